@@ -0,0 +1,331 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJAPerfSuiteAPI.hpp"
+#include "RAJAPerfSuiteAPI.h"
+
+#include "common/RAJAPerfSuite.hpp"
+#include "common/RunParams.hpp"
+#include "common/KernelBase.hpp"
+
+#include <exception>
+#include <stdexcept>
+
+namespace rajaperf
+{
+namespace api
+{
+
+namespace
+{
+
+KernelID findKernelID(const std::string& name)
+{
+  for (size_t ik = 0; ik < getNumKernels(); ++ik) {
+    KernelID kid = static_cast<KernelID>(ik);
+    if ( name == getFullKernelName(kid) || name == getKernelName(kid) ) {
+      return kid;
+    }
+  }
+  throw std::invalid_argument("rajaperf: unknown kernel " + name);
+}
+
+} // end anonymous namespace
+
+//
+// The kernel holds a reference to its run params, so they live with it.
+//
+struct Kernel::Impl
+{
+  RunParams run_params;
+  KernelBase* kernel = nullptr;
+  VariantID vid = NumVariants;
+  size_t tune_idx = 0;
+
+  ~Impl() { delete kernel; }
+
+  VariantID getVariantID(const std::string& variant) const
+  {
+    for (size_t iv = 0; iv < NumVariants; ++iv) {
+      VariantID a_vid = static_cast<VariantID>(iv);
+      if ( variant == getVariantName(a_vid) &&
+           isVariantAvailable(a_vid) && kernel->hasVariantDefined(a_vid) ) {
+        return a_vid;
+      }
+    }
+    throw std::invalid_argument("rajaperf: " + kernel->getName() +
+                                " has no variant " + variant);
+  }
+
+  void checkRun() const
+  {
+    if (vid == NumVariants) {
+      throw std::logic_error("rajaperf: " + kernel->getName() +
+                             " has not been run");
+    }
+  }
+};
+
+std::vector<std::string> Kernel::getKernelNames()
+{
+  std::vector<std::string> names;
+  for (size_t ik = 0; ik < getNumKernels(); ++ik) {
+    names.emplace_back( getFullKernelName(static_cast<KernelID>(ik)) );
+  }
+  return names;
+}
+
+Kernel::Kernel(const std::string& name, double size)
+  : m_impl(new Impl)
+{
+  KernelID kid = findKernelID(name);
+  if (size > 0.0) {
+    m_impl->run_params.setSize(size);
+  }
+  m_impl->kernel = getKernelObject(kid, m_impl->run_params);
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  m_impl->kernel->caliperOff();
+#endif
+}
+
+Kernel::~Kernel()
+{
+}
+
+const std::string& Kernel::getName() const
+{
+  return m_impl->kernel->getName();
+}
+
+long Kernel::getProblemSize() const
+{
+  return m_impl->kernel->getActualProblemSize();
+}
+
+std::vector<std::string> Kernel::getVariantNames() const
+{
+  std::vector<std::string> names;
+  for (size_t iv = 0; iv < NumVariants; ++iv) {
+    VariantID vid = static_cast<VariantID>(iv);
+    if ( isVariantAvailable(vid) && m_impl->kernel->hasVariantDefined(vid) ) {
+      names.emplace_back( getVariantName(vid) );
+    }
+  }
+  return names;
+}
+
+std::vector<std::string> Kernel::getTuningNames(const std::string& variant) const
+{
+  VariantID vid = m_impl->getVariantID(variant);
+  return m_impl->kernel->getVariantTuningNames(vid);
+}
+
+void Kernel::setReps(long reps)
+{
+  if (reps < 0) {
+    throw std::invalid_argument("rajaperf: reps must be at least 0");
+  }
+  m_impl->kernel->setCalibratedReps(reps);
+}
+
+long Kernel::getReps() const
+{
+  return m_impl->kernel->getRunReps();
+}
+
+void Kernel::run(const std::string& variant, const std::string& tuning)
+{
+  KernelBase* kernel = m_impl->kernel;
+  VariantID vid = m_impl->getVariantID(variant);
+  size_t tune_idx = kernel->getVariantTuningIndex(vid, tuning);
+  if (tune_idx == KernelBase::getUnknownTuningIdx()) {
+    throw std::invalid_argument("rajaperf: " + kernel->getName() + " " +
+                                variant + " has no tuning " + tuning);
+  }
+  kernel->execute(vid, tune_idx);
+  m_impl->vid = vid;
+  m_impl->tune_idx = tune_idx;
+}
+
+double Kernel::getLastTime() const
+{
+  m_impl->checkRun();
+  return m_impl->kernel->getLastTime();
+}
+
+double Kernel::getMinTime() const
+{
+  m_impl->checkRun();
+  return m_impl->kernel->getMinTime(m_impl->vid, m_impl->tune_idx);
+}
+
+long double Kernel::getLastChecksum() const
+{
+  m_impl->checkRun();
+  return m_impl->kernel->getPassChecksums(m_impl->vid, m_impl->tune_idx).back();
+}
+
+long Kernel::getItsPerRep() const
+{
+  return m_impl->kernel->getItsPerRep();
+}
+
+long Kernel::getBytesPerRep() const
+{
+  if (m_impl->vid == NumVariants) {
+    return m_impl->kernel->getBytesPerRep();
+  }
+  return m_impl->kernel->getBytesPerRep(m_impl->vid, m_impl->tune_idx);
+}
+
+long Kernel::getFLOPsPerRep() const
+{
+  if (m_impl->vid == NumVariants) {
+    return m_impl->kernel->getFLOPsPerRep();
+  }
+  return m_impl->kernel->getFLOPsPerRep(m_impl->vid, m_impl->tune_idx);
+}
+
+} // end namespace api
+} // end namespace rajaperf
+
+
+//
+// C interface, exceptions are caught here and kept as the last error.
+//
+struct rajaperf_kernel
+{
+  rajaperf::api::Kernel kernel;
+
+  rajaperf_kernel(const char* name, double size)
+    : kernel(name, size)
+  { }
+};
+
+namespace
+{
+
+thread_local std::string rajaperf_error;
+
+std::vector<std::string> const& rajaperf_kernel_names()
+{
+  static const std::vector<std::string> names =
+      rajaperf::api::Kernel::getKernelNames();
+  return names;
+}
+
+template < typename Func >
+int rajaperf_try(Func&& func)
+{
+  try {
+    func();
+  } catch (std::exception const& e) {
+    rajaperf_error = e.what();
+    return 1;
+  }
+  return 0;
+}
+
+} // end anonymous namespace
+
+extern "C" {
+
+int rajaperf_num_kernels(void)
+{
+  return static_cast<int>(rajaperf_kernel_names().size());
+}
+
+const char* rajaperf_kernel_name(int i)
+{
+  std::vector<std::string> const& names = rajaperf_kernel_names();
+  if (i < 0 || static_cast<size_t>(i) >= names.size()) {
+    return nullptr;
+  }
+  return names[i].c_str();
+}
+
+rajaperf_kernel* rajaperf_kernel_create(const char* name, double size)
+{
+  rajaperf_kernel* kernel = nullptr;
+  rajaperf_try([&]() {
+    if (name == nullptr) {
+      throw std::invalid_argument("rajaperf: kernel name is NULL");
+    }
+    kernel = new rajaperf_kernel(name, size);
+  });
+  return kernel;
+}
+
+void rajaperf_kernel_destroy(rajaperf_kernel* kernel)
+{
+  delete kernel;
+}
+
+long rajaperf_kernel_problem_size(const rajaperf_kernel* kernel)
+{
+  return kernel->kernel.getProblemSize();
+}
+
+int rajaperf_kernel_set_reps(rajaperf_kernel* kernel, long reps)
+{
+  return rajaperf_try([&]() { kernel->kernel.setReps(reps); });
+}
+
+int rajaperf_kernel_run(rajaperf_kernel* kernel,
+                        const char* variant, const char* tuning)
+{
+  return rajaperf_try([&]() {
+    if (variant == nullptr) {
+      throw std::invalid_argument("rajaperf: variant name is NULL");
+    }
+    kernel->kernel.run(variant, (tuning != nullptr) ? tuning : "default");
+  });
+}
+
+double rajaperf_kernel_last_time(const rajaperf_kernel* kernel)
+{
+  double time = -1.0;
+  rajaperf_try([&]() { time = kernel->kernel.getLastTime(); });
+  return time;
+}
+
+double rajaperf_kernel_min_time(const rajaperf_kernel* kernel)
+{
+  double time = -1.0;
+  rajaperf_try([&]() { time = kernel->kernel.getMinTime(); });
+  return time;
+}
+
+long double rajaperf_kernel_last_checksum(const rajaperf_kernel* kernel)
+{
+  long double checksum = 0.0L;
+  rajaperf_try([&]() { checksum = kernel->kernel.getLastChecksum(); });
+  return checksum;
+}
+
+long rajaperf_kernel_its_per_rep(const rajaperf_kernel* kernel)
+{
+  return kernel->kernel.getItsPerRep();
+}
+
+long rajaperf_kernel_bytes_per_rep(const rajaperf_kernel* kernel)
+{
+  return kernel->kernel.getBytesPerRep();
+}
+
+long rajaperf_kernel_flops_per_rep(const rajaperf_kernel* kernel)
+{
+  return kernel->kernel.getFLOPsPerRep();
+}
+
+const char* rajaperf_last_error(void)
+{
+  return rajaperf_error.c_str();
+}
+
+} // extern "C"
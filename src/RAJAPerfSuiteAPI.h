@@ -0,0 +1,57 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+/* Copyright (c) 2017-23, Lawrence Livermore National Security, LLC          */
+/* and RAJA Performance Suite project contributors.                          */
+/* See the RAJAPerf/LICENSE file for details.                                */
+/*                                                                           */
+/* SPDX-License-Identifier: (BSD-3-Clause)                                   */
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*
+ * C interface of the rajaperf library, see RAJAPerfSuiteAPI.hpp. Functions
+ * returning int return 0 on success and nonzero on error; the message of
+ * the last error is given by rajaperf_last_error.
+ */
+
+#ifndef RAJAPerfSuiteAPI_H
+#define RAJAPerfSuiteAPI_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct rajaperf_kernel rajaperf_kernel;
+
+int rajaperf_num_kernels(void);
+/* full name of kernel i, NULL if i is out of range */
+const char* rajaperf_kernel_name(int i);
+
+/* size 0 -> default problem size; NULL if there is no kernel named name */
+rajaperf_kernel* rajaperf_kernel_create(const char* name, double size);
+void rajaperf_kernel_destroy(rajaperf_kernel* kernel);
+
+long rajaperf_kernel_problem_size(const rajaperf_kernel* kernel);
+
+/* reps 0 -> default reps of the kernel */
+int rajaperf_kernel_set_reps(rajaperf_kernel* kernel, long reps);
+
+/* tuning NULL -> "default" */
+int rajaperf_kernel_run(rajaperf_kernel* kernel,
+                        const char* variant, const char* tuning);
+
+/* results of the last run, time in seconds */
+double rajaperf_kernel_last_time(const rajaperf_kernel* kernel);
+double rajaperf_kernel_min_time(const rajaperf_kernel* kernel);
+long double rajaperf_kernel_last_checksum(const rajaperf_kernel* kernel);
+
+/* work of one rep of the last run */
+long rajaperf_kernel_its_per_rep(const rajaperf_kernel* kernel);
+long rajaperf_kernel_bytes_per_rep(const rajaperf_kernel* kernel);
+long rajaperf_kernel_flops_per_rep(const rajaperf_kernel* kernel);
+
+const char* rajaperf_last_error(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* closing endif for header file include guard */
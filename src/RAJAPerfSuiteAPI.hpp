@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// C++ interface of the rajaperf library, for harnesses that run suite
+/// kernels themselves instead of through the raja-perf.exe command line.
+///
+/// The interface does not include suite headers, so code using it does not
+/// depend on the suite internals. A kernel runs with the default suite
+/// parameters, the size, and the reps given here, and writes no output
+/// files.
+///
+///   rajaperf::api::Kernel kernel("Stream_TRIAD", 1000000);
+///   kernel.setReps(10);
+///   kernel.run("Base_Seq");
+///   double time = kernel.getLastTime();
+///
+
+#ifndef RAJAPerfSuiteAPI_HPP
+#define RAJAPerfSuiteAPI_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+namespace api
+{
+
+class Kernel
+{
+public:
+  //
+  // Full names, ie. Stream_TRIAD, of all kernels in the suite.
+  //
+  static std::vector<std::string> getKernelNames();
+
+  //
+  // Create the kernel with the given full or short name. A size of 0 uses
+  // the default problem size of the kernel. Throws std::invalid_argument
+  // if there is no kernel with the name.
+  //
+  explicit Kernel(const std::string& name, double size = 0.0);
+  ~Kernel();
+
+  Kernel(Kernel const&) = delete;
+  Kernel& operator=(Kernel const&) = delete;
+
+  const std::string& getName() const;
+  long getProblemSize() const;
+
+  // Variants the kernel defines that are available in this build
+  std::vector<std::string> getVariantNames() const;
+  // Throws std::invalid_argument for an unknown variant
+  std::vector<std::string> getTuningNames(const std::string& variant) const;
+
+  //
+  // Reps of each run, 0 -> the default reps of the kernel.
+  //
+  void setReps(long reps);
+  long getReps() const;
+
+  //
+  // Run one pass of the reps of the variant and tuning. Throws
+  // std::invalid_argument for an unknown variant or tuning.
+  //
+  void run(const std::string& variant,
+           const std::string& tuning = "default");
+
+  // Time in seconds of the reps of the last run
+  double getLastTime() const;
+  // Minimum time in seconds over all runs of the last variant and tuning
+  double getMinTime() const;
+  // Checksum of the result of the last run
+  long double getLastChecksum() const;
+
+  // Work of one rep of the last variant and tuning run, of the default
+  // tuning before the first run
+  long getItsPerRep() const;
+  long getBytesPerRep() const;
+  long getFLOPsPerRep() const;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> m_impl;
+};
+
+} // end namespace api
+} // end namespace rajaperf
+
+#endif  // closing endif for header file include guard
@@ -11,6 +11,7 @@
 #endif
 
 #include "common/Executor.hpp"
+#include "common/ShmemUtils.hpp"
 
 #include <iostream>
 
@@ -48,14 +49,20 @@ int main( int argc, char** argv )
   // STEP 5: Generate suite execution reports
   executor.outputRunData();
 
+  // STEP 6: Exit with nonzero status if the run regressed vs. '--compare-to'
+  const int exit_status = executor.getExitStatus();
+
   rajaperf::getCout() << "\n\nDONE!!!...." << std::endl;
 
 #if defined(RUN_KOKKOS)
   Kokkos::finalize();
 #endif
+#if defined(RAJA_PERFSUITE_ENABLE_SHMEM)
+  rajaperf::detail::finalizeShmem();
+#endif
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
   MPI_Finalize();
 #endif
 
-  return 0;
+  return exit_status;
 }
@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MEMSET.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace algorithm {
+
+void MEMSET::runKokkosVariantLibrary(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  MEMSET_DATA_SETUP;
+
+  auto x_view = getViewFromPointer(x, iend);
+
+  // Point the kernel data at the View allocation so MEMSET_BODY can be
+  // used unchanged in the Kokkos lambda
+  x = x_view.data();
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::deep_copy(x_view, val);
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  MEMSET : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(m_x, x_view, iend);
+}
+
+void MEMSET::runKokkosVariantDefault(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMSET_DATA_SETUP;
+
+  auto x_view = getViewFromPointer(x, iend);
+
+  // Point the kernel data at the View allocation so MEMSET_BODY can be
+  // used unchanged in the Kokkos lambda
+  x = x_view.data();
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "MEMSET_Kokkos Kokkos_Lambda",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            MEMSET_BODY;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  MEMSET : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(m_x, x_view, iend);
+}
+
+void MEMSET::runKokkosVariant(VariantID vid, size_t tune_idx) {
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runKokkosVariantLibrary(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runKokkosVariantDefault(vid);
+  }
+  t += 1;
+}
+
+void MEMSET::setKokkosTuningDefinitions(VariantID vid) {
+  addVariantTuningName(vid, "library");
+
+  addVariantTuningName(vid, "default");
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SCAN.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace algorithm {
+
+template < typename Data_type >
+void SCAN::runKokkosVariantTyped(VariantID vid,
+                                 size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_DATA_SETUP;
+
+  auto x_view = getViewFromPointer(x, iend);
+  auto y_view = getViewFromPointer(y, iend);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // exclusive scan, y[i] is written before x[i] is added
+      Kokkos::parallel_scan(
+          "SCAN_Kokkos Kokkos_Lambda",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i, Data_type &scan_var, const bool final) {
+            if (final) {
+              y_view[i] = scan_var;
+            }
+            scan_var += x_view[i];
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  SCAN : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(y, y_view, iend);
+}
+
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SCAN, Kokkos)
+
+} // end namespace algorithm
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SORT.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <Kokkos_Sort.hpp>
+#include <iostream>
+
+namespace rajaperf {
+namespace algorithm {
+
+template < typename Data_type >
+void SORT::runKokkosVariantTyped(VariantID vid,
+                                 size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  auto x_view = getViewFromPointer(x, iend * run_reps);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // each rep sorts a different section of the data
+      Kokkos::sort(Kokkos::subview(
+          x_view, std::make_pair(iend * irep, iend * (irep + 1))));
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  SORT : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(x, x_view, iend * run_reps);
+}
+
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SORT, Kokkos)
+
+void SORT::setKokkosTuningDefinitions(VariantID vid) {
+  addKeyOrderTuningNames(vid, "");
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
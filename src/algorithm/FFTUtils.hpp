@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Stockham FFT stages used by the FFT kernels.
+///
+/// A forward FFT of length len is done in stages that each read every
+/// element from one buffer and write it to another, so no bit reversal
+/// pass is needed. Stage items are independent butterflies, a stage of
+/// radix r over num_lines transforms has num_lines*len/r items.
+///
+/// Transforms lie along lines of a multidimensional array, the elements
+/// of line l are at fftLineBase(l, len, stride) + stride*idx for idx in
+/// [0, len). Stride 1 gives contiguous batched 1D transforms and stride
+/// n^d gives the transforms along dimension d of an n^3 array.
+///
+
+#ifndef RAJAPerf_FFTUtils_HPP
+#define RAJAPerf_FFTUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include <cmath>
+#include <vector>
+
+#if defined(RAJA_PERFSUITE_USE_FFTW)
+#include <fftw3.h>
+#endif
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+/*!
+ * \brief One pass over all elements of a Stockham FFT.
+ *
+ * The stage combines radix sub-transforms of length len/(s*radix),
+ * interleaved with stride s, into sub-transforms of length len/s.
+ */
+struct FFTStage
+{
+  Index_type radix;
+  Index_type s;
+  Index_type stride;
+};
+
+/*!
+ * \brief Append the stages of a length len FFT along lines with the given
+ * stride to stages.
+ *
+ * max_radix 2 uses only radix 2 stages, max_radix 4 uses radix 4 stages
+ * after a radix 2 stage when log2(len) is odd.
+ */
+inline void appendFFTStages(std::vector<FFTStage>& stages,
+                            Index_type len, Index_type stride,
+                            Index_type max_radix)
+{
+  Index_type log2_len = 0;
+  while ( (Index_type(1) << log2_len) < len ) {
+    ++log2_len;
+  }
+
+  Index_type s = 1;
+  if ( max_radix < 4 || log2_len % 2 != 0 ) {
+    stages.push_back(FFTStage{2, s, stride});
+    s *= 2;
+  }
+  while ( s < len ) {
+    const Index_type radix = (max_radix < 4) ? 2 : 4;
+    stages.push_back(FFTStage{radix, s, stride});
+    s *= radix;
+  }
+}
+
+/*!
+ * \brief Set tw[k] = exp(-2 pi i k / len) for k in [0, len).
+ */
+inline void initFFTTwiddles(Complex_ptr tw, Index_type len)
+{
+  const Real_type pi = 3.14159265358979323846;
+  for (Index_type k = 0; k < len; ++k) {
+    const Real_type theta = 2.0 * pi * k / len;
+    tw[k] = Complex_type(std::cos(theta), -std::sin(theta));
+  }
+}
+
+/*!
+ * \brief Offset of the first element of line in an array whose lines of
+ * length len are stride apart.
+ */
+RAJA_HOST_DEVICE
+RAJA_INLINE Index_type fftLineBase(Index_type line, Index_type len,
+                                   Index_type stride)
+{
+  return (line % stride) + (line / stride) * stride * len;
+}
+
+/*!
+ * \brief Butterfly item of a radix 2 stage.
+ */
+RAJA_HOST_DEVICE
+RAJA_INLINE void fftRadix2Butterfly(const Complex_type* src, Complex_ptr dst,
+                                    const Complex_type* tw, Index_type len,
+                                    Index_type s, Index_type stride,
+                                    Index_type item)
+{
+  const Index_type items_per_line = len / 2;
+  const Index_type line = item / items_per_line;
+  const Index_type b = item % items_per_line;
+  const Index_type p = b / s;
+  const Index_type q = b % s;
+  const Index_type m = items_per_line / s;
+
+  const Index_type base = fftLineBase(line, len, stride);
+
+  const Complex_type a0 = src[base + stride*(q + s*(p + 0*m))];
+  const Complex_type a1 = src[base + stride*(q + s*(p + 1*m))];
+
+  dst[base + stride*(q + s*(2*p + 0))] = a0 + a1;
+  dst[base + stride*(q + s*(2*p + 1))] = (a0 - a1) * tw[p*s];
+}
+
+/*!
+ * \brief Butterfly item of a radix 4 stage.
+ */
+RAJA_HOST_DEVICE
+RAJA_INLINE void fftRadix4Butterfly(const Complex_type* src, Complex_ptr dst,
+                                    const Complex_type* tw, Index_type len,
+                                    Index_type s, Index_type stride,
+                                    Index_type item)
+{
+  const Index_type items_per_line = len / 4;
+  const Index_type line = item / items_per_line;
+  const Index_type b = item % items_per_line;
+  const Index_type p = b / s;
+  const Index_type q = b % s;
+  const Index_type m = items_per_line / s;
+
+  const Index_type base = fftLineBase(line, len, stride);
+
+  const Complex_type a0 = src[base + stride*(q + s*(p + 0*m))];
+  const Complex_type a1 = src[base + stride*(q + s*(p + 1*m))];
+  const Complex_type a2 = src[base + stride*(q + s*(p + 2*m))];
+  const Complex_type a3 = src[base + stride*(q + s*(p + 3*m))];
+
+  const Complex_type apc = a0 + a2;
+  const Complex_type amc = a0 - a2;
+  const Complex_type bpd = a1 + a3;
+  // i * (a1 - a3)
+  const Complex_type jbmd(imag(a3) - imag(a1), real(a1) - real(a3));
+
+  dst[base + stride*(q + s*(4*p + 0))] = apc + bpd;
+  dst[base + stride*(q + s*(4*p + 1))] = (amc - jbmd) * tw[1*p*s];
+  dst[base + stride*(q + s*(4*p + 2))] = (apc - bpd) * tw[2*p*s];
+  dst[base + stride*(q + s*(4*p + 3))] = (amc + jbmd) * tw[3*p*s];
+}
+
+}  // closing brace for algorithm namespace
+}  // closing brace for rajaperf namespace
+
+//
+// Stage loop variables and butterfly body shared by the FFT kernels.
+//
+// The last stage writes y and the stages before it alternate between
+// work and y, the first stage reads x.
+//
+#define FFT_STAGE_SETUP \
+  const Index_type radix = stages[st].radix; \
+  const Index_type s = stages[st].s; \
+  const Index_type stride = stages[st].stride; \
+  const Complex_type* src = (st == 0) ? x : \
+      (((num_stages-st) % 2 == 0) ? y : work); \
+  Complex_ptr dst = ((num_stages-1-st) % 2 == 0) ? y : work; \
+  const Index_type num_items = num_lines * (len / radix);
+
+#define FFT_STAGE_BODY \
+  if (radix == 4) { \
+    fftRadix4Butterfly(src, dst, twiddle, len, s, stride, i); \
+  } else { \
+    fftRadix2Butterfly(src, dst, twiddle, len, s, stride, i); \
+  }
+
+#endif  // closing endif for header file include guard
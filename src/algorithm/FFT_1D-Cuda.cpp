@@ -0,0 +1,237 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include "FFTUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fft_1d_stage(const Complex_type* src, Complex_ptr dst,
+                             const Complex_type* twiddle,
+                             Index_type len, Index_type radix,
+                             Index_type s, Index_type stride,
+                             Index_type num_items)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < num_items) {
+     FFT_STAGE_BODY;
+   }
+}
+
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+void FFT_1D::runCudaVariantCufft(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  FFT_1D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    int n = len;
+#if defined(RP_USE_DOUBLE)
+    const cufftType type = CUFFT_Z2Z;
+#else
+    const cufftType type = CUFFT_C2C;
+#endif
+
+    cufftHandle plan;
+    cufftErrchk( cufftPlanMany(&plan, 1, &n, nullptr, 1, len,
+                                             nullptr, 1, len,
+                               type, num_lines) );
+    cufftErrchk( cufftSetStream(plan, res.get_stream()) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RP_USE_DOUBLE)
+      cufftErrchk( cufftExecZ2Z(plan, reinterpret_cast<cufftDoubleComplex*>(x),
+                                      reinterpret_cast<cufftDoubleComplex*>(y),
+                                CUFFT_FORWARD) );
+#else
+      cufftErrchk( cufftExecC2C(plan, reinterpret_cast<cufftComplex*>(x),
+                                      reinterpret_cast<cufftComplex*>(y),
+                                CUFFT_FORWARD) );
+#endif
+
+    }
+    stopTimer();
+
+    cufftErrchk( cufftDestroy(plan) );
+
+    RAJA_UNUSED_VAR(work);
+    RAJA_UNUSED_VAR(twiddle);
+
+  } else {
+     getCout() << "\n  FFT_1D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+template < size_t block_size >
+void FFT_1D::runCudaVariantStockham(VariantID vid, Index_type max_radix)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  FFT_1D_DATA_SETUP;
+
+  FFT_1D_STAGES_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type st = 0; st < num_stages; ++st) {
+        FFT_STAGE_SETUP;
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_items, block_size);
+        constexpr size_t shmem = 0;
+        fft_1d_stage<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( src, dst,
+                                                   twiddle,
+                                                   len, radix,
+                                                   s, stride,
+                                                   num_items );
+        cudaErrchk( cudaGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type st = 0; st < num_stages; ++st) {
+        FFT_STAGE_SETUP;
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_items, block_size);
+        constexpr size_t shmem = 0;
+        lambda_cuda_forall<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          0, num_items, [=] __device__ (Index_type i) {
+          FFT_STAGE_BODY;
+        });
+        cudaErrchk( cudaGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type st = 0; st < num_stages; ++st) {
+        FFT_STAGE_SETUP;
+        RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+          RAJA::RangeSegment(0, num_items), [=] __device__ (Index_type i) {
+          FFT_STAGE_BODY;
+        });
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FFT_1D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void FFT_1D::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+  if ( vid == Base_CUDA ) {
+
+    if (tune_idx == t) {
+
+      runCudaVariantCufft(vid);
+
+    }
+
+    t += 1;
+
+  }
+#endif
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runCudaVariantStockham<block_size>(vid, 2);
+
+      }
+
+      t += 1;
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runCudaVariantStockham<block_size>(vid, 4);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+}
+
+void FFT_1D::setCudaTuningDefinitions(VariantID vid)
+{
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+  if ( vid == Base_CUDA ) {
+
+    addVariantTuningName(vid, "cufft");
+
+  }
+#endif
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "radix_2_block_"+std::to_string(block_size));
+
+      addVariantTuningName(vid, "radix_4_block_"+std::to_string(block_size));
+
+    }
+
+  });
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,254 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include "FFTUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fft_1d_stage(const Complex_type* src, Complex_ptr dst,
+                             const Complex_type* twiddle,
+                             Index_type len, Index_type radix,
+                             Index_type s, Index_type stride,
+                             Index_type num_items)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < num_items) {
+     FFT_STAGE_BODY;
+   }
+}
+
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+void FFT_1D::runHipVariantRocfft(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  FFT_1D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    rocfftErrchk( rocfft_setup() );
+
+#if defined(RP_USE_DOUBLE)
+    const rocfft_precision precision = rocfft_precision_double;
+#else
+    const rocfft_precision precision = rocfft_precision_single;
+#endif
+    const size_t lengths[1] = { static_cast<size_t>(len) };
+
+    rocfft_plan plan = nullptr;
+    rocfftErrchk( rocfft_plan_create(&plan, rocfft_placement_notinplace,
+                                     rocfft_transform_type_complex_forward,
+                                     precision, 1, lengths, num_lines,
+                                     nullptr) );
+
+    rocfft_execution_info info = nullptr;
+    rocfftErrchk( rocfft_execution_info_create(&info) );
+    rocfftErrchk( rocfft_execution_info_set_stream(info, res.get_stream()) );
+
+    size_t work_bytes = 0;
+    rocfftErrchk( rocfft_plan_get_work_buffer_size(plan, &work_bytes) );
+    unsigned char* work_buffer = nullptr;
+    if (work_bytes > 0) {
+      allocData(DataSpace::HipDevice, work_buffer, work_bytes);
+      rocfftErrchk( rocfft_execution_info_set_work_buffer(info, work_buffer, work_bytes) );
+    }
+
+    void* in_buffers[1] = { x };
+    void* out_buffers[1] = { y };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      rocfftErrchk( rocfft_execute(plan, in_buffers, out_buffers, info) );
+
+    }
+    stopTimer();
+
+    if (work_buffer != nullptr) {
+      deallocData(DataSpace::HipDevice, work_buffer);
+    }
+    rocfftErrchk( rocfft_execution_info_destroy(info) );
+    rocfftErrchk( rocfft_plan_destroy(plan) );
+
+    rocfftErrchk( rocfft_cleanup() );
+
+    RAJA_UNUSED_VAR(work);
+    RAJA_UNUSED_VAR(twiddle);
+
+  } else {
+     getCout() << "\n  FFT_1D : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+template < size_t block_size >
+void FFT_1D::runHipVariantStockham(VariantID vid, Index_type max_radix)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  FFT_1D_DATA_SETUP;
+
+  FFT_1D_STAGES_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type st = 0; st < num_stages; ++st) {
+        FFT_STAGE_SETUP;
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_items, block_size);
+        constexpr size_t shmem = 0;
+        hipLaunchKernelGGL((fft_1d_stage<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), src, dst,
+                                                   twiddle,
+                                                   len, radix,
+                                                   s, stride,
+                                                   num_items );
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type st = 0; st < num_stages; ++st) {
+        FFT_STAGE_SETUP;
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_items, block_size);
+        constexpr size_t shmem = 0;
+        auto fft_1d_lambda = [=] __device__ (Index_type i) {
+          FFT_STAGE_BODY;
+        };
+
+        hipLaunchKernelGGL((lambda_hip_forall<block_size, decltype(fft_1d_lambda)>),
+          grid_size, block_size, shmem, res.get_stream(), 0, num_items, fft_1d_lambda);
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type st = 0; st < num_stages; ++st) {
+        FFT_STAGE_SETUP;
+        RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+          RAJA::RangeSegment(0, num_items), [=] __device__ (Index_type i) {
+          FFT_STAGE_BODY;
+        });
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FFT_1D : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void FFT_1D::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+  if ( vid == Base_HIP ) {
+
+    if (tune_idx == t) {
+
+      runHipVariantRocfft(vid);
+
+    }
+
+    t += 1;
+
+  }
+#endif
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runHipVariantStockham<block_size>(vid, 2);
+
+      }
+
+      t += 1;
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runHipVariantStockham<block_size>(vid, 4);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+}
+
+void FFT_1D::setHipTuningDefinitions(VariantID vid)
+{
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+  if ( vid == Base_HIP ) {
+
+    addVariantTuningName(vid, "rocfft");
+
+  }
+#endif
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "radix_2_block_"+std::to_string(block_size));
+
+      addVariantTuningName(vid, "radix_4_block_"+std::to_string(block_size));
+
+    }
+
+  });
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
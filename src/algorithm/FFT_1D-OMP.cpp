@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "FFTUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void FFT_1D::runOpenMPVariantStockham(VariantID vid, Index_type max_radix)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  FFT_1D_DATA_SETUP;
+
+  FFT_1D_STAGES_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type st = 0; st < num_stages; ++st) {
+          FFT_STAGE_SETUP;
+          #pragma omp parallel for
+          for (Index_type i = 0; i < num_items; ++i) {
+            FFT_STAGE_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type st = 0; st < num_stages; ++st) {
+          FFT_STAGE_SETUP;
+          auto fft_1d_lam = [=](Index_type i) {
+                              FFT_STAGE_BODY;
+                            };
+          #pragma omp parallel for
+          for (Index_type i = 0; i < num_items; ++i) {
+            fft_1d_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type st = 0; st < num_stages; ++st) {
+          FFT_STAGE_SETUP;
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, num_items), [=](Index_type i) {
+            FFT_STAGE_BODY;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+    default : {
+      getCout() << "\n  FFT_1D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(max_radix);
+#endif
+}
+
+void FFT_1D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantStockham(vid, 2);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantStockham(vid, 4);
+  }
+  t += 1;
+}
+
+void FFT_1D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "radix_2");
+
+  addVariantTuningName(vid, "radix_4");
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,174 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "FFTUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+#if defined(RAJA_PERFSUITE_USE_FFTW) && defined(RP_USE_DOUBLE)
+void FFT_1D::runSeqVariantFFTW(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  FFT_1D_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    int n = len;
+    fftw_plan plan = fftw_plan_many_dft(1, &n, num_lines,
+                                        reinterpret_cast<fftw_complex*>(x), nullptr, 1, len,
+                                        reinterpret_cast<fftw_complex*>(y), nullptr, 1, len,
+                                        FFTW_FORWARD, FFTW_ESTIMATE);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      fftw_execute(plan);
+
+    }
+    stopTimer();
+
+    fftw_destroy_plan(plan);
+
+    RAJA_UNUSED_VAR(work);
+    RAJA_UNUSED_VAR(twiddle);
+
+  } else {
+    getCout() << "\n  FFT_1D : Unknown Seq variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+void FFT_1D::runSeqVariantStockham(VariantID vid, Index_type max_radix)
+{
+  const Index_type run_reps = getRunReps();
+
+  FFT_1D_DATA_SETUP;
+
+  FFT_1D_STAGES_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type st = 0; st < num_stages; ++st) {
+          FFT_STAGE_SETUP;
+          for (Index_type i = 0; i < num_items; ++i) {
+            FFT_STAGE_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type st = 0; st < num_stages; ++st) {
+          FFT_STAGE_SETUP;
+          auto fft_1d_lam = [=](Index_type i) {
+                              FFT_STAGE_BODY;
+                            };
+          for (Index_type i = 0; i < num_items; ++i) {
+            fft_1d_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type st = 0; st < num_stages; ++st) {
+          FFT_STAGE_SETUP;
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, num_items), [=](Index_type i) {
+            FFT_STAGE_BODY;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FFT_1D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FFT_1D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+#if defined(RAJA_PERFSUITE_USE_FFTW) && defined(RP_USE_DOUBLE)
+  if (vid == Base_Seq) {
+    if (tune_idx == t) {
+      runSeqVariantFFTW(vid);
+    }
+    t += 1;
+  }
+#endif
+
+  if (tune_idx == t) {
+    runSeqVariantStockham(vid, 2);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantStockham(vid, 4);
+  }
+  t += 1;
+}
+
+void FFT_1D::setSeqTuningDefinitions(VariantID vid)
+{
+#if defined(RAJA_PERFSUITE_USE_FFTW) && defined(RP_USE_DOUBLE)
+  if (vid == Base_Seq) {
+    addVariantTuningName(vid, "fftw");
+  }
+#endif
+
+  addVariantTuningName(vid, "radix_2");
+
+  addVariantTuningName(vid, "radix_4");
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
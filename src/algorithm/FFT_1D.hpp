@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FFT_1D kernel reference implementation:
+///
+/// // forward FFT of each of num_batch contiguous length len transforms
+/// for (Index_type ibatch = 0; ibatch < num_batch; ++ibatch) {
+///   for (Index_type k = 0; k < len; ++k) {
+///     Complex_type sum = 0.0;
+///     for (Index_type j = 0; j < len; ++j) {
+///       sum += x[ibatch*len + j] * exp(-2 pi i j k / len);
+///     }
+///     y[ibatch*len + k] = sum;
+///   }
+/// }
+///
+/// len is given by --fft-size and the problem size sets num_batch.
+/// Tunings compute the transforms in Stockham radix 2 stages (radix_2),
+/// in radix 4 stages (radix_4), see algorithm/FFTUtils.hpp, or with the
+/// vendor library (fftw, cufft, rocfft).
+///
+
+#ifndef RAJAPerf_Algorithm_FFT_1D_HPP
+#define RAJAPerf_Algorithm_FFT_1D_HPP
+
+#define FFT_1D_DATA_SETUP \
+  Complex_ptr x = m_x; \
+  Complex_ptr y = m_y; \
+  Complex_ptr work = m_work; \
+  Complex_ptr twiddle = m_twiddle; \
+  const Index_type len = m_len; \
+  const Index_type num_lines = m_num_batch;
+
+#define FFT_1D_STAGES_SETUP \
+  std::vector<FFTStage> stages; \
+  appendFFTStages(stages, len, 1, max_radix); \
+  const Index_type num_stages = stages.size();
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class FFT_1D : public KernelBase
+{
+public:
+
+  FFT_1D(const RunParams& params);
+
+  ~FFT_1D();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void setOpenMPTargetTuningDefinitions(VariantID vid);
+
+  void runSeqVariantFFTW(VariantID vid);
+  void runSeqVariantStockham(VariantID vid, Index_type max_radix);
+  void runOpenMPVariantStockham(VariantID vid, Index_type max_radix);
+  void runOpenMPTargetVariantStockham(VariantID vid, Index_type max_radix);
+
+  void runCudaVariantCufft(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantStockham(VariantID vid, Index_type max_radix);
+  void runHipVariantRocfft(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantStockham(VariantID vid, Index_type max_radix);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type m_len;
+  Index_type m_num_batch;
+
+  Complex_ptr m_x;
+  Complex_ptr m_y;
+  Complex_ptr m_work;
+  Complex_ptr m_twiddle;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_3D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include "FFTUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+  //
+  // Define threads per team for target execution
+  //
+  const size_t threads_per_team = 256;
+
+
+void FFT_3D::runOpenMPTargetVariantStockham(VariantID vid, Index_type max_radix)
+{
+  const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
+
+  FFT_3D_DATA_SETUP;
+
+  FFT_3D_STAGES_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type st = 0; st < num_stages; ++st) {
+        FFT_STAGE_SETUP;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(src, dst, twiddle) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 0; i < num_items; ++i) {
+            FFT_STAGE_BODY;
+          }
+        } else {
+          #pragma omp target is_device_ptr(src, dst, twiddle) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 0; i < num_items; ++i) {
+            FFT_STAGE_BODY;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type st = 0; st < num_stages; ++st) {
+        FFT_STAGE_SETUP;
+        RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment(0, num_items), [=](Index_type i) {
+          FFT_STAGE_BODY;
+        });
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FFT_3D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+}
+
+void FFT_3D::runOpenMPTargetVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPTargetVariantStockham(vid, 2);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPTargetVariantStockham(vid, 4);
+  }
+  t += 1;
+}
+
+void FFT_3D::setOpenMPTargetTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "radix_2");
+
+  addVariantTuningName(vid, "radix_4");
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
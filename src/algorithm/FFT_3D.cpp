@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_3D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include "FFTUtils.hpp"
+
+#include <cmath>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+FFT_3D::FFT_3D(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_FFT_3D, params)
+{
+  setDefaultProblemSize(128*128*128);
+  setDefaultReps(50);
+
+  m_n = 2;
+  while ( (2*m_n)*(2*m_n)*(2*m_n) <= getTargetProblemSize() ) {
+    m_n *= 2;
+  }
+
+  setActualProblemSize( m_n*m_n*m_n );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // one read of x and one write of y, the traffic of intermediate stages
+  // depends on the tuning and is not counted
+  setBytesPerRep( (1*sizeof(Complex_type) + 1*sizeof(Complex_type)) * getActualProblemSize() );
+  // conventional 5 N log2(N) flop count of a length N complex FFT
+  setFLOPsPerRep(5 * getActualProblemSize() *
+                 3 * static_cast<Index_type>(std::log2(m_n) + 0.5));
+
+  checksum_scale_factor = 1e-3 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(GatherScatter);
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+FFT_3D::~FFT_3D()
+{
+}
+
+void FFT_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type size = getActualProblemSize();
+
+  allocAndInitData(m_x, size, vid);
+
+  allocData(m_y, size, vid);
+  allocData(m_work, size, vid);
+  allocData(m_twiddle, m_n, vid);
+  {
+    auto reset_y = scopedMoveData(m_y, size, vid);
+    auto reset_work = scopedMoveData(m_work, size, vid);
+    auto reset_twiddle = scopedMoveData(m_twiddle, m_n, vid);
+    for (Index_type i = 0; i < size; ++i) {
+      m_y[i] = Complex_type(0.0, 0.0);
+      m_work[i] = Complex_type(0.0, 0.0);
+    }
+    initFFTTwiddles(m_twiddle, m_n);
+  }
+}
+
+void FFT_3D::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, getActualProblemSize(), checksum_scale_factor, vid);
+}
+
+void FFT_3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+  deallocData(m_work, vid);
+  deallocData(m_twiddle, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
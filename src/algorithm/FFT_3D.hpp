@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FFT_3D kernel reference implementation:
+///
+/// // forward FFT of an n x n x n array, x index fastest
+/// for (Index_type k3 = 0; k3 < n; ++k3) {
+///   for (Index_type k2 = 0; k2 < n; ++k2) {
+///     for (Index_type k1 = 0; k1 < n; ++k1) {
+///       Complex_type sum = 0.0;
+///       for (Index_type j3 = 0; j3 < n; ++j3) {
+///         for (Index_type j2 = 0; j2 < n; ++j2) {
+///           for (Index_type j1 = 0; j1 < n; ++j1) {
+///             sum += x[j1 + n*(j2 + n*j3)] *
+///                    exp(-2 pi i (j1*k1 + j2*k2 + j3*k3) / n);
+///           }
+///         }
+///       }
+///       y[k1 + n*(k2 + n*k3)] = sum;
+///     }
+///   }
+/// }
+///
+/// n is the largest power of two whose cube is at most the problem size.
+/// Tunings compute the transform as 1D transforms along each dimension in
+/// turn in Stockham radix 2 stages (radix_2), in radix 4 stages (radix_4),
+/// see algorithm/FFTUtils.hpp, or with the vendor library (fftw, cufft,
+/// rocfft).
+///
+
+#ifndef RAJAPerf_Algorithm_FFT_3D_HPP
+#define RAJAPerf_Algorithm_FFT_3D_HPP
+
+#define FFT_3D_DATA_SETUP \
+  Complex_ptr x = m_x; \
+  Complex_ptr y = m_y; \
+  Complex_ptr work = m_work; \
+  Complex_ptr twiddle = m_twiddle; \
+  const Index_type n = m_n; \
+  const Index_type len = n; \
+  const Index_type num_lines = n*n;
+
+#define FFT_3D_STAGES_SETUP \
+  std::vector<FFTStage> stages; \
+  for (Index_type stride = 1; stride < n*n*n; stride *= n) { \
+    appendFFTStages(stages, n, stride, max_radix); \
+  } \
+  const Index_type num_stages = stages.size();
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class FFT_3D : public KernelBase
+{
+public:
+
+  FFT_3D(const RunParams& params);
+
+  ~FFT_3D();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void setOpenMPTargetTuningDefinitions(VariantID vid);
+
+  void runSeqVariantFFTW(VariantID vid);
+  void runSeqVariantStockham(VariantID vid, Index_type max_radix);
+  void runOpenMPVariantStockham(VariantID vid, Index_type max_radix);
+  void runOpenMPTargetVariantStockham(VariantID vid, Index_type max_radix);
+
+  void runCudaVariantCufft(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantStockham(VariantID vid, Index_type max_radix);
+  void runHipVariantRocfft(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantStockham(VariantID vid, Index_type max_radix);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type m_n;
+
+  Complex_ptr m_x;
+  Complex_ptr m_y;
+  Complex_ptr m_work;
+  Complex_ptr m_twiddle;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,202 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HASH_TABLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size, typename Key, bool cuckoo >
+__launch_bounds__(block_size)
+__global__ void hash_table_clear(Key* keys, Int64_type* entries,
+                                 Index_type capacity)
+{
+   Index_type s = blockIdx.x * block_size + threadIdx.x;
+   if (s < capacity) {
+     HASH_TABLE_CLEAR_BODY;
+   }
+}
+
+template < size_t block_size, typename Key, bool quadratic, bool cuckoo >
+__launch_bounds__(block_size)
+__global__ void hash_table_insert(Key* keys, Int_ptr vals, Int64_type* entries,
+                                  Key* ins, Index_type mask,
+                                  Index_type num_keys)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < num_keys) {
+     HASH_TABLE_INSERT_BODY(RAJA::cuda_atomic);
+   }
+}
+
+template < size_t block_size, typename Key, bool quadratic, bool cuckoo >
+__launch_bounds__(block_size)
+__global__ void hash_table_lookup(Key* keys, Int_ptr vals, Int64_type* entries,
+                                  Key* qry, Int_ptr out, Index_type mask,
+                                  Index_type num_keys)
+{
+   Index_type j = blockIdx.x * block_size + threadIdx.x;
+   if (j < num_keys) {
+     HASH_TABLE_LOOKUP_BODY;
+   }
+}
+
+
+template < size_t block_size, size_t table >
+void HASH_TABLE::runCudaVariantImpl(VariantID vid)
+{
+  constexpr HashProbe probe = getProbe<table>();
+  constexpr bool quadratic = (probe == HashProbe::quadratic);
+  constexpr bool cuckoo = (probe == HashProbe::cuckoo);
+  using Key = key_type<table>;
+
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  HASH_TABLE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      startPhaseTimer(s_clear_phase);
+      const size_t clear_grid_size = RAJA_DIVIDE_CEILING_INT(capacity, block_size);
+      hash_table_clear<block_size, Key, cuckoo><<<clear_grid_size, block_size, shmem, res.get_stream()>>>(
+          keys, entries, capacity );
+      cudaErrchk( cudaGetLastError() );
+      stopPhaseTimer(s_clear_phase);
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_keys, block_size);
+
+      startPhaseTimer(s_insert_phase);
+      hash_table_insert<block_size, Key, quadratic, cuckoo><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          keys, vals, entries, ins, mask, num_keys );
+      cudaErrchk( cudaGetLastError() );
+      stopPhaseTimer(s_insert_phase);
+
+      startPhaseTimer(s_lookup_phase);
+      hash_table_lookup<block_size, Key, quadratic, cuckoo><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          keys, vals, entries, qry, out, mask, num_keys );
+      cudaErrchk( cudaGetLastError() );
+      stopPhaseTimer(s_lookup_phase);
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      startPhaseTimer(s_clear_phase);
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, capacity), [=] __device__ (Index_type s) {
+        HASH_TABLE_CLEAR_BODY;
+      });
+      stopPhaseTimer(s_clear_phase);
+
+      startPhaseTimer(s_insert_phase);
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, num_keys), [=] __device__ (Index_type i) {
+        HASH_TABLE_INSERT_BODY(RAJA::cuda_atomic);
+      });
+      stopPhaseTimer(s_insert_phase);
+
+      startPhaseTimer(s_lookup_phase);
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, num_keys), [=] __device__ (Index_type j) {
+        HASH_TABLE_LOOKUP_BODY;
+      });
+      stopPhaseTimer(s_lookup_phase);
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  HASH_TABLE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+
+void HASH_TABLE::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    seq_for(table_tunings_type{}, [&](auto table) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantImpl<block_size, decltype(table)::value>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    });
+
+  } else {
+
+    getCout() << "\n  HASH_TABLE : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+void HASH_TABLE::setCudaTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    for (const std::string& name : getTableTuningNames()) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, name+"_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
+  }
+
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HASH_TABLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+template < size_t table >
+void HASH_TABLE::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  constexpr HashProbe probe = getProbe<table>();
+  constexpr bool quadratic = (probe == HashProbe::quadratic);
+  constexpr bool cuckoo = (probe == HashProbe::cuckoo);
+  using Key = key_type<table>;
+
+  const Index_type run_reps = getRunReps();
+
+  HASH_TABLE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        startPhaseTimer(s_clear_phase);
+        #pragma omp parallel for
+        for (Index_type s = 0; s < capacity; ++s ) {
+          HASH_TABLE_CLEAR_BODY;
+        }
+        stopPhaseTimer(s_clear_phase);
+
+        startPhaseTimer(s_insert_phase);
+        #pragma omp parallel for
+        for (Index_type i = 0; i < num_keys; ++i ) {
+          HASH_TABLE_INSERT_BODY(RAJA::omp_atomic);
+        }
+        stopPhaseTimer(s_insert_phase);
+
+        startPhaseTimer(s_lookup_phase);
+        #pragma omp parallel for
+        for (Index_type j = 0; j < num_keys; ++j ) {
+          HASH_TABLE_LOOKUP_BODY;
+        }
+        stopPhaseTimer(s_lookup_phase);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        startPhaseTimer(s_clear_phase);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, capacity), [=](Index_type s) {
+          HASH_TABLE_CLEAR_BODY;
+        });
+        stopPhaseTimer(s_clear_phase);
+
+        startPhaseTimer(s_insert_phase);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_keys), [=](Index_type i) {
+          HASH_TABLE_INSERT_BODY(RAJA::omp_atomic);
+        });
+        stopPhaseTimer(s_insert_phase);
+
+        startPhaseTimer(s_lookup_phase);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_keys), [=](Index_type j) {
+          HASH_TABLE_LOOKUP_BODY;
+        });
+        stopPhaseTimer(s_lookup_phase);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HASH_TABLE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HASH_TABLE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(table_tunings_type{}, [&](auto table) {
+    if (tune_idx == table) {
+      runOpenMPVariantImpl<table>(vid);
+    }
+  });
+}
+
+void HASH_TABLE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getTableTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,257 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HASH_TABLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+namespace
+{
+
+//
+// Distinct nonzero keys for indices i, the finalizer is a bijection that
+// only maps 0 to 0, and 0 is the empty key.
+//
+Int32_type makeKey32(Index_type i)
+{
+  unsigned int z = static_cast<unsigned int>(i + 1);
+  z ^= z >> 16;
+  z *= 0x85EBCA6Bu;
+  z ^= z >> 13;
+  z *= 0xC2B2AE35u;
+  z ^= z >> 16;
+  return static_cast<Int32_type>(z);
+}
+
+Int64_type makeKey64(Index_type i)
+{
+  unsigned long long z = static_cast<unsigned long long>(i + 1);
+  z ^= z >> 33;
+  z *= 0xFF51AFD7ED558CCDull;
+  z ^= z >> 33;
+  z *= 0xC4CEB9FE1A85EC53ull;
+  z ^= z >> 33;
+  return static_cast<Int64_type>(z);
+}
+
+} // end anonymous namespace
+
+
+HASH_TABLE::HASH_TABLE(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_HASH_TABLE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(20);
+
+  m_load_pct = getKernelParam("load_pct", 50, 1, 90);
+  m_hit_pct = getKernelParam("hit_pct", 50, 0, 100);
+
+  // smallest power of two table with the target number of keys at the
+  // load factor, the 32 bit keys of inserts and misses must be distinct
+  const Index_type min_capacity =
+      std::min(getTargetProblemSize(), Index_type(1) << 29) * 100 / m_load_pct;
+  m_capacity = 2;
+  while (m_capacity < min_capacity) {
+    m_capacity *= 2;
+  }
+
+  setActualProblemSize( std::max(Index_type(1), m_capacity * m_load_pct / 100) );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(3);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  setFLOPsPerRep(0);
+
+  checksum_scale_factor = 1.0;
+
+  setPhaseNames({"clear", "insert", "lookup"});
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setHasPattern(GatherScatter);
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+HASH_TABLE::~HASH_TABLE()
+{
+}
+
+const std::vector<std::string>& HASH_TABLE::getTableTuningNames()
+{
+  static const std::vector<std::string> names{
+      "linear_32", "linear_64",
+      "quadratic_32", "quadratic_64",
+      "cuckoo_32"};
+  return names;
+}
+
+//
+// Tunings before setting up the kernel tunings, ie. in the constructor, are
+// linear_32.
+//
+size_t HASH_TABLE::getTableTuning(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx < getNumVariantTunings(vid)) {
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+    const std::vector<std::string>& names = getTableTuningNames();
+    for (size_t t = 0; t < names.size(); ++t) {
+      if (tuning_name.compare(0, names[t].size(), names[t]) == 0) {
+        return t;
+      }
+    }
+  }
+  return 0;
+}
+
+//
+// Touched data size, not actual number of stores and loads, of clearing,
+// inserting into, and looking up in the table.
+//
+Index_type HASH_TABLE::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const size_t table = getTableTuning(vid, tune_idx);
+  const HashProbe probe = static_cast<HashProbe>(table / 2);
+  const size_t key_size = ((table % 2) == 1) ? sizeof(Int64_type) : sizeof(Int32_type);
+
+  const Index_type num_keys = getActualProblemSize();
+
+  const size_t slot_size = (probe == HashProbe::cuckoo)
+      ? sizeof(Int64_type) : key_size + sizeof(Int_type);
+
+  const Index_type clear_bytes = (1*slot_size + 0*slot_size) * m_capacity;
+  const Index_type insert_bytes = (1*slot_size + 1*slot_size) * m_capacity +
+                                  (0*key_size + 1*key_size) * num_keys;
+  const Index_type lookup_bytes = (0*slot_size + 1*slot_size) * m_capacity +
+                                  (1*sizeof(Int_type) + 1*key_size) * num_keys;
+  return clear_bytes + insert_bytes + lookup_bytes;
+}
+
+void HASH_TABLE::setUp(VariantID vid, size_t tune_idx)
+{
+  const size_t table = getTableTuning(vid, tune_idx);
+  const HashProbe probe = static_cast<HashProbe>(table / 2);
+  const bool wide = (table % 2) == 1;
+
+  const Index_type num_keys = getActualProblemSize();
+
+  constexpr unsigned long long hit_seed = 4111;
+  constexpr unsigned long long key_seed = 4127;
+
+  m_keys32 = nullptr;
+  m_keys64 = nullptr;
+  m_ins32 = nullptr;
+  m_ins64 = nullptr;
+  m_qry32 = nullptr;
+  m_qry64 = nullptr;
+  m_vals = nullptr;
+  m_entries = nullptr;
+
+  if (probe == HashProbe::cuckoo) {
+    allocAndInitDataConst(m_entries, m_capacity, Int64_type(0), vid);
+  } else {
+    if (wide) {
+      allocAndInitDataConst(m_keys64, m_capacity, Int64_type(0), vid);
+    } else {
+      allocAndInitDataConst(m_keys32, m_capacity, Int32_type(0), vid);
+    }
+    allocAndInitDataConst(m_vals, m_capacity, Int_type(-1), vid);
+  }
+
+  //
+  // Queries hit a random inserted key or miss with the keys after them.
+  //
+  std::vector<Index_type> qry_idx(num_keys);
+  for (Index_type j = 0; j < num_keys; ++j) {
+    const bool hit = detail::counterRandValue(hit_seed, j) * 100.0 < m_hit_pct;
+    qry_idx[j] = hit
+        ? std::min(num_keys-1,
+                   static_cast<Index_type>(num_keys * detail::counterRandValue(key_seed, j)))
+        : num_keys + j;
+  }
+
+  if (wide) {
+    allocData(m_ins64, num_keys, vid);
+    allocData(m_qry64, num_keys, vid);
+    auto reset_ins = scopedMoveData(m_ins64, num_keys, vid);
+    auto reset_qry = scopedMoveData(m_qry64, num_keys, vid);
+    for (Index_type i = 0; i < num_keys; ++i) {
+      m_ins64[i] = makeKey64(i);
+      m_qry64[i] = makeKey64(qry_idx[i]);
+    }
+  } else {
+    allocData(m_ins32, num_keys, vid);
+    allocData(m_qry32, num_keys, vid);
+    auto reset_ins = scopedMoveData(m_ins32, num_keys, vid);
+    auto reset_qry = scopedMoveData(m_qry32, num_keys, vid);
+    for (Index_type i = 0; i < num_keys; ++i) {
+      m_ins32[i] = makeKey32(i);
+      m_qry32[i] = makeKey32(qry_idx[i]);
+    }
+  }
+
+  allocAndInitDataConst(m_out, num_keys, Int_type(-2), vid);
+}
+
+void HASH_TABLE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_out, getActualProblemSize(),
+                                          checksum_scale_factor , vid);
+}
+
+void HASH_TABLE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+
+  if (m_entries != nullptr) {
+    deallocData(m_entries, vid);
+  }
+  if (m_keys32 != nullptr) {
+    deallocData(m_keys32, vid);
+  }
+  if (m_keys64 != nullptr) {
+    deallocData(m_keys64, vid);
+  }
+  if (m_vals != nullptr) {
+    deallocData(m_vals, vid);
+  }
+  if (m_ins32 != nullptr) {
+    deallocData(m_ins32, vid);
+    deallocData(m_qry32, vid);
+  }
+  if (m_ins64 != nullptr) {
+    deallocData(m_ins64, vid);
+    deallocData(m_qry64, vid);
+  }
+  deallocData(m_out, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,324 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HASH_TABLE kernel reference implementation:
+///
+/// Build an open addressing hash table of num_keys distinct keys, with the
+/// index of each key as its value, then look up num_keys query keys. Each
+/// rep clears, inserts into, and looks up in the table, and each of these
+/// phases is timed separately.
+///
+/// for (Index_type s = 0; s < capacity; ++s ) {
+///   keys[s] = empty;
+/// }
+/// for (Index_type i = 0; i < num_keys; ++i ) {
+///   Index_type s = hash(ins[i]);
+///   while (atomicCAS(&keys[s], empty, ins[i]) != empty) {
+///     s = next probe of s;
+///   }
+///   vals[s] = i;
+/// }
+/// for (Index_type j = 0; j < num_keys; ++j ) {
+///   Index_type s = hash(qry[j]);
+///   while (keys[s] != qry[j] && keys[s] != empty) {
+///     s = next probe of s;
+///   }
+///   out[j] = (keys[s] == qry[j]) ? vals[s] : -1;
+/// }
+///
+/// Tunings are a probing scheme and a key size, ie. quadratic_64. Probing
+/// schemes are
+///
+///   linear    -- probe consecutive slots
+///   quadratic -- probe slots at triangular number offsets, which visits
+///                every slot of a power of two table
+///   cuckoo    -- each key is in one of 3 slots given by 3 hashes, an insert
+///                swaps its key into a slot with atomicExchange and moves
+///                the key it evicts to the next of its slots, with keys and
+///                values packed in 64 bit entries so they move together
+///
+/// and key sizes are 32 and 64 bit. Cuckoo tables only have 32 bit keys.
+///
+/// The table has a power of two number of slots and the number of keys is
+/// the load factor load_pct percent of it. Queries hit a random inserted key
+/// with probability hit_pct percent and otherwise miss. All tunings find the
+/// same values, so give the same checksum. The load factor and hit ratio are
+/// kernel parameters, given with '--kernel-param HASH_TABLE:load_pct=<n>'
+/// and '--kernel-param HASH_TABLE:hit_pct=<n>'.
+///
+
+#ifndef RAJAPerf_Algorithm_HASH_TABLE_HPP
+#define RAJAPerf_Algorithm_HASH_TABLE_HPP
+
+#define HASH_TABLE_NUM_CUCKOO_HASHES 3
+
+#define HASH_TABLE_DATA_SETUP \
+  Key* keys = selectKeyPtr<Key>(m_keys32, m_keys64); \
+  Key* ins = selectKeyPtr<Key>(m_ins32, m_ins64); \
+  Key* qry = selectKeyPtr<Key>(m_qry32, m_qry64); \
+  Int_ptr vals = m_vals; \
+  Int64_type* entries = m_entries; \
+  Int_ptr out = m_out; \
+  \
+  const Index_type capacity = m_capacity; \
+  const Index_type mask = m_capacity - 1; \
+  const Index_type num_keys = getActualProblemSize();
+
+#define HASH_TABLE_CLEAR_BODY \
+  if (cuckoo) { \
+    entries[s] = 0; \
+  } else { \
+    keys[s] = Key(0); \
+  }
+
+#define HASH_TABLE_INSERT_PROBE_BODY(policy) \
+  { \
+    const Key key = ins[i]; \
+    Index_type s = hashTableSlot(key, 0, mask); \
+    for (Index_type p = 1; ; ++p) { \
+      const Key old = RAJA::atomicCAS<policy>(&keys[s], Key(0), key); \
+      if (old == Key(0)) { \
+        vals[s] = static_cast<Int_type>(i); \
+        break; \
+      } \
+      s = (s + (quadratic ? p : 1)) & mask; \
+    } \
+  }
+
+#define HASH_TABLE_LOOKUP_PROBE_BODY \
+  { \
+    const Key key = qry[j]; \
+    Index_type s = hashTableSlot(key, 0, mask); \
+    Int_type val = -1; \
+    for (Index_type p = 1; ; ++p) { \
+      const Key k = keys[s]; \
+      if (k == key) { \
+        val = vals[s]; \
+        break; \
+      } \
+      if (k == Key(0)) { \
+        break; \
+      } \
+      s = (s + (quadratic ? p : 1)) & mask; \
+    } \
+    out[j] = val; \
+  }
+
+//
+// An entry left after hash_table_max_kicks evictions is dropped, which
+// shows in the checksum, so keep the load factor of cuckoo tables below
+// about 85 percent.
+//
+#define HASH_TABLE_INSERT_CUCKOO_BODY(policy) \
+  { \
+    const Int32_type key = static_cast<Int32_type>(ins[i]); \
+    Int64_type entry = hashTablePack(key, static_cast<Int_type>(i)); \
+    Index_type s = hashTableSlot(key, 0, mask); \
+    for (Index_type kick = 0; kick < hash_table_max_kicks; ++kick) { \
+      entry = RAJA::atomicExchange<policy>(&entries[s], entry); \
+      if (entry == 0) { \
+        break; \
+      } \
+      const Int32_type ekey = hashTableUnpackKey(entry); \
+      const Index_type s0 = hashTableSlot(ekey, 0, mask); \
+      const Index_type s1 = hashTableSlot(ekey, 1, mask); \
+      const Index_type s2 = hashTableSlot(ekey, 2, mask); \
+      s = (s == s0) ? s1 : ((s == s1) ? s2 : s0); \
+    } \
+  }
+
+#define HASH_TABLE_LOOKUP_CUCKOO_BODY \
+  { \
+    const Int32_type key = static_cast<Int32_type>(qry[j]); \
+    Int_type val = -1; \
+    for (int h = 0; h < HASH_TABLE_NUM_CUCKOO_HASHES; ++h) { \
+      const Int64_type e = entries[hashTableSlot(key, h, mask)]; \
+      if (e != 0 && hashTableUnpackKey(e) == key) { \
+        val = hashTableUnpackVal(e); \
+        break; \
+      } \
+    } \
+    out[j] = val; \
+  }
+
+#define HASH_TABLE_INSERT_BODY(policy) \
+  if (cuckoo) { \
+    HASH_TABLE_INSERT_CUCKOO_BODY(policy) \
+  } else { \
+    HASH_TABLE_INSERT_PROBE_BODY(policy) \
+  }
+
+#define HASH_TABLE_LOOKUP_BODY \
+  if (cuckoo) { \
+    HASH_TABLE_LOOKUP_CUCKOO_BODY \
+  } else { \
+    HASH_TABLE_LOOKUP_PROBE_BODY \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+enum struct HashProbe : int
+{
+  linear = 0,
+  quadratic,
+  cuckoo
+};
+
+constexpr Index_type hash_table_max_kicks = 1000;
+
+//
+// 32 and 64 bit finalizers of MurmurHash3, which are bijections, with a
+// different seed for each hash h of a key.
+//
+RAJA_HOST_DEVICE RAJA_INLINE Index_type hashTableSlot(Int32_type key, int h,
+                                                      Index_type mask)
+{
+  unsigned int z = static_cast<unsigned int>(key) ^ (0x9E3779B9u * (h + 1));
+  z ^= z >> 16;
+  z *= 0x85EBCA6Bu;
+  z ^= z >> 13;
+  z *= 0xC2B2AE35u;
+  z ^= z >> 16;
+  return static_cast<Index_type>(z) & mask;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Index_type hashTableSlot(Int64_type key, int h,
+                                                      Index_type mask)
+{
+  unsigned long long z = static_cast<unsigned long long>(key) ^
+                         (0x9E3779B97F4A7C15ull * (h + 1));
+  z ^= z >> 33;
+  z *= 0xFF51AFD7ED558CCDull;
+  z ^= z >> 33;
+  z *= 0xC4CEB9FE1A85EC53ull;
+  z ^= z >> 33;
+  return static_cast<Index_type>(z & static_cast<unsigned long long>(mask));
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Int64_type hashTablePack(Int32_type key, Int_type val)
+{
+  return static_cast<Int64_type>(
+      (static_cast<unsigned long long>(static_cast<unsigned int>(key)) << 32) |
+      static_cast<unsigned int>(val));
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Int32_type hashTableUnpackKey(Int64_type e)
+{
+  return static_cast<Int32_type>(
+      static_cast<unsigned int>(static_cast<unsigned long long>(e) >> 32));
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Int_type hashTableUnpackVal(Int64_type e)
+{
+  return static_cast<Int_type>(
+      static_cast<unsigned int>(static_cast<unsigned long long>(e)));
+}
+
+template < typename Key >
+Key* selectKeyPtr(Int32_type* ptr32, Int64_type* ptr64);
+
+template < >
+inline Int32_type* selectKeyPtr<Int32_type>(Int32_type* ptr32, Int64_type*)
+{ return ptr32; }
+
+template < >
+inline Int64_type* selectKeyPtr<Int64_type>(Int32_type*, Int64_type* ptr64)
+{ return ptr64; }
+
+class HASH_TABLE : public KernelBase
+{
+public:
+
+  HASH_TABLE(const RunParams& params);
+
+  ~HASH_TABLE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HASH_TABLE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t table >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t table >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, size_t table >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, size_t table >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  static const size_t s_clear_phase = 0;
+  static const size_t s_insert_phase = 1;
+  static const size_t s_lookup_phase = 2;
+
+  //
+  // Table tunings are numbered 2*probe + 64 bit keys, in the order of
+  // getTableTuningNames.
+  //
+  using table_tunings_type = camp::int_seq<size_t, 0, 1, 2, 3, 4>;
+
+  template < size_t table >
+  static constexpr HashProbe getProbe() { return static_cast<HashProbe>(table / 2); }
+  template < size_t table >
+  using key_type = typename std::conditional<(table % 2) == 1,
+                                             Int64_type, Int32_type>::type;
+
+  static const std::vector<std::string>& getTableTuningNames();
+  size_t getTableTuning(VariantID vid, size_t tune_idx) const;
+
+  Index_type m_capacity;
+  Index_type m_load_pct;
+  Index_type m_hit_pct;
+
+  Int32_type* m_keys32;
+  Int64_type* m_keys64;
+  Int32_type* m_ins32;
+  Int64_type* m_ins64;
+  Int32_type* m_qry32;
+  Int64_type* m_qry64;
+  Int_ptr m_vals;
+  Int64_type* m_entries;
+
+  Int_ptr m_out;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
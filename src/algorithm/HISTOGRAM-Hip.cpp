@@ -0,0 +1,325 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void histogram_atomic(Int_ptr bins, Int_ptr counts,
+                                 Index_type iend)
+{
+   Index_type i = blockIdx.x * blockDim.x + threadIdx.x;
+   if (i < iend) {
+     HISTOGRAM_RAJA_ATOMIC_BODY(RAJA::hip_atomic);
+   }
+}
+
+//
+// Count the elements in bins [bin_begin, bin_end) in shared memory, then
+// add the nonzero block counts to counts.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void histogram_shared(Int_ptr bins, Int_ptr counts,
+                                 Index_type bin_begin, Index_type bin_end,
+                                 Index_type iend)
+{
+  HIP_DYNAMIC_SHARED(Int_type, s_counts);
+
+  const Index_type nb = bin_end - bin_begin;
+
+  for (Index_type b = threadIdx.x; b < nb; b += block_size) {
+    s_counts[b] = 0;
+  }
+  __syncthreads();
+
+  for (Index_type i = blockIdx.x * block_size + threadIdx.x; i < iend;
+       i += gridDim.x * block_size) {
+    const Index_type b = bins[i] - bin_begin;
+    if (b >= 0 && b < nb) {
+      RAJA::atomicAdd<RAJA::hip_atomic>(&s_counts[b], 1);
+    }
+  }
+  __syncthreads();
+
+  for (Index_type b = threadIdx.x; b < nb; b += block_size) {
+    if (s_counts[b] != 0) {
+      RAJA::atomicAdd<RAJA::hip_atomic>(&counts[bin_begin + b], s_counts[b]);
+    }
+  }
+}
+
+//
+// Count elements in the copy of counts in priv of each block, blocks share
+// copies round robin.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void histogram_private(Int_ptr bins, Int_ptr priv,
+                                  Index_type num_bins, Index_type copies,
+                                  Index_type iend)
+{
+  Int_ptr my_counts = priv + num_bins * (blockIdx.x % copies);
+
+  for (Index_type i = blockIdx.x * block_size + threadIdx.x; i < iend;
+       i += gridDim.x * block_size) {
+    RAJA::atomicAdd<RAJA::hip_atomic>(&my_counts[bins[i]], 1);
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void histogram_private_reduce(Int_ptr priv, Int_ptr counts,
+                                         Index_type num_bins, Index_type copies)
+{
+  Index_type b = blockIdx.x * blockDim.x + threadIdx.x;
+  if (b < num_bins) {
+    Int_type count = 0;
+    for (Index_type c = 0; c < copies; ++c) {
+      count += priv[b + num_bins * c];
+    }
+    counts[b] = count;
+  }
+}
+
+
+template < size_t block_size >
+void HISTOGRAM::runHipVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  HISTOGRAM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemsetAsync(counts, 0, sizeof(Int_type)*num_bins,
+                                  res.get_stream()) );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((histogram_atomic<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), bins, counts,
+                                        iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemsetAsync(counts, 0, sizeof(Int_type)*num_bins,
+                                  res.get_stream()) );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      auto histogram_lambda = [=] __device__ (Index_type i) {
+        HISTOGRAM_RAJA_ATOMIC_BODY(RAJA::hip_atomic);
+      };
+
+      hipLaunchKernelGGL((lambda_hip_forall<block_size, decltype(histogram_lambda)>),
+        grid_size, block_size, shmem, res.get_stream(), ibegin, iend, histogram_lambda);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, num_bins), [=] __device__ (Index_type b) {
+        HISTOGRAM_INIT_BODY;
+      });
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        HISTOGRAM_RAJA_ATOMIC_BODY(RAJA::hip_atomic);
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  HISTOGRAM : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void HISTOGRAM::runHipVariantShared(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  HISTOGRAM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const size_t grid_size = std::max(size_t(1),
+        size_t(RAJA_DIVIDE_CEILING_INT(iend, block_size*HISTOGRAM_GPU_ITEMS_PER_THREAD)));
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemsetAsync(counts, 0, sizeof(Int_type)*num_bins,
+                                  res.get_stream()) );
+
+      for (Index_type bin_begin = 0; bin_begin < num_bins;
+           bin_begin += HISTOGRAM_GPU_SHARED_BINS) {
+
+        const Index_type bin_end = std::min(bin_begin + Index_type(HISTOGRAM_GPU_SHARED_BINS),
+                                            num_bins);
+        const size_t shmem = sizeof(Int_type)*(bin_end - bin_begin);
+        hipLaunchKernelGGL((histogram_shared<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), bins, counts,
+                                          bin_begin, bin_end,
+                                          iend );
+        hipErrchk( hipGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  HISTOGRAM : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void HISTOGRAM::runHipVariantPrivate(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  HISTOGRAM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const Index_type copies = getGPUPrivateCopies();
+    Int_ptr priv;
+    allocData(DataSpace::HipDevice, priv, copies*num_bins);
+
+    const size_t grid_size = std::max(size_t(1),
+        size_t(RAJA_DIVIDE_CEILING_INT(iend, block_size*HISTOGRAM_GPU_ITEMS_PER_THREAD)));
+    const size_t reduce_grid_size = RAJA_DIVIDE_CEILING_INT(num_bins, block_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemsetAsync(priv, 0, sizeof(Int_type)*copies*num_bins,
+                                  res.get_stream()) );
+
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((histogram_private<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), bins, priv,
+                                        num_bins, copies,
+                                        iend );
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((histogram_private_reduce<block_size>), dim3(reduce_grid_size), dim3(block_size), shmem, res.get_stream(), priv, counts,
+                                        num_bins, copies );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, priv);
+
+  } else {
+     getCout() << "\n  HISTOGRAM : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void HISTOGRAM::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantAtomic<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == Base_HIP) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantShared<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantPrivate<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    }
+
+  });
+}
+
+void HISTOGRAM::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "atomic"+block_name);
+
+      if (vid == Base_HIP) {
+        addVariantTuningName(vid, "shared"+block_name);
+        addVariantTuningName(vid, "private"+block_name);
+      }
+
+    }
+
+  });
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,206 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void HISTOGRAM::runOpenMPVariantAtomic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            HISTOGRAM_INIT_BODY;
+          }
+
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            #pragma omp atomic
+            counts[bins[i]] += 1;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto histogram_init_lam = [=](Index_type b) {
+                                  HISTOGRAM_INIT_BODY;
+                                };
+      auto histogram_lam = [=](Index_type i) {
+                             #pragma omp atomic
+                             counts[bins[i]] += 1;
+                           };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            histogram_init_lam(b);
+          }
+
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            histogram_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_bins), [=](Index_type b) {
+          HISTOGRAM_INIT_BODY;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HISTOGRAM_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HISTOGRAM::runOpenMPVariantPrivate(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  // private copy of counts of each thread
+  const Index_type nthreads = omp_get_max_threads();
+  std::vector<Int_type> private_counts(nthreads*num_bins);
+  Int_ptr priv = private_counts.data();
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel
+      {
+        const Index_type nt = omp_get_num_threads();
+        Int_ptr my_counts = priv + num_bins*omp_get_thread_num();
+
+        for (Index_type b = 0; b < num_bins; ++b ) {
+          my_counts[b] = 0;
+        }
+
+        #pragma omp for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          my_counts[bins[i]] += 1;
+        }
+
+        #pragma omp for
+        for (Index_type b = 0; b < num_bins; ++b ) {
+          Int_type count = 0;
+          for (Index_type t = 0; t < nt; ++t ) {
+            count += priv[b + num_bins*t];
+          }
+          counts[b] = count;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  HISTOGRAM : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HISTOGRAM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantAtomic(vid);
+  }
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+    if (tune_idx == t) {
+      runOpenMPVariantPrivate(vid);
+    }
+    t += 1;
+  }
+}
+
+void HISTOGRAM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "atomic");
+
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "private");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+  //
+  // Define threads per team for target execution
+  //
+  const size_t threads_per_team = 256;
+
+
+void HISTOGRAM::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(counts) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type b = 0; b < num_bins; ++b ) {
+          HISTOGRAM_INIT_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(counts) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type b = 0; b < num_bins; ++b ) {
+          HISTOGRAM_INIT_BODY;
+        }
+      }
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(bins, counts) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          #pragma omp atomic
+          counts[bins[i]] += 1;
+        }
+      } else {
+        #pragma omp target is_device_ptr(bins, counts) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          #pragma omp atomic
+          counts[bins[i]] += 1;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+        RAJA::RangeSegment(0, num_bins), [=](Index_type b) {
+        HISTOGRAM_INIT_BODY;
+      });
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+        RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+        HISTOGRAM_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
+      });
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  HISTOGRAM : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
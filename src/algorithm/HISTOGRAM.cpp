@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+HISTOGRAM::HISTOGRAM(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_HISTOGRAM, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_num_bins = params.getHistogramBins();
+  m_skew = params.getHistogramSkew();
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Int_type) + 1*sizeof(Int_type)) * m_num_bins +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setHasPattern(GatherScatter);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+HISTOGRAM::~HISTOGRAM()
+{
+}
+
+//
+// Private GPU tunings keep the copies of counts within a fixed footprint.
+//
+Index_type HISTOGRAM::getGPUPrivateCopies() const
+{
+  return std::max(Index_type(1),
+                  std::min(Index_type(HISTOGRAM_GPU_PRIVATE_TOTAL_BINS) / m_num_bins,
+                           Index_type(HISTOGRAM_GPU_PRIVATE_MAX_COPIES)));
+}
+
+void HISTOGRAM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  //
+  // Bin b is drawn with probability proportional to 1/(b+1)^skew, so skew 0
+  // spreads elements uniformly over the bins and larger skews concentrate
+  // them in the first bins.
+  //
+  std::vector<Real_type> cdf(m_num_bins);
+  Real_type total = 0.0;
+  for (Index_type b = 0; b < m_num_bins; ++b) {
+    total += std::pow(static_cast<Real_type>(b+1), -m_skew);
+    cdf[b] = total;
+  }
+
+  constexpr unsigned long long bins_seed = 1093;
+
+  allocData(m_bins, len, vid);
+  {
+    auto reset_bins = scopedMoveData(m_bins, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      const Real_type u = total * detail::counterRandValue(bins_seed, i);
+      const Index_type b = std::upper_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+      m_bins[i] = static_cast<Int_type>( std::min(b, m_num_bins-1) );
+    }
+  }
+  allocAndInitDataConst(m_counts, m_num_bins, Int_type(0), vid);
+}
+
+void HISTOGRAM::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_counts, m_num_bins, vid);
+}
+
+void HISTOGRAM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_bins, vid);
+  deallocData(m_counts, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
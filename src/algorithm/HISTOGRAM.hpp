@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HISTOGRAM kernel reference implementation:
+///
+/// for (Index_type b = 0; b < num_bins; ++b ) {
+///   counts[b] = 0;
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   counts[bins[i]] += 1;
+/// }
+///
+/// The number of bins and the Zipf exponent of the distribution of bins
+/// are given by --histogram-bins and --histogram-skew. Tunings accumulate
+/// with atomics into counts (atomic), into block private copies of counts
+/// in GPU shared memory, in passes over ranges of bins when counts does not
+/// fit (shared), or into thread or block private copies of counts that are
+/// summed into counts after (private).
+///
+
+#ifndef RAJAPerf_Algorithm_HISTOGRAM_HPP
+#define RAJAPerf_Algorithm_HISTOGRAM_HPP
+
+//
+// Bins held in GPU shared memory by shared tunings, and the number of
+// elements each thread of shared and private tunings counts.
+//
+#define HISTOGRAM_GPU_SHARED_BINS 8192
+#define HISTOGRAM_GPU_ITEMS_PER_THREAD 16
+
+//
+// Total number of bins in the block private copies of private GPU
+// tunings, and the most copies they use.
+//
+#define HISTOGRAM_GPU_PRIVATE_TOTAL_BINS (1 << 22)
+#define HISTOGRAM_GPU_PRIVATE_MAX_COPIES 64
+
+#define HISTOGRAM_DATA_SETUP \
+  Int_ptr bins = m_bins; \
+  Int_ptr counts = m_counts; \
+  const Index_type num_bins = m_num_bins;
+
+#define HISTOGRAM_INIT_BODY \
+  counts[b] = 0;
+
+#define HISTOGRAM_BODY \
+  counts[bins[i]] += 1;
+
+#define HISTOGRAM_RAJA_ATOMIC_BODY(policy) \
+  RAJA::atomicAdd<policy>(&counts[bins[i]], 1);
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class HISTOGRAM : public KernelBase
+{
+public:
+
+  HISTOGRAM(const RunParams& params);
+
+  ~HISTOGRAM();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runOpenMPVariantAtomic(VariantID vid);
+  void runOpenMPVariantPrivate(VariantID vid);
+
+  template < size_t block_size >
+  void runCudaVariantAtomic(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantShared(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantPrivate(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantAtomic(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantShared(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantPrivate(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type getGPUPrivateCopies() const;
+
+  Index_type m_num_bins;
+  Real_type m_skew;
+
+  Int_ptr m_bins;
+  Int_ptr m_counts;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
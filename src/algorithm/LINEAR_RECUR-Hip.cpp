@@ -0,0 +1,274 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LINEAR_RECUR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+//
+// Exclusive scan of the maps fa, fb of the threads of a block, on return
+// fa, fb is the map of the threads before this one and ta, tb is the map
+// of the whole block.
+//
+template < size_t block_size >
+__device__ void linear_recur_block_scan(Real_type& fa, Real_type& fb,
+                                        Real_type& ta, Real_type& tb)
+{
+  __shared__ Real_type s_a[block_size];
+  __shared__ Real_type s_b[block_size];
+
+  s_a[threadIdx.x] = fa;
+  s_b[threadIdx.x] = fb;
+  __syncthreads();
+
+  for (unsigned offset = 1; offset < block_size; offset *= 2) {
+    Real_type la = 1.0;
+    Real_type lb = 0.0;
+    if (threadIdx.x >= offset) {
+      la = s_a[threadIdx.x - offset];
+      lb = s_b[threadIdx.x - offset];
+    }
+    __syncthreads();
+    if (threadIdx.x >= offset) {
+      s_b[threadIdx.x] = s_a[threadIdx.x] * lb + s_b[threadIdx.x];
+      s_a[threadIdx.x] = s_a[threadIdx.x] * la;
+    }
+    __syncthreads();
+  }
+
+  fa = (threadIdx.x > 0) ? s_a[threadIdx.x - 1] : 1.0;
+  fb = (threadIdx.x > 0) ? s_b[threadIdx.x - 1] : 0.0;
+  ta = s_a[block_size - 1];
+  tb = s_b[block_size - 1];
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void linear_recur_sequential(Real_ptr x, Real_ptr a, Real_ptr b,
+                                        Index_type N, Index_type num_systems)
+{
+  Index_type isys = blockIdx.x * block_size + threadIdx.x;
+  if (isys < num_systems) {
+    LINEAR_RECUR_SYSTEM_BODY;
+  }
+}
+
+//
+// Tile blockIdx.x has block_size*LINEAR_RECUR_ITEMS elements, each thread
+// composes the maps of LINEAR_RECUR_ITEMS contiguous elements.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void linear_recur_tile_reduce(Real_ptr a, Real_ptr b,
+                                         Real_ptr tile_a, Real_ptr tile_b,
+                                         Index_type len)
+{
+  const Index_type t = blockIdx.x;
+  const Index_type ibegin = (t * block_size + threadIdx.x) * LINEAR_RECUR_ITEMS;
+
+  Real_type fa = 1.0;
+  Real_type fb = 0.0;
+  for (Index_type i = ibegin; i < ibegin + LINEAR_RECUR_ITEMS && i < len; ++i) {
+    LINEAR_RECUR_COMPOSE_BODY;
+  }
+
+  Real_type ta, tb;
+  linear_recur_block_scan<block_size>(fa, fb, ta, tb);
+
+  if (threadIdx.x == 0) {
+    tile_a[t] = ta;
+    tile_b[t] = tb;
+  }
+}
+
+//
+// One block, each thread scans a contiguous range of tiles.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void linear_recur_tile_scan(Real_ptr tile_a, Real_ptr tile_b,
+                                       Real_ptr tile_x, Index_type num_tiles)
+{
+  const Index_type tiles_per_thread = RAJA_DIVIDE_CEILING_INT(num_tiles, block_size);
+  const Index_type tbegin = threadIdx.x * tiles_per_thread;
+  const Index_type tend = (tbegin + tiles_per_thread < num_tiles)
+                        ? tbegin + tiles_per_thread : num_tiles;
+
+  Real_type fa = 1.0;
+  Real_type fb = 0.0;
+  for (Index_type t = tbegin; t < tend; ++t) {
+    fb = tile_a[t] * fb + tile_b[t];
+    fa = tile_a[t] * fa;
+  }
+
+  Real_type ta, tb;
+  linear_recur_block_scan<block_size>(fa, fb, ta, tb);
+
+  Real_type xp = fb;
+  for (Index_type t = tbegin; t < tend; ++t) {
+    tile_x[t] = xp;
+    xp = tile_a[t] * xp + tile_b[t];
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void linear_recur_tile_apply(Real_ptr x, Real_ptr a, Real_ptr b,
+                                        Real_ptr tile_x, Index_type len)
+{
+  const Index_type t = blockIdx.x;
+  const Index_type ibegin = (t * block_size + threadIdx.x) * LINEAR_RECUR_ITEMS;
+
+  Real_type fa = 1.0;
+  Real_type fb = 0.0;
+  for (Index_type i = ibegin; i < ibegin + LINEAR_RECUR_ITEMS && i < len; ++i) {
+    LINEAR_RECUR_COMPOSE_BODY;
+  }
+
+  Real_type ta, tb;
+  linear_recur_block_scan<block_size>(fa, fb, ta, tb);
+
+  Real_type xp = fa * tile_x[t] + fb;
+  for (Index_type i = ibegin; i < ibegin + LINEAR_RECUR_ITEMS && i < len; ++i) {
+    LINEAR_RECUR_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void LINEAR_RECUR::runHipVariantSequential(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  LINEAR_RECUR_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_systems, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((linear_recur_sequential<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+          x, a, b, N, num_systems );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(len);
+    RAJA_UNUSED_VAR(tile_a);
+    RAJA_UNUSED_VAR(tile_b);
+    RAJA_UNUSED_VAR(tile_x);
+
+  } else {
+     getCout() << "\n  LINEAR_RECUR : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void LINEAR_RECUR::runHipVariantScan(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  LINEAR_RECUR_DATA_SETUP;
+
+  const Index_type tile_len = block_size * LINEAR_RECUR_ITEMS;
+  const Index_type num_tiles = RAJA_DIVIDE_CEILING_INT(len, tile_len);
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((linear_recur_tile_reduce<block_size>), dim3(num_tiles), dim3(block_size), shmem, res.get_stream(),
+          a, b, tile_a, tile_b, len );
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((linear_recur_tile_scan<block_size>), dim3(1), dim3(block_size), shmem, res.get_stream(),
+          tile_a, tile_b, tile_x, num_tiles );
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((linear_recur_tile_apply<block_size>), dim3(num_tiles), dim3(block_size), shmem, res.get_stream(),
+          x, a, b, tile_x, len );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(N);
+
+  } else {
+     getCout() << "\n  LINEAR_RECUR : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void LINEAR_RECUR::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantSequential<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantScan<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+}
+
+void LINEAR_RECUR::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "sequential"+block_name);
+      addVariantTuningName(vid, "scan"+block_name);
+
+    }
+
+  });
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LINEAR_RECUR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void LINEAR_RECUR::runSeqVariantSequential(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  LINEAR_RECUR_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type isys = 0; isys < num_systems; ++isys) {
+        LINEAR_RECUR_SYSTEM_BODY;
+      }
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(len);
+    RAJA_UNUSED_VAR(tile_a);
+    RAJA_UNUSED_VAR(tile_b);
+    RAJA_UNUSED_VAR(tile_x);
+
+  } else {
+    getCout() << "\n  LINEAR_RECUR : Unknown variant id = " << vid << std::endl;
+  }
+}
+
+void LINEAR_RECUR::runSeqVariantScan(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  LINEAR_RECUR_DATA_SETUP;
+
+  const Index_type tile_len = LINEAR_RECUR_CPU_TILE_LEN;
+  const Index_type num_tiles = RAJA_DIVIDE_CEILING_INT(len, tile_len);
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < num_tiles; ++t) {
+        LINEAR_RECUR_TILE_REDUCE_BODY;
+      }
+
+      {
+        LINEAR_RECUR_TILE_SCAN_BODY;
+      }
+
+      for (Index_type t = 0; t < num_tiles; ++t) {
+        LINEAR_RECUR_TILE_APPLY_BODY;
+      }
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(N);
+
+  } else {
+    getCout() << "\n  LINEAR_RECUR : Unknown variant id = " << vid << std::endl;
+  }
+}
+
+void LINEAR_RECUR::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantSequential(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantScan(vid);
+  }
+  t += 1;
+}
+
+void LINEAR_RECUR::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "sequential");
+  addVariantTuningName(vid, "scan");
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
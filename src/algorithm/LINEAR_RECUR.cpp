@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LINEAR_RECUR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+LINEAR_RECUR::LINEAR_RECUR(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_LINEAR_RECUR, params)
+{
+  setDefaultProblemSize(1024*1024);
+  setDefaultReps(100);
+
+  m_N = getKernelParam("N", 1024);
+  m_num_systems = std::max(getTargetProblemSize() / m_N, Index_type(1));
+
+  setActualProblemSize( m_num_systems * m_N );
+
+  // tiles of the scan tunings have at least LINEAR_RECUR_ITEMS elements
+  m_max_num_tiles = RAJA_DIVIDE_CEILING_INT(getActualProblemSize(),
+                                            LINEAR_RECUR_ITEMS);
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // one read of a and b and one write of x, the scan tunings read a and b
+  // twice and do about twice the FLOPs, which is not counted
+  setBytesPerRep( (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(2 * getActualProblemSize());
+
+  checksum_scale_factor = 1e-3 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+LINEAR_RECUR::~LINEAR_RECUR()
+{
+}
+
+void LINEAR_RECUR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = m_num_systems * m_N;
+
+  //
+  // Multipliers are in [0.5, 0.95), so x stays bounded and the order of
+  // composing the maps only changes the result by rounding.
+  //
+  constexpr unsigned long long a_seed = 7121;
+  constexpr unsigned long long b_seed = 7127;
+
+  allocData(m_a, len, vid);
+  allocData(m_b, len, vid);
+  {
+    auto reset_a = scopedMoveData(m_a, len, vid);
+    auto reset_b = scopedMoveData(m_b, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      m_a[i] = (i % m_N == 0)
+             ? 0.0 : 0.5 + 0.45 * detail::counterRandValue(a_seed, i);
+      m_b[i] = 2.0 * detail::counterRandValue(b_seed, i) - 1.0;
+    }
+  }
+
+  allocAndInitDataConst(m_x, len, 0.0, vid);
+  allocAndInitDataConst(m_tile_a, m_max_num_tiles, 0.0, vid);
+  allocAndInitDataConst(m_tile_b, m_max_num_tiles, 0.0, vid);
+  allocAndInitDataConst(m_tile_x, m_max_num_tiles, 0.0, vid);
+}
+
+void LINEAR_RECUR::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_x, m_num_systems * m_N, checksum_scale_factor, vid);
+}
+
+void LINEAR_RECUR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_a, vid);
+  deallocData(m_b, vid);
+  deallocData(m_x, vid);
+  deallocData(m_tile_a, vid);
+  deallocData(m_tile_b, vid);
+  deallocData(m_tile_x, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
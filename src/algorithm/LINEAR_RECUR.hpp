@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// LINEAR_RECUR kernel reference implementation:
+///
+/// // first order linear recurrence of each of num_systems contiguous
+/// // systems of length N, a of the first element of each system is zero
+/// // so the batch is one recurrence over all len = num_systems*N elements
+/// Real_type xp = 0.0;
+/// for (Index_type i = 0; i < len; ++i) {
+///   xp = a[i] * xp + b[i];
+///   x[i] = xp;
+/// }
+///
+/// N is given by the kernel parameter "N" and the problem size sets
+/// num_systems. The sequential tunings solve each system in order, in
+/// parallel over systems. The scan tunings compose the affine maps
+/// x -> a[i]*x + b[i] of the elements of each tile, scan the tile maps, and
+/// recompute the elements of each tile from the x before it, in parallel
+/// over tiles and, on GPUs, over the elements of a tile.
+///
+
+#ifndef RAJAPerf_Algorithm_LINEAR_RECUR_HPP
+#define RAJAPerf_Algorithm_LINEAR_RECUR_HPP
+
+// elements of each tile of the CPU scan tunings
+#define LINEAR_RECUR_CPU_TILE_LEN (4096)
+
+// elements of each thread of the GPU scan tunings
+#define LINEAR_RECUR_ITEMS (8)
+
+#define LINEAR_RECUR_DATA_SETUP \
+  Real_ptr a = m_a; \
+  Real_ptr b = m_b; \
+  Real_ptr x = m_x; \
+  Real_ptr tile_a = m_tile_a; \
+  Real_ptr tile_b = m_tile_b; \
+  Real_ptr tile_x = m_tile_x; \
+  const Index_type N = m_N; \
+  const Index_type num_systems = m_num_systems; \
+  const Index_type len = num_systems * N;
+
+// x[i] given x[i-1] in xp
+#define LINEAR_RECUR_BODY \
+  xp = a[i] * xp + b[i]; \
+  x[i] = xp;
+
+// map of element i after the map fa, fb of the elements before it
+#define LINEAR_RECUR_COMPOSE_BODY \
+  fb = a[i] * fb + b[i]; \
+  fa = a[i] * fa;
+
+#define LINEAR_RECUR_SYSTEM_BODY \
+  Real_type xp = 0.0; \
+  for (Index_type i = isys*N; i < isys*N + N; ++i) { \
+    LINEAR_RECUR_BODY; \
+  }
+
+#define LINEAR_RECUR_TILE_SETUP \
+  const Index_type tbegin = t * tile_len; \
+  const Index_type tend = (tbegin + tile_len < len) ? tbegin + tile_len : len;
+
+#define LINEAR_RECUR_TILE_REDUCE_BODY \
+  LINEAR_RECUR_TILE_SETUP; \
+  Real_type fa = 1.0; \
+  Real_type fb = 0.0; \
+  for (Index_type i = tbegin; i < tend; ++i) { \
+    LINEAR_RECUR_COMPOSE_BODY; \
+  } \
+  tile_a[t] = fa; \
+  tile_b[t] = fb;
+
+// x before each tile
+#define LINEAR_RECUR_TILE_SCAN_BODY \
+  Real_type xp = 0.0; \
+  for (Index_type t = 0; t < num_tiles; ++t) { \
+    tile_x[t] = xp; \
+    xp = tile_a[t] * xp + tile_b[t]; \
+  }
+
+#define LINEAR_RECUR_TILE_APPLY_BODY \
+  LINEAR_RECUR_TILE_SETUP; \
+  Real_type xp = tile_x[t]; \
+  for (Index_type i = tbegin; i < tend; ++i) { \
+    LINEAR_RECUR_BODY; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class LINEAR_RECUR : public KernelBase
+{
+public:
+
+  LINEAR_RECUR(const RunParams& params);
+
+  ~LINEAR_RECUR();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  LINEAR_RECUR : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runSeqVariantSequential(VariantID vid);
+  void runSeqVariantScan(VariantID vid);
+  void runOpenMPVariantSequential(VariantID vid);
+  void runOpenMPVariantScan(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantSequential(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantScan(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantSequential(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantScan(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type m_N;
+  Index_type m_num_systems;
+  Index_type m_max_num_tiles;
+
+  Real_ptr m_a;
+  Real_ptr m_b;
+  Real_ptr m_x;
+  Real_ptr m_tile_a;
+  Real_ptr m_tile_b;
+  Real_ptr m_tile_x;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
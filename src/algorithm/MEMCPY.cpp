@@ -33,6 +33,8 @@ MEMCPY::MEMCPY(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Streaming);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -41,6 +43,8 @@ MEMCPY::MEMCPY(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -51,6 +55,8 @@ MEMCPY::MEMCPY(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 MEMCPY::~MEMCPY()
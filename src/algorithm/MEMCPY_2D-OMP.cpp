@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MEMCPY_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstring>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void MEMCPY_2D::runOpenMPVariantLibrary(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  MEMCPY_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < ny; ++j ) {
+          std::memcpy(y + j*nx, x + h + (j+h)*px, nx*sizeof(Real_type));
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MEMCPY_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantLibrary(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+
+  MEMCPY_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < ny; ++j ) {
+          for (Index_type i = 0; i < nx; ++i ) {
+            MEMCPY_2D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void MEMCPY_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "library");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MEMCPY_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstring>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void MEMCPY_2D::runSeqVariantLibrary(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  MEMCPY_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type j = 0; j < ny; ++j ) {
+          std::memcpy(y + j*nx, x + h + (j+h)*px, nx*sizeof(Real_type));
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void MEMCPY_2D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 1 ) {
+    runSeqVariantLibrary(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+
+  MEMCPY_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type j = 0; j < ny; ++j ) {
+          for (Index_type i = 0; i < nx; ++i ) {
+            MEMCPY_2D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void MEMCPY_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "library");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,87 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MEMCPY_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+MEMCPY_2D::MEMCPY_2D(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_MEMCPY_2D, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  const Index_type default_width =
+      std::max(Index_type(1), static_cast<Index_type>(std::sqrt(getTargetProblemSize())));
+  m_nx = getKernelParam("width", default_width);
+  m_ny = std::max(Index_type(1), getTargetProblemSize() / m_nx);
+  m_halo = getKernelParam("halo", 1, 0);
+  m_num_chunks = std::min(getKernelParam("chunks", 4), m_ny);
+
+  setActualProblemSize( m_nx * m_ny );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // the bytes of the subarray read from x and written to y, the bytes of
+  // the compute kernels of the compute tunings are not counted
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setHasPattern(Streaming);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+MEMCPY_2D::~MEMCPY_2D()
+{
+}
+
+void MEMCPY_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type px = m_nx + 2*m_halo;
+  const Index_type py = m_ny + 2*m_halo;
+
+  allocAndInitData(m_x, px*py, vid);
+  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+  allocAndInitDataConst(m_z, getActualProblemSize(), 0.0, vid);
+}
+
+void MEMCPY_2D::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid].at(tune_idx) += calcChecksum(m_y, getActualProblemSize(), vid);
+}
+
+void MEMCPY_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+  deallocData(m_z, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MEMCPY_2D kernel reference implementation:
+///
+/// // copy the nx x ny interior of x, which has a halo of h elements and
+/// // rows of pitch px = nx + 2*h, to the packed array y
+/// for (Index_type j = 0; j < ny; ++j ) {
+///   for (Index_type i = 0; i < nx; ++i ) {
+///     y[i + j*nx] = x[(i+h) + (j+h)*px];
+///   }
+/// }
+///
+/// nx is given by the kernel parameter "width" (the square root of the
+/// problem size by default) and h by "halo" (1 by default), a small width
+/// makes this a strided copy. Tunings copy with a loop nest (default) or a
+/// GPU kernel (block), or with a library copy of a row at a time on the
+/// CPU or of the whole subarray with cudaMemcpy2DAsync or hipMemcpy2DAsync
+/// on the GPU (library). GPU compute tunings also run a kernel reading
+/// each copied chunk, see algorithm/PitchedCopyUtils.hpp.
+///
+
+#ifndef RAJAPerf_Algorithm_MEMCPY_2D_HPP
+#define RAJAPerf_Algorithm_MEMCPY_2D_HPP
+
+#define MEMCPY_2D_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_ptr z = m_z; \
+  const Index_type nx = m_nx; \
+  const Index_type ny = m_ny; \
+  const Index_type h = m_halo; \
+  const Index_type px = nx + 2*h; \
+  const Index_type num_chunks = m_num_chunks; \
+  RAJA_UNUSED_VAR(z); \
+  RAJA_UNUSED_VAR(num_chunks);
+
+#define MEMCPY_2D_BODY \
+  y[i + j*nx] = x[(i+h) + (j+h)*px];
+
+// library copy of rows [jbegin, jend), dst pitch, src, src pitch, width, height
+#define MEMCPY_2D_LIBRARY_ARGS(jbegin, jend) \
+  y + (jbegin)*nx, nx*sizeof(Real_type), \
+  x + h + ((jbegin)+h)*px, px*sizeof(Real_type), \
+  nx*sizeof(Real_type), (jend) - (jbegin)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class MEMCPY_2D : public KernelBase
+{
+public:
+
+  MEMCPY_2D(const RunParams& params);
+
+  ~MEMCPY_2D();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MEMCPY_2D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runSeqVariantLibrary(VariantID vid);
+  void runOpenMPVariantLibrary(VariantID vid);
+
+  void runCudaVariantLibrary(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantBlock(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantCompute(VariantID vid, bool overlap);
+
+  void runHipVariantLibrary(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantBlock(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantCompute(VariantID vid, bool overlap);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type m_nx;
+  Index_type m_ny;
+  Index_type m_halo;
+  Index_type m_num_chunks;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Real_ptr m_z;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,242 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MEMCPY_3D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include "PitchedCopyUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void memcpy_3d(Real_ptr x, Real_ptr y,
+                          Index_type n, Index_type h,
+                          Index_type px, Index_type py,
+                          Index_type iend)
+{
+  Index_type idx = blockIdx.x * block_size + threadIdx.x;
+  if ( idx < iend ) {
+    Index_type k = idx / (n*n);
+    Index_type j = (idx - k*n*n) / n;
+    Index_type i = idx - k*n*n - j*n;
+    MEMCPY_3D_BODY;
+  }
+}
+
+//
+// Parameters of the library copy of planes [kbegin, kend) of the subarray.
+//
+static cudaMemcpy3DParms memcpy3DParams(Real_ptr x, Real_ptr y,
+                                       Index_type n, Index_type h,
+                                       Index_type px, Index_type py,
+                                       Index_type kbegin, Index_type kend)
+{
+  cudaMemcpy3DParms params = {};
+  params.srcPtr = make_cudaPitchedPtr(x, px*sizeof(Real_type), px, py);
+  params.srcPos = make_cudaPos(h*sizeof(Real_type), h, kbegin+h);
+  params.dstPtr = make_cudaPitchedPtr(y, n*sizeof(Real_type), n, n);
+  params.dstPos = make_cudaPos(0, 0, kbegin);
+  params.extent = make_cudaExtent(n*sizeof(Real_type), n, kend-kbegin);
+  params.kind = cudaMemcpyDefault;
+  return params;
+}
+
+
+void MEMCPY_3D::runCudaVariantLibrary(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  MEMCPY_3D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const cudaMemcpy3DParms params = memcpy3DParams(x, y, n, h, px, py, 0, n);
+      cudaErrchk( cudaMemcpy3DAsync( &params, res.get_stream() ) );
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  MEMCPY_3D : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < size_t block_size >
+void MEMCPY_3D::runCudaVariantBlock(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  MEMCPY_3D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      memcpy_3d<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, y, n, h, px, py, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  MEMCPY_3D : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < size_t block_size >
+void MEMCPY_3D::runCudaVariantCompute(VariantID vid, bool overlap)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  MEMCPY_3D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    cudaStream_t copy_stream = res.get_stream();
+    cudaStream_t compute_stream = copy_stream;
+    if (overlap) {
+      cudaErrchk( cudaStreamCreateWithFlags(&compute_stream, cudaStreamNonBlocking) );
+    }
+    std::vector<cudaEvent_t> copied(num_chunks);
+    for (cudaEvent_t& event : copied) {
+      cudaErrchk( cudaEventCreateWithFlags(&event, cudaEventDisableTiming) );
+    }
+    cudaEvent_t computed;
+    cudaErrchk( cudaEventCreateWithFlags(&computed, cudaEventDisableTiming) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type c = 0; c < num_chunks; ++c) {
+        const Index_type kbegin = pitchedCopyChunkBegin(c, num_chunks, n);
+        const Index_type kend = pitchedCopyChunkBegin(c+1, num_chunks, n);
+
+        const cudaMemcpy3DParms params = memcpy3DParams(x, y, n, h, px, py, kbegin, kend);
+        cudaErrchk( cudaMemcpy3DAsync( &params, copy_stream ) );
+        cudaErrchk( cudaEventRecord(copied[c], copy_stream) );
+
+        cudaErrchk( cudaStreamWaitEvent(compute_stream, copied[c], 0) );
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT((kend-kbegin)*n*n, block_size);
+        constexpr size_t shmem = 0;
+        pitched_copy_compute<block_size><<<grid_size, block_size, shmem, compute_stream>>>(
+            z, y, kbegin*n*n, kend*n*n );
+        cudaErrchk( cudaGetLastError() );
+      }
+      cudaErrchk( cudaEventRecord(computed, compute_stream) );
+      cudaErrchk( cudaStreamWaitEvent(copy_stream, computed, 0) );
+
+    }
+    stopTimer();
+
+    cudaErrchk( cudaEventDestroy(computed) );
+    for (cudaEvent_t& event : copied) {
+      cudaErrchk( cudaEventDestroy(event) );
+    }
+    if (overlap) {
+      cudaErrchk( cudaStreamDestroy(compute_stream) );
+    }
+
+  } else {
+
+    getCout() << "\n  MEMCPY_3D : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+void MEMCPY_3D::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runCudaVariantLibrary(vid);
+  }
+  t += 1;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantBlock<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  for (bool overlap : {false, true}) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantCompute<block_size>(vid, overlap);
+        }
+        t += 1;
+      }
+    });
+  }
+}
+
+void MEMCPY_3D::setCudaTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "library");
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  for (const char* name : {"serial_compute_", "overlap_compute_"}) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, name+std::to_string(block_size));
+      }
+    });
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,242 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MEMCPY_3D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include "PitchedCopyUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void memcpy_3d(Real_ptr x, Real_ptr y,
+                          Index_type n, Index_type h,
+                          Index_type px, Index_type py,
+                          Index_type iend)
+{
+  Index_type idx = blockIdx.x * block_size + threadIdx.x;
+  if ( idx < iend ) {
+    Index_type k = idx / (n*n);
+    Index_type j = (idx - k*n*n) / n;
+    Index_type i = idx - k*n*n - j*n;
+    MEMCPY_3D_BODY;
+  }
+}
+
+//
+// Parameters of the library copy of planes [kbegin, kend) of the subarray.
+//
+static hipMemcpy3DParms memcpy3DParams(Real_ptr x, Real_ptr y,
+                                       Index_type n, Index_type h,
+                                       Index_type px, Index_type py,
+                                       Index_type kbegin, Index_type kend)
+{
+  hipMemcpy3DParms params = {};
+  params.srcPtr = make_hipPitchedPtr(x, px*sizeof(Real_type), px, py);
+  params.srcPos = make_hipPos(h*sizeof(Real_type), h, kbegin+h);
+  params.dstPtr = make_hipPitchedPtr(y, n*sizeof(Real_type), n, n);
+  params.dstPos = make_hipPos(0, 0, kbegin);
+  params.extent = make_hipExtent(n*sizeof(Real_type), n, kend-kbegin);
+  params.kind = hipMemcpyDefault;
+  return params;
+}
+
+
+void MEMCPY_3D::runHipVariantLibrary(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  MEMCPY_3D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const hipMemcpy3DParms params = memcpy3DParams(x, y, n, h, px, py, 0, n);
+      hipErrchk( hipMemcpy3DAsync( &params, res.get_stream() ) );
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  MEMCPY_3D : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < size_t block_size >
+void MEMCPY_3D::runHipVariantBlock(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  MEMCPY_3D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((memcpy_3d<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         x, y, n, h, px, py, iend);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  MEMCPY_3D : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < size_t block_size >
+void MEMCPY_3D::runHipVariantCompute(VariantID vid, bool overlap)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  MEMCPY_3D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    hipStream_t copy_stream = res.get_stream();
+    hipStream_t compute_stream = copy_stream;
+    if (overlap) {
+      hipErrchk( hipStreamCreateWithFlags(&compute_stream, hipStreamNonBlocking) );
+    }
+    std::vector<hipEvent_t> copied(num_chunks);
+    for (hipEvent_t& event : copied) {
+      hipErrchk( hipEventCreateWithFlags(&event, hipEventDisableTiming) );
+    }
+    hipEvent_t computed;
+    hipErrchk( hipEventCreateWithFlags(&computed, hipEventDisableTiming) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type c = 0; c < num_chunks; ++c) {
+        const Index_type kbegin = pitchedCopyChunkBegin(c, num_chunks, n);
+        const Index_type kend = pitchedCopyChunkBegin(c+1, num_chunks, n);
+
+        const hipMemcpy3DParms params = memcpy3DParams(x, y, n, h, px, py, kbegin, kend);
+        hipErrchk( hipMemcpy3DAsync( &params, copy_stream ) );
+        hipErrchk( hipEventRecord(copied[c], copy_stream) );
+
+        hipErrchk( hipStreamWaitEvent(compute_stream, copied[c], 0) );
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT((kend-kbegin)*n*n, block_size);
+        constexpr size_t shmem = 0;
+        hipLaunchKernelGGL((pitched_copy_compute<block_size>), dim3(grid_size), dim3(block_size), shmem, compute_stream,
+                           z, y, kbegin*n*n, kend*n*n);
+        hipErrchk( hipGetLastError() );
+      }
+      hipErrchk( hipEventRecord(computed, compute_stream) );
+      hipErrchk( hipStreamWaitEvent(copy_stream, computed, 0) );
+
+    }
+    stopTimer();
+
+    hipErrchk( hipEventDestroy(computed) );
+    for (hipEvent_t& event : copied) {
+      hipErrchk( hipEventDestroy(event) );
+    }
+    if (overlap) {
+      hipErrchk( hipStreamDestroy(compute_stream) );
+    }
+
+  } else {
+
+    getCout() << "\n  MEMCPY_3D : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+void MEMCPY_3D::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runHipVariantLibrary(vid);
+  }
+  t += 1;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantBlock<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  for (bool overlap : {false, true}) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantCompute<block_size>(vid, overlap);
+        }
+        t += 1;
+      }
+    });
+  }
+}
+
+void MEMCPY_3D::setHipTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "library");
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  for (const char* name : {"serial_compute_", "overlap_compute_"}) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, name+std::to_string(block_size));
+      }
+    });
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MEMCPY_3D kernel reference implementation:
+///
+/// // copy the n x n x n interior of x, which has a halo of h elements and
+/// // pitches px = py = n + 2*h, to the packed array y
+/// for (Index_type k = 0; k < n; ++k ) {
+///   for (Index_type j = 0; j < n; ++j ) {
+///     for (Index_type i = 0; i < n; ++i ) {
+///       y[i + j*n + k*n*n] = x[(i+h) + (j+h)*px + (k+h)*px*py];
+///     }
+///   }
+/// }
+///
+/// n is the cube root of the problem size and h is given by the kernel
+/// parameter "halo" (1 by default). Tunings copy with a loop nest (default)
+/// or a GPU kernel (block), or with a library copy of a row at a time on
+/// the CPU or of the whole subarray with cudaMemcpy3DAsync or
+/// hipMemcpy3DAsync on the GPU (library). GPU compute tunings also run a
+/// kernel reading each copied chunk, see algorithm/PitchedCopyUtils.hpp.
+///
+
+#ifndef RAJAPerf_Algorithm_MEMCPY_3D_HPP
+#define RAJAPerf_Algorithm_MEMCPY_3D_HPP
+
+#define MEMCPY_3D_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_ptr z = m_z; \
+  const Index_type n = m_n; \
+  const Index_type h = m_halo; \
+  const Index_type px = n + 2*h; \
+  const Index_type py = n + 2*h; \
+  const Index_type num_chunks = m_num_chunks; \
+  RAJA_UNUSED_VAR(z); \
+  RAJA_UNUSED_VAR(num_chunks);
+
+#define MEMCPY_3D_BODY \
+  y[i + j*n + k*n*n] = x[(i+h) + (j+h)*px + (k+h)*px*py];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class MEMCPY_3D : public KernelBase
+{
+public:
+
+  MEMCPY_3D(const RunParams& params);
+
+  ~MEMCPY_3D();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MEMCPY_3D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runSeqVariantLibrary(VariantID vid);
+  void runOpenMPVariantLibrary(VariantID vid);
+
+  void runCudaVariantLibrary(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantBlock(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantCompute(VariantID vid, bool overlap);
+
+  void runHipVariantLibrary(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantBlock(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantCompute(VariantID vid, bool overlap);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type m_n;
+  Index_type m_halo;
+  Index_type m_num_chunks;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Real_ptr m_z;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -34,6 +34,8 @@ MEMSET::MEMSET(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Streaming);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -42,6 +44,8 @@ MEMSET::MEMSET(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -52,6 +56,8 @@ MEMSET::MEMSET(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 MEMSET::~MEMSET()
@@ -0,0 +1,66 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Helpers shared by the pitched subarray copy kernels MEMCPY_2D and
+/// MEMCPY_3D.
+///
+/// The compute tunings of the GPU variants copy the subarray in chunks of
+/// its outermost dimension and, after the copy of each chunk, run a kernel
+/// that reads the copied chunk,
+///
+///   z[i] = pitched_copy_alpha * y[i] + z[i];
+///
+/// serial_compute tunings queue the chunk copies and compute kernels in
+/// order on one stream, overlap_compute tunings queue the copies on the
+/// stream of the variant and the compute kernels on a second stream that
+/// waits for the copy of its chunk, so the copy of a chunk overlaps the
+/// compute of the chunk before it. z is not part of the checksum.
+///
+
+#ifndef RAJAPerf_PitchedCopyUtils_HPP
+#define RAJAPerf_PitchedCopyUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+constexpr Real_type pitched_copy_alpha = 0.5;
+
+//
+// Return the first outer index of chunk c of num_chunks chunks of outer
+// indices [0, n).
+//
+inline Index_type pitchedCopyChunkBegin(Index_type c, Index_type num_chunks,
+                                        Index_type n)
+{
+  return (c * n) / num_chunks;
+}
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pitched_copy_compute(Real_ptr z, const Real_type* y,
+                                     Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+  if ( i < iend ) {
+    z[i] = pitched_copy_alpha * y[i] + z[i];
+  }
+}
+
+#endif
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -14,6 +14,8 @@
 
 #include "common/CudaDataUtils.hpp"
 
+#include <cooperative_groups.h>
+
 #include "cub/device/device_reduce.cuh"
 #include "cub/util_allocator.cuh"
 
@@ -26,12 +28,14 @@ namespace rajaperf
 namespace algorithm
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void reduce_sum(Real_ptr x, Real_ptr dsum, Real_type sum_init,
+__global__ void reduce_sum(Data_type* x, Data_type* dsum, Data_type sum_init,
                            Index_type iend)
 {
-  extern __shared__ Real_type psum[ ];
+  // shared memory is declared with one type for all data types
+  extern __shared__ Double_type psum_shmem[ ];
+  Data_type* psum = reinterpret_cast<Data_type*>(psum_shmem);
 
   Index_type i = blockIdx.x * block_size + threadIdx.x;
 
@@ -60,6 +64,7 @@ __global__ void reduce_sum(Real_ptr x, Real_ptr dsum, Real_type sum_init,
 }
 
 
+template < typename Data_type >
 void REDUCE_SUM::runCudaVariantCub(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -76,7 +81,7 @@ void REDUCE_SUM::runCudaVariantCub(VariantID vid)
 
     int len = iend - ibegin;
 
-    Real_type* sum_storage;
+    Data_type* sum_storage;
     allocData(DataSpace::CudaPinned, sum_storage, 1);
 
     // Determine temporary device storage requirements
@@ -88,7 +93,7 @@ void REDUCE_SUM::runCudaVariantCub(VariantID vid)
                                            sum_storage,
                                            len,
                                            ::cub::Sum(),
-                                           m_sum_init,
+                                           sum_init,
                                            stream));
 
     // Allocate temporary storage
@@ -107,11 +112,11 @@ void REDUCE_SUM::runCudaVariantCub(VariantID vid)
                                              sum_storage,
                                              len,
                                              ::cub::Sum(),
-                                             m_sum_init,
+                                             sum_init,
                                              stream));
 
       cudaErrchk(cudaStreamSynchronize(stream));
-      m_sum = *sum_storage;
+      m_sum = static_cast<Real_type>(*sum_storage);
 
     }
     stopTimer();
@@ -128,7 +133,49 @@ void REDUCE_SUM::runCudaVariantCub(VariantID vid)
 
 }
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_partial(Data_type* x, Data_type* dpartial,
+                                   Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type sum = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE_SUM_BODY;
+  }
+
+  sum = cuda_block_reduce<block_size, sum_op>(sum);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = sum;
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_final(Data_type* dpartial, Index_type num_partial,
+                                 Data_type* dsum, Data_type sum_init)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type sum = sum_op::identity();
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    sum += dpartial[ i ];
+  }
+
+  sum = cuda_block_reduce<block_size, sum_op>(sum);
+
+  if ( threadIdx.x == 0 ) {
+    *dsum = sum_init + sum;
+  }
+}
+
+
+template < typename Data_type, size_t block_size >
 void REDUCE_SUM::runCudaVariantBlock(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -141,26 +188,28 @@ void REDUCE_SUM::runCudaVariantBlock(VariantID vid)
 
   if ( vid == Base_CUDA ) {
 
-    Real_ptr dsum;
+    Data_type* dsum;
     allocData(DataSpace::CudaDevice, dsum, 1);
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      cudaErrchk( cudaMemcpyAsync( dsum, &m_sum_init, sizeof(Real_type),
+      cudaErrchk( cudaMemcpyAsync( dsum, &sum_init, sizeof(Data_type),
                                    cudaMemcpyHostToDevice, res.get_stream() ) );
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
-      constexpr size_t shmem = sizeof(Real_type)*block_size;
-      reduce_sum<block_size><<<grid_size, block_size,
+      constexpr size_t shmem = sizeof(Data_type)*block_size;
+      reduce_sum<Data_type, block_size><<<grid_size, block_size,
                   shmem, res.get_stream()>>>( x,
-                                                   dsum, m_sum_init,
+                                                   dsum, sum_init,
                                                    iend );
       cudaErrchk( cudaGetLastError() );
 
-      cudaErrchk( cudaMemcpyAsync( &m_sum, dsum, sizeof(Real_type),
+      Data_type sum;
+      cudaErrchk( cudaMemcpyAsync( &sum, dsum, sizeof(Data_type),
                                    cudaMemcpyDeviceToHost, res.get_stream() ) );
       cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
 
     }
     stopTimer();
@@ -172,14 +221,14 @@ void REDUCE_SUM::runCudaVariantBlock(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> sum(m_sum_init);
+      RAJA::ReduceSum<RAJA::cuda_reduce, Data_type> sum(sum_init);
 
       RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           REDUCE_SUM_BODY;
       });
 
-      m_sum = sum.get();
+      m_sum = static_cast<Real_type>(sum.get());
 
     }
     stopTimer();
@@ -192,7 +241,7 @@ void REDUCE_SUM::runCudaVariantBlock(VariantID vid)
 
 }
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 void REDUCE_SUM::runCudaVariantOccGS(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -205,30 +254,34 @@ void REDUCE_SUM::runCudaVariantOccGS(VariantID vid)
 
   if ( vid == Base_CUDA ) {
 
-    Real_ptr dsum;
+    Data_type* dsum;
     allocData(DataSpace::CudaDevice, dsum, 1);
 
-    constexpr size_t shmem = sizeof(Real_type)*block_size;
+    constexpr size_t shmem = sizeof(Data_type)*block_size;
     const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
-        (reduce_sum<block_size>), block_size, shmem);
+        (reduce_sum<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("reduce_sum",
+        (reduce_sum<Data_type, block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      cudaErrchk( cudaMemcpyAsync( dsum, &m_sum_init, sizeof(Real_type),
+      cudaErrchk( cudaMemcpyAsync( dsum, &sum_init, sizeof(Data_type),
                                    cudaMemcpyHostToDevice, res.get_stream() ) );
 
       const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       const size_t grid_size = std::min(normal_grid_size, max_grid_size);
-      reduce_sum<block_size><<<grid_size, block_size,
+      reduce_sum<Data_type, block_size><<<grid_size, block_size,
                                shmem, res.get_stream()>>>( x,
-                                                   dsum, m_sum_init,
+                                                   dsum, sum_init,
                                                    iend );
       cudaErrchk( cudaGetLastError() );
 
-      cudaErrchk( cudaMemcpyAsync( &m_sum, dsum, sizeof(Real_type),
+      Data_type sum;
+      cudaErrchk( cudaMemcpyAsync( &sum, dsum, sizeof(Data_type),
                                    cudaMemcpyDeviceToHost, res.get_stream() ) );
       cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
 
     }
     stopTimer();
@@ -240,18 +293,308 @@ void REDUCE_SUM::runCudaVariantOccGS(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> sum(m_sum_init);
+      RAJA::ReduceSum<RAJA::cuda_reduce, Data_type> sum(sum_init);
 
       RAJA::forall< RAJA::cuda_exec_occ_calc<block_size, true /*async*/> >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           REDUCE_SUM_BODY;
       });
 
-      m_sum = sum.get();
+      m_sum = static_cast<Real_type>(sum.get());
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  REDUCE_SUM : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+//
+// Each block reduces a fixed part of x and the block results are reduced
+// in order by a single block, so the sum is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void REDUCE_SUM::runCudaVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  REDUCE_SUM_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (reduce_sum_partial<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("reduce_sum_partial",
+        (reduce_sum_partial<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dsum;
+    allocData(DataSpace::CudaDevice, dsum, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::CudaDevice, dpartial, grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      reduce_sum_partial<Data_type, block_size><<<grid_size, block_size,
+                  shmem, res.get_stream()>>>( x, dpartial, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      reduce_sum_final<Data_type, block_size><<<1, block_size,
+                  shmem, res.get_stream()>>>( dpartial, grid_size,
+                                              dsum, sum_init );
+      cudaErrchk( cudaGetLastError() );
+
+      Data_type sum;
+      cudaErrchk( cudaMemcpyAsync( &sum, dsum, sizeof(Data_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dpartial);
+    deallocData(DataSpace::CudaDevice, dsum);
+
+  } else {
+
+    getCout() << "\n  REDUCE_SUM : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_atomic(Data_type* x, Data_type* dsum,
+                                  Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type sum = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE_SUM_BODY;
+  }
+
+  sum = cuda_warp_reduce<sum_op>(sum);
+
+  if ( threadIdx.x % cuda_warp_size == 0 ) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>( dsum, sum );
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_lastblock(Data_type* x, Data_type* dpartial,
+                                     unsigned int* dcount,
+                                     Data_type* dsum, Data_type sum_init,
+                                     Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  __shared__ bool is_last_block;
+
+  Data_type sum = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE_SUM_BODY;
+  }
+
+  sum = cuda_block_reduce<block_size, sum_op>(sum);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = sum;
+    // make the partial visible to the last block before counting this block,
+    // the count wraps back to 0 for the next launch
+    __threadfence();
+    is_last_block = ( atomicInc( dcount, gridDim.x - 1 ) == gridDim.x - 1 );
+  }
+  __syncthreads();
+
+  if ( is_last_block ) {
+
+    sum = sum_op::identity();
+    for ( Index_type j = threadIdx.x ; j < gridDim.x ; j += block_size ) {
+      sum += dpartial[ j ];
+    }
+
+    sum = cuda_block_reduce<block_size, sum_op>(sum);
+
+    if ( threadIdx.x == 0 ) {
+      *dsum = sum_init + sum;
+    }
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_coopgs(Data_type* x, Data_type* dpartial,
+                                  Data_type* dsum, Data_type sum_init,
+                                  Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+
+  Data_type sum = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE_SUM_BODY;
+  }
+
+  sum = cuda_block_reduce<block_size, sum_op>(sum);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = sum;
+  }
+
+  grid.sync();
+
+  if ( blockIdx.x == 0 ) {
+
+    sum = sum_op::identity();
+    for ( Index_type j = threadIdx.x ; j < gridDim.x ; j += block_size ) {
+      sum += dpartial[ j ];
+    }
+
+    sum = cuda_block_reduce<block_size, sum_op>(sum);
+
+    if ( threadIdx.x == 0 ) {
+      *dsum = sum_init + sum;
+    }
+  }
+}
+
+//
+// Each warp adds its result to the sum with an atomic in one kernel.
+//
+template < typename Data_type, size_t block_size >
+void REDUCE_SUM::runCudaVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  REDUCE_SUM_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (reduce_sum_atomic<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("reduce_sum_atomic",
+        (reduce_sum_atomic<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dsum;
+    allocData(DataSpace::CudaDevice, dsum, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemcpyAsync( dsum, &sum_init, sizeof(Data_type),
+                                   cudaMemcpyHostToDevice, res.get_stream() ) );
+
+      reduce_sum_atomic<Data_type, block_size><<<grid_size, block_size,
+                  shmem, res.get_stream()>>>( x, dsum, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      Data_type sum;
+      cudaErrchk( cudaMemcpyAsync( &sum, dsum, sizeof(Data_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dsum);
+
+  } else {
+
+    getCout() << "\n  REDUCE_SUM : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+//
+// Each block writes its result and the last block to finish, found with a
+// fence and an atomic counter, reduces the block results in order in the
+// same kernel, so the sum is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void REDUCE_SUM::runCudaVariantLastBlock(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  REDUCE_SUM_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (reduce_sum_lastblock<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("reduce_sum_lastblock",
+        (reduce_sum_lastblock<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dsum;
+    allocData(DataSpace::CudaDevice, dsum, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::CudaDevice, dpartial, grid_size);
+
+    unsigned int* dcount;
+    allocData(DataSpace::CudaDevice, dcount, 1);
+    cudaErrchk( cudaMemsetAsync( dcount, 0, sizeof(unsigned int),
+                                 res.get_stream() ) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      reduce_sum_lastblock<Data_type, block_size><<<grid_size, block_size,
+                  shmem, res.get_stream()>>>( x, dpartial, dcount,
+                                              dsum, sum_init, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      Data_type sum;
+      cudaErrchk( cudaMemcpyAsync( &sum, dsum, sizeof(Data_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
 
     }
     stopTimer();
 
+    deallocData(DataSpace::CudaDevice, dcount);
+    deallocData(DataSpace::CudaDevice, dpartial);
+    deallocData(DataSpace::CudaDevice, dsum);
+
   } else {
 
     getCout() << "\n  REDUCE_SUM : Unknown Cuda variant id = " << vid << std::endl;
@@ -260,7 +603,69 @@ void REDUCE_SUM::runCudaVariantOccGS(VariantID vid)
 
 }
 
-void REDUCE_SUM::runCudaVariant(VariantID vid, size_t tune_idx)
+//
+// Each block writes its result and the first block reduces the block
+// results in order after a grid sync in the same cooperative kernel, so
+// the sum is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void REDUCE_SUM::runCudaVariantCoopGS(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  REDUCE_SUM_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (reduce_sum_coopgs<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("reduce_sum_coopgs",
+        (reduce_sum_coopgs<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dsum;
+    allocData(DataSpace::CudaDevice, dsum, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::CudaDevice, dpartial, grid_size);
+
+    void* args[] = { &x, &dpartial, &dsum, (void*)&sum_init, &iend };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaLaunchCooperativeKernel(
+          (const void*)reduce_sum_coopgs<Data_type, block_size>, grid_size, block_size,
+          args, shmem, res.get_stream() ) );
+
+      Data_type sum;
+      cudaErrchk( cudaMemcpyAsync( &sum, dsum, sizeof(Data_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dpartial);
+    deallocData(DataSpace::CudaDevice, dsum);
+
+  } else {
+
+    getCout() << "\n  REDUCE_SUM : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < typename Data_type >
+void REDUCE_SUM::runCudaVariantTyped(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
 
@@ -268,7 +673,7 @@ void REDUCE_SUM::runCudaVariant(VariantID vid, size_t tune_idx)
 
     if (tune_idx == t) {
 
-      runCudaVariantCub(vid);
+      runCudaVariantCub<Data_type>(vid);
 
     }
 
@@ -286,7 +691,7 @@ void REDUCE_SUM::runCudaVariant(VariantID vid, size_t tune_idx)
         if (tune_idx == t) {
 
           setBlockSize(block_size);
-          runCudaVariantBlock<block_size>(vid);
+          runCudaVariantBlock<Data_type, block_size>(vid);
 
         }
 
@@ -295,7 +700,7 @@ void REDUCE_SUM::runCudaVariant(VariantID vid, size_t tune_idx)
         if (tune_idx == t) {
 
           setBlockSize(block_size);
-          runCudaVariantOccGS<block_size>(vid);
+          runCudaVariantOccGS<Data_type, block_size>(vid);
 
         }
 
@@ -305,6 +710,68 @@ void REDUCE_SUM::runCudaVariant(VariantID vid, size_t tune_idx)
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantTwoPass<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantAtomic<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantLastBlock<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+      if ( detail::haveCudaCooperativeLaunch() ) {
+
+        seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            if (tune_idx == t) {
+
+              setBlockSize(block_size);
+              runCudaVariantCoopGS<Data_type, block_size>(vid);
+
+            }
+
+            t += 1;
+
+          }
+
+        });
+
+      }
+
+    }
+
   } else {
 
     getCout() << "\n  REDUCE_SUM : Unknown Cuda variant id = " << vid << std::endl;
@@ -313,6 +780,8 @@ void REDUCE_SUM::runCudaVariant(VariantID vid, size_t tune_idx)
 
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(REDUCE_SUM, Cuda)
+
 void REDUCE_SUM::setCudaTuningDefinitions(VariantID vid)
 {
   if ( vid == Base_CUDA ) {
@@ -336,6 +805,40 @@ void REDUCE_SUM::setCudaTuningDefinitions(VariantID vid)
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "atomic_"+std::to_string(block_size));
+
+          addReproducibleVariantTuningName(vid, "lastblock_"+std::to_string(block_size));
+
+        }
+
+      });
+
+      if ( detail::haveCudaCooperativeLaunch() ) {
+
+        seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            addReproducibleVariantTuningName(vid, "coopgs_"+std::to_string(block_size));
+
+          }
+
+        });
+
+      }
+
+    }
+
   }
 }
 
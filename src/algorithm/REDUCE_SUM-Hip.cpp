@@ -22,6 +22,8 @@
 
 #include "common/HipDataUtils.hpp"
 
+#include <hip/hip_cooperative_groups.h>
+
 #include <iostream>
 #include <utility>
 
@@ -31,12 +33,14 @@ namespace rajaperf
 namespace algorithm
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void reduce_sum(Real_ptr x, Real_ptr dsum, Real_type sum_init,
+__global__ void reduce_sum(Data_type* x, Data_type* dsum, Data_type sum_init,
                            Index_type iend)
 {
-  HIP_DYNAMIC_SHARED(Real_type, psum);
+  // shared memory is declared with one type for all data types
+  HIP_DYNAMIC_SHARED(Double_type, psum_shmem);
+  Data_type* psum = reinterpret_cast<Data_type*>(psum_shmem);
 
   Index_type i = blockIdx.x * block_size + threadIdx.x;
 
@@ -65,6 +69,7 @@ __global__ void reduce_sum(Real_ptr x, Real_ptr dsum, Real_type sum_init,
 }
 
 
+template < typename Data_type >
 void REDUCE_SUM::runHipVariantRocprim(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -81,7 +86,7 @@ void REDUCE_SUM::runHipVariantRocprim(VariantID vid)
 
     int len = iend - ibegin;
 
-    Real_type* sum_storage;
+    Data_type* sum_storage;
     allocData(DataSpace::HipPinned, sum_storage, 1);
 
     // Determine temporary device storage requirements
@@ -92,9 +97,9 @@ void REDUCE_SUM::runHipVariantRocprim(VariantID vid)
                                 temp_storage_bytes,
                                 x+ibegin,
                                 sum_storage,
-                                m_sum_init,
+                                sum_init,
                                 len,
-                                rocprim::plus<Real_type>(),
+                                rocprim::plus<Data_type>(),
                                 stream));
 #elif defined(__CUDACC__)
     hipErrchk(::cub::DeviceReduce::Reduce(d_temp_storage,
@@ -103,7 +108,7 @@ void REDUCE_SUM::runHipVariantRocprim(VariantID vid)
                                           sum_storage,
                                           len,
                                           ::cub::Sum(),
-                                          m_sum_init,
+                                          sum_init,
                                           stream));
 #endif
 
@@ -122,9 +127,9 @@ void REDUCE_SUM::runHipVariantRocprim(VariantID vid)
                                   temp_storage_bytes,
                                   x+ibegin,
                                   sum_storage,
-                                  m_sum_init,
+                                  sum_init,
                                   len,
-                                  rocprim::plus<Real_type>(),
+                                  rocprim::plus<Data_type>(),
                                   stream));
 #elif defined(__CUDACC__)
       hipErrchk(::cub::DeviceReduce::Reduce(d_temp_storage,
@@ -133,12 +138,12 @@ void REDUCE_SUM::runHipVariantRocprim(VariantID vid)
                                             sum_storage,
                                             len,
                                             ::cub::Sum(),
-                                            m_sum_init,
+                                            sum_init,
                                             stream));
 #endif
 
       hipErrchk(hipStreamSynchronize(stream));
-      m_sum = *sum_storage;
+      m_sum = static_cast<Real_type>(*sum_storage);
 
     }
     stopTimer();
@@ -155,7 +160,49 @@ void REDUCE_SUM::runHipVariantRocprim(VariantID vid)
 
 }
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_partial(Data_type* x, Data_type* dpartial,
+                                   Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type sum = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE_SUM_BODY;
+  }
+
+  sum = hip_block_reduce<block_size, sum_op>(sum);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = sum;
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_final(Data_type* dpartial, Index_type num_partial,
+                                 Data_type* dsum, Data_type sum_init)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type sum = sum_op::identity();
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    sum += dpartial[ i ];
+  }
+
+  sum = hip_block_reduce<block_size, sum_op>(sum);
+
+  if ( threadIdx.x == 0 ) {
+    *dsum = sum_init + sum;
+  }
+}
+
+
+template < typename Data_type, size_t block_size >
 void REDUCE_SUM::runHipVariantBlock(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -168,25 +215,27 @@ void REDUCE_SUM::runHipVariantBlock(VariantID vid)
 
   if ( vid == Base_HIP ) {
 
-    Real_ptr dsum;
+    Data_type* dsum;
     allocData(DataSpace::HipDevice, dsum, 1);
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      hipErrchk( hipMemcpyAsync( dsum, &m_sum_init, sizeof(Real_type),
+      hipErrchk( hipMemcpyAsync( dsum, &sum_init, sizeof(Data_type),
                                  hipMemcpyHostToDevice, res.get_stream() ) );
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
-      constexpr size_t shmem = sizeof(Real_type)*block_size;
-      hipLaunchKernelGGL( (reduce_sum<block_size>), dim3(grid_size), dim3(block_size),
+      constexpr size_t shmem = sizeof(Data_type)*block_size;
+      hipLaunchKernelGGL( (reduce_sum<Data_type, block_size>), dim3(grid_size), dim3(block_size),
                           shmem, res.get_stream(),
-                          x, dsum, m_sum_init, iend );
+                          x, dsum, sum_init, iend );
       hipErrchk( hipGetLastError() );
 
-      hipErrchk( hipMemcpyAsync( &m_sum, dsum, sizeof(Real_type),
+      Data_type sum;
+      hipErrchk( hipMemcpyAsync( &sum, dsum, sizeof(Data_type),
                                  hipMemcpyDeviceToHost, res.get_stream() ) );
       hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
 
     }
     stopTimer();
@@ -198,14 +247,14 @@ void REDUCE_SUM::runHipVariantBlock(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::ReduceSum<RAJA::hip_reduce, Real_type> sum(m_sum_init);
+      RAJA::ReduceSum<RAJA::hip_reduce, Data_type> sum(sum_init);
 
       RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           REDUCE_SUM_BODY;
       });
 
-      m_sum = sum.get();
+      m_sum = static_cast<Real_type>(sum.get());
 
     }
     stopTimer();
@@ -218,7 +267,7 @@ void REDUCE_SUM::runHipVariantBlock(VariantID vid)
 
 }
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 void REDUCE_SUM::runHipVariantOccGS(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -231,29 +280,33 @@ void REDUCE_SUM::runHipVariantOccGS(VariantID vid)
 
   if ( vid == Base_HIP ) {
 
-    Real_ptr dsum;
+    Data_type* dsum;
     allocData(DataSpace::HipDevice, dsum, 1);
 
-    constexpr size_t shmem = sizeof(Real_type)*block_size;
+    constexpr size_t shmem = sizeof(Data_type)*block_size;
     const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
-        (reduce_sum<block_size>), block_size, shmem);
+        (reduce_sum<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce_sum",
+        (reduce_sum<Data_type, block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      hipErrchk( hipMemcpyAsync( dsum, &m_sum_init, sizeof(Real_type),
+      hipErrchk( hipMemcpyAsync( dsum, &sum_init, sizeof(Data_type),
                                  hipMemcpyHostToDevice, res.get_stream() ) );
 
       const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       const size_t grid_size = std::min(normal_grid_size, max_grid_size);
-      hipLaunchKernelGGL( (reduce_sum<block_size>), dim3(grid_size), dim3(block_size),
+      hipLaunchKernelGGL( (reduce_sum<Data_type, block_size>), dim3(grid_size), dim3(block_size),
                           shmem, res.get_stream(),
-                          x, dsum, m_sum_init, iend );
+                          x, dsum, sum_init, iend );
       hipErrchk( hipGetLastError() );
 
-      hipErrchk( hipMemcpyAsync( &m_sum, dsum, sizeof(Real_type),
+      Data_type sum;
+      hipErrchk( hipMemcpyAsync( &sum, dsum, sizeof(Data_type),
                                  hipMemcpyDeviceToHost, res.get_stream() ) );
       hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
 
     }
     stopTimer();
@@ -265,18 +318,310 @@ void REDUCE_SUM::runHipVariantOccGS(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::ReduceSum<RAJA::hip_reduce, Real_type> sum(m_sum_init);
+      RAJA::ReduceSum<RAJA::hip_reduce, Data_type> sum(sum_init);
 
       RAJA::forall< RAJA::hip_exec_occ_calc<block_size, true /*async*/> >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           REDUCE_SUM_BODY;
       });
 
-      m_sum = sum.get();
+      m_sum = static_cast<Real_type>(sum.get());
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  REDUCE_SUM : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+//
+// Each block reduces a fixed part of x and the block results are reduced
+// in order by a single block, so the sum is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void REDUCE_SUM::runHipVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE_SUM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (reduce_sum_partial<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce_sum_partial",
+        (reduce_sum_partial<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dsum;
+    allocData(DataSpace::HipDevice, dsum, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::HipDevice, dpartial, grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL( (reduce_sum_partial<Data_type, block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          x, dpartial, iend );
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL( (reduce_sum_final<Data_type, block_size>), dim3(1), dim3(block_size),
+                          shmem, res.get_stream(),
+                          dpartial, grid_size, dsum, sum_init );
+      hipErrchk( hipGetLastError() );
+
+      Data_type sum;
+      hipErrchk( hipMemcpyAsync( &sum, dsum, sizeof(Data_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, dpartial);
+    deallocData(DataSpace::HipDevice, dsum);
+
+  } else {
+
+    getCout() << "\n  REDUCE_SUM : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_atomic(Data_type* x, Data_type* dsum,
+                                  Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type sum = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE_SUM_BODY;
+  }
+
+  sum = hip_warp_reduce<sum_op>(sum);
+
+  if ( threadIdx.x % hip_warp_size == 0 ) {
+    RAJA::atomicAdd<RAJA::hip_atomic>( dsum, sum );
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_lastblock(Data_type* x, Data_type* dpartial,
+                                     unsigned int* dcount,
+                                     Data_type* dsum, Data_type sum_init,
+                                     Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  __shared__ bool is_last_block;
+
+  Data_type sum = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE_SUM_BODY;
+  }
+
+  sum = hip_block_reduce<block_size, sum_op>(sum);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = sum;
+    // make the partial visible to the last block before counting this block,
+    // the count wraps back to 0 for the next launch
+    __threadfence();
+    is_last_block = ( atomicInc( dcount, gridDim.x - 1 ) == gridDim.x - 1 );
+  }
+  __syncthreads();
+
+  if ( is_last_block ) {
+
+    sum = sum_op::identity();
+    for ( Index_type j = threadIdx.x ; j < gridDim.x ; j += block_size ) {
+      sum += dpartial[ j ];
+    }
+
+    sum = hip_block_reduce<block_size, sum_op>(sum);
+
+    if ( threadIdx.x == 0 ) {
+      *dsum = sum_init + sum;
+    }
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_sum_coopgs(Data_type* x, Data_type* dpartial,
+                                  Data_type* dsum, Data_type sum_init,
+                                  Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+
+  Data_type sum = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE_SUM_BODY;
+  }
+
+  sum = hip_block_reduce<block_size, sum_op>(sum);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = sum;
+  }
+
+  grid.sync();
+
+  if ( blockIdx.x == 0 ) {
+
+    sum = sum_op::identity();
+    for ( Index_type j = threadIdx.x ; j < gridDim.x ; j += block_size ) {
+      sum += dpartial[ j ];
+    }
+
+    sum = hip_block_reduce<block_size, sum_op>(sum);
+
+    if ( threadIdx.x == 0 ) {
+      *dsum = sum_init + sum;
+    }
+  }
+}
+
+//
+// Each warp adds its result to the sum with an atomic in one kernel.
+//
+template < typename Data_type, size_t block_size >
+void REDUCE_SUM::runHipVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE_SUM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (reduce_sum_atomic<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce_sum_atomic",
+        (reduce_sum_atomic<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dsum;
+    allocData(DataSpace::HipDevice, dsum, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemcpyAsync( dsum, &sum_init, sizeof(Data_type),
+                                   hipMemcpyHostToDevice, res.get_stream() ) );
+
+      hipLaunchKernelGGL( (reduce_sum_atomic<Data_type, block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          x, dsum, iend );
+      hipErrchk( hipGetLastError() );
+
+      Data_type sum;
+      hipErrchk( hipMemcpyAsync( &sum, dsum, sizeof(Data_type),
+                                   hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, dsum);
+
+  } else {
+
+    getCout() << "\n  REDUCE_SUM : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+//
+// Each block writes its result and the last block to finish, found with a
+// fence and an atomic counter, reduces the block results in order in the
+// same kernel, so the sum is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void REDUCE_SUM::runHipVariantLastBlock(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE_SUM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (reduce_sum_lastblock<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce_sum_lastblock",
+        (reduce_sum_lastblock<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dsum;
+    allocData(DataSpace::HipDevice, dsum, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::HipDevice, dpartial, grid_size);
+
+    unsigned int* dcount;
+    allocData(DataSpace::HipDevice, dcount, 1);
+    hipErrchk( hipMemsetAsync( dcount, 0, sizeof(unsigned int),
+                                 res.get_stream() ) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL( (reduce_sum_lastblock<Data_type, block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          x, dpartial, dcount, dsum, sum_init, iend );
+      hipErrchk( hipGetLastError() );
+
+      Data_type sum;
+      hipErrchk( hipMemcpyAsync( &sum, dsum, sizeof(Data_type),
+                                   hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
 
     }
     stopTimer();
 
+    deallocData(DataSpace::HipDevice, dcount);
+    deallocData(DataSpace::HipDevice, dpartial);
+    deallocData(DataSpace::HipDevice, dsum);
+
   } else {
 
     getCout() << "\n  REDUCE_SUM : Unknown Hip variant id = " << vid << std::endl;
@@ -285,7 +630,69 @@ void REDUCE_SUM::runHipVariantOccGS(VariantID vid)
 
 }
 
-void REDUCE_SUM::runHipVariant(VariantID vid, size_t tune_idx)
+//
+// Each block writes its result and the first block reduces the block
+// results in order after a grid sync in the same cooperative kernel, so
+// the sum is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void REDUCE_SUM::runHipVariantCoopGS(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE_SUM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (reduce_sum_coopgs<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce_sum_coopgs",
+        (reduce_sum_coopgs<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dsum;
+    allocData(DataSpace::HipDevice, dsum, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::HipDevice, dpartial, grid_size);
+
+    void* args[] = { &x, &dpartial, &dsum, (void*)&sum_init, &iend };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipLaunchCooperativeKernel(
+          reinterpret_cast<const void*>(reduce_sum_coopgs<Data_type, block_size>),
+          dim3(grid_size), dim3(block_size), args, shmem, res.get_stream() ) );
+
+      Data_type sum;
+      hipErrchk( hipMemcpyAsync( &sum, dsum, sizeof(Data_type),
+                                   hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_sum = static_cast<Real_type>(sum);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, dpartial);
+    deallocData(DataSpace::HipDevice, dsum);
+
+  } else {
+
+    getCout() << "\n  REDUCE_SUM : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < typename Data_type >
+void REDUCE_SUM::runHipVariantTyped(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
 
@@ -293,7 +700,7 @@ void REDUCE_SUM::runHipVariant(VariantID vid, size_t tune_idx)
 
     if (tune_idx == t) {
 
-      runHipVariantRocprim(vid);
+      runHipVariantRocprim<Data_type>(vid);
 
     }
 
@@ -311,7 +718,7 @@ void REDUCE_SUM::runHipVariant(VariantID vid, size_t tune_idx)
         if (tune_idx == t) {
 
           setBlockSize(block_size);
-          runHipVariantBlock<block_size>(vid);
+          runHipVariantBlock<Data_type, block_size>(vid);
 
         }
 
@@ -320,7 +727,7 @@ void REDUCE_SUM::runHipVariant(VariantID vid, size_t tune_idx)
         if (tune_idx == t) {
 
           setBlockSize(block_size);
-          runHipVariantOccGS<block_size>(vid);
+          runHipVariantOccGS<Data_type, block_size>(vid);
 
         }
 
@@ -330,6 +737,68 @@ void REDUCE_SUM::runHipVariant(VariantID vid, size_t tune_idx)
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantTwoPass<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantAtomic<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantLastBlock<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+      if ( detail::haveHipCooperativeLaunch() ) {
+
+        seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            if (tune_idx == t) {
+
+              setBlockSize(block_size);
+              runHipVariantCoopGS<Data_type, block_size>(vid);
+
+            }
+
+            t += 1;
+
+          }
+
+        });
+
+      }
+
+    }
+
   } else {
 
     getCout() << "\n  REDUCE_SUM : Unknown Hip variant id = " << vid << std::endl;
@@ -338,6 +807,8 @@ void REDUCE_SUM::runHipVariant(VariantID vid, size_t tune_idx)
 
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(REDUCE_SUM, Hip)
+
 void REDUCE_SUM::setHipTuningDefinitions(VariantID vid)
 {
   if ( vid == Base_HIP ) {
@@ -365,6 +836,40 @@ void REDUCE_SUM::setHipTuningDefinitions(VariantID vid)
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "atomic_"+std::to_string(block_size));
+
+          addReproducibleVariantTuningName(vid, "lastblock_"+std::to_string(block_size));
+
+        }
+
+      });
+
+      if ( detail::haveHipCooperativeLaunch() ) {
+
+        seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            addReproducibleVariantTuningName(vid, "coopgs_"+std::to_string(block_size));
+
+          }
+
+        });
+
+      }
+
+    }
+
   }
 
 }
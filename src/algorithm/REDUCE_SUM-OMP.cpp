@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,8 +19,79 @@ namespace algorithm
 {
 
 
-void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// Each thread sums a fixed block of the iteration space and the thread
+// partial sums are combined in thread order, so the result is the same in
+// every run that uses the same number of threads.
+//
+template < typename Data_type >
+void REDUCE_SUM::runOpenMPVariantOrdered(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_SUM_DATA_SETUP;
+
+  // partial sum of each thread
+  const Index_type nthreads = omp_get_max_threads();
+  std::vector<Data_type> partial_sums(nthreads);
+  Data_type* partial = partial_sums.data();
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Index_type nt_used = 1;
+
+      #pragma omp parallel
+      {
+        const Index_type nt = omp_get_num_threads();
+        const Index_type tid = omp_get_thread_num();
+        const Index_type len = iend - ibegin;
+
+        Data_type sum = 0;
+        for (Index_type i = ibegin + (len*tid)/nt;
+             i < ibegin + (len*(tid+1))/nt; ++i ) {
+          REDUCE_SUM_BODY;
+        }
+        partial[tid] = sum;
+
+        if ( tid == 0 ) {
+          nt_used = nt;
+        }
+      }
+
+      Data_type sum = sum_init;
+      for (Index_type t = 0; t < nt_used; ++t ) {
+        sum += partial[t];
+      }
+
+      m_sum = static_cast<Real_type>(sum);
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  REDUCE_SUM : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < typename Data_type >
+void REDUCE_SUM::runOpenMPVariantTyped(VariantID vid, size_t tune_idx)
 {
+  if ( vid == Base_OpenMP && tune_idx == 1 ) {
+    runOpenMPVariantOrdered<Data_type>(vid);
+    return;
+  }
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
@@ -35,14 +107,14 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sum = m_sum_init;
+        Data_type sum = sum_init;
 
         #pragma omp parallel for reduction(+:sum)
         for (Index_type i = ibegin; i < iend; ++i ) {
           REDUCE_SUM_BODY;
         }
 
-        m_sum = sum;
+        m_sum = static_cast<Real_type>(sum);
 
       }
       stopTimer();
@@ -59,14 +131,14 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sum = m_sum_init;
+        Data_type sum = sum_init;
 
         #pragma omp parallel for reduction(+:sum)
         for (Index_type i = ibegin; i < iend; ++i ) {
           sum += sumreduce_base_lam(i);
         }
 
-        m_sum = sum;
+        m_sum = static_cast<Real_type>(sum);
 
       }
       stopTimer();
@@ -79,7 +151,7 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> sum(m_sum_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Data_type> sum(sum_init);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend),
@@ -87,7 +159,7 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
             REDUCE_SUM_BODY;
         });
 
-        m_sum = sum.get();
+        m_sum = static_cast<Real_type>(sum.get());
 
       }
       stopTimer();
@@ -103,8 +175,20 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(REDUCE_SUM, OpenMP)
+
+void REDUCE_SUM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addReproducibleVariantTuningName(vid, "ordered");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -27,9 +27,12 @@ namespace algorithm
   const size_t threads_per_team = 256;
 
 
-void REDUCE_SUM::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void REDUCE_SUM::runOpenMPTargetVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -40,16 +43,25 @@ void REDUCE_SUM::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      Real_type sum = m_sum_init;
+      Data_type sum = sum_init;
 
-      #pragma omp target is_device_ptr(x) device( did ) map(tofrom:sum)
-      #pragma omp teams distribute parallel for reduction(+:sum) \
-              thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        REDUCE_SUM_BODY;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x) device( did ) map(tofrom:sum)
+        #pragma omp teams distribute parallel for reduction(+:sum) \
+                num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          REDUCE_SUM_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x) device( did ) map(tofrom:sum)
+        #pragma omp teams distribute parallel for reduction(+:sum) \
+                thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          REDUCE_SUM_BODY;
+        }
       }
 
-      m_sum = sum;
+      m_sum = static_cast<Real_type>(sum);
 
     }
     stopTimer();
@@ -59,7 +71,7 @@ void REDUCE_SUM::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::ReduceSum<RAJA::omp_target_reduce, Real_type> sum(m_sum_init);
+      RAJA::ReduceSum<RAJA::omp_target_reduce, Data_type> sum(sum_init);
 
       RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
         RAJA::RangeSegment(ibegin, iend),
@@ -67,7 +79,7 @@ void REDUCE_SUM::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
           REDUCE_SUM_BODY;
       });
 
-      m_sum = sum.get();
+      m_sum = static_cast<Real_type>(sum.get());
 
     }
     stopTimer();
@@ -78,6 +90,8 @@ void REDUCE_SUM::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(REDUCE_SUM, OpenMPTarget)
+
 } // end namespace algorithm
 } // end namespace rajaperf
 
@@ -18,7 +18,8 @@ namespace algorithm
 {
 
 
-void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void REDUCE_SUM::runSeqVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -33,13 +34,13 @@ void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sum = m_sum_init;
+        Data_type sum = sum_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           REDUCE_SUM_BODY;
         }
 
-        m_sum = sum;
+        m_sum = static_cast<Real_type>(sum);
 
       }
       stopTimer();
@@ -57,13 +58,13 @@ void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sum = m_sum_init;
+        Data_type sum = sum_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           sum += reduce_sum_base_lam(i);
         }
 
-        m_sum = sum;
+        m_sum = static_cast<Real_type>(sum);
 
       }
       stopTimer();
@@ -76,14 +77,14 @@ void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> sum(m_sum_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Data_type> sum(sum_init);
 
         RAJA::forall<RAJA::seq_exec>( RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
             REDUCE_SUM_BODY;
         });
 
-        m_sum = sum.get();
+        m_sum = static_cast<Real_type>(sum.get());
 
       }
       stopTimer();
@@ -100,5 +101,7 @@ void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(REDUCE_SUM, Seq)
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -35,6 +35,10 @@ REDUCE_SUM::REDUCE_SUM(const RunParams& params)
   setUsesFeature(Forall);
   setUsesFeature(Reduction);
 
+  setHasPattern(ReductionBound);
+
+  setUsesDataTypes();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -43,6 +47,8 @@ REDUCE_SUM::REDUCE_SUM(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -57,11 +63,9 @@ REDUCE_SUM::~REDUCE_SUM()
 {
 }
 
-void REDUCE_SUM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_SUM::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitData(m_x, getActualProblemSize(), vid);
-  m_sum_init = 0.0;
-  m_sum = 0.0;
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void REDUCE_SUM::updateChecksum(VariantID vid, size_t tune_idx)
@@ -69,10 +73,27 @@ void REDUCE_SUM::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid].at(tune_idx) += calcChecksum(&m_sum, 1, vid);
 }
 
-void REDUCE_SUM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_SUM::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void REDUCE_SUM::setUpTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Data_type* x;
+  allocAndInitDataRandValue(x, getActualProblemSize(), vid);
+  m_x = x;
+  m_sum_init = 0.0;
+  m_sum = 0.0;
+}
+
+template < typename Data_type >
+void REDUCE_SUM::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  (void) vid;
-  deallocData(m_x, vid);
+  Data_type* x = static_cast<Data_type*>(m_x);
+  deallocData(x, vid);
+  m_x = nullptr;
 }
 
 } // end namespace algorithm
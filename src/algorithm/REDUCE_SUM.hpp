@@ -23,7 +23,8 @@
 #define RAJAPerf_Algorithm_REDUCE_SUM_HPP
 
 #define REDUCE_SUM_DATA_SETUP \
-  Real_ptr x = m_x;
+  Data_type* x = static_cast<Data_type*>(m_x); \
+  const Data_type sum_init = static_cast<Data_type>(m_sum_init);
 
 #define REDUCE_SUM_STD_ARGS  \
   x + ibegin, x + iend
@@ -33,6 +34,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "common/DataTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -59,24 +61,64 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  template < typename Data_type >
+  void setUpTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void tearDownTyped(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void runSeqVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPTargetVariantTyped(VariantID vid, size_t tune_idx);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantOrdered(VariantID vid);
+  template < typename Data_type >
   void runCudaVariantCub(VariantID vid);
+  template < typename Data_type >
   void runHipVariantRocprim(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
   void runCudaVariantBlock(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
   void runCudaVariantOccGS(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
   void runHipVariantBlock(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
   void runHipVariantOccGS(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantTwoPass(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantTwoPass(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantAtomic(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantAtomic(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantLastBlock(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantLastBlock(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantCoopGS(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantCoopGS(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  // warp shuffle tunings need whole warps on every gpu backend
+  using gpu_warp_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                     gpu_block_size::MultipleOf<64>>;
 
-  Real_ptr m_x;
+  void* m_x;        // array of Data_type
   Real_type m_sum_init;
   Real_type m_sum;
 };
@@ -25,7 +25,8 @@ namespace algorithm
 {
 
 
-void SCAN::runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SCAN::runCudaVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -39,8 +40,8 @@ void SCAN::runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
     cudaStream_t stream = res.get_stream();
 
-    RAJA::operators::plus<Real_type> binary_op;
-    Real_type init_val = 0.0;
+    RAJA::operators::plus<Data_type> binary_op;
+    Data_type init_val = 0;
 
     int len = iend - ibegin;
 
@@ -95,6 +96,8 @@ void SCAN::runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   }
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SCAN, Cuda)
+
 } // end namespace algorithm
 } // end namespace rajaperf
 
@@ -30,7 +30,8 @@ namespace algorithm
 {
 
 
-void SCAN::runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SCAN::runHipVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -44,8 +45,8 @@ void SCAN::runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
     hipStream_t stream = res.get_stream();
 
-    RAJA::operators::plus<Real_type> binary_op;
-    Real_type init_val = 0.0;
+    RAJA::operators::plus<Data_type> binary_op;
+    Data_type init_val = 0;
 
     int len = iend - ibegin;
 
@@ -122,6 +123,8 @@ void SCAN::runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   }
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SCAN, Hip)
+
 } // end namespace algorithm
 } // end namespace rajaperf
 
@@ -18,8 +18,93 @@ namespace rajaperf
 namespace algorithm
 {
 
-void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// Each thread sums a block of omp_scan_block_length elements, the threads
+// add the sums of the threads before them to the scan of the blocks before,
+// and each thread scans its block, so x is read a second time from cache
+// and y is written once.
+//
+template < typename Data_type >
+void SCAN::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    const int p0 = omp_get_max_threads();
+    ::std::vector<Data_type> thread_sums(p0);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      SCAN_PROLOGUE;
+
+      #pragma omp parallel num_threads(p0)
+      {
+        const int p = omp_get_num_threads();
+        const int pid = omp_get_thread_num();
+
+        Data_type block_scan_var = scan_var;
+        for (Index_type block_begin = ibegin; block_begin < iend;
+             block_begin += p * omp_scan_block_length) {
+
+          const Index_type local_begin =
+              std::min(block_begin + pid * omp_scan_block_length, iend);
+          const Index_type local_end =
+              std::min(local_begin + omp_scan_block_length, iend);
+
+          Data_type local_sum_var = 0;
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            local_sum_var += x[i];
+          }
+          thread_sums[pid] = local_sum_var;
+
+          #pragma omp barrier
+
+          Data_type local_scan_var = block_scan_var;
+          for (int ip = 0; ip < pid; ++ip) {
+            local_scan_var += thread_sums[ip];
+          }
+          for (int ip = 0; ip < p; ++ip) {
+            block_scan_var += thread_sums[ip];
+          }
+
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            y[i] = local_scan_var;
+            local_scan_var += x[i];
+          }
+
+          // thread_sums is written again for the next block
+          #pragma omp barrier
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  SCAN : Unknown variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < typename Data_type >
+void SCAN::runOpenMPVariantTyped(VariantID vid, size_t tune_idx)
 {
+  if ( vid == Base_OpenMP && tune_idx == 1 ) {
+    runOpenMPVariantBlocked<Data_type>(vid);
+    return;
+  }
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
@@ -36,7 +121,7 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #else
       const Index_type n = iend - ibegin;
       const int p0 = static_cast<int>(std::min(n, static_cast<Index_type>(omp_get_max_threads())));
-      ::std::vector<Real_type> thread_sums(p0);
+      ::std::vector<Data_type> thread_sums(p0);
 #endif
 
       startTimer();
@@ -60,7 +145,7 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
           const Index_type local_begin = pid * step + ibegin;
           const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
 
-          Real_type local_scan_var = (pid == 0) ? scan_var : 0;
+          Data_type local_scan_var = (pid == 0) ? scan_var : 0;
           for (Index_type i = local_begin; i < local_end; ++i ) {
             y[i] = local_scan_var;
             local_scan_var += x[i];
@@ -71,7 +156,7 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
           if (pid != 0) {
 
-            Real_type prev_sum = 0;
+            Data_type prev_sum = 0;
             for (int ip = 0; ip < pid; ++ip) {
               prev_sum += thread_sums[ip];
             }
@@ -92,7 +177,7 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
     case Lambda_OpenMP : {
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
-        auto scan_lam = [=](Index_type i, Real_type scan_var) {
+        auto scan_lam = [=](Index_type i, Data_type scan_var) {
                           y[i] = scan_var;
                           return x[i];
                         };
@@ -100,16 +185,16 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
         auto scan_lam_input = [=](Index_type i) {
                           return x[i];
                         };
-        auto scan_lam_sum_output = [=](Index_type i, Real_type sum_var) {
+        auto scan_lam_sum_output = [=](Index_type i, Data_type sum_var) {
                           y[i] += sum_var;
                         };
-        auto scan_lam_output = [=](Index_type i, Real_type scan_var) {
+        auto scan_lam_output = [=](Index_type i, Data_type scan_var) {
                           y[i] = scan_var;
                         };
 
         const Index_type n = iend - ibegin;
         const int p0 = static_cast<int>(std::min(n, static_cast<Index_type>(omp_get_max_threads())));
-        ::std::vector<Real_type> thread_sums(p0);
+        ::std::vector<Data_type> thread_sums(p0);
 #endif
 
       startTimer();
@@ -133,7 +218,7 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
           const Index_type local_begin = pid * step + ibegin;
           const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
 
-          Real_type local_scan_var = (pid == 0) ? scan_var : 0;
+          Data_type local_scan_var = (pid == 0) ? scan_var : 0;
           for (Index_type i = local_begin; i < local_end; ++i ) {
             scan_lam_output(i, local_scan_var);
             local_scan_var += scan_lam_input(i);
@@ -143,7 +228,7 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
           #pragma omp barrier
 
           if (pid != 0) {
-            Real_type prev_sum = 0;
+            Data_type prev_sum = 0;
             for (int ip = 0; ip < pid; ++ip) {
               prev_sum += thread_sums[ip];
             }
@@ -182,8 +267,20 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SCAN, OpenMP)
+
+void SCAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "blocked");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -30,11 +30,14 @@ namespace algorithm
 #endif
 
 
-void SCAN::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SCAN::runOpenMPTargetVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
 
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -49,13 +52,24 @@ void SCAN::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
         SCAN_PROLOGUE;
 
-        #pragma omp target is_device_ptr(x,y) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1) \
-                                                  reduction(inscan, +:scan_var)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          y[i] = scan_var;
-          #pragma omp scan exclusive(scan_var)
-          scan_var += x[i];
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(x,y) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1) \
+                                                    reduction(inscan, +:scan_var)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            y[i] = scan_var;
+            #pragma omp scan exclusive(scan_var)
+            scan_var += x[i];
+          }
+        } else {
+          #pragma omp target is_device_ptr(x,y) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1) \
+                                                    reduction(inscan, +:scan_var)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            y[i] = scan_var;
+            #pragma omp scan exclusive(scan_var)
+            scan_var += x[i];
+          }
         }
 
       }
@@ -71,6 +85,8 @@ void SCAN::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 #endif
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SCAN, OpenMPTarget)
+
 } // end namespace algorithm
 } // end namespace rajaperf
 
@@ -18,7 +18,8 @@ namespace algorithm
 {
 
 
-void SCAN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SCAN::runSeqVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -86,5 +87,7 @@ void SCAN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SCAN, Seq)
+
 } // end namespace algorithm
 } // end namespace rajaperf
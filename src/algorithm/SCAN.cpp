@@ -38,6 +38,10 @@ SCAN::SCAN(const RunParams& params)
 
   setUsesFeature(Scan);
 
+  setHasPattern(ReductionBound);
+
+  setUsesDataTypes();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -47,6 +51,8 @@ SCAN::SCAN(const RunParams& params)
   setVariantDefined( RAJA_OpenMP );
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
 #endif
 
@@ -55,28 +61,56 @@ SCAN::SCAN(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 SCAN::~SCAN()
 {
 }
 
-void SCAN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SCAN::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataRandValue(m_x, getActualProblemSize(), vid);
-  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void SCAN::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_y, getActualProblemSize(), checksum_scale_factor, vid);
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), updateChecksumTyped, vid, tune_idx);
+}
+
+void SCAN::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void SCAN::setUpTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Data_type* x;
+  Data_type* y;
+  allocAndInitDataRandValue(x, getActualProblemSize(), vid);
+  allocAndInitDataConst(y, getActualProblemSize(), Data_type(0), vid);
+  m_x = x;
+  m_y = y;
+}
+
+template < typename Data_type >
+void SCAN::updateChecksumTyped(VariantID vid, size_t tune_idx)
+{
+  Data_type* y = static_cast<Data_type*>(m_y);
+  checksum[vid][tune_idx] += calcChecksum(y, getActualProblemSize(), checksum_scale_factor, vid);
 }
 
-void SCAN::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SCAN::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  (void) vid;
-  deallocData(m_x, vid);
-  deallocData(m_y, vid);
+  Data_type* x = static_cast<Data_type*>(m_x);
+  Data_type* y = static_cast<Data_type*>(m_y);
+  deallocData(x, vid);
+  deallocData(y, vid);
+  m_x = nullptr;
+  m_y = nullptr;
 }
 
 } // end namespace algorithm
@@ -20,11 +20,11 @@
 #define RAJAPerf_Algorithm_SCAN_HPP
 
 #define SCAN_DATA_SETUP \
-  Real_ptr x = m_x; \
-  Real_ptr y = m_y;
+  Data_type* x = static_cast<Data_type*>(m_x); \
+  Data_type* y = static_cast<Data_type*>(m_y);
 
 #define SCAN_PROLOGUE \
-  Real_type scan_var = 0.0;
+  Data_type scan_var = 0;
 
 #define SCAN_BODY \
   y[i] = scan_var; \
@@ -36,6 +36,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "common/DataTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -61,12 +62,39 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void setUpTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void updateChecksumTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void tearDownTyped(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void runSeqVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPTargetVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runKokkosVariantTyped(VariantID vid, size_t tune_idx);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantBlocked(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 0;
+  // elements each thread scans at a time in the blocked OpenMP tuning
+  static const Index_type omp_scan_block_length = 4096;
 
-  Real_ptr m_x;
-  Real_ptr m_y;
+  void* m_x;        // array of Data_type
+  void* m_y;        // array of Data_type
 };
 
 } // end namespace algorithm
@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_REDUCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include "SegmentUtils.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+SEGMENTED_REDUCE::SEGMENTED_REDUCE(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_SEGMENTED_REDUCE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_num_segments = makeSegmentOffsets(getActualProblemSize(),
+                                      params.getSegmentSize(),
+                                      params.getSegmentDist()).size() - 1;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_num_segments +
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * (m_num_segments+1) );
+  setFLOPsPerRep(1 * getActualProblemSize());
+
+  setUsesFeature(Forall);
+
+  setHasPattern(ReductionBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+SEGMENTED_REDUCE::~SEGMENTED_REDUCE()
+{
+}
+
+void SEGMENTED_REDUCE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  std::vector<Int_type> offsets =
+      makeSegmentOffsets(len, run_params.getSegmentSize(),
+                         run_params.getSegmentDist());
+
+  //
+  // Multiples of 1/8 keep every sum exact, so all tunings give the same
+  // result.
+  //
+  constexpr unsigned long long x_seed = 4793;
+
+  allocData(m_x, len, vid);
+  {
+    auto reset_x = scopedMoveData(m_x, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      m_x[i] = 0.125 * std::floor(16.0 * detail::counterRandValue(x_seed, i));
+    }
+  }
+  allocData(m_offsets, m_num_segments+1, vid);
+  copyData(getDataSpace(vid), m_offsets, DataSpace::Host, offsets.data(),
+           m_num_segments+1);
+  allocAndInitDataConst(m_sums, m_num_segments, 0.0, vid);
+}
+
+void SEGMENTED_REDUCE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_sums, m_num_segments, vid);
+}
+
+void SEGMENTED_REDUCE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_x, vid);
+  deallocData(m_sums, vid);
+  deallocData(m_offsets, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
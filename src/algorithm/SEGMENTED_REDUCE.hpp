@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SEGMENTED_REDUCE kernel reference implementation:
+///
+/// // sum of each segment [offsets[s], offsets[s+1])
+/// for (Index_type s = 0; s < num_segments; ++s) {
+///   Real_type sum = 0.0;
+///   for (Index_type i = offsets[s]; i < offsets[s+1]; ++i) {
+///     sum += x[i];
+///   }
+///   sums[s] = sum;
+/// }
+///
+/// The mean and distribution of segment lengths are given by
+/// --segment-size and --segment-dist. GPU tunings sum each segment with a
+/// thread (thread_per_segment) or a block (block_per_segment), or use the
+/// vendor library segmented reduction (cub, rocprim).
+///
+
+#ifndef RAJAPerf_Algorithm_SEGMENTED_REDUCE_HPP
+#define RAJAPerf_Algorithm_SEGMENTED_REDUCE_HPP
+
+#define SEGMENTED_REDUCE_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr sums = m_sums; \
+  Int_ptr offsets = m_offsets; \
+  const Index_type num_segments = m_num_segments;
+
+#define SEGMENTED_REDUCE_BODY \
+  Real_type sum = 0.0; \
+  for (Index_type i = offsets[s]; i < offsets[s+1]; ++i) { \
+    sum += x[i]; \
+  } \
+  sums[s] = sum;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class SEGMENTED_REDUCE : public KernelBase
+{
+public:
+
+  SEGMENTED_REDUCE(const RunParams& params);
+
+  ~SEGMENTED_REDUCE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runCudaVariantCub(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantThread(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantBlock(VariantID vid);
+  void runHipVariantRocprim(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantThread(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantBlock(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  // block_per_segment tunings reduce in shared memory with a tree
+  using gpu_tree_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::PowerOfTwo>;
+
+  Index_type m_num_segments;
+
+  Real_ptr m_x;
+  Real_ptr m_sums;
+  Int_ptr m_offsets;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,213 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_SCAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "cub/device/device_scan.cuh"
+#include "cub/util_allocator.cuh"
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void segmented_scan_segments(Real_ptr x, Real_ptr y,
+                                        Int_ptr offsets,
+                                        Index_type num_segments)
+{
+   Index_type s = blockIdx.x * blockDim.x + threadIdx.x;
+   if (s < num_segments) {
+     SEGMENTED_SCAN_SEGMENT_BODY;
+   }
+}
+
+
+void SEGMENTED_SCAN::runCudaVariantCub(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    cudaStream_t stream = res.get_stream();
+
+    int len = iend - ibegin;
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+    cudaErrchk(::cub::DeviceScan::ExclusiveSumByKey(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    keys+ibegin,
+                                                    x+ibegin,
+                                                    y+ibegin,
+                                                    len,
+                                                    ::cub::Equality(),
+                                                    stream));
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::CudaDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // Run
+      cudaErrchk(::cub::DeviceScan::ExclusiveSumByKey(d_temp_storage,
+                                                      temp_storage_bytes,
+                                                      keys+ibegin,
+                                                      x+ibegin,
+                                                      y+ibegin,
+                                                      len,
+                                                      ::cub::Equality(),
+                                                      stream));
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::CudaDevice, temp_storage);
+
+  } else {
+     getCout() << "\n  SEGMENTED_SCAN : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void SEGMENTED_SCAN::runCudaVariantSegments(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_segments, block_size);
+      constexpr size_t shmem = 0;
+      segmented_scan_segments<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( x, y,
+                                        offsets,
+                                        num_segments );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_segments, block_size);
+      constexpr size_t shmem = 0;
+      lambda_cuda_forall<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+        0, num_segments, [=] __device__ (Index_type s) {
+        SEGMENTED_SCAN_SEGMENT_BODY;
+      });
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, num_segments), [=] __device__ (Index_type s) {
+        SEGMENTED_SCAN_SEGMENT_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SEGMENTED_SCAN : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void SEGMENTED_SCAN::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_CUDA ) {
+
+    if (tune_idx == t) {
+
+      runCudaVariantCub(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runCudaVariantSegments<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+}
+
+void SEGMENTED_SCAN::setCudaTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_CUDA ) {
+
+    addVariantTuningName(vid, "cub");
+
+  }
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "thread_per_segment_block_"+std::to_string(block_size));
+
+    }
+
+  });
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
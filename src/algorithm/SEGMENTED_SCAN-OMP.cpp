@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_SCAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SEGMENTED_SCAN::runOpenMPVariantHeadFlags(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    const Index_type n = iend - ibegin;
+    const int p0 = static_cast<int>(std::min(n, static_cast<Index_type>(omp_get_max_threads())));
+    ::std::vector<Real_type> thread_sums(p0);
+    ::std::vector<Int_type> thread_heads(p0);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel num_threads(p0)
+      {
+        const int p = omp_get_num_threads();
+        const int pid = omp_get_thread_num();
+        const Index_type step = n / p;
+        const Index_type local_begin = pid * step + ibegin;
+        const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
+
+        Int_type local_head = 0;
+        SEGMENTED_SCAN_PROLOGUE;
+        for (Index_type i = local_begin; i < local_end; ++i ) {
+          local_head |= flags[i];
+          SEGMENTED_SCAN_HEAD_FLAGS_BODY;
+        }
+        thread_sums[pid] = scan_var;
+        thread_heads[pid] = local_head;
+
+        #pragma omp barrier
+
+        //
+        // Elements before the first head of the chunk continue the segment
+        // of the previous chunks, add the sum of that segment in them.
+        //
+        Real_type prev_sum = 0.0;
+        for (int ip = pid-1; ip >= 0; --ip) {
+          prev_sum += thread_sums[ip];
+          if (thread_heads[ip]) {
+            break;
+          }
+        }
+
+        for (Index_type i = local_begin; i < local_end && !flags[i]; ++i ) {
+          y[i] += prev_sum;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SEGMENTED_SCAN : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SEGMENTED_SCAN::runOpenMPVariantSegments(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type s = 0; s < num_segments; ++s ) {
+          SEGMENTED_SCAN_SEGMENT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto segmented_scan_lam = [=](Index_type s) {
+                                  SEGMENTED_SCAN_SEGMENT_BODY;
+                                };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type s = 0; s < num_segments; ++s ) {
+          segmented_scan_lam(s);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_segments), [=](Index_type s) {
+          SEGMENTED_SCAN_SEGMENT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SEGMENTED_SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SEGMENTED_SCAN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (vid == Base_OpenMP) {
+    if (tune_idx == t) {
+      runOpenMPVariantHeadFlags(vid);
+    }
+    t += 1;
+  }
+
+  if (tune_idx == t) {
+    runOpenMPVariantSegments(vid);
+  }
+  t += 1;
+}
+
+void SEGMENTED_SCAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "head_flags");
+  }
+
+  addVariantTuningName(vid, "segments");
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
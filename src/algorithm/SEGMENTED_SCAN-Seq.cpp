@@ -0,0 +1,171 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_SCAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SEGMENTED_SCAN::runSeqVariantHeadFlags(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        SEGMENTED_SCAN_PROLOGUE;
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          SEGMENTED_SCAN_HEAD_FLAGS_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        SEGMENTED_SCAN_PROLOGUE;
+        auto segmented_scan_lam = [=, &scan_var](Index_type i) {
+                                    SEGMENTED_SCAN_HEAD_FLAGS_BODY;
+                                  };
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          segmented_scan_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  SEGMENTED_SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SEGMENTED_SCAN::runSeqVariantSegments(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < num_segments; ++s ) {
+          SEGMENTED_SCAN_SEGMENT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto segmented_scan_lam = [=](Index_type s) {
+                                  SEGMENTED_SCAN_SEGMENT_BODY;
+                                };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < num_segments; ++s ) {
+          segmented_scan_lam(s);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, num_segments), [=](Index_type s) {
+          SEGMENTED_SCAN_SEGMENT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  SEGMENTED_SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SEGMENTED_SCAN::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (vid == Base_Seq || vid == Lambda_Seq) {
+    if (tune_idx == t) {
+      runSeqVariantHeadFlags(vid);
+    }
+    t += 1;
+  }
+
+  if (tune_idx == t) {
+    runSeqVariantSegments(vid);
+  }
+  t += 1;
+}
+
+void SEGMENTED_SCAN::setSeqTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Lambda_Seq) {
+    addVariantTuningName(vid, "head_flags");
+  }
+
+  addVariantTuningName(vid, "segments");
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
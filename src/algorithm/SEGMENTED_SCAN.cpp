@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_SCAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include "SegmentUtils.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+SEGMENTED_SCAN::SEGMENTED_SCAN(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_SEGMENTED_SCAN, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_num_segments = makeSegmentOffsets(getActualProblemSize(),
+                                      params.getSegmentSize(),
+                                      params.getSegmentDist()).size() - 1;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // values and offsets, head flags and keys are not counted
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * (m_num_segments+1) );
+  setFLOPsPerRep(1 * getActualProblemSize());
+
+  checksum_scale_factor = 1e-2 *
+                 ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                              getActualProblemSize() ) /
+                 getActualProblemSize();
+
+  setUsesFeature(Forall);
+  setUsesFeature(Scan);
+
+  setHasPattern(ReductionBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+SEGMENTED_SCAN::~SEGMENTED_SCAN()
+{
+}
+
+void SEGMENTED_SCAN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  std::vector<Int_type> offsets =
+      makeSegmentOffsets(len, run_params.getSegmentSize(),
+                         run_params.getSegmentDist());
+
+  //
+  // Multiples of 1/8 keep every sum exact, so all tunings give the same
+  // result.
+  //
+  constexpr unsigned long long x_seed = 4793;
+
+  allocData(m_x, len, vid);
+  allocData(m_flags, len, vid);
+  allocData(m_keys, len, vid);
+  {
+    auto reset_x = scopedMoveData(m_x, len, vid);
+    auto reset_flags = scopedMoveData(m_flags, len, vid);
+    auto reset_keys = scopedMoveData(m_keys, len, vid);
+    for (Index_type s = 0; s < m_num_segments; ++s) {
+      for (Index_type i = offsets[s]; i < offsets[s+1]; ++i) {
+        m_x[i] = 0.125 * std::floor(16.0 * detail::counterRandValue(x_seed, i));
+        m_flags[i] = (i == offsets[s]) ? 1 : 0;
+        m_keys[i] = static_cast<Int_type>(s);
+      }
+    }
+  }
+  allocData(m_offsets, m_num_segments+1, vid);
+  copyData(getDataSpace(vid), m_offsets, DataSpace::Host, offsets.data(),
+           m_num_segments+1);
+  allocAndInitDataConst(m_y, len, 0.0, vid);
+}
+
+void SEGMENTED_SCAN::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, getActualProblemSize(), checksum_scale_factor, vid);
+}
+
+void SEGMENTED_SCAN::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+  deallocData(m_flags, vid);
+  deallocData(m_keys, vid);
+  deallocData(m_offsets, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SEGMENTED_SCAN kernel reference implementation:
+///
+/// // exclusive scan of each segment [offsets[s], offsets[s+1])
+/// for (Index_type s = 0; s < num_segments; ++s) {
+///   Real_type scan_var = 0.0;
+///   for (Index_type i = offsets[s]; i < offsets[s+1]; ++i) {
+///     y[i] = scan_var;
+///     scan_var += x[i];
+///   }
+/// }
+///
+/// The mean and distribution of segment lengths are given by
+/// --segment-size and --segment-dist. Tunings scan the elements in order
+/// restarting at elements whose head flag is set (head_flags), scan each
+/// segment given by offsets (segments), or use the vendor library scan by
+/// key or head flag (cub, rocprim).
+///
+
+#ifndef RAJAPerf_Algorithm_SEGMENTED_SCAN_HPP
+#define RAJAPerf_Algorithm_SEGMENTED_SCAN_HPP
+
+#define SEGMENTED_SCAN_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr flags = m_flags; \
+  Int_ptr keys = m_keys; \
+  Int_ptr offsets = m_offsets; \
+  const Index_type num_segments = m_num_segments;
+
+#define SEGMENTED_SCAN_PROLOGUE \
+  Real_type scan_var = 0.0;
+
+#define SEGMENTED_SCAN_HEAD_FLAGS_BODY \
+  if (flags[i]) { \
+    scan_var = 0.0; \
+  } \
+  y[i] = scan_var; \
+  scan_var += x[i];
+
+#define SEGMENTED_SCAN_SEGMENT_BODY \
+  Real_type scan_var = 0.0; \
+  for (Index_type i = offsets[s]; i < offsets[s+1]; ++i) { \
+    y[i] = scan_var; \
+    scan_var += x[i]; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class SEGMENTED_SCAN : public KernelBase
+{
+public:
+
+  SEGMENTED_SCAN(const RunParams& params);
+
+  ~SEGMENTED_SCAN();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runSeqVariantHeadFlags(VariantID vid);
+  void runSeqVariantSegments(VariantID vid);
+  void runOpenMPVariantHeadFlags(VariantID vid);
+  void runOpenMPVariantSegments(VariantID vid);
+
+  void runCudaVariantCub(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantSegments(VariantID vid);
+  void runHipVariantRocprim(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantSegments(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type m_num_segments;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_flags;
+  Int_ptr m_keys;
+  Int_ptr m_offsets;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,495 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SELECT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "cub/device/device_radix_sort.cuh"
+
+#include "common/CudaDataUtils.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+//
+// Histogram of the byte at shift of the keys whose higher bytes are the
+// bytes of the k-th key found so far.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void select_histogram(const Real_type* keys, Index_type len,
+                                 unsigned long long* state, int shift)
+{
+  __shared__ unsigned long long hist[select_radix_bins];
+
+  for (Index_type d = threadIdx.x; d < select_radix_bins; d += block_size) {
+    hist[d] = 0;
+  }
+  __syncthreads();
+
+  const unsigned long long prefix = state[select_state_prefix];
+  const unsigned long long high_mask = (shift + select_radix_bits < select_key_bits)
+                                     ? (~0ull << (shift + select_radix_bits)) : 0ull;
+
+  for (Index_type i = blockIdx.x * block_size + threadIdx.x; i < len;
+       i += gridDim.x * block_size) {
+    const unsigned long long bits = selectOrderedBits(keys[i]);
+    if (((bits ^ prefix) & high_mask) == 0ull) {
+      RAJA::atomicAdd<RAJA::cuda_atomic>(&hist[selectDigit(bits, shift)], 1ull);
+    }
+  }
+  __syncthreads();
+
+  for (Index_type d = threadIdx.x; d < select_radix_bins; d += block_size) {
+    if (hist[d] != 0ull) {
+      RAJA::atomicAdd<RAJA::cuda_atomic>(&state[d], hist[d]);
+    }
+  }
+}
+
+//
+// One thread picks the byte of the k-th key from the histogram, there are
+// only select_radix_bins bins.
+//
+__global__ void select_digit(unsigned long long* state, Index_type k, int shift)
+{
+  const unsigned long long kleft =
+      (shift == select_key_bits - select_radix_bits)
+      ? static_cast<unsigned long long>(k) : state[select_state_kleft];
+
+  unsigned long long nless = 0;
+  Index_type digit = 0;
+  while (nless + state[digit] < kleft) {
+    nless += state[digit];
+    ++digit;
+  }
+
+  state[select_state_kleft] = kleft - nless;
+  state[select_state_prefix] |= static_cast<unsigned long long>(digit) << shift;
+
+  for (Index_type d = 0; d < select_radix_bins; ++d) {
+    state[d] = 0ull;
+  }
+}
+
+//
+// Copy the keys less than the k-th key and fill the rest of the k keys
+// with the k-th key.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void select_gather(const Real_type* keys, Index_type len, Index_type k,
+                              Real_type* y, unsigned long long* state)
+{
+  const unsigned long long kth_bits = state[select_state_prefix];
+  const Index_type nless = k - static_cast<Index_type>(state[select_state_kleft]);
+
+  for (Index_type i = blockIdx.x * block_size + threadIdx.x; i < len;
+       i += gridDim.x * block_size) {
+    if (selectOrderedBits(keys[i]) < kth_bits) {
+      const unsigned long long pos =
+          RAJA::atomicAdd<RAJA::cuda_atomic>(&state[select_state_count], 1ull);
+      y[pos] = keys[i];
+    }
+  }
+
+  for (Index_type j = nless + blockIdx.x * block_size + threadIdx.x; j < k;
+       j += gridDim.x * block_size) {
+    y[j] = selectKeyFromBits(kth_bits);
+  }
+}
+
+//
+// One block sorts the samples with a bitonic sort in shared memory.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void select_sample(const Real_type* keys, Index_type len, Index_type k,
+                              unsigned long long* sample_state)
+{
+  __shared__ Real_type samples[select_num_samples];
+
+  for (Index_type s = threadIdx.x; s < select_num_samples; s += block_size) {
+    samples[s] = keys[(s*len) / select_num_samples];
+  }
+  __syncthreads();
+
+  for (Index_type size = 2; size <= select_num_samples; size *= 2) {
+    for (Index_type stride = size / 2; stride > 0; stride /= 2) {
+      for (Index_type s = threadIdx.x; s < select_num_samples; s += block_size) {
+        const Index_type p = s ^ stride;
+        if (p > s) {
+          const bool up = (s & size) == 0;
+          if ((samples[s] > samples[p]) == up) {
+            const Real_type tmp = samples[s];
+            samples[s] = samples[p];
+            samples[p] = tmp;
+          }
+        }
+      }
+      __syncthreads();
+    }
+  }
+
+  if (threadIdx.x == 0) {
+    unsigned long long lo_bits, hi_bits;
+    selectSampleBounds(samples, len, k, lo_bits, hi_bits);
+    sample_state[0] = lo_bits;
+    sample_state[1] = hi_bits;
+  }
+}
+
+//
+// Copy the keys below the splitters, up to k of them, and the keys between
+// the splitters, with one atomic per block for each.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void select_partition(const Real_type* keys, Index_type len, Index_type k,
+                                 Real_type* y, Real_type* cand,
+                                 unsigned long long* sample_state)
+{
+  __shared__ unsigned long long s_nlo;
+  __shared__ unsigned long long s_ncand;
+  __shared__ unsigned long long s_lo_base;
+  __shared__ unsigned long long s_cand_base;
+
+  const unsigned long long lo_bits = sample_state[0];
+  const unsigned long long hi_bits = sample_state[1];
+
+  for (Index_type ibase = blockIdx.x * block_size; ibase < len;
+       ibase += gridDim.x * block_size) {
+
+    if (threadIdx.x == 0) {
+      s_nlo = 0ull;
+      s_ncand = 0ull;
+    }
+    __syncthreads();
+
+    const Index_type i = ibase + threadIdx.x;
+    int side = 0;
+    unsigned long long pos = 0ull;
+    Real_type key = 0.0;
+    if (i < len) {
+      key = keys[i];
+      const unsigned long long bits = selectOrderedBits(key);
+      if (bits < lo_bits) {
+        side = 1;
+        pos = RAJA::atomicAdd<RAJA::cuda_atomic>(&s_nlo, 1ull);
+      } else if (bits <= hi_bits) {
+        side = 2;
+        pos = RAJA::atomicAdd<RAJA::cuda_atomic>(&s_ncand, 1ull);
+      }
+    }
+    __syncthreads();
+
+    if (threadIdx.x == 0) {
+      s_lo_base = RAJA::atomicAdd<RAJA::cuda_atomic>(&sample_state[2], s_nlo);
+      s_cand_base = RAJA::atomicAdd<RAJA::cuda_atomic>(&sample_state[3], s_ncand);
+    }
+    __syncthreads();
+
+    if (side == 1) {
+      pos += s_lo_base;
+      if (pos < static_cast<unsigned long long>(k)) {
+        y[pos] = key;
+      }
+    } else if (side == 2) {
+      cand[s_cand_base + pos] = key;
+    }
+    __syncthreads();
+
+  }
+}
+
+
+template < size_t block_size >
+void SELECT::radixSelectCuda(const Real_type* keys, Index_type len, Index_type k,
+                             Real_type* y, unsigned long long* state,
+                             size_t max_grid_size)
+{
+  auto res{getCudaResource()};
+
+  const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(len, block_size);
+  const size_t grid_size = std::max(size_t(1), std::min(normal_grid_size, max_grid_size));
+  constexpr size_t shmem = 0;
+
+  cudaErrchk( cudaMemsetAsync( state, 0, select_state_len*sizeof(unsigned long long),
+                               res.get_stream() ) );
+
+  for (int shift = select_key_bits - select_radix_bits; shift >= 0;
+       shift -= select_radix_bits) {
+    select_histogram<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+        keys, len, state, shift );
+    cudaErrchk( cudaGetLastError() );
+    select_digit<<<1, 1, shmem, res.get_stream()>>>( state, k, shift );
+    cudaErrchk( cudaGetLastError() );
+  }
+
+  select_gather<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+      keys, len, k, y, state );
+  cudaErrchk( cudaGetLastError() );
+}
+
+void SELECT::runCudaVariantSort(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  SELECT_DATA_SETUP;
+  RAJA_UNUSED_VAR(w1);
+
+  if ( vid == Base_CUDA ) {
+
+    cudaStream_t stream = res.get_stream();
+
+    int len = iend;
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+    {
+      ::cub::DoubleBuffer<Real_type> d_keys(x, w0);
+      cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys,
+                                                  len,
+                                                  0,
+                                                  sizeof(Real_type)*CHAR_BIT,
+                                                  stream));
+    }
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::CudaDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      ::cub::DoubleBuffer<Real_type> d_keys(x + iend*irep, w0);
+      cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys,
+                                                  len,
+                                                  0,
+                                                  sizeof(Real_type)*CHAR_BIT,
+                                                  stream));
+
+      // the sorted keys may be in either buffer
+      cudaErrchk( cudaMemcpyAsync(y + k*irep, d_keys.Current(), k*sizeof(Real_type),
+                                  cudaMemcpyDefault, stream) );
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::CudaDevice, temp_storage);
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::sort< RAJA::cuda_exec<default_gpu_block_size, true /*async*/> >(res,
+          RAJA::make_span(x + iend*irep, iend));
+
+      RAJA::forall< RAJA::cuda_exec<default_gpu_block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, k), [=] __device__ (Index_type j) {
+        SELECT_COPY_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SELECT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void SELECT::runCudaVariantRadix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SELECT_DATA_SETUP;
+  RAJA_UNUSED_VAR(w0);
+  RAJA_UNUSED_VAR(w1);
+
+  if ( vid == Base_CUDA ) {
+
+    unsigned long long* state;
+    allocData(DataSpace::CudaDevice, state, select_state_len);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (select_histogram<block_size>), block_size, shmem);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      radixSelectCuda<block_size>(x + iend*irep, iend, k, y + k*irep,
+                                  state, max_grid_size);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, state);
+
+  } else {
+     getCout() << "\n  SELECT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+//
+// The numbers of keys below and between the splitters are copied to the
+// host to choose between the radix select of the keys between the
+// splitters and the radix select of all keys.
+//
+template < size_t block_size >
+void SELECT::runCudaVariantSample(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  SELECT_DATA_SETUP;
+  RAJA_UNUSED_VAR(w1);
+
+  if ( vid == Base_CUDA ) {
+
+    unsigned long long* state;
+    allocData(DataSpace::CudaDevice, state, select_state_len);
+    unsigned long long* sample_state;
+    allocData(DataSpace::CudaDevice, sample_state, select_sample_state_len);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (select_histogram<block_size>), block_size, shmem);
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t partition_grid_size = std::min(normal_grid_size,
+        size_t(detail::getCudaOccupancyMaxBlocks(
+            (select_partition<block_size>), block_size, shmem)));
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_ptr keys = x + iend*irep;
+      Real_ptr yr = y + k*irep;
+
+      cudaErrchk( cudaMemsetAsync( sample_state, 0,
+                                   select_sample_state_len*sizeof(unsigned long long),
+                                   res.get_stream() ) );
+      select_sample<block_size><<<1, block_size, shmem, res.get_stream()>>>(
+          keys, iend, k, sample_state );
+      cudaErrchk( cudaGetLastError() );
+      select_partition<block_size><<<partition_grid_size, block_size, shmem, res.get_stream()>>>(
+          keys, iend, k, yr, w0, sample_state );
+      cudaErrchk( cudaGetLastError() );
+
+      unsigned long long counts[2];
+      cudaErrchk( cudaMemcpyAsync( counts, sample_state + 2, 2*sizeof(unsigned long long),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      const Index_type nlo = static_cast<Index_type>(counts[0]);
+      const Index_type ncand = static_cast<Index_type>(counts[1]);
+
+      if (nlo < k && nlo + ncand >= k) {
+        radixSelectCuda<block_size>(w0, ncand, k - nlo, yr + nlo,
+                                    state, max_grid_size);
+      } else {
+        radixSelectCuda<block_size>(keys, iend, k, yr,
+                                    state, max_grid_size);
+      }
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, state);
+    deallocData(DataSpace::CudaDevice, sample_state);
+
+  } else {
+     getCout() << "\n  SELECT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void SELECT::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runCudaVariantSort(vid);
+  }
+  t += 1;
+
+  if (vid == Base_CUDA) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantRadix<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantSample<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    });
+
+  }
+}
+
+void SELECT::setCudaTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "sort");
+
+  if (vid == Base_CUDA) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        const std::string block_name = "_block_"+std::to_string(block_size);
+
+        addVariantTuningName(vid, "radix"+block_name);
+        addVariantTuningName(vid, "sample"+block_name);
+
+      }
+
+    });
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,405 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SELECT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "SortUtils.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SELECT::runOpenMPVariantSort(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SELECT_DATA_SETUP;
+  RAJA_UNUSED_VAR(w0);
+  RAJA_UNUSED_VAR(w1);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        ompMergeSort(x + iend*irep, iend, std::less<Real_type>());
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < k; ++j) {
+          SELECT_COPY_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::sort<RAJA::omp_parallel_for_exec>(RAJA::make_span(x + iend*irep, iend));
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, k), [=](Index_type j) {
+          SELECT_COPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SELECT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SELECT::runOpenMPVariantNthElement(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SELECT_DATA_SETUP;
+  RAJA_UNUSED_VAR(w1);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        ompNthElement(x + iend*irep, k - 1, iend, w0, std::less<Real_type>());
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < k; ++j) {
+          SELECT_COPY_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SELECT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Each pass keeps the keys whose next byte is the byte of the k-th key,
+// each thread histograms a contiguous chunk of the kept keys, then copies
+// its keys with smaller bytes to the output and keeps its keys with the
+// byte of the k-th key at offsets given by the histograms.
+//
+void SELECT::runOpenMPVariantRadix(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SELECT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const int max_threads = omp_get_max_threads();
+      std::vector<Index_type> thread_hist(max_threads*select_radix_bins);
+      std::vector<Index_type> thread_out(max_threads);
+      std::vector<Index_type> thread_keep(max_threads);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        const Real_type* src = x + iend*irep;
+        Real_ptr dst = w0;
+        Real_ptr yr = y + k*irep;
+        Index_type ncand = iend;
+        Index_type kleft = k;
+        Index_type nout = 0;
+
+        for (int shift = select_key_bits - select_radix_bits;
+             shift >= 0 && ncand > kleft; shift -= select_radix_bits) {
+
+          Index_type digit = 0;
+          Index_type nkeep = 0;
+
+          #pragma omp parallel
+          {
+            const int t = omp_get_thread_num();
+            const int nt = omp_get_num_threads();
+            const Index_type cbegin = (ncand * t) / nt;
+            const Index_type cend = (ncand * (t+1)) / nt;
+
+            Index_type* hist = thread_hist.data() + t*select_radix_bins;
+            std::fill(hist, hist + select_radix_bins, Index_type(0));
+            for (Index_type c = cbegin; c < cend; ++c) {
+              ++hist[selectDigit(selectOrderedBits(src[c]), shift)];
+            }
+
+            #pragma omp barrier
+
+            #pragma omp single
+            {
+              Index_type nless = 0;
+              for (digit = 0; digit < select_radix_bins; ++digit) {
+                Index_type ndigit = 0;
+                for (int tt = 0; tt < nt; ++tt) {
+                  ndigit += thread_hist[tt*select_radix_bins + digit];
+                }
+                if (nless + ndigit >= kleft) {
+                  break;
+                }
+                nless += ndigit;
+              }
+              kleft -= nless;
+
+              for (int tt = 0; tt < nt; ++tt) {
+                const Index_type* th = thread_hist.data() + tt*select_radix_bins;
+                thread_out[tt] = nout;
+                thread_keep[tt] = nkeep;
+                for (Index_type d = 0; d < digit; ++d) {
+                  nout += th[d];
+                }
+                nkeep += th[digit];
+              }
+            }
+
+            Index_type io = thread_out[t];
+            Index_type ik = thread_keep[t];
+            for (Index_type c = cbegin; c < cend; ++c) {
+              const Index_type d = selectDigit(selectOrderedBits(src[c]), shift);
+              if (d < digit) {
+                yr[io++] = src[c];
+              } else if (d == digit) {
+                dst[ik++] = src[c];
+              }
+            }
+          }
+
+          src = dst;
+          dst = (dst == w0) ? w1 : w0;
+          ncand = nkeep;
+
+        }
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < kleft; ++j) {
+          yr[nout + j] = src[j];
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SELECT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Each thread counts then copies the keys of a contiguous chunk below and
+// between the splitters, the k-th key is then selected among the keys
+// between the splitters.
+//
+void SELECT::runOpenMPVariantSample(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SELECT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const int max_threads = omp_get_max_threads();
+      std::vector<Real_type> samples(select_num_samples);
+      std::vector<Index_type> thread_lo(max_threads);
+      std::vector<Index_type> thread_cand(max_threads);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr keys = x + iend*irep;
+        Real_ptr yr = y + k*irep;
+
+        for (Index_type s = 0; s < select_num_samples; ++s) {
+          samples[s] = keys[(s*iend) / select_num_samples];
+        }
+        std::sort(samples.begin(), samples.end());
+
+        unsigned long long lo_bits, hi_bits;
+        selectSampleBounds(samples.data(), iend, k, lo_bits, hi_bits);
+
+        Index_type nlo = 0;
+        Index_type ncand = 0;
+
+        #pragma omp parallel
+        {
+          const int t = omp_get_thread_num();
+          const int nt = omp_get_num_threads();
+          const Index_type cbegin = (iend * t) / nt;
+          const Index_type cend = (iend * (t+1)) / nt;
+
+          Index_type clo = 0;
+          Index_type ccand = 0;
+          for (Index_type i = cbegin; i < cend; ++i) {
+            const unsigned long long bits = selectOrderedBits(keys[i]);
+            if (bits < lo_bits) {
+              ++clo;
+            } else if (bits <= hi_bits) {
+              ++ccand;
+            }
+          }
+          thread_lo[t] = clo;
+          thread_cand[t] = ccand;
+
+          #pragma omp barrier
+
+          #pragma omp single
+          {
+            for (int tt = 0; tt < nt; ++tt) {
+              const Index_type tlo = thread_lo[tt];
+              const Index_type tcand = thread_cand[tt];
+              thread_lo[tt] = nlo;
+              thread_cand[tt] = ncand;
+              nlo += tlo;
+              ncand += tcand;
+            }
+          }
+
+          Index_type il = thread_lo[t];
+          Index_type ic = thread_cand[t];
+          for (Index_type i = cbegin; i < cend; ++i) {
+            const unsigned long long bits = selectOrderedBits(keys[i]);
+            if (bits < lo_bits) {
+              if (il < k) {
+                yr[il] = keys[i];
+              }
+              ++il;
+            } else if (bits <= hi_bits) {
+              w0[ic++] = keys[i];
+            }
+          }
+        }
+
+        if (nlo < k && nlo + ncand >= k) {
+          std::nth_element(w0, w0 + (k - nlo - 1), w0 + ncand);
+          std::copy(w0, w0 + (k - nlo), yr + nlo);
+        } else {
+          ompNthElement(keys, k - 1, iend, w1, std::less<Real_type>());
+          #pragma omp parallel for
+          for (Index_type j = 0; j < k; ++j) {
+            yr[j] = keys[j];
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SELECT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SELECT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantSort(vid);
+  }
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+      runOpenMPVariantNthElement(vid);
+    }
+    t += 1;
+
+    if (tune_idx == t) {
+      runOpenMPVariantRadix(vid);
+    }
+    t += 1;
+
+    if (tune_idx == t) {
+      runOpenMPVariantSample(vid);
+    }
+    t += 1;
+
+  }
+}
+
+void SELECT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "sort");
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "nth_element");
+    addVariantTuningName(vid, "radix");
+    addVariantTuningName(vid, "sample");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,286 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SELECT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SELECT::runSeqVariantSort(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SELECT_DATA_SETUP;
+  RAJA_UNUSED_VAR(w0);
+  RAJA_UNUSED_VAR(w1);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr keys = x + iend*irep;
+        std::sort(keys, keys + iend);
+        std::copy(keys, keys + k, y + k*irep);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::sort<RAJA::seq_exec>(RAJA::make_span(x + iend*irep, iend));
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, k), [=](Index_type j) {
+          SELECT_COPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  SELECT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SELECT::runSeqVariantNthElement(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SELECT_DATA_SETUP;
+  RAJA_UNUSED_VAR(w0);
+  RAJA_UNUSED_VAR(w1);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr keys = x + iend*irep;
+        std::nth_element(keys, keys + k - 1, keys + iend);
+        std::copy(keys, keys + k, y + k*irep);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SELECT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+//
+// Each pass keeps the keys whose next byte is the byte of the k-th key,
+// the keys with smaller bytes are among the k smallest.
+//
+void SELECT::runSeqVariantRadix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SELECT_DATA_SETUP;
+  RAJA_UNUSED_VAR(w1);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        const Real_type* src = x + iend*irep;
+        Real_ptr yr = y + k*irep;
+        Index_type ncand = iend;
+        Index_type kleft = k;
+        Index_type nout = 0;
+
+        for (int shift = select_key_bits - select_radix_bits;
+             shift >= 0 && ncand > kleft; shift -= select_radix_bits) {
+
+          Index_type hist[select_radix_bins] = {0};
+          for (Index_type c = 0; c < ncand; ++c) {
+            ++hist[selectDigit(selectOrderedBits(src[c]), shift)];
+          }
+
+          Index_type digit = 0;
+          Index_type nless = 0;
+          while (nless + hist[digit] < kleft) {
+            nless += hist[digit];
+            ++digit;
+          }
+          kleft -= nless;
+
+          Index_type nkeep = 0;
+          for (Index_type c = 0; c < ncand; ++c) {
+            const Index_type d = selectDigit(selectOrderedBits(src[c]), shift);
+            if (d < digit) {
+              yr[nout++] = src[c];
+            } else if (d == digit) {
+              w0[nkeep++] = src[c];
+            }
+          }
+          src = w0;
+          ncand = nkeep;
+
+        }
+
+        std::copy(src, src + kleft, yr + nout);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SELECT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SELECT::runSeqVariantSample(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  SELECT_DATA_SETUP;
+  RAJA_UNUSED_VAR(w1);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      std::vector<Real_type> samples(select_num_samples);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr keys = x + iend*irep;
+        Real_ptr yr = y + k*irep;
+
+        for (Index_type s = 0; s < select_num_samples; ++s) {
+          samples[s] = keys[(s*iend) / select_num_samples];
+        }
+        std::sort(samples.begin(), samples.end());
+
+        unsigned long long lo_bits, hi_bits;
+        selectSampleBounds(samples.data(), iend, k, lo_bits, hi_bits);
+
+        Index_type nlo = 0;
+        Index_type ncand = 0;
+        for (Index_type i = 0; i < iend; ++i) {
+          const unsigned long long bits = selectOrderedBits(keys[i]);
+          if (bits < lo_bits) {
+            if (nlo < k) {
+              yr[nlo] = keys[i];
+            }
+            ++nlo;
+          } else if (bits <= hi_bits) {
+            w0[ncand++] = keys[i];
+          }
+        }
+
+        if (nlo < k && nlo + ncand >= k) {
+          std::nth_element(w0, w0 + (k - nlo - 1), w0 + ncand);
+          std::copy(w0, w0 + (k - nlo), yr + nlo);
+        } else {
+          std::nth_element(keys, keys + k - 1, keys + iend);
+          std::copy(keys, keys + k, yr);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SELECT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SELECT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantSort(vid);
+  }
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+      runSeqVariantNthElement(vid);
+    }
+    t += 1;
+
+    if (tune_idx == t) {
+      runSeqVariantRadix(vid);
+    }
+    t += 1;
+
+    if (tune_idx == t) {
+      runSeqVariantSample(vid);
+    }
+    t += 1;
+
+  }
+}
+
+void SELECT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "sort");
+  if (vid == Base_Seq) {
+    addVariantTuningName(vid, "nth_element");
+    addVariantTuningName(vid, "radix");
+    addVariantTuningName(vid, "sample");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
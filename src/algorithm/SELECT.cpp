@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SELECT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+SELECT::SELECT(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_SELECT, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(20);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_k = getKernelParam("k", std::min(Index_type(1000), getActualProblemSize()),
+                       1, getActualProblemSize());
+  m_distribution = getKernelParam("distribution", 0, {0, 1, 2, 3});
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // touched data size, not actual number of stores and loads
+  setBytesPerRep( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_k );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Sort);
+
+  setHasPattern(GatherScatter);
+
+  // each rep selects from a different section of the data
+  setRepBatchingAllowed(false);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+SELECT::~SELECT()
+{
+}
+
+void SELECT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  constexpr unsigned long long key_seed = 4217;
+
+  const Index_type len = getActualProblemSize();
+  const Index_type nreps = getRunReps();
+
+  allocData(m_x, len*nreps, vid);
+  {
+    auto reset_x = scopedMoveData(m_x, len*nreps, vid);
+
+    for (Index_type i = 0; i < len*nreps; ++i) {
+      const Real_type u = detail::counterRandValue(key_seed, i);
+      switch (m_distribution) {
+        case 1 :
+          m_x[i] = -std::log(1.0 - u);
+          break;
+        case 2 :
+          m_x[i] = std::floor(u * 16.0) / 16.0;
+          break;
+        default :
+          m_x[i] = u;
+          break;
+      }
+    }
+
+    if (m_distribution == 3) {
+      for (Index_type irep = 0; irep < nreps; ++irep) {
+        std::sort(m_x + len*irep, m_x + len*(irep+1));
+      }
+    }
+  }
+
+  allocAndInitDataConst(m_y, m_k*nreps, 0.0, vid);
+  allocData(m_w0, len, vid);
+  allocData(m_w1, len, vid);
+}
+
+//
+// The selected keys are in no particular order, sort the keys of each rep
+// so every tuning has the same checksum.
+//
+void SELECT::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const Index_type nreps = getRunReps();
+  {
+    auto reset_y = scopedMoveData(m_y, m_k*nreps, vid);
+    for (Index_type irep = 0; irep < nreps; ++irep) {
+      std::sort(m_y + m_k*irep, m_y + m_k*(irep+1));
+    }
+  }
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_k*nreps, vid);
+}
+
+void SELECT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+  deallocData(m_w0, vid);
+  deallocData(m_w1, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SELECT kernel reference implementation:
+///
+/// // the k smallest keys of x, in no particular order
+/// std::nth_element(x+ibegin, x+ibegin+k-1, x+iend);
+/// std::copy(x+ibegin, x+ibegin+k, y);
+///
+/// The kernel parameter "k" (1000 by default) gives the number of keys
+/// selected and the kernel parameter "distribution" gives the keys, where
+///
+///   0 -- uniform, keys are uniformly random in [0, 1)
+///   1 -- exponential, keys are skewed towards 0
+///   2 -- duplicates, keys have 16 distinct values
+///   3 -- sorted, uniform keys in increasing order
+///
+/// Each rep selects from a different section of the keys, as the partition
+/// and sort tunings reorder the keys in place. Tunings sort the keys and
+/// copy the first k, partition the keys with nth_element, in parallel with
+/// OpenMP, select the k-th key with a radix select on the bits of the keys,
+/// a byte per pass, and select the k-th key among the keys between two
+/// splitters of a sorted sample of the keys, falling back to a full select
+/// when the splitters miss it. The keys of each rep are checksummed in
+/// sorted order so every tuning has one checksum.
+///
+
+#ifndef RAJAPerf_Algorithm_SELECT_HPP
+#define RAJAPerf_Algorithm_SELECT_HPP
+
+#define SELECT_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_ptr w0 = m_w0; \
+  Real_ptr w1 = m_w1; \
+  const Index_type k = m_k;
+
+#define SELECT_COPY_BODY \
+  y[j + k*irep] = x[j + iend*irep];
+
+
+#include "common/KernelBase.hpp"
+
+#include <cstring>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+// bits of the keys selected per pass of the radix select
+constexpr int select_key_bits = 64;
+constexpr int select_radix_bits = 8;
+constexpr Index_type select_radix_bins = Index_type(1) << select_radix_bits;
+
+// keys in the sample of the sample select, and the ranks above and below
+// the rank of the k-th key in the sample given to the splitters, about
+// three standard deviations of the rank
+constexpr Index_type select_num_samples = 2048;
+constexpr Index_type select_sample_margin = 64;
+
+// state of the GPU radix select after the histogram of a pass, the bits of
+// the k-th key found so far, the keys equal to the k-th key left to select,
+// and the number of keys less than the k-th key copied
+constexpr Index_type select_state_prefix = select_radix_bins;
+constexpr Index_type select_state_kleft = select_radix_bins + 1;
+constexpr Index_type select_state_count = select_radix_bins + 2;
+constexpr Index_type select_state_len = select_radix_bins + 3;
+
+// state of the GPU sample select, the bits of the splitters and the
+// numbers of keys below and between the splitters
+constexpr Index_type select_sample_state_len = 4;
+
+//
+// Bits of a key that order as unsigned integers in the order of the keys.
+//
+RAJA_HOST_DEVICE RAJA_INLINE unsigned long long selectOrderedBits(Real_type key)
+{
+  unsigned long long bits;
+  memcpy(&bits, &key, sizeof(bits));
+  return (bits >> 63) ? ~bits : (bits | 0x8000000000000000ull);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Real_type selectKeyFromBits(unsigned long long bits)
+{
+  bits = (bits >> 63) ? (bits & 0x7FFFFFFFFFFFFFFFull) : ~bits;
+  Real_type key;
+  memcpy(&key, &bits, sizeof(key));
+  return key;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Index_type selectDigit(unsigned long long bits, int shift)
+{
+  return static_cast<Index_type>((bits >> shift) & (select_radix_bins - 1));
+}
+
+//
+// Ordered bits of the splitters of the sorted samples, the k-th of len keys
+// is likely between them.
+//
+RAJA_HOST_DEVICE RAJA_INLINE void selectSampleBounds(const Real_type* samples,
+                                                     Index_type len, Index_type k,
+                                                     unsigned long long& lo_bits,
+                                                     unsigned long long& hi_bits)
+{
+  const Index_type r = ((k - 1) * select_num_samples) / len;
+  const Index_type lo = r - select_sample_margin;
+  const Index_type hi = r + select_sample_margin;
+  lo_bits = (lo < 0) ? 0ull : selectOrderedBits(samples[lo]);
+  hi_bits = (hi >= select_num_samples) ? ~0ull : selectOrderedBits(samples[hi]);
+}
+
+class SELECT : public KernelBase
+{
+public:
+
+  SELECT(const RunParams& params);
+
+  ~SELECT();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SELECT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantSort(VariantID vid);
+  void runSeqVariantNthElement(VariantID vid);
+  void runSeqVariantRadix(VariantID vid);
+  void runSeqVariantSample(VariantID vid);
+  void runOpenMPVariantSort(VariantID vid);
+  void runOpenMPVariantNthElement(VariantID vid);
+  void runOpenMPVariantRadix(VariantID vid);
+  void runOpenMPVariantSample(VariantID vid);
+  void runCudaVariantSort(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantRadix(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantSample(VariantID vid);
+  void runHipVariantSort(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantRadix(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantSample(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                     gpu_block_size::MultipleOf<32>>;
+
+  template < size_t block_size >
+  void radixSelectCuda(const Real_type* keys, Index_type len, Index_type k,
+                       Real_type* y, unsigned long long* state,
+                       size_t max_grid_size);
+  template < size_t block_size >
+  void radixSelectHip(const Real_type* keys, Index_type len, Index_type k,
+                      Real_type* y, unsigned long long* state,
+                      size_t max_grid_size);
+
+  Index_type m_k;
+  Index_type m_distribution;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Real_ptr m_w0;
+  Real_ptr m_w1;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -12,8 +12,13 @@
 
 #if defined(RAJA_ENABLE_CUDA)
 
+#include "cub/device/device_radix_sort.cuh"
+#include "cub/device/device_merge_sort.cuh"
+
 #include "common/CudaDataUtils.hpp"
 
+#include <climits>
+
 #include <iostream>
 
 namespace rajaperf
@@ -22,7 +27,8 @@ namespace algorithm
 {
 
 
-void SORT::runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SORT::runCudaVariantTyped(VariantID vid, size_t tune_idx)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -32,7 +38,105 @@ void SORT::runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   SORT_DATA_SETUP;
 
-  if ( vid == RAJA_CUDA ) {
+  if ( vid == Base_CUDA &&
+       tune_idx < static_cast<size_t>(KeyOrder::NumKeyOrders) ) {
+
+    cudaStream_t stream = res.get_stream();
+
+    int len = iend - ibegin;
+
+    // Radix sort sorts between the buffers of a double buffer
+    Data_type* x_alt;
+    allocData(DataSpace::CudaDevice, x_alt, len);
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+    {
+      ::cub::DoubleBuffer<Data_type> d_keys(x+ibegin, x_alt);
+      cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys,
+                                                  len,
+                                                  0,
+                                                  sizeof(Data_type)*CHAR_BIT,
+                                                  stream));
+    }
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::CudaDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Data_type* keys = x + iend*irep + ibegin;
+
+      // Run
+      ::cub::DoubleBuffer<Data_type> d_keys(keys, x_alt);
+      cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys,
+                                                  len,
+                                                  0,
+                                                  sizeof(Data_type)*CHAR_BIT,
+                                                  stream));
+
+      // Copy back if the sorted keys ended in the alternate buffer
+      if (d_keys.Current() != keys) {
+        cudaErrchk( cudaMemcpyAsync(keys, d_keys.Current(), len*sizeof(Data_type),
+                                    cudaMemcpyDefault, stream) );
+      }
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::CudaDevice, temp_storage);
+    deallocData(DataSpace::CudaDevice, x_alt);
+
+  } else if ( vid == Base_CUDA ) {
+
+    cudaStream_t stream = res.get_stream();
+
+    RAJA::operators::less<Data_type> comp;
+
+    int len = iend - ibegin;
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+    cudaErrchk(::cub::DeviceMergeSort::SortKeys(d_temp_storage,
+                                                temp_storage_bytes,
+                                                x+ibegin,
+                                                len,
+                                                comp,
+                                                stream));
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::CudaDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // Run
+      cudaErrchk(::cub::DeviceMergeSort::SortKeys(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  x + iend*irep + ibegin,
+                                                  len,
+                                                  comp,
+                                                  stream));
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::CudaDevice, temp_storage);
+
+  } else if ( vid == RAJA_CUDA ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -47,6 +151,18 @@ void SORT::runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   }
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SORT, Cuda)
+
+void SORT::setCudaTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_CUDA) {
+    addKeyOrderTuningNames(vid, "radix_");
+    addKeyOrderTuningNames(vid, "merge_");
+  } else {
+    addKeyOrderTuningNames(vid, "");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
 
@@ -12,8 +12,18 @@
 
 #if defined(RAJA_ENABLE_HIP)
 
+#if defined(__HIPCC__)
+#define ROCPRIM_HIP_API 1
+#include "rocprim/device/device_radix_sort.hpp"
+#include "rocprim/device/device_merge_sort.hpp"
+#elif defined(__CUDACC__)
+#include "cub/device/device_radix_sort.cuh"
+#include "cub/device/device_merge_sort.cuh"
+#endif
+
 #include "common/HipDataUtils.hpp"
 
+#include <climits>
 #include <iostream>
 
 namespace rajaperf
@@ -22,7 +32,8 @@ namespace algorithm
 {
 
 
-void SORT::runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SORT::runHipVariantTyped(VariantID vid, size_t tune_idx)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -32,7 +43,151 @@ void SORT::runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   SORT_DATA_SETUP;
 
-  if ( vid == RAJA_HIP ) {
+  if ( vid == Base_HIP &&
+       tune_idx < static_cast<size_t>(KeyOrder::NumKeyOrders) ) {
+
+    hipStream_t stream = res.get_stream();
+
+    int len = iend - ibegin;
+
+    // Radix sort sorts between the buffers of a double buffer
+    Data_type* x_alt;
+    allocData(DataSpace::HipDevice, x_alt, len);
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+    {
+#if defined(__HIPCC__)
+      ::rocprim::double_buffer<Data_type> d_keys(x+ibegin, x_alt);
+      hipErrchk(::rocprim::radix_sort_keys(d_temp_storage,
+                                           temp_storage_bytes,
+                                           d_keys,
+                                           len,
+                                           0,
+                                           sizeof(Data_type)*CHAR_BIT,
+                                           stream));
+#elif defined(__CUDACC__)
+      ::cub::DoubleBuffer<Data_type> d_keys(x+ibegin, x_alt);
+      hipErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_keys,
+                                                 len,
+                                                 0,
+                                                 sizeof(Data_type)*CHAR_BIT,
+                                                 stream));
+#endif
+    }
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::HipDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Data_type* keys = x + iend*irep + ibegin;
+
+      // Run
+#if defined(__HIPCC__)
+      ::rocprim::double_buffer<Data_type> d_keys(keys, x_alt);
+      hipErrchk(::rocprim::radix_sort_keys(d_temp_storage,
+                                           temp_storage_bytes,
+                                           d_keys,
+                                           len,
+                                           0,
+                                           sizeof(Data_type)*CHAR_BIT,
+                                           stream));
+      Data_type* sorted_keys = d_keys.current();
+#elif defined(__CUDACC__)
+      ::cub::DoubleBuffer<Data_type> d_keys(keys, x_alt);
+      hipErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_keys,
+                                                 len,
+                                                 0,
+                                                 sizeof(Data_type)*CHAR_BIT,
+                                                 stream));
+      Data_type* sorted_keys = d_keys.Current();
+#endif
+
+      // Copy back if the sorted keys ended in the alternate buffer
+      if (sorted_keys != keys) {
+        hipErrchk( hipMemcpyAsync(keys, sorted_keys, len*sizeof(Data_type),
+                                  hipMemcpyDefault, stream) );
+      }
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::HipDevice, temp_storage);
+    deallocData(DataSpace::HipDevice, x_alt);
+
+  } else if ( vid == Base_HIP ) {
+
+    hipStream_t stream = res.get_stream();
+
+    RAJA::operators::less<Data_type> comp;
+
+    int len = iend - ibegin;
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+#if defined(__HIPCC__)
+    hipErrchk(::rocprim::merge_sort(d_temp_storage,
+                                    temp_storage_bytes,
+                                    x+ibegin,
+                                    x+ibegin,
+                                    len,
+                                    comp,
+                                    stream));
+#elif defined(__CUDACC__)
+    hipErrchk(::cub::DeviceMergeSort::SortKeys(d_temp_storage,
+                                               temp_storage_bytes,
+                                               x+ibegin,
+                                               len,
+                                               comp,
+                                               stream));
+#endif
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::HipDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Data_type* keys = x + iend*irep + ibegin;
+
+      // Run
+#if defined(__HIPCC__)
+      hipErrchk(::rocprim::merge_sort(d_temp_storage,
+                                      temp_storage_bytes,
+                                      keys,
+                                      keys,
+                                      len,
+                                      comp,
+                                      stream));
+#elif defined(__CUDACC__)
+      hipErrchk(::cub::DeviceMergeSort::SortKeys(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 keys,
+                                                 len,
+                                                 comp,
+                                                 stream));
+#endif
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::HipDevice, temp_storage);
+
+  } else if ( vid == RAJA_HIP ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -47,6 +202,18 @@ void SORT::runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   }
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SORT, Hip)
+
+void SORT::setHipTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_HIP) {
+    addKeyOrderTuningNames(vid, "radix_");
+    addKeyOrderTuningNames(vid, "merge_");
+  } else {
+    addKeyOrderTuningNames(vid, "");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
 
@@ -10,6 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
+#include <functional>
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +22,8 @@ namespace algorithm
 {
 
 
-void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SORT::runOpenMPVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -30,6 +35,19 @@ void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   switch ( vid ) {
 
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        ompMergeSort(x + iend*irep + ibegin, iend - ibegin, std::less<Data_type>());
+
+      }
+      stopTimer();
+
+      break;
+    }
+
     case RAJA_OpenMP : {
 
       startTimer();
@@ -54,5 +72,12 @@ void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SORT, OpenMP)
+
+void SORT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addKeyOrderTuningNames(vid, "");
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -18,7 +18,8 @@ namespace algorithm
 {
 
 
-void SORT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SORT::runSeqVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -64,5 +65,12 @@ void SORT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SORT, Seq)
+
+void SORT::setSeqTuningDefinitions(VariantID vid)
+{
+  addKeyOrderTuningNames(vid, "");
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -12,6 +12,10 @@
 
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
 namespace rajaperf
 {
 namespace algorithm
@@ -33,34 +37,112 @@ SORT::SORT(const RunParams& params)
 
   setUsesFeature(Sort);
 
+  setHasPattern(GatherScatter);
+
+  setUsesDataTypes();
+
+  // each rep sorts a different section of the data
+  setRepBatchingAllowed(false);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setVariantDefined( Base_CUDA );
   setVariantDefined( RAJA_CUDA );
 
+  setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 SORT::~SORT()
 {
 }
 
-void SORT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void SORT::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize()*getRunReps(), vid);
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), updateChecksumTyped, vid, tune_idx);
+}
+
+void SORT::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void SORT::setUpTyped(VariantID vid, size_t tune_idx)
+{
+  const Index_type len = getActualProblemSize();
+
+  Data_type* x;
+  allocAndInitDataRandValue(x, len*getRunReps(), vid);
+
+  KeyOrder order = getKeyOrder(vid, tune_idx);
+  if (order != KeyOrder::Random) {
+    auto reset_x = scopedMoveData(x, len*getRunReps(), vid);
+
+    for (Index_type irep = 0; irep < getRunReps(); ++irep) {
+      Data_type* xr = x + len*irep;
+      if (order == KeyOrder::Presorted) {
+        std::sort(xr, xr + len);
+      } else {
+        std::sort(xr, xr + len, std::greater<Data_type>());
+      }
+    }
+  }
+
+  m_x = x;
+}
+
+template < typename Data_type >
+void SORT::updateChecksumTyped(VariantID vid, size_t tune_idx)
+{
+  Data_type* x = static_cast<Data_type*>(m_x);
+  checksum[vid][tune_idx] += calcChecksum(x, getActualProblemSize()*getRunReps(), vid);
+}
+
+template < typename Data_type >
+void SORT::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Data_type* x = static_cast<Data_type*>(m_x);
+  deallocData(x, vid);
+  m_x = nullptr;
+}
+
+std::string SORT::getKeyOrderName(KeyOrder order)
+{
+  switch ( order ) {
+    case KeyOrder::Random : return "random";
+    case KeyOrder::Presorted : return "presorted";
+    case KeyOrder::Reversed : return "reversed";
+    default : throw std::invalid_argument("SORT : Unknown key order");
+  }
+}
+
+//
+// Key order tunings are added in groups of all key orders by
+// addKeyOrderTuningNames.
+//
+SORT::KeyOrder SORT::getKeyOrder(VariantID vid, size_t tune_idx) const
+{
+  return static_cast<KeyOrder>(getDataTypeTuningIdx(vid, tune_idx) %
+                               static_cast<size_t>(KeyOrder::NumKeyOrders));
 }
 
-void SORT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::addKeyOrderTuningNames(VariantID vid, const std::string& prefix)
 {
-  (void) vid;
-  deallocData(m_x, vid);
+  for (size_t io = 0; io < static_cast<size_t>(KeyOrder::NumKeyOrders); ++io) {
+    addVariantTuningName(vid, prefix + getKeyOrderName(static_cast<KeyOrder>(io)));
+  }
 }
 
 } // end namespace algorithm
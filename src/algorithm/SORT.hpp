@@ -11,12 +11,16 @@
 ///
 /// std::sort(x+ibegin, x+iend);
 ///
+/// Tunings sort random, presorted, and reversed keys. Base GPU variants
+/// use the radix and merge sorts of cub or rocprim, the Base OpenMP
+/// variant sorts a chunk per thread then merges the sorted chunks.
+///
 
 #ifndef RAJAPerf_Algorithm_SORT_HPP
 #define RAJAPerf_Algorithm_SORT_HPP
 
 #define SORT_DATA_SETUP \
-  Real_ptr x = m_x;
+  Data_type* x = static_cast<Data_type*>(m_x);
 
 #define STD_SORT_ARGS  \
   x + iend*irep + ibegin, x + iend*irep + iend
@@ -26,6 +30,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "common/DataTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -54,11 +59,52 @@ public:
   {
     getCout() << "\n  SORT : Unknown OMP Target variant id = " << vid << std::endl;
   }
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void setKokkosTuningDefinitions(VariantID vid);
+
+  template < typename Data_type >
+  void setUpTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void updateChecksumTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void tearDownTyped(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void runSeqVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runKokkosVariantTyped(VariantID vid, size_t tune_idx);
 
 private:
   static const size_t default_gpu_block_size = 0;
 
-  Real_ptr m_x;
+  //
+  // Tunings of each variant sort keys in each order, the keys of each rep
+  // are a permutation of the same values so every tuning has one checksum.
+  //
+  enum struct KeyOrder : size_t
+  {
+    Random = 0,
+    Presorted,
+    Reversed,
+    NumKeyOrders
+  };
+  static std::string getKeyOrderName(KeyOrder order);
+  KeyOrder getKeyOrder(VariantID vid, size_t tune_idx) const;
+
+  void addKeyOrderTuningNames(VariantID vid, const std::string& prefix);
+
+  void* m_x;        // array of Data_type
 };
 
 } // end namespace algorithm
@@ -12,8 +12,13 @@
 
 #if defined(RAJA_ENABLE_CUDA)
 
+#include "cub/device/device_radix_sort.cuh"
+#include "cub/device/device_merge_sort.cuh"
+
 #include "common/CudaDataUtils.hpp"
 
+#include <climits>
+
 #include <iostream>
 
 namespace rajaperf
@@ -22,7 +27,8 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SORTPAIRS::runCudaVariantTyped(VariantID vid, size_t tune_idx)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -32,7 +38,119 @@ void SORTPAIRS::runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 
   SORTPAIRS_DATA_SETUP;
 
-  if ( vid == RAJA_CUDA ) {
+  if ( vid == Base_CUDA &&
+       tune_idx < static_cast<size_t>(KeyOrder::NumKeyOrders) ) {
+
+    cudaStream_t stream = res.get_stream();
+
+    int len = iend - ibegin;
+
+    // Radix sort sorts between the buffers of a double buffer
+    Data_type* x_alt;
+    Data_type* i_alt;
+    allocData(DataSpace::CudaDevice, x_alt, len);
+    allocData(DataSpace::CudaDevice, i_alt, len);
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+    {
+      ::cub::DoubleBuffer<Data_type> d_keys(x+ibegin, x_alt);
+      ::cub::DoubleBuffer<Data_type> d_values(i+ibegin, i_alt);
+      cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   d_keys,
+                                                   d_values,
+                                                   len,
+                                                   0,
+                                                   sizeof(Data_type)*CHAR_BIT,
+                                                   stream));
+    }
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::CudaDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Data_type* keys = x + iend*irep + ibegin;
+      Data_type* values = i + iend*irep + ibegin;
+
+      // Run
+      ::cub::DoubleBuffer<Data_type> d_keys(keys, x_alt);
+      ::cub::DoubleBuffer<Data_type> d_values(values, i_alt);
+      cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   d_keys,
+                                                   d_values,
+                                                   len,
+                                                   0,
+                                                   sizeof(Data_type)*CHAR_BIT,
+                                                   stream));
+
+      // Copy back if the sorted pairs ended in the alternate buffers
+      if (d_keys.Current() != keys) {
+        cudaErrchk( cudaMemcpyAsync(keys, d_keys.Current(), len*sizeof(Data_type),
+                                    cudaMemcpyDefault, stream) );
+      }
+      if (d_values.Current() != values) {
+        cudaErrchk( cudaMemcpyAsync(values, d_values.Current(), len*sizeof(Data_type),
+                                    cudaMemcpyDefault, stream) );
+      }
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::CudaDevice, temp_storage);
+    deallocData(DataSpace::CudaDevice, x_alt);
+    deallocData(DataSpace::CudaDevice, i_alt);
+
+  } else if ( vid == Base_CUDA ) {
+
+    cudaStream_t stream = res.get_stream();
+
+    RAJA::operators::less<Data_type> comp;
+
+    int len = iend - ibegin;
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+    cudaErrchk(::cub::DeviceMergeSort::SortPairs(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 x+ibegin,
+                                                 i+ibegin,
+                                                 len,
+                                                 comp,
+                                                 stream));
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::CudaDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // Run
+      cudaErrchk(::cub::DeviceMergeSort::SortPairs(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   x + iend*irep + ibegin,
+                                                   i + iend*irep + ibegin,
+                                                   len,
+                                                   comp,
+                                                   stream));
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::CudaDevice, temp_storage);
+
+  } else if ( vid == RAJA_CUDA ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -47,6 +165,18 @@ void SORTPAIRS::runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
   }
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SORTPAIRS, Cuda)
+
+void SORTPAIRS::setCudaTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_CUDA) {
+    addKeyOrderTuningNames(vid, "radix_");
+    addKeyOrderTuningNames(vid, "merge_");
+  } else {
+    addKeyOrderTuningNames(vid, "");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
 
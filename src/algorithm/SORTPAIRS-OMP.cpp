@@ -10,6 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
+#include <utility>
+#include <vector>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +22,8 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SORTPAIRS::runOpenMPVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -30,6 +35,38 @@ void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
   switch ( vid ) {
 
+    case Base_OpenMP : {
+
+      using pair_type = std::pair<Data_type, Data_type>;
+
+      std::vector<pair_type> vector_of_pairs(iend-ibegin);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type iemp = ibegin; iemp < iend; ++iemp) {
+          vector_of_pairs[iemp - ibegin] = pair_type(x[iend*irep + iemp], i[iend*irep + iemp]);
+        }
+
+        ompMergeSort(vector_of_pairs.begin(), iend-ibegin,
+            [](pair_type const& lhs, pair_type const& rhs) {
+              return lhs.first < rhs.first;
+            });
+
+        #pragma omp parallel for
+        for (Index_type iemp = ibegin; iemp < iend; ++iemp) {
+          pair_type& pair = vector_of_pairs[iemp - ibegin];
+          x[iend*irep + iemp] = pair.first;
+          i[iend*irep + iemp] = pair.second;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
     case RAJA_OpenMP : {
 
       startTimer();
@@ -54,5 +91,12 @@ void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SORTPAIRS, OpenMP)
+
+void SORTPAIRS::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addKeyOrderTuningNames(vid, "");
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -21,7 +21,8 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void SORTPAIRS::runSeqVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -36,7 +37,7 @@ void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        using pair_type = std::pair<Real_type, Real_type>;
+        using pair_type = std::pair<Data_type, Data_type>;
 
         std::vector<pair_type> vector_of_pairs;
         vector_of_pairs.reserve(iend-ibegin);
@@ -84,5 +85,12 @@ void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(SORTPAIRS, Seq)
+
+void SORTPAIRS::setSeqTuningDefinitions(VariantID vid)
+{
+  addKeyOrderTuningNames(vid, "");
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
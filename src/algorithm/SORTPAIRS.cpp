@@ -12,6 +12,14 @@
 
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace rajaperf
 {
 namespace algorithm
@@ -33,13 +41,23 @@ SORTPAIRS::SORTPAIRS(const RunParams& params)
 
   setUsesFeature(Sort);
 
+  setHasPattern(GatherScatter);
+
+  setUsesDataTypes();
+
+  // each rep sorts a different section of the data
+  setRepBatchingAllowed(false);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setVariantDefined( Base_CUDA );
   setVariantDefined( RAJA_CUDA );
 
+  setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
 }
 
@@ -47,23 +65,128 @@ SORTPAIRS::~SORTPAIRS()
 {
 }
 
-void SORTPAIRS::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
-  allocAndInitDataRandValue(m_i, getActualProblemSize()*getRunReps(), vid);
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void SORTPAIRS::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize()*getRunReps(), vid);
-  checksum[vid][tune_idx] += calcChecksum(m_i, getActualProblemSize()*getRunReps(), vid);
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), updateChecksumTyped, vid, tune_idx);
+}
+
+void SORTPAIRS::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void SORTPAIRS::setUpTyped(VariantID vid, size_t tune_idx)
+{
+  const Index_type len = getActualProblemSize();
+
+  Data_type* x;
+  Data_type* i;
+  allocAndInitDataRandValue(x, len*getRunReps(), vid);
+  allocAndInitDataRandValue(i, len*getRunReps(), vid);
+
+  //
+  // Random values of data types other than Real_type repeat often and
+  // different sorts order pairs with equal keys differently, so keys of
+  // those data types are a shuffled sequence of distinct values instead.
+  //
+  const bool distinct_keys = !std::is_same<Data_type, Real_type>::value;
+
+  KeyOrder order = getKeyOrder(vid, tune_idx);
+  if (order != KeyOrder::Random || distinct_keys) {
+    auto reset_x = scopedMoveData(x, len*getRunReps(), vid);
+    auto reset_i = scopedMoveData(i, len*getRunReps(), vid);
+
+    using pair_type = std::pair<Data_type, Data_type>;
+
+    std::vector<pair_type> vector_of_pairs(len);
+
+    for (Index_type irep = 0; irep < getRunReps(); ++irep) {
+      Data_type* xr = x + len*irep;
+      Data_type* ir = i + len*irep;
+
+      if (distinct_keys) {
+        std::iota(xr, xr + len, Data_type(0));
+        std::shuffle(xr, xr + len, std::mt19937_64(irep));
+      }
+
+      for (Index_type iemp = 0; iemp < len; ++iemp) {
+        vector_of_pairs[iemp] = pair_type(xr[iemp], ir[iemp]);
+      }
+
+      if (order == KeyOrder::Presorted) {
+        std::sort(vector_of_pairs.begin(), vector_of_pairs.end(),
+            [](pair_type const& lhs, pair_type const& rhs) {
+              return lhs.first < rhs.first;
+            });
+      } else if (order == KeyOrder::Reversed) {
+        std::sort(vector_of_pairs.begin(), vector_of_pairs.end(),
+            [](pair_type const& lhs, pair_type const& rhs) {
+              return lhs.first > rhs.first;
+            });
+      }
+
+      for (Index_type iemp = 0; iemp < len; ++iemp) {
+        xr[iemp] = vector_of_pairs[iemp].first;
+        ir[iemp] = vector_of_pairs[iemp].second;
+      }
+    }
+  }
+
+  m_x = x;
+  m_i = i;
+}
+
+template < typename Data_type >
+void SORTPAIRS::updateChecksumTyped(VariantID vid, size_t tune_idx)
+{
+  Data_type* x = static_cast<Data_type*>(m_x);
+  Data_type* i = static_cast<Data_type*>(m_i);
+  checksum[vid][tune_idx] += calcChecksum(x, getActualProblemSize()*getRunReps(), vid);
+  checksum[vid][tune_idx] += calcChecksum(i, getActualProblemSize()*getRunReps(), vid);
+}
+
+template < typename Data_type >
+void SORTPAIRS::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Data_type* x = static_cast<Data_type*>(m_x);
+  Data_type* i = static_cast<Data_type*>(m_i);
+  deallocData(x, vid);
+  deallocData(i, vid);
+  m_x = nullptr;
+  m_i = nullptr;
+}
+
+std::string SORTPAIRS::getKeyOrderName(KeyOrder order)
+{
+  switch ( order ) {
+    case KeyOrder::Random : return "random";
+    case KeyOrder::Presorted : return "presorted";
+    case KeyOrder::Reversed : return "reversed";
+    default : throw std::invalid_argument("SORTPAIRS : Unknown key order");
+  }
+}
+
+//
+// Key order tunings are added in groups of all key orders by
+// addKeyOrderTuningNames.
+//
+SORTPAIRS::KeyOrder SORTPAIRS::getKeyOrder(VariantID vid, size_t tune_idx) const
+{
+  return static_cast<KeyOrder>(getDataTypeTuningIdx(vid, tune_idx) %
+                               static_cast<size_t>(KeyOrder::NumKeyOrders));
 }
 
-void SORTPAIRS::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::addKeyOrderTuningNames(VariantID vid, const std::string& prefix)
 {
-  (void) vid;
-  deallocData(m_x, vid);
-  deallocData(m_i, vid);
+  for (size_t io = 0; io < static_cast<size_t>(KeyOrder::NumKeyOrders); ++io) {
+    addVariantTuningName(vid, prefix + getKeyOrderName(static_cast<KeyOrder>(io)));
+  }
 }
 
 } // end namespace algorithm
@@ -0,0 +1,75 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Segment layouts used by the segmented kernels.
+///
+
+#ifndef RAJAPerf_SegmentUtils_HPP
+#define RAJAPerf_SegmentUtils_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+/*!
+ * \brief Return the offsets of segments covering [0, len).
+ *
+ * Segment lengths have mean mean_size and are distributed according to
+ * dist, one of
+ *   fixed   - every segment has length mean_size
+ *   uniform - lengths are uniform in [1, 2*mean_size-1]
+ *   skewed  - lengths follow a Pareto distribution, most segments are
+ *             short and a few are very long
+ * The last segment is truncated to end at len. The returned vector holds
+ * the number of segments plus one entries, starting with 0 and ending
+ * with len.
+ */
+inline std::vector<Int_type> makeSegmentOffsets(Index_type len,
+                                                Index_type mean_size,
+                                                const std::string& dist)
+{
+  constexpr unsigned long long segment_seed = 2141;
+
+  std::vector<Int_type> offsets;
+  offsets.emplace_back(0);
+
+  Index_type begin = 0;
+  for (Index_type s = 0; begin < len; ++s) {
+
+    const Real_type u = detail::counterRandValue(segment_seed, s);
+
+    Index_type size = mean_size;
+    if (dist == "uniform") {
+      size = 1 + static_cast<Index_type>(u * (2*mean_size - 1));
+    } else if (dist == "skewed") {
+      // Pareto with shape 1.5 and scale mean_size/3 has mean mean_size
+      size = static_cast<Index_type>(mean_size / 3.0 * std::pow(1.0 - u, -1.0/1.5));
+    }
+    size = std::max(size, Index_type(1));
+
+    begin = std::min(begin + size, len);
+    offsets.emplace_back(static_cast<Int_type>(begin));
+  }
+
+  return offsets;
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
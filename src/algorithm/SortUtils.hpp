@@ -0,0 +1,178 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Hand-written sort and selection used by Base variants of the sort and
+/// select kernels.
+///
+
+#ifndef RAJAPerf_SortUtils_HPP
+#define RAJAPerf_SortUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+/*!
+ * \brief Sort [begin, begin+len) with comp using OpenMP threads.
+ *
+ * Each thread sorts a contiguous chunk, then pairs of sorted chunks are
+ * merged in parallel until one sorted chunk is left.
+ */
+template < typename Iter, typename Compare >
+inline void ompMergeSort(Iter begin, Index_type len, Compare comp)
+{
+  const Index_type num_chunks =
+      std::max(Index_type(1), std::min(Index_type(omp_get_max_threads()), len));
+
+  auto chunk_begin = [=](Index_type c) {
+    return begin + (len * c) / num_chunks;
+  };
+
+  #pragma omp parallel for
+  for (Index_type c = 0; c < num_chunks; ++c) {
+    std::sort(chunk_begin(c), chunk_begin(c+1), comp);
+  }
+
+  for (Index_type width = 1; width < num_chunks; width *= 2) {
+    #pragma omp parallel for
+    for (Index_type c = 0; c < num_chunks - width; c += 2*width) {
+      std::inplace_merge(chunk_begin(c), chunk_begin(c + width),
+                         chunk_begin(std::min(c + 2*width, num_chunks)), comp);
+    }
+  }
+}
+
+/*!
+ * \brief Reorder [begin, begin+len) with comp so the element at begin+nth
+ *        is the element that would be there if sorted, and no element
+ *        before it is greater, using OpenMP threads and tmp of len elements.
+ *
+ * The range holding nth is partitioned in parallel into elements less
+ * than, equal to, and greater than the median of a sample of its elements,
+ * each thread counting then scattering a contiguous chunk, until the range
+ * is short enough for std::nth_element.
+ */
+template < typename T, typename Compare >
+inline void ompNthElement(T* begin, Index_type nth, Index_type len, T* tmp,
+                          Compare comp)
+{
+  constexpr Index_type serial_len = Index_type(1) << 16;
+  constexpr Index_type num_pivot_samples = 63;
+
+  const int max_threads = omp_get_max_threads();
+  std::vector<Index_type> counts(3*max_threads);
+
+  Index_type lo = 0;
+  Index_type hi = len;
+  while (hi - lo > serial_len) {
+
+    T samples[num_pivot_samples];
+    for (Index_type s = 0; s < num_pivot_samples; ++s) {
+      samples[s] = begin[lo + ((hi - lo) * s) / num_pivot_samples];
+    }
+    std::nth_element(samples, samples + num_pivot_samples/2,
+                     samples + num_pivot_samples, comp);
+    const T pivot = samples[num_pivot_samples/2];
+
+    Index_type nless = 0;
+    Index_type nequal = 0;
+
+    #pragma omp parallel
+    {
+      const int t = omp_get_thread_num();
+      const int nt = omp_get_num_threads();
+      const Index_type cbegin = lo + ((hi - lo) * t) / nt;
+      const Index_type cend = lo + ((hi - lo) * (t+1)) / nt;
+
+      Index_type cless = 0;
+      Index_type cequal = 0;
+      for (Index_type i = cbegin; i < cend; ++i) {
+        if (comp(begin[i], pivot)) {
+          ++cless;
+        } else if (!comp(pivot, begin[i])) {
+          ++cequal;
+        }
+      }
+      counts[3*t + 0] = cless;
+      counts[3*t + 1] = cequal;
+      counts[3*t + 2] = (cend - cbegin) - cless - cequal;
+
+      #pragma omp barrier
+
+      #pragma omp single
+      {
+        Index_type total[3] = {0, 0, 0};
+        for (int tt = 0; tt < nt; ++tt) {
+          for (int p = 0; p < 3; ++p) {
+            total[p] += counts[3*tt + p];
+          }
+        }
+        Index_type offset[3] = {lo, lo + total[0], lo + total[0] + total[1]};
+        for (int tt = 0; tt < nt; ++tt) {
+          for (int p = 0; p < 3; ++p) {
+            const Index_type c = counts[3*tt + p];
+            counts[3*tt + p] = offset[p];
+            offset[p] += c;
+          }
+        }
+        nless = total[0];
+        nequal = total[1];
+      }
+
+      Index_type il = counts[3*t + 0];
+      Index_type ie = counts[3*t + 1];
+      Index_type ig = counts[3*t + 2];
+      for (Index_type i = cbegin; i < cend; ++i) {
+        if (comp(begin[i], pivot)) {
+          tmp[il++] = begin[i];
+        } else if (!comp(pivot, begin[i])) {
+          tmp[ie++] = begin[i];
+        } else {
+          tmp[ig++] = begin[i];
+        }
+      }
+
+      #pragma omp barrier
+
+      #pragma omp for
+      for (Index_type i = lo; i < hi; ++i) {
+        begin[i] = tmp[i];
+      }
+    }
+
+    if (nth < lo + nless) {
+      hi = lo + nless;
+    } else if (nth < lo + nless + nequal) {
+      return;
+    } else {
+      lo = lo + nless + nequal;
+    }
+  }
+
+  std::nth_element(begin + lo, begin + nth, begin + hi, comp);
+}
+
+#endif
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
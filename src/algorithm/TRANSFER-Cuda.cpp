@@ -0,0 +1,133 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSFER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+#include "common/DataUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void TRANSFER::runCudaVariantSync(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSFER_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const Transfer& transfer = m_transfers[vid].at(tune_idx);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type m = 0; m < num_messages; ++m) {
+        detail::copyData(transfer.dst_space, dst + m*len,
+                         transfer.src_space, src + m*len, message_bytes);
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  TRANSFER : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+void TRANSFER::runCudaVariantAsync(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSFER_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    std::vector<cudaStream_t> streams(m_num_streams);
+    for (cudaStream_t& stream : streams) {
+      cudaErrchk( cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking) );
+    }
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type m = 0; m < num_messages; ++m) {
+        cudaErrchk( cudaMemcpyAsync( TRANSFER_MESSAGE_ARGS(m),
+                                     cudaMemcpyDefault,
+                                     streams[m % m_num_streams] ) );
+      }
+
+    }
+    for (cudaStream_t& stream : streams) {
+      cudaErrchk( cudaStreamSynchronize(stream) );
+    }
+    stopTimer();
+
+    for (cudaStream_t& stream : streams) {
+      cudaErrchk( cudaStreamDestroy(stream) );
+    }
+
+  } else {
+
+    getCout() << "\n  TRANSFER : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+void TRANSFER::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  if ( m_transfers[vid].at(tune_idx).async ) {
+    runCudaVariantAsync(vid, tune_idx);
+  } else {
+    runCudaVariantSync(vid, tune_idx);
+  }
+}
+
+void TRANSFER::setCudaTuningDefinitions(VariantID vid)
+{
+  const struct { const char* name; DataSpace space; } host_spaces[] = {
+    { "host", DataSpace::Host },
+    { "pinned", DataSpace::CudaPinned },
+    { "managed", DataSpace::CudaManaged }
+  };
+
+  for (auto const& host : host_spaces) {
+    addTransferTunings(vid, host.name, host.space, "device", DataSpace::CudaDevice);
+  }
+  for (auto const& host : host_spaces) {
+    addTransferTunings(vid, "device", DataSpace::CudaDevice, host.name, host.space);
+  }
+  addTransferTunings(vid, "device", DataSpace::CudaDevice, "device", DataSpace::CudaDevice);
+
+  int num_devices = 0;
+  cudaErrchk( cudaGetDeviceCount(&num_devices) );
+  if (num_devices > 1) {
+    m_peer_device = (detail::getCudaDevice() + 1) % num_devices;
+    addTransferTunings(vid, "device", DataSpace::CudaDevice, "peer", DataSpace::CudaDevice,
+                       true /*peer*/);
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,135 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSFER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+#include "common/DataUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void TRANSFER::runHipVariantSync(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSFER_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const Transfer& transfer = m_transfers[vid].at(tune_idx);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type m = 0; m < num_messages; ++m) {
+        detail::copyData(transfer.dst_space, dst + m*len,
+                         transfer.src_space, src + m*len, message_bytes);
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  TRANSFER : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+void TRANSFER::runHipVariantAsync(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSFER_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    std::vector<hipStream_t> streams(m_num_streams);
+    for (hipStream_t& stream : streams) {
+      hipErrchk( hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) );
+    }
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type m = 0; m < num_messages; ++m) {
+        hipErrchk( hipMemcpyAsync( TRANSFER_MESSAGE_ARGS(m),
+                                     hipMemcpyDefault, 
+                                     streams[m % m_num_streams] ) );
+      }
+
+    }
+    for (hipStream_t& stream : streams) {
+      hipErrchk( hipStreamSynchronize(stream) );
+    }
+    stopTimer();
+
+    for (hipStream_t& stream : streams) {
+      hipErrchk( hipStreamDestroy(stream) );
+    }
+
+  } else {
+
+    getCout() << "\n  TRANSFER : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+void TRANSFER::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  if ( m_transfers[vid].at(tune_idx).async ) {
+    runHipVariantAsync(vid, tune_idx);
+  } else {
+    runHipVariantSync(vid, tune_idx);
+  }
+}
+
+void TRANSFER::setHipTuningDefinitions(VariantID vid)
+{
+  const struct { const char* name; DataSpace space; } host_spaces[] = {
+    { "host", DataSpace::Host },
+    { "pinned", DataSpace::HipPinned },
+    { "pinned_fine", DataSpace::HipPinnedFine },
+    { "pinned_coarse", DataSpace::HipPinnedCoarse },
+    { "managed", DataSpace::HipManaged }
+  };
+
+  for (auto const& host : host_spaces) {
+    addTransferTunings(vid, host.name, host.space, "device", DataSpace::HipDevice);
+  }
+  for (auto const& host : host_spaces) {
+    addTransferTunings(vid, "device", DataSpace::HipDevice, host.name, host.space);
+  }
+  addTransferTunings(vid, "device", DataSpace::HipDevice, "device", DataSpace::HipDevice);
+
+  int num_devices = 0;
+  hipErrchk( hipGetDeviceCount(&num_devices) );
+  if (num_devices > 1) {
+    m_peer_device = (detail::getHipDevice() + 1) % num_devices;
+    addTransferTunings(vid, "device", DataSpace::HipDevice, "peer", DataSpace::HipDevice,
+                       true /*peer*/);
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,58 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSFER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void TRANSFER::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSFER_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    const Transfer& transfer = m_transfers[vid].at(tune_idx);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type m = 0; m < num_messages; ++m) {
+        detail::copyData(transfer.dst_space, dst + m*len,
+                         transfer.src_space, src + m*len, message_bytes);
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  TRANSFER : Unknown variant id = " << vid << std::endl;
+  }
+
+}
+
+void TRANSFER::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "host_to_host");
+  m_transfers[vid].emplace_back(
+      Transfer{DataSpace::Host, DataSpace::Host, false, false});
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
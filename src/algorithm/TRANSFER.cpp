@@ -0,0 +1,155 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSFER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+#include "common/CudaDataUtils.hpp"
+#include "common/HipDataUtils.hpp"
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+TRANSFER::TRANSFER(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_TRANSFER, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_num_messages = getKernelParam("messages", 8);
+  m_num_streams = getKernelParam("streams", 4, 1, 32);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( m_num_messages * getActualProblemSize() );
+  setKernelsPerRep( m_num_messages );
+  // bytes moved between the data spaces, each byte is counted once
+  setBytesPerRep( (1*sizeof(Real_type)) * m_num_messages * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setHasPattern(Streaming);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+TRANSFER::~TRANSFER()
+{
+}
+
+void TRANSFER::addTransferTunings(VariantID vid,
+                                  const std::string& src_name, DataSpace src_space,
+                                  const std::string& dst_name, DataSpace dst_space,
+                                  bool peer)
+{
+  const std::string name = src_name + "_to_" + dst_name;
+
+  addVariantTuningName(vid, name + "_sync");
+  m_transfers[vid].emplace_back(Transfer{src_space, dst_space, peer, false});
+
+  addVariantTuningName(vid, name + "_async");
+  m_transfers[vid].emplace_back(Transfer{src_space, dst_space, peer, true});
+}
+
+void TRANSFER::allocPeerData(VariantID vid, Real_ptr& ptr, Index_type len)
+{
+  const size_t nbytes = len*sizeof(Real_type);
+#if defined(RAJA_ENABLE_CUDA)
+  if ( vid == Base_CUDA ) {
+    const int device = detail::getCudaDevice();
+    cudaErrchk( cudaSetDevice(m_peer_device) );
+    ptr = static_cast<Real_ptr>(detail::allocCudaDeviceData(nbytes));
+    cudaErrchk( cudaMemset(ptr, 0, nbytes) );
+    cudaErrchk( cudaDeviceSynchronize() );
+    cudaErrchk( cudaSetDevice(device) );
+    cudaError_t err = cudaDeviceEnablePeerAccess(m_peer_device, 0);
+    if (err == cudaErrorPeerAccessAlreadyEnabled) {
+      (void)cudaGetLastError();
+    } else {
+      cudaErrchk( err );
+    }
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if ( vid == Base_HIP ) {
+    const int device = detail::getHipDevice();
+    hipErrchk( hipSetDevice(m_peer_device) );
+    ptr = static_cast<Real_ptr>(detail::allocHipDeviceData(nbytes));
+    hipErrchk( hipMemset(ptr, 0, nbytes) );
+    hipErrchk( hipDeviceSynchronize() );
+    hipErrchk( hipSetDevice(device) );
+    hipError_t err = hipDeviceEnablePeerAccess(m_peer_device, 0);
+    if (err == hipErrorPeerAccessAlreadyEnabled) {
+      (void)hipGetLastError();
+    } else {
+      hipErrchk( err );
+    }
+  }
+#endif
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(nbytes);
+}
+
+void TRANSFER::deallocPeerData(VariantID vid, Real_ptr& ptr)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  if ( vid == Base_CUDA ) {
+    detail::deallocCudaDeviceData(ptr);
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if ( vid == Base_HIP ) {
+    detail::deallocHipDeviceData(ptr);
+  }
+#endif
+  RAJA_UNUSED_VAR(vid);
+  ptr = nullptr;
+}
+
+void TRANSFER::setUp(VariantID vid, size_t tune_idx)
+{
+  const Transfer& transfer = m_transfers[vid].at(tune_idx);
+  const Index_type len = m_num_messages * getActualProblemSize();
+
+  rajaperf::allocAndInitData(transfer.src_space, m_src, len, getDataAlignment());
+  if (transfer.peer) {
+    allocPeerData(vid, m_dst, len);
+  } else {
+    rajaperf::allocAndInitDataConst(transfer.dst_space, m_dst, len,
+                                    getDataAlignment(), 0.0);
+  }
+}
+
+void TRANSFER::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const Transfer& transfer = m_transfers[vid].at(tune_idx);
+  checksum[vid].at(tune_idx) += rajaperf::calcChecksum(transfer.dst_space,
+      m_dst, m_num_messages * getActualProblemSize(), getDataAlignment(), 1.0);
+}
+
+void TRANSFER::tearDown(VariantID vid, size_t tune_idx)
+{
+  const Transfer& transfer = m_transfers[vid].at(tune_idx);
+  rajaperf::deallocData(transfer.src_space, m_src);
+  if (transfer.peer) {
+    deallocPeerData(vid, m_dst);
+  } else {
+    rajaperf::deallocData(transfer.dst_space, m_dst);
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
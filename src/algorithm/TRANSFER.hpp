@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TRANSFER kernel reference implementation:
+///
+/// // copy num_messages messages of len elements from src in one data
+/// // space to dst in another data space
+/// for (Index_type m = 0; m < num_messages; ++m ) {
+///   copyData(dst_space, dst + m*len, src_space, src + m*len, len);
+/// }
+///
+/// The problem size is the message length, so a problem size sweep gives
+/// the transfer bandwidth as a function of message size. num_messages is
+/// given by the kernel parameter "messages". Each tuning copies from one
+/// source to one destination data space, ie. host_to_device, either one
+/// message at a time with detail::copyData (sync) or with async copies
+/// spread over the number of streams given by the kernel parameter
+/// "streams" (async). The peer destination is device memory of another
+/// GPU when more than one is visible.
+///
+
+#ifndef RAJAPerf_Algorithm_TRANSFER_HPP
+#define RAJAPerf_Algorithm_TRANSFER_HPP
+
+#define TRANSFER_DATA_SETUP \
+  Real_ptr src = m_src; \
+  Real_ptr dst = m_dst; \
+  const Index_type len = getActualProblemSize(); \
+  const Index_type num_messages = m_num_messages; \
+  const size_t message_bytes = len*sizeof(Real_type);
+
+#define TRANSFER_MESSAGE_ARGS(m) \
+  dst + (m)*len, src + (m)*len, message_bytes
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class TRANSFER : public KernelBase
+{
+public:
+
+  TRANSFER(const RunParams& params);
+
+  ~TRANSFER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRANSFER : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRANSFER : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runCudaVariantSync(VariantID vid, size_t tune_idx);
+  void runCudaVariantAsync(VariantID vid, size_t tune_idx);
+
+  void runHipVariantSync(VariantID vid, size_t tune_idx);
+  void runHipVariantAsync(VariantID vid, size_t tune_idx);
+
+private:
+  struct Transfer
+  {
+    DataSpace src_space;
+    DataSpace dst_space;
+    bool peer;  // dst is device memory of m_peer_device
+    bool async;
+  };
+
+  // add tunings copying from src to dst one message at a time and with
+  // async copies, named src_name_to_dst_name_sync and _async
+  void addTransferTunings(VariantID vid,
+                          const std::string& src_name, DataSpace src_space,
+                          const std::string& dst_name, DataSpace dst_space,
+                          bool peer = false);
+
+  void allocPeerData(VariantID vid, Real_ptr& ptr, Index_type len);
+  void deallocPeerData(VariantID vid, Real_ptr& ptr);
+
+  std::vector<Transfer> m_transfers[NumVariants];
+
+  Index_type m_num_messages;
+  Index_type m_num_streams;
+  int m_peer_device = -1;
+
+  Real_ptr m_src;
+  Real_ptr m_dst;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
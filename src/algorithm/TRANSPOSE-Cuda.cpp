@@ -0,0 +1,277 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSPOSE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void transpose_memcpy(Real_ptr x, Real_ptr y, Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    TRANSPOSE_MEMCPY_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void transpose_naive(Real_ptr x, Real_ptr y,
+                                Index_type ni, Index_type nd, Index_type ne,
+                                Index_type sxd, Index_type sxe,
+                                Index_type syi, Index_type sye)
+{
+  Index_type ide = blockIdx.x * block_size + threadIdx.x;
+  if (ide < ni*nd*ne) {
+    TRANSPOSE_FLAT_BODY;
+  }
+}
+
+//
+// Each block reads a tile of x along i and writes it along d, the padding
+// column puts the elements of a column of the tile in different banks.
+//
+template < size_t block_size, Index_type tile_dim, bool pad >
+__launch_bounds__(block_size)
+__global__ void transpose_tiled(Real_ptr x, Real_ptr y,
+                                Index_type ni, Index_type nd, Index_type ne,
+                                Index_type sxd, Index_type sxe,
+                                Index_type syi, Index_type sye)
+{
+  constexpr Index_type tile_rows = block_size / tile_dim;
+
+  __shared__ Real_type tile[tile_dim][tile_dim + (pad ? 1 : 0)];
+
+  const Index_type tx = threadIdx.x;
+  const Index_type i0 = blockIdx.x * tile_dim;
+
+  for (Index_type e = blockIdx.z; e < ne; e += gridDim.z) {
+    for (Index_type d0 = blockIdx.y * tile_dim; d0 < nd; d0 += gridDim.y * tile_dim) {
+
+      for (Index_type r = threadIdx.y; r < tile_dim; r += tile_rows) {
+        const Index_type i = i0 + tx;
+        const Index_type d = d0 + r;
+        if (i < ni && d < nd) {
+          tile[r][tx] = x[i + d*sxd + e*sxe];
+        }
+      }
+      __syncthreads();
+
+      for (Index_type r = threadIdx.y; r < tile_dim; r += tile_rows) {
+        const Index_type i = i0 + r;
+        const Index_type d = d0 + tx;
+        if (i < ni && d < nd) {
+          y[i*syi + d + e*sye] = tile[tx][r];
+        }
+      }
+      __syncthreads();
+
+    }
+  }
+}
+
+
+template < size_t block_size >
+void TRANSPOSE::runCudaVariantMemcpy(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  TRANSPOSE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      transpose_memcpy<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, y, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        TRANSPOSE_MEMCPY_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  TRANSPOSE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void TRANSPOSE::runCudaVariantNaive(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  TRANSPOSE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(ni*nd*ne, block_size);
+      constexpr size_t shmem = 0;
+      transpose_naive<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, y, ni, nd, ne, sxd, sxe, syi, sye );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, ni*nd*ne), [=] __device__ (Index_type ide) {
+        TRANSPOSE_FLAT_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  TRANSPOSE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size, bool pad >
+void TRANSPOSE::runCudaVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  TRANSPOSE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr Index_type tile_dim = gpu_tile_dim;
+    constexpr Index_type max_grid_dim = 65535;
+
+    const dim3 nthreads_per_block(tile_dim, block_size / tile_dim, 1);
+    const dim3 nblocks(RAJA_DIVIDE_CEILING_INT(ni, tile_dim),
+                       std::min(RAJA_DIVIDE_CEILING_INT(nd, tile_dim), max_grid_dim),
+                       std::min(ne, max_grid_dim));
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+      transpose_tiled<block_size, tile_dim, pad><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(
+          x, y, ni, nd, ne, sxd, sxe, syi, sye );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  TRANSPOSE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void TRANSPOSE::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantMemcpy<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantNaive<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == Base_CUDA) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantTiled<block_size, true>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantTiled<block_size, false>(vid);
+        }
+        t += 1;
+
+      }
+
+    }
+
+  });
+}
+
+void TRANSPOSE::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "memcpy"+block_name);
+      addVariantTuningName(vid, "naive"+block_name);
+      if (vid == Base_CUDA) {
+        addVariantTuningName(vid, "tiled"+block_name);
+        addVariantTuningName(vid, "tiled_unpadded"+block_name);
+      }
+
+    }
+
+  });
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,267 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSPOSE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/NontemporalUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void TRANSPOSE::runOpenMPVariantMemcpy(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRANSPOSE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRANSPOSE_MEMCPY_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRANSPOSE_MEMCPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRANSPOSE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TRANSPOSE::runOpenMPVariantNaive(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  TRANSPOSE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type e = 0; e < ne; ++e ) {
+          for (Index_type d = 0; d < nd; ++d ) {
+            for (Index_type i = 0; i < ni; ++i ) {
+              TRANSPOSE_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, ni*nd*ne), [=](Index_type ide) {
+          TRANSPOSE_FLAT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRANSPOSE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TRANSPOSE::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  TRANSPOSE_BLOCK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ite = 0; ite < ne*ntiles_i*ntiles_d; ++ite ) {
+          TRANSPOSE_TILE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, ne*ntiles_i*ntiles_d), [=](Index_type ite) {
+          TRANSPOSE_TILE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRANSPOSE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TRANSPOSE::runOpenMPVariantBlockedNontemporal(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  TRANSPOSE_BLOCK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for nowait
+          for (Index_type ite = 0; ite < ne*ntiles_i*ntiles_d; ++ite ) {
+            TRANSPOSE_TILE_BODY_NONTEMPORAL;
+          }
+          fenceNontemporal();
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRANSPOSE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TRANSPOSE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantMemcpy(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantNaive(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantBlocked(vid);
+  }
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+    if (tune_idx == t) {
+      runOpenMPVariantBlockedNontemporal(vid);
+    }
+    t += 1;
+  }
+}
+
+void TRANSPOSE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "memcpy");
+  addVariantTuningName(vid, "naive");
+  addVariantTuningName(vid, "blocked");
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "blocked_nontemporal");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,246 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSPOSE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/NontemporalUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void TRANSPOSE::runSeqVariantMemcpy(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRANSPOSE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRANSPOSE_MEMCPY_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRANSPOSE_MEMCPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRANSPOSE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRANSPOSE::runSeqVariantNaive(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSPOSE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type e = 0; e < ne; ++e ) {
+          for (Index_type d = 0; d < nd; ++d ) {
+            for (Index_type i = 0; i < ni; ++i ) {
+              TRANSPOSE_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, ni*nd*ne), [=](Index_type ide) {
+          TRANSPOSE_FLAT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRANSPOSE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRANSPOSE::runSeqVariantBlocked(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSPOSE_BLOCK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ite = 0; ite < ne*ntiles_i*ntiles_d; ++ite ) {
+          TRANSPOSE_TILE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, ne*ntiles_i*ntiles_d), [=](Index_type ite) {
+          TRANSPOSE_TILE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRANSPOSE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRANSPOSE::runSeqVariantBlockedNontemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSPOSE_BLOCK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ite = 0; ite < ne*ntiles_i*ntiles_d; ++ite ) {
+          TRANSPOSE_TILE_BODY_NONTEMPORAL;
+        }
+        fenceNontemporal();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRANSPOSE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRANSPOSE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantMemcpy(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantNaive(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantBlocked(vid);
+  }
+  t += 1;
+
+  if (vid == Base_Seq) {
+    if (tune_idx == t) {
+      runSeqVariantBlockedNontemporal(vid);
+    }
+    t += 1;
+  }
+}
+
+void TRANSPOSE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "memcpy");
+  addVariantTuningName(vid, "naive");
+  addVariantTuningName(vid, "blocked");
+  if (vid == Base_Seq) {
+    addVariantTuningName(vid, "blocked_nontemporal");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
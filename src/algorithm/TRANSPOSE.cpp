@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSPOSE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+TRANSPOSE::TRANSPOSE(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_TRANSPOSE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  m_dims = getKernelParam("dims", 2, {2, 3});
+  m_perm = getKernelParam("perm", 0, {0, 1, 2});
+  m_tile = getKernelParam("tile", 32);
+  const Index_type ni = getKernelParam("ni", 0, 0);
+  const Index_type nj = getKernelParam("nj", 0, 0);
+
+  const Index_type target = getTargetProblemSize();
+  if (m_dims == 2) {
+    m_n0 = (ni > 0) ? ni : std::max(Index_type(1),
+                                    static_cast<Index_type>(std::sqrt(target) + 0.5));
+    m_n1 = (nj > 0) ? nj : std::max(Index_type(1), target / m_n0);
+    m_n2 = 1;
+    // a 2D transpose only swaps i and j
+    m_perm = 0;
+  } else {
+    m_n0 = (ni > 0) ? ni : std::max(Index_type(1),
+                                    static_cast<Index_type>(std::cbrt(target) + 0.5));
+    m_n1 = (nj > 0) ? nj : std::max(Index_type(1),
+                                    static_cast<Index_type>(std::sqrt(
+                                        static_cast<double>(target) / m_n0) + 0.5));
+    m_n2 = std::max(Index_type(1), target / (m_n0*m_n1));
+  }
+
+  //
+  // The index of x that is fastest in y is d, the other index is e.
+  //
+  m_ni = m_n0;
+  switch (m_perm) {
+    case 1 :
+      m_nd = m_n2;
+      m_ne = m_n1;
+      m_sxd = m_n0*m_n1;
+      m_sxe = m_n0;
+      m_syi = m_n2*m_n1;
+      m_sye = m_n2;
+      break;
+    case 2 :
+      m_nd = m_n1;
+      m_ne = m_n2;
+      m_sxd = m_n0;
+      m_sxe = m_n0*m_n1;
+      m_syi = m_n1*m_n2;
+      m_sye = m_n1;
+      break;
+    default :
+      m_nd = m_n1;
+      m_ne = m_n2;
+      m_sxd = m_n0;
+      m_sxe = m_n0*m_n1;
+      m_syi = m_n1;
+      m_sye = m_n1*m_n0;
+      break;
+  }
+
+  setActualProblemSize( m_n0*m_n1*m_n2 );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setMetricNames({"memcpy_bw_pct"});
+
+  setUsesFeature(Forall);
+
+  setHasPattern(GatherScatter);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+TRANSPOSE::~TRANSPOSE()
+{
+}
+
+//
+// The tunings move the same bytes so the ratio of times is the ratio of
+// bandwidths.
+//
+std::vector<double> TRANSPOSE::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  double memcpy_time = 0.0;
+  for (size_t t = 0; t < getNumVariantTunings(vid); ++t) {
+    if ( getVariantTuningName(vid, t).compare(0, 6, "memcpy") == 0 &&
+         wasVariantTuningRun(vid, t) ) {
+      const double time = getMinTime(vid, t);
+      memcpy_time = (memcpy_time > 0.0) ? std::min(memcpy_time, time) : time;
+    }
+  }
+  if ( memcpy_time == 0.0 ) {
+    return {};
+  }
+  return {100.0 * memcpy_time / getMinTime(vid, tune_idx)};
+}
+
+void TRANSPOSE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_x, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+}
+
+void TRANSPOSE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, getActualProblemSize(), vid);
+}
+
+void TRANSPOSE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
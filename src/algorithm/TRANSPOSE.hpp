@@ -0,0 +1,194 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TRANSPOSE kernel reference implementation:
+///
+/// // out of place 2D transpose of the n1 x n0 array x, where i is the
+/// // fastest index of x and j is the fastest index of y
+/// for (Index_type j = 0; j < n1; ++j ) {
+///   for (Index_type i = 0; i < n0; ++i ) {
+///     y[j + i*n1] = x[i + j*n0];
+///   }
+/// }
+///
+/// The kernel parameter "dims" (2 by default) gives a 2D transpose or a 3D
+/// permutation of the n2 x n1 x n0 array x, given by the kernel parameter
+/// "perm" (0 by default), where
+///
+///   0 -- swap i and j,  y[j + i*n1 + k*n1*n0]
+///   1 -- swap i and k,  y[k + j*n2 + i*n2*n1]
+///   2 -- rotate,        y[j + k*n1 + i*n1*n2]
+///
+/// The extents are square or cube roots of the problem size unless given
+/// with the kernel parameters "ni" (n0) and "nj" (n1), the remaining extent
+/// is set by the problem size.
+///
+/// Each element is (i, d, e), where i is the fastest index of x, d is the
+/// index that is fastest in y, and e is the other index, so every
+/// permutation is one loop nest with the strides of d and e in x and of i
+/// and e in y. Tunings are naive loops, cache blocked loops over tiles of
+/// "tile" x "tile" elements on the CPU, with non-temporal stores in the
+/// Base variants, and GPU kernels staging tiles in shared memory, with and
+/// without padding against bank conflicts. The memcpy tunings copy x to y
+/// unpermuted with the same bytes, so their checksums differ from the other
+/// tunings, and the bandwidth of each tuning is reported relative to the
+/// best memcpy tuning of its variant.
+///
+
+#ifndef RAJAPerf_Algorithm_TRANSPOSE_HPP
+#define RAJAPerf_Algorithm_TRANSPOSE_HPP
+
+#define TRANSPOSE_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  const Index_type ni = m_ni; \
+  const Index_type nd = m_nd; \
+  const Index_type ne = m_ne; \
+  const Index_type sxd = m_sxd; \
+  const Index_type sxe = m_sxe; \
+  const Index_type syi = m_syi; \
+  const Index_type sye = m_sye;
+
+#define TRANSPOSE_BLOCK_DATA_SETUP \
+  TRANSPOSE_DATA_SETUP; \
+  const Index_type tile = m_tile; \
+  const Index_type ntiles_i = RAJA_DIVIDE_CEILING_INT(ni, tile); \
+  const Index_type ntiles_d = RAJA_DIVIDE_CEILING_INT(nd, tile);
+
+#define TRANSPOSE_MEMCPY_BODY \
+  y[i] = x[i];
+
+#define TRANSPOSE_BODY \
+  y[i*syi + d + e*sye] = x[i + d*sxd + e*sxe];
+
+#define TRANSPOSE_BODY_NONTEMPORAL \
+  storeNontemporal(&y[i*syi + d + e*sye], x[i + d*sxd + e*sxe]);
+
+// element (i, d, e) of flat index ide in the order of the loop nest
+#define TRANSPOSE_FLAT_BODY \
+  const Index_type i = ide % ni; \
+  const Index_type d = (ide / ni) % nd; \
+  const Index_type e = ide / (ni*nd); \
+  TRANSPOSE_BODY
+
+// tile (it, dt, e), the stores of each i are contiguous in y
+#define TRANSPOSE_TILE_BODY_IMPL(body) \
+  const Index_type e = ite / (ntiles_i*ntiles_d); \
+  const Index_type dt = (ite / ntiles_i) % ntiles_d; \
+  const Index_type it = ite % ntiles_i; \
+  const Index_type i0 = it * tile; \
+  const Index_type i1 = (i0 + tile < ni) ? i0 + tile : ni; \
+  const Index_type d0 = dt * tile; \
+  const Index_type d1 = (d0 + tile < nd) ? d0 + tile : nd; \
+  for (Index_type i = i0; i < i1; ++i ) { \
+    for (Index_type d = d0; d < d1; ++d ) { \
+      body; \
+    } \
+  }
+
+#define TRANSPOSE_TILE_BODY \
+  TRANSPOSE_TILE_BODY_IMPL(TRANSPOSE_BODY)
+
+#define TRANSPOSE_TILE_BODY_NONTEMPORAL \
+  TRANSPOSE_TILE_BODY_IMPL(TRANSPOSE_BODY_NONTEMPORAL)
+
+
+#include "common/KernelBase.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class TRANSPOSE : public KernelBase
+{
+public:
+
+  TRANSPOSE(const RunParams& params);
+
+  ~TRANSPOSE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  // bandwidth as a percent of the best memcpy tuning of the variant
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRANSPOSE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantMemcpy(VariantID vid);
+  void runSeqVariantNaive(VariantID vid);
+  void runSeqVariantBlocked(VariantID vid);
+  void runSeqVariantBlockedNontemporal(VariantID vid);
+  void runOpenMPVariantMemcpy(VariantID vid);
+  void runOpenMPVariantNaive(VariantID vid);
+  void runOpenMPVariantBlocked(VariantID vid);
+  void runOpenMPVariantBlockedNontemporal(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantMemcpy(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantNaive(VariantID vid);
+  template < size_t block_size, bool pad >
+  void runCudaVariantTiled(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantMemcpy(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantNaive(VariantID vid);
+  template < size_t block_size, bool pad >
+  void runHipVariantTiled(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  // tiled kernels use blocks of whole rows of a gpu tile
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                     gpu_block_size::MultipleOf<32>>;
+
+  // extents of the tiles of the GPU tiled kernels
+  static const Index_type gpu_tile_dim = 32;
+
+  Index_type m_dims;
+  Index_type m_perm;
+  Index_type m_tile;
+
+  Index_type m_n0;
+  Index_type m_n1;
+  Index_type m_n2;
+
+  Index_type m_ni;
+  Index_type m_nd;
+  Index_type m_ne;
+  Index_type m_sxd;
+  Index_type m_sxe;
+  Index_type m_syi;
+  Index_type m_sye;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,314 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_SOLVE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void tridiag_solve_thomas(Real_ptr a, Real_ptr b, Real_ptr c,
+                                     Real_ptr d, Real_ptr x, Real_ptr work,
+                                     Index_type N, Index_type num_systems)
+{
+  Index_type isys = blockIdx.x * block_size + threadIdx.x;
+  if (isys < num_systems) {
+    TRIDIAG_SOLVE_THOMAS_SYSTEM_BODY;
+  }
+}
+
+//
+// The reduction kernels solve system blockIdx.x with the coefficients in
+// 8*N values of dynamic shared memory.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void tridiag_solve_cr(Real_ptr a, Real_ptr b, Real_ptr c,
+                                 Real_ptr d, Real_ptr x, Index_type N)
+{
+  extern __shared__ Real_type tridiag_shmem[];
+
+  const Index_type isys = blockIdx.x;
+  TRIDIAG_SOLVE_SYSTEM_SETUP;
+  TRIDIAG_SOLVE_WORK_SETUP(tridiag_shmem);
+  Real_ptr wx = na;
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    TRIDIAG_SOLVE_COPY_BODY;
+  }
+  __syncthreads();
+
+  na = wa; nb = wb; nc = wc; nd = wd;
+  Index_type s = 1;
+  for ( ; 2*s - 1 < N; s *= 2) {
+    for (Index_type i = 2*s - 1 + 2*s*threadIdx.x; i < N; i += 2*s*block_size) {
+      TRIDIAG_SOLVE_REDUCE_BODY;
+    }
+    __syncthreads();
+  }
+  for ( ; s >= 1; s /= 2) {
+    for (Index_type i = s - 1 + 2*s*threadIdx.x; i < N; i += 2*s*block_size) {
+      TRIDIAG_SOLVE_BACK_SUBST_BODY;
+    }
+    __syncthreads();
+  }
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    sx[i] = wx[i];
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void tridiag_solve_pcr(Real_ptr a, Real_ptr b, Real_ptr c,
+                                  Real_ptr d, Real_ptr x, Index_type N)
+{
+  extern __shared__ Real_type tridiag_shmem[];
+
+  const Index_type isys = blockIdx.x;
+  TRIDIAG_SOLVE_SYSTEM_SETUP;
+  TRIDIAG_SOLVE_WORK_SETUP(tridiag_shmem);
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    TRIDIAG_SOLVE_COPY_BODY;
+  }
+  __syncthreads();
+
+  for (Index_type s = 1; s < N; s *= 2) {
+    for (Index_type i = threadIdx.x; i < N; i += block_size) {
+      TRIDIAG_SOLVE_REDUCE_BODY;
+    }
+    __syncthreads();
+    TRIDIAG_SOLVE_SWAP_WORK;
+  }
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    TRIDIAG_SOLVE_DIAG_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void tridiag_solve_pcr_thomas(Real_ptr a, Real_ptr b, Real_ptr c,
+                                         Real_ptr d, Real_ptr x, Index_type N)
+{
+  extern __shared__ Real_type tridiag_shmem[];
+
+  const Index_type isys = blockIdx.x;
+  TRIDIAG_SOLVE_SYSTEM_SETUP;
+  TRIDIAG_SOLVE_WORK_SETUP(tridiag_shmem);
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    TRIDIAG_SOLVE_COPY_BODY;
+  }
+  __syncthreads();
+
+  const Index_type m = TRIDIAG_SOLVE_PCR_THOMAS_STRIDE;
+  for (Index_type s = 1; s < m; s *= 2) {
+    for (Index_type i = threadIdx.x; i < N; i += block_size) {
+      TRIDIAG_SOLVE_REDUCE_BODY;
+    }
+    __syncthreads();
+    TRIDIAG_SOLVE_SWAP_WORK;
+  }
+
+  Real_ptr cp = nc;
+  Real_ptr wx = sx;
+  for (Index_type r = threadIdx.x; r < m && r < N; r += block_size) {
+    TRIDIAG_SOLVE_THOMAS_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void TRIDIAG_SOLVE::runCudaVariantThomas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  TRIDIAG_SOLVE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_systems, block_size);
+      constexpr size_t shmem = 0;
+      tridiag_solve_thomas<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          a, b, c, d, x, work, N, num_systems );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  TRIDIAG_SOLVE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void TRIDIAG_SOLVE::runCudaVariantCR(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  TRIDIAG_SOLVE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t shmem = 8*N*sizeof(Real_type);
+      tridiag_solve_cr<block_size><<<num_systems, block_size, shmem, res.get_stream()>>>(
+          a, b, c, d, x, N );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(work);
+
+  } else {
+     getCout() << "\n  TRIDIAG_SOLVE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void TRIDIAG_SOLVE::runCudaVariantPCR(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  TRIDIAG_SOLVE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t shmem = 8*N*sizeof(Real_type);
+      tridiag_solve_pcr<block_size><<<num_systems, block_size, shmem, res.get_stream()>>>(
+          a, b, c, d, x, N );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(work);
+
+  } else {
+     getCout() << "\n  TRIDIAG_SOLVE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void TRIDIAG_SOLVE::runCudaVariantPCRThomas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  TRIDIAG_SOLVE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t shmem = 8*N*sizeof(Real_type);
+      tridiag_solve_pcr_thomas<block_size><<<num_systems, block_size, shmem, res.get_stream()>>>(
+          a, b, c, d, x, N );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(work);
+
+  } else {
+     getCout() << "\n  TRIDIAG_SOLVE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void TRIDIAG_SOLVE::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantThomas<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantCR<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantPCR<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantPCRThomas<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+}
+
+void TRIDIAG_SOLVE::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "thomas"+block_name);
+      addVariantTuningName(vid, "cyclic_reduction"+block_name);
+      addVariantTuningName(vid, "parallel_cyclic_reduction"+block_name);
+      addVariantTuningName(vid, "pcr_thomas"+block_name);
+
+    }
+
+  });
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
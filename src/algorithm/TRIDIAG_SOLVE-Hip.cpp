@@ -0,0 +1,314 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_SOLVE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void tridiag_solve_thomas(Real_ptr a, Real_ptr b, Real_ptr c,
+                                     Real_ptr d, Real_ptr x, Real_ptr work,
+                                     Index_type N, Index_type num_systems)
+{
+  Index_type isys = blockIdx.x * block_size + threadIdx.x;
+  if (isys < num_systems) {
+    TRIDIAG_SOLVE_THOMAS_SYSTEM_BODY;
+  }
+}
+
+//
+// The reduction kernels solve system blockIdx.x with the coefficients in
+// 8*N values of dynamic shared memory.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void tridiag_solve_cr(Real_ptr a, Real_ptr b, Real_ptr c,
+                                 Real_ptr d, Real_ptr x, Index_type N)
+{
+  HIP_DYNAMIC_SHARED(Real_type, tridiag_shmem);
+
+  const Index_type isys = blockIdx.x;
+  TRIDIAG_SOLVE_SYSTEM_SETUP;
+  TRIDIAG_SOLVE_WORK_SETUP(tridiag_shmem);
+  Real_ptr wx = na;
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    TRIDIAG_SOLVE_COPY_BODY;
+  }
+  __syncthreads();
+
+  na = wa; nb = wb; nc = wc; nd = wd;
+  Index_type s = 1;
+  for ( ; 2*s - 1 < N; s *= 2) {
+    for (Index_type i = 2*s - 1 + 2*s*threadIdx.x; i < N; i += 2*s*block_size) {
+      TRIDIAG_SOLVE_REDUCE_BODY;
+    }
+    __syncthreads();
+  }
+  for ( ; s >= 1; s /= 2) {
+    for (Index_type i = s - 1 + 2*s*threadIdx.x; i < N; i += 2*s*block_size) {
+      TRIDIAG_SOLVE_BACK_SUBST_BODY;
+    }
+    __syncthreads();
+  }
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    sx[i] = wx[i];
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void tridiag_solve_pcr(Real_ptr a, Real_ptr b, Real_ptr c,
+                                  Real_ptr d, Real_ptr x, Index_type N)
+{
+  HIP_DYNAMIC_SHARED(Real_type, tridiag_shmem);
+
+  const Index_type isys = blockIdx.x;
+  TRIDIAG_SOLVE_SYSTEM_SETUP;
+  TRIDIAG_SOLVE_WORK_SETUP(tridiag_shmem);
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    TRIDIAG_SOLVE_COPY_BODY;
+  }
+  __syncthreads();
+
+  for (Index_type s = 1; s < N; s *= 2) {
+    for (Index_type i = threadIdx.x; i < N; i += block_size) {
+      TRIDIAG_SOLVE_REDUCE_BODY;
+    }
+    __syncthreads();
+    TRIDIAG_SOLVE_SWAP_WORK;
+  }
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    TRIDIAG_SOLVE_DIAG_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void tridiag_solve_pcr_thomas(Real_ptr a, Real_ptr b, Real_ptr c,
+                                         Real_ptr d, Real_ptr x, Index_type N)
+{
+  HIP_DYNAMIC_SHARED(Real_type, tridiag_shmem);
+
+  const Index_type isys = blockIdx.x;
+  TRIDIAG_SOLVE_SYSTEM_SETUP;
+  TRIDIAG_SOLVE_WORK_SETUP(tridiag_shmem);
+
+  for (Index_type i = threadIdx.x; i < N; i += block_size) {
+    TRIDIAG_SOLVE_COPY_BODY;
+  }
+  __syncthreads();
+
+  const Index_type m = TRIDIAG_SOLVE_PCR_THOMAS_STRIDE;
+  for (Index_type s = 1; s < m; s *= 2) {
+    for (Index_type i = threadIdx.x; i < N; i += block_size) {
+      TRIDIAG_SOLVE_REDUCE_BODY;
+    }
+    __syncthreads();
+    TRIDIAG_SOLVE_SWAP_WORK;
+  }
+
+  Real_ptr cp = nc;
+  Real_ptr wx = sx;
+  for (Index_type r = threadIdx.x; r < m && r < N; r += block_size) {
+    TRIDIAG_SOLVE_THOMAS_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void TRIDIAG_SOLVE::runHipVariantThomas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  TRIDIAG_SOLVE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_systems, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((tridiag_solve_thomas<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+          a, b, c, d, x, work, N, num_systems );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  TRIDIAG_SOLVE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void TRIDIAG_SOLVE::runHipVariantCR(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  TRIDIAG_SOLVE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t shmem = 8*N*sizeof(Real_type);
+      hipLaunchKernelGGL((tridiag_solve_cr<block_size>), dim3(num_systems), dim3(block_size), shmem, res.get_stream(),
+          a, b, c, d, x, N );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(work);
+
+  } else {
+     getCout() << "\n  TRIDIAG_SOLVE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void TRIDIAG_SOLVE::runHipVariantPCR(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  TRIDIAG_SOLVE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t shmem = 8*N*sizeof(Real_type);
+      hipLaunchKernelGGL((tridiag_solve_pcr<block_size>), dim3(num_systems), dim3(block_size), shmem, res.get_stream(),
+          a, b, c, d, x, N );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(work);
+
+  } else {
+     getCout() << "\n  TRIDIAG_SOLVE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void TRIDIAG_SOLVE::runHipVariantPCRThomas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  TRIDIAG_SOLVE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t shmem = 8*N*sizeof(Real_type);
+      hipLaunchKernelGGL((tridiag_solve_pcr_thomas<block_size>), dim3(num_systems), dim3(block_size), shmem, res.get_stream(),
+          a, b, c, d, x, N );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    RAJA_UNUSED_VAR(work);
+
+  } else {
+     getCout() << "\n  TRIDIAG_SOLVE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void TRIDIAG_SOLVE::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantThomas<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantCR<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantPCR<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantPCRThomas<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+}
+
+void TRIDIAG_SOLVE::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "thomas"+block_name);
+      addVariantTuningName(vid, "cyclic_reduction"+block_name);
+      addVariantTuningName(vid, "parallel_cyclic_reduction"+block_name);
+      addVariantTuningName(vid, "pcr_thomas"+block_name);
+
+    }
+
+  });
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,84 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_SOLVE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void TRIDIAG_SOLVE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRIDIAG_SOLVE_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    const Algorithm algorithm = getAlgorithm(vid, tune_idx);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      switch ( algorithm ) {
+
+        case Algorithm::Thomas : {
+          for (Index_type isys = 0; isys < num_systems; ++isys) {
+            TRIDIAG_SOLVE_THOMAS_SYSTEM_BODY;
+          }
+          break;
+        }
+
+        case Algorithm::CR : {
+          for (Index_type isys = 0; isys < num_systems; ++isys) {
+            TRIDIAG_SOLVE_CR_SYSTEM_BODY;
+          }
+          break;
+        }
+
+        case Algorithm::PCR : {
+          for (Index_type isys = 0; isys < num_systems; ++isys) {
+            TRIDIAG_SOLVE_PCR_SYSTEM_BODY;
+          }
+          break;
+        }
+
+        case Algorithm::PCRThomas : {
+          for (Index_type isys = 0; isys < num_systems; ++isys) {
+            TRIDIAG_SOLVE_PCR_THOMAS_SYSTEM_BODY;
+          }
+          break;
+        }
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  TRIDIAG_SOLVE : Unknown variant id = " << vid << std::endl;
+  }
+
+}
+
+void TRIDIAG_SOLVE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "thomas");
+  addVariantTuningName(vid, "cyclic_reduction");
+  addVariantTuningName(vid, "parallel_cyclic_reduction");
+  addVariantTuningName(vid, "pcr_thomas");
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
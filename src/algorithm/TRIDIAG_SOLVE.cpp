@@ -0,0 +1,180 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_SOLVE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+TRIDIAG_SOLVE::TRIDIAG_SOLVE(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_TRIDIAG_SOLVE, params)
+{
+  setDefaultProblemSize(1024*1024);
+  setDefaultReps(50);
+
+  m_N = getKernelParam("N", 256, 1, TRIDIAG_SOLVE_MAX_N);
+  m_num_systems = std::max(getTargetProblemSize() / m_N, Index_type(1));
+
+  setActualProblemSize( m_num_systems * m_N );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // one read of a, b, c, d and one write of x, the traffic of the work
+  // space depends on the tuning and is not counted
+  setBytesPerRep( (1*sizeof(Real_type) + 4*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep( getFLOPsPerRep(Base_Seq, 0) );
+
+  checksum_scale_factor = 1e-3 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+TRIDIAG_SOLVE::~TRIDIAG_SOLVE()
+{
+}
+
+TRIDIAG_SOLVE::Algorithm TRIDIAG_SOLVE::getAlgorithm(VariantID vid,
+                                                     size_t tune_idx) const
+{
+  const std::string& name = getVariantTuningName(vid, tune_idx);
+  if (name.compare(0, 10, "pcr_thomas") == 0) {
+    return Algorithm::PCRThomas;
+  } else if (name.compare(0, 8, "parallel") == 0) {
+    return Algorithm::PCR;
+  } else if (name.compare(0, 6, "cyclic") == 0) {
+    return Algorithm::CR;
+  }
+  return Algorithm::Thomas;
+}
+
+//
+// Reduction steps are counted as 12 FLOPs for every equation they update,
+// the equations near the ends of a system take fewer. Tunings before
+// setting up the kernel tunings, ie. in the constructor, are counted as
+// the Thomas algorithm.
+//
+Index_type TRIDIAG_SOLVE::getFLOPsPerRep(VariantID vid, size_t tune_idx) const
+{
+  const Index_type N = m_N;
+
+  const Algorithm algorithm = (tune_idx < getNumVariantTunings(vid))
+                            ? getAlgorithm(vid, tune_idx) : Algorithm::Thomas;
+
+  const Index_type thomas_flops = 9*N - 6;
+
+  Index_type flops = 0;
+  switch (algorithm) {
+
+    case Algorithm::Thomas :
+      flops = thomas_flops;
+      break;
+
+    case Algorithm::CR : {
+      Index_type s = 1;
+      for ( ; 2*s - 1 < N; s *= 2) {
+        flops += 12 * (N / (2*s));
+      }
+      flops += 5*N;
+      break;
+    }
+
+    case Algorithm::PCR : {
+      for (Index_type s = 1; s < N; s *= 2) {
+        flops += 12*N;
+      }
+      flops += N;
+      break;
+    }
+
+    case Algorithm::PCRThomas : {
+      for (Index_type s = 1; s < TRIDIAG_SOLVE_PCR_THOMAS_STRIDE; s *= 2) {
+        flops += 12*N;
+      }
+      flops += thomas_flops;
+      break;
+    }
+  }
+
+  return m_num_systems * flops;
+}
+
+void TRIDIAG_SOLVE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = m_num_systems * m_N;
+
+  //
+  // Off diagonal entries are in (-1, -0.5] and diagonal entries are in
+  // [2.5, 3), so every system is diagonally dominant by rows.
+  //
+  constexpr unsigned long long a_seed = 6113;
+  constexpr unsigned long long b_seed = 6121;
+  constexpr unsigned long long c_seed = 6131;
+  constexpr unsigned long long d_seed = 6133;
+
+  allocData(m_a, len, vid);
+  allocData(m_b, len, vid);
+  allocData(m_c, len, vid);
+  allocData(m_d, len, vid);
+  {
+    auto reset_a = scopedMoveData(m_a, len, vid);
+    auto reset_b = scopedMoveData(m_b, len, vid);
+    auto reset_c = scopedMoveData(m_c, len, vid);
+    auto reset_d = scopedMoveData(m_d, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      const Index_type j = i % m_N;
+      m_a[i] = (j == 0)
+             ? 0.0 : -0.5 - 0.5 * detail::counterRandValue(a_seed, i);
+      m_b[i] = 2.5 + 0.5 * detail::counterRandValue(b_seed, i);
+      m_c[i] = (j == m_N-1)
+             ? 0.0 : -0.5 - 0.5 * detail::counterRandValue(c_seed, i);
+      m_d[i] = 2.0 * detail::counterRandValue(d_seed, i) - 1.0;
+    }
+  }
+
+  allocAndInitDataConst(m_x, len, 0.0, vid);
+  allocAndInitDataConst(m_work, 8*len, 0.0, vid);
+}
+
+void TRIDIAG_SOLVE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_x, m_num_systems * m_N, checksum_scale_factor, vid);
+}
+
+void TRIDIAG_SOLVE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_a, vid);
+  deallocData(m_b, vid);
+  deallocData(m_c, vid);
+  deallocData(m_d, vid);
+  deallocData(m_x, vid);
+  deallocData(m_work, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
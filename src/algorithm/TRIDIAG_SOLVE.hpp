@@ -0,0 +1,305 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TRIDIAG_SOLVE kernel reference implementation:
+///
+/// // solve each of num_systems tridiagonal systems of N equations
+/// //   a[i]*x[i-1] + b[i]*x[i] + c[i]*x[i+1] = d[i]
+/// // for i in [isys*N, isys*N + N) with the Thomas algorithm, a of the
+/// // first and c of the last equation of each system are zero
+/// for (Index_type isys = 0; isys < num_systems; ++isys) {
+///   Index_type ibase = isys*N;
+///   cp[ibase] = c[ibase] / b[ibase];
+///   x[ibase] = d[ibase] / b[ibase];
+///   for (Index_type i = ibase+1; i < ibase+N; ++i) {
+///     Real_type inv = 1.0 / (b[i] - a[i]*cp[i-1]);
+///     cp[i] = c[i] * inv;
+///     x[i] = (d[i] - a[i]*x[i-1]) * inv;
+///   }
+///   for (Index_type i = ibase+N-2; i >= ibase; --i) {
+///     x[i] -= cp[i]*x[i+1];
+///   }
+/// }
+///
+/// N is given by the kernel parameter "N" and the problem size sets
+/// num_systems. The systems are diagonally dominant so none of the
+/// tunings pivot. Tunings solve each system with the Thomas algorithm
+/// (thomas), cyclic reduction (cyclic_reduction), parallel cyclic
+/// reduction (parallel_cyclic_reduction), or parallel cyclic reduction
+/// into TRIDIAG_SOLVE_PCR_THOMAS_STRIDE interleaved systems that are each
+/// solved with the Thomas algorithm (pcr_thomas). GPU thomas tunings solve
+/// a system with each thread, the others with each thread block.
+///
+
+#ifndef RAJAPerf_Algorithm_TRIDIAG_SOLVE_HPP
+#define RAJAPerf_Algorithm_TRIDIAG_SOLVE_HPP
+
+#define TRIDIAG_SOLVE_MAX_N (512)
+
+#define TRIDIAG_SOLVE_PCR_THOMAS_STRIDE (32)
+
+#define TRIDIAG_SOLVE_DATA_SETUP \
+  Real_ptr a = m_a; \
+  Real_ptr b = m_b; \
+  Real_ptr c = m_c; \
+  Real_ptr d = m_d; \
+  Real_ptr x = m_x; \
+  Real_ptr work = m_work; \
+  const Index_type N = m_N; \
+  const Index_type num_systems = m_num_systems;
+
+// pointers to the equations of system isys
+#define TRIDIAG_SOLVE_SYSTEM_SETUP \
+  const Index_type ibase = isys*N; \
+  Real_ptr sa = a + ibase; \
+  Real_ptr sb = b + ibase; \
+  Real_ptr sc = c + ibase; \
+  Real_ptr sd = d + ibase; \
+  Real_ptr sx = x + ibase;
+
+//
+// Work space of the reduction algorithms of 8*N values, that holds two
+// copies of the coefficients, wa, wb, wc, wd and na, nb, nc, nd.
+//
+#define TRIDIAG_SOLVE_WORK_SETUP(work_ptr) \
+  Real_ptr wa = work_ptr; \
+  Real_ptr wb = wa + N; \
+  Real_ptr wc = wb + N; \
+  Real_ptr wd = wc + N; \
+  Real_ptr na = wd + N; \
+  Real_ptr nb = na + N; \
+  Real_ptr nc = nb + N; \
+  Real_ptr nd = nc + N;
+
+#define TRIDIAG_SOLVE_SWAP_WORK \
+  { Real_ptr tmp = wa; wa = na; na = tmp; } \
+  { Real_ptr tmp = wb; wb = nb; nb = tmp; } \
+  { Real_ptr tmp = wc; wc = nc; nc = tmp; } \
+  { Real_ptr tmp = wd; wd = nd; nd = tmp; }
+
+#define TRIDIAG_SOLVE_COPY_BODY \
+  wa[i] = sa[i]; \
+  wb[i] = sb[i]; \
+  wc[i] = sc[i]; \
+  wd[i] = sd[i];
+
+//
+// Eliminate x[i-s] and x[i+s] from equation i of wa, wb, wc, wd and store
+// the equation coupling x[i-2s], x[i], and x[i+2s] in na, nb, nc, nd.
+// Cyclic reduction updates in place, the equations i-s and i+s it reads
+// are not updated in the same step.
+//
+#define TRIDIAG_SOLVE_REDUCE_BODY \
+  Real_type ai = 0.0; \
+  Real_type bi = wb[i]; \
+  Real_type ci = 0.0; \
+  Real_type di = wd[i]; \
+  if (i - s >= 0) { \
+    const Real_type k1 = wa[i] / wb[i-s]; \
+    ai = -wa[i-s] * k1; \
+    bi -= wc[i-s] * k1; \
+    di -= wd[i-s] * k1; \
+  } \
+  if (i + s < N) { \
+    const Real_type k2 = wc[i] / wb[i+s]; \
+    ci = -wc[i+s] * k2; \
+    bi -= wa[i+s] * k2; \
+    di -= wd[i+s] * k2; \
+  } \
+  na[i] = ai; \
+  nb[i] = bi; \
+  nc[i] = ci; \
+  nd[i] = di;
+
+// x[i] of equation i coupling x[i-s] and x[i+s], given those solutions
+#define TRIDIAG_SOLVE_BACK_SUBST_BODY \
+  Real_type xi = wd[i]; \
+  if (i - s >= 0) { \
+    xi -= wa[i] * wx[i-s]; \
+  } \
+  if (i + s < N) { \
+    xi -= wc[i] * wx[i+s]; \
+  } \
+  wx[i] = xi / wb[i];
+
+#define TRIDIAG_SOLVE_DIAG_BODY \
+  sx[i] = wd[i] / wb[i];
+
+//
+// Thomas algorithm for the equations r, r+m, r+2m, ... less than N of wa,
+// wb, wc, wd that only couple to each other, with cp as scratch space.
+//
+#define TRIDIAG_SOLVE_THOMAS_BODY \
+  { \
+    const Real_type inv = 1.0 / wb[r]; \
+    cp[r] = wc[r] * inv; \
+    wx[r] = wd[r] * inv; \
+  } \
+  Index_type ilast = r; \
+  for (Index_type i = r + m; i < N; i += m) { \
+    const Real_type inv = 1.0 / (wb[i] - wa[i] * cp[i-m]); \
+    cp[i] = wc[i] * inv; \
+    wx[i] = (wd[i] - wa[i] * wx[i-m]) * inv; \
+    ilast = i; \
+  } \
+  for (Index_type i = ilast - m; i >= r; i -= m) { \
+    wx[i] -= cp[i] * wx[i+m]; \
+  }
+
+//
+// Whole system solves of one CPU thread, the GPU kernels do the loops
+// over equations with the threads of a block.
+//
+#define TRIDIAG_SOLVE_THOMAS_SYSTEM_BODY \
+  TRIDIAG_SOLVE_SYSTEM_SETUP; \
+  Real_ptr wa = sa; \
+  Real_ptr wb = sb; \
+  Real_ptr wc = sc; \
+  Real_ptr wd = sd; \
+  Real_ptr wx = sx; \
+  Real_ptr cp = work + ibase; \
+  const Index_type r = 0; \
+  const Index_type m = 1; \
+  TRIDIAG_SOLVE_THOMAS_BODY;
+
+#define TRIDIAG_SOLVE_CR_SYSTEM_BODY \
+  TRIDIAG_SOLVE_SYSTEM_SETUP; \
+  TRIDIAG_SOLVE_WORK_SETUP(work + 8*ibase); \
+  Real_ptr wx = sx; \
+  for (Index_type i = 0; i < N; ++i) { \
+    TRIDIAG_SOLVE_COPY_BODY; \
+  } \
+  na = wa; nb = wb; nc = wc; nd = wd; \
+  Index_type s = 1; \
+  for ( ; 2*s - 1 < N; s *= 2) { \
+    for (Index_type i = 2*s - 1; i < N; i += 2*s) { \
+      TRIDIAG_SOLVE_REDUCE_BODY; \
+    } \
+  } \
+  for ( ; s >= 1; s /= 2) { \
+    for (Index_type i = s - 1; i < N; i += 2*s) { \
+      TRIDIAG_SOLVE_BACK_SUBST_BODY; \
+    } \
+  }
+
+#define TRIDIAG_SOLVE_PCR_SYSTEM_BODY \
+  TRIDIAG_SOLVE_SYSTEM_SETUP; \
+  TRIDIAG_SOLVE_WORK_SETUP(work + 8*ibase); \
+  for (Index_type i = 0; i < N; ++i) { \
+    TRIDIAG_SOLVE_COPY_BODY; \
+  } \
+  for (Index_type s = 1; s < N; s *= 2) { \
+    for (Index_type i = 0; i < N; ++i) { \
+      TRIDIAG_SOLVE_REDUCE_BODY; \
+    } \
+    TRIDIAG_SOLVE_SWAP_WORK; \
+  } \
+  for (Index_type i = 0; i < N; ++i) { \
+    TRIDIAG_SOLVE_DIAG_BODY; \
+  }
+
+#define TRIDIAG_SOLVE_PCR_THOMAS_SYSTEM_BODY \
+  TRIDIAG_SOLVE_SYSTEM_SETUP; \
+  TRIDIAG_SOLVE_WORK_SETUP(work + 8*ibase); \
+  for (Index_type i = 0; i < N; ++i) { \
+    TRIDIAG_SOLVE_COPY_BODY; \
+  } \
+  const Index_type m = TRIDIAG_SOLVE_PCR_THOMAS_STRIDE; \
+  for (Index_type s = 1; s < m; s *= 2) { \
+    for (Index_type i = 0; i < N; ++i) { \
+      TRIDIAG_SOLVE_REDUCE_BODY; \
+    } \
+    TRIDIAG_SOLVE_SWAP_WORK; \
+  } \
+  Real_ptr cp = nc; \
+  Real_ptr wx = sx; \
+  for (Index_type r = 0; r < m && r < N; ++r) { \
+    TRIDIAG_SOLVE_THOMAS_BODY; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class TRIDIAG_SOLVE : public KernelBase
+{
+public:
+
+  TRIDIAG_SOLVE(const RunParams& params);
+
+  ~TRIDIAG_SOLVE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getFLOPsPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_SOLVE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  template < size_t block_size >
+  void runCudaVariantThomas(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantCR(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantPCR(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantPCRThomas(VariantID vid);
+
+  template < size_t block_size >
+  void runHipVariantThomas(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantCR(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantPCR(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantPCRThomas(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  enum struct Algorithm { Thomas, CR, PCR, PCRThomas };
+
+  // algorithm of tuning, given by the start of the tuning name
+  Algorithm getAlgorithm(VariantID vid, size_t tune_idx) const;
+
+  Index_type m_N;
+  Index_type m_num_systems;
+
+  Real_ptr m_a;
+  Real_ptr m_b;
+  Real_ptr m_c;
+  Real_ptr m_d;
+  Real_ptr m_x;
+  Real_ptr m_work;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ENERGY.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace apps {
+
+void ENERGY::runKokkosVariant(VariantID vid,
+                              size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ENERGY_DATA_SETUP;
+
+  auto e_new_view = getViewFromPointer(e_new, iend);
+  auto e_old_view = getViewFromPointer(e_old, iend);
+  auto delvc_view = getViewFromPointer(delvc, iend);
+  auto p_new_view = getViewFromPointer(p_new, iend);
+  auto p_old_view = getViewFromPointer(p_old, iend);
+  auto q_new_view = getViewFromPointer(q_new, iend);
+  auto q_old_view = getViewFromPointer(q_old, iend);
+  auto work_view = getViewFromPointer(work, iend);
+  auto compHalfStep_view = getViewFromPointer(compHalfStep, iend);
+  auto pHalfStep_view = getViewFromPointer(pHalfStep, iend);
+  auto bvc_view = getViewFromPointer(bvc, iend);
+  auto pbvc_view = getViewFromPointer(pbvc, iend);
+  auto ql_old_view = getViewFromPointer(ql_old, iend);
+  auto qq_old_view = getViewFromPointer(qq_old, iend);
+  auto vnewc_view = getViewFromPointer(vnewc, iend);
+
+  // Point the kernel data at the contiguous View allocations so the
+  // ENERGY bodies can be used unchanged in the Kokkos lambdas
+  e_new = e_new_view.data();
+  e_old = e_old_view.data();
+  delvc = delvc_view.data();
+  p_new = p_new_view.data();
+  p_old = p_old_view.data();
+  q_new = q_new_view.data();
+  q_old = q_old_view.data();
+  work = work_view.data();
+  compHalfStep = compHalfStep_view.data();
+  pHalfStep = pHalfStep_view.data();
+  bvc = bvc_view.data();
+  pbvc = pbvc_view.data();
+  ql_old = ql_old_view.data();
+  qq_old = qq_old_view.data();
+  vnewc = vnewc_view.data();
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "ENERGY_Kokkos Kokkos_Lambda--BODY1",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            ENERGY_BODY1;
+          });
+
+      Kokkos::parallel_for(
+          "ENERGY_Kokkos Kokkos_Lambda--BODY2",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            ENERGY_BODY2;
+          });
+
+      Kokkos::parallel_for(
+          "ENERGY_Kokkos Kokkos_Lambda--BODY3",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            ENERGY_BODY3;
+          });
+
+      Kokkos::parallel_for(
+          "ENERGY_Kokkos Kokkos_Lambda--BODY4",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            ENERGY_BODY4;
+          });
+
+      Kokkos::parallel_for(
+          "ENERGY_Kokkos Kokkos_Lambda--BODY5",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            ENERGY_BODY5;
+          });
+
+      Kokkos::parallel_for(
+          "ENERGY_Kokkos Kokkos_Lambda--BODY6",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            ENERGY_BODY6;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  ENERGY : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(m_e_new, e_new_view, iend);
+  moveDataToHostFromKokkosView(m_q_new, q_new_view, iend);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,185 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MASS3DPA.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace apps {
+
+template < Index_type D1D, Index_type Q1D >
+void MASS3DPA::runKokkosVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  MASS3DPA_DATA_SETUP;
+
+  const Index_type B_len = Q1D * D1D;
+  const Index_type D_len = Q1D * Q1D * Q1D * NE;
+  const Index_type X_len = D1D * D1D * D1D * NE;
+
+  auto B_view = getViewFromPointer(B, B_len);
+  auto Bt_view = getViewFromPointer(Bt, B_len);
+  auto D_view = getViewFromPointer(D, D_len);
+  auto X_view = getViewFromPointer(X, X_len);
+  auto Y_view = getViewFromPointer(Y, X_len);
+
+  // Point the kernel data at the contiguous View allocations so the
+  // MASS3DPA bodies and accessor macros can be used unchanged
+  B = B_view.data();
+  Bt = Bt_view.data();
+  D = D_view.data();
+  X = X_view.data();
+  Y = Y_view.data();
+
+  using team_policy = Kokkos::TeamPolicy<Kokkos::DefaultExecutionSpace>;
+  using member_type = team_policy::member_type;
+  using scratch_view =
+      Kokkos::View<double *,
+                   Kokkos::DefaultExecutionSpace::scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  // Team scratch holds the shared memory arrays of MASS3DPA_0_GPU
+  constexpr Index_type max_dq = (Q1D > D1D) ? Q1D : D1D;
+  const size_t scratch_bytes =
+      scratch_view::shmem_size(Q1D * D1D) +
+      2 * scratch_view::shmem_size(max_dq * max_dq * max_dq);
+
+  // One thread per element on host execution spaces, Q1D x Q1D threads
+  // per element, as in the GPU variants, otherwise
+  const int team_size =
+      Kokkos::SpaceAccessibility<Kokkos::DefaultExecutionSpace,
+                                 Kokkos::HostSpace>::accessible
+          ? 1 : static_cast<int>(Q1D * Q1D);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "MASS3DPA_Kokkos Kokkos_Lambda",
+          team_policy(NE, team_size)
+              .set_scratch_size(0, Kokkos::PerTeam(scratch_bytes)),
+          KOKKOS_LAMBDA(const member_type &team) {
+
+            const int e = team.league_rank();
+
+            constexpr int MQ1 = Q1D;
+            constexpr int MD1 = D1D;
+            constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
+            scratch_view sDQ_view(team.team_scratch(0), MQ1 * MD1);
+            scratch_view sm0_view(team.team_scratch(0), MDQ * MDQ * MDQ);
+            scratch_view sm1_view(team.team_scratch(0), MDQ * MDQ * MDQ);
+            double *sDQ = sDQ_view.data();
+            double *sm0 = sm0_view.data();
+            double *sm1 = sm1_view.data();
+            double(*Bsmem)[MD1] = (double(*)[MD1])sDQ;
+            double(*Btsmem)[MQ1] = (double(*)[MQ1])sDQ;
+            double(*Xsmem)[MD1][MD1] = (double(*)[MD1][MD1])sm0;
+            double(*DDQ)[MD1][MQ1] = (double(*)[MD1][MQ1])sm1;
+            double(*DQQ)[MQ1][MQ1] = (double(*)[MQ1][MQ1])sm0;
+            double(*QQQ)[MQ1][MQ1] = (double(*)[MQ1][MQ1])sm1;
+            double(*QQD)[MQ1][MD1] = (double(*)[MQ1][MD1])sm0;
+            double(*QDD)[MD1][MD1] = (double(*)[MD1][MD1])sm1;
+
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, D1D * D1D), [&](int t) {
+                  const int dy = t / D1D;
+                  const int dx = t % D1D;
+                  MASS3DPA_1
+                });
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, D1D * Q1D), [&](int t) {
+                  const int dy = t / Q1D;
+                  const int dx = t % Q1D;
+                  MASS3DPA_2
+                });
+            team.team_barrier();
+
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, D1D * Q1D), [&](int t) {
+                  const int dy = t / Q1D;
+                  const int qx = t % Q1D;
+                  MASS3DPA_3
+                });
+            team.team_barrier();
+
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, Q1D * Q1D), [&](int t) {
+                  const int qy = t / Q1D;
+                  const int qx = t % Q1D;
+                  MASS3DPA_4
+                });
+            team.team_barrier();
+
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, Q1D * Q1D), [&](int t) {
+                  const int qy = t / Q1D;
+                  const int qx = t % Q1D;
+                  MASS3DPA_5
+                });
+            team.team_barrier();
+
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, D1D * Q1D), [&](int t) {
+                  const int d = t / Q1D;
+                  const int q = t % Q1D;
+                  MASS3DPA_6
+                });
+            team.team_barrier();
+
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, Q1D * D1D), [&](int t) {
+                  const int qy = t / D1D;
+                  const int dx = t % D1D;
+                  MASS3DPA_7
+                });
+            team.team_barrier();
+
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, D1D * D1D), [&](int t) {
+                  const int dy = t / D1D;
+                  const int dx = t % D1D;
+                  MASS3DPA_8
+                });
+            team.team_barrier();
+
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, D1D * D1D), [&](int t) {
+                  const int dy = t / D1D;
+                  const int dx = t % D1D;
+                  MASS3DPA_9
+                });
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  MASS3DPA : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(m_Y, Y_view, X_len);
+}
+
+RAJAPERF_FEM_ORDER_RUN_BOILERPLATE(MASS3DPA, Kokkos)
+
+} // end namespace apps
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PRESSURE.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace apps {
+
+void PRESSURE::runKokkosVariant(VariantID vid,
+                                size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PRESSURE_DATA_SETUP;
+
+  auto compression_view = getViewFromPointer(compression, iend);
+  auto bvc_view = getViewFromPointer(bvc, iend);
+  auto p_new_view = getViewFromPointer(p_new, iend);
+  auto e_old_view = getViewFromPointer(e_old, iend);
+  auto vnewc_view = getViewFromPointer(vnewc, iend);
+
+  // Point the kernel data at the contiguous View allocations so the
+  // PRESSURE bodies can be used unchanged in the Kokkos lambdas
+  compression = compression_view.data();
+  bvc = bvc_view.data();
+  p_new = p_new_view.data();
+  e_old = e_old_view.data();
+  vnewc = vnewc_view.data();
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "PRESSURE_Kokkos Kokkos_Lambda--BODY1",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            PRESSURE_BODY1;
+          });
+
+      Kokkos::parallel_for(
+          "PRESSURE_Kokkos Kokkos_Lambda--BODY2",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            PRESSURE_BODY2;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  PRESSURE : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(m_bvc, bvc_view, iend);
+  moveDataToHostFromKokkosView(m_p_new, p_new_view, iend);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,330 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "AMR_PATCHES.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void amr_patches_patch(Real_ptr out, Real_ptr in,
+                                  Index_type offset,
+                                  Index_type nx, Index_type ny,
+                                  Index_type jp, Index_type kp,
+                                  Real_type c0, Real_type c1,
+                                  Index_type len)
+{
+  Index_type c = blockIdx.x * block_size + threadIdx.x;
+  if (c < len) {
+    AMR_PATCHES_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void amr_patches_fused(Real_ptr out, Real_ptr in,
+                                  Index_type* patch_offsets,
+                                  Index_type* patch_dims,
+                                  Index_type* patch_cells,
+                                  Index_type num_patches,
+                                  Real_type c0, Real_type c1)
+{
+  for (Index_type p = blockIdx.y; p < num_patches; p += gridDim.y) {
+    AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+    const Index_type len = patch_cells[p+1] - patch_cells[p];
+    for (Index_type c = blockIdx.x * block_size + threadIdx.x;
+         c < len;
+         c += block_size * gridDim.x) {
+      AMR_PATCHES_BODY;
+    }
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void amr_patches_flat(Real_ptr out, Real_ptr in,
+                                 Index_type* patch_offsets,
+                                 Index_type* patch_dims,
+                                 Index_type* patch_cells,
+                                 Index_type num_patches,
+                                 Real_type c0, Real_type c1,
+                                 Index_type num_cells)
+{
+  Index_type g = blockIdx.x * block_size + threadIdx.x;
+  if (g < num_cells) {
+    AMR_PATCHES_FLAT_SETUP;
+    AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+    AMR_PATCHES_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void AMR_PATCHES::runHipVariantPatch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  AMR_PATCHES_DATA_SETUP;
+  AMR_PATCHES_HOST_DATA_SETUP;
+
+  RAJA_UNUSED_VAR(patch_offsets);
+  RAJA_UNUSED_VAR(patch_dims);
+  RAJA_UNUSED_VAR(patch_cells);
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type p = 0; p < num_patches; ++p) {
+        AMR_PATCHES_PATCH_SETUP(patch_offsets_host, patch_dims_host);
+        const Index_type len = patch_cells_host[p+1] - patch_cells_host[p];
+
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(len, block_size);
+        constexpr size_t shmem = 0;
+        hipLaunchKernelGGL((amr_patches_patch<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+            out, in, offset, nx, ny, jp, kp, c0, c1, len );
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type p = 0; p < num_patches; ++p) {
+        AMR_PATCHES_PATCH_SETUP(patch_offsets_host, patch_dims_host);
+        const Index_type len = patch_cells_host[p+1] - patch_cells_host[p];
+
+        RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+          RAJA::TypedRangeSegment<Index_type>(0, len),
+          [=] __device__ (Index_type c) {
+            AMR_PATCHES_BODY;
+        });
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  AMR_PATCHES : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void AMR_PATCHES::runHipVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  AMR_PATCHES_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    // a row of blocks per patch, enough blocks for the average patch
+    constexpr Index_type max_grid_y = 65535;
+    const Index_type avg_cells = RAJA_DIVIDE_CEILING_INT(
+        getActualProblemSize(), num_patches);
+    const dim3 nblocks(RAJA_DIVIDE_CEILING_INT(avg_cells, Index_type(block_size)),
+                       std::min(num_patches, max_grid_y));
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL((amr_patches_fused<block_size>), nblocks, dim3(block_size), shmem, res.get_stream(),
+          out, in, patch_offsets, patch_dims, patch_cells, num_patches, c0, c1 );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    AMR_PATCHES_HOST_DATA_SETUP;
+
+    RAJA_UNUSED_VAR(patch_offsets);
+    RAJA_UNUSED_VAR(patch_dims);
+    RAJA_UNUSED_VAR(patch_cells);
+
+    using AllocatorHolder = RAJAPoolAllocatorHolder<RAJA::hip::pinned_mempool_type>;
+    using Allocator = AllocatorHolder::Allocator<char>;
+
+    AllocatorHolder allocatorHolder;
+
+    using workgroup_policy = RAJA::WorkGroupPolicy <
+                                 RAJA::hip_work_async<block_size>,
+#if defined(RAJA_ENABLE_HIP_INDIRECT_FUNCTION_CALL)
+                                 RAJA::unordered_hip_loop_y_block_iter_x_threadblock_average,
+#else
+                                 RAJA::ordered,
+#endif
+                                 RAJA::constant_stride_array_of_objects >;
+
+    using workpool = RAJA::WorkPool< workgroup_policy,
+                                     Index_type,
+                                     RAJA::xargs<>,
+                                     Allocator >;
+
+    using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+    using worksite = RAJA::WorkSite< workgroup_policy,
+                                     Index_type,
+                                     RAJA::xargs<>,
+                                     Allocator >;
+
+    workpool pool(allocatorHolder.template getAllocator<char>());
+    pool.reserve(num_patches, 1024ull*1024ull);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type p = 0; p < num_patches; ++p) {
+        AMR_PATCHES_PATCH_SETUP(patch_offsets_host, patch_dims_host);
+        const Index_type len = patch_cells_host[p+1] - patch_cells_host[p];
+        auto amr_patches_base_lam = [=] __device__ (Index_type c) {
+              AMR_PATCHES_BODY;
+            };
+        pool.enqueue(
+            RAJA::TypedRangeSegment<Index_type>(0, len),
+            amr_patches_base_lam );
+      }
+      workgroup group = pool.instantiate();
+      worksite site = group.run(res);
+      res.wait();
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  AMR_PATCHES : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void AMR_PATCHES::runHipVariantFlat(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  AMR_PATCHES_DATA_SETUP;
+
+  const Index_type num_cells = getActualProblemSize();
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_cells, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((amr_patches_flat<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+          out, in, patch_offsets, patch_dims, patch_cells, num_patches,
+          c0, c1, num_cells );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+        RAJA::TypedRangeSegment<Index_type>(0, num_cells),
+        [=] __device__ (Index_type g) {
+          AMR_PATCHES_FLAT_SETUP;
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          AMR_PATCHES_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  AMR_PATCHES : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void AMR_PATCHES::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantPatch<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantFused<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantFlat<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+}
+
+void AMR_PATCHES::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "patch"+block_name);
+      addVariantTuningName(vid, "fused"+block_name);
+      addVariantTuningName(vid, "flat"+block_name);
+
+    }
+
+  });
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
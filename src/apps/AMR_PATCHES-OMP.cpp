@@ -0,0 +1,270 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "AMR_PATCHES.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void AMR_PATCHES::runOpenMPVariantPatch(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  AMR_PATCHES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < num_patches; ++p) {
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          const Index_type len = patch_cells[p+1] - patch_cells[p];
+          #pragma omp parallel for
+          for (Index_type c = 0; c < len; ++c) {
+            AMR_PATCHES_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < num_patches; ++p) {
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          const Index_type len = patch_cells[p+1] - patch_cells[p];
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::TypedRangeSegment<Index_type>(0, len),
+            [=](Index_type c) {
+              AMR_PATCHES_BODY;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  AMR_PATCHES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void AMR_PATCHES::runOpenMPVariantFused(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  AMR_PATCHES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        // one parallel region, the threads move on to the next patch
+        // without waiting as the patches write different cells
+        #pragma omp parallel
+        {
+          for (Index_type p = 0; p < num_patches; ++p) {
+            AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+            const Index_type len = patch_cells[p+1] - patch_cells[p];
+            #pragma omp for nowait
+            for (Index_type c = 0; c < len; ++c) {
+              AMR_PATCHES_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using AllocatorHolder = RAJAPoolAllocatorHolder<
+        RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>;
+      using Allocator = AllocatorHolder::Allocator<char>;
+
+      AllocatorHolder allocatorHolder;
+
+      using workgroup_policy = RAJA::WorkGroupPolicy <
+                                   RAJA::omp_work,
+                                   RAJA::ordered,
+                                   RAJA::constant_stride_array_of_objects >;
+
+      using workpool = RAJA::WorkPool< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                         Index_type,
+                                         RAJA::xargs<>,
+                                         Allocator >;
+
+      using worksite = RAJA::WorkSite< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      workpool pool(allocatorHolder.template getAllocator<char>());
+      pool.reserve(num_patches, 1024ull*1024ull);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < num_patches; ++p) {
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          const Index_type len = patch_cells[p+1] - patch_cells[p];
+          auto amr_patches_base_lam = [=](Index_type c) {
+                AMR_PATCHES_BODY;
+              };
+          pool.enqueue(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              amr_patches_base_lam );
+        }
+        workgroup group = pool.instantiate();
+        worksite site = group.run();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  AMR_PATCHES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void AMR_PATCHES::runOpenMPVariantFlat(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  AMR_PATCHES_DATA_SETUP;
+
+  const Index_type num_cells = getActualProblemSize();
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type g = 0; g < num_cells; ++g) {
+          AMR_PATCHES_FLAT_SETUP;
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          AMR_PATCHES_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::TypedRangeSegment<Index_type>(0, num_cells),
+          [=](Index_type g) {
+            AMR_PATCHES_FLAT_SETUP;
+            AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+            AMR_PATCHES_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  AMR_PATCHES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void AMR_PATCHES::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantPatch(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantFused(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantFlat(vid);
+  }
+  t += 1;
+}
+
+void AMR_PATCHES::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "patch");
+  addVariantTuningName(vid, "fused");
+  addVariantTuningName(vid, "flat");
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,255 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "AMR_PATCHES.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void AMR_PATCHES::runSeqVariantPatch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  AMR_PATCHES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < num_patches; ++p) {
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          const Index_type len = patch_cells[p+1] - patch_cells[p];
+          for (Index_type c = 0; c < len; ++c) {
+            AMR_PATCHES_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < num_patches; ++p) {
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          const Index_type len = patch_cells[p+1] - patch_cells[p];
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::TypedRangeSegment<Index_type>(0, len),
+            [=](Index_type c) {
+              AMR_PATCHES_BODY;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  AMR_PATCHES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void AMR_PATCHES::runSeqVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  AMR_PATCHES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      const Index_type num_cells = patch_cells[num_patches];
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        // one loop over the cells, moving to the next patch at its first cell
+        Index_type p = 0;
+        for (Index_type g = 0; g < num_cells; ++g) {
+          while (g >= patch_cells[p+1]) {
+            ++p;
+          }
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          const Index_type c = g - patch_cells[p];
+          AMR_PATCHES_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using AllocatorHolder = RAJAPoolAllocatorHolder<
+        RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>;
+      using Allocator = AllocatorHolder::Allocator<char>;
+
+      AllocatorHolder allocatorHolder;
+
+      using workgroup_policy = RAJA::WorkGroupPolicy <
+                                   RAJA::seq_work,
+                                   RAJA::ordered,
+                                   RAJA::constant_stride_array_of_objects >;
+
+      using workpool = RAJA::WorkPool< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                         Index_type,
+                                         RAJA::xargs<>,
+                                         Allocator >;
+
+      using worksite = RAJA::WorkSite< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      workpool pool(allocatorHolder.template getAllocator<char>());
+      pool.reserve(num_patches, 1024ull*1024ull);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < num_patches; ++p) {
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          const Index_type len = patch_cells[p+1] - patch_cells[p];
+          auto amr_patches_base_lam = [=](Index_type c) {
+                AMR_PATCHES_BODY;
+              };
+          pool.enqueue(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              amr_patches_base_lam );
+        }
+        workgroup group = pool.instantiate();
+        worksite site = group.run();
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  AMR_PATCHES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void AMR_PATCHES::runSeqVariantFlat(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  AMR_PATCHES_DATA_SETUP;
+
+  const Index_type num_cells = getActualProblemSize();
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type g = 0; g < num_cells; ++g) {
+          AMR_PATCHES_FLAT_SETUP;
+          AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+          AMR_PATCHES_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::TypedRangeSegment<Index_type>(0, num_cells),
+          [=](Index_type g) {
+            AMR_PATCHES_FLAT_SETUP;
+            AMR_PATCHES_PATCH_SETUP(patch_offsets, patch_dims);
+            AMR_PATCHES_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  AMR_PATCHES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void AMR_PATCHES::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantPatch(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantFused(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantFlat(vid);
+  }
+  t += 1;
+}
+
+void AMR_PATCHES::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "patch");
+  addVariantTuningName(vid, "fused");
+  addVariantTuningName(vid, "flat");
+}
+
+} // end namespace apps
+} // end namespace rajaperf
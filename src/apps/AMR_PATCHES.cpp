@@ -0,0 +1,164 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "AMR_PATCHES.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+AMR_PATCHES::AMR_PATCHES(const RunParams& params)
+  : KernelBase(rajaperf::Apps_AMR_PATCHES, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_min_patch = getKernelParam("min_patch", 4);
+  m_max_patch = getKernelParam("max_patch", 32);
+  m_max_patch = std::max(m_max_patch, m_min_patch);
+
+  m_c0 = 0.25;
+  m_c1 = 0.125;
+
+  //
+  // Draw patches until they have the target number of interior cells, the
+  // same patches for every variant and tuning.
+  //
+  constexpr unsigned long long dims_seed = 4289;
+
+  const Real_type edge_ratio = static_cast<Real_type>(m_max_patch + 1) /
+                               static_cast<Real_type>(m_min_patch);
+
+  m_patch_offsets_host.clear();
+  m_patch_dims_host.clear();
+  m_patch_cells_host.assign(1, 0);
+  m_var_size = 0;
+  for (Index_type p = 0;
+       m_patch_cells_host.back() < getTargetProblemSize(); ++p) {
+    Index_type dims[3];
+    for (Index_type d = 0; d < 3; ++d) {
+      const Real_type u = detail::counterRandValue(dims_seed, 3*p + d);
+      dims[d] = std::min(m_max_patch, static_cast<Index_type>(
+          m_min_patch * std::pow(edge_ratio, u)));
+      m_patch_dims_host.push_back(dims[d]);
+    }
+    m_patch_offsets_host.push_back(m_var_size);
+    m_patch_cells_host.push_back(m_patch_cells_host.back() +
+                                 dims[0] * dims[1] * dims[2]);
+    m_var_size += (dims[0]+2) * (dims[1]+2) * (dims[2]+2);
+  }
+  m_num_patches = static_cast<Index_type>(m_patch_offsets_host.size());
+
+  setActualProblemSize( m_patch_cells_host.back() );
+
+  Index_type num_face_cells = 0;
+  for (Index_type p = 0; p < m_num_patches; ++p) {
+    const Index_type nx = m_patch_dims_host[3*p];
+    const Index_type ny = m_patch_dims_host[3*p+1];
+    const Index_type nz = m_patch_dims_host[3*p+2];
+    num_face_cells += 2 * (nx*ny + ny*nz + nz*nx);
+  }
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // touched data size, not actual number of stores and loads, not counting
+  // the small patch arrays
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * num_face_cells );
+  setFLOPsPerRep(8 * getActualProblemSize());
+
+  setMetricNames({"patches", "launches", "Mcells_per_s"});
+
+  setUsesFeature(Forall);
+  setUsesFeature(Workgroup);
+
+  setHasPattern(Stencil);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+AMR_PATCHES::~AMR_PATCHES()
+{
+}
+
+//
+// The patch tunings launch each patch, the others all patches at once.
+//
+Index_type AMR_PATCHES::getLaunchesPerRep(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx < getNumVariantTunings(vid) &&
+      getVariantTuningName(vid, tune_idx).compare(0, 5, "patch") != 0) {
+    return 1;
+  }
+  return m_num_patches;
+}
+
+std::vector<double> AMR_PATCHES::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  const double rep_time = getMinTime(vid, tune_idx) / getRunReps();
+  return {static_cast<double>(m_num_patches),
+          static_cast<double>(getLaunchesPerRep(vid, tune_idx)),
+          (rep_time > 0.0) ? getActualProblemSize() / rep_time / 1.0e6 : 0.0};
+}
+
+void AMR_PATCHES::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocData(m_patch_offsets, m_num_patches, vid);
+  allocData(m_patch_dims, 3*m_num_patches, vid);
+  allocData(m_patch_cells, m_num_patches+1, vid);
+  {
+    auto reset_offsets = scopedMoveData(m_patch_offsets, m_num_patches, vid);
+    auto reset_dims = scopedMoveData(m_patch_dims, 3*m_num_patches, vid);
+    auto reset_cells = scopedMoveData(m_patch_cells, m_num_patches+1, vid);
+    std::copy(m_patch_offsets_host.begin(), m_patch_offsets_host.end(),
+              m_patch_offsets);
+    std::copy(m_patch_dims_host.begin(), m_patch_dims_host.end(),
+              m_patch_dims);
+    std::copy(m_patch_cells_host.begin(), m_patch_cells_host.end(),
+              m_patch_cells);
+  }
+
+  allocAndInitData(m_in, m_var_size, vid);
+  allocAndInitDataConst(m_out, m_var_size, Real_type(0.0), vid);
+}
+
+void AMR_PATCHES::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_out, m_var_size, vid);
+}
+
+void AMR_PATCHES::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_patch_offsets, vid);
+  deallocData(m_patch_dims, vid);
+  deallocData(m_patch_cells, vid);
+  deallocData(m_in, vid);
+  deallocData(m_out, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,205 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// AMR_PATCHES kernel reference implementation:
+///
+/// // explicit step of the heat equation on the interior cells of each
+/// // patch, patches have one layer of ghost cells on each side
+/// for (Index_type p = 0; p < num_patches; ++p) {
+///   const Index_type jp = nx[p] + 2;
+///   const Index_type kp = jp * (ny[p] + 2);
+///   for (Index_type c = 0; c < nx[p]*ny[p]*nz[p]; ++c) {
+///     // interior cell (i, j, k) of patch p, i fastest
+///     Index_type idx = offset[p] + (i+1) + (j+1)*jp + (k+1)*kp;
+///     out[idx] = c0*in[idx] + c1*(in[idx-1]  + in[idx+1] +
+///                                 in[idx-jp] + in[idx+jp] +
+///                                 in[idx-kp] + in[idx+kp]);
+///   }
+/// }
+///
+/// The patches mimic the boxes of a level of an AMR hierarchy, many small
+/// patches of different sizes. The edge of each patch in each direction is
+/// drawn from a log uniform distribution between the kernel parameters
+/// "min_patch" (4 by default) and "max_patch" (32 by default), so small
+/// patches are the most common, and patches are added until they have the
+/// target problem size of interior cells.
+///
+/// Tunings give how the patches are launched:
+///
+/// patch - one loop or GPU kernel per patch, as in a loop over the patches
+///         of a level
+/// fused - the patches in one launch, with RAJA::WorkGroup in the RAJA
+///         variants as in HALOEXCHANGE_FUSED and with a kernel that runs
+///         each patch in a row of blocks in the Base GPU variants
+/// flat  - one loop or GPU kernel over the cells of all the patches, each
+///         finds its patch with a binary search of the first cells of the
+///         patches
+///
+/// The flat tunings of the RAJA variants use one range segment over the
+/// cells and not an index set of a segment per patch, which RAJA runs one
+/// segment at a time, as the patch tunings. All tunings compute the same
+/// values. The patches and launches of a rep and the rate of cell updates
+/// in millions per second are in the metrics file.
+///
+
+#ifndef RAJAPerf_Apps_AMR_PATCHES_HPP
+#define RAJAPerf_Apps_AMR_PATCHES_HPP
+
+#define AMR_PATCHES_DATA_SETUP \
+  Real_ptr in = m_in; \
+  Real_ptr out = m_out; \
+  Index_type* patch_offsets = m_patch_offsets; \
+  Index_type* patch_dims = m_patch_dims; \
+  Index_type* patch_cells = m_patch_cells; \
+  const Index_type num_patches = m_num_patches; \
+  const Real_type c0 = m_c0; \
+  const Real_type c1 = m_c1;
+
+// host copies of the patch arrays, to launch patches from the host
+#define AMR_PATCHES_HOST_DATA_SETUP \
+  const Index_type* patch_offsets_host = m_patch_offsets_host.data(); \
+  const Index_type* patch_dims_host = m_patch_dims_host.data(); \
+  const Index_type* patch_cells_host = m_patch_cells_host.data();
+
+// offset and strides of patch p from the patch arrays given
+#define AMR_PATCHES_PATCH_SETUP(offsets, dims) \
+  const Index_type offset = offsets[p]; \
+  const Index_type nx = dims[3*p]; \
+  const Index_type ny = dims[3*p+1]; \
+  const Index_type jp = nx + 2; \
+  const Index_type kp = jp * (ny + 2);
+
+// patch p and cell c in the patch of cell g of all patches
+#define AMR_PATCHES_FLAT_SETUP \
+  const Index_type p = amrPatchesFindPatch(patch_cells, num_patches, g); \
+  const Index_type c = g - patch_cells[p];
+
+#define AMR_PATCHES_BODY \
+  const Index_type i = c % nx; \
+  const Index_type j = (c / nx) % ny; \
+  const Index_type k = c / (nx * ny); \
+  const Index_type idx = offset + (i+1) + (j+1)*jp + (k+1)*kp; \
+  out[idx] = c0*in[idx] + c1*(in[idx-1]  + in[idx+1] + \
+                              in[idx-jp] + in[idx+jp] + \
+                              in[idx-kp] + in[idx+kp]);
+
+
+#include "common/KernelBase.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+//
+// Return the patch of cell g of all patches, the last patch whose first
+// cell is at or before g, patch_cells has num_patches+1 entries.
+//
+RAJA_HOST_DEVICE RAJA_INLINE Index_type amrPatchesFindPatch(
+    const Index_type* patch_cells, Index_type num_patches, Index_type g)
+{
+  Index_type lo = 0;
+  Index_type hi = num_patches;
+  while (hi - lo > 1) {
+    const Index_type mid = lo + (hi - lo) / 2;
+    if (patch_cells[mid] <= g) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+class AMR_PATCHES : public KernelBase
+{
+public:
+
+  AMR_PATCHES(const RunParams& params);
+
+  ~AMR_PATCHES();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  // patches and launches per rep and million cell updates per second
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  AMR_PATCHES : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantPatch(VariantID vid);
+  void runSeqVariantFused(VariantID vid);
+  void runSeqVariantFlat(VariantID vid);
+  void runOpenMPVariantPatch(VariantID vid);
+  void runOpenMPVariantFused(VariantID vid);
+  void runOpenMPVariantFlat(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantPatch(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantFused(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantFlat(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantPatch(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantFused(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantFlat(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  // launches of a rep of the tuning, one per patch for the patch tunings
+  Index_type getLaunchesPerRep(VariantID vid, size_t tune_idx) const;
+
+  Index_type m_min_patch;
+  Index_type m_max_patch;
+
+  Index_type m_num_patches;
+  Index_type m_var_size;  // cells of all patches with their ghost cells
+
+  Real_type m_c0;
+  Real_type m_c1;
+
+  // offset of the first cell of each patch in the arrays, the nx, ny, and
+  // nz of each patch, and the first interior cell of each patch of all
+  // patches followed by the number of interior cells
+  std::vector<Index_type> m_patch_offsets_host;
+  std::vector<Index_type> m_patch_dims_host;
+  std::vector<Index_type> m_patch_cells_host;
+
+  Index_type* m_patch_offsets;
+  Index_type* m_patch_dims;
+  Index_type* m_patch_cells;
+
+  Real_ptr m_in;
+  Real_ptr m_out;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -8,8 +8,12 @@
 
 #include "common/RAJAPerfSuite.hpp"
 #include "AppsData.hpp"
+#include "common/DataUtils.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <utility>
 
 namespace rajaperf
 {
@@ -176,5 +180,319 @@ void setMeshPositions_3d(Real_ptr x, Real_type dx,
   }
 }
 
+//
+// Names of the unstructured tunings.
+//
+std::vector<std::string> getUnstructuredTuningNames()
+{
+  return {"unstructured_natural", "unstructured_random", "unstructured_morton"};
+}
+
+//
+// Node ordering of a tuning name, data type and other suffixes are ignored.
+//
+NodeOrdering getNodeOrdering(const std::string& tuning_name)
+{
+  if (tuning_name.compare(0, 20, "unstructured_natural") == 0) {
+    return NodeOrdering::natural;
+  } else if (tuning_name.compare(0, 19, "unstructured_random") == 0) {
+    return NodeOrdering::random;
+  } else if (tuning_name.compare(0, 19, "unstructured_morton") == 0) {
+    return NodeOrdering::morton;
+  }
+  return NodeOrdering::structured;
+}
+
+//
+// Spread the low 21 bits of v so there are two zero bits between each.
+//
+static uint64_t spreadMortonBits(uint64_t v)
+{
+  v &= 0x1fffff;
+  v = (v | (v << 32)) & 0x001f00000000ffffull;
+  v = (v | (v << 16)) & 0x001f0000ff0000ffull;
+  v = (v | (v <<  8)) & 0x100f00f00f00f00full;
+  v = (v | (v <<  4)) & 0x10c30c30c30c30c3ull;
+  v = (v | (v <<  2)) & 0x1249249249249249ull;
+  return v;
+}
+
+//
+// Number the nodes of 3d mesh.
+//
+void setNodeOrdering_3d(Index_type* node_perm,
+                        NodeOrdering ordering,
+                        const ADomain& domain)
+{
+  if (domain.ndims != 3) {
+    getCout() << "\n******* ERROR!!! domain is not 3d *******" << std::endl;
+    return;
+  }
+
+  constexpr unsigned long long node_seed = 4357;
+
+  const Index_type nnalls = domain.nnalls;
+  const Index_type jp = domain.jp;
+  const Index_type kp = domain.kp;
+
+  switch (ordering) {
+
+    case NodeOrdering::random : {
+      std::vector<Index_type> order(nnalls);
+      for (Index_type n = 0; n < nnalls; ++n) {
+        order[n] = n;
+      }
+      for (Index_type n = nnalls-1; n > 0; --n) {
+        const Index_type r = static_cast<Index_type>(
+            detail::counterRandValue(node_seed, n) * (n+1));
+        std::swap(order[n], order[r]);
+      }
+      for (Index_type n = 0; n < nnalls; ++n) {
+        node_perm[order[n]] = n;
+      }
+      break;
+    }
+
+    case NodeOrdering::morton : {
+      std::vector<std::pair<uint64_t, Index_type>> keys(nnalls);
+      for (Index_type n = 0; n < nnalls; ++n) {
+        const uint64_t i = n % jp;
+        const uint64_t j = (n % kp) / jp;
+        const uint64_t k = n / kp;
+        keys[n] = std::make_pair( spreadMortonBits(i)        |
+                                  (spreadMortonBits(j) << 1) |
+                                  (spreadMortonBits(k) << 2), n );
+      }
+      std::sort(keys.begin(), keys.end());
+      for (Index_type n = 0; n < nnalls; ++n) {
+        node_perm[keys[n].second] = n;
+      }
+      break;
+    }
+
+    default : {
+      for (Index_type n = 0; n < nnalls; ++n) {
+        node_perm[n] = n;
+      }
+      break;
+    }
+
+  }
+}
+
+//
+// Set zone-to-node connectivity for 3d mesh, zones are in real_zones order.
+//
+void setZoneNodes_3d(Index_type* zone_nodes,
+                     const Index_type* node_perm,
+                     const ADomain& domain)
+{
+  if (domain.ndims != 3) {
+    getCout() << "\n******* ERROR!!! domain is not 3d *******" << std::endl;
+    return;
+  }
+
+  Index_type imin = domain.imin;
+  Index_type imax = domain.imax;
+  Index_type jmin = domain.jmin;
+  Index_type jmax = domain.jmax;
+  Index_type kmin = domain.kmin;
+  Index_type kmax = domain.kmax;
+
+  Index_type jp = domain.jp;
+  Index_type kp = domain.kp;
+
+  Index_type j_stride = (imax - imin);
+  Index_type k_stride = j_stride * (jmax - jmin);
+
+  const Index_type offsets[8] = { 0, 1, jp, 1 + jp,
+                                  kp, 1 + kp, jp + kp, 1 + jp + kp };
+
+  for (Index_type k = kmin; k < kmax; k++) {
+     for (Index_type j = jmin; j < jmax; j++) {
+        for (Index_type i = imin; i < imax; i++) {
+           Index_type ip = i + j*jp + k*kp ;
+
+           Index_type id = (i-imin) + (j-jmin)*j_stride + (k-kmin)*k_stride ;
+           for (Index_type v = 0; v < 8; ++v) {
+              zone_nodes[8*id + v] = node_perm[ip + offsets[v]];
+           }
+        }
+     }
+  }
+}
+
+//
+// Names of the accumulation tunings.
+//
+std::vector<std::string> getAccumulationTuningNames()
+{
+  return {"colored", "gather"};
+}
+
+//
+// Accumulation method of a tuning name.
+//
+AccumulationMethod getAccumulationMethod(const std::string& tuning_name)
+{
+  if (tuning_name == "colored") {
+    return AccumulationMethod::colored;
+  } else if (tuning_name == "gather") {
+    return AccumulationMethod::gather;
+  } else if (tuning_name == "scatter") {
+    return AccumulationMethod::scatter;
+  }
+  return AccumulationMethod::atomic;
+}
+
+//
+// Color the real zones of 3d mesh, zones of each color are in real_zones
+// order.
+//
+void setZoneColors_3d(Index_type* color_zones,
+                      Index_type* color_offsets,
+                      const ADomain& domain)
+{
+  if (domain.ndims != 3) {
+    getCout() << "\n******* ERROR!!! domain is not 3d *******" << std::endl;
+    return;
+  }
+
+  Index_type imin = domain.imin;
+  Index_type imax = domain.imax;
+  Index_type jmin = domain.jmin;
+  Index_type jmax = domain.jmax;
+  Index_type kmin = domain.kmin;
+  Index_type kmax = domain.kmax;
+
+  Index_type jp = domain.jp;
+  Index_type kp = domain.kp;
+
+  Index_type id = 0;
+  for (Index_type c = 0; c < num_zone_colors; ++c) {
+    color_offsets[c] = id;
+
+    const Index_type ci = c % 2;
+    const Index_type cj = (c / 2) % 2;
+    const Index_type ck = c / 4;
+
+    for (Index_type k = kmin + ck; k < kmax; k += 2) {
+       for (Index_type j = jmin + cj; j < jmax; j += 2) {
+          for (Index_type i = imin + ci; i < imax; i += 2) {
+             color_zones[id++] = i + j*jp + k*kp ;
+          }
+       }
+    }
+  }
+  color_offsets[num_zone_colors] = id;
+}
+
+//
+// Set node-to-zone connectivity for 3d mesh, nodes are in i,j,k order.
+//
+void setNodeZones_3d(Index_type* real_nodes,
+                     Index_type* node_zones,
+                     const ADomain& domain)
+{
+  if (domain.ndims != 3) {
+    getCout() << "\n******* ERROR!!! domain is not 3d *******" << std::endl;
+    return;
+  }
+
+  Index_type imin = domain.imin;
+  Index_type imax = domain.imax;
+  Index_type jmin = domain.jmin;
+  Index_type jmax = domain.jmax;
+  Index_type kmin = domain.kmin;
+  Index_type kmax = domain.kmax;
+
+  Index_type jp = domain.jp;
+  Index_type kp = domain.kp;
+
+  const Index_type di[8] = { 0, 1, 0, 1, 0, 1, 0, 1 };
+  const Index_type dj[8] = { 0, 0, 1, 1, 0, 0, 1, 1 };
+  const Index_type dk[8] = { 0, 0, 0, 0, 1, 1, 1, 1 };
+
+  Index_type id = 0;
+  for (Index_type k = kmin; k <= kmax; k++) {
+     for (Index_type j = jmin; j <= jmax; j++) {
+        for (Index_type i = imin; i <= imax; i++) {
+           real_nodes[id] = i + j*jp + k*kp ;
+
+           for (Index_type v = 0; v < 8; ++v) {
+              const Index_type zi = i - di[v];
+              const Index_type zj = j - dj[v];
+              const Index_type zk = k - dk[v];
+              const bool real = zi >= imin && zi < imax &&
+                                zj >= jmin && zj < jmax &&
+                                zk >= kmin && zk < kmax;
+              node_zones[8*id + v] = real ? zi + zj*jp + zk*kp : -1;
+           }
+           ++id;
+        }
+     }
+  }
+}
+
+//
+// Names of the layout tunings.
+//
+std::vector<std::string> getLayoutTuningNames()
+{
+  return {"aos", "aosoa_"+std::to_string(aosoa_width)};
+}
+
+//
+// Layout of a tuning name, data type and other suffixes are ignored.
+//
+NodeLayout getNodeLayout(const std::string& tuning_name)
+{
+  if (tuning_name.compare(0, 5, "aosoa") == 0) {
+    return NodeLayout::aosoa;
+  } else if (tuning_name.compare(0, 3, "aos") == 0) {
+    return NodeLayout::aos;
+  }
+  return NodeLayout::soa;
+}
+
+//
+// Name of the node tile tuning.
+//
+std::string getNodeTileTuningName()
+{
+  return "node_tile_" + std::to_string(node_tile_x) + "x" +
+         std::to_string(node_tile_y) + "x" + std::to_string(node_tile_z);
+}
+
+//
+// Length of node data in a layout, aosoa is padded to whole blocks.
+//
+Index_type getLayoutLength(NodeLayout layout, Index_type ncomp, Index_type len)
+{
+  if (layout == NodeLayout::aosoa) {
+    return ((len + aosoa_width-1) / aosoa_width) * ncomp*aosoa_width;
+  }
+  return ncomp*len;
+}
+
+//
+// Copy node data into a layout.
+//
+void setLayoutData(Real_ptr data, NodeLayout layout,
+                   const Real_ptr* comps, Index_type ncomp, Index_type len)
+{
+  for (Index_type n = 0; n < len; ++n) {
+    for (Index_type c = 0; c < ncomp; ++c) {
+      Index_type idx = c*len + n;
+      if (layout == NodeLayout::aos) {
+        idx = ncomp*n + c;
+      } else if (layout == NodeLayout::aosoa) {
+        idx = (n/aosoa_width)*ncomp*aosoa_width + c*aosoa_width + n%aosoa_width;
+      }
+      data[idx] = comps[c][n];
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
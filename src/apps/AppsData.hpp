@@ -11,6 +11,11 @@
 
 #include "common/RPTypes.hpp"
 
+#include "RAJA/util/macros.hpp"
+
+#include <string>
+#include <vector>
+
 namespace rajaperf
 {
 namespace apps
@@ -135,6 +140,264 @@ void setMeshPositions_3d(Real_ptr x, Real_type dx,
                          Real_ptr z, Real_type dz,
                          const ADomain& domain);
 
+//
+// Node orderings of the unstructured tunings of the ADomain kernels. These
+// tunings read the nodes of each zone from explicit zone-to-node
+// connectivity instead of jp/kp stride arithmetic, with the nodes numbered
+//   natural - in the structured order, so only the indirection is added
+//   random  - in a random order
+//   morton  - along a Morton (Z-order) curve through the node i,j,k
+// structured is the stride arithmetic of the other tunings.
+//
+enum struct NodeOrdering : int
+{
+  structured = 0,
+  natural,
+  random,
+  morton
+};
+
+//
+// Names of the unstructured tunings, one for each node ordering, and the
+// node ordering of a tuning name, structured if it is not unstructured.
+//
+std::vector<std::string> getUnstructuredTuningNames();
+
+NodeOrdering getNodeOrdering(const std::string& tuning_name);
+
+//
+// Routine for numbering the nodes of a 3d domain, node_perm[n] is the new
+// number of structured node n for all domain.nnalls nodes.
+//
+void setNodeOrdering_3d(Index_type* node_perm,
+                        NodeOrdering ordering,
+                        const ADomain& domain);
+
+//
+// Routine for initializing the zone-to-node connectivity of a 3d domain,
+// zone_nodes[8*ii + v] is node v, in NDPTRSET order, of real zone ii
+// numbered by node_perm.
+//
+void setZoneNodes_3d(Index_type* zone_nodes,
+                     const Index_type* node_perm,
+                     const ADomain& domain);
+
+//
+// Accumulation methods of the zone-node kernels of ADomain
+//   atomic  - each zone adds to or reads its nodes as in the other tunings
+//   colored - the zones are split into 8 colors by the parity of their
+//             i,j,k indices, zones of one color share no nodes so each
+//             color is run without atomics
+//   gather  - each node sums its zones from node-to-zone connectivity
+//   scatter - each node adds to its zones with atomics from node-to-zone
+//             connectivity, the inverse of a zone gather from its nodes
+//
+enum struct AccumulationMethod : int
+{
+  atomic = 0,
+  colored,
+  gather,
+  scatter
+};
+
+constexpr Index_type num_zone_colors = 8;
+
+//
+// Names of the accumulation tunings of the node scatter kernels, one for
+// colored and gather, and the accumulation method of a tuning name, atomic
+// if it is not one of them.
+//
+std::vector<std::string> getAccumulationTuningNames();
+
+AccumulationMethod getAccumulationMethod(const std::string& tuning_name);
+
+//
+// Routine for coloring the real zones of a 3d domain, color_zones holds
+// the structured index of the real zones of color c from
+// color_offsets[c] to color_offsets[c+1], color_offsets has
+// num_zone_colors+1 entries.
+//
+void setZoneColors_3d(Index_type* color_zones,
+                      Index_type* color_offsets,
+                      const ADomain& domain);
+
+//
+// Routine for initializing the node-to-zone connectivity of a 3d domain,
+// real_nodes[jj] is the structured index of real node jj and
+// node_zones[8*jj + v] the structured index of the zone whose node v, in
+// NDPTRSET order, it is, or -1 if that zone is not real.
+//
+void setNodeZones_3d(Index_type* real_nodes,
+                     Index_type* node_zones,
+                     const ADomain& domain);
+
+//
+// Node data layouts of the layout tunings of the ADomain kernels. The ncomp
+// node arrays of a kernel, ie. the x, y, z coordinates, are stored with
+// component c of node n at
+//   soa   - comp_c[n], one array per component as in the other tunings
+//   aos   - data[ncomp*n + c]
+//   aosoa - data[(n/aosoa_width)*ncomp*aosoa_width + c*aosoa_width
+//                + n%aosoa_width], blocks of aosoa_width nodes holding
+//           one vector of each component
+//
+enum struct NodeLayout : int
+{
+  soa = 0,
+  aos,
+  aosoa
+};
+
+constexpr Index_type aosoa_width = 8;
+
+//
+// Names of the layout tunings, one for aos and aosoa, and the layout of a
+// tuning name, soa if it is not a layout tuning.
+//
+std::vector<std::string> getLayoutTuningNames();
+
+NodeLayout getNodeLayout(const std::string& tuning_name);
+
+//
+// Routines for the length of an array holding len nodes of ncomp
+// components in a layout, and for copying the ncomp arrays of len nodes
+// in comps into data in that layout.
+//
+Index_type getLayoutLength(NodeLayout layout, Index_type ncomp, Index_type len);
+
+void setLayoutData(Real_ptr data, NodeLayout layout,
+                   const Real_ptr* comps, Index_type ncomp, Index_type len);
+
+//
+// Zone extents of the tiles of the node tile tunings of the GPU ADomain
+// kernels. A block of node_tile_x*node_tile_y*node_tile_z threads stages
+// the (node_tile_x+1)*(node_tile_y+1)*(node_tile_z+1) nodes of its tile of
+// zones, with the halo on the high side, in shared memory and computes the
+// zones of the tile from there, so each node is read from global memory
+// once per tile instead of once per zone using it.
+//
+constexpr Index_type node_tile_x = 32;
+constexpr Index_type node_tile_y = 4;
+constexpr Index_type node_tile_z = 2;
+
+//
+// Name of the node tile tuning, ie. node_tile_32x4x2.
+//
+std::string getNodeTileTuningName();
+
+//
+// Views of one component of aos and aosoa node data. They index and offset
+// like a Real_ptr to the component array, so NDPTRSET, NDSET2D and the
+// kernel bodies use them unchanged.
+//
+template < Index_type ncomp >
+struct AoSPtr
+{
+  Real_ptr ptr;
+
+  static AoSPtr make(Real_ptr data, Index_type c)
+  { return AoSPtr{data + c}; }
+
+  RAJA_HOST_DEVICE
+  Real_type& operator[](Index_type i) const
+  { return ptr[ncomp*i]; }
+
+  RAJA_HOST_DEVICE
+  AoSPtr operator+(Index_type offset) const
+  { return AoSPtr{ptr + ncomp*offset}; }
+};
+
+template < Index_type ncomp >
+struct AoSoAPtr
+{
+  Real_ptr ptr;
+  Index_type offset;
+
+  static AoSoAPtr make(Real_ptr data, Index_type c)
+  { return AoSoAPtr{data + c*aosoa_width, 0}; }
+
+  RAJA_HOST_DEVICE
+  Real_type& operator[](Index_type i) const
+  {
+    const Index_type n = i + offset;
+    return ptr[(n/aosoa_width)*(ncomp*aosoa_width) + n%aosoa_width];
+  }
+
+  RAJA_HOST_DEVICE
+  AoSoAPtr operator+(Index_type off) const
+  { return AoSoAPtr{ptr, offset + off}; }
+};
+
+//
+// Block size tunings followed by the named tunings in names for named_vid
+// at the default block size. Named tunings call
+// run<variant>Variant<named>Impl<default_gpu_block_size>, the kernel gets
+// what a named tuning does from the tuning name in setUp. Launch tunings
+// for launch_vid follow.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_NAMED_TUNING_DEFINE_BOILERPLATE(kernel, variant, named_vid, names, named, launch_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<block_size>(vid);                          \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == named_vid) {                                                    \
+      for (size_t o = 0; o < names.size(); ++o) {                              \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(default_gpu_block_size);                                \
+          run##variant##Variant##named<default_gpu_block_size>(vid);           \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_RUN(variant, Impl, )                          \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == named_vid) {                                                    \
+      for (const std::string& name : names) {                                  \
+        addVariantTuningName(vid, name);                                       \
+      }                                                                        \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_NAMES                                         \
+    }                                                                          \
+  }
+
+//
+// Block size tunings followed by the unstructured tunings for
+// unstructured_vid, which call run<variant>VariantUnstructured, and the
+// launch tunings for launch_vid.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_UNSTRUCTURED_TUNING_DEFINE_BOILERPLATE(kernel, variant, unstructured_vid, launch_vid) \
+  RAJAPERF_GPU_BLOCK_SIZE_NAMED_TUNING_DEFINE_BOILERPLATE(kernel, variant,     \
+      unstructured_vid, getUnstructuredTuningNames(), Unstructured, launch_vid)
+
+//
+// Block size tunings followed by the layout tunings for layout_vid, which
+// call run<variant>VariantLayout, and the launch tunings for launch_vid.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_LAYOUT_TUNING_DEFINE_BOILERPLATE(kernel, variant, layout_vid, launch_vid) \
+  RAJAPERF_GPU_BLOCK_SIZE_NAMED_TUNING_DEFINE_BOILERPLATE(kernel, variant,     \
+      layout_vid, getLayoutTuningNames(), Layout, launch_vid)
+
 } // end namespace apps
 } // end namespace rajaperf
 
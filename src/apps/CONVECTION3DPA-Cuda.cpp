@@ -19,7 +19,7 @@
 namespace rajaperf {
 namespace apps {
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
   __launch_bounds__(block_size)
 __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
                               const Real_ptr dBasis, const Real_ptr D,
@@ -29,11 +29,11 @@ __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
 
   CONVECTION3DPA_0_GPU;
 
-  GPU_FOREACH_THREAD(dz,z,CPA_D1D)
+  GPU_FOREACH_THREAD(dz,z,D1D)
   {
-    GPU_FOREACH_THREAD(dy,y,CPA_D1D)
+    GPU_FOREACH_THREAD(dy,y,D1D)
     {
-      GPU_FOREACH_THREAD(dx,x,CPA_D1D)
+      GPU_FOREACH_THREAD(dx,x,D1D)
       {
         CONVECTION3DPA_1;
       }
@@ -41,11 +41,11 @@ __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
   }
   __syncthreads();
 
-  GPU_FOREACH_THREAD(dz,z,CPA_D1D)
+  GPU_FOREACH_THREAD(dz,z,D1D)
   {
-    GPU_FOREACH_THREAD(dy,y,CPA_D1D)
+    GPU_FOREACH_THREAD(dy,y,D1D)
     {
-      GPU_FOREACH_THREAD(qx,x,CPA_Q1D)
+      GPU_FOREACH_THREAD(qx,x,Q1D)
       {
         CONVECTION3DPA_2;
       }
@@ -53,11 +53,11 @@ __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
   }
   __syncthreads();
 
-  GPU_FOREACH_THREAD(dz,z,CPA_D1D)
+  GPU_FOREACH_THREAD(dz,z,D1D)
   {
-    GPU_FOREACH_THREAD(qx,x,CPA_Q1D)
+    GPU_FOREACH_THREAD(qx,x,Q1D)
     {
-      GPU_FOREACH_THREAD(qy,y,CPA_Q1D)
+      GPU_FOREACH_THREAD(qy,y,Q1D)
       {
         CONVECTION3DPA_3;
       }
@@ -65,11 +65,11 @@ __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
   }
   __syncthreads();
 
-  GPU_FOREACH_THREAD(qx,x,CPA_Q1D)
+  GPU_FOREACH_THREAD(qx,x,Q1D)
   {
-    GPU_FOREACH_THREAD(qy,y,CPA_Q1D)
+    GPU_FOREACH_THREAD(qy,y,Q1D)
     {
-      GPU_FOREACH_THREAD(qz,z,CPA_Q1D)
+      GPU_FOREACH_THREAD(qz,z,Q1D)
       {
         CONVECTION3DPA_4;
       }
@@ -77,11 +77,11 @@ __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
   }
   __syncthreads();
 
-  GPU_FOREACH_THREAD(qz,z,CPA_Q1D)
+  GPU_FOREACH_THREAD(qz,z,Q1D)
   {
-    GPU_FOREACH_THREAD(qy,y,CPA_Q1D)
+    GPU_FOREACH_THREAD(qy,y,Q1D)
     {
-      GPU_FOREACH_THREAD(qx,x,CPA_Q1D)
+      GPU_FOREACH_THREAD(qx,x,Q1D)
       {
         CONVECTION3DPA_5;
       }
@@ -89,11 +89,11 @@ __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
   }
   __syncthreads();
 
-  GPU_FOREACH_THREAD(qx,x,CPA_Q1D)
+  GPU_FOREACH_THREAD(qx,x,Q1D)
   {
-    GPU_FOREACH_THREAD(qy,y,CPA_Q1D)
+    GPU_FOREACH_THREAD(qy,y,Q1D)
     {
-      GPU_FOREACH_THREAD(dz,z,CPA_D1D)
+      GPU_FOREACH_THREAD(dz,z,D1D)
       {
         CONVECTION3DPA_6;
       }
@@ -101,11 +101,11 @@ __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
   }
   __syncthreads();
 
-  GPU_FOREACH_THREAD(dz,z,CPA_D1D)
+  GPU_FOREACH_THREAD(dz,z,D1D)
   {
-    GPU_FOREACH_THREAD(qx,x,CPA_Q1D)
+    GPU_FOREACH_THREAD(qx,x,Q1D)
     {
-      GPU_FOREACH_THREAD(dy,y,CPA_D1D)
+      GPU_FOREACH_THREAD(dy,y,D1D)
       {
         CONVECTION3DPA_7;
       }
@@ -113,11 +113,11 @@ __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
   }
   __syncthreads();
 
-  GPU_FOREACH_THREAD(dz,z,CPA_D1D)
+  GPU_FOREACH_THREAD(dz,z,D1D)
   {
-    GPU_FOREACH_THREAD(dy,y,CPA_D1D)
+    GPU_FOREACH_THREAD(dy,y,D1D)
     {
-      GPU_FOREACH_THREAD(dx,x,CPA_D1D)
+      GPU_FOREACH_THREAD(dx,x,D1D)
       {
         CONVECTION3DPA_8;
       }
@@ -126,7 +126,7 @@ __global__ void Convection3DPA(const Real_ptr Basis, const Real_ptr tBasis,
 
 }
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
 void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
@@ -138,13 +138,16 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
 
   case Base_CUDA: {
 
-    dim3 nthreads_per_block(CPA_Q1D, CPA_Q1D, CPA_Q1D);
+    dim3 nthreads_per_block(Q1D, Q1D, Q1D);
+
+    detail::setCudaFuncSharedMemCarveout(
+        Convection3DPA<block_size, D1D, Q1D>, getSharedMemCarveout());
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       constexpr size_t shmem = 0;
-      Convection3DPA<block_size><<<NE, nthreads_per_block, shmem, res.get_stream()>>>
+      Convection3DPA<block_size, D1D, Q1D><<<NE, nthreads_per_block, shmem, res.get_stream()>>>
         (Basis, tBasis, dBasis, D, X, Y);
 
       cudaErrchk(cudaGetLastError());
@@ -159,26 +162,26 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
     constexpr bool async = true;
 
     using launch_policy =
-        RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, CPA_Q1D*CPA_Q1D*CPA_Q1D>>;
+        RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, Q1D*Q1D*Q1D>>;
 
     using outer_x =
         RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
 
     using inner_x =
-        RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<CPA_Q1D>>;
+        RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<Q1D>>;
 
     using inner_y =
-        RAJA::LoopPolicy<RAJA::cuda_thread_size_y_loop<CPA_Q1D>>;
+        RAJA::LoopPolicy<RAJA::cuda_thread_size_y_loop<Q1D>>;
 
     using inner_z =
-        RAJA::LoopPolicy<RAJA::cuda_thread_size_z_loop<CPA_Q1D>>;
+        RAJA::LoopPolicy<RAJA::cuda_thread_size_z_loop<Q1D>>;
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       RAJA::launch<launch_policy>( res,
           RAJA::LaunchParams(RAJA::Teams(NE),
-                           RAJA::Threads(CPA_Q1D, CPA_Q1D, CPA_Q1D)),
+                           RAJA::Threads(Q1D, Q1D, Q1D)),
           [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
 
           RAJA::loop<outer_x>(ctx, RAJA::RangeSegment(0, NE),
@@ -186,11 +189,11 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
 
              CONVECTION3DPA_0_GPU;
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           CONVECTION3DPA_1;
@@ -204,11 +207,11 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           CONVECTION3DPA_2;
@@ -222,11 +225,11 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
 
              ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
-                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qy) {
 
                           CONVECTION3DPA_3;
@@ -240,11 +243,11 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
 
              ctx.teamSync();
 
-              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qx) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qz) {
 
                           CONVECTION3DPA_4;
@@ -258,11 +261,11 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
 
              ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           CONVECTION3DPA_5;
@@ -276,11 +279,11 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
 
              ctx.teamSync();
 
-              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qx) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dz) {
 
                           CONVECTION3DPA_6;
@@ -294,11 +297,11 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
 
              ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
-                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dy) {
 
                           CONVECTION3DPA_7;
@@ -312,11 +315,11 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
 
             ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           CONVECTION3DPA_8;
@@ -349,7 +352,7 @@ void CONVECTION3DPA::runCudaVariantImpl(VariantID vid) {
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(CONVECTION3DPA, Cuda)
+RAJAPERF_GPU_FEM_ORDER_TUNING_DEFINE_BOILERPLATE(CONVECTION3DPA, Cuda)
 
 } // end namespace apps
 } // end namespace rajaperf
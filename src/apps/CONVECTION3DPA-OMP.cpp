@@ -15,7 +15,8 @@
 namespace rajaperf {
 namespace apps {
 
-void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < Index_type D1D, Index_type Q1D >
+void CONVECTION3DPA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -34,88 +35,88 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
         CONVECTION3DPA_0_CPU;
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dy,y,D1D)
           {
-            CPU_FOREACH(dx,x,CPA_D1D)
+            CPU_FOREACH(dx,x,D1D)
             {
               CONVECTION3DPA_1;
             }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dy,y,D1D)
           {
-            CPU_FOREACH(qx,x,CPA_Q1D)
+            CPU_FOREACH(qx,x,Q1D)
             {
               CONVECTION3DPA_2;
             }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(qx,x,CPA_Q1D)
+          CPU_FOREACH(qx,x,Q1D)
           {
-            CPU_FOREACH(qy,y,CPA_Q1D)
+            CPU_FOREACH(qy,y,Q1D)
             {
               CONVECTION3DPA_3;
             }
           }
         }
 
-        CPU_FOREACH(qx,x,CPA_Q1D)
+        CPU_FOREACH(qx,x,Q1D)
         {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qy,y,Q1D)
           {
-            CPU_FOREACH(qz,z,CPA_Q1D)
+            CPU_FOREACH(qz,z,Q1D)
             {
               CONVECTION3DPA_4;
             }
           }
         }
 
-        CPU_FOREACH(qz,z,CPA_Q1D)
+        CPU_FOREACH(qz,z,Q1D)
         {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qy,y,Q1D)
           {
-            CPU_FOREACH(qx,x,CPA_Q1D)
+            CPU_FOREACH(qx,x,Q1D)
             {
               CONVECTION3DPA_5;
             }
           }
         }
 
-        CPU_FOREACH(qx,x,CPA_Q1D)
+        CPU_FOREACH(qx,x,Q1D)
         {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qy,y,Q1D)
           {
-            CPU_FOREACH(dz,z,CPA_D1D)
+            CPU_FOREACH(dz,z,D1D)
             {
               CONVECTION3DPA_6;
             }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-           CPU_FOREACH(qx,x,CPA_Q1D)
+           CPU_FOREACH(qx,x,Q1D)
            {
-              CPU_FOREACH(dy,y,CPA_D1D)
+              CPU_FOREACH(dy,y,D1D)
               {
                 CONVECTION3DPA_7;
              }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dy,y,D1D)
           {
-            CPU_FOREACH(dx,x,CPA_D1D)
+            CPU_FOREACH(dx,x,D1D)
             {
               CONVECTION3DPA_8;
             }
@@ -154,11 +155,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
              CONVECTION3DPA_0_CPU;
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           CONVECTION3DPA_1;
@@ -172,11 +173,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
               ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           CONVECTION3DPA_2;
@@ -190,11 +191,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
-                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qy) {
 
                           CONVECTION3DPA_3;
@@ -208,11 +209,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qx) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qz) {
 
                           CONVECTION3DPA_4;
@@ -226,11 +227,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           CONVECTION3DPA_5;
@@ -244,11 +245,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qx) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dz) {
 
                           CONVECTION3DPA_6;
@@ -262,11 +263,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
-                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dy) {
 
                           CONVECTION3DPA_7;
@@ -280,11 +281,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           CONVECTION3DPA_8;
@@ -317,5 +318,7 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+RAJAPERF_FEM_ORDER_RUN_BOILERPLATE(CONVECTION3DPA, OpenMP)
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -16,8 +16,8 @@
 ///
 /// for(int e = 0; e < NE; ++e) {
 ///
-///   constexpr int max_D1D = CPA_D1D;
-///   constexpr int max_Q1D = CPA_Q1D;
+///   constexpr int max_D1D = D1D;
+///   constexpr int max_Q1D = Q1D;
 ///   constexpr int max_DQ = (max_Q1D > max_D1D) ? max_Q1D : max_D1D;
 ///   MFEM_SHARED double sm0[max_DQ*max_DQ*max_DQ];
 ///   MFEM_SHARED double sm1[max_DQ*max_DQ*max_DQ];
@@ -27,11 +27,11 @@
 ///   MFEM_SHARED double sm5[max_DQ*max_DQ*max_DQ];
 ///
 ///   double (*u)[max_D1D][max_D1D] = (double (*)[max_D1D][max_D1D]) sm0;
-///   for(int dz = 0; dz < CPA_D1D; ++dz)
+///   for(int dz = 0; dz < D1D; ++dz)
 ///   {
-///     for(int dy = 0; dy < CPA_D1D; ++dy)
+///     for(int dy = 0; dy < D1D; ++dy)
 ///     {
-///       for(int dx = 0; dx < CPA_D1D; ++dx)
+///       for(int dx = 0; dx < D1D; ++dx)
 ///       {
 ///         u[dz][dy][dx] = cpaX_(dx,dy,dz,e);
 ///       }
@@ -40,15 +40,15 @@
 ///   MFEM_SYNC_THREAD;
 ///   double (*Bu)[max_D1D][max_Q1D] = (double (*)[max_D1D][max_Q1D])sm1;
 ///   double (*Gu)[max_D1D][max_Q1D] = (double (*)[max_D1D][max_Q1D])sm2;
-///   for(int dz = 0; dz < CPA_D1D; ++dz)
+///   for(int dz = 0; dz < D1D; ++dz)
 ///   {
-///     for(int dy = 0; dy < CPA_D1D; ++dy)
+///     for(int dy = 0; dy < D1D; ++dy)
 ///     {
-///       for(int qx = 0; qx < CPA_Q1D; ++qx)
+///       for(int qx = 0; qx < Q1D; ++qx)
 ///       {
 ///         double Bu_ = 0.0;
 ///         double Gu_ = 0.0;
-///         for(int dx = 0; dx < CPA_D1D; ++dx)
+///         for(int dx = 0; dx < D1D; ++dx)
 ///         {
 ///           const double bx = cpa_B(qx,dx);
 ///           const double gx = cpa_G(qx,dx);
@@ -65,16 +65,16 @@
 ///   double (*BBu)[max_Q1D][max_Q1D] = (double (*)[max_Q1D][max_Q1D])sm3;
 ///   double (*GBu)[max_Q1D][max_Q1D] = (double (*)[max_Q1D][max_Q1D])sm4;
 ///   double (*BGu)[max_Q1D][max_Q1D] = (double (*)[max_Q1D][max_Q1D])sm5;
-///   for(int dz = 0; dz < CPA_D1D; ++dz)
+///   for(int dz = 0; dz < D1D; ++dz)
 ///   {
-///     for(int qx = 0; qx < CPA_Q1D; ++qx)
+///     for(int qx = 0; qx < Q1D; ++qx)
 ///     {
-///       for(int qy = 0; qy < CPA_Q1D; ++qy)
+///       for(int qy = 0; qy < Q1D; ++qy)
 ///       {
 ///         double BBu_ = 0.0;
 ///         double GBu_ = 0.0;
 ///         double BGu_ = 0.0;
-///         for(int dy = 0; dy < CPA_D1D; ++dy)
+///         for(int dy = 0; dy < D1D; ++dy)
 ///         {
 ///           const double bx = cpa_B(qy,dy);
 ///           const double gx = cpa_G(qy,dy);
@@ -92,16 +92,16 @@
 ///   double (*GBBu)[max_Q1D][max_Q1D] = (double (*)[max_Q1D][max_Q1D])sm0;
 ///   double (*BGBu)[max_Q1D][max_Q1D] = (double (*)[max_Q1D][max_Q1D])sm1;
 ///   double (*BBGu)[max_Q1D][max_Q1D] = (double (*)[max_Q1D][max_Q1D])sm2;
-///   for(int qx = 0; qx < CPA_Q1D; ++qx)
+///   for(int qx = 0; qx < Q1D; ++qx)
 ///   {
-///     for(int qy = 0; qy < CPA_Q1D; ++qy)
+///     for(int qy = 0; qy < Q1D; ++qy)
 ///     {
-///       for(int qz = 0; qz < CPA_Q1D; ++qz)
+///       for(int qz = 0; qz < Q1D; ++qz)
 ///       {
 ///         double GBBu_ = 0.0;
 ///         double BGBu_ = 0.0;
 ///         double BBGu_ = 0.0;
-///         for(int dz = 0; dz < CPA_D1D; ++dz)
+///         for(int dz = 0; dz < D1D; ++dz)
 ///         {
 ///           const double bx = cpa_B(qz,dz);
 ///           const double gx = cpa_G(qz,dz);
@@ -117,11 +117,11 @@
 ///   }
 ///   MFEM_SYNC_THREAD;
 ///   double (*DGu)[max_Q1D][max_Q1D] = (double (*)[max_Q1D][max_Q1D])sm3;
-///   for(int qz = 0; qz < CPA_Q1D; ++qz)
+///   for(int qz = 0; qz < Q1D; ++qz)
 ///   {
-///     for(int qy = 0; qy < CPA_Q1D; ++qy)
+///     for(int qy = 0; qy < Q1D; ++qy)
 ///     {
-///       for(int qx = 0; qx < CPA_Q1D; ++qx)
+///       for(int qx = 0; qx < Q1D; ++qx)
 ///       {
 ///         const double O1 = cpa_op(qx,qy,qz,0,e);
 ///         const double O2 = cpa_op(qx,qy,qz,1,e);
@@ -137,14 +137,14 @@
 ///   }
 ///   MFEM_SYNC_THREAD;
 ///   double (*BDGu)[max_Q1D][max_Q1D] = (double (*)[max_Q1D][max_Q1D])sm4;
-///   for(int qx = 0; qx < CPA_Q1D; ++qx)
+///   for(int qx = 0; qx < Q1D; ++qx)
 ///   {
-///     for(int qy = 0; qy < CPA_Q1D; ++qy)
+///     for(int qy = 0; qy < Q1D; ++qy)
 ///     {
-///       for(int dz = 0; dz < CPA_D1D; ++dz)
+///       for(int dz = 0; dz < D1D; ++dz)
 ///       {
 ///          double BDGu_ = 0.0;
-///          for(int qz = 0; qz < CPA_Q1D; ++qz)
+///          for(int qz = 0; qz < Q1D; ++qz)
 ///          {
 ///             const double w = cpa_Bt(dz,qz);
 ///             BDGu_ += w * DGu[qz][qy][qx];
@@ -155,14 +155,14 @@
 ///   }
 ///   MFEM_SYNC_THREAD;
 ///   double (*BBDGu)[max_D1D][max_Q1D] = (double (*)[max_D1D][max_Q1D])sm5;
-///   for(int dz = 0; dz < CPA_D1D; ++dz)
+///   for(int dz = 0; dz < D1D; ++dz)
 ///   {
-///     for(int qx = 0; qx < CPA_Q1D; ++qx)
+///     for(int qx = 0; qx < Q1D; ++qx)
 ///      {
-///        for(int dy = 0; dy < CPA_D1D; ++dy)
+///        for(int dy = 0; dy < D1D; ++dy)
 ///         {
 ///            double BBDGu_ = 0.0;
-///            for(int qy = 0; qy < CPA_Q1D; ++qy)
+///            for(int qy = 0; qy < Q1D; ++qy)
 ///            {
 ///              const double w = cpa_Bt(dy,qy);
 ///              BBDGu_ += w * BDGu[dz][qy][qx];
@@ -172,14 +172,14 @@
 ///     }
 ///   }
 ///   MFEM_SYNC_THREAD;
-///   for(int dz = 0; dz < CPA_D1D; ++dz)
+///   for(int dz = 0; dz < D1D; ++dz)
 ///   {
-///     for(int dy = 0; dy < CPA_D1D; ++dy)
+///     for(int dy = 0; dy < D1D; ++dy)
 ///     {
-///       for(int dx = 0; dx < CPA_D1D; ++dx)
+///       for(int dx = 0; dx < D1D; ++dx)
 ///       {
 ///         double BBBDGu = 0.0;
-///         for(int qx = 0; qx < CPA_Q1D; ++qx)
+///         for(int qx = 0; qx < Q1D; ++qx)
 ///         {
 ///           const double w = cpa_Bt(dx,qx);
 ///           BBBDGu += w * BBDGu[dz][dy][qx];
@@ -208,23 +208,22 @@ Index_type NE = m_NE;
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
-#define CPA_D1D 3
-#define CPA_Q1D 4
+// D1D and Q1D, the number of Dofs/Qpts in 1D, are template parameters of
+// the variant implementations, see FEM_MACROS.hpp
 #define CPA_VDIM 3
-#define cpa_B(x, y) Basis[x + CPA_Q1D * y]
-#define cpa_Bt(x, y) tBasis[x + CPA_D1D * y]
-#define cpa_G(x, y) dBasis[x + CPA_Q1D * y]
+#define cpa_B(x, y) Basis[x + Q1D * y]
+#define cpa_Bt(x, y) tBasis[x + D1D * y]
+#define cpa_G(x, y) dBasis[x + Q1D * y]
 #define cpaX_(dx, dy, dz, e)                                                     \
-  X[dx + CPA_D1D * dy + CPA_D1D * CPA_D1D * dz + CPA_D1D * CPA_D1D * CPA_D1D * e]
+  X[dx + D1D * dy + D1D * D1D * dz + D1D * D1D * D1D * e]
 #define cpaY_(dx, dy, dz, e)                                                      \
-  Y[dx + CPA_D1D * dy + CPA_D1D * CPA_D1D * dz + CPA_D1D * CPA_D1D * CPA_D1D * e]
+  Y[dx + D1D * dy + D1D * D1D * dz + D1D * D1D * D1D * e]
 #define cpa_op(qx, qy, qz, d, e)                                       \
-  D[qx + CPA_Q1D * qy + CPA_Q1D * CPA_Q1D * qz + CPA_Q1D * CPA_Q1D * CPA_Q1D * d  +  CPA_VDIM * CPA_Q1D * CPA_Q1D * CPA_Q1D * e]
+  D[qx + Q1D * qy + Q1D * Q1D * qz + Q1D * Q1D * Q1D * d  +  CPA_VDIM * Q1D * Q1D * Q1D * e]
 
 #define CONVECTION3DPA_0_GPU \
-  constexpr int max_D1D = CPA_D1D; \
-  constexpr int max_Q1D = CPA_Q1D; \
+  constexpr int max_D1D = D1D;     \
+  constexpr int max_Q1D = Q1D;     \
   constexpr int max_DQ = (max_Q1D > max_D1D) ? max_Q1D : max_D1D; \
   RAJA_TEAM_SHARED double sm0[max_DQ*max_DQ*max_DQ]; \
   RAJA_TEAM_SHARED double sm1[max_DQ*max_DQ*max_DQ]; \
@@ -247,8 +246,8 @@ Index_type NE = m_NE;
 
 
 #define CONVECTION3DPA_0_CPU \
-  constexpr int max_D1D = CPA_D1D; \
-  constexpr int max_Q1D = CPA_Q1D; \
+  constexpr int max_D1D = D1D;     \
+  constexpr int max_Q1D = Q1D;     \
   constexpr int max_DQ = (max_Q1D > max_D1D) ? max_Q1D : max_D1D; \
   double sm0[max_DQ*max_DQ*max_DQ]; \
   double sm1[max_DQ*max_DQ*max_DQ]; \
@@ -275,7 +274,7 @@ Index_type NE = m_NE;
 #define CONVECTION3DPA_2 \
   double Bu_ = 0.0; \
   double Gu_ = 0.0; \
-  for (int dx = 0; dx < CPA_D1D; ++dx) \
+  for (int dx = 0; dx < D1D; ++dx)     \
   { \
     const double bx = cpa_B(qx,dx); \
     const double gx = cpa_G(qx,dx); \
@@ -290,7 +289,7 @@ Index_type NE = m_NE;
   double BBu_ = 0.0; \
   double GBu_ = 0.0; \
   double BGu_ = 0.0; \
-  for (int dy = 0; dy < CPA_D1D; ++dy) \
+  for (int dy = 0; dy < D1D; ++dy)     \
   { \
     const double bx = cpa_B(qy,dy); \
     const double gx = cpa_G(qy,dy); \
@@ -306,7 +305,7 @@ Index_type NE = m_NE;
   double GBBu_ = 0.0; \
   double BGBu_ = 0.0; \
   double BBGu_ = 0.0; \
-  for (int dz = 0; dz < CPA_D1D; ++dz) \
+  for (int dz = 0; dz < D1D; ++dz)     \
   { \
     const double bx = cpa_B(qz,dz); \
     const double gx = cpa_G(qz,dz); \
@@ -329,7 +328,7 @@ Index_type NE = m_NE;
 
 #define CONVECTION3DPA_6 \
   double BDGu_ = 0.0; \
-  for (int qz = 0; qz < CPA_Q1D; ++qz) \
+  for (int qz = 0; qz < Q1D; ++qz)     \
   { \
     const double w = cpa_Bt(dz,qz); \
     BDGu_ += w * DGu[qz][qy][qx]; \
@@ -338,7 +337,7 @@ Index_type NE = m_NE;
 
 #define CONVECTION3DPA_7 \
   double BBDGu_ = 0.0; \
-  for (int qy = 0; qy < CPA_Q1D; ++qy) \
+  for (int qy = 0; qy < Q1D; ++qy)     \
   { \
     const double w = cpa_Bt(dy,qy); \
     BBDGu_ += w * BDGu[dz][qy][qx]; \
@@ -347,7 +346,7 @@ Index_type NE = m_NE;
 
 #define CONVECTION3DPA_8 \
   double BBBDGu = 0.0; \
-  for (int qx = 0; qx < CPA_Q1D; ++qx) \
+  for (int qx = 0; qx < Q1D; ++qx)     \
   { \
     const double w = cpa_Bt(dx,qx); \
     BBBDGu += w * BBDGu[dz][dy][qx]; \
@@ -381,14 +380,25 @@ public:
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < Index_type D1D, Index_type Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < Index_type D1D, Index_type Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
   void runHipVariantImpl(VariantID vid);
 
 private:
-  static const size_t default_gpu_block_size = CPA_Q1D * CPA_Q1D * CPA_Q1D;
-  using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
+  static const size_t default_order = 2;
+  using fem_orders_type = fem_order::make_list_type<default_order,
+                                                   gpu_block_size::AtMost<8>>;
+
+  // GPU threads per element, Q1D x Q1D x Q1D
+  static constexpr size_t gpuBlockSize(size_t order)
+  {
+    return static_cast<size_t>(fem_order::q1d(order) * fem_order::q1d(order) * fem_order::q1d(order));
+  }
 
   Real_ptr m_B;
   Real_ptr m_Bt;
@@ -400,6 +410,10 @@ private:
 
   Index_type m_NE;
   Index_type m_NE_default;
+
+  Index_type m_order;
+  Index_type m_D1D;
+  Index_type m_Q1D;
 };
 
 } // end namespace apps
@@ -0,0 +1,177 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "COUPLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+  //
+  // Define thread block shape for Hip execution
+  //
+#define i_block_sz (32)
+#define j_block_sz (block_size / i_block_sz)
+#define k_block_sz (1)
+
+#define COUPLE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP \
+  i_block_sz, j_block_sz, k_block_sz
+
+#define COUPLE_THREADS_PER_BLOCK_HIP \
+  dim3 nthreads_per_block(COUPLE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP); \
+  static_assert(i_block_sz*j_block_sz*k_block_sz == block_size, "Invalid block_size");
+
+#define COUPLE_NBLOCKS_HIP \
+  dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(imax-imin, i_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(jmax-jmin, j_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(kmax-kmin, k_block_sz)));
+
+
+template< size_t i_block_size, size_t j_block_size, size_t k_block_size >
+__launch_bounds__(i_block_size*j_block_size*k_block_size)
+__global__ void couple(Complex_ptr t0, Complex_ptr t1, Complex_ptr t2,
+                       Complex_ptr denac, Complex_ptr denlw,
+                       Real_type dt, Real_type c10,
+                       Real_type fratio, Real_type r_fratio,
+                       Real_type c20, Complex_type ireal,
+                       Index_type imin, Index_type imax,
+                       Index_type jmin, Index_type jmax,
+                       Index_type kmin, Index_type kmax)
+{
+  Index_type i = imin + blockIdx.x * i_block_size + threadIdx.x;
+  Index_type j = jmin + blockIdx.y * j_block_size + threadIdx.y;
+  Index_type k = kmin + blockIdx.z;
+
+  if ( i < imax && j < jmax && k < kmax ) {
+    COUPLE_BODY;
+  }
+}
+
+template< size_t i_block_size, size_t j_block_size, size_t k_block_size, typename Lambda >
+__launch_bounds__(i_block_size*j_block_size*k_block_size)
+__global__ void couple_lam(Index_type imin, Index_type imax,
+                           Index_type jmin, Index_type jmax,
+                           Index_type kmin, Index_type kmax,
+                           Lambda body)
+{
+  Index_type i = imin + blockIdx.x * i_block_size + threadIdx.x;
+  Index_type j = jmin + blockIdx.y * j_block_size + threadIdx.y;
+  Index_type k = kmin + blockIdx.z;
+
+  if ( i < imax && j < jmax && k < kmax ) {
+    body(i, j, k);
+  }
+}
+
+
+
+template < size_t block_size >
+void COUPLE::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  COUPLE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      COUPLE_THREADS_PER_BLOCK_HIP;
+      COUPLE_NBLOCKS_HIP;
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((couple<COUPLE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+                         dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         t0, t1, t2, denac, denlw,
+                         dt, c10, fratio, r_fratio,
+                         c20, ireal,
+                         imin, imax,
+                         jmin, jmax,
+                         kmin, kmax);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      COUPLE_THREADS_PER_BLOCK_HIP;
+      COUPLE_NBLOCKS_HIP;
+      constexpr size_t shmem = 0;
+
+      auto couple_lambda = [=] __device__ (Index_type i, Index_type j,
+                                           Index_type k) {
+        COUPLE_BODY;
+      };
+
+      hipLaunchKernelGGL((couple_lam<COUPLE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, decltype(couple_lambda) >),
+                         dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         imin, imax,
+                         jmin, jmax,
+                         kmin, kmax,
+                         couple_lambda);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    using EXEC_POL =
+      RAJA::KernelPolicy<
+        RAJA::statement::HipKernelFixedAsync<i_block_sz * j_block_sz,
+          RAJA::statement::For<2, RAJA::hip_block_z_direct,      // k
+            RAJA::statement::For<1, RAJA::hip_global_size_y_direct<j_block_sz>,   // j
+              RAJA::statement::For<0, RAJA::hip_global_size_x_direct<i_block_sz>, // i
+                RAJA::statement::Lambda<0>
+              >
+            >
+          >
+        >
+      >;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::kernel_resource<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(imin, imax),
+                                               RAJA::RangeSegment(jmin, jmax),
+                                               RAJA::RangeSegment(kmin, kmax)),
+                                       res,
+        [=] __device__ (Index_type i, Index_type j, Index_type k) {
+        COUPLE_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  COUPLE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(COUPLE, Hip)
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
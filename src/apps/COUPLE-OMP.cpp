@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "COUPLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void COUPLE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  COUPLE_DATA_SETUP;
+
+  auto couple_lam = [=](Index_type i, Index_type j, Index_type k) {
+                      COUPLE_BODY;
+                    };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          for (Index_type j = jmin; j < jmax; ++j ) {
+            for (Index_type i = imin; i < imax; ++i ) {
+              COUPLE_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          for (Index_type j = jmin; j < jmax; ++j ) {
+            for (Index_type i = imin; i < imax; ++i ) {
+              couple_lam(i, j, k);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<2, RAJA::omp_parallel_for_exec,  // k
+            RAJA::statement::For<1, RAJA::seq_exec,            // j
+              RAJA::statement::For<0, RAJA::seq_exec,          // i
+                RAJA::statement::Lambda<0>
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(imin, imax),
+                                                 RAJA::RangeSegment(jmin, jmax),
+                                                 RAJA::RangeSegment(kmin, kmax)),
+                                couple_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  COUPLE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "COUPLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void COUPLE::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  COUPLE_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp target is_device_ptr(t0, t1, t2, denac, denlw) device( did )
+      #pragma omp teams distribute parallel for schedule(static, 1) collapse(3)
+      for (Index_type k = kmin ; k < kmax ; ++k ) {
+        for (Index_type j = jmin; j < jmax; ++j ) {
+          for (Index_type i = imin; i < imax; ++i ) {
+            COUPLE_BODY;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    using EXEC_POL =
+      RAJA::KernelPolicy<
+        RAJA::statement::Collapse<RAJA::omp_target_parallel_collapse_exec,
+                                  RAJA::ArgList<2, 1, 0>, // k, j, i
+          RAJA::statement::Lambda<0>
+        >
+      >;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(imin, imax),
+                                               RAJA::RangeSegment(jmin, jmax),
+                                               RAJA::RangeSegment(kmin, kmax)),
+           [=](Index_type i, Index_type j, Index_type k) {
+           COUPLE_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  COUPLE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
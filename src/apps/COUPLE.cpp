@@ -6,14 +6,14 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
-#include "WIP-COUPLE.hpp"
+#include "COUPLE.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
-#include <iostream>
+#include <cmath>
 
 namespace rajaperf
 {
@@ -42,15 +42,31 @@ COUPLE::COUPLE(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (3*sizeof(Complex_type) + 5*sizeof(Complex_type)) * m_domain->n_real_zones );
-  setFLOPsPerRep(0);
+  // sqrt, sin, cos, and division are each counted as one flop
+  setFLOPsPerRep(134 * m_domain->n_real_zones);
 
-  setUsesFeature(Forall);
+  setUsesFeature(Kernel);
+
+  setHasPattern(ComputeBound);
 
   setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
 
   setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
 }
 
 COUPLE::~COUPLE()
@@ -74,112 +90,12 @@ void COUPLE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   m_omegar = 0.9;
   m_dt = 0.208;
   m_c10 = 0.25 * (m_clight / m_csound);
-  m_fratio = sqrt(m_omegar / m_omega0);
+  m_fratio = std::sqrt(m_omegar / m_omega0);
   m_r_fratio = 1.0/m_fratio;
   m_c20 = 0.25 * (m_clight / m_csound) * m_r_fratio;
   m_ireal = Complex_type(0.0, 1.0);
 }
 
-void COUPLE::runKernel(VariantID vid, size_t tune_idx)
-{
-  RAJA_UNUSED_VAR(tune_idx);
-  const Index_type run_reps = getRunReps();
-
-  COUPLE_DATA_SETUP;
-
-  switch ( vid ) {
-
-    case Base_Seq : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        for (Index_type k = kmin ; k < kmax ; ++k ) {
-          COUPLE_BODY;
-        }
-
-      }
-      stopTimer();
-
-      break;
-    }
-
-#if defined(RUN_RAJA_SEQ)
-    case RAJA_Seq : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        RAJA::forall<RAJA::loop_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
-          COUPLE_BODY;
-        });
-
-      }
-      stopTimer();
-
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-    case Base_OpenMP : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        #pragma omp parallel for
-        for (Index_type k = kmin ; k < kmax ; ++k ) {
-          COUPLE_BODY;
-        }
-
-      }
-      stopTimer();
-      break;
-    }
-
-    case RAJA_OpenMP : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
-          COUPLE_BODY;
-        });
-
-      }
-      stopTimer();
-
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_TARGET_OPENMP) && 0
-    case Base_OpenMPTarget :
-    case RAJA_OpenMPTarget :
-    {
-      runOpenMPTargetVariant(vid, tune_idx);
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_CUDA) && 0
-    case Base_CUDA :
-    case RAJA_CUDA :
-    {
-      runCudaVariant(vid, tune_idx);
-      break;
-    }
-#endif
-
-    default : {
-      getCout() << "\n  COUPLE : Unknown variant id = " << vid << std::endl;
-    }
-
-  }
-}
-
 void COUPLE::updateChecksum(VariantID vid, size_t tune_idx)
 {
   Index_type max_loop_index = m_domain->lrn;
@@ -64,6 +64,9 @@
 ///   } /* j loop */
 /// } /* k loop */
 ///
+/// Complex_type is a lightweight complex type usable in device code, see
+/// common/RPComplex.hpp.
+///
 
 #ifndef RAJAPerf_Apps_COUPLE_HPP
 #define RAJAPerf_Apps_COUPLE_HPP
@@ -89,58 +92,50 @@
   const Index_type kmax = m_kmax;
 
 #define COUPLE_BODY \
-for (Index_type j = jmin; j < jmax; j++) { \
- \
-   Index_type it0=    ((k)*(jmax+1) + (j))*(imax+1) ; \
-   Index_type idenac= ((k)*(jmax+2) + (j))*(imax+2) ; \
- \
-   for (Index_type i = imin; i < imax; i++) { \
+  Index_type it0=    ((k)*(jmax+1) + (j))*(imax+1) + (i); \
+  Index_type idenac= ((k)*(jmax+2) + (j))*(imax+2) + (i); \
  \
-      Complex_type c1 = c10 * denac[idenac+i]; \
-      Complex_type c2 = c20 * denlw[it0+i]; \
+  Complex_type c1 = c10 * denac[idenac]; \
+  Complex_type c2 = c20 * denlw[it0]; \
  \
-      /* promote to doubles to avoid possible divide by zero */ \
-      Real_type c1re = real(c1);  Real_type c1im = imag(c1); \
-      Real_type c2re = real(c2);  Real_type c2im = imag(c2); \
+  /* promote to doubles to avoid possible divide by zero */ \
+  Real_type c1re = real(c1);  Real_type c1im = imag(c1); \
+  Real_type c2re = real(c2);  Real_type c2im = imag(c2); \
  \
-      /* lamda = sqrt(|c1|^2 + |c2|^2) uses doubles to avoid underflow. */ \
-      Real_type zlam = c1re*c1re + c1im*c1im + \
-                       c2re*c2re + c2im*c2im + 1.0e-34; \
-      zlam = sqrt(zlam); \
-      Real_type snlamt = sin(zlam * dt * 0.5); \
-      Real_type cslamt = cos(zlam * dt * 0.5); \
+  /* lamda = sqrt(|c1|^2 + |c2|^2) uses doubles to avoid underflow. */ \
+  Real_type zlam = c1re*c1re + c1im*c1im + \
+                   c2re*c2re + c2im*c2im + 1.0e-34; \
+  zlam = sqrt(zlam); \
+  Real_type snlamt = sin(zlam * dt * 0.5); \
+  Real_type cslamt = cos(zlam * dt * 0.5); \
  \
-      Complex_type a0t = t0[it0+i]; \
-      Complex_type a1t = t1[it0+i]; \
-      Complex_type a2t = t2[it0+i] * fratio; \
+  Complex_type a0t = t0[it0]; \
+  Complex_type a1t = t1[it0]; \
+  Complex_type a2t = t2[it0] * fratio; \
  \
-      Real_type r_zlam= 1.0/zlam; \
-      c1 *= r_zlam; \
-      c2 *= r_zlam; \
-      Real_type zac1 = zabs2(c1); \
-      Real_type zac2 = zabs2(c2); \
+  Real_type r_zlam= 1.0/zlam; \
+  c1 *= r_zlam; \
+  c2 *= r_zlam; \
+  Real_type zac1 = zabs2(c1); \
+  Real_type zac2 = zabs2(c2); \
  \
-      /* compute new A0 */ \
-      Complex_type z3 = ( c1 * a1t + c2 * a2t ) * snlamt ; \
-      t0[it0+i] = a0t * cslamt -  ireal * z3; \
+  /* compute new A0 */ \
+  Complex_type z3 = ( c1 * a1t + c2 * a2t ) * snlamt ; \
+  t0[it0] = a0t * cslamt -  ireal * z3; \
  \
-      /* compute new A1  */ \
-      Real_type r = zac1 * cslamt + zac2; \
-      Complex_type z5 = c2 * a2t; \
-      Complex_type z4 = conj(c1) * z5 * (cslamt-1); \
-      z3 = conj(c1) * a0t * snlamt; \
-      t1[it0+i] = a1t * r + z4 - ireal * z3; \
+  /* compute new A1  */ \
+  Real_type r = zac1 * cslamt + zac2; \
+  Complex_type z5 = c2 * a2t; \
+  Complex_type z4 = conj(c1) * z5 * (cslamt-1); \
+  z3 = conj(c1) * a0t * snlamt; \
+  t1[it0] = a1t * r + z4 - ireal * z3; \
  \
-      /* compute new A2  */ \
-      r = zac1 + zac2 * cslamt; \
-      z5 = c1 * a1t; \
-      z4 = conj(c2) * z5 * (cslamt-1); \
-      z3 = conj(c2) * a0t * snlamt; \
-      t2[it0+i] = ( a2t * r + z4 - ireal * z3 ) * r_fratio; \
- \
-   } /* i loop */ \
- \
-} /* j loop */
+  /* compute new A2  */ \
+  r = zac1 + zac2 * cslamt; \
+  z5 = c1 * a1t; \
+  z4 = conj(c2) * z5 * (cslamt-1); \
+  z3 = conj(c2) * a0t * snlamt; \
+  t2[it0] = ( a2t * r + z4 - ireal * z3 ) * r_fratio;
 
 
 #include "common/KernelBase.hpp"
@@ -153,6 +148,15 @@ namespace apps
 {
 class ADomain;
 
+///
+/// Squared magnitude of a complex number.
+///
+RAJA_HOST_DEVICE
+RAJA_INLINE Real_type zabs2(const Complex_type& z)
+{
+  return real(z)*real(z) + imag(z)*imag(z);
+}
+
 class COUPLE : public KernelBase
 {
 public:
@@ -162,17 +166,27 @@ public:
   ~COUPLE();
 
   void setUp(VariantID vid, size_t tune_idx);
-  void runKernel(VariantID vid, size_t tune_idx);
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
 
-  void runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
 
 private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+
   Complex_ptr m_t0;
   Complex_ptr m_t1;
   Complex_ptr m_t2;
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include "AppsData.hpp"
 
@@ -48,7 +49,26 @@ __global__ void deldotvec2d(Real_ptr div,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, typename ptr_type >
+__launch_bounds__(block_size)
+__global__ void deldotvec2d_layout(Real_ptr div,
+                                   const ptr_type x, const ptr_type y,
+                                   const ptr_type xdot, const ptr_type ydot,
+                                   const Index_ptr real_zones,
+                                   const Real_type half, const Real_type ptiny,
+                                   Index_type jp,
+                                   Index_type iend)
+{
+   Index_type ii = blockIdx.x * block_size + threadIdx.x;
+   if (ii < iend) {
+     DEL_DOT_VEC_2D_LAYOUT_NODE_SETUP(ptr_type);
+     DEL_DOT_VEC_2D_BODY_INDEX;
+     DEL_DOT_VEC_2D_BODY;
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void DEL_DOT_VEC_2D::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -107,7 +127,7 @@ void DEL_DOT_VEC_2D::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
          zones, [=] __device__ (Index_type i) {
          DEL_DOT_VEC_2D_BODY;
        });
@@ -120,7 +140,51 @@ void DEL_DOT_VEC_2D::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(DEL_DOT_VEC_2D, Cuda)
+template < size_t block_size, typename ptr_type >
+void DEL_DOT_VEC_2D::runCudaVariantLayoutImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = m_domain->n_real_zones;
+
+  auto res{getCudaResource()};
+
+  DEL_DOT_VEC_2D_LAYOUT_DATA_SETUP(ptr_type);
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+
+      constexpr size_t shmem = 0;
+      deldotvec2d_layout<block_size, ptr_type><<<grid_size, block_size, shmem, res.get_stream()>>>(div,
+                                             x, y, xdot, ydot,
+                                             real_zones,
+                                             half, ptiny,
+                                             jp,
+                                             iend);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  DEL_DOT_VEC_2D : Unknown Cuda layout variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void DEL_DOT_VEC_2D::runCudaVariantLayout(VariantID vid)
+{
+  if ( m_node_layout == NodeLayout::aos ) {
+    runCudaVariantLayoutImpl<block_size, AoSPtr<4>>(vid);
+  } else {
+    runCudaVariantLayoutImpl<block_size, AoSoAPtr<4>>(vid);
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_LAYOUT_TUNING_DEFINE_BOILERPLATE(DEL_DOT_VEC_2D, Cuda, Base_CUDA, RAJA_CUDA)
 
 } // end namespace apps
 } // end namespace rajaperf
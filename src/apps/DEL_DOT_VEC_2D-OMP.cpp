@@ -22,10 +22,53 @@ namespace apps
 {
 
 
+template < typename ptr_type >
+void DEL_DOT_VEC_2D::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  DEL_DOT_VEC_2D_LAYOUT_DATA_SETUP(ptr_type);
+  DEL_DOT_VEC_2D_LAYOUT_NODE_SETUP(ptr_type);
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+        DEL_DOT_VEC_2D_BODY_INDEX;
+        DEL_DOT_VEC_2D_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  DEL_DOT_VEC_2D : Unknown layout variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
 void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( m_node_layout == NodeLayout::aos ) {
+    runOpenMPVariantLayout< AoSPtr<4> >(vid);
+    return;
+  } else if ( m_node_layout == NodeLayout::aosoa ) {
+    runOpenMPVariantLayout< AoSoAPtr<4> >(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -104,5 +147,15 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void DEL_DOT_VEC_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  if ( vid == Base_OpenMP ) {
+    for (const std::string& name : getLayoutTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -34,6 +34,8 @@ namespace apps
 void DEL_DOT_VEC_2D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
@@ -44,13 +46,24 @@ void DEL_DOT_VEC_2D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSE
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(x1,x2,x3,x4, y1,y2,y3,y4, \
-                                       fx1,fx2,fx3,fx4, fy1,fy2,fy3,fy4, \
-                                       div, real_zones) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-        DEL_DOT_VEC_2D_BODY_INDEX;
-        DEL_DOT_VEC_2D_BODY;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x1,x2,x3,x4, y1,y2,y3,y4, \
+                                         fx1,fx2,fx3,fx4, fy1,fy2,fy3,fy4, \
+                                         div, real_zones) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x1,x2,x3,x4, y1,y2,y3,y4, \
+                                         fx1,fx2,fx3,fx4, fy1,fy2,fy3,fy4, \
+                                         div, real_zones) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        }
       }
 
     }
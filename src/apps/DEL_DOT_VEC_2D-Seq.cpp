@@ -22,8 +22,44 @@ namespace apps
 {
 
 
+template < typename ptr_type >
+void DEL_DOT_VEC_2D::runSeqVariantLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  DEL_DOT_VEC_2D_LAYOUT_DATA_SETUP(ptr_type);
+  DEL_DOT_VEC_2D_LAYOUT_NODE_SETUP(ptr_type);
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+        DEL_DOT_VEC_2D_BODY_INDEX;
+        DEL_DOT_VEC_2D_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  DEL_DOT_VEC_2D : Unknown layout variant id = " << vid << std::endl;
+  }
+}
+
 void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
+  if ( m_node_layout == NodeLayout::aos ) {
+    runSeqVariantLayout< AoSPtr<4> >(vid);
+    return;
+  } else if ( m_node_layout == NodeLayout::aosoa ) {
+    runSeqVariantLayout< AoSoAPtr<4> >(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -99,5 +135,15 @@ void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
 }
 
+void DEL_DOT_VEC_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  if ( vid == Base_Seq ) {
+    for (const std::string& name : getLayoutTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
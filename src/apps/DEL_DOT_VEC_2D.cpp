@@ -33,6 +33,9 @@ DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
 
   m_array_length = m_domain->nnalls;
 
+  m_node_layout = NodeLayout::soa;
+  m_x = m_y = m_xdot = m_ydot = m_node_data = nullptr;
+
   setActualProblemSize(m_domain->n_real_zones);
 
   setItsPerRep( getActualProblemSize() );
@@ -44,6 +47,9 @@ DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Stencil);
+  setHasPattern(GatherScatter);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -52,6 +58,8 @@ DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -69,26 +77,73 @@ DEL_DOT_VEC_2D::~DEL_DOT_VEC_2D()
   delete m_domain;
 }
 
-void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
-  allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
-  allocAndInitDataConst(m_real_zones, m_domain->n_real_zones,
-                        static_cast<Index_type>(-1), vid);
-
-  {
-    auto reset_x = scopedMoveData(m_x, m_array_length, vid);
-    auto reset_y = scopedMoveData(m_y, m_array_length, vid);
-    auto reset_rz = scopedMoveData(m_real_zones, m_domain->n_real_zones, vid);
-
-    Real_type dx = 0.2;
-    Real_type dy = 0.1;
-    setMeshPositions_2d(m_x, dx, m_y, dy, *m_domain);
-    setRealZones_2d(m_real_zones, *m_domain);
-  }
+  m_node_layout = getNodeLayout(getVariantTuningName(vid, tune_idx));
+
+  if (m_node_layout == NodeLayout::soa) {
+
+    allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
+    allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
+    allocAndInitDataConst(m_real_zones, m_domain->n_real_zones,
+                          static_cast<Index_type>(-1), vid);
+
+    {
+      auto reset_x = scopedMoveData(m_x, m_array_length, vid);
+      auto reset_y = scopedMoveData(m_y, m_array_length, vid);
+      auto reset_rz = scopedMoveData(m_real_zones, m_domain->n_real_zones, vid);
+
+      Real_type dx = 0.2;
+      Real_type dy = 0.1;
+      setMeshPositions_2d(m_x, dx, m_y, dy, *m_domain);
+      setRealZones_2d(m_real_zones, *m_domain);
+    }
+
+    allocAndInitData(m_xdot, m_array_length, vid);
+    allocAndInitData(m_ydot, m_array_length, vid);
+
+  } else {
+
+    // the node data is initialized per component on the host in the same
+    // order as above, so the values match, and copied into the layout
+    const size_t align = getDataAlignment();
+    Real_ptr x = nullptr;
+    Real_ptr y = nullptr;
+    Real_ptr xdot = nullptr;
+    Real_ptr ydot = nullptr;
+
+    rajaperf::allocAndInitDataConst(DataSpace::Host, x, m_array_length, align, 0.0);
+    rajaperf::allocAndInitDataConst(DataSpace::Host, y, m_array_length, align, 0.0);
+    allocAndInitDataConst(m_real_zones, m_domain->n_real_zones,
+                          static_cast<Index_type>(-1), vid);
+
+    {
+      auto reset_rz = scopedMoveData(m_real_zones, m_domain->n_real_zones, vid);
+
+      Real_type dx = 0.2;
+      Real_type dy = 0.1;
+      setMeshPositions_2d(x, dx, y, dy, *m_domain);
+      setRealZones_2d(m_real_zones, *m_domain);
+    }
+
+    rajaperf::allocAndInitData(DataSpace::Host, xdot, m_array_length, align);
+    rajaperf::allocAndInitData(DataSpace::Host, ydot, m_array_length, align);
+
+    const Index_type node_data_length = getLayoutLength(m_node_layout, 4, m_array_length);
+    allocAndInitDataConst(m_node_data, node_data_length, 0.0, vid);
+    {
+      auto reset_nd = scopedMoveData(m_node_data, node_data_length, vid);
+
+      const Real_ptr comps[4] = {x, y, xdot, ydot};
+      setLayoutData(m_node_data, m_node_layout, comps, 4, m_array_length);
+    }
+
+    rajaperf::deallocData(DataSpace::Host, x);
+    rajaperf::deallocData(DataSpace::Host, y);
+    rajaperf::deallocData(DataSpace::Host, xdot);
+    rajaperf::deallocData(DataSpace::Host, ydot);
 
-  allocAndInitData(m_xdot, m_array_length, vid);
-  allocAndInitData(m_ydot, m_array_length, vid);
+  }
 
   allocAndInitDataConst(m_div, m_array_length, 0.0, vid);
 
@@ -105,11 +160,15 @@ void DEL_DOT_VEC_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 {
   (void) vid;
 
-  deallocData(m_x, vid);
-  deallocData(m_y, vid);
+  if (m_node_layout == NodeLayout::soa) {
+    deallocData(m_x, vid);
+    deallocData(m_y, vid);
+    deallocData(m_xdot, vid);
+    deallocData(m_ydot, vid);
+  } else {
+    deallocData(m_node_data, vid);
+  }
   deallocData(m_real_zones, vid);
-  deallocData(m_xdot, vid);
-  deallocData(m_ydot, vid);
   deallocData(m_div, vid);
 }
 
@@ -36,6 +36,10 @@
 ///   div[i] = dfxdx + dfydy + affine ;
 /// }
 ///
+/// The layout tunings store x, y, xdot, ydot in one array in the aos or
+/// aosoa NodeLayout in AppsData.hpp instead of four arrays, and read them
+/// through AoSPtr or AoSoAPtr views with the same body.
+///
 
 #ifndef RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
 #define RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
@@ -62,6 +66,30 @@
 \
   Index_ptr real_zones = m_real_zones;
 
+#define DEL_DOT_VEC_2D_LAYOUT_DATA_SETUP(ptr_type) \
+  ptr_type x = ptr_type::make(m_node_data, 0); \
+  ptr_type y = ptr_type::make(m_node_data, 1); \
+  ptr_type xdot = ptr_type::make(m_node_data, 2); \
+  ptr_type ydot = ptr_type::make(m_node_data, 3); \
+  Real_ptr div = m_div; \
+\
+  const Real_type ptiny = m_ptiny; \
+  const Real_type half = m_half; \
+  const Index_type jp = m_domain->jp; \
+\
+  Index_ptr real_zones = m_real_zones;
+
+#define DEL_DOT_VEC_2D_LAYOUT_NODE_SETUP(ptr_type) \
+  ptr_type x1,x2,x3,x4 ; \
+  ptr_type y1,y2,y3,y4 ; \
+  ptr_type fx1,fx2,fx3,fx4 ; \
+  ptr_type fy1,fy2,fy3,fy4 ; \
+\
+  NDSET2D(jp, x,x1,x2,x3,x4) ; \
+  NDSET2D(jp, y,y1,y2,y3,y4) ; \
+  NDSET2D(jp, xdot,fx1,fx2,fx3,fx4) ; \
+  NDSET2D(jp, ydot,fy1,fy2,fy3,fy4) ;
+
 #define DEL_DOT_VEC_2D_BODY_INDEX \
   Index_type i = real_zones[ii];
 
@@ -92,6 +120,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "AppsData.hpp"
 
 namespace rajaperf
 {
@@ -99,7 +128,6 @@ class RunParams;
 
 namespace apps
 {
-class ADomain;
 
 class DEL_DOT_VEC_2D : public KernelBase
 {
@@ -119,12 +147,26 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < typename ptr_type >
+  void runSeqVariantLayout(VariantID vid);
+  template < typename ptr_type >
+  void runOpenMPVariantLayout(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantLayout(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantLayout(VariantID vid);
+  template < size_t block_size, typename ptr_type >
+  void runCudaVariantLayoutImpl(VariantID vid);
+  template < size_t block_size, typename ptr_type >
+  void runHipVariantLayoutImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -135,6 +177,9 @@ private:
   Real_ptr m_xdot;
   Real_ptr m_ydot;
   Real_ptr m_div;
+  Real_ptr m_node_data;  // x, y, xdot, ydot in the layout tunings
+
+  NodeLayout m_node_layout;
 
   Real_type m_ptiny;
   Real_type m_half;
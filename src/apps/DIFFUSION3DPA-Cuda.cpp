@@ -22,7 +22,7 @@
 namespace rajaperf {
 namespace apps {
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
   __launch_bounds__(block_size)
 __global__ void Diffusion3DPA(const Real_ptr Basis,
                               const Real_ptr dBasis, const Real_ptr D,
@@ -32,80 +32,80 @@ __global__ void Diffusion3DPA(const Real_ptr Basis,
 
   DIFFUSION3DPA_0_GPU;
 
-  GPU_FOREACH_THREAD(dz, z, DPA_D1D) {
-    GPU_FOREACH_THREAD(dy, y, DPA_D1D) {
-      GPU_FOREACH_THREAD(dx, x, DPA_D1D) {
+  GPU_FOREACH_THREAD(dz, z, D1D) {
+    GPU_FOREACH_THREAD(dy, y, D1D) {
+      GPU_FOREACH_THREAD(dx, x, D1D) {
         DIFFUSION3DPA_1;
       }
     }
   }
 
   if (threadIdx.z == 0) {
-    GPU_FOREACH_THREAD(dy, y, DPA_D1D) {
-      GPU_FOREACH_THREAD(qx, x, DPA_Q1D) {
+    GPU_FOREACH_THREAD(dy, y, D1D) {
+      GPU_FOREACH_THREAD(qx, x, Q1D) {
         DIFFUSION3DPA_2;
       }
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(dz, z, DPA_D1D) {
-    GPU_FOREACH_THREAD(dy, y, DPA_D1D) {
-      GPU_FOREACH_THREAD(qx, x, DPA_Q1D) {
+  GPU_FOREACH_THREAD(dz, z, D1D) {
+    GPU_FOREACH_THREAD(dy, y, D1D) {
+      GPU_FOREACH_THREAD(qx, x, Q1D) {
         DIFFUSION3DPA_3;
       }
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(dz, z, DPA_D1D) {
-    GPU_FOREACH_THREAD(qy, y, DPA_Q1D) {
-      GPU_FOREACH_THREAD(qx, x, DPA_Q1D) {
+  GPU_FOREACH_THREAD(dz, z, D1D) {
+    GPU_FOREACH_THREAD(qy, y, Q1D) {
+      GPU_FOREACH_THREAD(qx, x, Q1D) {
         DIFFUSION3DPA_4;
       }
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(qz, z, DPA_Q1D) {
-    GPU_FOREACH_THREAD(qy, y, DPA_Q1D) {
-      GPU_FOREACH_THREAD(qx, x, DPA_Q1D) {
+  GPU_FOREACH_THREAD(qz, z, Q1D) {
+    GPU_FOREACH_THREAD(qy, y, Q1D) {
+      GPU_FOREACH_THREAD(qx, x, Q1D) {
         DIFFUSION3DPA_5;
       }
     }
   }
   __syncthreads();
   if (threadIdx.z == 0) {
-    GPU_FOREACH_THREAD(d, y, DPA_D1D) {
-      GPU_FOREACH_THREAD(q, x, DPA_Q1D) {
+    GPU_FOREACH_THREAD(d, y, D1D) {
+      GPU_FOREACH_THREAD(q, x, Q1D) {
         DIFFUSION3DPA_6;
       }
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(qz, z, DPA_Q1D) {
-    GPU_FOREACH_THREAD(qy, y, DPA_Q1D) {
-      GPU_FOREACH_THREAD(dx, x, DPA_D1D) {
+  GPU_FOREACH_THREAD(qz, z, Q1D) {
+    GPU_FOREACH_THREAD(qy, y, Q1D) {
+      GPU_FOREACH_THREAD(dx, x, D1D) {
         DIFFUSION3DPA_7;
       }
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(qz, z, DPA_Q1D) {
-    GPU_FOREACH_THREAD(dy, y, DPA_D1D) {
-      GPU_FOREACH_THREAD(dx, x, DPA_D1D) {
+  GPU_FOREACH_THREAD(qz, z, Q1D) {
+    GPU_FOREACH_THREAD(dy, y, D1D) {
+      GPU_FOREACH_THREAD(dx, x, D1D) {
         DIFFUSION3DPA_8;
       }
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(dz, z, DPA_D1D) {
-    GPU_FOREACH_THREAD(dy, y, DPA_D1D) {
-      GPU_FOREACH_THREAD(dx, x, DPA_D1D) {
+  GPU_FOREACH_THREAD(dz, z, D1D) {
+    GPU_FOREACH_THREAD(dy, y, D1D) {
+      GPU_FOREACH_THREAD(dx, x, D1D) {
         DIFFUSION3DPA_9;
       }
     }
   }
 }
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
 void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
@@ -117,13 +117,19 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
   case Base_CUDA: {
 
-    dim3 nthreads_per_block(DPA_Q1D, DPA_Q1D, DPA_Q1D);
+    dim3 nthreads_per_block(Q1D, Q1D, Q1D);
+
+    detail::setCudaFuncSharedMemCarveout(
+        Diffusion3DPA<block_size, D1D, Q1D>, getSharedMemCarveout());
+
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("Diffusion3DPA",
+        Diffusion3DPA<block_size, D1D, Q1D>, Q1D*Q1D*Q1D, 0) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       constexpr size_t shmem = 0;
-      Diffusion3DPA<block_size><<<NE, nthreads_per_block, shmem, res.get_stream()>>>(
+      Diffusion3DPA<block_size, D1D, Q1D><<<NE, nthreads_per_block, shmem, res.get_stream()>>>(
           Basis, dBasis, D, X, Y, symmetric);
 
       cudaErrchk(cudaGetLastError());
@@ -138,26 +144,26 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
     constexpr bool async = true;
 
     using launch_policy =
-        RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, DPA_Q1D*DPA_Q1D*DPA_Q1D>>;
+        RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, Q1D*Q1D*Q1D>>;
 
     using outer_x =
         RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
 
     using inner_x =
-        RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<DPA_Q1D>>;
+        RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<Q1D>>;
 
     using inner_y =
-        RAJA::LoopPolicy<RAJA::cuda_thread_size_y_loop<DPA_Q1D>>;
+        RAJA::LoopPolicy<RAJA::cuda_thread_size_y_loop<Q1D>>;
 
     using inner_z =
-        RAJA::LoopPolicy<RAJA::cuda_thread_size_z_loop<DPA_Q1D>>;
+        RAJA::LoopPolicy<RAJA::cuda_thread_size_z_loop<Q1D>>;
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       RAJA::launch<launch_policy>( res,
           RAJA::LaunchParams(RAJA::Teams(NE),
-                           RAJA::Threads(DPA_Q1D, DPA_Q1D, DPA_Q1D)),
+                           RAJA::Threads(Q1D, Q1D, Q1D)),
           [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
 
           RAJA::loop<outer_x>(ctx, RAJA::RangeSegment(0, NE),
@@ -165,11 +171,11 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
               DIFFUSION3DPA_0_GPU;
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           DIFFUSION3DPA_1;
@@ -185,9 +191,9 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
               RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, 1),
                 [&](int RAJA_UNUSED_ARG(dz)) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           DIFFUSION3DPA_2;
@@ -201,11 +207,11 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           DIFFUSION3DPA_3;
@@ -219,11 +225,11 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                      RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           DIFFUSION3DPA_4;
@@ -237,11 +243,11 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
              ctx.teamSync();
 
-             RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+             RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                [&](int qz) {
-                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                    [&](int qy) {
-                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                        [&](int qx) {
 
                          DIFFUSION3DPA_5;
@@ -257,9 +263,9 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
              RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, 1),
                [&](int RAJA_UNUSED_ARG(dz)) {
-                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                    [&](int d) {
-                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                        [&](int q) {
 
                          DIFFUSION3DPA_6;
@@ -273,11 +279,11 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
              ctx.teamSync();
 
-             RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+             RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                [&](int qz) {
-                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                    [&](int qy) {
-                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                        [&](int dx) {
 
                          DIFFUSION3DPA_7;
@@ -291,11 +297,11 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
              ctx.teamSync();
 
-             RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+             RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                [&](int qz) {
-                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                    [&](int dy) {
-                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                        [&](int dx) {
 
                          DIFFUSION3DPA_8;
@@ -309,11 +315,11 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
 
              ctx.teamSync();
 
-             RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+             RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                [&](int dz) {
-                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                 RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                    [&](int dy) {
-                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                     RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                        [&](int dx) {
 
                          DIFFUSION3DPA_9;
@@ -346,7 +352,7 @@ void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(DIFFUSION3DPA, Cuda)
+RAJAPERF_GPU_FEM_ORDER_TUNING_DEFINE_BOILERPLATE(DIFFUSION3DPA, Cuda)
 
 } // end namespace apps
 } // end namespace rajaperf
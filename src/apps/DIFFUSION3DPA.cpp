@@ -23,42 +23,51 @@ namespace apps
 DIFFUSION3DPA::DIFFUSION3DPA(const RunParams& params)
   : KernelBase(rajaperf::Apps_DIFFUSION3DPA, params)
 {
+  m_order = RAJAPERF_FEM_ORDER_KERNEL_PARAM(default_order);
+  m_D1D = fem_order::d1d(m_order);
+  m_Q1D = fem_order::q1d(m_order);
+
   m_NE_default = 15625;
 
-  setDefaultProblemSize(m_NE_default*DPA_Q1D*DPA_Q1D*DPA_Q1D);
+  // same number of quadrature points for all orders
+  const Index_type default_Q1D = fem_order::q1d(default_order);
+  setDefaultProblemSize(m_NE_default*default_Q1D*default_Q1D*default_Q1D);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(DPA_Q1D*DPA_Q1D*DPA_Q1D), Index_type(1));
+  m_NE = std::max(getTargetProblemSize()/(m_Q1D*m_Q1D*m_Q1D), Index_type(1));
 
-  setActualProblemSize( m_NE*DPA_Q1D*DPA_Q1D*DPA_Q1D );
+  setActualProblemSize( m_NE*m_Q1D*m_Q1D*m_Q1D );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( 2*DPA_Q1D*DPA_D1D*sizeof(Real_type)  +
-                  DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (DPA_Q1D * DPA_D1D +
-                         5 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         15 * DPA_Q1D * DPA_Q1D * DPA_Q1D +
-                         DPA_Q1D * DPA_D1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         3 * DPA_D1D * DPA_D1D * DPA_D1D));
+  setBytesPerRep( 2*m_Q1D*m_D1D*sizeof(Real_type)  +
+                  m_Q1D*m_Q1D*m_Q1D*SYM*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) );
+
+  setFLOPsPerRep(m_NE * (m_Q1D * m_D1D +
+                         5 * m_D1D * m_D1D * m_Q1D * m_D1D +
+                         7 * m_D1D * m_D1D * m_Q1D * m_Q1D +
+                         7 * m_Q1D * m_D1D * m_Q1D * m_Q1D +
+                         15 * m_Q1D * m_Q1D * m_Q1D +
+                         m_Q1D * m_D1D +
+                         7 * m_Q1D * m_Q1D * m_D1D * m_Q1D +
+                         7 * m_Q1D * m_Q1D * m_D1D * m_D1D +
+                         7 * m_D1D * m_Q1D * m_D1D * m_D1D +
+                         3 * m_D1D * m_D1D * m_D1D));
 
   setUsesFeature(Launch);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
   setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesSharedMemCarveout();
   setVariantDefined( Base_CUDA );
   setVariantDefined( RAJA_CUDA );
 
@@ -74,16 +83,16 @@ DIFFUSION3DPA::~DIFFUSION3DPA()
 void DIFFUSION3DPA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 
-  allocAndInitDataConst(m_B, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_G, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(0.0), vid);
+  allocAndInitDataConst(m_B, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_G, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*SYM*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
 }
 
 void DIFFUSION3DPA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_Y, DPA_D1D*DPA_D1D*DPA_D1D*m_NE, vid);
+  checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE, vid);
 }
 
 void DIFFUSION3DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -15,8 +15,8 @@
 ///
 /// for (int e = 0; e < NE; ++e) {
 ///
-///   constexpr int MQ1 = DPA_Q1D;
-///   constexpr int MD1 = DPA_D1D;
+///   constexpr int MQ1 = Q1D;
+///   constexpr int MD1 = D1D;
 ///   constexpr int MDQ = (MQ1 >  ? MQ1 : MD1;
 ///   double sBG[MQ1*MD1];
 ///   double (*B)[MD1] = (double (*)[MD1]) sBG;
@@ -227,18 +227,17 @@ const bool symmetric = true;
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
-#define DPA_D1D 3
-#define DPA_Q1D 4
+// D1D and Q1D, the number of Dofs/Qpts in 1D, are template parameters of
+// the variant implementations, see FEM_MACROS.hpp
 #define SYM 6
-#define b(x, y) Basis[x + DPA_Q1D * y]
-#define g(x, y) dBasis[x + DPA_Q1D * y]
+#define b(x, y) Basis[x + Q1D * y]
+#define g(x, y) dBasis[x + Q1D * y]
 #define dpaX_(dx, dy, dz, e)                                                      \
-  X[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  X[dx + D1D * dy + D1D * D1D * dz + D1D * D1D * D1D * e]
 #define dpaY_(dx, dy, dz, e)                                                      \
-  Y[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  Y[dx + D1D * dy + D1D * D1D * dz + D1D * D1D * D1D * e]
 #define d(qx, qy, qz, s, e)                                                    \
-  D[qx + DPA_Q1D * qy + DPA_Q1D * DPA_Q1D * qz + DPA_Q1D * DPA_Q1D * DPA_Q1D * s  +  DPA_Q1D * DPA_Q1D * DPA_Q1D * SYM * e]
+  D[qx + Q1D * qy + Q1D * Q1D * qz + Q1D * Q1D * Q1D * s  +  Q1D * Q1D * Q1D * SYM * e]
 
 // Half of B and G are stored in shared to get B, Bt, G and Gt.
 // Indices computation for SmemPADiffusionApply3D.
@@ -268,8 +267,8 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 }
 
 #define DIFFUSION3DPA_0_GPU \
-        constexpr int MQ1 = DPA_Q1D; \
-        constexpr int MD1 = DPA_D1D; \
+        constexpr int MQ1 = Q1D;     \
+        constexpr int MD1 = D1D;     \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         RAJA_TEAM_SHARED double sBG[MQ1*MD1]; \
         double (*B)[MD1] = (double (*)[MD1]) sBG; \
@@ -295,8 +294,8 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         double (*QDD2)[MD1][MD1] = (double (*)[MD1][MD1]) (sm0+2);
 
 #define DIFFUSION3DPA_0_CPU \
-        constexpr int MQ1 = DPA_Q1D; \
-        constexpr int MD1 = DPA_D1D; \
+        constexpr int MQ1 = Q1D;     \
+        constexpr int MD1 = D1D;     \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         double sBG[MQ1*MD1]; \
         double (*B)[MD1] = (double (*)[MD1]) sBG; \
@@ -325,22 +324,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         s_X[dz][dy][dx] = dpaX_(dx,dy,dz,e);
 
 #define DIFFUSION3DPA_2 \
-        const int i = qi(qx,dy,DPA_Q1D); \
-        const int j = dj(qx,dy,DPA_D1D); \
-        const int k = qk(qx,dy,DPA_Q1D); \
-        const int l = dl(qx,dy,DPA_D1D); \
+        const int i = qi(qx,dy,Q1D);     \
+        const int j = dj(qx,dy,D1D);     \
+        const int k = qk(qx,dy,Q1D);     \
+        const int l = dl(qx,dy,D1D);     \
         B[i][j] = b(qx,dy); \
         G[k][l] = g(qx,dy) * sign(qx,dy); \
 
 #define DIFFUSION3DPA_3 \
            double u = 0.0, v = 0.0; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dx = 0; dx < DPA_D1D; ++dx) \
+            for (int dx = 0; dx < D1D; ++dx)     \
             { \
-               const int i = qi(qx,dx,DPA_Q1D); \
-               const int j = dj(qx,dx,DPA_D1D); \
-               const int k = qk(qx,dx,DPA_Q1D); \
-               const int l = dl(qx,dx,DPA_D1D); \
+               const int i = qi(qx,dx,Q1D);     \
+               const int j = dj(qx,dx,D1D);     \
+               const int k = qk(qx,dx,Q1D);     \
+               const int l = dl(qx,dx,D1D);     \
                const double s = sign(qx,dx); \
                const double coords = s_X[dz][dy][dx]; \
                u += coords * B[i][j]; \
@@ -352,12 +351,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_4 \
    double u = 0.0, v = 0.0, w = 0.0; \
    RAJAPERF_UNROLL(MD1)  \
-   for (int dy = 0; dy < DPA_D1D; ++dy) \
+   for (int dy = 0; dy < D1D; ++dy)     \
    { \
-      const int i = qi(qy,dy,DPA_Q1D); \
-      const int j = dj(qy,dy,DPA_D1D); \
-      const int k = qk(qy,dy,DPA_Q1D); \
-      const int l = dl(qy,dy,DPA_D1D); \
+      const int i = qi(qy,dy,Q1D);     \
+      const int j = dj(qy,dy,D1D);     \
+      const int k = qk(qy,dy,Q1D);     \
+      const int l = dl(qy,dy,D1D);     \
       const double s = sign(qy,dy); \
       u += DDQ1[dz][dy][qx] * B[i][j]; \
       v += DDQ0[dz][dy][qx] * G[k][l] * s; \
@@ -370,12 +369,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_5 \
                double u = 0.0, v = 0.0, w = 0.0; \
                RAJAPERF_UNROLL(MD1) \
-               for (int dz = 0; dz < DPA_D1D; ++dz) \
+               for (int dz = 0; dz < D1D; ++dz)     \
                { \
-                  const int i = qi(qz,dz,DPA_Q1D); \
-                  const int j = dj(qz,dz,DPA_D1D); \
-                  const int k = qk(qz,dz,DPA_Q1D); \
-                  const int l = dl(qz,dz,DPA_D1D); \
+                  const int i = qi(qz,dz,Q1D);     \
+                  const int j = dj(qz,dz,D1D);     \
+                  const int k = qk(qz,dz,Q1D);     \
+                  const int l = dl(qz,dz,D1D);     \
                   const double s = sign(qz,dz); \
                   u += DQQ0[dz][qy][qx] * B[i][j]; \
                   v += DQQ1[dz][qy][qx] * B[i][j]; \
@@ -398,22 +397,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
                QQQ2[qz][qy][qx] = (O31*gX) + (O32*gY) + (O33*gZ);
 
 #define DIFFUSION3DPA_6 \
-               const int i = qi(q,d,DPA_Q1D); \
-               const int j = dj(q,d,DPA_D1D); \
-               const int k = qk(q,d,DPA_Q1D); \
-               const int l = dl(q,d,DPA_D1D); \
+               const int i = qi(q,d,Q1D);     \
+               const int j = dj(q,d,D1D);     \
+               const int k = qk(q,d,Q1D);     \
+               const int l = dl(q,d,D1D);     \
                Bt[j][i] = b(q,d); \
                Gt[l][k] = g(q,d) * sign(q,d);
 
 #define DIFFUSION3DPA_7 \
             double u = 0.0, v = 0.0, w = 0.0; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qx = 0; qx < DPA_Q1D; ++qx) \
+            for (int qx = 0; qx < Q1D; ++qx)     \
             { \
-              const int i = qi(qx,dx,DPA_Q1D); \
-              const int j = dj(qx,dx,DPA_D1D); \
-              const int k = qk(qx,dx,DPA_Q1D); \
-              const int l = dl(qx,dx,DPA_D1D); \
+              const int i = qi(qx,dx,Q1D);     \
+              const int j = dj(qx,dx,D1D);     \
+              const int k = qk(qx,dx,Q1D);     \
+              const int l = dl(qx,dx,D1D);     \
               const double s = sign(qx,dx); \
               u += QQQ0[qz][qy][qx] * Gt[l][k] * s; \
               v += QQQ1[qz][qy][qx] * Bt[j][i]; \
@@ -425,13 +424,13 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 
 #define DIFFUSION3DPA_8 \
         double u = 0.0, v = 0.0, w = 0.0; \
-        RAJAPERF_UNROLL(DPA_Q1D)  \
-        for (int qy = 0; qy < DPA_Q1D; ++qy) \
+        RAJAPERF_UNROLL(Q1D)      \
+        for (int qy = 0; qy < Q1D; ++qy)     \
         { \
-          const int i = qi(qy,dy,DPA_Q1D); \
-          const int j = dj(qy,dy,DPA_D1D); \
-          const int k = qk(qy,dy,DPA_Q1D); \
-          const int l = dl(qy,dy,DPA_D1D); \
+          const int i = qi(qy,dy,Q1D);     \
+          const int j = dj(qy,dy,D1D);     \
+          const int k = qk(qy,dy,Q1D);     \
+          const int l = dl(qy,dy,D1D);     \
           const double s = sign(qy,dy); \
           u += QQD0[qz][qy][dx] * Bt[j][i]; \
           v += QQD1[qz][qy][dx] * Gt[l][k] * s; \
@@ -444,12 +443,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_9 \
         double u = 0.0, v = 0.0, w = 0.0; \
         RAJAPERF_UNROLL(MQ1) \
-        for (int qz = 0; qz < DPA_Q1D; ++qz)  \
+        for (int qz = 0; qz < Q1D; ++qz)      \
         {                                     \
-          const int i = qi(qz,dz,DPA_Q1D); \
-          const int j = dj(qz,dz,DPA_D1D); \
-          const int k = qk(qz,dz,DPA_Q1D); \
-          const int l = dl(qz,dz,DPA_D1D); \
+          const int i = qi(qz,dz,Q1D);     \
+          const int j = dj(qz,dz,D1D);     \
+          const int k = qk(qz,dz,Q1D);     \
+          const int l = dl(qz,dz,D1D);     \
           const double s = sign(qz,dz);    \
           u += QDD0[qz][dy][dx] * Bt[j][i];     \
           v += QDD1[qz][dy][dx] * Bt[j][i];     \
@@ -484,14 +483,25 @@ public:
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < Index_type D1D, Index_type Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < Index_type D1D, Index_type Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
   void runHipVariantImpl(VariantID vid);
 
 private:
-  static const size_t default_gpu_block_size = DPA_Q1D * DPA_Q1D * DPA_Q1D;
-  using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
+  static const size_t default_order = 2;
+  using fem_orders_type = fem_order::make_list_type<default_order,
+                                                   gpu_block_size::AtMost<8>>;
+
+  // GPU threads per element, Q1D x Q1D x Q1D
+  static constexpr size_t gpuBlockSize(size_t order)
+  {
+    return static_cast<size_t>(fem_order::q1d(order) * fem_order::q1d(order) * fem_order::q1d(order));
+  }
 
   Real_ptr m_B;
   Real_ptr m_Bt;
@@ -503,6 +513,10 @@ private:
 
   Index_type m_NE;
   Index_type m_NE_default;
+
+  Index_type m_order;
+  Index_type m_D1D;
+  Index_type m_Q1D;
 };
 
 } // end namespace apps
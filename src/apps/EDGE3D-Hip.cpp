@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include "AppsData.hpp"
 
@@ -23,21 +24,21 @@ namespace rajaperf
 namespace apps
 {
 
-template < size_t block_size >
-__launch_bounds__(block_size)
+template < size_t block_size, size_t min_blocks = 1, typename ptr_type = Real_ptr >
+__launch_bounds__(block_size, gpu_min_blocks::hip_min_waves_per_eu(block_size, min_blocks))
 __global__ void edge3d(Real_ptr sum,
-                       const Real_ptr x0, const Real_ptr x1,
-                       const Real_ptr x2, const Real_ptr x3,
-                       const Real_ptr x4, const Real_ptr x5,
-                       const Real_ptr x6, const Real_ptr x7,
-                       const Real_ptr y0, const Real_ptr y1,
-                       const Real_ptr y2, const Real_ptr y3,
-                       const Real_ptr y4, const Real_ptr y5,
-                       const Real_ptr y6, const Real_ptr y7,
-                       const Real_ptr z0, const Real_ptr z1,
-                       const Real_ptr z2, const Real_ptr z3,
-                       const Real_ptr z4, const Real_ptr z5,
-                       const Real_ptr z6, const Real_ptr z7,
+                       const ptr_type x0, const ptr_type x1,
+                       const ptr_type x2, const ptr_type x3,
+                       const ptr_type x4, const ptr_type x5,
+                       const ptr_type x6, const ptr_type x7,
+                       const ptr_type y0, const ptr_type y1,
+                       const ptr_type y2, const ptr_type y3,
+                       const ptr_type y4, const ptr_type y5,
+                       const ptr_type y6, const ptr_type y7,
+                       const ptr_type z0, const ptr_type z1,
+                       const ptr_type z2, const ptr_type z3,
+                       const ptr_type z4, const ptr_type z5,
+                       const ptr_type z6, const ptr_type z7,
                        Index_type ibegin, Index_type iend)
 {
   Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
@@ -47,7 +48,77 @@ __global__ void edge3d(Real_ptr sum,
 }
 
 
+template < size_t block_size, typename ptr_type >
+__launch_bounds__(block_size)
+__global__ void edge3d_layout(Real_ptr sum,
+                              const ptr_type x, const ptr_type y, const ptr_type z,
+                              Index_type jp, Index_type kp,
+                              Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    EDGE3D_LAYOUT_NODE_SETUP(ptr_type);
+    EDGE3D_BODY;
+  }
+}
+
+
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void edge3d_node_tile(Real_ptr sum,
+                      const Real_ptr x, const Real_ptr y, const Real_ptr z,
+                      Index_type jp, Index_type kp, Index_type nnodes,
+                      Index_type ibegin, Index_type iend)
+{
+  static_assert(node_tile_x*node_tile_y*node_tile_z == block_size,
+                "node tile must have one zone per thread");
+
+  constexpr Index_type tjp = node_tile_x + 1;
+  constexpr Index_type tkp = tjp * (node_tile_y + 1);
+  constexpr Index_type tlen = tkp * (node_tile_z + 1);
+
+  __shared__ Real_type xs[tlen];
+  __shared__ Real_type ys[tlen];
+  __shared__ Real_type zs[tlen];
+
+  const Index_type origin = blockIdx.x * node_tile_x +
+                            blockIdx.y * node_tile_y * jp +
+                            blockIdx.z * node_tile_z * kp;
+
+  // stage the nodes of the tile and its halo
+  for (Index_type t = threadIdx.x + threadIdx.y * node_tile_x +
+                      threadIdx.z * node_tile_x * node_tile_y;
+       t < tlen; t += block_size) {
+    const Index_type n = origin + t % tjp +
+                         ((t / tjp) % (node_tile_y + 1)) * jp +
+                         (t / tkp) * kp;
+    xs[t] = (n < nnodes) ? x[n] : 0.0;
+    ys[t] = (n < nnodes) ? y[n] : 0.0;
+    zs[t] = (n < nnodes) ? z[n] : 0.0;
+  }
+  __syncthreads();
+
+  const Index_type ti = blockIdx.x * node_tile_x + threadIdx.x;
+  const Index_type tj = blockIdx.y * node_tile_y + threadIdx.y;
+  const Index_type i = origin + threadIdx.x + threadIdx.y * jp + threadIdx.z * kp;
+  if (ti < jp && tj * jp < kp && i >= ibegin && i < iend) {
+    const Index_type li = threadIdx.x + threadIdx.y * tjp + threadIdx.z * tkp;
+
+    Real_ptr x0,x1,x2,x3,x4,x5,x6,x7 ;
+    Real_ptr y0,y1,y2,y3,y4,y5,y6,y7 ;
+    Real_ptr z0,z1,z2,z3,z4,z5,z6,z7 ;
+
+    NDPTRSET(tjp, tkp, xs,x0,x1,x2,x3,x4,x5,x6,x7) ;
+    NDPTRSET(tjp, tkp, ys,y0,y1,y2,y3,y4,y5,y6,y7) ;
+    NDPTRSET(tjp, tkp, zs,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+    EDGE3D_BODY_NODES(li);
+    EDGE3D_BODY_ZONE(i);
+  }
+}
+
+
+template < size_t block_size, size_t min_blocks, bool launch >
 void EDGE3D::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -60,13 +131,15 @@ void EDGE3D::runHipVariantImpl(VariantID vid)
 
   if ( vid == Base_HIP ) {
 
+    setGPUFuncAttributes( detail::getHipFuncAttributes("edge3d", edge3d<block_size, min_blocks>, block_size, 0) );
+
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
 
-      hipLaunchKernelGGL((edge3d<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), sum,
+      hipLaunchKernelGGL((edge3d<block_size, min_blocks>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), sum,
                                        x0, x1, x2, x3, x4, x5, x6, x7,
                                        y0, y1, y2, y3, y4, y5, y6, y7,
                                        z0, z1, z2, z3, z4, z5, z6, z7,
@@ -100,7 +173,7 @@ void EDGE3D::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         EDGE3D_BODY;
       });
@@ -113,7 +186,226 @@ void EDGE3D::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(EDGE3D, Hip)
+template < size_t block_size >
+void EDGE3D::runHipVariantReadOnly(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  auto res{getHipResource()};
+
+  EDGE3D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    setGPUFuncAttributes( detail::getHipFuncAttributes("edge3d", edge3d<block_size, 1, ReadOnlyPtr<Real_type>>, block_size, 0) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((edge3d<block_size, 1, ReadOnlyPtr<Real_type>>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), sum,
+                                       x0, x1, x2, x3, x4, x5, x6, x7,
+                                       y0, y1, y2, y3, y4, y5, y6, y7,
+                                       z0, z1, z2, z3, z4, z5, z6, z7,
+                                       ibegin, iend);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  EDGE3D : Unknown Hip read only variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size, typename ptr_type >
+void EDGE3D::runHipVariantLayoutImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  auto res{getHipResource()};
+
+  EDGE3D_LAYOUT_DATA_SETUP(ptr_type);
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((edge3d_layout<block_size, ptr_type>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), sum,
+                                       x, y, z,
+                                       jp, kp,
+                                       ibegin, iend);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  EDGE3D : Unknown Hip layout variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void EDGE3D::runHipVariantNodeTile(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  auto res{getHipResource()};
+
+  EDGE3D_DATA_SETUP;
+
+  const Index_type jp = m_domain->jp;
+  const Index_type kp = m_domain->kp;
+  const Index_type nnodes = m_array_length;
+
+  if ( vid == Base_HIP ) {
+
+    setGPUFuncAttributes( detail::getHipFuncAttributes("edge3d_node_tile", edge3d_node_tile<block_size>, block_size, 0) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const dim3 nthreads(node_tile_x, node_tile_y, node_tile_z);
+      const dim3 nblocks(RAJA_DIVIDE_CEILING_INT(jp, node_tile_x),
+                         RAJA_DIVIDE_CEILING_INT(kp/jp, node_tile_y),
+                         RAJA_DIVIDE_CEILING_INT(nnodes/kp, node_tile_z));
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((edge3d_node_tile<block_size>), dim3(nblocks), dim3(nthreads), shmem, res.get_stream(), sum,
+                                       x, y, z,
+                                       jp, kp, nnodes,
+                                       ibegin, iend);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  EDGE3D : Unknown Hip node tile variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void EDGE3D::runHipVariantLayout(VariantID vid)
+{
+  if ( m_node_layout == NodeLayout::aos ) {
+    runHipVariantLayoutImpl<block_size, AoSPtr<3>>(vid);
+  } else {
+    runHipVariantLayoutImpl<block_size, AoSoAPtr<3>>(vid);
+  }
+}
+
+void EDGE3D::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    RAJAPERF_GPU_MIN_BLOCKS_TUNING_RUN(Hip, Impl)
+
+    RAJAPERF_GPU_READ_ONLY_TUNING_RUN(Hip, ReadOnly)
+
+    for (size_t o = 0; o < getLayoutTuningNames().size(); ++o) {
+      if (tune_idx == t) {
+        setBlockSize(default_gpu_block_size);
+        runHipVariantLayout<default_gpu_block_size>(vid);
+      }
+      t += 1;
+    }
+
+    if (tune_idx == t) {
+      setBlockSize(default_gpu_block_size);
+      runHipVariantNodeTile<default_gpu_block_size>(vid);
+    }
+    t += 1;
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runHipVariantImpl<block_size, 1, true>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+}
+
+void EDGE3D::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    RAJAPERF_GPU_MIN_BLOCKS_TUNING_NAMES
+
+    RAJAPERF_GPU_READ_ONLY_TUNING_NAMES
+
+    for (const std::string& name : getLayoutTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+
+    addVariantTuningName(vid, getNodeTileTuningName());
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -20,10 +20,52 @@ namespace apps
 {
 
 
+template < typename ptr_type >
+void EDGE3D::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  EDGE3D_LAYOUT_DATA_SETUP(ptr_type);
+  EDGE3D_LAYOUT_NODE_SETUP(ptr_type);
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (Index_type i = ibegin ; i < iend ; ++i ) {
+        EDGE3D_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  EDGE3D : Unknown layout variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
 void EDGE3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( m_node_layout == NodeLayout::aos ) {
+    runOpenMPVariantLayout< AoSPtr<3> >(vid);
+    return;
+  } else if ( m_node_layout == NodeLayout::aosoa ) {
+    runOpenMPVariantLayout< AoSoAPtr<3> >(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = m_domain->fpz;
   const Index_type iend = m_domain->lpz+1;
@@ -96,5 +138,15 @@ void EDGE3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #endif
 }
 
+void EDGE3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  if ( vid == Base_OpenMP ) {
+    for (const std::string& name : getLayoutTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
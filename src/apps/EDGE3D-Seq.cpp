@@ -20,8 +20,43 @@ namespace apps
 {
 
 
+template < typename ptr_type >
+void EDGE3D::runSeqVariantLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  EDGE3D_LAYOUT_DATA_SETUP(ptr_type);
+  EDGE3D_LAYOUT_NODE_SETUP(ptr_type);
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type i = ibegin ; i < iend ; ++i ) {
+        EDGE3D_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  EDGE3D : Unknown layout variant id = " << vid << std::endl;
+  }
+}
+
 void EDGE3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
+  if ( m_node_layout == NodeLayout::aos ) {
+    runSeqVariantLayout< AoSPtr<3> >(vid);
+    return;
+  } else if ( m_node_layout == NodeLayout::aosoa ) {
+    runSeqVariantLayout< AoSoAPtr<3> >(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = m_domain->fpz;
   const Index_type iend = m_domain->lpz+1;
@@ -88,5 +123,15 @@ void EDGE3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void EDGE3D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  if ( vid == Base_Seq ) {
+    for (const std::string& name : getLayoutTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
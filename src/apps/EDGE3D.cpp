@@ -14,6 +14,7 @@
 #include "common/DataUtils.hpp"
 
 #include <cmath>
+#include <vector>
 
 
 namespace rajaperf
@@ -31,6 +32,9 @@ EDGE3D::EDGE3D(const RunParams& params)
   m_domain = new ADomain(rzmax, /* ndims = */ 3);
 
   m_array_length = m_domain->nnalls;
+
+  m_node_layout = NodeLayout::soa;
+  m_x = m_y = m_z = m_xyz = nullptr;
   size_t number_of_elements = m_domain->lpz+1 - m_domain->fpz;
 
   setActualProblemSize( number_of_elements );
@@ -65,6 +69,8 @@ EDGE3D::EDGE3D(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -73,6 +79,8 @@ EDGE3D::EDGE3D(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -90,21 +98,41 @@ EDGE3D::~EDGE3D()
   delete m_domain;
 }
 
-void EDGE3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void EDGE3D::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_x, m_array_length, Real_type(0.0), vid);
-  allocAndInitDataConst(m_y, m_array_length, Real_type(0.0), vid);
-  allocAndInitDataConst(m_z, m_array_length, Real_type(0.0), vid);
+  Real_type dx = 0.3;
+  Real_type dy = 0.2;
+  Real_type dz = 0.1;
+
+  m_node_layout = getNodeLayout(getVariantTuningName(vid, tune_idx));
+
+  if (m_node_layout == NodeLayout::soa) {
+
+    allocAndInitDataConst(m_x, m_array_length, Real_type(0.0), vid);
+    allocAndInitDataConst(m_y, m_array_length, Real_type(0.0), vid);
+    allocAndInitDataConst(m_z, m_array_length, Real_type(0.0), vid);
 
-  {
     auto reset_x = scopedMoveData(m_x, m_array_length, vid);
     auto reset_y = scopedMoveData(m_y, m_array_length, vid);
     auto reset_z = scopedMoveData(m_z, m_array_length, vid);
 
-    Real_type dx = 0.3;
-    Real_type dy = 0.2;
-    Real_type dz = 0.1;
     setMeshPositions_3d(m_x, dx, m_y, dy, m_z, dz, *m_domain);
+
+  } else {
+
+    // the positions are set per component and copied into the layout
+    std::vector<Real_type> x(m_array_length, 0.0);
+    std::vector<Real_type> y(m_array_length, 0.0);
+    std::vector<Real_type> z(m_array_length, 0.0);
+    setMeshPositions_3d(x.data(), dx, y.data(), dy, z.data(), dz, *m_domain);
+
+    const Index_type xyz_length = getLayoutLength(m_node_layout, 3, m_array_length);
+    allocAndInitDataConst(m_xyz, xyz_length, Real_type(0.0), vid);
+    auto reset_xyz = scopedMoveData(m_xyz, xyz_length, vid);
+
+    const Real_ptr comps[3] = {x.data(), y.data(), z.data()};
+    setLayoutData(m_xyz, m_node_layout, comps, 3, m_array_length);
+
   }
 
   allocAndInitDataConst(m_sum, m_array_length, Real_type(0.0), vid);
@@ -117,9 +145,13 @@ void EDGE3D::updateChecksum(VariantID vid, size_t tune_idx)
 
 void EDGE3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  deallocData(m_x, vid);
-  deallocData(m_y, vid);
-  deallocData(m_z, vid);
+  if (m_node_layout == NodeLayout::soa) {
+    deallocData(m_x, vid);
+    deallocData(m_y, vid);
+    deallocData(m_z, vid);
+  } else {
+    deallocData(m_xyz, vid);
+  }
 
   deallocData(m_sum, vid);
 }
@@ -184,6 +184,15 @@
 ///     sum[i] += check;
 ///   }
 /// }
+///
+/// The layout tunings store x, y, z in one array in the aos or aosoa
+/// NodeLayout in AppsData.hpp instead of three arrays, and read them
+/// through AoSPtr or AoSoAPtr views with the same body.
+/// The node tile tunings of the Base GPU variants stage the nodes of each
+/// block's 3D tile of zones, with its halo, in shared memory and run
+/// BODY_NODES on the shared copy and BODY_ZONE on the zone.
+/// The ldg tunings of the Base GPU variants read the node coordinates
+/// through ReadOnlyPtr, which loads them through the read-only data cache.
 
 #ifndef RAJAPerf_Apps_EDGE3D_HPP
 #define RAJAPerf_Apps_EDGE3D_HPP
@@ -374,10 +383,30 @@ RAJA_INLINE void edge_MpSmatrix(
   NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ; \
   NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
 
-#define EDGE3D_BODY \
-  rajaperf::Real_type X[NB] = {x0[i],x1[i],x2[i],x3[i],x4[i],x5[i],x6[i],x7[i]};\
-  rajaperf::Real_type Y[NB] = {y0[i],y1[i],y2[i],y3[i],y4[i],y5[i],y6[i],y7[i]};\
-  rajaperf::Real_type Z[NB] = {z0[i],z1[i],z2[i],z3[i],z4[i],z5[i],z6[i],z7[i]};\
+#define EDGE3D_LAYOUT_DATA_SETUP(ptr_type) \
+  ptr_type x = ptr_type::make(m_xyz, 0); \
+  ptr_type y = ptr_type::make(m_xyz, 1); \
+  ptr_type z = ptr_type::make(m_xyz, 2); \
+  Real_ptr sum = m_sum; \
+\
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp;
+
+#define EDGE3D_LAYOUT_NODE_SETUP(ptr_type) \
+  ptr_type x0,x1,x2,x3,x4,x5,x6,x7 ; \
+  ptr_type y0,y1,y2,y3,y4,y5,y6,y7 ; \
+  ptr_type z0,z1,z2,z3,z4,z5,z6,z7 ; \
+\
+  NDPTRSET(jp, kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ; \
+  NDPTRSET(jp, kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ; \
+  NDPTRSET(jp, kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+#define EDGE3D_BODY_NODES(n) \
+  rajaperf::Real_type X[NB] = {x0[n],x1[n],x2[n],x3[n],x4[n],x5[n],x6[n],x7[n]};\
+  rajaperf::Real_type Y[NB] = {y0[n],y1[n],y2[n],y3[n],y4[n],y5[n],y6[n],y7[n]};\
+  rajaperf::Real_type Z[NB] = {z0[n],z1[n],z2[n],z3[n],z4[n],z5[n],z6[n],z7[n]};
+
+#define EDGE3D_BODY_ZONE(i) \
   rajaperf::Real_type edge_matrix[EB][EB];\
   edge_MpSmatrix(X, Y, Z, 1.0, 1.0, 0.0, 1.0, NQ_1D, edge_matrix);\
   rajaperf::Real_type local_sum = 0.0;\
@@ -388,9 +417,14 @@ RAJA_INLINE void edge_MpSmatrix(
     }\
     local_sum += check;\
   }\
-  sum[i] = local_sum;\
+  sum[i] = local_sum;
+
+#define EDGE3D_BODY \
+  EDGE3D_BODY_NODES(i) \
+  EDGE3D_BODY_ZONE(i)
 
 #include "common/KernelBase.hpp"
+#include "AppsData.hpp"
 
 namespace rajaperf
 {
@@ -398,7 +432,6 @@ class RunParams;
 
 namespace apps
 {
-class ADomain;
 
 class EDGE3D : public KernelBase
 {
@@ -418,12 +451,34 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, size_t min_blocks = 1, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, size_t min_blocks = 1, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantReadOnly(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantReadOnly(VariantID vid);
+  template < typename ptr_type >
+  void runSeqVariantLayout(VariantID vid);
+  template < typename ptr_type >
+  void runOpenMPVariantLayout(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantLayout(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantLayout(VariantID vid);
+  template < size_t block_size, typename ptr_type >
+  void runCudaVariantLayoutImpl(VariantID vid);
+  template < size_t block_size, typename ptr_type >
+  void runHipVariantLayoutImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantNodeTile(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantNodeTile(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -433,6 +488,9 @@ private:
   Real_ptr m_y;
   Real_ptr m_z;
   Real_ptr m_sum;
+  Real_ptr m_xyz;
+
+  NodeLayout m_node_layout;
 
   ADomain* m_domain;
   Index_type m_array_length;
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -106,8 +107,56 @@ __global__ void energycalc6(Real_ptr delvc,
    }
 }
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void energycalc2_fast_math(Real_ptr delvc, Real_ptr q_new,
+                                      Real_ptr compHalfStep, Real_ptr pHalfStep,
+                                      Real_ptr e_new, Real_ptr bvc, Real_ptr pbvc,
+                                      Real_ptr ql_old, Real_ptr qq_old,
+                                      Real_type rho0,
+                                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     ENERGY_BODY2_FAST_MATH;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void energycalc5_fast_math(Real_ptr delvc,
+                                      Real_ptr pbvc, Real_ptr e_new, Real_ptr vnewc,
+                                      Real_ptr bvc, Real_ptr p_new,
+                                      Real_ptr ql_old, Real_ptr qq_old,
+                                      Real_ptr p_old, Real_ptr q_old,
+                                      Real_ptr pHalfStep, Real_ptr q_new,
+                                      Real_type rho0, Real_type e_cut, Real_type emin,
+                                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     ENERGY_BODY5_FAST_MATH;
+   }
+}
 
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void energycalc6_fast_math(Real_ptr delvc,
+                                      Real_ptr pbvc, Real_ptr e_new, Real_ptr vnewc,
+                                      Real_ptr bvc, Real_ptr p_new,
+                                      Real_ptr q_new,
+                                      Real_ptr ql_old, Real_ptr qq_old,
+                                      Real_type rho0, Real_type q_cut,
+                                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     ENERGY_BODY6_FAST_MATH;
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void ENERGY::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -174,39 +223,38 @@ void ENERGY::runHipVariantImpl(VariantID vid)
 
   } else if ( vid == RAJA_HIP ) {
 
-    const bool async = true;
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       RAJA::region<RAJA::seq_region>( [=]() {
 
-        RAJA::forall< RAJA::hip_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           ENERGY_BODY1;
         });
 
-        RAJA::forall< RAJA::hip_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           ENERGY_BODY2;
         });
 
-        RAJA::forall< RAJA::hip_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           ENERGY_BODY3;
         });
 
-        RAJA::forall< RAJA::hip_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           ENERGY_BODY4;
         });
 
-        RAJA::forall< RAJA::hip_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           ENERGY_BODY5;
         });
 
-        RAJA::forall< RAJA::hip_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           ENERGY_BODY6;
         });
@@ -221,7 +269,134 @@ void ENERGY::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(ENERGY, Hip)
+template < size_t block_size >
+void ENERGY::runHipVariantFastMath(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  ENERGY_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       hipLaunchKernelGGL((energycalc1<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  e_new, e_old, delvc,
+                                               p_old, q_old, work,
+                                               iend );
+       hipErrchk( hipGetLastError() );
+
+       hipLaunchKernelGGL((energycalc2_fast_math<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  delvc, q_new,
+                                               compHalfStep, pHalfStep,
+                                               e_new, bvc, pbvc,
+                                               ql_old, qq_old,
+                                               rho0,
+                                               iend );
+       hipErrchk( hipGetLastError() );
+
+       hipLaunchKernelGGL((energycalc3<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  e_new, delvc,
+                                               p_old, q_old,
+                                               pHalfStep, q_new,
+                                               iend );
+       hipErrchk( hipGetLastError() );
+
+       hipLaunchKernelGGL((energycalc4<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  e_new, work,
+                                               e_cut, emin,
+                                               iend );
+       hipErrchk( hipGetLastError() );
+
+       hipLaunchKernelGGL((energycalc5_fast_math<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  delvc,
+                                               pbvc, e_new, vnewc,
+                                               bvc, p_new,
+                                               ql_old, qq_old,
+                                               p_old, q_old,
+                                               pHalfStep, q_new,
+                                               rho0, e_cut, emin,
+                                               iend );
+       hipErrchk( hipGetLastError() );
+
+       hipLaunchKernelGGL((energycalc6_fast_math<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  delvc,
+                                               pbvc, e_new, vnewc,
+                                               bvc, p_new,
+                                               q_new,
+                                               ql_old, qq_old,
+                                               rho0, q_cut,
+                                               iend );
+       hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ENERGY : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void ENERGY::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    RAJAPERF_GPU_FAST_MATH_TUNING_RUN(Hip, FastMath)
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Hip, Impl, )
+
+  }
+
+}
+
+void ENERGY::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    RAJAPERF_GPU_FAST_MATH_TUNING_NAMES
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -30,6 +30,8 @@ namespace apps
 void ENERGY::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -40,48 +42,104 @@ void ENERGY::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(e_new, e_old, delvc, \
-                                       p_old, q_old, work) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        ENERGY_BODY1;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(e_new, e_old, delvc, \
+                                         p_old, q_old, work) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
+      } else {
+        #pragma omp target is_device_ptr(e_new, e_old, delvc, \
+                                         p_old, q_old, work) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
       }
 
-      #pragma omp target is_device_ptr(delvc, q_new, compHalfStep, \
-                                       pHalfStep, e_new, bvc, pbvc, \
-                                       ql_old, qq_old) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        ENERGY_BODY2;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(delvc, q_new, compHalfStep, \
+                                         pHalfStep, e_new, bvc, pbvc, \
+                                         ql_old, qq_old) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2;
+        }
+      } else {
+        #pragma omp target is_device_ptr(delvc, q_new, compHalfStep, \
+                                         pHalfStep, e_new, bvc, pbvc, \
+                                         ql_old, qq_old) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2;
+        }
       }
 
-      #pragma omp target is_device_ptr(e_new, delvc, p_old, \
-                                       q_old, pHalfStep, q_new) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        ENERGY_BODY3;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(e_new, delvc, p_old, \
+                                         q_old, pHalfStep, q_new) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
+      } else {
+        #pragma omp target is_device_ptr(e_new, delvc, p_old, \
+                                         q_old, pHalfStep, q_new) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
       }
 
-      #pragma omp target is_device_ptr(e_new, work) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        ENERGY_BODY4;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(e_new, work) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
+      } else {
+        #pragma omp target is_device_ptr(e_new, work) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
       }
 
-      #pragma omp target is_device_ptr(delvc, pbvc, e_new, vnewc, \
-                                       bvc, p_new, ql_old, qq_old, \
-                                       p_old, q_old, pHalfStep, q_new) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        ENERGY_BODY5;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(delvc, pbvc, e_new, vnewc, \
+                                         bvc, p_new, ql_old, qq_old, \
+                                         p_old, q_old, pHalfStep, q_new) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5;
+        }
+      } else {
+        #pragma omp target is_device_ptr(delvc, pbvc, e_new, vnewc, \
+                                         bvc, p_new, ql_old, qq_old, \
+                                         p_old, q_old, pHalfStep, q_new) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5;
+        }
       }
 
-      #pragma omp target is_device_ptr(delvc, pbvc, e_new, vnewc, \
-                                       bvc, p_new, q_new, ql_old, qq_old) \
-                                       device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        ENERGY_BODY6;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(delvc, pbvc, e_new, vnewc, \
+                                         bvc, p_new, q_new, ql_old, qq_old) \
+                                         device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6;
+        }
+      } else {
+        #pragma omp target is_device_ptr(delvc, pbvc, e_new, vnewc, \
+                                         bvc, p_new, q_new, ql_old, qq_old) \
+                                         device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6;
+        }
       }
 
     }
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SimdUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,8 +20,191 @@ namespace apps
 {
 
 
-void ENERGY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ENERGY::runSeqVariantSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ENERGY_DATA_SETUP;
+
+#if defined(RUN_RAJA_SEQ)
+  auto energy_lam1 = [=](Index_type i) {
+                       ENERGY_BODY1;
+                     };
+  auto energy_lam2 = [=](Index_type i) {
+                       ENERGY_BODY2;
+                     };
+  auto energy_lam3 = [=](Index_type i) {
+                       ENERGY_BODY3;
+                     };
+  auto energy_lam4 = [=](Index_type i) {
+                       ENERGY_BODY4;
+                     };
+  auto energy_lam5 = [=](Index_type i) {
+                       ENERGY_BODY5;
+                     };
+  auto energy_lam6 = [=](Index_type i) {
+                       ENERGY_BODY6;
+                     };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::seq_region>( [=]() {
+
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam1);
+
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam2);
+
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam3);
+
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam4);
+
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam5);
+
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam6);
+
+        }); // end sequential region (for single-source code)
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  ENERGY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void ENERGY::runSeqVariantFastMath(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ENERGY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2_FAST_MATH;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5_FAST_MATH;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6_FAST_MATH;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ENERGY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void ENERGY::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd(vid);
+    return;
+  }
+  if ( tune_idx == 2 ) {
+    runSeqVariantFastMath(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -162,5 +347,18 @@ void ENERGY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void ENERGY::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+  }
+
+  if ( vid == Base_Seq && run_params.getFastMath() ) {
+    addVariantTuningName(vid, fast_math::getTuningName());
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
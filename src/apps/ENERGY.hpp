@@ -83,6 +83,9 @@
 ///   }
 /// }
 ///
+/// The fast_math tunings compute the divides and sqrt of the second, fifth,
+/// and sixth loops with the fast methods in common/FastMathUtils.hpp.
+///
 
 #ifndef RAJAPerf_Apps_ENERGY_HPP
 #define RAJAPerf_Apps_ENERGY_HPP
@@ -177,7 +180,63 @@
   }
 
 
+#define ENERGY_BODY2_FAST_MATH \
+  if ( delvc[i] > 0.0 ) { \
+     q_new[i] = 0.0 ; \
+  } \
+  else { \
+     Real_type vhalf = fast_math::div(1.0, 1.0 + compHalfStep[i]) ; \
+     Real_type ssc = fast_math::div( pbvc[i] * e_new[i] \
+        + vhalf * vhalf * bvc[i] * pHalfStep[i], rho0 ) ; \
+     if ( ssc <= 0.1111111e-36 ) { \
+        ssc = 0.3333333e-18 ; \
+     } else { \
+        ssc = fast_math::sqrt(ssc) ; \
+     } \
+     q_new[i] = (ssc*ql_old[i] + qq_old[i]) ; \
+  }
+
+#define ENERGY_BODY5_FAST_MATH \
+  Real_type q_tilde ; \
+  if (delvc[i] > 0.0) { \
+     q_tilde = 0. ; \
+  } \
+  else { \
+     Real_type ssc = fast_math::div( pbvc[i] * e_new[i] \
+         + vnewc[i] * vnewc[i] * bvc[i] * p_new[i], rho0 ) ; \
+     if ( ssc <= 0.1111111e-36 ) { \
+        ssc = 0.3333333e-18 ; \
+     } else { \
+        ssc = fast_math::sqrt(ssc) ; \
+     } \
+     q_tilde = (ssc*ql_old[i] + qq_old[i]) ; \
+  } \
+  e_new[i] = e_new[i] - ( 7.0*(p_old[i] + q_old[i]) \
+                         - 8.0*(pHalfStep[i] + q_new[i]) \
+                         + (p_new[i] + q_tilde)) * delvc[i] / 6.0 ; \
+  if ( fabs(e_new[i]) < e_cut ) { \
+     e_new[i] = 0.0  ; \
+  } \
+  if ( e_new[i]  < emin ) { \
+     e_new[i] = emin ; \
+  }
+
+#define ENERGY_BODY6_FAST_MATH \
+  if ( delvc[i] <= 0.0 ) { \
+     Real_type ssc = fast_math::div( pbvc[i] * e_new[i] \
+             + vnewc[i] * vnewc[i] * bvc[i] * p_new[i], rho0 ) ; \
+     if ( ssc <= 0.1111111e-36 ) { \
+        ssc = 0.3333333e-18 ; \
+     } else { \
+        ssc = fast_math::sqrt(ssc) ; \
+     } \
+     q_new[i] = (ssc*ql_old[i] + qq_old[i]) ; \
+     if (fabs(q_new[i]) < q_cut) q_new[i] = 0.0 ; \
+  }
+
+
 #include "common/KernelBase.hpp"
+#include "common/FastMathUtils.hpp"
 
 namespace rajaperf
 {
@@ -203,13 +262,21 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  void runSeqVariantFastMath(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantFastMath(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantFastMath(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -5,9 +5,29 @@
 //
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Macros and polynomial order lists shared by the FEM kernels.
+///
+/// The partial and element assembly kernels are templated on the number of
+/// dofs (D1D) and quadrature points (Q1D) in 1D, so loops over them have
+/// compile time trip counts and the arrays sized by them may be kept in
+/// registers. Each kernel instantiates its variants for the orders in
+/// rajaperf::configuration::fem_orders, or its default order if that is
+/// empty, and runs the instantiation of the order chosen at run time.
+/// Order p has D1D = p+1 and Q1D = p+2.
+///
+
 #ifndef RAJAPerf_FEM_MACROS_HPP
 #define RAJAPerf_FEM_MACROS_HPP
 
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include "rajaperf_config.hpp"
+
+#include <vector>
+
 #if defined(USE_RAJAPERF_UNROLL)
 // If enabled uses RAJA's RAJA_UNROLL_COUNT which is always on
 #define RAJAPERF_UNROLL(N) RAJA_UNROLL_COUNT(N)
@@ -26,4 +46,111 @@
 
 #define CPU_FOREACH(i, k, N) for (int i = 0; i < N; i++)
 
+namespace rajaperf
+{
+
+namespace fem_order
+{
+
+template < size_t... orders >
+using list_type = camp::int_seq<size_t, orders...>;
+
+// A camp::int_seq of size_t's that is rajaperf::configuration::fem_orders
+// if rajaperf::configuration::fem_orders is not empty
+// and a camp::int_seq of default_order otherwise
+// with invalid entries removed according to validity_checker
+template < size_t default_order,
+           typename validity_checker = gpu_block_size::AllowAny >
+using make_list_type =
+      typename gpu_block_size::detail::remove_invalid<validity_checker,
+        typename std::conditional< (gpu_block_size::detail::SizeOfIntSeq<rajaperf::configuration::fem_orders>::size > 0),
+          rajaperf::configuration::fem_orders,
+          list_type<default_order>
+        >::type
+      >::type;
+
+// number of dofs in 1D of order
+constexpr Index_type d1d(size_t order) { return static_cast<Index_type>(order) + 1; }
+
+// number of quadrature points in 1D of order
+constexpr Index_type q1d(size_t order) { return static_cast<Index_type>(order) + 2; }
+
+// orders of an order list as a vector
+template < size_t... orders >
+inline std::vector<Index_type> to_vector(camp::int_seq<size_t, orders...> const&)
+{
+  return std::vector<Index_type>{static_cast<Index_type>(orders)...};
+}
+
+// default_order if it is in the order list, the first order otherwise
+template < size_t... orders >
+inline Index_type default_of(Index_type default_order,
+                             camp::int_seq<size_t, orders...> const& list)
+{
+  const std::vector<Index_type> valid = to_vector(list);
+  for (Index_type order : valid) {
+    if (order == default_order) {
+      return default_order;
+    }
+  }
+  return valid.empty() ? default_order : valid.front();
+}
+
+} // closing brace for fem_order namespace
+
+} // closing brace for rajaperf namespace
+
+//
+// Register the polynomial order of the kernel as the kernel parameter
+// "order" with the orders in fem_orders_type as valid values.
+//
+#define RAJAPERF_FEM_ORDER_KERNEL_PARAM(default_order)                         \
+  getKernelParam("order",                                                      \
+                 fem_order::default_of(default_order, fem_orders_type{}),      \
+                 fem_order::to_vector(fem_orders_type{}))
+
+//
+// Define run<variant>Variant to call run<variant>VariantImpl<D1D, Q1D>
+// with the D1D and Q1D of the order of the kernel, m_order.
+//
+#define RAJAPERF_FEM_ORDER_RUN_BOILERPLATE(kernel, variant)                    \
+  void kernel::run##variant##Variant(VariantID vid,                            \
+                                     size_t RAJAPERF_UNUSED_ARG(tune_idx))     \
+  {                                                                            \
+    seq_for(fem_orders_type{}, [&](auto order) {                               \
+      if (static_cast<Index_type>(order) == m_order) {                         \
+        run##variant##VariantImpl<fem_order::d1d(order),                      \
+                                  fem_order::q1d(order)>(vid);                \
+      }                                                                        \
+    });                                                                        \
+  }
+
+//
+// Same as above for GPU variants with one tuning whose block size is the
+// number of threads per element of the order, gpuBlockSize(order), calls
+// run<variant>VariantImpl<block_size, D1D, Q1D>.
+//
+#define RAJAPERF_GPU_FEM_ORDER_TUNING_DEFINE_BOILERPLATE(kernel, variant)      \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    seq_for(fem_orders_type{}, [&](auto order) {                               \
+      constexpr size_t block_size = gpuBlockSize(order);                       \
+      if (static_cast<Index_type>(order) == m_order && tune_idx == 0) {        \
+        setBlockSize(block_size);                                              \
+        run##variant##VariantImpl<block_size,                                  \
+                                  fem_order::d1d(order),                      \
+                                  fem_order::q1d(order)>(vid);                \
+      }                                                                        \
+    });                                                                        \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    const size_t block_size = gpuBlockSize(m_order);                           \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));          \
+    }                                                                          \
+  }
+
 #endif // closing endif for header file include guard
@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/JitUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <algorithm>
 #include <iostream>
@@ -22,26 +24,37 @@ namespace rajaperf
 namespace apps
 {
 
-#define USE_CUDA_CONSTANT_MEMORY
-//#undef USE_CUDA_CONSTANT_MEMORY
-
-#if defined(USE_CUDA_CONSTANT_MEMORY)
-
-__constant__ Real_type coeff[FIR_COEFFLEN];
+//
+// Coefficients in constant memory, used by the coeff_constant, input_tile,
+// and sliding_window tunings.
+//
+__constant__ Real_type coeff[FIR_MAX_COEFFLEN];
 
-#define FIR_DATA_SETUP_CUDA \
+#define FIR_DATA_SETUP_CUDA_CONSTANT \
   Real_type *dcoeff_addr; \
   cudaErrchk( cudaGetSymbolAddress((void**)&dcoeff_addr, coeff) ); \
-  cudaErrchk( cudaMemcpyAsync(dcoeff_addr, coeff_array, FIR_COEFFLEN * sizeof(Real_type), cudaMemcpyHostToDevice, res.get_stream()) );
+  cudaErrchk( cudaMemcpyAsync(dcoeff_addr, coeff_array, FIR_MAX_COEFFLEN * sizeof(Real_type), cudaMemcpyHostToDevice, res.get_stream()) );
+
+//
+// Coefficients in global memory, used by the coeff_global and coeff_shared
+// tunings.
+//
+#define FIR_DATA_SETUP_CUDA_GLOBAL \
+  Real_ptr coeff; \
+  \
+  Real_ptr tcoeff = &coeff_array[0]; \
+  allocData(DataSpace::CudaDevice, coeff, FIR_MAX_COEFFLEN); \
+  copyData(DataSpace::CudaDevice, coeff, DataSpace::Host, tcoeff, FIR_MAX_COEFFLEN);
 
 
-#define FIR_DATA_TEARDOWN_CUDA
+#define FIR_DATA_TEARDOWN_CUDA_GLOBAL \
+  deallocData(DataSpace::CudaDevice, coeff);
 
 template < size_t block_size >
 __launch_bounds__(block_size)
-__global__ void fir(Real_ptr out, Real_ptr in,
-                    const Index_type coefflen,
-                    Index_type iend)
+__global__ void fir_constant(Real_ptr out, Real_ptr in,
+                             const Index_type coefflen,
+                             Index_type iend)
 {
    Index_type i = blockIdx.x * block_size + threadIdx.x;
    if (i < iend) {
@@ -49,37 +62,74 @@ __global__ void fir(Real_ptr out, Real_ptr in,
    }
 }
 
-#else  // use global memory for coefficients
-
-#define FIR_DATA_SETUP_CUDA \
-  Real_ptr coeff; \
-  \
-  Real_ptr tcoeff = &coeff_array[0]; \
-  allocData(DataSpace::CudaDevice, coeff, FIR_COEFFLEN); \
-  copyData(DataSpace::CudaDevice, coeff, DataSpace::Host, tcoeff, FIR_COEFFLEN);
-
-
-#define FIR_DATA_TEARDOWN_CUDA \
-  deallocData(DataSpace::CudaDevice, coeff);
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fir_global(Real_ptr out, Real_ptr in,
+                           Real_ptr coeff,
+                           const Index_type coefflen,
+                           Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     FIR_BODY;
+   }
+}
 
 template < size_t block_size >
 __launch_bounds__(block_size)
-__global__ void fir(Real_ptr out, Real_ptr in,
-                    Real_ptr coeff,
-                    const Index_type coefflen,
-                    Index_type iend)
+__global__ void fir_shared(Real_ptr out, Real_ptr in,
+                           Real_ptr gcoeff,
+                           const Index_type coefflen,
+                           Index_type iend)
 {
+   __shared__ Real_type coeff[FIR_MAX_COEFFLEN];
+   for (Index_type j = threadIdx.x; j < coefflen; j += block_size) {
+     coeff[j] = gcoeff[j];
+   }
+   __syncthreads();
+
    Index_type i = blockIdx.x * block_size + threadIdx.x;
    if (i < iend) {
      FIR_BODY;
    }
 }
 
-#endif
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fir_input_tile(Real_ptr out, Real_ptr in,
+                               const Index_type coefflen,
+                               Index_type iend)
+{
+   __shared__ Real_type in_tile[block_size + FIR_MAX_COEFFLEN - 1];
+   const Index_type ibase = blockIdx.x * block_size;
+   const Index_type len_in = iend + coefflen - 1;
+   for (Index_type k = threadIdx.x; k < block_size + coefflen - 1; k += block_size) {
+     in_tile[k] = (ibase + k < len_in) ? in[ibase + k] : 0.0;
+   }
+   __syncthreads();
 
+   const Index_type ti = threadIdx.x;
+   Index_type i = ibase + ti;
+   if (i < iend) {
+     FIR_TILE_BODY;
+   }
+}
 
 template < size_t block_size >
-void FIR::runCudaVariantImpl(VariantID vid)
+__launch_bounds__(block_size)
+__global__ void fir_sliding_window(Real_ptr out, Real_ptr in,
+                                   const Index_type coefflen,
+                                   Index_type iend)
+{
+   const Index_type i0 = (blockIdx.x * block_size + threadIdx.x) * FIR_WINDOW_LEN;
+   if (i0 < iend) {
+     FIR_WINDOW_BODY;
+   }
+}
+
+
+template < size_t block_size, bool launch >
+void FIR::runCudaVariantConstant(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -89,11 +139,11 @@ void FIR::runCudaVariantImpl(VariantID vid)
 
   FIR_DATA_SETUP;
 
-  if ( vid == Base_CUDA ) {
+  FIR_COEFF;
 
-    FIR_COEFF;
+  FIR_DATA_SETUP_CUDA_CONSTANT;
 
-    FIR_DATA_SETUP_CUDA;
+  if ( vid == Base_CUDA ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -101,30 +151,66 @@ void FIR::runCudaVariantImpl(VariantID vid)
        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
        constexpr size_t shmem = 0;
 
-#if defined(USE_CUDA_CONSTANT_MEMORY)
-       fir<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( out, in,
+       fir_constant<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( out, in,
                                        coefflen,
                                        iend );
        cudaErrchk( cudaGetLastError() );
-#else
-       fir<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( out, in,
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       gpu_launch::forall< block_size, launch >( res,
+         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+         FIR_BODY;
+       });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FIR::runCudaVariantGlobal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getCudaResource()};
+
+  FIR_DATA_SETUP;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP_CUDA_GLOBAL;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       fir_global<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( out, in,
                                        coeff,
                                        coefflen,
                                        iend );
        cudaErrchk( cudaGetLastError() );
-#endif
 
     }
     stopTimer();
 
-    FIR_DATA_TEARDOWN_CUDA;
-
   } else if ( vid == RAJA_CUDA ) {
 
-    FIR_COEFF;
-
-    FIR_DATA_SETUP_CUDA;
-
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
@@ -136,14 +222,258 @@ void FIR::runCudaVariantImpl(VariantID vid)
     }
     stopTimer();
 
-    FIR_DATA_TEARDOWN_CUDA;
+  } else {
+     getCout() << "\n  FIR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+
+  FIR_DATA_TEARDOWN_CUDA_GLOBAL;
+}
+
+template < size_t block_size >
+void FIR::runCudaVariantShared(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getCudaResource()};
+
+  FIR_DATA_SETUP;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP_CUDA_GLOBAL;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       fir_shared<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( out, in,
+                                       coeff,
+                                       coefflen,
+                                       iend );
+       cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
 
   } else {
      getCout() << "\n  FIR : Unknown Cuda variant id = " << vid << std::endl;
   }
+
+  FIR_DATA_TEARDOWN_CUDA_GLOBAL;
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(FIR, Cuda)
+template < size_t block_size >
+void FIR::runCudaVariantInputTile(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getCudaResource()};
+
+  FIR_DATA_SETUP;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP_CUDA_CONSTANT;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       fir_input_tile<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( out, in,
+                                       coefflen,
+                                       iend );
+       cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FIR::runCudaVariantSlidingWindow(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getCudaResource()};
+
+  FIR_DATA_SETUP;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP_CUDA_CONSTANT;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size*FIR_WINDOW_LEN);
+       constexpr size_t shmem = 0;
+
+       fir_sliding_window<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( out, in,
+                                       coefflen,
+                                       iend );
+       cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+
+template < size_t block_size >
+void FIR::runCudaVariantJit(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getCudaResource()};
+
+  FIR_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    detail::JitStats stats;
+    auto function = detail::getCudaJitFunction("fir_jit", getJitSource(block_size),
+                                               run_params.getJitCacheDir(), stats);
+
+    m_jit_metrics[vid].resize(getNumVariantTunings(vid));
+    m_jit_metrics[vid][tune_idx] = detail::getJitMetrics(stats);
+
+    void* args[] = { &out, &in };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       detail::launchCudaJitFunction(function, grid_size, block_size, shmem,
+                                     res.get_stream(), args);
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+#endif
+
+void FIR::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantConstant<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantGlobal<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == Base_CUDA) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantShared<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantInputTile<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantSlidingWindow<block_size>(vid);
+        }
+        t += 1;
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantJit<block_size>(vid, tune_idx);
+        }
+        t += 1;
+#endif
+
+      }
+
+    }
+
+  });
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Cuda, Constant, )
+
+  }
+
+}
+
+void FIR::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "coeff_constant"+block_name);
+      addVariantTuningName(vid, "coeff_global"+block_name);
+
+      if (vid == Base_CUDA) {
+        addVariantTuningName(vid, "coeff_shared"+block_name);
+        addVariantTuningName(vid, "input_tile"+block_name);
+        addVariantTuningName(vid, "sliding_window"+block_name);
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+        addVariantTuningName(vid, "jit"+block_name);
+#endif
+      }
+
+    }
+
+  });
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/JitUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <algorithm>
 #include <iostream>
@@ -22,24 +24,35 @@ namespace rajaperf
 namespace apps
 {
 
-#define USE_HIP_CONSTANT_MEMORY
-// #undef USE_HIP_CONSTANT_MEMORY
-
-#if defined(USE_HIP_CONSTANT_MEMORY)
+//
+// Coefficients in constant memory, used by the coeff_constant, input_tile,
+// and sliding_window tunings.
+//
+__constant__ Real_type coeff[FIR_MAX_COEFFLEN];
 
-__constant__ Real_type coeff[FIR_COEFFLEN];
+#define FIR_DATA_SETUP_HIP_CONSTANT \
+  hipErrchk( hipMemcpyToSymbolAsync(HIP_SYMBOL(coeff), coeff_array, FIR_MAX_COEFFLEN * sizeof(Real_type), 0, hipMemcpyHostToDevice, res.get_stream()) );
 
-#define FIR_DATA_SETUP_HIP \
-  hipErrchk( hipMemcpyToSymbolAsync(HIP_SYMBOL(coeff), coeff_array, FIR_COEFFLEN * sizeof(Real_type), 0, hipMemcpyHostToDevice, res.get_stream()) );
+//
+// Coefficients in global memory, used by the coeff_global and coeff_shared
+// tunings.
+//
+#define FIR_DATA_SETUP_HIP_GLOBAL \
+  Real_ptr coeff; \
+  \
+  Real_ptr tcoeff = &coeff_array[0]; \
+  allocData(DataSpace::HipDevice, coeff, FIR_MAX_COEFFLEN); \
+  copyData(DataSpace::HipDevice, coeff, DataSpace::Host, tcoeff, FIR_MAX_COEFFLEN);
 
 
-#define FIR_DATA_TEARDOWN_HIP
+#define FIR_DATA_TEARDOWN_HIP_GLOBAL \
+  deallocData(DataSpace::HipDevice, coeff);
 
 template < size_t block_size >
 __launch_bounds__(block_size)
-__global__ void fir(Real_ptr out, Real_ptr in,
-                    const Index_type coefflen,
-                    Index_type iend)
+__global__ void fir_constant(Real_ptr out, Real_ptr in,
+                             const Index_type coefflen,
+                             Index_type iend)
 {
    Index_type i = blockIdx.x * block_size + threadIdx.x;
    if (i < iend) {
@@ -47,37 +60,74 @@ __global__ void fir(Real_ptr out, Real_ptr in,
    }
 }
 
-#else  // use global memry for coefficients
-
-#define FIR_DATA_SETUP_HIP \
-  Real_ptr coeff; \
-  \
-  Real_ptr tcoeff = &coeff_array[0]; \
-  allocData(DataSpace::HipDevice, coeff, FIR_COEFFLEN); \
-  copyData(DataSpace::HipDevice, coeff, DataSpace::Host, tcoeff, FIR_COEFFLEN);
-
-
-#define FIR_DATA_TEARDOWN_HIP \
-  deallocData(DataSpace::HipDevice, coeff);
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fir_global(Real_ptr out, Real_ptr in,
+                           Real_ptr coeff,
+                           const Index_type coefflen,
+                           Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     FIR_BODY;
+   }
+}
 
 template < size_t block_size >
 __launch_bounds__(block_size)
-__global__ void fir(Real_ptr out, Real_ptr in,
-                    Real_ptr coeff,
-                    const Index_type coefflen,
-                    Index_type iend)
+__global__ void fir_shared(Real_ptr out, Real_ptr in,
+                           Real_ptr gcoeff,
+                           const Index_type coefflen,
+                           Index_type iend)
 {
+   __shared__ Real_type coeff[FIR_MAX_COEFFLEN];
+   for (Index_type j = threadIdx.x; j < coefflen; j += block_size) {
+     coeff[j] = gcoeff[j];
+   }
+   __syncthreads();
+
    Index_type i = blockIdx.x * block_size + threadIdx.x;
    if (i < iend) {
      FIR_BODY;
    }
 }
 
-#endif
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fir_input_tile(Real_ptr out, Real_ptr in,
+                               const Index_type coefflen,
+                               Index_type iend)
+{
+   __shared__ Real_type in_tile[block_size + FIR_MAX_COEFFLEN - 1];
+   const Index_type ibase = blockIdx.x * block_size;
+   const Index_type len_in = iend + coefflen - 1;
+   for (Index_type k = threadIdx.x; k < block_size + coefflen - 1; k += block_size) {
+     in_tile[k] = (ibase + k < len_in) ? in[ibase + k] : 0.0;
+   }
+   __syncthreads();
 
+   const Index_type ti = threadIdx.x;
+   Index_type i = ibase + ti;
+   if (i < iend) {
+     FIR_TILE_BODY;
+   }
+}
 
 template < size_t block_size >
-void FIR::runHipVariantImpl(VariantID vid)
+__launch_bounds__(block_size)
+__global__ void fir_sliding_window(Real_ptr out, Real_ptr in,
+                                   const Index_type coefflen,
+                                   Index_type iend)
+{
+   const Index_type i0 = (blockIdx.x * block_size + threadIdx.x) * FIR_WINDOW_LEN;
+   if (i0 < iend) {
+     FIR_WINDOW_BODY;
+   }
+}
+
+
+template < size_t block_size, bool launch >
+void FIR::runHipVariantConstant(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -87,11 +137,11 @@ void FIR::runHipVariantImpl(VariantID vid)
 
   FIR_DATA_SETUP;
 
-  if ( vid == Base_HIP ) {
+  FIR_COEFF;
 
-    FIR_COEFF;
+  FIR_DATA_SETUP_HIP_CONSTANT;
 
-    FIR_DATA_SETUP_HIP;
+  if ( vid == Base_HIP ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -99,30 +149,66 @@ void FIR::runHipVariantImpl(VariantID vid)
        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
        constexpr size_t shmem = 0;
 
-#if defined(USE_HIP_CONSTANT_MEMORY)
-       hipLaunchKernelGGL((fir<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  out, in,
+       hipLaunchKernelGGL((fir_constant<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  out, in,
                                        coefflen,
                                        iend );
        hipErrchk( hipGetLastError() );
-#else
-       hipLaunchKernelGGL((fir<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  out, in,
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       gpu_launch::forall< block_size, launch >( res,
+         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+         FIR_BODY;
+       });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIR : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FIR::runHipVariantGlobal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getHipResource()};
+
+  FIR_DATA_SETUP;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP_HIP_GLOBAL;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       hipLaunchKernelGGL((fir_global<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  out, in,
                                        coeff,
                                        coefflen,
                                        iend );
        hipErrchk( hipGetLastError() );
-#endif
 
     }
     stopTimer();
 
-    FIR_DATA_TEARDOWN_HIP;
-
   } else if ( vid == RAJA_HIP ) {
 
-    FIR_COEFF;
-
-    FIR_DATA_SETUP_HIP;
-
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
@@ -134,14 +220,258 @@ void FIR::runHipVariantImpl(VariantID vid)
     }
     stopTimer();
 
-    FIR_DATA_TEARDOWN_HIP;
+  } else {
+     getCout() << "\n  FIR : Unknown Hip variant id = " << vid << std::endl;
+  }
+
+  FIR_DATA_TEARDOWN_HIP_GLOBAL;
+}
+
+template < size_t block_size >
+void FIR::runHipVariantShared(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getHipResource()};
+
+  FIR_DATA_SETUP;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP_HIP_GLOBAL;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       hipLaunchKernelGGL((fir_shared<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  out, in,
+                                       coeff,
+                                       coefflen,
+                                       iend );
+       hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
 
   } else {
      getCout() << "\n  FIR : Unknown Hip variant id = " << vid << std::endl;
   }
+
+  FIR_DATA_TEARDOWN_HIP_GLOBAL;
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(FIR, Hip)
+template < size_t block_size >
+void FIR::runHipVariantInputTile(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getHipResource()};
+
+  FIR_DATA_SETUP;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP_HIP_CONSTANT;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       hipLaunchKernelGGL((fir_input_tile<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  out, in,
+                                       coefflen,
+                                       iend );
+       hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIR : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FIR::runHipVariantSlidingWindow(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getHipResource()};
+
+  FIR_DATA_SETUP;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP_HIP_CONSTANT;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size*FIR_WINDOW_LEN);
+       constexpr size_t shmem = 0;
+
+       hipLaunchKernelGGL((fir_sliding_window<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  out, in,
+                                       coefflen,
+                                       iend );
+       hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIR : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+
+template < size_t block_size >
+void FIR::runHipVariantJit(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  auto res{getHipResource()};
+
+  FIR_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    detail::JitStats stats;
+    auto function = detail::getHipJitFunction("fir_jit", getJitSource(block_size),
+                                              run_params.getJitCacheDir(), stats);
+
+    m_jit_metrics[vid].resize(getNumVariantTunings(vid));
+    m_jit_metrics[vid][tune_idx] = detail::getJitMetrics(stats);
+
+    void* args[] = { &out, &in };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       detail::launchHipJitFunction(function, grid_size, block_size, shmem,
+                                    res.get_stream(), args);
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIR : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+#endif
+
+void FIR::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantConstant<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantGlobal<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == Base_HIP) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantShared<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantInputTile<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantSlidingWindow<block_size>(vid);
+        }
+        t += 1;
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantJit<block_size>(vid, tune_idx);
+        }
+        t += 1;
+#endif
+
+      }
+
+    }
+
+  });
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Hip, Constant, )
+
+  }
+
+}
+
+void FIR::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "coeff_constant"+block_name);
+      addVariantTuningName(vid, "coeff_global"+block_name);
+
+      if (vid == Base_HIP) {
+        addVariantTuningName(vid, "coeff_shared"+block_name);
+        addVariantTuningName(vid, "input_tile"+block_name);
+        addVariantTuningName(vid, "sliding_window"+block_name);
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+        addVariantTuningName(vid, "jit"+block_name);
+#endif
+      }
+
+    }
+
+  });
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -31,7 +31,7 @@ void FIR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   FIR_DATA_SETUP;
 
-  Real_type coeff[FIR_COEFFLEN];
+  Real_type coeff[FIR_MAX_COEFFLEN];
   std::copy(std::begin(coeff_array), std::end(coeff_array), std::begin(coeff));
 
   auto fir_lam = [=](Index_type i) {
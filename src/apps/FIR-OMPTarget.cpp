@@ -31,8 +31,8 @@ namespace apps
   Real_ptr coeff; \
   \
   Real_ptr tcoeff = &coeff_array[0]; \
-  allocData(DataSpace::OmpTarget, coeff, FIR_COEFFLEN); \
-  copyData(DataSpace::OmpTarget, coeff, DataSpace::Host, tcoeff, FIR_COEFFLEN);
+  allocData(DataSpace::OmpTarget, coeff, FIR_MAX_COEFFLEN); \
+  copyData(DataSpace::OmpTarget, coeff, DataSpace::Host, tcoeff, FIR_MAX_COEFFLEN);
 
 
 #define FIR_DATA_TEARDOWN_OMP_TARGET \
@@ -42,6 +42,8 @@ namespace apps
 void FIR::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize() - m_coefflen;
 
@@ -56,10 +58,18 @@ void FIR::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(in, out, coeff) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-         FIR_BODY;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(in, out, coeff) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+           FIR_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(in, out, coeff) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+           FIR_BODY;
+        }
       }
 
     }
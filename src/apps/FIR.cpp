@@ -11,6 +11,10 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/JitUtils.hpp"
+
+#include <iomanip>
+#include <sstream>
 
 namespace rajaperf
 {
@@ -24,7 +28,7 @@ FIR::FIR(const RunParams& params)
   setDefaultProblemSize(1000000);
   setDefaultReps(160);
 
-  m_coefflen = FIR_COEFFLEN;
+  m_coefflen = getKernelParam("coefflen", FIR_COEFFLEN, 1, FIR_MAX_COEFFLEN);
 
   setActualProblemSize( getTargetProblemSize() );
 
@@ -40,6 +44,8 @@ FIR::FIR(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Stencil);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -48,6 +54,8 @@ FIR::FIR(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -56,12 +64,55 @@ FIR::FIR(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+  setMetricNames(detail::getJitMetricNames());
+#endif
 }
 
 FIR::~FIR()
 {
 }
 
+std::vector<double> FIR::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx >= m_jit_metrics[vid].size()) {
+    return {};
+  }
+  return m_jit_metrics[vid][tune_idx];
+}
+
+std::string FIR::getJitSource(size_t block_size) const
+{
+  FIR_COEFF;
+
+  std::ostringstream src;
+  src << std::setprecision(17);
+  src << detail::getJitTypesSource();
+  src << "#define FIR_JIT_COEFFLEN " << m_coefflen << "\n";
+  src << "#define FIR_JIT_BLOCK_SIZE " << block_size << "\n";
+  src << "#define FIR_JIT_IEND " << (getActualProblemSize() - m_coefflen) << "\n";
+  src << "__device__ const Real_type fir_jit_coeff[FIR_JIT_COEFFLEN] = {";
+  for (Index_type j = 0; j < m_coefflen; ++j ) {
+    src << (j > 0 ? ", " : "") << std::showpoint << coeff_array[j];
+  }
+  src << "};\n";
+  src << "extern \"C\" __global__ void __launch_bounds__(FIR_JIT_BLOCK_SIZE)\n"
+         "fir_jit(Real_type* out, const Real_type* in)\n"
+         "{\n"
+         "  const Index_type i = blockIdx.x * FIR_JIT_BLOCK_SIZE + threadIdx.x;\n"
+         "  if (i < FIR_JIT_IEND) {\n"
+         "    Real_type sum = 0.0;\n"
+         "#pragma unroll\n"
+         "    for (Index_type j = 0; j < FIR_JIT_COEFFLEN; ++j ) {\n"
+         "      sum += fir_jit_coeff[j]*in[i+j];\n"
+         "    }\n"
+         "    out[i] = sum;\n"
+         "  }\n"
+         "}\n";
+  return src.str();
+}
+
 void FIR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   allocAndInitData(m_in, getActualProblemSize(), vid);
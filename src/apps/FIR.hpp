@@ -16,6 +16,13 @@
 ///                                  -1.0, -1.0, 3.0, -1.0,
 ///                                  -1.0, -1.0, -1.0, 3.0 };
 ///
+/// The number of coefficients, coefflen, is FIR_COEFFLEN by default and
+/// may be set up to FIR_MAX_COEFFLEN with the kernel parameter "coefflen",
+/// longer filters continue the pattern above, 3.0 every fifth coefficient.
+///
+/// The jit GPU tunings compile the loop at run time with coefflen, the
+/// coefficients, and iend written in as constants (see JitUtils.hpp).
+///
 /// for (Index_type i = ibegin; i < iend; ++i ) {
 ///   Real_type sum = 0.0;
 ///   for (Index_type j = 0; j < coefflen; ++j ) {
@@ -30,6 +37,10 @@
 
 
 #define FIR_COEFFLEN (16)
+#define FIR_MAX_COEFFLEN (64)
+
+// outputs computed by each thread of the GPU sliding window tunings
+#define FIR_WINDOW_LEN (8)
 
 #define FIR_DATA_SETUP \
   Real_ptr in = m_in; \
@@ -38,10 +49,10 @@
   const Index_type coefflen = m_coefflen;
 
 #define FIR_COEFF \
-  Real_type coeff_array[FIR_COEFFLEN] = { 3.0, -1.0, -1.0, -1.0, \
-                                         -1.0, 3.0, -1.0, -1.0, \
-                                         -1.0, -1.0, 3.0, -1.0, \
-                                         -1.0, -1.0, -1.0, 3.0 };
+  Real_type coeff_array[FIR_MAX_COEFFLEN]; \
+  for (Index_type j = 0; j < FIR_MAX_COEFFLEN; ++j ) { \
+    coeff_array[j] = (j % 5 == 0) ? 3.0 : -1.0; \
+  }
 
 #define FIR_BODY \
   Real_type sum = 0.0; \
@@ -51,9 +62,55 @@
   } \
   out[i] = sum;
 
+//
+// Output i of a GPU block from the inputs of the block staged in shared
+// memory, in_tile[ti+j] is in[i+j] where ti is the thread index of i.
+//
+#define FIR_TILE_BODY \
+  Real_type sum = 0.0; \
+\
+  for (Index_type j = 0; j < coefflen; ++j ) { \
+    sum += coeff[j]*in_tile[ti+j]; \
+  } \
+  out[i] = sum;
+
+//
+// Outputs [i0, i0 + FIR_WINDOW_LEN) of one GPU thread, the inputs used for
+// each coefficient are kept in registers and shifted by one for the next
+// coefficient, so each input is loaded once per thread. Sums are done in
+// the same order as FIR_BODY.
+//
+#define FIR_WINDOW_BODY \
+  const Index_type len_in = iend + coefflen - 1; \
+  Real_type window[FIR_WINDOW_LEN]; \
+  Real_type sums[FIR_WINDOW_LEN]; \
+  for (Index_type k = 0; k < FIR_WINDOW_LEN; ++k ) { \
+    window[k] = (i0 + k < len_in) ? in[i0 + k] : 0.0; \
+    sums[k] = 0.0; \
+  } \
+  for (Index_type j = 0; j < coefflen; ++j ) { \
+    const Real_type c = coeff[j]; \
+    for (Index_type k = 0; k < FIR_WINDOW_LEN; ++k ) { \
+      sums[k] += c*window[k]; \
+    } \
+    for (Index_type k = 0; k < FIR_WINDOW_LEN-1; ++k ) { \
+      window[k] = window[k+1]; \
+    } \
+    const Index_type inext = i0 + FIR_WINDOW_LEN + j; \
+    window[FIR_WINDOW_LEN-1] = (inext < len_in) ? in[inext] : 0.0; \
+  } \
+  for (Index_type k = 0; k < FIR_WINDOW_LEN; ++k ) { \
+    if (i0 + k < iend) { \
+      out[i0 + k] = sums[k]; \
+    } \
+  }
+
 
 #include "common/KernelBase.hpp"
 
+#include <string>
+#include <vector>
+
 namespace rajaperf
 {
 class RunParams;
@@ -79,12 +136,34 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runCudaVariantConstant(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantGlobal(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantShared(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantInputTile(VariantID vid);
   template < size_t block_size >
-  void runCudaVariantImpl(VariantID vid);
+  void runCudaVariantSlidingWindow(VariantID vid);
   template < size_t block_size >
-  void runHipVariantImpl(VariantID vid);
+  void runCudaVariantJit(VariantID vid, size_t tune_idx);
+  template < size_t block_size, bool launch = false >
+  void runHipVariantConstant(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantGlobal(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantShared(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantInputTile(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantSlidingWindow(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantJit(VariantID vid, size_t tune_idx);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -94,6 +173,13 @@ private:
   Real_ptr m_out;
 
   Index_type m_coefflen;
+
+  // source of the jit tunings with the coefficients, coefflen, and the
+  // loop bounds written in as constants
+  std::string getJitSource(size_t block_size) const;
+
+  // jit metrics of each tuning, empty for tunings that are not jit tunings
+  std::vector<std::vector<double>> m_jit_metrics[NumVariants];
 };
 
 } // end namespace apps
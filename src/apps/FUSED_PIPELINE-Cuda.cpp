@@ -0,0 +1,376 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSED_PIPELINE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+#include <cooperative_groups.h>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_pipeline_mul(Real_ptr b, Real_ptr c, Real_type alpha,
+                                   Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    MUL_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_pipeline_add(Real_ptr a, Real_ptr b, Real_ptr c,
+                                   Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    ADD_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_pipeline_triad(Real_ptr a, Real_ptr b, Real_ptr c, Real_type alpha,
+                                     Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    TRIAD_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_pipeline_stream(Real_ptr a, Real_ptr b, Real_ptr c, Real_type alpha,
+                                      Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_PIPELINE_STREAM_FUSED_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_pipeline_pressure1(Real_ptr bvc, Real_ptr compression,
+                                         const Real_type cls,
+                                         Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    PRESSURE_BODY1;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_pipeline_pressure2(Real_ptr p_new, Real_ptr bvc, Real_ptr e_old,
+                                         Real_ptr vnewc,
+                                         const Real_type p_cut, const Real_type eosvmax,
+                                         const Real_type pmin,
+                                         Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    PRESSURE_BODY2;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_pipeline_pressure(Real_ptr p_new, Real_ptr bvc, Real_ptr compression,
+                                        Real_ptr e_old, Real_ptr vnewc,
+                                        const Real_type cls,
+                                        const Real_type p_cut, const Real_type eosvmax,
+                                        const Real_type pmin,
+                                        Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_PIPELINE_PRESSURE_FUSED_BODY;
+  }
+}
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_pipeline_stream_persistent(Real_ptr a, Real_ptr b, Real_ptr c,
+                                                 Real_type alpha,
+                                                 Index_type iend, Index_type run_reps)
+{
+  cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+  const Index_type istart = blockIdx.x * block_size + threadIdx.x;
+  const Index_type istride = gridDim.x * block_size;
+  for (Index_type irep = 0; irep < run_reps; ++irep) {
+    for (Index_type i = istart; i < iend; i += istride) {
+      MUL_BODY;
+    }
+    grid.sync();
+    for (Index_type i = istart; i < iend; i += istride) {
+      ADD_BODY;
+    }
+    grid.sync();
+    for (Index_type i = istart; i < iend; i += istride) {
+      TRIAD_BODY;
+    }
+    grid.sync();
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_pipeline_pressure_persistent(Real_ptr p_new, Real_ptr bvc, Real_ptr compression,
+                                                   Real_ptr e_old, Real_ptr vnewc,
+                                                   Real_type cls,
+                                                   Real_type p_cut, Real_type eosvmax,
+                                                   Real_type pmin,
+                                                   Index_type iend, Index_type run_reps)
+{
+  cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+  const Index_type istart = blockIdx.x * block_size + threadIdx.x;
+  const Index_type istride = gridDim.x * block_size;
+  for (Index_type irep = 0; irep < run_reps; ++irep) {
+    for (Index_type i = istart; i < iend; i += istride) {
+      PRESSURE_BODY1;
+    }
+    grid.sync();
+    for (Index_type i = istart; i < iend; i += istride) {
+      PRESSURE_BODY2;
+    }
+    grid.sync();
+  }
+}
+
+template < size_t block_size >
+void FUSED_PIPELINE::runCudaVariantSeparate(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  FUSED_PIPELINE_STREAM_DATA_SETUP;
+  FUSED_PIPELINE_PRESSURE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      if ( m_pipeline == Pipeline::Stream ) {
+
+        fused_pipeline_mul<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+            b, c, alpha, iend );
+        cudaErrchk( cudaGetLastError() );
+
+        fused_pipeline_add<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+            a, b, c, iend );
+        cudaErrchk( cudaGetLastError() );
+
+        fused_pipeline_triad<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+            a, b, c, alpha, iend );
+        cudaErrchk( cudaGetLastError() );
+
+      } else {
+
+        fused_pipeline_pressure1<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+            bvc, compression, cls, iend );
+        cudaErrchk( cudaGetLastError() );
+
+        fused_pipeline_pressure2<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+            p_new, bvc, e_old, vnewc, p_cut, eosvmax, pmin, iend );
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FUSED_PIPELINE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FUSED_PIPELINE::runCudaVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  FUSED_PIPELINE_STREAM_DATA_SETUP;
+  FUSED_PIPELINE_PRESSURE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      if ( m_pipeline == Pipeline::Stream ) {
+
+        fused_pipeline_stream<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+            a, b, c, alpha, iend );
+        cudaErrchk( cudaGetLastError() );
+
+      } else {
+
+        fused_pipeline_pressure<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+            p_new, bvc, compression, e_old, vnewc, cls, p_cut, eosvmax, pmin, iend );
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FUSED_PIPELINE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FUSED_PIPELINE::runCudaVariantPersistent(VariantID vid)
+{
+  Index_type run_reps = getRunReps();
+  Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  FUSED_PIPELINE_STREAM_DATA_SETUP;
+  FUSED_PIPELINE_PRESSURE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    constexpr size_t shmem = 0;
+
+    if ( m_pipeline == Pipeline::Stream ) {
+
+      const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+          (fused_pipeline_stream_persistent<block_size>), block_size, shmem);
+      setGPUFuncAttributes( detail::getCudaFuncAttributes("fused_pipeline_stream_persistent",
+          (fused_pipeline_stream_persistent<block_size>), block_size, shmem) );
+      const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+      void* args[] = { &a, &b, &c, &alpha, &iend, &run_reps };
+
+      startTimer();
+
+      cudaErrchk( cudaLaunchCooperativeKernel(
+          (const void*)fused_pipeline_stream_persistent<block_size>, grid_size, block_size,
+          args, shmem, res.get_stream() ) );
+
+      stopTimer();
+
+    } else {
+
+      const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+          (fused_pipeline_pressure_persistent<block_size>), block_size, shmem);
+      setGPUFuncAttributes( detail::getCudaFuncAttributes("fused_pipeline_pressure_persistent",
+          (fused_pipeline_pressure_persistent<block_size>), block_size, shmem) );
+      const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+      void* args[] = { &p_new, &bvc, &compression, &e_old, &vnewc,
+                       (void*)&cls, (void*)&p_cut, (void*)&eosvmax, (void*)&pmin,
+                       &iend, &run_reps };
+
+      startTimer();
+
+      cudaErrchk( cudaLaunchCooperativeKernel(
+          (const void*)fused_pipeline_pressure_persistent<block_size>, grid_size, block_size,
+          args, shmem, res.get_stream() ) );
+
+      stopTimer();
+
+    }
+
+  } else {
+     getCout() << "\n  FUSED_PIPELINE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void FUSED_PIPELINE::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantSeparate<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantFused<block_size>(vid);
+      }
+      t += 1;
+
+      if (detail::haveCudaCooperativeLaunch()) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantPersistent<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    }
+
+  });
+}
+
+void FUSED_PIPELINE::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "separate"+block_name);
+      addVariantTuningName(vid, "fused"+block_name);
+
+      if (detail::haveCudaCooperativeLaunch()) {
+        addVariantTuningName(vid, "persistent"+block_name);
+      }
+
+    }
+
+  });
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSED_PIPELINE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void FUSED_PIPELINE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_PIPELINE_STREAM_DATA_SETUP;
+  FUSED_PIPELINE_PRESSURE_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    const bool fused = isFused(vid, tune_idx);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if ( m_pipeline == Pipeline::Stream ) {
+
+        if ( fused ) {
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            FUSED_PIPELINE_STREAM_FUSED_BODY;
+          }
+        } else {
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            MUL_BODY;
+          }
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ADD_BODY;
+          }
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            TRIAD_BODY;
+          }
+        }
+
+      } else {
+
+        if ( fused ) {
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            FUSED_PIPELINE_PRESSURE_FUSED_BODY;
+          }
+        } else {
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PRESSURE_BODY1;
+          }
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PRESSURE_BODY2;
+          }
+        }
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  FUSED_PIPELINE : Unknown variant id = " << vid << std::endl;
+  }
+
+}
+
+void FUSED_PIPELINE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "separate");
+  addVariantTuningName(vid, "fused");
+}
+
+} // end namespace apps
+} // end namespace rajaperf
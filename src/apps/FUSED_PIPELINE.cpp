@@ -0,0 +1,152 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSED_PIPELINE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+FUSED_PIPELINE::FUSED_PIPELINE(const RunParams& params)
+  : KernelBase(rajaperf::Apps_FUSED_PIPELINE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(700);
+
+  m_pipeline = static_cast<Pipeline>( getKernelParam("pipeline", 0, {0, 1}) );
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  const Index_type num_bodies = (m_pipeline == Pipeline::Stream) ? 3 : 2;
+
+  setItsPerRep( num_bodies * getActualProblemSize() );
+  setKernelsPerRep( num_bodies );
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  if (m_pipeline == Pipeline::Stream) {
+    setFLOPsPerRep((1 +
+                    1 +
+                    2) * getActualProblemSize());
+  } else {
+    setFLOPsPerRep((2 +
+                    1) * getActualProblemSize());
+  }
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(Streaming);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+FUSED_PIPELINE::~FUSED_PIPELINE()
+{
+}
+
+bool FUSED_PIPELINE::isFused(VariantID vid, size_t tune_idx) const
+{
+  const std::string& name = getVariantTuningName(vid, tune_idx);
+  return name.compare(0, 5, "fused") == 0;
+}
+
+//
+// The separate tunings read and write the arrays of each body. The fused
+// tunings read each array that is read before it is written once and write
+// each array once, ie. MUL does not read b and PRESSURE_BODY2 does not read
+// bvc. Tunings before setting up the kernel tunings, ie. in the
+// constructor, are counted as separate.
+//
+Index_type FUSED_PIPELINE::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const bool fused = (tune_idx < getNumVariantTunings(vid))
+                   ? isFused(vid, tune_idx) : false;
+
+  Index_type bytes = 0;
+  if (m_pipeline == Pipeline::Stream) {
+    if (fused) {
+      bytes = (3*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize();
+    } else {
+      bytes = (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+              (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() +
+              (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize();
+    }
+  } else {
+    if (fused) {
+      bytes = (2*sizeof(Real_type) + 3*sizeof(Real_type)) * getActualProblemSize();
+    } else {
+      bytes = (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+              (1*sizeof(Real_type) + 3*sizeof(Real_type)) * getActualProblemSize();
+    }
+  }
+  return bytes;
+}
+
+void FUSED_PIPELINE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  if (m_pipeline == Pipeline::Stream) {
+    allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, vid);
+    allocAndInitData(m_b, getActualProblemSize(), vid);
+    allocAndInitData(m_c, getActualProblemSize(), vid);
+    m_alpha = 0.25;
+  } else {
+    allocAndInitData(m_compression, getActualProblemSize(), vid);
+    allocAndInitData(m_bvc, getActualProblemSize(), vid);
+    allocAndInitDataConst(m_p_new, getActualProblemSize(), 0.0, vid);
+    allocAndInitData(m_e_old, getActualProblemSize(), vid);
+    allocAndInitData(m_vnewc, getActualProblemSize(), vid);
+
+    initData(m_cls, vid);
+    initData(m_p_cut, vid);
+    initData(m_pmin, vid);
+    initData(m_eosvmax, vid);
+  }
+}
+
+void FUSED_PIPELINE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  if (m_pipeline == Pipeline::Stream) {
+    checksum[vid][tune_idx] += calcChecksum(m_a, getActualProblemSize(), checksum_scale_factor , vid);
+    checksum[vid][tune_idx] += calcChecksum(m_b, getActualProblemSize(), checksum_scale_factor , vid);
+    checksum[vid][tune_idx] += calcChecksum(m_c, getActualProblemSize(), checksum_scale_factor , vid);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_p_new, getActualProblemSize(), checksum_scale_factor , vid);
+  }
+}
+
+void FUSED_PIPELINE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  if (m_pipeline == Pipeline::Stream) {
+    deallocData(m_a, vid);
+    deallocData(m_b, vid);
+    deallocData(m_c, vid);
+  } else {
+    deallocData(m_compression, vid);
+    deallocData(m_bvc, vid);
+    deallocData(m_p_new, vid);
+    deallocData(m_e_old, vid);
+    deallocData(m_vnewc, vid);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FUSED_PIPELINE kernel reference implementation:
+///
+/// The kernel runs a pipeline of the loop bodies of other kernels over the
+/// same arrays, chosen with the kernel parameter "pipeline":
+///
+/// 0: the Stream_MUL, Stream_ADD, and Stream_TRIAD bodies, with alpha 0.25
+///    so that the values neither grow nor vanish over the reps
+/// 1: the two loops of Apps_PRESSURE
+///
+/// The "separate" tunings run one loop, or GPU kernel, per body as the
+/// kernels do on their own:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   MUL_BODY;
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   ADD_BODY;
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   TRIAD_BODY;
+/// }
+///
+/// and the "fused" tunings run all the bodies for each index in one loop:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   MUL_BODY;
+///   ADD_BODY;
+///   TRIAD_BODY;
+/// }
+///
+/// The "persistent" tunings of the GPU variants run the separate loops for
+/// all the reps in one cooperative kernel, synchronizing the grid where the
+/// separate tunings start a new kernel, so they show the time of the
+/// separate tunings without the launch latency.
+///
+/// All the tunings compute the same values. The bytes per rep of the fused tunings
+/// count each array once and do not count reads of values written earlier
+/// in the same iteration, so the difference in bytes per rep of the two
+/// tunings is the traffic saved by fusing.
+///
+
+#ifndef RAJAPerf_Apps_FUSED_PIPELINE_HPP
+#define RAJAPerf_Apps_FUSED_PIPELINE_HPP
+
+#include "stream/MUL.hpp"
+#include "stream/ADD.hpp"
+#include "stream/TRIAD.hpp"
+#include "apps/PRESSURE.hpp"
+
+#define FUSED_PIPELINE_STREAM_DATA_SETUP \
+  using Data_type = Real_type; \
+  TRIAD_DATA_SETUP;
+
+#define FUSED_PIPELINE_STREAM_FUSED_BODY \
+  MUL_BODY; \
+  ADD_BODY; \
+  TRIAD_BODY;
+
+#define FUSED_PIPELINE_PRESSURE_DATA_SETUP \
+  PRESSURE_DATA_SETUP;
+
+#define FUSED_PIPELINE_PRESSURE_FUSED_BODY \
+  PRESSURE_BODY1; \
+  PRESSURE_BODY2;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class FUSED_PIPELINE : public KernelBase
+{
+public:
+
+  FUSED_PIPELINE(const RunParams& params);
+
+  ~FUSED_PIPELINE();
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FUSED_PIPELINE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  template < size_t block_size >
+  void runCudaVariantSeparate(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantFused(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantPersistent(VariantID vid);
+
+  template < size_t block_size >
+  void runHipVariantSeparate(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantFused(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantPersistent(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  enum struct Pipeline { Stream = 0, Pressure = 1 };
+
+  // true for the fused tunings, given by the start of the tuning name
+  bool isFused(VariantID vid, size_t tune_idx) const;
+
+  Pipeline m_pipeline;
+
+  Real_ptr m_a;
+  Real_ptr m_b;
+  Real_ptr m_c;
+  Real_type m_alpha;
+
+  Real_ptr m_compression;
+  Real_ptr m_bvc;
+  Real_ptr m_p_new;
+  Real_ptr m_e_old;
+  Real_ptr m_vnewc;
+
+  Real_type m_cls;
+  Real_type m_p_cut;
+  Real_type m_pmin;
+  Real_type m_eosvmax;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
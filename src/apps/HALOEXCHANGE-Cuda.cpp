@@ -13,6 +13,10 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/IndexUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include "HaloCompression.hpp"
 
 #include <iostream>
 
@@ -21,9 +25,11 @@ namespace rajaperf
 namespace apps
 {
 
-template < size_t block_size >
+template < size_t block_size, bool read_only = false >
 __launch_bounds__(block_size)
-__global__ void haloexchange_pack(Real_ptr buffer, Int_ptr list, Real_ptr var,
+__global__ void haloexchange_pack(Real_ptr buffer,
+                                  gpu_read_only::ptr_type<Int_type, read_only> list,
+                                  gpu_read_only::ptr_type<Real_type, read_only> var,
                                   Index_type len)
 {
    Index_type i = threadIdx.x + blockIdx.x * block_size;
@@ -33,9 +39,11 @@ __global__ void haloexchange_pack(Real_ptr buffer, Int_ptr list, Real_ptr var,
    }
 }
 
-template < size_t block_size >
+template < size_t block_size, bool read_only = false >
 __launch_bounds__(block_size)
-__global__ void haloexchange_unpack(Real_ptr buffer, Int_ptr list, Real_ptr var,
+__global__ void haloexchange_unpack(gpu_read_only::ptr_type<Real_type, read_only> buffer,
+                                    gpu_read_only::ptr_type<Int_type, read_only> list,
+                                    Real_ptr var,
                                     Index_type len)
 {
    Index_type i = threadIdx.x + blockIdx.x * block_size;
@@ -46,7 +54,32 @@ __global__ void haloexchange_unpack(Real_ptr buffer, Int_ptr list, Real_ptr var,
 }
 
 
-template < size_t block_size >
+template < typename IndexList_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void haloexchange_pack_index(Real_ptr buffer, IndexList_type* list,
+                                        Real_ptr var, IndexList_type len)
+{
+   IndexList_type i = threadIdx.x + blockIdx.x * block_size;
+
+   if (i < len) {
+     HALOEXCHANGE_PACK_BODY;
+   }
+}
+
+template < typename IndexList_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void haloexchange_unpack_index(Real_ptr buffer, IndexList_type* list,
+                                          Real_ptr var, IndexList_type len)
+{
+   IndexList_type i = threadIdx.x + blockIdx.x * block_size;
+
+   if (i < len) {
+     HALOEXCHANGE_UNPACK_BODY;
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void HALOEXCHANGE::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -97,7 +130,6 @@ void HALOEXCHANGE::runCudaVariantImpl(VariantID vid)
 
   } else if ( vid == RAJA_CUDA ) {
 
-    using EXEC_POL = RAJA::cuda_exec<block_size, true /*async*/>;
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -111,7 +143,7 @@ void HALOEXCHANGE::runCudaVariantImpl(VariantID vid)
           auto haloexchange_pack_base_lam = [=] __device__ (Index_type i) {
                 HALOEXCHANGE_PACK_BODY;
               };
-          RAJA::forall<EXEC_POL>( res,
+          gpu_launch::forall< block_size, launch >( res,
               RAJA::TypedRangeSegment<Index_type>(0, len),
               haloexchange_pack_base_lam );
           buffer += len;
@@ -128,7 +160,7 @@ void HALOEXCHANGE::runCudaVariantImpl(VariantID vid)
           auto haloexchange_unpack_base_lam = [=] __device__ (Index_type i) {
                 HALOEXCHANGE_UNPACK_BODY;
               };
-          RAJA::forall<EXEC_POL>( res,
+          gpu_launch::forall< block_size, launch >( res,
               RAJA::TypedRangeSegment<Index_type>(0, len),
               haloexchange_unpack_base_lam );
           buffer += len;
@@ -144,7 +176,352 @@ void HALOEXCHANGE::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(HALOEXCHANGE, Cuda)
+template < size_t block_size >
+void HALOEXCHANGE::runCudaVariantGraph(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    cudaGraphExec_t graph_exec = detail::captureCudaGraph(res.get_stream(), [&]() {
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          haloexchange_pack<block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          haloexchange_unpack<block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+
+    });
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaGraphLaunch( graph_exec, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+
+    }
+    stopTimer();
+
+    cudaErrchk( cudaGraphExecDestroy( graph_exec ) );
+
+  } else {
+     getCout() << "\n HALOEXCHANGE : Unknown Cuda graph variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void HALOEXCHANGE::runCudaVariantReadOnly(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          haloexchange_pack<block_size, true><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          haloexchange_unpack<block_size, true><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n HALOEXCHANGE : Unknown Cuda read only variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void HALOEXCHANGE::runCudaVariantCompress(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    HALO_COMPRESS_DATA_SETUP(block_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      startPhaseTimer(halo_compress::pack);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          haloexchange_pack<block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+      stopPhaseTimer(halo_compress::pack);
+
+      startPhaseTimer(halo_compress::compress);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        dim3 nthreads_per_block(block_size);
+        dim3 nblocks((message_lens[l] + block_size-1) / block_size);
+        constexpr size_t shmem = 0;
+        halo_compress::compress_message<block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(
+            buffers[l], message_lens[l], compressed_slots[l], compressed_chunk_bytes[l]);
+        cudaErrchk( cudaGetLastError() );
+      }
+      stopPhaseTimer(halo_compress::compress);
+
+      startPhaseTimer(halo_compress::decompress);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        dim3 nthreads_per_block(block_size);
+        dim3 nblocks((message_lens[l] + block_size-1) / block_size);
+        constexpr size_t shmem = 0;
+        halo_compress::decompress_message<block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(
+            buffers[l], message_lens[l], compressed_slots[l]);
+        cudaErrchk( cudaGetLastError() );
+      }
+      stopPhaseTimer(halo_compress::decompress);
+
+      startPhaseTimer(halo_compress::unpack);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          haloexchange_unpack<block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+      stopPhaseTimer(halo_compress::unpack);
+
+    }
+    stopTimer();
+
+    m_compressed_bytes[vid].resize(getNumVariantTunings(vid));
+    HALO_COMPRESS_DATA_TEARDOWN(block_size,
+                                m_compressed_bytes[vid][tune_idx].message_bytes,
+                                m_compressed_bytes[vid][tune_idx].compressed_bytes);
+
+  } else {
+     getCout() << "\n HALOEXCHANGE : Unknown Cuda compress variant id = " << vid << std::endl;
+  }
+}
+
+void HALOEXCHANGE::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if (vid == Base_CUDA && run_params.getGPUStream() != 0) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantGraph<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+  }
+
+  if (vid == Base_CUDA) {
+    RAJAPERF_GPU_READ_ONLY_TUNING_RUN(Cuda, ReadOnly)
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantCompress<block_size>(vid, tune_idx);
+        }
+        t += 1;
+      }
+    });
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Cuda, Impl, )
+
+  }
+
+}
+
+void HALOEXCHANGE::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if (vid == Base_CUDA && run_params.getGPUStream() != 0) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "graph_"+std::to_string(block_size));
+      }
+    });
+  }
+
+  if (vid == Base_CUDA) {
+    RAJAPERF_GPU_READ_ONLY_TUNING_NAMES
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "compress_"+std::to_string(block_size));
+      }
+    });
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
+
+template < typename IndexList_type >
+void HALOEXCHANGE::runCudaVariantIndex(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  HALOEXCHANGE_INDEX_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        IndexList_type* list = width_pack_index_lists[l];
+        IndexList_type  len  = static_cast<IndexList_type>(pack_index_list_lengths[l]);
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          haloexchange_pack_index<IndexList_type, block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        IndexList_type* list = width_unpack_index_lists[l];
+        IndexList_type  len  = static_cast<IndexList_type>(unpack_index_list_lengths[l]);
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          haloexchange_unpack_index<IndexList_type, block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  HALOEXCHANGE : Unknown Cuda index variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_INDEX_WIDTH_RUN_BOILERPLATE(HALOEXCHANGE, Cuda)
 
 } // end namespace apps
 } // end namespace rajaperf
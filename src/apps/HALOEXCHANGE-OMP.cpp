@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/IndexUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -30,39 +32,87 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
     case Base_OpenMP : {
 
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+      if (tune_idx == 0) {
+
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          for (Index_type l = 0; l < num_neighbors; ++l) {
+            Real_ptr buffer = buffers[l];
+            Int_ptr list = pack_index_lists[l];
+            Index_type  len  = pack_index_list_lengths[l];
+            for (Index_type v = 0; v < num_vars; ++v) {
+              Real_ptr var = vars[v];
+              #pragma omp parallel for
+              for (Index_type i = 0; i < len; i++) {
+                HALOEXCHANGE_PACK_BODY;
+              }
+              buffer += len;
+            }
+          }
 
-        for (Index_type l = 0; l < num_neighbors; ++l) {
-          Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
-          for (Index_type v = 0; v < num_vars; ++v) {
-            Real_ptr var = vars[v];
-            #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
-              HALOEXCHANGE_PACK_BODY;
+          for (Index_type l = 0; l < num_neighbors; ++l) {
+            Real_ptr buffer = buffers[l];
+            Int_ptr list = unpack_index_lists[l];
+            Index_type  len  = unpack_index_list_lengths[l];
+            for (Index_type v = 0; v < num_vars; ++v) {
+              Real_ptr var = vars[v];
+              #pragma omp parallel for
+              for (Index_type i = 0; i < len; i++) {
+                HALOEXCHANGE_UNPACK_BODY;
+              }
+              buffer += len;
             }
-            buffer += len;
           }
+
         }
+        stopTimer();
+
+      } else {
+
+        //
+        // One thread generates a task for each neighbor and variable,
+        // the messages are packed before any are unpacked.
+        //
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          #pragma omp parallel
+          #pragma omp single nowait
+          {
+            for (Index_type l = 0; l < num_neighbors; ++l) {
+              Int_ptr list = pack_index_lists[l];
+              Index_type  len  = pack_index_list_lengths[l];
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr buffer = buffers[l] + v*len;
+                Real_ptr var = vars[v];
+                #pragma omp task firstprivate(buffer, list, len, var)
+                for (Index_type i = 0; i < len; i++) {
+                  HALOEXCHANGE_PACK_BODY;
+                }
+              }
+            }
 
-        for (Index_type l = 0; l < num_neighbors; ++l) {
-          Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
-          for (Index_type v = 0; v < num_vars; ++v) {
-            Real_ptr var = vars[v];
-            #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
-              HALOEXCHANGE_UNPACK_BODY;
+            #pragma omp taskwait
+
+            for (Index_type l = 0; l < num_neighbors; ++l) {
+              Int_ptr list = unpack_index_lists[l];
+              Index_type  len  = unpack_index_list_lengths[l];
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr buffer = buffers[l] + v*len;
+                Real_ptr var = vars[v];
+                #pragma omp task firstprivate(buffer, list, len, var)
+                for (Index_type i = 0; i < len; i++) {
+                  HALOEXCHANGE_UNPACK_BODY;
+                }
+              }
             }
-            buffer += len;
           }
+
         }
+        stopTimer();
 
       }
-      stopTimer();
 
       break;
     }
@@ -165,8 +215,74 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void HALOEXCHANGE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "task");
+  }
+}
+
+template < typename IndexList_type >
+void HALOEXCHANGE::runOpenMPVariantIndex(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_INDEX_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        IndexList_type* list = width_pack_index_lists[l];
+        IndexList_type  len  = static_cast<IndexList_type>(pack_index_list_lengths[l]);
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          #pragma omp parallel for
+          for (IndexList_type i = 0; i < len; i++) {
+            HALOEXCHANGE_PACK_BODY;
+          }
+          buffer += len;
+        }
+      }
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        IndexList_type* list = width_unpack_index_lists[l];
+        IndexList_type  len  = static_cast<IndexList_type>(unpack_index_list_lengths[l]);
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          #pragma omp parallel for
+          for (IndexList_type i = 0; i < len; i++) {
+            HALOEXCHANGE_UNPACK_BODY;
+          }
+          buffer += len;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  HALOEXCHANGE : Unknown OpenMP index variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_INDEX_WIDTH_RUN_BOILERPLATE(HALOEXCHANGE, OpenMP)
+
 } // end namespace apps
 } // end namespace rajaperf
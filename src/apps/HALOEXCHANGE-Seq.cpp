@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/IndexUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -161,5 +163,53 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+template < typename IndexList_type >
+void HALOEXCHANGE::runSeqVariantIndex(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_INDEX_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        IndexList_type* list = width_pack_index_lists[l];
+        IndexList_type  len  = static_cast<IndexList_type>(pack_index_list_lengths[l]);
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          for (IndexList_type i = 0; i < len; i++) {
+            HALOEXCHANGE_PACK_BODY;
+          }
+          buffer += len;
+        }
+      }
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        IndexList_type* list = width_unpack_index_lists[l];
+        IndexList_type  len  = static_cast<IndexList_type>(unpack_index_list_lengths[l]);
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          for (IndexList_type i = 0; i < len; i++) {
+            HALOEXCHANGE_UNPACK_BODY;
+          }
+          buffer += len;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  HALOEXCHANGE : Unknown Seq index variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_INDEX_WIDTH_RUN_BOILERPLATE(HALOEXCHANGE, Seq)
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include "HaloCompression.hpp"
+
 #include <cmath>
 
 namespace rajaperf
@@ -38,8 +40,8 @@ HALOEXCHANGE::HALOEXCHANGE(const RunParams& params)
   m_grid_dims[0] = cbrt_run_size;
   m_grid_dims[1] = cbrt_run_size;
   m_grid_dims[2] = cbrt_run_size;
-  m_halo_width = m_halo_width_default;
-  m_num_vars   = m_num_vars_default;
+  m_halo_width = getKernelParam("halo_width", m_halo_width_default);
+  m_num_vars   = getKernelParam("num_vars", m_num_vars_default);
 
   m_grid_plus_halo_dims[0] = m_grid_dims[0] + 2*m_halo_width;
   m_grid_plus_halo_dims[1] = m_grid_dims[1] + 2*m_halo_width;
@@ -58,8 +60,17 @@ HALOEXCHANGE::HALOEXCHANGE(const RunParams& params)
                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
   setFLOPsPerRep(0);
 
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+  setPhaseNames(halo_compress::getPhaseNames());
+  setMetricNames(halo_compress::getMetricNames());
+#endif
+
   setUsesFeature(Forall);
 
+  setHasPattern(GatherScatter);
+
+  setUsesIndexWidths();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -82,7 +93,39 @@ HALOEXCHANGE::~HALOEXCHANGE()
 {
 }
 
-void HALOEXCHANGE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// Index width tunings read their index lists in the index type of the
+// tuning.
+//
+Index_type HALOEXCHANGE::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const IndexWidth width = getIndexWidth(vid, tune_idx);
+  if (width == IndexWidth::Default) {
+    return KernelBase::getBytesPerRep(vid, tune_idx);
+  }
+  const Index_type index_size = index_width::getIndexSize(width);
+  return (0*index_size + 1*index_size) * getItsPerRep() +
+         (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+         (0*index_size + 1*index_size) * getItsPerRep() +
+         (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep();
+}
+
+std::vector<double> HALOEXCHANGE::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx >= m_compressed_bytes[vid].size() ||
+      m_compressed_bytes[vid][tune_idx].message_bytes == 0) {
+    return {};
+  }
+  const std::vector<double> phase_times = getAvgPhaseTimes(vid, tune_idx);
+  const double run_reps = static_cast<double>(getRunReps());
+  return halo_compress::getMetrics(
+      m_compressed_bytes[vid][tune_idx].message_bytes,
+      m_compressed_bytes[vid][tune_idx].compressed_bytes,
+      phase_times.at(halo_compress::compress) / run_reps,
+      phase_times.at(halo_compress::decompress) / run_reps);
+}
+
+void HALOEXCHANGE::setUp(VariantID vid, size_t tune_idx)
 {
   m_vars.resize(m_num_vars, nullptr);
   for (Index_type v = 0; v < m_num_vars; ++v) {
@@ -104,6 +147,10 @@ void HALOEXCHANGE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   m_unpack_index_list_lengths.resize(s_num_neighbors, 0);
   create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
 
+  if (getIndexWidth(vid, tune_idx) != IndexWidth::Default) {
+    RAJAPERF_INDEX_WIDTH_DISPATCH(getIndexWidth(vid, tune_idx), create_width_lists, vid);
+  }
+
   m_buffers.resize(s_num_neighbors, nullptr);
   for (Index_type l = 0; l < s_num_neighbors; ++l) {
     Index_type buffer_len = m_num_vars * m_pack_index_list_lengths[l];
@@ -118,13 +165,17 @@ void HALOEXCHANGE::updateChecksum(VariantID vid, size_t tune_idx)
   }
 }
 
-void HALOEXCHANGE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::tearDown(VariantID vid, size_t tune_idx)
 {
   for (int l = 0; l < s_num_neighbors; ++l) {
     deallocData(m_buffers[l], vid);
   }
   m_buffers.clear();
 
+  if (getIndexWidth(vid, tune_idx) != IndexWidth::Default) {
+    RAJAPERF_INDEX_WIDTH_DISPATCH(getIndexWidth(vid, tune_idx), destroy_width_lists, vid);
+  }
+
   destroy_unpack_lists(m_unpack_index_lists, s_num_neighbors, vid);
   m_unpack_index_list_lengths.clear();
   m_unpack_index_lists.clear();
@@ -445,5 +496,39 @@ void HALOEXCHANGE::destroy_unpack_lists(
   }
 }
 
+//
+// Copy the index lists to IndexList_type for index width tunings.
+//
+template < typename IndexList_type >
+void HALOEXCHANGE::create_width_lists(VariantID vid)
+{
+  m_width_pack_index_lists.resize(s_num_neighbors, nullptr);
+  m_width_unpack_index_lists.resize(s_num_neighbors, nullptr);
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    IndexList_type* pack_list;
+    allocAndCopyIndexData(pack_list, m_pack_index_lists[l],
+                          m_pack_index_list_lengths[l], vid);
+    m_width_pack_index_lists[l] = pack_list;
+
+    IndexList_type* unpack_list;
+    allocAndCopyIndexData(unpack_list, m_unpack_index_lists[l],
+                          m_unpack_index_list_lengths[l], vid);
+    m_width_unpack_index_lists[l] = unpack_list;
+  }
+}
+
+template < typename IndexList_type >
+void HALOEXCHANGE::destroy_width_lists(VariantID vid)
+{
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    IndexList_type* pack_list = static_cast<IndexList_type*>(m_width_pack_index_lists[l]);
+    deallocData(pack_list, vid);
+    IndexList_type* unpack_list = static_cast<IndexList_type*>(m_width_unpack_index_lists[l]);
+    deallocData(unpack_list, vid);
+  }
+  m_width_pack_index_lists.clear();
+  m_width_unpack_index_lists.clear();
+}
+
 } // end namespace apps
 } // end namespace rajaperf
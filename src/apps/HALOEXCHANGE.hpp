@@ -41,6 +41,25 @@
 ///   }
 /// }
 ///
+/// The "task" tuning of the Base OpenMP variant packs and unpacks the part
+/// of each variable for each neighbor in its own OpenMP task instead of a
+/// parallel for per part.
+///
+/// The "ldg" tunings of the Base GPU variants load the index lists and
+/// the data that the pack and unpack kernels only read through the
+/// read-only data cache.
+///
+/// The "compress" tunings of the Base GPU variants compress each packed
+/// message on the device before it would be sent and decompress it into
+/// the buffer before unpacking (see HaloCompression.hpp). They time the
+/// pack, compress, decompress, and unpack phases and report the
+/// compression ratio and the network bandwidth below which compression
+/// would pay for itself in the metrics file.
+///
+/// The index width tunings of the Base variants pack and unpack through
+/// copies of the index lists in 32 or 64 bit integers, with loop indices of
+/// the same type, see common/IndexUtils.hpp.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_HPP
@@ -56,6 +75,16 @@
   std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists; \
   std::vector<Index_type> unpack_index_list_lengths = m_unpack_index_list_lengths;
 
+#define HALOEXCHANGE_INDEX_DATA_SETUP \
+  HALOEXCHANGE_DATA_SETUP; \
+\
+  std::vector<IndexList_type*> width_pack_index_lists(num_neighbors); \
+  std::vector<IndexList_type*> width_unpack_index_lists(num_neighbors); \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    width_pack_index_lists[l] = static_cast<IndexList_type*>(m_width_pack_index_lists[l]); \
+    width_unpack_index_lists[l] = static_cast<IndexList_type*>(m_width_unpack_index_lists[l]); \
+  }
+
 #define HALOEXCHANGE_PACK_BODY \
   buffer[i] = var[list[i]];
 
@@ -88,18 +117,48 @@ public:
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
 
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
   void runSeqVariant(VariantID vid, size_t tune_idx);
   void runOpenMPVariant(VariantID vid, size_t tune_idx);
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantGraph(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantReadOnly(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantCompress(VariantID vid, size_t tune_idx);
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantGraph(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantReadOnly(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantCompress(VariantID vid, size_t tune_idx);
+
+  void runSeqIndexVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPIndexVariant(VariantID vid, size_t tune_idx);
+  void runCudaIndexVariant(VariantID vid, size_t tune_idx);
+  void runHipIndexVariant(VariantID vid, size_t tune_idx);
+  template < typename IndexList_type >
+  void runSeqVariantIndex(VariantID vid);
+  template < typename IndexList_type >
+  void runOpenMPVariantIndex(VariantID vid);
+  template < typename IndexList_type >
+  void runCudaVariantIndex(VariantID vid);
+  template < typename IndexList_type >
+  void runHipVariantIndex(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -127,6 +186,19 @@ private:
   std::vector<Int_ptr> m_unpack_index_lists;
   std::vector<Index_type > m_unpack_index_list_lengths;
 
+  // copies of the index lists of index width tunings, arrays of IndexList_type
+  std::vector<void*> m_width_pack_index_lists;
+  std::vector<void*> m_width_unpack_index_lists;
+
+  // message bytes of a rep before and after compression of the compress
+  // tunings that were run, by tuning
+  struct CompressedBytes
+  {
+    Index_type message_bytes = 0;
+    Index_type compressed_bytes = 0;
+  };
+  std::vector<CompressedBytes> m_compressed_bytes[NumVariants];
+
   void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
                          std::vector<Index_type >& pack_index_list_lengths,
                          const Index_type halo_width, const Index_type* grid_dims,
@@ -143,6 +215,11 @@ private:
   void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
                             const Index_type num_neighbors,
                             VariantID vid);
+
+  template < typename IndexList_type >
+  void create_width_lists(VariantID vid);
+  template < typename IndexList_type >
+  void destroy_width_lists(VariantID vid);
 };
 
 } // end namespace apps
@@ -14,6 +14,9 @@
 
 #include "common/HipDataUtils.hpp"
 
+#include "HaloCompression.hpp"
+
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -49,6 +52,22 @@ namespace apps
   deallocData(DataSpace::HipPinned, unpack_var_ptrs); \
   deallocData(DataSpace::HipPinned, unpack_len_ptrs);
 
+#define HALOEXCHANGE_FUSED_COMPRESS_SETUP_HIP \
+  Real_ptr*       compress_buffer_ptrs; \
+  Index_type*     compress_len_ptrs; \
+  unsigned char** compress_slot_ptrs; \
+  Index_type**    compress_chunk_bytes_ptrs; \
+  allocData(DataSpace::HipPinned, compress_buffer_ptrs,      num_neighbors); \
+  allocData(DataSpace::HipPinned, compress_len_ptrs,         num_neighbors); \
+  allocData(DataSpace::HipPinned, compress_slot_ptrs,        num_neighbors); \
+  allocData(DataSpace::HipPinned, compress_chunk_bytes_ptrs, num_neighbors);
+
+#define HALOEXCHANGE_FUSED_COMPRESS_TEARDOWN_HIP \
+  deallocData(DataSpace::HipPinned, compress_buffer_ptrs); \
+  deallocData(DataSpace::HipPinned, compress_len_ptrs); \
+  deallocData(DataSpace::HipPinned, compress_slot_ptrs); \
+  deallocData(DataSpace::HipPinned, compress_chunk_bytes_ptrs);
+
 template < size_t block_size >
 __launch_bounds__(block_size)
 __global__ void haloexchange_fused_pack(Real_ptr* pack_buffer_ptrs, Int_ptr* pack_list_ptrs,
@@ -248,7 +267,168 @@ void HALOEXCHANGE_FUSED::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(HALOEXCHANGE_FUSED, Hip)
+template < size_t block_size >
+void HALOEXCHANGE_FUSED::runHipVariantCompress(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  HALOEXCHANGE_FUSED_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP_HIP;
+    HALO_COMPRESS_DATA_SETUP(block_size);
+    HALOEXCHANGE_FUSED_COMPRESS_SETUP_HIP;
+
+    // the messages are the same every rep
+    Index_type max_nchunks = 1;
+    for (Index_type l = 0; l < num_neighbors; ++l) {
+      compress_buffer_ptrs[l] = buffers[l];
+      compress_len_ptrs[l] = message_lens[l];
+      compress_slot_ptrs[l] = compressed_slots[l];
+      compress_chunk_bytes_ptrs[l] = compressed_chunk_bytes[l];
+      max_nchunks = std::max(max_nchunks,
+                             RAJA_DIVIDE_CEILING_INT(message_lens[l], Index_type(block_size)));
+    }
+    dim3 compress_nthreads_per_block(block_size);
+    dim3 compress_nblocks(max_nchunks, num_neighbors);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      startPhaseTimer(halo_compress::pack);
+      Index_type pack_index = 0;
+      Index_type pack_len_sum = 0;
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          pack_buffer_ptrs[pack_index] = buffer;
+          pack_list_ptrs[pack_index] = list;
+          pack_var_ptrs[pack_index] = var;
+          pack_len_ptrs[pack_index] = len;
+          pack_len_sum += len;
+          pack_index += 1;
+          buffer += len;
+        }
+      }
+      Index_type pack_len_ave = (pack_len_sum + pack_index-1) / pack_index;
+      dim3 pack_nthreads_per_block(block_size);
+      dim3 pack_nblocks((pack_len_ave + block_size-1) / block_size, pack_index);
+      hipLaunchKernelGGL((haloexchange_fused_pack<block_size>), pack_nblocks, pack_nthreads_per_block, shmem, res.get_stream(),
+          pack_buffer_ptrs, pack_list_ptrs, pack_var_ptrs, pack_len_ptrs);
+      hipErrchk( hipGetLastError() );
+      stopPhaseTimer(halo_compress::pack);
+
+      startPhaseTimer(halo_compress::compress);
+      hipLaunchKernelGGL((halo_compress::compress_messages<block_size>), compress_nblocks, compress_nthreads_per_block, shmem, res.get_stream(),
+          compress_buffer_ptrs, compress_len_ptrs, compress_slot_ptrs, compress_chunk_bytes_ptrs);
+      hipErrchk( hipGetLastError() );
+      stopPhaseTimer(halo_compress::compress);
+
+      startPhaseTimer(halo_compress::decompress);
+      hipLaunchKernelGGL((halo_compress::decompress_messages<block_size>), compress_nblocks, compress_nthreads_per_block, shmem, res.get_stream(),
+          compress_buffer_ptrs, compress_len_ptrs, compress_slot_ptrs);
+      hipErrchk( hipGetLastError() );
+      stopPhaseTimer(halo_compress::decompress);
+
+      startPhaseTimer(halo_compress::unpack);
+      Index_type unpack_index = 0;
+      Index_type unpack_len_sum = 0;
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          unpack_buffer_ptrs[unpack_index] = buffer;
+          unpack_list_ptrs[unpack_index] = list;
+          unpack_var_ptrs[unpack_index] = var;
+          unpack_len_ptrs[unpack_index] = len;
+          unpack_len_sum += len;
+          unpack_index += 1;
+          buffer += len;
+        }
+      }
+      Index_type unpack_len_ave = (unpack_len_sum + unpack_index-1) / unpack_index;
+      dim3 unpack_nthreads_per_block(block_size);
+      dim3 unpack_nblocks((unpack_len_ave + block_size-1) / block_size, unpack_index);
+      hipLaunchKernelGGL((haloexchange_fused_unpack<block_size>), unpack_nblocks, unpack_nthreads_per_block, shmem, res.get_stream(),
+          unpack_buffer_ptrs, unpack_list_ptrs, unpack_var_ptrs, unpack_len_ptrs);
+      hipErrchk( hipGetLastError() );
+      stopPhaseTimer(halo_compress::unpack);
+
+    }
+    stopTimer();
+
+    HALOEXCHANGE_FUSED_COMPRESS_TEARDOWN_HIP;
+    m_compressed_bytes[vid].resize(getNumVariantTunings(vid));
+    HALO_COMPRESS_DATA_TEARDOWN(block_size,
+                                m_compressed_bytes[vid][tune_idx].message_bytes,
+                                m_compressed_bytes[vid][tune_idx].compressed_bytes);
+    HALOEXCHANGE_FUSED_MANUAL_FUSER_TEARDOWN_HIP;
+
+  } else {
+     getCout() << "\n HALOEXCHANGE_FUSED : Unknown Hip compress variant id = " << vid << std::endl;
+  }
+}
+
+void HALOEXCHANGE_FUSED::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if (vid == Base_HIP) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantCompress<block_size>(vid, tune_idx);
+        }
+        t += 1;
+      }
+    });
+  }
+}
+
+void HALOEXCHANGE_FUSED::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if (vid == Base_HIP) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "compress_"+std::to_string(block_size));
+      }
+    });
+  }
+}
+
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include "HaloCompression.hpp"
+
 #include <cmath>
 
 namespace rajaperf
@@ -38,8 +40,8 @@ HALOEXCHANGE_FUSED::HALOEXCHANGE_FUSED(const RunParams& params)
   m_grid_dims[0] = cbrt_run_size;
   m_grid_dims[1] = cbrt_run_size;
   m_grid_dims[2] = cbrt_run_size;
-  m_halo_width = m_halo_width_default;
-  m_num_vars   = m_num_vars_default;
+  m_halo_width = getKernelParam("halo_width", m_halo_width_default);
+  m_num_vars   = getKernelParam("num_vars", m_num_vars_default);
 
   m_grid_plus_halo_dims[0] = m_grid_dims[0] + 2*m_halo_width;
   m_grid_plus_halo_dims[1] = m_grid_dims[1] + 2*m_halo_width;
@@ -58,8 +60,15 @@ HALOEXCHANGE_FUSED::HALOEXCHANGE_FUSED(const RunParams& params)
                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
   setFLOPsPerRep(0);
 
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+  setPhaseNames(halo_compress::getPhaseNames());
+  setMetricNames(halo_compress::getMetricNames());
+#endif
+
   setUsesFeature(Workgroup);
 
+  setHasPattern(GatherScatter);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -82,6 +91,21 @@ HALOEXCHANGE_FUSED::~HALOEXCHANGE_FUSED()
 {
 }
 
+std::vector<double> HALOEXCHANGE_FUSED::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx >= m_compressed_bytes[vid].size() ||
+      m_compressed_bytes[vid][tune_idx].message_bytes == 0) {
+    return {};
+  }
+  const std::vector<double> phase_times = getAvgPhaseTimes(vid, tune_idx);
+  const double run_reps = static_cast<double>(getRunReps());
+  return halo_compress::getMetrics(
+      m_compressed_bytes[vid][tune_idx].message_bytes,
+      m_compressed_bytes[vid][tune_idx].compressed_bytes,
+      phase_times.at(halo_compress::compress) / run_reps,
+      phase_times.at(halo_compress::decompress) / run_reps);
+}
+
 void HALOEXCHANGE_FUSED::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   m_vars.resize(m_num_vars, nullptr);
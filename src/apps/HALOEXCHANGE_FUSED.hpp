@@ -41,6 +41,14 @@
 ///   }
 /// }
 ///
+/// The "compress" tunings of the Base GPU variants compress every packed
+/// message in one launch on the device before they would be sent and
+/// decompress them into the buffers in one launch before unpacking (see
+/// HaloCompression.hpp). They time the pack, compress, decompress, and
+/// unpack phases and report the compression ratio and the network
+/// bandwidth below which compression would pay for itself in the metrics
+/// file.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
@@ -132,6 +140,8 @@ public:
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
 
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
   void runSeqVariant(VariantID vid, size_t tune_idx);
   void runOpenMPVariant(VariantID vid, size_t tune_idx);
   void runCudaVariant(VariantID vid, size_t tune_idx);
@@ -143,7 +153,11 @@ public:
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantCompress(VariantID vid, size_t tune_idx);
+  template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantCompress(VariantID vid, size_t tune_idx);
 
 private:
   static const size_t default_gpu_block_size = 1024;
@@ -171,6 +185,15 @@ private:
   std::vector<Int_ptr> m_unpack_index_lists;
   std::vector<Index_type > m_unpack_index_list_lengths;
 
+  // message bytes of a rep before and after compression of the compress
+  // tunings that were run, by tuning
+  struct CompressedBytes
+  {
+    Index_type message_bytes = 0;
+    Index_type compressed_bytes = 0;
+  };
+  std::vector<CompressedBytes> m_compressed_bytes[NumVariants];
+
   void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
                          std::vector<Index_type >& pack_index_list_lengths,
                          const Index_type halo_width, const Index_type* grid_dims,
@@ -0,0 +1,309 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Lossless GPU compression of packed halo messages used by the compress
+/// tunings of HALOEXCHANGE and HALOEXCHANGE_FUSED.
+///
+/// Each message is split in chunks of block_size values and each chunk is
+/// compressed by one block into its own slot of compressed bytes. Value i
+/// of a chunk is coded as the XOR of its bits with those of value i-1,
+/// which zeroes the sign, exponent, and high mantissa bytes of smoothly
+/// varying values and the low mantissa bytes of values with few
+/// significant bits, and only the bytes between the leading and trailing
+/// zero bytes are stored:
+///
+///   slot[i]                        -- (leading zero bytes << 4) | trailing
+///                                     zero bytes of value i
+///   slot[block_size + offset_i...] -- the other bytes of value i, offset_i
+///                                     is the prefix sum of the number of
+///                                     bytes stored for values before i
+///
+/// The compressed size of a chunk is the header bytes plus the payload
+/// bytes, a sender would copy the chunks of a message together before
+/// sending it. Decompression reverses the prefix sum and the XOR with a
+/// block scan each.
+///
+
+#ifndef RAJAPerf_Apps_HaloCompression_HPP
+#define RAJAPerf_Apps_HaloCompression_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <string>
+#include <vector>
+
+//
+// Compressed slots and chunk sizes of each message, allocated like the
+// buffers in the data space of the variant.
+//
+#define HALO_COMPRESS_DATA_SETUP(block_size) \
+  std::vector<unsigned char*> compressed_slots(num_neighbors, nullptr); \
+  std::vector<Index_type*> compressed_chunk_bytes(num_neighbors, nullptr); \
+  std::vector<Index_type> message_lens(num_neighbors, 0); \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    message_lens[l] = num_vars * pack_index_list_lengths[l]; \
+    const Index_type nchunks = RAJA_DIVIDE_CEILING_INT(message_lens[l], (block_size)); \
+    allocData(getDataSpace(vid), compressed_slots[l], \
+              nchunks * halo_compress::slotBytes((block_size))); \
+    allocData(getDataSpace(vid), compressed_chunk_bytes[l], nchunks); \
+  }
+
+//
+// Sum the chunk sizes of the last rep into message_bytes and
+// compressed_bytes.
+//
+#define HALO_COMPRESS_DATA_TEARDOWN(block_size, message_bytes, compressed_bytes) \
+  message_bytes = 0; \
+  compressed_bytes = 0; \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    const Index_type nchunks = RAJA_DIVIDE_CEILING_INT(message_lens[l], (block_size)); \
+    std::vector<Index_type> chunk_bytes(nchunks); \
+    copyData(DataSpace::Host, chunk_bytes.data(), \
+             getDataSpace(vid), compressed_chunk_bytes[l], nchunks); \
+    message_bytes += message_lens[l] * sizeof(Real_type); \
+    for (Index_type c = 0; c < nchunks; ++c) { \
+      compressed_bytes += chunk_bytes[c]; \
+    } \
+    deallocData(getDataSpace(vid), compressed_slots[l]); \
+    deallocData(getDataSpace(vid), compressed_chunk_bytes[l]); \
+  }
+
+namespace rajaperf
+{
+namespace apps
+{
+namespace halo_compress
+{
+
+//
+// Phases timed by the compress tunings, in the order of getPhaseNames.
+//
+enum Phase : size_t { pack = 0, compress, decompress, unpack };
+
+inline std::vector<std::string> getPhaseNames()
+{
+  return {"pack", "compress", "decompress", "unpack"};
+}
+
+inline std::vector<std::string> getMetricNames()
+{
+  return {"message_bytes", "compressed_bytes", "compression_ratio",
+          "compress_sec", "decompress_sec", "break_even_GB/s"};
+}
+
+//
+// Metrics of a compress tuning from the message bytes of a rep before and
+// after compression and its phase times per rep. Compression saves time
+// when the network bandwidth is below the break even bandwidth, where
+// sending the bytes it saves takes as long as compressing and
+// decompressing.
+//
+inline std::vector<double> getMetrics(Index_type message_bytes,
+                                      Index_type compressed_bytes,
+                                      double compress_time,
+                                      double decompress_time)
+{
+  const double saved_bytes = static_cast<double>(message_bytes - compressed_bytes);
+  const double cost = compress_time + decompress_time;
+  return {static_cast<double>(message_bytes),
+          static_cast<double>(compressed_bytes),
+          compressed_bytes > 0 ? static_cast<double>(message_bytes) / compressed_bytes : 0.0,
+          compress_time,
+          decompress_time,
+          (cost > 0.0 && saved_bytes > 0.0) ? saved_bytes / cost / 1.0e9 : 0.0};
+}
+
+//
+// Bytes of the compressed slot of a chunk, a header byte and at most 8
+// payload bytes per value.
+//
+constexpr Index_type slotBytes(Index_type block_size)
+{
+  return 9 * block_size;
+}
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+
+struct Plus
+{
+  template < typename T >
+  __device__ T operator()(T a, T b) const { return a + b; }
+};
+
+struct BitXor
+{
+  template < typename T >
+  __device__ T operator()(T a, T b) const { return a ^ b; }
+};
+
+//
+// Inclusive scan of val over the threads of a block.
+//
+template < size_t block_size, typename T, typename Op >
+__device__ T blockInclusiveScan(T val, Op op)
+{
+  __shared__ T s_scan[block_size];
+
+  s_scan[threadIdx.x] = val;
+  __syncthreads();
+
+  for (size_t offset = 1; offset < block_size; offset *= 2) {
+    if (threadIdx.x >= offset) {
+      val = op(s_scan[threadIdx.x - offset], val);
+    }
+    __syncthreads();
+    s_scan[threadIdx.x] = val;
+    __syncthreads();
+  }
+
+  return val;
+}
+
+template < size_t block_size >
+__device__ void compressChunk(const Real_type* values, Index_type len,
+                              unsigned char* slots, Index_type* chunk_bytes,
+                              Index_type chunk)
+{
+  const Index_type start = chunk * block_size;
+  const Index_type i = start + threadIdx.x;
+  const bool valid = i < len;
+
+  unsigned long long delta = 0;
+  if (valid) {
+    delta = static_cast<unsigned long long>(__double_as_longlong(values[i]));
+    if (threadIdx.x > 0) {
+      delta ^= static_cast<unsigned long long>(__double_as_longlong(values[i-1]));
+    }
+  }
+
+  int lead = 8;
+  int trail = 0;
+  if (delta != 0) {
+    lead = __clzll(static_cast<long long>(delta)) / 8;
+    trail = (__ffsll(static_cast<long long>(delta)) - 1) / 8;
+  }
+  const Index_type nbytes = valid ? 8 - lead - trail : 0;
+
+  const Index_type end = blockInclusiveScan<block_size>(nbytes, Plus{});
+
+  unsigned char* slot = slots + chunk * slotBytes(block_size);
+  if (valid) {
+    slot[threadIdx.x] = static_cast<unsigned char>((lead << 4) | trail);
+    unsigned char* payload = slot + block_size + (end - nbytes);
+    for (Index_type b = 0; b < nbytes; ++b) {
+      payload[b] = static_cast<unsigned char>(delta >> (8*(trail + b)));
+    }
+  }
+
+  if (threadIdx.x == block_size-1) {
+    const Index_type nvals = (len - start < Index_type(block_size))
+                           ? len - start : Index_type(block_size);
+    chunk_bytes[chunk] = nvals + end;
+  }
+}
+
+template < size_t block_size >
+__device__ void decompressChunk(Real_type* values, Index_type len,
+                                const unsigned char* slots,
+                                Index_type chunk)
+{
+  const Index_type start = chunk * block_size;
+  const Index_type i = start + threadIdx.x;
+  const bool valid = i < len;
+
+  const unsigned char* slot = slots + chunk * slotBytes(block_size);
+
+  const int header = valid ? slot[threadIdx.x] : (8 << 4);
+  const int lead = header >> 4;
+  const int trail = header & 0xf;
+  const Index_type nbytes = 8 - lead - trail;
+
+  const Index_type end = blockInclusiveScan<block_size>(nbytes, Plus{});
+
+  unsigned long long delta = 0;
+  const unsigned char* payload = slot + block_size + (end - nbytes);
+  for (Index_type b = 0; b < nbytes; ++b) {
+    delta |= static_cast<unsigned long long>(payload[b]) << (8*(trail + b));
+  }
+
+  const unsigned long long bits = blockInclusiveScan<block_size>(delta, BitXor{});
+
+  if (valid) {
+    values[i] = __longlong_as_double(static_cast<long long>(bits));
+  }
+}
+
+//
+// Compress or decompress the message in buffer, one chunk per block.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void compress_message(Real_ptr buffer, Index_type len,
+                                 unsigned char* slots, Index_type* chunk_bytes)
+{
+  compressChunk<block_size>(buffer, len, slots, chunk_bytes, blockIdx.x);
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void decompress_message(Real_ptr buffer, Index_type len,
+                                   const unsigned char* slots)
+{
+  decompressChunk<block_size>(buffer, len, slots, blockIdx.x);
+}
+
+//
+// Compress or decompress every message in one launch, message blockIdx.y
+// with the blocks of x looping over its chunks.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void compress_messages(Real_ptr* buffer_ptrs, Index_type* len_ptrs,
+                                  unsigned char** slot_ptrs,
+                                  Index_type** chunk_bytes_ptrs)
+{
+  Index_type j = blockIdx.y;
+
+  Real_ptr       buffer      = buffer_ptrs[j];
+  Index_type     len         = len_ptrs[j];
+  unsigned char* slots       = slot_ptrs[j];
+  Index_type*    chunk_bytes = chunk_bytes_ptrs[j];
+
+  for (Index_type chunk = blockIdx.x;
+       chunk * Index_type(block_size) < len;
+       chunk += gridDim.x) {
+    compressChunk<block_size>(buffer, len, slots, chunk_bytes, chunk);
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void decompress_messages(Real_ptr* buffer_ptrs, Index_type* len_ptrs,
+                                    unsigned char** slot_ptrs)
+{
+  Index_type j = blockIdx.y;
+
+  Real_ptr       buffer = buffer_ptrs[j];
+  Index_type     len    = len_ptrs[j];
+  unsigned char* slots  = slot_ptrs[j];
+
+  for (Index_type chunk = blockIdx.x;
+       chunk * Index_type(block_size) < len;
+       chunk += gridDim.x) {
+    decompressChunk<block_size>(buffer, len, slots, chunk);
+  }
+}
+
+#endif
+
+} // end namespace halo_compress
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,262 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LBM_D3Q19.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+template < size_t block_size, bool aos >
+__launch_bounds__(block_size)
+__global__ void lbm_d3q19_ab(Real_ptr f, Real_ptr g,
+                             Index_type n, Index_type ncells,
+                             Real_type omega)
+{
+   Index_type c = blockIdx.x * block_size + threadIdx.x;
+   if (c < ncells) {
+     LBM_D3Q19_AB_BODY;
+   }
+}
+
+template < size_t block_size, bool aos >
+__launch_bounds__(block_size)
+__global__ void lbm_d3q19_aa(Real_ptr f,
+                             Index_type n, Index_type ncells,
+                             Real_type omega, bool odd)
+{
+   Index_type c = blockIdx.x * block_size + threadIdx.x;
+   if (c < ncells) {
+     LBM_D3Q19_AA_BODY;
+   }
+}
+
+template < size_t block_size, bool aos >
+__launch_bounds__(block_size)
+__global__ void lbm_d3q19_collide(Real_ptr f,
+                                  Index_type ncells,
+                                  Real_type omega)
+{
+   Index_type c = blockIdx.x * block_size + threadIdx.x;
+   if (c < ncells) {
+     LBM_D3Q19_COLLIDE_BODY;
+   }
+}
+
+template < size_t block_size, bool aos >
+__launch_bounds__(block_size)
+__global__ void lbm_d3q19_stream(Real_ptr f, Real_ptr g,
+                                 Index_type n, Index_type ncells)
+{
+   Index_type c = blockIdx.x * block_size + threadIdx.x;
+   if (c < ncells) {
+     LBM_D3Q19_STREAM_BODY;
+   }
+}
+
+
+template < size_t block_size, size_t lattice, bool launch >
+void LBM_D3Q19::runHipVariantImpl(VariantID vid)
+{
+  constexpr LBMPropagation propagation = getPropagation<lattice>();
+  constexpr bool aos = getAoS<lattice>();
+
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  LBM_D3Q19_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(ncells, block_size);
+      constexpr size_t shmem = 0;
+
+      if (propagation == LBMPropagation::ab) {
+
+        hipLaunchKernelGGL((lbm_d3q19_ab<block_size, aos>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           f, g, n, ncells, omega);
+        hipErrchk( hipGetLastError() );
+        LBM_D3Q19_SWAP;
+
+      } else if (propagation == LBMPropagation::aa) {
+
+        const bool odd = ((m_steps + irep) % 2) == 1;
+        hipLaunchKernelGGL((lbm_d3q19_aa<block_size, aos>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           f, n, ncells, omega, odd);
+        hipErrchk( hipGetLastError() );
+
+      } else {
+
+        hipLaunchKernelGGL((lbm_d3q19_collide<block_size, aos>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           f, ncells, omega);
+        hipErrchk( hipGetLastError() );
+        hipLaunchKernelGGL((lbm_d3q19_stream<block_size, aos>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           f, g, n, ncells);
+        hipErrchk( hipGetLastError() );
+        LBM_D3Q19_SWAP;
+
+      }
+
+    }
+    stopTimer();
+
+    m_steps += run_reps;
+    LBM_D3Q19_DATA_STORE;
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if (propagation == LBMPropagation::ab) {
+
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, ncells), [=] __device__ (Index_type c) {
+          LBM_D3Q19_AB_BODY;
+        });
+        LBM_D3Q19_SWAP;
+
+      } else if (propagation == LBMPropagation::aa) {
+
+        const bool odd = ((m_steps + irep) % 2) == 1;
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, ncells), [=] __device__ (Index_type c) {
+          LBM_D3Q19_AA_BODY;
+        });
+
+      } else {
+
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, ncells), [=] __device__ (Index_type c) {
+          LBM_D3Q19_COLLIDE_BODY;
+        });
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, ncells), [=] __device__ (Index_type c) {
+          LBM_D3Q19_STREAM_BODY;
+        });
+        LBM_D3Q19_SWAP;
+
+      }
+
+    }
+    stopTimer();
+
+    m_steps += run_reps;
+    LBM_D3Q19_DATA_STORE;
+
+  } else {
+     getCout() << "\n  LBM_D3Q19 : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+
+void LBM_D3Q19::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    seq_for(lattice_tunings_type{}, [&](auto lattice) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantImpl<block_size, decltype(lattice)::value>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    });
+
+  } else {
+
+    getCout() << "\n  LBM_D3Q19 : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runHipVariantImpl<block_size, 0, true>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+}
+
+void LBM_D3Q19::setHipTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    for (const std::string& name : getLatticeTuningNames()) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, name+"_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,151 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LBM_D3Q19.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < size_t lattice >
+void LBM_D3Q19::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  constexpr LBMPropagation propagation = getPropagation<lattice>();
+  constexpr bool aos = getAoS<lattice>();
+
+  const Index_type run_reps = getRunReps();
+
+  LBM_D3Q19_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (propagation == LBMPropagation::ab) {
+
+          #pragma omp parallel for
+          for (Index_type c = 0; c < ncells; ++c ) {
+            LBM_D3Q19_AB_BODY;
+          }
+          LBM_D3Q19_SWAP;
+
+        } else if (propagation == LBMPropagation::aa) {
+
+          const bool odd = ((m_steps + irep) % 2) == 1;
+          #pragma omp parallel for
+          for (Index_type c = 0; c < ncells; ++c ) {
+            LBM_D3Q19_AA_BODY;
+          }
+
+        } else {
+
+          #pragma omp parallel for
+          for (Index_type c = 0; c < ncells; ++c ) {
+            LBM_D3Q19_COLLIDE_BODY;
+          }
+          #pragma omp parallel for
+          for (Index_type c = 0; c < ncells; ++c ) {
+            LBM_D3Q19_STREAM_BODY;
+          }
+          LBM_D3Q19_SWAP;
+
+        }
+
+      }
+      stopTimer();
+
+      m_steps += run_reps;
+      LBM_D3Q19_DATA_STORE;
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (propagation == LBMPropagation::ab) {
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, ncells), [=](Index_type c) {
+            LBM_D3Q19_AB_BODY;
+          });
+          LBM_D3Q19_SWAP;
+
+        } else if (propagation == LBMPropagation::aa) {
+
+          const bool odd = ((m_steps + irep) % 2) == 1;
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, ncells), [=](Index_type c) {
+            LBM_D3Q19_AA_BODY;
+          });
+
+        } else {
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, ncells), [=](Index_type c) {
+            LBM_D3Q19_COLLIDE_BODY;
+          });
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, ncells), [=](Index_type c) {
+            LBM_D3Q19_STREAM_BODY;
+          });
+          LBM_D3Q19_SWAP;
+
+        }
+
+      }
+      stopTimer();
+
+      m_steps += run_reps;
+      LBM_D3Q19_DATA_STORE;
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  LBM_D3Q19 : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void LBM_D3Q19::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(lattice_tunings_type{}, [&](auto lattice) {
+    if (tune_idx == lattice) {
+      runOpenMPVariantImpl<lattice>(vid);
+    }
+  });
+}
+
+void LBM_D3Q19::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getLatticeTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,144 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LBM_D3Q19.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < size_t lattice >
+void LBM_D3Q19::runSeqVariantImpl(VariantID vid)
+{
+  constexpr LBMPropagation propagation = getPropagation<lattice>();
+  constexpr bool aos = getAoS<lattice>();
+
+  const Index_type run_reps = getRunReps();
+
+  LBM_D3Q19_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (propagation == LBMPropagation::ab) {
+
+          for (Index_type c = 0; c < ncells; ++c ) {
+            LBM_D3Q19_AB_BODY;
+          }
+          LBM_D3Q19_SWAP;
+
+        } else if (propagation == LBMPropagation::aa) {
+
+          const bool odd = ((m_steps + irep) % 2) == 1;
+          for (Index_type c = 0; c < ncells; ++c ) {
+            LBM_D3Q19_AA_BODY;
+          }
+
+        } else {
+
+          for (Index_type c = 0; c < ncells; ++c ) {
+            LBM_D3Q19_COLLIDE_BODY;
+          }
+          for (Index_type c = 0; c < ncells; ++c ) {
+            LBM_D3Q19_STREAM_BODY;
+          }
+          LBM_D3Q19_SWAP;
+
+        }
+
+      }
+      stopTimer();
+
+      m_steps += run_reps;
+      LBM_D3Q19_DATA_STORE;
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (propagation == LBMPropagation::ab) {
+
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, ncells), [=](Index_type c) {
+            LBM_D3Q19_AB_BODY;
+          });
+          LBM_D3Q19_SWAP;
+
+        } else if (propagation == LBMPropagation::aa) {
+
+          const bool odd = ((m_steps + irep) % 2) == 1;
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, ncells), [=](Index_type c) {
+            LBM_D3Q19_AA_BODY;
+          });
+
+        } else {
+
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, ncells), [=](Index_type c) {
+            LBM_D3Q19_COLLIDE_BODY;
+          });
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, ncells), [=](Index_type c) {
+            LBM_D3Q19_STREAM_BODY;
+          });
+          LBM_D3Q19_SWAP;
+
+        }
+
+      }
+      stopTimer();
+
+      m_steps += run_reps;
+      LBM_D3Q19_DATA_STORE;
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  LBM_D3Q19 : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void LBM_D3Q19::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(lattice_tunings_type{}, [&](auto lattice) {
+    if (tune_idx == lattice) {
+      runSeqVariantImpl<lattice>(vid);
+    }
+  });
+}
+
+void LBM_D3Q19::setSeqTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getLatticeTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
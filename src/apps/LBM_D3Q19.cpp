@@ -0,0 +1,205 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LBM_D3Q19.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+LBM_D3Q19::LBM_D3Q19(const RunParams& params)
+  : KernelBase(rajaperf::Apps_LBM_D3Q19, params)
+{
+  setDefaultProblemSize(100*100*100);
+  setDefaultReps(20);
+
+  m_n = std::max(Index_type(1),
+                 static_cast<Index_type>(std::cbrt(getTargetProblemSize()) + 0.5));
+
+  setActualProblemSize( m_n*m_n*m_n );
+
+  // relaxation rate 1/tau with tau = 0.8
+  m_omega = 1.25;
+
+  m_steps = 0;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  // 19 distributions summed into 4 moments, then 12 flops per relaxation
+  setFLOPsPerRep((49 + 10 + 12*LBM_D3Q19_NUM_DIRS) * getActualProblemSize());
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(Stencil);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+LBM_D3Q19::~LBM_D3Q19()
+{
+}
+
+const std::vector<std::string>& LBM_D3Q19::getLatticeTuningNames()
+{
+  static const std::vector<std::string> names{
+      "ab_soa", "ab_aos",
+      "aa_soa", "aa_aos",
+      "split_soa", "split_aos"};
+  return names;
+}
+
+size_t LBM_D3Q19::getLatticeTuning(const std::string& tuning_name) const
+{
+  const std::vector<std::string>& names = getLatticeTuningNames();
+  for (size_t l = 0; l < names.size(); ++l) {
+    if (tuning_name.compare(0, names[l].size(), names[l]) == 0) {
+      return l;
+    }
+  }
+  return 0;
+}
+
+//
+// Touched data size, not actual number of stores and loads. Tunings before
+// setting up the kernel tunings, ie. in the constructor, are counted as
+// ab_soa.
+//
+Index_type LBM_D3Q19::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const size_t lattice = (tune_idx < getNumVariantTunings(vid))
+      ? getLatticeTuning(getVariantTuningName(vid, tune_idx))
+      : 0;
+  const LBMPropagation propagation = static_cast<LBMPropagation>(lattice / 2);
+
+  const Index_type ncells = getActualProblemSize();
+
+  Index_type bytes =
+      (LBM_D3Q19_NUM_DIRS*sizeof(Real_type) +
+       LBM_D3Q19_NUM_DIRS*sizeof(Real_type)) * ncells;
+  if (propagation == LBMPropagation::split) {
+    bytes *= 2;
+  }
+  return bytes;
+}
+
+void LBM_D3Q19::setUp(VariantID vid, size_t tune_idx)
+{
+  const size_t lattice = getLatticeTuning(getVariantTuningName(vid, tune_idx));
+  const LBMPropagation propagation = static_cast<LBMPropagation>(lattice / 2);
+  const bool aos = (lattice % 2) == 1;
+
+  const Index_type ncells = getActualProblemSize();
+  const Index_type len = LBM_D3Q19_NUM_DIRS*ncells;
+
+  constexpr unsigned long long rho_seed = 4073;
+  constexpr unsigned long long ux_seed = 4079;
+  constexpr unsigned long long uy_seed = 4091;
+  constexpr unsigned long long uz_seed = 4093;
+
+  m_steps = 0;
+
+  //
+  // Equilibrium distributions of a density near 1 and a small velocity in
+  // each cell.
+  //
+  allocData(m_f, len, vid);
+  {
+    auto reset_f = scopedMoveData(m_f, len, vid);
+
+    Real_ptr f = m_f;
+    const Real_type omega = 1.0;
+    for (Index_type c = 0; c < ncells; ++c) {
+      const Real_type rho = 1.0 + 0.01*(detail::counterRandValue(rho_seed, c) - 0.5);
+      const Real_type ux = 0.05*(detail::counterRandValue(ux_seed, c) - 0.5);
+      const Real_type uy = 0.05*(detail::counterRandValue(uy_seed, c) - 0.5);
+      const Real_type uz = 0.05*(detail::counterRandValue(uz_seed, c) - 0.5);
+      const Real_type usq = 1.5*(ux*ux + uy*uy + uz*uz);
+
+      // relaxing zero distributions with omega 1 gives the equilibrium
+      Real_type fl[LBM_D3Q19_NUM_DIRS] = {0.0};
+      LBM_D3Q19_DIRECTIONS(LBM_D3Q19_RELAX)
+      LBM_D3Q19_DIRECTIONS(LBM_D3Q19_STORE_CELL)
+    }
+  }
+
+  if (propagation == LBMPropagation::aa) {
+    m_g = nullptr;
+  } else {
+    allocAndInitDataConst(m_g, len, 0.0, vid);
+  }
+}
+
+void LBM_D3Q19::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const size_t lattice = getLatticeTuning(getVariantTuningName(vid, tune_idx));
+  const LBMPropagation propagation = static_cast<LBMPropagation>(lattice / 2);
+  const bool aos = (lattice % 2) == 1;
+
+  const Index_type n = m_n;
+  const Index_type ncells = getActualProblemSize();
+  const Index_type len = LBM_D3Q19_NUM_DIRS*ncells;
+
+  //
+  // Gather the distributions into soa order after streaming so all tunings
+  // give the same checksum. After an even step of aa the distributions of
+  // a cell are still at the cells they stream from, with the directions
+  // reversed.
+  //
+  auto reset_f = scopedMoveData(m_f, len, vid);
+
+  const bool aa_even = (propagation == LBMPropagation::aa) && (m_steps % 2 == 1);
+
+  Real_ptr f = m_f;
+  std::vector<Real_type> soa(len);
+  for (Index_type c = 0; c < ncells; ++c) {
+    LBM_D3Q19_CELL
+    LBM_D3Q19_DIRECTIONS(LBM_D3Q19_GATHER)
+  }
+
+  checksum[vid][tune_idx] += detail::calcChecksum(soa.data(), len,
+                                                  checksum_scale_factor);
+}
+
+void LBM_D3Q19::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+
+  deallocData(m_f, vid);
+  if (m_g != nullptr) {
+    deallocData(m_g, vid);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,305 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// LBM_D3Q19 kernel reference implementation:
+///
+/// One time step of a lattice Boltzmann method with the D3Q19 velocity set
+/// and BGK collision on a periodic n x n x n lattice, with the collision and
+/// streaming fused as in production codes.
+///
+/// for (Index_type c = 0; c < ncells; ++c ) {
+///   Real_type fl[19];
+///   for (q = 0; q < 19; ++q) fl[q] = src[q][c];
+///   Real_type rho = sum of fl[q];
+///   Real_type u[3] = sum of fl[q]*e[q] / rho;
+///   for (q = 0; q < 19; ++q) {
+///     Real_type cu = 3.0*dot(e[q], u);
+///     fl[q] -= omega*(fl[q] - w[q]*rho*(1.0 + cu + 0.5*cu*cu - 1.5*dot(u, u)));
+///     dst[q][c + e[q]] = fl[q];
+///   }
+/// }
+/// swap(src, dst);
+///
+/// Tunings are a propagation pattern and a data layout, ie. aa_soa.
+/// Propagation patterns are
+///
+///   ab    -- two lattices, each step reads the distributions of a cell from
+///            one and pushes them to the neighbor cells in the other
+///   aa    -- one lattice updated in place, even steps read and write the
+///            distributions of a cell at the cell with the directions
+///            reversed and odd steps read them from and write them to the
+///            neighbor cells, so each step touches the lattice only once
+///   split -- two lattices with separate collide and stream loops, as is
+///            often written first, which moves the lattice twice per step
+///
+/// and layouts are
+///
+///   soa   -- structure of arrays, distribution q of cell c at q*ncells + c
+///   aos   -- array of structures, distribution q of cell c at c*19 + q
+///
+/// Each rep is one time step and the iterates are the lattice cells, so
+/// millions of iterates per second are the million lattice updates per
+/// second (MLUPS) of LBM codes. All tunings compute the same lattice, so give
+/// the same checksum.
+///
+
+#ifndef RAJAPerf_Apps_LBM_D3Q19_HPP
+#define RAJAPerf_Apps_LBM_D3Q19_HPP
+
+#define LBM_D3Q19_NUM_DIRS 19
+
+//
+// X(q, ex, ey, ez, w) for each direction q of D3Q19, ordered so the
+// direction opposite q > 0 is q+1 for odd q and q-1 for even q.
+//
+#define LBM_D3Q19_DIRECTIONS(X) \
+  X( 0,  0,  0,  0, 1.0/3.0 ) \
+  X( 1,  1,  0,  0, 1.0/18.0 ) \
+  X( 2, -1,  0,  0, 1.0/18.0 ) \
+  X( 3,  0,  1,  0, 1.0/18.0 ) \
+  X( 4,  0, -1,  0, 1.0/18.0 ) \
+  X( 5,  0,  0,  1, 1.0/18.0 ) \
+  X( 6,  0,  0, -1, 1.0/18.0 ) \
+  X( 7,  1,  1,  0, 1.0/36.0 ) \
+  X( 8, -1, -1,  0, 1.0/36.0 ) \
+  X( 9,  1, -1,  0, 1.0/36.0 ) \
+  X(10, -1,  1,  0, 1.0/36.0 ) \
+  X(11,  1,  0,  1, 1.0/36.0 ) \
+  X(12, -1,  0, -1, 1.0/36.0 ) \
+  X(13,  1,  0, -1, 1.0/36.0 ) \
+  X(14, -1,  0,  1, 1.0/36.0 ) \
+  X(15,  0,  1,  1, 1.0/36.0 ) \
+  X(16,  0, -1, -1, 1.0/36.0 ) \
+  X(17,  0,  1, -1, 1.0/36.0 ) \
+  X(18,  0, -1,  1, 1.0/36.0 )
+
+#define LBM_D3Q19_OPP(q) \
+  ((q) == 0 ? 0 : ((q) % 2 == 1 ? (q)+1 : (q)-1))
+
+#define LBM_D3Q19_DATA_SETUP \
+  Real_ptr f = m_f; \
+  Real_ptr g = m_g; \
+  \
+  const Index_type n = m_n; \
+  const Index_type ncells = m_n*m_n*m_n; \
+  const Real_type omega = m_omega;
+
+#define LBM_D3Q19_DATA_STORE \
+  m_f = f; \
+  m_g = g;
+
+#define LBM_D3Q19_SWAP \
+  { Real_ptr tmp = f; f = g; g = tmp; }
+
+// index of distribution q of cell c in the layout of the tuning
+#define LBM_D3Q19_IDX(c, q) \
+  (aos ? (c)*LBM_D3Q19_NUM_DIRS + (q) : (q)*ncells + (c))
+
+#define LBM_D3Q19_WRAP(a) \
+  ((a) < 0 ? (a)+n : ((a) >= n ? (a)-n : (a)))
+
+#define LBM_D3Q19_CELL \
+  const Index_type ci = c % n; \
+  const Index_type cj = (c / n) % n; \
+  const Index_type ck = c / (n*n);
+
+// neighbor of cell c at offset (ex, ey, ez) in the periodic lattice
+#define LBM_D3Q19_NBR(ex, ey, ez) \
+  (LBM_D3Q19_WRAP(ci+(ex)) + \
+   n*(LBM_D3Q19_WRAP(cj+(ey)) + n*LBM_D3Q19_WRAP(ck+(ez))))
+
+#define LBM_D3Q19_MOMENTS(q, ex, ey, ez, w) \
+  rho += fl[q]; \
+  ux += (ex)*fl[q]; \
+  uy += (ey)*fl[q]; \
+  uz += (ez)*fl[q];
+
+#define LBM_D3Q19_RELAX(q, ex, ey, ez, w) \
+  { \
+    const Real_type cu = 3.0*((ex)*ux + (ey)*uy + (ez)*uz); \
+    fl[q] -= omega*(fl[q] - (w)*rho*(1.0 + cu + 0.5*cu*cu - usq)); \
+  }
+
+#define LBM_D3Q19_COLLIDE \
+  { \
+    Real_type rho = 0.0; \
+    Real_type ux = 0.0; \
+    Real_type uy = 0.0; \
+    Real_type uz = 0.0; \
+    LBM_D3Q19_DIRECTIONS(LBM_D3Q19_MOMENTS) \
+    const Real_type rinv = 1.0 / rho; \
+    ux *= rinv; \
+    uy *= rinv; \
+    uz *= rinv; \
+    const Real_type usq = 1.5*(ux*ux + uy*uy + uz*uz); \
+    LBM_D3Q19_DIRECTIONS(LBM_D3Q19_RELAX) \
+  }
+
+//
+// Distribution accesses of the propagation patterns.
+//
+#define LBM_D3Q19_LOAD_CELL(q, ex, ey, ez, w) \
+  fl[q] = f[LBM_D3Q19_IDX(c, q)];
+
+#define LBM_D3Q19_STORE_CELL(q, ex, ey, ez, w) \
+  f[LBM_D3Q19_IDX(c, q)] = fl[q];
+
+#define LBM_D3Q19_PUSH(q, ex, ey, ez, w) \
+  g[LBM_D3Q19_IDX(LBM_D3Q19_NBR(ex, ey, ez), q)] = fl[q];
+
+#define LBM_D3Q19_PULL(q, ex, ey, ez, w) \
+  g[LBM_D3Q19_IDX(c, q)] = f[LBM_D3Q19_IDX(LBM_D3Q19_NBR(-(ex), -(ey), -(ez)), q)];
+
+#define LBM_D3Q19_AA_EVEN_LOAD(q, ex, ey, ez, w) \
+  fl[q] = f[LBM_D3Q19_IDX(c, q)];
+
+#define LBM_D3Q19_AA_EVEN_STORE(q, ex, ey, ez, w) \
+  f[LBM_D3Q19_IDX(c, LBM_D3Q19_OPP(q))] = fl[q];
+
+#define LBM_D3Q19_AA_ODD_LOAD(q, ex, ey, ez, w) \
+  fl[q] = f[LBM_D3Q19_IDX(LBM_D3Q19_NBR(-(ex), -(ey), -(ez)), LBM_D3Q19_OPP(q))];
+
+#define LBM_D3Q19_AA_ODD_STORE(q, ex, ey, ez, w) \
+  f[LBM_D3Q19_IDX(LBM_D3Q19_NBR(ex, ey, ez), q)] = fl[q];
+
+// soa distribution q of cell c streamed to c, after an even aa step at the
+// cell it streams from with the direction reversed
+#define LBM_D3Q19_GATHER(q, ex, ey, ez, w) \
+  soa[(q)*ncells + c] = aa_even \
+      ? f[LBM_D3Q19_IDX(LBM_D3Q19_NBR(-(ex), -(ey), -(ez)), LBM_D3Q19_OPP(q))] \
+      : f[LBM_D3Q19_IDX(c, q)];
+
+//
+// Loop bodies over cells c.
+//
+#define LBM_D3Q19_AB_BODY \
+  LBM_D3Q19_CELL \
+  Real_type fl[LBM_D3Q19_NUM_DIRS]; \
+  LBM_D3Q19_DIRECTIONS(LBM_D3Q19_LOAD_CELL) \
+  LBM_D3Q19_COLLIDE \
+  LBM_D3Q19_DIRECTIONS(LBM_D3Q19_PUSH)
+
+#define LBM_D3Q19_AA_EVEN_BODY \
+  Real_type fl[LBM_D3Q19_NUM_DIRS]; \
+  LBM_D3Q19_DIRECTIONS(LBM_D3Q19_AA_EVEN_LOAD) \
+  LBM_D3Q19_COLLIDE \
+  LBM_D3Q19_DIRECTIONS(LBM_D3Q19_AA_EVEN_STORE)
+
+#define LBM_D3Q19_AA_ODD_BODY \
+  LBM_D3Q19_CELL \
+  Real_type fl[LBM_D3Q19_NUM_DIRS]; \
+  LBM_D3Q19_DIRECTIONS(LBM_D3Q19_AA_ODD_LOAD) \
+  LBM_D3Q19_COLLIDE \
+  LBM_D3Q19_DIRECTIONS(LBM_D3Q19_AA_ODD_STORE)
+
+// odd is true on odd steps since setUp, counted from 0
+#define LBM_D3Q19_AA_BODY \
+  if (!odd) { \
+    LBM_D3Q19_AA_EVEN_BODY \
+  } else { \
+    LBM_D3Q19_AA_ODD_BODY \
+  }
+
+#define LBM_D3Q19_COLLIDE_BODY \
+  Real_type fl[LBM_D3Q19_NUM_DIRS]; \
+  LBM_D3Q19_DIRECTIONS(LBM_D3Q19_LOAD_CELL) \
+  LBM_D3Q19_COLLIDE \
+  LBM_D3Q19_DIRECTIONS(LBM_D3Q19_STORE_CELL)
+
+#define LBM_D3Q19_STREAM_BODY \
+  LBM_D3Q19_CELL \
+  LBM_D3Q19_DIRECTIONS(LBM_D3Q19_PULL)
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+enum struct LBMPropagation : int
+{
+  ab = 0,
+  aa,
+  split
+};
+
+class LBM_D3Q19 : public KernelBase
+{
+public:
+
+  LBM_D3Q19(const RunParams& params);
+
+  ~LBM_D3Q19();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  LBM_D3Q19 : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t lattice >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t lattice >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, size_t lattice, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, size_t lattice, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  //
+  // Lattice tunings are numbered 2*propagation + aos, in the order of
+  // getLatticeTuningNames.
+  //
+  using lattice_tunings_type = camp::int_seq<size_t, 0, 1, 2, 3, 4, 5>;
+
+  template < size_t lattice >
+  static constexpr LBMPropagation getPropagation() { return static_cast<LBMPropagation>(lattice / 2); }
+  template < size_t lattice >
+  static constexpr bool getAoS() { return (lattice % 2) == 1; }
+
+  static const std::vector<std::string>& getLatticeTuningNames();
+  size_t getLatticeTuning(const std::string& tuning_name) const;
+
+  Index_type m_n;
+  Real_type m_omega;
+
+  Index_type m_steps;
+
+  Real_ptr m_f;
+  Real_ptr m_g;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -22,49 +22,52 @@ namespace apps
 {
 
 //
-// Define thread block shape for Hip execution
+// Define thread block shape for Hip execution, the fastest varying
+// index of phi in the layout is mapped to x
 //
-#define m_block_sz (32)
-#define g_block_sz (gpu_block_size::greater_of_squarest_factor_pair(block_size/m_block_sz))
-#define z_block_sz (gpu_block_size::lesser_of_squarest_factor_pair(block_size/m_block_sz))
+#define x_block_sz (32)
+#define y_block_sz (gpu_block_size::greater_of_squarest_factor_pair(block_size/x_block_sz))
+#define z_block_sz (gpu_block_size::lesser_of_squarest_factor_pair(block_size/x_block_sz))
 
 #define LTIMES_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP \
-  m_block_sz, g_block_sz, z_block_sz
+  x_block_sz, y_block_sz, z_block_sz
 
 #define LTIMES_THREADS_PER_BLOCK_HIP \
   dim3 nthreads_per_block(LTIMES_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP);
 
 #define LTIMES_NBLOCKS_HIP \
-  dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(num_m, m_block_sz)), \
-               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(num_g, g_block_sz)), \
-               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(num_z, z_block_sz)));
-
-
-template < size_t m_block_size, size_t g_block_size, size_t z_block_size >
-__launch_bounds__(m_block_size*g_block_size*z_block_size)
-__global__ void ltimes(Real_ptr phidat, Real_ptr elldat, Real_ptr psidat,
+  LTIMES_LAYOUT_GPU_EXTENTS; \
+  dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ltimes_extents[Layout::index(2)], x_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ltimes_extents[Layout::index(1)], y_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ltimes_extents[Layout::index(0)], z_block_sz)));
+
+
+template < size_t x_block_size, size_t y_block_size, size_t z_block_size,
+           typename Layout, bool read_only = false >
+__launch_bounds__(x_block_size*y_block_size*z_block_size)
+__global__ void ltimes(Real_ptr phidat,
+                       gpu_read_only::ptr_type<Real_type, read_only> elldat,
+                       gpu_read_only::ptr_type<Real_type, read_only> psidat,
                        Index_type num_d,
                        Index_type num_m, Index_type num_g, Index_type num_z)
 {
-   Index_type m = blockIdx.x * m_block_size + threadIdx.x;
-   Index_type g = blockIdx.y * g_block_size + threadIdx.y;
-   Index_type z = blockIdx.z * z_block_size + threadIdx.z;
+   LTIMES_LAYOUT_STRIDES(Layout);
+   LTIMES_LAYOUT_GPU_INDICES(Layout, x_block_size, y_block_size, z_block_size);
 
    if (m < num_m && g < num_g && z < num_z) {
      for (Index_type d = 0; d < num_d; ++d ) {
-       LTIMES_BODY;
+       LTIMES_LAYOUT_BODY;
      }
    }
 }
 
-template < size_t m_block_size, size_t g_block_size, size_t z_block_size, typename Lambda >
-__launch_bounds__(m_block_size*g_block_size*z_block_size)
+template < size_t x_block_size, size_t y_block_size, size_t z_block_size,
+           typename Layout, typename Lambda >
+__launch_bounds__(x_block_size*y_block_size*z_block_size)
 __global__ void ltimes_lam(Index_type num_m, Index_type num_g, Index_type num_z,
                            Lambda body)
 {
-   Index_type m = blockIdx.x * m_block_size + threadIdx.x;
-   Index_type g = blockIdx.y * g_block_size + threadIdx.y;
-   Index_type z = blockIdx.z * z_block_size + threadIdx.z;
+   LTIMES_LAYOUT_GPU_INDICES(Layout, x_block_size, y_block_size, z_block_size);
 
    if (m < num_m && g < num_g && z < num_z) {
      body(z, g, m);
@@ -72,7 +75,7 @@ __global__ void ltimes_lam(Index_type num_m, Index_type num_g, Index_type num_z,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, typename Layout >
 void LTIMES::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -90,7 +93,7 @@ void LTIMES::runHipVariantImpl(VariantID vid)
       LTIMES_NBLOCKS_HIP;
       constexpr size_t shmem = 0;
 
-      hipLaunchKernelGGL((ltimes<LTIMES_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+      hipLaunchKernelGGL((ltimes<LTIMES_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, Layout>),
                          dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
                          phidat, elldat, psidat,
                          num_d,
@@ -102,6 +105,8 @@ void LTIMES::runHipVariantImpl(VariantID vid)
 
   } else if ( vid == Lambda_HIP ) {
 
+    LTIMES_LAYOUT_STRIDES(Layout);
+
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
@@ -112,11 +117,11 @@ void LTIMES::runHipVariantImpl(VariantID vid)
       auto ltimes_lambda =
         [=] __device__ (Index_type z, Index_type g, Index_type m) {
           for (Index_type d = 0; d < num_d; ++d ) {
-            LTIMES_BODY;
+            LTIMES_LAYOUT_BODY;
           }
         };
 
-      hipLaunchKernelGGL((ltimes_lam<LTIMES_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, decltype(ltimes_lambda)>),
+      hipLaunchKernelGGL((ltimes_lam<LTIMES_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, Layout, decltype(ltimes_lambda)>),
                          dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
                          num_m, num_g, num_z, ltimes_lambda);
       hipErrchk( hipGetLastError() );
@@ -126,15 +131,16 @@ void LTIMES::runHipVariantImpl(VariantID vid)
 
   } else if ( vid == RAJA_HIP ) {
 
-    LTIMES_VIEWS_RANGES_RAJA;
+    LTIMES_VIEWS_RANGES_RAJA(Layout);
 
+    // threads in layout order, segments are (d, z, g, m)
     using EXEC_POL =
       RAJA::KernelPolicy<
-        RAJA::statement::HipKernelFixedAsync<m_block_sz*g_block_sz*z_block_sz,
-          RAJA::statement::For<1, RAJA::hip_global_size_z_direct<z_block_sz>,     //z
-            RAJA::statement::For<2, RAJA::hip_global_size_y_direct<g_block_sz>,   //g
-              RAJA::statement::For<3, RAJA::hip_global_size_x_direct<m_block_sz>, //m
-                RAJA::statement::For<0, RAJA::seq_exec,          //d
+        RAJA::statement::HipKernelFixedAsync<x_block_sz*y_block_sz*z_block_sz,
+          RAJA::statement::For<Layout::index(0)+1, RAJA::hip_global_size_z_direct<z_block_sz>,
+            RAJA::statement::For<Layout::index(1)+1, RAJA::hip_global_size_y_direct<y_block_sz>,
+              RAJA::statement::For<Layout::index(2)+1, RAJA::hip_global_size_x_direct<x_block_sz>,
+                RAJA::statement::For<0, RAJA::seq_exec,           //d
                   RAJA::statement::Lambda<0>
                 >
               >
@@ -163,7 +169,124 @@ void LTIMES::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(LTIMES, Hip)
+template < size_t block_size, typename Layout >
+void LTIMES::runHipVariantReadOnly(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  LTIMES_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      LTIMES_THREADS_PER_BLOCK_HIP;
+      LTIMES_NBLOCKS_HIP;
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((ltimes<LTIMES_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, Layout, true>),
+                         dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         phidat, elldat, psidat,
+                         num_d,
+                         num_m, num_g, num_z);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n LTIMES : Unknown Hip read only variant id = " << vid << std::endl;
+  }
+}
+
+void LTIMES::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantImpl<block_size, ltimes_layout<layout_idx>>(vid);
+        }
+        t += 1;
+
+      }
+
+    });
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+            setBlockSize(block_size);
+            runHipVariantReadOnly<block_size, ltimes_layout<layout_idx>>(vid);
+          }
+          t += 1;
+
+        }
+
+      });
+
+    });
+
+  }
+}
+
+void LTIMES::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, ltimes_layout<layout_idx>::name()+
+                                  "_block_"+std::to_string(block_size));
+
+      }
+
+    });
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, "ldg_"+ltimes_layout<layout_idx>::name()+
+                                    "_block_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    });
+
+  }
+}
 
 } // end namespace apps
 } // end namespace rajaperf
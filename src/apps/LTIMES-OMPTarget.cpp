@@ -50,7 +50,7 @@ void LTIMES::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
   } else if ( vid == RAJA_OpenMPTarget ) {
 
-    LTIMES_VIEWS_RANGES_RAJA;
+    LTIMES_VIEWS_RANGES_RAJA(ltimes_layout<0>);
 
     using EXEC_POL =
       RAJA::KernelPolicy<
@@ -18,12 +18,16 @@ namespace apps
 {
 
 
-void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Layout >
+void LTIMES::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
   LTIMES_DATA_SETUP;
 
+  LTIMES_LAYOUT_STRIDES(Layout);
+  LTIMES_LAYOUT_CPU_EXTENTS;
+
   switch ( vid ) {
 
     case Base_Seq : {
@@ -31,15 +35,7 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type z = 0; z < num_z; ++z ) {
-          for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
-              for (Index_type d = 0; d < num_d; ++d ) {
-                LTIMES_BODY;
-              }
-            }
-          }
-        }
+        LTIMES_LAYOUT_CPU_LOOPS(Layout, LTIMES_LAYOUT_BODY);
 
       }
       stopTimer();
@@ -52,21 +48,13 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
       auto ltimes_base_lam = [=](Index_type d, Index_type z,
                                  Index_type g, Index_type m) {
-                               LTIMES_BODY;
+                               LTIMES_LAYOUT_BODY;
                              };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type z = 0; z < num_z; ++z ) {
-          for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
-              for (Index_type d = 0; d < num_d; ++d ) {
-                ltimes_base_lam(d, z, g, m);
-              }
-            }
-          }
-        }
+        LTIMES_LAYOUT_CPU_LOOPS(Layout, ltimes_base_lam(d, z, g, m));
 
       }
       stopTimer();
@@ -76,19 +64,19 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
     case RAJA_Seq : {
 
-      LTIMES_VIEWS_RANGES_RAJA;
+      LTIMES_VIEWS_RANGES_RAJA(Layout);
 
       auto ltimes_lam = [=](ID d, IZ z, IG g, IM m) {
                           LTIMES_BODY_RAJA;
                         };
 
-
+      // loops in layout order, segments are (d, z, g, m)
       using EXEC_POL =
         RAJA::KernelPolicy<
-          RAJA::statement::For<1, RAJA::seq_exec,       // z
-            RAJA::statement::For<2, RAJA::seq_exec,     // g
-              RAJA::statement::For<3, RAJA::seq_exec,   // m
-                RAJA::statement::For<0, RAJA::seq_exec, // d
+          RAJA::statement::For<Layout::loopArg(0), RAJA::seq_exec,
+            RAJA::statement::For<Layout::loopArg(1), RAJA::seq_exec,
+              RAJA::statement::For<Layout::loopArg(2), RAJA::seq_exec,
+                RAJA::statement::For<Layout::loopArg(3), RAJA::seq_exec,
                   RAJA::statement::Lambda<0>
                 >
               >
@@ -121,5 +109,26 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void LTIMES::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+
+    if (tune_idx == t) {
+      runSeqVariantImpl<ltimes_layout<layout_idx>>(vid);
+    }
+    t += 1;
+
+  });
+}
+
+void LTIMES::setSeqTuningDefinitions(VariantID vid)
+{
+  seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+    addVariantTuningName(vid, ltimes_layout<layout_idx>::name());
+  });
+}
+
 } // end namespace apps
 } // end namespace rajaperf
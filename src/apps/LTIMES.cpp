@@ -31,12 +31,12 @@ LTIMES::LTIMES(const RunParams& params)
   setDefaultProblemSize(m_num_d_default * m_num_g_default * m_num_z_default);
   setDefaultReps(50);
 
+  m_num_d = getKernelParam("num_d", params.getLTIMESNumD());
+  m_num_g = getKernelParam("num_g", params.getLTIMESNumG());
+  m_num_m = getKernelParam("num_m", params.getLTIMESNumM());
   m_num_z = std::max( getTargetProblemSize() /
-                      (m_num_d_default * m_num_g_default),
+                      (m_num_d * m_num_g),
                       Index_type(1) );
-  m_num_g = m_num_g_default;
-  m_num_m = m_num_m_default;
-  m_num_d = m_num_d_default;
 
   m_philen = m_num_m * m_num_g * m_num_z;
   m_elllen = m_num_d * m_num_m;
@@ -59,6 +59,10 @@ LTIMES::LTIMES(const RunParams& params)
   setUsesFeature(Kernel);
   setUsesFeature(View);
 
+  setHasPattern(ComputeBound);
+
+  setUsesL2PersistWindow();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -83,15 +87,35 @@ LTIMES::~LTIMES()
 {
 }
 
-void LTIMES::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+size_t LTIMES::getLayoutIndex(VariantID vid, size_t tune_idx) const
+{
+  return getLTIMESLayoutIndex(getVariantTuningName(vid, tune_idx));
+}
+
+void LTIMES::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_phidat, int(m_philen), Real_type(0.0), vid);
   allocAndInitData(m_elldat, int(m_elllen), vid);
   allocAndInitData(m_psidat, int(m_psilen), vid);
+
+  // ell is read by every z and g
+  setL2PersistWindow(m_elldat, m_elllen*sizeof(Real_type));
+
+  const size_t layout_idx = getLayoutIndex(vid, tune_idx);
+  if (layout_idx != 0) {
+    auto reset_psi = scopedMoveData(m_psidat, m_psilen, vid);
+    reorderLTIMESData(layout_idx, m_psidat, m_num_z, m_num_g, m_num_d, true);
+  }
 }
 
 void LTIMES::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  const size_t layout_idx = getLayoutIndex(vid, tune_idx);
+  if (layout_idx != 0) {
+    auto reset_phi = scopedMoveData(m_phidat, m_philen, vid);
+    reorderLTIMESData(layout_idx, m_phidat, m_num_z, m_num_g, m_num_m, false);
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_phidat, m_philen, checksum_scale_factor , vid);
 }
 
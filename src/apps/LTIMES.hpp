@@ -26,6 +26,13 @@
 /// and views to do the same thing without explicit index calculations (see
 /// the loop body definitions below).
 ///
+/// CPU and GPU tunings run each order of the z, g, and d indices of psi and
+/// phi, ie. zgd above or dgz, with the loop nest in the same order (see
+/// LTIMESLayout.hpp). num_d, num_g, and num_m are given by --ltimes-num-d,
+/// --ltimes-num-g, and --ltimes-num-m and the problem size sets num_z. The
+/// ldg tunings of the Base GPU variants load ell and psi through the
+/// read-only data cache.
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_HPP
 #define RAJAPerf_Apps_LTIMES_HPP
@@ -48,28 +55,28 @@
   phi(z, g, m) +=  ell(m, d) * psi(z, g, d);
 
 
-#define LTIMES_VIEWS_RANGES_RAJA \
+#define LTIMES_VIEWS_RANGES_RAJA(Layout) \
   using namespace ltimes_idx; \
 \
   using PSI_VIEW = RAJA::TypedView<Real_type, \
-                                   RAJA::Layout<3, Index_type, 2>, \
+                                   RAJA::Layout<3, Index_type, Layout::unit_stride>, \
                                    IZ, IG, ID>; \
   using ELL_VIEW = RAJA::TypedView<Real_type, \
                                    RAJA::Layout<2, Index_type, 1>, \
                                    IM, ID>; \
   using PHI_VIEW = RAJA::TypedView<Real_type, \
-                                   RAJA::Layout<3, Index_type, 2>, \
+                                   RAJA::Layout<3, Index_type, Layout::unit_stride>, \
                                    IZ, IG, IM>; \
 \
   PSI_VIEW psi(psidat, \
                RAJA::make_permuted_layout( {{num_z, num_g, num_d}}, \
-                     RAJA::as_array<RAJA::Perm<0, 1, 2> >::get() ) ); \
+                     RAJA::as_array<typename Layout::perm>::get() ) ); \
   ELL_VIEW ell(elldat, \
                RAJA::make_permuted_layout( {{num_m, num_d}}, \
                      RAJA::as_array<RAJA::Perm<0, 1> >::get() ) ); \
   PHI_VIEW phi(phidat, \
                RAJA::make_permuted_layout( {{num_z, num_g, num_m}}, \
-                     RAJA::as_array<RAJA::Perm<0, 1, 2> >::get() ) ); \
+                     RAJA::as_array<typename Layout::perm>::get() ) ); \
 \
       using IDRange = RAJA::TypedRangeSegment<ID>; \
       using IZRange = RAJA::TypedRangeSegment<IZ>; \
@@ -79,6 +86,8 @@
 
 #include "common/KernelBase.hpp"
 
+#include "LTIMESLayout.hpp"
+
 #include "RAJA/RAJA.hpp"
 
 namespace rajaperf
@@ -117,12 +126,22 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < typename Layout >
+  void runSeqVariantImpl(VariantID vid);
+  template < typename Layout >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, typename Layout >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, typename Layout >
+  void runCudaVariantReadOnly(VariantID vid);
+  template < size_t block_size, typename Layout >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size, typename Layout >
+  void runHipVariantReadOnly(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -146,6 +165,8 @@ private:
   Index_type m_philen;
   Index_type m_elllen;
   Index_type m_psilen;
+
+  size_t getLayoutIndex(VariantID vid, size_t tune_idx) const;
 };
 
 } // end namespace apps
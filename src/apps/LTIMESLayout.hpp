@@ -0,0 +1,244 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Data layouts and loop orders used by the LTIMES kernels.
+///
+/// A layout names the z, g, and d indices of psi from slowest to fastest
+/// varying, phi has the same order with m in place of d, ie. zgd is
+/// psi(z, g, d) and phi(z, g, m) with d and m stride 1. ell(m, d) always
+/// has d stride 1.
+///
+/// CPU loop nests run in layout order with the m loop just outside the d
+/// loop, so the outer loop never runs over d and may run in parallel. GPU
+/// variants map the fastest varying index of phi to the x thread dimension
+/// and loop over d in each thread.
+///
+/// psi is initialized and the checksum of phi is computed in zgd order for
+/// every layout, so all layouts give the same checksum.
+///
+
+#ifndef RAJAPerf_Apps_LTIMESLayout_HPP
+#define RAJAPerf_Apps_LTIMESLayout_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+/*!
+ * \brief Strides of the z, g, and d (or m) indices of an array.
+ */
+struct LTIMESStrides
+{
+  Index_type z;
+  Index_type g;
+  Index_type d;
+};
+
+/*!
+ * \brief Layout with the indices P0, P1, P2 (0 z, 1 g, 2 d or m) from
+ * slowest to fastest varying.
+ */
+template < camp::idx_t P0, camp::idx_t P1, camp::idx_t P2 >
+struct LTIMESLayout
+{
+  using perm = RAJA::Perm<P0, P1, P2>;
+
+  static constexpr camp::idx_t unit_stride = P2;
+
+  static std::string name()
+  {
+    const char index_names[] = "zgd";
+    return std::string{index_names[P0], index_names[P1], index_names[P2]};
+  }
+
+  // index at position p, 0 is slowest varying
+  RAJA_HOST_DEVICE
+  static constexpr camp::idx_t index(camp::idx_t p)
+  {
+    return (p == 0) ? P0 : ((p == 1) ? P1 : P2);
+  }
+
+  // position of index i
+  RAJA_HOST_DEVICE
+  static constexpr camp::idx_t position(camp::idx_t i)
+  {
+    return (P0 == i) ? 0 : ((P1 == i) ? 1 : 2);
+  }
+
+  // CPU loop at level of the loop nest, outermost first, as an index into
+  // (z, g, m, d), the m loop is just outside the d loop
+  RAJA_HOST_DEVICE
+  static constexpr camp::idx_t loop(camp::idx_t level)
+  {
+    return (level < position(2)) ? index(level) :
+           ((level == position(2)) ? 2 :
+           ((level == position(2)+1) ? 3 : index(level-1)));
+  }
+
+  // RAJA::kernel segment of the CPU loop at level, segments are (d, z, g, m)
+  RAJA_HOST_DEVICE
+  static constexpr camp::idx_t loopArg(camp::idx_t level)
+  {
+    return (loop(level) + 1) % 4;
+  }
+
+  // strides of an array with extents num_z, num_g, num_d in this layout
+  RAJA_HOST_DEVICE
+  static LTIMESStrides strides(Index_type num_z, Index_type num_g,
+                               Index_type num_d)
+  {
+    const Index_type extent[3] = {num_z, num_g, num_d};
+    Index_type stride[3] = {0, 0, 0};
+    stride[P2] = 1;
+    stride[P1] = extent[P2];
+    stride[P0] = extent[P1] * extent[P2];
+    return LTIMESStrides{stride[0], stride[1], stride[2]};
+  }
+};
+
+//
+// All orders of z, g, and d, zgd is the order of the reference
+// implementation.
+//
+using ltimes_layouts_type = std::tuple< LTIMESLayout<0, 1, 2>,
+                                        LTIMESLayout<0, 2, 1>,
+                                        LTIMESLayout<1, 0, 2>,
+                                        LTIMESLayout<1, 2, 0>,
+                                        LTIMESLayout<2, 0, 1>,
+                                        LTIMESLayout<2, 1, 0> >;
+
+template < size_t layout_idx >
+using ltimes_layout = typename std::tuple_element<layout_idx, ltimes_layouts_type>::type;
+
+using ltimes_layout_indices_type =
+    camp::make_int_seq_t<size_t, std::tuple_size<ltimes_layouts_type>::value>;
+
+/*!
+ * \brief Return the index of the layout named at the start of tuning_name,
+ * 0 (zgd) if there is none.
+ */
+inline size_t getLTIMESLayoutIndex(const std::string& tuning_name)
+{
+  size_t layout_idx = 0;
+  seq_for(ltimes_layout_indices_type{}, [&](auto idx) {
+    const std::string name = ltimes_layout<idx>::name();
+    if (tuning_name.compare(0, name.size(), name) == 0) {
+      layout_idx = idx;
+    }
+  });
+  return layout_idx;
+}
+
+/*!
+ * \brief Reorder host data of a num_z x num_g x num_d array between zgd
+ * order and the order of a layout, into the layout order if to_layout is
+ * true, otherwise back into zgd order.
+ */
+inline void reorderLTIMESData(size_t layout_idx, Real_ptr data,
+                              Index_type num_z, Index_type num_g,
+                              Index_type num_d, bool to_layout)
+{
+  if (layout_idx == 0) {
+    return;
+  }
+
+  LTIMESStrides s{0, 0, 0};
+  seq_for(ltimes_layout_indices_type{}, [&](auto idx) {
+    if (idx == layout_idx) {
+      s = ltimes_layout<idx>::strides(num_z, num_g, num_d);
+    }
+  });
+
+  const std::vector<Real_type> copy(data, data + num_z*num_g*num_d);
+  for (Index_type z = 0; z < num_z; ++z ) {
+    for (Index_type g = 0; g < num_g; ++g ) {
+      for (Index_type d = 0; d < num_d; ++d ) {
+        const Index_type zgd = d + (g * num_d) + (z * num_d * num_g);
+        const Index_type lay = z*s.z + g*s.g + d*s.d;
+        if (to_layout) {
+          data[lay] = copy[zgd];
+        } else {
+          data[zgd] = copy[lay];
+        }
+      }
+    }
+  }
+}
+
+}  // closing brace for apps namespace
+}  // closing brace for rajaperf namespace
+
+//
+// Strides of psi and phi in Layout, and the loop extents of the CPU loop
+// nest indexed like Layout::loop.
+//
+#define LTIMES_LAYOUT_STRIDES(Layout) \
+  const LTIMESStrides psi_strides = Layout::strides(num_z, num_g, num_d); \
+  const LTIMESStrides phi_strides = Layout::strides(num_z, num_g, num_m);
+
+#define LTIMES_LAYOUT_CPU_EXTENTS \
+  const Index_type ltimes_extents[4] = {num_z, num_g, num_m, num_d};
+
+#define LTIMES_LAYOUT_BODY \
+  phidat[z*phi_strides.z + g*phi_strides.g + m*phi_strides.d] += \
+    elldat[d+ (m * num_d)] * \
+    psidat[z*psi_strides.z + g*psi_strides.g + d*psi_strides.d];
+
+//
+// CPU loop nest in the order of Layout running body for each z, g, m, d.
+// The outer loop variable is a plain variable so the loop nest may follow
+// an OpenMP parallel for pragma.
+//
+#define LTIMES_LAYOUT_CPU_LOOPS(Layout, body) \
+  for (Index_type i0 = 0; i0 < ltimes_extents[Layout::loop(0)]; ++i0 ) { \
+    for (Index_type i1 = 0; i1 < ltimes_extents[Layout::loop(1)]; ++i1 ) { \
+      for (Index_type i2 = 0; i2 < ltimes_extents[Layout::loop(2)]; ++i2 ) { \
+        for (Index_type i3 = 0; i3 < ltimes_extents[Layout::loop(3)]; ++i3 ) { \
+          Index_type zgmd[4]; \
+          zgmd[Layout::loop(0)] = i0; \
+          zgmd[Layout::loop(1)] = i1; \
+          zgmd[Layout::loop(2)] = i2; \
+          zgmd[Layout::loop(3)] = i3; \
+          const Index_type z = zgmd[0]; \
+          const Index_type g = zgmd[1]; \
+          const Index_type m = zgmd[2]; \
+          const Index_type d = zgmd[3]; \
+          body; \
+        } \
+      } \
+    } \
+  }
+
+//
+// z, g, and m of a GPU thread, the fastest varying index of phi in Layout
+// is mapped to the x thread dimension.
+//
+#define LTIMES_LAYOUT_GPU_INDICES(Layout, x_block_size, y_block_size, z_block_size) \
+  Index_type zgm[3]; \
+  zgm[Layout::index(2)] = blockIdx.x * x_block_size + threadIdx.x; \
+  zgm[Layout::index(1)] = blockIdx.y * y_block_size + threadIdx.y; \
+  zgm[Layout::index(0)] = blockIdx.z * z_block_size + threadIdx.z; \
+  const Index_type z = zgm[0]; \
+  const Index_type g = zgm[1]; \
+  const Index_type m = zgm[2];
+
+#define LTIMES_LAYOUT_GPU_EXTENTS \
+  const Index_type ltimes_extents[3] = {num_z, num_g, num_m};
+
+#endif  // closing endif for header file include guard
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/JitUtils.hpp"
 
 #include <iostream>
 
@@ -22,49 +23,50 @@ namespace apps
 {
 
 //
-// Define thread block shape for Hip execution
+// Define thread block shape for Hip execution, the fastest varying
+// index of phi in the layout is mapped to x
 //
-#define m_block_sz (32)
-#define g_block_sz (gpu_block_size::greater_of_squarest_factor_pair(block_size/m_block_sz))
-#define z_block_sz (gpu_block_size::lesser_of_squarest_factor_pair(block_size/m_block_sz))
+#define x_block_sz (32)
+#define y_block_sz (gpu_block_size::greater_of_squarest_factor_pair(block_size/x_block_sz))
+#define z_block_sz (gpu_block_size::lesser_of_squarest_factor_pair(block_size/x_block_sz))
 
 #define LTIMES_NOVIEW_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP \
-  m_block_sz, g_block_sz, z_block_sz
+  x_block_sz, y_block_sz, z_block_sz
 
 #define LTIMES_NOVIEW_THREADS_PER_BLOCK_HIP \
   dim3 nthreads_per_block(LTIMES_NOVIEW_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP);
 
 #define LTIMES_NOVIEW_NBLOCKS_HIP \
-  dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(num_m, m_block_sz)), \
-               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(num_g, g_block_sz)), \
-               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(num_z, z_block_sz)));
+  LTIMES_LAYOUT_GPU_EXTENTS; \
+  dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ltimes_extents[Layout::index(2)], x_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ltimes_extents[Layout::index(1)], y_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ltimes_extents[Layout::index(0)], z_block_sz)));
 
 
-template < size_t m_block_size, size_t g_block_size, size_t z_block_size >
-__launch_bounds__(m_block_size*g_block_size*z_block_size)
+template < size_t x_block_size, size_t y_block_size, size_t z_block_size,
+           typename Layout >
+__launch_bounds__(x_block_size*y_block_size*z_block_size)
 __global__ void ltimes_noview(Real_ptr phidat, Real_ptr elldat, Real_ptr psidat,
                               Index_type num_d,
                               Index_type num_m, Index_type num_g, Index_type num_z)
 {
-   Index_type m = blockIdx.x * m_block_size + threadIdx.x;
-   Index_type g = blockIdx.y * g_block_size + threadIdx.y;
-   Index_type z = blockIdx.z * z_block_size + threadIdx.z;
+   LTIMES_LAYOUT_STRIDES(Layout);
+   LTIMES_LAYOUT_GPU_INDICES(Layout, x_block_size, y_block_size, z_block_size);
 
    if (m < num_m && g < num_g && z < num_z) {
      for (Index_type d = 0; d < num_d; ++d ) {
-       LTIMES_NOVIEW_BODY;
+       LTIMES_LAYOUT_BODY;
      }
    }
 }
 
-template < size_t m_block_size, size_t g_block_size, size_t z_block_size, typename Lambda >
-__launch_bounds__(m_block_size*g_block_size*z_block_size)
+template < size_t x_block_size, size_t y_block_size, size_t z_block_size,
+           typename Layout, typename Lambda >
+__launch_bounds__(x_block_size*y_block_size*z_block_size)
 __global__ void ltimes_noview_lam(Index_type num_m, Index_type num_g, Index_type num_z,
                                   Lambda body)
 {
-   Index_type m = blockIdx.x * m_block_size + threadIdx.x;
-   Index_type g = blockIdx.y * g_block_size + threadIdx.y;
-   Index_type z = blockIdx.z * z_block_size + threadIdx.z;
+   LTIMES_LAYOUT_GPU_INDICES(Layout, x_block_size, y_block_size, z_block_size);
 
    if (m < num_m && g < num_g && z < num_z) {
      body(z, g, m);
@@ -72,7 +74,7 @@ __global__ void ltimes_noview_lam(Index_type num_m, Index_type num_g, Index_type
 }
 
 
-template < size_t block_size >
+template < size_t block_size, typename Layout >
 void LTIMES_NOVIEW::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -90,7 +92,7 @@ void LTIMES_NOVIEW::runHipVariantImpl(VariantID vid)
       LTIMES_NOVIEW_NBLOCKS_HIP;
       constexpr size_t shmem = 0;
 
-      hipLaunchKernelGGL((ltimes_noview<LTIMES_NOVIEW_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+      hipLaunchKernelGGL((ltimes_noview<LTIMES_NOVIEW_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, Layout>),
                          dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
                          phidat, elldat, psidat,
                          num_d,
@@ -102,6 +104,8 @@ void LTIMES_NOVIEW::runHipVariantImpl(VariantID vid)
 
   } else if ( vid == Lambda_HIP ) {
 
+    LTIMES_LAYOUT_STRIDES(Layout);
+
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
@@ -112,14 +116,13 @@ void LTIMES_NOVIEW::runHipVariantImpl(VariantID vid)
       auto ltimes_noview_lambda =
         [=] __device__ (Index_type z, Index_type g, Index_type m) {
           for (Index_type d = 0; d < num_d; ++d ) {
-            LTIMES_NOVIEW_BODY;
+            LTIMES_LAYOUT_BODY;
           }
-      };
+        };
 
-      hipLaunchKernelGGL((ltimes_noview_lam<LTIMES_NOVIEW_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, decltype(ltimes_noview_lambda)>),
+      hipLaunchKernelGGL((ltimes_noview_lam<LTIMES_NOVIEW_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, Layout, decltype(ltimes_noview_lambda)>),
                          dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
-                         num_m, num_g, num_z,
-                         ltimes_noview_lambda);
+                         num_m, num_g, num_z, ltimes_noview_lambda);
       hipErrchk( hipGetLastError() );
 
     }
@@ -127,13 +130,16 @@ void LTIMES_NOVIEW::runHipVariantImpl(VariantID vid)
 
   } else if ( vid == RAJA_HIP ) {
 
+    LTIMES_LAYOUT_STRIDES(Layout);
+
+    // threads in layout order, segments are (d, z, g, m)
     using EXEC_POL =
       RAJA::KernelPolicy<
-        RAJA::statement::HipKernelFixedAsync<m_block_sz*g_block_sz*z_block_sz,
-          RAJA::statement::For<1, RAJA::hip_global_size_z_direct<z_block_sz>,     //z
-            RAJA::statement::For<2, RAJA::hip_global_size_y_direct<g_block_sz>,   //g
-              RAJA::statement::For<3, RAJA::hip_global_size_x_direct<m_block_sz>, //m
-                RAJA::statement::For<0, RAJA::seq_exec,          //d
+        RAJA::statement::HipKernelFixedAsync<x_block_sz*y_block_sz*z_block_sz,
+          RAJA::statement::For<Layout::index(0)+1, RAJA::hip_global_size_z_direct<z_block_sz>,
+            RAJA::statement::For<Layout::index(1)+1, RAJA::hip_global_size_y_direct<y_block_sz>,
+              RAJA::statement::For<Layout::index(2)+1, RAJA::hip_global_size_x_direct<x_block_sz>,
+                RAJA::statement::For<0, RAJA::seq_exec,           //d
                   RAJA::statement::Lambda<0>
                 >
               >
@@ -151,7 +157,7 @@ void LTIMES_NOVIEW::runHipVariantImpl(VariantID vid)
                                                RAJA::RangeSegment(0, num_m)),
                                        res,
         [=] __device__ (Index_type d, Index_type z, Index_type g, Index_type m) {
-          LTIMES_NOVIEW_BODY;
+        LTIMES_LAYOUT_BODY;
       });
 
     }
@@ -162,7 +168,127 @@ void LTIMES_NOVIEW::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(LTIMES_NOVIEW, Hip)
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+
+template < size_t block_size >
+void LTIMES_NOVIEW::runHipVariantJit(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  LTIMES_NOVIEW_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    detail::JitStats stats;
+    auto function = detail::getHipJitFunction("ltimes_noview_jit", getJitSource(block_size),
+                                              run_params.getJitCacheDir(), stats);
+
+    m_jit_metrics[vid].resize(getNumVariantTunings(vid));
+    m_jit_metrics[vid][tune_idx] = detail::getJitMetrics(stats);
+
+    void* args[] = { &phidat, &elldat, &psidat };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_z*num_g*num_m, block_size);
+      constexpr size_t shmem = 0;
+
+      detail::launchHipJitFunction(function, grid_size, block_size, shmem,
+                                   res.get_stream(), args);
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n LTIMES_NOVIEW : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+#endif
+
+void LTIMES_NOVIEW::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantImpl<block_size, ltimes_layout<layout_idx>>(vid);
+        }
+        t += 1;
+
+      }
+
+    });
+
+  });
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantJit<block_size>(vid, tune_idx);
+        }
+        t += 1;
+
+      }
+
+    });
+
+  }
+#endif
+}
+
+void LTIMES_NOVIEW::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, ltimes_layout<layout_idx>::name()+
+                                  "_block_"+std::to_string(block_size));
+
+      }
+
+    });
+
+  });
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, "jit_block_"+std::to_string(block_size));
+
+      }
+
+    });
+
+  }
+#endif
+}
 
 } // end namespace apps
 } // end namespace rajaperf
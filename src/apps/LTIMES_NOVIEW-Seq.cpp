@@ -18,18 +18,15 @@ namespace apps
 {
 
 
-void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Layout >
+void LTIMES_NOVIEW::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
   LTIMES_NOVIEW_DATA_SETUP;
 
-#if defined(RUN_RAJA_SEQ)
-  auto ltimesnoview_lam = [=](Index_type d, Index_type z,
-                              Index_type g, Index_type m) {
-                                LTIMES_NOVIEW_BODY;
-                          };
-#endif
+  LTIMES_LAYOUT_STRIDES(Layout);
+  LTIMES_LAYOUT_CPU_EXTENTS;
 
   switch ( vid ) {
 
@@ -38,15 +35,7 @@ void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type z = 0; z < num_z; ++z ) {
-          for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
-              for (Index_type d = 0; d < num_d; ++d ) {
-                LTIMES_NOVIEW_BODY;
-              }
-            }
-          }
-        }
+        LTIMES_LAYOUT_CPU_LOOPS(Layout, LTIMES_LAYOUT_BODY);
 
       }
       stopTimer();
@@ -57,18 +46,15 @@ void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
+      auto ltimesnoview_base_lam = [=](Index_type d, Index_type z,
+                                 Index_type g, Index_type m) {
+                               LTIMES_LAYOUT_BODY;
+                             };
+
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type z = 0; z < num_z; ++z ) {
-          for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
-              for (Index_type d = 0; d < num_d; ++d ) {
-                ltimesnoview_lam(d, z, g, m);
-              }
-            }
-          }
-        }
+        LTIMES_LAYOUT_CPU_LOOPS(Layout, ltimesnoview_base_lam(d, z, g, m));
 
       }
       stopTimer();
@@ -78,12 +64,18 @@ void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
     case RAJA_Seq : {
 
+      auto ltimesnoview_lam = [=](Index_type d, Index_type z,
+                                  Index_type g, Index_type m) {
+                                    LTIMES_LAYOUT_BODY;
+                              };
+
+      // loops in layout order, segments are (d, z, g, m)
       using EXEC_POL =
         RAJA::KernelPolicy<
-          RAJA::statement::For<1, RAJA::seq_exec,       // z
-            RAJA::statement::For<2, RAJA::seq_exec,     // g
-              RAJA::statement::For<3, RAJA::seq_exec,   // m
-                RAJA::statement::For<0, RAJA::seq_exec, // d
+          RAJA::statement::For<Layout::loopArg(0), RAJA::seq_exec,
+            RAJA::statement::For<Layout::loopArg(1), RAJA::seq_exec,
+              RAJA::statement::For<Layout::loopArg(2), RAJA::seq_exec,
+                RAJA::statement::For<Layout::loopArg(3), RAJA::seq_exec,
                   RAJA::statement::Lambda<0>
                 >
               >
@@ -109,12 +101,33 @@ void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 #endif // RUN_RAJA_SEQ
 
     default : {
-      getCout() << "\n LTIMES_NOVIEW : Unknown variant id = " << vid << std::endl;
+      getCout() << "\n LTIMES : Unknown variant id = " << vid << std::endl;
     }
 
   }
 
 }
 
+void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+
+    if (tune_idx == t) {
+      runSeqVariantImpl<ltimes_layout<layout_idx>>(vid);
+    }
+    t += 1;
+
+  });
+}
+
+void LTIMES_NOVIEW::setSeqTuningDefinitions(VariantID vid)
+{
+  seq_for(ltimes_layout_indices_type{}, [&](auto layout_idx) {
+    addVariantTuningName(vid, ltimes_layout<layout_idx>::name());
+  });
+}
+
 } // end namespace apps
 } // end namespace rajaperf
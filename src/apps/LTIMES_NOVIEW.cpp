@@ -11,8 +11,10 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/JitUtils.hpp"
 
 #include <algorithm>
+#include <sstream>
 
 namespace rajaperf
 {
@@ -31,12 +33,12 @@ LTIMES_NOVIEW::LTIMES_NOVIEW(const RunParams& params)
   setDefaultProblemSize(m_num_d_default * m_num_g_default * m_num_z_default);
   setDefaultReps(50);
 
+  m_num_d = getKernelParam("num_d", params.getLTIMESNumD());
+  m_num_g = getKernelParam("num_g", params.getLTIMESNumG());
+  m_num_m = getKernelParam("num_m", params.getLTIMESNumM());
   m_num_z = std::max( getTargetProblemSize() /
-                      (m_num_d_default * m_num_g_default),
+                      (m_num_d * m_num_g),
                       Index_type(1) );
-  m_num_g = m_num_g_default;
-  m_num_m = m_num_m_default;
-  m_num_d = m_num_d_default;
 
   m_philen = m_num_m * m_num_g * m_num_z;
   m_elllen = m_num_d * m_num_m;
@@ -58,6 +60,8 @@ LTIMES_NOVIEW::LTIMES_NOVIEW(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -76,21 +80,82 @@ LTIMES_NOVIEW::LTIMES_NOVIEW(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT)
+  setMetricNames(detail::getJitMetricNames());
+#endif
 }
 
 LTIMES_NOVIEW::~LTIMES_NOVIEW()
 {
 }
 
-void LTIMES_NOVIEW::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+std::vector<double> LTIMES_NOVIEW::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx >= m_jit_metrics[vid].size()) {
+    return {};
+  }
+  return m_jit_metrics[vid][tune_idx];
+}
+
+std::string LTIMES_NOVIEW::getJitSource(size_t block_size) const
+{
+  std::ostringstream src;
+  src << detail::getJitTypesSource();
+  src << "#define LTIMES_JIT_NUM_D " << m_num_d << "\n";
+  src << "#define LTIMES_JIT_NUM_G " << m_num_g << "\n";
+  src << "#define LTIMES_JIT_NUM_M " << m_num_m << "\n";
+  src << "#define LTIMES_JIT_NUM_Z " << m_num_z << "\n";
+  src << "#define LTIMES_JIT_BLOCK_SIZE " << block_size << "\n";
+  src << "extern \"C\" __global__ void __launch_bounds__(LTIMES_JIT_BLOCK_SIZE)\n"
+         "ltimes_noview_jit(Real_type* phidat, const Real_type* elldat,\n"
+         "                  const Real_type* psidat)\n"
+         "{\n"
+         "  const Index_type i = blockIdx.x * LTIMES_JIT_BLOCK_SIZE + threadIdx.x;\n"
+         "  if (i < LTIMES_JIT_NUM_Z * LTIMES_JIT_NUM_G * LTIMES_JIT_NUM_M) {\n"
+         "    const Index_type m = i % LTIMES_JIT_NUM_M;\n"
+         "    const Index_type g = (i / LTIMES_JIT_NUM_M) % LTIMES_JIT_NUM_G;\n"
+         "    const Index_type z = i / (LTIMES_JIT_NUM_M * LTIMES_JIT_NUM_G);\n"
+         "    const Real_type* ell = elldat + m * LTIMES_JIT_NUM_D;\n"
+         "    const Real_type* psi = psidat + (g * LTIMES_JIT_NUM_D) +\n"
+         "                           (z * LTIMES_JIT_NUM_D * LTIMES_JIT_NUM_G);\n"
+         "    Real_type phi = phidat[i];\n"
+         "#pragma unroll\n"
+         "    for (Index_type d = 0; d < LTIMES_JIT_NUM_D; ++d ) {\n"
+         "      phi += ell[d] * psi[d];\n"
+         "    }\n"
+         "    phidat[i] = phi;\n"
+         "  }\n"
+         "}\n";
+  return src.str();
+}
+
+size_t LTIMES_NOVIEW::getLayoutIndex(VariantID vid, size_t tune_idx) const
+{
+  return getLTIMESLayoutIndex(getVariantTuningName(vid, tune_idx));
+}
+
+void LTIMES_NOVIEW::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_phidat, int(m_philen), Real_type(0.0), vid);
   allocAndInitData(m_elldat, int(m_elllen), vid);
   allocAndInitData(m_psidat, int(m_psilen), vid);
+
+  const size_t layout_idx = getLayoutIndex(vid, tune_idx);
+  if (layout_idx != 0) {
+    auto reset_psi = scopedMoveData(m_psidat, m_psilen, vid);
+    reorderLTIMESData(layout_idx, m_psidat, m_num_z, m_num_g, m_num_d, true);
+  }
 }
 
 void LTIMES_NOVIEW::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  const size_t layout_idx = getLayoutIndex(vid, tune_idx);
+  if (layout_idx != 0) {
+    auto reset_phi = scopedMoveData(m_phidat, m_philen, vid);
+    reorderLTIMESData(layout_idx, m_phidat, m_num_z, m_num_g, m_num_m, false);
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_phidat, m_philen, checksum_scale_factor , vid);
 }
 
@@ -22,6 +22,14 @@
 ///   }
 /// }
 ///
+/// CPU and GPU tunings run each order of the z, g, and d indices of psi and
+/// phi, ie. zgd above or dgz, with the loop nest in the same order (see
+/// LTIMESLayout.hpp). num_d, num_g, and num_m are given by --ltimes-num-d,
+/// --ltimes-num-g, and --ltimes-num-m and the problem size sets num_z.
+///
+/// The jit GPU tunings compile the zgd loop nest at run time with num_d,
+/// num_g, num_m, and num_z written in as constants (see JitUtils.hpp).
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_NOVIEW_HPP
 #define RAJAPerf_Apps_LTIMES_NOVIEW_HPP
@@ -42,6 +50,11 @@
 
 #include "common/KernelBase.hpp"
 
+#include "LTIMESLayout.hpp"
+
+#include <string>
+#include <vector>
+
 namespace rajaperf
 {
 class RunParams;
@@ -67,12 +80,24 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < typename Layout >
+  void runSeqVariantImpl(VariantID vid);
+  template < typename Layout >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, typename Layout >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, typename Layout >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantJit(VariantID vid, size_t tune_idx);
+  template < size_t block_size >
+  void runHipVariantJit(VariantID vid, size_t tune_idx);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -96,6 +121,14 @@ private:
   Index_type m_philen;
   Index_type m_elllen;
   Index_type m_psilen;
+
+  size_t getLayoutIndex(VariantID vid, size_t tune_idx) const;
+
+  // source of the jit tunings with the extents written in as constants
+  std::string getJitSource(size_t block_size) const;
+
+  // jit metrics of each tuning, empty for tunings that are not jit tunings
+  std::vector<std::vector<double>> m_jit_metrics[NumVariants];
 };
 
 } // end namespace apps
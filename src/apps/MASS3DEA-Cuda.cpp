@@ -19,7 +19,7 @@
 namespace rajaperf {
 namespace apps {
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
   __launch_bounds__(block_size)
 __global__ void Mass3DEA(const Real_ptr B, const Real_ptr D, Real_ptr M) {
 
@@ -28,8 +28,8 @@ __global__ void Mass3DEA(const Real_ptr B, const Real_ptr D, Real_ptr M) {
   MASS3DEA_0
 
   GPU_FOREACH_THREAD(iz, z, 1) {
-    GPU_FOREACH_THREAD(d, x, MEA_D1D) {
-      GPU_FOREACH_THREAD(q, y, MEA_Q1D) {
+    GPU_FOREACH_THREAD(d, x, D1D) {
+      GPU_FOREACH_THREAD(q, y, Q1D) {
         MASS3DEA_1
       }
     }
@@ -37,9 +37,9 @@ __global__ void Mass3DEA(const Real_ptr B, const Real_ptr D, Real_ptr M) {
 
   MASS3DEA_2
 
-  GPU_FOREACH_THREAD(k1, x, MEA_Q1D) {
-    GPU_FOREACH_THREAD(k2, y, MEA_Q1D) {
-      GPU_FOREACH_THREAD(k3, z, MEA_Q1D) {
+  GPU_FOREACH_THREAD(k1, x, Q1D) {
+    GPU_FOREACH_THREAD(k2, y, Q1D) {
+      GPU_FOREACH_THREAD(k3, z, Q1D) {
         MASS3DEA_3
       }
     }
@@ -47,9 +47,9 @@ __global__ void Mass3DEA(const Real_ptr B, const Real_ptr D, Real_ptr M) {
 
   __syncthreads();
 
-  GPU_FOREACH_THREAD(i1, x, MEA_D1D) {
-    GPU_FOREACH_THREAD(i2, y, MEA_D1D) {
-      GPU_FOREACH_THREAD(i3, z, MEA_D1D) {
+  GPU_FOREACH_THREAD(i1, x, D1D) {
+    GPU_FOREACH_THREAD(i2, y, D1D) {
+      GPU_FOREACH_THREAD(i3, z, D1D) {
         MASS3DEA_4
       }
     }
@@ -57,7 +57,7 @@ __global__ void Mass3DEA(const Real_ptr B, const Real_ptr D, Real_ptr M) {
   
 }
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
 void MASS3DEA::runCudaVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
@@ -69,13 +69,16 @@ void MASS3DEA::runCudaVariantImpl(VariantID vid) {
 
   case Base_CUDA: {
 
-    dim3 nthreads_per_block(MEA_D1D, MEA_D1D, MEA_D1D);
+    dim3 nthreads_per_block(D1D, D1D, D1D);
     constexpr size_t shmem = 0;
 
+    detail::setCudaFuncSharedMemCarveout(
+        Mass3DEA<block_size, D1D, Q1D>, getSharedMemCarveout());
+
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      Mass3DEA<block_size><<<NE, nthreads_per_block, shmem, res.get_stream()>>>(B, D, M);
+      Mass3DEA<block_size, D1D, Q1D><<<NE, nthreads_per_block, shmem, res.get_stream()>>>(B, D, M);
 
       cudaErrchk( cudaGetLastError() );
     }
@@ -88,22 +91,22 @@ void MASS3DEA::runCudaVariantImpl(VariantID vid) {
 
     constexpr bool async = true;
 
-    using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, MEA_D1D*MEA_D1D*MEA_D1D>>;
+    using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, D1D*D1D*D1D>>;
 
     using outer_x = RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
 
-    using inner_x = RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<MEA_D1D>>;
+    using inner_x = RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<D1D>>;
 
-    using inner_y = RAJA::LoopPolicy<RAJA::cuda_thread_size_y_loop<MEA_D1D>>;
+    using inner_y = RAJA::LoopPolicy<RAJA::cuda_thread_size_y_loop<D1D>>;
 
-    using inner_z = RAJA::LoopPolicy<RAJA::cuda_thread_size_z_loop<MEA_D1D>>;
+    using inner_z = RAJA::LoopPolicy<RAJA::cuda_thread_size_z_loop<D1D>>;
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       RAJA::launch<launch_policy>( res,
         RAJA::LaunchParams(RAJA::Teams(NE),
-                         RAJA::Threads(MEA_D1D, MEA_D1D, MEA_D1D)),
+                         RAJA::Threads(D1D, D1D, D1D)),
         [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
 
           RAJA::loop<outer_x>(ctx, RAJA::RangeSegment(0, NE),
@@ -113,9 +116,9 @@ void MASS3DEA::runCudaVariantImpl(VariantID vid) {
 
               RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, 1),
                 [&](int ) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MEA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int d) {
-                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MEA_Q1D),
+                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int q) {
                           MASS3DEA_1
                         }
@@ -128,11 +131,11 @@ void MASS3DEA::runCudaVariantImpl(VariantID vid) {
 
               MASS3DEA_2
 
-              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MEA_Q1D),
+              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int k1) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MEA_Q1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int k2) {
-                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, MEA_Q1D),
+                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int k3) {
                           MASS3DEA_3
                         }
@@ -144,11 +147,11 @@ void MASS3DEA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MEA_D1D),
+              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int i1) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MEA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int i2) {
-                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, MEA_D1D),
+                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int i3) {
                           MASS3DEA_4
                         }
@@ -178,7 +181,7 @@ void MASS3DEA::runCudaVariantImpl(VariantID vid) {
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(MASS3DEA, Cuda)
+RAJAPERF_GPU_FEM_ORDER_TUNING_DEFINE_BOILERPLATE(MASS3DEA, Cuda)
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace rajaperf {
 namespace apps {
 
 
-void MASS3DEA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < Index_type D1D, Index_type Q1D >
+void MASS3DEA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -38,25 +39,25 @@ void MASS3DEA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
         MASS3DEA_0_CPU
 
-        CPU_FOREACH(d, x, MEA_D1D) {
-          CPU_FOREACH(q, y, MEA_Q1D) {
+        CPU_FOREACH(d, x, D1D) {
+          CPU_FOREACH(q, y, Q1D) {
             MASS3DEA_1
           }
         }
 
         MASS3DEA_2_CPU
 
-        CPU_FOREACH(k1, x, MEA_Q1D) {
-          CPU_FOREACH(k2, y, MEA_Q1D) {
-            CPU_FOREACH(k3, z, MEA_Q1D) {
+        CPU_FOREACH(k1, x, Q1D) {
+          CPU_FOREACH(k2, y, Q1D) {
+            CPU_FOREACH(k3, z, Q1D) {
               MASS3DEA_3
             }
           }
         }
 
-        CPU_FOREACH(i1, x, MEA_D1D) {
-          CPU_FOREACH(i2, y, MEA_D1D) {
-            CPU_FOREACH(i3, z, MEA_D1D) {
+        CPU_FOREACH(i1, x, D1D) {
+          CPU_FOREACH(i2, y, D1D) {
+            CPU_FOREACH(i3, z, D1D) {
               MASS3DEA_4
             }
           }
@@ -97,9 +98,9 @@ void MASS3DEA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, 1),
                 [&](int ) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MEA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int d) {
-                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MEA_Q1D),
+                      RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int q) {
                           MASS3DEA_1
                         }
@@ -111,11 +112,11 @@ void MASS3DEA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               MASS3DEA_2
 
-              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MEA_Q1D),
+              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int k1) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MEA_Q1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int k2) {
-                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, MEA_Q1D),
+                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int k3) {
                           MASS3DEA_3
                         }
@@ -127,11 +128,11 @@ void MASS3DEA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               ctx.teamSync();
 
-              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MEA_D1D),
+              RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int i1) {
-                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MEA_D1D),
+                  RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int i2) {
-                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, MEA_D1D),
+                      RAJA::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int i3) {
                           MASS3DEA_4
                         }
@@ -163,5 +164,7 @@ void MASS3DEA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+RAJAPERF_FEM_ORDER_RUN_BOILERPLATE(MASS3DEA, OpenMP)
+
 } // end namespace apps
 } // end namespace rajaperf
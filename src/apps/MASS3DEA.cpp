@@ -23,12 +23,18 @@ namespace apps
 MASS3DEA::MASS3DEA(const RunParams& params)
   : KernelBase(rajaperf::Apps_MASS3DEA, params)
 {
+  m_order = RAJAPERF_FEM_ORDER_KERNEL_PARAM(default_order);
+  m_D1D = fem_order::d1d(m_order);
+  m_Q1D = fem_order::q1d(m_order);
+
   m_NE_default = 8000;
 
-  setDefaultProblemSize(m_NE_default*MEA_Q1D*MEA_Q1D*MEA_Q1D);
+  // same number of quadrature points for all orders
+  const Index_type default_Q1D = fem_order::q1d(default_order);
+  setDefaultProblemSize(m_NE_default*default_Q1D*default_Q1D*default_Q1D);
   setDefaultReps(1);
 
-  const int ea_mat_entries = MEA_D1D*MEA_D1D*MEA_D1D*MEA_D1D*MEA_D1D*MEA_D1D;
+  const int ea_mat_entries = m_D1D*m_D1D*m_D1D*m_D1D*m_D1D*m_D1D;
   
   m_NE = std::max(getTargetProblemSize()/(ea_mat_entries), Index_type(1));
 
@@ -37,20 +43,23 @@ MASS3DEA::MASS3DEA(const RunParams& params)
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( MEA_Q1D*MEA_D1D*sizeof(Real_type)  + // B
-                  MEA_Q1D*MEA_Q1D*MEA_Q1D*m_NE*sizeof(Real_type) + // D
+  setBytesPerRep( m_Q1D*m_D1D*sizeof(Real_type)  + // B
+                  m_Q1D*m_Q1D*m_Q1D*m_NE*sizeof(Real_type) + // D
                   ea_mat_entries*m_NE*sizeof(Real_type) ); // M_e
 
   setFLOPsPerRep(m_NE * 7 * ea_mat_entries);
                  
   setUsesFeature(Launch);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
   setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesSharedMemCarveout();
   setVariantDefined( Base_CUDA );
   setVariantDefined( RAJA_CUDA );
 
@@ -66,16 +75,16 @@ MASS3DEA::~MASS3DEA()
 void MASS3DEA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 
-  allocAndInitDataConst(m_B, int(MEA_Q1D*MEA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(MEA_Q1D*MEA_Q1D*MEA_Q1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_M, int(MEA_D1D*MEA_D1D*MEA_D1D*
-                                 MEA_D1D*MEA_D1D*MEA_D1D*m_NE), Real_type(0.0), vid);
+  allocAndInitDataConst(m_B, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_M, int(m_D1D*m_D1D*m_D1D*
+                                 m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
 }
 
 void MASS3DEA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_M, MEA_D1D*MEA_D1D*MEA_D1D*
-                                          MEA_D1D*MEA_D1D*MEA_D1D*m_NE, vid);
+  checksum[vid][tune_idx] += calcChecksum(m_M, m_D1D*m_D1D*m_D1D*
+                                          m_D1D*m_D1D*m_D1D*m_NE, vid);
 }
 
 void MASS3DEA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
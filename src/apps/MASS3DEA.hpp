@@ -86,42 +86,41 @@
 
 #include "RAJA/RAJA.hpp"
 
-// Number of Dofs/Qpts in 1D
-#define MEA_D1D 4
-#define MEA_Q1D 5
-#define B_MEA_(x, y) B[x + MEA_Q1D * y]
+// D1D and Q1D, the number of Dofs/Qpts in 1D, are template parameters of
+// the variant implementations, see FEM_MACROS.hpp
+#define B_MEA_(x, y) B[x + Q1D * y]
 #define M_(i1, i2, i3, j1, j2, j3, e)                                   \
-  M[i1 + MEA_D1D * (i2 + MEA_D1D * (i3 + MEA_D1D * (j1 + MEA_D1D * (j2 + MEA_D1D * (j3 + MEA_D1D * e)))))]
+  M[i1 + D1D * (i2 + D1D * (i3 + D1D * (j1 + D1D * (j2 + D1D * (j3 + D1D * e)))))]
 
 #define D_MEA_(qx, qy, qz, e)                                           \
-  D[qx + MEA_Q1D * qy + MEA_Q1D * MEA_Q1D * qz +                        \
-    MEA_Q1D * MEA_Q1D * MEA_Q1D * e]
+  D[qx + Q1D * qy + Q1D * Q1D * qz +                                    \
+    Q1D * Q1D * Q1D * e]
 
-#define MASS3DEA_0 RAJA_TEAM_SHARED double s_B[MEA_Q1D][MEA_D1D];
+#define MASS3DEA_0 RAJA_TEAM_SHARED double s_B[Q1D][D1D];
 
-#define MASS3DEA_0_CPU double s_B[MEA_Q1D][MEA_D1D];
+#define MASS3DEA_0_CPU double s_B[Q1D][D1D];
 
 #define MASS3DEA_1 s_B[q][d] = B_MEA_(q, d);
 
 #define MASS3DEA_2                                                      \
-  double(*l_B)[MEA_D1D] = (double(*)[MEA_D1D])s_B;                      \
-  RAJA_TEAM_SHARED double s_D[MEA_Q1D][MEA_Q1D][MEA_Q1D];
+  double(*l_B)[D1D] = (double(*)[D1D])s_B;                              \
+  RAJA_TEAM_SHARED double s_D[Q1D][Q1D][Q1D];
 
 #define MASS3DEA_2_CPU                                                  \
-  double(*l_B)[MEA_D1D] = (double(*)[MEA_D1D])s_B;                      \
-  double s_D[MEA_Q1D][MEA_Q1D][MEA_Q1D];
+  double(*l_B)[D1D] = (double(*)[D1D])s_B;                              \
+  double s_D[Q1D][Q1D][Q1D];
 
 #define MASS3DEA_3 s_D[k1][k2][k3] = D_MEA_(k1, k2, k3, e);
 
 #define MASS3DEA_4                                                      \
-  for (int j1 = 0; j1 < MEA_D1D; ++j1) {                                \
-    for (int j2 = 0; j2 < MEA_D1D; ++j2) {                              \
-      for (int j3 = 0; j3 < MEA_D1D; ++j3) {                            \
+  for (int j1 = 0; j1 < D1D; ++j1) {                                    \
+    for (int j2 = 0; j2 < D1D; ++j2) {                                  \
+      for (int j3 = 0; j3 < D1D; ++j3) {                                \
                                                                         \
         double val = 0.0;                                               \
-        for (int k1 = 0; k1 < MEA_Q1D; ++k1) {                          \
-          for (int k2 = 0; k2 < MEA_Q1D; ++k2) {                        \
-            for (int k3 = 0; k3 < MEA_Q1D; ++k3) {                      \
+        for (int k1 = 0; k1 < Q1D; ++k1) {                              \
+          for (int k2 = 0; k2 < Q1D; ++k2) {                            \
+            for (int k3 = 0; k3 < Q1D; ++k3) {                          \
                                                                         \
               val += l_B[k1][i1] * l_B[k1][j1] * l_B[k2][i2]            \
                 * l_B[k2][j2] *                                         \
@@ -157,13 +156,25 @@ public:
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template <size_t block_size> void runCudaVariantImpl(VariantID vid);
-  template <size_t block_size> void runHipVariantImpl(VariantID vid);
+  template < Index_type D1D, Index_type Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < Index_type D1D, Index_type Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
+  void runHipVariantImpl(VariantID vid);
 
 private:
-  static const size_t default_gpu_block_size = MEA_D1D * MEA_D1D * MEA_D1D;
-  using gpu_block_sizes_type =
-      gpu_block_size::list_type<default_gpu_block_size>;
+  static const size_t default_order = 3;
+  using fem_orders_type = fem_order::make_list_type<default_order,
+                                                   gpu_block_size::AtMost<9>>;
+
+  // GPU threads per element, D1D x D1D x D1D
+  static constexpr size_t gpuBlockSize(size_t order)
+  {
+    return static_cast<size_t>(fem_order::d1d(order) * fem_order::d1d(order) * fem_order::d1d(order));
+  }
 
   Real_ptr m_B;
   Real_ptr m_Bt;
@@ -172,6 +183,10 @@ private:
 
   Index_type m_NE;
   Index_type m_NE_default;
+
+  Index_type m_order;
+  Index_type m_D1D;
+  Index_type m_Q1D;
 };
 
 } // end namespace apps
@@ -22,7 +22,7 @@
 namespace rajaperf {
 namespace apps {
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
   __launch_bounds__(block_size)
 __global__ void Mass3DPA(const Real_ptr B, const Real_ptr Bt,
                          const Real_ptr D, const Real_ptr X, Real_ptr Y) {
@@ -31,63 +31,63 @@ __global__ void Mass3DPA(const Real_ptr B, const Real_ptr Bt,
 
   MASS3DPA_0_GPU
 
-  GPU_FOREACH_THREAD(dy, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(dx, x, MPA_D1D){
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D){
       MASS3DPA_1
     }
-    GPU_FOREACH_THREAD(dx, x, MPA_Q1D) {
+    GPU_FOREACH_THREAD(dx, x, Q1D) {
       MASS3DPA_2
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(dy, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(qx, x, MPA_Q1D) {
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(qx, x, Q1D) {
       MASS3DPA_3
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(qy, y, MPA_Q1D) {
-    GPU_FOREACH_THREAD(qx, x, MPA_Q1D) {
+  GPU_FOREACH_THREAD(qy, y, Q1D) {
+    GPU_FOREACH_THREAD(qx, x, Q1D) {
       MASS3DPA_4
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(qy, y, MPA_Q1D) {
-    GPU_FOREACH_THREAD(qx, x, MPA_Q1D) {
+  GPU_FOREACH_THREAD(qy, y, Q1D) {
+    GPU_FOREACH_THREAD(qx, x, Q1D) {
       MASS3DPA_5
     }
   }
 
   __syncthreads();
-  GPU_FOREACH_THREAD(d, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(q, x, MPA_Q1D) {
+  GPU_FOREACH_THREAD(d, y, D1D) {
+    GPU_FOREACH_THREAD(q, x, Q1D) {
       MASS3DPA_6
     }
   }
 
   __syncthreads();
-  GPU_FOREACH_THREAD(qy, y, MPA_Q1D) {
-    GPU_FOREACH_THREAD(dx, x, MPA_D1D) {
+  GPU_FOREACH_THREAD(qy, y, Q1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D) {
       MASS3DPA_7
     }
   }
   __syncthreads();
 
-  GPU_FOREACH_THREAD(dy, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(dx, x, MPA_D1D) {
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D) {
       MASS3DPA_8
     }
   }
 
   __syncthreads();
-  GPU_FOREACH_THREAD(dy, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(dx, x, MPA_D1D) {
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D) {
       MASS3DPA_9
     }
   }
 }
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
 void MASS3DPA::runCudaVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
@@ -99,13 +99,19 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
   case Base_CUDA: {
 
-    dim3 nthreads_per_block(MPA_Q1D, MPA_Q1D, 1);
+    dim3 nthreads_per_block(Q1D, Q1D, 1);
     constexpr size_t shmem = 0;
 
+    detail::setCudaFuncSharedMemCarveout(
+        Mass3DPA<block_size, D1D, Q1D>, getSharedMemCarveout());
+
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("Mass3DPA",
+        Mass3DPA<block_size, D1D, Q1D>, Q1D*Q1D, shmem) );
+
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      Mass3DPA<block_size><<<NE, nthreads_per_block, shmem, res.get_stream()>>>(B, Bt, D, X, Y);
+      Mass3DPA<block_size, D1D, Q1D><<<NE, nthreads_per_block, shmem, res.get_stream()>>>(B, Bt, D, X, Y);
 
       cudaErrchk( cudaGetLastError() );
     }
@@ -118,20 +124,20 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
     constexpr bool async = true;
 
-    using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, MPA_Q1D*MPA_Q1D>>;
+    using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, Q1D*Q1D>>;
 
     using outer_x = RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
 
-    using inner_x = RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<MPA_Q1D>>;
+    using inner_x = RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<Q1D>>;
 
-    using inner_y = RAJA::LoopPolicy<RAJA::cuda_thread_size_y_loop<MPA_Q1D>>;
+    using inner_y = RAJA::LoopPolicy<RAJA::cuda_thread_size_y_loop<Q1D>>;
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       RAJA::launch<launch_policy>( res,
         RAJA::LaunchParams(RAJA::Teams(NE),
-                         RAJA::Threads(MPA_Q1D, MPA_Q1D, 1)),
+                         RAJA::Threads(Q1D, Q1D, 1)),
         [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
 
           RAJA::loop<outer_x>(ctx, RAJA::RangeSegment(0, NE),
@@ -139,15 +145,15 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
               MASS3DPA_0_GPU
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_1
                     }
                   );  // RAJA::loop<inner_x>
 
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int dx) {
                       MASS3DPA_2
                     }
@@ -157,9 +163,9 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_3
                     }
@@ -169,9 +175,9 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_4
                     }
@@ -181,9 +187,9 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_5
                     }
@@ -193,9 +199,9 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int d) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int q) {
                       MASS3DPA_6
                     }
@@ -205,9 +211,9 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_7
                     }
@@ -217,9 +223,9 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_8
                     }
@@ -229,9 +235,9 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_9
                     }
@@ -259,7 +265,7 @@ void MASS3DPA::runCudaVariantImpl(VariantID vid) {
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(MASS3DPA, Cuda)
+RAJAPERF_GPU_FEM_ORDER_TUNING_DEFINE_BOILERPLATE(MASS3DPA, Cuda)
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -22,7 +22,7 @@
 namespace rajaperf {
 namespace apps {
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
   __launch_bounds__(block_size)
 __global__ void Mass3DPA(const Real_ptr B, const Real_ptr Bt,
                          const Real_ptr D, const Real_ptr X, Real_ptr Y) {
@@ -31,63 +31,63 @@ __global__ void Mass3DPA(const Real_ptr B, const Real_ptr Bt,
 
   MASS3DPA_0_GPU
 
-  GPU_FOREACH_THREAD(dy, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(dx, x, MPA_D1D){
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D){
       MASS3DPA_1
     }
-    GPU_FOREACH_THREAD(dx, x, MPA_Q1D) {
+    GPU_FOREACH_THREAD(dx, x, Q1D) {
       MASS3DPA_2
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(dy, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(qx, x, MPA_Q1D) {
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(qx, x, Q1D) {
       MASS3DPA_3
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(qy, y, MPA_Q1D) {
-    GPU_FOREACH_THREAD(qx, x, MPA_Q1D) {
+  GPU_FOREACH_THREAD(qy, y, Q1D) {
+    GPU_FOREACH_THREAD(qx, x, Q1D) {
       MASS3DPA_4
     }
   }
   __syncthreads();
-  GPU_FOREACH_THREAD(qy, y, MPA_Q1D) {
-    GPU_FOREACH_THREAD(qx, x, MPA_Q1D) {
+  GPU_FOREACH_THREAD(qy, y, Q1D) {
+    GPU_FOREACH_THREAD(qx, x, Q1D) {
       MASS3DPA_5
     }
   }
 
   __syncthreads();
-  GPU_FOREACH_THREAD(d, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(q, x, MPA_Q1D) {
+  GPU_FOREACH_THREAD(d, y, D1D) {
+    GPU_FOREACH_THREAD(q, x, Q1D) {
       MASS3DPA_6
     }
   }
 
   __syncthreads();
-  GPU_FOREACH_THREAD(qy, y, MPA_Q1D) {
-    GPU_FOREACH_THREAD(dx, x, MPA_D1D) {
+  GPU_FOREACH_THREAD(qy, y, Q1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D) {
       MASS3DPA_7
     }
   }
   __syncthreads();
 
-  GPU_FOREACH_THREAD(dy, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(dx, x, MPA_D1D) {
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D) {
       MASS3DPA_8
     }
   }
 
   __syncthreads();
-  GPU_FOREACH_THREAD(dy, y, MPA_D1D) {
-    GPU_FOREACH_THREAD(dx, x, MPA_D1D) {
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D) {
       MASS3DPA_9
     }
   }
 }
 
-template < size_t block_size >
+template < size_t block_size, Index_type D1D, Index_type Q1D >
 void MASS3DPA::runHipVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
@@ -100,13 +100,16 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
   case Base_HIP: {
 
     dim3 nblocks(NE);
-    dim3 nthreads_per_block(MPA_Q1D, MPA_Q1D, 1);
+    dim3 nthreads_per_block(Q1D, Q1D, 1);
     constexpr size_t shmem = 0;
 
+    setGPUFuncAttributes( detail::getHipFuncAttributes("Mass3DPA",
+        Mass3DPA<block_size, D1D, Q1D>, Q1D*Q1D, shmem) );
+
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      hipLaunchKernelGGL((Mass3DPA<block_size>), dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+      hipLaunchKernelGGL((Mass3DPA<block_size, D1D, Q1D>), dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
                          B, Bt, D, X, Y);
 
       hipErrchk( hipGetLastError() );
@@ -121,35 +124,35 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
 
     constexpr bool async = true;
 
-    using launch_policy = RAJA::LaunchPolicy<RAJA::hip_launch_t<async, MPA_Q1D*MPA_Q1D>>;
+    using launch_policy = RAJA::LaunchPolicy<RAJA::hip_launch_t<async, Q1D*Q1D>>;
 
     using outer_x = RAJA::LoopPolicy<RAJA::hip_block_x_direct>;
 
-    using inner_x = RAJA::LoopPolicy<RAJA::hip_thread_size_x_loop<MPA_Q1D>>;
+    using inner_x = RAJA::LoopPolicy<RAJA::hip_thread_size_x_loop<Q1D>>;
 
-    using inner_y = RAJA::LoopPolicy<RAJA::hip_thread_size_y_loop<MPA_Q1D>>;
+    using inner_y = RAJA::LoopPolicy<RAJA::hip_thread_size_y_loop<Q1D>>;
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       RAJA::launch<launch_policy>( res,
         RAJA::LaunchParams(RAJA::Teams(NE),
-                         RAJA::Threads(MPA_Q1D, MPA_Q1D, 1)),
+                         RAJA::Threads(Q1D, Q1D, 1)),
         [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
           RAJA::loop<outer_x>(ctx, RAJA::RangeSegment(0, NE),
             [&](int e) {
 
               MASS3DPA_0_GPU
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_1
                     }
                   );  // RAJA::loop<inner_x>
 
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int dx) {
                       MASS3DPA_2
                     }
@@ -159,9 +162,9 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_3
                     }
@@ -171,9 +174,9 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_4
                     }
@@ -183,9 +186,9 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_5
                     }
@@ -195,9 +198,9 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int d) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int q) {
                       MASS3DPA_6
                     }
@@ -207,9 +210,9 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_7
                     }
@@ -219,9 +222,9 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_8
                     }
@@ -231,9 +234,9 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
 
               ctx.teamSync();
 
-              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_9
                     }
@@ -261,7 +264,7 @@ void MASS3DPA::runHipVariantImpl(VariantID vid) {
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(MASS3DPA, Hip)
+RAJAPERF_GPU_FEM_ORDER_TUNING_DEFINE_BOILERPLATE(MASS3DPA, Hip)
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -23,44 +23,55 @@ namespace apps
 MASS3DPA::MASS3DPA(const RunParams& params)
   : KernelBase(rajaperf::Apps_MASS3DPA, params)
 {
+  m_order = RAJAPERF_FEM_ORDER_KERNEL_PARAM(default_order);
+  m_D1D = fem_order::d1d(m_order);
+  m_Q1D = fem_order::q1d(m_order);
+
   m_NE_default = 8000;
 
-  setDefaultProblemSize(m_NE_default*MPA_Q1D*MPA_Q1D*MPA_Q1D);
+  // same number of quadrature points for all orders
+  const Index_type default_Q1D = fem_order::q1d(default_order);
+  setDefaultProblemSize(m_NE_default*default_Q1D*default_Q1D*default_Q1D);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(MPA_Q1D*MPA_Q1D*MPA_Q1D), Index_type(1));
+  m_NE = std::max(getTargetProblemSize()/(m_Q1D*m_Q1D*m_Q1D), Index_type(1));
 
-  setActualProblemSize( m_NE*MPA_Q1D*MPA_Q1D*MPA_Q1D );
+  setActualProblemSize( m_NE*m_Q1D*m_Q1D*m_Q1D );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( MPA_Q1D*MPA_D1D*sizeof(Real_type)  +
-                  MPA_Q1D*MPA_D1D*sizeof(Real_type)  +
-                  MPA_Q1D*MPA_Q1D*MPA_Q1D*m_NE*sizeof(Real_type) +
-                  MPA_D1D*MPA_D1D*MPA_D1D*m_NE*sizeof(Real_type) +
-                  MPA_D1D*MPA_D1D*MPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (2 * MPA_D1D * MPA_D1D * MPA_D1D * MPA_Q1D +
-                         2 * MPA_D1D * MPA_D1D * MPA_Q1D * MPA_Q1D +
-                         2 * MPA_D1D * MPA_Q1D * MPA_Q1D * MPA_Q1D + MPA_Q1D * MPA_Q1D * MPA_Q1D +
-                         2 * MPA_Q1D * MPA_Q1D * MPA_Q1D * MPA_D1D +
-                         2 * MPA_Q1D * MPA_Q1D * MPA_D1D * MPA_D1D +
-                         2 * MPA_Q1D * MPA_D1D * MPA_D1D * MPA_D1D + MPA_D1D * MPA_D1D * MPA_D1D));
+  setBytesPerRep( m_Q1D*m_D1D*sizeof(Real_type)  +
+                  m_Q1D*m_D1D*sizeof(Real_type)  +
+                  m_Q1D*m_Q1D*m_Q1D*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) );
+
+  setFLOPsPerRep(m_NE * (2 * m_D1D * m_D1D * m_D1D * m_Q1D +
+                         2 * m_D1D * m_D1D * m_Q1D * m_Q1D +
+                         2 * m_D1D * m_Q1D * m_Q1D * m_Q1D + m_Q1D * m_Q1D * m_Q1D +
+                         2 * m_Q1D * m_Q1D * m_Q1D * m_D1D +
+                         2 * m_Q1D * m_Q1D * m_D1D * m_D1D +
+                         2 * m_Q1D * m_D1D * m_D1D * m_D1D + m_D1D * m_D1D * m_D1D));
   setUsesFeature(Launch);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
   setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesSharedMemCarveout();
   setVariantDefined( Base_CUDA );
   setVariantDefined( RAJA_CUDA );
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
 
+  setVariantDefined( Kokkos_Lambda );
+
 }
 
 MASS3DPA::~MASS3DPA()
@@ -70,16 +81,16 @@ MASS3DPA::~MASS3DPA()
 void MASS3DPA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 
-  allocAndInitDataConst(m_B, int(MPA_Q1D*MPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Bt,int(MPA_Q1D*MPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(MPA_Q1D*MPA_Q1D*MPA_Q1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(MPA_D1D*MPA_D1D*MPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(MPA_D1D*MPA_D1D*MPA_D1D*m_NE), Real_type(0.0), vid);
+  allocAndInitDataConst(m_B, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Bt,int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
 }
 
 void MASS3DPA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_Y, MPA_D1D*MPA_D1D*MPA_D1D*m_NE, vid);
+  checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE, vid);
 }
 
 void MASS3DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
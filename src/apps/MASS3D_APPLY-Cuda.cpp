@@ -0,0 +1,343 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// Uncomment to add compiler directives loop unrolling
+//#define USE_RAJAPERF_UNROLL
+
+#include "MASS3D_APPLY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace apps {
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mass3d_apply_restrict(Real_ptr X, Real_ptr Y, Real_ptr x,
+                                      Int_ptr elem_dofs, Index_type nl)
+{
+  Index_type l = blockIdx.x * block_size + threadIdx.x;
+  if (l < nl) {
+    MASS3D_APPLY_RESTRICT_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mass3d_apply_restrict_x(Real_ptr X, Real_ptr x,
+                                        Int_ptr elem_dofs, Index_type nl)
+{
+  Index_type l = blockIdx.x * block_size + threadIdx.x;
+  if (l < nl) {
+    MASS3D_APPLY_RESTRICT_X_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mass3d_apply_restrict_t(Real_ptr y, Real_ptr Y,
+                                        Int_ptr dof_ptr, Int_ptr dof_lidx,
+                                        Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    MASS3D_APPLY_RESTRICT_T_BODY;
+  }
+}
+
+template < size_t block_size, Index_type D1D, Index_type Q1D >
+  __launch_bounds__(block_size)
+__global__ void mass3d_apply_pa(const Real_ptr B, const Real_ptr D,
+                                const Real_ptr X, Real_ptr Y) {
+
+  const int e = blockIdx.x;
+
+  MASS3DPA_0_GPU
+
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D){
+      MASS3DPA_1
+    }
+    GPU_FOREACH_THREAD(dx, x, Q1D) {
+      MASS3DPA_2
+    }
+  }
+  __syncthreads();
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(qx, x, Q1D) {
+      MASS3DPA_3
+    }
+  }
+  __syncthreads();
+  GPU_FOREACH_THREAD(qy, y, Q1D) {
+    GPU_FOREACH_THREAD(qx, x, Q1D) {
+      MASS3DPA_4
+    }
+  }
+  __syncthreads();
+  GPU_FOREACH_THREAD(qy, y, Q1D) {
+    GPU_FOREACH_THREAD(qx, x, Q1D) {
+      MASS3DPA_5
+    }
+  }
+
+  __syncthreads();
+  GPU_FOREACH_THREAD(d, y, D1D) {
+    GPU_FOREACH_THREAD(q, x, Q1D) {
+      MASS3D_APPLY_PA_6
+    }
+  }
+
+  __syncthreads();
+  GPU_FOREACH_THREAD(qy, y, Q1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D) {
+      MASS3DPA_7
+    }
+  }
+  __syncthreads();
+
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D) {
+      MASS3DPA_8
+    }
+  }
+
+  __syncthreads();
+  GPU_FOREACH_THREAD(dy, y, D1D) {
+    GPU_FOREACH_THREAD(dx, x, D1D) {
+      MASS3DPA_9
+    }
+  }
+}
+
+template < size_t block_size, Index_type D1D, Index_type Q1D >
+__launch_bounds__(block_size)
+__global__ void mass3d_apply_ea(const Real_ptr M, const Real_ptr X,
+                                Real_ptr Y, Index_type nl)
+{
+  constexpr Index_type ND = D1D*D1D*D1D;
+  Index_type l = blockIdx.x * block_size + threadIdx.x;
+  if (l < nl) {
+    MASS3D_APPLY_EA_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mass3d_apply_fa(Real_ptr y, Real_ptr x,
+                                Int_ptr row_ptr, Int_ptr col, Real_ptr val,
+                                Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    SPMV_CSR_BODY;
+  }
+}
+
+
+template < size_t block_size, Index_type D1D, Index_type Q1D >
+void MASS3D_APPLY::runCudaVariantPA(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  MASS3D_APPLY_PA_DATA_SETUP;
+
+  constexpr Index_type ND = D1D*D1D*D1D;
+  constexpr size_t l_block_size = default_gpu_block_size;
+
+  switch (vid) {
+
+  case Base_CUDA: {
+
+    const Index_type nl = NE*ND;
+    dim3 nthreads_per_block(Q1D, Q1D, 1);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t l_grid_size = RAJA_DIVIDE_CEILING_INT(nl, l_block_size);
+      mass3d_apply_restrict<l_block_size><<<l_grid_size, l_block_size, shmem, res.get_stream()>>>(
+          X, Y, x, elem_dofs, nl );
+      cudaErrchk( cudaGetLastError() );
+
+      mass3d_apply_pa<block_size, D1D, Q1D><<<NE, nthreads_per_block, shmem, res.get_stream()>>>(
+          B, D, X, Y );
+      cudaErrchk( cudaGetLastError() );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, l_block_size);
+      mass3d_apply_restrict_t<l_block_size><<<grid_size, l_block_size, shmem, res.get_stream()>>>(
+          y, Y, dof_ptr, dof_lidx, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+
+    getCout() << "\n MASS3D_APPLY : Unknown Cuda variant id = " << vid << std::endl;
+    break;
+  }
+  }
+}
+
+template < size_t block_size, Index_type D1D, Index_type Q1D >
+void MASS3D_APPLY::runCudaVariantEA(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  MASS3D_APPLY_EA_DATA_SETUP;
+
+  constexpr Index_type ND = D1D*D1D*D1D;
+
+  switch (vid) {
+
+  case Base_CUDA: {
+
+    const Index_type nl = NE*ND;
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t l_grid_size = RAJA_DIVIDE_CEILING_INT(nl, block_size);
+      mass3d_apply_restrict_x<block_size><<<l_grid_size, block_size, shmem, res.get_stream()>>>(
+          X, x, elem_dofs, nl );
+      cudaErrchk( cudaGetLastError() );
+
+      mass3d_apply_ea<block_size, D1D, Q1D><<<l_grid_size, block_size, shmem, res.get_stream()>>>(
+          M, X, Y, nl );
+      cudaErrchk( cudaGetLastError() );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+      mass3d_apply_restrict_t<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, Y, dof_ptr, dof_lidx, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+
+    getCout() << "\n MASS3D_APPLY : Unknown Cuda variant id = " << vid << std::endl;
+    break;
+  }
+  }
+}
+
+template < size_t block_size >
+void MASS3D_APPLY::runCudaVariantFA(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  MASS3D_APPLY_FA_DATA_SETUP;
+
+  switch (vid) {
+
+  case Base_CUDA: {
+
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+      mass3d_apply_fa<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, x, row_ptr, col, val, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+
+    getCout() << "\n MASS3D_APPLY : Unknown Cuda variant id = " << vid << std::endl;
+    break;
+  }
+  }
+}
+
+void MASS3D_APPLY::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(fem_orders_type{}, [&](auto order) {
+    if (static_cast<Index_type>(order) == m_order) {
+
+      constexpr size_t pa_block_size = gpuBlockSize(order);
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(pa_block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(pa_block_size);
+          runCudaVariantPA<pa_block_size, fem_order::d1d(order),
+                                          fem_order::q1d(order)>(vid);
+        }
+        t += 1;
+      }
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(default_gpu_block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(default_gpu_block_size);
+          runCudaVariantEA<default_gpu_block_size, fem_order::d1d(order),
+                                                   fem_order::q1d(order)>(vid);
+        }
+        t += 1;
+      }
+
+    }
+  });
+
+  if (run_params.numValidGPUBlockSize() == 0u ||
+      run_params.validGPUBlockSize(default_gpu_block_size)) {
+    if (tune_idx == t) {
+      setBlockSize(default_gpu_block_size);
+      runCudaVariantFA<default_gpu_block_size>(vid);
+    }
+    t += 1;
+  }
+}
+
+void MASS3D_APPLY::setCudaTuningDefinitions(VariantID vid)
+{
+  const size_t pa_block_size = gpuBlockSize(m_order);
+  if (run_params.numValidGPUBlockSize() == 0u ||
+      run_params.validGPUBlockSize(pa_block_size)) {
+    addVariantTuningName(vid, "partial_assembly_block_"+std::to_string(pa_block_size));
+  }
+
+  if (run_params.numValidGPUBlockSize() == 0u ||
+      run_params.validGPUBlockSize(default_gpu_block_size)) {
+    const std::string block_name = "_block_"+std::to_string(default_gpu_block_size);
+    addVariantTuningName(vid, "element_assembly"+block_name);
+    addVariantTuningName(vid, "full_assembly"+block_name);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // RAJA_ENABLE_CUDA
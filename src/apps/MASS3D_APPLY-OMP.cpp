@@ -0,0 +1,243 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// Uncomment to add compiler directives for loop unrolling
+//#define USE_RAJAPERF_UNROLL
+
+#include "MASS3D_APPLY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace apps {
+
+
+template < Index_type D1D, Index_type Q1D >
+void MASS3D_APPLY::runOpenMPVariantPA(VariantID vid) {
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  MASS3D_APPLY_PA_DATA_SETUP;
+
+  constexpr Index_type ND = D1D*D1D*D1D;
+
+  switch (vid) {
+
+  case Base_OpenMP: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#pragma omp parallel for
+      for (Index_type l = 0; l < NE*ND; ++l) {
+        MASS3D_APPLY_RESTRICT_BODY
+      }
+
+#pragma omp parallel for
+      for (int e = 0; e < NE; ++e) {
+
+        MASS3DPA_0_CPU
+
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D){
+            MASS3DPA_1
+          }
+          CPU_FOREACH(dx, x, Q1D) {
+            MASS3DPA_2
+          }
+        }
+
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(qx, x, Q1D) {
+            MASS3DPA_3
+          }
+        }
+
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(qx, x, Q1D) {
+            MASS3DPA_4
+          }
+        }
+
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(qx, x, Q1D) {
+            MASS3DPA_5
+          }
+        }
+
+        CPU_FOREACH(d, y, D1D) {
+          CPU_FOREACH(q, x, Q1D) {
+            MASS3D_APPLY_PA_6
+          }
+        }
+
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(dx, x, D1D) {
+            MASS3DPA_7
+          }
+        }
+
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D) {
+            MASS3DPA_8
+          }
+        }
+
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D) {
+            MASS3DPA_9
+          }
+        }
+
+      } // element loop
+
+#pragma omp parallel for
+      for (Index_type i = 0; i < nrows; ++i) {
+        MASS3D_APPLY_RESTRICT_T_BODY
+      }
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  default:
+    getCout() << "\n MASS3D_APPLY : Unknown OpenMP variant id = " << vid
+              << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < Index_type D1D, Index_type Q1D >
+void MASS3D_APPLY::runOpenMPVariantEA(VariantID vid) {
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  MASS3D_APPLY_EA_DATA_SETUP;
+
+  constexpr Index_type ND = D1D*D1D*D1D;
+
+  switch (vid) {
+
+  case Base_OpenMP: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#pragma omp parallel for
+      for (Index_type l = 0; l < NE*ND; ++l) {
+        MASS3D_APPLY_RESTRICT_X_BODY
+      }
+
+#pragma omp parallel for
+      for (Index_type l = 0; l < NE*ND; ++l) {
+        MASS3D_APPLY_EA_BODY
+      }
+
+#pragma omp parallel for
+      for (Index_type i = 0; i < nrows; ++i) {
+        MASS3D_APPLY_RESTRICT_T_BODY
+      }
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  default:
+    getCout() << "\n MASS3D_APPLY : Unknown OpenMP variant id = " << vid
+              << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MASS3D_APPLY::runOpenMPVariantFA(VariantID vid) {
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  MASS3D_APPLY_FA_DATA_SETUP;
+
+  switch (vid) {
+
+  case Base_OpenMP: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#pragma omp parallel for
+      for (Index_type i = 0; i < nrows; ++i) {
+        SPMV_CSR_BODY;
+      }
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  default:
+    getCout() << "\n MASS3D_APPLY : Unknown OpenMP variant id = " << vid
+              << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MASS3D_APPLY::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(fem_orders_type{}, [&](auto order) {
+    if (static_cast<Index_type>(order) == m_order) {
+
+      if (tune_idx == t) {
+        runOpenMPVariantPA<fem_order::d1d(order), fem_order::q1d(order)>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        runOpenMPVariantEA<fem_order::d1d(order), fem_order::q1d(order)>(vid);
+      }
+      t += 1;
+
+    }
+  });
+
+  if (tune_idx == t) {
+    runOpenMPVariantFA(vid);
+  }
+  t += 1;
+}
+
+void MASS3D_APPLY::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "partial_assembly");
+  addVariantTuningName(vid, "element_assembly");
+  addVariantTuningName(vid, "full_assembly");
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,473 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MASS3D_APPLY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include "sparse/SparseData.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+namespace
+{
+
+//
+// First global dof in one dimension coupled to global dof g, ie. sharing
+// an element with it, and the number of coupled dofs. Dofs on element
+// boundaries (g % p == 0) couple to the dofs of both neighboring elements.
+//
+Index_type coupledDofsBegin(Index_type g, Index_type p)
+{
+  return (g % p == 0) ? std::max(g - p, Index_type(0)) : g - g % p;
+}
+
+Index_type numCoupledDofs(Index_type g, Index_type p, Index_type ng)
+{
+  return (g % p == 0) ? std::min(g + p, ng - 1) - coupledDofsBegin(g, p) + 1
+                      : p + 1;
+}
+
+} // end anonymous namespace
+
+
+MASS3D_APPLY::MASS3D_APPLY(const RunParams& params)
+  : KernelBase(rajaperf::Apps_MASS3D_APPLY, params)
+{
+  m_order = RAJAPERF_FEM_ORDER_KERNEL_PARAM(default_order);
+  m_D1D = fem_order::d1d(m_order);
+  m_Q1D = fem_order::q1d(m_order);
+
+  // the assembled matrix has about (2p+1)^3 non-zeros in rows of dofs on
+  // element vertices, keep the default size small enough to hold it
+  Index_type ng_default = 50;
+
+  setDefaultProblemSize(ng_default*ng_default*ng_default);
+  setDefaultReps(50);
+
+  m_nx = std::max(Index_type((std::cbrt(getTargetProblemSize()) - 1.0) /
+                             m_order + 0.5),
+                  Index_type(1));
+  m_ng = m_nx*m_order + 1;
+  m_NE = m_nx*m_nx*m_nx;
+  m_ndofs = m_ng*m_ng*m_ng;
+
+  Index_type nnz_1d = 0;
+  for (Index_type g = 0; g < m_ng; ++g) {
+    nnz_1d += numCoupledDofs(g, m_order, m_ng);
+  }
+  m_nnz = nnz_1d*nnz_1d*nnz_1d;
+
+  setActualProblemSize( m_ndofs );
+
+  // iterations are global dofs, so the iteration timing report gives the
+  // time per dof of each assembly level
+  setItsPerRep( m_ndofs );
+  setKernelsPerRep(3);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  setFLOPsPerRep( getFLOPsPerRep(Base_Seq, 0) );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(GatherScatter);
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+MASS3D_APPLY::~MASS3D_APPLY()
+{
+}
+
+MASS3D_APPLY::Assembly MASS3D_APPLY::getAssembly(VariantID vid,
+                                                 size_t tune_idx) const
+{
+  const std::string& name = getVariantTuningName(vid, tune_idx);
+  if (name.compare(0, 4, "full") == 0) {
+    return Assembly::Full;
+  } else if (name.compare(0, 7, "element") == 0) {
+    return Assembly::Element;
+  }
+  return Assembly::Partial;
+}
+
+//
+// Tunings before setting up the kernel tunings, ie. in the constructor,
+// are counted as partial assembly.
+//
+Index_type MASS3D_APPLY::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const Index_type ND = m_D1D*m_D1D*m_D1D;
+  const Index_type nl = m_NE*ND;
+
+  const Assembly assembly = (tune_idx < getNumVariantTunings(vid))
+                          ? getAssembly(vid, tune_idx) : Assembly::Partial;
+
+  const Index_type restrict_t_bytes =
+      (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * (m_ndofs+1) + // dof_ptr
+      (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * nl +          // dof_lidx
+      (0*sizeof(Real_type) + 1*sizeof(Real_type)) * nl +          // Y
+      (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_ndofs;      // y
+
+  switch (assembly) {
+
+    case Assembly::Partial :
+      return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_ndofs + // x
+             (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * nl +      // elem_dofs
+             (2*sizeof(Real_type) + 0*sizeof(Real_type)) * nl +      // X, Y
+             (0*sizeof(Real_type) + 2*sizeof(Real_type)) * m_Q1D*m_D1D + // B, B^T
+             (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_NE*m_Q1D*m_Q1D*m_Q1D + // D
+             (0*sizeof(Real_type) + 1*sizeof(Real_type)) * nl +      // X
+             (1*sizeof(Real_type) + 1*sizeof(Real_type)) * nl +      // Y
+             restrict_t_bytes;
+
+    case Assembly::Element :
+      return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_ndofs + // x
+             (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * nl +      // elem_dofs
+             (1*sizeof(Real_type) + 0*sizeof(Real_type)) * nl +      // X
+             (0*sizeof(Real_type) + 1*sizeof(Real_type)) * nl*ND +   // M
+             (0*sizeof(Real_type) + 1*sizeof(Real_type)) * nl +      // X
+             (1*sizeof(Real_type) + 0*sizeof(Real_type)) * nl +      // Y
+             restrict_t_bytes;
+
+    case Assembly::Full :
+      return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_ndofs +     // y
+             (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * (m_ndofs+1) + // row_ptr
+             (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * m_nnz +       // col
+             (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nnz +       // val
+             (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_ndofs;      // x
+  }
+  return 0;
+}
+
+Index_type MASS3D_APPLY::getFLOPsPerRep(VariantID vid, size_t tune_idx) const
+{
+  const Index_type ND = m_D1D*m_D1D*m_D1D;
+
+  const Assembly assembly = (tune_idx < getNumVariantTunings(vid))
+                          ? getAssembly(vid, tune_idx) : Assembly::Partial;
+
+  switch (assembly) {
+
+    case Assembly::Partial :
+      return m_NE * (2 * m_D1D * m_D1D * m_D1D * m_Q1D +
+                     2 * m_D1D * m_D1D * m_Q1D * m_Q1D +
+                     2 * m_D1D * m_Q1D * m_Q1D * m_Q1D + m_Q1D * m_Q1D * m_Q1D +
+                     2 * m_Q1D * m_Q1D * m_Q1D * m_D1D +
+                     2 * m_Q1D * m_Q1D * m_D1D * m_D1D +
+                     2 * m_Q1D * m_D1D * m_D1D * m_D1D + m_D1D * m_D1D * m_D1D) +
+             m_NE * ND; // restriction transpose
+
+    case Assembly::Element :
+      return m_NE * ND * 2 * ND +
+             m_NE * ND; // restriction transpose
+
+    case Assembly::Full :
+      return 2 * m_nnz;
+  }
+  return 0;
+}
+
+template < typename T >
+void MASS3D_APPLY::allocAndCopyData(T*& ptr, const std::vector<T>& host_data,
+                                    VariantID vid)
+{
+  const Index_type len = static_cast<Index_type>(host_data.size());
+  allocData(ptr, len, vid);
+  copyData(getDataSpace(vid), ptr, DataSpace::Host, host_data.data(), len);
+}
+
+void MASS3D_APPLY::setUp(VariantID vid, size_t tune_idx)
+{
+  const Index_type p = m_order;
+  const Index_type D1D = m_D1D;
+  const Index_type Q1D = m_Q1D;
+  const Index_type ND = D1D*D1D*D1D;
+  const Index_type NQ = Q1D*Q1D*Q1D;
+  const Index_type nl = m_NE*ND;
+
+  const Assembly assembly = getAssembly(vid, tune_idx);
+
+  m_B = nullptr;
+  m_D = nullptr;
+  m_M = nullptr;
+  m_Xe = nullptr;
+  m_Ye = nullptr;
+  m_elem_dofs = nullptr;
+  m_dof_ptr = nullptr;
+  m_dof_lidx = nullptr;
+  m_row_ptr = nullptr;
+  m_col = nullptr;
+  m_val = nullptr;
+
+  //
+  // Basis B(q, d) and quadrature data D(q, e), all tunings assemble from
+  // the same values.
+  //
+  std::vector<Real_type> B(Q1D*D1D);
+  for (Index_type d = 0; d < D1D; ++d) {
+    for (Index_type q = 0; q < Q1D; ++q) {
+      B[q + Q1D*d] = 1.0 / (1.0 + q + d);
+    }
+  }
+  std::vector<Real_type> Dq(m_NE*NQ);
+  for (Index_type i = 0; i < m_NE*NQ; ++i) {
+    Dq[i] = 1.0 + 0.125 * (i % 8);
+  }
+
+  //
+  // Global dofs of the local dofs of each element.
+  //
+  std::vector<Int_type> elem_dofs(nl);
+  for (Index_type ez = 0; ez < m_nx; ++ez) {
+    for (Index_type ey = 0; ey < m_nx; ++ey) {
+      for (Index_type ex = 0; ex < m_nx; ++ex) {
+        const Index_type e = ex + m_nx*(ey + m_nx*ez);
+        for (Index_type dz = 0; dz < D1D; ++dz) {
+          for (Index_type dy = 0; dy < D1D; ++dy) {
+            for (Index_type dx = 0; dx < D1D; ++dx) {
+              elem_dofs[dx + D1D*(dy + D1D*dz) + ND*e] = static_cast<Int_type>(
+                  (ex*p+dx) + m_ng*((ey*p+dy) + m_ng*(ez*p+dz)));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  //
+  // Element matrices M(i, j, e), assembled with sum factorization over
+  // the quadrature points one dimension at a time.
+  //
+  std::vector<Real_type> M;
+  if (assembly != Assembly::Partial) {
+    M.resize(nl*ND);
+    const Index_type D2 = D1D*D1D;
+    std::vector<Real_type> T1(D2*Q1D*Q1D);
+    std::vector<Real_type> T2(D2*D2*Q1D);
+    for (Index_type e = 0; e < m_NE; ++e) {
+      // T1(i1 j1, q2, q3) = sum_q1 B(q1, i1) B(q1, j1) D(q1, q2, q3, e)
+      for (Index_type q3 = 0; q3 < Q1D; ++q3) {
+        for (Index_type q2 = 0; q2 < Q1D; ++q2) {
+          for (Index_type ij = 0; ij < D2; ++ij) {
+            const Index_type i1 = ij % D1D;
+            const Index_type j1 = ij / D1D;
+            Real_type sum = 0.0;
+            for (Index_type q1 = 0; q1 < Q1D; ++q1) {
+              sum += B[q1 + Q1D*i1] * B[q1 + Q1D*j1] *
+                     Dq[q1 + Q1D*(q2 + Q1D*q3) + NQ*e];
+            }
+            T1[ij + D2*(q2 + Q1D*q3)] = sum;
+          }
+        }
+      }
+      // T2(i1 j1, i2 j2, q3) = sum_q2 B(q2, i2) B(q2, j2) T1(i1 j1, q2, q3)
+      for (Index_type q3 = 0; q3 < Q1D; ++q3) {
+        for (Index_type ij2 = 0; ij2 < D2; ++ij2) {
+          const Index_type i2 = ij2 % D1D;
+          const Index_type j2 = ij2 / D1D;
+          for (Index_type ij1 = 0; ij1 < D2; ++ij1) {
+            Real_type sum = 0.0;
+            for (Index_type q2 = 0; q2 < Q1D; ++q2) {
+              sum += B[q2 + Q1D*i2] * B[q2 + Q1D*j2] *
+                     T1[ij1 + D2*(q2 + Q1D*q3)];
+            }
+            T2[ij1 + D2*(ij2 + D2*q3)] = sum;
+          }
+        }
+      }
+      // M(i, j, e) = sum_q3 B(q3, i3) B(q3, j3) T2(i1 j1, i2 j2, q3)
+      for (Index_type j = 0; j < ND; ++j) {
+        const Index_type j1 = j % D1D;
+        const Index_type j2 = (j / D1D) % D1D;
+        const Index_type j3 = j / D2;
+        for (Index_type i = 0; i < ND; ++i) {
+          const Index_type i1 = i % D1D;
+          const Index_type i2 = (i / D1D) % D1D;
+          const Index_type i3 = i / D2;
+          const Index_type ij1 = i1 + D1D*j1;
+          const Index_type ij2 = i2 + D1D*j2;
+          Real_type sum = 0.0;
+          for (Index_type q3 = 0; q3 < Q1D; ++q3) {
+            sum += B[q3 + Q1D*i3] * B[q3 + Q1D*j3] *
+                   T2[ij1 + D2*(ij2 + D2*q3)];
+          }
+          M[i + ND*j + ND*ND*e] = sum;
+        }
+      }
+    }
+  }
+
+  if (assembly == Assembly::Full) {
+
+    //
+    // Global matrix in CSR format, the columns of a row are the dofs
+    // coupled to it in each dimension and are in increasing order.
+    //
+    sparse::CSRMatrix A;
+    A.nrows = m_ndofs;
+    A.row_ptr.resize(m_ndofs+1);
+    A.row_ptr[0] = 0;
+    for (Index_type gz = 0; gz < m_ng; ++gz) {
+      for (Index_type gy = 0; gy < m_ng; ++gy) {
+        for (Index_type gx = 0; gx < m_ng; ++gx) {
+          const Index_type g = gx + m_ng*(gy + m_ng*gz);
+          A.row_ptr[g+1] = A.row_ptr[g] + static_cast<Int_type>(
+              numCoupledDofs(gx, p, m_ng) * numCoupledDofs(gy, p, m_ng) *
+              numCoupledDofs(gz, p, m_ng));
+        }
+      }
+    }
+    A.col.resize(m_nnz);
+    A.val.assign(m_nnz, 0.0);
+    for (Index_type gz = 0; gz < m_ng; ++gz) {
+      for (Index_type gy = 0; gy < m_ng; ++gy) {
+        for (Index_type gx = 0; gx < m_ng; ++gx) {
+          Index_type k = A.row_ptr[gx + m_ng*(gy + m_ng*gz)];
+          const Index_type cz0 = coupledDofsBegin(gz, p);
+          const Index_type cy0 = coupledDofsBegin(gy, p);
+          const Index_type cx0 = coupledDofsBegin(gx, p);
+          for (Index_type cz = cz0; cz < cz0 + numCoupledDofs(gz, p, m_ng); ++cz) {
+            for (Index_type cy = cy0; cy < cy0 + numCoupledDofs(gy, p, m_ng); ++cy) {
+              for (Index_type cx = cx0; cx < cx0 + numCoupledDofs(gx, p, m_ng); ++cx) {
+                A.col[k++] = static_cast<Int_type>(cx + m_ng*(cy + m_ng*cz));
+              }
+            }
+          }
+        }
+      }
+    }
+    for (Index_type e = 0; e < m_NE; ++e) {
+      for (Index_type j = 0; j < ND; ++j) {
+        const Index_type gj = elem_dofs[j + ND*e];
+        const Index_type cx = gj % m_ng;
+        const Index_type cy = (gj / m_ng) % m_ng;
+        const Index_type cz = gj / (m_ng*m_ng);
+        for (Index_type i = 0; i < ND; ++i) {
+          const Index_type gi = elem_dofs[i + ND*e];
+          const Index_type gx = gi % m_ng;
+          const Index_type gy = (gi / m_ng) % m_ng;
+          const Index_type gz = gi / (m_ng*m_ng);
+          const Index_type k = A.row_ptr[gi] +
+              ((cz - coupledDofsBegin(gz, p)) * numCoupledDofs(gy, p, m_ng) +
+               (cy - coupledDofsBegin(gy, p))) * numCoupledDofs(gx, p, m_ng) +
+              (cx - coupledDofsBegin(gx, p));
+          A.val[k] += M[i + ND*j + ND*ND*e];
+        }
+      }
+    }
+
+    allocAndCopyData(m_row_ptr, A.row_ptr, vid);
+    allocAndCopyData(m_col, A.col, vid);
+    allocAndCopyData(m_val, A.val, vid);
+
+  } else {
+
+    //
+    // L-vector entries of each global dof, in increasing order.
+    //
+    std::vector<Int_type> dof_ptr(m_ndofs+1, 0);
+    for (Index_type l = 0; l < nl; ++l) {
+      dof_ptr[elem_dofs[l]+1] += 1;
+    }
+    for (Index_type i = 0; i < m_ndofs; ++i) {
+      dof_ptr[i+1] += dof_ptr[i];
+    }
+    std::vector<Int_type> dof_lidx(nl);
+    std::vector<Int_type> dof_next(dof_ptr.begin(), dof_ptr.end()-1);
+    for (Index_type l = 0; l < nl; ++l) {
+      dof_lidx[dof_next[elem_dofs[l]]++] = static_cast<Int_type>(l);
+    }
+
+    allocAndCopyData(m_elem_dofs, elem_dofs, vid);
+    allocAndCopyData(m_dof_ptr, dof_ptr, vid);
+    allocAndCopyData(m_dof_lidx, dof_lidx, vid);
+
+    if (assembly == Assembly::Partial) {
+      allocAndCopyData(m_B, B, vid);
+      allocAndCopyData(m_D, Dq, vid);
+    } else {
+      allocAndCopyData(m_M, M, vid);
+    }
+
+    allocAndInitDataConst(m_Xe, nl, 0.0, vid);
+    allocAndInitDataConst(m_Ye, nl, 0.0, vid);
+
+  }
+
+  allocAndInitData(m_x, m_ndofs, vid);
+  {
+    auto reset_x = scopedMoveData(m_x, m_ndofs, vid);
+    for (Index_type i = 0; i < m_ndofs; ++i) {
+      m_x[i] = 1.0 + 0.125 * (i % 8);
+    }
+  }
+  allocAndInitDataConst(m_y, m_ndofs, 0.0, vid);
+}
+
+void MASS3D_APPLY::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_ndofs, vid);
+}
+
+void MASS3D_APPLY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  if (m_B) {
+    deallocData(m_B, vid);
+  }
+  if (m_D) {
+    deallocData(m_D, vid);
+  }
+  if (m_M) {
+    deallocData(m_M, vid);
+  }
+  if (m_Xe) {
+    deallocData(m_Xe, vid);
+  }
+  if (m_Ye) {
+    deallocData(m_Ye, vid);
+  }
+  if (m_elem_dofs) {
+    deallocData(m_elem_dofs, vid);
+  }
+  if (m_dof_ptr) {
+    deallocData(m_dof_ptr, vid);
+  }
+  if (m_dof_lidx) {
+    deallocData(m_dof_lidx, vid);
+  }
+  if (m_row_ptr) {
+    deallocData(m_row_ptr, vid);
+  }
+  if (m_col) {
+    deallocData(m_col, vid);
+  }
+  if (m_val) {
+    deallocData(m_val, vid);
+  }
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,241 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Action of the global 3D mass matrix, y = A x, of continuous (H1)
+/// elements of order p on a structured nx x nx x nx hex mesh, computed
+/// with three levels of assembly. The tunings compute the same result.
+///
+/// The mesh has ng = nx*p+1 dofs in each dimension, local dof (dx, dy, dz)
+/// of element (ex, ey, ez) is global dof (ex*p+dx, ey*p+dy, ez*p+dz).
+/// elem_dofs maps element local dofs (L-vector entries) to global dofs and
+/// the CSR like dof_ptr, dof_lidx lists the L-vector entries of each global
+/// dof. Assembly of the element and global matrices is done in setUp and
+/// is not timed.
+///
+/// partial_assembly : restriction, sum factorized element action (MASS3DPA),
+///                    restriction transpose
+///
+///   for (l = 0; l < NE*ND; ++l) {
+///     X[l] = x[elem_dofs[l]]; Y[l] = 0;
+///   }
+///   for (e = 0; e < NE; ++e) {
+///     MASS3DPA element e, X -> Y
+///   }
+///   for (i = 0; i < ndofs; ++i) {
+///     y[i] = sum of Y[dof_lidx[k]], k in [dof_ptr[i], dof_ptr[i+1])
+///   }
+///
+/// element_assembly : restriction, batched dense matvec with the element
+///                    matrices M (MASS3DEA layout), restriction transpose
+///
+///   for (l = 0; l < NE*ND; ++l) {
+///     e = l / ND; i = l % ND;
+///     Y[l] = sum of M[i + ND*j + ND*ND*e] * X[j + ND*e], j in [0, ND)
+///   }
+///
+/// full_assembly : CSR SpMV with the assembled global matrix (SPMV)
+///
+/// where ND = D1D*D1D*D1D is the number of dofs per element.
+///
+
+#ifndef RAJAPerf_Apps_MASS3D_APPLY_HPP
+#define RAJAPerf_Apps_MASS3D_APPLY_HPP
+
+//
+// x and y are global vectors, X and Y are the L-vectors used by the
+// MASS3DPA macros.
+//
+#define MASS3D_APPLY_DATA_SETUP \
+  const Index_type nrows = m_ndofs; \
+\
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define MASS3D_APPLY_L_DATA_SETUP \
+  MASS3D_APPLY_DATA_SETUP; \
+\
+  const Index_type NE = m_NE; \
+\
+  Int_ptr elem_dofs = m_elem_dofs; \
+  Int_ptr dof_ptr = m_dof_ptr; \
+  Int_ptr dof_lidx = m_dof_lidx; \
+  Real_ptr X = m_Xe; \
+  Real_ptr Y = m_Ye;
+
+#define MASS3D_APPLY_PA_DATA_SETUP \
+  MASS3D_APPLY_L_DATA_SETUP; \
+\
+  Real_ptr B = m_B; \
+  Real_ptr D = m_D;
+
+#define MASS3D_APPLY_EA_DATA_SETUP \
+  MASS3D_APPLY_L_DATA_SETUP; \
+\
+  Real_ptr M = m_M;
+
+#define MASS3D_APPLY_FA_DATA_SETUP \
+  MASS3D_APPLY_DATA_SETUP; \
+\
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val;
+
+#include "common/KernelBase.hpp"
+#include "MASS3DPA.hpp"
+#include "sparse/SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <string>
+#include <vector>
+
+// element restriction of L-vector entry l, clears Y for MASS3DPA_9
+#define MASS3D_APPLY_RESTRICT_BODY \
+  X[l] = x[elem_dofs[l]]; \
+  Y[l] = 0.0;
+
+#define MASS3D_APPLY_RESTRICT_X_BODY \
+  X[l] = x[elem_dofs[l]];
+
+// transposed basis in shared memory read from B, used in place of MASS3DPA_6
+#define MASS3D_APPLY_PA_6 \
+  Btsmem[d][q] = B_(q, d);
+
+// transpose of the element restriction for global dof i
+#define MASS3D_APPLY_RESTRICT_T_BODY \
+  Real_type sum = 0.0; \
+  for (Index_type k = dof_ptr[i]; k < dof_ptr[i+1]; ++k ) { \
+    sum += Y[dof_lidx[k]]; \
+  } \
+  y[i] = sum;
+
+// row i of the matrix of element e times the element dofs of X
+// 2 * ND
+#define MASS3D_APPLY_EA_BODY \
+  const Index_type e = l / ND; \
+  const Index_type i = l - e * ND; \
+  Real_type dot = 0.0; \
+  RAJAPERF_UNROLL(ND) \
+  for (Index_type j = 0; j < ND; ++j ) { \
+    dot += M[i + ND * j + ND * ND * e] * X[j + ND * e]; \
+  } \
+  Y[l] = dot;
+
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class MASS3D_APPLY : public KernelBase
+{
+public:
+
+  MASS3D_APPLY(const RunParams& params);
+
+  ~MASS3D_APPLY();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+  Index_type getFLOPsPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3D_APPLY : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  template < Index_type D1D, Index_type Q1D >
+  void runSeqVariantPA(VariantID vid);
+  template < Index_type D1D, Index_type Q1D >
+  void runSeqVariantEA(VariantID vid);
+  void runSeqVariantFA(VariantID vid);
+  template < Index_type D1D, Index_type Q1D >
+  void runOpenMPVariantPA(VariantID vid);
+  template < Index_type D1D, Index_type Q1D >
+  void runOpenMPVariantEA(VariantID vid);
+  void runOpenMPVariantFA(VariantID vid);
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
+  void runCudaVariantPA(VariantID vid);
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
+  void runCudaVariantEA(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantFA(VariantID vid);
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
+  void runHipVariantPA(VariantID vid);
+  template < size_t block_size, Index_type D1D, Index_type Q1D >
+  void runHipVariantEA(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantFA(VariantID vid);
+
+private:
+  static const size_t default_order = 3;
+  using fem_orders_type = fem_order::make_list_type<default_order>;
+
+  // GPU threads per element of partial assembly, Q1D x Q1D
+  static constexpr size_t gpuBlockSize(size_t order)
+  {
+    return static_cast<size_t>(fem_order::q1d(order) * fem_order::q1d(order));
+  }
+
+  // block size of the element and full assembly GPU kernels
+  static const size_t default_gpu_block_size = 256;
+
+  enum struct Assembly { Partial, Element, Full };
+
+  // assembly level of tuning, given by the start of the tuning name
+  Assembly getAssembly(VariantID vid, size_t tune_idx) const;
+
+  template < typename T >
+  void allocAndCopyData(T*& ptr, const std::vector<T>& host_data,
+                        VariantID vid);
+
+  Real_ptr m_B;
+  Real_ptr m_D;
+  Real_ptr m_M;
+  Real_ptr m_Xe;
+  Real_ptr m_Ye;
+  Real_ptr m_x;
+  Real_ptr m_y;
+
+  Int_ptr m_elem_dofs;
+  Int_ptr m_dof_ptr;
+  Int_ptr m_dof_lidx;
+  Int_ptr m_row_ptr;
+  Int_ptr m_col;
+  Real_ptr m_val;
+
+  Index_type m_order;
+  Index_type m_D1D;
+  Index_type m_Q1D;
+
+  Index_type m_nx;     // elements in each dimension
+  Index_type m_ng;     // global dofs in each dimension
+  Index_type m_NE;
+  Index_type m_ndofs;
+  Index_type m_nnz;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
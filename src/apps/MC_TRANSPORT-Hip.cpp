@@ -0,0 +1,426 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MC_TRANSPORT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#if defined(__HIPCC__)
+#define ROCPRIM_HIP_API 1
+#include "rocprim/device/device_scan.hpp"
+#elif defined(__CUDACC__)
+#include "cub/device/device_scan.cuh"
+#include "cub/util_allocator.cuh"
+#endif
+
+#include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mc_history(Real_ptr x, Real_ptr mu, Int_ptr cell,
+                           Int_ptr nevents, Int_ptr event,
+                           Real_ptr sigma_t, Real_ptr tally,
+                           Index_type num_particles, Index_type num_cells,
+                           Real_type p_absorb)
+{
+  Index_type p = blockIdx.x * block_size + threadIdx.x;
+  if (p < num_particles) {
+    MC_TRANSPORT_HISTORY_BODY(RAJA::atomicAdd<RAJA::hip_atomic>);
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mc_event_init(Real_ptr x, Real_ptr mu, Int_ptr cell,
+                              Int_ptr nevents, Int_ptr event, Int_ptr queue,
+                              Index_type num_particles, Index_type num_cells)
+{
+  Index_type p = blockIdx.x * block_size + threadIdx.x;
+  if (p < num_particles) {
+    MC_TRANSPORT_EVENT_INIT_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mc_event_flight(Real_ptr x, Real_ptr mu, Int_ptr cell,
+                                Int_ptr nevents, Int_ptr event,
+                                Real_ptr sigma_t, Int_ptr queue,
+                                Index_type* counts, Index_type num_active,
+                                Index_type num_particles)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < num_active) {
+    MC_TRANSPORT_EVENT_FLIGHT_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mc_event_partition(Int_ptr queue, Int_ptr event_queue,
+                                   Index_type* counts, Index_type num_active)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < num_active) {
+    MC_TRANSPORT_EVENT_PARTITION_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mc_event_process(Real_ptr x, Real_ptr mu, Int_ptr cell,
+                                 Int_ptr nevents, Int_ptr event,
+                                 Real_ptr tally, Int_ptr event_queue,
+                                 Index_type* counts, Index_type* alive,
+                                 Index_type num_active,
+                                 Index_type num_particles, Index_type num_cells,
+                                 Real_type p_absorb)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < num_active) {
+    MC_TRANSPORT_EVENT_PROCESS_BODY(RAJA::atomicAdd<RAJA::hip_atomic>);
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mc_event_compact(Int_ptr queue, Int_ptr event_queue,
+                                 Index_type* alive, Index_type* len,
+                                 Index_type num_active)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < num_active) {
+    MC_TRANSPORT_EVENT_COMPACT_BODY;
+    if (i == num_active-1) {
+      *len = alive[i+1];
+    }
+  }
+}
+
+
+template < size_t block_size, size_t tuning, bool launch >
+void MC_TRANSPORT::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  MC_TRANSPORT_DATA_SETUP;
+  MC_TRANSPORT_EVENT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    Index_type* len;
+    allocData(DataSpace::HipPinned, len, 1);
+
+    hipStream_t stream = res.get_stream();
+
+    RAJA::operators::plus<Index_type> binary_op;
+    Index_type init_val = 0;
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+#if defined(__HIPCC__)
+    hipErrchk(::rocprim::exclusive_scan(d_temp_storage,
+                                        temp_storage_bytes,
+                                        counts,
+                                        counts,
+                                        init_val,
+                                        num_particles+1,
+                                        binary_op,
+                                        stream));
+#elif defined(__CUDACC__)
+    hipErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                               temp_storage_bytes,
+                                               counts,
+                                               counts,
+                                               binary_op,
+                                               init_val,
+                                               num_particles+1,
+                                               stream));
+#endif
+
+    unsigned char* temp_storage;
+    allocData(DataSpace::HipDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_particles, block_size);
+
+      if (tuning == s_history) {
+
+        hipLaunchKernelGGL((mc_history<block_size>), dim3(grid_size), dim3(block_size), shmem, stream,
+                           x, mu, cell, nevents, event, sigma_t, tally,
+                           num_particles, num_cells, p_absorb );
+        hipErrchk( hipGetLastError() );
+
+      } else {
+
+        hipLaunchKernelGGL((mc_event_init<block_size>), dim3(grid_size), dim3(block_size), shmem, stream,
+                           x, mu, cell, nevents, event, queue, num_particles, num_cells );
+        hipErrchk( hipGetLastError() );
+
+        Index_type num_active = num_particles;
+        while (num_active > 0) {
+
+          const size_t active_grid_size = RAJA_DIVIDE_CEILING_INT(num_active, block_size);
+          const int scan_size = num_active+1;
+
+          hipLaunchKernelGGL((mc_event_flight<block_size>), dim3(active_grid_size), dim3(block_size), shmem, stream,
+                             x, mu, cell, nevents, event, sigma_t, queue, counts,
+                             num_active, num_particles );
+          hipErrchk( hipGetLastError() );
+
+#if defined(__HIPCC__)
+          hipErrchk(::rocprim::exclusive_scan(d_temp_storage,
+                                              temp_storage_bytes,
+                                              counts,
+                                              counts,
+                                              init_val,
+                                              scan_size,
+                                              binary_op,
+                                              stream));
+#elif defined(__CUDACC__)
+          hipErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     counts,
+                                                     counts,
+                                                     binary_op,
+                                                     init_val,
+                                                     scan_size,
+                                                     stream));
+#endif
+
+          hipLaunchKernelGGL((mc_event_partition<block_size>), dim3(active_grid_size), dim3(block_size), shmem, stream,
+                             queue, event_queue, counts, num_active );
+          hipErrchk( hipGetLastError() );
+
+          hipLaunchKernelGGL((mc_event_process<block_size>), dim3(active_grid_size), dim3(block_size), shmem, stream,
+                             x, mu, cell, nevents, event, tally, event_queue, counts, alive,
+                             num_active, num_particles, num_cells, p_absorb );
+          hipErrchk( hipGetLastError() );
+
+#if defined(__HIPCC__)
+          hipErrchk(::rocprim::exclusive_scan(d_temp_storage,
+                                              temp_storage_bytes,
+                                              alive,
+                                              alive,
+                                              init_val,
+                                              scan_size,
+                                              binary_op,
+                                              stream));
+#elif defined(__CUDACC__)
+          hipErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     alive,
+                                                     alive,
+                                                     binary_op,
+                                                     init_val,
+                                                     scan_size,
+                                                     stream));
+#endif
+
+          hipLaunchKernelGGL((mc_event_compact<block_size>), dim3(active_grid_size), dim3(block_size), shmem, stream,
+                             queue, event_queue, alive, len, num_active );
+          hipErrchk( hipGetLastError() );
+
+          hipErrchk( hipStreamSynchronize(stream) );
+          num_active = *len;
+        }
+
+      }
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, temp_storage);
+    deallocData(DataSpace::HipPinned, len);
+
+  } else if ( vid == RAJA_HIP ) {
+
+    Index_type* len;
+    allocData(DataSpace::HipPinned, len, 1);
+
+    using exec_policy = RAJA::hip_exec<block_size, true /*async*/>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if (tuning == s_history) {
+
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, num_particles),
+          [=] __device__ (Index_type p) {
+          MC_TRANSPORT_HISTORY_BODY(RAJA::atomicAdd<RAJA::hip_atomic>);
+        });
+
+      } else {
+
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, num_particles),
+          [=] __device__ (Index_type p) {
+          MC_TRANSPORT_EVENT_INIT_BODY;
+        });
+
+        Index_type num_active = num_particles;
+        while (num_active > 0) {
+
+          gpu_launch::forall< block_size, launch >( res,
+            RAJA::RangeSegment(0, num_active),
+            [=] __device__ (Index_type i) {
+            MC_TRANSPORT_EVENT_FLIGHT_BODY;
+          });
+
+          RAJA::exclusive_scan_inplace< exec_policy >( res,
+              RAJA::make_span(counts, num_active+1));
+
+          gpu_launch::forall< block_size, launch >( res,
+            RAJA::RangeSegment(0, num_active),
+            [=] __device__ (Index_type i) {
+            MC_TRANSPORT_EVENT_PARTITION_BODY;
+          });
+
+          gpu_launch::forall< block_size, launch >( res,
+            RAJA::RangeSegment(0, num_active),
+            [=] __device__ (Index_type i) {
+            MC_TRANSPORT_EVENT_PROCESS_BODY(RAJA::atomicAdd<RAJA::hip_atomic>);
+          });
+
+          RAJA::exclusive_scan_inplace< exec_policy >( res,
+              RAJA::make_span(alive, num_active+1));
+
+          gpu_launch::forall< block_size, launch >( res,
+            RAJA::RangeSegment(0, num_active),
+            [=] __device__ (Index_type i) {
+            MC_TRANSPORT_EVENT_COMPACT_BODY;
+            if (i == num_active-1) {
+              *len = alive[i+1];
+            }
+          });
+
+          res.wait();
+          num_active = *len;
+        }
+
+      }
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipPinned, len);
+
+  } else {
+    getCout() << "\n  MC_TRANSPORT : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void MC_TRANSPORT::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    seq_for(tunings_type{}, [&](auto tuning) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantImpl<block_size, decltype(tuning)::value>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    });
+
+  } else {
+
+    getCout() << "\n  MC_TRANSPORT : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runHipVariantImpl<block_size, s_history, true>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+}
+
+void MC_TRANSPORT::setHipTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    seq_for(tunings_type{}, [&](auto tuning) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, getTuningNames()[tuning]+
+                                    "_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    });
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
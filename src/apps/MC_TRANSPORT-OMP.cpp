@@ -0,0 +1,303 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MC_TRANSPORT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// Exclusive scan in place of counts[0, n) by the threads of one parallel
+// region, each with a contiguous range of the counts.
+//
+static void mcExclusiveScanOMP(Index_type* counts, Index_type n,
+                               std::vector<Index_type>& thread_counts)
+{
+  const int p0 = static_cast<int>(std::min(n, static_cast<Index_type>(thread_counts.size())));
+
+  #pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Index_type step = n / p;
+    const Index_type local_begin = pid * step;
+    const Index_type local_end = (pid == p-1) ? n : (pid+1) * step;
+
+    Index_type local_count = 0;
+    for (Index_type i = local_begin; i < local_end; ++i ) {
+      Index_type inc = counts[i];
+      counts[i] = local_count;
+      local_count += inc;
+    }
+    thread_counts[pid] = local_count;
+
+    #pragma omp barrier
+
+    if (pid != 0) {
+
+      Index_type prev_count = 0;
+      for (int ip = 0; ip < pid; ++ip) {
+        prev_count += thread_counts[ip];
+      }
+
+      for (Index_type i = local_begin; i < local_end; ++i ) {
+        counts[i] += prev_count;
+      }
+    }
+  }
+}
+
+#endif
+
+template < size_t tuning >
+void MC_TRANSPORT::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  MC_TRANSPORT_DATA_SETUP;
+  MC_TRANSPORT_EVENT_DATA_SETUP;
+
+  std::vector<Index_type> thread_counts(omp_get_max_threads());
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (tuning == s_history) {
+
+          #pragma omp parallel for
+          for (Index_type p = 0; p < num_particles; ++p ) {
+            MC_TRANSPORT_HISTORY_BODY(RAJA::atomicAdd<RAJA::omp_atomic>);
+          }
+
+        } else {
+
+          #pragma omp parallel for
+          for (Index_type p = 0; p < num_particles; ++p ) {
+            MC_TRANSPORT_EVENT_INIT_BODY;
+          }
+
+          Index_type num_active = num_particles;
+          while (num_active > 0) {
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < num_active; ++i ) {
+              MC_TRANSPORT_EVENT_FLIGHT_BODY;
+            }
+
+            mcExclusiveScanOMP(counts, num_active+1, thread_counts);
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < num_active; ++i ) {
+              MC_TRANSPORT_EVENT_PARTITION_BODY;
+            }
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < num_active; ++i ) {
+              MC_TRANSPORT_EVENT_PROCESS_BODY(RAJA::atomicAdd<RAJA::omp_atomic>);
+            }
+
+            mcExclusiveScanOMP(alive, num_active+1, thread_counts);
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < num_active; ++i ) {
+              MC_TRANSPORT_EVENT_COMPACT_BODY;
+            }
+
+            num_active = alive[num_active];
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto history_lam = [=](Index_type p) {
+                           MC_TRANSPORT_HISTORY_BODY(RAJA::atomicAdd<RAJA::omp_atomic>);
+                         };
+      auto init_lam = [=](Index_type p) {
+                        MC_TRANSPORT_EVENT_INIT_BODY;
+                      };
+      auto flight_lam = [=](Index_type i) {
+                          MC_TRANSPORT_EVENT_FLIGHT_BODY;
+                        };
+      auto partition_lam = [=](Index_type i, Index_type num_active) {
+                             MC_TRANSPORT_EVENT_PARTITION_BODY;
+                           };
+      auto process_lam = [=](Index_type i, Index_type num_active) {
+                           MC_TRANSPORT_EVENT_PROCESS_BODY(RAJA::atomicAdd<RAJA::omp_atomic>);
+                         };
+      auto compact_lam = [=](Index_type i) {
+                           MC_TRANSPORT_EVENT_COMPACT_BODY;
+                         };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (tuning == s_history) {
+
+          #pragma omp parallel for
+          for (Index_type p = 0; p < num_particles; ++p ) {
+            history_lam(p);
+          }
+
+        } else {
+
+          #pragma omp parallel for
+          for (Index_type p = 0; p < num_particles; ++p ) {
+            init_lam(p);
+          }
+
+          Index_type num_active = num_particles;
+          while (num_active > 0) {
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < num_active; ++i ) {
+              flight_lam(i);
+            }
+
+            mcExclusiveScanOMP(counts, num_active+1, thread_counts);
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < num_active; ++i ) {
+              partition_lam(i, num_active);
+            }
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < num_active; ++i ) {
+              process_lam(i, num_active);
+            }
+
+            mcExclusiveScanOMP(alive, num_active+1, thread_counts);
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < num_active; ++i ) {
+              compact_lam(i);
+            }
+
+            num_active = alive[num_active];
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (tuning == s_history) {
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, num_particles), [=](Index_type p) {
+            MC_TRANSPORT_HISTORY_BODY(RAJA::atomicAdd<RAJA::omp_atomic>);
+          });
+
+        } else {
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, num_particles), [=](Index_type p) {
+            MC_TRANSPORT_EVENT_INIT_BODY;
+          });
+
+          Index_type num_active = num_particles;
+          while (num_active > 0) {
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, num_active), [=](Index_type i) {
+              MC_TRANSPORT_EVENT_FLIGHT_BODY;
+            });
+
+            RAJA::exclusive_scan_inplace<RAJA::omp_parallel_for_exec>(
+                RAJA::make_span(counts, num_active+1));
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, num_active), [=](Index_type i) {
+              MC_TRANSPORT_EVENT_PARTITION_BODY;
+            });
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, num_active), [=](Index_type i) {
+              MC_TRANSPORT_EVENT_PROCESS_BODY(RAJA::atomicAdd<RAJA::omp_atomic>);
+            });
+
+            RAJA::exclusive_scan_inplace<RAJA::omp_parallel_for_exec>(
+                RAJA::make_span(alive, num_active+1));
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, num_active), [=](Index_type i) {
+              MC_TRANSPORT_EVENT_COMPACT_BODY;
+            });
+
+            num_active = alive[num_active];
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MC_TRANSPORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MC_TRANSPORT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(tunings_type{}, [&](auto tuning) {
+    if (tune_idx == tuning) {
+      runOpenMPVariantImpl<tuning>(vid);
+    }
+  });
+}
+
+void MC_TRANSPORT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,261 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MC_TRANSPORT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < size_t tuning >
+void MC_TRANSPORT::runSeqVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  MC_TRANSPORT_DATA_SETUP;
+  MC_TRANSPORT_EVENT_DATA_SETUP;
+
+  auto tally_add = [](Real_ptr ptr, Real_type val) { *ptr += val; };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (tuning == s_history) {
+
+          for (Index_type p = 0; p < num_particles; ++p ) {
+            MC_TRANSPORT_HISTORY_BODY(tally_add);
+          }
+
+        } else {
+
+          for (Index_type p = 0; p < num_particles; ++p ) {
+            MC_TRANSPORT_EVENT_INIT_BODY;
+          }
+
+          Index_type num_active = num_particles;
+          while (num_active > 0) {
+
+            for (Index_type i = 0; i < num_active; ++i ) {
+              MC_TRANSPORT_EVENT_FLIGHT_BODY;
+            }
+
+            Index_type count = 0;
+            for (Index_type i = 0; i < num_active+1; ++i ) {
+              Index_type inc = counts[i];
+              counts[i] = count;
+              count += inc;
+            }
+
+            for (Index_type i = 0; i < num_active; ++i ) {
+              MC_TRANSPORT_EVENT_PARTITION_BODY;
+            }
+
+            for (Index_type i = 0; i < num_active; ++i ) {
+              MC_TRANSPORT_EVENT_PROCESS_BODY(tally_add);
+            }
+
+            count = 0;
+            for (Index_type i = 0; i < num_active+1; ++i ) {
+              Index_type inc = alive[i];
+              alive[i] = count;
+              count += inc;
+            }
+
+            for (Index_type i = 0; i < num_active; ++i ) {
+              MC_TRANSPORT_EVENT_COMPACT_BODY;
+            }
+
+            num_active = alive[num_active];
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto history_lam = [=](Index_type p) {
+                           MC_TRANSPORT_HISTORY_BODY(tally_add);
+                         };
+      auto init_lam = [=](Index_type p) {
+                        MC_TRANSPORT_EVENT_INIT_BODY;
+                      };
+      auto flight_lam = [=](Index_type i) {
+                          MC_TRANSPORT_EVENT_FLIGHT_BODY;
+                        };
+      auto partition_lam = [=](Index_type i, Index_type num_active) {
+                             MC_TRANSPORT_EVENT_PARTITION_BODY;
+                           };
+      auto process_lam = [=](Index_type i, Index_type num_active) {
+                           MC_TRANSPORT_EVENT_PROCESS_BODY(tally_add);
+                         };
+      auto compact_lam = [=](Index_type i) {
+                           MC_TRANSPORT_EVENT_COMPACT_BODY;
+                         };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (tuning == s_history) {
+
+          for (Index_type p = 0; p < num_particles; ++p ) {
+            history_lam(p);
+          }
+
+        } else {
+
+          for (Index_type p = 0; p < num_particles; ++p ) {
+            init_lam(p);
+          }
+
+          Index_type num_active = num_particles;
+          while (num_active > 0) {
+
+            for (Index_type i = 0; i < num_active; ++i ) {
+              flight_lam(i);
+            }
+
+            Index_type count = 0;
+            for (Index_type i = 0; i < num_active+1; ++i ) {
+              Index_type inc = counts[i];
+              counts[i] = count;
+              count += inc;
+            }
+
+            for (Index_type i = 0; i < num_active; ++i ) {
+              partition_lam(i, num_active);
+            }
+
+            for (Index_type i = 0; i < num_active; ++i ) {
+              process_lam(i, num_active);
+            }
+
+            count = 0;
+            for (Index_type i = 0; i < num_active+1; ++i ) {
+              Index_type inc = alive[i];
+              alive[i] = count;
+              count += inc;
+            }
+
+            for (Index_type i = 0; i < num_active; ++i ) {
+              compact_lam(i);
+            }
+
+            num_active = alive[num_active];
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (tuning == s_history) {
+
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, num_particles), [=](Index_type p) {
+            MC_TRANSPORT_HISTORY_BODY(RAJA::atomicAdd<RAJA::seq_atomic>);
+          });
+
+        } else {
+
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, num_particles), [=](Index_type p) {
+            MC_TRANSPORT_EVENT_INIT_BODY;
+          });
+
+          Index_type num_active = num_particles;
+          while (num_active > 0) {
+
+            RAJA::forall<RAJA::seq_exec>(
+              RAJA::RangeSegment(0, num_active), [=](Index_type i) {
+              MC_TRANSPORT_EVENT_FLIGHT_BODY;
+            });
+
+            RAJA::exclusive_scan_inplace<RAJA::seq_exec>(
+                RAJA::make_span(counts, num_active+1));
+
+            RAJA::forall<RAJA::seq_exec>(
+              RAJA::RangeSegment(0, num_active), [=](Index_type i) {
+              MC_TRANSPORT_EVENT_PARTITION_BODY;
+            });
+
+            RAJA::forall<RAJA::seq_exec>(
+              RAJA::RangeSegment(0, num_active), [=](Index_type i) {
+              MC_TRANSPORT_EVENT_PROCESS_BODY(RAJA::atomicAdd<RAJA::seq_atomic>);
+            });
+
+            RAJA::exclusive_scan_inplace<RAJA::seq_exec>(
+                RAJA::make_span(alive, num_active+1));
+
+            RAJA::forall<RAJA::seq_exec>(
+              RAJA::RangeSegment(0, num_active), [=](Index_type i) {
+              MC_TRANSPORT_EVENT_COMPACT_BODY;
+            });
+
+            num_active = alive[num_active];
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  MC_TRANSPORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void MC_TRANSPORT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(tunings_type{}, [&](auto tuning) {
+    if (tune_idx == tuning) {
+      runSeqVariantImpl<tuning>(vid);
+    }
+  });
+}
+
+void MC_TRANSPORT::setSeqTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
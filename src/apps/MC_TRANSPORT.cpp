@@ -0,0 +1,160 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MC_TRANSPORT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+MC_TRANSPORT::MC_TRANSPORT(const RunParams& params)
+  : KernelBase(rajaperf::Apps_MC_TRANSPORT, params)
+{
+  setDefaultProblemSize(100000);
+  setDefaultReps(20);
+
+  m_num_cells = getKernelParam("cells", 100);
+  m_events = getKernelParam("events", 10);
+  m_p_absorb = 1.0 / m_events;
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  // flight and collision, counting the log as one FLOP
+  setFLOPsPerRep(12 * m_events * getActualProblemSize());
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Scan);
+  setUsesFeature(Atomic);
+
+  setHasPattern(GatherScatter);
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+MC_TRANSPORT::~MC_TRANSPORT()
+{
+}
+
+const std::vector<std::string>& MC_TRANSPORT::getTuningNames()
+{
+  static const std::vector<std::string> names{"history", "event"};
+  return names;
+}
+
+//
+// Tunings before setting up the kernel tunings, ie. in the constructor, and
+// default tunings are history.
+//
+size_t MC_TRANSPORT::getTuning(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx < getNumVariantTunings(vid)) {
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+    const std::vector<std::string>& names = getTuningNames();
+    for (size_t t = 0; t < names.size(); ++t) {
+      if (tuning_name.compare(0, names[t].size(), names[t]) == 0) {
+        return t;
+      }
+    }
+  }
+  return s_history;
+}
+
+//
+// Particle state read and written by each of the expected collisions of a
+// history, crossings are not counted. The event tuning also reads and
+// writes the queues and counts of each step.
+//
+Index_type MC_TRANSPORT::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const Index_type state_bytes = 2*sizeof(Real_type) + 3*sizeof(Int_type);
+  Index_type step_bytes = 2*state_bytes + 2*sizeof(Real_type);
+  if (getTuning(vid, tune_idx) == s_event) {
+    step_bytes += 3*2*sizeof(Int_type) + 2*2*sizeof(Index_type);
+  }
+  return (1*state_bytes) * getActualProblemSize() +
+         step_bytes * m_events * getActualProblemSize() +
+         (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_num_cells;
+}
+
+void MC_TRANSPORT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type num_particles = getActualProblemSize();
+
+  allocAndInitDataConst(m_x, num_particles, 0.0, vid);
+  allocAndInitDataConst(m_mu, num_particles, 0.0, vid);
+  allocAndInitDataConst(m_cell, num_particles, 0, vid);
+  allocAndInitDataConst(m_nevents, num_particles, 0, vid);
+  allocAndInitDataConst(m_event, num_particles, Int_type(mc_dead), vid);
+  allocAndInitDataConst(m_tally, m_num_cells, 0.0, vid);
+
+  allocData(m_sigma_t, m_num_cells, vid);
+  {
+    auto reset_sigma_t = scopedMoveData(m_sigma_t, m_num_cells, vid);
+    for (Index_type c = 0; c < m_num_cells; ++c) {
+      m_sigma_t[c] = 0.5 + 1.5 * detail::counterRandValue(mc_sigma_seed, c);
+    }
+  }
+
+  allocAndInitDataConst(m_queue, num_particles, 0, vid);
+  allocAndInitDataConst(m_event_queue, num_particles, 0, vid);
+  allocAndInitDataConst(m_counts, num_particles+1, Index_type(0), vid);
+  allocAndInitDataConst(m_alive, num_particles+1, Index_type(0), vid);
+}
+
+void MC_TRANSPORT::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_tally, m_num_cells, checksum_scale_factor , vid);
+  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize(), checksum_scale_factor , vid);
+  checksum[vid][tune_idx] += calcChecksum(m_nevents, getActualProblemSize(), checksum_scale_factor , vid);
+}
+
+void MC_TRANSPORT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_x, vid);
+  deallocData(m_mu, vid);
+  deallocData(m_cell, vid);
+  deallocData(m_nevents, vid);
+  deallocData(m_event, vid);
+  deallocData(m_sigma_t, vid);
+  deallocData(m_tally, vid);
+
+  deallocData(m_queue, vid);
+  deallocData(m_event_queue, vid);
+  deallocData(m_counts, vid);
+  deallocData(m_alive, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
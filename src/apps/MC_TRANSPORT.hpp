@@ -0,0 +1,277 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MC_TRANSPORT kernel reference implementation:
+///
+/// Simplified Monte Carlo transport of num_particles particles in a 1D slab
+/// of num_cells unit cells with total cross section sigma_t[c] in cell c and
+/// reflecting boundaries. A particle alternates flights and events until it
+/// is absorbed,
+///
+/// for (Index_type p = 0; p < num_particles; ++p ) {
+///   init(p);          // x in [0, num_cells), mu in [-1, 1)
+///   do {
+///     flight(p);      // sample the distance to collision, -log(u)/sigma_t,
+///                     // and move to the collision or the cell boundary
+///     if (collision) {
+///       tally[cell] += 1.0;
+///       absorb with probability p_absorb, or scatter to a new mu
+///     } else {
+///       cross into the next cell or reflect at the slab boundary
+///     }
+///   } while (alive);
+/// }
+///
+/// with p_absorb = 1/events, so a history has events collisions on average.
+/// The random numbers of step n of particle p are counter based in n and p,
+/// so every tuning gives the same histories. Tunings are
+///
+///   history -- each particle is followed to its absorption in one loop
+///              iteration, ie. one thread per history
+///   event   -- all live particles do one flight, the queue of live
+///              particles is partitioned by their next event with an index
+///              list scan and the collisions and crossings are processed in
+///              that order, then the particles still alive are compacted
+///              into the next queue with a second scan, until none is alive
+///
+/// The number of particles is the problem size, the number of cells and the
+/// mean number of collisions per history are kernel parameters.
+///
+
+#ifndef RAJAPerf_Apps_MC_TRANSPORT_HPP
+#define RAJAPerf_Apps_MC_TRANSPORT_HPP
+
+#define MC_TRANSPORT_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr mu = m_mu; \
+  Int_ptr cell = m_cell; \
+  Int_ptr nevents = m_nevents; \
+  Int_ptr event = m_event; \
+  Real_ptr sigma_t = m_sigma_t; \
+  Real_ptr tally = m_tally; \
+\
+  const Index_type num_particles = getActualProblemSize(); \
+  const Index_type num_cells = m_num_cells; \
+  const Real_type p_absorb = m_p_absorb;
+
+//
+// Queues of the event tuning, the live particles and the live particles
+// ordered by their next event, and the index list counts of the two scans.
+//
+#define MC_TRANSPORT_EVENT_DATA_SETUP \
+  Int_ptr queue = m_queue; \
+  Int_ptr event_queue = m_event_queue; \
+  Index_type* counts = m_counts; \
+  Index_type* alive = m_alive;
+
+#define MC_TRANSPORT_INIT_BODY \
+  x[p] = num_cells * mcRand(mc_position_seed, 0, p, num_particles); \
+  cell[p] = (static_cast<Index_type>(x[p]) < num_cells) \
+          ? static_cast<Int_type>(x[p]) : static_cast<Int_type>(num_cells-1); \
+  mu[p] = 2.0 * mcRand(mc_init_direction_seed, 0, p, num_particles) - 1.0; \
+  nevents[p] = 0; \
+  event[p] = mc_cross;
+
+#define MC_TRANSPORT_FLIGHT_BODY \
+  const Int_type cf = cell[p]; \
+  const Real_type d_coll = \
+      -log(1.0 - mcRand(mc_flight_seed, nevents[p], p, num_particles)) / sigma_t[cf]; \
+  const Real_type d_bound = (mu[p] > 0.0) ? (cf + 1 - x[p]) / mu[p] \
+                          : (mu[p] < 0.0) ? (cf - x[p]) / mu[p] : 1.0e300; \
+  if (d_coll < d_bound) { \
+    x[p] += mu[p] * d_coll; \
+    event[p] = mc_collide; \
+  } else { \
+    event[p] = mc_cross; \
+  }
+
+#define MC_TRANSPORT_COLLIDE_BODY(atomic_add) \
+  atomic_add(&tally[cell[p]], 1.0); \
+  if (mcRand(mc_absorb_seed, nevents[p], p, num_particles) < p_absorb) { \
+    event[p] = mc_dead; \
+  } else { \
+    mu[p] = 2.0 * mcRand(mc_direction_seed, nevents[p], p, num_particles) - 1.0; \
+  } \
+  nevents[p] += 1;
+
+#define MC_TRANSPORT_CROSS_BODY \
+  const Int_type cx = cell[p]; \
+  if (mu[p] > 0.0) { \
+    x[p] = cx + 1; \
+    if (cx == num_cells-1) { \
+      mu[p] = -mu[p]; \
+    } else { \
+      cell[p] = cx + 1; \
+    } \
+  } else { \
+    x[p] = cx; \
+    if (cx == 0) { \
+      mu[p] = -mu[p]; \
+    } else { \
+      cell[p] = cx - 1; \
+    } \
+  } \
+  nevents[p] += 1;
+
+#define MC_TRANSPORT_HISTORY_BODY(atomic_add) \
+  MC_TRANSPORT_INIT_BODY; \
+  do { \
+    MC_TRANSPORT_FLIGHT_BODY; \
+    if (event[p] == mc_collide) { \
+      MC_TRANSPORT_COLLIDE_BODY(atomic_add); \
+    } else { \
+      MC_TRANSPORT_CROSS_BODY; \
+    } \
+  } while (event[p] != mc_dead);
+
+//
+// Steps of the event tuning for entry i of a queue of num_active particles.
+//
+#define MC_TRANSPORT_EVENT_INIT_BODY \
+  MC_TRANSPORT_INIT_BODY; \
+  queue[p] = p;
+
+#define MC_TRANSPORT_EVENT_FLIGHT_BODY \
+  const Index_type p = queue[i]; \
+  MC_TRANSPORT_FLIGHT_BODY; \
+  counts[i] = (event[p] == mc_collide) ? 1 : 0;
+
+// collisions first, then crossings, in queue order
+#define MC_TRANSPORT_EVENT_PARTITION_BODY \
+  if (counts[i] != counts[i+1]) { \
+    event_queue[counts[i]] = queue[i]; \
+  } else { \
+    event_queue[counts[num_active] + i - counts[i]] = queue[i]; \
+  }
+
+#define MC_TRANSPORT_EVENT_PROCESS_BODY(atomic_add) \
+  const Index_type p = event_queue[i]; \
+  if (i < counts[num_active]) { \
+    MC_TRANSPORT_COLLIDE_BODY(atomic_add); \
+  } else { \
+    MC_TRANSPORT_CROSS_BODY; \
+  } \
+  alive[i] = (event[p] != mc_dead) ? 1 : 0;
+
+#define MC_TRANSPORT_EVENT_COMPACT_BODY \
+  if (alive[i] != alive[i+1]) { \
+    queue[alive[i]] = event_queue[i]; \
+  }
+
+
+#include "common/KernelBase.hpp"
+#include "common/DataUtils.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+enum MCEvent : Int_type
+{
+  mc_dead = 0,
+  mc_collide,
+  mc_cross
+};
+
+constexpr unsigned long long mc_position_seed = 4051;
+constexpr unsigned long long mc_init_direction_seed = 4057;
+constexpr unsigned long long mc_flight_seed = 4073;
+constexpr unsigned long long mc_absorb_seed = 4079;
+constexpr unsigned long long mc_direction_seed = 4091;
+constexpr unsigned long long mc_sigma_seed = 4093;
+
+//
+// Random number of step n of particle p.
+//
+RAJA_HOST_DEVICE RAJA_INLINE Real_type mcRand(unsigned long long seed,
+                                              Int_type n, Index_type p,
+                                              Index_type num_particles)
+{
+  return detail::counterRandValue(seed,
+      static_cast<unsigned long long>(n) * num_particles + p);
+}
+
+class MC_TRANSPORT : public KernelBase
+{
+public:
+
+  MC_TRANSPORT(const RunParams& params);
+
+  ~MC_TRANSPORT();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MC_TRANSPORT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t tuning >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t tuning >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, size_t tuning, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, size_t tuning, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  //
+  // Tunings are numbered in the order of getTuningNames.
+  //
+  static const size_t s_history = 0;
+  static const size_t s_event = 1;
+  using tunings_type = camp::int_seq<size_t, 0, 1>;
+
+  static const std::vector<std::string>& getTuningNames();
+  size_t getTuning(VariantID vid, size_t tune_idx) const;
+
+  Index_type m_num_cells;
+  Index_type m_events;
+  Real_type m_p_absorb;
+
+  Real_ptr m_x;
+  Real_ptr m_mu;
+  Int_ptr m_cell;
+  Int_ptr m_nevents;
+  Int_ptr m_event;
+  Real_ptr m_sigma_t;
+  Real_ptr m_tally;
+
+  Int_ptr m_queue;
+  Int_ptr m_event_queue;
+  Index_type* m_counts;
+  Index_type* m_alive;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
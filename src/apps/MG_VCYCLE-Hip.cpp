@@ -0,0 +1,466 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MG_VCYCLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mg_residual(Real_ptr ul, Real_ptr fl, Real_ptr rl,
+                            Index_type n, Index_type N, Index_type npts,
+                            Real_type inv_h2, Real_type rscale)
+{
+   Index_type ii = blockIdx.x * block_size + threadIdx.x;
+   if (ii < npts) {
+     MG_RESIDUAL_BODY;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mg_smooth(Real_ptr ul, Real_ptr rl, Real_ptr dl,
+                          Index_type n, Index_type N, Index_type npts,
+                          bool chebyshev, Real_type c1, Real_type c2)
+{
+   Index_type ii = blockIdx.x * block_size + threadIdx.x;
+   if (ii < npts) {
+     MG_SMOOTH_BODY;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mg_restrict(Real_ptr rl, Real_ptr uc, Real_ptr fc,
+                            Index_type N, Index_type nc, Index_type Nc,
+                            Index_type npts_c)
+{
+   Index_type ii = blockIdx.x * block_size + threadIdx.x;
+   if (ii < npts_c) {
+     MG_RESTRICT_BODY;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mg_prolong(Real_ptr ul, Real_ptr uc,
+                           Index_type n, Index_type N, Index_type Nc,
+                           Index_type npts)
+{
+   Index_type ii = blockIdx.x * block_size + threadIdx.x;
+   if (ii < npts) {
+     MG_PROLONG_BODY;
+   }
+}
+
+//
+// Steps of a level done by one block, each loop is followed by a barrier
+// so the next one sees all of its results.
+//
+template < size_t block_size >
+__device__ void mg_block_smooth(Real_ptr u, Real_ptr f, Real_ptr r, Real_ptr d,
+                                Index_type n0, Index_type lbase, Index_type l,
+                                Index_type sweeps, bool chebyshev)
+{
+  MG_LEVEL_SETUP(l);
+  const Real_type rscale = 1.0 / (6.0 * inv_h2);
+  for (Index_type s = 0; s < sweeps; ++s) {
+    Real_type c1, c2;
+    mgSmootherCoefs(chebyshev, s, c1, c2);
+    for (Index_type ii = threadIdx.x; ii < npts; ii += block_size) {
+      MG_RESIDUAL_BODY;
+    }
+    __syncthreads();
+    for (Index_type ii = threadIdx.x; ii < npts; ii += block_size) {
+      MG_SMOOTH_BODY;
+    }
+    __syncthreads();
+  }
+}
+
+template < size_t block_size >
+__device__ void mg_block_restrict(Real_ptr u, Real_ptr f, Real_ptr r, Real_ptr d,
+                                  Index_type n0, Index_type lbase, Index_type l)
+{
+  MG_LEVEL_SETUP(l);
+  MG_COARSE_LEVEL_SETUP(l);
+  const Real_type rscale = 1.0;
+  for (Index_type ii = threadIdx.x; ii < npts; ii += block_size) {
+    MG_RESIDUAL_BODY;
+  }
+  __syncthreads();
+  for (Index_type ii = threadIdx.x; ii < npts_c; ii += block_size) {
+    MG_RESTRICT_BODY;
+  }
+  __syncthreads();
+}
+
+template < size_t block_size >
+__device__ void mg_block_prolong(Real_ptr u, Real_ptr f, Real_ptr r, Real_ptr d,
+                                 Index_type n0, Index_type lbase, Index_type l)
+{
+  MG_LEVEL_SETUP(l);
+  MG_COARSE_LEVEL_SETUP(l);
+  for (Index_type ii = threadIdx.x; ii < npts; ii += block_size) {
+    MG_PROLONG_BODY;
+  }
+  __syncthreads();
+}
+
+//
+// V-cycle on levels lbegin and coarser in a single block.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mg_vcycle_block(Real_ptr u, Real_ptr f, Real_ptr r, Real_ptr d,
+                                Index_type n0, Index_type lbegin,
+                                Index_type levels, Index_type sweeps,
+                                bool chebyshev)
+{
+  const Index_type lbase = 0;
+  for (Index_type l = lbegin; l < levels-1; ++l) {
+    mg_block_smooth<block_size>(u, f, r, d, n0, lbase, l, sweeps, chebyshev);
+    mg_block_restrict<block_size>(u, f, r, d, n0, lbase, l);
+  }
+  mg_block_smooth<block_size>(u, f, r, d, n0, lbase, levels-1, sweeps, chebyshev);
+  for (Index_type l = levels-2; l >= lbegin; --l) {
+    mg_block_prolong<block_size>(u, f, r, d, n0, lbase, l);
+    mg_block_smooth<block_size>(u, f, r, d, n0, lbase, l, sweeps, chebyshev);
+  }
+}
+
+
+template < size_t block_size, size_t agglomerate, bool launch >
+void MG_VCYCLE::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  MG_VCYCLE_DATA_SETUP;
+
+  const Index_type lbase = 0;
+  const Index_type levels = m_levels;
+  const Index_type lcoarse = (agglomerate == s_all_levels)
+                           ? m_levels-1 : m_agglomerate_level;
+  const bool level_timing = m_level_timing;
+
+  //
+  // Copy f of level l to the host after restriction, do the V-cycle of
+  // the coarse levels there, and copy u back for prolongation.
+  //
+  auto agglomerate_host = [&](Index_type l) {
+    const Index_type N = mgLevelSize(n0, l) + 2;
+    const Index_type loff = mgLevelOffset(n0, l);
+    hipErrchk( hipMemcpyAsync( m_host_f, f + loff, N*N*N*sizeof(Real_type),
+                               hipMemcpyDeviceToHost, res.get_stream() ) );
+    hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+    std::fill_n(m_host_u, N*N*N, 0.0);
+    runSeqVCycle(m_host_u, m_host_f, m_host_r, m_host_d, l, l, false);
+    hipErrchk( hipMemcpyAsync( u + loff, m_host_u, N*N*N*sizeof(Real_type),
+                               hipMemcpyHostToDevice, res.get_stream() ) );
+  };
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+
+    auto smooth = [&](Index_type l) {
+      MG_LEVEL_SETUP(l);
+      const Real_type rscale = 1.0 / (6.0 * inv_h2);
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(npts, block_size);
+      for (Index_type s = 0; s < sweeps; ++s) {
+        Real_type c1, c2;
+        mgSmootherCoefs(chebyshev, s, c1, c2);
+        hipLaunchKernelGGL((mg_residual<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           ul, fl, rl, n, N, npts, inv_h2, rscale);
+        hipErrchk( hipGetLastError() );
+        hipLaunchKernelGGL((mg_smooth<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           ul, rl, dl, n, N, npts, chebyshev, c1, c2);
+        hipErrchk( hipGetLastError() );
+      }
+    };
+
+    auto restrict_to = [&](Index_type l) {
+      MG_LEVEL_SETUP(l);
+      MG_COARSE_LEVEL_SETUP(l);
+      const Real_type rscale = 1.0;
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(npts, block_size);
+      hipLaunchKernelGGL((mg_residual<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         ul, fl, rl, n, N, npts, inv_h2, rscale);
+      hipErrchk( hipGetLastError() );
+      const size_t grid_size_c = RAJA_DIVIDE_CEILING_INT(npts_c, block_size);
+      hipLaunchKernelGGL((mg_restrict<block_size>), dim3(grid_size_c), dim3(block_size), shmem, res.get_stream(),
+                         rl, uc, fc, N, nc, Nc, npts_c);
+      hipErrchk( hipGetLastError() );
+    };
+
+    auto prolong = [&](Index_type l) {
+      MG_LEVEL_SETUP(l);
+      MG_COARSE_LEVEL_SETUP(l);
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(npts, block_size);
+      hipLaunchKernelGGL((mg_prolong<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         ul, uc, n, N, Nc, npts);
+      hipErrchk( hipGetLastError() );
+    };
+
+    auto coarse = [&](Index_type l) {
+      if (agglomerate == s_agglomerate_host) {
+        agglomerate_host(l);
+      } else if (agglomerate == s_agglomerate_block) {
+        hipLaunchKernelGGL((mg_vcycle_block<block_size>), dim3(1), dim3(block_size), shmem, res.get_stream(),
+                           u, f, r, d, n0, l, levels, sweeps, chebyshev);
+        hipErrchk( hipGetLastError() );
+      } else {
+        smooth(l);
+      }
+    };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      vCycle(0, lcoarse, level_timing,
+             smooth, restrict_to, prolong, coarse);
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    auto smooth = [&](Index_type l) {
+      MG_LEVEL_SETUP(l);
+      const Real_type rscale = 1.0 / (6.0 * inv_h2);
+      for (Index_type s = 0; s < sweeps; ++s) {
+        Real_type c1, c2;
+        mgSmootherCoefs(chebyshev, s, c1, c2);
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, npts), [=] __device__ (Index_type ii) {
+          MG_RESIDUAL_BODY;
+        });
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, npts), [=] __device__ (Index_type ii) {
+          MG_SMOOTH_BODY;
+        });
+      }
+    };
+
+    auto restrict_to = [&](Index_type l) {
+      MG_LEVEL_SETUP(l);
+      MG_COARSE_LEVEL_SETUP(l);
+      const Real_type rscale = 1.0;
+      gpu_launch::forall< block_size, launch >( res,
+        RAJA::RangeSegment(0, npts), [=] __device__ (Index_type ii) {
+        MG_RESIDUAL_BODY;
+      });
+      gpu_launch::forall< block_size, launch >( res,
+        RAJA::RangeSegment(0, npts_c), [=] __device__ (Index_type ii) {
+        MG_RESTRICT_BODY;
+      });
+    };
+
+    auto prolong = [&](Index_type l) {
+      MG_LEVEL_SETUP(l);
+      MG_COARSE_LEVEL_SETUP(l);
+      gpu_launch::forall< block_size, launch >( res,
+        RAJA::RangeSegment(0, npts), [=] __device__ (Index_type ii) {
+        MG_PROLONG_BODY;
+      });
+    };
+
+    using launch_policy = RAJA::LaunchPolicy<RAJA::hip_launch_t<true /*async*/, block_size>>;
+
+    using block_loop = RAJA::LoopPolicy<RAJA::hip_thread_size_x_loop<block_size>>;
+
+    auto coarse = [&](Index_type lbegin) {
+      if (agglomerate == s_agglomerate_host) {
+        agglomerate_host(lbegin);
+      } else if (agglomerate == s_agglomerate_block) {
+        RAJA::launch<launch_policy>( res,
+          RAJA::LaunchParams(RAJA::Teams(1),
+                             RAJA::Threads(block_size)),
+          [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+            auto block_smooth = [&](Index_type l) {
+              MG_LEVEL_SETUP(l);
+              const Real_type rscale = 1.0 / (6.0 * inv_h2);
+              for (Index_type s = 0; s < sweeps; ++s) {
+                Real_type c1, c2;
+                mgSmootherCoefs(chebyshev, s, c1, c2);
+                RAJA::loop<block_loop>(ctx, RAJA::RangeSegment(0, npts),
+                  [&](Index_type ii) {
+                    MG_RESIDUAL_BODY;
+                  }
+                );
+                ctx.teamSync();
+                RAJA::loop<block_loop>(ctx, RAJA::RangeSegment(0, npts),
+                  [&](Index_type ii) {
+                    MG_SMOOTH_BODY;
+                  }
+                );
+                ctx.teamSync();
+              }
+            };
+
+            for (Index_type l = lbegin; l < levels-1; ++l) {
+              block_smooth(l);
+              MG_LEVEL_SETUP(l);
+              MG_COARSE_LEVEL_SETUP(l);
+              const Real_type rscale = 1.0;
+              RAJA::loop<block_loop>(ctx, RAJA::RangeSegment(0, npts),
+                [&](Index_type ii) {
+                  MG_RESIDUAL_BODY;
+                }
+              );
+              ctx.teamSync();
+              RAJA::loop<block_loop>(ctx, RAJA::RangeSegment(0, npts_c),
+                [&](Index_type ii) {
+                  MG_RESTRICT_BODY;
+                }
+              );
+              ctx.teamSync();
+            }
+            block_smooth(levels-1);
+            for (Index_type l = levels-2; l >= lbegin; --l) {
+              MG_LEVEL_SETUP(l);
+              MG_COARSE_LEVEL_SETUP(l);
+              RAJA::loop<block_loop>(ctx, RAJA::RangeSegment(0, npts),
+                [&](Index_type ii) {
+                  MG_PROLONG_BODY;
+                }
+              );
+              ctx.teamSync();
+              block_smooth(l);
+            }
+
+          }
+        );  // RAJA::launch
+      } else {
+        smooth(lbegin);
+      }
+    };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      vCycle(0, lcoarse, level_timing,
+             smooth, restrict_to, prolong, coarse);
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  MG_VCYCLE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+
+void MG_VCYCLE::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    seq_for(gpu_agglomerate_tunings_type{}, [&](auto agglomerate) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantImpl<block_size, decltype(agglomerate)::value>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    });
+
+  } else {
+
+    getCout() << "\n  MG_VCYCLE : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runHipVariantImpl<block_size, s_all_levels, true>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+}
+
+void MG_VCYCLE::setHipTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    seq_for(gpu_agglomerate_tunings_type{}, [&](auto agglomerate) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, getAgglomerateTuningNames()[agglomerate]+
+                                    "_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    });
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
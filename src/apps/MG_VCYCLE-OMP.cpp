@@ -0,0 +1,192 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MG_VCYCLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < size_t agglomerate >
+void MG_VCYCLE::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  MG_VCYCLE_DATA_SETUP;
+
+  const Index_type lbase = 0;
+  const Index_type lcoarse = (agglomerate == s_agglomerate_host)
+                           ? m_agglomerate_level : m_levels-1;
+  const bool level_timing = m_level_timing;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      auto smooth = [&](Index_type l) {
+        MG_LEVEL_SETUP(l);
+        const Real_type rscale = 1.0 / (6.0 * inv_h2);
+        for (Index_type s = 0; s < sweeps; ++s) {
+          Real_type c1, c2;
+          mgSmootherCoefs(chebyshev, s, c1, c2);
+          #pragma omp parallel for
+          for (Index_type ii = 0; ii < npts; ++ii ) {
+            MG_RESIDUAL_BODY;
+          }
+          #pragma omp parallel for
+          for (Index_type ii = 0; ii < npts; ++ii ) {
+            MG_SMOOTH_BODY;
+          }
+        }
+      };
+
+      auto restrict_to = [&](Index_type l) {
+        MG_LEVEL_SETUP(l);
+        MG_COARSE_LEVEL_SETUP(l);
+        const Real_type rscale = 1.0;
+        #pragma omp parallel for
+        for (Index_type ii = 0; ii < npts; ++ii ) {
+          MG_RESIDUAL_BODY;
+        }
+        #pragma omp parallel for
+        for (Index_type ii = 0; ii < npts_c; ++ii ) {
+          MG_RESTRICT_BODY;
+        }
+      };
+
+      auto prolong = [&](Index_type l) {
+        MG_LEVEL_SETUP(l);
+        MG_COARSE_LEVEL_SETUP(l);
+        #pragma omp parallel for
+        for (Index_type ii = 0; ii < npts; ++ii ) {
+          MG_PROLONG_BODY;
+        }
+      };
+
+      auto coarse = [&](Index_type l) {
+        if (agglomerate == s_agglomerate_host) {
+          runSeqVCycle(u, f, r, d, lbase, l, false);
+        } else {
+          smooth(l);
+        }
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        vCycle(0, lcoarse, level_timing,
+               smooth, restrict_to, prolong, coarse);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto smooth = [&](Index_type l) {
+        MG_LEVEL_SETUP(l);
+        const Real_type rscale = 1.0 / (6.0 * inv_h2);
+        for (Index_type s = 0; s < sweeps; ++s) {
+          Real_type c1, c2;
+          mgSmootherCoefs(chebyshev, s, c1, c2);
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, npts), [=](Index_type ii) {
+            MG_RESIDUAL_BODY;
+          });
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, npts), [=](Index_type ii) {
+            MG_SMOOTH_BODY;
+          });
+        }
+      };
+
+      auto restrict_to = [&](Index_type l) {
+        MG_LEVEL_SETUP(l);
+        MG_COARSE_LEVEL_SETUP(l);
+        const Real_type rscale = 1.0;
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, npts), [=](Index_type ii) {
+          MG_RESIDUAL_BODY;
+        });
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, npts_c), [=](Index_type ii) {
+          MG_RESTRICT_BODY;
+        });
+      };
+
+      auto prolong = [&](Index_type l) {
+        MG_LEVEL_SETUP(l);
+        MG_COARSE_LEVEL_SETUP(l);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, npts), [=](Index_type ii) {
+          MG_PROLONG_BODY;
+        });
+      };
+
+      auto coarse = [&](Index_type l) {
+        if (agglomerate == s_agglomerate_host) {
+          runSeqVCycle(u, f, r, d, lbase, l, false);
+        } else {
+          smooth(l);
+        }
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        vCycle(0, lcoarse, level_timing,
+               smooth, restrict_to, prolong, coarse);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MG_VCYCLE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MG_VCYCLE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(host_agglomerate_tunings_type{}, [&](auto agglomerate) {
+    if (tune_idx == agglomerate) {
+      runOpenMPVariantImpl<agglomerate>(vid);
+    }
+  });
+}
+
+//
+// The host agglomerated levels run serially on the calling thread.
+//
+void MG_VCYCLE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  seq_for(host_agglomerate_tunings_type{}, [&](auto agglomerate) {
+    addVariantTuningName(vid, getAgglomerateTuningNames()[agglomerate]);
+  });
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MG_VCYCLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void MG_VCYCLE::runSeqVCycle(Real_ptr u, Real_ptr f, Real_ptr r, Real_ptr d,
+                             Index_type lbase, Index_type lbegin,
+                             bool level_timing)
+{
+  const Index_type n0 = m_n;
+  const Index_type sweeps = m_sweeps;
+  const bool chebyshev = m_chebyshev;
+
+  auto smooth = [&](Index_type l) {
+    MG_LEVEL_SETUP(l);
+    const Real_type rscale = 1.0 / (6.0 * inv_h2);
+    for (Index_type s = 0; s < sweeps; ++s) {
+      Real_type c1, c2;
+      mgSmootherCoefs(chebyshev, s, c1, c2);
+      for (Index_type ii = 0; ii < npts; ++ii ) {
+        MG_RESIDUAL_BODY;
+      }
+      for (Index_type ii = 0; ii < npts; ++ii ) {
+        MG_SMOOTH_BODY;
+      }
+    }
+  };
+
+  auto restrict_to = [&](Index_type l) {
+    MG_LEVEL_SETUP(l);
+    MG_COARSE_LEVEL_SETUP(l);
+    const Real_type rscale = 1.0;
+    for (Index_type ii = 0; ii < npts; ++ii ) {
+      MG_RESIDUAL_BODY;
+    }
+    for (Index_type ii = 0; ii < npts_c; ++ii ) {
+      MG_RESTRICT_BODY;
+    }
+  };
+
+  auto prolong = [&](Index_type l) {
+    MG_LEVEL_SETUP(l);
+    MG_COARSE_LEVEL_SETUP(l);
+    for (Index_type ii = 0; ii < npts; ++ii ) {
+      MG_PROLONG_BODY;
+    }
+  };
+
+  vCycle(lbegin, m_levels-1, level_timing,
+         smooth, restrict_to, prolong, smooth);
+}
+
+void MG_VCYCLE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  MG_VCYCLE_DATA_SETUP;
+
+  const Index_type lbase = 0;
+  const Index_type levels = m_levels;
+  const bool level_timing = m_level_timing;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        runSeqVCycle(u, f, r, d, lbase, 0, level_timing);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto smooth = [&](Index_type l) {
+        MG_LEVEL_SETUP(l);
+        const Real_type rscale = 1.0 / (6.0 * inv_h2);
+        for (Index_type s = 0; s < sweeps; ++s) {
+          Real_type c1, c2;
+          mgSmootherCoefs(chebyshev, s, c1, c2);
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, npts), [=](Index_type ii) {
+            MG_RESIDUAL_BODY;
+          });
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, npts), [=](Index_type ii) {
+            MG_SMOOTH_BODY;
+          });
+        }
+      };
+
+      auto restrict_to = [&](Index_type l) {
+        MG_LEVEL_SETUP(l);
+        MG_COARSE_LEVEL_SETUP(l);
+        const Real_type rscale = 1.0;
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, npts), [=](Index_type ii) {
+          MG_RESIDUAL_BODY;
+        });
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, npts_c), [=](Index_type ii) {
+          MG_RESTRICT_BODY;
+        });
+      };
+
+      auto prolong = [&](Index_type l) {
+        MG_LEVEL_SETUP(l);
+        MG_COARSE_LEVEL_SETUP(l);
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, npts), [=](Index_type ii) {
+          MG_PROLONG_BODY;
+        });
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        vCycle(0, levels-1, level_timing,
+               smooth, restrict_to, prolong, smooth);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  MG_VCYCLE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,232 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MG_VCYCLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+MG_VCYCLE::MG_VCYCLE(const RunParams& params)
+  : KernelBase(rajaperf::Apps_MG_VCYCLE, params)
+{
+  Index_type n_default = 127;
+
+  setDefaultProblemSize(n_default*n_default*n_default);
+  setDefaultReps(20);
+
+  m_chebyshev = getKernelParam("smoother", 0, {0, 1}) == 1;
+  m_sweeps = getKernelParam("sweeps", 2, 1, 16);
+  m_coarse_points = getKernelParam("coarse_points", 4096);
+  m_level_timing = getKernelParam("level_timing", 1, {0, 1}) == 1;
+
+  // n + 1 is the power of two closest to that of the target size
+  const Real_type target_n = std::cbrt(static_cast<Real_type>(getTargetProblemSize()));
+  m_levels = std::max(Index_type(1),
+                      static_cast<Index_type>(std::log2(target_n + 1.0) + 0.5));
+  m_n = (Index_type(1) << m_levels) - 1;
+
+  m_agglomerate_level = 0;
+  while (m_agglomerate_level < m_levels-1) {
+    const Index_type n = mgLevelSize(m_n, m_agglomerate_level);
+    if (n*n*n <= m_coarse_points) {
+      break;
+    }
+    m_agglomerate_level += 1;
+  }
+
+  m_total_size = mgLevelOffset(m_n, m_levels);
+
+  setActualProblemSize( m_n*m_n*m_n );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep( (m_levels-1)*(4*m_sweeps + 3) + 2*m_sweeps );
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  setFLOPsPerRep( getFLOPsPerRep(Base_Seq, 0) );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  if (m_level_timing) {
+    std::vector<std::string> level_names;
+    for (Index_type l = 0; l < m_levels; ++l) {
+      level_names.emplace_back("level_" + std::to_string(l));
+    }
+    setPhaseNames(level_names);
+  }
+
+  setUsesFeature(Forall);
+
+  setHasPattern(Stencil);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+MG_VCYCLE::~MG_VCYCLE()
+{
+}
+
+const std::vector<std::string>& MG_VCYCLE::getAgglomerateTuningNames()
+{
+  static const std::vector<std::string> names{
+      "all_levels", "agglomerate_host", "agglomerate_block"};
+  return names;
+}
+
+//
+// Tunings before setting up the kernel tunings, ie. in the constructor, and
+// default tunings are all_levels.
+//
+size_t MG_VCYCLE::getAgglomerateTuning(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx < getNumVariantTunings(vid)) {
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+    const std::vector<std::string>& names = getAgglomerateTuningNames();
+    for (size_t a = 0; a < names.size(); ++a) {
+      if (tuning_name.compare(0, names[a].size(), names[a]) == 0) {
+        return a;
+      }
+    }
+  }
+  return s_all_levels;
+}
+
+//
+// Sum over levels of the arrays read and written by each loop, the same
+// for all tunings apart from the copies to and from the host of the GPU
+// agglomerate_host tunings.
+//
+Index_type MG_VCYCLE::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const Index_type sweep_rw = m_chebyshev ? (3 + 5) : (3 + 3);
+
+  Index_type bytes = 0;
+  for (Index_type l = 0; l < m_levels; ++l) {
+    const Index_type n = mgLevelSize(m_n, l);
+    const Index_type pts = n*n*n;
+    const Index_type smooths = (l < m_levels-1) ? 2 : 1;
+    bytes += smooths * m_sweeps * sweep_rw * sizeof(Real_type) * pts;
+    if (l < m_levels-1) {
+      const Index_type nc = mgLevelSize(m_n, l+1);
+      const Index_type pts_c = nc*nc*nc;
+      bytes += (1*sizeof(Real_type) + 2*sizeof(Real_type)) * pts +     // residual
+               (2*sizeof(Real_type) + 0*sizeof(Real_type)) * pts_c +   // restrict
+               (0*sizeof(Real_type) + 1*sizeof(Real_type)) * pts +
+               (1*sizeof(Real_type) + 2*sizeof(Real_type)) * pts;      // prolong
+    }
+  }
+  if (isVariantGPU(vid) &&
+      getAgglomerateTuning(vid, tune_idx) == s_agglomerate_host) {
+    const Index_type nc = mgLevelSize(m_n, m_agglomerate_level);
+    bytes += 2*sizeof(Real_type) * nc*nc*nc;
+  }
+  return bytes;
+}
+
+Index_type MG_VCYCLE::getFLOPsPerRep(VariantID RAJAPERF_UNUSED_ARG(vid),
+                                     size_t RAJAPERF_UNUSED_ARG(tune_idx)) const
+{
+  const Index_type sweep_flops = 10 + (m_chebyshev ? 4 : 2);
+
+  Index_type flops = 0;
+  for (Index_type l = 0; l < m_levels; ++l) {
+    const Index_type n = mgLevelSize(m_n, l);
+    const Index_type pts = n*n*n;
+    const Index_type smooths = (l < m_levels-1) ? 2 : 1;
+    flops += smooths * m_sweeps * sweep_flops * pts;
+    if (l < m_levels-1) {
+      const Index_type nc = mgLevelSize(m_n, l+1);
+      flops += 10 * pts + 55 * nc*nc*nc + 10 * pts;
+    }
+  }
+  return flops;
+}
+
+void MG_VCYCLE::setUp(VariantID vid, size_t tune_idx)
+{
+  allocAndInitDataConst(m_u, m_total_size, 0.0, vid);
+  allocAndInitDataConst(m_f, m_total_size, 0.0, vid);
+  allocAndInitDataConst(m_r, m_total_size, 0.0, vid);
+  allocAndInitDataConst(m_d, m_total_size, 0.0, vid);
+
+  // f = 1 on the finest interior points
+  {
+    auto reset_f = scopedMoveData(m_f, m_total_size, vid);
+    const Index_type n = m_n;
+    const Index_type N = n + 2;
+    for (Index_type ii = 0; ii < n*n*n; ++ii) {
+      MG_POINT;
+      m_f[c] = 1.0;
+    }
+  }
+
+  m_host_u = nullptr;
+  m_host_f = nullptr;
+  m_host_r = nullptr;
+  m_host_d = nullptr;
+
+  if (isVariantGPU(vid) &&
+      getAgglomerateTuning(vid, tune_idx) == s_agglomerate_host) {
+    const DataSpace host_space = getHostAccessibleDataSpace(vid);
+    const Index_type len = m_total_size - mgLevelOffset(m_n, m_agglomerate_level);
+    allocData(host_space, m_host_u, len);
+    allocData(host_space, m_host_f, len);
+    allocData(host_space, m_host_r, len);
+    allocData(host_space, m_host_d, len);
+    std::fill_n(m_host_u, len, 0.0);
+    std::fill_n(m_host_f, len, 0.0);
+    std::fill_n(m_host_r, len, 0.0);
+    std::fill_n(m_host_d, len, 0.0);
+  }
+}
+
+void MG_VCYCLE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const Index_type N = m_n + 2;
+  checksum[vid][tune_idx] += calcChecksum(m_u, N*N*N, checksum_scale_factor , vid);
+}
+
+void MG_VCYCLE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_u, vid);
+  deallocData(m_f, vid);
+  deallocData(m_r, vid);
+  deallocData(m_d, vid);
+
+  if (m_host_u) {
+    const DataSpace host_space = getHostAccessibleDataSpace(vid);
+    deallocData(host_space, m_host_u);
+    deallocData(host_space, m_host_f);
+    deallocData(host_space, m_host_r);
+    deallocData(host_space, m_host_d);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,336 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MG_VCYCLE kernel reference implementation:
+///
+/// One geometric multigrid V-cycle per rep for the 7 point Laplacian on a
+/// hierarchy of 3D grids, the finest with n = 2^levels - 1 interior points
+/// per dimension and each coarser level with (n-1)/2, down to one point.
+/// Grids have a boundary layer of zeros.
+///
+/// for (Index_type l = 0; l < levels-1; ++l ) {
+///   smooth(l);      // sweeps of the smoother on u_l
+///   restrict(l);    // f_{l+1} = full weighting of f_l - A_l*u_l, u_{l+1} = 0
+/// }
+/// smooth(levels-1);
+/// for (Index_type l = levels-2; l >= 0; --l ) {
+///   prolong(l);     // u_l += trilinear interpolation of u_{l+1}
+///   smooth(l);
+/// }
+///
+/// Each sweep computes r = D^-1 (f - A*u) and then updates u with
+///
+///   weighted Jacobi -- u += omega*r, omega = 6/7
+///   Chebyshev       -- d = c1*d + c2*r, u += d, with the coefficients of
+///                      the Chebyshev polynomial of degree sweeps for the
+///                      eigenvalues of D^-1 A in [lambda_max/4, lambda_max]
+///
+/// Coarse levels are a few points, so most of the kernels of a V-cycle are
+/// bound by launch and synchronization latency. Tunings of the parallel
+/// variants run all levels on the device or agglomerate the levels with at
+/// most coarse_points points,
+///
+///   agglomerate_host   -- on the host, copying f to the host after
+///                         restriction and u back before prolongation
+///   agglomerate_block  -- in one kernel of a single GPU block
+///
+/// The work on each level is timed in a level phase, agglomerated levels are
+/// timed together in the phase of the finest of them. The smoother, sweeps,
+/// and agglomeration threshold are kernel parameters.
+///
+
+#ifndef RAJAPerf_Apps_MG_VCYCLE_HPP
+#define RAJAPerf_Apps_MG_VCYCLE_HPP
+
+#define MG_VCYCLE_DATA_SETUP \
+  Real_ptr u = m_u; \
+  Real_ptr f = m_f; \
+  Real_ptr r = m_r; \
+  Real_ptr d = m_d; \
+\
+  const Index_type n0 = m_n; \
+  const Index_type sweeps = m_sweeps; \
+  const bool chebyshev = m_chebyshev;
+
+//
+// Grid of level l, the arrays of level l start at Real_ptr base plus
+// mgLevelOffset(n0, l) - mgLevelOffset(n0, lbase). Grid point ii of the
+// n^3 interior points is c in the N^3 array with the boundary.
+//
+#define MG_LEVEL_SETUP(l) \
+  const Index_type n = mgLevelSize(n0, (l)); \
+  const Index_type N = n + 2; \
+  const Index_type npts = n*n*n; \
+  const Real_type inv_h2 = mgLevelInvH2((l)); \
+  const Index_type loff = mgLevelOffset(n0, (l)) - mgLevelOffset(n0, lbase); \
+  Real_ptr ul = u + loff; \
+  Real_ptr fl = f + loff; \
+  Real_ptr rl = r + loff; \
+  Real_ptr dl = d + loff; \
+  RAJA_UNUSED_VAR(npts); \
+  RAJA_UNUSED_VAR(inv_h2); \
+  RAJA_UNUSED_VAR(fl); \
+  RAJA_UNUSED_VAR(rl); \
+  RAJA_UNUSED_VAR(dl);
+
+//
+// Coarse grid of level l+1 for restriction and prolongation.
+//
+#define MG_COARSE_LEVEL_SETUP(l) \
+  const Index_type nc = mgLevelSize(n0, (l)+1); \
+  const Index_type Nc = nc + 2; \
+  const Index_type npts_c = nc*nc*nc; \
+  const Index_type loff_c = mgLevelOffset(n0, (l)+1) - mgLevelOffset(n0, lbase); \
+  Real_ptr uc = u + loff_c; \
+  Real_ptr fc = f + loff_c; \
+  RAJA_UNUSED_VAR(npts_c); \
+  RAJA_UNUSED_VAR(fc);
+
+#define MG_POINT \
+  const Index_type c = (ii % n + 1) + N*((ii / n) % n + 1) + N*N*(ii / (n*n) + 1);
+
+#define MG_RESIDUAL_BODY \
+  MG_POINT \
+  rl[c] = rscale * (fl[c] - inv_h2 * (6.0*ul[c] - ul[c-1] - ul[c+1] \
+                                       - ul[c-N] - ul[c+N] \
+                                       - ul[c-N*N] - ul[c+N*N]));
+
+#define MG_SMOOTH_BODY \
+  MG_POINT \
+  if (chebyshev) { \
+    dl[c] = c1 * dl[c] + c2 * rl[c]; \
+    ul[c] += dl[c]; \
+  } else { \
+    ul[c] += c2 * rl[c]; \
+  }
+
+//
+// Full weighting of the residual of level l into coarse point ii, with
+// weights (2-|di|)(2-|dj|)(2-|dk|)/64 of the 27 fine points around it.
+//
+#define MG_RESTRICT_BODY \
+  const Index_type ic = ii % nc + 1; \
+  const Index_type jc = (ii / nc) % nc + 1; \
+  const Index_type kc = ii / (nc*nc) + 1; \
+  const Index_type cc = ic + Nc*(jc + Nc*kc); \
+  const Index_type cf = 2*ic + N*(2*jc + N*2*kc); \
+  Real_type sum = 0.0; \
+  for (Index_type dk = -1; dk <= 1; ++dk) { \
+    for (Index_type dj = -1; dj <= 1; ++dj) { \
+      for (Index_type di = -1; di <= 1; ++di) { \
+        const Real_type wt = (dk == 0 ? 2.0 : 1.0) * (dj == 0 ? 2.0 : 1.0) * \
+                             (di == 0 ? 2.0 : 1.0); \
+        sum += wt * rl[cf + di + N*(dj + N*dk)]; \
+      } \
+    } \
+  } \
+  fc[cc] = sum * (1.0/64.0); \
+  uc[cc] = 0.0;
+
+//
+// Trilinear interpolation into fine point ii of level l, the average of the
+// coarse points i/2 and (i+1)/2 in each dimension, which are the same
+// point for even i.
+//
+#define MG_PROLONG_BODY \
+  MG_POINT \
+  const Index_type i0 = (ii % n + 1) / 2; \
+  const Index_type j0 = ((ii / n) % n + 1) / 2; \
+  const Index_type k0 = (ii / (n*n) + 1) / 2; \
+  const Index_type i1 = (ii % n + 2) / 2; \
+  const Index_type j1 = ((ii / n) % n + 2) / 2; \
+  const Index_type k1 = (ii / (n*n) + 2) / 2; \
+  ul[c] += 0.125 * (uc[i0 + Nc*(j0 + Nc*k0)] + uc[i1 + Nc*(j0 + Nc*k0)] + \
+                    uc[i0 + Nc*(j1 + Nc*k0)] + uc[i1 + Nc*(j1 + Nc*k0)] + \
+                    uc[i0 + Nc*(j0 + Nc*k1)] + uc[i1 + Nc*(j0 + Nc*k1)] + \
+                    uc[i0 + Nc*(j1 + Nc*k1)] + uc[i1 + Nc*(j1 + Nc*k1)]);
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+//
+// Interior points per dimension of level l of a hierarchy with n0
+// points on the finest level.
+//
+RAJA_HOST_DEVICE RAJA_INLINE Index_type mgLevelSize(Index_type n0, Index_type l)
+{
+  return ((n0 + 1) >> l) - 1;
+}
+
+//
+// Offset of the arrays of level l in arrays holding all levels.
+//
+RAJA_HOST_DEVICE RAJA_INLINE Index_type mgLevelOffset(Index_type n0, Index_type l)
+{
+  Index_type off = 0;
+  for (Index_type m = 0; m < l; ++m) {
+    const Index_type N = mgLevelSize(n0, m) + 2;
+    off += N*N*N;
+  }
+  return off;
+}
+
+//
+// 1/h^2 of level l with h = 1 on the finest level.
+//
+RAJA_HOST_DEVICE RAJA_INLINE Real_type mgLevelInvH2(Index_type l)
+{
+  return 1.0 / static_cast<Real_type>(Index_type(1) << (2*l));
+}
+
+//
+// Update coefficients of sweep s of the smoother, weighted Jacobi or the
+// Chebyshev iteration of Saad, Iterative Methods for Sparse Linear Systems,
+// Algorithm 12.1, for eigenvalues of D^-1 A in [1/2, 2].
+//
+RAJA_HOST_DEVICE RAJA_INLINE void mgSmootherCoefs(bool chebyshev, Index_type s,
+                                                  Real_type& c1, Real_type& c2)
+{
+  if (!chebyshev) {
+    c1 = 0.0;
+    c2 = 6.0 / 7.0;
+    return;
+  }
+  constexpr Real_type hi = 2.0;
+  constexpr Real_type lo = hi / 4.0;
+  constexpr Real_type theta = 0.5 * (hi + lo);
+  constexpr Real_type delta = 0.5 * (hi - lo);
+  constexpr Real_type sigma = theta / delta;
+  Real_type rho = 1.0 / sigma;
+  c1 = 0.0;
+  c2 = 1.0 / theta;
+  for (Index_type k = 1; k <= s; ++k) {
+    const Real_type rho_new = 1.0 / (2.0*sigma - rho);
+    c1 = rho_new * rho;
+    c2 = 2.0 * rho_new / delta;
+    rho = rho_new;
+  }
+}
+
+class MG_VCYCLE : public KernelBase
+{
+public:
+
+  MG_VCYCLE(const RunParams& params);
+
+  ~MG_VCYCLE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+  Index_type getFLOPsPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MG_VCYCLE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t agglomerate >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, size_t agglomerate, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, size_t agglomerate, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+
+  //
+  // V-cycle with the host loops of the Base_Seq variant on levels lbegin
+  // and coarser, with arrays starting at level lbase.
+  //
+  void runSeqVCycle(Real_ptr u, Real_ptr f, Real_ptr r, Real_ptr d,
+                    Index_type lbase, Index_type lbegin, bool level_timing);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  //
+  // Agglomeration tunings are numbered in the order of
+  // getAgglomerateTuningNames, the host tunings have the first two.
+  //
+  static const size_t s_all_levels = 0;
+  static const size_t s_agglomerate_host = 1;
+  static const size_t s_agglomerate_block = 2;
+  using host_agglomerate_tunings_type = camp::int_seq<size_t, 0, 1>;
+  using gpu_agglomerate_tunings_type = camp::int_seq<size_t, 0, 1, 2>;
+
+  static const std::vector<std::string>& getAgglomerateTuningNames();
+  size_t getAgglomerateTuning(VariantID vid, size_t tune_idx) const;
+
+  //
+  // V-cycle on levels lbegin to lcoarse-1, coarse(lcoarse) does the levels
+  // lcoarse and coarser. Each step takes the level it works on, work on a
+  // level is timed in its phase when level_timing is set.
+  //
+  template < typename Smooth, typename Restrict, typename Prolong, typename Coarse >
+  void vCycle(Index_type lbegin, Index_type lcoarse, bool level_timing,
+              Smooth&& smooth, Restrict&& restrict_to, Prolong&& prolong,
+              Coarse&& coarse)
+  {
+    for (Index_type l = lbegin; l < lcoarse; ++l) {
+      if (level_timing) { startPhaseTimer(l); }
+      smooth(l);
+      restrict_to(l);
+      if (level_timing) { stopPhaseTimer(l); }
+    }
+    if (level_timing) { startPhaseTimer(lcoarse); }
+    coarse(lcoarse);
+    if (level_timing) { stopPhaseTimer(lcoarse); }
+    for (Index_type l = lcoarse-1; l >= lbegin; --l) {
+      if (level_timing) { startPhaseTimer(l); }
+      prolong(l);
+      smooth(l);
+      if (level_timing) { stopPhaseTimer(l); }
+    }
+  }
+
+  Index_type m_n;
+  Index_type m_levels;
+  Index_type m_sweeps;
+  bool m_chebyshev;
+  Index_type m_coarse_points;
+  Index_type m_agglomerate_level;
+  bool m_level_timing;
+
+  Index_type m_total_size;
+
+  Real_ptr m_u;
+  Real_ptr m_f;
+  Real_ptr m_r;
+  Real_ptr m_d;
+
+  // host copies of the agglomerated levels, from m_agglomerate_level
+  Real_ptr m_host_u;
+  Real_ptr m_host_f;
+  Real_ptr m_host_r;
+  Real_ptr m_host_d;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,396 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MPI_HALOEXCHANGE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI) && defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/ShmemUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mpi_haloexchange_pack(Real_ptr buffer, Int_ptr list, Real_ptr var,
+                                  Index_type len)
+{
+   Index_type i = threadIdx.x + blockIdx.x * block_size;
+
+   if (i < len) {
+     MPI_HALOEXCHANGE_PACK_BODY;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mpi_haloexchange_unpack(Real_ptr buffer, Int_ptr list, Real_ptr var,
+                                    Index_type len)
+{
+   Index_type i = threadIdx.x + blockIdx.x * block_size;
+
+   if (i < len) {
+     MPI_HALOEXCHANGE_UNPACK_BODY;
+   }
+}
+
+#if defined(RAJA_PERFSUITE_ENABLE_SHMEM)
+
+//
+// Each block packs a chunk of a message into the local send buffer and puts
+// it into the receive buffer of the receiver, adding one to its signal.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mpi_haloexchange_shmem_pack(const MPI_HALOEXCHANGE_ShmemChunk* chunks,
+                                            Real_ptr send_buffer,
+                                            Real_ptr recv_buffer,
+                                            uint64_t* signals)
+{
+  const MPI_HALOEXCHANGE_ShmemChunk chunk = chunks[blockIdx.x];
+
+  Real_ptr buffer = send_buffer + chunk.buffer_offset;
+  Int_ptr list = chunk.list;
+  Real_ptr var = chunk.var;
+
+  Index_type i = threadIdx.x;
+  if (i < chunk.len) {
+    MPI_HALOEXCHANGE_PACK_BODY;
+  }
+  __syncthreads();
+
+  nvshmemx_putmem_signal_block(recv_buffer + chunk.remote_offset, buffer,
+                               chunk.len*sizeof(Real_type),
+                               signals + chunk.signal, 1,
+                               NVSHMEM_SIGNAL_ADD, chunk.pe);
+}
+
+//
+// Each block waits until all chunks of its message arrived in this round
+// and unpacks its chunk of the message.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mpi_haloexchange_shmem_unpack(const MPI_HALOEXCHANGE_ShmemChunk* chunks,
+                                              Real_ptr recv_buffer,
+                                              uint64_t* signals,
+                                              uint64_t round)
+{
+  const MPI_HALOEXCHANGE_ShmemChunk chunk = chunks[blockIdx.x];
+
+  if (threadIdx.x == 0) {
+    nvshmem_signal_wait_until(signals + chunk.signal, NVSHMEM_CMP_GE,
+                              round * chunk.message_chunks);
+  }
+  __syncthreads();
+
+  Real_ptr buffer = recv_buffer + chunk.buffer_offset;
+  Int_ptr list = chunk.list;
+  Real_ptr var = chunk.var;
+
+  Index_type i = threadIdx.x;
+  if (i < chunk.len) {
+    MPI_HALOEXCHANGE_UNPACK_BODY;
+  }
+}
+
+template < size_t block_size >
+void MPI_HALOEXCHANGE::runCudaVariantShmem(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  MPI_HALOEXCHANGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    detail::initShmem();
+
+    std::vector<MPI_HALOEXCHANGE_ShmemChunk> pack_chunks;
+    std::vector<MPI_HALOEXCHANGE_ShmemChunk> unpack_chunks;
+    Index_type send_len = 0;
+    Index_type recv_len = 0;
+    create_shmem_chunks(pack_chunks, unpack_chunks, send_len, recv_len, block_size);
+
+    MPI_HALOEXCHANGE_ShmemChunk* d_pack_chunks;
+    MPI_HALOEXCHANGE_ShmemChunk* d_unpack_chunks;
+    allocData(DataSpace::CudaDevice, d_pack_chunks, pack_chunks.size());
+    allocData(DataSpace::CudaDevice, d_unpack_chunks, unpack_chunks.size());
+    copyData(DataSpace::CudaDevice, d_pack_chunks,
+             DataSpace::Host, pack_chunks.data(), pack_chunks.size());
+    copyData(DataSpace::CudaDevice, d_unpack_chunks,
+             DataSpace::Host, unpack_chunks.data(), unpack_chunks.size());
+
+    //
+    // Receive buffers and signals alternate between even and odd reps, so a
+    // neighbor may put the next message while this rank unpacks this one.
+    //
+    Real_ptr send_buffer = static_cast<Real_ptr>(
+        detail::allocShmemData(send_len*sizeof(Real_type)));
+    Real_ptr recv_buffer = static_cast<Real_ptr>(
+        detail::allocShmemData(2*recv_len*sizeof(Real_type)));
+    uint64_t* signals = static_cast<uint64_t*>(
+        detail::allocShmemData(2*num_neighbors*sizeof(uint64_t)));
+    cudaErrchk( cudaMemset(signals, 0, 2*num_neighbors*sizeof(uint64_t)) );
+    cudaErrchk( cudaDeviceSynchronize() );
+    detail::barrierShmem();
+
+    const size_t pack_grid_size = pack_chunks.size();
+    const size_t unpack_grid_size = unpack_chunks.size();
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const Index_type parity = irep % 2;
+      const uint64_t round = irep / 2 + 1;
+
+      mpi_haloexchange_shmem_pack<block_size><<<pack_grid_size, block_size, shmem, res.get_stream()>>>(
+          d_pack_chunks, send_buffer,
+          recv_buffer + parity*recv_len, signals + parity*num_neighbors );
+      cudaErrchk( cudaGetLastError() );
+
+      mpi_haloexchange_shmem_unpack<block_size><<<unpack_grid_size, block_size, shmem, res.get_stream()>>>(
+          d_unpack_chunks,
+          recv_buffer + parity*recv_len, signals + parity*num_neighbors, round );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    detail::barrierShmem();
+    detail::deallocShmemData(signals);
+    detail::deallocShmemData(recv_buffer);
+    detail::deallocShmemData(send_buffer);
+
+    deallocData(DataSpace::CudaDevice, d_unpack_chunks);
+    deallocData(DataSpace::CudaDevice, d_pack_chunks);
+
+  } else {
+     getCout() << "\n MPI_HALOEXCHANGE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+#endif
+
+
+template < size_t block_size, bool launch >
+void MPI_HALOEXCHANGE::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  MPI_HALOEXCHANGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      MPI_HALOEXCHANGE_POST_RECVS;
+
+      startPhaseTimer(s_pack_phase);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = pack_buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          mpi_haloexchange_pack<block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      stopPhaseTimer(s_pack_phase);
+
+      MPI_HALOEXCHANGE_SEND_AND_RECV;
+
+      startPhaseTimer(s_unpack_phase);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = unpack_buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          dim3 nthreads_per_block(block_size);
+          dim3 nblocks((len + block_size-1) / block_size);
+          constexpr size_t shmem = 0;
+          mpi_haloexchange_unpack<block_size><<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(buffer, list, var, len);
+          cudaErrchk( cudaGetLastError() );
+          buffer += len;
+        }
+      }
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      stopPhaseTimer(s_unpack_phase);
+
+      MPI_HALOEXCHANGE_WAIT_SENDS;
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      MPI_HALOEXCHANGE_POST_RECVS;
+
+      startPhaseTimer(s_pack_phase);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = pack_buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto mpi_haloexchange_pack_base_lam = [=] __device__ (Index_type i) {
+                MPI_HALOEXCHANGE_PACK_BODY;
+              };
+          gpu_launch::forall< block_size, launch >( res,
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              mpi_haloexchange_pack_base_lam );
+          buffer += len;
+        }
+      }
+      res.wait();
+      stopPhaseTimer(s_pack_phase);
+
+      MPI_HALOEXCHANGE_SEND_AND_RECV;
+
+      startPhaseTimer(s_unpack_phase);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = unpack_buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto mpi_haloexchange_unpack_base_lam = [=] __device__ (Index_type i) {
+                MPI_HALOEXCHANGE_UNPACK_BODY;
+              };
+          gpu_launch::forall< block_size, launch >( res,
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              mpi_haloexchange_unpack_base_lam );
+          buffer += len;
+        }
+      }
+      res.wait();
+      stopPhaseTimer(s_unpack_phase);
+
+      MPI_HALOEXCHANGE_WAIT_SENDS;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n MPI_HALOEXCHANGE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void MPI_HALOEXCHANGE::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Cuda, Impl, )
+
+  }
+
+#if defined(RAJA_PERFSUITE_ENABLE_SHMEM)
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantShmem<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    });
+
+  }
+#endif
+
+}
+
+void MPI_HALOEXCHANGE::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+#if defined(RAJA_PERFSUITE_ENABLE_SHMEM)
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, "shmem_block_"+std::to_string(block_size));
+
+      }
+
+    });
+
+  }
+#endif
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI && RAJA_ENABLE_CUDA
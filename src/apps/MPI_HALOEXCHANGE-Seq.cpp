@@ -0,0 +1,325 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MPI_HALOEXCHANGE.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void MPI_HALOEXCHANGE::runSeqVariantBuffered(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  MPI_HALOEXCHANGE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        MPI_HALOEXCHANGE_POST_RECVS;
+
+        startPhaseTimer(s_pack_phase);
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              MPI_HALOEXCHANGE_PACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+        stopPhaseTimer(s_pack_phase);
+
+        MPI_HALOEXCHANGE_SEND_AND_RECV;
+
+        startPhaseTimer(s_unpack_phase);
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              MPI_HALOEXCHANGE_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+        stopPhaseTimer(s_unpack_phase);
+
+        MPI_HALOEXCHANGE_WAIT_SENDS;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        MPI_HALOEXCHANGE_POST_RECVS;
+
+        startPhaseTimer(s_pack_phase);
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_pack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_PACK_BODY;
+                };
+            for (Index_type i = 0; i < len; i++) {
+              mpi_haloexchange_pack_base_lam(i);
+            }
+            buffer += len;
+          }
+        }
+        stopPhaseTimer(s_pack_phase);
+
+        MPI_HALOEXCHANGE_SEND_AND_RECV;
+
+        startPhaseTimer(s_unpack_phase);
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_unpack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_UNPACK_BODY;
+                };
+            for (Index_type i = 0; i < len; i++) {
+              mpi_haloexchange_unpack_base_lam(i);
+            }
+            buffer += len;
+          }
+        }
+        stopPhaseTimer(s_unpack_phase);
+
+        MPI_HALOEXCHANGE_WAIT_SENDS;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::seq_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        MPI_HALOEXCHANGE_POST_RECVS;
+
+        startPhaseTimer(s_pack_phase);
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_pack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_PACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                mpi_haloexchange_pack_base_lam );
+            buffer += len;
+          }
+        }
+        stopPhaseTimer(s_pack_phase);
+
+        MPI_HALOEXCHANGE_SEND_AND_RECV;
+
+        startPhaseTimer(s_unpack_phase);
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_unpack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_UNPACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                mpi_haloexchange_unpack_base_lam );
+            buffer += len;
+          }
+        }
+        stopPhaseTimer(s_unpack_phase);
+
+        MPI_HALOEXCHANGE_WAIT_SENDS;
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n MPI_HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void MPI_HALOEXCHANGE::runSeqVariantSharedWindow(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  MPI_HALOEXCHANGE_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    MPI_HALOEXCHANGE_SharedWindow window;
+    create_shared_window(window);
+
+    vars = window.vars;
+    std::vector<Real_ptr> neighbor_vars = window.neighbor_vars;
+    const Index_type var_size = m_var_size;
+
+    auto on_node = [&](Index_type l) { return neighbor_vars[l] != nullptr; };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      startPhaseTimer(s_comm_phase);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Index_type len = unpack_index_list_lengths[l];
+        unpack_mpi_requests[l] = MPI_REQUEST_NULL;
+        if (!on_node(l)) {
+          MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+      }
+      stopPhaseTimer(s_comm_phase);
+
+      startPhaseTimer(s_pack_phase);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        if (on_node(l)) {
+          continue;
+        }
+        Real_ptr buffer = pack_buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          for (Index_type i = 0; i < len; i++) {
+            MPI_HALOEXCHANGE_PACK_BODY;
+          }
+          buffer += len;
+        }
+      }
+      stopPhaseTimer(s_pack_phase);
+
+      MPI_HALOEXCHANGE_SHARED_SEND_AND_RECV;
+
+      startPhaseTimer(s_unpack_phase);
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        if (on_node(l)) {
+          Int_ptr neighbor_list = pack_index_lists[send_tags[l]];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            Real_ptr neighbor_var = neighbor_vars[l] + v*var_size;
+            for (Index_type i = 0; i < len; i++) {
+              MPI_HALOEXCHANGE_SHARED_UNPACK_BODY;
+            }
+          }
+        } else {
+          Real_ptr buffer = unpack_buffers[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              MPI_HALOEXCHANGE_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+      }
+      stopPhaseTimer(s_unpack_phase);
+
+      MPI_HALOEXCHANGE_SHARED_WAIT_SENDS;
+
+    }
+    stopTimer();
+
+    destroy_shared_window(window);
+
+  } else {
+    getCout() << "\n MPI_HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+  }
+
+}
+
+void MPI_HALOEXCHANGE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantBuffered(vid);
+
+  }
+
+  t += 1;
+
+  if ( vid == Base_Seq ) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantSharedWindow(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+}
+
+void MPI_HALOEXCHANGE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "shared_window");
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
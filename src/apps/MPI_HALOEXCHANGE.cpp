@@ -0,0 +1,708 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MPI_HALOEXCHANGE.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+MPI_HALOEXCHANGE::MPI_HALOEXCHANGE(const RunParams& params)
+  : KernelBase(rajaperf::Apps_MPI_HALOEXCHANGE, params)
+{
+  m_grid_dims_default[0] = 100;
+  m_grid_dims_default[1] = 100;
+  m_grid_dims_default[2] = 100;
+  m_halo_width_default   = 1;
+  m_num_vars_default     = 3;
+
+  setDefaultProblemSize( m_grid_dims_default[0] *
+                         m_grid_dims_default[1] *
+                         m_grid_dims_default[2] );
+  setDefaultReps(50);
+
+  double cbrt_run_size = std::cbrt(getTargetProblemSize());
+
+  m_grid_dims[0] = cbrt_run_size;
+  m_grid_dims[1] = cbrt_run_size;
+  m_grid_dims[2] = cbrt_run_size;
+  m_halo_width = getKernelParam("halo_width", m_halo_width_default);
+  m_num_vars   = getKernelParam("num_vars", m_num_vars_default);
+
+  m_grid_plus_halo_dims[0] = m_grid_dims[0] + 2*m_halo_width;
+  m_grid_plus_halo_dims[1] = m_grid_dims[1] + 2*m_halo_width;
+  m_grid_plus_halo_dims[2] = m_grid_dims[2] + 2*m_halo_width;
+  m_var_size = m_grid_plus_halo_dims[0] *
+               m_grid_plus_halo_dims[1] *
+               m_grid_plus_halo_dims[2] ;
+
+  setActualProblemSize( m_grid_dims[0] * m_grid_dims[1] * m_grid_dims[2] );
+
+  setItsPerRep( m_num_vars * (m_var_size - getActualProblemSize()) );
+  setKernelsPerRep( 2 * s_num_neighbors * m_num_vars );
+  setBytesPerRep( (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setHasPattern(GatherScatter);
+
+  setPhaseNames({"pack", "comm", "unpack"});
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+MPI_HALOEXCHANGE::~MPI_HALOEXCHANGE()
+{
+}
+
+void MPI_HALOEXCHANGE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  m_mpi_ranks.resize(s_num_neighbors, -1);
+  m_send_tags.resize(s_num_neighbors, -1);
+  m_recv_tags.resize(s_num_neighbors, -1);
+  create_mpi_neighbors(m_mpi_ranks, m_send_tags, m_recv_tags, m_mpi_dims, m_my_mpi_rank, s_num_neighbors);
+
+  m_vars.resize(m_num_vars, nullptr);
+  for (Index_type v = 0; v < m_num_vars; ++v) {
+    allocAndInitData(m_vars[v], m_var_size, vid);
+    auto reset_var = scopedMoveData(m_vars[v], m_var_size, vid);
+
+    Real_ptr var = m_vars[v];
+
+    for (Index_type i = 0; i < m_var_size; i++) {
+      var[i] = i + v;
+    }
+  }
+
+  m_pack_index_lists.resize(s_num_neighbors, nullptr);
+  m_pack_index_list_lengths.resize(s_num_neighbors, 0);
+  create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  m_unpack_index_lists.resize(s_num_neighbors, nullptr);
+  m_unpack_index_list_lengths.resize(s_num_neighbors, 0);
+  create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  //
+  // Messages go through host buffers unless MPI can use the kernel data
+  // space directly.
+  //
+  const DataSpace buffer_space = getHostAccessibleDataSpace(vid);
+  m_separate_buffers = !run_params.getMPIGPUAware() &&
+                       (getDataSpace(vid) != buffer_space);
+
+  m_pack_buffers.resize(s_num_neighbors, nullptr);
+  m_send_buffers.resize(s_num_neighbors, nullptr);
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    Index_type buffer_len = m_num_vars * m_pack_index_list_lengths[l];
+    allocAndInitData(m_pack_buffers[l], buffer_len, vid);
+    if (m_separate_buffers) {
+      allocData(buffer_space, m_send_buffers[l], buffer_len);
+    } else {
+      m_send_buffers[l] = m_pack_buffers[l];
+    }
+  }
+
+  m_unpack_buffers.resize(s_num_neighbors, nullptr);
+  m_recv_buffers.resize(s_num_neighbors, nullptr);
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    Index_type buffer_len = m_num_vars * m_unpack_index_list_lengths[l];
+    allocAndInitData(m_unpack_buffers[l], buffer_len, vid);
+    if (m_separate_buffers) {
+      allocData(buffer_space, m_recv_buffers[l], buffer_len);
+    } else {
+      m_recv_buffers[l] = m_unpack_buffers[l];
+    }
+  }
+}
+
+void MPI_HALOEXCHANGE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  for (Real_ptr var : m_vars) {
+    checksum[vid][tune_idx] += calcChecksum(var, m_var_size, vid);
+  }
+}
+
+void MPI_HALOEXCHANGE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const DataSpace buffer_space = getHostAccessibleDataSpace(vid);
+
+  for (int l = 0; l < s_num_neighbors; ++l) {
+    if (m_separate_buffers) {
+      deallocData(buffer_space, m_recv_buffers[l]);
+    }
+    deallocData(m_unpack_buffers[l], vid);
+  }
+  m_recv_buffers.clear();
+  m_unpack_buffers.clear();
+
+  for (int l = 0; l < s_num_neighbors; ++l) {
+    if (m_separate_buffers) {
+      deallocData(buffer_space, m_send_buffers[l]);
+    }
+    deallocData(m_pack_buffers[l], vid);
+  }
+  m_send_buffers.clear();
+  m_pack_buffers.clear();
+
+  destroy_unpack_lists(m_unpack_index_lists, s_num_neighbors, vid);
+  m_unpack_index_list_lengths.clear();
+  m_unpack_index_lists.clear();
+
+  destroy_pack_lists(m_pack_index_lists, s_num_neighbors, vid);
+  m_pack_index_list_lengths.clear();
+  m_pack_index_lists.clear();
+
+  for (int v = 0; v < m_num_vars; ++v) {
+    deallocData(m_vars[v], vid);
+  }
+  m_vars.clear();
+
+  m_recv_tags.clear();
+  m_send_tags.clear();
+  m_mpi_ranks.clear();
+}
+
+namespace {
+
+//
+// Offsets in the rank grid of the neighbor each index list is exchanged
+// with, in the same order as the index list extents below.
+//
+const int neighbor_offsets[26][3] = {
+  // faces
+  {-1,  0,  0}, { 1,  0,  0}, { 0, -1,  0}, { 0,  1,  0}, { 0,  0, -1}, { 0,  0,  1},
+  // edges
+  {-1, -1,  0}, {-1,  1,  0}, { 1, -1,  0}, { 1,  1,  0},
+  {-1,  0, -1}, {-1,  0,  1}, { 1,  0, -1}, { 1,  0,  1},
+  { 0, -1, -1}, { 0, -1,  1}, { 0,  1, -1}, { 0,  1,  1},
+  // corners
+  {-1, -1, -1}, {-1, -1,  1}, {-1,  1, -1}, {-1,  1,  1},
+  { 1, -1, -1}, { 1, -1,  1}, { 1,  1, -1}, { 1,  1,  1}
+};
+
+}
+
+//
+// Function to find the neighbor ranks and message tags.
+//
+void MPI_HALOEXCHANGE::create_mpi_neighbors(
+    std::vector<int>& mpi_ranks,
+    std::vector<int>& send_tags,
+    std::vector<int>& recv_tags,
+    int* mpi_dims, int& my_mpi_rank,
+    const Index_type num_neighbors)
+{
+  int num_ranks = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_mpi_rank);
+
+  mpi_dims[0] = 0;
+  mpi_dims[1] = 0;
+  mpi_dims[2] = 0;
+  MPI_Dims_create(num_ranks, 3, mpi_dims);
+
+  int my_coords[3] = { my_mpi_rank % mpi_dims[0],
+                       (my_mpi_rank / mpi_dims[0]) % mpi_dims[1],
+                       my_mpi_rank / (mpi_dims[0] * mpi_dims[1]) };
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+
+    // periodic in each dimension
+    int coords[3];
+    for (int d = 0; d < 3; ++d) {
+      coords[d] = (my_coords[d] + neighbor_offsets[l][d] + mpi_dims[d]) % mpi_dims[d];
+    }
+    mpi_ranks[l] = (coords[2] * mpi_dims[1] + coords[1]) * mpi_dims[0] + coords[0];
+
+    // messages are tagged with the index of the list they are unpacked with,
+    // the message packed with list l is unpacked with the opposite list
+    recv_tags[l] = l;
+    for (Index_type o = 0; o < num_neighbors; ++o) {
+      if (neighbor_offsets[o][0] == -neighbor_offsets[l][0] &&
+          neighbor_offsets[o][1] == -neighbor_offsets[l][1] &&
+          neighbor_offsets[o][2] == -neighbor_offsets[l][2]) {
+        send_tags[l] = o;
+      }
+    }
+  }
+}
+
+namespace {
+
+struct Extent
+{
+  Index_type i_min;
+  Index_type i_max;
+  Index_type j_min;
+  Index_type j_max;
+  Index_type k_min;
+  Index_type k_max;
+};
+
+}
+
+//
+// Function to generate index lists for packing.
+//
+void MPI_HALOEXCHANGE::create_pack_lists(
+    std::vector<Int_ptr>& pack_index_lists,
+    std::vector<Index_type >& pack_index_list_lengths,
+    const Index_type halo_width, const Index_type* grid_dims,
+    const Index_type num_neighbors,
+    VariantID vid)
+{
+  std::vector<Extent> pack_index_list_extents(num_neighbors);
+
+  // faces
+  pack_index_list_extents[0]  = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[1]  = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[2]  = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[3]  = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[4]  = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[5]  = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+
+  // edges
+  pack_index_list_extents[6]  = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[7]  = Extent{halo_width  , halo_width   + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[8]  = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[9]  = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[10] = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[11] = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[12] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[13] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[14] = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[15] = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[16] = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[17] = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+
+  // corners
+  pack_index_list_extents[18] = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[19] = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[20] = Extent{halo_width  , halo_width   + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[21] = Extent{halo_width  , halo_width   + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[22] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[23] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[24] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[25] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+
+  const Index_type grid_i_stride = 1;
+  const Index_type grid_j_stride = grid_dims[0] + 2*halo_width;
+  const Index_type grid_k_stride = grid_j_stride * (grid_dims[1] + 2*halo_width);
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+
+    Extent extent = pack_index_list_extents[l];
+
+    pack_index_list_lengths[l] = (extent.i_max - extent.i_min) *
+                                 (extent.j_max - extent.j_min) *
+                                 (extent.k_max - extent.k_min) ;
+
+    allocAndInitData(pack_index_lists[l], pack_index_list_lengths[l], vid);
+    auto reset_list = scopedMoveData(pack_index_lists[l], pack_index_list_lengths[l], vid);
+
+    Int_ptr pack_list = pack_index_lists[l];
+
+    Index_type list_idx = 0;
+    for (Index_type kk = extent.k_min; kk < extent.k_max; ++kk) {
+      for (Index_type jj = extent.j_min; jj < extent.j_max; ++jj) {
+        for (Index_type ii = extent.i_min; ii < extent.i_max; ++ii) {
+
+          Index_type pack_idx = ii * grid_i_stride +
+                         jj * grid_j_stride +
+                         kk * grid_k_stride ;
+
+          pack_list[list_idx] = pack_idx;
+
+          list_idx += 1;
+        }
+      }
+    }
+  }
+}
+
+//
+// Function to destroy packing index lists.
+//
+void MPI_HALOEXCHANGE::destroy_pack_lists(
+    std::vector<Int_ptr>& pack_index_lists,
+    const Index_type num_neighbors,
+    VariantID vid)
+{
+  (void) vid;
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+    deallocData(pack_index_lists[l], vid);
+  }
+}
+
+//
+// Function to generate index lists for unpacking.
+//
+void MPI_HALOEXCHANGE::create_unpack_lists(
+    std::vector<Int_ptr>& unpack_index_lists,
+    std::vector<Index_type >& unpack_index_list_lengths,
+    const Index_type halo_width, const Index_type* grid_dims,
+    const Index_type num_neighbors,
+    VariantID vid)
+{
+  std::vector<Extent> unpack_index_list_extents(num_neighbors);
+
+  // faces
+  unpack_index_list_extents[0]  = Extent{0                        ,                  halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[1]  = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[2]  = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         0                        ,                  halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[3]  = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[4]  = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[5]  = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+
+  // edges
+  unpack_index_list_extents[6]  = Extent{0                        ,                  halo_width,
+                                         0                        ,                  halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[7]  = Extent{0                        ,                  halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[8]  = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         0                        ,                  halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[9]  = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[10] = Extent{0                        ,                  halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[11] = Extent{0                        ,                  halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[12] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[13] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[14] = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         0                        ,                  halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[15] = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         0                        ,                  halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[16] = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[17] = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+
+  // corners
+  unpack_index_list_extents[18] = Extent{0                        ,                  halo_width,
+                                         0                        ,                  halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[19] = Extent{0                        ,                  halo_width,
+                                         0                        ,                  halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[20] = Extent{0                        ,                  halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[21] = Extent{0                        ,                  halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[22] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         0                        ,                  halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[23] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         0                        ,                  halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[24] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[25] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+
+  const Index_type grid_i_stride = 1;
+  const Index_type grid_j_stride = grid_dims[0] + 2*halo_width;
+  const Index_type grid_k_stride = grid_j_stride * (grid_dims[1] + 2*halo_width);
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+
+    Extent extent = unpack_index_list_extents[l];
+
+    unpack_index_list_lengths[l] = (extent.i_max - extent.i_min) *
+                                   (extent.j_max - extent.j_min) *
+                                   (extent.k_max - extent.k_min) ;
+
+    allocAndInitData(unpack_index_lists[l], unpack_index_list_lengths[l], vid);
+    auto reset_list = scopedMoveData(unpack_index_lists[l], unpack_index_list_lengths[l], vid);
+
+    Int_ptr unpack_list = unpack_index_lists[l];
+
+    Index_type list_idx = 0;
+    for (Index_type kk = extent.k_min; kk < extent.k_max; ++kk) {
+      for (Index_type jj = extent.j_min; jj < extent.j_max; ++jj) {
+        for (Index_type ii = extent.i_min; ii < extent.i_max; ++ii) {
+
+          Index_type unpack_idx = ii * grid_i_stride +
+                           jj * grid_j_stride +
+                           kk * grid_k_stride ;
+
+          unpack_list[list_idx] = unpack_idx;
+
+          list_idx += 1;
+        }
+      }
+    }
+  }
+}
+
+//
+// Function to destroy unpacking index lists.
+//
+void MPI_HALOEXCHANGE::destroy_unpack_lists(
+    std::vector<Int_ptr>& unpack_index_lists,
+    const Index_type num_neighbors,
+    VariantID vid)
+{
+  (void) vid;
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+    deallocData(unpack_index_lists[l], vid);
+  }
+}
+
+//
+// Function to create the shared memory window of the ranks on this node
+// and copy the variables into it, finding where the variables of each
+// on-node neighbor are in the window.
+//
+void MPI_HALOEXCHANGE::create_shared_window(MPI_HALOEXCHANGE_SharedWindow& window)
+{
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, m_my_mpi_rank,
+                      MPI_INFO_NULL, &window.node_comm);
+
+  Real_ptr base = nullptr;
+  MPI_Win_allocate_shared(m_num_vars * m_var_size * sizeof(Real_type),
+                          sizeof(Real_type), MPI_INFO_NULL, window.node_comm,
+                          &base, &window.win);
+
+  window.vars.resize(m_num_vars, nullptr);
+  for (Index_type v = 0; v < m_num_vars; ++v) {
+    window.vars[v] = base + v * m_var_size;
+    std::copy(m_vars[v], m_vars[v] + m_var_size, window.vars[v]);
+  }
+
+  MPI_Group world_group;
+  MPI_Group node_group;
+  MPI_Comm_group(MPI_COMM_WORLD, &world_group);
+  MPI_Comm_group(window.node_comm, &node_group);
+
+  window.neighbor_vars.resize(s_num_neighbors, nullptr);
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    int node_rank = MPI_UNDEFINED;
+    MPI_Group_translate_ranks(world_group, 1, &m_mpi_ranks[l],
+                              node_group, &node_rank);
+    if (node_rank != MPI_UNDEFINED) {
+      MPI_Aint size = 0;
+      int disp_unit = 0;
+      Real_ptr neighbor_base = nullptr;
+      MPI_Win_shared_query(window.win, node_rank, &size, &disp_unit,
+                           &neighbor_base);
+      window.neighbor_vars[l] = neighbor_base;
+    }
+  }
+
+  MPI_Group_free(&node_group);
+  MPI_Group_free(&world_group);
+
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, window.win);
+  MPI_Win_sync(window.win);
+  MPI_Barrier(window.node_comm);
+}
+
+//
+// Function to copy the variables back out of the shared memory window and
+// free it.
+//
+void MPI_HALOEXCHANGE::destroy_shared_window(MPI_HALOEXCHANGE_SharedWindow& window)
+{
+  MPI_Win_sync(window.win);
+  MPI_Barrier(window.node_comm);
+  MPI_Win_unlock_all(window.win);
+
+  for (Index_type v = 0; v < m_num_vars; ++v) {
+    std::copy(window.vars[v], window.vars[v] + m_var_size, m_vars[v]);
+  }
+  window.vars.clear();
+  window.neighbor_vars.clear();
+
+  MPI_Win_free(&window.win);
+  MPI_Comm_free(&window.node_comm);
+}
+
+//
+// Function to split the messages into chunks of at most block_size items of
+// one variable for the fused kernels of the shmem tunings. The messages are
+// laid out one after the other in the send and receive buffers and every
+// rank has the same lists, so the offset of a message in the receive buffer
+// of the neighbor is the offset of the list it is unpacked with here.
+//
+void MPI_HALOEXCHANGE::create_shmem_chunks(
+    std::vector<MPI_HALOEXCHANGE_ShmemChunk>& pack_chunks,
+    std::vector<MPI_HALOEXCHANGE_ShmemChunk>& unpack_chunks,
+    Index_type& send_len, Index_type& recv_len,
+    const Index_type block_size)
+{
+  std::vector<Index_type> pack_offsets(s_num_neighbors+1, 0);
+  std::vector<Index_type> unpack_offsets(s_num_neighbors+1, 0);
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    pack_offsets[l+1] = pack_offsets[l] + m_num_vars * m_pack_index_list_lengths[l];
+    unpack_offsets[l+1] = unpack_offsets[l] + m_num_vars * m_unpack_index_list_lengths[l];
+  }
+  send_len = pack_offsets[s_num_neighbors];
+  recv_len = unpack_offsets[s_num_neighbors];
+
+  pack_chunks.clear();
+  unpack_chunks.clear();
+
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+
+    const Index_type pack_len = m_pack_index_list_lengths[l];
+    const uint64_t pack_message_chunks =
+        m_num_vars * RAJA_DIVIDE_CEILING_INT(pack_len, block_size);
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      for (Index_type c = 0; c < pack_len; c += block_size) {
+        MPI_HALOEXCHANGE_ShmemChunk chunk;
+        chunk.list = m_pack_index_lists[l] + c;
+        chunk.var = m_vars[v];
+        chunk.len = std::min(block_size, pack_len - c);
+        chunk.buffer_offset = pack_offsets[l] + v * pack_len + c;
+        chunk.remote_offset = unpack_offsets[m_send_tags[l]] + v * pack_len + c;
+        chunk.pe = m_mpi_ranks[l];
+        chunk.signal = m_send_tags[l];
+        chunk.message_chunks = pack_message_chunks;
+        pack_chunks.emplace_back(chunk);
+      }
+    }
+
+    const Index_type unpack_len = m_unpack_index_list_lengths[l];
+    const uint64_t unpack_message_chunks =
+        m_num_vars * RAJA_DIVIDE_CEILING_INT(unpack_len, block_size);
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      for (Index_type c = 0; c < unpack_len; c += block_size) {
+        MPI_HALOEXCHANGE_ShmemChunk chunk;
+        chunk.list = m_unpack_index_lists[l] + c;
+        chunk.var = m_vars[v];
+        chunk.len = std::min(block_size, unpack_len - c);
+        chunk.buffer_offset = unpack_offsets[l] + v * unpack_len + c;
+        chunk.remote_offset = 0;
+        chunk.pe = m_my_mpi_rank;
+        chunk.signal = l;
+        chunk.message_chunks = unpack_message_chunks;
+        unpack_chunks.emplace_back(chunk);
+      }
+    }
+
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
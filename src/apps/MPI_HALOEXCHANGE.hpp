@@ -0,0 +1,377 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MPI_HALOEXCHANGE kernel reference implementation:
+///
+/// // post a receive for each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Index_type len = unpack_index_list_lengths[l];
+///   MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+///       mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+/// }
+///
+/// // pack a message for each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Real_ptr buffer = pack_buffers[l];
+///   Int_ptr list = pack_index_lists[l];
+///   Index_type len = pack_index_list_lengths[l];
+///   // pack part of each variable
+///   for (Index_type v = 0; v < num_vars; ++v) {
+///     Real_ptr var = vars[v];
+///     for (Index_type i = 0; i < len; i++) {
+///       MPI_HALOEXCHANGE_PACK_BODY;
+///     }
+///     buffer += len;
+///   }
+/// }
+///
+/// // send the message to each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Index_type len = pack_index_list_lengths[l];
+///   MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+///       mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+/// }
+///
+/// // receive the message from each neighbor
+/// MPI_Waitall(num_neighbors, unpack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+///
+/// // unpack the message from each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Real_ptr buffer = unpack_buffers[l];
+///   Int_ptr list = unpack_index_lists[l];
+///   Index_type len = unpack_index_list_lengths[l];
+///   // unpack part of each variable
+///   for (Index_type v = 0; v < num_vars; ++v) {
+///     Real_ptr var = vars[v];
+///     for (Index_type i = 0; i < len; i++) {
+///       MPI_HALOEXCHANGE_UNPACK_BODY;
+///     }
+///     buffer += len;
+///   }
+/// }
+///
+/// // wait for the sends to complete
+/// MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+///
+/// Ranks are arranged in a periodic 3d cartesian grid so every rank has
+/// 26 neighbors (6 faces, 12 edges, 8 corners), some of which may be the
+/// same rank or this rank when there are few ranks in a dimension.
+///
+/// When kernel data is not host accessible, messages are copied through
+/// host send and receive buffers unless run with '--mpi-gpu-aware',
+/// in which case the pack and unpack buffers are passed to MPI directly.
+///
+/// Pack, communication, and unpack times are reported separately in the
+/// phase timing report.
+///
+/// The Base Seq and OpenMP variants also have shared_window tunings for
+/// ranks on the same node. The variables of the ranks of a node are kept
+/// in an MPI-3 shared memory window, so the halo from an on-node neighbor
+/// is unpacked directly from the variables of the neighbor, after a
+/// barrier over the node, and only the messages to off-node neighbors are
+/// packed and sent through MPI.
+///
+/// When built with RAJA_PERFSUITE_ENABLE_SHMEM, the Base GPU variants also
+/// have shmem_block_<size> tunings which use GPU-initiated communication
+/// with NVSHMEM or rocSHMEM instead of MPI. One fused kernel packs all
+/// messages, each block putting its part of a message directly into the
+/// receive buffer of the neighbor on the symmetric heap and signaling it,
+/// and one fused kernel unpacks all messages, each block waiting for the
+/// signal of its part. Receive buffers and signals alternate between reps
+/// so no rank waits on the host, and the phases are not timed separately.
+///
+
+#ifndef RAJAPerf_Apps_MPI_HALOEXCHANGE_HPP
+#define RAJAPerf_Apps_MPI_HALOEXCHANGE_HPP
+
+#define MPI_HALOEXCHANGE_DATA_SETUP \
+  std::vector<Real_ptr> vars = m_vars; \
+  std::vector<Real_ptr> pack_buffers = m_pack_buffers; \
+  std::vector<Real_ptr> unpack_buffers = m_unpack_buffers; \
+  std::vector<Real_ptr> send_buffers = m_send_buffers; \
+  std::vector<Real_ptr> recv_buffers = m_recv_buffers; \
+\
+  Index_type num_neighbors = s_num_neighbors; \
+  Index_type num_vars = m_num_vars; \
+  std::vector<Int_ptr> pack_index_lists = m_pack_index_lists; \
+  std::vector<Index_type> pack_index_list_lengths = m_pack_index_list_lengths; \
+  std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists; \
+  std::vector<Index_type> unpack_index_list_lengths = m_unpack_index_list_lengths; \
+\
+  std::vector<int> mpi_ranks = m_mpi_ranks; \
+  std::vector<int> send_tags = m_send_tags; \
+  std::vector<int> recv_tags = m_recv_tags; \
+  std::vector<MPI_Request> pack_mpi_requests(num_neighbors); \
+  std::vector<MPI_Request> unpack_mpi_requests(num_neighbors); \
+\
+  const bool separate_buffers = m_separate_buffers; \
+  const DataSpace data_space = getDataSpace(vid); \
+  const DataSpace buffer_space = getHostAccessibleDataSpace(vid);
+
+#define MPI_HALOEXCHANGE_PACK_BODY \
+  buffer[i] = var[list[i]];
+
+#define MPI_HALOEXCHANGE_UNPACK_BODY \
+  var[list[i]] = buffer[i];
+
+#define MPI_HALOEXCHANGE_SHARED_UNPACK_BODY \
+  var[list[i]] = neighbor_var[neighbor_list[i]];
+
+//
+// Post receives for the message from each neighbor.
+//
+#define MPI_HALOEXCHANGE_POST_RECVS \
+  startPhaseTimer(s_comm_phase); \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    Index_type len = unpack_index_list_lengths[l]; \
+    MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type, \
+        mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]); \
+  } \
+  stopPhaseTimer(s_comm_phase);
+
+//
+// Send the packed message to each neighbor, then wait for the message
+// from each neighbor.
+//
+#define MPI_HALOEXCHANGE_SEND_AND_RECV \
+  startPhaseTimer(s_comm_phase); \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    Index_type len = pack_index_list_lengths[l]; \
+    if (separate_buffers) { \
+      copyData(buffer_space, send_buffers[l], \
+               data_space, pack_buffers[l], len*num_vars); \
+    } \
+    MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type, \
+        mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]); \
+  } \
+  MPI_Waitall(num_neighbors, unpack_mpi_requests.data(), MPI_STATUSES_IGNORE); \
+  if (separate_buffers) { \
+    for (Index_type l = 0; l < num_neighbors; ++l) { \
+      Index_type len = unpack_index_list_lengths[l]; \
+      copyData(data_space, unpack_buffers[l], \
+               buffer_space, recv_buffers[l], len*num_vars); \
+    } \
+  } \
+  stopPhaseTimer(s_comm_phase);
+
+//
+// Wait for the sends to each neighbor to complete.
+//
+#define MPI_HALOEXCHANGE_WAIT_SENDS \
+  startPhaseTimer(s_comm_phase); \
+  MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE); \
+  stopPhaseTimer(s_comm_phase);
+
+//
+// Send the packed message to each off-node neighbor, then make the
+// variables of this rank visible to the ranks on the node and wait for the
+// messages from the off-node neighbors.
+//
+#define MPI_HALOEXCHANGE_SHARED_SEND_AND_RECV \
+  startPhaseTimer(s_comm_phase); \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    Index_type len = pack_index_list_lengths[l]; \
+    pack_mpi_requests[l] = MPI_REQUEST_NULL; \
+    if (!on_node(l)) { \
+      if (separate_buffers) { \
+        copyData(buffer_space, send_buffers[l], \
+                 data_space, pack_buffers[l], len*num_vars); \
+      } \
+      MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type, \
+          mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]); \
+    } \
+  } \
+  MPI_Win_sync(window.win); \
+  MPI_Barrier(window.node_comm); \
+  MPI_Waitall(num_neighbors, unpack_mpi_requests.data(), MPI_STATUSES_IGNORE); \
+  if (separate_buffers) { \
+    for (Index_type l = 0; l < num_neighbors; ++l) { \
+      if (!on_node(l)) { \
+        Index_type len = unpack_index_list_lengths[l]; \
+        copyData(data_space, unpack_buffers[l], \
+                 buffer_space, recv_buffers[l], len*num_vars); \
+      } \
+    } \
+  } \
+  stopPhaseTimer(s_comm_phase);
+
+//
+// Wait for the sends to each off-node neighbor to complete, then wait for
+// the ranks on the node to finish reading the variables of this rank.
+//
+#define MPI_HALOEXCHANGE_SHARED_WAIT_SENDS \
+  startPhaseTimer(s_comm_phase); \
+  MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE); \
+  MPI_Win_sync(window.win); \
+  MPI_Barrier(window.node_comm); \
+  stopPhaseTimer(s_comm_phase);
+
+
+#include "common/KernelBase.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+struct MPI_HALOEXCHANGE_ShmemChunk;
+struct MPI_HALOEXCHANGE_SharedWindow;
+
+class MPI_HALOEXCHANGE : public KernelBase
+{
+public:
+
+  MPI_HALOEXCHANGE(const RunParams& params);
+
+  ~MPI_HALOEXCHANGE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantBuffered(VariantID vid);
+  void runSeqVariantSharedWindow(VariantID vid);
+  void runOpenMPVariantBuffered(VariantID vid);
+  void runOpenMPVariantSharedWindow(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantShmem(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantShmem(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  static const int s_num_neighbors = 26;
+
+  static const size_t s_pack_phase = 0;
+  static const size_t s_comm_phase = 1;
+  static const size_t s_unpack_phase = 2;
+
+  Index_type m_grid_dims[3];
+  Index_type m_halo_width;
+  Index_type m_num_vars;
+
+  Index_type m_grid_dims_default[3];
+  Index_type m_halo_width_default;
+  Index_type m_num_vars_default;
+
+  Index_type m_grid_plus_halo_dims[3];
+  Index_type m_var_size;
+  Index_type m_var_halo_size;
+
+  int m_mpi_dims[3];
+  int m_my_mpi_rank;
+  std::vector<int> m_mpi_ranks;
+  std::vector<int> m_send_tags;
+  std::vector<int> m_recv_tags;
+
+  bool m_separate_buffers;
+
+  std::vector<Real_ptr> m_vars;
+  std::vector<Real_ptr> m_pack_buffers;
+  std::vector<Real_ptr> m_unpack_buffers;
+  std::vector<Real_ptr> m_send_buffers;
+  std::vector<Real_ptr> m_recv_buffers;
+
+  std::vector<Int_ptr> m_pack_index_lists;
+  std::vector<Index_type > m_pack_index_list_lengths;
+  std::vector<Int_ptr> m_unpack_index_lists;
+  std::vector<Index_type > m_unpack_index_list_lengths;
+
+  void create_mpi_neighbors(std::vector<int>& mpi_ranks,
+                            std::vector<int>& send_tags,
+                            std::vector<int>& recv_tags,
+                            int* mpi_dims, int& my_mpi_rank,
+                            const Index_type num_neighbors);
+
+  void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+                         std::vector<Index_type >& pack_index_list_lengths,
+                         const Index_type halo_width, const Index_type* grid_dims,
+                         const Index_type num_neighbors,
+                         VariantID vid);
+  void destroy_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+                          const Index_type num_neighbors,
+                          VariantID vid);
+  void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+                           std::vector<Index_type >& unpack_index_list_lengths,
+                           const Index_type halo_width, const Index_type* grid_dims,
+                           const Index_type num_neighbors,
+                           VariantID vid);
+  void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+                            const Index_type num_neighbors,
+                            VariantID vid);
+
+  void create_shared_window(MPI_HALOEXCHANGE_SharedWindow& window);
+  void destroy_shared_window(MPI_HALOEXCHANGE_SharedWindow& window);
+
+  void create_shmem_chunks(std::vector<MPI_HALOEXCHANGE_ShmemChunk>& pack_chunks,
+                           std::vector<MPI_HALOEXCHANGE_ShmemChunk>& unpack_chunks,
+                           Index_type& send_len, Index_type& recv_len,
+                           const Index_type block_size);
+};
+
+//
+// MPI-3 shared memory window holding the variables of the ranks on this
+// node, used by the shared_window tunings.
+//
+struct MPI_HALOEXCHANGE_SharedWindow
+{
+  MPI_Comm node_comm = MPI_COMM_NULL;
+  MPI_Win win = MPI_WIN_NULL;
+  std::vector<Real_ptr> vars;            // variables of this rank in the window
+  std::vector<Real_ptr> neighbor_vars;   // first variable of each neighbor in
+                                         // the window, nullptr if off node
+};
+
+//
+// Part of one variable of one message packed or unpacked by one block of
+// the fused kernels of the shmem tunings.
+//
+struct MPI_HALOEXCHANGE_ShmemChunk
+{
+  Int_ptr list;              // index list of the items of the chunk
+  Real_ptr var;
+  Index_type len;            // number of items, at most the block size
+  Index_type buffer_offset;  // offset of the chunk in the local buffer
+  Index_type remote_offset;  // pack, offset in the receive buffer of pe
+  int pe;                    // pack, rank the chunk is put to
+  int signal;                // index of the signal of the message at the receiver
+  uint64_t message_chunks;   // number of chunks in the message
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // RAJA_PERFSUITE_ENABLE_MPI
+
+#endif // closing endif for header file include guard
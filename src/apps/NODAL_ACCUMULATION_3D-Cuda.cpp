@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include "AppsData.hpp"
 
@@ -43,6 +44,52 @@ __global__ void nodal_accumulation_3d(Real_ptr vol,
 
 
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void nodal_accumulation_3d_unstructured(Real_ptr vol, Real_ptr x,
+                      Index_ptr real_zones, Index_ptr zone_nodes,
+                      Index_type ibegin, Index_type iend)
+{
+   Index_type ii = blockIdx.x * blockDim.x + threadIdx.x + ibegin;
+   if (ii < iend) {
+     NODAL_ACCUMULATION_3D_UNSTRUCTURED_BODY_INDEX;
+     NODAL_ACCUMULATION_3D_UNSTRUCTURED_RAJA_ATOMIC_BODY(RAJA::cuda_atomic);
+   }
+}
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void nodal_accumulation_3d_colored(Real_ptr vol,
+                      Real_ptr x0, Real_ptr x1,
+                      Real_ptr x2, Real_ptr x3,
+                      Real_ptr x4, Real_ptr x5,
+                      Real_ptr x6, Real_ptr x7,
+                      Index_ptr color_zones,
+                      Index_type ibegin, Index_type iend)
+{
+   Index_type ii = blockIdx.x * blockDim.x + threadIdx.x + ibegin;
+   if (ii < iend) {
+     NODAL_ACCUMULATION_3D_COLORED_BODY_INDEX;
+     NODAL_ACCUMULATION_3D_BODY;
+   }
+}
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void nodal_accumulation_3d_gather(Real_ptr vol, Real_ptr x,
+                      Index_ptr gather_nodes, Index_ptr node_zones,
+                      Index_type jbegin, Index_type jend)
+{
+   Index_type jj = blockIdx.x * blockDim.x + threadIdx.x + jbegin;
+   if (jj < jend) {
+     NODAL_ACCUMULATION_3D_GATHER_BODY_INDEX;
+     NODAL_ACCUMULATION_3D_GATHER_BODY;
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void NODAL_ACCUMULATION_3D::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -78,7 +125,7 @@ void NODAL_ACCUMULATION_3D::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         zones, [=] __device__ (Index_type i) {
           NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::cuda_atomic);
       });
@@ -91,7 +138,121 @@ void NODAL_ACCUMULATION_3D::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(NODAL_ACCUMULATION_3D, Cuda)
+template < size_t block_size >
+void NODAL_ACCUMULATION_3D::runCudaVariantUnstructured(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  auto res{getCudaResource()};
+
+  NODAL_ACCUMULATION_3D_UNSTRUCTURED_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      nodal_accumulation_3d_unstructured<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(vol, x,
+                                       real_zones, zone_nodes,
+                                       ibegin, iend);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown Cuda unstructured variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void NODAL_ACCUMULATION_3D::runCudaVariantColored(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  NODAL_ACCUMULATION_3D_COLORED_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type c = 0; c < num_zone_colors; ++c) {
+        const Index_type ibegin = m_color_offsets[c];
+        const Index_type iend = m_color_offsets[c+1];
+        if (iend == ibegin) continue;
+
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend - ibegin, block_size);
+        constexpr size_t shmem = 0;
+
+        nodal_accumulation_3d_colored<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(vol,
+                                         x0, x1, x2, x3, x4, x5, x6, x7,
+                                         color_zones,
+                                         ibegin, iend);
+        cudaErrchk( cudaGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown Cuda colored variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void NODAL_ACCUMULATION_3D::runCudaVariantGather(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type jbegin = 0;
+  const Index_type jend = m_domain->n_real_nodes;
+
+  auto res{getCudaResource()};
+
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(jend, block_size);
+      constexpr size_t shmem = 0;
+
+      nodal_accumulation_3d_gather<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(vol, x,
+                                       gather_nodes, node_zones,
+                                       jbegin, jend);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown Cuda gather variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void NODAL_ACCUMULATION_3D::runCudaVariantNamed(VariantID vid)
+{
+  if ( m_accumulation == AccumulationMethod::colored ) {
+    runCudaVariantColored<block_size>(vid);
+  } else if ( m_accumulation == AccumulationMethod::gather ) {
+    runCudaVariantGather<block_size>(vid);
+  } else {
+    runCudaVariantUnstructured<block_size>(vid);
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_NAMED_TUNING_DEFINE_BOILERPLATE(NODAL_ACCUMULATION_3D, Cuda, Base_CUDA,
+    getNamedTuningNames(), Named, RAJA_CUDA)
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include "AppsData.hpp"
 
@@ -43,6 +44,52 @@ __global__ void nodal_accumulation_3d(Real_ptr vol,
 
 
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void nodal_accumulation_3d_unstructured(Real_ptr vol, Real_ptr x,
+                      Index_ptr real_zones, Index_ptr zone_nodes,
+                      Index_type ibegin, Index_type iend)
+{
+   Index_type ii = blockIdx.x * blockDim.x + threadIdx.x + ibegin;
+   if (ii < iend) {
+     NODAL_ACCUMULATION_3D_UNSTRUCTURED_BODY_INDEX;
+     NODAL_ACCUMULATION_3D_UNSTRUCTURED_RAJA_ATOMIC_BODY(RAJA::hip_atomic);
+   }
+}
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void nodal_accumulation_3d_colored(Real_ptr vol,
+                      Real_ptr x0, Real_ptr x1,
+                      Real_ptr x2, Real_ptr x3,
+                      Real_ptr x4, Real_ptr x5,
+                      Real_ptr x6, Real_ptr x7,
+                      Index_ptr color_zones,
+                      Index_type ibegin, Index_type iend)
+{
+   Index_type ii = blockIdx.x * blockDim.x + threadIdx.x + ibegin;
+   if (ii < iend) {
+     NODAL_ACCUMULATION_3D_COLORED_BODY_INDEX;
+     NODAL_ACCUMULATION_3D_BODY;
+   }
+}
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void nodal_accumulation_3d_gather(Real_ptr vol, Real_ptr x,
+                      Index_ptr gather_nodes, Index_ptr node_zones,
+                      Index_type jbegin, Index_type jend)
+{
+   Index_type jj = blockIdx.x * blockDim.x + threadIdx.x + jbegin;
+   if (jj < jend) {
+     NODAL_ACCUMULATION_3D_GATHER_BODY_INDEX;
+     NODAL_ACCUMULATION_3D_GATHER_BODY;
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void NODAL_ACCUMULATION_3D::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -78,7 +125,7 @@ void NODAL_ACCUMULATION_3D::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         zones, [=] __device__ (Index_type i) {
           NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::hip_atomic);
       });
@@ -91,7 +138,121 @@ void NODAL_ACCUMULATION_3D::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(NODAL_ACCUMULATION_3D, Hip)
+template < size_t block_size >
+void NODAL_ACCUMULATION_3D::runHipVariantUnstructured(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  auto res{getHipResource()};
+
+  NODAL_ACCUMULATION_3D_UNSTRUCTURED_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((nodal_accumulation_3d_unstructured<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), vol, x,
+                                       real_zones, zone_nodes,
+                                       ibegin, iend);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown Hip unstructured variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void NODAL_ACCUMULATION_3D::runHipVariantColored(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  NODAL_ACCUMULATION_3D_COLORED_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type c = 0; c < num_zone_colors; ++c) {
+        const Index_type ibegin = m_color_offsets[c];
+        const Index_type iend = m_color_offsets[c+1];
+        if (iend == ibegin) continue;
+
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend - ibegin, block_size);
+        constexpr size_t shmem = 0;
+
+        hipLaunchKernelGGL((nodal_accumulation_3d_colored<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), vol,
+                                         x0, x1, x2, x3, x4, x5, x6, x7,
+                                         color_zones,
+                                         ibegin, iend);
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown Hip colored variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void NODAL_ACCUMULATION_3D::runHipVariantGather(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type jbegin = 0;
+  const Index_type jend = m_domain->n_real_nodes;
+
+  auto res{getHipResource()};
+
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(jend, block_size);
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((nodal_accumulation_3d_gather<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), vol, x,
+                                       gather_nodes, node_zones,
+                                       jbegin, jend);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown Hip gather variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void NODAL_ACCUMULATION_3D::runHipVariantNamed(VariantID vid)
+{
+  if ( m_accumulation == AccumulationMethod::colored ) {
+    runHipVariantColored<block_size>(vid);
+  } else if ( m_accumulation == AccumulationMethod::gather ) {
+    runHipVariantGather<block_size>(vid);
+  } else {
+    runHipVariantUnstructured<block_size>(vid);
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_NAMED_TUNING_DEFINE_BOILERPLATE(NODAL_ACCUMULATION_3D, Hip, Base_HIP,
+    getNamedTuningNames(), Named, RAJA_HIP)
 
 } // end namespace apps
 } // end namespace rajaperf
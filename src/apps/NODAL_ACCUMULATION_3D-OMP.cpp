@@ -24,6 +24,17 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( m_node_ordering != NodeOrdering::structured ) {
+    runOpenMPVariantUnstructured(vid);
+    return;
+  } else if ( m_accumulation == AccumulationMethod::colored ) {
+    runOpenMPVariantColored(vid);
+    return;
+  } else if ( m_accumulation == AccumulationMethod::gather ) {
+    runOpenMPVariantGather(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -140,5 +151,123 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 #endif
 }
 
+void NODAL_ACCUMULATION_3D::runOpenMPVariantUnstructured(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  NODAL_ACCUMULATION_3D_UNSTRUCTURED_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+        NODAL_ACCUMULATION_3D_UNSTRUCTURED_BODY_INDEX;
+
+        Real_type val = 0.125 * vol[i];
+
+        for (Index_type v = 0; v < 8; ++v) {
+          #pragma omp atomic
+          x[nodes[v]] += val;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown unstructured variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantColored(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_COLORED_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel
+      for (Index_type c = 0; c < num_zone_colors; ++c) {
+        const Index_type ibegin = m_color_offsets[c];
+        const Index_type iend = m_color_offsets[c+1];
+        #pragma omp for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          NODAL_ACCUMULATION_3D_COLORED_BODY_INDEX;
+          NODAL_ACCUMULATION_3D_BODY;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown colored variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantGather(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type jbegin = 0;
+  const Index_type jend = m_domain->n_real_nodes;
+
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (Index_type jj = jbegin ; jj < jend ; ++jj ) {
+        NODAL_ACCUMULATION_3D_GATHER_BODY_INDEX;
+        NODAL_ACCUMULATION_3D_GATHER_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown gather variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  if ( vid == Base_OpenMP ) {
+    for (const std::string& name : getNamedTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -32,6 +32,8 @@ namespace apps
 void NODAL_ACCUMULATION_3D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
@@ -42,30 +44,58 @@ void NODAL_ACCUMULATION_3D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPER
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(x0,x1,x2,x3,x4,x5,x6,x7, \
-                                       vol, real_zones) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-        NODAL_ACCUMULATION_3D_BODY_INDEX;
-
-        Real_type val = 0.125 * vol[i];
-
-        #pragma omp atomic
-        x0[i] += val;
-        #pragma omp atomic
-        x1[i] += val;
-        #pragma omp atomic
-        x2[i] += val;
-        #pragma omp atomic
-        x3[i] += val;
-        #pragma omp atomic
-        x4[i] += val;
-        #pragma omp atomic
-        x5[i] += val;
-        #pragma omp atomic
-        x6[i] += val;
-        #pragma omp atomic
-        x7[i] += val;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x0,x1,x2,x3,x4,x5,x6,x7, \
+                                         vol, real_zones) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          NODAL_ACCUMULATION_3D_BODY_INDEX;
+
+          Real_type val = 0.125 * vol[i];
+
+          #pragma omp atomic
+          x0[i] += val;
+          #pragma omp atomic
+          x1[i] += val;
+          #pragma omp atomic
+          x2[i] += val;
+          #pragma omp atomic
+          x3[i] += val;
+          #pragma omp atomic
+          x4[i] += val;
+          #pragma omp atomic
+          x5[i] += val;
+          #pragma omp atomic
+          x6[i] += val;
+          #pragma omp atomic
+          x7[i] += val;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x0,x1,x2,x3,x4,x5,x6,x7, \
+                                         vol, real_zones) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          NODAL_ACCUMULATION_3D_BODY_INDEX;
+
+          Real_type val = 0.125 * vol[i];
+
+          #pragma omp atomic
+          x0[i] += val;
+          #pragma omp atomic
+          x1[i] += val;
+          #pragma omp atomic
+          x2[i] += val;
+          #pragma omp atomic
+          x3[i] += val;
+          #pragma omp atomic
+          x4[i] += val;
+          #pragma omp atomic
+          x5[i] += val;
+          #pragma omp atomic
+          x6[i] += val;
+          #pragma omp atomic
+          x7[i] += val;
+        }
       }
 
     }
@@ -22,6 +22,17 @@ namespace apps
 
 void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
+  if ( m_node_ordering != NodeOrdering::structured ) {
+    runSeqVariantUnstructured(vid);
+    return;
+  } else if ( m_accumulation == AccumulationMethod::colored ) {
+    runSeqVariantColored(vid);
+    return;
+  } else if ( m_accumulation == AccumulationMethod::gather ) {
+    runSeqVariantGather(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -97,5 +108,95 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
 }
 
+void NODAL_ACCUMULATION_3D::runSeqVariantUnstructured(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  NODAL_ACCUMULATION_3D_UNSTRUCTURED_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+        NODAL_ACCUMULATION_3D_UNSTRUCTURED_BODY_INDEX;
+        NODAL_ACCUMULATION_3D_UNSTRUCTURED_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown unstructured variant id = " << vid << std::endl;
+  }
+}
+
+void NODAL_ACCUMULATION_3D::runSeqVariantColored(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_COLORED_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type c = 0; c < num_zone_colors; ++c) {
+        const Index_type ibegin = m_color_offsets[c];
+        const Index_type iend = m_color_offsets[c+1];
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          NODAL_ACCUMULATION_3D_COLORED_BODY_INDEX;
+          NODAL_ACCUMULATION_3D_BODY;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown colored variant id = " << vid << std::endl;
+  }
+}
+
+void NODAL_ACCUMULATION_3D::runSeqVariantGather(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type jbegin = 0;
+  const Index_type jend = m_domain->n_real_nodes;
+
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type jj = jbegin ; jj < jend ; ++jj ) {
+        NODAL_ACCUMULATION_3D_GATHER_BODY_INDEX;
+        NODAL_ACCUMULATION_3D_GATHER_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown gather variant id = " << vid << std::endl;
+  }
+}
+
+void NODAL_ACCUMULATION_3D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  if ( vid == Base_Seq ) {
+    for (const std::string& name : getNamedTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -14,6 +14,7 @@
 #include "common/DataUtils.hpp"
 
 #include <cmath>
+#include <vector>
 
 
 namespace rajaperf
@@ -36,12 +37,17 @@ NODAL_ACCUMULATION_3D::NODAL_ACCUMULATION_3D(const RunParams& params)
 
   setActualProblemSize( m_domain->n_real_zones );
 
+  m_node_ordering = NodeOrdering::structured;
+  m_zone_nodes = nullptr;
+
+  m_accumulation = AccumulationMethod::atomic;
+  m_color_zones = nullptr;
+  m_gather_nodes = nullptr;
+  m_node_zones = nullptr;
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
-  // touched data size, not actual number of stores and loads
-  setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * getItsPerRep() +
-                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
-                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_domain->n_real_nodes);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
   setFLOPsPerRep(9 * getItsPerRep());
 
   checksum_scale_factor = 0.001 *
@@ -51,6 +57,9 @@ NODAL_ACCUMULATION_3D::NODAL_ACCUMULATION_3D(const RunParams& params)
   setUsesFeature(Forall);
   setUsesFeature(Atomic);
 
+  setHasPattern(Stencil);
+  setHasPattern(GatherScatter);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -59,6 +68,8 @@ NODAL_ACCUMULATION_3D::NODAL_ACCUMULATION_3D(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -74,8 +85,59 @@ NODAL_ACCUMULATION_3D::~NODAL_ACCUMULATION_3D()
   delete m_domain;
 }
 
-void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// Touched data size, not actual number of stores and loads. Unstructured
+// tunings also read the connectivity, colored tunings read the colored zone
+// list instead of real_zones, and gather tunings read the node-to-zone
+// connectivity instead. Tunings before setting up the kernel tunings, ie.
+// in the constructor, are counted as structured.
+//
+Index_type NODAL_ACCUMULATION_3D::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const bool tuned = tune_idx < getNumVariantTunings(vid);
+  const NodeOrdering ordering = tuned
+      ? getNodeOrdering(getVariantTuningName(vid, tune_idx))
+      : NodeOrdering::structured;
+  const AccumulationMethod accumulation = tuned
+      ? getAccumulationMethod(getVariantTuningName(vid, tune_idx))
+      : AccumulationMethod::atomic;
+
+  const Index_type zones = m_domain->n_real_zones;
+  const Index_type nodes = m_domain->n_real_nodes;
+
+  if (accumulation == AccumulationMethod::gather) {
+    return (0*sizeof(Index_type) + 9*sizeof(Index_type)) * nodes +
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * zones +
+           (1*sizeof(Real_type) + 1*sizeof(Real_type)) * nodes;
+  }
+
+  Index_type bytes =
+      (0*sizeof(Index_type) + 1*sizeof(Index_type)) * zones +
+      (0*sizeof(Real_type) + 1*sizeof(Real_type)) * zones +
+      (1*sizeof(Real_type) + 1*sizeof(Real_type)) * nodes;
+  if (ordering != NodeOrdering::structured) {
+    bytes += (0*sizeof(Index_type) + 8*sizeof(Index_type)) * zones;
+  }
+  return bytes;
+}
+
+//
+// Unstructured tunings followed by accumulation tunings.
+//
+std::vector<std::string> NODAL_ACCUMULATION_3D::getNamedTuningNames()
+{
+  std::vector<std::string> names = getUnstructuredTuningNames();
+  for (const std::string& name : getAccumulationTuningNames()) {
+    names.emplace_back(name);
+  }
+  return names;
+}
+
+void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t tune_idx)
 {
+  m_node_ordering = getNodeOrdering(getVariantTuningName(vid, tune_idx));
+  m_accumulation = getAccumulationMethod(getVariantTuningName(vid, tune_idx));
+
   allocAndInitDataConst(m_x, m_nodal_array_length, 0.0, vid);
   allocAndInitDataConst(m_vol, m_zonal_array_length, 1.0, vid);
   allocAndInitDataConst(m_real_zones, m_domain->n_real_zones,
@@ -86,11 +148,56 @@ void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
     setRealZones_3d(m_real_zones, *m_domain);
   }
+
+  if (m_node_ordering != NodeOrdering::structured) {
+    m_node_perm.resize(m_nodal_array_length);
+    setNodeOrdering_3d(m_node_perm.data(), m_node_ordering, *m_domain);
+
+    allocAndInitDataConst(m_zone_nodes, 8*m_domain->n_real_zones,
+                          static_cast<Index_type>(-1), vid);
+    auto reset_zn = scopedMoveData(m_zone_nodes, 8*m_domain->n_real_zones, vid);
+
+    setZoneNodes_3d(m_zone_nodes, m_node_perm.data(), *m_domain);
+  }
+
+  // the coloring and node-to-zone connectivity are built once here, so
+  // their cost is in the SetUp phase time and not the kernel time
+  if (m_accumulation == AccumulationMethod::colored) {
+    m_color_offsets.resize(num_zone_colors+1);
+
+    allocAndInitDataConst(m_color_zones, m_domain->n_real_zones,
+                          static_cast<Index_type>(-1), vid);
+    auto reset_cz = scopedMoveData(m_color_zones, m_domain->n_real_zones, vid);
+
+    setZoneColors_3d(m_color_zones, m_color_offsets.data(), *m_domain);
+
+  } else if (m_accumulation == AccumulationMethod::gather) {
+    allocAndInitDataConst(m_gather_nodes, m_domain->n_real_nodes,
+                          static_cast<Index_type>(-1), vid);
+    allocAndInitDataConst(m_node_zones, 8*m_domain->n_real_nodes,
+                          static_cast<Index_type>(-1), vid);
+    auto reset_gn = scopedMoveData(m_gather_nodes, m_domain->n_real_nodes, vid);
+    auto reset_nz = scopedMoveData(m_node_zones, 8*m_domain->n_real_nodes, vid);
+
+    setNodeZones_3d(m_gather_nodes, m_node_zones, *m_domain);
+  }
 }
 
 void NODAL_ACCUMULATION_3D::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid].at(tune_idx) += calcChecksum(m_x, m_nodal_array_length, checksum_scale_factor , vid);
+  if (m_node_ordering == NodeOrdering::structured) {
+    checksum[vid].at(tune_idx) += calcChecksum(m_x, m_nodal_array_length, checksum_scale_factor , vid);
+  } else {
+    // undo the node numbering so all tunings give the same checksum
+    auto reset_x = scopedMoveData(m_x, m_nodal_array_length, vid);
+
+    std::vector<Real_type> x(m_nodal_array_length);
+    for (Index_type n = 0; n < m_nodal_array_length; ++n) {
+      x[n] = m_x[m_node_perm[n]];
+    }
+    checksum[vid].at(tune_idx) += detail::calcChecksum(x.data(), m_nodal_array_length,
+                                                       checksum_scale_factor);
+  }
 }
 
 void NODAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -100,6 +207,18 @@ void NODAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
   deallocData(m_x, vid);
   deallocData(m_vol, vid);
   deallocData(m_real_zones, vid);
+  if (m_zone_nodes != nullptr) {
+    deallocData(m_zone_nodes, vid);
+  }
+  if (m_color_zones != nullptr) {
+    deallocData(m_color_zones, vid);
+  }
+  if (m_gather_nodes != nullptr) {
+    deallocData(m_gather_nodes, vid);
+    deallocData(m_node_zones, vid);
+  }
+  m_node_perm.clear();
+  m_color_offsets.clear();
 }
 
 } // end namespace apps
@@ -27,6 +27,38 @@
 ///
 /// }
 ///
+/// The unstructured tunings read the eight nodes of each zone from
+/// zone-to-node connectivity, with the nodes numbered in one of the
+/// NodeOrdering orders in AppsData.hpp:
+///
+/// for (Index_type ii = ibegin; ii < iend; ++ii ) {
+///   Index_type i = real_zones[ii];
+///   Index_ptr nodes = zone_nodes + 8*ii;
+///
+///   Real_type val = 0.125 * vol[i] ;
+///
+///   x[nodes[0]] += val;
+///   ...
+///   x[nodes[7]] += val;
+///
+/// }
+///
+/// The colored tunings run the zones of each of the 8 colors of
+/// setZoneColors_3d in AppsData.hpp in turn without atomics, and the gather
+/// tunings sum the zones of each node from node-to-zone connectivity:
+///
+/// for (Index_type jj = jbegin; jj < jend; ++jj ) {
+///   Index_type n = gather_nodes[jj];
+///   Index_ptr zones = node_zones + 8*jj;
+///
+///   Real_type sum = 0.0;
+///   for (Index_type v = 0; v < 8; ++v) {
+///     if (zones[v] >= 0) sum += 0.125 * vol[zones[v]];
+///   }
+///   x[n] += sum;
+///
+/// }
+///
 
 #ifndef RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 #define RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
@@ -41,6 +73,72 @@
   \
   Index_ptr real_zones = m_real_zones;
 
+#define NODAL_ACCUMULATION_3D_UNSTRUCTURED_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  Index_ptr real_zones = m_real_zones; \
+  Index_ptr zone_nodes = m_zone_nodes;
+
+#define NODAL_ACCUMULATION_3D_UNSTRUCTURED_BODY_INDEX \
+  Index_type i = real_zones[ii]; \
+  Index_ptr nodes = zone_nodes + 8*ii;
+
+#define NODAL_ACCUMULATION_3D_UNSTRUCTURED_BODY \
+  Real_type val = 0.125 * vol[i]; \
+  \
+  x[nodes[0]] += val; \
+  x[nodes[1]] += val; \
+  x[nodes[2]] += val; \
+  x[nodes[3]] += val; \
+  x[nodes[4]] += val; \
+  x[nodes[5]] += val; \
+  x[nodes[6]] += val; \
+  x[nodes[7]] += val;
+
+#define NODAL_ACCUMULATION_3D_UNSTRUCTURED_RAJA_ATOMIC_BODY(policy) \
+  Real_type val = 0.125 * vol[i]; \
+  \
+  RAJA::atomicAdd<policy>(&x[nodes[0]], val); \
+  RAJA::atomicAdd<policy>(&x[nodes[1]], val); \
+  RAJA::atomicAdd<policy>(&x[nodes[2]], val); \
+  RAJA::atomicAdd<policy>(&x[nodes[3]], val); \
+  RAJA::atomicAdd<policy>(&x[nodes[4]], val); \
+  RAJA::atomicAdd<policy>(&x[nodes[5]], val); \
+  RAJA::atomicAdd<policy>(&x[nodes[6]], val); \
+  RAJA::atomicAdd<policy>(&x[nodes[7]], val);
+
+#define NODAL_ACCUMULATION_3D_COLORED_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  Real_ptr x0,x1,x2,x3,x4,x5,x6,x7; \
+  \
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ; \
+  \
+  Index_ptr color_zones = m_color_zones;
+
+#define NODAL_ACCUMULATION_3D_COLORED_BODY_INDEX \
+  Index_type i = color_zones[ii];
+
+#define NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  Index_ptr gather_nodes = m_gather_nodes; \
+  Index_ptr node_zones = m_node_zones;
+
+#define NODAL_ACCUMULATION_3D_GATHER_BODY_INDEX \
+  Index_type n = gather_nodes[jj]; \
+  Index_ptr zones = node_zones + 8*jj;
+
+#define NODAL_ACCUMULATION_3D_GATHER_BODY \
+  Real_type sum = 0.0; \
+  for (Index_type v = 0; v < 8; ++v) { \
+    if (zones[v] >= 0) sum += 0.125 * vol[zones[v]]; \
+  } \
+  x[n] += sum;
+
 #define NODAL_ACCUMULATION_3D_BODY_INDEX \
   Index_type i = real_zones[ii];
 
@@ -71,6 +169,9 @@
 
 
 #include "common/KernelBase.hpp"
+#include "AppsData.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -78,7 +179,6 @@ class RunParams;
 
 namespace apps
 {
-class ADomain;
 
 class NODAL_ACCUMULATION_3D : public KernelBase
 {
@@ -92,18 +192,46 @@ public:
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
 
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
   void runSeqVariant(VariantID vid, size_t tune_idx);
   void runOpenMPVariant(VariantID vid, size_t tune_idx);
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  void runSeqVariantUnstructured(VariantID vid);
+  void runOpenMPVariantUnstructured(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantUnstructured(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantUnstructured(VariantID vid);
+  void runSeqVariantColored(VariantID vid);
+  void runOpenMPVariantColored(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantColored(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantColored(VariantID vid);
+  void runSeqVariantGather(VariantID vid);
+  void runOpenMPVariantGather(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantGather(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantGather(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantNamed(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantNamed(VariantID vid);
+
+  static std::vector<std::string> getNamedTuningNames();
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -116,6 +244,16 @@ private:
   Index_type* m_real_zones;
   Index_type m_nodal_array_length;
   Index_type m_zonal_array_length;
+
+  NodeOrdering m_node_ordering;
+  std::vector<Index_type> m_node_perm;
+  Index_type* m_zone_nodes;
+
+  AccumulationMethod m_accumulation;
+  std::vector<Index_type> m_color_offsets;
+  Index_type* m_color_zones;
+  Index_type* m_gather_nodes;
+  Index_type* m_node_zones;
 };
 
 } // end namespace apps
@@ -0,0 +1,416 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_PUSH_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#if defined(__HIPCC__)
+#define ROCPRIM_HIP_API 1
+#include "rocprim/device/device_radix_sort.hpp"
+#elif defined(__CUDACC__)
+#include "cub/device/device_radix_sort.cuh"
+#endif
+
+#include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <climits>
+#include <iostream>
+#include <utility>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pic_push_deposit_keys(Real_ptr x, Real_ptr y, Index_ptr id,
+                                      Index_ptr keys, Index_ptr perm,
+                                      Index_type nx, Index_type ny,
+                                      Index_type np)
+{
+   Index_type p = blockIdx.x * block_size + threadIdx.x;
+   if (p < np) {
+     PIC_PUSH_DEPOSIT_KEY_BODY;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pic_push_deposit_permute(Real_ptr x, Real_ptr y,
+                                         Real_ptr vx, Real_ptr vy, Index_ptr id,
+                                         Real_ptr x_sorted, Real_ptr y_sorted,
+                                         Real_ptr vx_sorted, Real_ptr vy_sorted,
+                                         Index_ptr id_sorted,
+                                         Index_ptr perm, Index_type np)
+{
+   Index_type p = blockIdx.x * block_size + threadIdx.x;
+   if (p < np) {
+     PIC_PUSH_DEPOSIT_PERMUTE_BODY;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pic_push_deposit(Real_ptr x, Real_ptr y,
+                                 Real_ptr vx, Real_ptr vy,
+                                 Real_ptr ex, Real_ptr ey,
+                                 Real_ptr jx, Real_ptr jy,
+                                 Index_type nx, Index_type ny,
+                                 Real_type qdt, Real_type charge,
+                                 Index_type np)
+{
+   Index_type p = blockIdx.x * block_size + threadIdx.x;
+   if (p < np) {
+     PIC_PUSH_DEPOSIT_PUSH_BODY;
+     PIC_PUSH_DEPOSIT_RAJA_ATOMIC_DEPOSIT_BODY(RAJA::hip_atomic);
+   }
+}
+
+//
+// Particles sorted by cell deposit into a shared memory tile of the cells
+// following the cell of the first particle of the block, then each cell of
+// the tile with current is added to its nodes. Particles that drifted out
+// of the tile deposit with global atomics.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pic_push_deposit_shared(Real_ptr x, Real_ptr y,
+                                        Real_ptr vx, Real_ptr vy,
+                                        Real_ptr ex, Real_ptr ey,
+                                        Real_ptr jx, Real_ptr jy,
+                                        Index_type nx, Index_type ny,
+                                        Real_type qdt, Real_type charge,
+                                        Index_type np)
+{
+  constexpr Index_type tile_cells = (block_size < 256) ? block_size : 256;
+
+  __shared__ Real_type s_j[8*tile_cells];
+  __shared__ Index_type s_c_lo;
+
+  for (Index_type k = threadIdx.x; k < 8*tile_cells; k += block_size) {
+    s_j[k] = 0.0;
+  }
+  if (threadIdx.x == 0) {
+    const Index_type p0 = blockIdx.x * block_size;
+    // start one cell early for particles that drifted back
+    s_c_lo = PIC_PUSH_DEPOSIT_CELL(x[p0], y[p0]) - 1;
+  }
+  __syncthreads();
+
+  Index_type p = blockIdx.x * block_size + threadIdx.x;
+  if (p < np) {
+    PIC_PUSH_DEPOSIT_PUSH_BODY;
+
+    PIC_PUSH_DEPOSIT_WEIGHTS(x[p], y[p])
+    const Real_type jxp = charge*vx[p];
+    const Real_type jyp = charge*vy[p];
+
+    const Index_type tc = c - s_c_lo;
+    if (0 <= tc && tc < tile_cells) {
+      Real_type* s_jc = s_j + 8*tc;
+      RAJA::atomicAdd<RAJA::hip_atomic>(&s_jc[0], w00*jxp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&s_jc[1], w00*jyp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&s_jc[2], w10*jxp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&s_jc[3], w10*jyp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&s_jc[4], w01*jxp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&s_jc[5], w01*jyp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&s_jc[6], w11*jxp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&s_jc[7], w11*jyp);
+    } else {
+      RAJA::atomicAdd<RAJA::hip_atomic>(&jx[n00], w00*jxp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&jx[n10], w10*jxp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&jx[n01], w01*jxp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&jx[n11], w11*jxp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&jy[n00], w00*jyp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&jy[n10], w10*jyp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&jy[n01], w01*jyp);
+      RAJA::atomicAdd<RAJA::hip_atomic>(&jy[n11], w11*jyp);
+    }
+  }
+  __syncthreads();
+
+  for (Index_type k = threadIdx.x; k < 8*tile_cells; k += block_size) {
+    const Real_type val = s_j[k];
+    if (val != 0.0) {
+      const Index_type cell = s_c_lo + k/8;
+      PIC_PUSH_DEPOSIT_CELL_NODES(cell)
+      const Index_type corner = (k%8)/2;
+      const Index_type node = (corner == 0) ? n00 :
+                              (corner == 1) ? n10 :
+                              (corner == 2) ? n01 : n11;
+      Real_ptr j = (k%2 == 0) ? jx : jy;
+      RAJA::atomicAdd<RAJA::hip_atomic>(&j[node], val);
+    }
+  }
+}
+
+
+template < size_t block_size, bool launch >
+void PIC_PUSH_DEPOSIT::runHipVariantImpl(VariantID vid, Index_type sort_interval)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type np = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  PIC_PUSH_DEPOSIT_DATA_SETUP;
+  PIC_PUSH_DEPOSIT_SORT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    hipStream_t stream = res.get_stream();
+    int len = np;
+
+    // Radix sort sorts between the buffers of a double buffer
+    Index_type* keys_alt;
+    Index_type* perm_alt;
+    allocData(DataSpace::HipDevice, keys_alt, len);
+    allocData(DataSpace::HipDevice, perm_alt, len);
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+    {
+#if defined(__HIPCC__)
+      ::rocprim::double_buffer<Index_type> d_keys(keys, keys_alt);
+      ::rocprim::double_buffer<Index_type> d_values(perm, perm_alt);
+      hipErrchk(::rocprim::radix_sort_pairs(d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_keys,
+                                            d_values,
+                                            len,
+                                            0,
+                                            sizeof(Index_type)*CHAR_BIT,
+                                            stream));
+#elif defined(__CUDACC__)
+      ::cub::DoubleBuffer<Index_type> d_keys(keys, keys_alt);
+      ::cub::DoubleBuffer<Index_type> d_values(perm, perm_alt);
+      hipErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys,
+                                                  d_values,
+                                                  len,
+                                                  0,
+                                                  sizeof(Index_type)*CHAR_BIT,
+                                                  stream));
+#endif
+    }
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::HipDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(np, block_size);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if (sort_interval > 0 && irep % sort_interval == 0) {
+
+        hipLaunchKernelGGL((pic_push_deposit_keys<block_size>), dim3(grid_size), dim3(block_size), shmem, stream,
+                           x, y, id, keys, perm, nx, ny, np);
+        hipErrchk( hipGetLastError() );
+
+#if defined(__HIPCC__)
+        ::rocprim::double_buffer<Index_type> d_keys(keys, keys_alt);
+        ::rocprim::double_buffer<Index_type> d_values(perm, perm_alt);
+        hipErrchk(::rocprim::radix_sort_pairs(d_temp_storage,
+                                              temp_storage_bytes,
+                                              d_keys,
+                                              d_values,
+                                              len,
+                                              0,
+                                              sizeof(Index_type)*CHAR_BIT,
+                                              stream));
+        Index_type* sorted_perm = d_values.current();
+#elif defined(__CUDACC__)
+        ::cub::DoubleBuffer<Index_type> d_keys(keys, keys_alt);
+        ::cub::DoubleBuffer<Index_type> d_values(perm, perm_alt);
+        hipErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    d_keys,
+                                                    d_values,
+                                                    len,
+                                                    0,
+                                                    sizeof(Index_type)*CHAR_BIT,
+                                                    stream));
+        Index_type* sorted_perm = d_values.Current();
+#endif
+
+        hipLaunchKernelGGL((pic_push_deposit_permute<block_size>), dim3(grid_size), dim3(block_size), shmem, stream,
+                           x, y, vx, vy, id, x_sorted, y_sorted, vx_sorted, vy_sorted, id_sorted, sorted_perm, np);
+        hipErrchk( hipGetLastError() );
+        PIC_PUSH_DEPOSIT_SWAP_SORTED;
+
+      }
+
+      hipErrchk( hipMemsetAsync(jx, 0, sizeof(Real_type)*ncells, stream) );
+      hipErrchk( hipMemsetAsync(jy, 0, sizeof(Real_type)*ncells, stream) );
+
+      if (sort_interval > 0) {
+        hipLaunchKernelGGL((pic_push_deposit_shared<block_size>), dim3(grid_size), dim3(block_size), shmem, stream,
+                           x, y, vx, vy, ex, ey, jx, jy, nx, ny, qdt, charge, np);
+      } else {
+        hipLaunchKernelGGL((pic_push_deposit<block_size>), dim3(grid_size), dim3(block_size), shmem, stream,
+                           x, y, vx, vy, ex, ey, jx, jy, nx, ny, qdt, charge, np);
+      }
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    PIC_PUSH_DEPOSIT_DATA_STORE;
+
+    // Free temporary storage
+    deallocData(DataSpace::HipDevice, temp_storage);
+    deallocData(DataSpace::HipDevice, keys_alt);
+    deallocData(DataSpace::HipDevice, perm_alt);
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if (sort_interval > 0 && irep % sort_interval == 0) {
+
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, np), [=] __device__ (Index_type p) {
+          PIC_PUSH_DEPOSIT_KEY_BODY;
+        });
+
+        RAJA::sort_pairs< RAJA::hip_exec<block_size, true /*async*/> >( res,
+          RAJA::make_span(keys, np), RAJA::make_span(perm, np));
+
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, np), [=] __device__ (Index_type p) {
+          PIC_PUSH_DEPOSIT_PERMUTE_BODY;
+        });
+        PIC_PUSH_DEPOSIT_SWAP_SORTED;
+
+      }
+
+      gpu_launch::forall< block_size, launch >( res,
+        RAJA::RangeSegment(0, ncells), [=] __device__ (Index_type n) {
+        PIC_PUSH_DEPOSIT_ZERO_BODY;
+      });
+
+      gpu_launch::forall< block_size, launch >( res,
+        RAJA::RangeSegment(0, np), [=] __device__ (Index_type p) {
+        PIC_PUSH_DEPOSIT_PUSH_BODY;
+        PIC_PUSH_DEPOSIT_RAJA_ATOMIC_DEPOSIT_BODY(RAJA::hip_atomic);
+      });
+
+    }
+    stopTimer();
+
+    PIC_PUSH_DEPOSIT_DATA_STORE;
+
+  } else {
+     getCout() << "\n  PIC_PUSH_DEPOSIT : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+
+void PIC_PUSH_DEPOSIT::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    for (size_t s = 0; s < getSortTuningNames().size(); ++s) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantImpl<block_size>(vid, getSortInterval(s));
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
+  } else {
+
+    getCout() << "\n  PIC_PUSH_DEPOSIT : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runHipVariantImpl<block_size, true>(vid, getSortInterval(size_t(0)));
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+}
+
+void PIC_PUSH_DEPOSIT::setHipTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    for (const std::string& name : getSortTuningNames()) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, name+"_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,167 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_PUSH_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "algorithm/SortUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void PIC_PUSH_DEPOSIT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type np = getActualProblemSize();
+
+  const Index_type sort_interval = getSortInterval(tune_idx);
+
+  PIC_PUSH_DEPOSIT_DATA_SETUP;
+  PIC_PUSH_DEPOSIT_SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (sort_interval > 0 && irep % sort_interval == 0) {
+
+          #pragma omp parallel for
+          for (Index_type p = 0; p < np; ++p ) {
+            PIC_PUSH_DEPOSIT_KEY_BODY;
+          }
+
+          algorithm::ompMergeSort(perm, np, [=](Index_type a, Index_type b) {
+            return keys[a] < keys[b];
+          });
+
+          #pragma omp parallel for
+          for (Index_type p = 0; p < np; ++p ) {
+            PIC_PUSH_DEPOSIT_PERMUTE_BODY;
+          }
+          PIC_PUSH_DEPOSIT_SWAP_SORTED;
+
+        }
+
+        #pragma omp parallel
+        {
+          #pragma omp for
+          for (Index_type n = 0; n < ncells; ++n ) {
+            PIC_PUSH_DEPOSIT_ZERO_BODY;
+          }
+
+          #pragma omp for
+          for (Index_type p = 0; p < np; ++p ) {
+            PIC_PUSH_DEPOSIT_PUSH_BODY;
+
+            PIC_PUSH_DEPOSIT_WEIGHTS(x[p], y[p])
+            const Real_type jxp = charge*vx[p];
+            const Real_type jyp = charge*vy[p];
+
+            #pragma omp atomic
+            jx[n00] += w00*jxp;
+            #pragma omp atomic
+            jx[n10] += w10*jxp;
+            #pragma omp atomic
+            jx[n01] += w01*jxp;
+            #pragma omp atomic
+            jx[n11] += w11*jxp;
+            #pragma omp atomic
+            jy[n00] += w00*jyp;
+            #pragma omp atomic
+            jy[n10] += w10*jyp;
+            #pragma omp atomic
+            jy[n01] += w01*jyp;
+            #pragma omp atomic
+            jy[n11] += w11*jyp;
+          }
+        }
+
+      }
+      stopTimer();
+
+      PIC_PUSH_DEPOSIT_DATA_STORE;
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (sort_interval > 0 && irep % sort_interval == 0) {
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, np), [=](Index_type p) {
+            PIC_PUSH_DEPOSIT_KEY_BODY;
+          });
+
+          RAJA::sort_pairs<RAJA::omp_parallel_for_exec>(RAJA::make_span(keys, np),
+                                                        RAJA::make_span(perm, np));
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, np), [=](Index_type p) {
+            PIC_PUSH_DEPOSIT_PERMUTE_BODY;
+          });
+          PIC_PUSH_DEPOSIT_SWAP_SORTED;
+
+        }
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, ncells), [=](Index_type n) {
+          PIC_PUSH_DEPOSIT_ZERO_BODY;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, np), [=](Index_type p) {
+          PIC_PUSH_DEPOSIT_PUSH_BODY;
+          PIC_PUSH_DEPOSIT_RAJA_ATOMIC_DEPOSIT_BODY(RAJA::omp_atomic);
+        });
+
+      }
+      stopTimer();
+
+      PIC_PUSH_DEPOSIT_DATA_STORE;
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_PUSH_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void PIC_PUSH_DEPOSIT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getSortTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
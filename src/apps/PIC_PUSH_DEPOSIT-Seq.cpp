@@ -0,0 +1,134 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_PUSH_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void PIC_PUSH_DEPOSIT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type np = getActualProblemSize();
+
+  const Index_type sort_interval = getSortInterval(tune_idx);
+
+  PIC_PUSH_DEPOSIT_DATA_SETUP;
+  PIC_PUSH_DEPOSIT_SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (sort_interval > 0 && irep % sort_interval == 0) {
+
+          for (Index_type p = 0; p < np; ++p ) {
+            PIC_PUSH_DEPOSIT_KEY_BODY;
+          }
+
+          std::sort(perm, perm+np, [=](Index_type a, Index_type b) {
+            return keys[a] < keys[b];
+          });
+
+          for (Index_type p = 0; p < np; ++p ) {
+            PIC_PUSH_DEPOSIT_PERMUTE_BODY;
+          }
+          PIC_PUSH_DEPOSIT_SWAP_SORTED;
+
+        }
+
+        for (Index_type n = 0; n < ncells; ++n ) {
+          PIC_PUSH_DEPOSIT_ZERO_BODY;
+        }
+
+        for (Index_type p = 0; p < np; ++p ) {
+          PIC_PUSH_DEPOSIT_PUSH_BODY;
+          PIC_PUSH_DEPOSIT_DEPOSIT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      PIC_PUSH_DEPOSIT_DATA_STORE;
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (sort_interval > 0 && irep % sort_interval == 0) {
+
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, np), [=](Index_type p) {
+            PIC_PUSH_DEPOSIT_KEY_BODY;
+          });
+
+          RAJA::sort_pairs<RAJA::seq_exec>(RAJA::make_span(keys, np),
+                                           RAJA::make_span(perm, np));
+
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, np), [=](Index_type p) {
+            PIC_PUSH_DEPOSIT_PERMUTE_BODY;
+          });
+          PIC_PUSH_DEPOSIT_SWAP_SORTED;
+
+        }
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, ncells), [=](Index_type n) {
+          PIC_PUSH_DEPOSIT_ZERO_BODY;
+        });
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, np), [=](Index_type p) {
+          PIC_PUSH_DEPOSIT_PUSH_BODY;
+          PIC_PUSH_DEPOSIT_RAJA_ATOMIC_DEPOSIT_BODY(RAJA::seq_atomic);
+        });
+
+      }
+      stopTimer();
+
+      PIC_PUSH_DEPOSIT_DATA_STORE;
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PIC_PUSH_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PIC_PUSH_DEPOSIT::setSeqTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getSortTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
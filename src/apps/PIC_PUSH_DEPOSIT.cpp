@@ -0,0 +1,248 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_PUSH_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+PIC_PUSH_DEPOSIT::PIC_PUSH_DEPOSIT(const RunParams& params)
+  : KernelBase(rajaperf::Apps_PIC_PUSH_DEPOSIT, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_ppc = getKernelParam("ppc", 16, 1, std::numeric_limits<Index_type>::max());
+  m_drift = getKernelParam("drift", 10, 1, 100);
+  m_resort = getKernelParam("resort", 10, 1, std::numeric_limits<Index_type>::max());
+
+  const Index_type ncells = std::max(Index_type(1), getActualProblemSize() / m_ppc);
+  m_nx = std::max(Index_type(1), static_cast<Index_type>(std::sqrt(ncells)));
+  m_ny = std::max(Index_type(1), ncells / m_nx);
+
+  // velocities start in [-vmax, vmax] cells per step and the field changes
+  // them by a small fraction of vmax per step
+  const Real_type vmax = 0.01 * m_drift;
+  m_qdt = 1.0e-3 * vmax;
+  m_charge = 1.0 / m_ppc;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(2);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  setFLOPsPerRep(44 * getActualProblemSize());
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+  setUsesFeature(Sort);
+
+  setHasPattern(GatherScatter);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+PIC_PUSH_DEPOSIT::~PIC_PUSH_DEPOSIT()
+{
+}
+
+const std::vector<std::string>& PIC_PUSH_DEPOSIT::getSortTuningNames()
+{
+  static const std::vector<std::string> names{"unsorted", "sorted", "resort"};
+  return names;
+}
+
+//
+// Steps between sorts of the particles, 0 if they are never sorted.
+//
+Index_type PIC_PUSH_DEPOSIT::getSortInterval(size_t sort_idx) const
+{
+  switch (sort_idx) {
+    case 0 : return 0;
+    case 1 : return 1;
+    default : return m_resort;
+  }
+}
+
+Index_type PIC_PUSH_DEPOSIT::getSortInterval(const std::string& tuning_name) const
+{
+  const std::vector<std::string>& names = getSortTuningNames();
+  for (size_t s = 0; s < names.size(); ++s) {
+    if (tuning_name.compare(0, names[s].size(), names[s]) == 0) {
+      return getSortInterval(s);
+    }
+  }
+  return 0;
+}
+
+//
+// Touched data size, not actual number of stores and loads. Sorted tunings
+// add the keys, sort, and gather of the particles amortized over the steps
+// between sorts. Tunings before setting up the kernel tunings, ie. in the
+// constructor, are counted as unsorted.
+//
+Index_type PIC_PUSH_DEPOSIT::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const Index_type sort_interval = (tune_idx < getNumVariantTunings(vid))
+      ? getSortInterval(getVariantTuningName(vid, tune_idx))
+      : 0;
+
+  const Index_type np = getActualProblemSize();
+  const Index_type ncells = m_nx*m_ny;
+
+  Index_type bytes =
+      (4*sizeof(Real_type) + 4*sizeof(Real_type)) * np +
+      (0*sizeof(Real_type) + 2*sizeof(Real_type)) * ncells +
+      (2*sizeof(Real_type) + 2*sizeof(Real_type)) * ncells;
+  if (sort_interval > 0) {
+    const Index_type sort_bytes =
+        (3*sizeof(Real_type) + 1*sizeof(Index_type) +
+         2*sizeof(Index_type) + 2*sizeof(Index_type)) * np +
+        (4*sizeof(Real_type) + 2*sizeof(Index_type) +
+         4*sizeof(Real_type) + 1*sizeof(Index_type)) * np;
+    bytes += sort_bytes / sort_interval;
+  }
+  return bytes;
+}
+
+void PIC_PUSH_DEPOSIT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type np = getActualProblemSize();
+  const Index_type ncells = m_nx*m_ny;
+
+  constexpr unsigned long long x_seed = 2297;
+  constexpr unsigned long long y_seed = 2351;
+  constexpr unsigned long long vx_seed = 2417;
+  constexpr unsigned long long vy_seed = 2477;
+
+  const Real_type vmax = 0.01 * m_drift;
+
+  allocData(m_x, np, vid);
+  allocData(m_y, np, vid);
+  allocData(m_vx, np, vid);
+  allocData(m_vy, np, vid);
+  allocData(m_id, np, vid);
+  {
+    auto reset_x = scopedMoveData(m_x, np, vid);
+    auto reset_y = scopedMoveData(m_y, np, vid);
+    auto reset_vx = scopedMoveData(m_vx, np, vid);
+    auto reset_vy = scopedMoveData(m_vy, np, vid);
+    auto reset_id = scopedMoveData(m_id, np, vid);
+
+    for (Index_type p = 0; p < np; ++p) {
+      m_x[p] = m_nx * detail::counterRandValue(x_seed, p);
+      m_y[p] = m_ny * detail::counterRandValue(y_seed, p);
+      m_vx[p] = vmax * (2.0*detail::counterRandValue(vx_seed, p) - 1.0);
+      m_vy[p] = vmax * (2.0*detail::counterRandValue(vy_seed, p) - 1.0);
+      m_id[p] = p;
+    }
+  }
+
+  allocData(m_x_sorted, np, vid);
+  allocData(m_y_sorted, np, vid);
+  allocData(m_vx_sorted, np, vid);
+  allocData(m_vy_sorted, np, vid);
+  allocData(m_id_sorted, np, vid);
+  allocData(m_keys, np, vid);
+  allocData(m_perm, np, vid);
+
+  allocData(m_ex, ncells, vid);
+  allocData(m_ey, ncells, vid);
+  {
+    auto reset_ex = scopedMoveData(m_ex, ncells, vid);
+    auto reset_ey = scopedMoveData(m_ey, ncells, vid);
+
+    const Real_type two_pi = 2.0 * 3.14159265358979323846;
+    for (Index_type j = 0; j < m_ny; ++j) {
+      for (Index_type i = 0; i < m_nx; ++i) {
+        m_ex[i + m_nx*j] = std::sin(two_pi * j / m_ny);
+        m_ey[i + m_nx*j] = std::cos(two_pi * i / m_nx);
+      }
+    }
+  }
+
+  allocAndInitDataConst(m_jx, ncells, 0.0, vid);
+  allocAndInitDataConst(m_jy, ncells, 0.0, vid);
+}
+
+void PIC_PUSH_DEPOSIT::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const Index_type np = getActualProblemSize();
+  const Index_type ncells = m_nx*m_ny;
+
+  checksum[vid][tune_idx] += calcChecksum(m_jx, ncells, checksum_scale_factor , vid);
+  checksum[vid][tune_idx] += calcChecksum(m_jy, ncells, checksum_scale_factor , vid);
+
+  // undo the particle order so all tunings give the same checksum
+  auto reset_x = scopedMoveData(m_x, np, vid);
+  auto reset_y = scopedMoveData(m_y, np, vid);
+  auto reset_id = scopedMoveData(m_id, np, vid);
+
+  std::vector<Real_type> x(np);
+  std::vector<Real_type> y(np);
+  for (Index_type p = 0; p < np; ++p) {
+    x[m_id[p]] = m_x[p];
+    y[m_id[p]] = m_y[p];
+  }
+  checksum[vid][tune_idx] += detail::calcChecksum(x.data(), np, checksum_scale_factor);
+  checksum[vid][tune_idx] += detail::calcChecksum(y.data(), np, checksum_scale_factor);
+}
+
+void PIC_PUSH_DEPOSIT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+  deallocData(m_vx, vid);
+  deallocData(m_vy, vid);
+  deallocData(m_id, vid);
+
+  deallocData(m_x_sorted, vid);
+  deallocData(m_y_sorted, vid);
+  deallocData(m_vx_sorted, vid);
+  deallocData(m_vy_sorted, vid);
+  deallocData(m_id_sorted, vid);
+  deallocData(m_keys, vid);
+  deallocData(m_perm, vid);
+
+  deallocData(m_ex, vid);
+  deallocData(m_ey, vid);
+  deallocData(m_jx, vid);
+  deallocData(m_jy, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
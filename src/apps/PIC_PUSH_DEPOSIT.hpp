@@ -0,0 +1,266 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// PIC_PUSH_DEPOSIT kernel reference implementation:
+///
+/// One step of a 2D electrostatic particle-in-cell code on a periodic
+/// nx by ny grid of unit cells, with the field and current on the nodes.
+///
+/// for (Index_type n = 0; n < nx*ny; ++n ) {
+///   jx[n] = 0.0; jy[n] = 0.0;
+/// }
+/// for (Index_type p = 0; p < np; ++p ) {
+///   // gather the field at x[p], y[p] with bilinear weights of the
+///   // four nodes of the cell of the particle
+///   vx[p] += qdt * (w00*ex[n00] + w10*ex[n10] + w01*ex[n01] + w11*ex[n11]);
+///   vy[p] += qdt * (w00*ey[n00] + w10*ey[n10] + w01*ey[n01] + w11*ey[n11]);
+///   // push, wrapping periodically
+///   x[p] = wrap(x[p] + vx[p], nx);
+///   y[p] = wrap(y[p] + vy[p], ny);
+///   // deposit the current with the weights of the new position
+///   jx[n00] += w00*charge*vx[p]; ... jx[n11] += w11*charge*vx[p];
+///   jy[n00] += w00*charge*vy[p]; ... jy[n11] += w11*charge*vy[p];
+/// }
+///
+/// The deposit scatters to nodes shared by the particles of neighboring
+/// cells, so parallel variants use atomics. Tunings differ in the order of
+/// the particles,
+///
+///   unsorted -- particles stay in their random initial order
+///   sorted   -- particles are sorted by cell before every step
+///   resort   -- particles are sorted by cell every m_resort steps and
+///               drift out of order in between
+///
+/// Sorting is a key, value sort of cell*np+id by particle, then a gather of
+/// the particle arrays, and is part of the timed step. Base GPU variants
+/// of sorted tunings accumulate the current of the cells of a block in
+/// shared memory and add each cell to the nodes with one set of atomics.
+///
+/// The particles per cell, the distance moved per step as a percent of a
+/// cell, and the steps between sorts are kernel parameters, given with
+/// '--kernel-param PIC_PUSH_DEPOSIT:ppc=<n>',
+/// '--kernel-param PIC_PUSH_DEPOSIT:drift=<percent>' and
+/// '--kernel-param PIC_PUSH_DEPOSIT:resort=<steps>'.
+///
+
+#ifndef RAJAPerf_Apps_PIC_PUSH_DEPOSIT_HPP
+#define RAJAPerf_Apps_PIC_PUSH_DEPOSIT_HPP
+
+#define PIC_PUSH_DEPOSIT_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_ptr vx = m_vx; \
+  Real_ptr vy = m_vy; \
+  Index_ptr id = m_id; \
+  \
+  Real_ptr ex = m_ex; \
+  Real_ptr ey = m_ey; \
+  Real_ptr jx = m_jx; \
+  Real_ptr jy = m_jy; \
+  \
+  const Index_type nx = m_nx; \
+  const Index_type ny = m_ny; \
+  const Index_type ncells = m_nx*m_ny; \
+  const Real_type qdt = m_qdt; \
+  const Real_type charge = m_charge;
+
+#define PIC_PUSH_DEPOSIT_SORT_DATA_SETUP \
+  Real_ptr x_sorted = m_x_sorted; \
+  Real_ptr y_sorted = m_y_sorted; \
+  Real_ptr vx_sorted = m_vx_sorted; \
+  Real_ptr vy_sorted = m_vy_sorted; \
+  Index_ptr id_sorted = m_id_sorted; \
+  \
+  Index_ptr keys = m_keys; \
+  Index_ptr perm = m_perm;
+
+//
+// Sorting gathers the particles into the sorted arrays, which are then
+// swapped with the particle arrays, the arrays are stored back to the
+// members after the timed loop so the checksum reads the last ones written.
+//
+#define PIC_PUSH_DEPOSIT_SWAP_SORTED \
+  std::swap(x, x_sorted); \
+  std::swap(y, y_sorted); \
+  std::swap(vx, vx_sorted); \
+  std::swap(vy, vy_sorted); \
+  std::swap(id, id_sorted);
+
+#define PIC_PUSH_DEPOSIT_DATA_STORE \
+  m_x = x; m_x_sorted = x_sorted; \
+  m_y = y; m_y_sorted = y_sorted; \
+  m_vx = vx; m_vx_sorted = vx_sorted; \
+  m_vy = vy; m_vy_sorted = vy_sorted; \
+  m_id = id; m_id_sorted = id_sorted;
+
+#define PIC_PUSH_DEPOSIT_CELL(xp, yp) \
+  ( RAJA_MIN(static_cast<Index_type>(xp), nx-1) + \
+    nx*RAJA_MIN(static_cast<Index_type>(yp), ny-1) )
+
+#define PIC_PUSH_DEPOSIT_CELL_NODES(c) \
+  const Index_type ci = (c) % nx; \
+  const Index_type cj = (c) / nx; \
+  const Index_type ci1 = (ci+1 < nx) ? ci+1 : 0; \
+  const Index_type cj1 = (cj+1 < ny) ? cj+1 : 0; \
+  const Index_type n00 = ci + nx*cj; \
+  const Index_type n10 = ci1 + nx*cj; \
+  const Index_type n01 = ci + nx*cj1; \
+  const Index_type n11 = ci1 + nx*cj1;
+
+#define PIC_PUSH_DEPOSIT_WEIGHTS(xp, yp) \
+  const Index_type c = PIC_PUSH_DEPOSIT_CELL(xp, yp); \
+  PIC_PUSH_DEPOSIT_CELL_NODES(c) \
+  const Real_type fx = (xp) - ci; \
+  const Real_type fy = (yp) - cj; \
+  const Real_type w00 = (1.0-fx)*(1.0-fy); \
+  const Real_type w10 = fx*(1.0-fy); \
+  const Real_type w01 = (1.0-fx)*fy; \
+  const Real_type w11 = fx*fy;
+
+#define PIC_PUSH_DEPOSIT_ZERO_BODY \
+  jx[n] = 0.0; \
+  jy[n] = 0.0;
+
+#define PIC_PUSH_DEPOSIT_PUSH_BODY \
+  { \
+    PIC_PUSH_DEPOSIT_WEIGHTS(x[p], y[p]) \
+    vx[p] += qdt * (w00*ex[n00] + w10*ex[n10] + w01*ex[n01] + w11*ex[n11]); \
+    vy[p] += qdt * (w00*ey[n00] + w10*ey[n10] + w01*ey[n01] + w11*ey[n11]); \
+    Real_type xn = x[p] + vx[p]; \
+    Real_type yn = y[p] + vy[p]; \
+    xn = (xn < 0.0) ? xn + nx : ((xn >= nx) ? xn - nx : xn); \
+    yn = (yn < 0.0) ? yn + ny : ((yn >= ny) ? yn - ny : yn); \
+    x[p] = xn; \
+    y[p] = yn; \
+  }
+
+#define PIC_PUSH_DEPOSIT_DEPOSIT_BODY \
+  PIC_PUSH_DEPOSIT_WEIGHTS(x[p], y[p]) \
+  const Real_type jxp = charge*vx[p]; \
+  const Real_type jyp = charge*vy[p]; \
+  jx[n00] += w00*jxp; \
+  jx[n10] += w10*jxp; \
+  jx[n01] += w01*jxp; \
+  jx[n11] += w11*jxp; \
+  jy[n00] += w00*jyp; \
+  jy[n10] += w10*jyp; \
+  jy[n01] += w01*jyp; \
+  jy[n11] += w11*jyp;
+
+#define PIC_PUSH_DEPOSIT_RAJA_ATOMIC_DEPOSIT_BODY(policy) \
+  PIC_PUSH_DEPOSIT_WEIGHTS(x[p], y[p]) \
+  const Real_type jxp = charge*vx[p]; \
+  const Real_type jyp = charge*vy[p]; \
+  RAJA::atomicAdd<policy>(&jx[n00], w00*jxp); \
+  RAJA::atomicAdd<policy>(&jx[n10], w10*jxp); \
+  RAJA::atomicAdd<policy>(&jx[n01], w01*jxp); \
+  RAJA::atomicAdd<policy>(&jx[n11], w11*jxp); \
+  RAJA::atomicAdd<policy>(&jy[n00], w00*jyp); \
+  RAJA::atomicAdd<policy>(&jy[n10], w10*jyp); \
+  RAJA::atomicAdd<policy>(&jy[n01], w01*jyp); \
+  RAJA::atomicAdd<policy>(&jy[n11], w11*jyp);
+
+#define PIC_PUSH_DEPOSIT_KEY_BODY \
+  keys[p] = PIC_PUSH_DEPOSIT_CELL(x[p], y[p])*np + id[p]; \
+  perm[p] = p;
+
+#define PIC_PUSH_DEPOSIT_PERMUTE_BODY \
+  x_sorted[p] = x[perm[p]]; \
+  y_sorted[p] = y[perm[p]]; \
+  vx_sorted[p] = vx[perm[p]]; \
+  vy_sorted[p] = vy[perm[p]]; \
+  id_sorted[p] = id[perm[p]];
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class PIC_PUSH_DEPOSIT : public KernelBase
+{
+public:
+
+  PIC_PUSH_DEPOSIT(const RunParams& params);
+
+  ~PIC_PUSH_DEPOSIT();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PIC_PUSH_DEPOSIT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runCudaVariantImpl(VariantID vid, Index_type sort_interval);
+  template < size_t block_size, bool launch = false >
+  void runHipVariantImpl(VariantID vid, Index_type sort_interval);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  static const std::vector<std::string>& getSortTuningNames();
+  Index_type getSortInterval(size_t sort_idx) const;
+  Index_type getSortInterval(const std::string& tuning_name) const;
+
+  Index_type m_ppc;
+  Index_type m_drift;
+  Index_type m_resort;
+
+  Index_type m_nx;
+  Index_type m_ny;
+  Real_type m_qdt;
+  Real_type m_charge;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Real_ptr m_vx;
+  Real_ptr m_vy;
+  Index_ptr m_id;
+
+  Real_ptr m_x_sorted;
+  Real_ptr m_y_sorted;
+  Real_ptr m_vx_sorted;
+  Real_ptr m_vy_sorted;
+  Index_ptr m_id_sorted;
+
+  Index_ptr m_keys;
+  Index_ptr m_perm;
+
+  Real_ptr m_ex;
+  Real_ptr m_ey;
+  Real_ptr m_jx;
+  Real_ptr m_jy;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/StorageUtils.hpp"
 
 #include <iostream>
 
@@ -48,7 +50,34 @@ __global__ void pressurecalc2(Real_ptr p_new, Real_ptr bvc, Real_ptr e_old,
 }
 
 
-template < size_t block_size >
+template < typename Storage_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pressurecalc1_storage(Storage_type* bvc, Storage_type* compression,
+                                      const Real_type cls,
+                                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     PRESSURE_STORAGE_BODY1;
+   }
+}
+
+template < typename Storage_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pressurecalc2_storage(Storage_type* p_new, Storage_type* bvc,
+                                      Storage_type* e_old, Storage_type* vnewc,
+                                      const Real_type p_cut, const Real_type eosvmax,
+                                      const Real_type pmin,
+                                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     PRESSURE_STORAGE_BODY2;
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void PRESSURE::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -83,8 +112,6 @@ void PRESSURE::runCudaVariantImpl(VariantID vid)
 
   } else if ( vid == RAJA_CUDA ) {
 
-    const bool async = true;
-
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
@@ -94,12 +121,12 @@ void PRESSURE::runCudaVariantImpl(VariantID vid)
       RAJA::region<RAJA::seq_region>( [=]() {
 #endif
 
-        RAJA::forall< RAJA::cuda_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           PRESSURE_BODY1;
         });
 
-        RAJA::forall< RAJA::cuda_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           PRESSURE_BODY2;
         });
@@ -116,7 +143,49 @@ void PRESSURE::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(PRESSURE, Cuda)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(PRESSURE, Cuda, RAJA_CUDA)
+
+template < typename Storage_type >
+void PRESSURE::runCudaVariantStorage(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  PRESSURE_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       pressurecalc1_storage<Storage_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( bvc, compression,
+                                                 cls,
+                                                 iend );
+       cudaErrchk( cudaGetLastError() );
+
+       pressurecalc2_storage<Storage_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( p_new, bvc, e_old,
+                                                 vnewc,
+                                                 p_cut, eosvmax, pmin,
+                                                 iend );
+       cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PRESSURE : Unknown Cuda storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(PRESSURE, Cuda)
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/StorageUtils.hpp"
 
 #include <iostream>
 
@@ -48,7 +50,34 @@ __global__ void pressurecalc2(Real_ptr p_new, Real_ptr bvc, Real_ptr e_old,
 }
 
 
-template < size_t block_size >
+template < typename Storage_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pressurecalc1_storage(Storage_type* bvc, Storage_type* compression,
+                                      const Real_type cls,
+                                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     PRESSURE_STORAGE_BODY1;
+   }
+}
+
+template < typename Storage_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pressurecalc2_storage(Storage_type* p_new, Storage_type* bvc,
+                                      Storage_type* e_old, Storage_type* vnewc,
+                                      const Real_type p_cut, const Real_type eosvmax,
+                                      const Real_type pmin,
+                                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     PRESSURE_STORAGE_BODY2;
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void PRESSURE::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -83,18 +112,16 @@ void PRESSURE::runHipVariantImpl(VariantID vid)
 
   } else if ( vid == RAJA_HIP ) {
 
-    const bool async = true;
-
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       RAJA::region<RAJA::seq_region>( [=]() {
 
-        RAJA::forall< RAJA::hip_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           PRESSURE_BODY1;
         });
-        RAJA::forall< RAJA::hip_exec<block_size, async> >( res,
+        gpu_launch::forall< block_size, launch >( res,
           RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           PRESSURE_BODY2;
         });
@@ -109,7 +136,49 @@ void PRESSURE::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(PRESSURE, Hip)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(PRESSURE, Hip, RAJA_HIP)
+
+template < typename Storage_type >
+void PRESSURE::runHipVariantStorage(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  PRESSURE_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       hipLaunchKernelGGL((pressurecalc1_storage<Storage_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  bvc, compression,
+                                                 cls,
+                                                 iend );
+       hipErrchk( hipGetLastError() );
+
+       hipLaunchKernelGGL((pressurecalc2_storage<Storage_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  p_new, bvc, e_old,
+                                                 vnewc,
+                                                 p_cut, eosvmax, pmin,
+                                                 iend );
+       hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PRESSURE : Unknown Hip storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(PRESSURE, Hip)
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/StorageUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -121,5 +123,50 @@ void PRESSURE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+template < typename Storage_type >
+void PRESSURE::runOpenMPVariantStorage(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PRESSURE_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel
+      {
+
+        #pragma omp for schedule(static) nowait
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_STORAGE_BODY1;
+        }
+
+        #pragma omp for schedule(static) nowait
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_STORAGE_BODY2;
+        }
+
+      } // end omp parallel region
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  PRESSURE : Unknown OpenMP storage variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(PRESSURE, OpenMP)
+
 } // end namespace apps
 } // end namespace rajaperf
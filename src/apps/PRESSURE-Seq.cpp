@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SimdUtils.hpp"
+#include "common/StorageUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,8 +21,84 @@ namespace apps
 {
 
 
-void PRESSURE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PRESSURE::runSeqVariantSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PRESSURE_DATA_SETUP;
+
+#if defined(RUN_RAJA_SEQ)
+  auto pressure_lam1 = [=](Index_type i) {
+                         PRESSURE_BODY1;
+                       };
+  auto pressure_lam2 = [=](Index_type i) {
+                         PRESSURE_BODY2;
+                       };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_BODY1;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PRESSURE_BODY2;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::seq_region>( [=]() {
+
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ibegin, iend), pressure_lam1);
+
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(ibegin, iend), pressure_lam2);
+
+        }); // end sequential region (for single-source code)
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PRESSURE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PRESSURE::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -106,5 +185,46 @@ void PRESSURE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 }
 
+template < typename Storage_type >
+void PRESSURE::runSeqVariantStorage(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PRESSURE_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        PRESSURE_STORAGE_BODY1;
+      }
+
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        PRESSURE_STORAGE_BODY2;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  PRESSURE : Unknown Seq storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(PRESSURE, Seq)
+
+void PRESSURE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
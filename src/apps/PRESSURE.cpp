@@ -36,6 +36,10 @@ PRESSURE::PRESSURE(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Streaming);
+
+  setUsesStoragePrecisions();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -44,6 +48,8 @@ PRESSURE::PRESSURE(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -52,13 +58,15 @@ PRESSURE::PRESSURE(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 PRESSURE::~PRESSURE()
 {
 }
 
-void PRESSURE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PRESSURE::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitData(m_compression, getActualProblemSize(), vid);
   allocAndInitData(m_bvc, getActualProblemSize(), vid);
@@ -66,6 +74,12 @@ void PRESSURE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   allocAndInitData(m_e_old, getActualProblemSize(), vid);
   allocAndInitData(m_vnewc, getActualProblemSize(), vid);
 
+  convertDataToStorage(m_compression, getActualProblemSize(), vid, tune_idx);
+  convertDataToStorage(m_bvc, getActualProblemSize(), vid, tune_idx);
+  convertDataToStorage(m_p_new, getActualProblemSize(), vid, tune_idx);
+  convertDataToStorage(m_e_old, getActualProblemSize(), vid, tune_idx);
+  convertDataToStorage(m_vnewc, getActualProblemSize(), vid, tune_idx);
+
   initData(m_cls, vid);
   initData(m_p_cut, vid);
   initData(m_pmin, vid);
@@ -74,6 +88,7 @@ void PRESSURE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 void PRESSURE::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  convertDataFromStorage(m_p_new, getActualProblemSize(), vid, tune_idx);
   checksum[vid][tune_idx] += calcChecksum(m_p_new, getActualProblemSize(), vid);
 }
 
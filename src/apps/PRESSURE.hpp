@@ -20,6 +20,9 @@
 ///   if ( p_new[i]  <  pmin ) p_new[i]   = pmin ;
 /// }
 ///
+/// The storage tunings keep the arrays in fp32 or bf16 and compute in
+/// Real_type, see common/StorageUtils.hpp.
+///
 
 #ifndef RAJAPerf_Apps_PRESSURE_HPP
 #define RAJAPerf_Apps_PRESSURE_HPP
@@ -45,6 +48,27 @@
   if ( vnewc[i] >= eosvmax ) p_new[i] = 0.0 ; \
   if ( p_new[i]  <  pmin ) p_new[i]   = pmin ;
 
+#define PRESSURE_STORAGE_DATA_SETUP \
+  Storage_type* compression = reinterpret_cast<Storage_type*>(m_compression); \
+  Storage_type* bvc = reinterpret_cast<Storage_type*>(m_bvc); \
+  Storage_type* p_new = reinterpret_cast<Storage_type*>(m_p_new); \
+  Storage_type* e_old  = reinterpret_cast<Storage_type*>(m_e_old); \
+  Storage_type* vnewc  = reinterpret_cast<Storage_type*>(m_vnewc); \
+  const Real_type cls = m_cls; \
+  const Real_type p_cut = m_p_cut; \
+  const Real_type pmin = m_pmin; \
+  const Real_type eosvmax = m_eosvmax;
+
+#define PRESSURE_STORAGE_BODY1 \
+  bvc[i] = storage::store<Storage_type>(cls * (storage::load(compression[i]) + 1.0));
+
+#define PRESSURE_STORAGE_BODY2 \
+  Real_type p = storage::load(bvc[i]) * storage::load(e_old[i]) ; \
+  if ( fabs(p) <  p_cut ) p = 0.0 ; \
+  if ( storage::load(vnewc[i]) >= eosvmax ) p = 0.0 ; \
+  if ( p  <  pmin ) p   = pmin ; \
+  p_new[i] = storage::store<Storage_type>(p);
+
 
 #include "common/KernelBase.hpp"
 
@@ -72,14 +96,30 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
 
+  void runSeqStorageVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPStorageVariant(VariantID vid, size_t tune_idx);
+  void runCudaStorageVariant(VariantID vid, size_t tune_idx);
+  void runHipStorageVariant(VariantID vid, size_t tune_idx);
+  template < typename Storage_type >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runOpenMPVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runCudaVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runHipVariantStorage(VariantID vid);
+
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
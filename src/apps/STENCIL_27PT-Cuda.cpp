@@ -0,0 +1,615 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "STENCIL_27PT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+  //
+  // Define thread block shape for CUDA execution, blocks compute a
+  // k_block_sz x j_block_sz tile of a plane
+  //
+#define k_block_sz (32)
+#define j_block_sz (block_size / k_block_sz)
+
+#define STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA \
+  k_block_sz, j_block_sz
+
+#define STENCIL_27PT_THREADS_PER_BLOCK_CUDA \
+  dim3 nthreads_per_block(STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA, 1);
+
+#define STENCIL_27PT_NBLOCKS_CUDA \
+  dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, k_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, j_block_sz)), \
+               static_cast<size_t>(N-2));
+
+#define STENCIL_27PT_NBLOCKS_STREAM_CUDA \
+  dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, k_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, j_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, STENCIL_27PT_GPU_I_CHUNK)));
+
+
+//
+// Load the plane_k x plane_j tile of plane i of in starting at (j_lo, k_lo)
+// into s_plane, skipping points outside the grid.
+//
+template < Index_type plane_k, Index_type plane_j, size_t block_size >
+__device__ __forceinline__ void stencil_27pt_load_plane(Real_ptr s_plane,
+                                                        const Real_type* in,
+                                                        Index_type N,
+                                                        Index_type i,
+                                                        Index_type j_lo,
+                                                        Index_type k_lo)
+{
+  const Index_type tid = threadIdx.x + blockDim.x * threadIdx.y;
+  for (Index_type idx = tid; idx < plane_k*plane_j; idx += block_size) {
+    const Index_type lj = idx / plane_k;
+    const Index_type j = j_lo + lj;
+    const Index_type k = k_lo + (idx - lj*plane_k);
+    if (0 <= j && j < N && 0 <= k && k < N) {
+      s_plane[idx] = in[k + N*(j + N*i)];
+    }
+  }
+}
+
+template < size_t k_block_size, size_t j_block_size >
+__launch_bounds__(k_block_size*j_block_size)
+__global__ void stencil_27pt_naive(Real_ptr out, const Real_type* in,
+                                   Index_type N)
+{
+   Index_type i = 1 + blockIdx.z;
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (j < N-1 && k < N-1) {
+     STENCIL_27PT_BODY(out, in);
+   }
+}
+
+template < size_t k_block_size, size_t j_block_size, typename Lambda >
+__launch_bounds__(k_block_size*j_block_size)
+__global__ void stencil_27pt_lam(Index_type N, Lambda body)
+{
+   Index_type i = 1 + blockIdx.z;
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (j < N-1 && k < N-1) {
+     body(i, j, k);
+   }
+}
+
+//
+// Each block loads the three planes its tile of plane i reads, with halos,
+// into shared memory.
+//
+template < size_t k_block_size, size_t j_block_size >
+__launch_bounds__(k_block_size*j_block_size)
+__global__ void stencil_27pt_tile(Real_ptr out, const Real_type* in,
+                                  Index_type N)
+{
+  constexpr size_t block_size = k_block_size*j_block_size;
+  constexpr Index_type pk = k_block_size + 2;
+  constexpr Index_type pj = j_block_size + 2;
+  constexpr Index_type plane = pk*pj;
+
+  __shared__ Real_type s_in[3*plane];
+
+  const Index_type i = 1 + blockIdx.z;
+  const Index_type j0 = 1 + blockIdx.y * j_block_size;
+  const Index_type k0 = 1 + blockIdx.x * k_block_size;
+
+  for (Index_type p = 0; p < 3; ++p) {
+    stencil_27pt_load_plane<pk, pj, block_size>(s_in + p*plane, in, N,
+                                                i-1+p, j0-1, k0-1);
+  }
+  __syncthreads();
+
+  const Index_type j = j0 + threadIdx.y;
+  const Index_type k = k0 + threadIdx.x;
+  if (j < N-1 && k < N-1) {
+    const Index_type c = (threadIdx.x+1) + pk*(threadIdx.y+1);
+    STENCIL_27PT_POINT(out[k + N*(j + N*i)],
+                       s_in, s_in + plane, s_in + 2*plane, c, pk);
+  }
+}
+
+//
+// Each block streams its tile along STENCIL_27PT_GPU_I_CHUNK planes with a
+// queue of three planes in shared memory, loading the plane after next into
+// registers while computing the current plane.
+//
+template < size_t k_block_size, size_t j_block_size >
+__launch_bounds__(k_block_size*j_block_size)
+__global__ void stencil_27pt_stream(Real_ptr out, const Real_type* in,
+                                    Index_type N)
+{
+  constexpr size_t block_size = k_block_size*j_block_size;
+  constexpr Index_type pk = k_block_size + 2;
+  constexpr Index_type pj = j_block_size + 2;
+  constexpr Index_type plane = pk*pj;
+  constexpr Index_type loads = (plane + block_size - 1) / block_size;
+
+  __shared__ Real_type s_in[3*plane];
+
+  const Index_type i_begin = 1 + blockIdx.z * STENCIL_27PT_GPU_I_CHUNK;
+  const Index_type i_end = (i_begin + STENCIL_27PT_GPU_I_CHUNK < N-1)
+                         ? i_begin + STENCIL_27PT_GPU_I_CHUNK : N-1;
+  const Index_type j0 = 1 + blockIdx.y * j_block_size;
+  const Index_type k0 = 1 + blockIdx.x * k_block_size;
+  const Index_type tid = threadIdx.x + k_block_size * threadIdx.y;
+
+  stencil_27pt_load_plane<pk, pj, block_size>(s_in + ((i_begin-1)%3)*plane,
+                                              in, N, i_begin-1, j0-1, k0-1);
+  stencil_27pt_load_plane<pk, pj, block_size>(s_in + (i_begin%3)*plane,
+                                              in, N, i_begin, j0-1, k0-1);
+
+  Real_type next[loads];
+  for (Index_type r = 0; r < loads; ++r) {
+    const Index_type idx = tid + r*block_size;
+    const Index_type lj = idx / pk;
+    const Index_type j = j0-1 + lj;
+    const Index_type k = k0-1 + (idx - lj*pk);
+    if (idx < plane && j < N && k < N) {
+      next[r] = in[k + N*(j + N*(i_begin+1))];
+    }
+  }
+
+  const Index_type j = j0 + threadIdx.y;
+  const Index_type k = k0 + threadIdx.x;
+  const Index_type c = (threadIdx.x+1) + pk*(threadIdx.y+1);
+
+  for (Index_type i = i_begin; i < i_end; ++i) {
+
+    Real_ptr s_next = s_in + ((i+1)%3)*plane;
+    for (Index_type r = 0; r < loads; ++r) {
+      const Index_type idx = tid + r*block_size;
+      const Index_type lj = idx / pk;
+      if (idx < plane && j0-1 + lj < N && k0-1 + (idx - lj*pk) < N) {
+        s_next[idx] = next[r];
+      }
+    }
+    __syncthreads();
+
+    if (i+1 < i_end) {
+      for (Index_type r = 0; r < loads; ++r) {
+        const Index_type idx = tid + r*block_size;
+        const Index_type lj = idx / pk;
+        const Index_type jn = j0-1 + lj;
+        const Index_type kn = k0-1 + (idx - lj*pk);
+        if (idx < plane && jn < N && kn < N) {
+          next[r] = in[kn + N*(jn + N*(i+2))];
+        }
+      }
+    }
+
+    if (j < N-1 && k < N-1) {
+      STENCIL_27PT_POINT(out[k + N*(j + N*i)],
+                         s_in + ((i-1)%3)*plane, s_in + (i%3)*plane,
+                         s_next, c, pk);
+    }
+    __syncthreads();
+
+  }
+}
+
+//
+// Each block streams its tile along STENCIL_27PT_GPU_I_CHUNK planes
+// computing two timesteps, queues of three planes of the input and of the
+// first timestep on the tile with halos are kept in shared memory.
+//
+template < size_t k_block_size, size_t j_block_size >
+__launch_bounds__(k_block_size*j_block_size)
+__global__ void stencil_27pt_temporal_2(Real_ptr out, const Real_type* in,
+                                        Index_type N)
+{
+  constexpr size_t block_size = k_block_size*j_block_size;
+  constexpr Index_type pk1 = k_block_size + 2;
+  constexpr Index_type pj1 = j_block_size + 2;
+  constexpr Index_type plane1 = pk1*pj1;
+  constexpr Index_type pk2 = k_block_size + 4;
+  constexpr Index_type pj2 = j_block_size + 4;
+  constexpr Index_type plane2 = pk2*pj2;
+
+  __shared__ Real_type s_in[3*plane2];
+  __shared__ Real_type s_mid[3*plane1];
+
+  const Index_type i_begin = 1 + blockIdx.z * STENCIL_27PT_GPU_I_CHUNK;
+  const Index_type i_end = (i_begin + STENCIL_27PT_GPU_I_CHUNK < N-1)
+                         ? i_begin + STENCIL_27PT_GPU_I_CHUNK : N-1;
+  const Index_type j0 = 1 + blockIdx.y * j_block_size;
+  const Index_type k0 = 1 + blockIdx.x * k_block_size;
+  const Index_type tid = threadIdx.x + k_block_size * threadIdx.y;
+
+  const Index_type j = j0 + threadIdx.y;
+  const Index_type k = k0 + threadIdx.x;
+  const Index_type c = (threadIdx.x+1) + pk1*(threadIdx.y+1);
+
+  const Index_type p_begin = (i_begin > 1) ? i_begin-2 : 0;
+
+  //
+  // Load input plane p, compute the first timestep on plane p-1, and
+  // compute the second timestep on plane p-2.
+  //
+  for (Index_type p = p_begin; p <= i_end+1; ++p) {
+
+    if (p < N) {
+      stencil_27pt_load_plane<pk2, pj2, block_size>(s_in + (p%3)*plane2,
+                                                    in, N, p, j0-2, k0-2);
+    }
+    __syncthreads();
+
+    const Index_type q = p-1;
+    if (q >= i_begin-1) {
+      Real_ptr s_q = s_mid + (q%3)*plane1;
+      for (Index_type idx = tid; idx < plane1; idx += block_size) {
+        const Index_type lj = idx / pk1;
+        const Index_type lk = idx - lj*pk1;
+        const Index_type jq = j0-1 + lj;
+        const Index_type kq = k0-1 + lk;
+        const Index_type cq = (lk+1) + pk2*(lj+1);
+        if (jq < N && kq < N) {
+          if (q == 0 || q == N-1 || jq == 0 || jq == N-1 ||
+              kq == 0 || kq == N-1) {
+            s_q[idx] = s_in[(q%3)*plane2 + cq];
+          } else {
+            STENCIL_27PT_POINT(s_q[idx],
+                               s_in + ((q-1)%3)*plane2,
+                               s_in + (q%3)*plane2,
+                               s_in + ((q+1)%3)*plane2, cq, pk2);
+          }
+        }
+      }
+    }
+    __syncthreads();
+
+    const Index_type i = p-2;
+    if (i >= i_begin && j < N-1 && k < N-1) {
+      STENCIL_27PT_POINT(out[k + N*(j + N*i)],
+                         s_mid + ((i-1)%3)*plane1, s_mid + (i%3)*plane1,
+                         s_mid + ((i+1)%3)*plane1, c, pk1);
+    }
+
+  }
+}
+
+
+template < size_t block_size >
+void STENCIL_27PT::runCudaVariantNaive(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  STENCIL_27PT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; t += 2) {
+
+        STENCIL_27PT_THREADS_PER_BLOCK_CUDA;
+        STENCIL_27PT_NBLOCKS_CUDA;
+        constexpr size_t shmem = 0;
+
+        stencil_27pt_naive<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(B, A, N);
+        cudaErrchk( cudaGetLastError() );
+
+        stencil_27pt_naive<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; t += 2) {
+
+        STENCIL_27PT_THREADS_PER_BLOCK_CUDA;
+        STENCIL_27PT_NBLOCKS_CUDA;
+        constexpr size_t shmem = 0;
+
+        stencil_27pt_lam<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(N,
+          [=] __device__ (Index_type i, Index_type j, Index_type k) {
+            STENCIL_27PT_BODY1;
+          }
+        );
+        cudaErrchk( cudaGetLastError() );
+
+        stencil_27pt_lam<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(N,
+          [=] __device__ (Index_type i, Index_type j, Index_type k) {
+            STENCIL_27PT_BODY2;
+          }
+        );
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else if (vid == RAJA_CUDA) {
+
+    using EXEC_POL =
+      RAJA::KernelPolicy<
+        RAJA::statement::CudaKernelFixedAsync<j_block_sz * k_block_sz,
+          RAJA::statement::For<0, RAJA::cuda_block_z_direct,      // i
+            RAJA::statement::For<1, RAJA::cuda_global_size_y_direct<j_block_sz>,   // j
+              RAJA::statement::For<2, RAJA::cuda_global_size_x_direct<k_block_sz>, // k
+                RAJA::statement::Lambda<0>
+              >
+            >
+          >
+        >
+      >;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; t += 2) {
+
+        RAJA::kernel_resource<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                                 RAJA::RangeSegment{1, N-1},
+                                                 RAJA::RangeSegment{1, N-1}),
+                                         res,
+          [=] __device__ (Index_type i, Index_type j, Index_type k) {
+            STENCIL_27PT_BODY1;
+          }
+        );
+
+        RAJA::kernel_resource<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                                 RAJA::RangeSegment{1, N-1},
+                                                 RAJA::RangeSegment{1, N-1}),
+                                         res,
+          [=] __device__ (Index_type i, Index_type j, Index_type k) {
+            STENCIL_27PT_BODY2;
+          }
+        );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  STENCIL_27PT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void STENCIL_27PT::runCudaVariantTile(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  STENCIL_27PT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; t += 2) {
+
+        STENCIL_27PT_THREADS_PER_BLOCK_CUDA;
+        STENCIL_27PT_NBLOCKS_CUDA;
+        constexpr size_t shmem = 0;
+
+        stencil_27pt_tile<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(B, A, N);
+        cudaErrchk( cudaGetLastError() );
+
+        stencil_27pt_tile<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  STENCIL_27PT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void STENCIL_27PT::runCudaVariantStream(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  STENCIL_27PT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; t += 2) {
+
+        STENCIL_27PT_THREADS_PER_BLOCK_CUDA;
+        STENCIL_27PT_NBLOCKS_STREAM_CUDA;
+        constexpr size_t shmem = 0;
+
+        stencil_27pt_stream<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(B, A, N);
+        cudaErrchk( cudaGetLastError() );
+
+        stencil_27pt_stream<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  STENCIL_27PT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void STENCIL_27PT::runCudaVariantTemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  STENCIL_27PT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; t += 2*gpu_temporal_depth) {
+
+        STENCIL_27PT_THREADS_PER_BLOCK_CUDA;
+        STENCIL_27PT_NBLOCKS_STREAM_CUDA;
+        constexpr size_t shmem = 0;
+
+        stencil_27pt_temporal_2<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(B, A, N);
+        cudaErrchk( cudaGetLastError() );
+
+        stencil_27pt_temporal_2<STENCIL_27PT_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  STENCIL_27PT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void STENCIL_27PT::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantNaive<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == Base_CUDA) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantTile<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantStream<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    }
+
+  });
+
+  if (vid == Base_CUDA) {
+
+    seq_for(gpu_temporal_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantTemporal<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    });
+
+  }
+}
+
+void STENCIL_27PT::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "naive"+block_name);
+
+      if (vid == Base_CUDA) {
+        addVariantTuningName(vid, "tile"+block_name);
+        addVariantTuningName(vid, "stream"+block_name);
+      }
+
+    }
+
+  });
+
+  if (vid == Base_CUDA) {
+
+    seq_for(gpu_temporal_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, "temporal_"+std::to_string(gpu_temporal_depth)+
+                                  "_block_"+std::to_string(block_size));
+
+      }
+
+    });
+
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
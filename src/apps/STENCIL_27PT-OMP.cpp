@@ -0,0 +1,420 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "STENCIL_27PT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void STENCIL_27PT::runOpenMPVariantNaive(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  STENCIL_27PT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; t += 2) {
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type i = 1; i < N-1; ++i ) {
+            for (Index_type j = 1; j < N-1; ++j ) {
+              for (Index_type k = 1; k < N-1; ++k ) {
+                STENCIL_27PT_BODY1;
+              }
+            }
+          }
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type i = 1; i < N-1; ++i ) {
+            for (Index_type j = 1; j < N-1; ++j ) {
+              for (Index_type k = 1; k < N-1; ++k ) {
+                STENCIL_27PT_BODY2;
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto stencil_27pt_lam1 = [=](Index_type i, Index_type j, Index_type k) {
+                                 STENCIL_27PT_BODY1;
+                               };
+      auto stencil_27pt_lam2 = [=](Index_type i, Index_type j, Index_type k) {
+                                 STENCIL_27PT_BODY2;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; t += 2) {
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type i = 1; i < N-1; ++i ) {
+            for (Index_type j = 1; j < N-1; ++j ) {
+              for (Index_type k = 1; k < N-1; ++k ) {
+                stencil_27pt_lam1(i, j, k);
+              }
+            }
+          }
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type i = 1; i < N-1; ++i ) {
+            for (Index_type j = 1; j < N-1; ++j ) {
+              for (Index_type k = 1; k < N-1; ++k ) {
+                stencil_27pt_lam2(i, j, k);
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                    RAJA::ArgList<0, 1>,
+            RAJA::statement::For<2, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; t += 2) {
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                                   RAJA::RangeSegment{1, N-1},
+                                                   RAJA::RangeSegment{1, N-1}),
+            [=](Index_type i, Index_type j, Index_type k) {
+              STENCIL_27PT_BODY1;
+            }
+          );
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                                   RAJA::RangeSegment{1, N-1},
+                                                   RAJA::RangeSegment{1, N-1}),
+            [=](Index_type i, Index_type j, Index_type k) {
+              STENCIL_27PT_BODY2;
+            }
+          );
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  STENCIL_27PT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void STENCIL_27PT::runOpenMPVariantTile(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  STENCIL_27PT_DATA_SETUP;
+
+  constexpr Index_type tj = STENCIL_27PT_CPU_TILE_J;
+  constexpr Index_type tk = STENCIL_27PT_CPU_TILE_K;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; t += 2) {
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type jj = 1; jj < N-1; jj += tj ) {
+            for (Index_type kk = 1; kk < N-1; kk += tk ) {
+              for (Index_type i = 1; i < N-1; ++i ) {
+                for (Index_type j = jj; j < std::min(jj+tj, N-1); ++j ) {
+                  for (Index_type k = kk; k < std::min(kk+tk, N-1); ++k ) {
+                    STENCIL_27PT_BODY1;
+                  }
+                }
+              }
+            }
+          }
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type jj = 1; jj < N-1; jj += tj ) {
+            for (Index_type kk = 1; kk < N-1; kk += tk ) {
+              for (Index_type i = 1; i < N-1; ++i ) {
+                for (Index_type j = jj; j < std::min(jj+tj, N-1); ++j ) {
+                  for (Index_type k = kk; k < std::min(kk+tk, N-1); ++k ) {
+                    STENCIL_27PT_BODY2;
+                  }
+                }
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto stencil_27pt_lam1 = [=](Index_type i, Index_type j, Index_type k) {
+                                 STENCIL_27PT_BODY1;
+                               };
+      auto stencil_27pt_lam2 = [=](Index_type i, Index_type j, Index_type k) {
+                                 STENCIL_27PT_BODY2;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; t += 2) {
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type jj = 1; jj < N-1; jj += tj ) {
+            for (Index_type kk = 1; kk < N-1; kk += tk ) {
+              for (Index_type i = 1; i < N-1; ++i ) {
+                for (Index_type j = jj; j < std::min(jj+tj, N-1); ++j ) {
+                  for (Index_type k = kk; k < std::min(kk+tk, N-1); ++k ) {
+                    stencil_27pt_lam1(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type jj = 1; jj < N-1; jj += tj ) {
+            for (Index_type kk = 1; kk < N-1; kk += tk ) {
+              for (Index_type i = 1; i < N-1; ++i ) {
+                for (Index_type j = jj; j < std::min(jj+tj, N-1); ++j ) {
+                  for (Index_type k = kk; k < std::min(kk+tk, N-1); ++k ) {
+                    stencil_27pt_lam2(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<1, RAJA::tile_fixed<tj>, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Tile<2, RAJA::tile_fixed<tk>, RAJA::seq_exec,
+              RAJA::statement::For<0, RAJA::seq_exec,
+                RAJA::statement::For<1, RAJA::seq_exec,
+                  RAJA::statement::For<2, RAJA::seq_exec,
+                    RAJA::statement::Lambda<0>
+                  >
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; t += 2) {
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                                   RAJA::RangeSegment{1, N-1},
+                                                   RAJA::RangeSegment{1, N-1}),
+            [=](Index_type i, Index_type j, Index_type k) {
+              STENCIL_27PT_BODY1;
+            }
+          );
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                                   RAJA::RangeSegment{1, N-1},
+                                                   RAJA::RangeSegment{1, N-1}),
+            [=](Index_type i, Index_type j, Index_type k) {
+              STENCIL_27PT_BODY2;
+            }
+          );
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  STENCIL_27PT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void STENCIL_27PT::runOpenMPVariantTemporal(VariantID vid, Index_type depth)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  STENCIL_27PT_DATA_SETUP;
+
+  constexpr Index_type tile = STENCIL_27PT_CPU_TEMPORAL_TILE;
+  const Index_type box = (tile+2*depth)*(tile+2*depth)*(tile+2*depth);
+
+  // scratch tiles of each thread
+  std::vector<Real_type> scratch(2*box*omp_get_max_threads());
+  Real_ptr s = scratch.data();
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; t += 2*depth) {
+
+        #pragma omp parallel
+        {
+          Real_ptr s0 = s + 2*box*omp_get_thread_num();
+          Real_ptr s1 = s0 + box;
+
+          #pragma omp for collapse(3)
+          for (Index_type ii = 1; ii < N-1; ii += tile ) {
+            for (Index_type jj = 1; jj < N-1; jj += tile ) {
+              for (Index_type kk = 1; kk < N-1; kk += tile ) {
+                computeTemporalTile(B, A, s0, s1, N, depth, tile, ii, jj, kk);
+              }
+            }
+          }
+
+          #pragma omp for collapse(3)
+          for (Index_type ii = 1; ii < N-1; ii += tile ) {
+            for (Index_type jj = 1; jj < N-1; jj += tile ) {
+              for (Index_type kk = 1; kk < N-1; kk += tile ) {
+                computeTemporalTile(A, B, s0, s1, N, depth, tile, ii, jj, kk);
+              }
+            }
+          }
+        }
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  STENCIL_27PT : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(depth);
+#endif
+}
+
+void STENCIL_27PT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantNaive(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantTile(vid);
+  }
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+    seq_for(cpu_temporal_depths_type{}, [&](auto depth) {
+      if (tune_idx == t) {
+        runOpenMPVariantTemporal(vid, depth);
+      }
+      t += 1;
+    });
+  }
+}
+
+void STENCIL_27PT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "naive");
+  addVariantTuningName(vid, "tile");
+
+  if (vid == Base_OpenMP) {
+    seq_for(cpu_temporal_depths_type{}, [&](auto depth) {
+      addVariantTuningName(vid, "temporal_"+std::to_string(depth));
+    });
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "STENCIL_27PT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+void STENCIL_27PT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  STENCIL_27PT_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; t += 2) {
+
+        #pragma omp target is_device_ptr(A,B) device( did )
+        #pragma omp teams distribute parallel for schedule(static, 1) collapse(3)
+        for (Index_type i = 1; i < N-1; ++i ) {
+          for (Index_type j = 1; j < N-1; ++j ) {
+            for (Index_type k = 1; k < N-1; ++k ) {
+              STENCIL_27PT_BODY1;
+            }
+          }
+        }
+
+        #pragma omp target is_device_ptr(A,B) device( did )
+        #pragma omp teams distribute parallel for schedule(static, 1) collapse(3)
+        for (Index_type i = 1; i < N-1; ++i ) {
+          for (Index_type j = 1; j < N-1; ++j ) {
+            for (Index_type k = 1; k < N-1; ++k ) {
+              STENCIL_27PT_BODY2;
+            }
+          }
+        }
+
+      }
+
+    }
+    stopTimer();
+
+  } else if (vid == RAJA_OpenMPTarget) {
+
+    using EXEC_POL =
+      RAJA::KernelPolicy<
+        RAJA::statement::Collapse<RAJA::omp_target_parallel_collapse_exec,
+                                  RAJA::ArgList<0, 1, 2>,
+          RAJA::statement::Lambda<0>
+        >
+      >;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; t += 2) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                                 RAJA::RangeSegment{1, N-1},
+                                                 RAJA::RangeSegment{1, N-1}),
+          [=] (Index_type i, Index_type j, Index_type k) {
+            STENCIL_27PT_BODY1;
+          }
+        );
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                                 RAJA::RangeSegment{1, N-1},
+                                                 RAJA::RangeSegment{1, N-1}),
+          [=] (Index_type i, Index_type j, Index_type k) {
+            STENCIL_27PT_BODY2;
+          }
+        );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  STENCIL_27PT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
@@ -0,0 +1,179 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "STENCIL_27PT.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+STENCIL_27PT::STENCIL_27PT(const RunParams& params)
+  : KernelBase(rajaperf::Apps_STENCIL_27PT, params)
+{
+  Index_type N_default = 102;
+
+  setDefaultProblemSize( (N_default-2)*(N_default-2)*(N_default-2) );
+  setDefaultReps(50);
+
+  m_N = static_cast<Index_type>( std::cbrt( getTargetProblemSize() ) + 0.5 ) + 2;
+  // a multiple of twice the depth of every temporal tuning
+  m_tsteps = 8;
+
+
+  setActualProblemSize( (m_N-2) * (m_N-2) * (m_N-2) );
+
+  setItsPerRep( m_tsteps * getActualProblemSize() );
+  setKernelsPerRep( m_tsteps );
+  // each sweep writes the interior and reads the whole grid
+  setBytesPerRep( m_tsteps * ( (1*sizeof(Real_type ) + 0*sizeof(Real_type )) *
+                               (m_N-2) * (m_N-2) * (m_N-2) +
+                               (0*sizeof(Real_type ) + 1*sizeof(Real_type )) *
+                               m_N * m_N * m_N ) );
+  setFLOPsPerRep( m_tsteps * 30 * (m_N-2) * (m_N-2) * (m_N-2) );
+
+  checksum_scale_factor = 0.0001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+
+  setHasPattern(Stencil);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+STENCIL_27PT::~STENCIL_27PT()
+{
+}
+
+//
+// Temporal tunings read and write the grid once per depth timesteps.
+//
+Index_type STENCIL_27PT::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  return KernelBase::getBytesPerRep(vid, tune_idx) /
+         getTemporalDepth(vid, tune_idx);
+}
+
+Index_type STENCIL_27PT::getTemporalDepth(VariantID vid, size_t tune_idx) const
+{
+  const std::string& name = getVariantTuningName(vid, tune_idx);
+  const std::string prefix = "temporal_";
+  if (name.compare(0, prefix.size(), prefix) == 0) {
+    return std::stol(name.substr(prefix.size()));
+  }
+  return 1;
+}
+
+//
+// Compute depth timesteps from in into the
+// [i0, i0+tile) x [j0, j0+tile) x [k0, k0+tile) tile of out, clipped to the
+// interior. Intermediate timesteps are computed on the tile grown by the
+// remaining timesteps in s0 and s1, which must each hold (tile+2*depth)^3
+// values.
+//
+void STENCIL_27PT::computeTemporalTile(Real_ptr out, const Real_type* in,
+                                       Real_ptr s0, Real_ptr s1,
+                                       Index_type N, Index_type depth,
+                                       Index_type tile, Index_type i0,
+                                       Index_type j0, Index_type k0)
+{
+  const Index_type ilo = std::max(i0 - depth, Index_type(0));
+  const Index_type jlo = std::max(j0 - depth, Index_type(0));
+  const Index_type klo = std::max(k0 - depth, Index_type(0));
+  const Index_type bi = std::min(i0 + tile + depth, N) - ilo;
+  const Index_type bj = std::min(j0 + tile + depth, N) - jlo;
+  const Index_type bk = std::min(k0 + tile + depth, N) - klo;
+
+  for (Index_type i = 0; i < bi; ++i ) {
+    for (Index_type j = 0; j < bj; ++j ) {
+      for (Index_type k = 0; k < bk; ++k ) {
+        const Index_type c = k + bk*(j + bj*i);
+        s0[c] = s1[c] = in[klo+k + N*(jlo+j + N*(ilo+i))];
+      }
+    }
+  }
+
+  Real_ptr s[2] = {s0, s1};
+
+  for (Index_type step = 1; step <= depth; ++step ) {
+
+    const Index_type h = depth - step;
+    const Index_type i_end = std::min(i0 + tile + h, N-1);
+    const Index_type j_end = std::min(j0 + tile + h, N-1);
+    const Index_type k_end = std::min(k0 + tile + h, N-1);
+
+    const Real_type* src = s[(step-1) % 2];
+    Real_ptr dst = s[step % 2];
+
+    for (Index_type i = std::max(i0 - h, Index_type(1)); i < i_end; ++i ) {
+      const Real_type* im = src + bk*bj*(i-1-ilo);
+      const Real_type* ic = src + bk*bj*(i-ilo);
+      const Real_type* ip = src + bk*bj*(i+1-ilo);
+      for (Index_type j = std::max(j0 - h, Index_type(1)); j < j_end; ++j ) {
+        for (Index_type k = std::max(k0 - h, Index_type(1)); k < k_end; ++k ) {
+          const Index_type c = k-klo + bk*(j-jlo);
+          if (step < depth) {
+            STENCIL_27PT_POINT(dst[c + bk*bj*(i-ilo)], im, ic, ip, c, bk);
+          } else {
+            STENCIL_27PT_POINT(out[k + N*(j + N*i)], im, ic, ip, c, bk);
+          }
+        }
+      }
+    }
+
+  }
+}
+
+void STENCIL_27PT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_Ainit, m_N*m_N*m_N, vid);
+  allocData(m_A, m_N*m_N*m_N, vid);
+  allocData(m_B, m_N*m_N*m_N, vid);
+}
+
+void STENCIL_27PT::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_A, m_N*m_N*m_N, checksum_scale_factor , vid);
+}
+
+void STENCIL_27PT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_A, vid);
+  deallocData(m_B, vid);
+  deallocData(m_Ainit, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
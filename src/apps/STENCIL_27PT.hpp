@@ -0,0 +1,179 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// STENCIL_27PT kernel reference implementation:
+///
+/// for (Index_type t = 0; t < tsteps; t += 2) {
+///
+///   for (Index_type i = 1; i < N-1; ++i ) {
+///     for (Index_type j = 1; j < N-1; ++j ) {
+///       for (Index_type k = 1; k < N-1; ++k ) {
+///         B[i][j][k] = c0 * A[i][j][k] +
+///                      c1 * (sum of the 6 face neighbors of A[i][j][k]) +
+///                      c2 * (sum of the 12 edge neighbors of A[i][j][k]) +
+///                      c3 * (sum of the 8 corner neighbors of A[i][j][k]);
+///       }
+///     }
+///   }
+///
+///   same sweep computing A from B
+///
+/// }
+///
+/// Tunings run the sweeps directly (naive), tiled for cache or shared
+/// memory (tile), streaming planes of a tile along i through shared memory
+/// (stream, GPU only), or fused depth timesteps at a time on tiles with
+/// overlapping halos (temporal_<depth>). Boundary values of A and B are
+/// equal and never written, so every tuning computes the same result in A.
+///
+
+#ifndef RAJAPerf_Apps_STENCIL_27PT_HPP
+#define RAJAPerf_Apps_STENCIL_27PT_HPP
+
+//
+// CPU tile sizes of tile tunings (in j and k) and temporal tunings (in
+// i, j, and k), and the number of planes a GPU block streams along i.
+//
+#define STENCIL_27PT_CPU_TILE_J 16
+#define STENCIL_27PT_CPU_TILE_K 64
+#define STENCIL_27PT_CPU_TEMPORAL_TILE 16
+#define STENCIL_27PT_GPU_I_CHUNK 16
+
+#define STENCIL_27PT_DATA_SETUP \
+  Real_ptr A = m_A; \
+  Real_ptr B = m_B; \
+  \
+  copyData(getDataSpace(vid), A, getDataSpace(vid), m_Ainit, m_N*m_N*m_N); \
+  copyData(getDataSpace(vid), B, getDataSpace(vid), m_Ainit, m_N*m_N*m_N); \
+  \
+  const Index_type N = m_N; \
+  const Index_type tsteps = m_tsteps;
+
+//
+// Point c of plane ic, with planes im and ip before and after it along i
+// and a stride of js between rows along j.
+//
+#define STENCIL_27PT_POINT(out, im, ic, ip, c, js) \
+  out = 0.25 * (ic)[(c)] + \
+        0.0625 * ( (ic)[(c)-1] + (ic)[(c)+1] + \
+                   (ic)[(c)-(js)] + (ic)[(c)+(js)] + \
+                   (im)[(c)] + (ip)[(c)] ) + \
+        0.015625 * ( (ic)[(c)-(js)-1] + (ic)[(c)-(js)+1] + \
+                     (ic)[(c)+(js)-1] + (ic)[(c)+(js)+1] + \
+                     (im)[(c)-1] + (im)[(c)+1] + \
+                     (im)[(c)-(js)] + (im)[(c)+(js)] + \
+                     (ip)[(c)-1] + (ip)[(c)+1] + \
+                     (ip)[(c)-(js)] + (ip)[(c)+(js)] ) + \
+        0.0234375 * ( (im)[(c)-(js)-1] + (im)[(c)-(js)+1] + \
+                      (im)[(c)+(js)-1] + (im)[(c)+(js)+1] + \
+                      (ip)[(c)-(js)-1] + (ip)[(c)-(js)+1] + \
+                      (ip)[(c)+(js)-1] + (ip)[(c)+(js)+1] );
+
+#define STENCIL_27PT_BODY(out, in) \
+  STENCIL_27PT_POINT(out[k + N*(j + N*i)], \
+                     (in + N*N*(i-1)), (in + N*N*i), (in + N*N*(i+1)), \
+                     k + N*j, N)
+
+#define STENCIL_27PT_BODY1 \
+  STENCIL_27PT_BODY(B, A)
+
+#define STENCIL_27PT_BODY2 \
+  STENCIL_27PT_BODY(A, B)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class STENCIL_27PT : public KernelBase
+{
+public:
+
+  STENCIL_27PT(const RunParams& params);
+
+  ~STENCIL_27PT();
+
+  using KernelBase::getBytesPerRep;
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const;
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runSeqVariantNaive(VariantID vid);
+  void runSeqVariantTile(VariantID vid);
+  void runSeqVariantTemporal(VariantID vid, Index_type depth);
+  void runOpenMPVariantNaive(VariantID vid);
+  void runOpenMPVariantTile(VariantID vid);
+  void runOpenMPVariantTemporal(VariantID vid, Index_type depth);
+  static void computeTemporalTile(Real_ptr out, const Real_type* in,
+                                  Real_ptr s0, Real_ptr s1,
+                                  Index_type N, Index_type depth,
+                                  Index_type tile, Index_type i0,
+                                  Index_type j0, Index_type k0);
+
+  template < size_t block_size >
+  void runCudaVariantNaive(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantTile(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantStream(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantTemporal(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantNaive(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantTile(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantStream(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantTemporal(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+  // temporal tunings hold two tiles with halos in shared memory
+  static const size_t max_gpu_temporal_block_size = 512;
+  using gpu_temporal_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+      gpu_block_size::AllOf<gpu_block_size::MultipleOf<32>,
+                            gpu_block_size::AtMost<max_gpu_temporal_block_size>>>;
+  static const Index_type gpu_temporal_depth = 2;
+  using cpu_temporal_depths_type = camp::int_seq<Index_type, 2, 4>;
+
+  Index_type getTemporalDepth(VariantID vid, size_t tune_idx) const;
+
+  Index_type m_N;
+  Index_type m_tsteps;
+
+  Real_ptr m_A;
+  Real_ptr m_B;
+  Real_ptr m_Ainit;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
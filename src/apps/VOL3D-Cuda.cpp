@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include "AppsData.hpp"
 
@@ -49,7 +50,80 @@ __global__ void vol3d(Real_ptr vol,
 }
 
 
+template < size_t block_size, typename ptr_type >
+__launch_bounds__(block_size)
+__global__ void vol3d_layout(Real_ptr vol,
+                             const ptr_type x, const ptr_type y, const ptr_type z,
+                             const Real_type vnormq,
+                             Index_type jp, Index_type kp,
+                             Index_type ibegin, Index_type iend)
+{
+   Index_type ii = blockIdx.x * block_size + threadIdx.x;
+   Index_type i = ii + ibegin;
+   if (i < iend) {
+     VOL3D_LAYOUT_NODE_SETUP(ptr_type);
+     VOL3D_BODY;
+   }
+}
+
+
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void vol3d_node_tile(Real_ptr vol,
+                      const Real_ptr x, const Real_ptr y, const Real_ptr z,
+                      const Real_type vnormq,
+                      Index_type jp, Index_type kp, Index_type nnodes,
+                      Index_type ibegin, Index_type iend)
+{
+  static_assert(node_tile_x*node_tile_y*node_tile_z == block_size,
+                "node tile must have one zone per thread");
+
+  constexpr Index_type tjp = node_tile_x + 1;
+  constexpr Index_type tkp = tjp * (node_tile_y + 1);
+  constexpr Index_type tlen = tkp * (node_tile_z + 1);
+
+  __shared__ Real_type xs[tlen];
+  __shared__ Real_type ys[tlen];
+  __shared__ Real_type zs[tlen];
+
+  const Index_type origin = blockIdx.x * node_tile_x +
+                            blockIdx.y * node_tile_y * jp +
+                            blockIdx.z * node_tile_z * kp;
+
+  // stage the nodes of the tile and its halo
+  for (Index_type t = threadIdx.x + threadIdx.y * node_tile_x +
+                      threadIdx.z * node_tile_x * node_tile_y;
+       t < tlen; t += block_size) {
+    const Index_type n = origin + t % tjp +
+                         ((t / tjp) % (node_tile_y + 1)) * jp +
+                         (t / tkp) * kp;
+    xs[t] = (n < nnodes) ? x[n] : 0.0;
+    ys[t] = (n < nnodes) ? y[n] : 0.0;
+    zs[t] = (n < nnodes) ? z[n] : 0.0;
+  }
+  __syncthreads();
+
+  const Index_type ti = blockIdx.x * node_tile_x + threadIdx.x;
+  const Index_type tj = blockIdx.y * node_tile_y + threadIdx.y;
+  const Index_type i = origin + threadIdx.x + threadIdx.y * jp + threadIdx.z * kp;
+  if (ti < jp && tj * jp < kp && i >= ibegin && i < iend) {
+    const Index_type li = threadIdx.x + threadIdx.y * tjp + threadIdx.z * tkp;
+
+    Real_ptr x0,x1,x2,x3,x4,x5,x6,x7 ;
+    Real_ptr y0,y1,y2,y3,y4,y5,y6,y7 ;
+    Real_ptr z0,z1,z2,z3,z4,z5,z6,z7 ;
+
+    NDPTRSET(tjp, tkp, xs,x0,x1,x2,x3,x4,x5,x6,x7) ;
+    NDPTRSET(tjp, tkp, ys,y0,y1,y2,y3,y4,y5,y6,y7) ;
+    NDPTRSET(tjp, tkp, zs,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+    VOL3D_BODY_NODES(li);
+    VOL3D_BODY_ZONE(i);
+  }
+}
+
+
+template < size_t block_size, bool launch >
 void VOL3D::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -84,7 +158,7 @@ void VOL3D::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         VOL3D_BODY;
       });
@@ -97,7 +171,103 @@ void VOL3D::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(VOL3D, Cuda)
+template < size_t block_size, typename ptr_type >
+void VOL3D::runCudaVariantLayoutImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  auto res{getCudaResource()};
+
+  VOL3D_LAYOUT_DATA_SETUP(ptr_type);
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      vol3d_layout<block_size, ptr_type><<<grid_size, block_size, shmem, res.get_stream()>>>(vol,
+                                       x, y, z,
+                                       vnormq,
+                                       jp, kp,
+                                       ibegin, iend);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  VOL3D : Unknown Cuda layout variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void VOL3D::runCudaVariantLayout(VariantID vid)
+{
+  if ( m_node_layout == NodeLayout::aos ) {
+    runCudaVariantLayoutImpl<block_size, AoSPtr<3>>(vid);
+  } else {
+    runCudaVariantLayoutImpl<block_size, AoSoAPtr<3>>(vid);
+  }
+}
+
+template < size_t block_size >
+void VOL3D::runCudaVariantNodeTile(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  auto res{getCudaResource()};
+
+  VOL3D_DATA_SETUP;
+
+  const Index_type jp = m_domain->jp;
+  const Index_type kp = m_domain->kp;
+  const Index_type nnodes = m_array_length;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const dim3 nthreads(node_tile_x, node_tile_y, node_tile_z);
+      const dim3 nblocks(RAJA_DIVIDE_CEILING_INT(jp, node_tile_x),
+                         RAJA_DIVIDE_CEILING_INT(kp/jp, node_tile_y),
+                         RAJA_DIVIDE_CEILING_INT(nnodes/kp, node_tile_z));
+      constexpr size_t shmem = 0;
+
+      vol3d_node_tile<block_size><<<nblocks, nthreads, shmem, res.get_stream()>>>(vol,
+                                       x, y, z,
+                                       vnormq,
+                                       jp, kp, nnodes,
+                                       ibegin, iend);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  VOL3D : Unknown Cuda node tile variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void VOL3D::runCudaVariantNamed(VariantID vid)
+{
+  if ( m_node_tile ) {
+    runCudaVariantNodeTile<block_size>(vid);
+  } else {
+    runCudaVariantLayout<block_size>(vid);
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_NAMED_TUNING_DEFINE_BOILERPLATE(VOL3D, Cuda, Base_CUDA,
+    getNamedTuningNames(), Named, RAJA_CUDA)
 
 } // end namespace apps
 } // end namespace rajaperf
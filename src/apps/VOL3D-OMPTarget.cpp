@@ -32,6 +32,8 @@ namespace apps
 void VOL3D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = m_domain->fpz;
   const Index_type iend = m_domain->lpz+1;
 
@@ -42,13 +44,24 @@ void VOL3D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(x0,x1,x2,x3,x4,x5,x6,x7, \
-                                       y0,y1,y2,y3,y4,y5,y6,y7, \
-                                       z0,z1,z2,z3,z4,z5,z6,z7, \
-                                       vol) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin ; i < iend ; ++i ) {
-        VOL3D_BODY;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x0,x1,x2,x3,x4,x5,x6,x7, \
+                                         y0,y1,y2,y3,y4,y5,y6,y7, \
+                                         z0,z1,z2,z3,z4,z5,z6,z7, \
+                                         vol) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x0,x1,x2,x3,x4,x5,x6,x7, \
+                                         y0,y1,y2,y3,y4,y5,y6,y7, \
+                                         z0,z1,z2,z3,z4,z5,z6,z7, \
+                                         vol) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_BODY;
+        }
       }
 
     }
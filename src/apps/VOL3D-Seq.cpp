@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SimdUtils.hpp"
+
 #include "AppsData.hpp"
 
 #include <iostream>
@@ -20,7 +22,7 @@ namespace apps
 {
 
 
-void VOL3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::runSeqVariantSimd(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = m_domain->fpz;
@@ -28,6 +30,102 @@ void VOL3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   VOL3D_DATA_SETUP;
 
+#if defined(RUN_RAJA_SEQ)
+  auto vol3d_lam = [=](Index_type i) {
+                     VOL3D_BODY;
+                   };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), vol3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  VOL3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < typename ptr_type >
+void VOL3D::runSeqVariantLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  VOL3D_LAYOUT_DATA_SETUP(ptr_type);
+  VOL3D_LAYOUT_NODE_SETUP(ptr_type);
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type i = ibegin ; i < iend ; ++i ) {
+        VOL3D_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  VOL3D : Unknown layout variant id = " << vid << std::endl;
+  }
+}
+
+void VOL3D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( m_node_layout == NodeLayout::aos ) {
+    runSeqVariantLayout< AoSPtr<3> >(vid);
+    return;
+  } else if ( m_node_layout == NodeLayout::aosoa ) {
+    runSeqVariantLayout< AoSoAPtr<3> >(vid);
+    return;
+  }
+
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  VOL3D_DATA_SETUP;
+
 #if defined(RUN_RAJA_SEQ)
   auto vol3d_lam = [=](Index_type i) {
                      VOL3D_BODY;
@@ -90,5 +188,20 @@ void VOL3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void VOL3D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+  }
+
+  if ( vid == Base_Seq ) {
+    for (const std::string& name : getLayoutTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -65,6 +65,13 @@
 ///   vol[i] *= vnormq ;
 /// }
 ///
+/// The layout tunings store x, y, z in one array in the aos or aosoa
+/// NodeLayout in AppsData.hpp instead of three arrays, and read them
+/// through AoSPtr or AoSoAPtr views with the same body.
+/// The node tile tunings of the Base GPU variants stage the nodes of each
+/// block's 3D tile of zones, with its halo, in shared memory and run
+/// BODY_NODES on the shared copy and BODY_ZONE on the zone.
+///
 
 #ifndef RAJAPerf_Apps_VOL3D_HPP
 #define RAJAPerf_Apps_VOL3D_HPP
@@ -85,28 +92,48 @@
   NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ; \
   NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
 
-#define VOL3D_BODY \
-  Real_type x71 = x7[i] - x1[i] ; \
-  Real_type x72 = x7[i] - x2[i] ; \
-  Real_type x74 = x7[i] - x4[i] ; \
-  Real_type x30 = x3[i] - x0[i] ; \
-  Real_type x50 = x5[i] - x0[i] ; \
-  Real_type x60 = x6[i] - x0[i] ; \
- \
-  Real_type y71 = y7[i] - y1[i] ; \
-  Real_type y72 = y7[i] - y2[i] ; \
-  Real_type y74 = y7[i] - y4[i] ; \
-  Real_type y30 = y3[i] - y0[i] ; \
-  Real_type y50 = y5[i] - y0[i] ; \
-  Real_type y60 = y6[i] - y0[i] ; \
+#define VOL3D_LAYOUT_DATA_SETUP(ptr_type) \
+  ptr_type x = ptr_type::make(m_xyz, 0); \
+  ptr_type y = ptr_type::make(m_xyz, 1); \
+  ptr_type z = ptr_type::make(m_xyz, 2); \
+  Real_ptr vol = m_vol; \
+\
+  const Real_type vnormq = m_vnormq; \
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp;
+
+#define VOL3D_LAYOUT_NODE_SETUP(ptr_type) \
+  ptr_type x0,x1,x2,x3,x4,x5,x6,x7 ; \
+  ptr_type y0,y1,y2,y3,y4,y5,y6,y7 ; \
+  ptr_type z0,z1,z2,z3,z4,z5,z6,z7 ; \
+\
+  NDPTRSET(jp, kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ; \
+  NDPTRSET(jp, kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ; \
+  NDPTRSET(jp, kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+#define VOL3D_BODY_NODES(n) \
+  Real_type x71 = x7[n] - x1[n] ; \
+  Real_type x72 = x7[n] - x2[n] ; \
+  Real_type x74 = x7[n] - x4[n] ; \
+  Real_type x30 = x3[n] - x0[n] ; \
+  Real_type x50 = x5[n] - x0[n] ; \
+  Real_type x60 = x6[n] - x0[n] ; \
  \
-  Real_type z71 = z7[i] - z1[i] ; \
-  Real_type z72 = z7[i] - z2[i] ; \
-  Real_type z74 = z7[i] - z4[i] ; \
-  Real_type z30 = z3[i] - z0[i] ; \
-  Real_type z50 = z5[i] - z0[i] ; \
-  Real_type z60 = z6[i] - z0[i] ; \
+  Real_type y71 = y7[n] - y1[n] ; \
+  Real_type y72 = y7[n] - y2[n] ; \
+  Real_type y74 = y7[n] - y4[n] ; \
+  Real_type y30 = y3[n] - y0[n] ; \
+  Real_type y50 = y5[n] - y0[n] ; \
+  Real_type y60 = y6[n] - y0[n] ; \
  \
+  Real_type z71 = z7[n] - z1[n] ; \
+  Real_type z72 = z7[n] - z2[n] ; \
+  Real_type z74 = z7[n] - z4[n] ; \
+  Real_type z30 = z3[n] - z0[n] ; \
+  Real_type z50 = z5[n] - z0[n] ; \
+  Real_type z60 = z6[n] - z0[n] ;
+
+#define VOL3D_BODY_ZONE(i) \
   Real_type xps = x71 + x60 ; \
   Real_type yps = y71 + y60 ; \
   Real_type zps = z71 + z60 ; \
@@ -145,8 +172,16 @@
  \
   vol[i] *= vnormq ;
 
+#define VOL3D_BODY \
+  VOL3D_BODY_NODES(i) \
+  VOL3D_BODY_ZONE(i)
+
 
 #include "common/KernelBase.hpp"
+#include "AppsData.hpp"
+
+#include <string>
+#include <vector>
 
 namespace rajaperf
 {
@@ -154,7 +189,6 @@ class RunParams;
 
 namespace apps
 {
-class ADomain;
 
 class VOL3D : public KernelBase
 {
@@ -174,12 +208,37 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < typename ptr_type >
+  void runSeqVariantLayout(VariantID vid);
+  template < typename ptr_type >
+  void runOpenMPVariantLayout(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantLayout(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantLayout(VariantID vid);
+  template < size_t block_size, typename ptr_type >
+  void runCudaVariantLayoutImpl(VariantID vid);
+  template < size_t block_size, typename ptr_type >
+  void runHipVariantLayoutImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantNodeTile(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantNodeTile(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantNamed(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantNamed(VariantID vid);
+
+  static std::vector<std::string> getNamedTuningNames();
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -189,6 +248,10 @@ private:
   Real_ptr m_y;
   Real_ptr m_z;
   Real_ptr m_vol;
+  Real_ptr m_xyz;
+
+  NodeLayout m_node_layout;
+  bool m_node_tile;
 
   Real_type m_vnormq;
 
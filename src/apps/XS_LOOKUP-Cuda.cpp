@@ -0,0 +1,275 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "XS_LOOKUP.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+template < size_t block_size, XSSearch search, bool history,
+           bool read_only = false >
+__launch_bounds__(block_size)
+__global__ void xs_lookup(gpu_read_only::ptr_type<Real_type, read_only> egrid,
+                          gpu_read_only::ptr_type<Real_type, read_only> xs,
+                          gpu_read_only::ptr_type<Int_type, read_only> num_nucs,
+                          gpu_read_only::ptr_type<Int_type, read_only> mats,
+                          gpu_read_only::ptr_type<Real_type, read_only> concs,
+                          gpu_read_only::ptr_type<Real_type, read_only> union_energy,
+                          gpu_read_only::ptr_type<Int_type, read_only> union_index,
+                          gpu_read_only::ptr_type<Int_type, read_only> hash_index,
+                          gpu_read_only::ptr_type<Real_type, read_only> sample_energy,
+                          gpu_read_only::ptr_type<Int_type, read_only> sample_mat,
+                          Real_ptr out,
+                          Index_type num_nuclides, Index_type num_gridpoints,
+                          Index_type num_materials, Index_type max_nucs,
+                          Index_type num_union, Index_type hash_bins,
+                          Index_type history_lookups, Index_type num_lookups,
+                          Index_type num_items)
+{
+   Index_type w = blockIdx.x * block_size + threadIdx.x;
+   if (w < num_items) {
+     XS_LOOKUP_BODY;
+   }
+}
+
+
+template < size_t block_size, size_t lookup, bool launch >
+void XS_LOOKUP::runCudaVariantImpl(VariantID vid)
+{
+  constexpr XSSearch search = getSearch<lookup>();
+  constexpr bool history = getHistory<lookup>();
+
+  const Index_type run_reps = getRunReps();
+  const Index_type num_items = getNumItems(history);
+
+  auto res{getCudaResource()};
+
+  XS_LOOKUP_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_items, block_size);
+      constexpr size_t shmem = 0;
+      xs_lookup<block_size, search, history><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          egrid, xs, num_nucs, mats, concs,
+          union_energy, union_index, hash_index,
+          sample_energy, sample_mat, out,
+          num_nuclides, num_gridpoints, num_materials, max_nucs,
+          num_union, hash_bins, history_lookups, num_lookups,
+          num_items );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      gpu_launch::forall< block_size, launch >( res,
+        RAJA::RangeSegment(0, num_items), [=] __device__ (Index_type w) {
+        XS_LOOKUP_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  XS_LOOKUP : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+
+template < size_t block_size, size_t lookup >
+void XS_LOOKUP::runCudaVariantReadOnly(VariantID vid)
+{
+  constexpr XSSearch search = getSearch<lookup>();
+  constexpr bool history = getHistory<lookup>();
+
+  const Index_type run_reps = getRunReps();
+  const Index_type num_items = getNumItems(history);
+
+  auto res{getCudaResource()};
+
+  XS_LOOKUP_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_items, block_size);
+      constexpr size_t shmem = 0;
+      xs_lookup<block_size, search, history, true><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          egrid, xs, num_nucs, mats, concs,
+          union_energy, union_index, hash_index,
+          sample_energy, sample_mat, out,
+          num_nuclides, num_gridpoints, num_materials, max_nucs,
+          num_union, hash_bins, history_lookups, num_lookups,
+          num_items );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  XS_LOOKUP : Unknown Cuda read only variant id = " << vid << std::endl;
+  }
+}
+
+void XS_LOOKUP::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    seq_for(lookup_tunings_type{}, [&](auto lookup) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantImpl<block_size, decltype(lookup)::value>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    });
+
+    if ( vid == Base_CUDA ) {
+
+      seq_for(lookup_tunings_type{}, [&](auto lookup) {
+
+        seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            if (tune_idx == t) {
+
+              setBlockSize(block_size);
+              runCudaVariantReadOnly<block_size, decltype(lookup)::value>(vid);
+
+            }
+
+            t += 1;
+
+          }
+
+        });
+
+      });
+
+    }
+
+  } else {
+
+    getCout() << "\n  XS_LOOKUP : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runCudaVariantImpl<block_size, 0, true>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+}
+
+void XS_LOOKUP::setCudaTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    for (const std::string& name : getLookupTuningNames()) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, name+"_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
+    if ( vid == Base_CUDA ) {
+
+      for (const std::string& name : getLookupTuningNames()) {
+
+        seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            addVariantTuningName(vid, name+"_ldg_"+std::to_string(block_size));
+
+          }
+
+        });
+
+      }
+
+    }
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
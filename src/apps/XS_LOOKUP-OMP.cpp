@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "XS_LOOKUP.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < size_t lookup >
+void XS_LOOKUP::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  constexpr XSSearch search = getSearch<lookup>();
+  constexpr bool history = getHistory<lookup>();
+
+  const Index_type run_reps = getRunReps();
+  const Index_type num_items = getNumItems(history);
+
+  XS_LOOKUP_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type w = 0; w < num_items; ++w ) {
+          XS_LOOKUP_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_items), [=](Index_type w) {
+          XS_LOOKUP_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  XS_LOOKUP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void XS_LOOKUP::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(lookup_tunings_type{}, [&](auto lookup) {
+    if (tune_idx == lookup) {
+      runOpenMPVariantImpl<lookup>(vid);
+    }
+  });
+}
+
+void XS_LOOKUP::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getLookupTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "XS_LOOKUP.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < size_t lookup >
+void XS_LOOKUP::runSeqVariantImpl(VariantID vid)
+{
+  constexpr XSSearch search = getSearch<lookup>();
+  constexpr bool history = getHistory<lookup>();
+
+  const Index_type run_reps = getRunReps();
+  const Index_type num_items = getNumItems(history);
+
+  XS_LOOKUP_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 0; w < num_items; ++w ) {
+          XS_LOOKUP_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, num_items), [=](Index_type w) {
+          XS_LOOKUP_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  XS_LOOKUP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void XS_LOOKUP::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(lookup_tunings_type{}, [&](auto lookup) {
+    if (tune_idx == lookup) {
+      runSeqVariantImpl<lookup>(vid);
+    }
+  });
+}
+
+void XS_LOOKUP::setSeqTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getLookupTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,328 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "XS_LOOKUP.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+XS_LOOKUP::XS_LOOKUP(const RunParams& params)
+  : KernelBase(rajaperf::Apps_XS_LOOKUP, params)
+{
+  setDefaultProblemSize(200000);
+  setDefaultReps(10);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_num_nuclides = getKernelParam("nuclides", 68, 1,
+                                  std::numeric_limits<Int_type>::max());
+  m_num_gridpoints = getKernelParam("gridpoints", 5000, 2,
+                                    std::numeric_limits<Int_type>::max());
+  m_num_materials = getKernelParam("materials", 12, 1,
+                                   std::numeric_limits<Int_type>::max());
+  m_hash_bins = getKernelParam("hash_bins", 10000, 1,
+                               std::numeric_limits<Int_type>::max());
+  m_history_lookups = getKernelParam("history_lookups", 34, 1,
+                                     std::numeric_limits<Int_type>::max());
+
+  //
+  // The first material, the fuel, has half of the nuclides and the others
+  // up to a quarter of them, as in XSBench.
+  //
+  constexpr unsigned long long num_nucs_seed = 3593;
+
+  m_num_nucs_host.resize(m_num_materials);
+  Index_type total_nucs = 0;
+  for (Index_type m = 0; m < m_num_materials; ++m) {
+    const Index_type most = (m == 0) ? std::max(Index_type(1), m_num_nuclides/2)
+                                     : std::max(Index_type(1), m_num_nuclides/4);
+    const Index_type num = (m == 0) ? most
+        : 1 + static_cast<Index_type>(most * detail::counterRandValue(num_nucs_seed, m));
+    m_num_nucs_host[m] = static_cast<Int_type>(std::min(num, most));
+    total_nucs += m_num_nucs_host[m];
+  }
+  m_max_nucs = *std::max_element(m_num_nucs_host.begin(), m_num_nucs_host.end());
+
+  const Real_type avg_nucs = static_cast<Real_type>(total_nucs) / m_num_materials;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  setFLOPsPerRep(static_cast<Index_type>(
+      (4 + 3*XS_LOOKUP_NUM_CHANNELS) * avg_nucs * getActualProblemSize()));
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(GatherScatter);
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+XS_LOOKUP::~XS_LOOKUP()
+{
+}
+
+const std::vector<std::string>& XS_LOOKUP::getLookupTuningNames()
+{
+  static const std::vector<std::string> names{
+      "binary_event", "binary_history",
+      "unionized_event", "unionized_history",
+      "hash_event", "hash_history"};
+  return names;
+}
+
+size_t XS_LOOKUP::getLookupTuning(const std::string& tuning_name) const
+{
+  const std::vector<std::string>& names = getLookupTuningNames();
+  for (size_t l = 0; l < names.size(); ++l) {
+    if (tuning_name.compare(0, names[l].size(), names[l]) == 0) {
+      return l;
+    }
+  }
+  return 0;
+}
+
+Index_type XS_LOOKUP::getNumItems(bool history) const
+{
+  return history ? RAJA_DIVIDE_CEILING_INT(getActualProblemSize(), m_history_lookups)
+                 : getActualProblemSize();
+}
+
+//
+// Touched data size, not actual number of stores and loads. Tunings before
+// setting up the kernel tunings, ie. in the constructor, are counted as
+// binary_event.
+//
+Index_type XS_LOOKUP::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const size_t lookup = (tune_idx < getNumVariantTunings(vid))
+      ? getLookupTuning(getVariantTuningName(vid, tune_idx))
+      : 0;
+  const XSSearch search = static_cast<XSSearch>(lookup / 2);
+  const bool history = (lookup % 2) == 1;
+
+  const Index_type num_lookups = getActualProblemSize();
+  const Index_type grid_len = m_num_nuclides*m_num_gridpoints;
+
+  Index_type bytes =
+      (0*sizeof(Real_type) + (1+XS_LOOKUP_NUM_CHANNELS)*sizeof(Real_type)) * grid_len +
+      (0*sizeof(Int_type) + 2*sizeof(Int_type) + 1*sizeof(Real_type)) *
+          m_num_materials*m_max_nucs +
+      (1*sizeof(Real_type) + 0*sizeof(Real_type)) * num_lookups;
+  if (search == XSSearch::unionized) {
+    bytes += (0*sizeof(Real_type) + 1*sizeof(Real_type)) * grid_len +
+             (0*sizeof(Int_type) + 1*sizeof(Int_type)) * grid_len*m_num_nuclides;
+  } else if (search == XSSearch::hash) {
+    bytes += (0*sizeof(Int_type) + 1*sizeof(Int_type)) *
+             (m_hash_bins+1)*m_num_nuclides;
+  }
+  if (!history) {
+    bytes += (0*sizeof(Real_type) + 1*sizeof(Real_type) + 1*sizeof(Int_type)) *
+             num_lookups;
+  }
+  return bytes;
+}
+
+void XS_LOOKUP::setUp(VariantID vid, size_t tune_idx)
+{
+  const size_t lookup = getLookupTuning(getVariantTuningName(vid, tune_idx));
+  const XSSearch search = static_cast<XSSearch>(lookup / 2);
+  const bool history = (lookup % 2) == 1;
+
+  const Index_type num_lookups = getActualProblemSize();
+  const Index_type num_nuclides = m_num_nuclides;
+  const Index_type num_gridpoints = m_num_gridpoints;
+  const Index_type num_materials = m_num_materials;
+  const Index_type grid_len = num_nuclides*num_gridpoints;
+
+  constexpr unsigned long long egrid_seed = 3607;
+  constexpr unsigned long long xs_seed = 3613;
+  constexpr unsigned long long mats_seed = 3617;
+  constexpr unsigned long long concs_seed = 3623;
+
+  //
+  // Sorted energy grids in [0, 1] of each nuclide, the grids start at 0 and
+  // end at 1 so every energy in [0, 1) is inside every grid.
+  //
+  std::vector<Real_type> egrid(grid_len);
+  for (Index_type n = 0; n < num_nuclides; ++n) {
+    Real_type* ngrid = egrid.data() + n*num_gridpoints;
+    for (Index_type g = 0; g < num_gridpoints; ++g) {
+      ngrid[g] = detail::counterRandValue(egrid_seed, n*num_gridpoints + g);
+    }
+    std::sort(ngrid, ngrid + num_gridpoints);
+    ngrid[0] = 0.0;
+    ngrid[num_gridpoints-1] = 1.0;
+  }
+
+  allocData(m_egrid, grid_len, vid);
+  {
+    auto reset_egrid = scopedMoveData(m_egrid, grid_len, vid);
+    std::copy(egrid.begin(), egrid.end(), m_egrid);
+  }
+
+  allocData(m_xs, XS_LOOKUP_NUM_CHANNELS*grid_len, vid);
+  {
+    auto reset_xs = scopedMoveData(m_xs, XS_LOOKUP_NUM_CHANNELS*grid_len, vid);
+    for (Index_type j = 0; j < XS_LOOKUP_NUM_CHANNELS*grid_len; ++j) {
+      m_xs[j] = detail::counterRandValue(xs_seed, j);
+    }
+  }
+
+  const Index_type mats_len = num_materials*m_max_nucs;
+  allocData(m_num_nucs, num_materials, vid);
+  allocData(m_mats, mats_len, vid);
+  allocData(m_concs, mats_len, vid);
+  {
+    auto reset_num_nucs = scopedMoveData(m_num_nucs, num_materials, vid);
+    auto reset_mats = scopedMoveData(m_mats, mats_len, vid);
+    auto reset_concs = scopedMoveData(m_concs, mats_len, vid);
+
+    for (Index_type m = 0; m < num_materials; ++m) {
+      m_num_nucs[m] = m_num_nucs_host[m];
+      for (Index_type in = 0; in < m_max_nucs; ++in) {
+        const Index_type j = m*m_max_nucs + in;
+        m_mats[j] = static_cast<Int_type>( std::min(num_nuclides-1,
+            static_cast<Index_type>(num_nuclides * detail::counterRandValue(mats_seed, j))) );
+        m_concs[j] = detail::counterRandValue(concs_seed, j);
+      }
+    }
+  }
+
+  m_union_energy = nullptr;
+  m_union_index = nullptr;
+  if (search == XSSearch::unionized) {
+
+    std::vector<Real_type> union_energy(egrid);
+    std::sort(union_energy.begin(), union_energy.end());
+
+    allocData(m_union_energy, grid_len, vid);
+    {
+      auto reset_union_energy = scopedMoveData(m_union_energy, grid_len, vid);
+      std::copy(union_energy.begin(), union_energy.end(), m_union_energy);
+    }
+
+    // index of the largest energy of each nuclide grid not above each
+    // union energy, at most num_gridpoints-2 so there is an energy above it
+    allocData(m_union_index, grid_len*num_nuclides, vid);
+    {
+      auto reset_union_index = scopedMoveData(m_union_index, grid_len*num_nuclides, vid);
+      for (Index_type n = 0; n < num_nuclides; ++n) {
+        const Real_type* ngrid = egrid.data() + n*num_gridpoints;
+        Index_type g = 0;
+        for (Index_type u = 0; u < grid_len; ++u) {
+          while (g+1 < num_gridpoints-1 && ngrid[g+1] <= union_energy[u]) {
+            ++g;
+          }
+          m_union_index[u*num_nuclides + n] = static_cast<Int_type>(g);
+        }
+      }
+    }
+  }
+
+  m_hash_index = nullptr;
+  if (search == XSSearch::hash) {
+
+    // index of the largest energy of each nuclide grid in a bin below each
+    // bin, at most num_gridpoints-2, bins of energies are found as in the
+    // lookups so the search range of a lookup always holds its energy
+    const Index_type hash_bins = m_hash_bins;
+    const Index_type hash_len = (hash_bins+1)*num_nuclides;
+    allocData(m_hash_index, hash_len, vid);
+    {
+      auto reset_hash_index = scopedMoveData(m_hash_index, hash_len, vid);
+      for (Index_type n = 0; n < num_nuclides; ++n) {
+        const Real_type* ngrid = egrid.data() + n*num_gridpoints;
+        Index_type g = 0;
+        for (Index_type b = 0; b <= hash_bins; ++b) {
+          while (g < num_gridpoints &&
+                 RAJA_MIN(static_cast<Index_type>(ngrid[g]*hash_bins), hash_bins-1) < b) {
+            ++g;
+          }
+          m_hash_index[b*num_nuclides + n] = static_cast<Int_type>(
+              std::min(std::max(g-1, Index_type(0)), num_gridpoints-2) );
+        }
+      }
+    }
+  }
+
+  m_sample_energy = nullptr;
+  m_sample_mat = nullptr;
+  if (!history) {
+    allocData(m_sample_energy, num_lookups, vid);
+    allocData(m_sample_mat, num_lookups, vid);
+    auto reset_sample_energy = scopedMoveData(m_sample_energy, num_lookups, vid);
+    auto reset_sample_mat = scopedMoveData(m_sample_mat, num_lookups, vid);
+    for (Index_type i = 0; i < num_lookups; ++i) {
+      m_sample_energy[i] = detail::counterRandValue(xs_lookup_energy_seed, i);
+      m_sample_mat[i] =
+          XS_LOOKUP_MATERIAL(detail::counterRandValue(xs_lookup_material_seed, i));
+    }
+  }
+
+  allocAndInitDataConst(m_out, num_lookups, 0.0, vid);
+}
+
+void XS_LOOKUP::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_out, getActualProblemSize(),
+                                          checksum_scale_factor , vid);
+}
+
+void XS_LOOKUP::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+
+  deallocData(m_egrid, vid);
+  deallocData(m_xs, vid);
+  deallocData(m_num_nucs, vid);
+  deallocData(m_mats, vid);
+  deallocData(m_concs, vid);
+  if (m_union_energy != nullptr) {
+    deallocData(m_union_energy, vid);
+    deallocData(m_union_index, vid);
+  }
+  if (m_hash_index != nullptr) {
+    deallocData(m_hash_index, vid);
+  }
+  if (m_sample_energy != nullptr) {
+    deallocData(m_sample_energy, vid);
+    deallocData(m_sample_mat, vid);
+  }
+  deallocData(m_out, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,277 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// XS_LOOKUP kernel reference implementation:
+///
+/// Macroscopic cross section lookups of Monte Carlo transport, as in
+/// XSBench. Each nuclide has a sorted energy grid of num_gridpoints
+/// energies with 5 cross sections at each energy, and each material is a
+/// list of nuclides and their concentrations.
+///
+/// for (Index_type i = 0; i < num_lookups; ++i ) {
+///   Real_type e = energy of lookup i;
+///   Int_type mat = material of lookup i;
+///   Real_type macro_xs[5] = {0.0};
+///   for (Index_type in = 0; in < num_nucs[mat]; ++in ) {
+///     Index_type n = mats[mat*max_nucs + in];
+///     // largest lo with egrid[n*num_gridpoints + lo] <= e
+///     Index_type lo = search(egrid + n*num_gridpoints, e);
+///     Real_type f = interpolation fraction of e in [lo, lo+1];
+///     for (Index_type k = 0; k < 5; ++k ) {
+///       macro_xs[k] += concs[mat*max_nucs + in] *
+///                      (xs_lo[k] + f*(xs_lo+1[k] - xs_lo[k]));
+///     }
+///   }
+///   out[i] = macro_xs[0] + ... + macro_xs[4];
+/// }
+///
+/// Tunings are a search and a batching of the lookups, ie. binary_history.
+/// Searches are
+///
+///   binary    -- binary search of the energy grid of each nuclide
+///   unionized -- one binary search of the union of the energy grids, with
+///                the index into the grid of each nuclide of each union
+///                energy in a table of num_gridpoints*num_nuclides^2 entries
+///   hash      -- energies are hashed into hash_bins equal bins, each with
+///                the range of indices of each nuclide grid in the bin, so
+///                the binary search of each nuclide is over the bin
+///
+/// and batchings are
+///
+///   event     -- the energy and material of every lookup are generated
+///                into arrays before timing and each lookup is one iterate
+///   history   -- each iterate is a particle history that generates the
+///                energy and material of history_lookups lookups in turn
+///
+/// All tunings find the same grid indices, so give the same checksum. The
+/// <lookup>_ldg tunings of the Base GPU variants load the tables through
+/// the read-only data cache.
+///
+/// The table sizes are kernel parameters, given with
+/// '--kernel-param XS_LOOKUP:nuclides=<n>',
+/// '--kernel-param XS_LOOKUP:gridpoints=<n>',
+/// '--kernel-param XS_LOOKUP:materials=<n>',
+/// '--kernel-param XS_LOOKUP:hash_bins=<n>', and
+/// '--kernel-param XS_LOOKUP:history_lookups=<n>'.
+///
+
+#ifndef RAJAPerf_Apps_XS_LOOKUP_HPP
+#define RAJAPerf_Apps_XS_LOOKUP_HPP
+
+#define XS_LOOKUP_NUM_CHANNELS 5
+
+#define XS_LOOKUP_DATA_SETUP \
+  Real_ptr egrid = m_egrid; \
+  Real_ptr xs = m_xs; \
+  Int_ptr num_nucs = m_num_nucs; \
+  Int_ptr mats = m_mats; \
+  Real_ptr concs = m_concs; \
+  Real_ptr union_energy = m_union_energy; \
+  Int_ptr union_index = m_union_index; \
+  Int_ptr hash_index = m_hash_index; \
+  Real_ptr sample_energy = m_sample_energy; \
+  Int_ptr sample_mat = m_sample_mat; \
+  Real_ptr out = m_out; \
+  \
+  const Index_type num_nuclides = m_num_nuclides; \
+  const Index_type num_gridpoints = m_num_gridpoints; \
+  const Index_type num_materials = m_num_materials; \
+  const Index_type max_nucs = m_max_nucs; \
+  const Index_type num_union = m_num_nuclides*m_num_gridpoints; \
+  const Index_type hash_bins = m_hash_bins; \
+  const Index_type history_lookups = m_history_lookups; \
+  const Index_type num_lookups = getActualProblemSize();
+
+//
+// Largest lo in [lo, high) with arr[lo] <= e, where arr[lo] <= e < arr[high]
+// on entry.
+//
+#define XS_LOOKUP_BINARY_SEARCH(lo, arr, high) \
+  { \
+    Index_type hi = (high); \
+    while (hi - (lo) > 1) { \
+      const Index_type mid = ((lo) + hi) / 2; \
+      if ((arr)[mid] > e) { \
+        hi = mid; \
+      } else { \
+        (lo) = mid; \
+      } \
+    } \
+  }
+
+#define XS_LOOKUP_MATERIAL(r) \
+  static_cast<Int_type>( RAJA_MIN(static_cast<Index_type>((r)*num_materials), \
+                                  num_materials-1) )
+
+//
+// The energy and material of lookup i, generated in place by histories.
+//
+#define XS_LOOKUP_SAMPLE \
+  const Real_type e = history \
+      ? detail::counterRandValue(xs_lookup_energy_seed, i) \
+      : sample_energy[i]; \
+  const Int_type mat = history \
+      ? XS_LOOKUP_MATERIAL(detail::counterRandValue(xs_lookup_material_seed, i)) \
+      : sample_mat[i];
+
+#define XS_LOOKUP_SEARCH_BODY \
+  Real_type macro_xs[XS_LOOKUP_NUM_CHANNELS] = {0.0, 0.0, 0.0, 0.0, 0.0}; \
+  Index_type u = 0; \
+  if (search == XSSearch::unionized) { \
+    XS_LOOKUP_BINARY_SEARCH(u, union_energy, num_union-1) \
+  } \
+  const Index_type b = RAJA_MIN(static_cast<Index_type>(e*hash_bins), hash_bins-1); \
+  for (Index_type in = 0; in < num_nucs[mat]; ++in) { \
+    const Index_type n = mats[mat*max_nucs + in]; \
+    const Real_type conc = concs[mat*max_nucs + in]; \
+    const auto ngrid = egrid + n*num_gridpoints; \
+    Index_type lo = 0; \
+    if (search == XSSearch::binary) { \
+      XS_LOOKUP_BINARY_SEARCH(lo, ngrid, num_gridpoints-1) \
+    } else if (search == XSSearch::unionized) { \
+      lo = union_index[u*num_nuclides + n]; \
+    } else { \
+      lo = hash_index[b*num_nuclides + n]; \
+      XS_LOOKUP_BINARY_SEARCH(lo, ngrid, hash_index[(b+1)*num_nuclides + n]+1) \
+    } \
+    const Real_type f = (e - ngrid[lo]) / (ngrid[lo+1] - ngrid[lo]); \
+    const auto xs_lo = xs + XS_LOOKUP_NUM_CHANNELS*(n*num_gridpoints + lo); \
+    for (Index_type k = 0; k < XS_LOOKUP_NUM_CHANNELS; ++k) { \
+      macro_xs[k] += conc * (xs_lo[k] + \
+                             f*(xs_lo[k+XS_LOOKUP_NUM_CHANNELS] - xs_lo[k])); \
+    } \
+  } \
+  out[i] = macro_xs[0] + macro_xs[1] + macro_xs[2] + macro_xs[3] + macro_xs[4];
+
+//
+// Iterate w is lookup w for events, or the history_lookups lookups of
+// history w.
+//
+#define XS_LOOKUP_BODY \
+  const Index_type kend = history ? history_lookups : 1; \
+  for (Index_type k = 0; k < kend; ++k) { \
+    const Index_type i = w*kend + k; \
+    if (i < num_lookups) { \
+      XS_LOOKUP_SAMPLE \
+      XS_LOOKUP_SEARCH_BODY \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+enum struct XSSearch : int
+{
+  binary = 0,
+  unionized,
+  hash
+};
+
+constexpr unsigned long long xs_lookup_energy_seed = 3571;
+constexpr unsigned long long xs_lookup_material_seed = 3581;
+
+class XS_LOOKUP : public KernelBase
+{
+public:
+
+  XS_LOOKUP(const RunParams& params);
+
+  ~XS_LOOKUP();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  XS_LOOKUP : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t lookup >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t lookup >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, size_t lookup, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, size_t lookup >
+  void runCudaVariantReadOnly(VariantID vid);
+  template < size_t block_size, size_t lookup, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+  template < size_t block_size, size_t lookup >
+  void runHipVariantReadOnly(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  //
+  // Lookup tunings are numbered 2*search + history, in the order of
+  // getLookupTuningNames.
+  //
+  using lookup_tunings_type = camp::int_seq<size_t, 0, 1, 2, 3, 4, 5>;
+
+  template < size_t lookup >
+  static constexpr XSSearch getSearch() { return static_cast<XSSearch>(lookup / 2); }
+  template < size_t lookup >
+  static constexpr bool getHistory() { return (lookup % 2) == 1; }
+
+  static const std::vector<std::string>& getLookupTuningNames();
+  size_t getLookupTuning(const std::string& tuning_name) const;
+
+  Index_type getNumItems(bool history) const;
+
+  Index_type m_num_nuclides;
+  Index_type m_num_gridpoints;
+  Index_type m_num_materials;
+  Index_type m_hash_bins;
+  Index_type m_history_lookups;
+
+  std::vector<Int_type> m_num_nucs_host;
+  Index_type m_max_nucs;
+
+  Real_ptr m_egrid;
+  Real_ptr m_xs;
+  Int_ptr m_num_nucs;
+  Int_ptr m_mats;
+  Real_ptr m_concs;
+
+  Real_ptr m_union_energy;
+  Int_ptr m_union_index;
+  Int_ptr m_hash_index;
+
+  Real_ptr m_sample_energy;
+  Int_ptr m_sample_mat;
+
+  Real_ptr m_out;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/IndexUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include "AppsData.hpp"
 
@@ -43,6 +45,62 @@ __global__ void zonal_accumulation_3d(Real_ptr vol,
 
 
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void zonal_accumulation_3d_unstructured(Real_ptr vol, Real_ptr x,
+                      Index_ptr real_zones, Index_ptr zone_nodes,
+                      Index_type ibegin, Index_type iend)
+{
+   Index_type ii = blockIdx.x * blockDim.x + threadIdx.x + ibegin;
+   if (ii < iend) {
+     ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY_INDEX;
+     ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY;
+   }
+}
+
+
+template < typename IndexList_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void zonal_accumulation_3d_index(Real_ptr vol, Real_ptr x,
+                      IndexList_type* real_zones, IndexList_type* zone_nodes,
+                      IndexList_type ibegin, IndexList_type iend)
+{
+   IndexList_type ii = blockIdx.x * blockDim.x + threadIdx.x + ibegin;
+   if (ii < iend) {
+     ZONAL_ACCUMULATION_3D_INDEX_BODY_INDEX;
+     ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY;
+   }
+}
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void zonal_accumulation_3d_scatter_zero(Real_ptr vol,
+                      Index_ptr real_zones,
+                      Index_type ibegin, Index_type iend)
+{
+   Index_type ii = blockIdx.x * blockDim.x + threadIdx.x + ibegin;
+   if (ii < iend) {
+     ZONAL_ACCUMULATION_3D_BODY_INDEX;
+     ZONAL_ACCUMULATION_3D_SCATTER_ZERO_BODY;
+   }
+}
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void zonal_accumulation_3d_scatter(Real_ptr vol, Real_ptr x,
+                      Index_ptr real_nodes, Index_ptr node_zones,
+                      Index_type jbegin, Index_type jend)
+{
+   Index_type jj = blockIdx.x * blockDim.x + threadIdx.x + jbegin;
+   if (jj < jend) {
+     ZONAL_ACCUMULATION_3D_SCATTER_BODY_INDEX;
+     ZONAL_ACCUMULATION_3D_SCATTER_RAJA_ATOMIC_BODY(RAJA::cuda_atomic);
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void ZONAL_ACCUMULATION_3D::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -78,7 +136,7 @@ void ZONAL_ACCUMULATION_3D::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         zones, [=] __device__ (Index_type i) {
           ZONAL_ACCUMULATION_3D_BODY;
       });
@@ -91,7 +149,127 @@ void ZONAL_ACCUMULATION_3D::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(ZONAL_ACCUMULATION_3D, Cuda)
+template < size_t block_size >
+void ZONAL_ACCUMULATION_3D::runCudaVariantUnstructured(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  auto res{getCudaResource()};
+
+  ZONAL_ACCUMULATION_3D_UNSTRUCTURED_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      zonal_accumulation_3d_unstructured<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(vol, x,
+                                       real_zones, zone_nodes,
+                                       ibegin, iend);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown Cuda unstructured variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void ZONAL_ACCUMULATION_3D::runCudaVariantScatter(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+  const Index_type jbegin = 0;
+  const Index_type jend = m_domain->n_real_nodes;
+
+  auto res{getCudaResource()};
+
+  ZONAL_ACCUMULATION_3D_SCATTER_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t zero_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(jend, block_size);
+      constexpr size_t shmem = 0;
+
+      zonal_accumulation_3d_scatter_zero<block_size><<<zero_grid_size, block_size, shmem, res.get_stream()>>>(vol,
+                                       real_zones,
+                                       ibegin, iend);
+      cudaErrchk( cudaGetLastError() );
+
+      zonal_accumulation_3d_scatter<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(vol, x,
+                                       real_nodes, node_zones,
+                                       jbegin, jend);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown Cuda scatter variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void ZONAL_ACCUMULATION_3D::runCudaVariantNamed(VariantID vid)
+{
+  if ( m_accumulation == AccumulationMethod::scatter ) {
+    runCudaVariantScatter<block_size>(vid);
+  } else {
+    runCudaVariantUnstructured<block_size>(vid);
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_NAMED_TUNING_DEFINE_BOILERPLATE(ZONAL_ACCUMULATION_3D, Cuda, Base_CUDA,
+    getNamedTuningNames(), Named, RAJA_CUDA)
+
+template < typename IndexList_type >
+void ZONAL_ACCUMULATION_3D::runCudaVariantIndex(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+  const IndexList_type ibegin = 0;
+  const IndexList_type iend = static_cast<IndexList_type>(m_domain->n_real_zones);
+
+  auto res{getCudaResource()};
+
+  ZONAL_ACCUMULATION_3D_INDEX_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      zonal_accumulation_3d_index<IndexList_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(vol, x,
+                                       real_zones, zone_nodes,
+                                       ibegin, iend);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown Cuda index variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_INDEX_WIDTH_RUN_BOILERPLATE(ZONAL_ACCUMULATION_3D, Cuda)
 
 } // end namespace apps
 } // end namespace rajaperf
@@ -10,6 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/IndexUtils.hpp"
+
+#include "common/OpenMPUtils.hpp"
+
 #include "AppsData.hpp"
 
 #include <iostream>
@@ -20,10 +24,110 @@ namespace apps
 {
 
 
-void ZONAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ZONAL_ACCUMULATION_3D::runOpenMPVariantSchedule(VariantID vid, size_t schedule_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  ZONAL_ACCUMULATION_3D_DATA_SETUP;
+
+  omp_schedule::ScopedSchedule schedule(omp_schedule::getSchedules()[schedule_idx]);
+
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(runtime)
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ZONAL_ACCUMULATION_3D_BODY_INDEX;
+          ZONAL_ACCUMULATION_3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto zonal_accumulation_3d_lam = [=](Index_type ii) {
+            ZONAL_ACCUMULATION_3D_BODY_INDEX;
+            ZONAL_ACCUMULATION_3D_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(runtime)
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          zonal_accumulation_3d_lam(ii);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host::get_default()};
+      RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
+                                               working_res, RAJA::Unowned);
+
+      auto zonal_accumulation_3d_lam = [=](Index_type i) {
+                                         ZONAL_ACCUMULATION_3D_BODY;
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_parallel_for_runtime_exec>(
+          zones, zonal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(schedule_idx);
+#endif
+}
+
+void ZONAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( m_node_ordering != NodeOrdering::structured ) {
+    runOpenMPVariantUnstructured(vid);
+    return;
+  } else if ( m_accumulation == AccumulationMethod::scatter ) {
+    runOpenMPVariantScatter(vid);
+    return;
+  }
+
+  if ( tune_idx > 0 ) {
+    runOpenMPVariantSchedule(vid, tune_idx - 1);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -99,10 +203,149 @@ void ZONAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void ZONAL_ACCUMULATION_3D::runOpenMPVariantUnstructured(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  ZONAL_ACCUMULATION_3D_UNSTRUCTURED_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+        ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY_INDEX;
+        ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown unstructured variant id = " << vid << std::endl;
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void ZONAL_ACCUMULATION_3D::runOpenMPVariantScatter(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+  const Index_type jbegin = 0;
+  const Index_type jend = m_domain->n_real_nodes;
+
+  ZONAL_ACCUMULATION_3D_SCATTER_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel
+      {
+        #pragma omp for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ZONAL_ACCUMULATION_3D_BODY_INDEX;
+          ZONAL_ACCUMULATION_3D_SCATTER_ZERO_BODY;
+        }
+
+        #pragma omp for
+        for (Index_type jj = jbegin ; jj < jend ; ++jj ) {
+          ZONAL_ACCUMULATION_3D_SCATTER_BODY_INDEX;
+
+          Real_type val = 0.125 * x[n];
+
+          for (Index_type v = 0; v < 8; ++v) {
+            if (zones[v] >= 0) {
+              #pragma omp atomic
+              vol[zones[v]] += val;
+            }
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown scatter variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void ZONAL_ACCUMULATION_3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  for (omp_schedule::Schedule const& schedule : omp_schedule::getSchedules()) {
+    addVariantTuningName(vid, omp_schedule::getScheduleTuningName(schedule));
+  }
+#endif
+
+  if ( vid == Base_OpenMP ) {
+    for (const std::string& name : getNamedTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+  }
+}
+
+template < typename IndexList_type >
+void ZONAL_ACCUMULATION_3D::runOpenMPVariantIndex(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const IndexList_type ibegin = 0;
+  const IndexList_type iend = static_cast<IndexList_type>(m_domain->n_real_zones);
+
+  ZONAL_ACCUMULATION_3D_INDEX_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (IndexList_type ii = ibegin ; ii < iend ; ++ii ) {
+        ZONAL_ACCUMULATION_3D_INDEX_BODY_INDEX;
+        ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown OpenMP index variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_INDEX_WIDTH_RUN_BOILERPLATE(ZONAL_ACCUMULATION_3D, OpenMP)
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -32,6 +32,8 @@ namespace apps
 void ZONAL_ACCUMULATION_3D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
@@ -42,12 +44,22 @@ void ZONAL_ACCUMULATION_3D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPER
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(x0,x1,x2,x3,x4,x5,x6,x7, \
-                                       vol, real_zones) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-        ZONAL_ACCUMULATION_3D_BODY_INDEX;
-        ZONAL_ACCUMULATION_3D_BODY;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x0,x1,x2,x3,x4,x5,x6,x7, \
+                                         vol, real_zones) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ZONAL_ACCUMULATION_3D_BODY_INDEX;
+          ZONAL_ACCUMULATION_3D_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x0,x1,x2,x3,x4,x5,x6,x7, \
+                                         vol, real_zones) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ZONAL_ACCUMULATION_3D_BODY_INDEX;
+          ZONAL_ACCUMULATION_3D_BODY;
+        }
       }
 
     }
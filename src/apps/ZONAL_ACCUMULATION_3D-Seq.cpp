@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/IndexUtils.hpp"
+
 #include "AppsData.hpp"
 
 #include <iostream>
@@ -22,6 +24,14 @@ namespace apps
 
 void ZONAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
+  if ( m_node_ordering != NodeOrdering::structured ) {
+    runSeqVariantUnstructured(vid);
+    return;
+  } else if ( m_accumulation == AccumulationMethod::scatter ) {
+    runSeqVariantScatter(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -97,5 +107,103 @@ void ZONAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
 }
 
+void ZONAL_ACCUMULATION_3D::runSeqVariantUnstructured(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  ZONAL_ACCUMULATION_3D_UNSTRUCTURED_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+        ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY_INDEX;
+        ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown unstructured variant id = " << vid << std::endl;
+  }
+}
+
+void ZONAL_ACCUMULATION_3D::runSeqVariantScatter(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+  const Index_type jbegin = 0;
+  const Index_type jend = m_domain->n_real_nodes;
+
+  ZONAL_ACCUMULATION_3D_SCATTER_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+        ZONAL_ACCUMULATION_3D_BODY_INDEX;
+        ZONAL_ACCUMULATION_3D_SCATTER_ZERO_BODY;
+      }
+
+      for (Index_type jj = jbegin ; jj < jend ; ++jj ) {
+        ZONAL_ACCUMULATION_3D_SCATTER_BODY_INDEX;
+        ZONAL_ACCUMULATION_3D_SCATTER_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown scatter variant id = " << vid << std::endl;
+  }
+}
+
+void ZONAL_ACCUMULATION_3D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  if ( vid == Base_Seq ) {
+    for (const std::string& name : getNamedTuningNames()) {
+      addVariantTuningName(vid, name);
+    }
+  }
+}
+
+template < typename IndexList_type >
+void ZONAL_ACCUMULATION_3D::runSeqVariantIndex(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const IndexList_type ibegin = 0;
+  const IndexList_type iend = static_cast<IndexList_type>(m_domain->n_real_zones);
+
+  ZONAL_ACCUMULATION_3D_INDEX_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (IndexList_type ii = ibegin ; ii < iend ; ++ii ) {
+        ZONAL_ACCUMULATION_3D_INDEX_BODY_INDEX;
+        ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  ZONAL_ACCUMULATION_3D : Unknown Seq index variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_INDEX_WIDTH_RUN_BOILERPLATE(ZONAL_ACCUMULATION_3D, Seq)
+
 } // end namespace apps
 } // end namespace rajaperf
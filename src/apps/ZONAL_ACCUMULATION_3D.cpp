@@ -14,6 +14,7 @@
 #include "common/DataUtils.hpp"
 
 #include <cmath>
+#include <vector>
 
 
 namespace rajaperf
@@ -36,12 +37,19 @@ ZONAL_ACCUMULATION_3D::ZONAL_ACCUMULATION_3D(const RunParams& params)
 
   setActualProblemSize( m_domain->n_real_zones );
 
+  m_node_ordering = NodeOrdering::structured;
+  m_zone_nodes = nullptr;
+
+  m_accumulation = AccumulationMethod::atomic;
+  m_real_nodes = nullptr;
+  m_node_zones = nullptr;
+
+  m_width_real_zones = nullptr;
+  m_width_zone_nodes = nullptr;
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
-  // touched data size, not actual number of stores and loads
-  setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * getItsPerRep() +
-                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getItsPerRep() +
-                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_domain->n_real_nodes);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
   setFLOPsPerRep(8 * getItsPerRep());
 
   checksum_scale_factor = 0.001 *
@@ -50,6 +58,11 @@ ZONAL_ACCUMULATION_3D::ZONAL_ACCUMULATION_3D(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Stencil);
+  setHasPattern(GatherScatter);
+
+  setUsesIndexWidths();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -58,6 +71,8 @@ ZONAL_ACCUMULATION_3D::ZONAL_ACCUMULATION_3D(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -73,8 +88,70 @@ ZONAL_ACCUMULATION_3D::~ZONAL_ACCUMULATION_3D()
   delete m_domain;
 }
 
-void ZONAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// Touched data size, not actual number of stores and loads. Unstructured
+// tunings also read the connectivity, and scatter tunings zero and then
+// update the zones and read the node-to-zone connectivity. Tunings before
+// setting up the kernel tunings, ie. in the constructor, are counted as
+// structured. Index width tunings read the connectivity in their index type.
+//
+Index_type ZONAL_ACCUMULATION_3D::getBytesPerRep(VariantID vid, size_t tune_idx) const
 {
+  const IndexWidth width = getIndexWidth(vid, tune_idx);
+  if (width != IndexWidth::Default) {
+    const Index_type index_size = index_width::getIndexSize(width);
+    return (0*index_size + 1*index_size) * m_domain->n_real_zones +
+           (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_domain->n_real_zones +
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_domain->n_real_nodes +
+           (0*index_size + 8*index_size) * m_domain->n_real_zones;
+  }
+
+  const bool tuned = tune_idx < getNumVariantTunings(vid);
+  const NodeOrdering ordering = tuned
+      ? getNodeOrdering(getVariantTuningName(vid, tune_idx))
+      : NodeOrdering::structured;
+  const AccumulationMethod accumulation = tuned
+      ? getAccumulationMethod(getVariantTuningName(vid, tune_idx))
+      : AccumulationMethod::atomic;
+
+  const Index_type zones = m_domain->n_real_zones;
+  const Index_type nodes = m_domain->n_real_nodes;
+
+  if (accumulation == AccumulationMethod::scatter) {
+    return (0*sizeof(Index_type) + 1*sizeof(Index_type)) * zones +
+           (1*sizeof(Real_type) + 1*sizeof(Real_type)) * zones +
+           (0*sizeof(Index_type) + 9*sizeof(Index_type)) * nodes +
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * nodes;
+  }
+
+  Index_type bytes =
+      (0*sizeof(Index_type) + 1*sizeof(Index_type)) * zones +
+      (1*sizeof(Real_type) + 0*sizeof(Real_type)) * zones +
+      (0*sizeof(Real_type) + 1*sizeof(Real_type)) * nodes;
+  if (ordering != NodeOrdering::structured) {
+    bytes += (0*sizeof(Index_type) + 8*sizeof(Index_type)) * zones;
+  }
+  return bytes;
+}
+
+//
+// Unstructured tunings followed by the scatter tuning.
+//
+std::vector<std::string> ZONAL_ACCUMULATION_3D::getNamedTuningNames()
+{
+  std::vector<std::string> names = getUnstructuredTuningNames();
+  names.emplace_back("scatter");
+  return names;
+}
+
+void ZONAL_ACCUMULATION_3D::setUp(VariantID vid, size_t tune_idx)
+{
+  m_node_ordering = getNodeOrdering(getVariantTuningName(vid, tune_idx));
+  m_accumulation = getAccumulationMethod(getVariantTuningName(vid, tune_idx));
+  if (getIndexWidth(vid, tune_idx) != IndexWidth::Default) {
+    m_node_ordering = NodeOrdering::natural;
+  }
+
   allocAndInitDataConst(m_x, m_nodal_array_length, 1.0, vid);
   allocAndInitDataConst(m_vol, m_zonal_array_length, 0.0, vid);
   allocAndInitDataConst(m_real_zones, m_domain->n_real_zones,
@@ -85,6 +162,60 @@ void ZONAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
     setRealZones_3d(m_real_zones, *m_domain);
   }
+
+  // the nodal values are all the same, so only the connectivity depends
+  // on the node ordering
+  if (m_node_ordering != NodeOrdering::structured) {
+    std::vector<Index_type> node_perm(m_nodal_array_length);
+    setNodeOrdering_3d(node_perm.data(), m_node_ordering, *m_domain);
+
+    allocAndInitDataConst(m_zone_nodes, 8*m_domain->n_real_zones,
+                          static_cast<Index_type>(-1), vid);
+    auto reset_zn = scopedMoveData(m_zone_nodes, 8*m_domain->n_real_zones, vid);
+
+    setZoneNodes_3d(m_zone_nodes, node_perm.data(), *m_domain);
+  }
+
+  // the node-to-zone connectivity is built once here, so its cost is in
+  // the SetUp phase time and not the kernel time
+  if (m_accumulation == AccumulationMethod::scatter) {
+    allocAndInitDataConst(m_real_nodes, m_domain->n_real_nodes,
+                          static_cast<Index_type>(-1), vid);
+    allocAndInitDataConst(m_node_zones, 8*m_domain->n_real_nodes,
+                          static_cast<Index_type>(-1), vid);
+    auto reset_rn = scopedMoveData(m_real_nodes, m_domain->n_real_nodes, vid);
+    auto reset_nz = scopedMoveData(m_node_zones, 8*m_domain->n_real_nodes, vid);
+
+    setNodeZones_3d(m_real_nodes, m_node_zones, *m_domain);
+  }
+
+  if (getIndexWidth(vid, tune_idx) != IndexWidth::Default) {
+    RAJAPERF_INDEX_WIDTH_DISPATCH(getIndexWidth(vid, tune_idx), setUpIndexLists, vid);
+  }
+}
+
+template < typename IndexList_type >
+void ZONAL_ACCUMULATION_3D::setUpIndexLists(VariantID vid)
+{
+  IndexList_type* real_zones;
+  allocAndCopyIndexData(real_zones, m_real_zones, m_domain->n_real_zones, vid);
+  m_width_real_zones = real_zones;
+
+  IndexList_type* zone_nodes;
+  allocAndCopyIndexData(zone_nodes, m_zone_nodes, 8*m_domain->n_real_zones, vid);
+  m_width_zone_nodes = zone_nodes;
+}
+
+template < typename IndexList_type >
+void ZONAL_ACCUMULATION_3D::tearDownIndexLists(VariantID vid)
+{
+  IndexList_type* real_zones = static_cast<IndexList_type*>(m_width_real_zones);
+  deallocData(real_zones, vid);
+  m_width_real_zones = nullptr;
+
+  IndexList_type* zone_nodes = static_cast<IndexList_type*>(m_width_zone_nodes);
+  deallocData(zone_nodes, vid);
+  m_width_zone_nodes = nullptr;
 }
 
 void ZONAL_ACCUMULATION_3D::updateChecksum(VariantID vid, size_t tune_idx)
@@ -92,13 +223,23 @@ void ZONAL_ACCUMULATION_3D::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid].at(tune_idx) += calcChecksum(m_vol, m_zonal_array_length, checksum_scale_factor , vid);
 }
 
-void ZONAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ZONAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t tune_idx)
 {
   (void) vid;
 
   deallocData(m_x, vid);
   deallocData(m_vol, vid);
   deallocData(m_real_zones, vid);
+  if (m_zone_nodes != nullptr) {
+    deallocData(m_zone_nodes, vid);
+  }
+  if (m_real_nodes != nullptr) {
+    deallocData(m_real_nodes, vid);
+    deallocData(m_node_zones, vid);
+  }
+  if (getIndexWidth(vid, tune_idx) != IndexWidth::Default) {
+    RAJAPERF_INDEX_WIDTH_DISPATCH(getIndexWidth(vid, tune_idx), tearDownIndexLists, vid);
+  }
 }
 
 } // end namespace apps
@@ -25,6 +25,38 @@
 ///
 /// }
 ///
+/// The unstructured tunings read the eight nodes of each zone from
+/// zone-to-node connectivity, with the nodes numbered in one of the
+/// NodeOrdering orders in AppsData.hpp:
+///
+/// for (Index_type ii = ibegin; ii < iend; ++ii ) {
+///   Index_type i = real_zones[ii];
+///   Index_ptr nodes = zone_nodes + 8*ii;
+///
+///   vol[i] = 0.125 * ( x[nodes[0]] + ... + x[nodes[7]] );
+///
+/// }
+///
+/// The scatter tunings compute the same zone values from node-to-zone
+/// connectivity, the inverse of the zone gather, zeroing the zones and then
+/// adding each node to its zones with atomics:
+///
+/// for (Index_type jj = jbegin; jj < jend; ++jj ) {
+///   Index_type n = real_nodes[jj];
+///   Index_ptr zones = node_zones + 8*jj;
+///
+///   Real_type val = 0.125 * x[n];
+///   for (Index_type v = 0; v < 8; ++v) {
+///     if (zones[v] >= 0) vol[zones[v]] += val;
+///   }
+///
+/// }
+///
+/// The index width tunings of the Base variants run the unstructured zone
+/// gather with natural node ordering through copies of real_zones and the
+/// zone-to-node connectivity in 32 or 64 bit integers, with loop indices of
+/// the same type, see common/IndexUtils.hpp.
+///
 
 #ifndef RAJAPerf_Apps_ZONAL_ACCUMULATION_3D_HPP
 #define RAJAPerf_Apps_ZONAL_ACCUMULATION_3D_HPP
@@ -39,6 +71,65 @@
   \
   Index_ptr real_zones = m_real_zones;
 
+#define ZONAL_ACCUMULATION_3D_UNSTRUCTURED_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  Index_ptr real_zones = m_real_zones; \
+  Index_ptr zone_nodes = m_zone_nodes;
+
+#define ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY_INDEX \
+  Index_type i = real_zones[ii]; \
+  Index_ptr nodes = zone_nodes + 8*ii;
+
+#define ZONAL_ACCUMULATION_3D_UNSTRUCTURED_BODY \
+  vol[i] = 0.125 * ( x[nodes[0]] + \
+                     x[nodes[1]] + \
+                     x[nodes[2]] + \
+                     x[nodes[3]] + \
+                     x[nodes[4]] + \
+                     x[nodes[5]] + \
+                     x[nodes[6]] + \
+                     x[nodes[7]] );
+
+#define ZONAL_ACCUMULATION_3D_INDEX_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  IndexList_type* real_zones = static_cast<IndexList_type*>(m_width_real_zones); \
+  IndexList_type* zone_nodes = static_cast<IndexList_type*>(m_width_zone_nodes);
+
+#define ZONAL_ACCUMULATION_3D_INDEX_BODY_INDEX \
+  IndexList_type i = real_zones[ii]; \
+  IndexList_type* nodes = zone_nodes + 8*ii;
+
+#define ZONAL_ACCUMULATION_3D_SCATTER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  Index_ptr real_zones = m_real_zones; \
+  Index_ptr real_nodes = m_real_nodes; \
+  Index_ptr node_zones = m_node_zones;
+
+#define ZONAL_ACCUMULATION_3D_SCATTER_ZERO_BODY \
+  vol[i] = 0.0;
+
+#define ZONAL_ACCUMULATION_3D_SCATTER_BODY_INDEX \
+  Index_type n = real_nodes[jj]; \
+  Index_ptr zones = node_zones + 8*jj;
+
+#define ZONAL_ACCUMULATION_3D_SCATTER_BODY \
+  Real_type val = 0.125 * x[n]; \
+  for (Index_type v = 0; v < 8; ++v) { \
+    if (zones[v] >= 0) vol[zones[v]] += val; \
+  }
+
+#define ZONAL_ACCUMULATION_3D_SCATTER_RAJA_ATOMIC_BODY(policy) \
+  Real_type val = 0.125 * x[n]; \
+  for (Index_type v = 0; v < 8; ++v) { \
+    if (zones[v] >= 0) RAJA::atomicAdd<policy>(&vol[zones[v]], val); \
+  }
+
 #define ZONAL_ACCUMULATION_3D_BODY_INDEX \
   Index_type i = real_zones[ii];
 
@@ -55,6 +146,10 @@
 
 
 #include "common/KernelBase.hpp"
+#include "AppsData.hpp"
+
+#include <string>
+#include <vector>
 
 namespace rajaperf
 {
@@ -62,7 +157,6 @@ class RunParams;
 
 namespace apps
 {
-class ADomain;
 
 class ZONAL_ACCUMULATION_3D : public KernelBase
 {
@@ -76,18 +170,54 @@ public:
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
 
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
   void runSeqVariant(VariantID vid, size_t tune_idx);
   void runOpenMPVariant(VariantID vid, size_t tune_idx);
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  void runOpenMPVariantSchedule(VariantID vid, size_t schedule_idx);
+  void runSeqVariantUnstructured(VariantID vid);
+  void runOpenMPVariantUnstructured(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantUnstructured(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantUnstructured(VariantID vid);
+  void runSeqVariantScatter(VariantID vid);
+  void runOpenMPVariantScatter(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantScatter(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantScatter(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantNamed(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantNamed(VariantID vid);
+
+  void runSeqIndexVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPIndexVariant(VariantID vid, size_t tune_idx);
+  void runCudaIndexVariant(VariantID vid, size_t tune_idx);
+  void runHipIndexVariant(VariantID vid, size_t tune_idx);
+  template < typename IndexList_type >
+  void runSeqVariantIndex(VariantID vid);
+  template < typename IndexList_type >
+  void runOpenMPVariantIndex(VariantID vid);
+  template < typename IndexList_type >
+  void runCudaVariantIndex(VariantID vid);
+  template < typename IndexList_type >
+  void runHipVariantIndex(VariantID vid);
+
+  static std::vector<std::string> getNamedTuningNames();
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -100,6 +230,23 @@ private:
   Index_type* m_real_zones;
   Index_type m_nodal_array_length;
   Index_type m_zonal_array_length;
+
+  NodeOrdering m_node_ordering;
+  Index_type* m_zone_nodes;
+
+  AccumulationMethod m_accumulation;
+  Index_type* m_real_nodes;
+  Index_type* m_node_zones;
+
+  // copies of real_zones and zone_nodes of index width tunings, arrays of
+  // IndexList_type
+  void* m_width_real_zones;
+  void* m_width_zone_nodes;
+
+  template < typename IndexList_type >
+  void setUpIndexLists(VariantID vid);
+  template < typename IndexList_type >
+  void tearDownIndexLists(VariantID vid);
 };
 
 } // end namespace apps
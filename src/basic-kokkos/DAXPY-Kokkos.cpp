@@ -23,7 +23,8 @@ struct DaxpyFunctor {
   void operator()(Index_type i) const { DAXPY_BODY; }
 };
 
-void DAXPY::runKokkosVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < typename Data_type >
+void DAXPY::runKokkosVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -64,6 +65,8 @@ void DAXPY::runKokkosVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
   moveDataToHostFromKokkosView(y, y_view, iend);
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DAXPY, Kokkos)
+
 } // end namespace basic
 } // end namespace rajaperf
 #endif
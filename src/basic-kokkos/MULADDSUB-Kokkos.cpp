@@ -15,7 +15,8 @@
 namespace rajaperf {
 namespace basic {
 
-void MULADDSUB::runKokkosVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < typename Data_type >
+void MULADDSUB::runKokkosVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -67,6 +68,8 @@ void MULADDSUB::runKokkosVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   moveDataToHostFromKokkosView(in2, in2_view, iend);
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(MULADDSUB, Kokkos)
+
 } // end namespace basic
 } // end namespace rajaperf
 #endif
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -21,9 +22,14 @@ namespace rajaperf
 namespace basic
 {
 
-template < size_t block_size >
+//
+// Pointers in constant memory, used by the constant tunings.
+//
+__constant__ Real_ptr array_of_ptrs_x[ARRAY_OF_PTRS_MAX_ARRAY_SIZE];
+
+template < size_t block_size, size_t max_array_size >
 __launch_bounds__(block_size)
-__global__ void array_of_ptrs(Real_ptr y, ARRAY_OF_PTRS_Array x_array,
+__global__ void array_of_ptrs(Real_ptr y, ARRAY_OF_PTRS_Array<max_array_size> x_array,
                       Index_type array_size,
                       Index_type iend)
 {
@@ -33,12 +39,49 @@ __global__ void array_of_ptrs(Real_ptr y, ARRAY_OF_PTRS_Array x_array,
    }
 }
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void array_of_ptrs_constant(Real_ptr y,
+                      Index_type array_size,
+                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     ARRAY_OF_PTRS_BODY(array_of_ptrs_x);
+   }
+}
 
 template < size_t block_size >
-void ARRAY_OF_PTRS::runCudaVariantImpl(VariantID vid)
+__launch_bounds__(block_size)
+__global__ void array_of_ptrs_device_array(Real_ptr y,
+                      const Real_ptr* __restrict__ x_device,
+                      Index_type array_size,
+                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     ARRAY_OF_PTRS_BODY(x_device);
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void array_of_ptrs_read_only(Real_ptr y,
+                      ReadOnlyPtr<Real_ptr> x_device,
+                      Index_type array_size,
+                      Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     ARRAY_OF_PTRS_BODY(x_device);
+   }
+}
+
+
+template < size_t block_size, size_t max_array_size >
+void ARRAY_OF_PTRS::runCudaVariantArg(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
   auto res{getCudaResource()};
@@ -47,20 +90,154 @@ void ARRAY_OF_PTRS::runCudaVariantImpl(VariantID vid)
 
   if ( vid == Base_CUDA ) {
 
-    ARRAY_OF_PTRS_Array x_array = x;
+    ARRAY_OF_PTRS_Array<max_array_size> x_array = x;
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      array_of_ptrs<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+      array_of_ptrs<block_size, max_array_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
           y, x_array, array_size, iend );
       cudaErrchk( cudaGetLastError() );
 
     }
     stopTimer();
 
+  } else {
+     getCout() << "\n  ARRAY_OF_PTRS : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void ARRAY_OF_PTRS::runCudaVariantConstant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  ARRAY_OF_PTRS_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Real_ptr* x_constant_addr;
+    cudaErrchk( cudaGetSymbolAddress((void**)&x_constant_addr, array_of_ptrs_x) );
+    cudaErrchk( cudaMemcpyAsync(x_constant_addr, x, array_size * sizeof(Real_ptr), cudaMemcpyHostToDevice, res.get_stream()) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      array_of_ptrs_constant<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, array_size, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ARRAY_OF_PTRS : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void ARRAY_OF_PTRS::runCudaVariantDeviceArray(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  ARRAY_OF_PTRS_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Real_ptr* x_device;
+    allocData(DataSpace::CudaDevice, x_device, array_size);
+    copyData(DataSpace::CudaDevice, x_device, DataSpace::Host, &x[0], array_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      array_of_ptrs_device_array<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, x_device, array_size, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, x_device);
+
+  } else {
+     getCout() << "\n  ARRAY_OF_PTRS : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void ARRAY_OF_PTRS::runCudaVariantReadOnly(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  ARRAY_OF_PTRS_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Real_ptr* x_device;
+    allocData(DataSpace::CudaDevice, x_device, array_size);
+    copyData(DataSpace::CudaDevice, x_device, DataSpace::Host, &x[0], array_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      array_of_ptrs_read_only<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, x_device, array_size, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, x_device);
+
+  } else {
+     getCout() << "\n  ARRAY_OF_PTRS : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+
+template < size_t block_size, bool launch >
+void ARRAY_OF_PTRS::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  ARRAY_OF_PTRS_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    if (array_size <= 26) {
+      runCudaVariantArg<block_size, 26>(vid);
+    } else if (array_size <= 64) {
+      runCudaVariantArg<block_size, 64>(vid);
+    } else if (array_size <= 128) {
+      runCudaVariantArg<block_size, 128>(vid);
+    } else if (array_size <= 256) {
+      runCudaVariantArg<block_size, 256>(vid);
+    } else {
+      runCudaVariantArg<block_size, ARRAY_OF_PTRS_MAX_ARRAY_SIZE>(vid);
+    }
+
   } else if ( vid == Lambda_CUDA ) {
 
     startTimer();
@@ -82,7 +259,7 @@ void ARRAY_OF_PTRS::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         ARRAY_OF_PTRS_BODY(x);
       });
@@ -95,7 +272,83 @@ void ARRAY_OF_PTRS::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(ARRAY_OF_PTRS, Cuda)
+void ARRAY_OF_PTRS::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == Base_CUDA) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantConstant<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantDeviceArray<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantReadOnly<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    }
+
+  });
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Cuda, Impl, )
+
+  }
+
+}
+
+void ARRAY_OF_PTRS::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, block_name);
+
+      if (vid == Base_CUDA) {
+        addVariantTuningName(vid, "constant_"+block_name);
+        addVariantTuningName(vid, "device_array_"+block_name);
+        addVariantTuningName(vid, "ldg_device_array_"+block_name);
+      }
+
+    }
+
+  });
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
 
 } // end namespace basic
 } // end namespace rajaperf
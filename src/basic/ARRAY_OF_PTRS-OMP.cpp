@@ -10,7 +10,11 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrefetchUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,8 +22,109 @@ namespace basic
 {
 
 
-void ARRAY_OF_PTRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ARRAY_OF_PTRS::runOpenMPVariantPrefetch(VariantID vid, Index_type distance)
 {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ARRAY_OF_PTRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ib = ibegin; ib < iend; ib += prefetch::line_length) {
+          const Index_type ie = std::min(ib + prefetch::line_length, iend);
+          if ( ib + distance < iend ) {
+            ARRAY_OF_PTRS_PREFETCH(x, ib + distance);
+          }
+          for (Index_type i = ib; i < ie; ++i ) {
+            ARRAY_OF_PTRS_BODY(x);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ARRAY_OF_PTRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(distance);
+#endif
+}
+
+void ARRAY_OF_PTRS::runOpenMPVariantSplit(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ARRAY_OF_PTRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          for (Index_type a0 = 0; a0 < array_size; a0 += ARRAY_OF_PTRS_SPLIT_ARRAYS) {
+            const Index_type a1 = std::min(a0 + ARRAY_OF_PTRS_SPLIT_ARRAYS, array_size);
+            #pragma omp for
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              ARRAY_OF_PTRS_SPLIT_BODY(x, a0, a1);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ARRAY_OF_PTRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void ARRAY_OF_PTRS::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  const std::vector<Index_type> distances = prefetch::getDistances();
+  if ( tune_idx > 0 && tune_idx < 1 + distances.size() ) {
+    runOpenMPVariantPrefetch(vid, distances[tune_idx - 1]);
+    return;
+  }
+  if ( tune_idx == 1 + distances.size() ) {
+    runOpenMPVariantSplit(vid);
+    return;
+  }
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
@@ -91,5 +196,17 @@ void ARRAY_OF_PTRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void ARRAY_OF_PTRS::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    for (Index_type distance : prefetch::getDistances()) {
+      addVariantTuningName(vid, prefetch::getPrefetchTuningName(distance));
+    }
+    addVariantTuningName(vid, prefetch::getSplitTuningName());
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -24,9 +24,10 @@ ARRAY_OF_PTRS::ARRAY_OF_PTRS(const RunParams& params)
   setDefaultProblemSize(1000000);
   setDefaultReps(50);
 
-  setActualProblemSize( getTargetProblemSize() );
+  m_array_size = getKernelParam("arrays", ARRAY_OF_PTRS_DEFAULT_ARRAY_SIZE,
+                                1, ARRAY_OF_PTRS_MAX_ARRAY_SIZE);
 
-  m_array_size = ARRAY_OF_PTRS_MAX_ARRAY_SIZE;
+  setActualProblemSize( getTargetProblemSize() );
 
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
@@ -35,6 +36,8 @@ ARRAY_OF_PTRS::ARRAY_OF_PTRS(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Streaming);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -43,6 +46,8 @@ ARRAY_OF_PTRS::ARRAY_OF_PTRS(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -20,11 +20,25 @@
 ///   }
 /// }
 ///
+/// array_size is given by the kernel parameter "arrays". The Base GPU
+/// variants have tunings that pass the pointers to the kernel in a struct
+/// kernel argument (block_<size>), in __constant__ memory
+/// (constant_block_<size>), or in an array in device memory
+/// (device_array_block_<size>). The ldg_device_array_block_<size> tunings
+/// load the pointers in device memory and the arrays through the
+/// read-only data cache. The Base CPU variants have tunings that prefetch
+/// each array a distance of elements ahead (prefetch_<distance>) and that
+/// sum the arrays in loops over ARRAY_OF_PTRS_SPLIT_ARRAYS arrays each
+/// (split).
+///
 
 #ifndef RAJAPerf_Basic_ARRAY_OF_PTRS_HPP
 #define RAJAPerf_Basic_ARRAY_OF_PTRS_HPP
 
-#define ARRAY_OF_PTRS_MAX_ARRAY_SIZE 26
+#define ARRAY_OF_PTRS_DEFAULT_ARRAY_SIZE 26
+// The pointers of the largest array fit in the 4KB kernel parameter limit
+// with room for the other kernel arguments and lambda captures.
+#define ARRAY_OF_PTRS_MAX_ARRAY_SIZE 480
 
 #define ARRAY_OF_PTRS_DATA_SETUP_X_ARRAY \
   for (Index_type a = 0; a < array_size; ++a) { \
@@ -45,6 +59,21 @@
   } \
   y[i] = yi;
 
+#define ARRAY_OF_PTRS_PREFETCH(x, i) \
+  for (Index_type a = 0; a < array_size; ++a) { \
+    prefetchRead(&(x)[a][i]); \
+  } \
+  prefetchWrite(&y[i]);
+
+#define ARRAY_OF_PTRS_SPLIT_ARRAYS 4
+
+#define ARRAY_OF_PTRS_SPLIT_BODY(x, abegin, aend) \
+  Real_type yi = ((abegin) == 0) ? 0.0 : y[i]; \
+  for (Index_type a = (abegin); a < (aend); ++a) { \
+    yi += (x)[a][i] ; \
+  } \
+  y[i] = yi;
+
 
 #include "common/KernelBase.hpp"
 
@@ -74,12 +103,34 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantPrefetch(VariantID vid, Index_type distance);
+  void runSeqVariantSplit(VariantID vid);
+  void runOpenMPVariantPrefetch(VariantID vid, Index_type distance);
+  void runOpenMPVariantSplit(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, size_t max_array_size >
+  void runCudaVariantArg(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantConstant(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantDeviceArray(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantReadOnly(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size, size_t max_array_size >
+  void runHipVariantArg(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantConstant(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantDeviceArray(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantReadOnly(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -90,8 +141,14 @@ private:
   Index_type m_array_size;
 };
 
+//
+// Kernel argument holding the first max_array_size pointers of x, the GPU
+// variants use the smallest max_array_size that holds array_size pointers
+// so the kernel arguments are not larger than needed.
+//
+template < size_t max_array_size >
 struct ARRAY_OF_PTRS_Array {
-  Real_ptr array[ARRAY_OF_PTRS_MAX_ARRAY_SIZE];
+  Real_ptr array[max_array_size];
 
   template < size_t ... Indices >
   ARRAY_OF_PTRS_Array(Real_ptr (&array_)[ARRAY_OF_PTRS_MAX_ARRAY_SIZE],
@@ -100,7 +157,7 @@ struct ARRAY_OF_PTRS_Array {
   { }
 
   ARRAY_OF_PTRS_Array(Real_ptr (&array_)[ARRAY_OF_PTRS_MAX_ARRAY_SIZE])
-    : ARRAY_OF_PTRS_Array(array_, camp::make_int_seq_t<size_t, 26>{})
+    : ARRAY_OF_PTRS_Array(array_, camp::make_int_seq_t<size_t, max_array_size>{})
   { }
 };
 
@@ -0,0 +1,253 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ATOMIC_CONTENTION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void atomic_contention(Int_ptr addresses, Real_ptr atomics,
+                                  Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     ATOMIC_CONTENTION_RAJA_ATOMIC_BODY(RAJA::cuda_atomic);
+   }
+}
+
+//
+// The lowest lane of each group of lanes in a warp updating the same
+// address adds the size of the group with one atomic.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void atomic_contention_warp_aggregated(Int_ptr addresses, Real_ptr atomics,
+                                                  Index_type iend)
+{
+  static_assert(block_size % cuda_warp_size == 0,
+                "block_size must be a multiple of the warp size");
+
+  const int warp_index = threadIdx.x % cuda_warp_size;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  const bool valid = (i < iend);
+  const Int_type address = valid ? addresses[i] : Int_type(-1);
+
+  unsigned pending = __ballot_sync(0xffffffffu, valid);
+  while (pending != 0u) {
+    const int leader = __ffs(pending) - 1;
+    const Int_type leader_address = __shfl_sync(0xffffffffu, address, leader);
+    const unsigned peers = __ballot_sync(0xffffffffu, valid && address == leader_address);
+    if (warp_index == leader) {
+      RAJA::atomicAdd<RAJA::cuda_atomic>(&atomics[leader_address],
+                                         static_cast<Real_type>(__popc(peers)));
+    }
+    pending &= ~peers;
+  }
+}
+
+
+template < size_t block_size, bool launch >
+void ATOMIC_CONTENTION::runCudaVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  ATOMIC_CONTENTION_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemsetAsync(atomics, 0, sizeof(Real_type)*num_addresses,
+                                  res.get_stream()) );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      atomic_contention<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          addresses, atomics, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemsetAsync(atomics, 0, sizeof(Real_type)*num_addresses,
+                                  res.get_stream()) );
+
+      gpu_launch::forall< block_size, launch >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+          ATOMIC_CONTENTION_RAJA_ATOMIC_BODY(RAJA::cuda_atomic);
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ATOMIC_CONTENTION : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void ATOMIC_CONTENTION::runCudaVariantWarpAggregated(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  ATOMIC_CONTENTION_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemsetAsync(atomics, 0, sizeof(Real_type)*num_addresses,
+                                  res.get_stream()) );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      atomic_contention_warp_aggregated<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          addresses, atomics, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ATOMIC_CONTENTION : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+
+void ATOMIC_CONTENTION::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runCudaVariantAtomic<block_size>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantWarpAggregated<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
+  } else {
+
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Cuda, Atomic, )
+
+  }
+
+}
+
+void ATOMIC_CONTENTION::setCudaTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, "atomic_"+std::to_string(block_size));
+
+      }
+
+    });
+
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, "warp_aggregated_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
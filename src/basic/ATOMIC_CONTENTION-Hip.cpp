@@ -0,0 +1,332 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ATOMIC_CONTENTION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void atomic_contention(Int_ptr addresses, Real_ptr atomics,
+                                  Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     ATOMIC_CONTENTION_RAJA_ATOMIC_BODY(RAJA::hip_atomic);
+   }
+}
+
+//
+// Unsafe atomics may use hardware floating point atomics that are not
+// safe for all memory, such as fine grained host memory.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void atomic_contention_unsafe(Int_ptr addresses, Real_ptr atomics,
+                                         Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     unsafeAtomicAdd(&atomics[addresses[i]], 1.0);
+   }
+}
+
+//
+// The lowest lane of each group of lanes in a warp updating the same
+// address adds the size of the group with one atomic.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void atomic_contention_warp_aggregated(Int_ptr addresses, Real_ptr atomics,
+                                                  Index_type iend)
+{
+  static_assert(block_size % hip_warp_size == 0,
+                "block_size must be a multiple of the warp size");
+
+  const int warp_index = threadIdx.x % hip_warp_size;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  const bool valid = (i < iend);
+  const Int_type address = valid ? addresses[i] : Int_type(-1);
+
+  unsigned long long pending = __ballot(valid);
+  while (pending != 0ull) {
+    const int leader = __ffsll(pending) - 1;
+    const Int_type leader_address = __shfl(address, leader);
+    const unsigned long long peers = __ballot(valid && address == leader_address);
+    if (warp_index == leader) {
+      RAJA::atomicAdd<RAJA::hip_atomic>(&atomics[leader_address],
+                                         static_cast<Real_type>(__popcll(peers)));
+    }
+    pending &= ~peers;
+  }
+}
+
+
+template < size_t block_size, bool launch >
+void ATOMIC_CONTENTION::runHipVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  ATOMIC_CONTENTION_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemsetAsync(atomics, 0, sizeof(Real_type)*num_addresses,
+                                res.get_stream()) );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL( (atomic_contention<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          addresses, atomics, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemsetAsync(atomics, 0, sizeof(Real_type)*num_addresses,
+                                res.get_stream()) );
+
+      gpu_launch::forall< block_size, launch >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+          ATOMIC_CONTENTION_RAJA_ATOMIC_BODY(RAJA::hip_atomic);
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ATOMIC_CONTENTION : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void ATOMIC_CONTENTION::runHipVariantUnsafe(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  ATOMIC_CONTENTION_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemsetAsync(atomics, 0, sizeof(Real_type)*num_addresses,
+                                res.get_stream()) );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL( (atomic_contention_unsafe<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          addresses, atomics, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ATOMIC_CONTENTION : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void ATOMIC_CONTENTION::runHipVariantWarpAggregated(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  ATOMIC_CONTENTION_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemsetAsync(atomics, 0, sizeof(Real_type)*num_addresses,
+                                res.get_stream()) );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL( (atomic_contention_warp_aggregated<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          addresses, atomics, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ATOMIC_CONTENTION : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+
+void ATOMIC_CONTENTION::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runHipVariantAtomic<block_size>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantUnsafe<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantWarpAggregated<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
+  } else {
+
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Hip, Atomic, )
+
+  }
+
+}
+
+void ATOMIC_CONTENTION::setHipTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, "atomic_"+std::to_string(block_size));
+
+      }
+
+    });
+
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, "unsafe_"+std::to_string(block_size));
+
+        }
+
+      });
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, "warp_aggregated_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
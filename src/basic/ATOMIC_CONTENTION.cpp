@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ATOMIC_CONTENTION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+ATOMIC_CONTENTION::ATOMIC_CONTENTION(const RunParams& params)
+  : KernelBase(rajaperf::Basic_ATOMIC_CONTENTION, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_num_addresses = getKernelParam("addresses", 1024, 1,
+                                   std::numeric_limits<Int_type>::max());
+  m_pattern = getKernelParam("pattern", 0, {0, 1, 2});
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // each address is read and written once, contended updates of the same
+  // address are not counted
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_num_addresses +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(1 * getActualProblemSize());
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+ATOMIC_CONTENTION::~ATOMIC_CONTENTION()
+{
+}
+
+void ATOMIC_CONTENTION::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  constexpr unsigned long long addresses_seed = 1597;
+
+  const Index_type block_len = RAJA_DIVIDE_CEILING_INT(len, m_num_addresses);
+
+  allocData(m_addresses, len, vid);
+  {
+    auto reset_addresses = scopedMoveData(m_addresses, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      Index_type a = 0;
+      switch (m_pattern) {
+        case 0 :
+          a = i % m_num_addresses;
+          break;
+        case 1 :
+          a = i / block_len;
+          break;
+        default :
+          a = static_cast<Index_type>(
+                m_num_addresses * detail::counterRandValue(addresses_seed, i));
+          break;
+      }
+      m_addresses[i] = static_cast<Int_type>( std::min(a, m_num_addresses-1) );
+    }
+  }
+  allocAndInitDataConst(m_atomics, m_num_addresses, 0.0, vid);
+}
+
+void ATOMIC_CONTENTION::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_atomics, m_num_addresses, vid);
+}
+
+void ATOMIC_CONTENTION::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_addresses, vid);
+  deallocData(m_atomics, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
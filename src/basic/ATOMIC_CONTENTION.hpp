@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// ATOMIC_CONTENTION kernel reference implementation:
+///
+/// for (Index_type a = 0; a < num_addresses; ++a ) {
+///   atomics[a] = 0.0;
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   atomics[addresses[i]] += 1.0;
+/// }
+///
+/// The number of distinct addresses updated and the pattern of addresses
+/// are kernel parameters, given with
+/// '--kernel-param ATOMIC_CONTENTION:addresses=<n>' and
+/// '--kernel-param ATOMIC_CONTENTION:pattern=<p>'. Patterns are
+///
+///   0 -- strided, iterate i updates address i % num_addresses,
+///        neighboring iterates update different addresses
+///   1 -- blocked, iterates are split into num_addresses contiguous
+///        blocks that each update one address, neighboring iterates
+///        update the same address
+///   2 -- random, each iterate updates a uniformly random address
+///
+/// With one address this is the contention of PI_ATOMIC, and with as many
+/// addresses as iterates in the strided pattern it is the contention free
+/// updates of DAXPY_ATOMIC. GPU tunings compare RAJA atomics, unsafe
+/// hardware atomics on HIP, and warp aggregated atomics that combine the
+/// updates of a warp to the same address into one atomic.
+///
+
+#ifndef RAJAPerf_Basic_ATOMIC_CONTENTION_HPP
+#define RAJAPerf_Basic_ATOMIC_CONTENTION_HPP
+
+#define ATOMIC_CONTENTION_DATA_SETUP \
+  Int_ptr addresses = m_addresses; \
+  Real_ptr atomics = m_atomics; \
+  const Index_type num_addresses = m_num_addresses;
+
+#define ATOMIC_CONTENTION_INIT_BODY \
+  atomics[a] = 0.0;
+
+#define ATOMIC_CONTENTION_BODY \
+  atomics[addresses[i]] += 1.0;
+
+#define ATOMIC_CONTENTION_RAJA_ATOMIC_BODY(policy) \
+  RAJA::atomicAdd<policy>(&atomics[addresses[i]], 1.0);
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class ATOMIC_CONTENTION : public KernelBase
+{
+public:
+
+  ATOMIC_CONTENTION(const RunParams& params);
+
+  ~ATOMIC_CONTENTION();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runCudaVariantAtomic(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpAggregated(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runHipVariantAtomic(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantUnsafe(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpAggregated(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  // warp aggregated tunings need whole warps on every gpu backend
+  using gpu_warp_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                     gpu_block_size::MultipleOf<64>>;
+
+  Index_type m_num_addresses;
+  Index_type m_pattern;
+
+  Int_ptr m_addresses;
+  Real_ptr m_atomics;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
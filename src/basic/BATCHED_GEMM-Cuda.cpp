@@ -0,0 +1,411 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BATCHED_GEMM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+  //
+  // Number of threads computing each matrix in warp_per_matrix tunings
+  //
+  const size_t warp_size = 32;
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void batched_gemm_thread_per_matrix(Real_ptr A, Real_ptr B, Real_ptr C,
+                                               Index_type N, Index_type num_batch)
+{
+  Index_type ibatch = blockIdx.x * block_size + threadIdx.x;
+  if (ibatch < num_batch) {
+    for (Index_type j = 0; j < N; ++j) {
+      for (Index_type i = 0; i < N; ++i) {
+        BATCHED_GEMM_BODY;
+      }
+    }
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void batched_gemm_warp_per_matrix(Real_ptr A, Real_ptr B, Real_ptr C,
+                                             Index_type N, Index_type num_batch)
+{
+  Index_type ibatch = (blockIdx.x * block_size + threadIdx.x) / warp_size;
+  if (ibatch < num_batch) {
+    for (Index_type ij = threadIdx.x % warp_size; ij < N*N; ij += warp_size) {
+      BATCHED_GEMM_ENTRY_BODY;
+    }
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void batched_gemm_team_per_matrix(Real_ptr A, Real_ptr B, Real_ptr C,
+                                             Index_type N)
+{
+  Index_type ibatch = blockIdx.x;
+  for (Index_type ij = threadIdx.x; ij < N*N; ij += block_size) {
+    BATCHED_GEMM_ENTRY_BODY;
+  }
+}
+
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+void BATCHED_GEMM::runCudaVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  BATCHED_GEMM_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    cublasHandle_t handle;
+    cublasErrchk( cublasCreate(&handle) );
+    cublasErrchk( cublasSetStream(handle, res.get_stream()) );
+
+    const int n = N;
+    const long long stride = N*N;
+    const Real_type alpha = 1.0;
+    const Real_type beta = 0.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RP_USE_DOUBLE)
+      cublasErrchk( cublasDgemmStridedBatched(handle, CUBLAS_OP_N, CUBLAS_OP_N,
+                                              n, n, n,
+                                              &alpha, A, n, stride,
+                                                      B, n, stride,
+                                              &beta,  C, n, stride,
+                                              num_batch) );
+#else
+      cublasErrchk( cublasSgemmStridedBatched(handle, CUBLAS_OP_N, CUBLAS_OP_N,
+                                              n, n, n,
+                                              &alpha, A, n, stride,
+                                                      B, n, stride,
+                                              &beta,  C, n, stride,
+                                              num_batch) );
+#endif
+
+    }
+    stopTimer();
+
+    cublasErrchk( cublasDestroy(handle) );
+
+  } else {
+     getCout() << "\n  BATCHED_GEMM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+template < size_t block_size >
+void BATCHED_GEMM::runCudaVariantThreadPerMatrix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  BATCHED_GEMM_DATA_SETUP;
+
+  const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_batch, block_size);
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+      batched_gemm_thread_per_matrix<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          A, B, C, N, num_batch );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    constexpr bool async = true;
+
+    using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, block_size>>;
+
+    using teams_x = RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
+
+    using threads_x = RAJA::LoopPolicy<RAJA::cuda_thread_size_x_direct<block_size>>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::launch<launch_policy>( res,
+        RAJA::LaunchParams(RAJA::Teams(grid_size),
+                           RAJA::Threads(block_size)),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<teams_x>(ctx, RAJA::RangeSegment(0, grid_size),
+            [&](Index_type bx) {
+              RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, block_size),
+                [&](Index_type tx) {
+                  const Index_type ibatch = bx * block_size + tx;
+                  if (ibatch < num_batch) {
+                    for (Index_type j = 0; j < N; ++j) {
+                      for (Index_type i = 0; i < N; ++i) {
+                        BATCHED_GEMM_BODY;
+                      }
+                    }
+                  }
+                }
+              );  // RAJA::loop<threads_x>
+            }
+          );  // RAJA::loop<teams_x>
+
+        }  // outer lambda (ctx)
+      );  // RAJA::launch
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  BATCHED_GEMM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void BATCHED_GEMM::runCudaVariantWarpPerMatrix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  BATCHED_GEMM_DATA_SETUP;
+
+  constexpr size_t matrices_per_block = block_size / warp_size;
+  static_assert(matrices_per_block*warp_size == block_size, "Invalid block_size");
+  const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_batch, matrices_per_block);
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+      batched_gemm_warp_per_matrix<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          A, B, C, N, num_batch );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    constexpr bool async = true;
+
+    using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, block_size>>;
+
+    using teams_x = RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
+
+    using threads_x = RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<warp_size>>;
+
+    using threads_y = RAJA::LoopPolicy<RAJA::cuda_thread_size_y_direct<matrices_per_block>>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::launch<launch_policy>( res,
+        RAJA::LaunchParams(RAJA::Teams(grid_size),
+                           RAJA::Threads(warp_size, matrices_per_block)),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<teams_x>(ctx, RAJA::RangeSegment(0, grid_size),
+            [&](Index_type bx) {
+              RAJA::loop<threads_y>(ctx, RAJA::RangeSegment(0, matrices_per_block),
+                [&](Index_type ty) {
+                  const Index_type ibatch = bx * matrices_per_block + ty;
+                  if (ibatch < num_batch) {
+                    RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, N*N),
+                      [&](Index_type ij) {
+                        BATCHED_GEMM_ENTRY_BODY;
+                      }
+                    );  // RAJA::loop<threads_x>
+                  }
+                }
+              );  // RAJA::loop<threads_y>
+            }
+          );  // RAJA::loop<teams_x>
+
+        }  // outer lambda (ctx)
+      );  // RAJA::launch
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  BATCHED_GEMM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void BATCHED_GEMM::runCudaVariantTeamPerMatrix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  BATCHED_GEMM_DATA_SETUP;
+
+  const size_t grid_size = num_batch;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+      batched_gemm_team_per_matrix<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          A, B, C, N );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    constexpr bool async = true;
+
+    using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, block_size>>;
+
+    using teams_x = RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
+
+    using threads_x = RAJA::LoopPolicy<RAJA::cuda_thread_size_x_loop<block_size>>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::launch<launch_policy>( res,
+        RAJA::LaunchParams(RAJA::Teams(grid_size),
+                           RAJA::Threads(block_size)),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<teams_x>(ctx, RAJA::RangeSegment(0, num_batch),
+            [&](Index_type ibatch) {
+              RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, N*N),
+                [&](Index_type ij) {
+                  BATCHED_GEMM_ENTRY_BODY;
+                }
+              );  // RAJA::loop<threads_x>
+            }
+          );  // RAJA::loop<teams_x>
+
+        }  // outer lambda (ctx)
+      );  // RAJA::launch
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  BATCHED_GEMM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void BATCHED_GEMM::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_CUDA ) {
+
+    if (tune_idx == t) {
+
+      runCudaVariantBlas(vid);
+
+    }
+
+    t += 1;
+
+  }
+#endif
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runCudaVariantThreadPerMatrix<block_size>(vid);
+
+      }
+
+      t += 1;
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runCudaVariantWarpPerMatrix<block_size>(vid);
+
+      }
+
+      t += 1;
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runCudaVariantTeamPerMatrix<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+}
+
+void BATCHED_GEMM::setCudaTuningDefinitions(VariantID vid)
+{
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_CUDA ) {
+
+    addVariantTuningName(vid, "cublas");
+
+  }
+#endif
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "thread_per_matrix_block_"+std::to_string(block_size));
+
+      addVariantTuningName(vid, "warp_per_matrix_block_"+std::to_string(block_size));
+
+      addVariantTuningName(vid, "team_per_matrix_block_"+std::to_string(block_size));
+
+    }
+
+  });
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BATCHED_GEMM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void BATCHED_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  BATCHED_GEMM_DATA_SETUP;
+
+  auto batched_gemm_lam = [=](Index_type ibatch) {
+                            for (Index_type j = 0; j < N; ++j) {
+                              for (Index_type i = 0; i < N; ++i) {
+                                BATCHED_GEMM_BODY;
+                              }
+                            }
+                          };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ibatch = 0; ibatch < num_batch; ++ibatch) {
+          for (Index_type j = 0; j < N; ++j) {
+            for (Index_type i = 0; i < N; ++i) {
+              BATCHED_GEMM_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ibatch = 0; ibatch < num_batch; ++ibatch) {
+          batched_gemm_lam(ibatch);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using launch_policy = RAJA::LaunchPolicy<RAJA::omp_launch_t>;
+
+      using outer_x = RAJA::LoopPolicy<RAJA::omp_for_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::launch<launch_policy>(RAJA::LaunchParams(),
+          [=](RAJA::LaunchContext ctx) {
+
+            RAJA::loop<outer_x>(ctx, RAJA::RangeSegment(0, num_batch),
+              batched_gemm_lam
+            );  // RAJA::loop<outer_x>
+
+          }  // outer lambda (ctx)
+        );  // RAJA::launch
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  BATCHED_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
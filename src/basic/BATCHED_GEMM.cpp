@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BATCHED_GEMM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+BATCHED_GEMM::BATCHED_GEMM(const RunParams& params)
+  : KernelBase(rajaperf::Basic_BATCHED_GEMM, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_N = getKernelParam("N", params.getBatchedMatrixSize());
+  m_num_batch = std::max(getTargetProblemSize() / (m_N*m_N), Index_type(1));
+
+  setActualProblemSize( m_num_batch * m_N*m_N );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 2*sizeof(Real_type)) * m_num_batch * m_N*m_N );
+  setFLOPsPerRep(2 * m_num_batch * m_N*m_N*m_N);
+
+  checksum_scale_factor = 1e-3 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Launch);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+BATCHED_GEMM::~BATCHED_GEMM()
+{
+}
+
+void BATCHED_GEMM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = m_num_batch * m_N*m_N;
+
+  //
+  // Multiples of 1/8 in [-1, 1) keep every product and sum exact, so all
+  // tunings, including vendor library ones, give the same result.
+  //
+  constexpr unsigned long long a_seed = 3571;
+  constexpr unsigned long long b_seed = 6961;
+
+  allocData(m_A, len, vid);
+  allocData(m_B, len, vid);
+  {
+    auto reset_A = scopedMoveData(m_A, len, vid);
+    auto reset_B = scopedMoveData(m_B, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      m_A[i] = 0.125 * std::floor(16.0 * detail::counterRandValue(a_seed, i)) - 1.0;
+      m_B[i] = 0.125 * std::floor(16.0 * detail::counterRandValue(b_seed, i)) - 1.0;
+    }
+  }
+  allocAndInitDataConst(m_C, len, 0.0, vid);
+}
+
+void BATCHED_GEMM::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_C, m_num_batch * m_N*m_N, checksum_scale_factor, vid);
+}
+
+void BATCHED_GEMM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_A, vid);
+  deallocData(m_B, vid);
+  deallocData(m_C, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
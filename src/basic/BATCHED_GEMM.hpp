@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// BATCHED_GEMM kernel reference implementation:
+///
+/// // C = A * B for each of num_batch N x N column major matrices
+/// for (Index_type ibatch = 0; ibatch < num_batch; ++ibatch) {
+///   for (Index_type j = 0; j < N; ++j) {
+///     for (Index_type i = 0; i < N; ++i) {
+///       Real_type dot = 0.0;
+///       for (Index_type k = 0; k < N; ++k) {
+///         dot += A[ibatch*N*N + i + k*N] * B[ibatch*N*N + k + j*N];
+///       }
+///       C[ibatch*N*N + i + j*N] = dot;
+///     }
+///   }
+/// }
+///
+/// N is given by --batched-matrix-size and the problem size sets num_batch.
+/// GPU tunings compute each matrix with one thread (thread_per_matrix),
+/// one warp (warp_per_matrix), or one thread block (team_per_matrix), or
+/// with the vendor batched BLAS gemm (cublas, rocblas).
+///
+
+#ifndef RAJAPerf_Basic_BATCHED_GEMM_HPP
+#define RAJAPerf_Basic_BATCHED_GEMM_HPP
+
+#define BATCHED_GEMM_DATA_SETUP \
+  Real_ptr A = m_A; \
+  Real_ptr B = m_B; \
+  Real_ptr C = m_C; \
+  const Index_type N = m_N; \
+  const Index_type num_batch = m_num_batch;
+
+#define BATCHED_GEMM_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < N; ++k) { \
+    dot += A[ibatch*N*N + i + k*N] * B[ibatch*N*N + k + j*N]; \
+  } \
+  C[ibatch*N*N + i + j*N] = dot;
+
+// entry ij of a matrix in column major order
+#define BATCHED_GEMM_ENTRY_BODY \
+  const Index_type i = ij % N; \
+  const Index_type j = ij / N; \
+  BATCHED_GEMM_BODY;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class BATCHED_GEMM : public KernelBase
+{
+public:
+
+  BATCHED_GEMM(const RunParams& params);
+
+  ~BATCHED_GEMM();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runCudaVariantBlas(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantThreadPerMatrix(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpPerMatrix(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantTeamPerMatrix(VariantID vid);
+
+  void runHipVariantBlas(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantThreadPerMatrix(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpPerMatrix(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantTeamPerMatrix(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<64>>;
+
+  Index_type m_N;
+  Index_type m_num_batch;
+
+  Real_ptr m_A;
+  Real_ptr m_B;
+  Real_ptr m_C;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
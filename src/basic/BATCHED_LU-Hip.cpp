@@ -0,0 +1,500 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BATCHED_LU.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+  //
+  // Number of threads computing each matrix in warp_per_matrix tunings
+  //
+  const size_t warp_size = 64;
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void batched_lu_thread_per_matrix(Real_ptr A, Real_ptr LU,
+                                             Index_type N, Index_type num_batch)
+{
+  Index_type ibatch = blockIdx.x * block_size + threadIdx.x;
+  if (ibatch < num_batch) {
+    BATCHED_LU_MATRIX_BODY;
+  }
+}
+
+//
+// Every thread in the block reaches each __syncthreads, only the work of
+// warps past the last matrix is skipped.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void batched_lu_warp_per_matrix(Real_ptr A, Real_ptr LU,
+                                           Index_type N, Index_type num_batch)
+{
+  Index_type ibatch = (blockIdx.x * block_size + threadIdx.x) / warp_size;
+  Index_type lane = threadIdx.x % warp_size;
+  if (ibatch < num_batch) {
+    for (Index_type ij = lane; ij < N*N; ij += warp_size) {
+      BATCHED_LU_COPY_BODY;
+    }
+  }
+  __syncthreads();
+  for (Index_type k = 0; k < N; ++k) {
+    const Index_type M = N-k-1;
+    if (ibatch < num_batch) {
+      for (Index_type t = lane; t < M; t += warp_size) {
+        BATCHED_LU_SCALE_ENTRY_BODY;
+      }
+    }
+    __syncthreads();
+    if (ibatch < num_batch) {
+      for (Index_type t = lane; t < M*M; t += warp_size) {
+        BATCHED_LU_UPDATE_ENTRY_BODY;
+      }
+    }
+    __syncthreads();
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void batched_lu_team_per_matrix(Real_ptr A, Real_ptr LU,
+                                           Index_type N)
+{
+  Index_type ibatch = blockIdx.x;
+  for (Index_type ij = threadIdx.x; ij < N*N; ij += block_size) {
+    BATCHED_LU_COPY_BODY;
+  }
+  __syncthreads();
+  for (Index_type k = 0; k < N; ++k) {
+    const Index_type M = N-k-1;
+    for (Index_type t = threadIdx.x; t < M; t += block_size) {
+      BATCHED_LU_SCALE_ENTRY_BODY;
+    }
+    __syncthreads();
+    for (Index_type t = threadIdx.x; t < M*M; t += block_size) {
+      BATCHED_LU_UPDATE_ENTRY_BODY;
+    }
+    __syncthreads();
+  }
+}
+
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+void BATCHED_LU::runHipVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  BATCHED_LU_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    hipStream_t stream = res.get_stream();
+
+    rocblas_handle handle;
+    rocblasErrchk( rocblas_create_handle(&handle) );
+    rocblasErrchk( rocblas_set_stream(handle, stream) );
+
+    const rocblas_int n = N;
+    const rocblas_stride stride = N*N;
+
+    rocblas_int* info;
+    allocData(DataSpace::HipDevice, info, num_batch);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemcpyAsync(LU, A, num_batch*N*N*sizeof(Real_type),
+                                hipMemcpyDeviceToDevice, stream) );
+
+#if defined(RP_USE_DOUBLE)
+      rocblasErrchk( rocsolver_dgetrf_npvt_strided_batched(handle, n, n,
+                                                           LU, n, stride,
+                                                           info, num_batch) );
+#else
+      rocblasErrchk( rocsolver_sgetrf_npvt_strided_batched(handle, n, n,
+                                                           LU, n, stride,
+                                                           info, num_batch) );
+#endif
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, info);
+
+    rocblasErrchk( rocblas_destroy_handle(handle) );
+
+  } else {
+     getCout() << "\n  BATCHED_LU : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+template < size_t block_size >
+void BATCHED_LU::runHipVariantThreadPerMatrix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  BATCHED_LU_DATA_SETUP;
+
+  const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_batch, block_size);
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((batched_lu_thread_per_matrix<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         A, LU, N, num_batch );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    constexpr bool async = true;
+
+    using launch_policy = RAJA::LaunchPolicy<RAJA::hip_launch_t<async, block_size>>;
+
+    using teams_x = RAJA::LoopPolicy<RAJA::hip_block_x_direct>;
+
+    using threads_x = RAJA::LoopPolicy<RAJA::hip_thread_size_x_direct<block_size>>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::launch<launch_policy>( res,
+        RAJA::LaunchParams(RAJA::Teams(grid_size),
+                           RAJA::Threads(block_size)),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<teams_x>(ctx, RAJA::RangeSegment(0, grid_size),
+            [&](Index_type bx) {
+              RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, block_size),
+                [&](Index_type tx) {
+                  const Index_type ibatch = bx * block_size + tx;
+                  if (ibatch < num_batch) {
+                    BATCHED_LU_MATRIX_BODY;
+                  }
+                }
+              );  // RAJA::loop<threads_x>
+            }
+          );  // RAJA::loop<teams_x>
+
+        }  // outer lambda (ctx)
+      );  // RAJA::launch
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  BATCHED_LU : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void BATCHED_LU::runHipVariantWarpPerMatrix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  BATCHED_LU_DATA_SETUP;
+
+  constexpr size_t matrices_per_block = block_size / warp_size;
+  static_assert(matrices_per_block*warp_size == block_size, "Invalid block_size");
+  const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_batch, matrices_per_block);
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((batched_lu_warp_per_matrix<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         A, LU, N, num_batch );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    constexpr bool async = true;
+
+    using launch_policy = RAJA::LaunchPolicy<RAJA::hip_launch_t<async, block_size>>;
+
+    using teams_x = RAJA::LoopPolicy<RAJA::hip_block_x_direct>;
+
+    using threads_x = RAJA::LoopPolicy<RAJA::hip_thread_size_x_loop<warp_size>>;
+
+    using threads_y = RAJA::LoopPolicy<RAJA::hip_thread_size_y_direct<matrices_per_block>>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::launch<launch_policy>( res,
+        RAJA::LaunchParams(RAJA::Teams(grid_size),
+                           RAJA::Threads(warp_size, matrices_per_block)),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<teams_x>(ctx, RAJA::RangeSegment(0, grid_size),
+            [&](Index_type bx) {
+
+              RAJA::loop<threads_y>(ctx, RAJA::RangeSegment(0, matrices_per_block),
+                [&](Index_type ty) {
+                  const Index_type ibatch = bx * matrices_per_block + ty;
+                  if (ibatch < num_batch) {
+                    RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, N*N),
+                      [&](Index_type ij) {
+                        BATCHED_LU_COPY_BODY;
+                      }
+                    );  // RAJA::loop<threads_x>
+                  }
+                }
+              );  // RAJA::loop<threads_y>
+
+              ctx.teamSync();
+
+              for (Index_type k = 0; k < N; ++k) {
+                const Index_type M = N-k-1;
+
+                RAJA::loop<threads_y>(ctx, RAJA::RangeSegment(0, matrices_per_block),
+                  [&](Index_type ty) {
+                    const Index_type ibatch = bx * matrices_per_block + ty;
+                    if (ibatch < num_batch) {
+                      RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, M),
+                        [&](Index_type t) {
+                          BATCHED_LU_SCALE_ENTRY_BODY;
+                        }
+                      );  // RAJA::loop<threads_x>
+                    }
+                  }
+                );  // RAJA::loop<threads_y>
+
+                ctx.teamSync();
+
+                RAJA::loop<threads_y>(ctx, RAJA::RangeSegment(0, matrices_per_block),
+                  [&](Index_type ty) {
+                    const Index_type ibatch = bx * matrices_per_block + ty;
+                    if (ibatch < num_batch) {
+                      RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, M*M),
+                        [&](Index_type t) {
+                          BATCHED_LU_UPDATE_ENTRY_BODY;
+                        }
+                      );  // RAJA::loop<threads_x>
+                    }
+                  }
+                );  // RAJA::loop<threads_y>
+
+                ctx.teamSync();
+              }
+
+            }
+          );  // RAJA::loop<teams_x>
+
+        }  // outer lambda (ctx)
+      );  // RAJA::launch
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  BATCHED_LU : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void BATCHED_LU::runHipVariantTeamPerMatrix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  BATCHED_LU_DATA_SETUP;
+
+  const size_t grid_size = num_batch;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((batched_lu_team_per_matrix<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         A, LU, N );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    constexpr bool async = true;
+
+    using launch_policy = RAJA::LaunchPolicy<RAJA::hip_launch_t<async, block_size>>;
+
+    using teams_x = RAJA::LoopPolicy<RAJA::hip_block_x_direct>;
+
+    using threads_x = RAJA::LoopPolicy<RAJA::hip_thread_size_x_loop<block_size>>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::launch<launch_policy>( res,
+        RAJA::LaunchParams(RAJA::Teams(grid_size),
+                           RAJA::Threads(block_size)),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<teams_x>(ctx, RAJA::RangeSegment(0, num_batch),
+            [&](Index_type ibatch) {
+
+              RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, N*N),
+                [&](Index_type ij) {
+                  BATCHED_LU_COPY_BODY;
+                }
+              );  // RAJA::loop<threads_x>
+
+              ctx.teamSync();
+
+              for (Index_type k = 0; k < N; ++k) {
+                const Index_type M = N-k-1;
+
+                RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, M),
+                  [&](Index_type t) {
+                    BATCHED_LU_SCALE_ENTRY_BODY;
+                  }
+                );  // RAJA::loop<threads_x>
+
+                ctx.teamSync();
+
+                RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, M*M),
+                  [&](Index_type t) {
+                    BATCHED_LU_UPDATE_ENTRY_BODY;
+                  }
+                );  // RAJA::loop<threads_x>
+
+                ctx.teamSync();
+              }
+
+            }
+          );  // RAJA::loop<teams_x>
+
+        }  // outer lambda (ctx)
+      );  // RAJA::launch
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  BATCHED_LU : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void BATCHED_LU::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_HIP ) {
+
+    if (tune_idx == t) {
+
+      runHipVariantBlas(vid);
+
+    }
+
+    t += 1;
+
+  }
+#endif
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runHipVariantThreadPerMatrix<block_size>(vid);
+
+      }
+
+      t += 1;
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runHipVariantWarpPerMatrix<block_size>(vid);
+
+      }
+
+      t += 1;
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runHipVariantTeamPerMatrix<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+}
+
+void BATCHED_LU::setHipTuningDefinitions(VariantID vid)
+{
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_HIP ) {
+
+    addVariantTuningName(vid, "rocsolver");
+
+  }
+#endif
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "thread_per_matrix_block_"+std::to_string(block_size));
+
+      addVariantTuningName(vid, "warp_per_matrix_block_"+std::to_string(block_size));
+
+      addVariantTuningName(vid, "team_per_matrix_block_"+std::to_string(block_size));
+
+    }
+
+  });
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BATCHED_LU.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void BATCHED_LU::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  BATCHED_LU_DATA_SETUP;
+
+#if defined(RUN_RAJA_SEQ)
+  auto batched_lu_lam = [=](Index_type ibatch) {
+                          BATCHED_LU_MATRIX_BODY;
+                        };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ibatch = 0; ibatch < num_batch; ++ibatch) {
+          BATCHED_LU_MATRIX_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ibatch = 0; ibatch < num_batch; ++ibatch) {
+          batched_lu_lam(ibatch);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using launch_policy = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+
+      using outer_x = RAJA::LoopPolicy<RAJA::seq_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::launch<launch_policy>(RAJA::LaunchParams(),
+          [=](RAJA::LaunchContext ctx) {
+
+            RAJA::loop<outer_x>(ctx, RAJA::RangeSegment(0, num_batch),
+              batched_lu_lam
+            );  // RAJA::loop<outer_x>
+
+          }  // outer lambda (ctx)
+        );  // RAJA::launch
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  BATCHED_LU : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BATCHED_LU.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+BATCHED_LU::BATCHED_LU(const RunParams& params)
+  : KernelBase(rajaperf::Basic_BATCHED_LU, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_N = getKernelParam("N", params.getBatchedMatrixSize());
+  m_num_batch = std::max(getTargetProblemSize() / (m_N*m_N), Index_type(1));
+
+  setActualProblemSize( m_num_batch * m_N*m_N );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_num_batch * m_N*m_N );
+  // step k does N-k-1 divisions and (N-k-1)^2 multiply-subtracts
+  setFLOPsPerRep(m_num_batch * ( m_N*(m_N-1)/2 +
+                                 2 * (m_N-1)*m_N*(2*m_N-1)/6 ));
+
+  checksum_scale_factor = 1e-3 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Launch);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+BATCHED_LU::~BATCHED_LU()
+{
+}
+
+void BATCHED_LU::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = m_num_batch * m_N*m_N;
+
+  //
+  // Off diagonal entries are multiples of 1/8 in [-1, 1) and diagonal
+  // entries are N, so every matrix is diagonally dominant by columns and
+  // factors stably without pivoting, matching the vendor library tunings.
+  //
+  constexpr unsigned long long a_seed = 5113;
+
+  allocData(m_A, len, vid);
+  {
+    auto reset_A = scopedMoveData(m_A, len, vid);
+    for (Index_type ibatch = 0; ibatch < m_num_batch; ++ibatch) {
+      for (Index_type j = 0; j < m_N; ++j) {
+        for (Index_type i = 0; i < m_N; ++i) {
+          const Index_type idx = ibatch*m_N*m_N + i + j*m_N;
+          m_A[idx] = (i == j)
+              ? static_cast<Real_type>(m_N)
+              : 0.125 * std::floor(16.0 * detail::counterRandValue(a_seed, idx)) - 1.0;
+        }
+      }
+    }
+  }
+  allocAndInitDataConst(m_LU, len, 0.0, vid);
+}
+
+void BATCHED_LU::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_LU, m_num_batch * m_N*m_N, checksum_scale_factor, vid);
+}
+
+void BATCHED_LU::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_A, vid);
+  deallocData(m_LU, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
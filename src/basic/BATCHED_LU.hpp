@@ -0,0 +1,144 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// BATCHED_LU kernel reference implementation:
+///
+/// // LU = A, then factor LU in place for each of num_batch N x N column
+/// // major matrices without pivoting (unit lower triangular L)
+/// for (Index_type ibatch = 0; ibatch < num_batch; ++ibatch) {
+///   for (Index_type ij = 0; ij < N*N; ++ij) {
+///     LU[ibatch*N*N + ij] = A[ibatch*N*N + ij];
+///   }
+///   for (Index_type k = 0; k < N; ++k) {
+///     for (Index_type i = k+1; i < N; ++i) {
+///       LU[ibatch*N*N + i + k*N] /= LU[ibatch*N*N + k + k*N];
+///     }
+///     for (Index_type j = k+1; j < N; ++j) {
+///       for (Index_type i = k+1; i < N; ++i) {
+///         LU[ibatch*N*N + i + j*N] -= LU[ibatch*N*N + i + k*N] *
+///                                     LU[ibatch*N*N + k + j*N];
+///       }
+///     }
+///   }
+/// }
+///
+/// N is given by --batched-matrix-size and the problem size sets num_batch.
+/// The matrices are diagonally dominant so no pivoting is needed.
+/// GPU tunings factor each matrix with one thread (thread_per_matrix),
+/// one warp (warp_per_matrix), or one thread block (team_per_matrix), or
+/// with the vendor batched getrf (cublas, rocsolver).
+///
+
+#ifndef RAJAPerf_Basic_BATCHED_LU_HPP
+#define RAJAPerf_Basic_BATCHED_LU_HPP
+
+#define BATCHED_LU_DATA_SETUP \
+  Real_ptr A = m_A; \
+  Real_ptr LU = m_LU; \
+  const Index_type N = m_N; \
+  const Index_type num_batch = m_num_batch;
+
+#define BATCHED_LU_COPY_BODY \
+  LU[ibatch*N*N + ij] = A[ibatch*N*N + ij];
+
+#define BATCHED_LU_SCALE_BODY \
+  LU[ibatch*N*N + i + k*N] /= LU[ibatch*N*N + k + k*N];
+
+#define BATCHED_LU_UPDATE_BODY \
+  LU[ibatch*N*N + i + j*N] -= LU[ibatch*N*N + i + k*N] * \
+                              LU[ibatch*N*N + k + j*N];
+
+#define BATCHED_LU_MATRIX_BODY \
+  for (Index_type ij = 0; ij < N*N; ++ij) { \
+    BATCHED_LU_COPY_BODY; \
+  } \
+  for (Index_type k = 0; k < N; ++k) { \
+    for (Index_type i = k+1; i < N; ++i) { \
+      BATCHED_LU_SCALE_BODY; \
+    } \
+    for (Index_type j = k+1; j < N; ++j) { \
+      for (Index_type i = k+1; i < N; ++i) { \
+        BATCHED_LU_UPDATE_BODY; \
+      } \
+    } \
+  }
+
+// entry t of the column below the diagonal in step k
+#define BATCHED_LU_SCALE_ENTRY_BODY \
+  const Index_type i = k+1 + t; \
+  BATCHED_LU_SCALE_BODY;
+
+// entry t of the trailing M x M submatrix in step k in column major order
+#define BATCHED_LU_UPDATE_ENTRY_BODY \
+  const Index_type i = k+1 + t % M; \
+  const Index_type j = k+1 + t / M; \
+  BATCHED_LU_UPDATE_BODY;
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class BATCHED_LU : public KernelBase
+{
+public:
+
+  BATCHED_LU(const RunParams& params);
+
+  ~BATCHED_LU();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runCudaVariantBlas(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantThreadPerMatrix(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpPerMatrix(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantTeamPerMatrix(VariantID vid);
+
+  void runHipVariantBlas(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantThreadPerMatrix(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpPerMatrix(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantTeamPerMatrix(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<64>>;
+
+  Index_type m_N;
+  Index_type m_num_batch;
+
+  Real_ptr m_A;
+  Real_ptr m_LU;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
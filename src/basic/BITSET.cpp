@@ -0,0 +1,154 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BITSET.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+BITSET::BITSET(const RunParams& params)
+  : KernelBase(rajaperf::Basic_BITSET, params)
+{
+  setDefaultProblemSize(100000);
+  setDefaultReps(50);
+
+  m_bits = getKernelParam("bits", 256, 64);
+  m_bits -= m_bits % 64;
+  m_pairs = getKernelParam("pairs", 8);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // touched data size, not actual number of stores and loads
+  setBytesPerRep( (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() +
+                  (m_bits/8) * (2*getActualProblemSize() + m_pairs-1) );
+  setFLOPsPerRep(0);
+
+  setMetricNames({"int_ops", "Gops"});
+
+  setUsesFeature(Forall);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+BITSET::~BITSET()
+{
+}
+
+//
+// Tunings before setting up the kernel tunings, ie. in the constructor, are
+// int32.
+//
+bool BITSET::isInt64Tuning(VariantID vid, size_t tune_idx) const
+{
+  return tune_idx < getNumVariantTunings(vid) &&
+         getVariantTuningName(vid, tune_idx).compare(0, 5, "int64") == 0;
+}
+
+std::vector<double> BITSET::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  const Index_type word_bits = isInt64Tuning(vid, tune_idx) ? 64 : 32;
+  const double ops = 3.0 * m_pairs * (m_bits / word_bits) * getActualProblemSize();
+  const double rep_time = getMinTime(vid, tune_idx) / getRunReps();
+  return {ops, (rep_time > 0.0) ? ops / rep_time / 1.0e9 : 0.0};
+}
+
+//
+// The words of both widths hold the same random bits, the 64 bit words in
+// little endian order of the 32 bit words.
+//
+void BITSET::setUp(VariantID vid, size_t tune_idx)
+{
+  constexpr unsigned long long a_seed = 4261;
+  constexpr unsigned long long b_seed = 4271;
+
+  const Index_type len = getActualProblemSize();
+  const Index_type a_words = (m_bits/32) * len;
+  const Index_type b_words = (m_bits/32) * (len + m_pairs-1);
+
+  auto randWord = [](unsigned long long seed, Index_type w) {
+    return static_cast<unsigned int>(
+        4294967296.0 * detail::counterRandValue(seed, w));
+  };
+
+  m_a32 = nullptr;
+  m_b32 = nullptr;
+  m_a64 = nullptr;
+  m_b64 = nullptr;
+
+  if (isInt64Tuning(vid, tune_idx)) {
+    allocData(m_a64, a_words/2, vid);
+    allocData(m_b64, b_words/2, vid);
+    auto reset_a = scopedMoveData(m_a64, a_words/2, vid);
+    auto reset_b = scopedMoveData(m_b64, b_words/2, vid);
+    for (Index_type w = 0; w < a_words/2; ++w) {
+      m_a64[w] = static_cast<Int64_type>(
+          (static_cast<unsigned long long>(randWord(a_seed, 2*w+1)) << 32) |
+          randWord(a_seed, 2*w));
+    }
+    for (Index_type w = 0; w < b_words/2; ++w) {
+      m_b64[w] = static_cast<Int64_type>(
+          (static_cast<unsigned long long>(randWord(b_seed, 2*w+1)) << 32) |
+          randWord(b_seed, 2*w));
+    }
+  } else {
+    allocData(m_a32, a_words, vid);
+    allocData(m_b32, b_words, vid);
+    auto reset_a = scopedMoveData(m_a32, a_words, vid);
+    auto reset_b = scopedMoveData(m_b32, b_words, vid);
+    for (Index_type w = 0; w < a_words; ++w) {
+      m_a32[w] = static_cast<Int32_type>(randWord(a_seed, w));
+    }
+    for (Index_type w = 0; w < b_words; ++w) {
+      m_b32[w] = static_cast<Int32_type>(randWord(b_seed, w));
+    }
+  }
+
+  allocAndInitDataConst(m_out, len, Int_type(0), vid);
+}
+
+void BITSET::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_out, getActualProblemSize(), vid);
+}
+
+void BITSET::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  if (m_a32 != nullptr) {
+    deallocData(m_a32, vid);
+    deallocData(m_b32, vid);
+  }
+  if (m_a64 != nullptr) {
+    deallocData(m_a64, vid);
+    deallocData(m_b64, vid);
+  }
+  deallocData(m_out, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// BITSET kernel reference implementation:
+///
+/// // the sizes of the intersections of bitset i of a with the bitsets
+/// // i to i+pairs-1 of b, of words UInt each
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   Int_type count = 0;
+///   for (Index_type j = 0; j < pairs; ++j ) {
+///     for (Index_type w = 0; w < words; ++w ) {
+///       count += popcount(a[i*words + w] & b[(i+j)*words + w]);
+///     }
+///   }
+///   out[i] = count;
+/// }
+///
+/// The kernel parameter "bits" (256 by default) gives the bits of each
+/// bitset, rounded down to a multiple of 64, and "pairs" (8 by default) the
+/// bitsets of b intersected with each bitset of a, which are reused from
+/// cache. Tunings give the width of the words, int32 and int64, of the same
+/// random bits, so both widths give the same checksum with twice the words,
+/// and popcounts, for int32.
+///
+/// The integer ops of a rep, an and, a popcount, and an add per word, and
+/// their rate in Gop/s are in the metrics file.
+///
+
+#ifndef RAJAPerf_Basic_BITSET_HPP
+#define RAJAPerf_Basic_BITSET_HPP
+
+#define BITSET_DATA_SETUP \
+  IntT* a; \
+  IntT* b; \
+  getData(a, b); \
+  Int_ptr out = m_out; \
+  const Index_type pairs = m_pairs; \
+  const Index_type words = m_bits / static_cast<Index_type>(8*sizeof(IntT));
+
+#define BITSET_BODY \
+  Int_type count = 0; \
+  for (Index_type j = 0; j < pairs; ++j ) { \
+    for (Index_type w = 0; w < words; ++w ) { \
+      count += bitsetPopcount(static_cast<UInt>(a[i*words + w]) & \
+                              static_cast<UInt>(b[(i+j)*words + w])); \
+    } \
+  } \
+  out[i] = count;
+
+
+#include "common/KernelBase.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+//
+// Set bits of v, with the popcount instructions of the device or host.
+//
+RAJA_HOST_DEVICE RAJA_INLINE Int_type bitsetPopcount(std::uint32_t v)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __popc(v);
+#else
+  return __builtin_popcount(v);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Int_type bitsetPopcount(std::uint64_t v)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __popcll(v);
+#else
+  return __builtin_popcountll(v);
+#endif
+}
+
+class BITSET : public KernelBase
+{
+public:
+
+  BITSET(const RunParams& params);
+
+  ~BITSET();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  // integer ops per rep and Gop/s
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  BITSET : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < typename IntT >
+  void runSeqVariantImpl(VariantID vid);
+  template < typename IntT >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, typename IntT >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, typename IntT >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  bool isInt64Tuning(VariantID vid, size_t tune_idx) const;
+
+  void getData(Int32_type*& a, Int32_type*& b) const
+  {
+    a = m_a32;
+    b = m_b32;
+  }
+  void getData(Int64_type*& a, Int64_type*& b) const
+  {
+    a = m_a64;
+    b = m_b64;
+  }
+
+  Index_type m_bits;
+  Index_type m_pairs;
+
+  Int32_type* m_a32;
+  Int32_type* m_b32;
+  Int64_type* m_a64;
+  Int64_type* m_b64;
+  Int_ptr m_out;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
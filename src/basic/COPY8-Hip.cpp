@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -35,7 +36,78 @@ __global__ void copy8(Real_ptr y0, Real_ptr y1, Real_ptr y2, Real_ptr y3, Real_p
 
 
 
-template < size_t block_size >
+template < size_t block_size, size_t items_per_thread, bool strided >
+__launch_bounds__(block_size)
+__global__ void copy8_coarsened(Real_ptr y0, Real_ptr y1, Real_ptr y2, Real_ptr y3, Real_ptr y4, Real_ptr y5, Real_ptr y6, Real_ptr y7,
+                                Real_ptr x0, Real_ptr x1, Real_ptr x2, Real_ptr x3, Real_ptr x4, Real_ptr x5, Real_ptr x6, Real_ptr x7,
+                                Index_type iend)
+{
+  #pragma unroll
+  for (size_t j = 0; j < items_per_thread; ++j) {
+    Index_type i = hip_coarsened_index<block_size, items_per_thread, strided>(j);
+    if (i < iend) {
+      COPY8_BODY;
+    }
+  }
+}
+
+template < size_t block_size, size_t vec_width >
+__launch_bounds__(block_size)
+__global__ void copy8_vec(Real_ptr y0, Real_ptr y1, Real_ptr y2, Real_ptr y3, Real_ptr y4, Real_ptr y5, Real_ptr y6, Real_ptr y7,
+                          Real_ptr x0, Real_ptr x1, Real_ptr x2, Real_ptr x3, Real_ptr x4, Real_ptr x5, Real_ptr x6, Real_ptr x7,
+                          Index_type iend)
+{
+  using vec_type = gpu_coarsen::vec_type<Real_type, vec_width>;
+  Index_type iv = blockIdx.x * block_size + threadIdx.x;
+  if ((iv+1) * static_cast<Index_type>(vec_width) <= iend) {
+    vec_type x0_v = reinterpret_cast<const vec_type*>(x0)[iv];
+    vec_type x1_v = reinterpret_cast<const vec_type*>(x1)[iv];
+    vec_type x2_v = reinterpret_cast<const vec_type*>(x2)[iv];
+    vec_type x3_v = reinterpret_cast<const vec_type*>(x3)[iv];
+    vec_type x4_v = reinterpret_cast<const vec_type*>(x4)[iv];
+    vec_type x5_v = reinterpret_cast<const vec_type*>(x5)[iv];
+    vec_type x6_v = reinterpret_cast<const vec_type*>(x6)[iv];
+    vec_type x7_v = reinterpret_cast<const vec_type*>(x7)[iv];
+    vec_type y0_v, y1_v, y2_v, y3_v, y4_v, y5_v, y6_v, y7_v;
+    {
+      Real_ptr y0 = y0_v.v;
+      Real_ptr y1 = y1_v.v;
+      Real_ptr y2 = y2_v.v;
+      Real_ptr y3 = y3_v.v;
+      Real_ptr y4 = y4_v.v;
+      Real_ptr y5 = y5_v.v;
+      Real_ptr y6 = y6_v.v;
+      Real_ptr y7 = y7_v.v;
+      Real_ptr x0 = x0_v.v;
+      Real_ptr x1 = x1_v.v;
+      Real_ptr x2 = x2_v.v;
+      Real_ptr x3 = x3_v.v;
+      Real_ptr x4 = x4_v.v;
+      Real_ptr x5 = x5_v.v;
+      Real_ptr x6 = x6_v.v;
+      Real_ptr x7 = x7_v.v;
+      #pragma unroll
+      for (Index_type i = 0; i < static_cast<Index_type>(vec_width); ++i) {
+        COPY8_BODY;
+      }
+    }
+    reinterpret_cast<vec_type*>(y0)[iv] = y0_v;
+    reinterpret_cast<vec_type*>(y1)[iv] = y1_v;
+    reinterpret_cast<vec_type*>(y2)[iv] = y2_v;
+    reinterpret_cast<vec_type*>(y3)[iv] = y3_v;
+    reinterpret_cast<vec_type*>(y4)[iv] = y4_v;
+    reinterpret_cast<vec_type*>(y5)[iv] = y5_v;
+    reinterpret_cast<vec_type*>(y6)[iv] = y6_v;
+    reinterpret_cast<vec_type*>(y7)[iv] = y7_v;
+  } else {
+    for (Index_type i = iv * static_cast<Index_type>(vec_width); i < iend; ++i) {
+      COPY8_BODY;
+    }
+  }
+}
+
+
+template < size_t block_size, bool launch >
 void COPY8::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -85,7 +157,7 @@ void COPY8::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         COPY8_BODY;
       });
@@ -98,7 +170,69 @@ void COPY8::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(COPY8, Hip)
+template < size_t block_size, size_t items_per_thread, bool strided >
+void COPY8::runHipVariantCoarsened(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  COPY8_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size*items_per_thread);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((copy8_coarsened<block_size, items_per_thread, strided>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+          y0, y1, y2, y3, y4, y5, y6, y7,
+          x0, x1, x2, x3, x4, x5, x6, x7,
+          iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  COPY8 : Unknown Hip coarsened variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size, size_t vec_width >
+void COPY8::runHipVariantVec(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  COPY8_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size*vec_width);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((copy8_vec<block_size, vec_width>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+          y0, y1, y2, y3, y4, y5, y6, y7,
+          x0, x1, x2, x3, x4, x5, x6, x7,
+          iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  COPY8 : Unknown Hip vec variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_COARSEN_TUNING_DEFINE_BOILERPLATE(COPY8, Hip, Base_HIP, RAJA_HIP)
 
 } // end namespace basic
 } // end namespace rajaperf
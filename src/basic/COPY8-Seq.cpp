@@ -10,7 +10,11 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrefetchUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +22,7 @@ namespace basic
 {
 
 
-void COPY8::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void COPY8::runSeqVariantPrefetch(VariantID vid, Index_type distance)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -26,6 +30,91 @@ void COPY8::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   COPY8_DATA_SETUP;
 
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ib = ibegin; ib < iend; ib += prefetch::line_length) {
+          const Index_type ie = std::min(ib + prefetch::line_length, iend);
+          if ( ib + distance < iend ) {
+            COPY8_PREFETCH(ib + distance);
+          }
+          for (Index_type i = ib; i < ie; ++i ) {
+            COPY8_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  COPY8 : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void COPY8::runSeqVariantSplit(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  COPY8_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COPY8_SPLIT_BODY_0;
+        }
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COPY8_SPLIT_BODY_1;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  COPY8 : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void COPY8::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  const std::vector<Index_type> distances = prefetch::getDistances();
+  if ( tune_idx > 0 && tune_idx < 1 + distances.size() ) {
+    runSeqVariantPrefetch(vid, distances[tune_idx - 1]);
+    return;
+  }
+  if ( tune_idx == 1 + distances.size() ) {
+    runSeqVariantSplit(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  COPY8_DATA_SETUP;
+
 #if defined(RUN_RAJA_SEQ)
   auto copy8_lam = [=](Index_type i) {
                      COPY8_BODY;
@@ -88,5 +177,17 @@ void COPY8::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void COPY8::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    for (Index_type distance : prefetch::getDistances()) {
+      addVariantTuningName(vid, prefetch::getPrefetchTuningName(distance));
+    }
+    addVariantTuningName(vid, prefetch::getSplitTuningName());
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -20,6 +20,10 @@
 ///   y7[i] = x7[i] ;
 /// }
 ///
+/// The Base CPU variants have tunings that prefetch each array a distance
+/// of elements ahead (prefetch_<distance>) and that copy the arrays in two
+/// loops of four arrays each (split).
+///
 
 #ifndef RAJAPerf_Basic_COPY8_HPP
 #define RAJAPerf_Basic_COPY8_HPP
@@ -52,6 +56,36 @@
   y6[i] = x6[i] ; \
   y7[i] = x7[i] ;
 
+#define COPY8_PREFETCH(i) \
+  prefetchRead(&x0[i]); \
+  prefetchRead(&x1[i]); \
+  prefetchRead(&x2[i]); \
+  prefetchRead(&x3[i]); \
+  prefetchRead(&x4[i]); \
+  prefetchRead(&x5[i]); \
+  prefetchRead(&x6[i]); \
+  prefetchRead(&x7[i]); \
+  prefetchWrite(&y0[i]); \
+  prefetchWrite(&y1[i]); \
+  prefetchWrite(&y2[i]); \
+  prefetchWrite(&y3[i]); \
+  prefetchWrite(&y4[i]); \
+  prefetchWrite(&y5[i]); \
+  prefetchWrite(&y6[i]); \
+  prefetchWrite(&y7[i]);
+
+#define COPY8_SPLIT_BODY_0  \
+  y0[i] = x0[i] ; \
+  y1[i] = x1[i] ; \
+  y2[i] = x2[i] ; \
+  y3[i] = x3[i] ;
+
+#define COPY8_SPLIT_BODY_1  \
+  y4[i] = x4[i] ; \
+  y5[i] = x5[i] ; \
+  y6[i] = x6[i] ; \
+  y7[i] = x7[i] ;
+
 
 #include "common/KernelBase.hpp"
 
@@ -81,12 +115,26 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantPrefetch(VariantID vid, Index_type distance);
+  void runSeqVariantSplit(VariantID vid);
+  void runOpenMPVariantPrefetch(VariantID vid, Index_type distance);
+  void runOpenMPVariantSplit(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, size_t items_per_thread, bool strided >
+  void runCudaVariantCoarsened(VariantID vid);
+  template < size_t block_size, size_t vec_width >
+  void runCudaVariantVec(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size, size_t items_per_thread, bool strided >
+  void runHipVariantCoarsened(VariantID vid);
+  template < size_t block_size, size_t vec_width >
+  void runHipVariantVec(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
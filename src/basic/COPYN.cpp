@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "COPYN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <limits>
+#include <string>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+COPYN::COPYN(const RunParams& params)
+  : KernelBase(rajaperf::Basic_COPYN, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  const Index_type max_arrays = getKernelParam("arrays", COPYN_DEFAULT_ARRAYS,
+                                               1, COPYN_MAX_ARRAYS);
+  m_array_offset = getKernelParam("offset", 0, 0,
+                                  std::numeric_limits<Index_type>::max());
+
+  for (Index_type num_arrays = 1; num_arrays < max_arrays; num_arrays *= 2) {
+    m_array_counts.emplace_back(num_arrays);
+  }
+  m_array_counts.emplace_back(max_arrays);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_array_stride = RAJA_DIVIDE_CEILING_INT(getActualProblemSize(), COPYN_ARRAY_ALIGN) *
+                   COPYN_ARRAY_ALIGN + m_array_offset;
+  m_num_arrays = max_arrays;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * max_arrays * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setHasPattern(Streaming);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+COPYN::~COPYN()
+{
+}
+
+//
+// Each tuning copies its number of arrays.
+//
+Index_type COPYN::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx >= getNumVariantTunings(vid)) {
+    return KernelBase::getBytesPerRep(vid, tune_idx);
+  }
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+         m_array_counts.at(tune_idx) * getActualProblemSize();
+}
+
+void COPYN::addArraysTuningNames(VariantID vid)
+{
+  for (Index_type num_arrays : m_array_counts) {
+    addVariantTuningName(vid, "arrays_"+std::to_string(num_arrays));
+  }
+}
+
+void COPYN::setSeqTuningDefinitions(VariantID vid)
+{
+  addArraysTuningNames(vid);
+}
+
+void COPYN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addArraysTuningNames(vid);
+}
+
+void COPYN::setCudaTuningDefinitions(VariantID vid)
+{
+  addArraysTuningNames(vid);
+}
+
+void COPYN::setHipTuningDefinitions(VariantID vid)
+{
+  addArraysTuningNames(vid);
+}
+
+void COPYN::setUp(VariantID vid, size_t tune_idx)
+{
+  m_num_arrays = m_array_counts.at(tune_idx);
+
+  const Index_type len = getActualProblemSize();
+
+  allocAndInitDataConst(m_x, m_num_arrays*m_array_stride, 0.0, vid);
+  allocAndInitDataConst(m_y, m_num_arrays*m_array_stride, 0.0, vid);
+
+  // all x arrays get the values initData gives one array, so every tuning
+  // gives the same checksum
+  auto reset_x = scopedMoveData(m_x, m_num_arrays*m_array_stride, vid);
+
+  for (Index_type a = 0; a < m_num_arrays; ++a) {
+    Real_ptr x = m_x + a*m_array_stride;
+    for (Index_type i = 0; i < len; ++i) {
+      x[i] = 0.1*(i + 1.1)/(i + 1.12345);
+    }
+  }
+}
+
+void COPYN::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const Real_type scale_factor = 1.0 / m_num_arrays;
+  for (Index_type a = 0; a < m_num_arrays; ++a) {
+    checksum[vid].at(tune_idx) += calcChecksum(m_y + a*m_array_stride,
+                                               getActualProblemSize(),
+                                               scale_factor, vid);
+  }
+}
+
+void COPYN::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
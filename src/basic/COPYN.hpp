@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// COPYN kernel reference implementation:
+///
+/// Real_ptr x[num_arrays];
+/// Real_ptr y[num_arrays];
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   for (Index_type a = 0; a < num_arrays; ++a) {
+///     y[a][i] = x[a][i] ;
+///   }
+/// }
+///
+/// Each tuning, arrays_<num_arrays>, copies num_arrays arrays at once, for
+/// num_arrays 1, 2, 4, ... up to the kernel parameter "arrays", at most
+/// COPYN_MAX_ARRAYS, and "arrays" itself, so a sweep of the number of
+/// concurrent streams is in one run.
+///
+/// The x arrays, and the y arrays, are laid out in one allocation each,
+/// array a starting at a * array_stride. The stride is the problem size
+/// rounded up to COPYN_ARRAY_ALIGN elements plus the kernel parameter
+/// "offset" in elements, so with offset 0 all arrays start at the same
+/// offset in a 4 KiB page and with other offsets the starts are skewed.
+///
+
+#ifndef RAJAPerf_Basic_COPYN_HPP
+#define RAJAPerf_Basic_COPYN_HPP
+
+#define COPYN_DEFAULT_ARRAYS 64
+// The pointers of all arrays fit in the 4KB kernel parameter limit with
+// room for the other kernel arguments.
+#define COPYN_MAX_ARRAYS 64
+// 4 KiB of Real_type elements
+#define COPYN_ARRAY_ALIGN 512
+
+#define COPYN_DATA_SETUP \
+  const Index_type num_arrays = m_num_arrays; \
+  Real_ptr x_data = m_x; \
+  Real_ptr y_data = m_y; \
+  COPYN_Arrays arrays{}; \
+  for (Index_type a = 0; a < num_arrays; ++a) { \
+    arrays.x[a] = x_data + a * m_array_stride; \
+    arrays.y[a] = y_data + a * m_array_stride; \
+  }
+
+#define COPYN_BODY(arrays) \
+  for (Index_type a = 0; a < num_arrays; ++a) { \
+    (arrays).y[a][i] = (arrays).x[a][i] ; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+//
+// Pointers of the x and y arrays, passed by value as a kernel argument or
+// lambda capture.
+//
+struct COPYN_Arrays {
+  Real_ptr x[COPYN_MAX_ARRAYS];
+  Real_ptr y[COPYN_MAX_ARRAYS];
+};
+
+class COPYN : public KernelBase
+{
+public:
+
+  COPYN(const RunParams& params);
+
+  ~COPYN();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COPYN : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+
+  void addArraysTuningNames(VariantID vid);
+
+  std::vector<Index_type> m_array_counts; // num_arrays of each tuning
+  Index_type m_array_offset;
+  Index_type m_array_stride;
+  Index_type m_num_arrays;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/BlasUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -21,10 +23,10 @@ namespace rajaperf
 namespace basic
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void daxpy(Real_ptr y, Real_ptr x,
-                      Real_type a,
+__global__ void daxpy(Data_type* y, Data_type* x,
+                      Data_type a,
                       Index_type iend)
 {
    Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -34,7 +36,7 @@ __global__ void daxpy(Real_ptr y, Real_ptr x,
 }
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size, bool launch >
 void DAXPY::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -52,7 +54,7 @@ void DAXPY::runCudaVariantImpl(VariantID vid)
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      daxpy<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( y, x, a,
+      daxpy<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( y, x, a,
                                         iend );
       cudaErrchk( cudaGetLastError() );
 
@@ -80,7 +82,7 @@ void DAXPY::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         DAXPY_BODY;
       });
@@ -93,7 +95,94 @@ void DAXPY::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(DAXPY, Cuda)
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+template < typename Data_type >
+void DAXPY::runCudaVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  DAXPY_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    cublasHandle_t handle;
+    cublasErrchk( cublasCreate(&handle) );
+    cublasErrchk( cublasSetStream(handle, res.get_stream()) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cublasErrchk( cublasAxpy(handle, iend, &a, x, y) );
+
+    }
+    stopTimer();
+
+    cublasErrchk( cublasDestroy(handle) );
+
+  } else {
+     getCout() << "\n  DAXPY : Unknown Cuda blas variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+template < typename Data_type >
+void DAXPY::runCudaVariantTyped(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<Data_type, block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Cuda, Impl, RAJAPERF_GPU_LAUNCH_TYPED_TPARAMS)
+
+  }
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_CUDA ) {
+    if (tune_idx == t) {
+      runCudaVariantBlas<Data_type>(vid);
+    }
+    t += 1;
+  }
+#endif
+}
+
+void DAXPY::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_CUDA ) {
+    addVariantTuningName(vid, "cublas");
+  }
+#endif
+}
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DAXPY, Cuda)
 
 } // end namespace basic
 } // end namespace rajaperf
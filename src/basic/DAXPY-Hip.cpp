@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/BlasUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -21,10 +23,10 @@ namespace rajaperf
 namespace basic
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void daxpy(Real_ptr y, Real_ptr x,
-                      Real_type a,
+__global__ void daxpy(Data_type* y, Data_type* x,
+                      Data_type a,
                       Index_type iend)
 {
    Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -35,7 +37,7 @@ __global__ void daxpy(Real_ptr y, Real_ptr x,
 
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size, bool launch >
 void DAXPY::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -53,7 +55,7 @@ void DAXPY::runHipVariantImpl(VariantID vid)
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      hipLaunchKernelGGL((daxpy<block_size>),dim3(grid_size), dim3(block_size), shmem, res.get_stream(), y, x, a,
+      hipLaunchKernelGGL((daxpy<Data_type, block_size>),dim3(grid_size), dim3(block_size), shmem, res.get_stream(), y, x, a,
                                         iend );
       hipErrchk( hipGetLastError() );
 
@@ -83,7 +85,7 @@ void DAXPY::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         DAXPY_BODY;
       });
@@ -96,7 +98,94 @@ void DAXPY::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(DAXPY, Hip)
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+template < typename Data_type >
+void DAXPY::runHipVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  DAXPY_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    rocblas_handle handle;
+    rocblasErrchk( rocblas_create_handle(&handle) );
+    rocblasErrchk( rocblas_set_stream(handle, res.get_stream()) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      rocblasErrchk( rocblasAxpy(handle, iend, &a, x, y) );
+
+    }
+    stopTimer();
+
+    rocblasErrchk( rocblas_destroy_handle(handle) );
+
+  } else {
+     getCout() << "\n  DAXPY : Unknown Hip blas variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+template < typename Data_type >
+void DAXPY::runHipVariantTyped(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<Data_type, block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Hip, Impl, RAJAPERF_GPU_LAUNCH_TYPED_TPARAMS)
+
+  }
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_HIP ) {
+    if (tune_idx == t) {
+      runHipVariantBlas<Data_type>(vid);
+    }
+    t += 1;
+  }
+#endif
+}
+
+void DAXPY::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_HIP ) {
+    addVariantTuningName(vid, "rocblas");
+  }
+#endif
+}
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DAXPY, Hip)
 
 } // end namespace basic
 } // end namespace rajaperf
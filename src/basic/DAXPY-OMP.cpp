@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,8 @@ namespace basic
 {
 
 
-void DAXPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void DAXPY::runOpenMPVariantSchedule(VariantID vid, size_t schedule_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -28,6 +31,88 @@ void DAXPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
   DAXPY_DATA_SETUP;
 
+  omp_schedule::ScopedSchedule schedule(omp_schedule::getSchedules()[schedule_idx]);
+
+  auto daxpy_lam = [=](Index_type i) {
+                     DAXPY_BODY;
+                   };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(runtime)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DAXPY_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(runtime)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          daxpy_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_parallel_for_runtime_exec>(
+          RAJA::RangeSegment(ibegin, iend), daxpy_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DAXPY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(schedule_idx);
+#endif
+}
+
+template < typename Data_type >
+void DAXPY::runOpenMPVariantTyped(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx > 0 ) {
+    runOpenMPVariantSchedule<Data_type>(vid, tune_idx - 1);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DAXPY_DATA_SETUP;
+
   auto daxpy_lam = [=](Index_type i) {
                      DAXPY_BODY;
                    };
@@ -88,6 +173,20 @@ void DAXPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DAXPY, OpenMP)
+
+void DAXPY::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  for (omp_schedule::Schedule const& schedule : omp_schedule::getSchedules()) {
+    addVariantTuningName(vid, omp_schedule::getScheduleTuningName(schedule));
+  }
 #endif
 }
 
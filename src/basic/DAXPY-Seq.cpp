@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/BlasUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,8 +20,51 @@ namespace basic
 {
 
 
-void DAXPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+template < typename Data_type >
+void DAXPY::runSeqVariantCblas(VariantID vid)
 {
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  DAXPY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        cblasAxpy(iend, a, x, y);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DAXPY : Unknown cblas variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
+template < typename Data_type >
+void DAXPY::runSeqVariantTyped(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+  if ( tune_idx == 1 ) {
+    runSeqVariantCblas<Data_type>(vid);
+    return;
+  }
+#else
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -88,5 +133,18 @@ void DAXPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DAXPY, Seq)
+
+void DAXPY::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "cblas");
+  }
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -33,6 +33,10 @@ DAXPY::DAXPY(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Streaming);
+
+  setUsesFloatingPointDataTypes();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -41,6 +45,8 @@ DAXPY::DAXPY(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -52,6 +58,9 @@ DAXPY::DAXPY(const RunParams& params)
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
 
+  setVariantDefined( Base_SYCL );
+  setVariantDefined( RAJA_SYCL );
+
   setVariantDefined( Kokkos_Lambda );
 }
 
@@ -59,23 +68,49 @@ DAXPY::~DAXPY()
 {
 }
 
-void DAXPY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DAXPY::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_x, getActualProblemSize(), vid);
-  initData(m_a, vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void DAXPY::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid].at(tune_idx) += calcChecksum(m_y, getActualProblemSize(), vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), updateChecksumTyped, vid, tune_idx);
+}
+
+void DAXPY::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void DAXPY::setUpTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Data_type* x;
+  Data_type* y;
+  allocAndInitDataConst(y, getActualProblemSize(), Data_type(0), vid);
+  allocAndInitData(x, getActualProblemSize(), vid);
+  initData(m_a, vid);
+  m_x = x;
+  m_y = y;
+}
+
+template < typename Data_type >
+void DAXPY::updateChecksumTyped(VariantID vid, size_t tune_idx)
+{
+  Data_type* y = static_cast<Data_type*>(m_y);
+  checksum[vid].at(tune_idx) += calcChecksum(y, getActualProblemSize(), vid);
 }
 
-void DAXPY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void DAXPY::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  (void) vid;
-  deallocData(m_x, vid);
-  deallocData(m_y, vid);
+  Data_type* x = static_cast<Data_type*>(m_x);
+  Data_type* y = static_cast<Data_type*>(m_y);
+  deallocData(x, vid);
+  deallocData(y, vid);
+  m_x = nullptr;
+  m_y = nullptr;
 }
 
 } // end namespace basic
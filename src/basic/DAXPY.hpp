@@ -13,20 +13,24 @@
 ///   y[i] += a * x[i] ;
 /// }
 ///
+/// The cblas, cublas, and rocblas tunings call the axpy routine of the
+/// vendor BLAS library, see common/BlasUtils.hpp.
+///
 
 #ifndef RAJAPerf_Basic_DAXPY_HPP
 #define RAJAPerf_Basic_DAXPY_HPP
 
 #define DAXPY_DATA_SETUP \
-  Real_ptr x = m_x; \
-  Real_ptr y = m_y; \
-  Real_type a = m_a;
+  Data_type* x = static_cast<Data_type*>(m_x); \
+  Data_type* y = static_cast<Data_type*>(m_y); \
+  Data_type a = static_cast<Data_type>(m_a);
 
 #define DAXPY_BODY  \
   y[i] += a * x[i] ;
 
 
 #include "common/KernelBase.hpp"
+#include "common/DataTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -52,21 +56,60 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runSyclVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  template < typename Data_type >
+  void setUpTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void updateChecksumTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void tearDownTyped(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void runSeqVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runSyclVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPTargetVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runKokkosVariantTyped(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void setSyclTuningDefinitions(VariantID vid);
+  void setOpenMPTargetTuningDefinitions(VariantID vid);
+  template < typename Data_type >
+  void runSeqVariantCblas(VariantID vid);
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < typename Data_type >
+  void runCudaVariantBlas(VariantID vid);
+  template < typename Data_type >
+  void runHipVariantBlas(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runSyclVariantImpl(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantSchedule(VariantID vid, size_t schedule_idx);
+  template < typename Data_type >
+  void runOpenMPTargetVariantMapped(VariantID vid, size_t tune_idx);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
-  Real_ptr m_x;
-  Real_ptr m_y;
+  void* m_x; // array of Data_type
+  void* m_y; // array of Data_type
   Real_type m_a;
 };
 
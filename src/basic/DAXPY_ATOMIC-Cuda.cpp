@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -34,7 +35,7 @@ __global__ void daxpy_atomic(Real_ptr y, Real_ptr x,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void DAXPY_ATOMIC::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -80,7 +81,7 @@ void DAXPY_ATOMIC::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         DAXPY_ATOMIC_RAJA_BODY(RAJA::cuda_atomic);
       });
@@ -93,7 +94,7 @@ void DAXPY_ATOMIC::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(DAXPY_ATOMIC, Cuda)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(DAXPY_ATOMIC, Cuda, RAJA_CUDA)
 
 } // end namespace basic
 } // end namespace rajaperf
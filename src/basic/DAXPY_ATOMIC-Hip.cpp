@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -34,7 +35,7 @@ __global__ void daxpy_atomic(Real_ptr y, Real_ptr x,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void DAXPY_ATOMIC::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -82,7 +83,7 @@ void DAXPY_ATOMIC::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         DAXPY_ATOMIC_RAJA_BODY(RAJA::hip_atomic);
       });
@@ -95,7 +96,7 @@ void DAXPY_ATOMIC::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(DAXPY_ATOMIC, Hip)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(DAXPY_ATOMIC, Hip, RAJA_HIP)
 
 } // end namespace basic
 } // end namespace rajaperf
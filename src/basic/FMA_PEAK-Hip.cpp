@@ -0,0 +1,214 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FMA_PEAK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <hip/hip_fp16.h>
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+template < typename T, Index_type ilp, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fma_peak(Real_ptr y, const Real_type* x, T b, T c,
+                         Index_type fmas, Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if ( i < iend ) {
+    T a[ilp];
+    #pragma unroll
+    for (Index_type l = 0; l < ilp; ++l ) {
+      a[l] = static_cast<T>(x[i]);
+    }
+    for (Index_type k = 0; k < fmas/ilp; ++k ) {
+      #pragma unroll
+      for (Index_type l = 0; l < ilp; ++l ) {
+        a[l] = a[l] * b + c;
+      }
+    }
+    T m = a[0];
+    #pragma unroll
+    for (Index_type l = 1; l < ilp; ++l ) {
+      m = (a[l] < m) ? a[l] : m;
+    }
+    y[i] = static_cast<Real_type>(m);
+  }
+}
+
+//
+// Each thread runs the chains of elements i and i+1 in the halves of a
+// __half2, so each __hfma2 is two FMAs.
+//
+template < Index_type ilp, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fma_peak_half2(Real_ptr y, const Real_type* x,
+                               float b, float c,
+                               Index_type fmas, Index_type iend)
+{
+  Index_type i = 2 * (blockIdx.x * block_size + threadIdx.x);
+  if ( i < iend ) {
+    const bool has_next = (i+1 < iend);
+    const __half2 b2 = __float2half2_rn(b);
+    const __half2 c2 = __float2half2_rn(c);
+    __half2 a[ilp];
+    #pragma unroll
+    for (Index_type l = 0; l < ilp; ++l ) {
+      a[l] = __floats2half2_rn(x[i], has_next ? x[i+1] : x[i]);
+    }
+    for (Index_type k = 0; k < fmas/ilp; ++k ) {
+      #pragma unroll
+      for (Index_type l = 0; l < ilp; ++l ) {
+        a[l] = __hfma2(a[l], b2, c2);
+      }
+    }
+    float m0 = __low2float(a[0]);
+    float m1 = __high2float(a[0]);
+    #pragma unroll
+    for (Index_type l = 1; l < ilp; ++l ) {
+      m0 = fminf(m0, __low2float(a[l]));
+      m1 = fminf(m1, __high2float(a[l]));
+    }
+    y[i] = m0;
+    if ( has_next ) {
+      y[i+1] = m1;
+    }
+  }
+}
+
+
+template < typename T, Index_type ilp, size_t block_size >
+void FMA_PEAK::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  FMA_PEAK_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((fma_peak<T, ilp, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         y, x, static_cast<T>(b), static_cast<T>(c), fmas, iend);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FMA_PEAK : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < Index_type ilp, size_t block_size >
+void FMA_PEAK::runHipVariantHalf(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  FMA_PEAK_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, 2*block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((fma_peak_half2<ilp, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         y, x, static_cast<float>(b), static_cast<float>(c), fmas, iend);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FMA_PEAK : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void FMA_PEAK::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantImpl<Double_type, ilp, block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+  });
+
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantImpl<Float_type, ilp, block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+  });
+
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantHalf<ilp, block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+  });
+}
+
+void FMA_PEAK::setHipTuningDefinitions(VariantID vid)
+{
+  for (std::string type_name : {"fp64", "fp32", "fp16"}) {
+    seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+          addVariantTuningName(vid, getFMATuningName(type_name, ilp) +
+                                    "_block_" + std::to_string(block_size));
+        }
+      });
+    });
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FMA_PEAK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+//
+// Elements each thread runs at a time.
+//
+constexpr Index_type fma_peak_omp_chunk = 1024;
+
+template < typename T, Index_type ilp >
+void FMA_PEAK::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FMA_PEAK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i0 = ibegin; i0 < iend; i0 += fma_peak_omp_chunk) {
+          const Index_type i1 = (iend - i0 < fma_peak_omp_chunk)
+                              ? iend : i0 + fma_peak_omp_chunk;
+          fmaPeakElements<T, ilp>(y, x, static_cast<T>(b), static_cast<T>(c),
+                                  fmas, i0, i1);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FMA_PEAK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FMA_PEAK::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    if (tune_idx == t) {
+      runOpenMPVariantImpl<Double_type, ilp>(vid);
+    }
+    t += 1;
+  });
+
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    if (tune_idx == t) {
+      runOpenMPVariantImpl<Float_type, ilp>(vid);
+    }
+    t += 1;
+  });
+
+#if defined(RAJA_PERFSUITE_HAVE_CPU_FP16)
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    if (tune_idx == t) {
+      runOpenMPVariantImpl<_Float16, ilp>(vid);
+    }
+    t += 1;
+  });
+#endif
+}
+
+void FMA_PEAK::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (std::string type_name : {"fp64", "fp32"}) {
+    seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+      addVariantTuningName(vid, getFMATuningName(type_name, ilp));
+    });
+  }
+
+#if defined(RAJA_PERFSUITE_HAVE_CPU_FP16)
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    addVariantTuningName(vid, getFMATuningName("fp16", ilp));
+  });
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
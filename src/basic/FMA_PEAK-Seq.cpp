@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FMA_PEAK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < typename T, Index_type ilp >
+void FMA_PEAK::runSeqVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FMA_PEAK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        fmaPeakElements<T, ilp>(y, x, static_cast<T>(b), static_cast<T>(c),
+                                fmas, ibegin, iend);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FMA_PEAK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FMA_PEAK::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    if (tune_idx == t) {
+      runSeqVariantImpl<Double_type, ilp>(vid);
+    }
+    t += 1;
+  });
+
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    if (tune_idx == t) {
+      runSeqVariantImpl<Float_type, ilp>(vid);
+    }
+    t += 1;
+  });
+
+#if defined(RAJA_PERFSUITE_HAVE_CPU_FP16)
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    if (tune_idx == t) {
+      runSeqVariantImpl<_Float16, ilp>(vid);
+    }
+    t += 1;
+  });
+#endif
+}
+
+void FMA_PEAK::setSeqTuningDefinitions(VariantID vid)
+{
+  for (std::string type_name : {"fp64", "fp32"}) {
+    seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+      addVariantTuningName(vid, getFMATuningName(type_name, ilp));
+    });
+  }
+
+#if defined(RAJA_PERFSUITE_HAVE_CPU_FP16)
+  seq_for(fma_peak_ilps_type{}, [&](auto ilp) {
+    addVariantTuningName(vid, getFMATuningName("fp16", ilp));
+  });
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,75 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FMA_PEAK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+FMA_PEAK::FMA_PEAK(const RunParams& params)
+  : KernelBase(rajaperf::Basic_FMA_PEAK, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(20);
+
+  m_fmas = getKernelParam("fmas", 1024, fma_peak_max_ilp);
+  m_fmas -= m_fmas % fma_peak_max_ilp;
+  m_b = 1.0;
+  m_c = 0.0;
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(2 * m_fmas * getActualProblemSize());
+
+  setUsesFeature(Forall);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+FMA_PEAK::~FMA_PEAK()
+{
+}
+
+void FMA_PEAK::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitDataConst(m_x, getActualProblemSize(), 0.5, vid);
+  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+}
+
+void FMA_PEAK::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid].at(tune_idx) += calcChecksum(m_y, getActualProblemSize(), vid);
+}
+
+void FMA_PEAK::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,186 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FMA_PEAK kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   T a[ilp];
+///   for (Index_type l = 0; l < ilp; ++l ) {
+///     a[l] = x[i];
+///   }
+///   for (Index_type k = 0; k < fmas/ilp; ++k ) {
+///     for (Index_type l = 0; l < ilp; ++l ) {
+///       a[l] = a[l] * b + c;
+///     }
+///   }
+///   y[i] = min(a[0], ..., a[ilp-1]);
+/// }
+///
+/// Each element does fmas fused multiply adds, given by the kernel
+/// parameter "fmas" (1024 by default), in ilp independent dependence
+/// chains, so the FLOP rate is limited by FMA throughput when ilp covers
+/// the FMA latency and by latency otherwise. Tunings give the element type
+/// T and ilp, ie. fp32_ilp_8. CPU tunings run each chain on a SIMD register
+/// worth of elements, GPU fp16 tunings run each chain on a __half2 of two
+/// elements. b and c are 1 and 0, read at run time so the FMAs can not be
+/// removed, and x is 0.5, so every tuning computes y[i] = 0.5 exactly.
+///
+/// When it is run, the best rate of the tunings of Real_type is the peak
+/// GFLOP/s of the roofline report, unless --peak-flops is given.
+///
+
+#ifndef RAJAPerf_Basic_FMA_PEAK_HPP
+#define RAJAPerf_Basic_FMA_PEAK_HPP
+
+#define FMA_PEAK_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  const Index_type fmas = m_fmas; \
+  const Real_type b = m_b; \
+  const Real_type c = m_c;
+
+
+#include "common/KernelBase.hpp"
+#include "common/SimdUtils.hpp"
+
+#include <string>
+
+#if defined(__FLT16_MAX__)
+#define RAJA_PERFSUITE_HAVE_CPU_FP16
+#endif
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+//
+// The ilp of the tunings, fmas is rounded down to a multiple of the largest.
+//
+using fma_peak_ilps_type = camp::int_seq<Index_type, 1, 2, 4, 8, 16>;
+constexpr Index_type fma_peak_max_ilp = 16;
+
+//
+// Bytes of the widest SIMD registers the CPU tunings are compiled for.
+//
+#if defined(__AVX512F__)
+constexpr Index_type fma_peak_simd_bytes = 64;
+#elif defined(__AVX__)
+constexpr Index_type fma_peak_simd_bytes = 32;
+#elif defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && \
+      __ARM_FEATURE_SVE_BITS > 0
+constexpr Index_type fma_peak_simd_bytes = __ARM_FEATURE_SVE_BITS / 8;
+#else
+constexpr Index_type fma_peak_simd_bytes = 16;
+#endif
+
+//
+// Run the reference loop for elements [ibegin, iend) a SIMD register worth
+// of elements at a time, elements past iend repeat the last element.
+//
+template < typename T, Index_type ilp >
+inline void fmaPeakElements(Real_ptr y, const Real_type* x,
+                            T b, T c, Index_type fmas,
+                            Index_type ibegin, Index_type iend)
+{
+  constexpr Index_type width = fma_peak_simd_bytes / sizeof(T);
+
+  for (Index_type i0 = ibegin; i0 < iend; i0 += width) {
+    const Index_type len = (iend - i0 < width) ? iend - i0 : width;
+
+    T a[ilp][width];
+    for (Index_type l = 0; l < ilp; ++l ) {
+      for (Index_type w = 0; w < width; ++w ) {
+        a[l][w] = static_cast<T>(x[i0 + (w < len ? w : len-1)]);
+      }
+    }
+
+    for (Index_type k = 0; k < fmas/ilp; ++k ) {
+      for (Index_type l = 0; l < ilp; ++l ) {
+        RAJAPERF_SIMD
+        for (Index_type w = 0; w < width; ++w ) {
+          a[l][w] = a[l][w] * b + c;
+        }
+      }
+    }
+
+    for (Index_type w = 0; w < len; ++w ) {
+      T m = a[0][w];
+      for (Index_type l = 1; l < ilp; ++l ) {
+        m = (a[l][w] < m) ? a[l][w] : m;
+      }
+      y[i0 + w] = static_cast<Real_type>(m);
+    }
+  }
+}
+
+class FMA_PEAK : public KernelBase
+{
+public:
+
+  FMA_PEAK(const RunParams& params);
+
+  ~FMA_PEAK();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FMA_PEAK : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  template < typename T, Index_type ilp >
+  void runSeqVariantImpl(VariantID vid);
+  template < typename T, Index_type ilp >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < typename T, Index_type ilp, size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < Index_type ilp, size_t block_size >
+  void runCudaVariantHalf(VariantID vid);
+  template < typename T, Index_type ilp, size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+  template < Index_type ilp, size_t block_size >
+  void runHipVariantHalf(VariantID vid);
+
+  // return the tuning name of element type name and ilp, ie. fp64_ilp_4
+  static std::string getFMATuningName(const std::string& type_name,
+                                      Index_type ilp)
+  {
+    return type_name + "_ilp_" + std::to_string(ilp);
+  }
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type m_fmas;
+  Real_type m_b;
+  Real_type m_c;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
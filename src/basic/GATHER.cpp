@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include "GatherUtils.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+GATHER::GATHER(const RunParams& params)
+  : KernelBase(rajaperf::Basic_GATHER, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setHasPattern(GatherScatter);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+GATHER::~GATHER()
+{
+}
+
+void GATHER::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  std::vector<Int_type> idx =
+      makeGatherIndices(len, run_params.getGatherPattern(),
+                        run_params.getGatherBlockSize());
+
+  allocAndInitDataConst(m_y, len, 0.0, vid);
+  allocAndInitData(m_x, len, vid);
+  allocData(m_idx, len, vid);
+  copyData(getDataSpace(vid), m_idx, DataSpace::Host, idx.data(), len);
+}
+
+void GATHER::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, getActualProblemSize(), vid);
+}
+
+void GATHER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_y, vid);
+  deallocData(m_x, vid);
+  deallocData(m_idx, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
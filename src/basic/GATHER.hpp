@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// GATHER kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   y[i] = x[idx[i]] ;
+/// }
+///
+/// idx is a permutation of [0, iend) whose locality is given by
+/// --gather-pattern and --gather-block-size, see basic/GatherUtils.hpp.
+/// Compare its bandwidth to Stream_COPY, which moves the same data
+/// contiguously.
+///
+
+#ifndef RAJAPerf_Basic_GATHER_HPP
+#define RAJAPerf_Basic_GATHER_HPP
+
+
+#define GATHER_DATA_SETUP \
+  Real_ptr y = m_y; \
+  Real_ptr x = m_x; \
+  Int_ptr idx = m_idx;
+
+#define GATHER_BODY  \
+  y[i] = x[idx[i]] ;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class GATHER : public KernelBase
+{
+public:
+
+  GATHER(const RunParams& params);
+
+  ~GATHER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Real_ptr m_y;
+  Real_ptr m_x;
+  Int_ptr m_idx;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Index patterns used by the gather and scatter kernels.
+///
+
+#ifndef RAJAPerf_GatherUtils_HPP
+#define RAJAPerf_GatherUtils_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/DataUtils.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+/*!
+ * \brief Return a permutation of [0, len) with the locality given by
+ * pattern, one of
+ *   identity       - idx[i] = i
+ *   strided        - every block_size-th index starting at 0, then at 1,
+ *                    and so on
+ *   block_shuffled - blocks of block_size contiguous indices in random
+ *                    order
+ *   random         - a random permutation
+ * The indices are a permutation so scatters through them do not conflict.
+ */
+inline std::vector<Int_type> makeGatherIndices(Index_type len,
+                                               const std::string& pattern,
+                                               Index_type block_size)
+{
+  constexpr unsigned long long gather_seed = 7723;
+
+  std::vector<Int_type> idx(len);
+
+  if (pattern == "strided") {
+
+    Index_type i = 0;
+    for (Index_type first = 0; first < block_size && first < len; ++first) {
+      for (Index_type j = first; j < len; j += block_size) {
+        idx[i++] = static_cast<Int_type>(j);
+      }
+    }
+
+  } else if (pattern == "block_shuffled") {
+
+    const Index_type num_blocks = (len + block_size - 1) / block_size;
+    std::vector<Index_type> blocks(num_blocks);
+    for (Index_type b = 0; b < num_blocks; ++b) {
+      blocks[b] = b;
+    }
+    for (Index_type b = num_blocks-1; b > 0; --b) {
+      const Index_type r = static_cast<Index_type>(
+          detail::counterRandValue(gather_seed, b) * (b+1));
+      std::swap(blocks[b], blocks[r]);
+    }
+    Index_type i = 0;
+    for (Index_type b = 0; b < num_blocks; ++b) {
+      for (Index_type j = blocks[b]*block_size;
+           j < (blocks[b]+1)*block_size && j < len; ++j) {
+        idx[i++] = static_cast<Int_type>(j);
+      }
+    }
+
+  } else {
+
+    for (Index_type i = 0; i < len; ++i) {
+      idx[i] = static_cast<Int_type>(i);
+    }
+    if (pattern == "random") {
+      for (Index_type i = len-1; i > 0; --i) {
+        const Index_type r = static_cast<Index_type>(
+            detail::counterRandValue(gather_seed, i) * (i+1));
+        std::swap(idx[i], idx[r]);
+      }
+    }
+
+  }
+
+  return idx;
+}
+
+}  // closing brace for basic namespace
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
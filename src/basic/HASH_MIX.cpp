@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HASH_MIX.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+HASH_MIX::HASH_MIX(const RunParams& params)
+  : KernelBase(rajaperf::Basic_HASH_MIX, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_rounds = getKernelParam("rounds", 16);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  setFLOPsPerRep(0);
+
+  setMetricNames({"int_ops", "Gops"});
+
+  setUsesFeature(Forall);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+HASH_MIX::~HASH_MIX()
+{
+}
+
+//
+// Tunings before setting up the kernel tunings, ie. in the constructor, are
+// int32.
+//
+bool HASH_MIX::isInt64Tuning(VariantID vid, size_t tune_idx) const
+{
+  return tune_idx < getNumVariantTunings(vid) &&
+         getVariantTuningName(vid, tune_idx).compare(0, 5, "int64") == 0;
+}
+
+Index_type HASH_MIX::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const Index_type int_size = isInt64Tuning(vid, tune_idx) ? sizeof(Int64_type)
+                                                           : sizeof(Int32_type);
+  return (1*int_size + 1*int_size) * getActualProblemSize();
+}
+
+std::vector<double> HASH_MIX::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  const double ops = static_cast<double>(hash_mix_round_ops) * m_rounds *
+                     getActualProblemSize();
+  const double rep_time = getMinTime(vid, tune_idx) / getRunReps();
+  return {ops, (rep_time > 0.0) ? ops / rep_time / 1.0e9 : 0.0};
+}
+
+//
+// Random 64 bit keys, the int32 tunings hash the low 32 bits.
+//
+void HASH_MIX::setUp(VariantID vid, size_t tune_idx)
+{
+  constexpr unsigned long long key_seed = 4283;
+
+  const Index_type len = getActualProblemSize();
+
+  auto randWord = [](Index_type w) {
+    return static_cast<std::uint64_t>(
+        4294967296.0 * detail::counterRandValue(key_seed, w));
+  };
+
+  m_keys32 = nullptr;
+  m_keys64 = nullptr;
+  m_out32 = nullptr;
+  m_out64 = nullptr;
+
+  if (isInt64Tuning(vid, tune_idx)) {
+    allocData(m_keys64, len, vid);
+    auto reset_keys = scopedMoveData(m_keys64, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      m_keys64[i] = static_cast<Int64_type>((randWord(2*i+1) << 32) | randWord(2*i));
+    }
+    allocAndInitDataConst(m_out64, len, Int64_type(0), vid);
+  } else {
+    allocData(m_keys32, len, vid);
+    auto reset_keys = scopedMoveData(m_keys32, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      m_keys32[i] = static_cast<Int32_type>(randWord(2*i));
+    }
+    allocAndInitDataConst(m_out32, len, Int32_type(0), vid);
+  }
+}
+
+void HASH_MIX::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  if (m_out64 != nullptr) {
+    checksum[vid][tune_idx] += calcChecksum(m_out64, getActualProblemSize(), vid);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_out32, getActualProblemSize(), vid);
+  }
+}
+
+void HASH_MIX::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  if (m_keys32 != nullptr) {
+    deallocData(m_keys32, vid);
+    deallocData(m_out32, vid);
+  }
+  if (m_keys64 != nullptr) {
+    deallocData(m_keys64, vid);
+    deallocData(m_out64, vid);
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HASH_MIX kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   UInt h = keys[i];
+///   for (Index_type r = 0; r < rounds; ++r ) {
+///     h = fmix(h + golden);
+///   }
+///   out[i] = h;
+/// }
+///
+/// fmix is the finalizer of MurmurHash3, xor shifts and multiplies by odd
+/// constants, as in the hashing of mesh connectivity, and golden is the
+/// golden ratio constant of the width. The kernel parameter "rounds" (16 by
+/// default) gives the dependent rounds of each key. Tunings give the width,
+/// int32 uses fmix32 with 32 bit multiplies and int64 uses fmix64 with 64
+/// bit multiplies, which many GPUs and CPU SIMD units do in several
+/// instructions, so the widths hash different functions of the keys and
+/// have different checksums.
+///
+/// The integer ops of a rep, 8 per round, and their rate in Gop/s are in
+/// the metrics file.
+///
+
+#ifndef RAJAPerf_Basic_HASH_MIX_HPP
+#define RAJAPerf_Basic_HASH_MIX_HPP
+
+#define HASH_MIX_DATA_SETUP \
+  IntT* keys; \
+  IntT* out; \
+  getData(keys, out); \
+  const Index_type rounds = m_rounds;
+
+#define HASH_MIX_BODY \
+  UInt h = static_cast<UInt>(keys[i]); \
+  for (Index_type r = 0; r < rounds; ++r ) { \
+    h = hashMix(h); \
+  } \
+  out[i] = static_cast<IntT>(h);
+
+
+#include "common/KernelBase.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+// integer ops of a round of hashMix
+constexpr Index_type hash_mix_round_ops = 8;
+
+//
+// A round of the hash, add the golden ratio constant and mix with fmix32
+// or fmix64 of MurmurHash3.
+//
+RAJA_HOST_DEVICE RAJA_INLINE std::uint32_t hashMix(std::uint32_t h)
+{
+  h += 0x9E3779B9u;
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35u;
+  h ^= h >> 16;
+  return h;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE std::uint64_t hashMix(std::uint64_t h)
+{
+  h += 0x9E3779B97F4A7C15ull;
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDull;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+class HASH_MIX : public KernelBase
+{
+public:
+
+  HASH_MIX(const RunParams& params);
+
+  ~HASH_MIX();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  // integer ops per rep and Gop/s
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HASH_MIX : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < typename IntT >
+  void runSeqVariantImpl(VariantID vid);
+  template < typename IntT >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, typename IntT >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, typename IntT >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  bool isInt64Tuning(VariantID vid, size_t tune_idx) const;
+
+  void getData(Int32_type*& keys, Int32_type*& out) const
+  {
+    keys = m_keys32;
+    out = m_out32;
+  }
+  void getData(Int64_type*& keys, Int64_type*& out) const
+  {
+    keys = m_keys64;
+    out = m_out64;
+  }
+
+  Index_type m_rounds;
+
+  Int32_type* m_keys32;
+  Int64_type* m_keys64;
+  Int32_type* m_out32;
+  Int64_type* m_out64;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
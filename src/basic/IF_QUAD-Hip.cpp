@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -34,8 +35,58 @@ __global__ void ifquad(Real_ptr x1, Real_ptr x2,
 }
 
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void ifquad_branchless(Real_ptr x1, Real_ptr x2,
+                                  Real_ptr a, Real_ptr b, Real_ptr c,
+                                  Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    IF_QUAD_BODY_BRANCHLESS;
+  }
+}
 
+//
+// Order the elements of the block with real roots first and the others
+// last in shared memory, so only the warp holding the boundary diverges.
+//
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void ifquad_sorted(Real_ptr x1, Real_ptr x2,
+                              Real_ptr a, Real_ptr b, Real_ptr c,
+                              Index_type iend)
+{
+  __shared__ Index_type order[block_size];
+  __shared__ unsigned int num_real;
+  __shared__ unsigned int num_zero;
+
+  if (threadIdx.x == 0) {
+    num_real = 0;
+    num_zero = 0;
+  }
+  __syncthreads();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    if (IF_QUAD_IS_REAL) {
+      order[atomicAdd(&num_real, 1u)] = i;
+    } else {
+      order[block_size - 1 - atomicAdd(&num_zero, 1u)] = i;
+    }
+  }
+  __syncthreads();
+
+  if (threadIdx.x < num_real) {
+    i = order[threadIdx.x];
+    IF_QUAD_BODY_REAL;
+  } else if (threadIdx.x >= block_size - num_zero) {
+    i = order[threadIdx.x];
+    IF_QUAD_BODY_ZERO;
+  }
+}
+
+template < size_t block_size, bool launch >
 void IF_QUAD::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -83,7 +134,7 @@ void IF_QUAD::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         IF_QUAD_BODY;
       });
@@ -96,7 +147,151 @@ void IF_QUAD::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(IF_QUAD, Hip)
+template < size_t block_size >
+void IF_QUAD::runHipVariantBranchless(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  IF_QUAD_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((ifquad_branchless<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  x1, x2, a, b, c,
+                                          iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+  } else {
+     getCout() << "\n  IF_QUAD : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void IF_QUAD::runHipVariantSorted(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  IF_QUAD_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((ifquad_sorted<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  x1, x2, a, b, c,
+                                          iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+  } else {
+     getCout() << "\n  IF_QUAD : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void IF_QUAD::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantBranchless<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantSorted<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Hip, Impl, )
+
+  }
+
+}
+
+void IF_QUAD::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, "branchless_"+std::to_string(block_size));
+
+        addVariantTuningName(vid, "sorted_"+std::to_string(block_size));
+
+      }
+
+    });
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
 
 } // end namespace basic
 } // end namespace rajaperf
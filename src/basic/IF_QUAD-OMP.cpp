@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,10 +20,91 @@ namespace basic
 {
 
 
-void IF_QUAD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void IF_QUAD::runOpenMPVariantSchedule(VariantID vid, size_t schedule_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  IF_QUAD_DATA_SETUP;
+
+  omp_schedule::ScopedSchedule schedule(omp_schedule::getSchedules()[schedule_idx]);
+
+  auto ifquad_lam = [=](Index_type i) {
+                      IF_QUAD_BODY;
+                    };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(runtime)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          IF_QUAD_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(runtime)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ifquad_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_parallel_for_runtime_exec>(
+          RAJA::RangeSegment(ibegin, iend), ifquad_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  IF_QUAD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(schedule_idx);
+#endif
+}
+
+void IF_QUAD::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx > 0 ) {
+    runOpenMPVariantSchedule(vid, tune_idx - 1);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -88,6 +171,18 @@ void IF_QUAD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void IF_QUAD::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  for (omp_schedule::Schedule const& schedule : omp_schedule::getSchedules()) {
+    addVariantTuningName(vid, omp_schedule::getScheduleTuningName(schedule));
+  }
 #endif
 }
 
@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +19,7 @@ namespace basic
 {
 
 
-void IF_QUAD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void IF_QUAD::runSeqVariantBranchless(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -26,6 +27,108 @@ void IF_QUAD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   IF_QUAD_DATA_SETUP;
 
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          IF_QUAD_BODY_BRANCHLESS;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  IF_QUAD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+//
+// Order the elements of each chunk with real roots first, from the front of
+// order, and the others last, from the back, then process each group.
+//
+void IF_QUAD::runSeqVariantSorted(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  IF_QUAD_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      constexpr Index_type chunk_size = 256;
+      Index_type order[chunk_size];
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ii = ibegin; ii < iend; ii += chunk_size) {
+
+          const Index_type len = std::min(chunk_size, iend - ii);
+
+          Index_type num_real = 0;
+          Index_type num_zero = 0;
+          for (Index_type i = ii; i < ii + len; ++i ) {
+            const bool real = IF_QUAD_IS_REAL;
+            order[ real ? num_real : chunk_size - 1 - num_zero ] = i;
+            num_real += real ? 1 : 0;
+            num_zero += real ? 0 : 1;
+          }
+
+          for (Index_type k = 0; k < num_real; ++k ) {
+            const Index_type i = order[k];
+            IF_QUAD_BODY_REAL;
+          }
+          for (Index_type k = chunk_size - num_zero; k < chunk_size; ++k ) {
+            const Index_type i = order[k];
+            IF_QUAD_BODY_ZERO;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  IF_QUAD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void IF_QUAD::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 1 ) {
+    runSeqVariantBranchless(vid);
+    return;
+  }
+  if ( tune_idx == 2 ) {
+    runSeqVariantSorted(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  IF_QUAD_DATA_SETUP;
+
 #if defined(RUN_RAJA_SEQ)
   auto ifquad_lam = [=](Index_type i) {
                       IF_QUAD_BODY;
@@ -88,5 +191,15 @@ void IF_QUAD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void IF_QUAD::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "branchless");
+    addVariantTuningName(vid, "sorted");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -26,6 +26,9 @@ IF_QUAD::IF_QUAD(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_branch_fraction = params.getBranchFraction();
+  m_branch_run_length = params.getBranchRunLength();
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (2*sizeof(Real_type) + 3*sizeof(Real_type)) * getActualProblemSize() );
@@ -37,6 +40,8 @@ IF_QUAD::IF_QUAD(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -45,6 +50,8 @@ IF_QUAD::IF_QUAD(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -65,9 +72,41 @@ IF_QUAD::~IF_QUAD()
 
 void IF_QUAD::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandSign(m_a, getActualProblemSize(), vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-  allocAndInitData(m_c, getActualProblemSize(), vid);
+  const Index_type len = getActualProblemSize();
+
+  if ( m_branch_fraction < 0.0 ) {
+
+    allocAndInitDataRandSign(m_a, len, vid);
+    allocAndInitData(m_b, len, vid);
+    allocAndInitData(m_c, len, vid);
+
+  } else {
+
+    //
+    // Each run of m_branch_run_length elements takes the branch with
+    // probability m_branch_fraction. Then a = -+b^2/(2c) gives
+    // b^2 - 4ac = 3b^2 for elements that take the branch and -b^2 for
+    // the others.
+    //
+    constexpr unsigned long long branch_seed = 2897;
+
+    allocData(m_a, len, vid);
+    allocAndInitData(m_b, len, vid);
+    allocAndInitData(m_c, len, vid);
+    {
+      auto reset_a = scopedMoveData(m_a, len, vid);
+      auto reset_b = scopedMoveData(m_b, len, vid);
+      auto reset_c = scopedMoveData(m_c, len, vid);
+      for (Index_type i = 0; i < len; ++i) {
+        const bool real = detail::counterRandValue(
+            branch_seed, i / m_branch_run_length) < m_branch_fraction;
+        const Real_type a_mag = m_b[i]*m_b[i] / (2.0*m_c[i]);
+        m_a[i] = real ? -a_mag : a_mag;
+      }
+    }
+
+  }
+
   allocAndInitDataConst(m_x1, getActualProblemSize(), 0.0, vid);
   allocAndInitDataConst(m_x2, getActualProblemSize(), 0.0, vid);
 }
@@ -21,6 +21,12 @@
 ///   }
 /// }
 ///
+/// The fraction of elements with real roots and how many consecutive
+/// elements agree are set with --branch-fraction and --branch-run-length.
+/// The branchless tunings compute both sides and select the result, the
+/// sorted tunings order the elements of each block of iterations by branch
+/// and process each group without branching.
+///
 
 #ifndef RAJAPerf_Basic_IF_QUAD_HPP
 #define RAJAPerf_Basic_IF_QUAD_HPP
@@ -43,6 +49,25 @@
     x1[i] = 0.0; \
   }
 
+#define IF_QUAD_BODY_BRANCHLESS  \
+  Real_type s = b[i]*b[i] - 4.0*a[i]*c[i]; \
+  const Real_type real = ( s >= 0 ) ? 1.0 : 0.0; \
+  s = sqrt(s*real); \
+  x2[i] = real*(-b[i]+s)/(2.0*a[i]); \
+  x1[i] = real*(-b[i]-s)/(2.0*a[i]);
+
+#define IF_QUAD_BODY_REAL  \
+  Real_type s = sqrt(b[i]*b[i] - 4.0*a[i]*c[i]); \
+  x2[i] = (-b[i]+s)/(2.0*a[i]); \
+  x1[i] = (-b[i]-s)/(2.0*a[i]);
+
+#define IF_QUAD_BODY_ZERO  \
+  x2[i] = 0.0; \
+  x1[i] = 0.0;
+
+#define IF_QUAD_IS_REAL \
+  ( b[i]*b[i] - 4.0*a[i]*c[i] >= 0 )
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf
@@ -71,12 +96,25 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantBranchless(VariantID vid);
+  void runSeqVariantSorted(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantBranchless(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantSorted(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantBranchless(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantSorted(VariantID vid);
+  void runOpenMPVariantSchedule(VariantID vid, size_t schedule_idx);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -87,6 +125,9 @@ private:
   Real_ptr m_c;
   Real_ptr m_x1;
   Real_ptr m_x2;
+
+  Real_type m_branch_fraction;
+  Index_type m_branch_run_length;
 };
 
 } // end namespace basic
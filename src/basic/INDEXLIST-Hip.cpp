@@ -246,6 +246,68 @@ __global__ void indexlist(Real_ptr x,
   }
 }
 
+//
+// Each warp compacts a contiguous part of the iterates of its block with
+// warp ballots, so only the count of each warp goes through the grid scan
+//
+template < size_t block_size, size_t items_per_thread >
+__launch_bounds__(block_size)
+__global__ void indexlist_ballot(Real_ptr x,
+                                 Int_ptr list,
+                                 Index_type* block_counts,
+                                 Index_type* grid_counts,
+                                 unsigned* block_readys,
+                                 Index_type* len,
+                                 Index_type iend)
+{
+  static_assert(block_size % warp_size == 0,
+                "block_size must be a multiple of the warp size");
+
+  const int block_id = blockIdx.x;
+  const int warp_id = threadIdx.x / warp_size;
+  const int warp_index = threadIdx.x % warp_size;
+  const unsigned long long warp_index_mask_left = (1ull << warp_index) - 1ull;
+
+  const Index_type warp_begin =
+      (block_id * block_size + warp_id * warp_size) * items_per_thread;
+
+  unsigned long long ballots[items_per_thread];
+  Index_type warp_count = 0;
+
+  for (size_t ti = 0; ti < items_per_thread; ++ti) {
+    Index_type i = warp_begin + ti * warp_size + warp_index;
+    bool flag = false;
+    if (i < iend) {
+      if (INDEXLIST_CONDITIONAL) {
+        flag = true;
+      }
+    }
+    ballots[ti] = __ballot(flag);
+    warp_count += __popcll(ballots[ti]);
+  }
+
+  // scan one count per warp, held by the first thread of the warp
+  Index_type vals[1] = { (warp_index == 0) ? warp_count : 0 };
+  Index_type exclusives[1];
+  Index_type inclusives[1];
+  grid_scan<block_size, 1>(
+      block_id, vals, exclusives, inclusives, block_counts, grid_counts, block_readys);
+
+  Index_type count = __shfl(exclusives[0], 0, warp_size);
+
+  for (size_t ti = 0; ti < items_per_thread; ++ti) {
+    Index_type i = warp_begin + ti * warp_size + warp_index;
+    const unsigned long long ballot = ballots[ti];
+    if ((ballot >> warp_index) & 1ull) {
+      list[count + __popcll(ballot & warp_index_mask_left)] = i;
+    }
+    count += __popcll(ballot);
+    if (i == iend-1) {
+      *len = count;
+    }
+  }
+}
+
 template < size_t block_size >
 void INDEXLIST::runHipVariantImpl(VariantID vid)
 {
@@ -299,7 +361,134 @@ void INDEXLIST::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(INDEXLIST, Hip)
+template < size_t block_size >
+void INDEXLIST::runHipVariantBallot(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  INDEXLIST_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT((iend-ibegin), block_size*items_per_thread);
+    const size_t shmem_size = 0;
+
+    Index_type* len;
+    allocData(DataSpace::HipPinned, len, 1);
+    Index_type* block_counts;
+    allocData(DataSpace::HipDevice, block_counts, grid_size);
+    Index_type* grid_counts;
+    allocData(DataSpace::HipDevice, grid_counts, grid_size);
+    unsigned* block_readys;
+    allocData(DataSpace::HipDevice, block_readys, grid_size);
+    hipErrchk( hipMemsetAsync(block_readys, 0, sizeof(unsigned)*grid_size, res.get_stream()) );
+    hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      indexlist_ballot<block_size, items_per_thread>
+          <<<grid_size, block_size, shmem_size, res.get_stream()>>>(
+          x+ibegin, list+ibegin,
+          block_counts, grid_counts, block_readys,
+          len, iend-ibegin );
+      hipErrchk( hipGetLastError() );
+
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_len = *len;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipPinned, len);
+    deallocData(DataSpace::HipDevice, block_counts);
+    deallocData(DataSpace::HipDevice, grid_counts);
+    deallocData(DataSpace::HipDevice, block_readys);
+
+  } else {
+    getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+  }
+}
+
+void INDEXLIST::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runHipVariantBallot<block_size>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+}
+
+void INDEXLIST::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, "ballot_"+std::to_string(block_size));
+
+      }
+
+    });
+
+  }
+
+}
 
 } // end namespace basic
 } // end namespace rajaperf
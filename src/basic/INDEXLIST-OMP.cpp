@@ -10,15 +10,109 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
 namespace basic
 {
 
-void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// Each thread counts the elements in a block of omp_scan_block_length
+// elements, the threads add the counts of the threads before them to the
+// count of the blocks before, and each thread writes the list of its
+// block, so x is read a second time from cache and no scan is stored.
+//
+void INDEXLIST::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    const int p0 = omp_get_max_threads();
+    ::std::vector<Index_type> thread_counts(p0);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Index_type count = 0;
+
+      #pragma omp parallel num_threads(p0)
+      {
+        const int p = omp_get_num_threads();
+        const int pid = omp_get_thread_num();
+
+        Index_type block_count_var = 0;
+        for (Index_type block_begin = ibegin; block_begin < iend;
+             block_begin += p * omp_scan_block_length) {
+
+          const Index_type local_begin =
+              std::min(block_begin + pid * omp_scan_block_length, iend);
+          const Index_type local_end =
+              std::min(local_begin + omp_scan_block_length, iend);
+
+          Index_type local_sum_var = 0;
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            if (INDEXLIST_CONDITIONAL) {
+              local_sum_var += 1;
+            }
+          }
+          thread_counts[pid] = local_sum_var;
+
+          #pragma omp barrier
+
+          Index_type local_count_var = block_count_var;
+          for (int ip = 0; ip < pid; ++ip) {
+            local_count_var += thread_counts[ip];
+          }
+          for (int ip = 0; ip < p; ++ip) {
+            block_count_var += thread_counts[ip];
+          }
+
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            if (INDEXLIST_CONDITIONAL) {
+              list[local_count_var++] = i ;
+            }
+          }
+
+          // thread_counts is written again for the next block
+          #pragma omp barrier
+        }
+
+        if (pid == 0) {
+          count = block_count_var;
+        }
+      }
+
+      m_len = count;
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void INDEXLIST::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
+  if ( vid == Base_OpenMP && tune_idx == 1 ) {
+    runOpenMPVariantBlocked(vid);
+    return;
+  }
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
@@ -200,8 +294,18 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void INDEXLIST::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "blocked");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -34,6 +34,8 @@ void INDEXLIST::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
  && _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
 
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -47,17 +49,32 @@ void INDEXLIST::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         Index_type count = 0;
-        #pragma omp target is_device_ptr(x, list) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1) \
-                                                  reduction(inscan, +:count)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          Index_type inc = 0;
-          if (INDEXLIST_CONDITIONAL) {
-            list[count] = i ;
-            inc = 1;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(x, list) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1) \
+                                                    reduction(inscan, +:count)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            Index_type inc = 0;
+            if (INDEXLIST_CONDITIONAL) {
+              list[count] = i ;
+              inc = 1;
+            }
+            #pragma omp scan exclusive(count)
+            count += inc;
+          }
+        } else {
+          #pragma omp target is_device_ptr(x, list) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1) \
+                                                    reduction(inscan, +:count)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            Index_type inc = 0;
+            if (INDEXLIST_CONDITIONAL) {
+              list[count] = i ;
+              inc = 1;
+            }
+            #pragma omp scan exclusive(count)
+            count += inc;
           }
-          #pragma omp scan exclusive(count)
-          count += inc;
         }
 
         m_len = count;
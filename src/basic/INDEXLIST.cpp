@@ -36,6 +36,8 @@ INDEXLIST::INDEXLIST(const RunParams& params)
   setUsesFeature(Forall);
   setUsesFeature(Scan);
 
+  setHasPattern(Streaming);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
 
@@ -43,6 +45,8 @@ INDEXLIST::INDEXLIST(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
 #endif
 
@@ -52,6 +56,8 @@ INDEXLIST::INDEXLIST(const RunParams& params)
     setVariantDefined( Base_CUDA );
 
     setVariantDefined( Base_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
   }
 }
 
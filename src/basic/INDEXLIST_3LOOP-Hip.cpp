@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -58,7 +59,7 @@ __global__ void indexlist_make_list(Int_ptr list,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void INDEXLIST_3LOOP::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -161,7 +162,7 @@ void INDEXLIST_3LOOP::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend),
         [=] __device__ (Index_type i) {
         counts[i] = (INDEXLIST_3LOOP_CONDITIONAL) ? 1 : 0;
@@ -170,7 +171,7 @@ void INDEXLIST_3LOOP::runHipVariantImpl(VariantID vid)
       RAJA::exclusive_scan_inplace< RAJA::hip_exec<block_size, true /*async*/> >( res,
           RAJA::make_span(counts+ibegin, iend+1-ibegin));
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend),
         [=] __device__ (Index_type i) {
         if (counts[i] != counts[i+1]) {
@@ -196,7 +197,7 @@ void INDEXLIST_3LOOP::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(INDEXLIST_3LOOP, Hip)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(INDEXLIST_3LOOP, Hip, RAJA_HIP)
 
 } // end namespace basic
 } // end namespace rajaperf
@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -24,8 +26,106 @@ namespace basic
   delete[] counts; counts = nullptr;
 
 
-void INDEXLIST_3LOOP::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// The scan of counts sums a block of omp_scan_block_length elements in each
+// thread, the threads add the sums of the threads before them to the scan
+// of the blocks before, and each thread scans its block in place, so counts
+// is read a second time from cache.
+//
+void INDEXLIST_3LOOP::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_3LOOP_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    INDEXLIST_3LOOP_DATA_SETUP_OMP;
+
+    const int p0 = omp_get_max_threads();
+    ::std::vector<Index_type> thread_counts(p0);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        counts[i] = (INDEXLIST_3LOOP_CONDITIONAL) ? 1 : 0;
+      }
+
+      #pragma omp parallel num_threads(p0)
+      {
+        const int p = omp_get_num_threads();
+        const int pid = omp_get_thread_num();
+
+        Index_type block_count = 0;
+        for (Index_type block_begin = ibegin; block_begin < iend+1;
+             block_begin += p * omp_scan_block_length) {
+
+          const Index_type local_begin =
+              std::min(block_begin + pid * omp_scan_block_length, iend+1);
+          const Index_type local_end =
+              std::min(local_begin + omp_scan_block_length, iend+1);
+
+          Index_type local_sum = 0;
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            local_sum += counts[i];
+          }
+          thread_counts[pid] = local_sum;
+
+          #pragma omp barrier
+
+          Index_type local_count = block_count;
+          for (int ip = 0; ip < pid; ++ip) {
+            local_count += thread_counts[ip];
+          }
+          for (int ip = 0; ip < p; ++ip) {
+            block_count += thread_counts[ip];
+          }
+
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            Index_type inc = counts[i];
+            counts[i] = local_count;
+            local_count += inc;
+          }
+
+          // thread_counts is written again for the next block
+          #pragma omp barrier
+        }
+      }
+
+      #pragma omp parallel for
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        INDEXLIST_3LOOP_MAKE_LIST;
+      }
+
+      m_len = counts[iend];
+
+    }
+    stopTimer();
+
+    INDEXLIST_3LOOP_DATA_TEARDOWN_OMP;
+
+  } else {
+    getCout() << "\n  INDEXLIST_3LOOP : Unknown variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void INDEXLIST_3LOOP::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
+  if ( vid == Base_OpenMP && tune_idx == 1 ) {
+    runOpenMPVariantBlocked(vid);
+    return;
+  }
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
@@ -238,8 +338,18 @@ void INDEXLIST_3LOOP::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void INDEXLIST_3LOOP::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "blocked");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
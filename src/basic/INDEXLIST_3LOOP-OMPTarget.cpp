@@ -41,6 +41,8 @@ void INDEXLIST_3LOOP::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUS
  && _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
 
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -57,27 +59,55 @@ void INDEXLIST_3LOOP::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUS
 
         #pragma omp parallel for
 
-        #pragma omp target is_device_ptr(counts, x) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          counts[i] = (INDEXLIST_3LOOP_CONDITIONAL) ? 1 : 0;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(counts, x) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            counts[i] = (INDEXLIST_3LOOP_CONDITIONAL) ? 1 : 0;
+          }
+        } else {
+          #pragma omp target is_device_ptr(counts, x) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            counts[i] = (INDEXLIST_3LOOP_CONDITIONAL) ? 1 : 0;
+          }
         }
 
         Index_type count = 0;
-        #pragma omp target is_device_ptr(counts) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1) \
-                                                  reduction(inscan, +:count)
-        for (Index_type i = ibegin; i < iend+1; ++i ) {
-          Index_type inc = counts[i];
-          counts[i] = count;
-          #pragma omp scan exclusive(count)
-          count += inc;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(counts) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1) \
+                                                    reduction(inscan, +:count)
+          for (Index_type i = ibegin; i < iend+1; ++i ) {
+            Index_type inc = counts[i];
+            counts[i] = count;
+            #pragma omp scan exclusive(count)
+            count += inc;
+          }
+        } else {
+          #pragma omp target is_device_ptr(counts) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1) \
+                                                    reduction(inscan, +:count)
+          for (Index_type i = ibegin; i < iend+1; ++i ) {
+            Index_type inc = counts[i];
+            counts[i] = count;
+            #pragma omp scan exclusive(count)
+            count += inc;
+          }
         }
 
-        #pragma omp target is_device_ptr(counts, list) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          INDEXLIST_3LOOP_MAKE_LIST;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(counts, list) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            INDEXLIST_3LOOP_MAKE_LIST;
+          }
+        } else {
+          #pragma omp target is_device_ptr(counts, list) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            INDEXLIST_3LOOP_MAKE_LIST;
+          }
         }
 
         m_len = counts[iend];
@@ -41,6 +41,8 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
   setUsesFeature(Forall);
   setUsesFeature(Scan);
 
+  setHasPattern(Streaming);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -50,6 +52,8 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
   setVariantDefined( RAJA_OpenMP );
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
 #endif
 
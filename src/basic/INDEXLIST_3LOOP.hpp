@@ -72,16 +72,20 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runOpenMPVariantBlocked(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
+  // elements each thread scans at a time in the blocked OpenMP tuning
+  static const Index_type omp_scan_block_length = 4096;
 
   Real_ptr m_x;
   Int_ptr m_list;
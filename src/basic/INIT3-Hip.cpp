@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -35,7 +36,56 @@ __global__ void init3(Real_ptr out1, Real_ptr out2, Real_ptr out3,
 
 
 
-template < size_t block_size >
+template < size_t block_size, size_t items_per_thread, bool strided >
+__launch_bounds__(block_size)
+__global__ void init3_coarsened(Real_ptr out1, Real_ptr out2, Real_ptr out3,
+                                Real_ptr in1, Real_ptr in2,
+                                Index_type iend)
+{
+  #pragma unroll
+  for (size_t j = 0; j < items_per_thread; ++j) {
+    Index_type i = hip_coarsened_index<block_size, items_per_thread, strided>(j);
+    if (i < iend) {
+      INIT3_BODY;
+    }
+  }
+}
+
+template < size_t block_size, size_t vec_width >
+__launch_bounds__(block_size)
+__global__ void init3_vec(Real_ptr out1, Real_ptr out2, Real_ptr out3,
+                          Real_ptr in1, Real_ptr in2,
+                          Index_type iend)
+{
+  using vec_type = gpu_coarsen::vec_type<Real_type, vec_width>;
+  Index_type iv = blockIdx.x * block_size + threadIdx.x;
+  if ((iv+1) * static_cast<Index_type>(vec_width) <= iend) {
+    vec_type in1_v = reinterpret_cast<const vec_type*>(in1)[iv];
+    vec_type in2_v = reinterpret_cast<const vec_type*>(in2)[iv];
+    vec_type out1_v, out2_v, out3_v;
+    {
+      Real_ptr out1 = out1_v.v;
+      Real_ptr out2 = out2_v.v;
+      Real_ptr out3 = out3_v.v;
+      Real_ptr in1 = in1_v.v;
+      Real_ptr in2 = in2_v.v;
+      #pragma unroll
+      for (Index_type i = 0; i < static_cast<Index_type>(vec_width); ++i) {
+        INIT3_BODY;
+      }
+    }
+    reinterpret_cast<vec_type*>(out1)[iv] = out1_v;
+    reinterpret_cast<vec_type*>(out2)[iv] = out2_v;
+    reinterpret_cast<vec_type*>(out3)[iv] = out3_v;
+  } else {
+    for (Index_type i = iv * static_cast<Index_type>(vec_width); i < iend; ++i) {
+      INIT3_BODY;
+    }
+  }
+}
+
+
+template < size_t block_size, bool launch >
 void INIT3::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -83,7 +133,7 @@ void INIT3::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         INIT3_BODY;
       });
@@ -96,7 +146,63 @@ void INIT3::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(INIT3, Hip)
+template < size_t block_size, size_t items_per_thread, bool strided >
+void INIT3::runHipVariantCoarsened(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  INIT3_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size*items_per_thread);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((init3_coarsened<block_size, items_per_thread, strided>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), out1, out2, out3, in1, in2, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  INIT3 : Unknown Hip coarsened variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size, size_t vec_width >
+void INIT3::runHipVariantVec(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  INIT3_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size*vec_width);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((init3_vec<block_size, vec_width>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), out1, out2, out3, in1, in2, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  INIT3 : Unknown Hip vec variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_COARSEN_TUNING_DEFINE_BOILERPLATE(INIT3, Hip, Base_HIP, RAJA_HIP)
 
 } // end namespace basic
 } // end namespace rajaperf
@@ -59,10 +59,18 @@ public:
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, size_t items_per_thread, bool strided >
+  void runCudaVariantCoarsened(VariantID vid);
+  template < size_t block_size, size_t vec_width >
+  void runCudaVariantVec(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size, size_t items_per_thread, bool strided >
+  void runHipVariantCoarsened(VariantID vid);
+  template < size_t block_size, size_t vec_width >
+  void runHipVariantVec(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
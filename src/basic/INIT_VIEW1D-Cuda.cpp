@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -35,7 +36,7 @@ __global__ void initview1d(Real_ptr a,
 
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void INIT_VIEW1D::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -82,7 +83,7 @@ void INIT_VIEW1D::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         INIT_VIEW1D_BODY_RAJA;
       });
@@ -95,7 +96,7 @@ void INIT_VIEW1D::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(INIT_VIEW1D, Cuda)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(INIT_VIEW1D, Cuda, RAJA_CUDA)
 
 } // end namespace basic
 } // end namespace rajaperf
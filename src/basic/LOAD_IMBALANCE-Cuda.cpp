@@ -0,0 +1,326 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LOAD_IMBALANCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void load_imbalance(Real_ptr x, Real_ptr y, Int_ptr cost,
+                               Real_type h, Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    LOAD_IMBALANCE_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void load_imbalance_sorted(Real_ptr x, Real_ptr y, Int_ptr cost,
+                                      Int_ptr order,
+                                      Real_type h, Index_type iend)
+{
+  Index_type ii = blockIdx.x * block_size + threadIdx.x;
+  if (ii < iend) {
+    LOAD_IMBALANCE_ORDER_BODY;
+  }
+}
+
+//
+// The lanes of a warp do every warp size-th term of an item.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void load_imbalance_warp_sorted(Real_ptr x, Real_ptr y, Int_ptr cost,
+                                           Int_ptr order,
+                                           Real_type h, Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+
+  const int lane = threadIdx.x % cuda_warp_size;
+
+  Index_type ii = (blockIdx.x * block_size + threadIdx.x) / cuda_warp_size;
+  if (ii < iend) {
+    const Index_type i = order[ii];
+    Real_type sum = 0.0;
+    for (Int_type n = lane; n < cost[i]; n += cuda_warp_size) {
+      LOAD_IMBALANCE_TERM;
+    }
+    sum = cuda_warp_reduce<sum_op>(sum);
+    if (lane == 0) {
+      y[i] = sum;
+    }
+  }
+}
+
+//
+// A grid of the blocks that fit on the device at once, each warp takes the
+// next warp size items from the queue until it is empty.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void load_imbalance_work_queue(Real_ptr x, Real_ptr y, Int_ptr cost,
+                                          Int_ptr order, Int_ptr queue,
+                                          Real_type h, Index_type iend)
+{
+  const int lane = threadIdx.x % cuda_warp_size;
+
+  while (true) {
+    Int_type ibegin = 0;
+    if (lane == 0) {
+      ibegin = RAJA::atomicAdd<RAJA::cuda_atomic>(queue, Int_type(cuda_warp_size));
+    }
+    ibegin = __shfl_sync(0xffffffffu, ibegin, 0);
+    if (ibegin >= iend) {
+      break;
+    }
+    Index_type ii = ibegin + lane;
+    if (ii < iend) {
+      LOAD_IMBALANCE_ORDER_BODY;
+    }
+  }
+}
+
+
+template < size_t block_size >
+void LOAD_IMBALANCE::runCudaVariantThread(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  LOAD_IMBALANCE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      load_imbalance<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, y, cost, h, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        LOAD_IMBALANCE_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  LOAD_IMBALANCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void LOAD_IMBALANCE::runCudaVariantThreadSorted(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  LOAD_IMBALANCE_ORDER_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      load_imbalance_sorted<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, y, cost, order, h, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type ii) {
+        LOAD_IMBALANCE_ORDER_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  LOAD_IMBALANCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void LOAD_IMBALANCE::runCudaVariantWarpSorted(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  LOAD_IMBALANCE_ORDER_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr size_t items_per_block = block_size / cuda_warp_size;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, items_per_block);
+      constexpr size_t shmem = 0;
+      load_imbalance_warp_sorted<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, y, cost, order, h, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  LOAD_IMBALANCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void LOAD_IMBALANCE::runCudaVariantWorkQueue(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  LOAD_IMBALANCE_ORDER_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Int_ptr queue;
+    allocData(DataSpace::CudaDevice, queue, 1);
+
+    constexpr size_t shmem = 0;
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (load_imbalance_work_queue<block_size>), block_size, shmem);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemsetAsync( queue, 0, sizeof(Int_type), res.get_stream() ) );
+      load_imbalance_work_queue<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, y, cost, order, queue, h, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, queue);
+
+  } else {
+     getCout() << "\n  LOAD_IMBALANCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void LOAD_IMBALANCE::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantThread<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantThreadSorted<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == Base_CUDA) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantWarpSorted<block_size>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantWorkQueue<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    }
+
+  });
+}
+
+void LOAD_IMBALANCE::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "thread"+block_name);
+      addVariantTuningName(vid, "thread_sorted"+block_name);
+      if (vid == Base_CUDA) {
+        addVariantTuningName(vid, "warp_sorted"+block_name);
+        addVariantTuningName(vid, "work_queue"+block_name);
+      }
+
+    }
+
+  });
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
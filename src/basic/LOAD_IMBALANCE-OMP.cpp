@@ -0,0 +1,268 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LOAD_IMBALANCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void LOAD_IMBALANCE::runOpenMPVariantStatic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  LOAD_IMBALANCE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(static)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          LOAD_IMBALANCE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_exec<RAJA::omp_for_static_exec<>>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          LOAD_IMBALANCE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  LOAD_IMBALANCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void LOAD_IMBALANCE::runOpenMPVariantDynamic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  LOAD_IMBALANCE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(dynamic, omp_chunk_size)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          LOAD_IMBALANCE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_exec<RAJA::omp_for_dynamic_exec<omp_chunk_size>>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          LOAD_IMBALANCE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  LOAD_IMBALANCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void LOAD_IMBALANCE::runOpenMPVariantGuided(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  LOAD_IMBALANCE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(guided, omp_chunk_size)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          LOAD_IMBALANCE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_exec<RAJA::omp_for_guided_exec<omp_chunk_size>>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          LOAD_IMBALANCE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  LOAD_IMBALANCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// One thread makes tasks of chunks of items that idle threads take.
+//
+void LOAD_IMBALANCE::runOpenMPVariantTasks(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  LOAD_IMBALANCE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        #pragma omp single
+        #pragma omp taskloop grainsize(omp_chunk_size)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          LOAD_IMBALANCE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  LOAD_IMBALANCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void LOAD_IMBALANCE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantStatic(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantDynamic(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantGuided(vid);
+  }
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+    if (tune_idx == t) {
+      runOpenMPVariantTasks(vid);
+    }
+    t += 1;
+  }
+}
+
+void LOAD_IMBALANCE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "static");
+  addVariantTuningName(vid, "dynamic");
+  addVariantTuningName(vid, "guided");
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "tasks");
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
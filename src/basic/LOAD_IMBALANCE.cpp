@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "LOAD_IMBALANCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+LOAD_IMBALANCE::LOAD_IMBALANCE(const RunParams& params)
+  : KernelBase(rajaperf::Basic_LOAD_IMBALANCE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_max_cost = getKernelParam("max_cost", 100, 1,
+                              std::numeric_limits<Int_type>::max());
+  m_distribution = getKernelParam("distribution", 0, {0, 1, 2});
+  m_cluster = getKernelParam("cluster", 1);
+
+  m_total_cost = 0;
+  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+    m_total_cost += getCost(i);
+  }
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // the order of the sorted tunings is not counted
+  setBytesPerRep( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(6 * m_total_cost);
+
+  setUsesFeature(Forall);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+LOAD_IMBALANCE::~LOAD_IMBALANCE()
+{
+}
+
+//
+// Items of a cluster share the cost drawn for their cluster.
+//
+Int_type LOAD_IMBALANCE::getCost(Index_type i) const
+{
+  constexpr unsigned long long cost_seed = 2411;
+
+  const Real_type u = detail::counterRandValue(cost_seed, i / m_cluster);
+
+  Index_type c = 1;
+  switch (m_distribution) {
+    case 0 :
+      c = 1 + static_cast<Index_type>(u * m_max_cost);
+      break;
+    case 1 :
+      c = (u < 0.1) ? m_max_cost : 1;
+      break;
+    default :
+      c = static_cast<Index_type>(1.0 / (1.0 - u));
+      break;
+  }
+  return static_cast<Int_type>( std::max(std::min(c, m_max_cost), Index_type(1)) );
+}
+
+void LOAD_IMBALANCE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  allocAndInitData(m_x, len, vid);
+  allocAndInitDataConst(m_y, len, 0.0, vid);
+
+  std::vector<Int_type> host_cost(len);
+  for (Index_type i = 0; i < len; ++i) {
+    host_cost[i] = getCost(i);
+  }
+
+  allocData(m_cost, len, vid);
+  {
+    auto reset_cost = scopedMoveData(m_cost, len, vid);
+    std::copy(host_cost.begin(), host_cost.end(), m_cost);
+  }
+
+  allocData(m_order, len, vid);
+  {
+    auto reset_order = scopedMoveData(m_order, len, vid);
+    std::iota(m_order, m_order + len, Int_type(0));
+    std::stable_sort(m_order, m_order + len,
+                     [&](Int_type a, Int_type b) {
+                       return host_cost[a] > host_cost[b];
+                     });
+  }
+
+  m_h = 1.0 / m_max_cost;
+}
+
+void LOAD_IMBALANCE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, getActualProblemSize(), vid);
+}
+
+void LOAD_IMBALANCE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+  deallocData(m_cost, vid);
+  deallocData(m_order, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
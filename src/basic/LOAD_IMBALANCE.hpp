@@ -0,0 +1,151 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// LOAD_IMBALANCE kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   Real_type sum = 0.0;
+///   for (Int_type n = 0; n < cost[i]; ++n ) {
+///     Real_type t = x[i] + n * h;
+///     sum += t / (1.0 + t * t);
+///   }
+///   y[i] = sum;
+/// }
+///
+/// Each item does cost[i] terms, from 1 to max_cost, like the iterations of
+/// an iterative solve in each zone. The costs are given by the kernel
+/// parameters "max_cost", "distribution", and "cluster". Distributions are
+///
+///   0 -- uniform, costs are uniformly random from 1 to max_cost
+///   1 -- bimodal, a tenth of the items have max_cost and the rest cost 1
+///   2 -- heavy tailed, the chance of a cost more than c is 1/c, up to
+///        max_cost
+///
+/// and cluster is the number of neighboring items that share a cost, so 1
+/// scatters the expensive items and larger values give clustered regions of
+/// expensive items.
+///
+/// OpenMP tunings compare static, dynamic, and guided schedules, and tasks
+/// in the Base variant. GPU tunings compare a thread per item in item order
+/// and in order of decreasing cost, so the threads of a warp have similar
+/// costs, a warp per item in order of decreasing cost with the terms of an
+/// item split over the lanes, and a persistent kernel where each warp takes
+/// the next warp of items from a work queue in order of decreasing cost.
+///
+
+#ifndef RAJAPerf_Basic_LOAD_IMBALANCE_HPP
+#define RAJAPerf_Basic_LOAD_IMBALANCE_HPP
+
+#define LOAD_IMBALANCE_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr cost = m_cost; \
+  const Real_type h = m_h;
+
+#define LOAD_IMBALANCE_ORDER_DATA_SETUP \
+  LOAD_IMBALANCE_DATA_SETUP; \
+  Int_ptr order = m_order;
+
+#define LOAD_IMBALANCE_TERM \
+  const Real_type t = x[i] + n * h; \
+  sum += t / (1.0 + t * t);
+
+#define LOAD_IMBALANCE_BODY \
+  Real_type sum = 0.0; \
+  for (Int_type n = 0; n < cost[i]; ++n ) { \
+    LOAD_IMBALANCE_TERM; \
+  } \
+  y[i] = sum;
+
+#define LOAD_IMBALANCE_ORDER_BODY \
+  const Index_type i = order[ii]; \
+  LOAD_IMBALANCE_BODY
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class LOAD_IMBALANCE : public KernelBase
+{
+public:
+
+  LOAD_IMBALANCE(const RunParams& params);
+
+  ~LOAD_IMBALANCE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  LOAD_IMBALANCE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void runOpenMPVariantStatic(VariantID vid);
+  void runOpenMPVariantDynamic(VariantID vid);
+  void runOpenMPVariantGuided(VariantID vid);
+  void runOpenMPVariantTasks(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantThread(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantThreadSorted(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpSorted(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWorkQueue(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantThread(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantThreadSorted(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpSorted(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWorkQueue(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  // warp tunings need whole warps on every gpu backend
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                     gpu_block_size::MultipleOf<64>>;
+
+  // items per chunk of the dynamic and guided schedules and per task
+  static const Index_type omp_chunk_size = 16;
+
+  Int_type getCost(Index_type i) const;
+
+  Index_type m_max_cost;
+  Index_type m_distribution;
+  Index_type m_cluster;
+  Index_type m_total_cost;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_cost;
+  Int_ptr m_order;
+  Real_type m_h;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
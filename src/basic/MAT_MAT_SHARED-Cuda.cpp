@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/MmaUtils.hpp"
 
 #include <iostream>
 
@@ -70,6 +71,11 @@ void MAT_MAT_SHARED::runCudaVariantImpl(VariantID vid)
 
   if (vid == Base_CUDA) {
 
+    detail::setCudaFuncSharedMemCarveout(mat_mat_shared<tile_size>,
+                                         getSharedMemCarveout());
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("mat_mat_shared",
+        mat_mat_shared<tile_size>, tile_size*tile_size, shmem) );
+
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
@@ -272,7 +278,150 @@ void MAT_MAT_SHARED::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(MAT_MAT_SHARED, Cuda)
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+void MAT_MAT_SHARED::runCudaVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  auto res{getCudaResource()};
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_CUDA) {
+
+    cublasHandle_t handle;
+    cublasErrchk( cublasCreate(&handle) );
+    cublasErrchk( cublasSetStream(handle, res.get_stream()) );
+
+    // row major C = A B is column major C^T = B^T A^T
+    const int n = N;
+    const Real_type one = 1.0;
+    const Real_type zero = 0.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RP_USE_DOUBLE)
+      cublasErrchk( cublasDgemm(handle, CUBLAS_OP_N, CUBLAS_OP_N,
+                                n, n, n,
+                                &one,  B, n,
+                                       A, n,
+                                &zero, C, n) );
+#else
+      cublasErrchk( cublasSgemm(handle, CUBLAS_OP_N, CUBLAS_OP_N,
+                                n, n, n,
+                                &one,  B, n,
+                                       A, n,
+                                &zero, C, n) );
+#endif
+
+    }
+    stopTimer();
+
+    cublasErrchk( cublasDestroy(handle) );
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown Cuda blas variant id = " << vid
+              << std::endl;
+  }
+}
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+void MAT_MAT_SHARED::runCudaVariantMma(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  dim3 gridDim(getMmaGridSize(N), getMmaGridSize(N));
+  constexpr size_t shmem = 0;
+
+  auto res{getCudaResource()};
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_CUDA) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      gpu_matmul_mma<Real_type>
+                <<<gridDim, gpu_mma::block_size, shmem, res.get_stream()>>>(C, A, B,
+                                                   1.0, N, N, N);
+      cudaErrchk( cudaGetLastError() );
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown Cuda mma variant id = " << vid
+              << std::endl;
+  }
+}
+#endif
+
+void MAT_MAT_SHARED::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if ((run_params.numValidGPUBlockSize() == 0u ||
+         run_params.validGPUBlockSize(block_size)) &&
+        tileSharedMemBytes(block_size) <= detail::getCudaSharedMemPerBlock()) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if (vid == Base_CUDA) {
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    if (tune_idx == t) {
+      runCudaVariantBlas(vid);
+    }
+    t += 1;
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+    if (detail::haveCudaDoubleMma()) {
+      if (tune_idx == t) {
+        setBlockSize(gpu_mma::block_size);
+        runCudaVariantMma(vid);
+      }
+      t += 1;
+    }
+#endif
+
+  }
+}
+
+void MAT_MAT_SHARED::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if ((run_params.numValidGPUBlockSize() == 0u ||
+         run_params.validGPUBlockSize(block_size)) &&
+        tileSharedMemBytes(block_size) <= detail::getCudaSharedMemPerBlock()) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if (vid == Base_CUDA) {
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    addVariantTuningName(vid, "cublas");
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+    if (detail::haveCudaDoubleMma()) {
+      addVariantTuningName(vid, "mma");
+    }
+#endif
+
+  }
+}
 
 } // end namespace basic
 } // end namespace rajaperf
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/MmaUtils.hpp"
 
 #include <iostream>
 
@@ -70,6 +71,9 @@ void MAT_MAT_SHARED::runHipVariantImpl(VariantID vid)
 
   if (vid == Base_HIP) {
 
+    setGPUFuncAttributes( detail::getHipFuncAttributes("mat_mat_shared",
+        mat_mat_shared<tile_size>, tile_size*tile_size, shmem) );
+
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
@@ -276,7 +280,152 @@ void MAT_MAT_SHARED::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(MAT_MAT_SHARED, Hip)
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+void MAT_MAT_SHARED::runHipVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  auto res{getHipResource()};
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_HIP) {
+
+    rocblas_handle handle;
+    rocblasErrchk( rocblas_create_handle(&handle) );
+    rocblasErrchk( rocblas_set_stream(handle, res.get_stream()) );
+
+    // row major C = A B is column major C^T = B^T A^T
+    const rocblas_int n = N;
+    const Real_type one = 1.0;
+    const Real_type zero = 0.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RP_USE_DOUBLE)
+      rocblasErrchk( rocblas_dgemm(handle,
+                                   rocblas_operation_none, rocblas_operation_none,
+                                   n, n, n,
+                                   &one,  B, n,
+                                          A, n,
+                                   &zero, C, n) );
+#else
+      rocblasErrchk( rocblas_sgemm(handle,
+                                   rocblas_operation_none, rocblas_operation_none,
+                                   n, n, n,
+                                   &one,  B, n,
+                                          A, n,
+                                   &zero, C, n) );
+#endif
+
+    }
+    stopTimer();
+
+    rocblasErrchk( rocblas_destroy_handle(handle) );
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown Hip blas variant id = " << vid
+              << std::endl;
+  }
+}
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+void MAT_MAT_SHARED::runHipVariantMma(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  dim3 gridDim(getMmaGridSize(N), getMmaGridSize(N));
+  constexpr size_t shmem = 0;
+
+  auto res{getHipResource()};
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_HIP) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL((gpu_matmul_mma<Real_type>),
+                         dim3(gridDim), dim3(gpu_mma::block_size), shmem, res.get_stream(),
+                         C, A, B, 1.0, N, N, N);
+      hipErrchk( hipGetLastError() );
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown Hip mma variant id = " << vid
+              << std::endl;
+  }
+}
+#endif
+
+void MAT_MAT_SHARED::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if ((run_params.numValidGPUBlockSize() == 0u ||
+         run_params.validGPUBlockSize(block_size)) &&
+        tileSharedMemBytes(block_size) <= detail::getHipSharedMemPerBlock()) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if (vid == Base_HIP) {
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    if (tune_idx == t) {
+      runHipVariantBlas(vid);
+    }
+    t += 1;
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+    if (detail::haveHipDoubleMma()) {
+      if (tune_idx == t) {
+        setBlockSize(gpu_mma::block_size);
+        runHipVariantMma(vid);
+      }
+      t += 1;
+    }
+#endif
+
+  }
+}
+
+void MAT_MAT_SHARED::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if ((run_params.numValidGPUBlockSize() == 0u ||
+         run_params.validGPUBlockSize(block_size)) &&
+        tileSharedMemBytes(block_size) <= detail::getHipSharedMemPerBlock()) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if (vid == Base_HIP) {
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    addVariantTuningName(vid, "rocblas");
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+    if (detail::haveHipDoubleMma()) {
+      addVariantTuningName(vid, "mma");
+    }
+#endif
+
+  }
+}
 
 } // end namespace basic
 } // end namespace rajaperf
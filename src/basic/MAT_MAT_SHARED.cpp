@@ -45,6 +45,8 @@ MAT_MAT_SHARED::MAT_MAT_SHARED(const RunParams &params)
 
   setUsesFeature(Launch);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined(Base_Seq);
   setVariantDefined(Lambda_Seq);
   setVariantDefined(RAJA_Seq);
@@ -53,6 +55,7 @@ MAT_MAT_SHARED::MAT_MAT_SHARED(const RunParams &params)
   setVariantDefined(Lambda_OpenMP);
   setVariantDefined(RAJA_OpenMP);
 
+  setUsesSharedMemCarveout();
   setVariantDefined(Base_CUDA);
   setVariantDefined(Lambda_CUDA);
   setVariantDefined(RAJA_CUDA);
@@ -61,6 +61,15 @@
 ///        }
 ///      }
 ///
+/// The tile size of each block tuning is the square root of the block size,
+/// block sizes whose tiles do not fit in the shared memory a block may use
+/// on the device are skipped. The Base_CUDA tunings may also be run with
+/// each shared memory carve-out given with '--gpu-shmem-carveouts'.
+///
+/// Besides the block tunings, the Base GPU variants have a vendor BLAS gemm
+/// tuning (cublas, rocblas) and an mma tuning on the FP64 matrix units when
+/// the device has them. These sum in a different order, so their checksums
+/// differ by rounding.
 ///
 
 #ifndef RAJAPerf_Basic_MAT_MAT_SHARED_HPP
@@ -146,11 +155,23 @@ public:
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void runCudaVariantBlas(VariantID vid);
+  void runHipVariantBlas(VariantID vid);
+  void runCudaVariantMma(VariantID vid);
+  void runHipVariantMma(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = TL_SZ * TL_SZ;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size, gpu_block_size::ExactSqrt>;
 
+  // shared memory of the As, Bs, and Cs tiles of a block, block sizes whose
+  // tiles do not fit in the shared memory of a block of the device are not
+  // run
+  static constexpr size_t tileSharedMemBytes(size_t block_size)
+  {
+    return 3 * block_size * sizeof(double);
+  }
+
   Real_ptr m_A;
   Real_ptr m_B;
   Real_ptr m_C;
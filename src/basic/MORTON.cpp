@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MORTON.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+MORTON::MORTON(const RunParams& params)
+  : KernelBase(rajaperf::Basic_MORTON, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  setFLOPsPerRep(0);
+
+  setMetricNames({"int_ops", "Gops"});
+
+  setUsesFeature(Forall);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+MORTON::~MORTON()
+{
+}
+
+//
+// Tunings before setting up the kernel tunings, ie. in the constructor, are
+// int32.
+//
+bool MORTON::isInt64Tuning(VariantID vid, size_t tune_idx) const
+{
+  return tune_idx < getNumVariantTunings(vid) &&
+         getVariantTuningName(vid, tune_idx).compare(0, 5, "int64") == 0;
+}
+
+Index_type MORTON::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const Index_type int_size = isInt64Tuning(vid, tune_idx) ? sizeof(Int64_type)
+                                                           : sizeof(Int32_type);
+  return (1*int_size + 1*int_size) * getActualProblemSize();
+}
+
+std::vector<double> MORTON::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  const Index_type bit_ops = isInt64Tuning(vid, tune_idx) ? morton_ops_64
+                                                          : morton_ops_32;
+  const double ops = static_cast<double>(12*bit_ops + morton_ops_rest) *
+                     getActualProblemSize();
+  const double rep_time = getMinTime(vid, tune_idx) / getRunReps();
+  return {ops, (rep_time > 0.0) ? ops / rep_time / 1.0e9 : 0.0};
+}
+
+void MORTON::setUp(VariantID vid, size_t tune_idx)
+{
+  constexpr unsigned long long code_seed = 4253;
+
+  const Index_type len = getActualProblemSize();
+  const bool wide = isInt64Tuning(vid, tune_idx);
+
+  m_codes32 = nullptr;
+  m_codes64 = nullptr;
+  m_out32 = nullptr;
+  m_out64 = nullptr;
+
+  //
+  // Random codes of cells of the 1024^3 grid.
+  //
+  const Real_type num_codes = static_cast<Real_type>(morton_cells) *
+                              morton_cells * morton_cells;
+  if (wide) {
+    allocData(m_codes64, len, vid);
+    auto reset_codes = scopedMoveData(m_codes64, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      m_codes64[i] = static_cast<Int64_type>(
+          num_codes * detail::counterRandValue(code_seed, i));
+    }
+    allocAndInitDataConst(m_out64, len, Int64_type(0), vid);
+  } else {
+    allocData(m_codes32, len, vid);
+    auto reset_codes = scopedMoveData(m_codes32, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      m_codes32[i] = static_cast<Int32_type>(
+          num_codes * detail::counterRandValue(code_seed, i));
+    }
+    allocAndInitDataConst(m_out32, len, Int32_type(0), vid);
+  }
+}
+
+void MORTON::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  if (m_out64 != nullptr) {
+    checksum[vid][tune_idx] += calcChecksum(m_out64, getActualProblemSize(), vid);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_out32, getActualProblemSize(), vid);
+  }
+}
+
+void MORTON::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  if (m_codes32 != nullptr) {
+    deallocData(m_codes32, vid);
+    deallocData(m_out32, vid);
+  }
+  if (m_codes64 != nullptr) {
+    deallocData(m_codes64, vid);
+    deallocData(m_out64, vid);
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
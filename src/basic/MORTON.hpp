@@ -0,0 +1,200 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MORTON kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   // decode the cell of the Morton code
+///   UInt x = compact(codes[i]);
+///   UInt y = compact(codes[i] >> 1);
+///   UInt z = compact(codes[i] >> 2);
+///   // xor of the codes of the 6 face neighbors, periodic in 1024^3 cells
+///   UInt r = 0;
+///   r ^= spread((x+1) & 1023) | (spread(y) << 1) | (spread(z) << 2);
+///   r ^= spread((x-1) & 1023) | (spread(y) << 1) | (spread(z) << 2);
+///   ...
+///   out[i] = r;
+/// }
+///
+/// spread puts the bits of a coordinate in every third bit and compact
+/// takes them out, with masks and shifts. Tunings give the width of the
+/// integers, int32 codes use 10 bits of each coordinate and int64 codes 21
+/// bits, with one more step of the spread and compact. The cells are in a
+/// 1024^3 grid so both widths compute the same codes and checksums.
+///
+/// The integer ops of a rep, counted as in the reference, and their rate in
+/// Gop/s are in the metrics file.
+///
+
+#ifndef RAJAPerf_Basic_MORTON_HPP
+#define RAJAPerf_Basic_MORTON_HPP
+
+#define MORTON_DATA_SETUP \
+  IntT* codes; \
+  IntT* out; \
+  getData(codes, out);
+
+#define MORTON_BODY \
+  const UInt c = static_cast<UInt>(codes[i]); \
+  const UInt x = mortonCompact(c); \
+  const UInt y = mortonCompact(static_cast<UInt>(c >> 1)); \
+  const UInt z = mortonCompact(static_cast<UInt>(c >> 2)); \
+  const UInt sx = mortonSpread(x); \
+  const UInt sy = static_cast<UInt>(mortonSpread(y) << 1); \
+  const UInt sz = static_cast<UInt>(mortonSpread(z) << 2); \
+  const UInt m = static_cast<UInt>(morton_cells - 1); \
+  UInt r = 0; \
+  r ^= mortonSpread(static_cast<UInt>((x + 1) & m)) | sy | sz; \
+  r ^= mortonSpread(static_cast<UInt>((x - 1) & m)) | sy | sz; \
+  r ^= sx | static_cast<UInt>(mortonSpread(static_cast<UInt>((y + 1) & m)) << 1) | sz; \
+  r ^= sx | static_cast<UInt>(mortonSpread(static_cast<UInt>((y - 1) & m)) << 1) | sz; \
+  r ^= sx | sy | static_cast<UInt>(mortonSpread(static_cast<UInt>((z + 1) & m)) << 2); \
+  r ^= sx | sy | static_cast<UInt>(mortonSpread(static_cast<UInt>((z - 1) & m)) << 2); \
+  out[i] = static_cast<IntT>(r);
+
+
+#include "common/KernelBase.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+// cells in each direction of the grid of the codes
+constexpr Index_type morton_cells = 1024;
+
+//
+// Integer ops of spread and compact of each width, and of the rest of an
+// element, the decode shifts, the neighbor increments and masks, and the
+// shifts, ors, and xors of the neighbor codes.
+//
+constexpr Index_type morton_ops_32 = 13;
+constexpr Index_type morton_ops_64 = 16;
+constexpr Index_type morton_ops_rest = 2 + 2 + 6*2 + 4 + 6*3;
+
+//
+// Put bit b of v in bit 3*b.
+//
+RAJA_HOST_DEVICE RAJA_INLINE std::uint32_t mortonSpread(std::uint32_t v)
+{
+  v &= 0x000003FFu;
+  v = (v | (v << 16)) & 0x030000FFu;
+  v = (v | (v <<  8)) & 0x0300F00Fu;
+  v = (v | (v <<  4)) & 0x030C30C3u;
+  v = (v | (v <<  2)) & 0x09249249u;
+  return v;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE std::uint64_t mortonSpread(std::uint64_t v)
+{
+  v &= 0x00000000001FFFFFull;
+  v = (v | (v << 32)) & 0x001F00000000FFFFull;
+  v = (v | (v << 16)) & 0x001F0000FF0000FFull;
+  v = (v | (v <<  8)) & 0x100F00F00F00F00Full;
+  v = (v | (v <<  4)) & 0x10C30C30C30C30C3ull;
+  v = (v | (v <<  2)) & 0x1249249249249249ull;
+  return v;
+}
+
+//
+// Put bit 3*b of v in bit b.
+//
+RAJA_HOST_DEVICE RAJA_INLINE std::uint32_t mortonCompact(std::uint32_t v)
+{
+  v &= 0x09249249u;
+  v = (v ^ (v >>  2)) & 0x030C30C3u;
+  v = (v ^ (v >>  4)) & 0x0300F00Fu;
+  v = (v ^ (v >>  8)) & 0x030000FFu;
+  v = (v ^ (v >> 16)) & 0x000003FFu;
+  return v;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE std::uint64_t mortonCompact(std::uint64_t v)
+{
+  v &= 0x1249249249249249ull;
+  v = (v ^ (v >>  2)) & 0x10C30C30C30C30C3ull;
+  v = (v ^ (v >>  4)) & 0x100F00F00F00F00Full;
+  v = (v ^ (v >>  8)) & 0x001F0000FF0000FFull;
+  v = (v ^ (v >> 16)) & 0x001F00000000FFFFull;
+  v = (v ^ (v >> 32)) & 0x00000000001FFFFFull;
+  return v;
+}
+
+class MORTON : public KernelBase
+{
+public:
+
+  MORTON(const RunParams& params);
+
+  ~MORTON();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  // integer ops per rep and Gop/s
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MORTON : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < typename IntT >
+  void runSeqVariantImpl(VariantID vid);
+  template < typename IntT >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, typename IntT >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, typename IntT >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  bool isInt64Tuning(VariantID vid, size_t tune_idx) const;
+
+  void getData(Int32_type*& codes, Int32_type*& out) const
+  {
+    codes = m_codes32;
+    out = m_out32;
+  }
+  void getData(Int64_type*& codes, Int64_type*& out) const
+  {
+    codes = m_codes64;
+    out = m_out64;
+  }
+
+  Int32_type* m_codes32;
+  Int64_type* m_codes64;
+  Int32_type* m_out32;
+  Int64_type* m_out64;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
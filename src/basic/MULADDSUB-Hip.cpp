@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -21,10 +22,10 @@ namespace rajaperf
 namespace basic
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void muladdsub(Real_ptr out1, Real_ptr out2, Real_ptr out3,
-                          Real_ptr in1, Real_ptr in2,
+__global__ void muladdsub(Data_type* out1, Data_type* out2, Data_type* out3,
+                          Data_type* in1, Data_type* in2,
                           Index_type iend)
 {
   Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -35,7 +36,56 @@ __global__ void muladdsub(Real_ptr out1, Real_ptr out2, Real_ptr out3,
 
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size, size_t items_per_thread, bool strided >
+__launch_bounds__(block_size)
+__global__ void muladdsub_coarsened(Data_type* out1, Data_type* out2, Data_type* out3,
+                                    Data_type* in1, Data_type* in2,
+                                    Index_type iend)
+{
+  #pragma unroll
+  for (size_t j = 0; j < items_per_thread; ++j) {
+    Index_type i = hip_coarsened_index<block_size, items_per_thread, strided>(j);
+    if (i < iend) {
+      MULADDSUB_BODY;
+    }
+  }
+}
+
+template < typename Data_type, size_t block_size, size_t vec_width >
+__launch_bounds__(block_size)
+__global__ void muladdsub_vec(Data_type* out1, Data_type* out2, Data_type* out3,
+                              Data_type* in1, Data_type* in2,
+                              Index_type iend)
+{
+  using vec_type = gpu_coarsen::vec_type<Data_type, vec_width>;
+  Index_type iv = blockIdx.x * block_size + threadIdx.x;
+  if ((iv+1) * static_cast<Index_type>(vec_width) <= iend) {
+    vec_type in1_v = reinterpret_cast<const vec_type*>(in1)[iv];
+    vec_type in2_v = reinterpret_cast<const vec_type*>(in2)[iv];
+    vec_type out1_v, out2_v, out3_v;
+    {
+      Data_type* out1 = out1_v.v;
+      Data_type* out2 = out2_v.v;
+      Data_type* out3 = out3_v.v;
+      Data_type* in1 = in1_v.v;
+      Data_type* in2 = in2_v.v;
+      #pragma unroll
+      for (Index_type i = 0; i < static_cast<Index_type>(vec_width); ++i) {
+        MULADDSUB_BODY;
+      }
+    }
+    reinterpret_cast<vec_type*>(out1)[iv] = out1_v;
+    reinterpret_cast<vec_type*>(out2)[iv] = out2_v;
+    reinterpret_cast<vec_type*>(out3)[iv] = out3_v;
+  } else {
+    for (Index_type i = iv * static_cast<Index_type>(vec_width); i < iend; ++i) {
+      MULADDSUB_BODY;
+    }
+  }
+}
+
+
+template < typename Data_type, size_t block_size, bool launch >
 void MULADDSUB::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -53,7 +103,7 @@ void MULADDSUB::runHipVariantImpl(VariantID vid)
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      hipLaunchKernelGGL((muladdsub<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+      hipLaunchKernelGGL((muladdsub<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
           out1, out2, out3, in1, in2, iend );
       hipErrchk( hipGetLastError() );
 
@@ -83,7 +133,7 @@ void MULADDSUB::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         MULADDSUB_BODY;
       });
@@ -96,7 +146,65 @@ void MULADDSUB::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(MULADDSUB, Hip)
+template < typename Data_type, size_t block_size, size_t items_per_thread, bool strided >
+void MULADDSUB::runHipVariantCoarsened(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  MULADDSUB_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size*items_per_thread);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((muladdsub_coarsened<Data_type, block_size, items_per_thread, strided>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), out1, out2, out3, in1, in2, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  MULADDSUB : Unknown Hip coarsened variant id = " << vid << std::endl;
+  }
+}
+
+template < typename Data_type, size_t block_size, size_t vec_width >
+void MULADDSUB::runHipVariantVec(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  MULADDSUB_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size*vec_width);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((muladdsub_vec<Data_type, block_size, vec_width>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), out1, out2, out3, in1, in2, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  MULADDSUB : Unknown Hip vec variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_COARSEN_TUNING_DEFINE_TYPED_BOILERPLATE(MULADDSUB, Hip, Base_HIP, RAJA_HIP)
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(MULADDSUB, Hip)
 
 } // end namespace basic
 } // end namespace rajaperf
@@ -18,7 +18,8 @@ namespace basic
 {
 
 
-void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void MULADDSUB::runOpenMPVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -91,5 +92,7 @@ void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(MULADDSUB, OpenMP)
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -33,6 +33,10 @@ MULADDSUB::MULADDSUB(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Streaming);
+
+  setUsesFloatingPointDataTypes();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -41,6 +45,8 @@ MULADDSUB::MULADDSUB(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -59,30 +65,70 @@ MULADDSUB::~MULADDSUB()
 {
 }
 
-void MULADDSUB::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void MULADDSUB::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_out1, getActualProblemSize(), 0.0, vid);
-  allocAndInitDataConst(m_out2, getActualProblemSize(), 0.0, vid);
-  allocAndInitDataConst(m_out3, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_in1, getActualProblemSize(), vid);
-  allocAndInitData(m_in2, getActualProblemSize(), vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void MULADDSUB::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_out1, getActualProblemSize(), vid);
-  checksum[vid][tune_idx] += calcChecksum(m_out2, getActualProblemSize(), vid);
-  checksum[vid][tune_idx] += calcChecksum(m_out3, getActualProblemSize(), vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), updateChecksumTyped, vid, tune_idx);
+}
+
+void MULADDSUB::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void MULADDSUB::setUpTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Data_type* out1;
+  Data_type* out2;
+  Data_type* out3;
+  Data_type* in1;
+  Data_type* in2;
+  allocAndInitDataConst(out1, getActualProblemSize(), Data_type(0), vid);
+  allocAndInitDataConst(out2, getActualProblemSize(), Data_type(0), vid);
+  allocAndInitDataConst(out3, getActualProblemSize(), Data_type(0), vid);
+  allocAndInitData(in1, getActualProblemSize(), vid);
+  allocAndInitData(in2, getActualProblemSize(), vid);
+  m_out1 = out1;
+  m_out2 = out2;
+  m_out3 = out3;
+  m_in1 = in1;
+  m_in2 = in2;
+}
+
+template < typename Data_type >
+void MULADDSUB::updateChecksumTyped(VariantID vid, size_t tune_idx)
+{
+  Data_type* out1 = static_cast<Data_type*>(m_out1);
+  Data_type* out2 = static_cast<Data_type*>(m_out2);
+  Data_type* out3 = static_cast<Data_type*>(m_out3);
+  checksum[vid][tune_idx] += calcChecksum(out1, getActualProblemSize(), vid);
+  checksum[vid][tune_idx] += calcChecksum(out2, getActualProblemSize(), vid);
+  checksum[vid][tune_idx] += calcChecksum(out3, getActualProblemSize(), vid);
 }
 
-void MULADDSUB::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void MULADDSUB::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  (void) vid;
-  deallocData(m_out1, vid);
-  deallocData(m_out2, vid);
-  deallocData(m_out3, vid);
-  deallocData(m_in1, vid);
-  deallocData(m_in2, vid);
+  Data_type* out1 = static_cast<Data_type*>(m_out1);
+  Data_type* out2 = static_cast<Data_type*>(m_out2);
+  Data_type* out3 = static_cast<Data_type*>(m_out3);
+  Data_type* in1 = static_cast<Data_type*>(m_in1);
+  Data_type* in2 = static_cast<Data_type*>(m_in2);
+  deallocData(out1, vid);
+  deallocData(out2, vid);
+  deallocData(out3, vid);
+  deallocData(in1, vid);
+  deallocData(in2, vid);
+  m_out1 = nullptr;
+  m_out2 = nullptr;
+  m_out3 = nullptr;
+  m_in1 = nullptr;
+  m_in2 = nullptr;
 }
 
 } // end namespace basic
@@ -20,11 +20,11 @@
 #define RAJAPerf_Basic_MULADDSUB_HPP
 
 #define MULADDSUB_DATA_SETUP \
-  Real_ptr out1 = m_out1; \
-  Real_ptr out2 = m_out2; \
-  Real_ptr out3 = m_out3; \
-  Real_ptr in1 = m_in1; \
-  Real_ptr in2 = m_in2;
+  Data_type* out1 = static_cast<Data_type*>(m_out1); \
+  Data_type* out2 = static_cast<Data_type*>(m_out2); \
+  Data_type* out3 = static_cast<Data_type*>(m_out3); \
+  Data_type* in1 = static_cast<Data_type*>(m_in1); \
+  Data_type* in2 = static_cast<Data_type*>(m_in2);
 
 #define MULADDSUB_BODY  \
   out1[i] = in1[i] * in2[i] ; \
@@ -33,6 +33,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "common/DataTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -60,22 +61,50 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  template < typename Data_type >
+  void setUpTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void updateChecksumTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void tearDownTyped(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void runSeqVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPTargetVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runKokkosVariantTyped(VariantID vid, size_t tune_idx);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size, size_t items_per_thread, bool strided >
+  void runCudaVariantCoarsened(VariantID vid);
+  template < typename Data_type, size_t block_size, size_t vec_width >
+  void runCudaVariantVec(VariantID vid);
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < typename Data_type, size_t block_size, size_t items_per_thread, bool strided >
+  void runHipVariantCoarsened(VariantID vid);
+  template < typename Data_type, size_t block_size, size_t vec_width >
+  void runHipVariantVec(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
-  Real_ptr m_out1;
-  Real_ptr m_out2;
-  Real_ptr m_out3;
-  Real_ptr m_in1;
-  Real_ptr m_in2;
+  void* m_out1; // array of Data_type
+  void* m_out2; // array of Data_type
+  void* m_out3; // array of Data_type
+  void* m_in1;  // array of Data_type
+  void* m_in2;  // array of Data_type
 };
 
 } // end namespace basic
@@ -48,7 +48,7 @@ __global__ void nested_init(Real_ptr array,
 {
   Index_type i = blockIdx.x * i_block_size + threadIdx.x;
   Index_type j = blockIdx.y * j_block_size + threadIdx.y;
-  Index_type k = blockIdx.z;
+  Index_type k = blockIdx.z * k_block_size + threadIdx.z;
 
   if ( i < ni && j < nj && k < nk ) {
     NESTED_INIT_BODY;
@@ -62,7 +62,7 @@ __global__ void nested_init_lam(Index_type ni, Index_type nj, Index_type nk,
 {
   Index_type i = blockIdx.x * i_block_size + threadIdx.x;
   Index_type j = blockIdx.y * j_block_size + threadIdx.y;
-  Index_type k = blockIdx.z;
+  Index_type k = blockIdx.z * k_block_size + threadIdx.z;
 
   if ( i < ni && j < nj && k < nk ) {
     body(i, j, k);
@@ -70,6 +70,22 @@ __global__ void nested_init_lam(Index_type ni, Index_type nj, Index_type nk,
 }
 
 
+template< size_t i_block_size, size_t j_block_size >
+__launch_bounds__(i_block_size*j_block_size)
+__global__ void nested_init_march(Real_ptr array,
+                                  Index_type ni, Index_type nj, Index_type nk)
+{
+  Index_type i = blockIdx.x * i_block_size + threadIdx.x;
+  Index_type j = blockIdx.y * j_block_size + threadIdx.y;
+
+  if ( i < ni && j < nj ) {
+    for (Index_type k = 0; k < nk; ++k) {
+      NESTED_INIT_BODY;
+    }
+  }
+}
+
+
 
 template < size_t block_size >
 void NESTED_INIT::runHipVariantImpl(VariantID vid)
@@ -154,7 +170,73 @@ void NESTED_INIT::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(NESTED_INIT, Hip)
+template < size_t i_block_size, size_t j_block_size, size_t k_block_size >
+void NESTED_INIT::runHipVariantShape(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  NESTED_INIT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dim3 nthreads_per_block(i_block_size, j_block_size, k_block_size);
+      dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, i_block_size)),
+                   static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nj, j_block_size)),
+                   static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nk, k_block_size)));
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((nested_init<i_block_size, j_block_size, k_block_size>),
+                         dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         array, ni, nj, nk);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  NESTED_INIT : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t i_block_size, size_t j_block_size >
+void NESTED_INIT::runHipVariantMarch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  NESTED_INIT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dim3 nthreads_per_block(i_block_size, j_block_size, 1);
+      dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, i_block_size)),
+                   static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nj, j_block_size)),
+                   static_cast<size_t>(1));
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((nested_init_march<i_block_size, j_block_size>),
+                         dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         array, ni, nj, nk);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  NESTED_INIT : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_SHAPE_3D_TUNING_DEFINE_BOILERPLATE(NESTED_INIT, Hip, Base_HIP)
 
 } // end namespace basic
 } // end namespace rajaperf
@@ -17,11 +17,60 @@ namespace rajaperf
 namespace basic
 {
 
-//#define USE_OMP_COLLAPSE
-#undef USE_OMP_COLLAPSE
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// RAJA OpenMP kernel policies of the tunings, segments are (i, j, k).
+//
+using nested_init_omp_outer_pol =
+  RAJA::KernelPolicy<
+    RAJA::statement::For<2, RAJA::omp_parallel_for_exec,  // k
+      RAJA::statement::For<1, RAJA::seq_exec,            // j
+        RAJA::statement::For<0, RAJA::seq_exec,          // i
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >
+  >;
+
+using nested_init_omp_collapse_pol =
+  RAJA::KernelPolicy<
+    RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                              RAJA::ArgList<2, 1, 0>,  // k, j, i
+      RAJA::statement::Lambda<0>
+    >
+  >;
+
+using nested_init_omp_collapse_simd_pol =
+  RAJA::KernelPolicy<
+    RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                              RAJA::ArgList<2, 1>,  // k, j
+      RAJA::statement::For<0, RAJA::simd_exec,      // i
+        RAJA::statement::Lambda<0>
+      >
+    >
+  >;
+
+template < Index_type tile_size >
+using nested_init_omp_tile_pol =
+  RAJA::KernelPolicy<
+    RAJA::statement::For<2, RAJA::omp_parallel_for_exec,                        // k
+      RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::seq_exec,     // j tile
+        RAJA::statement::Tile<0, RAJA::tile_fixed<tile_size>, RAJA::seq_exec,   // i tile
+          RAJA::statement::For<1, RAJA::seq_exec,                               // j
+            RAJA::statement::For<0, RAJA::simd_exec,                            // i
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >
+  >;
+
+#endif
 
 
-void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -33,6 +82,9 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
                           NESTED_INIT_BODY;
                         };
 
+  // the second tuning of each variant collapses the loops
+  const bool collapse = (tune_idx == 1);
+
   switch ( vid ) {
 
     case Base_OpenMP : {
@@ -40,11 +92,17 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#if defined(USE_OMP_COLLAPSE)
+        if (collapse) {
           #pragma omp parallel for collapse(3)
-#else
+          for (Index_type k = 0; k < nk; ++k ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              for (Index_type i = 0; i < ni; ++i ) {
+                NESTED_INIT_BODY;
+              }
+            }
+          }
+        } else {
           #pragma omp parallel for
-#endif
           for (Index_type k = 0; k < nk; ++k ) {
             for (Index_type j = 0; j < nj; ++j ) {
               for (Index_type i = 0; i < ni; ++i ) {
@@ -52,6 +110,7 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
               }
             }
           }
+        }
 
       }
       stopTimer();
@@ -64,11 +123,17 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#if defined(USE_OMP_COLLAPSE)
+        if (collapse) {
           #pragma omp parallel for collapse(3)
-#else
+          for (Index_type k = 0; k < nk; ++k ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              for (Index_type i = 0; i < ni; ++i ) {
+                nestedinit_lam(i, j, k);
+              }
+            }
+          }
+        } else {
           #pragma omp parallel for
-#endif
           for (Index_type k = 0; k < nk; ++k ) {
             for (Index_type j = 0; j < nj; ++j ) {
               for (Index_type i = 0; i < ni; ++i ) {
@@ -76,6 +141,7 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
               }
             }
           }
+        }
 
       }
       stopTimer();
@@ -85,38 +151,34 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
     case RAJA_OpenMP : {
 
-#if defined(USE_OMP_COLLAPSE)
-      using EXEC_POL =
-        RAJA::KernelPolicy<
-          RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
-                                    RAJA::ArgList<2, 1, 0>,  // k, j, i
-            RAJA::statement::Lambda<0>
-          >
-        >;
-#else
-      using EXEC_POL =
-        RAJA::KernelPolicy<
-          RAJA::statement::For<2, RAJA::omp_parallel_for_exec,  // k
-            RAJA::statement::For<1, RAJA::seq_exec,            // j
-              RAJA::statement::For<0, RAJA::seq_exec,          // i
-                RAJA::statement::Lambda<0>
-              >
-            >
-          >
-        >;
-#endif
+      size_t t = 0;
 
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+      if (tune_idx == t) {
+        runOpenMPVariantRAJA<nested_init_omp_outer_pol>(vid);
+      }
+      t += 1;
 
-        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, ni),
-                                                 RAJA::RangeSegment(0, nj),
-                                                 RAJA::RangeSegment(0, nk)),
-                                nestedinit_lam
-                              );
+      if (tune_idx == t) {
+        runOpenMPVariantRAJA<nested_init_omp_collapse_pol>(vid);
+      }
+      t += 1;
 
+      if (tune_idx == t) {
+        runOpenMPVariantRAJA<nested_init_omp_collapse_simd_pol>(vid);
       }
-      stopTimer();
+      t += 1;
+
+      seq_for(omp_tile_sizes_type{}, [&](auto tile_size) {
+        if (tune_idx == t) {
+          runOpenMPVariantRAJA<nested_init_omp_tile_pol<tile_size>>(vid);
+        }
+        t += 1;
+      });
+
+      if (tune_idx == t) {
+        runOpenMPVariantLaunch(vid);
+      }
+      t += 1;
 
       break;
     }
@@ -129,8 +191,94 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+template < typename EXEC_POL >
+void NESTED_INIT::runOpenMPVariantRAJA(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NESTED_INIT_DATA_SETUP;
+
+  auto nestedinit_lam = [=](Index_type i, Index_type j, Index_type k) {
+                          NESTED_INIT_BODY;
+                        };
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                             RAJA::RangeSegment(0, nj),
+                                             RAJA::RangeSegment(0, nk)),
+                            nestedinit_lam
+                          );
+
+  }
+  stopTimer();
+
+#endif
+  RAJA_UNUSED_VAR(vid);
+}
+
+void NESTED_INIT::runOpenMPVariantLaunch(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NESTED_INIT_DATA_SETUP;
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::omp_launch_t>;
+
+  using outer_z = RAJA::LoopPolicy<RAJA::omp_for_exec>;
+  using inner_y = RAJA::LoopPolicy<RAJA::seq_exec>;
+  using inner_x = RAJA::LoopPolicy<RAJA::simd_exec>;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    RAJA::launch<launch_policy>(RAJA::LaunchParams(),
+      [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<outer_z>(ctx, RAJA::RangeSegment(0, nk),
+          [&](Index_type k) {
+            RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, nj),
+              [&](Index_type j) {
+                RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, ni),
+                  [&](Index_type i) {
+                    NESTED_INIT_BODY;
+                  }
+                );  // RAJA::loop<inner_x>
+              }
+            );  // RAJA::loop<inner_y>
+          }
+        );  // RAJA::loop<outer_z>
+      }  // outer lambda (ctx)
+    );  // RAJA::launch
+
+  }
+  stopTimer();
+
+#endif
+  RAJA_UNUSED_VAR(vid);
+}
+
+void NESTED_INIT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  addVariantTuningName(vid, "collapse");
+
+  if (vid == RAJA_OpenMP) {
+    addVariantTuningName(vid, "collapse_simd");
+    seq_for(omp_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "tile_"+std::to_string(tile_size));
+    });
+    addVariantTuningName(vid, "launch");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
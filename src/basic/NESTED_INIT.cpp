@@ -43,6 +43,9 @@ NESTED_INIT::NESTED_INIT(const RunParams& params)
   setFLOPsPerRep(3 * getActualProblemSize());
 
   setUsesFeature(Kernel);
+  setUsesFeature(Launch);
+
+  setHasPattern(Streaming);
 
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
@@ -17,6 +17,15 @@
 ///   }
 /// }
 ///
+/// The OpenMP variants have a "collapse" tuning that collapses the three
+/// loops. The RAJA OpenMP variant also has tunings that run the i loop as
+/// simd under a collapse of the k and j loops, that tile the j and i loops
+/// with tiles of each size of omp_tile_sizes_type, and that use RAJA::launch.
+///
+/// The Base GPU variants also have tunings for each x by y by z block
+/// shape of each block size, see gpu_block_shape, and for each x by y
+/// shape whose threads march through all of k.
+///
 
 #ifndef RAJAPerf_Basic_NESTED_INIT_HPP
 #define RAJAPerf_Basic_NESTED_INIT_HPP
@@ -60,17 +69,30 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename EXEC_POL >
+  void runOpenMPVariantRAJA(VariantID vid);
+  void runOpenMPVariantLaunch(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t i_block_size, size_t j_block_size, size_t k_block_size >
+  void runCudaVariantShape(VariantID vid);
+  template < size_t i_block_size, size_t j_block_size, size_t k_block_size >
+  void runHipVariantShape(VariantID vid);
+  template < size_t i_block_size, size_t j_block_size >
+  void runCudaVariantMarch(VariantID vid);
+  template < size_t i_block_size, size_t j_block_size >
+  void runHipVariantMarch(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using omp_tile_sizes_type = camp::int_seq<Index_type, 16, 64>;
 
   Index_type m_array_length;
 
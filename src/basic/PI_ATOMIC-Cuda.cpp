@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -36,7 +37,7 @@ __global__ void pi_atomic(Real_ptr pi,
 
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void PI_ATOMIC::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -101,7 +102,7 @@ void PI_ATOMIC::runCudaVariantImpl(VariantID vid)
       cudaErrchk( cudaMemcpyAsync( pi, &m_pi_init, sizeof(Real_type),
                                    cudaMemcpyHostToDevice, res.get_stream() ) );
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           double x = (double(i) + 0.5) * dx;
           RAJA::atomicAdd<RAJA::cuda_atomic>(pi, dx / (1.0 + x * x));
@@ -120,7 +121,7 @@ void PI_ATOMIC::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(PI_ATOMIC, Cuda)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(PI_ATOMIC, Cuda, RAJA_CUDA)
 
 } // end namespace basic
 } // end namespace rajaperf
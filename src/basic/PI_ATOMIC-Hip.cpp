@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -36,7 +37,7 @@ __global__ void atomic_pi(Real_ptr pi,
 
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void PI_ATOMIC::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -103,7 +104,7 @@ void PI_ATOMIC::runHipVariantImpl(VariantID vid)
       hipErrchk( hipMemcpyAsync( pi, &m_pi_init, sizeof(Real_type),
                                  hipMemcpyHostToDevice, res.get_stream() ) );
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
           double x = (double(i) + 0.5) * dx;
           RAJA::atomicAdd<RAJA::hip_atomic>(pi, dx / (1.0 + x * x));
@@ -122,7 +123,7 @@ void PI_ATOMIC::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(PI_ATOMIC, Hip)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(PI_ATOMIC, Hip, RAJA_HIP)
 
 } // end namespace basic
 } // end namespace rajaperf
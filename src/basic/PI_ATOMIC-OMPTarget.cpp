@@ -30,6 +30,8 @@ namespace basic
 void PI_ATOMIC::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -42,12 +44,22 @@ void PI_ATOMIC::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
       initOpenMPDeviceData(pi, &m_pi_init, 1);
 
-      #pragma omp target is_device_ptr(pi)
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        double x = (double(i) + 0.5) * dx;
-        #pragma omp atomic
-        *pi += dx / (1.0 + x * x);
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(pi)
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          double x = (double(i) + 0.5) * dx;
+          #pragma omp atomic
+          *pi += dx / (1.0 + x * x);
+        }
+      } else {
+        #pragma omp target is_device_ptr(pi)
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          double x = (double(i) + 0.5) * dx;
+          #pragma omp atomic
+          *pi += dx / (1.0 + x * x);
+        }
       }
 
       getOpenMPDeviceData(&m_pi_final, pi, 1);
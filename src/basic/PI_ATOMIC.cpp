@@ -35,6 +35,8 @@ PI_ATOMIC::PI_ATOMIC(const RunParams& params)
   setUsesFeature(Forall);
   setUsesFeature(Atomic);
 
+  setHasPattern(ReductionBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -43,6 +45,8 @@ PI_ATOMIC::PI_ATOMIC(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -58,6 +58,64 @@ __global__ void pi_reduce(Real_type dx,
 #endif
 }
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pi_reduce_warp_atomic(Real_type dx,
+                                      Real_ptr dpi,
+                                      Index_type iend)
+{
+  Real_type pi = 0.0;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    PI_REDUCE_BODY;
+  }
+
+  pi = cuda_block_reduce<block_size, RAJA::operators::plus<Real_type>>(pi);
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>( dpi, pi );
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pi_reduce_partial(Real_type dx,
+                                  Real_ptr dpartial,
+                                  Index_type iend)
+{
+  Real_type pi = 0.0;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    PI_REDUCE_BODY;
+  }
+
+  pi = cuda_block_reduce<block_size, RAJA::operators::plus<Real_type>>(pi);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = pi;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pi_reduce_final(Real_ptr dpartial, Index_type num_partial,
+                                Real_ptr dpi, Real_type pi_init)
+{
+  Real_type pi = 0.0;
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    pi += dpartial[ i ];
+  }
+
+  pi = cuda_block_reduce<block_size, RAJA::operators::plus<Real_type>>(pi);
+
+  if ( threadIdx.x == 0 ) {
+    *dpi = pi_init + pi;
+  }
+}
+
 
 
 template < size_t block_size >
@@ -141,6 +199,8 @@ void PI_REDUCE::runCudaVariantOccGS(VariantID vid)
     constexpr size_t shmem = sizeof(Real_type)*block_size;
     const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
         (pi_reduce<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("pi_reduce",
+        (pi_reduce<block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -188,6 +248,145 @@ void PI_REDUCE::runCudaVariantOccGS(VariantID vid)
   }
 }
 
+template < typename exec_policy >
+void PI_REDUCE::runCudaVariantExpt(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  PI_REDUCE_DATA_SETUP;
+
+  if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_type tpi = m_pi_init;
+
+      RAJA::forall< exec_policy >( res,
+        RAJA::RangeSegment(ibegin, iend),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&tpi),
+        [=] __device__ (Index_type i, Real_type& pi) {
+          PI_REDUCE_BODY;
+        }
+      );
+
+      m_pi = 4.0 * tpi;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PI_REDUCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void PI_REDUCE::runCudaVariantWarpAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  PI_REDUCE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Real_ptr dpi;
+    allocData(DataSpace::CudaDevice, dpi, 1);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (pi_reduce_warp_atomic<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("pi_reduce_warp_atomic",
+        (pi_reduce_warp_atomic<block_size>), block_size, shmem) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemcpyAsync( dpi, &m_pi_init, sizeof(Real_type),
+                                   cudaMemcpyHostToDevice, res.get_stream() ) );
+
+      const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+      pi_reduce_warp_atomic<block_size><<<grid_size, block_size,
+                              shmem, res.get_stream()>>>( dx, dpi, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      cudaErrchk( cudaMemcpyAsync( &m_pi, dpi, sizeof(Real_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_pi *= 4.0;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dpi);
+
+  } else {
+     getCout() << "\n  PI_REDUCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void PI_REDUCE::runCudaVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  PI_REDUCE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (pi_reduce_partial<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("pi_reduce_partial",
+        (pi_reduce_partial<block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Real_ptr dpi;
+    allocData(DataSpace::CudaDevice, dpi, 1);
+
+    Real_ptr dpartial;
+    allocData(DataSpace::CudaDevice, dpartial, grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      pi_reduce_partial<block_size><<<grid_size, block_size,
+                              shmem, res.get_stream()>>>( dx, dpartial, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      pi_reduce_final<block_size><<<1, block_size,
+                              shmem, res.get_stream()>>>( dpartial, grid_size,
+                                                          dpi, m_pi_init );
+      cudaErrchk( cudaGetLastError() );
+
+      cudaErrchk( cudaMemcpyAsync( &m_pi, dpi, sizeof(Real_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_pi *= 4.0;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dpartial);
+    deallocData(DataSpace::CudaDevice, dpi);
+
+  } else {
+     getCout() << "\n  PI_REDUCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
 void PI_REDUCE::runCudaVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -217,10 +416,63 @@ void PI_REDUCE::runCudaVariant(VariantID vid, size_t tune_idx)
 
         t += 1;
 
+        if ( vid == RAJA_CUDA ) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantExpt<RAJA::cuda_exec<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantExpt<RAJA::cuda_exec_occ_calc<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantWarpAtomic<block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantTwoPass<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
   } else {
 
     getCout() << "\n  PI_REDUCE : Unknown Cuda variant id = " << vid << std::endl;
@@ -242,10 +494,35 @@ void PI_REDUCE::setCudaTuningDefinitions(VariantID vid)
 
         addVariantTuningName(vid, "occgs_"+std::to_string(block_size));
 
+        if ( vid == RAJA_CUDA ) {
+
+          addVariantTuningName(vid, "expt_block_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "expt_occgs_"+std::to_string(block_size));
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, "warp_atomic_"+std::to_string(block_size));
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
   }
 }
 
@@ -58,6 +58,64 @@ __global__ void pi_reduce(Real_type dx,
 #endif
 }
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pi_reduce_warp_atomic(Real_type dx,
+                                      Real_ptr dpi,
+                                      Index_type iend)
+{
+  Real_type pi = 0.0;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    PI_REDUCE_BODY;
+  }
+
+  pi = hip_block_reduce<block_size, RAJA::operators::plus<Real_type>>(pi);
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd<RAJA::hip_atomic>( dpi, pi );
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pi_reduce_partial(Real_type dx,
+                                  Real_ptr dpartial,
+                                  Index_type iend)
+{
+  Real_type pi = 0.0;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    PI_REDUCE_BODY;
+  }
+
+  pi = hip_block_reduce<block_size, RAJA::operators::plus<Real_type>>(pi);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = pi;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pi_reduce_final(Real_ptr dpartial, Index_type num_partial,
+                                Real_ptr dpi, Real_type pi_init)
+{
+  Real_type pi = 0.0;
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    pi += dpartial[ i ];
+  }
+
+  pi = hip_block_reduce<block_size, RAJA::operators::plus<Real_type>>(pi);
+
+  if ( threadIdx.x == 0 ) {
+    *dpi = pi_init + pi;
+  }
+}
+
 
 
 template < size_t block_size >
@@ -140,6 +198,8 @@ void PI_REDUCE::runHipVariantOccGS(VariantID vid)
     constexpr size_t shmem = sizeof(Real_type)*block_size;
     const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
         (pi_reduce<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("pi_reduce",
+        (pi_reduce<block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -186,6 +246,147 @@ void PI_REDUCE::runHipVariantOccGS(VariantID vid)
   }
 }
 
+template < typename exec_policy >
+void PI_REDUCE::runHipVariantExpt(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  PI_REDUCE_DATA_SETUP;
+
+  if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_type tpi = m_pi_init;
+
+      RAJA::forall< exec_policy >( res,
+        RAJA::RangeSegment(ibegin, iend),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&tpi),
+        [=] __device__ (Index_type i, Real_type& pi) {
+          PI_REDUCE_BODY;
+        }
+      );
+
+      m_pi = 4.0 * tpi;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PI_REDUCE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void PI_REDUCE::runHipVariantWarpAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  PI_REDUCE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    Real_ptr dpi;
+    allocData(DataSpace::HipDevice, dpi, 1);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (pi_reduce_warp_atomic<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("pi_reduce_warp_atomic",
+        (pi_reduce_warp_atomic<block_size>), block_size, shmem) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemcpyAsync( dpi, &m_pi_init, sizeof(Real_type),
+                                 hipMemcpyHostToDevice, res.get_stream() ) );
+
+      const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+      hipLaunchKernelGGL( (pi_reduce_warp_atomic<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          dx, dpi, iend );
+      hipErrchk( hipGetLastError() );
+
+      hipErrchk( hipMemcpyAsync( &m_pi, dpi, sizeof(Real_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_pi *= 4.0;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, dpi);
+
+  } else {
+     getCout() << "\n  PI_REDUCE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void PI_REDUCE::runHipVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  PI_REDUCE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (pi_reduce_partial<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("pi_reduce_partial",
+        (pi_reduce_partial<block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Real_ptr dpi;
+    allocData(DataSpace::HipDevice, dpi, 1);
+
+    Real_ptr dpartial;
+    allocData(DataSpace::HipDevice, dpartial, grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL( (pi_reduce_partial<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          dx, dpartial, iend );
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL( (pi_reduce_final<block_size>), dim3(1), dim3(block_size),
+                          shmem, res.get_stream(),
+                          dpartial, grid_size, dpi, m_pi_init );
+      hipErrchk( hipGetLastError() );
+
+      hipErrchk( hipMemcpyAsync( &m_pi, dpi, sizeof(Real_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_pi *= 4.0;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, dpartial);
+    deallocData(DataSpace::HipDevice, dpi);
+
+  } else {
+     getCout() << "\n  PI_REDUCE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
 void PI_REDUCE::runHipVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -215,10 +416,63 @@ void PI_REDUCE::runHipVariant(VariantID vid, size_t tune_idx)
 
         t += 1;
 
+        if ( vid == RAJA_HIP ) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantExpt<RAJA::hip_exec<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantExpt<RAJA::hip_exec_occ_calc<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantWarpAtomic<block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantTwoPass<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
   } else {
 
     getCout() << "\n  PI_REDUCE : Unknown Hip variant id = " << vid << std::endl;
@@ -240,12 +494,36 @@ void PI_REDUCE::setHipTuningDefinitions(VariantID vid)
 
         addVariantTuningName(vid, "occgs_"+std::to_string(block_size));
 
+        if ( vid == RAJA_HIP ) {
+
+          addVariantTuningName(vid, "expt_block_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "expt_occgs_"+std::to_string(block_size));
+
+        }
+
       }
 
     });
 
-  }
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
 
+          addVariantTuningName(vid, "warp_atomic_"+std::to_string(block_size));
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
+  }
 }
 
 } // end namespace basic
@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,8 +19,77 @@ namespace basic
 {
 
 
-void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// Each thread sums a fixed block of the iteration space and the thread
+// partial sums are combined in thread order, so the result is the same in
+// every run that uses the same number of threads.
+//
+void PI_REDUCE::runOpenMPVariantOrdered(VariantID vid)
 {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_REDUCE_DATA_SETUP;
+
+  // partial sum of each thread
+  const Index_type nthreads = omp_get_max_threads();
+  std::vector<Real_type> partial_sums(nthreads);
+  Real_type* partial = partial_sums.data();
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Index_type nt_used = 1;
+
+      #pragma omp parallel
+      {
+        const Index_type nt = omp_get_num_threads();
+        const Index_type tid = omp_get_thread_num();
+        const Index_type len = iend - ibegin;
+
+        Real_type pi = 0;
+        for (Index_type i = ibegin + (len*tid)/nt;
+             i < ibegin + (len*(tid+1))/nt; ++i ) {
+          PI_REDUCE_BODY;
+        }
+        partial[tid] = pi;
+
+        if ( tid == 0 ) {
+          nt_used = nt;
+        }
+      }
+
+      Real_type pi = m_pi_init;
+      for (Index_type t = 0; t < nt_used; ++t ) {
+        pi += partial[t];
+      }
+
+      m_pi = 4.0 * pi;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PI_REDUCE : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  if ( vid == Base_OpenMP && tune_idx == 1 ) {
+    runOpenMPVariantOrdered(vid);
+    return;
+  }
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
@@ -104,8 +174,18 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void PI_REDUCE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addReproducibleVariantTuningName(vid, "ordered");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
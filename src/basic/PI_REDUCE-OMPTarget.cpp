@@ -30,6 +30,8 @@ namespace basic
 void PI_REDUCE::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -42,11 +44,20 @@ void PI_REDUCE::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
       Real_type pi = m_pi_init;
 
-      #pragma omp target device( did ) map(tofrom:pi)
-      #pragma omp teams distribute parallel for reduction(+:pi) \
-              thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        PI_REDUCE_BODY;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target device( did ) map(tofrom:pi)
+        #pragma omp teams distribute parallel for reduction(+:pi) \
+                num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PI_REDUCE_BODY;
+        }
+      } else {
+        #pragma omp target device( did ) map(tofrom:pi)
+        #pragma omp teams distribute parallel for reduction(+:pi) \
+                thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PI_REDUCE_BODY;
+        }
       }
 
       m_pi = 4.0 * pi;
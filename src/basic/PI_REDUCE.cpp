@@ -35,6 +35,8 @@ PI_REDUCE::PI_REDUCE(const RunParams& params)
   setUsesFeature(Forall);
   setUsesFeature(Reduction);
 
+  setHasPattern(ReductionBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -43,6 +45,8 @@ PI_REDUCE::PI_REDUCE(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -51,6 +55,8 @@ PI_REDUCE::PI_REDUCE(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 PI_REDUCE::~PI_REDUCE()
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POINTER_CHASE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+  //
+  // The chase is one dependent chain so it runs on a single thread.
+  //
+  constexpr size_t chase_block_size = 1;
+
+__launch_bounds__(chase_block_size)
+__global__ void pointer_chase(Int_ptr next, Int_ptr pos,
+                              Index_type num_loads)
+{
+  POINTER_CHASE_BODY;
+}
+
+
+void POINTER_CHASE::runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POINTER_CHASE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((pointer_chase), dim3(1), dim3(chase_block_size), shmem, res.get_stream(),
+                         next, pos, num_loads );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_HIP ) {
+
+    auto chase_lambda = [=] __device__ () {
+      POINTER_CHASE_BODY;
+    };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((lambda_hip<chase_block_size, decltype(chase_lambda)>),
+                         dim3(1), dim3(chase_block_size), shmem, res.get_stream(),
+                         chase_lambda);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::hip_exec<chase_block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, 1), [=] __device__ (Index_type) {
+        POINTER_CHASE_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  POINTER_CHASE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POINTER_CHASE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+POINTER_CHASE::POINTER_CHASE(const RunParams& params)
+  : KernelBase(rajaperf::Basic_POINTER_CHASE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(5);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  // chase at least 64K loads per rep so small working sets are timed
+  // over many loads
+  m_num_loads = std::max(getActualProblemSize(), Index_type(64*1024));
+
+  setItsPerRep( m_num_loads );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Int_type) + 1*sizeof(Int_type)) * m_num_loads +
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+POINTER_CHASE::~POINTER_CHASE()
+{
+}
+
+void POINTER_CHASE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  //
+  // Sattolo's algorithm gives a random permutation with a single cycle so
+  // the chase visits every entry before returning to the start.
+  //
+  constexpr unsigned long long chase_seed = 4099;
+
+  std::vector<Int_type> next(len);
+  for (Index_type i = 0; i < len; ++i) {
+    next[i] = static_cast<Int_type>(i);
+  }
+  for (Index_type i = len-1; i > 0; --i) {
+    const Index_type r = static_cast<Index_type>(
+        detail::counterRandValue(chase_seed, i) * i);
+    std::swap(next[i], next[r]);
+  }
+
+  allocData(m_next, len, vid);
+  copyData(getDataSpace(vid), m_next, DataSpace::Host, next.data(), len);
+  allocAndInitDataConst(m_pos, 1, 0, vid);
+}
+
+void POINTER_CHASE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_pos, 1, vid);
+}
+
+void POINTER_CHASE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_next, vid);
+  deallocData(m_pos, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
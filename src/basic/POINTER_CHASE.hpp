@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POINTER_CHASE kernel reference implementation:
+///
+/// Int_type j = 0;
+/// for (Index_type l = 0; l < num_loads; ++l) {
+///   j = next[j];
+/// }
+/// pos[0] = j;
+///
+/// next is a random cyclic permutation of the problem size, so each load
+/// depends on the one before it and the loads visit the whole working set
+/// in an order hardware prefetchers can not follow. The kernel runs on a
+/// single host thread or a single GPU thread and its runtime per iteration
+/// is the average load latency for a working set of the problem size, see
+/// the per iteration runtime report.
+///
+
+#ifndef RAJAPerf_Basic_POINTER_CHASE_HPP
+#define RAJAPerf_Basic_POINTER_CHASE_HPP
+
+#define POINTER_CHASE_DATA_SETUP \
+  Int_ptr next = m_next; \
+  Int_ptr pos = m_pos; \
+  const Index_type num_loads = m_num_loads;
+
+#define POINTER_CHASE_BODY \
+  Int_type j = 0; \
+  for (Index_type l = 0; l < num_loads; ++l) { \
+    j = next[j]; \
+  } \
+  pos[0] = j;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class POINTER_CHASE : public KernelBase
+{
+public:
+
+  POINTER_CHASE(const RunParams& params);
+
+  ~POINTER_CHASE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+private:
+  Index_type m_num_loads;
+
+  Int_ptr m_next;
+  Int_ptr m_pos;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
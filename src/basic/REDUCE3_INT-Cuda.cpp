@@ -73,6 +73,109 @@ __global__ void reduce3int(Int_ptr vec,
 #endif
 }
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce3int_warp_atomic(Int_ptr vec,
+                                       Int_ptr vsum_out,
+                                       Int_ptr vmin_out,
+                                       Int_ptr vmax_out,
+                                       Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Int_type>;
+  using min_op = RAJA::operators::minimum<Int_type>;
+  using max_op = RAJA::operators::maximum<Int_type>;
+
+  Int_type vsum = sum_op::identity();
+  Int_type vmin = min_op::identity();
+  Int_type vmax = max_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE3_INT_BODY;
+  }
+
+  vsum = cuda_block_reduce<block_size, sum_op>(vsum);
+  vmin = cuda_block_reduce<block_size, min_op>(vmin);
+  vmax = cuda_block_reduce<block_size, max_op>(vmax);
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>( vsum_out, vsum );
+    RAJA::atomicMin<RAJA::cuda_atomic>( vmin_out, vmin );
+    RAJA::atomicMax<RAJA::cuda_atomic>( vmax_out, vmax );
+  }
+}
+
+//
+// First pass of the two pass reduction, each block writes its results to
+// vpartial[blockIdx.x + {0, 1, 2}*gridDim.x].
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce3int_partial(Int_ptr vec,
+                                   Int_ptr vpartial,
+                                   Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Int_type>;
+  using min_op = RAJA::operators::minimum<Int_type>;
+  using max_op = RAJA::operators::maximum<Int_type>;
+
+  Int_type vsum = sum_op::identity();
+  Int_type vmin = min_op::identity();
+  Int_type vmax = max_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE3_INT_BODY;
+  }
+
+  vsum = cuda_block_reduce<block_size, sum_op>(vsum);
+  vmin = cuda_block_reduce<block_size, min_op>(vmin);
+  vmax = cuda_block_reduce<block_size, max_op>(vmax);
+
+  if ( threadIdx.x == 0 ) {
+    vpartial[ blockIdx.x + 0 * gridDim.x ] = vsum;
+    vpartial[ blockIdx.x + 1 * gridDim.x ] = vmin;
+    vpartial[ blockIdx.x + 2 * gridDim.x ] = vmax;
+  }
+}
+
+//
+// Second pass of the two pass reduction, a single block combines the
+// num_partial results of each reduction with the initial values.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce3int_final(Int_ptr vpartial, Index_type num_partial,
+                                 Int_ptr vmem,
+                                 Int_type vsum_init,
+                                 Int_type vmin_init,
+                                 Int_type vmax_init)
+{
+  using sum_op = RAJA::operators::plus<Int_type>;
+  using min_op = RAJA::operators::minimum<Int_type>;
+  using max_op = RAJA::operators::maximum<Int_type>;
+
+  Int_type vsum = sum_op::identity();
+  Int_type vmin = min_op::identity();
+  Int_type vmax = max_op::identity();
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    vsum += vpartial[ i + 0 * num_partial ];
+    vmin = RAJA_MIN( vmin, vpartial[ i + 1 * num_partial ] );
+    vmax = RAJA_MAX( vmax, vpartial[ i + 2 * num_partial ] );
+  }
+
+  vsum = cuda_block_reduce<block_size, sum_op>(vsum);
+  vmin = cuda_block_reduce<block_size, min_op>(vmin);
+  vmax = cuda_block_reduce<block_size, max_op>(vmax);
+
+  if ( threadIdx.x == 0 ) {
+    vmem[0] = vsum_init + vsum;
+    vmem[1] = RAJA_MIN( vmin_init, vmin );
+    vmem[2] = RAJA_MAX( vmax_init, vmax );
+  }
+}
+
 
 
 template < size_t block_size >
@@ -175,6 +278,8 @@ void REDUCE3_INT::runCudaVariantOccGS(VariantID vid)
     constexpr size_t shmem = 3*sizeof(Int_type)*block_size;
     const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
         (reduce3int<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("reduce3int",
+        (reduce3int<block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -235,6 +340,172 @@ void REDUCE3_INT::runCudaVariantOccGS(VariantID vid)
   }
 }
 
+template < typename exec_policy >
+void REDUCE3_INT::runCudaVariantExpt(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  REDUCE3_INT_DATA_SETUP;
+
+  if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Int_type tvsum = m_vsum_init;
+      Int_type tvmin = m_vmin_init;
+      Int_type tvmax = m_vmax_init;
+
+      RAJA::forall< exec_policy >( res,
+        RAJA::RangeSegment(ibegin, iend),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&tvsum),
+        RAJA::expt::Reduce<RAJA::operators::minimum>(&tvmin),
+        RAJA::expt::Reduce<RAJA::operators::maximum>(&tvmax),
+        [=] __device__ (Index_type i,
+                        Int_type& vsum, Int_type& vmin, Int_type& vmax) {
+          REDUCE3_INT_BODY;
+        }
+      );
+
+      m_vsum += static_cast<Int_type>(tvsum);
+      m_vmin = RAJA_MIN(m_vmin, static_cast<Int_type>(tvmin));
+      m_vmax = RAJA_MAX(m_vmax, static_cast<Int_type>(tvmax));
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  REDUCE3_INT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void REDUCE3_INT::runCudaVariantWarpAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  REDUCE3_INT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Int_ptr vmem_init;
+    allocData(DataSpace::CudaPinned, vmem_init, 3);
+
+    Int_ptr vmem;
+    allocData(DataSpace::CudaDevice, vmem, 3);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (reduce3int_warp_atomic<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("reduce3int_warp_atomic",
+        (reduce3int_warp_atomic<block_size>), block_size, shmem) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      vmem_init[0] = m_vsum_init;
+      vmem_init[1] = m_vmin_init;
+      vmem_init[2] = m_vmax_init;
+      cudaErrchk( cudaMemcpyAsync( vmem, vmem_init, 3*sizeof(Int_type),
+                                   cudaMemcpyHostToDevice, res.get_stream() ) );
+
+      const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+      reduce3int_warp_atomic<block_size><<<grid_size, block_size,
+                               shmem, res.get_stream()>>>(vec,
+                                                    vmem + 0,
+                                                    vmem + 1,
+                                                    vmem + 2,
+                                                    iend );
+      cudaErrchk( cudaGetLastError() );
+
+      Int_type lmem[3];
+      cudaErrchk( cudaMemcpyAsync( &lmem[0], vmem, 3*sizeof(Int_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_vsum += lmem[0];
+      m_vmin = RAJA_MIN(m_vmin, lmem[1]);
+      m_vmax = RAJA_MAX(m_vmax, lmem[2]);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, vmem);
+    deallocData(DataSpace::CudaPinned, vmem_init);
+
+  } else {
+     getCout() << "\n  REDUCE3_INT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void REDUCE3_INT::runCudaVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  REDUCE3_INT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (reduce3int_partial<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("reduce3int_partial",
+        (reduce3int_partial<block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Int_ptr vmem;
+    allocData(DataSpace::CudaDevice, vmem, 3);
+
+    Int_ptr vpartial;
+    allocData(DataSpace::CudaDevice, vpartial, 3*grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      reduce3int_partial<block_size><<<grid_size, block_size,
+                               shmem, res.get_stream()>>>(vec, vpartial, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      reduce3int_final<block_size><<<1, block_size,
+                               shmem, res.get_stream()>>>(vpartial, grid_size,
+                                                    vmem,
+                                                    m_vsum_init,
+                                                    m_vmin_init,
+                                                    m_vmax_init );
+      cudaErrchk( cudaGetLastError() );
+
+      Int_type lmem[3];
+      cudaErrchk( cudaMemcpyAsync( &lmem[0], vmem, 3*sizeof(Int_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_vsum += lmem[0];
+      m_vmin = RAJA_MIN(m_vmin, lmem[1]);
+      m_vmax = RAJA_MAX(m_vmax, lmem[2]);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, vpartial);
+    deallocData(DataSpace::CudaDevice, vmem);
+
+  } else {
+     getCout() << "\n  REDUCE3_INT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
 void REDUCE3_INT::runCudaVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -264,10 +535,63 @@ void REDUCE3_INT::runCudaVariant(VariantID vid, size_t tune_idx)
 
         t += 1;
 
+        if ( vid == RAJA_CUDA ) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantExpt<RAJA::cuda_exec<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantExpt<RAJA::cuda_exec_occ_calc<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantWarpAtomic<block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantTwoPass<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
   } else {
 
     getCout() << "\n  REDUCE3_INT : Unknown Cuda variant id = " << vid << std::endl;
@@ -289,10 +613,35 @@ void REDUCE3_INT::setCudaTuningDefinitions(VariantID vid)
 
         addVariantTuningName(vid, "occgs_"+std::to_string(block_size));
 
+        if ( vid == RAJA_CUDA ) {
+
+          addVariantTuningName(vid, "expt_block_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "expt_occgs_"+std::to_string(block_size));
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, "warp_atomic_"+std::to_string(block_size));
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
   }
 }
 
@@ -73,6 +73,109 @@ __global__ void reduce3int(Int_ptr vec,
 #endif
 }
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce3int_warp_atomic(Int_ptr vec,
+                                       Int_ptr vsum_out,
+                                       Int_ptr vmin_out,
+                                       Int_ptr vmax_out,
+                                       Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Int_type>;
+  using min_op = RAJA::operators::minimum<Int_type>;
+  using max_op = RAJA::operators::maximum<Int_type>;
+
+  Int_type vsum = sum_op::identity();
+  Int_type vmin = min_op::identity();
+  Int_type vmax = max_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE3_INT_BODY;
+  }
+
+  vsum = hip_block_reduce<block_size, sum_op>(vsum);
+  vmin = hip_block_reduce<block_size, min_op>(vmin);
+  vmax = hip_block_reduce<block_size, max_op>(vmax);
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd<RAJA::hip_atomic>( vsum_out, vsum );
+    RAJA::atomicMin<RAJA::hip_atomic>( vmin_out, vmin );
+    RAJA::atomicMax<RAJA::hip_atomic>( vmax_out, vmax );
+  }
+}
+
+//
+// First pass of the two pass reduction, each block writes its results to
+// vpartial[blockIdx.x + {0, 1, 2}*gridDim.x].
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce3int_partial(Int_ptr vec,
+                                   Int_ptr vpartial,
+                                   Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Int_type>;
+  using min_op = RAJA::operators::minimum<Int_type>;
+  using max_op = RAJA::operators::maximum<Int_type>;
+
+  Int_type vsum = sum_op::identity();
+  Int_type vmin = min_op::identity();
+  Int_type vmax = max_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    REDUCE3_INT_BODY;
+  }
+
+  vsum = hip_block_reduce<block_size, sum_op>(vsum);
+  vmin = hip_block_reduce<block_size, min_op>(vmin);
+  vmax = hip_block_reduce<block_size, max_op>(vmax);
+
+  if ( threadIdx.x == 0 ) {
+    vpartial[ blockIdx.x + 0 * gridDim.x ] = vsum;
+    vpartial[ blockIdx.x + 1 * gridDim.x ] = vmin;
+    vpartial[ blockIdx.x + 2 * gridDim.x ] = vmax;
+  }
+}
+
+//
+// Second pass of the two pass reduction, a single block combines the
+// num_partial results of each reduction with the initial values.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce3int_final(Int_ptr vpartial, Index_type num_partial,
+                                 Int_ptr vmem,
+                                 Int_type vsum_init,
+                                 Int_type vmin_init,
+                                 Int_type vmax_init)
+{
+  using sum_op = RAJA::operators::plus<Int_type>;
+  using min_op = RAJA::operators::minimum<Int_type>;
+  using max_op = RAJA::operators::maximum<Int_type>;
+
+  Int_type vsum = sum_op::identity();
+  Int_type vmin = min_op::identity();
+  Int_type vmax = max_op::identity();
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    vsum += vpartial[ i + 0 * num_partial ];
+    vmin = RAJA_MIN( vmin, vpartial[ i + 1 * num_partial ] );
+    vmax = RAJA_MAX( vmax, vpartial[ i + 2 * num_partial ] );
+  }
+
+  vsum = hip_block_reduce<block_size, sum_op>(vsum);
+  vmin = hip_block_reduce<block_size, min_op>(vmin);
+  vmax = hip_block_reduce<block_size, max_op>(vmax);
+
+  if ( threadIdx.x == 0 ) {
+    vmem[0] = vsum_init + vsum;
+    vmem[1] = RAJA_MIN( vmin_init, vmin );
+    vmem[2] = RAJA_MAX( vmax_init, vmax );
+  }
+}
+
 
 
 template < size_t block_size >
@@ -175,6 +278,8 @@ void REDUCE3_INT::runHipVariantOccGS(VariantID vid)
     constexpr size_t shmem = 3*sizeof(Int_type)*block_size;
     const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
         (reduce3int<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce3int",
+        (reduce3int<block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -236,6 +341,168 @@ void REDUCE3_INT::runHipVariantOccGS(VariantID vid)
   }
 }
 
+template < typename exec_policy >
+void REDUCE3_INT::runHipVariantExpt(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE3_INT_DATA_SETUP;
+
+  if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Int_type tvsum = m_vsum_init;
+      Int_type tvmin = m_vmin_init;
+      Int_type tvmax = m_vmax_init;
+
+      RAJA::forall< exec_policy >( res,
+        RAJA::RangeSegment(ibegin, iend),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&tvsum),
+        RAJA::expt::Reduce<RAJA::operators::minimum>(&tvmin),
+        RAJA::expt::Reduce<RAJA::operators::maximum>(&tvmax),
+        [=] __device__ (Index_type i,
+                        Int_type& vsum, Int_type& vmin, Int_type& vmax) {
+          REDUCE3_INT_BODY;
+        }
+      );
+
+      m_vsum += static_cast<Int_type>(tvsum);
+      m_vmin = RAJA_MIN(m_vmin, static_cast<Int_type>(tvmin));
+      m_vmax = RAJA_MAX(m_vmax, static_cast<Int_type>(tvmax));
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  REDUCE3_INT : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void REDUCE3_INT::runHipVariantWarpAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE3_INT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    Int_ptr vmem_init;
+    allocData(DataSpace::HipPinned, vmem_init, 3);
+
+    Int_ptr vmem;
+    allocData(DataSpace::HipDevice, vmem, 3);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (reduce3int_warp_atomic<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce3int_warp_atomic",
+        (reduce3int_warp_atomic<block_size>), block_size, shmem) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      vmem_init[0] = m_vsum_init;
+      vmem_init[1] = m_vmin_init;
+      vmem_init[2] = m_vmax_init;
+      hipErrchk( hipMemcpyAsync( vmem, vmem_init, 3*sizeof(Int_type),
+                                 hipMemcpyHostToDevice, res.get_stream() ) );
+
+      const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+      hipLaunchKernelGGL( (reduce3int_warp_atomic<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          vec, vmem + 0, vmem + 1, vmem + 2, iend );
+      hipErrchk( hipGetLastError() );
+
+      Int_type lmem[3];
+      hipErrchk( hipMemcpyAsync( &lmem[0], vmem, 3*sizeof(Int_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_vsum += lmem[0];
+      m_vmin = RAJA_MIN(m_vmin, lmem[1]);
+      m_vmax = RAJA_MAX(m_vmax, lmem[2]);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, vmem);
+    deallocData(DataSpace::HipPinned, vmem_init);
+
+  } else {
+     getCout() << "\n  REDUCE3_INT : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void REDUCE3_INT::runHipVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE3_INT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (reduce3int_partial<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce3int_partial",
+        (reduce3int_partial<block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Int_ptr vmem;
+    allocData(DataSpace::HipDevice, vmem, 3);
+
+    Int_ptr vpartial;
+    allocData(DataSpace::HipDevice, vpartial, 3*grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL( (reduce3int_partial<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          vec, vpartial, iend );
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL( (reduce3int_final<block_size>), dim3(1), dim3(block_size),
+                          shmem, res.get_stream(),
+                          vpartial, grid_size, vmem,
+                          m_vsum_init, m_vmin_init, m_vmax_init );
+      hipErrchk( hipGetLastError() );
+
+      Int_type lmem[3];
+      hipErrchk( hipMemcpyAsync( &lmem[0], vmem, 3*sizeof(Int_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_vsum += lmem[0];
+      m_vmin = RAJA_MIN(m_vmin, lmem[1]);
+      m_vmax = RAJA_MAX(m_vmax, lmem[2]);
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, vpartial);
+    deallocData(DataSpace::HipDevice, vmem);
+
+  } else {
+     getCout() << "\n  REDUCE3_INT : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
 void REDUCE3_INT::runHipVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -265,10 +532,63 @@ void REDUCE3_INT::runHipVariant(VariantID vid, size_t tune_idx)
 
         t += 1;
 
+        if ( vid == RAJA_HIP ) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantExpt<RAJA::hip_exec<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantExpt<RAJA::hip_exec_occ_calc<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantWarpAtomic<block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantTwoPass<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
   } else {
 
     getCout() << "\n  REDUCE3_INT : Unknown Hip variant id = " << vid << std::endl;
@@ -290,12 +610,36 @@ void REDUCE3_INT::setHipTuningDefinitions(VariantID vid)
 
         addVariantTuningName(vid, "occgs_"+std::to_string(block_size));
 
+        if ( vid == RAJA_HIP ) {
+
+          addVariantTuningName(vid, "expt_block_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "expt_occgs_"+std::to_string(block_size));
+
+        }
+
       }
 
     });
 
-  }
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, "warp_atomic_"+std::to_string(block_size));
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+        }
+
+      });
 
+    }
+
+  }
 }
 
 } // end namespace basic
@@ -30,6 +30,8 @@ namespace basic
 void REDUCE3_INT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -44,13 +46,24 @@ void REDUCE3_INT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
       Int_type vmin = m_vmin_init;
       Int_type vmax = m_vmax_init;
 
-      #pragma omp target is_device_ptr(vec) device( did ) map(tofrom:vsum, vmin, vmax)
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static,1) \
-                               reduction(+:vsum) \
-                               reduction(min:vmin) \
-                               reduction(max:vmax)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        REDUCE3_INT_BODY;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(vec) device( did ) map(tofrom:vsum, vmin, vmax)
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static,1) \
+                                 reduction(+:vsum) \
+                                 reduction(min:vmin) \
+                                 reduction(max:vmax)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          REDUCE3_INT_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(vec) device( did ) map(tofrom:vsum, vmin, vmax)
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static,1) \
+                                 reduction(+:vsum) \
+                                 reduction(min:vmin) \
+                                 reduction(max:vmax)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          REDUCE3_INT_BODY;
+        }
       }
 
       m_vsum += vsum;
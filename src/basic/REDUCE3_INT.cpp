@@ -40,6 +40,8 @@ REDUCE3_INT::REDUCE3_INT(const RunParams& params)
   setUsesFeature(Forall);
   setUsesFeature(Reduction);
 
+  setHasPattern(ReductionBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -48,6 +50,8 @@ REDUCE3_INT::REDUCE3_INT(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
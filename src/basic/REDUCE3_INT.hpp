@@ -82,10 +82,25 @@ public:
   void runHipVariantBlock(VariantID vid);
   template < size_t block_size >
   void runHipVariantOccGS(VariantID vid);
+  template < typename exec_policy >
+  void runCudaVariantExpt(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpAtomic(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantTwoPass(VariantID vid);
+  template < typename exec_policy >
+  void runHipVariantExpt(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpAtomic(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantTwoPass(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  // warp shuffle tunings need whole warps on every gpu backend
+  using gpu_warp_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<64>>;
 
   Int_ptr m_vec;
   Int_type m_vsum;
@@ -97,6 +97,151 @@ __global__ void reduce_struct(Real_ptr x, Real_ptr y,
   }
 }
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_struct_warp_atomic(Real_ptr x, Real_ptr y,
+                              Real_ptr xsum_out, Real_ptr xmin_out, Real_ptr xmax_out,
+                              Real_ptr ysum_out, Real_ptr ymin_out, Real_ptr ymax_out,
+                              Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+  using min_op = RAJA::operators::minimum<Real_type>;
+  using max_op = RAJA::operators::maximum<Real_type>;
+
+  Real_type xsum = sum_op::identity();
+  Real_type xmin = min_op::identity();
+  Real_type xmax = max_op::identity();
+  Real_type ysum = sum_op::identity();
+  Real_type ymin = min_op::identity();
+  Real_type ymax = max_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    xsum += x[ i ];
+    xmin = RAJA_MIN( xmin, x[ i ] );
+    xmax = RAJA_MAX( xmax, x[ i ] );
+    ysum += y[ i ];
+    ymin = RAJA_MIN( ymin, y[ i ] );
+    ymax = RAJA_MAX( ymax, y[ i ] );
+  }
+
+  xsum = hip_block_reduce<block_size, sum_op>(xsum);
+  xmin = hip_block_reduce<block_size, min_op>(xmin);
+  xmax = hip_block_reduce<block_size, max_op>(xmax);
+  ysum = hip_block_reduce<block_size, sum_op>(ysum);
+  ymin = hip_block_reduce<block_size, min_op>(ymin);
+  ymax = hip_block_reduce<block_size, max_op>(ymax);
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd<RAJA::hip_atomic>( xsum_out, xsum );
+    RAJA::atomicMin<RAJA::hip_atomic>( xmin_out, xmin );
+    RAJA::atomicMax<RAJA::hip_atomic>( xmax_out, xmax );
+
+    RAJA::atomicAdd<RAJA::hip_atomic>( ysum_out, ysum );
+    RAJA::atomicMin<RAJA::hip_atomic>( ymin_out, ymin );
+    RAJA::atomicMax<RAJA::hip_atomic>( ymax_out, ymax );
+  }
+}
+
+//
+// First pass of the two pass reduction, each block writes its results to
+// partial[blockIdx.x + {0, ..., 5}*gridDim.x] in the order
+// xsum, xmin, xmax, ysum, ymin, ymax.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_struct_partial(Real_ptr x, Real_ptr y,
+                                      Real_ptr partial,
+                                      Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+  using min_op = RAJA::operators::minimum<Real_type>;
+  using max_op = RAJA::operators::maximum<Real_type>;
+
+  Real_type xsum = sum_op::identity();
+  Real_type xmin = min_op::identity();
+  Real_type xmax = max_op::identity();
+  Real_type ysum = sum_op::identity();
+  Real_type ymin = min_op::identity();
+  Real_type ymax = max_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    xsum += x[ i ];
+    xmin = RAJA_MIN( xmin, x[ i ] );
+    xmax = RAJA_MAX( xmax, x[ i ] );
+    ysum += y[ i ];
+    ymin = RAJA_MIN( ymin, y[ i ] );
+    ymax = RAJA_MAX( ymax, y[ i ] );
+  }
+
+  xsum = hip_block_reduce<block_size, sum_op>(xsum);
+  xmin = hip_block_reduce<block_size, min_op>(xmin);
+  xmax = hip_block_reduce<block_size, max_op>(xmax);
+  ysum = hip_block_reduce<block_size, sum_op>(ysum);
+  ymin = hip_block_reduce<block_size, min_op>(ymin);
+  ymax = hip_block_reduce<block_size, max_op>(ymax);
+
+  if ( threadIdx.x == 0 ) {
+    partial[ blockIdx.x + 0 * gridDim.x ] = xsum;
+    partial[ blockIdx.x + 1 * gridDim.x ] = xmin;
+    partial[ blockIdx.x + 2 * gridDim.x ] = xmax;
+    partial[ blockIdx.x + 3 * gridDim.x ] = ysum;
+    partial[ blockIdx.x + 4 * gridDim.x ] = ymin;
+    partial[ blockIdx.x + 5 * gridDim.x ] = ymax;
+  }
+}
+
+//
+// Second pass of the two pass reduction, a single block combines the
+// num_partial results of each reduction with the initial values.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void reduce_struct_final(Real_ptr partial, Index_type num_partial,
+                                    Real_ptr mem,
+                                    Real_type init_sum,
+                                    Real_type init_min,
+                                    Real_type init_max)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+  using min_op = RAJA::operators::minimum<Real_type>;
+  using max_op = RAJA::operators::maximum<Real_type>;
+
+  Real_type xsum = sum_op::identity();
+  Real_type xmin = min_op::identity();
+  Real_type xmax = max_op::identity();
+  Real_type ysum = sum_op::identity();
+  Real_type ymin = min_op::identity();
+  Real_type ymax = max_op::identity();
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    xsum += partial[ i + 0 * num_partial ];
+    xmin = RAJA_MIN( xmin, partial[ i + 1 * num_partial ] );
+    xmax = RAJA_MAX( xmax, partial[ i + 2 * num_partial ] );
+    ysum += partial[ i + 3 * num_partial ];
+    ymin = RAJA_MIN( ymin, partial[ i + 4 * num_partial ] );
+    ymax = RAJA_MAX( ymax, partial[ i + 5 * num_partial ] );
+  }
+
+  xsum = hip_block_reduce<block_size, sum_op>(xsum);
+  xmin = hip_block_reduce<block_size, min_op>(xmin);
+  xmax = hip_block_reduce<block_size, max_op>(xmax);
+  ysum = hip_block_reduce<block_size, sum_op>(ysum);
+  ymin = hip_block_reduce<block_size, min_op>(ymin);
+  ymax = hip_block_reduce<block_size, max_op>(ymax);
+
+  if ( threadIdx.x == 0 ) {
+    mem[0] = init_sum + xsum;
+    mem[1] = RAJA_MIN( init_min, xmin );
+    mem[2] = RAJA_MAX( init_max, xmax );
+    mem[3] = init_sum + ysum;
+    mem[4] = RAJA_MIN( init_min, ymin );
+    mem[5] = RAJA_MAX( init_max, ymax );
+  }
+}
+
+
 
 template < size_t block_size >
 void REDUCE_STRUCT::runHipVariantBlock(VariantID vid)
@@ -201,6 +346,8 @@ void REDUCE_STRUCT::runHipVariantOccGS(VariantID vid)
     constexpr size_t shmem = 6*sizeof(Real_type)*block_size;
     const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
         (reduce_struct<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce_struct",
+        (reduce_struct<block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -270,6 +417,195 @@ void REDUCE_STRUCT::runHipVariantOccGS(VariantID vid)
 
 }
 
+template < typename exec_policy >
+void REDUCE_STRUCT::runHipVariantExpt(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_type txsum = m_init_sum;
+      Real_type txmin = m_init_min;
+      Real_type txmax = m_init_max;
+      Real_type tysum = m_init_sum;
+      Real_type tymin = m_init_min;
+      Real_type tymax = m_init_max;
+
+      RAJA::forall< exec_policy >( res,
+        RAJA::RangeSegment(ibegin, iend),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&txsum),
+        RAJA::expt::Reduce<RAJA::operators::minimum>(&txmin),
+        RAJA::expt::Reduce<RAJA::operators::maximum>(&txmax),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&tysum),
+        RAJA::expt::Reduce<RAJA::operators::minimum>(&tymin),
+        RAJA::expt::Reduce<RAJA::operators::maximum>(&tymax),
+        [=] __device__ (Index_type i,
+                        Real_type& xsum, Real_type& xmin, Real_type& xmax,
+                        Real_type& ysum, Real_type& ymin, Real_type& ymax) {
+          REDUCE_STRUCT_BODY;
+        }
+      );
+
+      points.SetCenter(txsum/(points.N), tysum/(points.N));
+      points.SetXMin(txmin);
+      points.SetXMax(txmax);
+      points.SetYMin(tymin);
+      points.SetYMax(tymax);
+      m_points=points;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  REDUCE_STRUCT : Unknown Hip variant id = " << vid << std::endl;
+  }
+
+}
+
+template < size_t block_size >
+void REDUCE_STRUCT::runHipVariantWarpAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    Real_ptr mem_init; //xcenter,xmin,xmax,ycenter,ymin,ymax
+    allocData(DataSpace::HipPinned, mem_init, 6);
+
+    Real_ptr mem;
+    allocData(DataSpace::HipDevice, mem, 6);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (reduce_struct_warp_atomic<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce_struct_warp_atomic",
+        (reduce_struct_warp_atomic<block_size>), block_size, shmem) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      mem_init[0] = m_init_sum;
+      mem_init[1] = m_init_min;
+      mem_init[2] = m_init_max;
+      mem_init[3] = m_init_sum;
+      mem_init[4] = m_init_min;
+      mem_init[5] = m_init_max;
+      hipErrchk( hipMemcpyAsync( mem, mem_init, 6*sizeof(Real_type),
+                                 hipMemcpyHostToDevice, res.get_stream() ) );
+
+      const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+      hipLaunchKernelGGL( (reduce_struct_warp_atomic<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          points.x, points.y,
+                          mem, mem+1, mem+2,    // xcenter,xmin,xmax
+                          mem+3, mem+4, mem+5,  // ycenter,ymin,ymax
+                          points.N );
+      hipErrchk( hipGetLastError() );
+
+      Real_type lmem[6]={0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+      hipErrchk( hipMemcpyAsync( &lmem[0], mem, 6*sizeof(Real_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+
+      points.SetCenter(lmem[0]/points.N, lmem[3]/points.N);
+      points.SetXMin(lmem[1]);
+      points.SetXMax(lmem[2]);
+      points.SetYMin(lmem[4]);
+      points.SetYMax(lmem[5]);
+      m_points=points;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, mem);
+    deallocData(DataSpace::HipPinned, mem_init);
+
+  } else {
+     getCout() << "\n  REDUCE_STRUCT : Unknown Hip variant id = " << vid << std::endl;
+  }
+
+}
+
+template < size_t block_size >
+void REDUCE_STRUCT::runHipVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (reduce_struct_partial<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("reduce_struct_partial",
+        (reduce_struct_partial<block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Real_ptr mem; //xcenter,xmin,xmax,ycenter,ymin,ymax
+    allocData(DataSpace::HipDevice, mem, 6);
+
+    Real_ptr partial;
+    allocData(DataSpace::HipDevice, partial, 6*grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL( (reduce_struct_partial<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          points.x, points.y, partial, points.N );
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL( (reduce_struct_final<block_size>), dim3(1), dim3(block_size),
+                          shmem, res.get_stream(),
+                          partial, grid_size, mem,
+                          m_init_sum, m_init_min, m_init_max );
+      hipErrchk( hipGetLastError() );
+
+      Real_type lmem[6]={0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+      hipErrchk( hipMemcpyAsync( &lmem[0], mem, 6*sizeof(Real_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+
+      points.SetCenter(lmem[0]/points.N, lmem[3]/points.N);
+      points.SetXMin(lmem[1]);
+      points.SetXMax(lmem[2]);
+      points.SetYMin(lmem[4]);
+      points.SetYMax(lmem[5]);
+      m_points=points;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, partial);
+    deallocData(DataSpace::HipDevice, mem);
+
+  } else {
+     getCout() << "\n  REDUCE_STRUCT : Unknown Hip variant id = " << vid << std::endl;
+  }
+
+}
+
 void REDUCE_STRUCT::runHipVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -299,10 +635,63 @@ void REDUCE_STRUCT::runHipVariant(VariantID vid, size_t tune_idx)
 
         t += 1;
 
+        if ( vid == RAJA_HIP ) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantExpt<RAJA::hip_exec<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantExpt<RAJA::hip_exec_occ_calc<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantWarpAtomic<block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantTwoPass<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
   } else {
 
     getCout() << "\n  REDUCE_STRUCT : Unknown Hip variant id = " << vid << std::endl;
@@ -324,12 +713,36 @@ void REDUCE_STRUCT::setHipTuningDefinitions(VariantID vid)
 
         addVariantTuningName(vid, "occgs_"+std::to_string(block_size));
 
+        if ( vid == RAJA_HIP ) {
+
+          addVariantTuningName(vid, "expt_block_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "expt_occgs_"+std::to_string(block_size));
+
+        }
+
       }
 
     });
 
-  }
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, "warp_atomic_"+std::to_string(block_size));
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+        }
+
+      });
 
+    }
+
+  }
 }
 
 } // end namespace basic
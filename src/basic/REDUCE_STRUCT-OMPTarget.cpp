@@ -31,6 +31,8 @@ void REDUCE_STRUCT::runOpenMPTargetVariant(VariantID vid,
                                            size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -48,21 +50,40 @@ void REDUCE_STRUCT::runOpenMPTargetVariant(VariantID vid,
       Real_type xmin = m_init_min; Real_type ymin = m_init_min;
       Real_type xmax = m_init_max; Real_type ymax = m_init_max;
 
-      #pragma omp target is_device_ptr(xa, ya) device( did ) map(tofrom:xsum, xmin, xmax, ysum, ymin, ymax)
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static,1) \
-                               reduction(+:xsum) \
-                               reduction(min:xmin) \
-                               reduction(max:xmax), \
-                               reduction(+:ysum), \
-                               reduction(min:ymin), \
-                               reduction(max:ymax)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        xsum += xa[i] ;
-        xmin = RAJA_MIN(xmin, xa[i]) ;
-        xmax = RAJA_MAX(xmax, xa[i]) ;
-        ysum += ya[i] ;
-        ymin = RAJA_MIN(ymin, ya[i]) ;
-        ymax = RAJA_MAX(ymax, ya[i]) ;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(xa, ya) device( did ) map(tofrom:xsum, xmin, xmax, ysum, ymin, ymax)
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static,1) \
+                                 reduction(+:xsum) \
+                                 reduction(min:xmin) \
+                                 reduction(max:xmax), \
+                                 reduction(+:ysum), \
+                                 reduction(min:ymin), \
+                                 reduction(max:ymax)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          xsum += xa[i] ;
+          xmin = RAJA_MIN(xmin, xa[i]) ;
+          xmax = RAJA_MAX(xmax, xa[i]) ;
+          ysum += ya[i] ;
+          ymin = RAJA_MIN(ymin, ya[i]) ;
+          ymax = RAJA_MAX(ymax, ya[i]) ;
+        }
+      } else {
+        #pragma omp target is_device_ptr(xa, ya) device( did ) map(tofrom:xsum, xmin, xmax, ysum, ymin, ymax)
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static,1) \
+                                 reduction(+:xsum) \
+                                 reduction(min:xmin) \
+                                 reduction(max:xmax), \
+                                 reduction(+:ysum), \
+                                 reduction(min:ymin), \
+                                 reduction(max:ymax)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          xsum += xa[i] ;
+          xmin = RAJA_MIN(xmin, xa[i]) ;
+          xmax = RAJA_MAX(xmax, xa[i]) ;
+          ysum += ya[i] ;
+          ymin = RAJA_MIN(ymin, ya[i]) ;
+          ymax = RAJA_MAX(ymax, ya[i]) ;
+        }
       }
 
       points.SetCenter(xsum/points.N, ysum/points.N);
@@ -97,6 +97,18 @@ public:
   void runHipVariantBlock(VariantID vid);
   template < size_t block_size >
   void runHipVariantOccGS(VariantID vid);
+  template < typename exec_policy >
+  void runCudaVariantExpt(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpAtomic(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantTwoPass(VariantID vid);
+  template < typename exec_policy >
+  void runHipVariantExpt(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpAtomic(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantTwoPass(VariantID vid);
 
   struct PointsType {
     Int_type N;
@@ -123,6 +135,9 @@ public:
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  // warp shuffle tunings need whole warps on every gpu backend
+  using gpu_warp_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<64>>;
   Real_ptr m_x; Real_ptr m_y;
   Real_type	m_init_sum; 
   Real_type	m_init_min; 
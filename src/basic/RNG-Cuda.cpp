@@ -0,0 +1,199 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RNG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+template < size_t block_size, bool philox, bool normal >
+__launch_bounds__(block_size)
+__global__ void rng_store(Real_ptr out, unsigned long long seed,
+                          Index_type num_outputs)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < num_outputs) {
+     RNG_STORE_BODY;
+   }
+}
+
+template < size_t block_size, bool philox, bool normal >
+__launch_bounds__(block_size)
+__global__ void rng_register(Real_ptr out, unsigned long long seed,
+                             Index_type batch, Index_type num_outputs)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < num_outputs) {
+     RNG_REGISTER_BODY;
+   }
+}
+
+
+template < size_t block_size, size_t gen, bool launch >
+void RNG::runCudaVariantImpl(VariantID vid)
+{
+  constexpr bool philox = getPhilox<gen>();
+  constexpr bool normal = getNormal<gen>();
+  constexpr bool reg = getRegister<gen>();
+
+  const Index_type run_reps = getRunReps();
+  const Index_type num_outputs = getNumOutputs(reg);
+
+  auto res{getCudaResource()};
+
+  RNG_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(num_outputs, block_size);
+      constexpr size_t shmem = 0;
+
+      if (reg) {
+        rng_register<block_size, philox, normal><<<grid_size, block_size, shmem, res.get_stream()>>>(
+            out, seed, batch, num_outputs );
+        cudaErrchk( cudaGetLastError() );
+      } else {
+        rng_store<block_size, philox, normal><<<grid_size, block_size, shmem, res.get_stream()>>>(
+            out, seed, num_outputs );
+        cudaErrchk( cudaGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if (reg) {
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, num_outputs), [=] __device__ (Index_type i) {
+          RNG_REGISTER_BODY;
+        });
+      } else {
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(0, num_outputs), [=] __device__ (Index_type i) {
+          RNG_STORE_BODY;
+        });
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  RNG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+
+void RNG::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    seq_for(gen_tunings_type{}, [&](auto gen) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantImpl<block_size, decltype(gen)::value>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    });
+
+  } else {
+
+    getCout() << "\n  RNG : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runCudaVariantImpl<block_size, 0, true>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+}
+
+void RNG::setCudaTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    for (const std::string& name : getGenTuningNames()) {
+
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addVariantTuningName(vid, name+"_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RNG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < size_t gen >
+void RNG::runSeqVariantImpl(VariantID vid)
+{
+  constexpr bool philox = getPhilox<gen>();
+  constexpr bool normal = getNormal<gen>();
+  constexpr bool reg = getRegister<gen>();
+
+  const Index_type run_reps = getRunReps();
+  const Index_type num_outputs = getNumOutputs(reg);
+
+  RNG_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (reg) {
+          for (Index_type i = 0; i < num_outputs; ++i ) {
+            RNG_REGISTER_BODY;
+          }
+        } else {
+          for (Index_type i = 0; i < num_outputs; ++i ) {
+            RNG_STORE_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (reg) {
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, num_outputs), [=](Index_type i) {
+            RNG_REGISTER_BODY;
+          });
+        } else {
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(0, num_outputs), [=](Index_type i) {
+            RNG_STORE_BODY;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  RNG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void RNG::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(gen_tunings_type{}, [&](auto gen) {
+    if (tune_idx == gen) {
+      runSeqVariantImpl<gen>(vid);
+    }
+  });
+}
+
+void RNG::setSeqTuningDefinitions(VariantID vid)
+{
+  for (const std::string& name : getGenTuningNames()) {
+    addVariantTuningName(vid, name);
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
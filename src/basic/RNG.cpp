@@ -0,0 +1,178 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RNG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+RNG::RNG(const RunParams& params)
+  : KernelBase(rajaperf::Basic_RNG, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_batch = getKernelParam("batch", 16, 1,
+                           std::numeric_limits<Index_type>::max() / 2);
+  m_seed = rng_seed;
+
+  // whole batches of variates so all tunings generate the same variates
+  const Index_type batch_len = 2*m_batch;
+  setActualProblemSize(
+      std::max(Index_type(1), RAJA_DIVIDE_CEILING_INT(getTargetProblemSize(), batch_len)) *
+      batch_len );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  setFLOPsPerRep( getFLOPsPerRep(Base_Seq, 0) );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+RNG::~RNG()
+{
+}
+
+const std::vector<std::string>& RNG::getGenTuningNames()
+{
+  static const std::vector<std::string> names{
+      "philox_uniform_store", "philox_uniform_register",
+      "philox_normal_store", "philox_normal_register",
+      "threefry_uniform_store", "threefry_uniform_register",
+      "threefry_normal_store", "threefry_normal_register"};
+  return names;
+}
+
+//
+// Tunings before setting up the kernel tunings, ie. in the constructor, are
+// philox_uniform_store.
+//
+size_t RNG::getGenTuning(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx < getNumVariantTunings(vid)) {
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+    const std::vector<std::string>& names = getGenTuningNames();
+    for (size_t g = 0; g < names.size(); ++g) {
+      if (tuning_name.compare(0, names[g].size(), names[g]) == 0) {
+        return g;
+      }
+    }
+  }
+  return 0;
+}
+
+//
+// Generator outputs for the store tunings, sums for the register tunings.
+//
+Index_type RNG::getNumOutputs(bool reg) const
+{
+  return reg ? getActualProblemSize() / (2*m_batch)
+             : getActualProblemSize() / 2;
+}
+
+Index_type RNG::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const bool reg = (getGenTuning(vid, tune_idx) % 2) == 1;
+
+  return reg ? (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getNumOutputs(reg)
+             : (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getActualProblemSize();
+}
+
+//
+// The conversion of each variate to floating point, the Box-Muller
+// transform of each pair counted as 6 operations, and the sum of each
+// variate in register tunings. The integer operations of the generators
+// are not counted.
+//
+Index_type RNG::getFLOPsPerRep(VariantID vid, size_t tune_idx) const
+{
+  const size_t gen = getGenTuning(vid, tune_idx);
+  const bool normal = ((gen / 2) % 2) == 1;
+  const bool reg = (gen % 2) == 1;
+
+  return (2 + (normal ? 3 : 0) + (reg ? 1 : 0)) * getActualProblemSize();
+}
+
+void RNG::setUp(VariantID vid, size_t tune_idx)
+{
+  const bool reg = (getGenTuning(vid, tune_idx) % 2) == 1;
+
+  const Index_type len = reg ? getNumOutputs(reg) : getActualProblemSize();
+  allocAndInitDataConst(m_out, len, 0.0, vid);
+}
+
+void RNG::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const bool reg = (getGenTuning(vid, tune_idx) % 2) == 1;
+  const Index_type nsums = getNumOutputs(true);
+
+  if (reg) {
+
+    checksum[vid][tune_idx] += calcChecksum(m_out, nsums, checksum_scale_factor , vid);
+
+  } else {
+
+    // sum the stored variates of each batch in the order of the register
+    // tunings so uses of a generator give the same checksum
+    const Index_type len = getActualProblemSize();
+    auto reset_out = scopedMoveData(m_out, len, vid);
+
+    std::vector<Real_type> sums(nsums);
+    for (Index_type i = 0; i < nsums; ++i) {
+      Real_type sum = 0.0;
+      for (Index_type b = 0; b < 2*m_batch; ++b) {
+        sum += m_out[i*2*m_batch + b];
+      }
+      sums[i] = sum;
+    }
+    checksum[vid][tune_idx] += detail::calcChecksum(sums.data(), nsums,
+                                                    checksum_scale_factor);
+
+  }
+}
+
+void RNG::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+
+  deallocData(m_out, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// RNG kernel reference implementation:
+///
+/// Counter based random number generation, with each 128 bit generator
+/// output giving two variates.
+///
+/// for (Index_type i = 0; i < len/2; ++i ) {
+///   Uint4x32 r = philox4x32_10(i, seed);
+///   Real_type v0 = uniform(r.v[0], r.v[1]);
+///   Real_type v1 = uniform(r.v[2], r.v[3]);
+///   boxMuller(v0, v1);  // normal tunings only
+///   out[2*i] = v0;
+///   out[2*i+1] = v1;
+/// }
+///
+/// Tunings are a generator, a distribution, and a use of the variates, ie.
+/// threefry_normal_register. Generators are philox, Philox4x32-10, and
+/// threefry, Threefry4x32-20, distributions are uniform in (0, 1) and
+/// standard normal, and uses are
+///
+///   store    -- the variates are stored to memory as above
+///   register -- each iterate sums the variates of batch generator outputs
+///               in registers and stores the sum, as do Monte Carlo codes
+///               that use the variates where they are generated
+///
+/// Uses of a generator and a distribution give the same checksum, of the
+/// sums of each batch.
+///
+/// The generator outputs per sum are a kernel parameter, given with
+/// '--kernel-param RNG:batch=<n>'.
+///
+
+#ifndef RAJAPerf_Basic_RNG_HPP
+#define RAJAPerf_Basic_RNG_HPP
+
+#define RNG_DATA_SETUP \
+  Real_ptr out = m_out; \
+  const Index_type batch = m_batch; \
+  const unsigned long long seed = m_seed;
+
+//
+// The two variates v0, v1 of generator output j.
+//
+#define RNG_VARIATES(j) \
+  const rng::Uint4x32 r = philox ? rng::philox((j), seed) \
+                                 : rng::threefry((j), seed); \
+  Real_type v0 = rng::uniform(r.v[0], r.v[1]); \
+  Real_type v1 = rng::uniform(r.v[2], r.v[3]); \
+  if (normal) { \
+    rng::boxMuller(v0, v1); \
+  }
+
+#define RNG_STORE_BODY \
+  RNG_VARIATES(i) \
+  out[2*i] = v0; \
+  out[2*i+1] = v1;
+
+#define RNG_REGISTER_BODY \
+  Real_type sum = 0.0; \
+  for (Index_type b = 0; b < batch; ++b) { \
+    RNG_VARIATES(i*batch + b) \
+    sum += v0; \
+    sum += v1; \
+  } \
+  out[i] = sum;
+
+
+#include "common/KernelBase.hpp"
+#include "common/RandomUtils.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+constexpr unsigned long long rng_seed = 4099;
+
+class RNG : public KernelBase
+{
+public:
+
+  RNG(const RunParams& params);
+
+  ~RNG();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+  Index_type getFLOPsPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  RNG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t gen >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t gen >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t block_size, size_t gen, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, size_t gen, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  //
+  // Generation tunings are numbered 4*threefry + 2*normal + register, in
+  // the order of getGenTuningNames.
+  //
+  using gen_tunings_type = camp::int_seq<size_t, 0, 1, 2, 3, 4, 5, 6, 7>;
+
+  template < size_t gen >
+  static constexpr bool getPhilox() { return (gen / 4) == 0; }
+  template < size_t gen >
+  static constexpr bool getNormal() { return ((gen / 2) % 2) == 1; }
+  template < size_t gen >
+  static constexpr bool getRegister() { return (gen % 2) == 1; }
+
+  static const std::vector<std::string>& getGenTuningNames();
+  size_t getGenTuning(VariantID vid, size_t tune_idx) const;
+
+  Index_type getNumOutputs(bool reg) const;
+
+  Index_type m_batch;
+  unsigned long long m_seed;
+
+  Real_ptr m_out;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
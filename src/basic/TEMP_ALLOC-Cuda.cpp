@@ -0,0 +1,194 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TEMP_ALLOC.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void temp_alloc1(Real_ptr tmp, Real_ptr x,
+                            Real_type a,
+                            Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     TEMP_ALLOC_BODY1;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void temp_alloc2(Real_ptr y, Real_ptr tmp,
+                            Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     TEMP_ALLOC_BODY2;
+   }
+}
+
+
+template < size_t block_size, bool malloc_async >
+void TEMP_ALLOC::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+  cudaStream_t stream = res.get_stream();
+
+  const DataSpace ds = getDataSpace(vid);
+
+  TEMP_ALLOC_DATA_SETUP;
+
+  //
+  // Allocate the temporary array in the data space of the variant or
+  // stream ordered in the stream of the kernels.
+  //
+  auto alloc_tmp = [&](Real_ptr& tmp) {
+    if (malloc_async) {
+      cudaErrchk( cudaMallocAsync( (void**)&tmp, iend*sizeof(Real_type), stream ) );
+    } else {
+      allocData(ds, tmp, iend);
+    }
+  };
+  auto dealloc_tmp = [&](Real_ptr& tmp) {
+    if (malloc_async) {
+      cudaErrchk( cudaFreeAsync( tmp, stream ) );
+      tmp = nullptr;
+    } else {
+      deallocData(ds, tmp);
+    }
+  };
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_ptr tmp;
+      alloc_tmp(tmp);
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+
+      temp_alloc1<block_size><<<grid_size, block_size, shmem, stream>>>(
+          tmp, x, a, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      temp_alloc2<block_size><<<grid_size, block_size, shmem, stream>>>(
+          y, tmp, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      dealloc_tmp(tmp);
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_ptr tmp;
+      alloc_tmp(tmp);
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        TEMP_ALLOC_BODY1;
+      });
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        TEMP_ALLOC_BODY2;
+      });
+
+      dealloc_tmp(tmp);
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  TEMP_ALLOC : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void TEMP_ALLOC::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantImpl<block_size, false>(vid);
+        }
+        t += 1;
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantImpl<block_size, true>(vid);
+        }
+        t += 1;
+
+      }
+
+    });
+
+  } else {
+
+    getCout() << "\n  TEMP_ALLOC : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+void TEMP_ALLOC::setCudaTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        const std::string block_name = "block_"+std::to_string(block_size);
+
+        addVariantTuningName(vid, block_name);
+        addVariantTuningName(vid, "malloc_async_"+block_name);
+
+      }
+
+    });
+
+  }
+
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
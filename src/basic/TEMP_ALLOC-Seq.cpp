@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TEMP_ALLOC.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void TEMP_ALLOC::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  const DataSpace ds = getDataSpace(vid);
+
+  TEMP_ALLOC_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr tmp;
+        allocData(ds, tmp, iend);
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TEMP_ALLOC_BODY1;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TEMP_ALLOC_BODY2;
+        }
+
+        deallocData(ds, tmp);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr tmp;
+        allocData(ds, tmp, iend);
+
+        auto temp_alloc_lam1 = [=](Index_type i) {
+                                 TEMP_ALLOC_BODY1;
+                               };
+        auto temp_alloc_lam2 = [=](Index_type i) {
+                                 TEMP_ALLOC_BODY2;
+                               };
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          temp_alloc_lam1(i);
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          temp_alloc_lam2(i);
+        }
+
+        deallocData(ds, tmp);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_ptr tmp;
+        allocData(ds, tmp, iend);
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TEMP_ALLOC_BODY1;
+        });
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TEMP_ALLOC_BODY2;
+        });
+
+        deallocData(ds, tmp);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TEMP_ALLOC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TEMP_ALLOC kernel reference implementation:
+///
+/// // Allocate a temporary array in every rep
+/// Real_ptr tmp = alloc(iend);
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   tmp[i] = a * x[i] ;
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   y[i] += tmp[i] ;
+/// }
+///
+/// free(tmp);
+///
+/// The temporary array is allocated and freed inside the timed rep loop, so
+/// the time of the kernel includes the cost of the allocator. The variants
+/// allocate it in the data space of the variant, which can be changed with
+/// the data space options and --data-pool to compare allocators. The GPU
+/// variants also have tunings that allocate it with cudaMallocAsync or
+/// hipMallocAsync in the stream of the kernel (malloc_async_block_<size>).
+///
+
+#ifndef RAJAPerf_Basic_TEMP_ALLOC_HPP
+#define RAJAPerf_Basic_TEMP_ALLOC_HPP
+
+#define TEMP_ALLOC_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_type a = m_a;
+
+#define TEMP_ALLOC_BODY1  \
+  tmp[i] = a * x[i] ;
+
+#define TEMP_ALLOC_BODY2  \
+  y[i] += tmp[i] ;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class TEMP_ALLOC : public KernelBase
+{
+public:
+
+  TEMP_ALLOC(const RunParams& params);
+
+  ~TEMP_ALLOC();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TEMP_ALLOC : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size, bool malloc_async >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, bool malloc_async >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Real_type m_a;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
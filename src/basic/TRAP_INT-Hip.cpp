@@ -38,8 +38,23 @@ Real_type trap_int_func(Real_type x,
    return denom;
 }
 
+//
+// Function used in the fast_math tunings of the TRAP_INT loop.
+//
+RAJA_INLINE
+RAJA_DEVICE
+Real_type trap_int_func_fast_math(Real_type x,
+                                  Real_type y,
+                                  Real_type xp,
+                                  Real_type yp)
+{
+   Real_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
+   denom = fast_math::rsqrt(denom);
+   return denom;
+}
 
-template < size_t block_size >
+
+template < size_t block_size, bool use_fast_math = false >
 __launch_bounds__(block_size)
 __global__ void trapint(Real_type x0, Real_type xp,
                         Real_type y, Real_type yp,
@@ -54,7 +69,8 @@ __global__ void trapint(Real_type x0, Real_type xp,
   psumx[ threadIdx.x ] = 0.0;
   for ( ; i < iend ; i += gridDim.x * block_size ) {
     Real_type x = x0 + i*h;
-    Real_type val = trap_int_func(x, y, xp, yp);
+    Real_type val = use_fast_math ? trap_int_func_fast_math(x, y, xp, yp)
+                                  : trap_int_func(x, y, xp, yp);
     psumx[ threadIdx.x ] += val;
   }
   __syncthreads();
@@ -144,6 +160,52 @@ void TRAP_INT::runHipVariantBlock(VariantID vid)
   }
 }
 
+template < size_t block_size >
+void TRAP_INT::runHipVariantFastMath(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  TRAP_INT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    Real_ptr sumx;
+    allocData(DataSpace::HipDevice, sumx, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemcpyAsync( sumx, &m_sumx_init, sizeof(Real_type),
+                                 hipMemcpyHostToDevice, res.get_stream() ) );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = sizeof(Real_type)*block_size;
+      hipLaunchKernelGGL((trapint<block_size, true>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), x0, xp,
+                                                y, yp,
+                                                h,
+                                                sumx,
+                                                iend);
+      hipErrchk( hipGetLastError() );
+
+      Real_type lsumx;
+      hipErrchk( hipMemcpyAsync( &lsumx, sumx, sizeof(Real_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_sumx += lsumx * h;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, sumx);
+
+  } else {
+     getCout() << "\n  TRAP_INT : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
 template < size_t block_size >
 void TRAP_INT::runHipVariantOccGS(VariantID vid)
 {
@@ -163,6 +225,8 @@ void TRAP_INT::runHipVariantOccGS(VariantID vid)
     constexpr size_t shmem = sizeof(Real_type)*block_size;
     const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
         (trapint<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("trapint",
+        (trapint<block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -246,6 +310,12 @@ void TRAP_INT::runHipVariant(VariantID vid, size_t tune_idx)
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      RAJAPERF_GPU_FAST_MATH_TUNING_RUN(Hip, FastMath)
+
+    }
+
   } else {
 
     getCout() << "\n  TRAP_INT : Unknown Hip variant id = " << vid << std::endl;
@@ -271,6 +341,12 @@ void TRAP_INT::setHipTuningDefinitions(VariantID vid)
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      RAJAPERF_GPU_FAST_MATH_TUNING_NAMES
+
+    }
+
   }
 
 }
@@ -44,6 +44,8 @@ Real_type trap_int_func(Real_type x,
 void TRAP_INT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -58,11 +60,20 @@ void TRAP_INT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
       Real_type sumx = m_sumx_init;
 
-      #pragma omp target teams distribute parallel for map(tofrom: sumx) reduction(+:sumx) \
-                         thread_limit(threads_per_team) schedule(static, 1)
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target teams distribute parallel for map(tofrom: sumx) reduction(+:sumx) \
+                           num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
 
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        TRAP_INT_BODY;
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRAP_INT_BODY;
+        }
+      } else {
+        #pragma omp target teams distribute parallel for map(tofrom: sumx) reduction(+:sumx) \
+                           thread_limit(omp_thread_limit) schedule(static, 1)
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRAP_INT_BODY;
+        }
       }
 
       m_sumx += sumx * h;
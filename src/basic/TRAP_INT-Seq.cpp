@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SimdUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -31,8 +33,22 @@ Real_type trap_int_func(Real_type x,
    return denom;
 }
 
+//
+// Function used in the fast_math tunings of the TRAP_INT loop.
+//
+RAJA_INLINE
+Real_type trap_int_func_fast_math(Real_type x,
+                                  Real_type y,
+                                  Real_type xp,
+                                  Real_type yp)
+{
+   Real_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
+   denom = fast_math::rsqrt(denom);
+   return denom;
+}
+
 
-void TRAP_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRAP_INT::runSeqVariantFastMath(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -40,6 +56,49 @@ void TRAP_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
   TRAP_INT_DATA_SETUP;
 
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sumx = m_sumx_init;
+
+        RAJAPERF_SIMD_REDUCTION(+, sumx)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRAP_INT_BODY_FAST_MATH;
+        }
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRAP_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRAP_INT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 1 ) {
+    runSeqVariantFastMath(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRAP_INT_DATA_SETUP;
+
   switch ( vid ) {
 
     case Base_Seq : {
@@ -115,5 +174,14 @@ void TRAP_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 }
 
+void TRAP_INT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq && run_params.getFastMath() ) {
+    addVariantTuningName(vid, fast_math::getTuningName());
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -35,6 +35,9 @@ TRAP_INT::TRAP_INT(const RunParams& params)
   setUsesFeature(Forall);
   setUsesFeature(Reduction);
 
+  setHasPattern(ReductionBound);
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -43,6 +46,8 @@ TRAP_INT::TRAP_INT(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
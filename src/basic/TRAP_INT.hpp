@@ -24,6 +24,9 @@
 ///    sumx += trap_int_func(x, y, xp, yp);
 /// }
 ///
+/// The fast_math tunings compute 1.0/sqrt(denom) with fast_math::rsqrt from
+/// common/FastMathUtils.hpp in trap_int_func_fast_math.
+///
 
 #ifndef RAJAPerf_Basic_TRAP_INT_HPP
 #define RAJAPerf_Basic_TRAP_INT_HPP
@@ -40,8 +43,13 @@
   Real_type x = x0 + i*h; \
   sumx += trap_int_func(x, y, xp, yp);
 
+#define TRAP_INT_BODY_FAST_MATH \
+  Real_type x = x0 + i*h; \
+  sumx += trap_int_func_fast_math(x, y, xp, yp);
+
 
 #include "common/KernelBase.hpp"
+#include "common/FastMathUtils.hpp"
 
 namespace rajaperf
 {
@@ -69,16 +77,22 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantFastMath(VariantID vid);
   template < size_t block_size >
   void runCudaVariantBlock(VariantID vid);
   template < size_t block_size >
   void runCudaVariantOccGS(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantFastMath(VariantID vid);
+  template < size_t block_size >
   void runHipVariantBlock(VariantID vid);
   template < size_t block_size >
   void runHipVariantOccGS(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantFastMath(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
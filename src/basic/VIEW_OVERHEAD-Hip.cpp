@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "VIEW_OVERHEAD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < Index_type D, size_t block_size >
+void VIEW_OVERHEAD::runHipVariantImpl(VariantID vid, ViewOverheadLayout layout)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  VIEW_OVERHEAD_DATA_SETUP;
+
+  const ViewOverheadExtents ext = getExtents(D, layout);
+  const bool reversed = isViewOverheadPermuted(layout);
+
+  if ( vid == Base_HIP ) {
+
+    viewOverheadMakeViews<D>(layout, x, y, ext, [&](auto xv, auto yv) {
+
+      using view_type = decltype(xv);
+      const ViewOverheadBody<view_type> body{xv, yv, v};
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        const dim3 grid_size = viewOverheadGrid<D, block_size>(ext, reversed);
+        constexpr size_t shmem = 0;
+        hipLaunchKernelGGL((view_overhead<D, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           body, ext, reversed);
+        hipErrchk( hipGetLastError() );
+
+      }
+      stopTimer();
+
+    });
+
+  } else {
+
+    getCout() << "\n  VIEW_OVERHEAD : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+void VIEW_OVERHEAD::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  for (Index_type l = 0; l < NumViewOverheadLayouts; ++l) {
+    seq_for(view_overhead_dims_type{}, [&](auto dims) {
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+          if (tune_idx == t) {
+            setBlockSize(block_size);
+            runHipVariantImpl<dims, block_size>(vid, static_cast<ViewOverheadLayout>(l));
+          }
+          t += 1;
+        }
+      });
+    });
+  }
+}
+
+void VIEW_OVERHEAD::setHipTuningDefinitions(VariantID vid)
+{
+  for (Index_type l = 0; l < NumViewOverheadLayouts; ++l) {
+    seq_for(view_overhead_dims_type{}, [&](auto dims) {
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+          addVariantTuningName(vid, getViewOverheadTuningName(
+              static_cast<ViewOverheadLayout>(l), dims) +
+              "_block_"+std::to_string(block_size));
+        }
+      });
+    });
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
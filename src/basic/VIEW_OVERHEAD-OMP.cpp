@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "VIEW_OVERHEAD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < Index_type D >
+void VIEW_OVERHEAD::runOpenMPVariantImpl(VariantID vid, ViewOverheadLayout layout)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  VIEW_OVERHEAD_DATA_SETUP;
+
+  const ViewOverheadExtents ext = getExtents(D, layout);
+  const bool reversed = isViewOverheadPermuted(layout);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      viewOverheadMakeViews<D>(layout, x, y, ext, [&](auto xv, auto yv) {
+
+        using view_type = decltype(xv);
+        const ViewOverheadBody<view_type> body{xv, yv, v};
+
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          ViewOverheadLoops<D>::run(ext, reversed, true, body);
+
+        }
+        stopTimer();
+
+      });
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  VIEW_OVERHEAD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(layout);
+#endif
+}
+
+void VIEW_OVERHEAD::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  for (Index_type l = 0; l < NumViewOverheadLayouts; ++l) {
+    seq_for(view_overhead_dims_type{}, [&](auto dims) {
+      if (tune_idx == t) {
+        runOpenMPVariantImpl<dims>(vid, static_cast<ViewOverheadLayout>(l));
+      }
+      t += 1;
+    });
+  }
+}
+
+void VIEW_OVERHEAD::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (Index_type l = 0; l < NumViewOverheadLayouts; ++l) {
+    seq_for(view_overhead_dims_type{}, [&](auto dims) {
+      addVariantTuningName(vid, getViewOverheadTuningName(
+          static_cast<ViewOverheadLayout>(l), dims));
+    });
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
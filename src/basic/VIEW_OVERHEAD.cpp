@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "VIEW_OVERHEAD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+VIEW_OVERHEAD::VIEW_OVERHEAD(const RunParams& params)
+  : KernelBase(rajaperf::Basic_VIEW_OVERHEAD, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  m_outer = getKernelParam("outer", 8);
+  m_val = 0.75;
+
+  const Index_type outer_size = m_outer * m_outer * m_outer;
+  setActualProblemSize( std::max(outer_size,
+      getTargetProblemSize() - getTargetProblemSize() % outer_size) );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(1 * getActualProblemSize());
+
+  setUsesFeature(View);
+
+  setHasPattern(Streaming);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+VIEW_OVERHEAD::~VIEW_OVERHEAD()
+{
+}
+
+ViewOverheadExtents VIEW_OVERHEAD::getExtents(Index_type D,
+                                              ViewOverheadLayout layout) const
+{
+  ViewOverheadExtents ext;
+  Index_type inner = getActualProblemSize();
+  for (Index_type k = 0; k < D-1; ++k) {
+    ext.n[k] = m_outer;
+    inner /= m_outer;
+  }
+  ext.n[D-1] = inner;
+  if ( isViewOverheadPermuted(layout) ) {
+    std::reverse(&ext.n[0], &ext.n[D]);
+  }
+  for (Index_type k = D; k < view_overhead_max_dims; ++k) {
+    ext.n[k] = 1;
+  }
+  return ext;
+}
+
+void VIEW_OVERHEAD::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_x, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+}
+
+void VIEW_OVERHEAD::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid].at(tune_idx) += calcChecksum(m_y, getActualProblemSize(), vid);
+}
+
+void VIEW_OVERHEAD::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
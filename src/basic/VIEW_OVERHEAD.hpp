@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// VIEW_OVERHEAD kernel reference implementation, for D = 3:
+///
+/// for (Index_type i0 = 0; i0 < n0; ++i0 ) {
+///   for (Index_type i1 = 0; i1 < n1; ++i1 ) {
+///     for (Index_type i2 = 0; i2 < n2; ++i2 ) {
+///       y[(i0*n1 + i1)*n2 + i2] = v * x[(i0*n1 + i1)*n2 + i2];
+///     }
+///   }
+/// }
+///
+/// The same problem is indexed as a D dimensional array, D = 1 to 4,
+/// through a raw pointer and through each kind of RAJA View listed in
+/// ViewOverheadUtils.hpp, so the tunings, ie. layout_stride1_3d, show the
+/// cost of the address arithmetic of each View feature against the
+/// pointer tuning of the same D. The outer extents are given by the
+/// kernel parameter "outer" (8 by default) and the stride one extent
+/// holds the rest of the problem, which is rounded down to a multiple of
+/// outer^3 so every D has the same problem size.
+///
+
+#ifndef RAJAPerf_Basic_VIEW_OVERHEAD_HPP
+#define RAJAPerf_Basic_VIEW_OVERHEAD_HPP
+
+#define VIEW_OVERHEAD_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  const Real_type v = m_val;
+
+
+#include "common/KernelBase.hpp"
+
+#include "ViewOverheadUtils.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+using view_overhead_dims_type = camp::int_seq<Index_type, 1, 2, 3, 4>;
+
+class VIEW_OVERHEAD : public KernelBase
+{
+public:
+
+  VIEW_OVERHEAD(const RunParams& params);
+
+  ~VIEW_OVERHEAD();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  VIEW_OVERHEAD : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  template < Index_type D >
+  void runSeqVariantImpl(VariantID vid, ViewOverheadLayout layout);
+  template < Index_type D >
+  void runOpenMPVariantImpl(VariantID vid, ViewOverheadLayout layout);
+  template < Index_type D, size_t block_size >
+  void runCudaVariantImpl(VariantID vid, ViewOverheadLayout layout);
+  template < Index_type D, size_t block_size >
+  void runHipVariantImpl(VariantID vid, ViewOverheadLayout layout);
+
+  // return the extents of the D dimensional arrays of layout, the stride
+  // one extent is last, or first for the permuted layouts
+  ViewOverheadExtents getExtents(Index_type D, ViewOverheadLayout layout) const;
+
+  // return the tuning name of layout and D, ie. typed_view_2d
+  static std::string getViewOverheadTuningName(ViewOverheadLayout layout,
+                                               Index_type D)
+  {
+    return getViewOverheadLayoutName(layout) + "_" + std::to_string(D) + "d";
+  }
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type m_outer;
+  Real_type m_val;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
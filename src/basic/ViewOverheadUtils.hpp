@@ -0,0 +1,438 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Views and loop nests used by the tunings of the VIEW_OVERHEAD kernel.
+///
+/// Every tuning computes y(i0, ..., iD-1) = v * x(i0, ..., iD-1) over the
+/// same D dimensional arrays through one kind of view:
+///
+///   pointer                  - raw pointer indexed with the extents
+///   layout                   - RAJA::View with RAJA::Layout<D>
+///   layout_stride1           - Layout<D, Index_type, D-1>
+///   offset_layout            - RAJA::OffsetLayout<D>, with zero offsets
+///                              that are only known at run time
+///   permuted_layout          - Layout<D> made by make_permuted_layout with
+///                              the reversed permutation, so i0 is stride one
+///   permuted_layout_stride1  - Layout<D, Index_type, 0> of the same
+///   typed_view               - RAJA::TypedView with Layout<D, Index_type, D-1>
+///                              and strongly typed indices
+///
+/// The loops run with the stride one index innermost, so every tuning
+/// reads and writes memory in the same order.
+///
+
+#ifndef RAJAPerf_ViewOverheadUtils_HPP
+#define RAJAPerf_ViewOverheadUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+#include "common/RPTypes.hpp"
+
+#include <array>
+#include <string>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+enum ViewOverheadLayout {
+  VO_Pointer = 0,
+  VO_Layout,
+  VO_LayoutStride1,
+  VO_OffsetLayout,
+  VO_PermutedLayout,
+  VO_PermutedLayoutStride1,
+  VO_TypedView,
+
+  NumViewOverheadLayouts
+};
+
+inline std::string getViewOverheadLayoutName(ViewOverheadLayout layout)
+{
+  static const std::string names[] = {
+    "pointer", "layout", "layout_stride1", "offset_layout",
+    "permuted_layout", "permuted_layout_stride1", "typed_view" };
+  return names[layout];
+}
+
+// permuted layouts make i0 the stride one index
+inline bool isViewOverheadPermuted(ViewOverheadLayout layout)
+{
+  return layout == VO_PermutedLayout || layout == VO_PermutedLayoutStride1;
+}
+
+constexpr Index_type view_overhead_max_dims = 4;
+
+//
+// Index extents, passed by value to GPU kernels.
+//
+struct ViewOverheadExtents
+{
+  Index_type n[view_overhead_max_dims];
+};
+
+//
+// Raw pointer indexed with the extents, the last index is stride one.
+//
+template < Index_type D >
+struct ViewOverheadPointer
+{
+  Real_ptr p;
+  ViewOverheadExtents ext;
+
+  template < typename... Is >
+  RAJA_HOST_DEVICE Real_type& operator()(Is... is) const
+  {
+    const Index_type idx[] = { static_cast<Index_type>(is)... };
+    Index_type lin = idx[0];
+    for (Index_type k = 1; k < D; ++k) {
+      lin = lin * ext.n[k] + idx[k];
+    }
+    return p[lin];
+  }
+};
+
+//
+// RAJA::TypedView accessed with untyped indices.
+//
+namespace view_overhead_idx {
+  RAJA_INDEX_VALUE(I0, "I0");
+  RAJA_INDEX_VALUE(I1, "I1");
+  RAJA_INDEX_VALUE(I2, "I2");
+  RAJA_INDEX_VALUE(I3, "I3");
+}
+
+template < Index_type D >
+struct ViewOverheadTyped;
+
+template < >
+struct ViewOverheadTyped<1>
+{
+  using view_type = RAJA::TypedView<Real_type, RAJA::Layout<1, Index_type, 0>,
+                                    view_overhead_idx::I0>;
+  view_type v;
+
+  RAJA_HOST_DEVICE Real_type& operator()(Index_type i0) const
+  {
+    return v(view_overhead_idx::I0{i0});
+  }
+};
+
+template < >
+struct ViewOverheadTyped<2>
+{
+  using view_type = RAJA::TypedView<Real_type, RAJA::Layout<2, Index_type, 1>,
+                                    view_overhead_idx::I0, view_overhead_idx::I1>;
+  view_type v;
+
+  RAJA_HOST_DEVICE Real_type& operator()(Index_type i0, Index_type i1) const
+  {
+    return v(view_overhead_idx::I0{i0}, view_overhead_idx::I1{i1});
+  }
+};
+
+template < >
+struct ViewOverheadTyped<3>
+{
+  using view_type = RAJA::TypedView<Real_type, RAJA::Layout<3, Index_type, 2>,
+                                    view_overhead_idx::I0, view_overhead_idx::I1,
+                                    view_overhead_idx::I2>;
+  view_type v;
+
+  RAJA_HOST_DEVICE Real_type& operator()(Index_type i0, Index_type i1,
+                                         Index_type i2) const
+  {
+    return v(view_overhead_idx::I0{i0}, view_overhead_idx::I1{i1},
+             view_overhead_idx::I2{i2});
+  }
+};
+
+template < >
+struct ViewOverheadTyped<4>
+{
+  using view_type = RAJA::TypedView<Real_type, RAJA::Layout<4, Index_type, 3>,
+                                    view_overhead_idx::I0, view_overhead_idx::I1,
+                                    view_overhead_idx::I2, view_overhead_idx::I3>;
+  view_type v;
+
+  RAJA_HOST_DEVICE Real_type& operator()(Index_type i0, Index_type i1,
+                                         Index_type i2, Index_type i3) const
+  {
+    return v(view_overhead_idx::I0{i0}, view_overhead_idx::I1{i1},
+             view_overhead_idx::I2{i2}, view_overhead_idx::I3{i3});
+  }
+};
+
+//
+// The loop body, y(is...) = v * x(is...).
+//
+template < typename View >
+struct ViewOverheadBody
+{
+  View x;
+  View y;
+  Real_type v;
+
+  template < typename... Is >
+  RAJA_HOST_DEVICE void operator()(Is... is) const
+  {
+    y(is...) = v * x(is...);
+  }
+};
+
+//
+// Make the views of the ptr to D dimensional arrays of extents ext of a
+// layout and call func(x_view, y_view). Permuted layouts take the extents
+// in reversed order.
+//
+template < Index_type D, typename Func >
+inline void viewOverheadMakeViews(ViewOverheadLayout layout,
+                                  Real_ptr x, Real_ptr y,
+                                  const ViewOverheadExtents& ext,
+                                  Func&& func)
+{
+  std::array<Index_type, D> sizes;
+  std::array<Index_type, D> zeros;
+  std::array<RAJA::idx_t, D> perm;
+  for (Index_type k = 0; k < D; ++k) {
+    sizes[k] = ext.n[k];
+    zeros[k] = 0;
+    perm[k] = isViewOverheadPermuted(layout) ? D-1-k : k;
+  }
+
+  switch ( layout ) {
+
+    case VO_Pointer : {
+      using view_type = ViewOverheadPointer<D>;
+      func(view_type{x, ext}, view_type{y, ext});
+      break;
+    }
+
+    case VO_Layout :
+    case VO_PermutedLayout : {
+      using view_type = RAJA::View<Real_type, RAJA::Layout<D, Index_type>>;
+      const auto lay = RAJA::make_permuted_layout(sizes, perm);
+      func(view_type(x, lay), view_type(y, lay));
+      break;
+    }
+
+    case VO_LayoutStride1 : {
+      using view_type = RAJA::View<Real_type, RAJA::Layout<D, Index_type, D-1>>;
+      const auto lay = RAJA::make_permuted_layout(sizes, perm);
+      func(view_type(x, lay), view_type(y, lay));
+      break;
+    }
+
+    case VO_PermutedLayoutStride1 : {
+      using view_type = RAJA::View<Real_type, RAJA::Layout<D, Index_type, 0>>;
+      const auto lay = RAJA::make_permuted_layout(sizes, perm);
+      func(view_type(x, lay), view_type(y, lay));
+      break;
+    }
+
+    case VO_OffsetLayout : {
+      using view_type = RAJA::View<Real_type, RAJA::OffsetLayout<D, Index_type>>;
+      const auto lay = RAJA::make_offset_layout<D, Index_type>(zeros, sizes);
+      func(view_type(x, lay), view_type(y, lay));
+      break;
+    }
+
+    case VO_TypedView : {
+      using view_type = ViewOverheadTyped<D>;
+      using raja_view_type = typename view_type::view_type;
+      const auto lay = RAJA::make_permuted_layout(sizes, perm);
+      func(view_type{raja_view_type(x, lay)}, view_type{raja_view_type(y, lay)});
+      break;
+    }
+
+    default : break;
+  }
+}
+
+//
+// CPU loop nests over extents ext with the last index innermost, or the
+// first index innermost when reversed. The loops outside the innermost are
+// collapsed into one OpenMP parallel loop when parallel is true.
+//
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#define VIEW_OVERHEAD_OMP_FOR(n) RAJA_PRAGMA(omp parallel for collapse(n) if(parallel))
+#else
+#define VIEW_OVERHEAD_OMP_FOR(n)
+#endif
+
+template < Index_type D >
+struct ViewOverheadLoops;
+
+template < >
+struct ViewOverheadLoops<1>
+{
+  template < typename Body >
+  static void run(const ViewOverheadExtents& ext, bool RAJAPERF_UNUSED_ARG(reversed),
+                  bool parallel, const Body& body)
+  {
+    RAJA_UNUSED_VAR(parallel);
+    VIEW_OVERHEAD_OMP_FOR(1)
+    for (Index_type i0 = 0; i0 < ext.n[0]; ++i0) {
+      body(i0);
+    }
+  }
+};
+
+template < >
+struct ViewOverheadLoops<2>
+{
+  template < typename Body >
+  static void run(const ViewOverheadExtents& ext, bool reversed,
+                  bool parallel, const Body& body)
+  {
+    RAJA_UNUSED_VAR(parallel);
+    if ( !reversed ) {
+      VIEW_OVERHEAD_OMP_FOR(1)
+      for (Index_type i0 = 0; i0 < ext.n[0]; ++i0) {
+        for (Index_type i1 = 0; i1 < ext.n[1]; ++i1) {
+          body(i0, i1);
+        }
+      }
+    } else {
+      VIEW_OVERHEAD_OMP_FOR(1)
+      for (Index_type i1 = 0; i1 < ext.n[1]; ++i1) {
+        for (Index_type i0 = 0; i0 < ext.n[0]; ++i0) {
+          body(i0, i1);
+        }
+      }
+    }
+  }
+};
+
+template < >
+struct ViewOverheadLoops<3>
+{
+  template < typename Body >
+  static void run(const ViewOverheadExtents& ext, bool reversed,
+                  bool parallel, const Body& body)
+  {
+    RAJA_UNUSED_VAR(parallel);
+    if ( !reversed ) {
+      VIEW_OVERHEAD_OMP_FOR(2)
+      for (Index_type i0 = 0; i0 < ext.n[0]; ++i0) {
+        for (Index_type i1 = 0; i1 < ext.n[1]; ++i1) {
+          for (Index_type i2 = 0; i2 < ext.n[2]; ++i2) {
+            body(i0, i1, i2);
+          }
+        }
+      }
+    } else {
+      VIEW_OVERHEAD_OMP_FOR(2)
+      for (Index_type i2 = 0; i2 < ext.n[2]; ++i2) {
+        for (Index_type i1 = 0; i1 < ext.n[1]; ++i1) {
+          for (Index_type i0 = 0; i0 < ext.n[0]; ++i0) {
+            body(i0, i1, i2);
+          }
+        }
+      }
+    }
+  }
+};
+
+template < >
+struct ViewOverheadLoops<4>
+{
+  template < typename Body >
+  static void run(const ViewOverheadExtents& ext, bool reversed,
+                  bool parallel, const Body& body)
+  {
+    RAJA_UNUSED_VAR(parallel);
+    if ( !reversed ) {
+      VIEW_OVERHEAD_OMP_FOR(3)
+      for (Index_type i0 = 0; i0 < ext.n[0]; ++i0) {
+        for (Index_type i1 = 0; i1 < ext.n[1]; ++i1) {
+          for (Index_type i2 = 0; i2 < ext.n[2]; ++i2) {
+            for (Index_type i3 = 0; i3 < ext.n[3]; ++i3) {
+              body(i0, i1, i2, i3);
+            }
+          }
+        }
+      }
+    } else {
+      VIEW_OVERHEAD_OMP_FOR(3)
+      for (Index_type i3 = 0; i3 < ext.n[3]; ++i3) {
+        for (Index_type i2 = 0; i2 < ext.n[2]; ++i2) {
+          for (Index_type i1 = 0; i1 < ext.n[1]; ++i1) {
+            for (Index_type i0 = 0; i0 < ext.n[0]; ++i0) {
+              body(i0, i1, i2, i3);
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+
+template < typename Body, camp::idx_t... Ks >
+__device__ __forceinline__ void viewOverheadApply(const Body& body,
+                                                  const Index_type* idx,
+                                                  camp::idx_seq<Ks...>)
+{
+  body(idx[Ks]...);
+}
+
+//
+// The innermost index is blockIdx.x * block_size + threadIdx.x, the next
+// outer index is blockIdx.y, and blockIdx.z holds the rest.
+//
+template < Index_type D, size_t block_size, typename Body >
+__launch_bounds__(block_size)
+__global__ void view_overhead(Body body, ViewOverheadExtents ext, bool reversed)
+{
+  const Index_type inner = reversed ? 0 : D-1;
+  Index_type idx[D];
+  idx[inner] = blockIdx.x * block_size + threadIdx.x;
+  if ( idx[inner] < ext.n[inner] ) {
+    Index_type rest_idx = blockIdx.z;
+    for (Index_type o = 0; o < D-1; ++o) {
+      // the outer indices from the innermost out
+      const Index_type k = reversed ? o+1 : D-2-o;
+      if ( o == 0 ) {
+        idx[k] = blockIdx.y;
+      } else {
+        idx[k] = rest_idx % ext.n[k];
+        rest_idx /= ext.n[k];
+      }
+    }
+    viewOverheadApply(body, idx, camp::make_idx_seq_t<D>{});
+  }
+}
+
+//
+// Return the grid of view_overhead for extents ext.
+//
+template < Index_type D, size_t block_size >
+inline dim3 viewOverheadGrid(const ViewOverheadExtents& ext, bool reversed)
+{
+  const Index_type inner = reversed ? 0 : D-1;
+  dim3 grid(RAJA_DIVIDE_CEILING_INT(ext.n[inner], block_size), 1, 1);
+  for (Index_type o = 1; o < D; ++o) {
+    const Index_type k = reversed ? o : D-1-o;
+    if ( o == 1 ) {
+      grid.y = ext.n[k];
+    } else {
+      grid.z *= ext.n[k];
+    }
+  }
+  return grid;
+}
+
+#endif
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
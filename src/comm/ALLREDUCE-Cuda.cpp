@@ -0,0 +1,55 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ALLREDUCE.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+
+void ALLREDUCE::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type count = getTuningCount(tune_idx);
+  const bool nonblocking = getTuningNonblocking(tune_idx);
+
+  ALLREDUCE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      ALLREDUCE_BODY(count, nonblocking);
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  ALLREDUCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
+
+#endif
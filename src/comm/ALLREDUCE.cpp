@@ -0,0 +1,144 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ALLREDUCE.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+
+ALLREDUCE::ALLREDUCE(const RunParams& params)
+  : KernelBase(rajaperf::Comm_ALLREDUCE, params)
+{
+  setDefaultProblemSize(64);
+  setDefaultReps(10000);
+
+  m_max_count = getKernelParam("max_count", 64);
+
+  for (Index_type count = 1; count < m_max_count; count *= 2) {
+    m_counts.emplace_back(count);
+  }
+  m_counts.emplace_back(m_max_count);
+
+  setActualProblemSize( m_max_count );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep( getActualProblemSize() );
+
+  setUsesFeature(Reduction);
+
+  setHasPattern(LatencyBound);
+  setHasPattern(ReductionBound);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+ALLREDUCE::~ALLREDUCE()
+{
+}
+
+//
+// Each tuning reduces its count of values.
+//
+Index_type ALLREDUCE::getBytesPerRep(VariantID RAJAPERF_UNUSED_ARG(vid),
+                                     size_t tune_idx) const
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getTuningCount(tune_idx);
+}
+
+void ALLREDUCE::addCountTuningNames(VariantID vid)
+{
+  for (Index_type count : m_counts) {
+    addVariantTuningName(vid, "allreduce_"+std::to_string(count));
+    addVariantTuningName(vid, "iallreduce_"+std::to_string(count));
+  }
+}
+
+void ALLREDUCE::setSeqTuningDefinitions(VariantID vid)
+{
+  addCountTuningNames(vid);
+}
+
+void ALLREDUCE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addCountTuningNames(vid);
+}
+
+void ALLREDUCE::setCudaTuningDefinitions(VariantID vid)
+{
+  addCountTuningNames(vid);
+}
+
+void ALLREDUCE::setHipTuningDefinitions(VariantID vid)
+{
+  addCountTuningNames(vid);
+}
+
+void ALLREDUCE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_send, m_max_count, vid);
+  allocAndInitDataConst(m_recv, m_max_count, 0.0, vid);
+
+  //
+  // Messages go through host buffers unless MPI can use the kernel data
+  // space directly.
+  //
+  const DataSpace buffer_space = getHostAccessibleDataSpace(vid);
+  m_separate_buffers = !run_params.getMPIGPUAware() &&
+                       (getDataSpace(vid) != buffer_space);
+
+  if (m_separate_buffers) {
+    allocData(buffer_space, m_send_buffer, m_max_count);
+    allocData(buffer_space, m_recv_buffer, m_max_count);
+  } else {
+    m_send_buffer = m_send;
+    m_recv_buffer = m_recv;
+  }
+}
+
+void ALLREDUCE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_recv, m_max_count, vid);
+}
+
+void ALLREDUCE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  if (m_separate_buffers) {
+    const DataSpace buffer_space = getHostAccessibleDataSpace(vid);
+    deallocData(buffer_space, m_send_buffer);
+    deallocData(buffer_space, m_recv_buffer);
+  }
+  m_send_buffer = nullptr;
+  m_recv_buffer = nullptr;
+
+  deallocData(m_send, vid);
+  deallocData(m_recv, vid);
+}
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
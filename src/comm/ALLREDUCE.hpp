@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// ALLREDUCE kernel reference implementation:
+///
+/// MPI_Allreduce(send, recv, count, Real_MPI_type, MPI_SUM, MPI_COMM_WORLD);
+///
+/// Each tuning, allreduce_<count> or iallreduce_<count>, sums count values
+/// over all ranks with MPI_Allreduce, or MPI_Iallreduce and MPI_Wait, for
+/// count 1, 2, 4, ... up to the kernel parameter "max_count", and
+/// "max_count" itself, so the latency of the small reductions of global
+/// dot products and norms in solvers is measured over message sizes in one
+/// run. The message sizes do not depend on the problem size.
+///
+/// The Base Seq and OpenMP variants reduce host buffers. The Base GPU
+/// variants reduce device buffers, which are copied through host buffers
+/// unless run with '--mpi-gpu-aware'.
+///
+
+#ifndef RAJAPerf_Comm_ALLREDUCE_HPP
+#define RAJAPerf_Comm_ALLREDUCE_HPP
+
+#define ALLREDUCE_DATA_SETUP \
+  Real_ptr send = m_send; \
+  Real_ptr recv = m_recv; \
+  Real_ptr send_buffer = m_send_buffer; \
+  Real_ptr recv_buffer = m_recv_buffer; \
+\
+  const bool separate_buffers = m_separate_buffers; \
+  const DataSpace data_space = getDataSpace(vid); \
+  const DataSpace buffer_space = getHostAccessibleDataSpace(vid);
+
+//
+// Sum count values of send over all ranks into recv, blocking or
+// nonblocking, going through the host buffers if they are separate.
+//
+#define ALLREDUCE_BODY(count, nonblocking) \
+  if (separate_buffers) { \
+    copyData(buffer_space, send_buffer, data_space, send, count); \
+  } \
+  if (nonblocking) { \
+    MPI_Request request; \
+    MPI_Iallreduce(send_buffer, recv_buffer, count, Real_MPI_type, \
+                   MPI_SUM, MPI_COMM_WORLD, &request); \
+    MPI_Wait(&request, MPI_STATUS_IGNORE); \
+  } else { \
+    MPI_Allreduce(send_buffer, recv_buffer, count, Real_MPI_type, \
+                  MPI_SUM, MPI_COMM_WORLD); \
+  } \
+  if (separate_buffers) { \
+    copyData(data_space, recv, buffer_space, recv_buffer, count); \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <vector>
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace comm
+{
+
+class ALLREDUCE : public KernelBase
+{
+public:
+
+  ALLREDUCE(const RunParams& params);
+
+  ~ALLREDUCE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ALLREDUCE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+private:
+  void addCountTuningNames(VariantID vid);
+
+  // each count has a blocking then a nonblocking tuning
+  Index_type getTuningCount(size_t tune_idx) const
+  {
+    return m_counts.at((tune_idx % (2*m_counts.size())) / 2);
+  }
+  bool getTuningNonblocking(size_t tune_idx) const
+  {
+    return (tune_idx % 2) == 1;
+  }
+
+  std::vector<Index_type> m_counts; // count of each pair of tunings
+  Index_type m_max_count;
+
+  bool m_separate_buffers;
+
+  Real_ptr m_send;
+  Real_ptr m_recv;
+  Real_ptr m_send_buffer;
+  Real_ptr m_recv_buffer;
+};
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
+
+#endif // closing endif for header file include guard
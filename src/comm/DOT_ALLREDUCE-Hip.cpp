@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "DOT_ALLREDUCE.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+
+namespace rajaperf
+{
+namespace comm
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_allreduce(Real_ptr a, Real_ptr b,
+                              Real_ptr ddot,
+                              Index_type iend)
+{
+  Real_type dot = 0.0;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    DOT_ALLREDUCE_BODY;
+  }
+
+  dot = hip_block_reduce<block_size, RAJA::operators::plus<Real_type>>(dot);
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd<RAJA::hip_atomic>( ddot, dot );
+  }
+}
+
+
+template < size_t block_size >
+void DOT_ALLREDUCE::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  DOT_ALLREDUCE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const bool gpu_aware = run_params.getMPIGPUAware();
+
+    Real_ptr ddot;
+    allocData(DataSpace::HipDevice, ddot, 1);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (dot_allreduce<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("dot_allreduce",
+        (dot_allreduce<block_size>), block_size, shmem) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      startPhaseTimer(s_dot_phase);
+      hipErrchk( hipMemcpyAsync( ddot, &m_dot_init, sizeof(Real_type),
+                                   hipMemcpyHostToDevice, res.get_stream() ) );
+
+      const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+      hipLaunchKernelGGL( (dot_allreduce<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          a, b, ddot, iend );
+      hipErrchk( hipGetLastError() );
+
+      Real_type dot;
+      if (gpu_aware) {
+        // the reduction reads the device value after the kernel
+        hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+        stopPhaseTimer(s_dot_phase);
+
+        startPhaseTimer(s_comm_phase);
+        MPI_Allreduce(MPI_IN_PLACE, ddot, 1, Real_MPI_type, MPI_SUM, MPI_COMM_WORLD);
+        hipErrchk( hipMemcpyAsync( &dot, ddot, sizeof(Real_type),
+                                     hipMemcpyDeviceToHost, res.get_stream() ) );
+        hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+        stopPhaseTimer(s_comm_phase);
+      } else {
+        hipErrchk( hipMemcpyAsync( &dot, ddot, sizeof(Real_type),
+                                     hipMemcpyDeviceToHost, res.get_stream() ) );
+        hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+        stopPhaseTimer(s_dot_phase);
+
+        DOT_ALLREDUCE_REDUCE(dot);
+      }
+
+      m_dot += dot;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, ddot);
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      startPhaseTimer(s_dot_phase);
+      RAJA::ReduceSum<RAJA::hip_reduce, Real_type> rdot(m_dot_init);
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        rdot += a[i] * b[i];
+      });
+
+      Real_type dot = static_cast<Real_type>(rdot.get());
+      stopPhaseTimer(s_dot_phase);
+
+      DOT_ALLREDUCE_REDUCE(dot);
+
+      m_dot += dot;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  DOT_ALLREDUCE : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(DOT_ALLREDUCE, Hip)
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
+
+#endif
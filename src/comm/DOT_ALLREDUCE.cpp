@@ -0,0 +1,87 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "DOT_ALLREDUCE.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace comm
+{
+
+
+DOT_ALLREDUCE::DOT_ALLREDUCE(const RunParams& params)
+  : KernelBase(rajaperf::Comm_DOT_ALLREDUCE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(2000);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) +
+                  (0*sizeof(Real_type) + 2*sizeof(Real_type)) *
+                  getActualProblemSize() );
+  setFLOPsPerRep(2 * getActualProblemSize() + 1);
+
+  setUsesFeature( Forall );
+  setUsesFeature( Reduction );
+
+  setHasPattern( Streaming );
+  setHasPattern( ReductionBound );
+  setHasPattern( LatencyBound );
+
+  setPhaseNames({"dot", "comm"});
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+DOT_ALLREDUCE::~DOT_ALLREDUCE()
+{
+}
+
+void DOT_ALLREDUCE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_a, getActualProblemSize(), vid);
+  allocAndInitData(m_b, getActualProblemSize(), vid);
+
+  m_dot = 0.0;
+  m_dot_init = 0.0;
+}
+
+void DOT_ALLREDUCE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += m_dot;
+}
+
+void DOT_ALLREDUCE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_a, vid);
+  deallocData(m_b, vid);
+}
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
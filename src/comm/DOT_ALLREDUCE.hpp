@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// DOT_ALLREDUCE kernel reference implementation:
+///
+/// Real_type dot = 0.0;
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   dot += a[i] * b[i];
+/// }
+/// MPI_Allreduce(MPI_IN_PLACE, &dot, 1, Real_MPI_type, MPI_SUM, MPI_COMM_WORLD);
+///
+/// The global dot product of a distributed solver, the local dot product is
+/// followed by a sum over all ranks of one value in each rep, so at scale the
+/// rep time is bound by the latency of the reduction instead of the
+/// bandwidth of the local loop. Local and reduction times are reported
+/// separately in the phase timing report.
+///
+/// The GPU variants copy the local dot product to the host before the
+/// reduction, unless run with '--mpi-gpu-aware', in which case the Base GPU
+/// variants reduce the device value and copy the global dot product.
+///
+
+#ifndef RAJAPerf_Comm_DOT_ALLREDUCE_HPP
+#define RAJAPerf_Comm_DOT_ALLREDUCE_HPP
+
+#define DOT_ALLREDUCE_DATA_SETUP \
+  Real_ptr a = m_a; \
+  Real_ptr b = m_b;
+
+#define DOT_ALLREDUCE_BODY  \
+  dot += a[i] * b[i] ;
+
+//
+// Sum the local dot product on the host over all ranks.
+//
+#define DOT_ALLREDUCE_REDUCE(dot) \
+  startPhaseTimer(s_comm_phase); \
+  MPI_Allreduce(MPI_IN_PLACE, &(dot), 1, Real_MPI_type, MPI_SUM, MPI_COMM_WORLD); \
+  stopPhaseTimer(s_comm_phase);
+
+
+#include "common/KernelBase.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace comm
+{
+
+class DOT_ALLREDUCE : public KernelBase
+{
+public:
+
+  DOT_ALLREDUCE(const RunParams& params);
+
+  ~DOT_ALLREDUCE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  DOT_ALLREDUCE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  static const size_t s_dot_phase = 0;
+  static const size_t s_comm_phase = 1;
+
+  Real_ptr m_a;
+  Real_ptr m_b;
+  Real_type m_dot;
+  Real_type m_dot_init;
+};
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,234 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "NEIGHBOR_ALLTOALLV.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+namespace {
+
+//
+// Offsets in the rank grid of the neighbors, faces then edges then corners.
+//
+const int neighbor_offsets[26][3] = {
+  // faces
+  {-1,  0,  0}, { 1,  0,  0}, { 0, -1,  0}, { 0,  1,  0}, { 0,  0, -1}, { 0,  0,  1},
+  // edges
+  {-1, -1,  0}, {-1,  1,  0}, { 1, -1,  0}, { 1,  1,  0},
+  {-1,  0, -1}, {-1,  0,  1}, { 1,  0, -1}, { 1,  0,  1},
+  { 0, -1, -1}, { 0, -1,  1}, { 0,  1, -1}, { 0,  1,  1},
+  // corners
+  {-1, -1, -1}, {-1, -1,  1}, {-1,  1, -1}, {-1,  1,  1},
+  { 1, -1, -1}, { 1, -1,  1}, { 1,  1, -1}, { 1,  1,  1}
+};
+
+//
+// Return number of elements of one variable in the halo shared with the
+// neighbor at offset, the grid extent in dimensions with offset 0 and the
+// halo width in the others.
+//
+Index_type halo_extent(const int* offset, const Index_type* grid_dims,
+                       Index_type halo_width)
+{
+  Index_type extent = 1;
+  for (int d = 0; d < 3; ++d) {
+    extent *= (offset[d] == 0) ? grid_dims[d] : halo_width;
+  }
+  return extent;
+}
+
+}
+
+
+NEIGHBOR_ALLTOALLV::NEIGHBOR_ALLTOALLV(const RunParams& params)
+  : KernelBase(rajaperf::Comm_NEIGHBOR_ALLTOALLV, params)
+{
+  setDefaultProblemSize( 100 * 100 * 100 );
+  setDefaultReps(200);
+
+  double cbrt_run_size = std::cbrt(getTargetProblemSize());
+
+  m_grid_dims[0] = cbrt_run_size;
+  m_grid_dims[1] = cbrt_run_size;
+  m_grid_dims[2] = cbrt_run_size;
+  m_halo_width = getKernelParam("halo_width", 1);
+  m_num_vars   = getKernelParam("num_vars", 3);
+
+  // the messages to all neighbors hold every halo piece once, however the
+  // pieces are grouped by neighbor rank
+  m_message_len = 0;
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    m_message_len += m_num_vars *
+        halo_extent(neighbor_offsets[l], m_grid_dims, m_halo_width);
+  }
+
+  setActualProblemSize( m_grid_dims[0] * m_grid_dims[1] * m_grid_dims[2] );
+
+  setItsPerRep( m_message_len );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_message_len );
+  setFLOPsPerRep(0);
+
+  setHasPattern(GatherScatter);
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+NEIGHBOR_ALLTOALLV::~NEIGHBOR_ALLTOALLV()
+{
+}
+
+void NEIGHBOR_ALLTOALLV::addExchangeTuningNames(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  addVariantTuningName(vid, "ineighbor");
+}
+
+void NEIGHBOR_ALLTOALLV::setSeqTuningDefinitions(VariantID vid)
+{
+  addExchangeTuningNames(vid);
+}
+
+void NEIGHBOR_ALLTOALLV::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addExchangeTuningNames(vid);
+}
+
+void NEIGHBOR_ALLTOALLV::setCudaTuningDefinitions(VariantID vid)
+{
+  addExchangeTuningNames(vid);
+}
+
+void NEIGHBOR_ALLTOALLV::setHipTuningDefinitions(VariantID vid)
+{
+  addExchangeTuningNames(vid);
+}
+
+void NEIGHBOR_ALLTOALLV::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  create_neighbor_comm();
+
+  allocAndInitData(m_send, m_message_len, vid);
+  allocAndInitDataConst(m_recv, m_message_len, 0.0, vid);
+
+  //
+  // Messages go through host buffers unless MPI can use the kernel data
+  // space directly.
+  //
+  const DataSpace buffer_space = getHostAccessibleDataSpace(vid);
+  m_separate_buffers = !run_params.getMPIGPUAware() &&
+                       (getDataSpace(vid) != buffer_space);
+
+  if (m_separate_buffers) {
+    allocData(buffer_space, m_send_buffer, m_message_len);
+    allocData(buffer_space, m_recv_buffer, m_message_len);
+  } else {
+    m_send_buffer = m_send;
+    m_recv_buffer = m_recv;
+  }
+}
+
+void NEIGHBOR_ALLTOALLV::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_recv, m_message_len, vid);
+}
+
+void NEIGHBOR_ALLTOALLV::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  if (m_separate_buffers) {
+    const DataSpace buffer_space = getHostAccessibleDataSpace(vid);
+    deallocData(buffer_space, m_send_buffer);
+    deallocData(buffer_space, m_recv_buffer);
+  }
+  m_send_buffer = nullptr;
+  m_recv_buffer = nullptr;
+
+  deallocData(m_send, vid);
+  deallocData(m_recv, vid);
+
+  MPI_Comm_free(&m_neighbor_comm);
+  m_displs.clear();
+  m_counts.clear();
+  m_neighbor_ranks.clear();
+}
+
+//
+// Create the graph communicator of the distinct neighbor ranks, the
+// message to a rank holds the halo pieces of all offsets leading to it.
+// The offsets from a neighbor back to this rank are the negated offsets,
+// which have the same halo extents, so the message lengths each way match.
+//
+void NEIGHBOR_ALLTOALLV::create_neighbor_comm()
+{
+  int num_ranks = 1;
+  int my_mpi_rank = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_mpi_rank);
+
+  int mpi_dims[3] = {0, 0, 0};
+  MPI_Dims_create(num_ranks, 3, mpi_dims);
+
+  int my_coords[3] = { my_mpi_rank % mpi_dims[0],
+                       (my_mpi_rank / mpi_dims[0]) % mpi_dims[1],
+                       my_mpi_rank / (mpi_dims[0] * mpi_dims[1]) };
+
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+
+    // periodic in each dimension
+    int coords[3];
+    for (int d = 0; d < 3; ++d) {
+      coords[d] = (my_coords[d] + neighbor_offsets[l][d] + mpi_dims[d]) % mpi_dims[d];
+    }
+    const int rank = (coords[2] * mpi_dims[1] + coords[1]) * mpi_dims[0] + coords[0];
+    const int count = static_cast<int>(m_num_vars *
+        halo_extent(neighbor_offsets[l], m_grid_dims, m_halo_width));
+
+    auto found = std::find(m_neighbor_ranks.begin(), m_neighbor_ranks.end(), rank);
+    if (found == m_neighbor_ranks.end()) {
+      m_neighbor_ranks.emplace_back(rank);
+      m_counts.emplace_back(count);
+    } else {
+      m_counts[found - m_neighbor_ranks.begin()] += count;
+    }
+  }
+
+  m_displs.resize(m_counts.size(), 0);
+  for (size_t n = 1; n < m_counts.size(); ++n) {
+    m_displs[n] = m_displs[n-1] + m_counts[n-1];
+  }
+
+  const int num_neighbor_ranks = static_cast<int>(m_neighbor_ranks.size());
+  MPI_Dist_graph_create_adjacent(MPI_COMM_WORLD,
+      num_neighbor_ranks, m_neighbor_ranks.data(), MPI_UNWEIGHTED,
+      num_neighbor_ranks, m_neighbor_ranks.data(), MPI_UNWEIGHTED,
+      MPI_INFO_NULL, 0 /*reorder*/, &m_neighbor_comm);
+}
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
@@ -0,0 +1,146 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// NEIGHBOR_ALLTOALLV kernel reference implementation:
+///
+/// MPI_Neighbor_alltoallv(send, counts, displs, Real_MPI_type,
+///                        recv, counts, displs, Real_MPI_type,
+///                        neighbor_comm);
+///
+/// Ranks are arranged in a periodic 3d grid like Apps_MPI_HALOEXCHANGE and
+/// neighbor_comm is a distributed graph communicator connecting each rank
+/// to the distinct ranks of its 26 neighbors. The message to a neighbor
+/// holds the halo of each of the kernel parameter "num_vars" variables on
+/// the local grid for each of the faces, edges, and corners shared with
+/// that neighbor, "halo_width" deep, so message sizes differ by neighbor.
+///
+/// The default tuning uses MPI_Neighbor_alltoallv, the ineighbor tuning
+/// MPI_Ineighbor_alltoallv and MPI_Wait. The Base Seq and OpenMP variants
+/// exchange host buffers. The Base GPU variants exchange device buffers,
+/// which are copied through host buffers unless run with '--mpi-gpu-aware'.
+///
+
+#ifndef RAJAPerf_Comm_NEIGHBOR_ALLTOALLV_HPP
+#define RAJAPerf_Comm_NEIGHBOR_ALLTOALLV_HPP
+
+#define NEIGHBOR_ALLTOALLV_DATA_SETUP \
+  Real_ptr send = m_send; \
+  Real_ptr recv = m_recv; \
+  Real_ptr send_buffer = m_send_buffer; \
+  Real_ptr recv_buffer = m_recv_buffer; \
+  const Index_type len = m_message_len; \
+\
+  const int* counts = m_counts.data(); \
+  const int* displs = m_displs.data(); \
+  MPI_Comm neighbor_comm = m_neighbor_comm; \
+\
+  const bool separate_buffers = m_separate_buffers; \
+  const DataSpace data_space = getDataSpace(vid); \
+  const DataSpace buffer_space = getHostAccessibleDataSpace(vid);
+
+//
+// Exchange the messages with all neighbors, blocking or nonblocking, going
+// through the host buffers if they are separate.
+//
+#define NEIGHBOR_ALLTOALLV_BODY(nonblocking) \
+  if (separate_buffers) { \
+    copyData(buffer_space, send_buffer, data_space, send, len); \
+  } \
+  if (nonblocking) { \
+    MPI_Request request; \
+    MPI_Ineighbor_alltoallv(send_buffer, counts, displs, Real_MPI_type, \
+                            recv_buffer, counts, displs, Real_MPI_type, \
+                            neighbor_comm, &request); \
+    MPI_Wait(&request, MPI_STATUS_IGNORE); \
+  } else { \
+    MPI_Neighbor_alltoallv(send_buffer, counts, displs, Real_MPI_type, \
+                           recv_buffer, counts, displs, Real_MPI_type, \
+                           neighbor_comm); \
+  } \
+  if (separate_buffers) { \
+    copyData(data_space, recv, buffer_space, recv_buffer, len); \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <vector>
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace comm
+{
+
+class NEIGHBOR_ALLTOALLV : public KernelBase
+{
+public:
+
+  NEIGHBOR_ALLTOALLV(const RunParams& params);
+
+  ~NEIGHBOR_ALLTOALLV();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  NEIGHBOR_ALLTOALLV : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+private:
+  void addExchangeTuningNames(VariantID vid);
+
+  // the default tuning is blocking, the ineighbor tuning nonblocking
+  bool getTuningNonblocking(size_t tune_idx) const
+  {
+    return (tune_idx % 2) == 1;
+  }
+
+  void create_neighbor_comm();
+
+  static const int s_num_neighbors = 26;
+
+  Index_type m_grid_dims[3];
+  Index_type m_halo_width;
+  Index_type m_num_vars;
+
+  std::vector<int> m_neighbor_ranks; // distinct ranks of the neighbors
+  std::vector<int> m_counts;         // message length of each neighbor
+  std::vector<int> m_displs;         // message offset of each neighbor
+  Index_type m_message_len;          // sum of the message lengths
+  MPI_Comm m_neighbor_comm;
+
+  bool m_separate_buffers;
+
+  Real_ptr m_send;
+  Real_ptr m_recv;
+  Real_ptr m_send_buffer;
+  Real_ptr m_recv_buffer;
+};
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,277 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ActivityUtils.hpp"
+
+#if defined(RAJA_PERFSUITE_USE_CUPTI)
+#include <cupti.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_ROCTRACER)
+#include <roctracer/roctracer.h>
+#include <roctracer/roctracer_hip.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+namespace
+{
+
+bool activity_initialized = false;
+
+//
+// Start and end timestamps in ns of the device operations delivered by the
+// tracing library since the region started. Records are delivered from a
+// thread of the tracing library, so they are guarded by a mutex.
+//
+std::mutex activity_mutex;
+std::vector<std::pair<uint64_t, uint64_t>> activity_intervals;
+
+uint64_t region_start = 0;
+
+void addInterval(uint64_t start, uint64_t end)
+{
+  std::lock_guard<std::mutex> lock(activity_mutex);
+  activity_intervals.emplace_back(start, end);
+}
+
+#if defined(RAJA_PERFSUITE_USE_CUPTI)
+const size_t activity_buffer_bytes = 8 * 1024 * 1024;
+
+void cuptiCheck(CUptiResult result, const char* call)
+{
+  if (result != CUPTI_SUCCESS) {
+    const char* msg = nullptr;
+    cuptiGetResultString(result, &msg);
+    throw std::runtime_error(std::string("CUPTI ") + call + " failed: " +
+                             (msg != nullptr ? msg : "unknown error"));
+  }
+}
+
+void CUPTIAPI bufferRequested(uint8_t** buffer, size_t* size,
+                              size_t* max_num_records)
+{
+  // malloc alignment satisfies the 8 byte alignment CUPTI requires
+  *buffer = static_cast<uint8_t*>(std::malloc(activity_buffer_bytes));
+  *size = (*buffer != nullptr) ? activity_buffer_bytes : 0;
+  *max_num_records = 0;
+}
+
+void CUPTIAPI bufferCompleted(CUcontext, uint32_t, uint8_t* buffer,
+                              size_t, size_t valid_size)
+{
+  CUpti_Activity* record = nullptr;
+  while (cuptiActivityGetNextRecord(buffer, valid_size, &record) == CUPTI_SUCCESS) {
+    switch (record->kind) {
+      case CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL : {
+        CUpti_ActivityKernel4* kernel =
+            reinterpret_cast<CUpti_ActivityKernel4*>(record);
+        addInterval(kernel->start, kernel->end);
+        break;
+      }
+      case CUPTI_ACTIVITY_KIND_MEMCPY : {
+        CUpti_ActivityMemcpy* copy =
+            reinterpret_cast<CUpti_ActivityMemcpy*>(record);
+        addInterval(copy->start, copy->end);
+        break;
+      }
+      case CUPTI_ACTIVITY_KIND_MEMSET : {
+        CUpti_ActivityMemset* set =
+            reinterpret_cast<CUpti_ActivityMemset*>(record);
+        addInterval(set->start, set->end);
+        break;
+      }
+      default : break;
+    }
+  }
+  std::free(buffer);
+}
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_ROCTRACER)
+void roctracerCheck(roctracer_status_t status, const char* call)
+{
+  if (status != ROCTRACER_STATUS_SUCCESS) {
+    throw std::runtime_error(std::string("roctracer ") + call + " failed: " +
+                             roctracer_error_string());
+  }
+}
+
+void activityCallback(const char* begin, const char* end, void*)
+{
+  const roctracer_record_t* record =
+      reinterpret_cast<const roctracer_record_t*>(begin);
+  const roctracer_record_t* end_record =
+      reinterpret_cast<const roctracer_record_t*>(end);
+  while (record < end_record) {
+    // barrier and marker packets are not device work
+    if (record->op != HIP_OP_ID_BARRIER) {
+      addInterval(record->begin_ns, record->end_ns);
+    }
+    if (roctracer_next_record(record, &record) != ROCTRACER_STATUS_SUCCESS) {
+      break;
+    }
+  }
+}
+#endif
+
+uint64_t getActivityTimestamp()
+{
+  uint64_t timestamp = 0;
+#if defined(RAJA_PERFSUITE_USE_CUPTI)
+  cuptiGetTimestamp(&timestamp);
+#elif defined(RAJA_PERFSUITE_USE_ROCTRACER)
+  roctracer_timestamp_t rt_timestamp = 0;
+  roctracer_get_timestamp(&rt_timestamp);
+  timestamp = rt_timestamp;
+#endif
+  return timestamp;
+}
+
+void flushActivity()
+{
+#if defined(RAJA_PERFSUITE_USE_CUPTI)
+  cuptiActivityFlushAll(0);
+#elif defined(RAJA_PERFSUITE_USE_ROCTRACER)
+  roctracer_flush_activity();
+#endif
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Start tracing device activity.
+ */
+void initActivityTracing()
+{
+  if (activity_initialized) {
+    return;
+  }
+#if defined(RAJA_PERFSUITE_USE_CUPTI)
+  cuptiCheck( cuptiActivityRegisterCallbacks(bufferRequested, bufferCompleted),
+              "cuptiActivityRegisterCallbacks" );
+  cuptiCheck( cuptiActivityEnable(CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL),
+              "cuptiActivityEnable(CONCURRENT_KERNEL)" );
+  cuptiCheck( cuptiActivityEnable(CUPTI_ACTIVITY_KIND_MEMCPY),
+              "cuptiActivityEnable(MEMCPY)" );
+  cuptiCheck( cuptiActivityEnable(CUPTI_ACTIVITY_KIND_MEMSET),
+              "cuptiActivityEnable(MEMSET)" );
+  activity_initialized = true;
+#elif defined(RAJA_PERFSUITE_USE_ROCTRACER)
+  roctracer_properties_t properties{};
+  properties.buffer_size = 8 * 1024 * 1024;
+  properties.buffer_callback_fun = activityCallback;
+  roctracerCheck( roctracer_open_pool(&properties), "roctracer_open_pool" );
+  roctracerCheck( roctracer_enable_domain_activity(ACTIVITY_DOMAIN_HIP_OPS),
+                  "roctracer_enable_domain_activity" );
+  activity_initialized = true;
+#else
+  throw std::runtime_error("device activity tracing requires building with "
+                           "RAJA_PERFSUITE_USE_CUPTI or "
+                           "RAJA_PERFSUITE_USE_ROCTRACER");
+#endif
+}
+
+/*
+ * Stop tracing device activity.
+ */
+void finalizeActivityTracing()
+{
+  if (!activity_initialized) {
+    return;
+  }
+#if defined(RAJA_PERFSUITE_USE_CUPTI)
+  cuptiActivityFlushAll(0);
+  cuptiActivityDisable(CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL);
+  cuptiActivityDisable(CUPTI_ACTIVITY_KIND_MEMCPY);
+  cuptiActivityDisable(CUPTI_ACTIVITY_KIND_MEMSET);
+#elif defined(RAJA_PERFSUITE_USE_ROCTRACER)
+  roctracer_disable_domain_activity(ACTIVITY_DOMAIN_HIP_OPS);
+  roctracer_flush_activity();
+  roctracer_close_pool();
+#endif
+  activity_initialized = false;
+}
+
+bool haveActivityTracing()
+{
+  return activity_initialized;
+}
+
+/*
+ * Drop the records of earlier regions and note the start of this one.
+ */
+void startActivityRegion()
+{
+  flushActivity();
+  {
+    std::lock_guard<std::mutex> lock(activity_mutex);
+    activity_intervals.clear();
+  }
+  region_start = getActivityTimestamp();
+}
+
+/*
+ * The busy time is the length of the union of the operation intervals
+ * clipped to the region, so operations overlapping on several streams are
+ * counted once.
+ */
+DeviceActivity stopActivityRegion(
+    std::vector<std::pair<double, double>>* op_times)
+{
+  const uint64_t region_end = getActivityTimestamp();
+  flushActivity();
+
+  std::vector<std::pair<uint64_t, uint64_t>> intervals;
+  {
+    std::lock_guard<std::mutex> lock(activity_mutex);
+    intervals.swap(activity_intervals);
+  }
+
+  DeviceActivity activity{0.0, 0};
+  std::sort(intervals.begin(), intervals.end());
+
+  uint64_t busy_ns = 0;
+  uint64_t covered_end = region_start;
+  for (const std::pair<uint64_t, uint64_t>& interval : intervals) {
+    const uint64_t start = std::max(interval.first, region_start);
+    const uint64_t end = std::min(interval.second, region_end);
+    if (end <= start) {
+      continue;
+    }
+    activity.num_ops++;
+    if (op_times) {
+      op_times->emplace_back(static_cast<double>(start - region_start) * 1.0e-9,
+                             static_cast<double>(end - region_start) * 1.0e-9);
+    }
+    if (end > covered_end) {
+      busy_ns += end - std::max(start, covered_end);
+      covered_end = end;
+    }
+  }
+
+  activity.busy_time = static_cast<double>(busy_ns) * 1.0e-9;
+  return activity;
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
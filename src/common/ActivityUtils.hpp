@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for tracing GPU activity, the kernels, copies, and memsets the
+/// device runs, in timed kernel regions.
+///
+/// Activity records are collected with the CUPTI activity API when the
+/// suite is built with RAJA_PERFSUITE_USE_CUPTI and with roctracer when
+/// the suite is built with RAJA_PERFSUITE_USE_ROCTRACER. The part of the
+/// timed region the device was not busy is the host side time, ie. launch
+/// overhead and host objects made in the rep loop.
+///
+
+#ifndef RAJAPerf_ActivityUtils_HPP
+#define RAJAPerf_ActivityUtils_HPP
+
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Device activity in a region, the time the device was busy with
+ * any operation, overlapping operations are counted once.
+ */
+struct DeviceActivity
+{
+  double busy_time;  // seconds
+  long num_ops;      // kernels, copies, and memsets
+};
+
+/*!
+ * \brief Start tracing device activity.
+ *
+ * Throws std::runtime_error if the suite was built without a tracing
+ * library or tracing can not be enabled.
+ */
+void initActivityTracing();
+
+/*!
+ * \brief Stop tracing device activity.
+ */
+void finalizeActivityTracing();
+
+/*!
+ * \brief Return true if device activity is being traced.
+ */
+bool haveActivityTracing();
+
+/*!
+ * \brief Start a region, activity before it is not counted.
+ */
+void startActivityRegion();
+
+/*!
+ * \brief End the region started last and return the activity in it. The
+ * device must be synchronized before the region ends.
+ *
+ * If op_times is given it is set to the start and end times of each
+ * operation in the region, in seconds since the region started.
+ */
+DeviceActivity stopActivityRegion(
+    std::vector<std::pair<double, double>>* op_times = nullptr);
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
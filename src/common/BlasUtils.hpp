@@ -0,0 +1,297 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Float and double overloads of the vendor BLAS routines used by the
+/// cblas, cublas, and rocblas tunings, so typed kernels call the routine
+/// of their element type.
+///
+/// The CBLAS overloads take row major matrices like the kernels. cuBLAS
+/// and rocBLAS are column major, so callers pass the transposed operation
+/// for a row major matrix. Sbmv with a bandwidth of 0 is the elementwise
+/// product y = alpha * d * x + beta * y of the vectors d and x.
+///
+
+#ifndef RAJAPerf_BlasUtils_HPP
+#define RAJAPerf_BlasUtils_HPP
+
+#include "RAJA/config.hpp"
+
+#include "common/RPTypes.hpp"
+
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+#if defined(RAJA_PERFSUITE_USE_MKL_CBLAS)
+#include <mkl_cblas.h>
+#else
+#include <cblas.h>
+#endif
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS) && defined(RAJA_ENABLE_CUDA)
+#include <cublas_v2.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS) && defined(RAJA_ENABLE_HIP)
+#include <rocblas/rocblas.h>
+#endif
+
+namespace rajaperf
+{
+
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+inline void cblasAxpy(Index_type n, float a, const float* x, float* y)
+{
+  cblas_saxpy(static_cast<int>(n), a, x, 1, y, 1);
+}
+inline void cblasAxpy(Index_type n, double a, const double* x, double* y)
+{
+  cblas_daxpy(static_cast<int>(n), a, x, 1, y, 1);
+}
+
+inline float cblasDot(Index_type n, const float* x, const float* y)
+{
+  return cblas_sdot(static_cast<int>(n), x, 1, y, 1);
+}
+inline double cblasDot(Index_type n, const double* x, const double* y)
+{
+  return cblas_ddot(static_cast<int>(n), x, 1, y, 1);
+}
+
+inline void cblasCopy(Index_type n, const float* x, float* y)
+{
+  cblas_scopy(static_cast<int>(n), x, 1, y, 1);
+}
+inline void cblasCopy(Index_type n, const double* x, double* y)
+{
+  cblas_dcopy(static_cast<int>(n), x, 1, y, 1);
+}
+
+inline void cblasScal(Index_type n, float a, float* x)
+{
+  cblas_sscal(static_cast<int>(n), a, x, 1);
+}
+inline void cblasScal(Index_type n, double a, double* x)
+{
+  cblas_dscal(static_cast<int>(n), a, x, 1);
+}
+
+/*!
+ * \brief y = alpha * op(A) * x + beta * y with A a row major m x n matrix.
+ */
+inline void cblasGemv(bool trans, Index_type m, Index_type n,
+                      float alpha, const float* A, const float* x,
+                      float beta, float* y)
+{
+  cblas_sgemv(CblasRowMajor, trans ? CblasTrans : CblasNoTrans,
+              static_cast<int>(m), static_cast<int>(n),
+              alpha, A, static_cast<int>(n), x, 1, beta, y, 1);
+}
+inline void cblasGemv(bool trans, Index_type m, Index_type n,
+                      double alpha, const double* A, const double* x,
+                      double beta, double* y)
+{
+  cblas_dgemv(CblasRowMajor, trans ? CblasTrans : CblasNoTrans,
+              static_cast<int>(m), static_cast<int>(n),
+              alpha, A, static_cast<int>(n), x, 1, beta, y, 1);
+}
+
+inline void cblasSbmv(Index_type n, float alpha, const float* d,
+                      const float* x, float beta, float* y)
+{
+  cblas_ssbmv(CblasRowMajor, CblasUpper, static_cast<int>(n), 0,
+              alpha, d, 1, x, 1, beta, y, 1);
+}
+inline void cblasSbmv(Index_type n, double alpha, const double* d,
+                      const double* x, double beta, double* y)
+{
+  cblas_dsbmv(CblasRowMajor, CblasUpper, static_cast<int>(n), 0,
+              alpha, d, 1, x, 1, beta, y, 1);
+}
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS) && defined(RAJA_ENABLE_CUDA)
+inline cublasStatus_t cublasAxpy(cublasHandle_t handle, Index_type n,
+                                 const float* a, const float* x, float* y)
+{
+  return cublasSaxpy(handle, static_cast<int>(n), a, x, 1, y, 1);
+}
+inline cublasStatus_t cublasAxpy(cublasHandle_t handle, Index_type n,
+                                 const double* a, const double* x, double* y)
+{
+  return cublasDaxpy(handle, static_cast<int>(n), a, x, 1, y, 1);
+}
+
+inline cublasStatus_t cublasDot(cublasHandle_t handle, Index_type n,
+                                const float* x, const float* y, float* result)
+{
+  return cublasSdot(handle, static_cast<int>(n), x, 1, y, 1, result);
+}
+inline cublasStatus_t cublasDot(cublasHandle_t handle, Index_type n,
+                                const double* x, const double* y, double* result)
+{
+  return cublasDdot(handle, static_cast<int>(n), x, 1, y, 1, result);
+}
+
+/*!
+ * \brief C = alpha * A + beta * B with A, B, and C column major m x n
+ * matrices with leading dimension m.
+ */
+inline cublasStatus_t cublasGeam(cublasHandle_t handle,
+                                 Index_type m, Index_type n,
+                                 const float* alpha, const float* A,
+                                 const float* beta, const float* B,
+                                 float* C)
+{
+  const int ld = static_cast<int>(m);
+  return cublasSgeam(handle, CUBLAS_OP_N, CUBLAS_OP_N,
+                     static_cast<int>(m), static_cast<int>(n),
+                     alpha, A, ld, beta, B, ld, C, ld);
+}
+inline cublasStatus_t cublasGeam(cublasHandle_t handle,
+                                 Index_type m, Index_type n,
+                                 const double* alpha, const double* A,
+                                 const double* beta, const double* B,
+                                 double* C)
+{
+  const int ld = static_cast<int>(m);
+  return cublasDgeam(handle, CUBLAS_OP_N, CUBLAS_OP_N,
+                     static_cast<int>(m), static_cast<int>(n),
+                     alpha, A, ld, beta, B, ld, C, ld);
+}
+
+/*!
+ * \brief y = alpha * op(A) * x + beta * y with A a column major m x n
+ * matrix with leading dimension m.
+ */
+inline cublasStatus_t cublasGemv(cublasHandle_t handle, cublasOperation_t op,
+                                 Index_type m, Index_type n,
+                                 const float* alpha, const float* A,
+                                 const float* x, const float* beta, float* y)
+{
+  return cublasSgemv(handle, op, static_cast<int>(m), static_cast<int>(n),
+                     alpha, A, static_cast<int>(m), x, 1, beta, y, 1);
+}
+inline cublasStatus_t cublasGemv(cublasHandle_t handle, cublasOperation_t op,
+                                 Index_type m, Index_type n,
+                                 const double* alpha, const double* A,
+                                 const double* x, const double* beta, double* y)
+{
+  return cublasDgemv(handle, op, static_cast<int>(m), static_cast<int>(n),
+                     alpha, A, static_cast<int>(m), x, 1, beta, y, 1);
+}
+
+inline cublasStatus_t cublasSbmv(cublasHandle_t handle, Index_type n,
+                                 const float* alpha, const float* d,
+                                 const float* x, const float* beta, float* y)
+{
+  return cublasSsbmv(handle, CUBLAS_FILL_MODE_UPPER, static_cast<int>(n), 0,
+                     alpha, d, 1, x, 1, beta, y, 1);
+}
+inline cublasStatus_t cublasSbmv(cublasHandle_t handle, Index_type n,
+                                 const double* alpha, const double* d,
+                                 const double* x, const double* beta, double* y)
+{
+  return cublasDsbmv(handle, CUBLAS_FILL_MODE_UPPER, static_cast<int>(n), 0,
+                     alpha, d, 1, x, 1, beta, y, 1);
+}
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS) && defined(RAJA_ENABLE_HIP)
+inline rocblas_status rocblasAxpy(rocblas_handle handle, Index_type n,
+                                  const float* a, const float* x, float* y)
+{
+  return rocblas_saxpy(handle, static_cast<rocblas_int>(n), a, x, 1, y, 1);
+}
+inline rocblas_status rocblasAxpy(rocblas_handle handle, Index_type n,
+                                  const double* a, const double* x, double* y)
+{
+  return rocblas_daxpy(handle, static_cast<rocblas_int>(n), a, x, 1, y, 1);
+}
+
+inline rocblas_status rocblasDot(rocblas_handle handle, Index_type n,
+                                 const float* x, const float* y, float* result)
+{
+  return rocblas_sdot(handle, static_cast<rocblas_int>(n), x, 1, y, 1, result);
+}
+inline rocblas_status rocblasDot(rocblas_handle handle, Index_type n,
+                                 const double* x, const double* y, double* result)
+{
+  return rocblas_ddot(handle, static_cast<rocblas_int>(n), x, 1, y, 1, result);
+}
+
+/*!
+ * \brief C = alpha * A + beta * B with A, B, and C column major m x n
+ * matrices with leading dimension m.
+ */
+inline rocblas_status rocblasGeam(rocblas_handle handle,
+                                  Index_type m, Index_type n,
+                                  const float* alpha, const float* A,
+                                  const float* beta, const float* B,
+                                  float* C)
+{
+  const rocblas_int ld = static_cast<rocblas_int>(m);
+  return rocblas_sgeam(handle, rocblas_operation_none, rocblas_operation_none,
+                       static_cast<rocblas_int>(m), static_cast<rocblas_int>(n),
+                       alpha, A, ld, beta, B, ld, C, ld);
+}
+inline rocblas_status rocblasGeam(rocblas_handle handle,
+                                  Index_type m, Index_type n,
+                                  const double* alpha, const double* A,
+                                  const double* beta, const double* B,
+                                  double* C)
+{
+  const rocblas_int ld = static_cast<rocblas_int>(m);
+  return rocblas_dgeam(handle, rocblas_operation_none, rocblas_operation_none,
+                       static_cast<rocblas_int>(m), static_cast<rocblas_int>(n),
+                       alpha, A, ld, beta, B, ld, C, ld);
+}
+
+/*!
+ * \brief y = alpha * op(A) * x + beta * y with A a column major m x n
+ * matrix with leading dimension m.
+ */
+inline rocblas_status rocblasGemv(rocblas_handle handle, rocblas_operation op,
+                                  Index_type m, Index_type n,
+                                  const float* alpha, const float* A,
+                                  const float* x, const float* beta, float* y)
+{
+  return rocblas_sgemv(handle, op,
+                       static_cast<rocblas_int>(m), static_cast<rocblas_int>(n),
+                       alpha, A, static_cast<rocblas_int>(m), x, 1, beta, y, 1);
+}
+inline rocblas_status rocblasGemv(rocblas_handle handle, rocblas_operation op,
+                                  Index_type m, Index_type n,
+                                  const double* alpha, const double* A,
+                                  const double* x, const double* beta, double* y)
+{
+  return rocblas_dgemv(handle, op,
+                       static_cast<rocblas_int>(m), static_cast<rocblas_int>(n),
+                       alpha, A, static_cast<rocblas_int>(m), x, 1, beta, y, 1);
+}
+
+inline rocblas_status rocblasSbmv(rocblas_handle handle, Index_type n,
+                                  const float* alpha, const float* d,
+                                  const float* x, const float* beta, float* y)
+{
+  return rocblas_ssbmv(handle, rocblas_fill_upper,
+                       static_cast<rocblas_int>(n), 0,
+                       alpha, d, 1, x, 1, beta, y, 1);
+}
+inline rocblas_status rocblasSbmv(rocblas_handle handle, Index_type n,
+                                  const double* alpha, const double* d,
+                                  const double* x, const double* beta, double* y)
+{
+  return rocblas_dsbmv(handle, rocblas_fill_upper,
+                       static_cast<rocblas_int>(n), 0,
+                       alpha, d, 1, x, 1, beta, y, 1);
+}
+#endif
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,166 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CounterUtils.hpp"
+
+#if defined(RAJA_PERFSUITE_USE_PAPI)
+#include <papi.h>
+#endif
+
+#include <map>
+#include <stdexcept>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+#if defined(RAJA_PERFSUITE_USE_PAPI)
+
+/*!
+ * \brief PAPI event set and the index of the counter for each of its events.
+ *
+ * PAPI event sets may only hold events of one component, so events of
+ * each component (cpu, cuda, rocm, ...) are counted in a separate set.
+ */
+struct CounterEventSet
+{
+  int event_set;
+  std::vector<size_t> counter_idx;
+};
+
+static std::vector<CounterEventSet> counter_event_sets;
+
+static std::string getPapiErrorString(const std::string& where, int ret)
+{
+  return where + " : " + PAPI_strerror(ret);
+}
+
+#endif
+
+static size_t num_counters = 0;
+
+/*
+ * Initialize counter collection for the given event names.
+ */
+void initCounters(const std::vector<std::string>& event_names)
+{
+  if (event_names.empty()) {
+    return;
+  }
+
+#if defined(RAJA_PERFSUITE_USE_PAPI)
+  int ret = PAPI_library_init(PAPI_VER_CURRENT);
+  if (ret != PAPI_VER_CURRENT) {
+    throw std::runtime_error(getPapiErrorString("initCounters : PAPI_library_init", ret));
+  }
+
+  std::map<int, size_t> component_set_idx;
+
+  for (size_t ic = 0; ic < event_names.size(); ++ic) {
+    int code = PAPI_NULL;
+    ret = PAPI_event_name_to_code(const_cast<char*>(event_names[ic].c_str()), &code);
+    if (ret != PAPI_OK) {
+      throw std::runtime_error(getPapiErrorString(
+          "initCounters : Unknown event " + event_names[ic], ret));
+    }
+
+    int component = PAPI_get_event_component(code);
+    auto set_idx = component_set_idx.find(component);
+    if (set_idx == component_set_idx.end()) {
+      CounterEventSet counter_event_set{PAPI_NULL, {}};
+      ret = PAPI_create_eventset(&counter_event_set.event_set);
+      if (ret != PAPI_OK) {
+        throw std::runtime_error(getPapiErrorString("initCounters : PAPI_create_eventset", ret));
+      }
+      set_idx = component_set_idx.emplace(component, counter_event_sets.size()).first;
+      counter_event_sets.push_back(counter_event_set);
+    }
+
+    CounterEventSet& counter_event_set = counter_event_sets[set_idx->second];
+    ret = PAPI_add_event(counter_event_set.event_set, code);
+    if (ret != PAPI_OK) {
+      throw std::runtime_error(getPapiErrorString(
+          "initCounters : Can not count event " + event_names[ic], ret));
+    }
+    counter_event_set.counter_idx.push_back(ic);
+  }
+
+  num_counters = event_names.size();
+#else
+  throw std::runtime_error("initCounters : Suite not built with PAPI");
+#endif
+}
+
+/*
+ * Release resources used for counter collection.
+ */
+void finalizeCounters()
+{
+#if defined(RAJA_PERFSUITE_USE_PAPI)
+  if (num_counters == 0) {
+    return;
+  }
+  for (CounterEventSet& counter_event_set : counter_event_sets) {
+    PAPI_cleanup_eventset(counter_event_set.event_set);
+    PAPI_destroy_eventset(&counter_event_set.event_set);
+  }
+  counter_event_sets.clear();
+  PAPI_shutdown();
+#endif
+  num_counters = 0;
+}
+
+/*
+ * Return number of counters collected.
+ */
+size_t getNumCounters()
+{
+  return num_counters;
+}
+
+/*
+ * Start counting on the calling thread.
+ */
+void startCounters()
+{
+#if defined(RAJA_PERFSUITE_USE_PAPI)
+  for (CounterEventSet& counter_event_set : counter_event_sets) {
+    int ret = PAPI_start(counter_event_set.event_set);
+    if (ret != PAPI_OK) {
+      throw std::runtime_error(getPapiErrorString("startCounters : PAPI_start", ret));
+    }
+  }
+#endif
+}
+
+/*
+ * Stop counting and add counts since startCounters to values.
+ */
+void stopCounters(std::vector<long long>& values)
+{
+#if defined(RAJA_PERFSUITE_USE_PAPI)
+  for (CounterEventSet& counter_event_set : counter_event_sets) {
+    std::vector<long long> set_values(counter_event_set.counter_idx.size(), 0);
+    int ret = PAPI_stop(counter_event_set.event_set, set_values.data());
+    if (ret != PAPI_OK) {
+      throw std::runtime_error(getPapiErrorString("stopCounters : PAPI_stop", ret));
+    }
+    for (size_t iv = 0; iv < set_values.size(); ++iv) {
+      values.at(counter_event_set.counter_idx[iv]) += set_values[iv];
+    }
+  }
+#else
+  static_cast<void>(values);
+#endif
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for collecting hardware counters around timed kernel regions.
+///
+/// Counters are collected with PAPI when the suite is built with
+/// RAJA_PERFSUITE_USE_PAPI, otherwise no counters are available.
+/// GPU metrics are available through the PAPI cuda (CUPTI) and
+/// rocm (rocprofiler) components when PAPI is built with them.
+///
+
+#ifndef RAJAPerf_CounterUtils_HPP
+#define RAJAPerf_CounterUtils_HPP
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Initialize counter collection for the given event names.
+ *
+ * Throws std::runtime_error if counters are not available or an event
+ * can not be counted.
+ */
+void initCounters(const std::vector<std::string>& event_names);
+
+/*!
+ * \brief Release resources used for counter collection.
+ */
+void finalizeCounters();
+
+/*!
+ * \brief Return number of counters collected, 0 if none.
+ */
+size_t getNumCounters();
+
+/*!
+ * \brief Start counting on the calling thread.
+ */
+void startCounters();
+
+/*!
+ * \brief Stop counting and add counts since startCounters to values.
+ *
+ * values must have getNumCounters() entries.
+ */
+void stopCounters(std::vector<long long>& values);
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
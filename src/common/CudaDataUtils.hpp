@@ -15,7 +15,9 @@
 #define RAJAPerf_CudaDataUtils_HPP
 
 #include "RPTypes.hpp"
+#include <algorithm>
 #include <stdexcept>
+#include <vector>
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -25,6 +27,14 @@
 #include "RAJA/policy/cuda/policy.hpp"
 #include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
 
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+#include <cublas_v2.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+#include <cufft.h>
+#endif
+
 
 namespace rajaperf
 {
@@ -80,6 +90,108 @@ __global__ void lambda_cuda(Lambda body)
   body();
 }
 
+/*!
+ * \brief Index of item j of the calling thread of a coarsened kernel whose
+ * threads compute items_per_thread items each, contiguous items or items
+ * block_size apart so consecutive threads access consecutive items.
+ */
+template < size_t block_size, size_t items_per_thread, bool strided >
+__device__ __forceinline__ Index_type cuda_coarsened_index(size_t j)
+{
+  return strided
+      ? static_cast<Index_type>(blockIdx.x * block_size * items_per_thread +
+                                j * block_size + threadIdx.x)
+      : static_cast<Index_type>((blockIdx.x * block_size + threadIdx.x) *
+                                items_per_thread + j);
+}
+
+/*!
+ * \brief Number of threads in a cuda warp.
+ */
+constexpr size_t cuda_warp_size = 32;
+
+/*!
+ * \brief Reduce val over the threads of a warp with shuffles using the RAJA
+ * operator Op, the result is valid in lane 0.
+ * Every thread in the warp must call this.
+ */
+template < typename Op, typename T >
+__device__ __forceinline__ T cuda_warp_reduce(T val)
+{
+  for (int offset = cuda_warp_size / 2; offset > 0; offset /= 2) {
+    val = Op{}(val, __shfl_down_sync(0xffffffffu, val, offset));
+  }
+  return val;
+}
+
+/*!
+ * \brief Reduce val over the threads of a block using the RAJA operator Op,
+ * the result is valid in thread 0. Warps reduce with shuffles and the warp
+ * results are combined through shared memory.
+ * Every thread in the block must call this and block_size must be a
+ * multiple of cuda_warp_size.
+ */
+template < size_t block_size, typename Op, typename T >
+__device__ __forceinline__ T cuda_block_reduce(T val)
+{
+  static_assert(block_size % cuda_warp_size == 0,
+                "block_size must be a multiple of the warp size");
+  constexpr size_t num_warps = block_size / cuda_warp_size;
+
+  __shared__ T warp_vals[num_warps];
+
+  const size_t lane = threadIdx.x % cuda_warp_size;
+  const size_t warp = threadIdx.x / cuda_warp_size;
+
+  val = cuda_warp_reduce<Op>(val);
+
+  if (num_warps > 1) {
+    if (lane == 0) {
+      warp_vals[warp] = val;
+    }
+    __syncthreads();
+
+    if (warp == 0) {
+      val = cuda_warp_reduce<Op>( (lane < num_warps) ? warp_vals[lane]
+                                                     : Op::identity() );
+    }
+    // warp_vals may be reused by the next call
+    __syncthreads();
+  }
+
+  return val;
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+/*!
+ * \brief Throw if a cuBLAS call did not succeed.
+ */
+inline void cublasAssert(cublasStatus_t code, const char *file, int line)
+{
+  if (code != CUBLAS_STATUS_SUCCESS) {
+    throw std::runtime_error(std::string("CUBLASassert: status ") +
+                             std::to_string(static_cast<int>(code)) + " " +
+                             file + " " + std::to_string(line));
+  }
+}
+#define cublasErrchk(ans) { ::rajaperf::cublasAssert((ans), __FILE__, __LINE__); }
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+/*!
+ * \brief Throw if a cuFFT call did not succeed.
+ */
+inline void cufftAssert(cufftResult code, const char *file, int line)
+{
+  if (code != CUFFT_SUCCESS) {
+    throw std::runtime_error(std::string("CUFFTassert: result ") +
+                             std::to_string(static_cast<int>(code)) + " " +
+                             file + " " + std::to_string(line));
+  }
+}
+#define cufftErrchk(ans) { ::rajaperf::cufftAssert((ans), __FILE__, __LINE__); }
+#endif
+
 
 namespace detail
 {
@@ -104,6 +216,86 @@ inline cudaDeviceProp getCudaDeviceProp()
   return prop;
 }
 
+/*!
+ * \brief Get if the current cuda device can access memory from the system
+ *        allocator, through HMM or ATS like on Grace Hopper.
+ */
+inline bool haveCudaPageableMemoryAccess()
+{
+  int pageable = 0;
+  cudaErrchk( cudaDeviceGetAttribute(&pageable,
+                                     cudaDevAttrPageableMemoryAccess,
+                                     getCudaDevice()) );
+  return pageable != 0;
+}
+
+/*!
+ * \brief Get if the current cuda device can keep data persisting in L2,
+ *        sm_80 and newer with cuda 11 or newer.
+ */
+inline bool haveCudaL2PersistWindow()
+{
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 11000
+  cudaDeviceProp prop = getCudaDeviceProp();
+  return prop.persistingL2CacheMaxSize > 0 && prop.accessPolicyMaxWindowSize > 0;
+#else
+  return false;
+#endif
+}
+
+/*!
+ * \brief Mark the nbytes at ptr as persisting in L2 for kernels launched on
+ *        stream, the L2 set aside and the window are limited to what the
+ *        device supports.
+ */
+inline void setCudaL2PersistWindow(cudaStream_t stream, const void* ptr,
+                                   size_t nbytes)
+{
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 11000
+  cudaDeviceProp prop = getCudaDeviceProp();
+  const size_t window_nbytes =
+      std::min(nbytes, static_cast<size_t>(prop.accessPolicyMaxWindowSize));
+  const size_t persist_nbytes =
+      std::min(window_nbytes, static_cast<size_t>(prop.persistingL2CacheMaxSize));
+  cudaErrchk( cudaDeviceSetLimit(cudaLimitPersistingL2CacheSize, persist_nbytes) );
+
+  cudaStreamAttrValue attr;
+  attr.accessPolicyWindow.base_ptr = const_cast<void*>(ptr);
+  attr.accessPolicyWindow.num_bytes = window_nbytes;
+  attr.accessPolicyWindow.hitRatio = (window_nbytes > 0)
+      ? std::min(1.0f, static_cast<float>(persist_nbytes) / window_nbytes)
+      : 0.0f;
+  attr.accessPolicyWindow.hitProp = cudaAccessPropertyPersisting;
+  attr.accessPolicyWindow.missProp = cudaAccessPropertyStreaming;
+  cudaErrchk( cudaStreamSetAttribute(stream, cudaStreamAttributeAccessPolicyWindow, &attr) );
+#else
+  RAJA_UNUSED_VAR(stream);
+  RAJA_UNUSED_VAR(ptr);
+  RAJA_UNUSED_VAR(nbytes);
+#endif
+}
+
+/*!
+ * \brief Remove the persisting window of stream and return the persisting
+ *        lines in L2 to normal.
+ */
+inline void resetCudaL2PersistWindow(cudaStream_t stream)
+{
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 11000
+  cudaStreamAttrValue attr;
+  attr.accessPolicyWindow.base_ptr = nullptr;
+  attr.accessPolicyWindow.num_bytes = 0;
+  attr.accessPolicyWindow.hitRatio = 0.0f;
+  attr.accessPolicyWindow.hitProp = cudaAccessPropertyNormal;
+  attr.accessPolicyWindow.missProp = cudaAccessPropertyNormal;
+  cudaErrchk( cudaStreamSetAttribute(stream, cudaStreamAttributeAccessPolicyWindow, &attr) );
+  cudaErrchk( cudaCtxResetPersistingL2Cache() );
+  cudaErrchk( cudaDeviceSetLimit(cudaLimitPersistingL2CacheSize, 0) );
+#else
+  RAJA_UNUSED_VAR(stream);
+#endif
+}
+
 /*!
  * \brief Get max occupancy in blocks for the given kernel for the current
  *        cuda device.
@@ -121,6 +313,105 @@ int getCudaOccupancyMaxBlocks(Func&& func, int num_threads, size_t shmem_size)
   return max_blocks * multiProcessorCount;
 }
 
+/*!
+ * \brief Get if the current cuda device supports cooperative launches, whose
+ *        blocks are all resident at once and may synchronize the grid.
+ */
+inline bool haveCudaCooperativeLaunch()
+{
+  return getCudaDeviceProp().cooperativeLaunch != 0;
+}
+
+/*!
+ * \brief Get if the current cuda device has FP64 tensor cores, sm_80 and
+ *        newer.
+ */
+inline bool haveCudaDoubleMma()
+{
+  return getCudaDeviceProp().major >= 8;
+}
+
+/*!
+ * \brief Get the most shared memory a block may use on the current cuda
+ *        device, including what a kernel must opt into.
+ */
+inline size_t getCudaSharedMemPerBlock()
+{
+  return getCudaDeviceProp().sharedMemPerBlockOptin;
+}
+
+/*!
+ * \brief Get the shared memory of a multiprocessor of the current cuda
+ *        device with the largest shared memory carve-out.
+ */
+inline size_t getCudaSharedMemPerMultiprocessor()
+{
+  return getCudaDeviceProp().sharedMemPerMultiprocessor;
+}
+
+/*!
+ * \brief Set the preferred shared memory carve-out of func, the percent of
+ *        the unified L1 and shared memory of a multiprocessor used as
+ *        shared memory, a hint the driver rounds to a supported size.
+ *        -1 is cudaSharedmemCarveoutDefault and leaves it to the driver.
+ */
+template < typename Func >
+RAJA_INLINE
+void setCudaFuncSharedMemCarveout(Func&& func, int carveout)
+{
+  cudaErrchk( cudaFuncSetAttribute(func,
+      cudaFuncAttributePreferredSharedMemoryCarveout, carveout) );
+}
+
+/*!
+ * \brief Get the registers and local memory per thread, the shared memory
+ *        per block, and the occupancy of the given kernel, called name in
+ *        reports, for the current cuda device launched with num_threads
+ *        threads and shmem_size bytes of dynamic shared memory per block.
+ */
+template < typename Func >
+RAJA_INLINE
+GPUFuncAttributes getCudaFuncAttributes(const std::string& name, Func&& func,
+                                     int num_threads, size_t shmem_size)
+{
+  cudaFuncAttributes func_attrs;
+  cudaErrchk(cudaFuncGetAttributes(&func_attrs, func));
+
+  int max_blocks = 0;
+  cudaErrchk(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &max_blocks, func, num_threads, shmem_size));
+
+  GPUFuncAttributes attrs;
+  attrs.name = name;
+  attrs.num_regs = func_attrs.numRegs;
+  attrs.local_bytes = func_attrs.localSizeBytes;
+  attrs.static_shmem_bytes = func_attrs.sharedSizeBytes;
+  attrs.dynamic_shmem_bytes = shmem_size;
+  attrs.occupancy = static_cast<double>(max_blocks * num_threads) /
+                    getCudaDeviceProp().maxThreadsPerMultiProcessor;
+  return attrs;
+}
+
+/*!
+ * \brief Capture the work body enqueues on stream into an executable graph.
+ *
+ * body must not synchronize stream. Destroy the returned graph with
+ * cudaGraphExecDestroy.
+ */
+template < typename Body >
+inline cudaGraphExec_t captureCudaGraph(cudaStream_t stream, Body&& body)
+{
+  cudaGraph_t graph;
+  cudaErrchk( cudaStreamBeginCapture( stream, cudaStreamCaptureModeThreadLocal ) );
+  body();
+  cudaErrchk( cudaStreamEndCapture( stream, &graph ) );
+
+  cudaGraphExec_t graph_exec;
+  cudaErrchk( cudaGraphInstantiateWithFlags( &graph_exec, graph, 0 ) );
+  cudaErrchk( cudaGraphDestroy( graph ) );
+  return graph_exec;
+}
+
 /*
  * Copy memory len bytes from src to dst.
  */
@@ -140,6 +431,31 @@ inline void* allocCudaDeviceData(size_t len)
   return dptr;
 }
 
+/*!
+ * \brief Set the release threshold of the default memory pool of the
+ * current device, memory the pool holds above it is returned to the
+ * system when the device or a stream synchronizes.
+ */
+inline void setCudaMemPoolReleaseThreshold(size_t nbytes)
+{
+  cudaMemPool_t pool;
+  cudaErrchk( cudaDeviceGetDefaultMemPool( &pool, getCudaDevice() ) );
+  uint64_t threshold = nbytes;
+  cudaErrchk( cudaMemPoolSetAttribute( pool, cudaMemPoolAttrReleaseThreshold,
+                                       &threshold ) );
+}
+
+/*!
+ * \brief Allocate CUDA device data array (dptr) from the default memory pool
+ * of the device, ordered in the legacy default stream.
+ */
+inline void* allocCudaDeviceAsyncData(size_t len)
+{
+  void* dptr = nullptr;
+  cudaErrchk( cudaMallocAsync( &dptr, len, 0 ) );
+  return dptr;
+}
+
 /*!
  * \brief Allocate CUDA managed data array (dptr).
  */
@@ -169,6 +485,15 @@ inline void deallocCudaDeviceData(void* dptr)
   cudaErrchk( cudaFree( dptr ) );
 }
 
+/*!
+ * \brief Free device data array allocated from the default memory pool,
+ * ordered in the legacy default stream.
+ */
+inline void deallocCudaDeviceAsyncData(void* dptr)
+{
+  cudaErrchk( cudaFreeAsync( dptr, 0 ) );
+}
+
 /*!
  * \brief Free managed data array.
  */
@@ -185,6 +510,112 @@ inline void deallocCudaPinnedData(void* pptr)
   cudaErrchk( cudaFreeHost( pptr ) );
 }
 
+/*!
+ * \brief Contiguous chunks of [0, len) owned by each visible CUDA device
+ *        in multi-GPU runs, each device runs its chunk on its own stream.
+ *
+ * Chunk p is [offsets[p], offsets[p+1]) and lives on devices[p].
+ */
+struct CudaPartitions
+{
+  int home_device = -1;
+  std::vector<int> devices;
+  std::vector<cudaStream_t> streams;
+  std::vector<Index_type> offsets;
+};
+
+/*!
+ * \brief Split [0, len) evenly over all visible devices.
+ */
+inline CudaPartitions makeCudaPartitions(Index_type len)
+{
+  CudaPartitions parts;
+  parts.home_device = getCudaDevice();
+
+  int num_devices = 0;
+  cudaErrchk( cudaGetDeviceCount(&num_devices) );
+  parts.offsets.emplace_back(0);
+  for (int p = 0; p < num_devices; ++p) {
+    cudaStream_t stream;
+    cudaErrchk( cudaSetDevice(p) );
+    cudaErrchk( cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking) );
+    parts.devices.emplace_back(p);
+    parts.streams.emplace_back(stream);
+    parts.offsets.emplace_back((len * (p+1)) / num_devices);
+  }
+  cudaErrchk( cudaSetDevice(parts.home_device) );
+  return parts;
+}
+
+/*!
+ * \brief Wait for the streams of all devices.
+ */
+inline void synchronizeCudaPartitions(const CudaPartitions& parts)
+{
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    cudaErrchk( cudaSetDevice(parts.devices[p]) );
+    cudaErrchk( cudaStreamSynchronize(parts.streams[p]) );
+  }
+  cudaErrchk( cudaSetDevice(parts.home_device) );
+}
+
+inline void destroyCudaPartitions(CudaPartitions& parts)
+{
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    cudaErrchk( cudaSetDevice(parts.devices[p]) );
+    cudaErrchk( cudaStreamDestroy(parts.streams[p]) );
+  }
+  cudaErrchk( cudaSetDevice(parts.home_device) );
+  parts.devices.clear();
+  parts.streams.clear();
+  parts.offsets.clear();
+}
+
+/*!
+ * \brief Copy the chunks of ptr to device arrays allocated on the device
+ *        owning each chunk.
+ */
+template < typename T >
+inline std::vector<T*> scatterCudaPartitions(const CudaPartitions& parts, const T* ptr)
+{
+  std::vector<T*> chunks;
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    const size_t nbytes = (parts.offsets[p+1] - parts.offsets[p]) * sizeof(T);
+    cudaErrchk( cudaSetDevice(parts.devices[p]) );
+    T* chunk = static_cast<T*>(allocCudaDeviceData(nbytes));
+    cudaErrchk( cudaMemcpy( chunk, ptr + parts.offsets[p], nbytes,
+                cudaMemcpyDefault ) );
+    chunks.emplace_back(chunk);
+  }
+  cudaErrchk( cudaSetDevice(parts.home_device) );
+  return chunks;
+}
+
+/*!
+ * \brief Copy the device chunks back to ptr.
+ */
+template < typename T >
+inline void gatherCudaPartitions(const CudaPartitions& parts,
+                                 const std::vector<T*>& chunks, T* ptr)
+{
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    const size_t nbytes = (parts.offsets[p+1] - parts.offsets[p]) * sizeof(T);
+    cudaErrchk( cudaMemcpy( ptr + parts.offsets[p], chunks[p], nbytes,
+                cudaMemcpyDefault ) );
+  }
+}
+
+template < typename T >
+inline void freeCudaPartitions(const CudaPartitions& parts, std::vector<T*>& chunks)
+{
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    cudaErrchk( cudaSetDevice(parts.devices[p]) );
+    deallocCudaDeviceData(chunks[p]);
+  }
+  cudaErrchk( cudaSetDevice(parts.home_device) );
+  chunks.clear();
+}
+
 }  // closing brace for detail namespace
 
 }  // closing brace for rajaperf namespace
@@ -0,0 +1,77 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Macros for kernels templated on element data type.
+///
+/// Such kernels call setUsesDataTypes, or setUsesFloatingPointDataTypes,
+/// in their constructor and implement templated methods taking the element
+/// type as template argument, which are called with the type of the
+/// DataType of each tuning.
+///
+
+#ifndef RAJAPerf_DataTypeUtils_HPP
+#define RAJAPerf_DataTypeUtils_HPP
+
+#include "common/RAJAPerfSuite.hpp"
+#include "common/RPTypes.hpp"
+
+#include <iostream>
+
+//
+// Call func<T>(...) with T the element type of data_type.
+//
+#define RAJAPERF_DATA_TYPE_DISPATCH(data_type, func, ...)                     \
+  switch ( data_type ) {                                                       \
+    case ::rajaperf::DataType::Int32 :                                         \
+      func< ::rajaperf::Int32_type >(__VA_ARGS__); break;                      \
+    case ::rajaperf::DataType::Int64 :                                         \
+      func< ::rajaperf::Int64_type >(__VA_ARGS__); break;                      \
+    case ::rajaperf::DataType::Float :                                         \
+      func< ::rajaperf::Float_type >(__VA_ARGS__); break;                      \
+    case ::rajaperf::DataType::Double :                                        \
+      func< ::rajaperf::Double_type >(__VA_ARGS__); break;                     \
+    default :                                                                  \
+      getCout() << "\n  " << getName() << " : Unknown data type = "            \
+                << static_cast<int>(data_type) << std::endl;                   \
+  }
+
+//
+// Call func<T>(...) with T the element type of floating point data_type.
+//
+#define RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(data_type, func, ...)      \
+  switch ( data_type ) {                                                       \
+    case ::rajaperf::DataType::Float :                                         \
+      func< ::rajaperf::Float_type >(__VA_ARGS__); break;                      \
+    case ::rajaperf::DataType::Double :                                        \
+      func< ::rajaperf::Double_type >(__VA_ARGS__); break;                     \
+    default :                                                                  \
+      getCout() << "\n  " << getName() << " : Unknown data type = "            \
+                << static_cast<int>(data_type) << std::endl;                   \
+  }
+
+//
+// Define run<variant>Variant to call run<variant>VariantTyped<T> with the
+// element type of the data type of the tuning and the index of the tuning
+// among the tunings of that data type.
+//
+#define RAJAPERF_DATA_TYPE_RUN_BOILERPLATE(kernel, variant)                    \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    RAJAPERF_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx),                    \
+        run##variant##VariantTyped, vid, getDataTypeTuningIdx(vid, tune_idx)); \
+  }
+
+#define RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(kernel, variant)     \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx),     \
+        run##variant##VariantTyped, vid, getDataTypeTuningIdx(vid, tune_idx)); \
+  }
+
+#endif  // closing endif for header file include guard
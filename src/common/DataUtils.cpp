@@ -9,15 +9,38 @@
 #include "DataUtils.hpp"
 #include "CudaDataUtils.hpp"
 #include "HipDataUtils.hpp"
+#include "SyclDataUtils.hpp"
 #include "OpenMPTargetDataUtils.hpp"
 
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include <algorithm>
+#include <climits>
+#include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <unistd.h>
+#include <sys/resource.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(MAP_HUGETLB) && !defined(MAP_HUGE_SHIFT)
+// value from linux/mman.h, missing from older libc headers
+#define MAP_HUGE_SHIFT 26
+#endif
+#endif
 
 namespace rajaperf
 {
@@ -73,6 +96,8 @@ bool isCudaDataSpace(DataSpace dataSpace)
     case DataSpace::CudaPinned:
     case DataSpace::CudaManaged:
     case DataSpace::CudaDevice:
+    case DataSpace::CudaDeviceAsync:
+    case DataSpace::CudaSystem:
       return true;
     default:
       return false;
@@ -95,6 +120,23 @@ bool isHipDataSpace(DataSpace dataSpace)
     case DataSpace::HipManagedAdviseCoarse:
     case DataSpace::HipDevice:
     case DataSpace::HipDeviceFine:
+    case DataSpace::HipDeviceAsync:
+    case DataSpace::HipSystem:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/*!
+ * \brief Get if the data space is a sycl DataSpace.
+ */
+bool isSyclDataSpace(DataSpace dataSpace)
+{
+  switch (dataSpace) {
+    case DataSpace::SyclPinned:
+    case DataSpace::SyclManaged:
+    case DataSpace::SyclDevice:
       return true;
     default:
       return false;
@@ -102,7 +144,9 @@ bool isHipDataSpace(DataSpace dataSpace)
 }
 
 
-static int data_init_count = 0;
+// per thread, so kernels set up on other host threads with
+// '--pipeline-setup' initialize the same data
+static thread_local int data_init_count = 0;
 
 /*
  * Reset counter for data initialization.
@@ -129,13 +173,115 @@ void copyHostData(void* dst_ptr, const void* src_ptr, size_t len)
 }
 
 
+static HostPagePolicy host_page_policy = HostPagePolicy::Default;
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+/*
+ * Explicit huge page mappings made by allocHostData and their lengths.
+ */
+static std::mutex host_mapping_mutex;
+static std::unordered_map<void*, size_t> host_mappings;
+#endif
+
+void setHostPagePolicy(HostPagePolicy policy)
+{
+  if (!isHostPagePolicyAvailable(policy)) {
+    throw std::invalid_argument("setHostPagePolicy : host page policy " +
+                                getHostPagePolicyName(policy) + " is not available");
+  }
+  host_page_policy = policy;
+}
+
+/*
+ * Get the size of transparent huge pages, which is 2MiB unless the kernel
+ * reports otherwise.
+ */
+static size_t getTransparentHugePageSize()
+{
+  static const size_t thp_size = []() {
+    size_t size = size_t(2) << 20;
+    std::ifstream file("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+    size_t file_size = 0;
+    if (file >> file_size && file_size > 0) {
+      size = file_size;
+    }
+    return size;
+  }();
+  return thp_size;
+}
+
+size_t getHostPageSize()
+{
+  switch (host_page_policy) {
+    case HostPagePolicy::THP:
+      return getTransparentHugePageSize();
+    case HostPagePolicy::Huge2MB:
+      return size_t(2) << 20;
+    case HostPagePolicy::Huge1GB:
+      return size_t(1) << 30;
+    default:
+      return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  }
+}
+
 /*
  * Allocate data arrays of given type.
  */
 void* allocHostData(size_t len, size_t align)
 {
-  return RAJA::allocate_aligned_type<Int_type>(
-      align, len);
+  const size_t page_size = getHostPageSize();
+
+  if (host_page_policy == HostPagePolicy::Default || len < page_size) {
+    return RAJA::allocate_aligned_type<Int_type>(
+        align, len);
+  }
+
+  // round up to whole huge pages so no other allocation shares them
+  const size_t page_len = RAJA_DIVIDE_CEILING_INT(len, page_size) * page_size;
+
+  void* ptr = nullptr;
+
+  switch (host_page_policy) {
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    case HostPagePolicy::THP:
+    {
+      ptr = RAJA::allocate_aligned_type<Int_type>(
+          std::max(align, page_size), page_len);
+      if (ptr) {
+        // only a hint, the kernel may still use default pages
+        madvise(ptr, page_len, MADV_HUGEPAGE);
+      }
+    } break;
+#endif
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    case HostPagePolicy::Huge2MB:
+    case HostPagePolicy::Huge1GB:
+    {
+      const int page_shift = (host_page_policy == HostPagePolicy::Huge1GB) ? 30 : 21;
+      ptr = mmap(nullptr, page_len, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                 (page_shift << MAP_HUGE_SHIFT),
+                 -1, 0);
+      if (ptr == MAP_FAILED) {
+        throw std::runtime_error("allocHostData : failed to map " +
+                                 getHostPagePolicyName(host_page_policy) +
+                                 " pages, check that enough huge pages are reserved");
+      }
+      std::lock_guard<std::mutex> lock(host_mapping_mutex);
+      host_mappings.emplace(ptr, page_len);
+    } break;
+#endif
+
+    default:
+    {
+      ptr = RAJA::allocate_aligned_type<Int_type>(
+          align, len);
+    } break;
+  }
+
+  return ptr;
 }
 
 
@@ -145,15 +291,122 @@ void* allocHostData(size_t len, size_t align)
 void deallocHostData(void* ptr)
 {
   if (ptr) {
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    {
+      std::lock_guard<std::mutex> lock(host_mapping_mutex);
+      auto mapping = host_mappings.find(ptr);
+      if (mapping != host_mappings.end()) {
+        munmap(ptr, mapping->second);
+        host_mappings.erase(mapping);
+        return;
+      }
+    }
+#endif
     RAJA::free_aligned(ptr);
   }
 }
 
 
+static NumaPolicy omp_numa_policy = NumaPolicy::FirstTouch;
+static std::vector<int> omp_numa_nodes;
+
+void setOmpNumaPolicy(NumaPolicy policy, const std::vector<int>& nodes)
+{
+  if (!isNumaPolicyAvailable(policy)) {
+    throw std::invalid_argument("setOmpNumaPolicy : NUMA policy " +
+                                getNumaPolicyName(policy) + " is not available");
+  }
+  omp_numa_policy = policy;
+  omp_numa_nodes = nodes;
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 /*
- * Allocate data arrays of given dataSpace.
+ * Apply the Omp NUMA policy to the pages in [ptr, ptr+nbytes), which must
+ * not have been touched yet.
+ */
+static void applyOmpNumaPolicy(void* ptr, size_t nbytes)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+  // values from linux/mempolicy.h
+  constexpr int mpol_bind = 2;
+  constexpr int mpol_interleave = 3;
+  constexpr int mpol_f_mems_allowed = 1 << 2;
+
+  constexpr size_t bits_per_mask = CHAR_BIT * sizeof(unsigned long);
+  constexpr size_t max_nodes = 1024;
+  std::vector<unsigned long> mask(max_nodes / bits_per_mask, 0ul);
+
+  if (omp_numa_nodes.empty()) {
+    if (syscall(SYS_get_mempolicy, nullptr, mask.data(), max_nodes,
+                nullptr, mpol_f_mems_allowed) != 0) {
+      throw std::runtime_error("allocData : failed to get allowed NUMA nodes");
+    }
+  } else {
+    for (int node : omp_numa_nodes) {
+      if (node < 0 || static_cast<size_t>(node) >= max_nodes - 1) {
+        throw std::invalid_argument("allocData : NUMA node " +
+                                    std::to_string(node) + " out of range");
+      }
+      mask[node / bits_per_mask] |= 1ul << (node % bits_per_mask);
+    }
+  }
+
+  const int mode = (omp_numa_policy == NumaPolicy::Interleave) ? mpol_interleave
+                                                              : mpol_bind;
+  if (syscall(SYS_mbind, ptr, nbytes, mode, mask.data(), max_nodes, 0) != 0) {
+    throw std::runtime_error("allocData : failed to apply NUMA policy " +
+                             getNumaPolicyName(omp_numa_policy));
+  }
+#else
+  RAJA_UNUSED_VAR(ptr);
+  RAJA_UNUSED_VAR(nbytes);
+#endif
+}
+#endif
+
+static size_t gpu_pool_release_threshold = 0;
+static std::mutex gpu_pool_mutex;
+static std::set<int> gpu_pool_devices; // devices with threshold set
+
+void setGPUPoolReleaseThreshold(size_t nbytes)
+{
+  std::lock_guard<std::mutex> lock(gpu_pool_mutex);
+  gpu_pool_release_threshold = nbytes;
+  gpu_pool_devices.clear();
+}
+
+size_t getGPUPoolReleaseThreshold()
+{
+  return gpu_pool_release_threshold;
+}
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+/*
+ * Set the release threshold of the default memory pool of the current
+ * device the first time it is used by an async data space.
+ */
+static void applyGPUPoolReleaseThreshold()
+{
+  std::lock_guard<std::mutex> lock(gpu_pool_mutex);
+#if defined(RAJA_ENABLE_CUDA)
+  const int device = getCudaDevice();
+  if (gpu_pool_devices.insert(device).second) {
+    setCudaMemPoolReleaseThreshold(gpu_pool_release_threshold);
+  }
+#elif defined(RAJA_ENABLE_HIP)
+  const int device = getHipDevice();
+  if (gpu_pool_devices.insert(device).second) {
+    setHipMemPoolReleaseThreshold(gpu_pool_release_threshold);
+  }
+#endif
+}
+#endif
+
+/*
+ * Allocate data arrays of given dataSpace directly from the system.
  */
-void* allocData(DataSpace dataSpace, int nbytes, int align)
+static void* allocDataSpaceData(DataSpace dataSpace, size_t nbytes, size_t align)
 {
   void* ptr = nullptr;
 
@@ -166,7 +419,17 @@ void* allocData(DataSpace dataSpace, int nbytes, int align)
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
     case DataSpace::Omp:
     {
-      ptr = detail::allocHostData(nbytes, align);
+      if (omp_numa_policy == NumaPolicy::FirstTouch) {
+        ptr = detail::allocHostData(nbytes, align);
+      } else {
+        // NUMA policies apply to whole pages, so do not share pages
+        // with other allocations
+        const size_t page_size = getHostPageSize();
+        const size_t page_nbytes =
+            RAJA_DIVIDE_CEILING_INT(nbytes, page_size) * page_size;
+        ptr = detail::allocHostData(page_nbytes, std::max(align, page_size));
+        applyOmpNumaPolicy(ptr, page_nbytes);
+      }
     } break;
 #endif
 
@@ -175,6 +438,12 @@ void* allocData(DataSpace dataSpace, int nbytes, int align)
     {
       ptr = detail::allocOpenMPDeviceData(nbytes);
     } break;
+#if defined(RAJA_PERFSUITE_ENABLE_OMPTARGET_USM)
+    case DataSpace::OmpTargetSystem:
+    {
+      ptr = detail::allocHostData(nbytes, align);
+    } break;
+#endif
 #endif
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -190,6 +459,19 @@ void* allocData(DataSpace dataSpace, int nbytes, int align)
     {
       ptr = detail::allocCudaDeviceData(nbytes);
     } break;
+    case DataSpace::CudaDeviceAsync:
+    {
+      applyGPUPoolReleaseThreshold();
+      ptr = detail::allocCudaDeviceAsyncData(nbytes);
+    } break;
+    case DataSpace::CudaSystem:
+    {
+      if (!detail::haveCudaPageableMemoryAccess()) {
+        throw std::runtime_error("allocData : CudaSystem data space needs a "
+                                 "device with pageable memory access");
+      }
+      ptr = detail::allocHostData(nbytes, align);
+    } break;
 #endif
 
 #if defined(RAJA_ENABLE_HIP)
@@ -241,6 +523,35 @@ void* allocData(DataSpace dataSpace, int nbytes, int align)
     {
       ptr = detail::allocHipDeviceFineData(nbytes);
     } break;
+    case DataSpace::HipDeviceAsync:
+    {
+      applyGPUPoolReleaseThreshold();
+      ptr = detail::allocHipDeviceAsyncData(nbytes);
+    } break;
+    case DataSpace::HipSystem:
+    {
+      if (!detail::haveHipPageableMemoryAccess()) {
+        throw std::runtime_error("allocData : HipSystem data space needs a "
+                                 "device with pageable memory access, "
+                                 "for example with HSA_XNACK=1");
+      }
+      ptr = detail::allocHostData(nbytes, align);
+    } break;
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+    case DataSpace::SyclPinned:
+    {
+      ptr = detail::allocSyclPinnedData(nbytes);
+    } break;
+    case DataSpace::SyclManaged:
+    {
+      ptr = detail::allocSyclManagedData(nbytes);
+    } break;
+    case DataSpace::SyclDevice:
+    {
+      ptr = detail::allocSyclDeviceData(nbytes);
+    } break;
 #endif
 
     default:
@@ -290,20 +601,34 @@ void copyData(DataSpace dst_dataSpace, void* dst_ptr,
   }
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  else if (isSyclDataSpace(dst_dataSpace) ||
+           isSyclDataSpace(src_dataSpace)) {
+    detail::copySyclData(dst_ptr, src_ptr, nbytes);
+  }
+#endif
+
   else {
     throw std::invalid_argument("copyData : Unknown data space");
   }
 }
 
 /*!
- * \brief Deallocate data array (ptr).
+ * \brief Deallocate data array (ptr) directly to the system.
  */
-void deallocData(DataSpace dataSpace, void* ptr)
+static void deallocDataSpaceData(DataSpace dataSpace, void* ptr)
 {
   switch (dataSpace) {
     case DataSpace::Host:
     case DataSpace::Omp:
+#if defined(RAJA_ENABLE_TARGET_OPENMP) && defined(RAJA_PERFSUITE_ENABLE_OMPTARGET_USM)
+    case DataSpace::OmpTargetSystem:
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+    case DataSpace::CudaSystem:
+#endif
 #if defined(RAJA_ENABLE_HIP)
+    case DataSpace::HipSystem:
     case DataSpace::HipHostAdviseFine:
 #if defined(RAJAPERF_USE_MEMADVISE_COARSE)
     case DataSpace::HipHostAdviseCoarse:
@@ -333,6 +658,10 @@ void deallocData(DataSpace dataSpace, void* ptr)
     {
       detail::deallocCudaDeviceData(ptr);
     } break;
+    case DataSpace::CudaDeviceAsync:
+    {
+      detail::deallocCudaDeviceAsyncData(ptr);
+    } break;
 #endif
 
 #if defined(RAJA_ENABLE_HIP)
@@ -355,6 +684,19 @@ void deallocData(DataSpace dataSpace, void* ptr)
     {
       detail::deallocHipDeviceData(ptr);
     } break;
+    case DataSpace::HipDeviceAsync:
+    {
+      detail::deallocHipDeviceAsyncData(ptr);
+    } break;
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+    case DataSpace::SyclPinned:
+    case DataSpace::SyclManaged:
+    case DataSpace::SyclDevice:
+    {
+      detail::deallocSyclData(ptr);
+    } break;
 #endif
 
     default:
@@ -365,156 +707,885 @@ void deallocData(DataSpace dataSpace, void* ptr)
 }
 
 
-/*
- * \brief Initialize Int_type data array to
- * randomly signed positive and negative values.
- */
-void initData(Int_ptr& ptr, int len)
+struct LiveData
 {
-  srand(4793);
-
-  Real_type signfact = 0.0;
+  size_t nbytes;
+  DataSpace dataSpace;
+};
 
-  for (int i = 0; i < len; ++i) {
-    signfact = Real_type(rand())/RAND_MAX;
-    ptr[i] = ( signfact < 0.5 ? -1 : 1 );
-  };
+static size_t data_live_bytes = 0;
+static size_t data_live_device_bytes = 0;
+static size_t data_peak_device_bytes = 0;
+static std::unordered_map<void*, LiveData> data_live_sizes;
+static std::mutex data_live_mutex;
 
-  signfact = Real_type(rand())/RAND_MAX;
-  Int_type ilo = len * signfact;
-  ptr[ilo] = -58;
-
-  signfact = Real_type(rand())/RAND_MAX;
-  Int_type ihi = len * signfact;
-  ptr[ihi] = 19;
-
-  incDataInitCount();
+/*!
+ * \brief Get if data in the data space is in device memory.
+ */
+static bool isDeviceDataSpace(DataSpace dataSpace)
+{
+  switch (dataSpace) {
+    case DataSpace::OmpTarget:
+    case DataSpace::CudaDevice:
+    case DataSpace::CudaDeviceAsync:
+    case DataSpace::HipDevice:
+    case DataSpace::HipDeviceFine:
+    case DataSpace::HipDeviceAsync:
+    case DataSpace::SyclDevice:
+      return true;
+    default:
+      return false;
+  }
 }
 
-/*
- * Initialize Real_type data array to non-random
- * positive values (0.0, 1.0) based on their array position
- * (index) and the order in which this method is called.
+/*!
+ * \brief Record an allocation or free of data in data_live_bytes.
  */
-void initData(Real_ptr& ptr, int len)
+static void addLiveData(void* ptr, size_t nbytes, DataSpace dataSpace)
 {
-  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+  if (ptr == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(data_live_mutex);
+  data_live_sizes[ptr] = LiveData{nbytes, dataSpace};
+  data_live_bytes += nbytes;
+  if (isDeviceDataSpace(dataSpace)) {
+    data_live_device_bytes += nbytes;
+    data_peak_device_bytes = std::max(data_peak_device_bytes, data_live_device_bytes);
+  }
+}
 
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = factor*(i + 1.1)/(i + 1.12345);
+static void removeLiveData(void* ptr)
+{
+  std::lock_guard<std::mutex> lock(data_live_mutex);
+  auto live = data_live_sizes.find(ptr);
+  if (live != data_live_sizes.end()) {
+    data_live_bytes -= live->second.nbytes;
+    if (isDeviceDataSpace(live->second.dataSpace)) {
+      data_live_device_bytes -= live->second.nbytes;
+    }
+    data_live_sizes.erase(live);
   }
+}
 
-  incDataInitCount();
+size_t getDataLiveBytes()
+{
+  std::lock_guard<std::mutex> lock(data_live_mutex);
+  return data_live_bytes;
 }
 
-/*
- * Initialize Real_type data array to constant values.
- */
-void initDataConst(Real_ptr& ptr, int len, Real_type val)
+size_t getDataLiveDeviceBytes()
 {
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = val;
-  };
+  std::lock_guard<std::mutex> lock(data_live_mutex);
+  return data_live_device_bytes;
+}
 
-  incDataInitCount();
+size_t getDataPeakDeviceBytes()
+{
+  std::lock_guard<std::mutex> lock(data_live_mutex);
+  return data_peak_device_bytes;
 }
 
-/*
- * Initialize Index_type data array to constant values.
- */
-void initDataConst(Index_type*& ptr, int len, Index_type val)
+void resetDataPeakDeviceBytes()
 {
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = val;
-  };
+  std::lock_guard<std::mutex> lock(data_live_mutex);
+  data_peak_device_bytes = data_live_device_bytes;
+}
 
-  incDataInitCount();
+size_t getGPUFreeBytes()
+{
+  size_t free_bytes = 0;
+  size_t total_bytes = 0;
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk( cudaMemGetInfo(&free_bytes, &total_bytes) );
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk( hipMemGetInfo(&free_bytes, &total_bytes) );
+#endif
+  RAJA_UNUSED_VAR(total_bytes);
+  return free_bytes;
 }
 
-/*
- * Initialize Real_type data array with random sign.
+/*!
+ * \brief Get if data in the data space is managed by a GPU runtime, or
+ * migrated by it like system allocated data used from the GPU.
  */
-void initDataRandSign(Real_ptr& ptr, int len)
+static bool isGPUManagedDataSpace(DataSpace dataSpace)
 {
-  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+  switch (dataSpace) {
+#if defined(RAJA_ENABLE_CUDA)
+    case DataSpace::CudaManaged:
+    case DataSpace::CudaSystem:
+      return true;
+#endif
+#if defined(RAJA_ENABLE_HIP)
+    case DataSpace::HipManaged:
+    case DataSpace::HipManagedAdviseFine:
+    case DataSpace::HipManagedAdviseCoarse:
+    case DataSpace::HipSystem:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
 
-  srand(4793);
+void applyManagedPolicy(ManagedPolicy policy)
+{
+  if (policy == ManagedPolicy::None) {
+    return;
+  }
 
-  for (int i = 0; i < len; ++i) {
-    Real_type signfact = Real_type(rand())/RAND_MAX;
-    signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
-    ptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
-  };
+  std::lock_guard<std::mutex> lock(data_live_mutex);
+#if defined(RAJA_ENABLE_CUDA)
+  const int device = getCudaDevice();
+  for (auto const& live : data_live_sizes) {
+    if (!isGPUManagedDataSpace(live.second.dataSpace)) {
+      continue;
+    }
+    void* ptr = live.first;
+    const size_t nbytes = live.second.nbytes;
+    switch (policy) {
+      case ManagedPolicy::Prefetch:
+        cudaErrchk( cudaMemPrefetchAsync(ptr, nbytes, device, 0) );
+        break;
+      case ManagedPolicy::PreferredLocation:
+        cudaErrchk( cudaMemAdvise(ptr, nbytes, cudaMemAdviseSetPreferredLocation, device) );
+        cudaErrchk( cudaMemAdvise(ptr, nbytes, cudaMemAdviseSetAccessedBy, device) );
+        break;
+      case ManagedPolicy::ReadMostly:
+        cudaErrchk( cudaMemAdvise(ptr, nbytes, cudaMemAdviseSetReadMostly, device) );
+        break;
+      default:
+        break;
+    }
+  }
+  cudaErrchk( cudaDeviceSynchronize() );
+#elif defined(RAJA_ENABLE_HIP)
+  const int device = getHipDevice();
+  for (auto const& live : data_live_sizes) {
+    if (!isGPUManagedDataSpace(live.second.dataSpace)) {
+      continue;
+    }
+    void* ptr = live.first;
+    const size_t nbytes = live.second.nbytes;
+    switch (policy) {
+      case ManagedPolicy::Prefetch:
+        hipErrchk( hipMemPrefetchAsync(ptr, nbytes, device, 0) );
+        break;
+      case ManagedPolicy::PreferredLocation:
+        hipErrchk( hipMemAdvise(ptr, nbytes, hipMemAdviseSetPreferredLocation, device) );
+        hipErrchk( hipMemAdvise(ptr, nbytes, hipMemAdviseSetAccessedBy, device) );
+        break;
+      case ManagedPolicy::ReadMostly:
+        hipErrchk( hipMemAdvise(ptr, nbytes, hipMemAdviseSetReadMostly, device) );
+        break;
+      default:
+        break;
+    }
+  }
+  hipErrchk( hipDeviceSynchronize() );
+#endif
+}
 
-  incDataInitCount();
+void readPageFaults(long long& minor_faults, long long& major_faults)
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    minor_faults = 0;
+    major_faults = 0;
+    return;
+  }
+  minor_faults = static_cast<long long>(usage.ru_minflt);
+  major_faults = static_cast<long long>(usage.ru_majflt);
 }
 
-/*
- * Initialize Real_type data array with random values.
+
+static bool data_pool_enabled = false;
+
+/*!
+ * \brief Block of memory owned by a data pool.
  */
-void initDataRandValue(Real_ptr& ptr, int len)
+struct DataPoolBlock
 {
-  srand(4793);
+  DataSpace dataSpace;
+  size_t nbytes;
+  size_t align;
+};
 
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = Real_type(rand())/RAND_MAX;
-  };
+using DataPoolBinKey = std::pair<size_t, size_t>; // size class, alignment
 
-  incDataInitCount();
-}
+static std::map<DataSpace, std::map<DataPoolBinKey, std::vector<void*>>> data_pool_free;
+static std::unordered_map<void*, DataPoolBlock> data_pool_in_use;
+static std::map<DataSpace, DataPoolStats> data_pool_stats;
+static std::mutex data_pool_mutex; // kernels may allocate on multiple threads
 
-/*
- * Initialize Complex_type data array.
+/*!
+ * \brief Round nbytes up to its data pool size class.
+ *
+ * Size classes are spaced at a quarter of the enclosing power of two
+ * so at most 25% of a block is unused.
  */
-void initData(Complex_ptr& ptr, int len)
+static size_t getDataPoolSizeClass(size_t nbytes)
 {
-  Complex_type factor = ( data_init_count % 2 ?  Complex_type(0.1,0.2) :
-                                                 Complex_type(0.2,0.3) );
-
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = factor*(i + 1.1)/(i + 1.12345);
+  constexpr size_t min_size_class = 256;
+  if (nbytes <= min_size_class) {
+    return min_size_class;
   }
-
-  incDataInitCount();
+  size_t pow2 = min_size_class;
+  while (pow2 < nbytes / 2) {
+    pow2 *= 2;
+  }
+  const size_t step = pow2 / 4;
+  return RAJA_DIVIDE_CEILING_INT(nbytes, step) * step;
 }
 
-/*
- * Initialize scalar data.
- */
-void initData(Real_type& d)
+void setDataPoolEnabled(bool enabled)
 {
-  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
-  d = factor*1.1/1.12345;
+  data_pool_enabled = enabled;
+}
 
-  incDataInitCount();
+bool getDataPoolEnabled()
+{
+  return data_pool_enabled;
 }
 
-/*
- * Calculate and return checksum for data arrays.
- */
-long double calcChecksum(Int_ptr ptr, int len,
-                         Real_type scale_factor)
+DataPoolStats getDataPoolStats(DataSpace dataSpace)
 {
-  long double tchk = 0.0;
-  long double ckahan = 0.0;
-  for (Index_type j = 0; j < len; ++j) {
-    long double x = (std::abs(std::sin(j+1.0))+0.5) * ptr[j];
-    long double y = x - ckahan;
-    volatile long double t = tchk + y;
-    volatile long double z = t - tchk;
-    ckahan = z - y;
-    tchk = t;
-#if 0 // RDH DEBUG
-    if ( (j % 100) == 0 ) {
-      getCout() << "j : tchk = " << j << " : " << tchk << std::endl;
-    }
-#endif
+  std::lock_guard<std::mutex> lock(data_pool_mutex);
+  auto stats = data_pool_stats.find(dataSpace);
+  if (stats == data_pool_stats.end()) {
+    return DataPoolStats{};
   }
-  tchk *= scale_factor;
-  return tchk;
+  return stats->second;
 }
 
-long double calcChecksum(Real_ptr ptr, int len,
+void releaseDataPools()
+{
+  std::lock_guard<std::mutex> lock(data_pool_mutex);
+  for (auto& space_bins : data_pool_free) {
+    DataPoolStats& stats = data_pool_stats[space_bins.first];
+    for (auto& bin : space_bins.second) {
+      for (void* ptr : bin.second) {
+        deallocDataSpaceData(space_bins.first, ptr);
+        stats.held_bytes -= bin.first.first;
+      }
+    }
+  }
+  data_pool_free.clear();
+}
+
+/*
+ * Allocate data arrays of given dataSpace.
+ */
+void* allocData(DataSpace dataSpace, size_t nbytes, size_t align)
+{
+  if (!data_pool_enabled) {
+    void* ptr = allocDataSpaceData(dataSpace, nbytes, align);
+    addLiveData(ptr, nbytes, dataSpace);
+    return ptr;
+  }
+
+  std::lock_guard<std::mutex> lock(data_pool_mutex);
+
+  DataPoolStats& stats = data_pool_stats[dataSpace];
+  const size_t size_class = getDataPoolSizeClass(nbytes);
+
+  void* ptr = nullptr;
+
+  std::vector<void*>& bin = data_pool_free[dataSpace][{size_class, align}];
+  if (!bin.empty()) {
+    ptr = bin.back();
+    bin.pop_back();
+    stats.num_reused++;
+  } else {
+    ptr = allocDataSpaceData(dataSpace, size_class, align);
+    stats.held_bytes += size_class;
+    stats.peak_held_bytes = std::max(stats.peak_held_bytes, stats.held_bytes);
+  }
+
+  data_pool_in_use.emplace(ptr, DataPoolBlock{dataSpace, size_class, align});
+
+  stats.num_allocs++;
+  stats.in_use_bytes += size_class;
+  stats.peak_in_use_bytes = std::max(stats.peak_in_use_bytes, stats.in_use_bytes);
+
+  addLiveData(ptr, nbytes, dataSpace);
+
+  return ptr;
+}
+
+/*!
+ * \brief Deallocate data array (ptr).
+ */
+void deallocData(DataSpace dataSpace, void* ptr)
+{
+  removeLiveData(ptr);
+
+  std::unique_lock<std::mutex> lock(data_pool_mutex);
+
+  auto block = data_pool_in_use.find(ptr);
+  if (ptr == nullptr || block == data_pool_in_use.end()) {
+    // not allocated from a pool
+    lock.unlock();
+    deallocDataSpaceData(dataSpace, ptr);
+    return;
+  }
+
+  if (block->second.dataSpace != dataSpace) {
+    throw std::invalid_argument("deallocData : Data space does not match allocation");
+  }
+
+  DataPoolStats& stats = data_pool_stats[dataSpace];
+  stats.in_use_bytes -= block->second.nbytes;
+
+  data_pool_free[dataSpace][{block->second.nbytes, block->second.align}].push_back(ptr);
+
+  data_pool_in_use.erase(block);
+}
+
+
+/*
+ * Cache flush buffers are twice the cache size so no line of kernel data
+ * survives in a cache with a non LRU replacement policy.
+ */
+static char* host_flush_buffer = nullptr;
+static size_t host_flush_nbytes = 0;
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+static void* device_flush_buffer = nullptr;
+static size_t device_flush_nbytes = 0;
+static unsigned char device_flush_value = 0;
+#endif
+
+size_t getHostCacheSize()
+{
+  long nbytes = -1;
+#if defined(_SC_LEVEL4_CACHE_SIZE)
+  nbytes = std::max(nbytes, sysconf(_SC_LEVEL4_CACHE_SIZE));
+#endif
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+  nbytes = std::max(nbytes, sysconf(_SC_LEVEL3_CACHE_SIZE));
+#endif
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+  nbytes = std::max(nbytes, sysconf(_SC_LEVEL2_CACHE_SIZE));
+#endif
+  // unknown, assume a large LLC
+  return (nbytes > 0) ? static_cast<size_t>(nbytes) : size_t(64) << 20;
+}
+
+std::vector<size_t> getHostCacheLevelSizes()
+{
+  std::vector<size_t> sizes;
+  long nbytes[4] = {-1, -1, -1, -1};
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  nbytes[0] = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+#endif
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+  nbytes[1] = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+  nbytes[2] = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+#if defined(_SC_LEVEL4_CACHE_SIZE)
+  nbytes[3] = sysconf(_SC_LEVEL4_CACHE_SIZE);
+#endif
+  for (long n : nbytes) {
+    if (n <= 0) {
+      break;
+    }
+    sizes.push_back(static_cast<size_t>(n));
+  }
+
+  // sysconf does not know the caches on some architectures, ie. aarch64,
+  // read the caches of cpu0 from sysfs instead
+  if (sizes.empty()) {
+    for (int index = 0; ; ++index) {
+      const std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" +
+                              std::to_string(index) + "/";
+      std::ifstream level_file(dir + "level");
+      std::ifstream type_file(dir + "type");
+      std::ifstream size_file(dir + "size");
+      if (!level_file || !type_file || !size_file) {
+        break;
+      }
+      size_t level = 0;
+      std::string type;
+      std::string size_str;
+      level_file >> level;
+      type_file >> type;
+      size_file >> size_str;
+      // size is given as ie. 48K or 32M
+      size_t nbytes = std::strtoull(size_str.c_str(), nullptr, 10);
+      switch (size_str.empty() ? ' ' : size_str.back()) {
+        case 'K': nbytes <<= 10; break;
+        case 'M': nbytes <<= 20; break;
+        case 'G': nbytes <<= 30; break;
+        default: break;
+      }
+      if (type == "Instruction" || level == 0 || nbytes == 0) {
+        continue;
+      }
+      if (sizes.size() < level) {
+        sizes.resize(level, 0);
+      }
+      sizes[level-1] = std::max(sizes[level-1], nbytes);
+    }
+    sizes.erase(std::find(sizes.begin(), sizes.end(), size_t(0)), sizes.end());
+  }
+
+  return sizes;
+}
+
+void flushCaches(bool gpu)
+{
+  if (host_flush_buffer == nullptr) {
+    host_flush_nbytes = 2*getHostCacheSize();
+    host_flush_buffer = static_cast<char*>(allocHostData(host_flush_nbytes, 64));
+    std::memset(host_flush_buffer, 0, host_flush_nbytes);
+  }
+
+  // touch every line from all threads so the private caches are flushed too
+  volatile char* buf = host_flush_buffer;
+  const Index_type nlines = static_cast<Index_type>(host_flush_nbytes / 64);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  #pragma omp parallel for
+#endif
+  for (Index_type i = 0; i < nlines; ++i) {
+    buf[i*64] = buf[i*64] + 1;
+  }
+
+#if defined(RAJA_ENABLE_CUDA)
+  if (gpu) {
+    if (device_flush_buffer == nullptr) {
+      device_flush_nbytes = 2*static_cast<size_t>(getCudaDeviceProp().l2CacheSize);
+      cudaErrchk( cudaMalloc( &device_flush_buffer, device_flush_nbytes ) );
+    }
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 11000
+    cudaErrchk( cudaCtxResetPersistingL2Cache() );
+#endif
+    cudaErrchk( cudaMemset( device_flush_buffer, ++device_flush_value,
+                            device_flush_nbytes ) );
+    cudaErrchk( cudaDeviceSynchronize() );
+  }
+#elif defined(RAJA_ENABLE_HIP)
+  if (gpu) {
+    if (device_flush_buffer == nullptr) {
+      device_flush_nbytes = 2*static_cast<size_t>(getHipDeviceProp().l2CacheSize);
+      hipErrchk( hipMalloc( &device_flush_buffer, device_flush_nbytes ) );
+    }
+    hipErrchk( hipMemset( device_flush_buffer, ++device_flush_value,
+                          device_flush_nbytes ) );
+    hipErrchk( hipDeviceSynchronize() );
+  }
+#else
+  RAJA_UNUSED_VAR(gpu);
+#endif
+}
+
+void releaseCacheFlushBuffers()
+{
+  if (host_flush_buffer != nullptr) {
+    deallocHostData(host_flush_buffer);
+    host_flush_buffer = nullptr;
+    host_flush_nbytes = 0;
+  }
+#if defined(RAJA_ENABLE_CUDA)
+  if (device_flush_buffer != nullptr) {
+    cudaErrchk( cudaFree( device_flush_buffer ) );
+    device_flush_buffer = nullptr;
+    device_flush_nbytes = 0;
+  }
+#elif defined(RAJA_ENABLE_HIP)
+  if (device_flush_buffer != nullptr) {
+    hipErrchk( hipFree( device_flush_buffer ) );
+    device_flush_buffer = nullptr;
+    device_flush_nbytes = 0;
+  }
+#endif
+}
+
+int getNumGPUDevices()
+{
+  int num_devices = 0;
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk( cudaGetDeviceCount(&num_devices) );
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk( hipGetDeviceCount(&num_devices) );
+#endif
+  return num_devices;
+}
+
+void setGPUDevice(int device)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk( cudaSetDevice(device) );
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk( hipSetDevice(device) );
+#else
+  RAJA_UNUSED_VAR(device);
+#endif
+}
+
+int getGPUDevice()
+{
+#if defined(RAJA_ENABLE_CUDA)
+  return getCudaDevice();
+#elif defined(RAJA_ENABLE_HIP)
+  return getHipDevice();
+#else
+  return -1;
+#endif
+}
+
+std::string getGPUPciBusId()
+{
+  char bus_id[64] = "";
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk( cudaDeviceGetPCIBusId(bus_id, sizeof(bus_id), getCudaDevice()) );
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk( hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), getHipDevice()) );
+#endif
+  return std::string(bus_id);
+}
+
+bool haveGPUPageableMemoryAccess()
+{
+#if defined(RAJA_ENABLE_CUDA)
+  return haveCudaPageableMemoryAccess();
+#elif defined(RAJA_ENABLE_HIP)
+  return haveHipPageableMemoryAccess();
+#else
+  return false;
+#endif
+}
+
+
+/*!
+ * \brief Get if data in the data space is initialized on a device.
+ */
+bool isDeviceInitDataSpace(DataSpace dataSpace)
+{
+  switch (dataSpace) {
+#if defined(RAJA_ENABLE_CUDA)
+    case DataSpace::CudaManaged:
+    case DataSpace::CudaDevice:
+    case DataSpace::CudaDeviceAsync:
+      return true;
+#endif
+#if defined(RAJA_ENABLE_HIP)
+    case DataSpace::HipDevice:
+    case DataSpace::HipDeviceFine:
+    case DataSpace::HipDeviceAsync:
+      return true;
+#endif
+#if defined(RAJA_ENABLE_SYCL)
+    case DataSpace::SyclManaged:
+    case DataSpace::SyclDevice:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+/*
+ * Get the data space to initialize data in for this dataSpace.
+ */
+DataSpace initDataSpace(DataSpace dataSpace)
+{
+  if (isDeviceInitDataSpace(dataSpace)) {
+    return dataSpace;
+  }
+  return hostAccessibleDataSpace(dataSpace);
+}
+
+/*!
+ * \brief Run body for each index of a data array in dataSpace.
+ *
+ * Runs on the device for device data spaces, otherwise in an OpenMP
+ * parallel loop on the host if OpenMP is enabled.
+ */
+template < typename Body >
+void initDataForall(DataSpace dataSpace, Index_type len, Body body)
+{
+  if (isCudaDataSpace(dataSpace) && isDeviceInitDataSpace(dataSpace)) {
+#if defined(RAJA_ENABLE_CUDA)
+    constexpr size_t block_size = 256;
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(len, block_size);
+    lambda_cuda_forall<block_size><<<grid_size, block_size>>>(
+        static_cast<Index_type>(0), len, body);
+    cudaErrchk( cudaGetLastError() );
+    cudaErrchk( cudaDeviceSynchronize() );
+#endif
+  } else if (isHipDataSpace(dataSpace) && isDeviceInitDataSpace(dataSpace)) {
+#if defined(RAJA_ENABLE_HIP)
+    constexpr size_t block_size = 256;
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(len, block_size);
+    hipLaunchKernelGGL((lambda_hip_forall<block_size, Body>),
+        dim3(grid_size), dim3(block_size), 0, 0,
+        static_cast<Index_type>(0), len, body);
+    hipErrchk( hipGetLastError() );
+    hipErrchk( hipDeviceSynchronize() );
+#endif
+  } else if (isSyclDataSpace(dataSpace) && isDeviceInitDataSpace(dataSpace)) {
+#if defined(RAJA_ENABLE_SYCL)
+    constexpr size_t block_size = 256;
+    const size_t global_size = getSyclGlobalSize(len, block_size);
+    detail::getSyclQueue()->submit([&] (sycl::handler& h) {
+      h.parallel_for(sycl::nd_range<1>(global_size, block_size),
+                     [=] (sycl::nd_item<1> item) {
+        Index_type i = item.get_global_id(0);
+        if (i < len) {
+          body(i);
+        }
+      });
+    }).wait();
+#endif
+  } else {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    #pragma omp parallel for
+#endif
+    for (Index_type i = 0; i < len; ++i) {
+      body(i);
+    }
+  }
+}
+
+/*
+ * Seed used for random data initialization.
+ */
+static constexpr unsigned long long data_init_seed = 4793;
+
+/*
+ * \brief Initialize Int_type data array to
+ * randomly signed positive and negative values.
+ */
+void initData(DataSpace dataSpace, Int_ptr& ptr, Index_type len)
+{
+  const Index_type ilo =
+      static_cast<Index_type>(len * counterRandValue(data_init_seed, len));
+  const Index_type ihi =
+      static_cast<Index_type>(len * counterRandValue(data_init_seed, len+1));
+
+  Int_ptr tptr = ptr;
+  initDataForall(dataSpace, len, [=] RAJA_HOST_DEVICE (Index_type i) {
+    if (i == ihi) {
+      tptr[i] = 19;
+    } else if (i == ilo) {
+      tptr[i] = -58;
+    } else {
+      Real_type signfact = counterRandValue(data_init_seed, i);
+      tptr[i] = ( signfact < 0.5 ? -1 : 1 );
+    }
+  });
+
+  incDataInitCount();
+}
+
+/*
+ * Initialize Real_type data array to non-random
+ * positive values (0.0, 1.0) based on their array position
+ * (index) and the order in which this method is called.
+ */
+void initData(DataSpace dataSpace, Real_ptr& ptr, Index_type len)
+{
+  const Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+
+  Real_ptr tptr = ptr;
+  initDataForall(dataSpace, len, [=] RAJA_HOST_DEVICE (Index_type i) {
+    tptr[i] = factor*(i + 1.1)/(i + 1.12345);
+  });
+
+  incDataInitCount();
+}
+
+/*
+ * Initialize Real_type data array to constant values.
+ */
+void initDataConst(DataSpace dataSpace, Real_ptr& ptr, Index_type len, Real_type val)
+{
+  Real_ptr tptr = ptr;
+  initDataForall(dataSpace, len, [=] RAJA_HOST_DEVICE (Index_type i) {
+    tptr[i] = val;
+  });
+
+  incDataInitCount();
+}
+
+/*
+ * Initialize Index_type data array to constant values.
+ */
+void initDataConst(DataSpace dataSpace, Index_type*& ptr, Index_type len, Index_type val)
+{
+  Index_type* tptr = ptr;
+  initDataForall(dataSpace, len, [=] RAJA_HOST_DEVICE (Index_type i) {
+    tptr[i] = val;
+  });
+
+  incDataInitCount();
+}
+
+/*
+ * Initialize Real_type data array with random sign.
+ */
+void initDataRandSign(DataSpace dataSpace, Real_ptr& ptr, Index_type len)
+{
+  const Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+
+  Real_ptr tptr = ptr;
+  initDataForall(dataSpace, len, [=] RAJA_HOST_DEVICE (Index_type i) {
+    Real_type signfact = counterRandValue(data_init_seed, i);
+    signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
+    tptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
+  });
+
+  incDataInitCount();
+}
+
+/*
+ * Initialize Real_type data array with random values.
+ */
+void initDataRandValue(DataSpace dataSpace, Real_ptr& ptr, Index_type len)
+{
+  Real_ptr tptr = ptr;
+  initDataForall(dataSpace, len, [=] RAJA_HOST_DEVICE (Index_type i) {
+    tptr[i] = counterRandValue(data_init_seed, i);
+  });
+
+  incDataInitCount();
+}
+
+/*
+ * Initialize floating point data array of a kernel data type.
+ */
+template < typename T >
+void initData(DataSpace dataSpace, T*& ptr, Index_type len)
+{
+  const Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+
+  T* tptr = ptr;
+  initDataForall(dataSpace, len, [=] RAJA_HOST_DEVICE (Index_type i) {
+    tptr[i] = static_cast<T>(factor*(i + 1.1)/(i + 1.12345));
+  });
+
+  incDataInitCount();
+}
+
+template void initData(DataSpace, Float_type*&, Index_type);
+template void initData(DataSpace, Double_type*&, Index_type);
+
+/*
+ * Initialize data array of a kernel data type to constant values.
+ */
+template < typename T >
+void initDataConst(DataSpace dataSpace, T*& ptr, Index_type len, T val)
+{
+  T* tptr = ptr;
+  initDataForall(dataSpace, len, [=] RAJA_HOST_DEVICE (Index_type i) {
+    tptr[i] = val;
+  });
+
+  incDataInitCount();
+}
+
+/*
+ * Initialize data array of a kernel data type with random values.
+ */
+template < typename T >
+void initDataRandValue(DataSpace dataSpace, T*& ptr, Index_type len)
+{
+  const Real_type range = std::is_integral<T>::value ? 128.0 : 1.0;
+
+  T* tptr = ptr;
+  initDataForall(dataSpace, len, [=] RAJA_HOST_DEVICE (Index_type i) {
+    tptr[i] = static_cast<T>(range * counterRandValue(data_init_seed, i));
+  });
+
+  incDataInitCount();
+}
+
+template void initDataConst(DataSpace, Int32_type*&, Index_type, Int32_type);
+template void initDataConst(DataSpace, Int64_type*&, Index_type, Int64_type);
+template void initDataConst(DataSpace, Float_type*&, Index_type, Float_type);
+template void initDataConst(DataSpace, Double_type*&, Index_type, Double_type);
+
+template void initDataRandValue(DataSpace, Int32_type*&, Index_type);
+template void initDataRandValue(DataSpace, Int64_type*&, Index_type);
+template void initDataRandValue(DataSpace, Float_type*&, Index_type);
+template void initDataRandValue(DataSpace, Double_type*&, Index_type);
+
+/*
+ * Initialize Complex_type data array.
+ *
+ * Data in device data spaces is initialized on the host and copied to the
+ * device.
+ */
+void initData(DataSpace dataSpace, Complex_ptr& ptr, Index_type len)
+{
+  const Complex_type factor = ( data_init_count % 2 ?  Complex_type(0.1,0.2) :
+                                                       Complex_type(0.2,0.3) );
+
+  DataSpace host_dataSpace = hostAccessibleDataSpace(dataSpace);
+
+  Complex_ptr tptr = ptr;
+  if (host_dataSpace != dataSpace) {
+    tptr = static_cast<Complex_ptr>(
+        allocData(host_dataSpace, len*sizeof(Complex_type), alignof(Complex_type)));
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  #pragma omp parallel for
+#endif
+  for (Index_type i = 0; i < len; ++i) {
+    tptr[i] = factor*(i + 1.1)/(i + 1.12345);
+  }
+
+  if (host_dataSpace != dataSpace) {
+    copyData(dataSpace, static_cast<void*>(ptr),
+             host_dataSpace, static_cast<const void*>(tptr),
+             len*sizeof(Complex_type));
+    deallocData(host_dataSpace, tptr);
+  }
+
+  incDataInitCount();
+}
+
+/*
+ * Initialize scalar data.
+ */
+void initData(Real_type& d)
+{
+  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+  d = factor*1.1/1.12345;
+
+  incDataInitCount();
+}
+
+/*
+ * Calculate and return checksum for data arrays.
+ */
+long double calcChecksum(Int_ptr ptr, Index_type len,
+                         Real_type scale_factor)
+{
+  long double tchk = 0.0;
+  long double ckahan = 0.0;
+  for (Index_type j = 0; j < len; ++j) {
+    long double x = (std::abs(std::sin(j+1.0))+0.5) * ptr[j];
+    long double y = x - ckahan;
+    volatile long double t = tchk + y;
+    volatile long double z = t - tchk;
+    ckahan = z - y;
+    tchk = t;
+#if 0 // RDH DEBUG
+    if ( (j % 100) == 0 ) {
+      getCout() << "j : tchk = " << j << " : " << tchk << std::endl;
+    }
+#endif
+  }
+  tchk *= scale_factor;
+  return tchk;
+}
+
+long double calcChecksum(Real_ptr ptr, Index_type len,
                          Real_type scale_factor)
 {
   long double tchk = 0.0;
@@ -536,7 +1607,7 @@ long double calcChecksum(Real_ptr ptr, int len,
   return tchk;
 }
 
-long double calcChecksum(Complex_ptr ptr, int len,
+long double calcChecksum(Complex_ptr ptr, Index_type len,
                          Real_type scale_factor)
 {
   long double tchk = 0.0;
@@ -558,6 +1629,474 @@ long double calcChecksum(Complex_ptr ptr, int len,
   return tchk;
 }
 
+template < typename T >
+long double calcChecksum(T* ptr, Index_type len,
+                         Real_type scale_factor)
+{
+  long double tchk = 0.0;
+  long double ckahan = 0.0;
+  for (Index_type j = 0; j < len; ++j) {
+    long double x = (std::abs(std::sin(j+1.0))+0.5) * ptr[j];
+    long double y = x - ckahan;
+    volatile long double t = tchk + y;
+    volatile long double z = t - tchk;
+    ckahan = z - y;
+    tchk = t;
+  }
+  tchk *= scale_factor;
+  return tchk;
+}
+
+template long double calcChecksum(Int32_type*, Index_type, Real_type);
+template long double calcChecksum(Int64_type*, Index_type, Real_type);
+template long double calcChecksum(Float_type*, Index_type, Real_type);
+template long double calcChecksum(Double_type*, Index_type, Real_type);
+
+
+/*!
+ * \brief Get if checksums of data in the data space are computed on the
+ * device, so only the checksum is copied back to the host.
+ */
+bool isDeviceChecksumDataSpace(DataSpace dataSpace)
+{
+  switch (dataSpace) {
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+    case DataSpace::OmpTarget:
+      return true;
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+    case DataSpace::CudaManaged:
+    case DataSpace::CudaDevice:
+    case DataSpace::CudaDeviceAsync:
+      return true;
+#endif
+#if defined(RAJA_ENABLE_HIP)
+    case DataSpace::HipDevice:
+    case DataSpace::HipDeviceFine:
+    case DataSpace::HipDeviceAsync:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+#pragma omp declare target
+#endif
+
+/*!
+ * \brief Double-double sum used by device checksums, hi + lo carries about
+ * twice the precision of a double.
+ */
+struct ChecksumSum
+{
+  double hi;
+  double lo;
+};
+
+/*!
+ * \brief Add two double-double sums.
+ */
+RAJA_HOST_DEVICE
+inline ChecksumSum checksumSumAdd(ChecksumSum a, ChecksumSum b)
+{
+  double s = a.hi + b.hi;
+  double bb = s - a.hi;
+  double e = (a.hi - (s - bb)) + (b.hi - bb);
+  e += a.lo + b.lo;
+  double hi = s + e;
+  return ChecksumSum{hi, e - (hi - s)};
+}
+
+/*!
+ * \brief Weighted checksum term of entry j, the same term as the host
+ * checksums above.
+ */
+template < typename T >
+RAJA_HOST_DEVICE
+inline double checksumTerm(const T* ptr, Index_type j)
+{
+  return (fabs(sin(j+1.0))+0.5) * ptr[j];
+}
+///
+RAJA_HOST_DEVICE
+inline double checksumTerm(const Complex_type* ptr, Index_type j)
+{
+  return (fabs(sin(j+1.0))+0.5) * (real(ptr[j])+imag(ptr[j]));
+}
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+#pragma omp end declare target
+#endif
+
+/*
+ * Upper bound on the number of partial sums of a device checksum. The
+ * partial sums depend only on the array length, so the checksum of the
+ * same data is the same in every run.
+ */
+static constexpr Index_type checksum_max_partial_sums = 1024;
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+
+/*!
+ * \brief Sum the checksum terms of the indices strided over the grid in
+ * each thread, then the threads of each block in a fixed tree order, and
+ * write the sum of each block to block_sums.
+ */
+template < size_t block_size, typename Term >
+__launch_bounds__(block_size)
+__global__ void checksum_block_sums(Index_type len, Term term,
+                                    ChecksumSum* block_sums)
+{
+  __shared__ ChecksumSum s_sums[block_size];
+
+  ChecksumSum sum{0.0, 0.0};
+  for (Index_type j = blockIdx.x * block_size + threadIdx.x; j < len;
+       j += gridDim.x * block_size) {
+    sum = checksumSumAdd(sum, term(j));
+  }
+
+  s_sums[threadIdx.x] = sum;
+  __syncthreads();
+
+  for (size_t w = block_size / 2; w > 0; w /= 2) {
+    if (threadIdx.x < w) {
+      s_sums[threadIdx.x] = checksumSumAdd(s_sums[threadIdx.x],
+                                           s_sums[threadIdx.x + w]);
+    }
+    __syncthreads();
+  }
+
+  if (threadIdx.x == 0) {
+    block_sums[blockIdx.x] = s_sums[0];
+  }
+}
+
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+
+/*!
+ * \brief Sum the checksum terms of len indices on the device, reducing the
+ * block sums with a second single block kernel.
+ */
+template < typename Term >
+ChecksumSum calcCudaChecksumSum(Index_type len, Term term)
+{
+  constexpr size_t block_size = 256;
+  const size_t grid_size = std::max(size_t(1), std::min(
+      size_t(checksum_max_partial_sums),
+      size_t(RAJA_DIVIDE_CEILING_INT(len, block_size))));
+
+  ChecksumSum* block_sums = static_cast<ChecksumSum*>(
+      allocCudaDeviceData((grid_size + 1) * sizeof(ChecksumSum)));
+
+  checksum_block_sums<block_size><<<grid_size, block_size>>>(
+      len, term, block_sums);
+  cudaErrchk( cudaGetLastError() );
+
+  checksum_block_sums<block_size><<<1, block_size>>>(
+      static_cast<Index_type>(grid_size),
+      [=] __device__ (Index_type b) { return block_sums[b]; },
+      block_sums + grid_size);
+  cudaErrchk( cudaGetLastError() );
+
+  ChecksumSum sum;
+  cudaErrchk( cudaMemcpy(&sum, block_sums + grid_size, sizeof(ChecksumSum),
+                         cudaMemcpyDeviceToHost) );
+
+  deallocCudaDeviceData(block_sums);
+
+  return sum;
+}
+
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+
+/*!
+ * \brief Sum the checksum terms of len indices on the device, reducing the
+ * block sums with a second single block kernel.
+ */
+template < typename Term >
+ChecksumSum calcHipChecksumSum(Index_type len, Term term)
+{
+  constexpr size_t block_size = 256;
+  const size_t grid_size = std::max(size_t(1), std::min(
+      size_t(checksum_max_partial_sums),
+      size_t(RAJA_DIVIDE_CEILING_INT(len, block_size))));
+
+  ChecksumSum* block_sums = static_cast<ChecksumSum*>(
+      allocHipDeviceData((grid_size + 1) * sizeof(ChecksumSum)));
+
+  hipLaunchKernelGGL((checksum_block_sums<block_size, Term>),
+      dim3(grid_size), dim3(block_size), 0, 0,
+      len, term, block_sums);
+  hipErrchk( hipGetLastError() );
+
+  auto block_sum = [=] __device__ (Index_type b) { return block_sums[b]; };
+  hipLaunchKernelGGL((checksum_block_sums<block_size, decltype(block_sum)>),
+      dim3(1), dim3(block_size), 0, 0,
+      static_cast<Index_type>(grid_size), block_sum, block_sums + grid_size);
+  hipErrchk( hipGetLastError() );
+
+  ChecksumSum sum;
+  hipErrchk( hipMemcpy(&sum, block_sums + grid_size, sizeof(ChecksumSum),
+                       hipMemcpyDeviceToHost) );
+
+  deallocHipDeviceData(block_sums);
+
+  return sum;
+}
+
+#endif
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+/*!
+ * \brief Sum the checksum terms of len indices on the target device in
+ * contiguous chunks, then sum the chunk sums in order on the host.
+ */
+template < typename T >
+ChecksumSum calcOpenMPTargetChecksumSum(const T* ptr, Index_type len)
+{
+  const Index_type num_chunks =
+      std::max(Index_type(1), std::min(checksum_max_partial_sums, len));
+  const size_t nbytes = num_chunks * sizeof(ChecksumSum);
+
+  const int did = getOpenMPTargetDevice();
+  ChecksumSum* chunk_sums =
+      static_cast<ChecksumSum*>(allocOpenMPDeviceData(nbytes, did));
+
+  #pragma omp target teams distribute parallel for \
+          is_device_ptr(ptr, chunk_sums) device(did)
+  for (Index_type c = 0; c < num_chunks; ++c) {
+    const Index_type jbegin = (len * c) / num_chunks;
+    const Index_type jend = (len * (c+1)) / num_chunks;
+    ChecksumSum sum{0.0, 0.0};
+    for (Index_type j = jbegin; j < jend; ++j) {
+      sum = checksumSumAdd(sum, ChecksumSum{checksumTerm(ptr, j), 0.0});
+    }
+    chunk_sums[c] = sum;
+  }
+
+  std::vector<ChecksumSum> host_sums(num_chunks);
+  copyOpenMPTargetData(host_sums.data(), chunk_sums, nbytes,
+                       getOpenMPTargetHost(), did);
+  deallocOpenMPDeviceData(chunk_sums, did);
+
+  ChecksumSum sum{0.0, 0.0};
+  for (Index_type c = 0; c < num_chunks; ++c) {
+    sum = checksumSumAdd(sum, host_sums[c]);
+  }
+  return sum;
+}
+
+#endif
+
+/*
+ * Calculate checksum of data in a device data space on the device.
+ */
+template < typename T >
+long double calcDeviceChecksum(DataSpace dataSpace, T* ptr, Index_type len,
+                               Real_type scale_factor)
+{
+  ChecksumSum sum{0.0, 0.0};
+
+  if (isCudaDataSpace(dataSpace)) {
+#if defined(RAJA_ENABLE_CUDA)
+    sum = calcCudaChecksumSum(len, [=] __device__ (Index_type j) {
+      return ChecksumSum{checksumTerm(ptr, j), 0.0};
+    });
+#endif
+  } else if (isHipDataSpace(dataSpace)) {
+#if defined(RAJA_ENABLE_HIP)
+    sum = calcHipChecksumSum(len, [=] __device__ (Index_type j) {
+      return ChecksumSum{checksumTerm(ptr, j), 0.0};
+    });
+#endif
+  } else if (isOpenMPTargetDataSpace(dataSpace)) {
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+    sum = calcOpenMPTargetChecksumSum(ptr, len);
+#endif
+  } else {
+    throw std::invalid_argument("calcDeviceChecksum : Unknown data space");
+  }
+
+  long double tchk = static_cast<long double>(sum.hi) +
+                     static_cast<long double>(sum.lo);
+  tchk *= scale_factor;
+  RAJA_UNUSED_VAR(ptr);
+  RAJA_UNUSED_VAR(len);
+  return tchk;
+}
+
+template long double calcDeviceChecksum(DataSpace, Int32_type*, Index_type, Real_type);
+template long double calcDeviceChecksum(DataSpace, Int64_type*, Index_type, Real_type);
+template long double calcDeviceChecksum(DataSpace, Float_type*, Index_type, Real_type);
+template long double calcDeviceChecksum(DataSpace, Double_type*, Index_type, Real_type);
+template long double calcDeviceChecksum(DataSpace, Complex_type*, Index_type, Real_type);
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+#pragma omp declare target
+#endif
+
+/*!
+ * \brief Mix the bits of a 64 bit value, the splitmix64 finalizer.
+ */
+RAJA_HOST_DEVICE
+inline uint64_t dataHashMix(uint64_t x)
+{
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ull;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebull;
+  x ^= x >> 31;
+  return x;
+}
+
+/*!
+ * \brief Hash term of entry j, its bits in 64 bit words mixed with j so
+ * permuted entries give a different hash.
+ */
+template < typename T >
+RAJA_HOST_DEVICE
+inline uint64_t dataHashTerm(const T* ptr, Index_type j)
+{
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(ptr + j);
+  uint64_t term = static_cast<uint64_t>(j) * 0x9e3779b97f4a7c15ull;
+  for (size_t w = 0; w < sizeof(T); w += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    for (size_t b = w; b < sizeof(T) && b < w + sizeof(uint64_t); ++b) {
+      word |= static_cast<uint64_t>(bytes[b]) << (8*(b-w));
+    }
+    term = dataHashMix(term ^ word);
+  }
+  return term;
+}
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+#pragma omp end declare target
+#endif
+
+template < typename T >
+uint64_t calcDataHash(const T* ptr, Index_type len)
+{
+  uint64_t hash = 0;
+  for (Index_type j = 0; j < len; ++j) {
+    hash += dataHashTerm(ptr, j);
+  }
+  return hash;
+}
+
+template uint64_t calcDataHash(const Int32_type*, Index_type);
+template uint64_t calcDataHash(const Int64_type*, Index_type);
+template uint64_t calcDataHash(const Float_type*, Index_type);
+template uint64_t calcDataHash(const Double_type*, Index_type);
+template uint64_t calcDataHash(const Complex_type*, Index_type);
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+
+/*!
+ * \brief Sum the hash terms of the indices strided over the grid in each
+ * thread, then the threads of each block, and add the sum of each block to
+ * hash. Wrapping sums are associative so the hash does not depend on the
+ * order blocks are added in.
+ */
+template < size_t block_size, typename T >
+__launch_bounds__(block_size)
+__global__ void data_hash_sums(const T* ptr, Index_type len,
+                               unsigned long long* hash)
+{
+  __shared__ uint64_t s_sums[block_size];
+
+  uint64_t sum = 0;
+  for (Index_type j = blockIdx.x * block_size + threadIdx.x; j < len;
+       j += gridDim.x * block_size) {
+    sum += dataHashTerm(ptr, j);
+  }
+
+  s_sums[threadIdx.x] = sum;
+  __syncthreads();
+
+  for (size_t w = block_size / 2; w > 0; w /= 2) {
+    if (threadIdx.x < w) {
+      s_sums[threadIdx.x] += s_sums[threadIdx.x + w];
+    }
+    __syncthreads();
+  }
+
+  if (threadIdx.x == 0) {
+    atomicAdd(hash, static_cast<unsigned long long>(s_sums[0]));
+  }
+}
+
+#endif
+
+/*
+ * Calculate hash of data in a device data space on the device.
+ */
+template < typename T >
+uint64_t calcDeviceDataHash(DataSpace dataSpace, const T* ptr, Index_type len)
+{
+  unsigned long long hash = 0;
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+  constexpr size_t block_size = 256;
+  const size_t grid_size = std::max(size_t(1), std::min(
+      size_t(checksum_max_partial_sums),
+      size_t(RAJA_DIVIDE_CEILING_INT(len, block_size))));
+#endif
+
+  if (isCudaDataSpace(dataSpace)) {
+#if defined(RAJA_ENABLE_CUDA)
+    unsigned long long* d_hash = static_cast<unsigned long long*>(
+        allocCudaDeviceData(sizeof(unsigned long long)));
+    cudaErrchk( cudaMemset(d_hash, 0, sizeof(unsigned long long)) );
+    data_hash_sums<block_size><<<grid_size, block_size>>>(ptr, len, d_hash);
+    cudaErrchk( cudaGetLastError() );
+    cudaErrchk( cudaMemcpy(&hash, d_hash, sizeof(unsigned long long),
+                           cudaMemcpyDeviceToHost) );
+    deallocCudaDeviceData(d_hash);
+#endif
+  } else if (isHipDataSpace(dataSpace)) {
+#if defined(RAJA_ENABLE_HIP)
+    unsigned long long* d_hash = static_cast<unsigned long long*>(
+        allocHipDeviceData(sizeof(unsigned long long)));
+    hipErrchk( hipMemset(d_hash, 0, sizeof(unsigned long long)) );
+    hipLaunchKernelGGL((data_hash_sums<block_size, T>),
+        dim3(grid_size), dim3(block_size), 0, 0,
+        ptr, len, d_hash);
+    hipErrchk( hipGetLastError() );
+    hipErrchk( hipMemcpy(&hash, d_hash, sizeof(unsigned long long),
+                         hipMemcpyDeviceToHost) );
+    deallocHipDeviceData(d_hash);
+#endif
+  } else if (isOpenMPTargetDataSpace(dataSpace)) {
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+    const int did = getOpenMPTargetDevice();
+    #pragma omp target teams distribute parallel for \
+            is_device_ptr(ptr) device(did) map(tofrom:hash) reduction(+:hash)
+    for (Index_type j = 0; j < len; ++j) {
+      hash += dataHashTerm(ptr, j);
+    }
+#endif
+  } else {
+    throw std::invalid_argument("calcDeviceDataHash : Unknown data space");
+  }
+
+  RAJA_UNUSED_VAR(ptr);
+  RAJA_UNUSED_VAR(len);
+  return static_cast<uint64_t>(hash);
+}
+
+template uint64_t calcDeviceDataHash(DataSpace, const Int32_type*, Index_type);
+template uint64_t calcDeviceDataHash(DataSpace, const Int64_type*, Index_type);
+template uint64_t calcDeviceDataHash(DataSpace, const Float_type*, Index_type);
+template uint64_t calcDeviceDataHash(DataSpace, const Double_type*, Index_type);
+template uint64_t calcDeviceDataHash(DataSpace, const Complex_type*, Index_type);
+
 }  // closing brace for detail namespace
 
 
@@ -575,6 +2114,9 @@ DataSpace hostAccessibleDataSpace(DataSpace dataSpace)
     case DataSpace::HipPinned:
     case DataSpace::HipPinnedFine:
     case DataSpace::HipPinnedCoarse:
+    case DataSpace::OmpTargetSystem:
+    case DataSpace::CudaSystem:
+    case DataSpace::HipSystem:
       return dataSpace;
 
     case DataSpace::OmpTarget:
@@ -582,6 +2124,7 @@ DataSpace hostAccessibleDataSpace(DataSpace dataSpace)
 
     case DataSpace::CudaManaged:
     case DataSpace::CudaDevice:
+    case DataSpace::CudaDeviceAsync:
       return DataSpace::CudaPinned;
 
     case DataSpace::HipManaged:
@@ -591,8 +2134,16 @@ DataSpace hostAccessibleDataSpace(DataSpace dataSpace)
 
     case DataSpace::HipDevice:
     case DataSpace::HipDeviceFine:
+    case DataSpace::HipDeviceAsync:
       return DataSpace::HipPinned;
 
+    case DataSpace::SyclPinned:
+    case DataSpace::SyclManaged:
+      return dataSpace;
+
+    case DataSpace::SyclDevice:
+      return DataSpace::SyclPinned;
+
     default:
     {
       throw std::invalid_argument("hostAccessibleDataSpace : Unknown data space");
@@ -17,9 +17,13 @@
 #include "RAJAPerfSuite.hpp"
 #include "RPTypes.hpp"
 
+#include "RAJA/util/macros.hpp"
+
+#include <cstdint>
 #include <limits>
 #include <new>
 #include <type_traits>
+#include <vector>
 
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
@@ -46,6 +50,22 @@ void incDataInitCount();
 
 void copyHostData(void* dst_ptr, const void* src_ptr, size_t len);
 
+/*!
+ * \brief Set the page size policy used to allocate host data with
+ *        allocHostData.
+ *
+ * THP asks for transparent huge pages with madvise, Huge2MB and Huge1GB map
+ * explicit huge pages with MAP_HUGETLB, which must be reserved on the node.
+ * Allocations smaller than a huge page always use default pages.
+ */
+void setHostPagePolicy(HostPagePolicy policy);
+
+/*!
+ * \brief Get the size in bytes of the pages of host data allocated with
+ *        allocHostData that are at least this large.
+ */
+size_t getHostPageSize();
+
 /*!
  * \brief Allocate data arrays.
  */
@@ -60,7 +80,7 @@ void deallocHostData(void* ptr);
 /*!
  * \brief Allocate data array in dataSpace.
  */
-void* allocData(DataSpace dataSpace, int nbytes, int align);
+void* allocData(DataSpace dataSpace, size_t nbytes, size_t align);
 
 /*!
  * \brief Copy data from one dataSpace to another.
@@ -74,61 +94,264 @@ void copyData(DataSpace dst_dataSpace, void* dst_ptr,
  */
 void deallocData(DataSpace dataSpace, void* ptr);
 
+/*!
+ * \brief Return bytes allocated with allocData and not yet freed, summed
+ *        over all data spaces.
+ */
+size_t getDataLiveBytes();
+
+/*!
+ * \brief Return bytes allocated with allocData in device data spaces and not
+ *        yet freed, and the most of them live at once since the last call
+ *        of resetDataPeakDeviceBytes.
+ */
+size_t getDataLiveDeviceBytes();
+size_t getDataPeakDeviceBytes();
+void resetDataPeakDeviceBytes();
 
 /*!
- * \brief Initialize Int_type data array.
+ * \brief Return the free memory of the current CUDA or HIP device, from
+ *        cudaMemGetInfo or hipMemGetInfo, or 0 without one.
+ */
+size_t getGPUFreeBytes();
+
+/*!
+ * \brief Apply the managed policy to all live data allocated in CUDA and
+ *        HIP managed data spaces, ie. prefetch the data to the device.
+ *
+ * Synchronizes the device so prefetches finish before returning.
+ */
+void applyManagedPolicy(ManagedPolicy policy);
+
+/*!
+ * \brief Read the minor and major page faults of this process so far.
+ */
+void readPageFaults(long long& minor_faults, long long& major_faults);
+
+/*!
+ * \brief Allocation statistics for the data pool of a dataSpace.
+ */
+struct DataPoolStats
+{
+  size_t num_allocs = 0;        /*!< number of allocations requested */
+  size_t num_reused = 0;        /*!< number of allocations served from pool */
+  size_t in_use_bytes = 0;      /*!< bytes currently handed out */
+  size_t peak_in_use_bytes = 0; /*!< max bytes handed out at once */
+  size_t held_bytes = 0;        /*!< bytes currently allocated by the pool */
+  size_t peak_held_bytes = 0;   /*!< max bytes allocated by the pool at once */
+};
+
+/*!
+ * \brief Enable or disable pooling of allocations made with allocData.
+ *
+ * When enabled, memory freed with deallocData is kept in a pool for its
+ * dataSpace and reused by later allocations of the same size class and
+ * alignment instead of being returned to the system.
+ */
+void setDataPoolEnabled(bool enabled);
+
+bool getDataPoolEnabled();
+
+/*!
+ * \brief Set the release threshold in bytes of the default memory pool of
+ *        each GPU used by the CudaDeviceAsync and HipDeviceAsync data spaces.
+ *
+ * The pool keeps up to this many bytes of freed memory for later
+ * allocations when the device or a stream synchronizes, 0 returns all of it.
+ */
+void setGPUPoolReleaseThreshold(size_t nbytes);
+
+size_t getGPUPoolReleaseThreshold();
+
+/*!
+ * \brief Get allocation statistics for the data pool of dataSpace.
+ */
+DataPoolStats getDataPoolStats(DataSpace dataSpace);
+
+/*!
+ * \brief Return memory cached in the data pools to the system.
+ *
+ * Memory currently in use is not affected.
+ */
+void releaseDataPools();
+
+/*!
+ * \brief Return the size of the largest host cache, ie. the LLC.
+ */
+size_t getHostCacheSize();
+
+/*!
+ * \brief Return the sizes of the host data and unified cache levels, from L1
+ *        to the LLC, empty if they are not known.
+ */
+std::vector<size_t> getHostCacheLevelSizes();
+
+/*!
+ * \brief Evict kernel data from the host caches and, when gpu is true, the
+ *        GPU L2 cache by writing flush buffers larger than the caches.
+ *
+ * The flush buffers are allocated on first use and kept until
+ * releaseCacheFlushBuffers is called.
+ */
+void flushCaches(bool gpu);
+
+/*!
+ * \brief Free the buffers used by flushCaches.
+ */
+void releaseCacheFlushBuffers();
+
+/*!
+ * \brief Return the number of visible CUDA or HIP devices, 0 without GPUs.
+ */
+int getNumGPUDevices();
+
+/*!
+ * \brief Make device the current CUDA or HIP device of this thread.
+ */
+void setGPUDevice(int device);
+
+/*!
+ * \brief Return the current CUDA or HIP device of this thread, -1 without
+ *        GPUs.
+ */
+int getGPUDevice();
+
+/*!
+ * \brief Return the PCI bus id of the current CUDA or HIP device of this
+ *        thread, ie. 0000:3b:00.0, empty without GPUs.
+ */
+std::string getGPUPciBusId();
+
+/*!
+ * \brief Get if the current CUDA or HIP device of this thread can access
+ *        memory from the system allocator, used by the CudaSystem and
+ *        HipSystem data spaces, false without GPUs.
+ */
+bool haveGPUPageableMemoryAccess();
+
+/*!
+ * \brief Set the NUMA policy used to place the pages of Omp data and the
+ *        NUMA nodes it applies to.
+ *
+ * FirstTouch leaves placement to the first touch of each page in allocData,
+ * Interleave and Membind apply the policy to the pages of each allocation
+ * before they are touched. An empty list of nodes means all nodes the
+ * process may allocate memory on.
+ */
+void setOmpNumaPolicy(NumaPolicy policy, const std::vector<int>& nodes);
+
+
+/*!
+ * \brief Counter based random number generator.
+ *
+ * Returns a value in the interval [0.0, 1.0) that only depends on the
+ * given seed and counter, so array entries may be initialized in any order,
+ * in parallel, or on a device and produce the same values.
+ */
+RAJA_HOST_DEVICE
+inline Real_type counterRandValue(unsigned long long seed,
+                                  unsigned long long counter)
+{
+  // splitmix64 mix of seed and counter
+  unsigned long long z = seed + (counter + 1ull) * 0x9E3779B97F4A7C15ull;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  z = z ^ (z >> 31);
+  return static_cast<Real_type>(z >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/*!
+ * \brief Get the data space to initialize data in for this dataSpace.
+ *
+ * This is the dataSpace itself if data in it can be initialized in place,
+ * either on the host or on the device, otherwise it is a host accessible
+ * data space.
+ */
+DataSpace initDataSpace(DataSpace dataSpace);
+
+/*!
+ * \brief Initialize Int_type data array in dataSpace.
  *
  * Array entries are randomly initialized to +/-1.
  * Then, two randomly-chosen entries are reset, one to
  * a value > 1, one to a value < -1.
  */
-void initData(Int_ptr& ptr, int len);
+void initData(DataSpace dataSpace, Int_ptr& ptr, Index_type len);
 
 /*!
- * \brief Initialize Real_type data array.
+ * \brief Initialize Real_type data array in dataSpace.
  *
  * Array entries are set (non-randomly) to positive values
  * in the interval (0.0, 1.0) based on their array position (index)
  * and the order in which this method is called.
  */
-void initData(Real_ptr& ptr, int len);
+void initData(DataSpace dataSpace, Real_ptr& ptr, Index_type len);
 
 /*!
- * \brief Initialize Real_type data array.
+ * \brief Initialize Real_type data array in dataSpace.
  *
  * Array entries are set to given constant value.
  */
-void initDataConst(Real_ptr& ptr, int len, Real_type val);
+void initDataConst(DataSpace dataSpace, Real_ptr& ptr, Index_type len, Real_type val);
 
 /*!
- * \brief Initialize Index_type data array.
+ * \brief Initialize Index_type data array in dataSpace.
  *
  * Array entries are set to given constant value.
  */
-void initDataConst(Index_type*& ptr, int len, Index_type val);
+void initDataConst(DataSpace dataSpace, Index_type*& ptr, Index_type len, Index_type val);
 
 /*!
- * \brief Initialize Real_type data array with random sign.
+ * \brief Initialize Real_type data array in dataSpace with random sign.
  *
  * Array entries are initialized in the same way as the method
  * initData(Real_ptr& ptr...) above, but with random sign.
  */
-void initDataRandSign(Real_ptr& ptr, int len);
+void initDataRandSign(DataSpace dataSpace, Real_ptr& ptr, Index_type len);
 
 /*!
- * \brief Initialize Real_type data array with random values.
+ * \brief Initialize Real_type data array in dataSpace with random values.
  *
- * Array entries are initialized with random values in the interval [0.0, 1.0].
+ * Array entries are initialized with random values in the interval [0.0, 1.0).
  */
-void initDataRandValue(Real_ptr& ptr, int len);
+void initDataRandValue(DataSpace dataSpace, Real_ptr& ptr, Index_type len);
 
 /*!
- * \brief Initialize Complex_type data array.
+ * \brief Initialize floating point data array of a kernel data type
+ *        in dataSpace.
+ *
+ * Array entries are set in the same way as the method
+ * initData(Real_ptr& ptr...) above.
+ */
+template < typename T >
+void initData(DataSpace dataSpace, T*& ptr, Index_type len);
+
+/*!
+ * \brief Initialize data array of a kernel data type in dataSpace.
+ *
+ * Array entries are set to given constant value.
+ */
+template < typename T >
+void initDataConst(DataSpace dataSpace, T*& ptr, Index_type len, T val);
+
+/*!
+ * \brief Initialize data array of a kernel data type in dataSpace with
+ *        random values.
+ *
+ * Integer array entries are initialized with random values in [0, 128),
+ * small enough that sums of many entries fit in 32 bits. Floating point
+ * array entries are initialized with random values in [0.0, 1.0).
+ */
+template < typename T >
+void initDataRandValue(DataSpace dataSpace, T*& ptr, Index_type len);
+
+/*!
+ * \brief Initialize Complex_type data array in dataSpace.
  *
  * Real and imaginary array entries are initialized in the same way as the
  * method allocAndInitData(Real_ptr& ptr...) above.
  */
-void initData(Complex_ptr& ptr, int len);
+void initData(DataSpace dataSpace, Complex_ptr& ptr, Index_type len);
 
 /*!
  * \brief Initialize Real_type scalar data.
@@ -147,15 +370,57 @@ void initData(Real_type& d);
  *
  * Checksumn is multiplied by given scale factor.
  */
-long double calcChecksum(Int_ptr d, int len,
+long double calcChecksum(Int_ptr d, Index_type len,
+                         Real_type scale_factor);
+///
+long double calcChecksum(Real_ptr d, Index_type len,
                          Real_type scale_factor);
 ///
-long double calcChecksum(Real_ptr d, int len,
+long double calcChecksum(Complex_ptr d, Index_type len,
                          Real_type scale_factor);
 ///
-long double calcChecksum(Complex_ptr d, int len,
+template < typename T >
+long double calcChecksum(T* d, Index_type len,
                          Real_type scale_factor);
 
+/*!
+ * \brief Get if checksums of data in the data space are computed on the
+ * device by calcDeviceChecksum.
+ */
+bool isDeviceChecksumDataSpace(DataSpace dataSpace);
+
+/*!
+ * \brief Calculate and return the checksum of a data array in a device
+ * data space on the device.
+ *
+ * The weighted entries are summed in double-double precision in an order
+ * that depends only on len, so only the checksum is copied to the host.
+ * Defined for the Int32, Int64, Float, Double, and Complex data types.
+ */
+template < typename T >
+long double calcDeviceChecksum(DataSpace dataSpace, T* d, Index_type len,
+                               Real_type scale_factor);
+
+/*!
+ * \brief Calculate and return a hash of the bits of a host data array.
+ *
+ * The hash is a wrapping sum of a mixed term of each entry and its index,
+ * so it does not depend on the order terms are summed in and is the same
+ * when computed on the device by calcDeviceDataHash. It is much cheaper
+ * than a checksum and is used to find data that is bitwise the same as
+ * data checksummed before, see '--checksum-once'.
+ * Defined for the Int32, Int64, Float, Double, and Complex data types.
+ */
+template < typename T >
+uint64_t calcDataHash(const T* d, Index_type len);
+
+/*!
+ * \brief Calculate and return the hash of a data array in a device data
+ * space, where isDeviceChecksumDataSpace is true, on the device.
+ */
+template < typename T >
+uint64_t calcDeviceDataHash(DataSpace dataSpace, const T* d, Index_type len);
+
 }  // closing brace for detail namespace
 
 
@@ -171,16 +436,17 @@ DataSpace hostAccessibleDataSpace(DataSpace dataSpace);
  * \brief Allocate data array (ptr).
  */
 template <typename T>
-inline void allocData(DataSpace dataSpace, T*& ptr_ref, int len, int align)
+inline void allocData(DataSpace dataSpace, T*& ptr_ref, Index_type len, size_t align)
 {
   size_t nbytes = len*sizeof(T);
   T* ptr = static_cast<T*>(detail::allocData(dataSpace, nbytes, align));
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
   if (dataSpace == DataSpace::Omp) {
-    // perform first touch on Omp Data
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
+    // perform first touch on Omp Data with the static schedule used by
+    // the OpenMP kernels so pages are placed near the threads using them
+    #pragma omp parallel for schedule(static)
+    for (Index_type i = 0; i < len; ++i) {
       ptr[i] = T{};
     };
   }
@@ -205,7 +471,7 @@ inline void deallocData(DataSpace dataSpace, T*& ptr)
 template <typename T>
 inline void copyData(DataSpace dst_dataSpace, T* dst_ptr,
                      DataSpace src_dataSpace, const T* src_ptr,
-                     int len)
+                     Index_type len)
 {
   size_t nbytes = len*sizeof(T);
   detail::copyData(dst_dataSpace, dst_ptr, src_dataSpace, src_ptr, nbytes);
@@ -216,7 +482,7 @@ inline void copyData(DataSpace dst_dataSpace, T* dst_ptr,
  */
 template <typename T>
 inline void moveData(DataSpace new_dataSpace, DataSpace old_dataSpace,
-                     T*& ptr, int len, int align)
+                     T*& ptr, Index_type len, size_t align)
 {
   if (new_dataSpace != old_dataSpace) {
 
@@ -237,7 +503,7 @@ template <typename T>
 struct AutoDataMover
 {
   AutoDataMover(DataSpace new_dataSpace, DataSpace old_dataSpace,
-                T*& ptr, int len, int align)
+                T*& ptr, Index_type len, size_t align)
     : m_ptr(&ptr)
     , m_new_dataSpace(new_dataSpace)
     , m_old_dataSpace(old_dataSpace)
@@ -284,21 +550,21 @@ private:
   T** m_ptr;
   DataSpace m_new_dataSpace;
   DataSpace m_old_dataSpace;
-  int m_len;
-  int m_align;
+  Index_type m_len;
+  size_t m_align;
 };
 
 /*!
  * \brief Allocate and initialize data array.
  */
 template <typename T>
-inline void allocAndInitData(DataSpace dataSpace, T*& ptr, int len, int align)
+inline void allocAndInitData(DataSpace dataSpace, T*& ptr, Index_type len, size_t align)
 {
-  DataSpace init_dataSpace = hostAccessibleDataSpace(dataSpace);
+  DataSpace init_dataSpace = detail::initDataSpace(dataSpace);
 
   allocData(init_dataSpace, ptr, len, align);
 
-  detail::initData(ptr, len);
+  detail::initData(init_dataSpace, ptr, len);
 
   moveData(dataSpace, init_dataSpace, ptr, len, align);
 }
@@ -310,14 +576,14 @@ inline void allocAndInitData(DataSpace dataSpace, T*& ptr, int len, int align)
  * Array entries are initialized using the method initDataConst.
  */
 template <typename T>
-inline void allocAndInitDataConst(DataSpace dataSpace, T*& ptr, int len, int align,
+inline void allocAndInitDataConst(DataSpace dataSpace, T*& ptr, Index_type len, size_t align,
                                   T val)
 {
-  DataSpace init_dataSpace = hostAccessibleDataSpace(dataSpace);
+  DataSpace init_dataSpace = detail::initDataSpace(dataSpace);
 
   allocData(init_dataSpace, ptr, len, align);
 
-  detail::initDataConst(ptr, len, val);
+  detail::initDataConst(init_dataSpace, ptr, len, val);
 
   moveData(dataSpace, init_dataSpace, ptr, len, align);
 }
@@ -328,13 +594,13 @@ inline void allocAndInitDataConst(DataSpace dataSpace, T*& ptr, int len, int ali
  * Array is initialized using method initDataRandSign.
  */
 template <typename T>
-inline void allocAndInitDataRandSign(DataSpace dataSpace, T*& ptr, int len, int align)
+inline void allocAndInitDataRandSign(DataSpace dataSpace, T*& ptr, Index_type len, size_t align)
 {
-  DataSpace init_dataSpace = hostAccessibleDataSpace(dataSpace);
+  DataSpace init_dataSpace = detail::initDataSpace(dataSpace);
 
   allocData(init_dataSpace, ptr, len, align);
 
-  detail::initDataRandSign(ptr, len);
+  detail::initDataRandSign(init_dataSpace, ptr, len);
 
   moveData(dataSpace, init_dataSpace, ptr, len, align);
 }
@@ -346,13 +612,13 @@ inline void allocAndInitDataRandSign(DataSpace dataSpace, T*& ptr, int len, int
  * Array is initialized using method initDataRandValue.
  */
 template <typename T>
-inline void allocAndInitDataRandValue(DataSpace dataSpace, T*& ptr, int len, int align)
+inline void allocAndInitDataRandValue(DataSpace dataSpace, T*& ptr, Index_type len, size_t align)
 {
-  DataSpace init_dataSpace = hostAccessibleDataSpace(dataSpace);
+  DataSpace init_dataSpace = detail::initDataSpace(dataSpace);
 
   allocData(init_dataSpace, ptr, len, align);
 
-  detail::initDataRandValue(ptr, len);
+  detail::initDataRandValue(init_dataSpace, ptr, len);
 
   moveData(dataSpace, init_dataSpace, ptr, len, align);
 }
@@ -361,9 +627,13 @@ inline void allocAndInitDataRandValue(DataSpace dataSpace, T*& ptr, int len, int
  * Calculate and return checksum for arrays.
  */
 template <typename T>
-inline long double calcChecksum(DataSpace dataSpace, T* ptr, int len, int align,
+inline long double calcChecksum(DataSpace dataSpace, T* ptr, Index_type len, size_t align,
                                 Real_type scale_factor)
 {
+  if (detail::isDeviceChecksumDataSpace(dataSpace)) {
+    return detail::calcDeviceChecksum(dataSpace, ptr, len, scale_factor);
+  }
+
   T* check_ptr = ptr;
   T* copied_ptr = nullptr;
 
@@ -385,6 +655,37 @@ inline long double calcChecksum(DataSpace dataSpace, T* ptr, int len, int align,
   return val;
 }
 
+/*
+ * Calculate and return hash of the bits of arrays, see detail::calcDataHash.
+ */
+template <typename T>
+inline uint64_t calcDataHash(DataSpace dataSpace, T* ptr, Index_type len, size_t align)
+{
+  if (detail::isDeviceChecksumDataSpace(dataSpace)) {
+    return detail::calcDeviceDataHash(dataSpace, ptr, len);
+  }
+
+  T* hash_ptr = ptr;
+  T* copied_ptr = nullptr;
+
+  DataSpace hash_dataSpace = hostAccessibleDataSpace(dataSpace);
+  if (hash_dataSpace != dataSpace) {
+    allocData(hash_dataSpace, copied_ptr, len, align);
+
+    copyData(hash_dataSpace, copied_ptr, dataSpace, ptr, len);
+
+    hash_ptr = copied_ptr;
+  }
+
+  uint64_t hash = detail::calcDataHash(hash_ptr, len);
+
+  if (hash_dataSpace != dataSpace) {
+    deallocData(hash_dataSpace, copied_ptr);
+  }
+
+  return hash;
+}
+
 
 /*!
  * \brief Holds a RajaPool object and provides access to it via a
@@ -0,0 +1,299 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "EnergyUtils.hpp"
+
+#if defined(RAJA_PERFSUITE_USE_NVML)
+#include <nvml.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+#include <amd_smi/amdsmi.h>
+#endif
+
+#if defined(__linux__)
+#include <dirent.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+namespace
+{
+
+/*!
+ * \brief An energy meter and how to read it.
+ */
+struct EnergyMeter
+{
+  enum Kind { RAPL, NVML, AMDSMI };
+
+  Kind kind;
+  std::string path;     // RAPL energy_uj file
+  size_t device;        // index of NVML or AMD SMI device handle
+  double range_joules;  // meter wraps at this value, 0 -> does not wrap
+};
+
+std::vector<EnergyMeter> energy_meters;
+std::vector<std::string> energy_meter_names;
+
+#if defined(RAJA_PERFSUITE_USE_NVML)
+std::vector<nvmlDevice_t> nvml_devices;
+bool nvml_initialized = false;
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+std::vector<amdsmi_processor_handle> amdsmi_devices;
+bool amdsmi_initialized = false;
+#endif
+
+/*!
+ * \brief Read an unsigned integer from a sysfs file, return false on failure.
+ */
+bool readSysfsValue(const std::string& path, unsigned long long& value)
+{
+  std::ifstream file(path);
+  return static_cast<bool>(file >> value);
+}
+
+/*!
+ * \brief Add the readable RAPL package domains, ie. intel-rapl:0.
+ *
+ * Subdomains such as intel-rapl:0:0 (core) are part of their package and
+ * are not added.
+ */
+void addRaplMeters()
+{
+#if defined(__linux__)
+  const std::string powercap_dir("/sys/class/powercap/");
+  DIR* dir = opendir(powercap_dir.c_str());
+  if (dir == nullptr) {
+    return;
+  }
+
+  std::vector<std::string> domains;
+  for (dirent* entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+    const std::string domain(entry->d_name);
+    if (domain.rfind("intel-rapl:", 0) == 0 &&
+        std::count(domain.begin(), domain.end(), ':') == 1) {
+      domains.push_back(domain);
+    }
+  }
+  closedir(dir);
+  std::sort(domains.begin(), domains.end());
+
+  for (const std::string& domain : domains) {
+    const std::string path = powercap_dir + domain + "/energy_uj";
+    unsigned long long value = 0;
+    if (!readSysfsValue(path, value)) {
+      continue; // reading energy_uj usually requires elevated privileges
+    }
+    unsigned long long range = 0;
+    readSysfsValue(powercap_dir + domain + "/max_energy_range_uj", range);
+
+    energy_meters.push_back(EnergyMeter{EnergyMeter::RAPL, path, 0,
+                                        static_cast<double>(range) * 1.0e-6});
+    energy_meter_names.push_back("cpu_package_" + domain.substr(domain.find(':')+1));
+  }
+#endif
+}
+
+/*!
+ * \brief Add NVIDIA GPUs that support energy consumption queries.
+ */
+void addNvmlMeters()
+{
+#if defined(RAJA_PERFSUITE_USE_NVML)
+  if (nvmlInit() != NVML_SUCCESS) {
+    return;
+  }
+  nvml_initialized = true;
+
+  unsigned int num_devices = 0;
+  if (nvmlDeviceGetCount(&num_devices) != NVML_SUCCESS) {
+    return;
+  }
+  for (unsigned int id = 0; id < num_devices; ++id) {
+    nvmlDevice_t device;
+    unsigned long long millijoules = 0;
+    if (nvmlDeviceGetHandleByIndex(id, &device) != NVML_SUCCESS ||
+        nvmlDeviceGetTotalEnergyConsumption(device, &millijoules) != NVML_SUCCESS) {
+      continue;
+    }
+    energy_meters.push_back(EnergyMeter{EnergyMeter::NVML, "", nvml_devices.size(), 0.0});
+    energy_meter_names.push_back("gpu_" + std::to_string(id));
+    nvml_devices.push_back(device);
+  }
+#endif
+}
+
+/*!
+ * \brief Add AMD GPUs that support energy count queries.
+ */
+void addAmdSmiMeters()
+{
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+  if (amdsmi_init(AMDSMI_INIT_AMD_GPUS) != AMDSMI_STATUS_SUCCESS) {
+    return;
+  }
+  amdsmi_initialized = true;
+
+  uint32_t num_sockets = 0;
+  if (amdsmi_get_socket_handles(&num_sockets, nullptr) != AMDSMI_STATUS_SUCCESS) {
+    return;
+  }
+  std::vector<amdsmi_socket_handle> sockets(num_sockets);
+  if (amdsmi_get_socket_handles(&num_sockets, sockets.data()) != AMDSMI_STATUS_SUCCESS) {
+    return;
+  }
+
+  size_t id = 0;
+  for (amdsmi_socket_handle socket : sockets) {
+    uint32_t num_devices = 0;
+    if (amdsmi_get_processor_handles(socket, &num_devices, nullptr) != AMDSMI_STATUS_SUCCESS) {
+      continue;
+    }
+    std::vector<amdsmi_processor_handle> devices(num_devices);
+    if (amdsmi_get_processor_handles(socket, &num_devices, devices.data()) != AMDSMI_STATUS_SUCCESS) {
+      continue;
+    }
+    for (amdsmi_processor_handle device : devices) {
+      uint64_t count = 0;
+      float resolution = 0.0f;
+      uint64_t timestamp = 0;
+      if (amdsmi_get_energy_count(device, &count, &resolution, &timestamp) ==
+          AMDSMI_STATUS_SUCCESS) {
+        energy_meters.push_back(EnergyMeter{EnergyMeter::AMDSMI, "", amdsmi_devices.size(), 0.0});
+        energy_meter_names.push_back("gpu_" + std::to_string(id));
+        amdsmi_devices.push_back(device);
+      }
+      ++id;
+    }
+  }
+#endif
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Initialize energy measurement with all meters that can be read.
+ */
+void initEnergy()
+{
+  addRaplMeters();
+  addNvmlMeters();
+  addAmdSmiMeters();
+
+  if (energy_meters.empty()) {
+    finalizeEnergy();
+    throw std::runtime_error("initEnergy : No readable RAPL, NVML, or AMD SMI energy meters");
+  }
+}
+
+/*
+ * Release resources used for energy measurement.
+ */
+void finalizeEnergy()
+{
+#if defined(RAJA_PERFSUITE_USE_NVML)
+  if (nvml_initialized) {
+    nvmlShutdown();
+    nvml_initialized = false;
+  }
+  nvml_devices.clear();
+#endif
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+  if (amdsmi_initialized) {
+    amdsmi_shut_down();
+    amdsmi_initialized = false;
+  }
+  amdsmi_devices.clear();
+#endif
+  energy_meters.clear();
+  energy_meter_names.clear();
+}
+
+/*
+ * Return number of energy meters read.
+ */
+size_t getNumEnergyMeters()
+{
+  return energy_meters.size();
+}
+
+/*
+ * Return names of energy meters.
+ */
+const std::vector<std::string>& getEnergyMeterNames()
+{
+  return energy_meter_names;
+}
+
+/*
+ * Read the current value of each meter into joules.
+ */
+void readEnergy(std::vector<double>& joules)
+{
+  for (size_t im = 0; im < energy_meters.size(); ++im) {
+    const EnergyMeter& meter = energy_meters[im];
+    switch (meter.kind) {
+      case EnergyMeter::RAPL: {
+        unsigned long long microjoules = 0;
+        readSysfsValue(meter.path, microjoules);
+        joules.at(im) = static_cast<double>(microjoules) * 1.0e-6;
+        break;
+      }
+      case EnergyMeter::NVML: {
+#if defined(RAJA_PERFSUITE_USE_NVML)
+        unsigned long long millijoules = 0;
+        nvmlDeviceGetTotalEnergyConsumption(nvml_devices[meter.device], &millijoules);
+        joules.at(im) = static_cast<double>(millijoules) * 1.0e-3;
+#endif
+        break;
+      }
+      case EnergyMeter::AMDSMI: {
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+        uint64_t count = 0;
+        float resolution = 0.0f;
+        uint64_t timestamp = 0;
+        amdsmi_get_energy_count(amdsmi_devices[meter.device], &count, &resolution, &timestamp);
+        // count is in units of resolution microjoules
+        joules.at(im) = static_cast<double>(count) * resolution * 1.0e-6;
+#endif
+        break;
+      }
+    }
+  }
+}
+
+/*
+ * Add the energy used between the readings start and stop to values.
+ */
+void addEnergyUsed(const std::vector<double>& start,
+                   const std::vector<double>& stop,
+                   std::vector<double>& values)
+{
+  for (size_t im = 0; im < energy_meters.size(); ++im) {
+    double used = stop.at(im) - start.at(im);
+    if (used < 0.0 && energy_meters[im].range_joules > 0.0) {
+      used += energy_meters[im].range_joules;
+    }
+    values.at(im) += used;
+  }
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
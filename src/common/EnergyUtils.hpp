@@ -0,0 +1,73 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for measuring energy used around timed kernel regions.
+///
+/// Energy is read from cumulative energy meters before the timer starts and
+/// after it stops, so the meters are not sampled while a kernel runs.
+/// CPU package energy is read from the Linux powercap RAPL interface
+/// (/sys/class/powercap/intel-rapl:*), NVIDIA GPU energy with NVML when the
+/// suite is built with RAJA_PERFSUITE_USE_NVML, and AMD GPU energy with
+/// AMD SMI when the suite is built with RAJA_PERFSUITE_USE_AMDSMI.
+///
+
+#ifndef RAJAPerf_EnergyUtils_HPP
+#define RAJAPerf_EnergyUtils_HPP
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Initialize energy measurement with all meters that can be read.
+ *
+ * Throws std::runtime_error if no energy meter can be read.
+ */
+void initEnergy();
+
+/*!
+ * \brief Release resources used for energy measurement.
+ */
+void finalizeEnergy();
+
+/*!
+ * \brief Return number of energy meters read, 0 if none.
+ */
+size_t getNumEnergyMeters();
+
+/*!
+ * \brief Return names of energy meters, ie. cpu_package_0 or gpu_0.
+ */
+const std::vector<std::string>& getEnergyMeterNames();
+
+/*!
+ * \brief Read the current value of each meter into joules.
+ *
+ * joules must have getNumEnergyMeters() entries.
+ */
+void readEnergy(std::vector<double>& joules);
+
+/*!
+ * \brief Add the energy used between the readings start and stop in joules
+ * to values, accounting for meters that wrap around.
+ */
+void addEnergyUsed(const std::vector<double>& start,
+                   const std::vector<double>& stop,
+                   std::vector<double>& values);
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
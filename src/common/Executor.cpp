@@ -10,7 +10,18 @@
 #include "Executor.hpp"
 
 #include "common/KernelBase.hpp"
+#include "common/CounterUtils.hpp"
+#include "common/EnergyUtils.hpp"
+#include "common/GPUClockUtils.hpp"
+#include "common/TelemetryUtils.hpp"
+#include "common/ActivityUtils.hpp"
+#include "common/TraceUtils.hpp"
+#include "common/InterferenceUtils.hpp"
+#include "common/TopologyUtils.hpp"
+#include "common/TimerUtils.hpp"
 #include "common/OutputUtils.hpp"
+#include "common/SimdUtils.hpp"
+#include "common/StatsUtils.hpp"
 
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
 #include <mpi.h>
@@ -25,6 +36,7 @@
 #include "basic/INDEXLIST_3LOOP.hpp"
 #include "algorithm/SORT.hpp"
 #include "apps/HALOEXCHANGE_FUSED.hpp"
+#include "stream/CACHE_BW.hpp"
 
 #include <list>
 #include <vector>
@@ -37,9 +49,26 @@
 #include <sstream>
 #include <fstream>
 #include <cmath>
+#include <limits>
+#include <climits>
 #include <algorithm>
+#include <numeric>
+#include <map>
+#include <ctime>
+#include <cerrno>
+#include <cctype>
+#include <thread>
 
 #include <unistd.h>
+#include <dirent.h>
+#include <sys/wait.h>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#endif
 
 
 namespace rajaperf {
@@ -110,7 +139,414 @@ void Allreduce(const Checksum_type* send, Checksum_type* recv, int count,
 
 }
 
+/*
+ * Gather the samples of each rank to rank 0, in rank order, other ranks
+ * get an empty vector.
+ */
+template < typename T >
+vector<T> gatherSamples(const vector<T>& send, MPI_Comm comm)
+{
+  int rank = 0;
+  int num_ranks = 1;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+
+  int nbytes = static_cast<int>(send.size() * sizeof(T));
+  vector<int> counts(num_ranks, 0);
+  MPI_Gather(&nbytes, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, comm);
+
+  vector<int> displs(num_ranks, 0);
+  for (int r = 1; r < num_ranks; ++r) {
+    displs[r] = displs[r-1] + counts[r-1];
+  }
+  vector<T> recv(rank == 0 ? (displs[num_ranks-1] + counts[num_ranks-1]) / sizeof(T)
+                           : 0);
+  MPI_Gatherv(send.data(), nbytes, MPI_BYTE, recv.data(), counts.data(),
+              displs.data(), MPI_BYTE, 0, comm);
+  return recv;
+}
+
+/*
+ * Gather the string of each rank to rank 0, in rank order, other ranks
+ * get an empty vector.
+ */
+vector<string> gatherStrings(const string& send, MPI_Comm comm)
+{
+  int rank = 0;
+  int num_ranks = 1;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+
+  int len = static_cast<int>(send.size());
+  vector<int> lens(num_ranks, 0);
+  MPI_Gather(&len, 1, MPI_INT, lens.data(), 1, MPI_INT, 0, comm);
+
+  vector<int> displs(num_ranks, 0);
+  for (int r = 1; r < num_ranks; ++r) {
+    displs[r] = displs[r-1] + lens[r-1];
+  }
+  vector<char> recv(rank == 0 ? displs[num_ranks-1] + lens[num_ranks-1] : 0);
+  MPI_Gatherv(send.data(), len, MPI_CHAR, recv.data(), lens.data(),
+              displs.data(), MPI_CHAR, 0, comm);
+
+  vector<string> strs;
+  if (rank == 0) {
+    for (int r = 0; r < num_ranks; ++r) {
+      strs.emplace_back(recv.data() + displs[r], lens[r]);
+    }
+  }
+  return strs;
+}
+
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+/*
+ * Write the OpenMP binding settings and the place and cpu each OpenMP
+ * thread runs on, as seen from a parallel region like those of the
+ * OpenMP kernels.
+ */
+void writeOpenMPAffinity(ostream& str)
+{
+  const char* omp_places = getenv("OMP_PLACES");
+  const char* omp_proc_bind = getenv("OMP_PROC_BIND");
+  str << "\t OMP_PLACES = " << (omp_places ? omp_places : "unset") << endl;
+  str << "\t OMP_PROC_BIND = " << (omp_proc_bind ? omp_proc_bind : "unset") << endl;
+
+  const int num_threads = omp_get_max_threads();
+  vector<int> thread_places(num_threads, -1);
+  vector<int> thread_cpus(num_threads, -1);
+
+  #pragma omp parallel num_threads(num_threads)
+  {
+    const int thread = omp_get_thread_num();
+    thread_places[thread] = omp_get_place_num();
+#if defined(__linux__)
+    thread_cpus[thread] = sched_getcpu();
+#endif
+  }
+
+  str << "\t OpenMP threads = " << num_threads
+      << ", places = " << omp_get_num_places() << endl;
+  str << "\t OpenMP thread affinity (thread:place/cpu) =";
+  for (int thread = 0; thread < num_threads; ++thread) {
+    str << " " << thread << ":"
+        << ((thread_places[thread] < 0) ? string("unbound")
+                                        : to_string(thread_places[thread]))
+        << "/"
+        << ((thread_cpus[thread] < 0) ? string("?")
+                                      : to_string(thread_cpus[thread]));
+  }
+  str << endl;
+}
+
+#endif
+
+/*!
+ * \brief Get the value of the first field named key in a line of the run
+ *        data file, unquoting string values.
+ *
+ * Returns false if the line has no such field.
+ */
+bool getRunDataField(const string& line, const string& key, string& value)
+{
+  const string field = "\"" + key + "\":";
+  size_t pos = line.find(field);
+  while ( pos != string::npos && pos > 0 &&
+          line[pos-1] != '{' && line[pos-1] != ',' ) {
+    pos = line.find(field, pos+1);
+  }
+  if ( pos == string::npos ) {
+    return false;
+  }
+  pos += field.size();
+
+  value.clear();
+  if ( pos < line.size() && line[pos] == '"' ) {
+    for (++pos; pos < line.size() && line[pos] != '"'; ++pos) {
+      if ( line[pos] == '\\' && pos+1 < line.size() ) {
+        ++pos;
+      }
+      value += line[pos];
+    }
+  } else {
+    const size_t end = line.find_first_of(",}", pos);
+    value = line.substr(pos, end - pos);
+  }
+  return true;
+}
+
+/*!
+ * \brief A level of the memory hierarchy and its size in bytes.
+ */
+struct MemoryLevel
+{
+  string name;
+  size_t nbytes;
+};
+
+/*!
+ * \brief Get the data and unified caches of cpu 0 from sysfs, smallest first.
+ *
+ * Sizes are those of one cache, shared caches such as L3 may be shared by
+ * several cores.
+ */
+vector<MemoryLevel> getHostMemoryLevels()
+{
+  vector<MemoryLevel> levels;
+  const string cache_dir("/sys/devices/system/cpu/cpu0/cache/index");
+  for (int index = 0; ; ++index) {
+    ifstream level_file(cache_dir + to_string(index) + "/level");
+    ifstream type_file(cache_dir + to_string(index) + "/type");
+    ifstream size_file(cache_dir + to_string(index) + "/size");
+    int level = 0;
+    string type;
+    string size_str;
+    if ( !(level_file >> level) || !(type_file >> type) ||
+         !(size_file >> size_str) ) {
+      break;
+    }
+    if ( type == "Instruction" ) {
+      continue;
+    }
+    // size is given as ie. 48K or 32M
+    size_t nbytes = std::strtoull(size_str.c_str(), nullptr, 10);
+    switch ( size_str.back() ) {
+      case 'K': nbytes <<= 10; break;
+      case 'M': nbytes <<= 20; break;
+      case 'G': nbytes <<= 30; break;
+      default: break;
+    }
+    levels.push_back(MemoryLevel{"L" + to_string(level), nbytes});
+  }
+  std::sort(levels.begin(), levels.end(),
+            [](const MemoryLevel& lhs, const MemoryLevel& rhs) {
+    return lhs.nbytes < rhs.nbytes;
+  });
+  return levels;
+}
+
+/*!
+ * \brief Get the L2 cache and memory sizes of the current GPU, if any.
+ */
+vector<MemoryLevel> getDeviceMemoryLevels()
+{
+  vector<MemoryLevel> levels;
+#if defined(RAJA_ENABLE_CUDA)
+  cudaDeviceProp prop = getCudaDeviceProp();
+  levels.push_back(MemoryLevel{"L2", static_cast<size_t>(prop.l2CacheSize)});
+  levels.push_back(MemoryLevel{"HBM", prop.totalGlobalMem});
+#elif defined(RAJA_ENABLE_HIP)
+  hipDeviceProp_t prop = getHipDeviceProp();
+  levels.push_back(MemoryLevel{"L2", static_cast<size_t>(prop.l2CacheSize)});
+  levels.push_back(MemoryLevel{"HBM", prop.totalGlobalMem});
+#endif
+  return levels;
+}
+
+/*!
+ * \brief Get the physical memory of the host divided among the MPI ranks on
+ *        it, or 0 if it is not known.
+ */
+size_t getHostMemoryBytesPerRank()
+{
+  const long pages = sysconf(_SC_PHYS_PAGES);
+  const long page_size = sysconf(_SC_PAGE_SIZE);
+  if ( pages <= 0 || page_size <= 0 ) {
+    return 0;
+  }
+  int num_local_ranks = 1;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Comm local_comm;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &local_comm);
+  MPI_Comm_size(local_comm, &num_local_ranks);
+  MPI_Comm_free(&local_comm);
+#endif
+  return static_cast<size_t>(pages) * static_cast<size_t>(page_size) /
+         static_cast<size_t>(num_local_ranks);
+}
+
+/*!
+ * \brief Get the free memory of the current GPU divided among the ranks
+ *        sharing it, or 0 without one.
+ */
+size_t getDeviceFreeMemoryBytesPerRank(int ranks_per_gpu)
+{
+  return detail::getGPUFreeBytes() / static_cast<size_t>(std::max(ranks_per_gpu, 1));
+}
+
+/*!
+ * \brief Get the name of the smallest level nbytes fits in, or beyond if
+ *        it fits in none of them.
+ */
+string getFootprintLevel(size_t nbytes, const vector<MemoryLevel>& levels,
+                         const string& beyond)
+{
+  for (const MemoryLevel& level : levels) {
+    if ( nbytes <= level.nbytes ) {
+      return level.name;
+    }
+  }
+  return beyond;
+}
+
+/*!
+ * \brief Get the name of the current GPU, or an empty string without one.
+ */
+string getGPUModelName()
+{
+  string gpu;
+#if defined(RAJA_ENABLE_CUDA)
+  gpu = getCudaDeviceProp().name;
+#elif defined(RAJA_ENABLE_HIP)
+  {
+    hipDeviceProp_t prop = getHipDeviceProp();
+    gpu = string(prop.name) + " " + prop.gcnArchName;
+  }
+#endif
+  return gpu;
+}
+
+/*!
+ * \brief Get the most shared memory a block may use and the shared memory
+ *        of a multiprocessor of the current GPU, zeros without one.
+ */
+std::pair<size_t, size_t> getGPUSharedMemSizes()
+{
+  std::pair<size_t, size_t> sizes{0, 0};
+#if defined(RAJA_ENABLE_CUDA)
+  sizes = {detail::getCudaSharedMemPerBlock(),
+           detail::getCudaSharedMemPerMultiprocessor()};
+#elif defined(RAJA_ENABLE_HIP)
+  sizes = {detail::getHipSharedMemPerBlock(),
+           detail::getHipSharedMemPerMultiprocessor()};
 #endif
+  return sizes;
+}
+
+/*!
+ * \brief Get the size bucket of a problem size in the tuning database, the
+ *        largest power of two not above the size.
+ */
+Index_type getTuningDBSizeBucket(Index_type problem_size)
+{
+  Index_type bucket = 1;
+  while ( bucket <= problem_size / 2 ) {
+    bucket *= 2;
+  }
+  return bucket;
+}
+
+/*!
+ * \brief Mix bytes into a 64 bit FNV-1a hash.
+ */
+uint64_t hashBytes(uint64_t hash, const char* bytes, size_t len)
+{
+  for (size_t i = 0; i < len; ++i) {
+    hash ^= static_cast<unsigned char>(bytes[i]);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+uint64_t hashString(uint64_t hash, const string& str)
+{
+  // the terminating null separates consecutive strings
+  return hashBytes(hash, str.c_str(), str.size()+1);
+}
+
+/*!
+ * \brief Mix the contents of a file into a hash, false if it can't be read.
+ */
+bool hashFile(uint64_t& hash, const string& filename)
+{
+  ifstream file(filename, ios::binary);
+  if ( !file ) {
+    return false;
+  }
+  char buffer[65536];
+  while ( file.read(buffer, sizeof(buffer)) || file.gcount() > 0 ) {
+    hash = hashBytes(hash, buffer, static_cast<size_t>(file.gcount()));
+  }
+  return true;
+}
+
+/*!
+ * \brief Hash the object code of a kernel, ie. Basic_DAXPY.
+ *
+ * This hashes the object files of the kernel in the build directory, ie.
+ * src/basic/CMakeFiles/basic.dir/DAXPY*.o, so rebuilding other kernels
+ * does not change it. Kernels whose object files are not found, ie. with
+ * an installed executable or from a library given to '--load-kernels',
+ * hash the executable.
+ */
+uint64_t getKernelCodeHash(const string& kernel_name)
+{
+  uint64_t hash = 0xcbf29ce484222325ull;
+
+  const size_t sep = kernel_name.find('_');
+  if ( sep != string::npos ) {
+    string group = kernel_name.substr(0, sep);
+    std::transform(group.begin(), group.end(), group.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    const string base_name = kernel_name.substr(sep+1);
+    const string dirname = string(configuration::build_dir) + "/src/" + group +
+                           "/CMakeFiles/" + group + ".dir";
+
+    // files of this kernel are named <base_name>.cpp.o or <base_name>-*.o,
+    // which other kernels with base_name as a prefix are not
+    vector<string> filenames;
+    if ( DIR* dir = opendir(dirname.c_str()) ) {
+      while ( dirent* entry = readdir(dir) ) {
+        const string name(entry->d_name);
+        if ( name.size() > base_name.size() &&
+             name.compare(0, base_name.size(), base_name) == 0 &&
+             (name[base_name.size()] == '.' || name[base_name.size()] == '-') &&
+             name.compare(name.size()-2, 2, ".o") == 0 ) {
+          filenames.emplace_back(name);
+        }
+      }
+      closedir(dir);
+    }
+    std::sort(filenames.begin(), filenames.end());
+
+    bool hashed = !filenames.empty();
+    for (const string& name : filenames) {
+      hash = hashString(hash, name);
+      hashed = hashFile(hash, dirname + "/" + name) && hashed;
+    }
+    if ( hashed ) {
+      return hash;
+    }
+  }
+
+  hashFile(hash, "/proc/self/exe");
+  return hash;
+}
+
+/*!
+ * \brief Get an ID of the node hardware, its CPU model, number of hardware
+ *        threads, and GPU model, which identical nodes share.
+ */
+string getNodeHardwareID()
+{
+  string cpu;
+  ifstream cpuinfo("/proc/cpuinfo");
+  string line;
+  while ( getline(cpuinfo, line) ) {
+    if ( line.compare(0, 10, "model name") == 0 ) {
+      const size_t start = line.find_first_not_of(" \t", line.find(':')+1);
+      if ( line.find(':') != string::npos && start != string::npos ) {
+        cpu = line.substr(start);
+      }
+      break;
+    }
+  }
+  return cpu + ";" + std::to_string(std::thread::hardware_concurrency()) +
+         ";" + getGPUModelName();
+}
 
 }
 
@@ -181,6 +617,33 @@ Executor::Executor(int argc, char** argv)
     adiak::value("machine_build", cc.adiak_machine_build);
   }
 
+  // back-ends compiled into the suite, so runs can be sliced by build
+  std::vector<std::string> build_backends{"Seq"};
+#if defined(RAJA_ENABLE_OPENMP)
+  build_backends.emplace_back("OpenMP");
+#endif
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+  build_backends.emplace_back("OpenMPTarget");
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+  build_backends.emplace_back("CUDA");
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  build_backends.emplace_back("HIP");
+#endif
+#if defined(RAJA_ENABLE_SYCL)
+  build_backends.emplace_back("SYCL");
+#endif
+#if defined(RUN_KOKKOS)
+  build_backends.emplace_back("Kokkos");
+#endif
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  build_backends.emplace_back("MPI");
+#endif
+  adiak::value("build_backends", build_backends);
+  adiak::value("build_host", configuration::build_host);
+  adiak::value("NumPasses", run_params.getNumPasses());
+
   adiak::value("SizeMeaning",(adiak::catstring)run_params.SizeMeaningToStr(run_params.getSizeMeaning()));
   if (run_params.getSizeMeaning() == RunParams::SizeMeaning::Factor) {
     adiak::value("ProblemSizeRunParam",(uint)run_params.getSizeFactor());
@@ -215,8 +678,21 @@ Executor::Executor(int argc, char** argv)
 Executor::~Executor()
 {
   for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    kernels[ik]->cancelPipelinedSetUp();
     delete kernels[ik];
   }
+  if ( progress_file != nullptr ) {
+    fclose(progress_file);
+  }
+  if ( result_cache_file != nullptr ) {
+    fclose(result_cache_file);
+  }
+  detail::finalizeCounters();
+  detail::finalizeEnergy();
+  detail::finalizeTelemetry();
+  detail::finalizeGPUControl();
+  detail::finalizeActivityTracing();
+  detail::finalizeTrace();
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
   adiak::fini();
 #endif
@@ -232,6 +708,81 @@ void Executor::setupSuite()
 
   getCout() << "\nSetting up suite based on input..." << endl;
 
+  detail::setDataPoolEnabled(run_params.getUseDataPool());
+  detail::setGPUPoolReleaseThreshold(run_params.getGPUPoolReleaseThreshold());
+  detail::setUseCycleCounter(
+      run_params.getHostTimer() == RunParams::CycleHostTimer);
+  detail::setHostPagePolicy(run_params.getHostPagePolicy());
+  detail::setOmpNumaPolicy(run_params.getOmpNumaPolicy(),
+                           run_params.getOmpNumaNodes());
+  // the driver of isolated kernels must not use the GPU before forking
+  if ( !run_params.getIsolateKernels() ) {
+    bindGPUDevice(true);
+  }
+  gatherTopology();
+
+  if ( run_params.getRandomOrder() ) {
+    random_order_seed = run_params.getRandomOrderSeed();
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    // all ranks run kernels in the order rank 0 draws
+    MPI_Bcast(&random_order_seed, 1, MPI_UNSIGNED_LONG_LONG, 0, MPI_COMM_WORLD);
+#endif
+    random_order_engine.seed(random_order_seed);
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+    adiak::value("RandomOrderSeed", std::to_string(random_order_seed));
+#endif
+  }
+
+  if ( !run_params.getTuningFile().empty() ) {
+    readTuningFile(run_params.getTuningFile());
+  }
+  if ( !run_params.getTuningDBFile().empty() ) {
+    readTuningDBFile(run_params.getTuningDBFile());
+  }
+  if ( !run_params.getCompareDir().empty() ) {
+    readBaselineFile(run_params.getCompareDir());
+  }
+  for (const string& dirname : run_params.getScalingSeriesDirs()) {
+    readScalingSeriesFile(dirname);
+  }
+  if ( run_params.getResume() ) {
+    readProgressFile();
+  }
+  if ( run_params.getIncremental() ) {
+    readResultCacheFile();
+  }
+  detail::initCounters(run_params.getPapiEvents());
+  if ( run_params.getMeasureEnergy() ) {
+    detail::initEnergy();
+  }
+  if ( run_params.getGPUTelemetry() ) {
+    if ( detail::getNumGPUDevices() > 0 ) {
+      detail::initTelemetry(detail::getGPUPciBusId());
+    } else {
+      getCout() << "\n WARNING: --gpu-telemetry given without a GPU, no"
+                << " telemetry is recorded" << endl;
+    }
+  }
+  if ( !run_params.getGPUSettings().empty() ) {
+    if ( detail::getNumGPUDevices() > 0 ) {
+      detail::initGPUControl(detail::getGPUPciBusId(), run_params.getGPUSettings());
+    } else {
+      getCout() << "\n WARNING: --gpu-clocks or --gpu-power-limits given"
+                << " without a GPU, no GPU settings are swept" << endl;
+    }
+  }
+  if ( run_params.getDeviceActivity() ) {
+    if ( detail::getNumGPUDevices() > 0 ) {
+      detail::initActivityTracing();
+    } else {
+      getCout() << "\n WARNING: --device-activity given without a GPU, no"
+                << " device activity is recorded" << endl;
+    }
+  }
+  if ( run_params.getTrace() ) {
+    detail::initTrace();
+  }
+
   using Svector = vector<string>;
 
   //
@@ -239,10 +790,20 @@ void Executor::setupSuite()
   //
   // Kernel and variant input is assumed to be good at this point.
   //
+  // Kernel objects are made up front since their tuning names are needed
+  // below and they hold the results used by the reports. Constructors only
+  // compute sizes and metadata, kernel data is allocated in setUp when a
+  // kernel is executed and the setup data cache is cleared after each pass
+  // of a kernel, see runKernel.
+  //
 
-  const std::set<KernelID>& run_kern = run_params.getKernelIDsToRun();
-  for (auto kid = run_kern.begin(); kid != run_kern.end(); ++kid) {
-    kernels.push_back( getKernelObject(*kid, run_params) );
+  if ( run_params.getRunPlan().empty() ) {
+    const std::set<KernelID>& run_kern = run_params.getKernelIDsToRun();
+    for (auto kid = run_kern.begin(); kid != run_kern.end(); ++kid) {
+      kernels.push_back( getKernelObject(*kid, run_params) );
+    }
+  } else {
+    makeRunPlanKernels();
   }
 
   const std::set<VariantID>& run_var = run_params.getVariantIDsToRun();
@@ -250,6 +811,10 @@ void Executor::setupSuite()
     variant_ids.push_back( *vid );
   }
 
+  if ( run_params.getMemoryFraction() > 0.0 ) {
+    fitKernelsToMemory();
+  }
+
   //
   // Set reference variant and reference tuning index IDs. 
   //
@@ -333,6 +898,10 @@ void Executor::setupSuite()
 
   }  // iterate over variant_ids to run
 
+  if ( run_params.getRunBestTunings() ) {
+    selectBestTunings();
+  }
+
 }
 
 
@@ -384,12 +953,81 @@ void Executor::reportRunSummary(ostream& str) const
 
     str << "\nHow suite will be run:" << endl;
     str << "\t # passes = " << run_params.getNumPasses() << endl;
+    if (run_params.getRandomOrder()) {
+      str << "\t Random order seed = " << random_order_seed << endl;
+    }
     if (run_params.getSizeMeaning() == RunParams::SizeMeaning::Factor) {
       str << "\t Kernel size factor = " << run_params.getSizeFactor() << endl;
     } else if (run_params.getSizeMeaning() == RunParams::SizeMeaning::Direct) {
       str << "\t Kernel size = " << run_params.getSize() << endl;
     }
     str << "\t Kernel rep factor = " << run_params.getRepFactor() << endl;
+    if (getSimdVectorWidthBits() > 0) {
+      str << "\t SIMD vector width = " << getSimdVectorWidthBits() << " bits" << endl;
+    }
+    str << "\t Host page policy = "
+        << getHostPagePolicyName(run_params.getHostPagePolicy())
+        << " (" << detail::getHostPageSize() << " byte pages)" << endl;
+    str << "\t Host timer = "
+        << RunParams::HostTimerToStr(run_params.getHostTimer())
+        << " (resolution " << detail::getTimerResolution() * 1.0e9
+        << " ns, overhead " << detail::getTimerOverhead() * 1.0e9
+        << " ns)" << endl;
+    if (detail::getNumGPUDevices() > 0 && !run_params.getIsolateKernels()) {
+      str << "\t GPU device = " << detail::getGPUDevice() << " of "
+          << detail::getNumGPUDevices();
+      if (run_params.getMultiGPU()) {
+        str << " (multi-GPU Stream kernels use all)";
+      }
+      str << endl;
+      str << "\t GPU pageable memory access = "
+          << (detail::haveGPUPageableMemoryAccess() ? "yes" : "no");
+      if (const char* xnack = getenv("HSA_XNACK")) {
+        str << " (HSA_XNACK=" << xnack << ")";
+      }
+      str << endl;
+    }
+    str << "\t Rank 0 placement = " << rank_placement.host
+        << " cpus " << detail::formatCPUList(rank_placement.cpus)
+        << " (NUMA nodes " << detail::formatCPUList(rank_placement.cpu_nodes)
+        << "), data on NUMA node " << rank_placement.data_node
+        << " (memory policy " << rank_placement.memory_policy << ")";
+    if (rank_placement.gpu_device >= 0) {
+      str << ", GPU " << rank_placement.gpu_bus_id << " on NUMA node "
+          << rank_placement.gpu_node;
+    }
+    str << endl;
+    {
+      const vector<int> nodes = detail::getNumaNodes();
+      if (nodes.size() > 1) {
+        str << "\t NUMA distances =";
+        for (int node : nodes) {
+          str << " " << node << ":";
+          const vector<int> distances = detail::getNumaDistances(node);
+          for (size_t i = 0; i < distances.size(); ++i) {
+            str << (i > 0 ? "," : "") << distances[i];
+          }
+        }
+        str << endl;
+      }
+    }
+    str << "\t Placement warnings = " << topology_warnings.size()
+        << " (all ranks are in the topology file)" << endl;
+    if (run_params.getManagedPolicy() != ManagedPolicy::None) {
+      str << "\t Managed policy = "
+          << getManagedPolicyName(run_params.getManagedPolicy()) << endl;
+    }
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    if (isVariantAvailable(VariantID::Base_OpenMP)) {
+      str << "\t OpenMP NUMA policy = "
+          << getNumaPolicyName(run_params.getOmpNumaPolicy());
+      for (int node : run_params.getOmpNumaNodes()) {
+        str << " " << node;
+      }
+      str << endl;
+      writeOpenMPAffinity(str);
+    }
+#endif
     str << "\t Output files will be named " << ofiles << endl;
 
     str << "\nThe following kernels and variants (when available for a kernel) will be run:" << endl;
@@ -409,6 +1047,9 @@ void Executor::reportRunSummary(ostream& str) const
     if (isVariantAvailable(VariantID::Base_HIP)) {
       str << "\nHip - " << getDataSpaceName(run_params.getHipDataSpace());
     }
+    if (isVariantAvailable(VariantID::Base_SYCL)) {
+      str << "\nSycl - " << getDataSpaceName(run_params.getSyclDataSpace());
+    }
     if (isVariantAvailable(VariantID::Kokkos_Lambda)) {
       str << "\nKokkos - " << getDataSpaceName(run_params.getKokkosDataSpace());
     }
@@ -445,6 +1086,30 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
 #endif
   }
 
+  //
+  // Data footprints are measured when kernels run, so they are only
+  // written to the file after the suite has run.
+  //
+  const vector<MemoryLevel> host_levels =
+      to_file ? getHostMemoryLevels() : vector<MemoryLevel>{};
+  const vector<MemoryLevel> device_levels =
+      to_file ? getDeviceMemoryLevels() : vector<MemoryLevel>{};
+  if ( to_file ) {
+    str << "Host memory levels (bytes) :";
+    for (const MemoryLevel& level : host_levels) {
+      str << " " << level.name << " = " << level.nbytes;
+    }
+    str << endl;
+    if ( !device_levels.empty() ) {
+      str << "Device memory levels (bytes) :";
+      for (const MemoryLevel& level : device_levels) {
+        str << " " << level.name << " = " << level.nbytes;
+      }
+      str << endl;
+    }
+    writeExecutePhaseSummary(str);
+  }
+
 //
 // Set up column headers and column widths for kernel summary output.
 //
@@ -508,14 +1173,85 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
                          static_cast<Index_type>(frsize) ) + 3;
   dash_width += flopsrep_width + static_cast<Index_type>(sepchr.size());
 
+  string footprint_head("Footprint (bytes)");
+  Index_type footprint_width = static_cast<Index_type>(footprint_head.size()) + 3;
+  string hostfit_head("Host fit");
+  Index_type hostfit_width = static_cast<Index_type>(hostfit_head.size()) + 3;
+  string devicefit_head("Device fit");
+  Index_type devicefit_width = static_cast<Index_type>(devicefit_head.size()) + 3;
+  const Index_type phase_width = 14;
+
+  //
+  // Largest registers per thread and shared memory per block of the GPU
+  // functions recorded by the tunings of each kernel that were run, see
+  // the GPU function attributes report for each function.
+  //
+  string gpuregs_head("Max GPU regs");
+  Index_type gpuregs_width = static_cast<Index_type>(gpuregs_head.size()) + 3;
+  string gpushmem_head("Max GPU shmem (bytes)");
+  Index_type gpushmem_width = static_cast<Index_type>(gpushmem_head.size()) + 3;
+  vector<int> max_gpu_regs(kernels.size(), -1);
+  vector<size_t> max_gpu_shmem(kernels.size(), 0);
+  bool have_gpu_func_attributes = false;
+  if ( to_file ) {
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      for (VariantID vid : variant_ids) {
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+          for (GPUFuncAttributes const& attrs : kern->getGPUFuncAttributes(vid, tune_idx)) {
+            max_gpu_regs[ik] = max(max_gpu_regs[ik], attrs.num_regs);
+            max_gpu_shmem[ik] = max(max_gpu_shmem[ik],
+                                    attrs.static_shmem_bytes + attrs.dynamic_shmem_bytes);
+            have_gpu_func_attributes = true;
+          }
+        }
+      }
+    }
+  }
+
+  //
+  // Kernel parameters are the last column, written only if some kernel
+  // has parameters that may be set with --kernel-param.
+  //
+  string params_head("Kernel params");
+  bool have_params = false;
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    have_params = have_params || !kernels[ik]->getKernelParams().empty();
+  }
+  if ( have_params ) {
+    dash_width += static_cast<Index_type>(params_head.size() + sepchr.size());
+  }
+
   str <<left<< setw(kercol_width) << kern_head
       << sepchr <<right<< setw(psize_width) << psize_head
       << sepchr <<right<< setw(reps_width) << rsize_head
       << sepchr <<right<< setw(itsrep_width) << itsrep_head
       << sepchr <<right<< setw(kernsrep_width) << kernsrep_head
       << sepchr <<right<< setw(bytesrep_width) << bytesrep_head
-      << sepchr <<right<< setw(flopsrep_width) << flopsrep_head
-      << endl;
+      << sepchr <<right<< setw(flopsrep_width) << flopsrep_head;
+  if ( to_file ) {
+    str << sepchr <<right<< setw(footprint_width) << footprint_head
+        << sepchr <<right<< setw(hostfit_width) << hostfit_head;
+    if ( !device_levels.empty() ) {
+      str << sepchr <<right<< setw(devicefit_width) << devicefit_head;
+    }
+    if ( have_gpu_func_attributes ) {
+      str << sepchr <<right<< setw(gpuregs_width) << gpuregs_head
+          << sepchr <<right<< setw(gpushmem_width) << gpushmem_head;
+    }
+    for (int ip = 0; ip < KernelBase::NumExecutePhases; ++ip) {
+      KernelBase::ExecutePhase phase = static_cast<KernelBase::ExecutePhase>(ip);
+      str << sepchr <<right<< setw(phase_width)
+          << (KernelBase::getExecutePhaseName(phase) + " (sec)");
+    }
+  }
+  if ( have_params ) {
+    str << sepchr <<left<< params_head;
+  }
+  str << endl;
 
   if ( !to_file ) {
     for (Index_type i = 0; i < dash_width; ++i) {
@@ -532,8 +1268,37 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
         << sepchr <<right<< setw(itsrep_width) << kern->getItsPerRep()
         << sepchr <<right<< setw(kernsrep_width) << kern->getKernelsPerRep()
         << sepchr <<right<< setw(bytesrep_width) << kern->getBytesPerRep()
-        << sepchr <<right<< setw(flopsrep_width) << kern->getFLOPsPerRep()
-        << endl;
+        << sepchr <<right<< setw(flopsrep_width) << kern->getFLOPsPerRep();
+    if ( to_file ) {
+      const size_t footprint = kern->getDataFootprint();
+      str << sepchr <<right<< setw(footprint_width) << footprint
+          << sepchr <<right<< setw(hostfit_width)
+          << (footprint > 0 ? getFootprintLevel(footprint, host_levels, "DRAM")
+                            : string("-"));
+      if ( !device_levels.empty() ) {
+        str << sepchr <<right<< setw(devicefit_width)
+            << (footprint > 0 ? getFootprintLevel(footprint, device_levels, "exceeds HBM")
+                              : string("-"));
+      }
+      if ( have_gpu_func_attributes ) {
+        if ( max_gpu_regs[ik] >= 0 ) {
+          str << sepchr <<right<< setw(gpuregs_width) << max_gpu_regs[ik]
+              << sepchr <<right<< setw(gpushmem_width) << max_gpu_shmem[ik];
+        } else {
+          str << sepchr <<right<< setw(gpuregs_width) << "-"
+              << sepchr <<right<< setw(gpushmem_width) << "-";
+        }
+      }
+      for (int ip = 0; ip < KernelBase::NumExecutePhases; ++ip) {
+        KernelBase::ExecutePhase phase = static_cast<KernelBase::ExecutePhase>(ip);
+        str << sepchr <<right<< setw(phase_width) << setprecision(6)
+            << kern->getExecutePhaseTime(phase);
+      }
+    }
+    if ( have_params ) {
+      str << sepchr <<left<< kern->getKernelParamsString();
+    }
+    str << endl;
   }
 
   str.flush();
@@ -543,51 +1308,488 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
 void Executor::runSuite()
 {
   RunParams::InputOpt in_state = run_params.getInputState();
+  if ( in_state == RunParams::DryRun ) {
+    writeRunTimeEstimate(getCout());
+    return;
+  }
   if ( in_state != RunParams::PerfRun &&
        in_state != RunParams::CheckRun ) {
     return;
   }
 
-  runWarmupKernels();
+  RAJA::Timer suite_timer;
+  suite_timer.start();
 
-  getCout() << "\n\nRunning specified kernels and variants...\n";
+  // the driver must not use the device before forking isolated workers
+  if ( !run_params.getIsolateKernels() ) {
+    runWarmupKernels();
+  }
 
-  const int npasses = run_params.getNumPasses();
-  for (int ip = 0; ip < npasses; ++ip) {
-    if ( run_params.showProgress() ) {
-      getCout() << "\nPass through suite # " << ip << "\n";
-    }
+  if ( run_params.getAdaptiveWarmupTolerance() > 0.0 ) {
+    runAdaptiveWarmup();
+  }
 
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      KernelBase* kernel = kernels[ik];
-      runKernel(kernel, false);
-    } // iterate over kernels
+  if ( in_state == RunParams::PerfRun &&
+       run_params.getAutotune() ) {
+    autotuneKernels();
+  }
 
-  } // iterate over passes through suite
+  if ( in_state == RunParams::PerfRun &&
+       run_params.getTargetTime() > 0.0 ) {
+    calibrateKernelReps();
+  }
 
-}
+  openProgressFile();
+  openResultCacheFile();
 
-template < typename Kernel >
-KernelBase* Executor::makeKernel()
-{
-  Kernel* kernel = new Kernel(run_params);
-  return kernel;
-}
+  getCout() << "\n\nRunning specified kernels and variants...\n";
 
-void Executor::runKernel(KernelBase* kernel, bool print_kernel_name)
-{
-  if ( run_params.showProgress() || print_kernel_name) {
-    getCout()  << endl << "Run kernel -- " << kernel->getName() << endl;
+  if ( run_params.getSizeSweep().empty() ) {
+    runPasses();
+  } else {
+    runSizeSweep();
   }
 
-  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-    VariantID vid = variant_ids[iv];
+  if ( run_params.getIncremental() ) {
+    getCout() << "\n Reused " << num_cached_passes
+              << " passes from result cache " << getResultCacheFileName() << endl;
+  }
 
-    if ( run_params.showProgress() ) {
-      if ( kernel->hasVariantDefined(vid) ) {
-        getCout() << "\tRunning ";
-      } else {
-        getCout() << "\tNo ";
+  if ( run_params.getConcurrentKernels() > 1 ) {
+    runConcurrentKernels();
+  }
+
+  if ( in_state == RunParams::PerfRun &&
+       run_params.getAppProxyCycles() > 0 ) {
+    runAppProxy();
+  }
+
+  if ( run_params.getCoExecGPUVariant() != NumVariants ) {
+    runCoExecution();
+  }
+
+  if ( in_state == RunParams::PerfRun &&
+       !run_params.getInterferenceLoads().empty() ) {
+    runInterference();
+  }
+
+  detail::releaseDataPools();
+  detail::releaseCacheFlushBuffers();
+
+  suite_timer.stop();
+  suite_wall_time = suite_timer.elapsed();
+
+  writeExecutePhaseSummary(getCout());
+}
+
+//
+// Phase times are summed over the kernels of the suite passes, so the
+// harness time is everything else, ie. warmup, calibration, and the kernels
+// made for the extra runs after the passes. Kernels run in isolated
+// workers are not timed in this process, their time is harness time.
+//
+void Executor::writeExecutePhaseSummary(ostream& str) const
+{
+  double phase_time[KernelBase::NumExecutePhases] = {0.0, 0.0, 0.0, 0.0};
+  double kernels_time = 0.0;
+  for (KernelBase* kernel : kernels) {
+    for (int ip = 0; ip < KernelBase::NumExecutePhases; ++ip) {
+      KernelBase::ExecutePhase phase = static_cast<KernelBase::ExecutePhase>(ip);
+      phase_time[ip] += kernel->getExecutePhaseTime(phase);
+      kernels_time += kernel->getExecutePhaseTime(phase);
+    }
+  }
+  const double harness_time = std::max(0.0, suite_wall_time - kernels_time);
+
+  auto percent = [&](double time) {
+    return (suite_wall_time > 0.0) ? 100.0 * time / suite_wall_time : 0.0;
+  };
+
+  str << "\nSuite wall time (sec) : " << setprecision(6) << fixed
+      << suite_wall_time << endl;
+  for (int ip = 0; ip < KernelBase::NumExecutePhases; ++ip) {
+    KernelBase::ExecutePhase phase = static_cast<KernelBase::ExecutePhase>(ip);
+    str << "  " << left << setw(10) << KernelBase::getExecutePhaseName(phase)
+        << right << " : " << setw(14) << phase_time[ip]
+        << " (" << setprecision(1) << setw(5) << percent(phase_time[ip])
+        << "%)" << setprecision(6) << endl;
+  }
+  str << "  " << left << setw(10) << "Harness"
+      << right << " : " << setw(14) << harness_time
+      << " (" << setprecision(1) << setw(5) << percent(harness_time)
+      << "%)" << setprecision(6) << endl;
+  str.unsetf(std::ios_base::floatfield);
+  str.flush();
+}
+
+void Executor::runPasses()
+{
+  RunParams::InputOpt in_state = run_params.getInputState();
+
+  const bool pipeline = pipelineSetUp();
+
+  const int npasses = run_params.getNumPasses();
+  for (int ip = 0; ip < npasses; ++ip) {
+    if ( run_params.showProgress() ) {
+      getCout() << "\nPass through suite # " << ip << "\n";
+    }
+
+    const vector<KernelBase*> pass_kernels = getPassKernels(kernels);
+    for (size_t ik = 0; ik < pass_kernels.size(); ++ik) {
+      KernelBase* kernel = pass_kernels[ik];
+      kernel->setPassIndex(ip);
+      if ( run_params.getIsolateKernels() ) {
+        runKernelIsolated(kernel);
+      } else if ( pipeline && ik+1 < pass_kernels.size() ) {
+        pass_kernels[ik+1]->setPassIndex(ip);
+        runKernel(kernel, false, pass_kernels[ik+1]);
+      } else {
+        runKernel(kernel, false);
+      }
+    } // iterate over kernels
+
+  } // iterate over passes through suite
+
+  if ( in_state == RunParams::PerfRun &&
+       run_params.getCITarget() > 0.0 ) {
+    runPassesToCITarget();
+  }
+}
+
+//
+// With '--pipeline-setup' the first tuning of the next kernel is set up on
+// another host thread while the last tuning of the current kernel checks
+// its results and tears down. Kernels that flush caches before setUp, run
+// in other processes, or may be resumed are set up in order, as are
+// kernels of runs with more than one MPI rank, which may communicate in
+// setUp. With '--random-order' the next tuning is not known ahead of time.
+// With '--track-device-memory' each setUp is measured in its own pass.
+//
+bool Executor::pipelineSetUp() const
+{
+  if ( !run_params.getPipelineSetUp() ||
+       run_params.getIsolateKernels() ||
+       run_params.getColdCache() ||
+       run_params.getTrackDeviceMemory() ||
+       run_params.getRandomOrder() ||
+       !resumed_passes.empty() ) {
+    return false;
+  }
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  int num_ranks = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+  if ( num_ranks > 1 ) {
+    return false;
+  }
+#endif
+  return true;
+}
+
+//
+// Order of kerns in a pass. With '--random-order' it is shuffled each pass,
+// and runKernel shuffles the variant tunings of each kernel, so that clock
+// boost, thermal, and cache state left by the runs before do not favor the
+// same kernels and tunings every pass. All ranks draw from generators with
+// the same seed in the same sequence so they run the same order.
+//
+std::vector<KernelBase*> Executor::getPassKernels(
+    const std::vector<KernelBase*>& kerns)
+{
+  std::vector<KernelBase*> pass_kernels(kerns);
+  if ( run_params.getRandomOrder() ) {
+    std::shuffle(pass_kernels.begin(), pass_kernels.end(), random_order_engine);
+  }
+  return pass_kernels;
+}
+
+//
+// Variant tunings of kern that runKernel executes, in order.
+//
+std::vector<std::pair<VariantID, size_t>> Executor::getSelectedTunings(
+    const KernelBase* kern) const
+{
+  std::vector<std::pair<VariantID, size_t>> selected;
+  for (VariantID vid : variant_ids) {
+    if ( !kern->hasVariantDefined(vid) ) {
+      continue;
+    }
+    for (size_t tune_idx = 0;
+         tune_idx < kern->getNumVariantTunings(vid);
+         ++tune_idx) {
+      if ( isTuningSelected(kern, vid, kern->getVariantTuningName(vid, tune_idx)) ) {
+        selected.emplace_back(vid, tune_idx);
+      }
+    }
+  }
+  return selected;
+}
+
+void Executor::runSizeSweep()
+{
+  RunParams::InputOpt in_state = run_params.getInputState();
+
+  //
+  // Kernels are made again for each size, warmup, autotuning, GPU contexts,
+  // and data pools carry over from the previous size.
+  //
+  const vector<double>& sizes = run_params.getSizeSweep();
+  for (size_t is = 0; is < sizes.size(); ++is) {
+
+    if ( is > 0 ) {
+      run_params.setSize(sizes[is]);
+      for (KernelBase*& kernel : kernels) {
+        KernelID kid = kernel->getKernelID();
+        kernel->cancelPipelinedSetUp();
+        delete kernel;
+        kernel = getKernelObject(kid, run_params);
+      }
+      if ( run_params.getMemoryFraction() > 0.0 ) {
+        fitKernelsToMemory();
+      }
+      if ( in_state == RunParams::PerfRun &&
+           run_params.getTargetTime() > 0.0 ) {
+        calibrateKernelReps();
+      }
+    }
+
+    getCout() << "\nRunning size " << static_cast<Index_type>(sizes[is])
+              << " of size sweep\n";
+
+    runPasses();
+
+    recordSizeSweepResults();
+  }
+}
+
+void Executor::recordSizeSweepResults()
+{
+  for (KernelBase* kern : kernels) {
+    for (VariantID vid : variant_ids) {
+      for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+        if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+          continue;
+        }
+        size_sweep_results.push_back(SizeSweepResult{
+            kern->getName(), vid, kern->getVariantTuningName(vid, tune_idx),
+            kern->getActualProblemSize(), kern->getDataFootprint(),
+            kern->getMinTime(vid, tune_idx) / kern->getRunReps(),
+            static_cast<double>(kern->getBytesPerRep(vid, tune_idx)),
+            static_cast<double>(kern->getFLOPsPerRep(vid, tune_idx))});
+      }
+    }
+  }
+}
+
+void Executor::makeRunPlanKernels()
+{
+  //
+  // Each configuration of the run plan is its own kernel object, made with
+  // the size of the configuration, so a kernel may run in several
+  // configurations, in plan order, in one process.
+  //
+  const RunParams::SizeMeaning size_meaning = run_params.getSizeMeaning();
+  const double size = run_params.getSize();
+
+  for (const RunParams::RunPlanEntry& entry : run_params.getRunPlan()) {
+
+    if ( entry.size > 0.0 ) {
+      run_params.setSize(entry.size);
+    }
+    KernelBase* kernel = getKernelObject(entry.kernel_id, run_params);
+    run_params.restoreSize(size_meaning, size);
+
+    if ( entry.reps > 0 ) {
+      kernel->setCalibratedReps(static_cast<Index_type>(entry.reps));
+    }
+
+    run_plan_entries[kernel] = &entry;
+    kernels.push_back(kernel);
+  }
+}
+
+//
+// Kernel data is allocated in setUp, so the footprint of a kernel is
+// estimated before then as the most bytes any of its variant tunings to run
+// touch per rep, the bytes read plus written. GPU variant footprints are
+// bounded by the free memory of the GPU and the others by host memory.
+// Kernels over the bound are skipped or made again at a smaller size, the
+// footprint is about linear in the size so the size is scaled by the ratio
+// of the bound to the footprint until it fits.
+//
+void Executor::fitKernelsToMemory()
+{
+  const double fraction = run_params.getMemoryFraction();
+  const RunParams::MemoryFit memory_fit = run_params.getMemoryFit();
+
+  const double host_budget = fraction * getHostMemoryBytesPerRank();
+  const double device_budget = fraction *
+      getDeviceFreeMemoryBytesPerRank(run_params.getRanksPerGPU());
+
+  // ratio of the estimated footprint to the budget, and the budget
+  auto getBudgetRatio = [&](KernelBase* kernel, double& bytes, double& budget) {
+    double ratio = 0.0;
+    bytes = 0.0;
+    budget = 0.0;
+    for (VariantID vid : variant_ids) {
+      if ( !kernel->hasVariantDefined(vid) ) {
+        continue;
+      }
+      const double vid_budget = isVariantGPU(vid) ? device_budget : host_budget;
+      if ( vid_budget <= 0.0 ) {
+        continue;
+      }
+      for (size_t tune_idx = 0; tune_idx < kernel->getNumVariantTunings(vid); ++tune_idx) {
+        const double vid_bytes = kernel->getBytesPerRep(vid, tune_idx);
+        if ( vid_bytes / vid_budget > ratio ) {
+          ratio = vid_bytes / vid_budget;
+          bytes = vid_bytes;
+          budget = vid_budget;
+        }
+      }
+    }
+    return ratio;
+  };
+
+  const RunParams::SizeMeaning size_meaning = run_params.getSizeMeaning();
+  const double size = run_params.getSize();
+
+  // attempts at making the kernel at a smaller size before skipping it
+  constexpr int max_resize_attempts = 8;
+
+  vector<KernelBase*> fit_kernels;
+  for (KernelBase* kernel : kernels) {
+
+    MemoryFitResult result;
+    result.kernel_name = kernel->getName();
+    result.requested_size = kernel->getTargetProblemSize();
+    double ratio = getBudgetRatio(kernel, result.requested_bytes,
+                                  result.budget_bytes);
+    result.run_size = result.requested_size;
+    result.run_bytes = result.requested_bytes;
+    result.action = "fits";
+
+    const bool resize = (memory_fit == RunParams::MaxMemoryFit && ratio > 0.0) ||
+                        (memory_fit == RunParams::DownsizeMemoryFit && ratio > 1.0);
+
+    if ( resize ) {
+      // leave a little room for data that is not touched every rep
+      double new_size = result.requested_size * 0.95 / ratio;
+      for (int attempt = 0; attempt < max_resize_attempts; ++attempt) {
+        if ( new_size < 1.0 ) {
+          break;
+        }
+        run_params.setSize(std::floor(new_size));
+        KernelBase* new_kernel = getKernelObject(kernel->getKernelID(), run_params);
+        run_params.restoreSize(size_meaning, size);
+
+        double budget = 0.0;
+        ratio = getBudgetRatio(new_kernel, result.run_bytes, budget);
+
+        auto plan_entry = run_plan_entries.find(kernel);
+        if ( plan_entry != run_plan_entries.end() ) {
+          if ( plan_entry->second->reps > 0 ) {
+            new_kernel->setCalibratedReps(
+                static_cast<Index_type>(plan_entry->second->reps));
+          }
+          run_plan_entries[new_kernel] = plan_entry->second;
+          run_plan_entries.erase(plan_entry);
+        }
+        delete kernel;
+        kernel = new_kernel;
+        result.run_size = kernel->getTargetProblemSize();
+
+        if ( ratio <= 1.0 ) {
+          break;
+        }
+        new_size *= 0.9 / ratio;
+      }
+      result.action = (result.run_size < result.requested_size) ? "downsized" : "resized";
+    }
+
+    if ( ratio > 1.0 ) {
+      result.run_size = 0;
+      result.run_bytes = 0.0;
+      result.action = "skipped";
+      getCout() << "\n Skipping " << kernel->getName() << ", it needs about "
+                << result.requested_bytes << " bytes of the "
+                << result.budget_bytes << " bytes of memory given by"
+                << " --memory-fraction" << endl;
+      run_plan_entries.erase(kernel);
+      delete kernel;
+    } else {
+      if ( result.run_size != result.requested_size ) {
+        getCout() << "\n Running " << kernel->getName() << " at size "
+                  << result.run_size << " instead of " << result.requested_size
+                  << " to fit --memory-fraction" << endl;
+      }
+      fit_kernels.push_back(kernel);
+    }
+
+    memory_fit_results.push_back(result);
+  }
+
+  kernels = fit_kernels;
+}
+
+template < typename Kernel >
+KernelBase* Executor::makeKernel()
+{
+  Kernel* kernel = new Kernel(run_params);
+  return kernel;
+}
+
+void Executor::runKernel(KernelBase* kernel, bool print_kernel_name,
+                         KernelBase* next_kernel)
+{
+  if ( run_params.showProgress() || print_kernel_name) {
+    getCout()  << endl << "Run kernel -- " << kernel->getName() << endl;
+  }
+
+  //
+  // The first tuning of next_kernel is set up when the last tuning of this
+  // kernel has run, see pipelineSetUp.
+  //
+  std::pair<VariantID, size_t> last_tuning{NumVariants, 0};
+  std::pair<VariantID, size_t> next_tuning{NumVariants, 0};
+  if ( next_kernel != nullptr ) {
+    auto selected = getSelectedTunings(kernel);
+    auto next_selected = getSelectedTunings(next_kernel);
+    if ( !selected.empty() && !next_selected.empty() ) {
+      last_tuning = selected.back();
+      next_tuning = next_selected.front();
+    }
+  }
+
+  if ( run_params.getRandomOrder() ) {
+
+    //
+    // Variant tunings are interleaved in a random order, see getPassKernels.
+    //
+    auto selected = getSelectedTunings(kernel);
+    std::shuffle(selected.begin(), selected.end(), random_order_engine);
+    for (const auto& tuning : selected) {
+      if ( run_params.showProgress() ) {
+        getCout() << "\tRunning " << getVariantName(tuning.first) << " "
+                  << kernel->getVariantTuningName(tuning.first, tuning.second)
+                  << " tuning";
+      }
+      runKernelTuning(kernel, tuning.first, tuning.second,
+                      next_kernel, last_tuning, next_tuning);
+    }
+
+    kernel->cancelPipelinedSetUp();
+    kernel->clearSetupDataCache();
+    return;
+  }
+
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    VariantID vid = variant_ids[iv];
+
+    if ( run_params.showProgress() ) {
+      if ( kernel->hasVariantDefined(vid) ) {
+        getCout() << "\tRunning ";
+      } else {
+        getCout() << "\tNo ";
       }
       getCout() << getVariantName(vid) << " variant" << endl;
     }
@@ -598,20 +1800,15 @@ void Executor::runKernel(KernelBase* kernel, bool print_kernel_name)
       std::string const& tuning_name = 
         kernel->getVariantTuningName(vid, tune_idx);
 
-      if ( find(tuning_names[vid].begin(), 
-                tuning_names[vid].end(), tuning_name) != 
-             tuning_names[vid].end()) 
+      if ( isTuningSelected(kernel, vid, tuning_name) )
       { 
         // Check if valid tuning
         if ( run_params.showProgress() ) {
           getCout() << "\t\tRunning " << tuning_name << " tuning";
         }
 
-        kernel->execute(vid, tune_idx); // Execute kernel
-
-        if ( run_params.showProgress() ) {
-          getCout() << " -- " << kernel->getLastTime() << " sec." << endl;
-        }
+        runKernelTuning(kernel, vid, tune_idx,
+                        next_kernel, last_tuning, next_tuning);
 
       } else {
         getCout() << "\t\tSkipping " << tuning_name << " tuning" << endl;
@@ -621,250 +1818,5888 @@ void Executor::runKernel(KernelBase* kernel, bool print_kernel_name)
 
   } // iterate over variants
 
+  kernel->cancelPipelinedSetUp();
+  kernel->clearSetupDataCache();
 }
 
-void Executor::runWarmupKernels()
+void Executor::runKernelTuning(KernelBase* kernel, VariantID vid, size_t tune_idx,
+                               KernelBase* next_kernel,
+                               std::pair<VariantID, size_t> last_tuning,
+                               std::pair<VariantID, size_t> next_tuning)
 {
-  if ( run_params.getDisableWarmup() ) {
-    return;
-  } 
-
-  getCout() << "\n\nRun warmup kernels...\n";
+  std::string const& tuning_name = kernel->getVariantTuningName(vid, tune_idx);
 
-  //
-  // For kernels to be run, assemble a set of feature IDs
-  //
-  std::set<FeatureID> feature_ids;
-  for (size_t ik = 0; ik < kernels.size(); ++ik) {
-    KernelBase* kernel = kernels[ik];
+  if ( resumePass(kernel, vid, tune_idx) ) {
 
-    for (size_t fid = 0; fid < NumFeatures; ++fid) {
-      FeatureID tfid = static_cast<FeatureID>(fid);
-      if (kernel->usesFeature(tfid) ) {
-         feature_ids.insert( tfid );
-      }
+    if ( run_params.showProgress() ) {
+      getCout() << " -- resumed from progress file" << endl;
     }
-  
-  } // iterate over kernels
-
-  //
-  // Map feature IDs to set of warmup kernel IDs
-  //
-  std::set<KernelID> kernel_ids;
-  for ( auto fid = feature_ids.begin(); fid != feature_ids.end(); ++ fid ) {
 
-    switch (*fid) {
-
-      case Forall:
-      case Kernel:
-      case Launch:
-        kernel_ids.insert(Basic_DAXPY); break;
+  } else if ( cachedPass(kernel, vid, tune_idx) ) {
 
-      case Sort:
-        kernel_ids.insert(Algorithm_SORT); break;
-   
-      case Scan:
-        kernel_ids.insert(Basic_INDEXLIST_3LOOP); break;
+    if ( run_params.showProgress() ) {
+      getCout() << " -- reused from result cache" << endl;
+    }
 
-      case Workgroup:
-        kernel_ids.insert(Apps_HALOEXCHANGE_FUSED); break;
+  } else {
 
-      case Reduction:
-        kernel_ids.insert(Basic_REDUCE3_INT); break;
+    if ( last_tuning == std::make_pair(vid, tune_idx) ) {
+      const auto next = next_tuning;
+      kernel->setPostRunHook([=]() {
+        next_kernel->startPipelinedSetUp(next.first, next.second);
+      });
+    }
 
-      case Atomic:
-        kernel_ids.insert(Basic_PI_ATOMIC); break; 
+    kernel->execute(vid, tune_idx); // Execute kernel
 
-      case View:
-        break;
-  
-      default:
+    //
+    // Passes taken while the GPU was throttled are run again up to
+    // '--throttle-reruns' times, a pass kept while throttled is
+    // reported.
+    //
+    int reruns = 0;
+    while ( kernel->wasLastPassThrottled(vid, tune_idx) ) {
+      if ( reruns == run_params.getThrottleReruns() ) {
+        getCout() << "\n WARNING: " << kernel->getName() << " "
+                  << getVariantName(vid) << " " << tuning_name
+                  << " pass was timed while the GPU was throttled" << endl;
         break;
+      }
+      kernel->discardLastPass(vid, tune_idx);
+      // the rerun must not be timed while next_kernel is set up
+      if ( next_kernel != nullptr ) {
+        next_kernel->waitPipelinedSetUp();
+      }
+      kernel->execute(vid, tune_idx);
+      ++reruns;
+    }
 
+    if ( run_params.showProgress() ) {
+      getCout() << " -- " << kernel->getLastTime() << " sec." << endl;
     }
 
+    writeProgressRecord(kernel, vid, tune_idx,
+                        kernel->getPassChecksums(vid, tune_idx).back());
+    writeResultCacheRecord(kernel, vid, tune_idx,
+                           kernel->getPassChecksums(vid, tune_idx).back());
+  }
+}
+
+bool Executor::needsMorePasses(const KernelBase* kern) const
+{
+  for (VariantID vid : variant_ids) {
+    for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+      if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+        continue;
+      }
+      ConfidenceInterval ci =
+          computeConfidenceInterval(kern->getPassTimes(vid, tune_idx));
+      if ( ci.num < 2 || ci.relHalfWidth() > run_params.getCITarget() ) {
+        return true;
+      }
+    }
   }
+  return false;
+}
 
+void Executor::runPassesToCITarget()
+{
   //
-  // Run warmup kernels
+  // Run more passes of the kernels with a variant tuning whose confidence
+  // interval is wider than the target until all meet it or the max number
+  // of passes is reached.
   //
-  for ( auto kid = kernel_ids.begin(); kid != kernel_ids.end(); ++ kid ) {
-    KernelBase* kernel = getKernelObject(*kid, run_params);
-#if defined(RAJA_PERFSUITE_USE_CALIPER)
-    kernel->caliperOff();
-#endif
-    runKernel(kernel, true);
-#if defined(RAJA_PERFSUITE_USE_CALIPER)
-    kernel->caliperOn();
+  int ip = run_params.getNumPasses();
+  vector<KernelBase*> wide_kernels;
+  for ( ; ip < run_params.getMaxNumPasses(); ++ip) {
+
+    wide_kernels.clear();
+    for (KernelBase* kernel : kernels) {
+      if ( needsMorePasses(kernel) ) {
+        wide_kernels.push_back(kernel);
+      }
+    }
+    int num_wide = static_cast<int>(wide_kernels.size());
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    // run the same kernels on all ranks
+    int max_wide = 0;
+    MPI_Allreduce(&num_wide, &max_wide, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    if ( max_wide > 0 ) {
+      wide_kernels = kernels;
+    }
+    num_wide = max_wide;
 #endif
-    delete kernel;
+    if ( num_wide == 0 ) {
+      break;
+    }
+
+    if ( run_params.showProgress() ) {
+      getCout() << "\nPass through suite # " << ip << " for "
+                << wide_kernels.size() << " kernels above CI target\n";
+    }
+    for (KernelBase* kernel : getPassKernels(wide_kernels)) {
+      kernel->setPassIndex(ip);
+      runKernel(kernel, false);
+    }
   }
 
+  size_t num_wide = 0;
+  for (KernelBase* kernel : kernels) {
+    if ( needsMorePasses(kernel) ) {
+      ++num_wide;
+    }
+  }
+  getCout() << "\nRan up to " << ip << " passes for CI target "
+            << run_params.getCITarget() << ", " << num_wide
+            << " kernels did not reach it" << endl;
 }
 
-void Executor::outputRunData()
+bool Executor::isTuningSelected(const KernelBase* kern, VariantID vid,
+                                const string& tuning_name) const
 {
-  RunParams::InputOpt in_state = run_params.getInputState();
-  if ( in_state != RunParams::PerfRun &&
-       in_state != RunParams::CheckRun ) {
+  if ( find(tuning_names[vid].begin(),
+            tuning_names[vid].end(), tuning_name) ==
+         tuning_names[vid].end() ) {
+    return false;
+  }
+
+  auto plan_entry = run_plan_entries.find(kern);
+  if ( plan_entry != run_plan_entries.end() &&
+       !plan_entry->second->tunings.empty() &&
+       find(plan_entry->second->tunings.begin(),
+            plan_entry->second->tunings.end(), tuning_name) ==
+         plan_entry->second->tunings.end() ) {
+    return false;
+  }
+
+  auto kern_tunings = kernel_tuning_names.find({kern->getName(), vid});
+  if ( kern_tunings == kernel_tuning_names.end() ) {
+    return true;
+  }
+
+  return find(kern_tunings->second.begin(),
+              kern_tunings->second.end(), tuning_name) !=
+           kern_tunings->second.end();
+}
+
+void Executor::readBaselineFile(const string& dirname)
+{
+  const string filename = dirname + "/" + run_params.getOutputFilePrefix() +
+                          "-run-data.jsonl";
+  ifstream file(filename.c_str());
+  if ( !file ) {
+    getCout() << " ERROR: Can't open run data file " << filename
+              << " of run to compare to" << endl;
     return;
   }
 
-  getCout() << "\n\nGenerate run report files...\n";
+  //
+  // Each line is one pass of a kernel variant tuning, keep the min and max
+  // pass times.
+  //
+  string line;
+  while ( getline(file, line) ) {
+    string kernel_name, variant_name, tuning_name, time_str;
+    if ( line.empty() ) {
+      continue;
+    }
+    if ( !getRunDataField(line, "kernel", kernel_name) ||
+         !getRunDataField(line, "variant", variant_name) ||
+         !getRunDataField(line, "tuning", tuning_name) ||
+         !getRunDataField(line, "time", time_str) ) {
+      getCout() << " ERROR: Bad line in run data file " << filename
+                << ": " << line << endl;
+      continue;
+    }
+    const double time = ::atof(time_str.c_str());
+
+    auto key = std::make_tuple(kernel_name, variant_name, tuning_name);
+    auto iter = baseline_times.find(key);
+    if ( iter == baseline_times.end() ) {
+      baseline_times.emplace(key, std::make_pair(time, time));
+    } else {
+      iter->second.first = min(iter->second.first, time);
+      iter->second.second = max(iter->second.second, time);
+    }
+  }
+}
+
+void Executor::readScalingSeriesFile(const string& dirname)
+{
+  const string filename = dirname + "/" + run_params.getOutputFilePrefix() +
+                          "-run-data.jsonl";
+  ifstream file(filename.c_str());
+  if ( !file ) {
+    getCout() << " ERROR: Can't open run data file " << filename
+              << " of scaling series run" << endl;
+    return;
+  }
 
   //
-  // Generate output file prefix (including directory path).
+  // Each line is one pass of a kernel variant tuning, keep the min time
+  // per rep over passes.
   //
-  string out_fprefix;
-  string outdir = recursiveMkdir(run_params.getOutputDirName());
-  if ( !outdir.empty() ) {
-    chdir(outdir.c_str());
+  map<std::tuple<string, string, string>, ScalingPoint> points;
+  string line;
+  while ( getline(file, line) ) {
+    string kernel_name, variant_name, tuning_name, time_str, reps_str,
+           size_str, ranks_str;
+    if ( line.empty() ) {
+      continue;
+    }
+    if ( !getRunDataField(line, "kernel", kernel_name) ||
+         !getRunDataField(line, "variant", variant_name) ||
+         !getRunDataField(line, "tuning", tuning_name) ||
+         !getRunDataField(line, "time", time_str) ||
+         !getRunDataField(line, "reps", reps_str) ||
+         !getRunDataField(line, "problem_size", size_str) ||
+         !getRunDataField(line, "mpi_ranks", ranks_str) ) {
+      getCout() << " ERROR: Bad line in run data file " << filename
+                << ": " << line << endl;
+      continue;
+    }
+    const double reps = ::atof(reps_str.c_str());
+    const double time_per_rep = reps > 0.0 ? ::atof(time_str.c_str()) / reps : 0.0;
+
+    auto key = std::make_tuple(kernel_name, variant_name, tuning_name);
+    auto iter = points.find(key);
+    if ( iter == points.end() ) {
+      points.emplace(key, ScalingPoint{::atoi(ranks_str.c_str()),
+                                       ::atol(size_str.c_str()),
+                                       time_per_rep});
+    } else {
+      iter->second.time_per_rep = min(iter->second.time_per_rep, time_per_rep);
+    }
   }
-  out_fprefix = "./" + run_params.getOutputFilePrefix();
 
-  unique_ptr<ostream> file;
+  for (const auto& point : points) {
+    scaling_series[point.first].push_back(point.second);
+  }
+}
+
+//
+// Make the GPU given with '--gpu-device' the current device or, without it,
+// bind each MPI rank to a GPU by its rank among the ranks on its node.
+//
+void Executor::bindGPUDevice(bool verbose)
+{
+  const int num_devices = detail::getNumGPUDevices();
+  if ( num_devices == 0 ) {
+    return;
+  }
+
+  int device = run_params.getGPUDevice();
+  if ( device < 0 ) {
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    MPI_Comm local_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+                        MPI_INFO_NULL, &local_comm);
+    int local_rank = 0;
+    MPI_Comm_rank(local_comm, &local_rank);
+    int num_local_ranks = 1;
+    MPI_Comm_size(local_comm, &num_local_ranks);
+    MPI_Comm_free(&local_comm);
+    const int ranks_per_gpu = run_params.getRanksPerGPU();
+    if ( ranks_per_gpu > 0 ) {
+      // consecutive local ranks share a device
+      const int num_used_devices =
+          (num_local_ranks + ranks_per_gpu - 1) / ranks_per_gpu;
+      if ( verbose && num_used_devices > num_devices ) {
+        getCout() << "\n WARNING: --ranks-per-gpu " << ranks_per_gpu << " with "
+                  << num_local_ranks << " ranks on a node needs "
+                  << num_used_devices << " GPUs but " << num_devices
+                  << " are visible, some GPUs are shared by more ranks" << endl;
+      }
+      device = (local_rank / ranks_per_gpu) % num_devices;
+    } else {
+      device = local_rank % num_devices;
+    }
+#else
+    device = detail::getGPUDevice();
+#endif
+  } else if ( device >= num_devices ) {
+    if ( verbose ) {
+      getCout() << "\n WARNING: --gpu-device " << device << " is not one of the "
+                << num_devices << " visible GPUs, using device "
+                << device % num_devices << endl;
+    }
+    device = device % num_devices;
+  }
+
+  detail::setGPUDevice(device);
+}
+
+/*
+ * Find the placement of this rank and warn of misplaced ranks, ranks whose
+ * data or GPU is away from their cpus or that share cpus with other ranks
+ * on their node.
+ */
+void Executor::gatherTopology()
+{
+  int gpu_device = -1;
+  string gpu_bus_id;
+  // the driver of isolated kernels must not use the GPU before forking
+  if ( !run_params.getIsolateKernels() && detail::getNumGPUDevices() > 0 ) {
+    gpu_device = detail::getGPUDevice();
+    gpu_bus_id = detail::getGPUPciBusId();
+  }
+  rank_placement = detail::getRankPlacement(gpu_device, gpu_bus_id);
+
+  vector<string> warnings = detail::getPlacementWarnings(rank_placement);
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( run_params.getOmpNumaPolicy() == NumaPolicy::Membind &&
+       !rank_placement.cpu_nodes.empty() ) {
+    for (int node : run_params.getOmpNumaNodes()) {
+      if ( find(rank_placement.cpu_nodes.begin(), rank_placement.cpu_nodes.end(),
+                node) == rank_placement.cpu_nodes.end() ) {
+        warnings.push_back("--omp-numa-policy Membind puts OpenMP data on"
+            " NUMA node " + to_string(node) + " but the cpus are on NUMA nodes " +
+            detail::formatCPUList(rank_placement.cpu_nodes) +
+            ", give nodes of the cpus");
+        break;
+      }
+    }
+  }
+#endif
+
+  int rank = 0;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  //
+  // Count the other ranks on this node that may run on the cpus of this
+  // rank, as when ranks are not bound or are bound to the same cores.
+  //
+  {
+    constexpr int max_cpus = 1024;
+    vector<unsigned char> mask(max_cpus / CHAR_BIT, 0);
+    for (int cpu : rank_placement.cpus) {
+      if ( cpu < max_cpus ) {
+        mask[cpu / CHAR_BIT] |= static_cast<unsigned char>(1u << (cpu % CHAR_BIT));
+      }
+    }
+
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+                        MPI_INFO_NULL, &node_comm);
+    int local_rank = 0;
+    int num_local_ranks = 1;
+    MPI_Comm_rank(node_comm, &local_rank);
+    MPI_Comm_size(node_comm, &num_local_ranks);
+    vector<unsigned char> masks(mask.size() * num_local_ranks, 0);
+    MPI_Allgather(mask.data(), static_cast<int>(mask.size()), MPI_BYTE,
+                  masks.data(), static_cast<int>(mask.size()), MPI_BYTE,
+                  node_comm);
+    MPI_Comm_free(&node_comm);
+
+    int num_sharing = 0;
+    for (int r = 0; r < num_local_ranks; ++r) {
+      if ( r == local_rank ) {
+        continue;
+      }
+      for (size_t b = 0; b < mask.size(); ++b) {
+        if ( mask[b] & masks[r*mask.size() + b] ) {
+          ++num_sharing;
+          break;
+        }
+      }
+    }
+    if ( num_sharing > 0 ) {
+      warnings.push_back("cpus " + detail::formatCPUList(rank_placement.cpus) +
+          " are shared with " + to_string(num_sharing) + " other ranks on the"
+          " node, bind each rank to its own cpus, ie. srun --cpu-bind=cores"
+          " or mpirun --bind-to core");
+    }
+  }
+#endif
+
+  ostringstream row;
+  row << rank
+      << " , " << rank_placement.host
+      << " , " << detail::formatCPUList(rank_placement.cpus, ";")
+      << " , " << detail::formatCPUList(rank_placement.cpu_nodes, ";")
+      << " , " << rank_placement.data_node
+      << " , " << rank_placement.memory_policy
+      << " , " << rank_placement.gpu_device
+      << " , " << (rank_placement.gpu_bus_id.empty() ? string("none")
+                                                     : rank_placement.gpu_bus_id)
+      << " , " << rank_placement.gpu_node
+      << " , " << (rank_placement.gpu_local_cpus.empty()
+                   ? string("none")
+                   : detail::formatCPUList(rank_placement.gpu_local_cpus, ";"))
+      << " , ";
+  string nics;
+  for (const auto& nic : rank_placement.nics) {
+    nics += (nics.empty() ? "" : ";") + nic.first + ":" + to_string(nic.second);
+  }
+  row << (nics.empty() ? string("none") : nics);
+
+  string rank_warnings;
+  for (const string& warning : warnings) {
+    rank_warnings += "rank " + to_string(rank) + ": " + warning + "\n";
+  }
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  topology_rows = gatherStrings(row.str(), MPI_COMM_WORLD);
+  vector<string> gathered = gatherStrings(rank_warnings, MPI_COMM_WORLD);
+  rank_warnings.clear();
+  for (const string& str : gathered) {
+    rank_warnings += str;
+  }
+#else
+  topology_rows.assign(1, row.str());
+#endif
+
+  topology_warnings.clear();
+  istringstream warning_lines(rank_warnings);
+  for (string line; getline(warning_lines, line); ) {
+    topology_warnings.push_back(line);
+  }
+
+  // the topology file has all warnings
+  constexpr size_t max_printed_warnings = 8;
+  for (size_t i = 0; i < topology_warnings.size() && i < max_printed_warnings; ++i) {
+    getCout() << "\n WARNING: " << topology_warnings[i] << endl;
+  }
+  if ( topology_warnings.size() > max_printed_warnings ) {
+    getCout() << "\n WARNING: "
+              << topology_warnings.size() - max_printed_warnings
+              << " more placement warnings are in the topology file" << endl;
+  }
+}
+
+string Executor::getProgressFileName() const
+{
+  string dirname = run_params.getOutputDirName();
+  if ( !dirname.empty() ) {
+    dirname += "/";
+  }
+  return dirname + run_params.getOutputFilePrefix() + "-progress.jsonl";
+}
+
+//
+// Rank 0 reads the file and sends it to the other ranks so all ranks
+// skip the same passes, false if rank 0 can't read it.
+//
+bool Executor::readFileOnRank0(const string& filename, string& contents) const
+{
+  int found = 0;
+  int rank = 0;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  if ( rank == 0 ) {
+    ifstream file(filename);
+    if ( file ) {
+      stringstream buffer;
+      buffer << file.rdbuf();
+      contents = buffer.str();
+      found = 1;
+    }
+  }
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Bcast(&found, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  unsigned long long size = contents.size();
+  MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG_LONG, 0, MPI_COMM_WORLD);
+  contents.resize(size);
+  MPI_Bcast(&contents[0], static_cast<int>(size), MPI_CHAR, 0, MPI_COMM_WORLD);
+#endif
+  return found != 0;
+}
+
+void Executor::readProgressFile()
+{
+  string contents;
+  if ( !readFileOnRank0(getProgressFileName(), contents) ) {
+    getCout() << "\n No progress file " << getProgressFileName()
+              << " to resume from, running all passes" << endl;
+  }
+
+  readProgressRecords(contents, resumed_passes);
+
+  getCout() << "\n Resuming " << resumed_passes.size()
+            << " completed passes from " << getProgressFileName() << endl;
+}
+
+void Executor::readProgressRecords(const string& contents,
+                                   ResumedPassMap& passes)
+{
+  istringstream lines(contents);
+  string line;
+  while ( getline(lines, line) ) {
+    string kernel_name, variant_name, tuning_name;
+    string pass_str, time_str, device_time_str, reps_str, checksum_str, block_size_str;
+    string problem_size_str;
+    if ( !getRunDataField(line, "kernel", kernel_name) ||
+         !getRunDataField(line, "problem_size", problem_size_str) ||
+         !getRunDataField(line, "variant", variant_name) ||
+         !getRunDataField(line, "tuning", tuning_name) ||
+         !getRunDataField(line, "pass", pass_str) ||
+         !getRunDataField(line, "time", time_str) ||
+         !getRunDataField(line, "device_time", device_time_str) ||
+         !getRunDataField(line, "reps", reps_str) ||
+         !getRunDataField(line, "checksum", checksum_str) ||
+         !getRunDataField(line, "block_size", block_size_str) ) {
+      continue; // a line cut off when the run was interrupted
+    }
+    ResumedPass resumed;
+    resumed.reps = stoll(reps_str);
+    resumed.time = stod(time_str);
+    resumed.device_time = (device_time_str == "null") ? nan("") : stod(device_time_str);
+    resumed.checksum = stold(checksum_str);
+    resumed.block_size = (block_size_str == "null") ? nan("") : stod(block_size_str);
+    // only records of the result cache have a key
+    getRunDataField(line, "cache_key", resumed.cache_key);
+    passes[std::make_tuple(kernel_name, variant_name, tuning_name,
+                           static_cast<Index_type>(stoll(problem_size_str)),
+                           stoi(pass_str))] = resumed;
+  }
+}
+
+void Executor::openProgressFile()
+{
+  // all ranks make the directory, it is collective with MPI
+  recursiveMkdir(run_params.getOutputDirName());
+
+  int rank = 0;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  if ( rank != 0 ) {
+    return;
+  }
+
+  // keep the records of the interrupted run when resuming
+  progress_file = fopen(getProgressFileName().c_str(),
+                        run_params.getResume() ? "a" : "w");
+  if ( progress_file == nullptr ) {
+    getCout() << " ERROR: Can't open output file " << getProgressFileName() << endl;
+  }
+  progress_metadata = getRunDataMetadata();
+}
+
+bool Executor::resumePass(KernelBase* kern, VariantID vid, size_t tune_idx)
+{
+  if ( resumed_passes.empty() || kern->getPassIndex() < 0 ) {
+    return false;
+  }
+  auto resumed = resumed_passes.find(std::make_tuple(
+      kern->getName(), getVariantName(vid),
+      kern->getVariantTuningName(vid, tune_idx), kern->getActualProblemSize(),
+      kern->getPassIndex()));
+  // passes run with other reps, ie. calibrated with '--target-time', are rerun
+  if ( resumed == resumed_passes.end() ||
+       resumed->second.reps != kern->getRunReps() ) {
+    return false;
+  }
+  kern->addResumedPass(vid, tune_idx, resumed->second.time,
+                       resumed->second.device_time, resumed->second.checksum,
+                       resumed->second.block_size);
+  return true;
+}
+
+void Executor::writeProgressRecord(KernelBase* kern, VariantID vid,
+                                   size_t tune_idx, Checksum_type pass_checksum)
+{
+  if ( progress_file == nullptr || kern->getPassIndex() < 0 ||
+       !kern->wasVariantTuningRun(vid, tune_idx) ) {
+    return;
+  }
+
+  ostringstream record;
+  record << setprecision(17);
+  writeRunDataRecord(record, kern, vid, tune_idx,
+                     kern->getPassTimes(vid, tune_idx).size()-1,
+                     kern->getPassIndex(), pass_checksum, progress_metadata);
+
+  // flush and sync each record so it survives the job being killed
+  fputs(record.str().c_str(), progress_file);
+  fflush(progress_file);
+  fsync(fileno(progress_file));
+}
+
+string Executor::getResultCacheFileName() const
+{
+  if ( !run_params.getResultCacheFile().empty() ) {
+    return run_params.getResultCacheFile();
+  }
+  string dirname = run_params.getOutputDirName();
+  if ( !dirname.empty() ) {
+    dirname += "/";
+  }
+  return dirname + run_params.getOutputFilePrefix() + "-cache.jsonl";
+}
+
+//
+// The key of a pass in the result cache hashes everything that may change
+// its result but the kernel, variant, tuning, problem size, and pass index,
+// which the cache is indexed by, and the reps, which are checked like
+// those of resumed passes. Changes to the harness, ie. src/common, do not
+// change the key, use a new cache file after those.
+//
+string Executor::getResultCacheKey(KernelBase* kern, VariantID vid,
+                                   size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  auto code_hash = kernel_code_hashes.find(kern->getName());
+  if ( code_hash == kernel_code_hashes.end() ) {
+    code_hash = kernel_code_hashes.emplace(
+        kern->getName(), getKernelCodeHash(kern->getName())).first;
+  }
+
+  static const string node_hardware_id = getNodeHardwareID();
+
+  int num_ranks = 1;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+
+  uint64_t hash = code_hash->second;
+  hash = hashString(hash, configuration::build_raja_version);
+  hash = hashString(hash, configuration::build_type);
+  hash = hashString(hash, configuration::build_compiler);
+  hash = hashString(hash, configuration::build_compiler_version);
+  hash = hashString(hash, configuration::build_compiler_options);
+  hash = hashString(hash, configuration::build_gpu_targets);
+  hash = hashString(hash, run_params.getResultCacheOptions());
+  hash = hashString(hash, std::to_string(num_ranks));
+  hash = hashString(hash, getDataSpaceName(kern->getDataSpace(vid)));
+  hash = hashString(hash, node_hardware_id);
+
+  ostringstream key;
+  key << hex << setw(16) << setfill('0') << hash;
+  return key.str();
+}
+
+void Executor::readResultCacheFile()
+{
+  string contents;
+  if ( !readFileOnRank0(getResultCacheFileName(), contents) ) {
+    getCout() << "\n No result cache " << getResultCacheFileName()
+              << ", running all passes" << endl;
+    return;
+  }
+
+  // later records of a pass replace earlier ones
+  readProgressRecords(contents, cached_passes);
+
+  getCout() << "\n Read " << cached_passes.size()
+            << " cached passes from " << getResultCacheFileName() << endl;
+}
+
+void Executor::openResultCacheFile()
+{
+  if ( !run_params.getIncremental() ) {
+    return;
+  }
+
+  int rank = 0;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  if ( rank != 0 ) {
+    return;
+  }
+
+  result_cache_file = fopen(getResultCacheFileName().c_str(), "a");
+  if ( result_cache_file == nullptr ) {
+    getCout() << " ERROR: Can't open output file " << getResultCacheFileName() << endl;
+  }
+}
+
+bool Executor::cachedPass(KernelBase* kern, VariantID vid, size_t tune_idx)
+{
+  if ( cached_passes.empty() || kern->getPassIndex() < 0 ) {
+    return false;
+  }
+  auto cached = cached_passes.find(std::make_tuple(
+      kern->getName(), getVariantName(vid),
+      kern->getVariantTuningName(vid, tune_idx), kern->getActualProblemSize(),
+      kern->getPassIndex()));
+  if ( cached == cached_passes.end() ||
+       cached->second.reps != kern->getRunReps() ||
+       cached->second.cache_key != getResultCacheKey(kern, vid, tune_idx) ) {
+    return false;
+  }
+  kern->addResumedPass(vid, tune_idx, cached->second.time,
+                       cached->second.device_time, cached->second.checksum,
+                       cached->second.block_size);
+  ++num_cached_passes;
+  return true;
+}
+
+void Executor::writeResultCacheRecord(KernelBase* kern, VariantID vid,
+                                      size_t tune_idx, Checksum_type pass_checksum)
+{
+  if ( result_cache_file == nullptr || kern->getPassIndex() < 0 ||
+       !kern->wasVariantTuningRun(vid, tune_idx) ) {
+    return;
+  }
+
+  ostringstream record;
+  record << setprecision(17);
+  writeRunDataRecord(record, kern, vid, tune_idx,
+                     kern->getPassTimes(vid, tune_idx).size()-1,
+                     kern->getPassIndex(), pass_checksum, progress_metadata);
+
+  // the key goes first in the record object
+  const string line = "{\"cache_key\":" +
+                      jsonString(getResultCacheKey(kern, vid, tune_idx)) + "," +
+                      record.str().substr(1);
+
+  fputs(line.c_str(), result_cache_file);
+  fflush(result_cache_file);
+}
+
+//
+// Run one pass of a kernel in a forked worker so it does not share caches,
+// allocator state, or a device context with the other kernels. The worker
+// writes a progress record for each pass it runs to a pipe, the driver
+// adds those passes to its kernel object as if they were resumed. The
+// driver does not use the device, so each worker makes its own context.
+//
+void Executor::runKernelIsolated(KernelBase* kern)
+{
+  int fds[2];
+  if ( pipe(fds) != 0 ) {
+    getCout() << "\n ERROR: Can't make pipe for isolated worker, running "
+              << kern->getName() << " in this process" << endl;
+    runKernel(kern, false);
+    return;
+  }
+
+  getCout().flush();
+  fflush(nullptr);
+
+  pid_t pid = fork();
+  if ( pid < 0 ) {
+    close(fds[0]);
+    close(fds[1]);
+    getCout() << "\n ERROR: Can't fork isolated worker, running "
+              << kern->getName() << " in this process" << endl;
+    runKernel(kern, false);
+    return;
+  }
+
+  if ( pid == 0 ) {
+    // worker, send progress records to the driver instead of the file
+    close(fds[0]);
+    if ( progress_file != nullptr ) {
+      fclose(progress_file);
+    }
+    progress_file = fdopen(fds[1], "w");
+    if ( progress_file == nullptr ) {
+      _exit(1);
+    }
+    // the driver adds the passes run to the result cache
+    if ( result_cache_file != nullptr ) {
+      fclose(result_cache_file);
+      result_cache_file = nullptr;
+    }
+    bindGPUDevice(false);
+    runKernel(kern, false);
+    getCout().flush();
+    fflush(nullptr);
+    _exit(0);
+  }
+
+  close(fds[1]);
+  string contents;
+  char buffer[4096];
+  ssize_t nread;
+  while ( (nread = read(fds[0], buffer, sizeof(buffer))) != 0 ) {
+    if ( nread < 0 ) {
+      if ( errno == EINTR ) {
+        continue;
+      }
+      break;
+    }
+    contents.append(buffer, static_cast<size_t>(nread));
+  }
+  close(fds[0]);
+
+  int status = 0;
+  while ( waitpid(pid, &status, 0) < 0 && errno == EINTR ) { }
+  if ( !WIFEXITED(status) || WEXITSTATUS(status) != 0 ) {
+    getCout() << "\n ERROR: Isolated worker for " << kern->getName()
+              << " did not exit cleanly, passes it did not report are missing"
+              << endl;
+  }
+
+  ResumedPassMap worker_passes;
+  readProgressRecords(contents, worker_passes);
+
+  for (VariantID vid : variant_ids) {
+    for (size_t tune_idx = 0;
+         tune_idx < kern->getNumVariantTunings(vid);
+         ++tune_idx) {
+      std::string const& tuning_name = kern->getVariantTuningName(vid, tune_idx);
+      if ( !isTuningSelected(kern, vid, tuning_name) ) {
+        continue;
+      }
+      auto pass = worker_passes.find(std::make_tuple(
+          kern->getName(), getVariantName(vid), tuning_name,
+          kern->getActualProblemSize(), kern->getPassIndex()));
+      if ( pass != worker_passes.end() ) {
+        kern->addResumedPass(vid, tune_idx, pass->second.time,
+                             pass->second.device_time, pass->second.checksum,
+                             pass->second.block_size);
+        writeProgressRecord(kern, vid, tune_idx, pass->second.checksum);
+        writeResultCacheRecord(kern, vid, tune_idx, pass->second.checksum);
+      } else if ( !resumePass(kern, vid, tune_idx) ) {
+        // passes the worker reused from the result cache, or resumed from
+        // the progress file above
+        cachedPass(kern, vid, tune_idx);
+      }
+    }
+  }
+}
+
+void Executor::compareToBaseline()
+{
+  //
+  // Compare min times, the noise of each run is the spread of its pass
+  // times relative to its min time. A ratio beyond tolerance plus the
+  // larger noise of the two runs is a regression.
+  //
+  const double tol = run_params.getCompareTolerance();
+
+  regression_results.clear();
+
+  for (KernelBase* kern : kernels) {
+    for (VariantID vid : variant_ids) {
+      for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+        if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+          continue;
+        }
+
+        RegressionResult result;
+        result.kernel_name = kern->getName();
+        result.vid = vid;
+        result.tuning_name = kern->getVariantTuningName(vid, tune_idx);
+        result.time = kern->getMinTime(vid, tune_idx);
+        result.base_time = 0.0;
+        result.threshold = 0.0;
+
+        auto iter = baseline_times.find(
+            std::make_tuple(result.kernel_name, getVariantName(vid),
+                            result.tuning_name));
+        result.in_baseline = ( iter != baseline_times.end() &&
+                               iter->second.first > 0.0 );
+        if ( result.in_baseline ) {
+          const double base_min = iter->second.first;
+          const double base_max = iter->second.second;
+          const double base_noise = (base_max - base_min) / base_min;
+          const double noise = (result.time > 0.0)
+              ? (kern->getMaxTime(vid, tune_idx) - result.time) / result.time
+              : 0.0;
+          result.base_time = base_min;
+          result.threshold = 1.0 + tol + max(base_noise, noise);
+        }
+
+        regression_results.push_back(result);
+      }
+    }
+  }
+
+  size_t num_regressed = 0;
+  for (RegressionResult const& result : regression_results) {
+    if ( result.in_baseline &&
+         result.time > result.threshold * result.base_time ) {
+      ++num_regressed;
+    }
+  }
+  getCout() << "\n" << num_regressed << " of " << regression_results.size()
+            << " kernel variant tunings regressed vs. "
+            << run_params.getCompareDir() << endl;
+}
+
+int Executor::getExitStatus() const
+{
+  int regressed = 0;
+  for (RegressionResult const& result : regression_results) {
+    if ( result.in_baseline &&
+         result.time > result.threshold * result.base_time ) {
+      regressed = 1;
+    }
+  }
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  int any_regressed = 0;
+  MPI_Allreduce(&regressed, &any_regressed, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  regressed = any_regressed;
+#endif
+  return regressed;
+}
+
+void Executor::readTuningFile(const string& filename)
+{
+  ifstream file(filename.c_str());
+  if ( !file ) {
+    getCout() << " ERROR: Can't open tuning file " << filename << endl;
+    return;
+  }
+
+  //
+  // Each line names a kernel, a variant, and a tuning to run for that
+  // kernel and variant, text after # is ignored.
+  //
+  string line;
+  while ( getline(file, line) ) {
+    line = line.substr(0, line.find('#'));
+
+    istringstream line_stream(line);
+    string kernel_name, variant_name, tuning_name;
+    if ( !(line_stream >> kernel_name) ) {
+      continue;
+    }
+    if ( !(line_stream >> variant_name >> tuning_name) ) {
+      getCout() << " ERROR: Bad line in tuning file " << filename
+                << ": " << line << endl;
+      continue;
+    }
+
+    VariantID vid = NumVariants;
+    for (size_t iv = 0; iv < NumVariants; ++iv) {
+      if ( getVariantName(static_cast<VariantID>(iv)) == variant_name ) {
+        vid = static_cast<VariantID>(iv);
+      }
+    }
+    if ( vid == NumVariants ) {
+      getCout() << " ERROR: Unknown variant " << variant_name
+                << " in tuning file " << filename << endl;
+      continue;
+    }
+
+    kernel_tuning_names[{kernel_name, vid}].emplace_back(tuning_name);
+  }
+}
+
+//
+// The key of a tuning in the tuning database, the GPU model is "cpu" for
+// the CPU variants and spaces in it are replaced by underscores.
+//
+Executor::TuningDBKey Executor::getTuningDBKey(const KernelBase* kern,
+                                               VariantID vid,
+                                               size_t tune_idx) const
+{
+  string model = isVariantGPU(vid) ? getGPUModelName() : string("cpu");
+  if ( model.empty() ) {
+    model = "none";
+  }
+  std::replace(model.begin(), model.end(), ' ', '_');
+  return TuningDBKey{kern->getName(), getVariantName(vid),
+                     getDataTypeName(kern->getDataType(vid, tune_idx)),
+                     getTuningDBSizeBucket(kern->getActualProblemSize()),
+                     model};
+}
+
+void Executor::readTuningDBFile(const string& filename)
+{
+  ifstream file(filename.c_str());
+  if ( !file ) {
+    // a new database is written at the end of the run
+    if ( run_params.getRunBestTunings() ) {
+      getCout() << " ERROR: Can't open tuning database file " << filename << endl;
+    }
+    return;
+  }
+
+  //
+  // Each line gives a kernel, a variant, a data type, a size bucket, a GPU
+  // model, the best tuning, and its time per rep, text after # is ignored.
+  //
+  string line;
+  while ( getline(file, line) ) {
+    line = line.substr(0, line.find('#'));
+
+    istringstream line_stream(line);
+    string kernel_name, variant_name, data_type_name, model, tuning_name;
+    Index_type bucket = 0;
+    double time_per_rep = 0.0;
+    if ( !(line_stream >> kernel_name) ) {
+      continue;
+    }
+    if ( !(line_stream >> variant_name >> data_type_name >> bucket >> model
+                       >> tuning_name >> time_per_rep) ) {
+      getCout() << " ERROR: Bad line in tuning database file " << filename
+                << ": " << line << endl;
+      continue;
+    }
+
+    tuning_db[TuningDBKey{kernel_name, variant_name, data_type_name,
+                          bucket, model}] =
+        TuningDBEntry{tuning_name, time_per_rep};
+  }
+}
+
+//
+// Run only the best tuning in the tuning database of each kernel variant
+// and data type, kernel variants without an entry for their size bucket
+// and GPU model run all selected tunings.
+//
+void Executor::selectBestTunings()
+{
+  for (KernelBase* kernel : kernels) {
+    for (VariantID vid : variant_ids) {
+
+      set<string> found_data_types;
+      vector<string> best_tunings;
+      for (size_t tune_idx = 0; tune_idx < kernel->getNumVariantTunings(vid); ++tune_idx) {
+        const TuningDBKey key = getTuningDBKey(kernel, vid, tune_idx);
+        auto iter = tuning_db.find(key);
+        if ( iter != tuning_db.end() &&
+             iter->second.tuning_name == kernel->getVariantTuningName(vid, tune_idx) ) {
+          found_data_types.insert(std::get<2>(key));
+          best_tunings.emplace_back(iter->second.tuning_name);
+        }
+      }
+      if ( found_data_types.empty() ) {
+        if ( kernel->hasVariantDefined(vid) && run_params.showProgress() ) {
+          getCout() << "\t" << kernel->getName() << " " << getVariantName(vid)
+                    << " has no best tuning in the tuning database" << endl;
+        }
+        continue;
+      }
+
+      vector<string>& kern_tunings = kernel_tuning_names[{kernel->getName(), vid}];
+      kern_tunings.clear();
+      for (size_t tune_idx = 0; tune_idx < kernel->getNumVariantTunings(vid); ++tune_idx) {
+        const string& tuning_name = kernel->getVariantTuningName(vid, tune_idx);
+        const string data_type_name = getDataTypeName(kernel->getDataType(vid, tune_idx));
+        if ( found_data_types.count(data_type_name) == 0 ||
+             find(best_tunings.begin(), best_tunings.end(), tuning_name) !=
+               best_tunings.end() ) {
+          kern_tunings.emplace_back(tuning_name);
+        }
+      }
+    }
+  }
+}
+
+void Executor::autotuneKernels()
+{
+  getCout() << "\n\nAutotune GPU block size tunings...\n";
+
+  //
+  // Search the block size tunings, ie. block_<size> or occgs_<size>, of
+  // each GPU variant and data type for the fastest one. Every tuning is
+  // probed briefly, tunings much slower than the fastest are pruned, and the
+  // rest are probed again for longer. Only the fastest block size tuning is
+  // run afterwards, together with tunings that have no block size.
+  //
+  const double target_time = run_params.getTargetTime();
+  const double first_probe_time = (target_time > 0.0) ? 0.01 * target_time
+                                                      : 1.0e-3;
+  const double second_probe_time = 10.0 * first_probe_time;
+  const double prune_factor = 1.5;
+
+  auto isBlockSizeTuning = [](const KernelBase* kern, VariantID vid,
+                              size_t tune_idx) {
+    string name = kern->getVariantTuningName(vid, tune_idx);
+    if ( kern->usesDataTypes() ) {
+      const string suffix = "_" + getDataTypeName(kern->getDataType(vid, tune_idx));
+      if ( name.size() > suffix.size() &&
+           name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0 ) {
+        name.erase(name.size() - suffix.size());
+      }
+    }
+    const size_t pos = name.find_last_of('_');
+    return pos != string::npos && pos + 1 < name.size() &&
+           name.find_first_not_of("0123456789", pos + 1) == string::npos;
+  };
+
+  for (KernelBase* kernel : kernels) {
+
+    for (VariantID vid : variant_ids) {
+      if ( !isVariantGPU(vid) ) {
+        continue;
+      }
+
+      vector<bool> run_tuning(kernel->getNumVariantTunings(vid), false);
+      map<DataType, vector<size_t>> searched_tunings;
+      for (size_t tune_idx = 0;
+           tune_idx < kernel->getNumVariantTunings(vid);
+           ++tune_idx) {
+        if ( !isTuningSelected(kernel, vid,
+                               kernel->getVariantTuningName(vid, tune_idx)) ) {
+          continue;
+        }
+        if ( isBlockSizeTuning(kernel, vid, tune_idx) ) {
+          searched_tunings[kernel->getDataType(vid, tune_idx)].push_back(tune_idx);
+        } else {
+          run_tuning[tune_idx] = true;
+        }
+      }
+      if ( searched_tunings.empty() ) {
+        continue;
+      }
+
+      for (auto const& dt_tunings : searched_tunings) {
+
+        if ( dt_tunings.second.size() == 1 ) {
+          run_tuning[dt_tunings.second.front()] = true;
+          continue;
+        }
+
+        vector<pair<double, size_t>> rep_times;
+        for (size_t tune_idx : dt_tunings.second) {
+          rep_times.emplace_back(
+              kernel->probeRepTime(vid, tune_idx, first_probe_time), tune_idx);
+        }
+        const double first_best_time = min_element(rep_times.begin(),
+                                                   rep_times.end())->first;
+
+        vector<pair<double, size_t>> kept_times;
+        for (auto const& rep_time : rep_times) {
+          if ( rep_time.first <= prune_factor * first_best_time ) {
+            kept_times.push_back(rep_time);
+          }
+        }
+        if ( kept_times.size() > 1 ) {
+          for (auto& rep_time : kept_times) {
+            rep_time.first = kernel->probeRepTime(vid, rep_time.second,
+                                                  second_probe_time);
+          }
+        }
+        auto const& best = *min_element(kept_times.begin(), kept_times.end());
+
+        run_tuning[best.second] = true;
+        autotune_results.push_back(
+            AutotuneResult{kernel->getName(), vid, dt_tunings.first,
+                           kernel->getVariantTuningName(vid, best.second),
+                           best.first, rep_times.size(),
+                           rep_times.size() - kept_times.size()});
+
+        if ( run_params.showProgress() ) {
+          getCout() << "\t" << kernel->getName() << " "
+                    << getVariantName(vid) << " -- "
+                    << kernel->getVariantTuningName(vid, best.second)
+                    << " of " << rep_times.size() << " tunings, "
+                    << rep_times.size() - kept_times.size() << " pruned" << endl;
+        }
+      }
+
+      vector<string>& kern_tunings = kernel_tuning_names[{kernel->getName(), vid}];
+      kern_tunings.clear();
+      for (size_t tune_idx = 0; tune_idx < run_tuning.size(); ++tune_idx) {
+        if ( run_tuning[tune_idx] ) {
+          kern_tunings.emplace_back(kernel->getVariantTuningName(vid, tune_idx));
+        }
+      }
+    }
+
+    kernel->clearSetupDataCache();
+  }
+
+  writeAutotuneReport(getCout());
+}
+
+void Executor::runWarmupKernels()
+{
+  if ( run_params.getDisableWarmup() ) {
+    return;
+  } 
+
+  getCout() << "\n\nRun warmup kernels...\n";
+
+  //
+  // For kernels to be run, assemble a set of feature IDs
+  //
+  std::set<FeatureID> feature_ids;
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kernel = kernels[ik];
+
+    for (size_t fid = 0; fid < NumFeatures; ++fid) {
+      FeatureID tfid = static_cast<FeatureID>(fid);
+      if (kernel->usesFeature(tfid) ) {
+         feature_ids.insert( tfid );
+      }
+    }
+  
+  } // iterate over kernels
+
+  //
+  // Map feature IDs to set of warmup kernel IDs
+  //
+  std::set<KernelID> kernel_ids;
+  for ( auto fid = feature_ids.begin(); fid != feature_ids.end(); ++ fid ) {
+
+    switch (*fid) {
+
+      case Forall:
+      case Kernel:
+      case Launch:
+        kernel_ids.insert(Basic_DAXPY); break;
+
+      case Sort:
+        kernel_ids.insert(Algorithm_SORT); break;
+   
+      case Scan:
+        kernel_ids.insert(Basic_INDEXLIST_3LOOP); break;
+
+      case Workgroup:
+        kernel_ids.insert(Apps_HALOEXCHANGE_FUSED); break;
+
+      case Reduction:
+        kernel_ids.insert(Basic_REDUCE3_INT); break;
+
+      case Atomic:
+        kernel_ids.insert(Basic_PI_ATOMIC); break; 
+
+      case View:
+        break;
+  
+      default:
+        break;
+
+    }
+
+  }
+
+  //
+  // Run warmup kernels
+  //
+  const double trace_start = detail::haveTrace() ? detail::getTraceTime() : 0.0;
+  for ( auto kid = kernel_ids.begin(); kid != kernel_ids.end(); ++ kid ) {
+    KernelBase* kernel = getKernelObject(*kid, run_params);
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+    kernel->caliperOff();
+#endif
+    runKernel(kernel, true);
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+    kernel->caliperOn();
+#endif
+    delete kernel;
+  }
+  if ( detail::haveTrace() ) {
+    detail::addTraceEvent("Warmup kernels", "warmup", trace_start,
+                          detail::getTraceTime(), {});
+  }
+
+}
+
+void Executor::runAdaptiveWarmup()
+{
+  const double tolerance = run_params.getAdaptiveWarmupTolerance();
+  const Index_type max_reps = run_params.getAdaptiveWarmupMaxReps();
+
+  getCout() << "\n\nRun adaptive warmup to rep time tolerance of "
+            << tolerance << "...\n";
+
+  //
+  // Warm up each variant tuning to be run with the kernel objects of the
+  // suite passes, so the first pass runs after the cold-start costs of
+  // its own code and data, ie. module loads and first touch of pages.
+  //
+  for (KernelBase* kernel : kernels) {
+
+    for (VariantID vid : variant_ids) {
+
+      for (size_t tune_idx = 0;
+           tune_idx < kernel->getNumVariantTunings(vid);
+           ++tune_idx) {
+        std::string const& tuning_name =
+          kernel->getVariantTuningName(vid, tune_idx);
+
+        if ( !kernel->hasVariantDefined(vid) ||
+             !isTuningSelected(kernel, vid, tuning_name) ) {
+          continue;
+        }
+
+        KernelBase::WarmupResult warmup =
+            kernel->warmupUntilStable(vid, tune_idx, tolerance, max_reps);
+        warmup_results.push_back(
+            AdaptiveWarmupResult{kernel->getName(), vid, tuning_name,
+                                 static_cast<long>(warmup.reps),
+                                 warmup.converged,
+                                 warmup.first_rep_time, warmup.last_rep_time});
+
+        if ( run_params.showProgress() ) {
+          getCout() << "\t" << kernel->getName() << " "
+                    << getVariantName(vid) << " " << tuning_name << " -- "
+                    << warmup.reps << " reps" << endl;
+        }
+      }
+    }
+
+    kernel->clearSetupDataCache();
+  }
+}
+
+void Executor::calibrateKernelReps()
+{
+  const double target_time = run_params.getTargetTime();
+
+  getCout() << "\n\nCalibrate kernel reps to target time of "
+            << target_time << " sec...\n";
+
+  //
+  // Probe each variant tuning to be run for at least a fraction of the
+  // target time. Reps are set so the slowest variant tuning of each kernel
+  // runs for about the target time, so all variants of a kernel run the same
+  // reps and speedups and FOMs remain meaningful.
+  //
+  const double min_probe_time = 0.1 * target_time;
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kernel = kernels[ik];
+
+    // reps given in the run plan are kept
+    auto plan_entry = run_plan_entries.find(kernel);
+    if ( plan_entry != run_plan_entries.end() &&
+         plan_entry->second->reps > 0 ) {
+      continue;
+    }
+
+    double max_rep_time = 0.0;
+
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+
+      for (size_t tune_idx = 0;
+           tune_idx < kernel->getNumVariantTunings(vid);
+           ++tune_idx) {
+        std::string const& tuning_name =
+          kernel->getVariantTuningName(vid, tune_idx);
+
+        if ( isTuningSelected(kernel, vid, tuning_name) )
+        {
+          max_rep_time = max(max_rep_time,
+              static_cast<double>(kernel->probeRepTime(vid, tune_idx,
+                                                       min_probe_time)));
+        }
+      }
+    }
+
+    if ( max_rep_time > 0.0 ) {
+      Index_type reps = max(static_cast<Index_type>(target_time / max_rep_time),
+                            static_cast<Index_type>(1));
+      if ( !kernel->getRepBatchingAllowed() ) {
+        // data size of these kernels grows with reps
+        reps = min(reps, kernel->getRunReps());
+      }
+      kernel->setCalibratedReps(reps);
+    }
+
+    kernel->clearSetupDataCache();
+
+    if ( run_params.showProgress() ) {
+      getCout() << "\t" << kernel->getName() << " -- "
+                << kernel->getRunReps() << " reps" << endl;
+    }
+  }
+
+}
+
+//
+// Estimate the time of the suite passes from the times per rep in the
+// tuning database and from short probes of the selected variant tunings,
+// only a probe gives the setUp, checksum, and tearDown times. Warmup,
+// calibration, and the extra runs after the passes are not estimated.
+// With a walltime budget the reps are scaled so the estimate fits in it.
+//
+void Executor::writeRunTimeEstimate(ostream& str)
+{
+  const double probe_time = run_params.getEstimateProbeTime();
+  const double budget = run_params.getWalltimeBudget();
+  const double target_time = run_params.getTargetTime();
+  const int npasses = run_params.getNumPasses();
+
+  str << "\nRun time estimate:"
+      << "\n------------------" << endl;
+
+  if ( tuning_db.empty() && probe_time <= 0.0 ) {
+    str << "\t Give --tuning-db or --estimate-probe to estimate run time\n"
+        << endl;
+    return;
+  }
+
+  struct KernelEstimate
+  {
+    KernelBase* kernel;
+    Index_type reps;
+    double phase_time[KernelBase::NumExecutePhases]; // per pass, run per rep
+    size_t num_unknown;
+  };
+  vector<KernelEstimate> estimates;
+
+  for (KernelBase* kernel : kernels) {
+
+    KernelEstimate est{kernel, kernel->getRunReps(), {0.0, 0.0, 0.0, 0.0}, 0};
+    double max_rep_time = 0.0;
+
+    for (const auto& selected : getSelectedTunings(kernel)) {
+      const VariantID vid = selected.first;
+      const size_t tune_idx = selected.second;
+
+      double phase_time[KernelBase::NumExecutePhases] = {0.0, 0.0, 0.0, 0.0};
+      bool have_rep_time = false;
+      if ( probe_time > 0.0 ) {
+        kernel->probePhaseTimes(vid, tune_idx, probe_time, phase_time);
+        have_rep_time = true;
+      }
+
+      // the database time is the best over all passes of a previous run
+      auto iter = tuning_db.find(getTuningDBKey(kernel, vid, tune_idx));
+      if ( iter != tuning_db.end() &&
+           iter->second.tuning_name ==
+             kernel->getVariantTuningName(vid, tune_idx) ) {
+        phase_time[KernelBase::RunPhase] = iter->second.time_per_rep;
+        have_rep_time = true;
+      }
+
+      if ( !have_rep_time ) {
+        est.num_unknown += 1;
+        continue;
+      }
+      for (int ip = 0; ip < KernelBase::NumExecutePhases; ++ip) {
+        est.phase_time[ip] += phase_time[ip];
+      }
+      max_rep_time = max(max_rep_time, phase_time[KernelBase::RunPhase]);
+    }
+
+    kernel->clearSetupDataCache();
+
+    // reps calibrated as in calibrateKernelReps, reps in the run plan are kept
+    auto plan_entry = run_plan_entries.find(kernel);
+    if ( target_time > 0.0 && max_rep_time > 0.0 &&
+         !(plan_entry != run_plan_entries.end() &&
+           plan_entry->second->reps > 0) ) {
+      est.reps = max(static_cast<Index_type>(target_time / max_rep_time),
+                     static_cast<Index_type>(1));
+      if ( !kernel->getRepBatchingAllowed() ) {
+        est.reps = min(est.reps, kernel->getRunReps());
+      }
+    }
+
+    estimates.emplace_back(est);
+  }
+
+  auto runTime = [&](const KernelEstimate& est) {
+    return npasses * est.reps * est.phase_time[KernelBase::RunPhase];
+  };
+  auto fixedTime = [&](const KernelEstimate& est) {
+    return npasses * (est.phase_time[KernelBase::SetUpPhase] +
+                      est.phase_time[KernelBase::ChecksumPhase] +
+                      est.phase_time[KernelBase::TearDownPhase]);
+  };
+
+  double run_total = 0.0;
+  double fixed_total = 0.0;
+  size_t unknown_total = 0;
+  for (const KernelEstimate& est : estimates) {
+    run_total += runTime(est);
+    fixed_total += fixedTime(est);
+    unknown_total += est.num_unknown;
+  }
+
+  //
+  // Scale the run phase so the estimate fits in the budget, setUp,
+  // checksum, and tearDown do not depend on reps.
+  //
+  double rep_scale = 0.0;
+  if ( budget > 0.0 && run_total > 0.0 ) {
+    rep_scale = (budget - fixed_total) / run_total;
+  }
+
+  size_t namelen = 6;
+  for (const KernelEstimate& est : estimates) {
+    namelen = max(namelen, est.kernel->getName().size());
+  }
+
+  str << "Times (sec) are summed over " << npasses << " passes" << endl;
+  str << left << setw(namelen) << "Kernel" << right
+      << setw(10) << "Reps";
+  for (int ip = 0; ip < KernelBase::NumExecutePhases; ++ip) {
+    KernelBase::ExecutePhase phase = static_cast<KernelBase::ExecutePhase>(ip);
+    str << setw(12) << KernelBase::getExecutePhaseName(phase);
+  }
+  str << setw(12) << "Total" << setw(10) << "Unknown";
+  if ( rep_scale > 0.0 ) {
+    str << setw(14) << "Budget reps";
+  }
+  str << endl;
+
+  str << setprecision(4) << scientific;
+  for (const KernelEstimate& est : estimates) {
+    str << left << setw(namelen) << est.kernel->getName() << right
+        << setw(10) << est.reps;
+    for (int ip = 0; ip < KernelBase::NumExecutePhases; ++ip) {
+      const double time = (ip == KernelBase::RunPhase)
+          ? runTime(est) : npasses * est.phase_time[ip];
+      str << setw(12) << time;
+    }
+    str << setw(12) << runTime(est) + fixedTime(est)
+        << setw(10) << est.num_unknown;
+    if ( rep_scale > 0.0 ) {
+      Index_type budget_reps =
+          max(static_cast<Index_type>(est.reps * rep_scale),
+              static_cast<Index_type>(1));
+      if ( !est.kernel->getRepBatchingAllowed() ) {
+        // data size of these kernels grows with reps
+        budget_reps = min(budget_reps, est.reps);
+      }
+      str << setw(14) << budget_reps;
+    }
+    str << endl;
+  }
+  str.unsetf(std::ios_base::floatfield);
+  str << setprecision(6);
+
+  str << "\nEstimated suite time (sec) : " << run_total + fixed_total
+      << " (run " << run_total << ", setUp/checksum/tearDown "
+      << fixed_total << ")" << endl;
+  if ( unknown_total > 0 ) {
+    str << "\t " << unknown_total << " variant tunings have no time per rep"
+        << " in the tuning database and are not counted,"
+        << " give --estimate-probe to probe them" << endl;
+  }
+  if ( probe_time <= 0.0 ) {
+    str << "\t setUp, checksum, and tearDown times are only estimated"
+        << " with --estimate-probe" << endl;
+  }
+
+  if ( budget > 0.0 ) {
+    str << "\nWalltime budget (sec) : " << budget << endl;
+    if ( run_total <= 0.0 ) {
+      str << "\t No run time estimate to fit to the budget" << endl;
+    } else if ( rep_scale <= 0.0 ) {
+      str << "\t setUp, checksum, and tearDown alone exceed the budget,"
+          << " run fewer passes or kernels" << endl;
+    } else if ( target_time > 0.0 ) {
+      str << "\t Suggested --target-time " << target_time * rep_scale
+          << " (or the Budget reps above in a --run-plan)" << endl;
+    } else {
+      str << "\t Suggested --repfact " << run_params.getRepFactor() * rep_scale
+          << " (or the Budget reps above in a --run-plan)" << endl;
+    }
+  }
+
+  str << endl;
+  str.flush();
+}
+
+void Executor::runConcurrentKernels()
+{
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+  const size_t num_concurrent = run_params.getConcurrentKernels();
+
+  getCout() << "\n\nRunning kernels concurrently...\n";
+
+  //
+  // Groups of indices into kernels to run concurrently.
+  //
+  vector<vector<size_t>> groups;
+  if ( run_params.getConcurrentMixed() ) {
+    for (size_t ik = 0; ik < kernels.size(); ik += num_concurrent) {
+      vector<size_t> group;
+      for (size_t jk = ik; jk < min(ik + num_concurrent, kernels.size()); ++jk) {
+        group.push_back(jk);
+      }
+      groups.push_back(group);
+    }
+  } else {
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      groups.push_back(vector<size_t>(num_concurrent, ik));
+    }
+  }
+
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    VariantID vid = variant_ids[iv];
+    if ( !isVariantGPU(vid) ) {
+      continue;
+    }
+
+    for (vector<size_t> const& group : groups) {
+
+      for (std::string const& tuning_name : tuning_names[vid]) {
+
+        bool all_defined = true;
+        for (size_t ik : group) {
+          all_defined = all_defined &&
+                        kernels[ik]->hasVariantTuningDefined(vid, tuning_name) &&
+                        isTuningSelected(kernels[ik], vid, tuning_name);
+        }
+        if ( !all_defined ) {
+          continue;
+        }
+
+        //
+        // Use new kernel objects so results of the suite passes are kept.
+        //
+        vector<KernelBase*> instances;
+        vector<size_t> tune_idxs;
+        string kernel_names;
+        for (size_t ik : group) {
+          KernelBase* instance =
+              getKernelObject(kernels[ik]->getKernelID(), run_params);
+          instance->setCalibratedReps(kernels[ik]->getRunReps());
+          instance->setGPUStreamIndex(static_cast<int>(instances.size()));
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+          instance->caliperOff();
+#endif
+          instances.push_back(instance);
+          tune_idxs.push_back(instance->getVariantTuningIndex(vid, tuning_name));
+          kernel_names += (kernel_names.empty() ? "" : "+") + instance->getName();
+        }
+
+        if ( run_params.showProgress() ) {
+          getCout() << "\tRunning " << kernel_names << " "
+                    << getVariantName(vid) << " " << tuning_name << endl;
+        }
+
+        ConcurrentResult result{kernel_names, vid, tuning_name, instances.size(),
+                                numeric_limits<double>::max(),
+                                numeric_limits<double>::max()};
+
+        const int npasses = run_params.getNumPasses();
+        for (int ip = 0; ip < npasses; ++ip) {
+
+          double serial_time = 0.0;
+          for (size_t ii = 0; ii < instances.size(); ++ii) {
+            instances[ii]->execute(vid, tune_idxs[ii]);
+            serial_time += instances[ii]->getLastTime();
+          }
+
+          double concurrent_time =
+              KernelBase::executeConcurrently(instances, vid, tune_idxs);
+
+          result.serial_time = min(result.serial_time, serial_time);
+          result.concurrent_time = min(result.concurrent_time, concurrent_time);
+        }
+
+        concurrent_results.push_back(result);
+
+        for (KernelBase* instance : instances) {
+          delete instance;
+        }
+
+      } // iterate over tunings
+
+    } // iterate over groups
+
+  } // iterate over variants
+#else
+  getCout() << "\n\nNo GPU variants to run concurrently...\n";
+#endif
+}
+
+//
+// Each selected kernel variant tuning that ran in the suite passes is run
+// on a new kernel object alone and then with the load running, pass by
+// pass, so both times see the same state of the machine.
+//
+void Executor::runInterference()
+{
+  getCout() << "\n\nRunning kernels with interference load...\n";
+
+  const bool copy_load = run_params.hasInterferenceLoad(RunParams::CopyLoad);
+  const size_t copy_bytes = 64*1024*1024;
+
+  //
+  // Each cpu-stream thread runs its own Stream_TRIAD object so the threads
+  // stream through separate arrays.
+  //
+  vector<KernelBase*> loads;
+  vector<VariantID> load_vids;
+  vector<int> load_cpus;
+  auto addLoad = [&](VariantID load_vid, int cpu, int stream_idx) {
+    KernelBase* load = getKernelObject(Stream_TRIAD, run_params);
+    if ( !load->hasVariantDefined(load_vid) ) {
+      getCout() << "\n WARNING: Stream_TRIAD " << getVariantName(load_vid)
+                << " is not defined, interference load not run" << endl;
+      delete load;
+      return;
+    }
+    load->setGPUStreamIndex(stream_idx);
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+    load->caliperOff();
+#endif
+    loads.push_back(load);
+    load_vids.push_back(load_vid);
+    load_cpus.push_back(cpu);
+  };
+
+  if ( run_params.hasInterferenceLoad(RunParams::CPUStreamLoad) ) {
+    for (int cpu : detail::getBackgroundCPUs(run_params.getInterferenceThreads())) {
+      addLoad(Base_Seq, cpu, -1);
+    }
+  }
+  if ( run_params.hasInterferenceLoad(RunParams::GPUStreamLoad) ) {
+    // stream 1 of the pool, kernels of the suite passes run on the default
+    // stream or stream 0 of the pool
+#if defined(RAJA_ENABLE_CUDA)
+    addLoad(Base_CUDA, -1, 1);
+#elif defined(RAJA_ENABLE_HIP)
+    addLoad(Base_HIP, -1, 1);
+#endif
+  }
+
+  auto startLoads = [&]() {
+    for (size_t il = 0; il < loads.size(); ++il) {
+      loads[il]->startBackgroundRun(load_vids[il], 0, load_cpus[il]);
+    }
+    if ( copy_load ) {
+      detail::startCopyLoad(copy_bytes);
+    }
+  };
+  auto stopLoads = [&]() {
+    if ( copy_load ) {
+      detail::stopCopyLoad();
+    }
+    for (KernelBase* load : loads) {
+      load->stopBackgroundRun();
+    }
+  };
+
+  for (KernelBase* kernel : kernels) {
+    for (VariantID vid : variant_ids) {
+      for (size_t tune_idx = 0; tune_idx < kernel->getNumVariantTunings(vid); ++tune_idx) {
+        if ( !kernel->wasVariantTuningRun(vid, tune_idx) ) {
+          continue;
+        }
+        const string& tuning_name = kernel->getVariantTuningName(vid, tune_idx);
+
+        //
+        // Use new kernel objects so results of the suite passes are kept.
+        //
+        KernelBase* instance =
+            getKernelObject(kernel->getKernelID(), run_params);
+        instance->setCalibratedReps(kernel->getRunReps());
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+        instance->caliperOff();
+#endif
+        const size_t itune = instance->getVariantTuningIndex(vid, tuning_name);
+
+        if ( run_params.showProgress() ) {
+          getCout() << "\tRunning " << instance->getName() << " "
+                    << getVariantName(vid) << " " << tuning_name << endl;
+        }
+
+        InterferenceResult result{instance->getName(), vid, tuning_name,
+                                  numeric_limits<double>::max(),
+                                  numeric_limits<double>::max()};
+
+        const int npasses = run_params.getNumPasses();
+        for (int ip = 0; ip < npasses; ++ip) {
+
+          instance->execute(vid, itune);
+          result.idle_time = min(result.idle_time, instance->getLastTime());
+
+          startLoads();
+          instance->execute(vid, itune);
+          stopLoads();
+          result.loaded_time = min(result.loaded_time, instance->getLastTime());
+        }
+
+        interference_results.push_back(result);
+
+        delete instance;
+      }
+    }
+  }
+
+  for (KernelBase* load : loads) {
+    delete load;
+  }
+}
+
+void Executor::runCoExecution()
+{
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+  const VariantID cpu_vid = run_params.getCoExecCPUVariant();
+  const VariantID gpu_vid = run_params.getCoExecGPUVariant();
+  const double gpu_fraction = run_params.getCoExecGPUFraction();
+  const RunParams::SizeMeaning size_meaning = run_params.getSizeMeaning();
+  const double size = run_params.getSize();
+
+  getCout() << "\n\nRunning " << getVariantName(cpu_vid) << " and "
+            << getVariantName(gpu_vid) << " variants at the same time...\n";
+
+  for (KernelBase* kernel : kernels) {
+
+    //
+    // Each side runs the first of its selected tunings that was run in the
+    // suite passes.
+    //
+    const VariantID vids[2] = {cpu_vid, gpu_vid};
+    size_t kernel_tune_idxs[2] = {kernel->getNumVariantTunings(cpu_vid),
+                                  kernel->getNumVariantTunings(gpu_vid)};
+    for (size_t is = 0; is < 2; ++is) {
+      for (size_t tune_idx = 0;
+           tune_idx < kernel->getNumVariantTunings(vids[is]); ++tune_idx) {
+        if ( kernel->wasVariantTuningRun(vids[is], tune_idx) &&
+             isTuningSelected(kernel, vids[is],
+                              kernel->getVariantTuningName(vids[is], tune_idx)) ) {
+          kernel_tune_idxs[is] = tune_idx;
+          break;
+        }
+      }
+    }
+    if ( kernel_tune_idxs[0] == kernel->getNumVariantTunings(cpu_vid) ||
+         kernel_tune_idxs[1] == kernel->getNumVariantTunings(gpu_vid) ) {
+      continue;
+    }
+
+    //
+    // Each side is a new kernel object made with its part of the problem
+    // size, its data is in the data space of its variant.
+    //
+    const double gpu_size = std::max(1.0,
+        std::floor(gpu_fraction * kernel->getActualProblemSize()));
+    const double cpu_size = std::max(1.0,
+        kernel->getActualProblemSize() - gpu_size);
+    const double side_sizes[2] = {cpu_size, gpu_size};
+
+    vector<KernelBase*> instances;
+    vector<VariantID> instance_vids;
+    vector<size_t> tune_idxs;
+    for (size_t is = 0; is < 2; ++is) {
+      run_params.setSize(side_sizes[is]);
+      KernelBase* instance = getKernelObject(kernel->getKernelID(), run_params);
+      run_params.restoreSize(size_meaning, size);
+      instance->setCalibratedReps(kernel->getRunReps());
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+      instance->caliperOff();
+#endif
+      const string& tuning_name =
+          kernel->getVariantTuningName(vids[is], kernel_tune_idxs[is]);
+      instances.push_back(instance);
+      instance_vids.push_back(vids[is]);
+      tune_idxs.push_back(instance->getVariantTuningIndex(vids[is], tuning_name));
+    }
+
+    if ( run_params.showProgress() ) {
+      getCout() << "\tRunning " << kernel->getName() << endl;
+    }
+
+    CoExecResult result{kernel->getName(),
+                        kernel->getVariantTuningName(cpu_vid, kernel_tune_idxs[0]),
+                        kernel->getVariantTuningName(gpu_vid, kernel_tune_idxs[1]),
+                        numeric_limits<double>::max(),
+                        numeric_limits<double>::max(),
+                        numeric_limits<double>::max(),
+                        numeric_limits<double>::max(),
+                        numeric_limits<double>::max(),
+                        static_cast<double>(instances[0]->getItsPerRep() +
+                                            instances[1]->getItsPerRep()) *
+                            kernel->getRunReps(),
+                        kernel->getMinTime(gpu_vid, kernel_tune_idxs[1])};
+
+    const int npasses = run_params.getNumPasses();
+    for (int ip = 0; ip < npasses; ++ip) {
+
+      instances[0]->execute(cpu_vid, tune_idxs[0]);
+      result.cpu_time = min(result.cpu_time, instances[0]->getLastTime());
+      instances[1]->execute(gpu_vid, tune_idxs[1]);
+      result.gpu_time = min(result.gpu_time, instances[1]->getLastTime());
+
+      double co_time =
+          KernelBase::executeConcurrently(instances, instance_vids, tune_idxs);
+
+      result.co_time = min(result.co_time, co_time);
+      result.cpu_co_time = min(result.cpu_co_time, instances[0]->getLastTime());
+      result.gpu_co_time = min(result.gpu_co_time, instances[1]->getLastTime());
+    }
+
+    co_exec_results.push_back(result);
+
+    for (KernelBase* instance : instances) {
+      delete instance;
+    }
+
+  } // iterate over kernels
+#else
+  getCout() << "\n\nNo GPU variants to co-execute...\n";
+#endif
+}
+
+void Executor::runAppProxy()
+{
+  getCout() << "\n\nRunning app proxy cycles...\n";
+
+  const int num_cycles = run_params.getAppProxyCycles();
+  const RunParams::SizeMeaning size_meaning = run_params.getSizeMeaning();
+  const double size = run_params.getSize();
+
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    VariantID vid = variant_ids[iv];
+
+    //
+    // Each kernel of the plan runs the first of its selected tunings, the
+    // variant is skipped if a kernel has none.
+    //
+    AppProxyResult result{vid, {}, {}, {}, {}, {},
+                          numeric_limits<double>::max()};
+    vector<KernelBase*> instances;
+    vector<size_t> tune_idxs;
+    bool all_defined = true;
+
+    for (size_t ik = 0; ik < kernels.size() && all_defined; ++ik) {
+      KernelBase* kernel = kernels[ik];
+      const RunParams::RunPlanEntry* entry = run_plan_entries.at(kernel);
+
+      all_defined = false;
+      for (size_t tune_idx = 0;
+           tune_idx < kernel->getNumVariantTunings(vid); ++tune_idx) {
+        const string& tuning_name = kernel->getVariantTuningName(vid, tune_idx);
+        if ( kernel->wasVariantTuningRun(vid, tune_idx) &&
+             isTuningSelected(kernel, vid, tuning_name) ) {
+
+          const long weight = max(entry->weight, 1L);
+
+          //
+          // Use new kernel objects so results of the suite passes are kept.
+          //
+          if ( entry->size > 0.0 ) {
+            run_params.setSize(entry->size);
+          }
+          KernelBase* instance = getKernelObject(entry->kernel_id, run_params);
+          run_params.restoreSize(size_meaning, size);
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+          instance->caliperOff();
+#endif
+          instance->setCalibratedReps(static_cast<Index_type>(weight));
+          instances.push_back(instance);
+          tune_idxs.push_back(instance->getVariantTuningIndex(vid, tuning_name));
+
+          result.kernel_names.push_back(kernel->getName());
+          result.tuning_names.push_back(tuning_name);
+          result.weights.push_back(weight);
+          result.isolated_times.push_back(
+              kernel->getMinTime(vid, tune_idx) / kernel->getRunReps() * weight);
+          result.interleaved_times.push_back(numeric_limits<double>::max());
+
+          all_defined = true;
+          break;
+        }
+      }
+    }
+
+    if ( all_defined && !instances.empty() ) {
+
+      if ( run_params.showProgress() ) {
+        getCout() << "\tRunning " << getVariantName(vid) << " "
+                  << num_cycles << " cycles" << endl;
+      }
+
+      const int npasses = run_params.getNumPasses();
+      for (int ip = 0; ip < npasses; ++ip) {
+
+        double cycle_time =
+            KernelBase::executeInterleaved(instances, vid, tune_idxs, num_cycles) /
+            num_cycles;
+
+        result.cycle_time = min(result.cycle_time, cycle_time);
+        for (size_t ii = 0; ii < instances.size(); ++ii) {
+          result.interleaved_times[ii] = min(result.interleaved_times[ii],
+              instances[ii]->getLastTime() / num_cycles);
+        }
+      }
+
+      app_proxy_results.push_back(result);
+    }
+
+    for (KernelBase* instance : instances) {
+      delete instance;
+    }
+
+  } // iterate over variants
+}
+
+void Executor::outputRunData()
+{
+  RunParams::InputOpt in_state = run_params.getInputState();
+  if ( in_state != RunParams::PerfRun &&
+       in_state != RunParams::CheckRun ) {
+    return;
+  }
+
+  getCout() << "\n\nGenerate run report files...\n";
+
+  //
+  // Generate output file prefix (including directory path).
+  //
+  string out_fprefix;
+  string outdir = recursiveMkdir(run_params.getOutputDirName());
+  if ( !outdir.empty() ) {
+    chdir(outdir.c_str());
+  }
+  out_fprefix = "./" + run_params.getOutputFilePrefix();
+
+  unique_ptr<ostream> file;
+
+
+  for (RunParams::CombinerOpt combiner : run_params.getNpassesCombinerOpts()) {
+    file = openOutputFile(out_fprefix + "-timing-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::Timing, combiner, 6 /* prec */);
+
+    file = openOutputFile(out_fprefix + "-timing-iteration-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::IterationTiming, combiner, 3 /* prec */);
+
+    if ( haveReferenceVariant() ) {
+      file = openOutputFile(out_fprefix + "-speedup-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+      writeCSVReport(*file, CSVRepMode::Speedup, combiner, 3 /* prec */);
+    }
+
+    if ( run_params.getGPUEventTiming() ) {
+      file = openOutputFile(out_fprefix + "-timing-device-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+      writeCSVReport(*file, CSVRepMode::DeviceTiming, combiner, 6 /* prec */);
+    }
+  }
+
+  file = openOutputFile(out_fprefix + "-checksum.txt");
+  writeChecksumReport(*file);
+
+  file = openOutputFile(out_fprefix + "-timing-ci.csv");
+  writeConfidenceIntervalReport(*file);
+
+  file = openOutputFile(out_fprefix + "-topology.csv");
+  writeTopologyReport(*file);
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  file = openOutputFile(out_fprefix + "-timing-ranks.csv");
+  writeRankTimingReport(*file);
+
+  if ( run_params.getRanksPerGPU() > 0 ) {
+    file = openOutputFile(out_fprefix + "-gpu-sharing.csv");
+    writeGPUSharingReport(*file);
+  }
+#endif
+
+  if ( run_params.getTimingBatchReps() > 0 ) {
+    file = openOutputFile(out_fprefix + "-timing-distribution.csv");
+    writeTimingDistributionReport(*file);
+  }
+
+  file = openOutputFile(out_fprefix + "-roofline.csv");
+  writeRooflineReport(*file);
+
+  {
+    bool have_patterns = false;
+    for (KernelBase* kern : kernels) {
+      for (size_t pid = 0; pid < NumPatterns; ++pid) {
+        have_patterns = have_patterns || kern->hasPattern(static_cast<PatternID>(pid));
+      }
+    }
+    if ( have_patterns ) {
+      file = openOutputFile(out_fprefix + "-patterns.csv");
+      writePatternReport(*file);
+    }
+  }
+
+  file = openOutputFile(out_fprefix + "-run-data.jsonl");
+  writeRunDataReport(*file);
+
+  if ( !run_params.getCompareDir().empty() ) {
+    compareToBaseline();
+    file = openOutputFile(out_fprefix + "-regression.csv");
+    writeRegressionReport(*file);
+  }
+
+  if ( !run_params.getPapiEvents().empty() ) {
+    file = openOutputFile(out_fprefix + "-counters.csv");
+    writeCountersReport(*file);
+  }
+
+  if ( run_params.getValidateBytes() ) {
+    file = openOutputFile(out_fprefix + "-bytes-validation.csv");
+    writeBytesValidationReport(*file);
+  }
+
+  if ( run_params.getMeasureEnergy() ) {
+    file = openOutputFile(out_fprefix + "-energy.csv");
+    writeEnergyReport(*file);
+  }
+
+  {
+    bool have_phases = false;
+    for (KernelBase* kern : kernels) {
+      have_phases = have_phases || !kern->getPhaseNames().empty();
+    }
+    if ( have_phases ) {
+      file = openOutputFile(out_fprefix + "-phase-timing.csv");
+      writePhaseTimingReport(*file);
+    }
+  }
+
+  {
+    bool have_metrics = false;
+    for (KernelBase* kern : kernels) {
+      have_metrics = have_metrics || !kern->getMetricNames().empty();
+    }
+    if ( have_metrics ) {
+      file = openOutputFile(out_fprefix + "-metrics.csv");
+      writeMetricsReport(*file);
+    }
+  }
+
+  if ( run_params.getUseDataPool() ) {
+    file = openOutputFile(out_fprefix + "-datapool.csv");
+    writeDataPoolReport(*file);
+  }
+
+  if ( !concurrent_results.empty() ) {
+    file = openOutputFile(out_fprefix + "-concurrent.csv");
+    writeConcurrentReport(*file);
+  }
+
+  if ( !interference_results.empty() ) {
+    file = openOutputFile(out_fprefix + "-interference.csv");
+    writeInterferenceReport(*file);
+  }
+
+  if ( !app_proxy_results.empty() ) {
+    file = openOutputFile(out_fprefix + "-app-proxy.csv");
+    writeAppProxyReport(*file);
+  }
+
+  if ( !co_exec_results.empty() ) {
+    file = openOutputFile(out_fprefix + "-co-exec.csv");
+    writeCoExecReport(*file);
+  }
+
+  if ( run_params.getReproducible() ) {
+    file = openOutputFile(out_fprefix + "-reproducibility.csv");
+    writeReproducibilityReport(*file);
+  }
+
+  if ( run_params.getColdCache() ) {
+    file = openOutputFile(out_fprefix + "-cold-cache.csv");
+    writeColdCacheReport(*file);
+  }
+
+  if ( !run_params.getOpenMPThreadCounts().empty() ) {
+    file = openOutputFile(out_fprefix + "-omp-scaling.csv");
+    writeOpenMPScalingReport(*file);
+  }
+
+  if ( !run_params.getGPUSettings().empty() ) {
+    file = openOutputFile(out_fprefix + "-gpu-sweep.csv");
+    writeGPUSweepReport(*file);
+  }
+
+  if ( run_params.getCountPageFaults() ) {
+    file = openOutputFile(out_fprefix + "-page-faults.csv");
+    writePageFaultsReport(*file);
+  }
+
+  if ( run_params.getTrackDeviceMemory() ) {
+    file = openOutputFile(out_fprefix + "-device-memory.csv");
+    writeDeviceMemoryReport(*file);
+  }
+
+  if ( detail::haveTelemetry() ) {
+    file = openOutputFile(out_fprefix + "-gpu-telemetry.csv");
+    writeGPUTelemetryReport(*file);
+  }
+
+  if ( detail::haveActivityTracing() ) {
+    file = openOutputFile(out_fprefix + "-device-activity.csv");
+    writeDeviceActivityReport(*file);
+  }
+
+  if ( !warmup_results.empty() ) {
+    file = openOutputFile(out_fprefix + "-warmup.csv");
+    writeWarmupReport(*file);
+  }
+
+  if ( detail::haveTrace() ) {
+    writeTraceFile(out_fprefix);
+  }
+
+  {
+    bool have_gpu_func_attributes = false;
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+          if ( kern->wasVariantTuningRun(vid, tune_idx) &&
+               !kern->getGPUFuncAttributes(vid, tune_idx).empty() ) {
+            have_gpu_func_attributes = true;
+          }
+        }
+      }
+    }
+    if ( have_gpu_func_attributes ) {
+      file = openOutputFile(out_fprefix + "-gpu-func-attributes.csv");
+      writeGPUFuncAttributesReport(*file);
+    }
+  }
+
+  if ( !autotune_results.empty() ) {
+    file = openOutputFile(out_fprefix + "-autotune.txt");
+    writeAutotuneReport(*file);
+  }
+
+  file = openOutputFile(out_fprefix + "-tuning-db.txt");
+  writeTuningDBReport(*file);
+
+  {
+    vector<FOMGroup> fom_groups;
+    getFOMGroups(fom_groups);
+    if (!fom_groups.empty() ) {
+      file = openOutputFile(out_fprefix + "-fom.csv");
+      writeFOMReport(*file, fom_groups);
+    }
+  }
+
+  if ( !size_sweep_results.empty() ) {
+    file = openOutputFile(out_fprefix + "-size-sweep.csv");
+    writeSizeSweepReport(*file);
+  }
+
+  if ( !memory_fit_results.empty() ) {
+    file = openOutputFile(out_fprefix + "-memory-fit.csv");
+    writeMemoryFitReport(*file);
+  }
+
+  if ( run_params.getMPIScaling() != RunParams::NoScaling ) {
+    file = openOutputFile(out_fprefix + "-mpi-scaling.csv");
+    writeMPIScalingReport(*file);
+  }
+
+  file = openOutputFile(out_fprefix + "-kernels.csv");
+  if ( *file ) {
+    bool to_file = true;
+    writeKernelInfoSummary(*file, to_file);
+  }
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  KernelBase::setCaliperMgrFlush();
+#endif
+}
+
+unique_ptr<ostream> Executor::openOutputFile(const string& filename) const
+{
+  int rank = 0;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  if (rank == 0) {
+    unique_ptr<ostream> file(new ofstream(filename.c_str(), ios::out | ios::trunc));
+    if ( !*file ) {
+      getCout() << " ERROR: Can't open output file " << filename << endl;
+    }
+    return file;
+  }
+  return unique_ptr<ostream>(makeNullStream());
+}
+
+void Executor::writeTraceFile(const string& out_fprefix) const
+{
+  int rank = 0;
+  int num_ranks = 1;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+  const string filename = (num_ranks > 1)
+      ? out_fprefix + "-trace-" + std::to_string(rank) + ".json"
+      : out_fprefix + "-trace.json";
+  ofstream file(filename.c_str(), ios::out | ios::trunc);
+  if ( !file ) {
+    getCout() << " ERROR: Can't open output file " << filename << endl;
+    return;
+  }
+  detail::writeTrace(file, rank);
+}
+
+void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
+                              RunParams::CombinerOpt combiner, size_t prec)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    vector<std::vector<size_t>> vartuncol_width(variant_ids.size());
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      size_t var_width = max(prec+2, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        vartuncol_width[iv].emplace_back(max(var_width, tuning_name.size()));
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << getReportTitle(mode, combiner);
+
+    //
+    // Wrtie CSV file contents for report.
+    //
+
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
+        file << sepchr;
+      }
+    }
+    file << endl;
+
+    //
+    // Print column variant name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
+        file << sepchr <<left<< setw(vartuncol_width[iv][it])
+             << getVariantName(variant_ids[iv]);
+      }
+    }
+    file << endl;
+
+    //
+    // Print column tuning name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
+        file << sepchr <<left<< setw(vartuncol_width[iv][it])
+             << tuning_names[variant_ids[iv]][it];
+      }
+    }
+    file << endl;
+
+    //
+    // Print row of data for variants of each kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      file <<left<< setw(kercol_width) << kern->getName();
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
+          std::string const& tuning_name = tuning_names[variant_ids[iv]][it];
+          file << sepchr <<right<< setw(vartuncol_width[iv][it]);
+          const bool was_run =
+              kern->wasVariantTuningRun(vid, kern->getVariantTuningIndex(vid, tuning_name));
+          if ( (mode == CSVRepMode::Speedup) &&
+               (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
+                !kern->wasVariantTuningRun(reference_vid, reference_tune_idx) ||
+                !was_run) ) {
+            file << "Not run";
+          } else if ( (mode == CSVRepMode::Timing ||
+                       mode == CSVRepMode::IterationTiming) && !was_run ) {
+            file << "Not run";
+          } else if ( (mode == CSVRepMode::DeviceTiming) &&
+                      (!was_run || !isVariantGPU(vid)) ) {
+            file << "Not run";
+          } else if ( mode == CSVRepMode::Speedup &&
+                      !isSpeedupSignificant(kern, vid,
+                          kern->getVariantTuningIndex(vid, tuning_name)) ) {
+            ostringstream entry;
+            entry << setprecision(prec) << std::fixed
+                  << getReportDataEntry(mode, combiner, kern, vid,
+                         kern->getVariantTuningIndex(vid, tuning_name))
+                  << "*";
+            file << entry.str();
+          } else {
+            file << setprecision(prec) << std::fixed
+                 << getReportDataEntry(mode, combiner, kern, vid,
+                        kern->getVariantTuningIndex(vid, tuning_name));
+          }
+        }
+      }
+      file << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeFOMReport(ostream& file, vector<FOMGroup>& fom_groups)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+    size_t prec = 2;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t fom_col_width = prec+14;
+
+    std::vector<size_t> fom_group_ncols(fom_groups.size(), 0);
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      const FOMGroup& group = fom_groups[ifg];
+
+      for (size_t gv = 0; gv < group.variants.size(); ++gv) {
+        VariantID vid = group.variants[gv];
+        const string& variant_name = getVariantName(vid);
+        // num variants and tuning
+        // Includes the PM baseline and the variants and tunings to compared to it
+        fom_group_ncols[ifg] += tuning_names[vid].size();
+        for (const string& tuning_name : tuning_names[vid]) {
+          fom_col_width = max(fom_col_width, variant_name.size()+1+tuning_name.size());
+        }
+      }
+    }
+
+    vector< vector<int> > col_exec_count(fom_groups.size());
+    vector< vector<double> > col_min(fom_groups.size());
+    vector< vector<double> > col_max(fom_groups.size());
+    vector< vector<double> > col_avg(fom_groups.size());
+    vector< vector<double> > col_stddev(fom_groups.size());
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      col_exec_count[ifg].resize(fom_group_ncols[ifg], 0);
+      col_min[ifg].resize(fom_group_ncols[ifg], numeric_limits<double>::max());
+      col_max[ifg].resize(fom_group_ncols[ifg], -numeric_limits<double>::max());
+      col_avg[ifg].resize(fom_group_ncols[ifg], 0.0);
+      col_stddev[ifg].resize(fom_group_ncols[ifg], 0.0);
+    }
+    vector< vector< vector<double> > > pct_diff(kernels.size());
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      pct_diff[ik].resize(fom_groups.size());
+      for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+        pct_diff[ik][ifg].resize(fom_group_ncols[ifg], 0.0);
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << "FOM Report : signed speedup(-)/slowdown(+) for each PM (base vs. RAJA) -> (T_RAJA - T_base) / T_base )";
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      for (size_t iv = 0; iv < fom_group_ncols[ifg]*2; ++iv) {
+        file << sepchr;
+      }
+    }
+    file << endl;
+
+    file << "'OVER_TOL' in column to right if RAJA speedup is over tolerance";
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      for (size_t iv = 0; iv < fom_group_ncols[ifg]*2; ++iv) {
+        file << sepchr;
+      }
+    }
+    file << endl;
+
+    string pass(",        ");
+    string fail(",OVER_TOL");
+    string base(",base_ref");
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      const FOMGroup& group = fom_groups[ifg];
+      for (size_t gv = 0; gv < group.variants.size(); ++gv) {
+        VariantID vid = group.variants[gv];
+        string variant_name = getVariantName(vid);
+        for (const string& tuning_name : tuning_names[vid]) {
+          file << sepchr <<left<< setw(fom_col_width)
+               << (variant_name+"-"+tuning_name) << pass;
+        }
+      }
+    }
+    file << endl;
+
+
+    //
+    // Write CSV file contents for FOM report.
+    //
+
+    //
+    // Print row of FOM data for each kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      file <<left<< setw(kercol_width) << kern->getName();
+
+      for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+        const FOMGroup& group = fom_groups[ifg];
+
+        constexpr double unknown_totTime = -1.0;
+        double base_totTime = unknown_totTime;
+
+        size_t col = 0;
+        for (size_t gv = 0; gv < group.variants.size(); ++gv) {
+          VariantID vid = group.variants[gv];
+
+          for (const string& tuning_name : tuning_names[vid]) {
+
+            size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+
+            //
+            // If kernel variant was run, generate data for it and
+            // print (signed) percentage difference from baseline.
+            //
+            if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+              col_exec_count[ifg][col]++;
+
+              bool is_base = (base_totTime == unknown_totTime);
+              if (is_base) {
+                base_totTime = kern->getTotTime(vid, tune_idx);
+              }
+
+              pct_diff[ik][ifg][col] =
+                (kern->getTotTime(vid, tune_idx) - base_totTime) / base_totTime;
+
+              string pfstring(pass);
+              if (pct_diff[ik][ifg][col] > run_params.getPFTolerance()) {
+                pfstring = fail;
+              }
+              if (is_base) {
+                pfstring = base;
+              }
+
+              file << sepchr << setw(fom_col_width) << setprecision(prec)
+                   <<left<< pct_diff[ik][ifg][col] <<right<< pfstring;
+
+              //
+              // Gather data for column summaries (unsigned).
+              //
+              col_min[ifg][col] = min( col_min[ifg][col], pct_diff[ik][ifg][col] );
+              col_max[ifg][col] = max( col_max[ifg][col], pct_diff[ik][ifg][col] );
+              col_avg[ifg][col] += pct_diff[ik][ifg][col];
+
+            } else {  // variant was not run, print a big fat goose egg...
+
+              file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
+                   << 0.0 << pass;
+
+            }
+
+            col++;
+          }
+
+        }  // iterate over group variants
+
+      }  // iterate over fom_groups (i.e., columns)
+
+      file << endl;
+
+    } // iterate over kernels
+
+
+    //
+    // Compute column summary data.
+    //
+
+    // Column average...
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
+        if ( col_exec_count[ifg][col] > 0 ) {
+          col_avg[ifg][col] /= col_exec_count[ifg][col];
+        } else {
+          col_avg[ifg][col] = 0.0;
+        }
+      }
+    }
+
+    // Column standard deviation...
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+        const FOMGroup& group = fom_groups[ifg];
+
+        int col = 0;
+        for (size_t gv = 0; gv < group.variants.size(); ++gv) {
+          VariantID vid = group.variants[gv];
+
+          for (const string& tuning_name : tuning_names[vid]) {
+
+            size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+
+            if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+              col_stddev[ifg][col] += ( pct_diff[ik][ifg][col] - col_avg[ifg][col] ) *
+                                      ( pct_diff[ik][ifg][col] - col_avg[ifg][col] );
+            }
+
+            col++;
+          }
+
+        } // iterate over group variants
+
+      }  // iterate over groups
+
+    }  // iterate over kernels
+
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
+        if ( col_exec_count[ifg][col] > 0 ) {
+          col_stddev[ifg][col] /= col_exec_count[ifg][col];
+        } else {
+          col_stddev[ifg][col] = 0.0;
+        }
+      }
+    }
+
+    //
+    // Print column summaries.
+    //
+    file <<left<< setw(kercol_width) << " ";
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
+        file << sepchr << setw(fom_col_width) <<left<< "  " <<right<< pass;
+      }
+    }
+    file << endl;
+
+    file <<left<< setw(kercol_width) << "Col Min";
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
+        file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
+             << col_min[ifg][col] << pass;
+      }
+    }
+    file << endl;
+
+    file <<left<< setw(kercol_width) << "Col Max";
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
+        file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
+             << col_max[ifg][col] << pass;
+      }
+    }
+    file << endl;
+
+    file <<left<< setw(kercol_width) << "Col Avg";
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
+        file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
+             << col_avg[ifg][col] << pass;
+      }
+    }
+    file << endl;
+
+    file <<left<< setw(kercol_width) << "Col Std Dev";
+    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
+      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
+        file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
+             << col_stddev[ifg][col] << pass;
+      }
+    }
+    file << endl;
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeChecksumReport(ostream& file)
+{
+  if ( file ) {
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    int num_ranks;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string equal_line("===================================================================================================");
+    const string dash_line("----------------------------------------------------------------------------------------");
+    const string dash_line_short("-------------------------------------------------------");
+    string dot_line("........................................................");
+
+    size_t prec = 20;
+    size_t checksum_width = prec + 8;
+
+    size_t namecol_width = 0;
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      namecol_width = max(namecol_width, kernels[ik]->getName().size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        size_t var_width = getVariantName(variant_ids[iv]).size();
+        for (std::string const& tuning_name :
+             kernels[ik]->getVariantTuningNames(variant_ids[iv])) {
+          namecol_width = max(namecol_width, var_width+1+tuning_name.size());
+        }
+      }
+    }
+    namecol_width++;
+
+
+    //
+    // Print title.
+    //
+    file << equal_line << endl;
+    file << "Checksum Report ";
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    file << "for " << num_ranks << " MPI ranks ";
+#endif
+    file << endl;
+    file << equal_line << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(namecol_width) << "Kernel  " << endl;
+    file << dot_line << endl;
+    file <<left<< setw(namecol_width) << "Variants  "
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+         <<left<< setw(checksum_width) << "Average Checksum  "
+         <<left<< setw(checksum_width) << "Max Checksum Diff  "
+         <<left<< setw(checksum_width) << "Checksum Diff StdDev"
+#else
+         <<left<< setw(checksum_width) << "Checksum  "
+         <<left<< setw(checksum_width) << "Checksum Diff  "
+#endif
+         << endl;
+    file <<left<< setw(namecol_width) << "  "
+         <<left<< setw(checksum_width) << "  "
+         <<left<< setw(checksum_width) << "(vs. first variant listed)  "
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+         <<left<< setw(checksum_width) << ""
+#endif
+         << endl;
+    file << dash_line << endl;
+
+    //
+    // Print checksum and diff against baseline for each kernel variant.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      file <<left<< setw(namecol_width) << kern->getName() << endl;
+      file << dot_line << endl;
+
+      Checksum_type cksum_ref = 0.0;
+      size_t ivck = 0;
+      bool found_ref = false;
+      while ( ivck < variant_ids.size() && !found_ref ) {
+        VariantID vid = variant_ids[ivck];
+        size_t num_tunings = kern->getNumVariantTunings(vid);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+          if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+            cksum_ref = kern->getChecksum(vid, tune_idx);
+            found_ref = true;
+            break;
+          }
+        }
+        ++ivck;
+      }
+
+      // get vector of checksums and diffs
+      std::vector<std::vector<Checksum_type>> checksums(variant_ids.size());
+      std::vector<std::vector<Checksum_type>> checksums_diff(variant_ids.size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+
+        checksums[iv].resize(num_tunings, 0.0);
+        checksums_diff[iv].resize(num_tunings, 0.0);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+          if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+            checksums[iv][tune_idx] = kern->getChecksum(vid, tune_idx);
+            checksums_diff[iv][tune_idx] = cksum_ref - kern->getChecksum(vid, tune_idx);
+          }
+        }
+      }
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+      // get stats for checksums
+      std::vector<std::vector<Checksum_type>> checksums_sum(variant_ids.size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+        checksums_sum[iv].resize(num_tunings, 0.0);
+        Allreduce(checksums[iv].data(), checksums_sum[iv].data(), num_tunings,
+                  MPI_SUM, MPI_COMM_WORLD);
+      }
+
+      std::vector<std::vector<Checksum_type>> checksums_avg(variant_ids.size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+        checksums_avg[iv].resize(num_tunings, 0.0);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+          checksums_avg[iv][tune_idx] = checksums_sum[iv][tune_idx] / num_ranks;
+        }
+      }
+
+      // get stats for checksums_abs_diff
+      std::vector<std::vector<Checksum_type>> checksums_abs_diff(variant_ids.size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+        checksums_abs_diff[iv].resize(num_tunings, 0.0);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+          checksums_abs_diff[iv][tune_idx] = std::abs(checksums_diff[iv][tune_idx]);
+        }
+      }
+
+      std::vector<std::vector<Checksum_type>> checksums_abs_diff_min(variant_ids.size());
+      std::vector<std::vector<Checksum_type>> checksums_abs_diff_max(variant_ids.size());
+      std::vector<std::vector<Checksum_type>> checksums_abs_diff_sum(variant_ids.size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+        checksums_abs_diff_min[iv].resize(num_tunings, 0.0);
+        checksums_abs_diff_max[iv].resize(num_tunings, 0.0);
+        checksums_abs_diff_sum[iv].resize(num_tunings, 0.0);
+
+        Allreduce(checksums_abs_diff[iv].data(), checksums_abs_diff_min[iv].data(), num_tunings,
+                  MPI_MIN, MPI_COMM_WORLD);
+        Allreduce(checksums_abs_diff[iv].data(), checksums_abs_diff_max[iv].data(), num_tunings,
+                  MPI_MAX, MPI_COMM_WORLD);
+        Allreduce(checksums_abs_diff[iv].data(), checksums_abs_diff_sum[iv].data(), num_tunings,
+                  MPI_SUM, MPI_COMM_WORLD);
+      }
+
+      std::vector<std::vector<Checksum_type>> checksums_abs_diff_avg(variant_ids.size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+        checksums_abs_diff_avg[iv].resize(num_tunings, 0.0);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+          checksums_abs_diff_avg[iv][tune_idx] = checksums_abs_diff_sum[iv][tune_idx] / num_ranks;
+        }
+      }
+
+      std::vector<std::vector<Checksum_type>> checksums_abs_diff_diff2avg2(variant_ids.size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+        checksums_abs_diff_diff2avg2[iv].resize(num_tunings, 0.0);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+          checksums_abs_diff_diff2avg2[iv][tune_idx] = (checksums_abs_diff[iv][tune_idx] - checksums_abs_diff_avg[iv][tune_idx]) *
+                                                  (checksums_abs_diff[iv][tune_idx] - checksums_abs_diff_avg[iv][tune_idx]) ;
+        }
+      }
+
+      std::vector<std::vector<Checksum_type>> checksums_abs_diff_stddev(variant_ids.size());
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+        checksums_abs_diff_stddev[iv].resize(num_tunings, 0.0);
+        Allreduce(checksums_abs_diff_diff2avg2[iv].data(), checksums_abs_diff_stddev[iv].data(), num_tunings,
+                  MPI_SUM, MPI_COMM_WORLD);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+          checksums_abs_diff_stddev[iv][tune_idx] = std::sqrt(checksums_abs_diff_stddev[iv][tune_idx] / num_ranks);
+        }
+      }
+
+#endif
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        const string& variant_name = getVariantName(vid);
+
+        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+          const string& tuning_name = kern->getVariantTuningName(vid, tune_idx);
+
+          if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+            file <<left<< setw(namecol_width) << (variant_name+"-"+tuning_name)
+                 << showpoint << setprecision(prec)
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+                 <<left<< setw(checksum_width) << checksums_avg[iv][tune_idx]
+                 <<left<< setw(checksum_width) << checksums_abs_diff_max[iv][tune_idx]
+                 <<left<< setw(checksum_width) << checksums_abs_diff_stddev[iv][tune_idx] << endl;
+#else
+                 <<left<< setw(checksum_width) << checksums[iv][tune_idx]
+                 <<left<< setw(checksum_width) << checksums_diff[iv][tune_idx] << endl;
+#endif
+          } else {
+            file <<left<< setw(namecol_width) << (variant_name+"-"+tuning_name)
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+                 <<left<< setw(checksum_width) << "Not Run"
+                 <<left<< setw(checksum_width) << "Not Run"
+                 <<left<< setw(checksum_width) << "Not Run" << endl;
+#else
+                 <<left<< setw(checksum_width) << "Not Run"
+                 <<left<< setw(checksum_width) << "Not Run" << endl;
+#endif
+          }
+
+        }
+      }
+
+      file << endl;
+      file << dash_line_short << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeConfidenceIntervalReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 9;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const size_t data_width = prec + 4;
+
+    const vector<string> stat_col_names{ "Passes", "Mean", "StdDev",
+                                         "CI_Low", "CI_High", "CI_RelHalfWidth" };
+
+    //
+    // Print title line.
+    //
+    file << "Pass Time 95% Confidence Interval Report (sec.) ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel variant tuning that was run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          ConfidenceInterval ci =
+              computeConfidenceInterval(kern->getPassTimes(vid, tune_idx));
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << sepchr <<right<< setw(data_width) << ci.num
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(data_width) << ci.mean
+               << sepchr <<right<< setw(data_width) << ci.stddev
+               << sepchr <<right<< setw(data_width) << ci.lo
+               << sepchr <<right<< setw(data_width) << ci.hi
+               << setprecision(4)
+               << sepchr <<right<< setw(data_width) << ci.relHalfWidth()
+               << endl;
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeTopologyReport(ostream& file)
+{
+  if ( file ) {
+
+    const string sepchr(" , ");
+
+    //
+    // Print the placement of each rank, lists of cpus and nodes are in
+    // Linux cpu list form with ';' between ranges.
+    //
+    file << "Placement of " << topology_rows.size() << " ranks"
+         << " (NUMA nodes are -1 if not known)"
+         << " (Data NUMA Node -> node of a page touched by the rank)" << endl;
+    file << "Rank" << sepchr << "Host" << sepchr << "CPUs"
+         << sepchr << "CPU NUMA Nodes" << sepchr << "Data NUMA Node"
+         << sepchr << "Memory Policy" << sepchr << "GPU"
+         << sepchr << "GPU PCI Bus ID" << sepchr << "GPU NUMA Node"
+         << sepchr << "GPU Local CPUs" << sepchr << "NICs (device:node)" << endl;
+    for (const string& row : topology_rows) {
+      file << row << endl;
+    }
+
+    //
+    // Print the NUMA distances of the node of rank 0.
+    //
+    const vector<int> nodes = detail::getNumaNodes();
+    if ( !nodes.empty() ) {
+      file << endl;
+      file << "NUMA distances on " << rank_placement.host << endl;
+      file << "Node";
+      for (int node : nodes) {
+        file << sepchr << node;
+      }
+      file << endl;
+      for (int node : nodes) {
+        file << node;
+        for (int distance : detail::getNumaDistances(node)) {
+          file << sepchr << distance;
+        }
+        file << endl;
+      }
+    }
+
+    if ( !topology_warnings.empty() ) {
+      file << endl;
+      file << "Placement warnings" << endl;
+      for (const string& warning : topology_warnings) {
+        file << warning << endl;
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeTimingDistributionReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 9;
+    const size_t num_bins = run_params.getTimingHistBins();
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const size_t data_width = prec + 4;
+
+    const vector<string> stat_col_names{ "Reps/Sample", "Samples", "Ranks",
+                                         "First", "Mean", "StdDev", "Min",
+                                         "Median", "P90", "P99", "Max" };
+
+    int num_ranks = 1;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+
+    //
+    // Print title line.
+    //
+    file << "Timing Distribution Report (sec. per rep) ";
+    if ( num_ranks > 1 ) {
+      file << "(samples of all ranks pooled, First -> first sample of rank 0) ";
+    }
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    for (size_t ib = 0; ib < num_bins; ++ib) {
+      file << sepchr <<left<< setw(data_width) << ("Hist_" + to_string(ib));
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel variant tuning that was run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          vector<RAJA::Timer::ElapsedType> samples =
+              kern->getRepBatchTimes(vid, tune_idx);
+          if ( samples.empty() ) {
+            continue;
+          }
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+          // pool the samples of all ranks on rank 0, other ranks keep their
+          // own as their rows are not written
+          vector<RAJA::Timer::ElapsedType> all_samples =
+              gatherSamples(samples, MPI_COMM_WORLD);
+          if ( !all_samples.empty() ) {
+            samples.swap(all_samples);
+          }
+#endif
+
+          const size_t num_samples = samples.size();
+
+          vector<RAJA::Timer::ElapsedType> sorted(samples);
+          sort(sorted.begin(), sorted.end());
+
+          // nearest-rank percentile of sorted samples
+          auto percentile = [&](double pct) {
+            size_t rank = static_cast<size_t>(ceil(pct * num_samples));
+            rank = min(max(rank, static_cast<size_t>(1)), num_samples);
+            return sorted[rank-1];
+          };
+
+          long double mean = 0.0;
+          for (RAJA::Timer::ElapsedType sample : samples) {
+            mean += sample;
+          }
+          mean /= num_samples;
+
+          long double var = 0.0;
+          for (RAJA::Timer::ElapsedType sample : samples) {
+            var += (sample - mean) * (sample - mean);
+          }
+          if ( num_samples > 1 ) {
+            var /= (num_samples - 1);
+          }
+
+          const RAJA::Timer::ElapsedType min_sample = sorted.front();
+          const RAJA::Timer::ElapsedType max_sample = sorted.back();
+
+          vector<size_t> hist(num_bins, 0);
+          const RAJA::Timer::ElapsedType bin_width =
+              (max_sample - min_sample) / num_bins;
+          for (RAJA::Timer::ElapsedType sample : samples) {
+            size_t ib = 0;
+            if ( bin_width > 0.0 ) {
+              ib = static_cast<size_t>((sample - min_sample) / bin_width);
+            }
+            hist[min(ib, num_bins-1)]++;
+          }
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name;
+
+          file << sepchr <<right<< setw(data_width) << kern->getRepBatchSize()
+               << sepchr <<right<< setw(data_width) << num_samples
+               << sepchr <<right<< setw(data_width) << num_ranks;
+
+          file << setprecision(prec) << std::scientific;
+          file << sepchr <<right<< setw(data_width) << samples.front()
+               << sepchr <<right<< setw(data_width) << mean
+               << sepchr <<right<< setw(data_width) << sqrt(var)
+               << sepchr <<right<< setw(data_width) << min_sample
+               << sepchr <<right<< setw(data_width) << percentile(0.5)
+               << sepchr <<right<< setw(data_width) << percentile(0.9)
+               << sepchr <<right<< setw(data_width) << percentile(0.99)
+               << sepchr <<right<< setw(data_width) << max_sample;
+          file << std::defaultfloat;
+
+          for (size_t ib = 0; ib < num_bins; ++ib) {
+            file << sepchr <<right<< setw(data_width) << hist[ib];
+          }
+          file << endl;
+
+        }  // iterate over tunings
+
+      }  // iterate over variants
+
+    }  // iterate over kernels
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+string Executor::getRunDataMetadata() const
+{
+  ostringstream str;
+
+  char hostname[256] = {'\0'};
+  gethostname(hostname, sizeof(hostname)-1);
+
+  char date[64] = {'\0'};
+  time_t now = time(nullptr);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+  int num_ranks = 1;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+
+  const string gpu = getGPUModelName();
+  const std::pair<size_t, size_t> gpu_shmem = getGPUSharedMemSizes();
+
+  auto json_bool = [](bool val) { return val ? "true" : "false"; };
+
+  str << "{\"hostname\":" << jsonString(hostname)
+      << ",\"date\":" << jsonString(date)
+      << ",\"gpu\":" << jsonString(gpu)
+      << ",\"gpu_shmem_per_block\":" << gpu_shmem.first
+      << ",\"gpu_shmem_per_sm\":" << gpu_shmem.second
+      << ",\"mpi_ranks\":" << num_ranks
+      << ",\"mpi_scaling\":" << jsonString(RunParams::MPIScalingToStr(run_params.getMPIScaling()))
+      << ",\"npasses\":" << run_params.getNumPasses()
+      << ",\"random_order\":" << json_bool(run_params.getRandomOrder())
+      << ",\"random_order_seed\":" << random_order_seed
+      << ",\"host_timer\":" << jsonString(RunParams::HostTimerToStr(run_params.getHostTimer()))
+      << ",\"timer_overhead\":" << detail::getTimerOverhead()
+      << ",\"build\":{"
+      << "\"perfsuite_version\":" << jsonString(configuration::build_perfsuite_version)
+      << ",\"raja_version\":" << jsonString(configuration::build_raja_version)
+      << ",\"build_type\":" << jsonString(configuration::build_type)
+      << ",\"compiler\":" << jsonString(configuration::build_compiler)
+      << ",\"compiler_version\":" << jsonString(configuration::build_compiler_version)
+      << ",\"compiler_options\":" << jsonString(configuration::build_compiler_options)
+      << ",\"gpu_targets\":" << jsonString(configuration::build_gpu_targets)
+      << ",\"build_host\":" << jsonString(configuration::build_host)
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+      << ",\"openmp\":" << json_bool(true)
+#else
+      << ",\"openmp\":" << json_bool(false)
+#endif
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+      << ",\"openmp_target\":" << json_bool(true)
+#else
+      << ",\"openmp_target\":" << json_bool(false)
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+      << ",\"cuda\":" << json_bool(true)
+#else
+      << ",\"cuda\":" << json_bool(false)
+#endif
+#if defined(RAJA_ENABLE_HIP)
+      << ",\"hip\":" << json_bool(true)
+#else
+      << ",\"hip\":" << json_bool(false)
+#endif
+#if defined(RAJA_ENABLE_SYCL)
+      << ",\"sycl\":" << json_bool(true)
+#else
+      << ",\"sycl\":" << json_bool(false)
+#endif
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+      << ",\"mpi\":" << json_bool(true)
+#else
+      << ",\"mpi\":" << json_bool(false)
+#endif
+      << "}}";
+
+  return str.str();
+}
+
+void Executor::writeRunDataReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // One JSON object per line for each pass of each kernel variant tuning
+    // run, each carries the run metadata so lines can be loaded on their own.
+    //
+    const string metadata = getRunDataMetadata();
+
+    file << setprecision(17);
+
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          const size_t num_passes = kern->getPassTimes(vid, tune_idx).size();
+          for (size_t ip = 0; ip < num_passes; ++ip) {
+            writeRunDataRecord(file, kern, vid, tune_idx, ip, static_cast<int>(ip),
+                               kern->getChecksum(vid, tune_idx), metadata);
+          }
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeRunDataRecord(ostream& file, KernelBase* kern,
+                                  VariantID vid, size_t tune_idx, size_t ip,
+                                  int pass, Checksum_type checksum,
+                                  const string& metadata)
+{
+  const vector<RAJA::Timer::ElapsedType>& pass_times =
+      kern->getPassTimes(vid, tune_idx);
+  const vector<RAJA::Timer::ElapsedType>& pass_device_times =
+      kern->getPassDeviceTimes(vid, tune_idx);
+  const double block_size = kern->getTuningBlockSize(vid, tune_idx);
+
+  file << "{\"kernel\":" << jsonString(kern->getName())
+       << ",\"variant\":" << jsonString(getVariantName(vid))
+       << ",\"tuning\":" << jsonString(kern->getVariantTuningName(vid, tune_idx))
+       << ",\"pass\":" << pass
+       << ",\"time\":" << pass_times.at(ip);
+  if ( ip < pass_device_times.size() ) {
+    file << ",\"device_time\":" << pass_device_times[ip];
+  } else {
+    file << ",\"device_time\":null";
+  }
+  file << ",\"reps\":" << kern->getRunReps()
+       << ",\"problem_size\":" << kern->getActualProblemSize()
+       << ",\"iterations_per_rep\":" << kern->getItsPerRep()
+       << ",\"kernels_per_rep\":" << kern->getKernelsPerRep()
+       << ",\"bytes_per_rep\":" << kern->getBytesPerRep(vid, tune_idx)
+       << ",\"flops_per_rep\":" << kern->getFLOPsPerRep(vid, tune_idx);
+  if ( std::isnan(block_size) ) {
+    file << ",\"block_size\":null";
+  } else {
+    file << ",\"block_size\":" << block_size;
+  }
+  file << ",\"data_space\":" << jsonString(getDataSpaceName(kern->getDataSpace(vid)))
+       << ",\"checksum\":" << checksum
+       << ",\"run\":" << metadata
+       << "}" << endl;
+}
+
+/*
+ *******************************************************************************
+ *
+ * Get the peak GB/s and GFLOP/s of each variant and the best rate of each
+ * Stream_CACHE_BW cache level of each variant.
+ *
+ *******************************************************************************
+ */
+void Executor::getPeakRates(
+    vector<double>& peak_gbytes_per_sec,
+    vector<double>& peak_gflops_per_sec,
+    vector<vector<pair<string, double>>>& level_gbytes_per_sec,
+    bool& mem_peak_run, bool& fma_peak_run)
+{
+  auto get_time_per_rep = [&](KernelBase* kern, VariantID vid, size_t tune_idx) {
+    return kern->getMinTime(vid, tune_idx) / kern->getRunReps();
+  };
+  auto get_gbytes_per_sec = [&](KernelBase* kern, VariantID vid, size_t tune_idx) {
+    return kern->getBytesPerRep(vid, tune_idx) / get_time_per_rep(kern, vid, tune_idx) / 1.0e9;
+  };
+  auto get_gflops_per_sec = [&](KernelBase* kern, VariantID vid, size_t tune_idx) {
+    return kern->getFLOPsPerRep(vid, tune_idx) / get_time_per_rep(kern, vid, tune_idx) / 1.0e9;
+  };
+
+  //
+  // Use given peaks or best measured rates of each variant. The FLOP
+  // peak is the best rate of the Basic_FMA_PEAK tunings of Real_type
+  // when that kernel was run, and the bandwidth peak is the best rate of
+  // the mem tunings of Stream_CACHE_BW when that kernel was run.
+  //
+#if defined(RP_USE_DOUBLE)
+  const string fma_peak_type_prefix("fp64_");
+#else
+  const string fma_peak_type_prefix("fp32_");
+#endif
+  peak_gbytes_per_sec.assign(NumVariants, run_params.getPeakBandwidth());
+  peak_gflops_per_sec.assign(NumVariants, run_params.getPeakFLOPs());
+  vector<double> fma_peak_gflops_per_sec(NumVariants, 0.0);
+  vector<double> mem_peak_gbytes_per_sec(NumVariants, 0.0);
+  level_gbytes_per_sec.assign(NumVariants, vector<pair<string, double>>());
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+        if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+          continue;
+        }
+        if ( run_params.getPeakBandwidth() == 0.0 ) {
+          peak_gbytes_per_sec[vid] = max(peak_gbytes_per_sec[vid],
+                                         get_gbytes_per_sec(kern, vid, tune_idx));
+        }
+        if ( kern->getKernelID() == Stream_CACHE_BW ) {
+          const string level = stream::CACHE_BW::getLevelName(
+              kern->getVariantTuningName(vid, tune_idx));
+          const double gbytes_per_sec = get_gbytes_per_sec(kern, vid, tune_idx);
+          auto& levels = level_gbytes_per_sec[vid];
+          auto it = find_if(levels.begin(), levels.end(),
+                            [&](pair<string, double> const& l) { return l.first == level; });
+          if ( it == levels.end() ) {
+            levels.emplace_back(level, gbytes_per_sec);
+          } else {
+            it->second = max(it->second, gbytes_per_sec);
+          }
+          if ( level == "mem" ) {
+            mem_peak_gbytes_per_sec[vid] = max(mem_peak_gbytes_per_sec[vid],
+                                               gbytes_per_sec);
+          }
+        }
+        if ( run_params.getPeakFLOPs() == 0.0 ) {
+          peak_gflops_per_sec[vid] = max(peak_gflops_per_sec[vid],
+                                         get_gflops_per_sec(kern, vid, tune_idx));
+          if ( kern->getKernelID() == Basic_FMA_PEAK &&
+               kern->getVariantTuningName(vid, tune_idx).compare(
+                   0, fma_peak_type_prefix.size(), fma_peak_type_prefix) == 0 ) {
+            fma_peak_gflops_per_sec[vid] = max(fma_peak_gflops_per_sec[vid],
+                                               get_gflops_per_sec(kern, vid, tune_idx));
+          }
+        }
+      }
+    }
+  }
+  fma_peak_run = false;
+  mem_peak_run = false;
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    VariantID vid = variant_ids[iv];
+    if ( fma_peak_gflops_per_sec[vid] > 0.0 ) {
+      peak_gflops_per_sec[vid] = fma_peak_gflops_per_sec[vid];
+      fma_peak_run = true;
+    }
+    if ( run_params.getPeakBandwidth() == 0.0 &&
+         mem_peak_gbytes_per_sec[vid] > 0.0 ) {
+      peak_gbytes_per_sec[vid] = mem_peak_gbytes_per_sec[vid];
+      mem_peak_run = true;
+    }
+  }
+}
+
+void Executor::writeRooflineReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Achieved rates of a kernel variant tuning from its min time.
+    //
+    auto get_time_per_rep = [&](KernelBase* kern, VariantID vid, size_t tune_idx) {
+      return kern->getMinTime(vid, tune_idx) / kern->getRunReps();
+    };
+    auto get_gbytes_per_sec = [&](KernelBase* kern, VariantID vid, size_t tune_idx) {
+      return kern->getBytesPerRep(vid, tune_idx) / get_time_per_rep(kern, vid, tune_idx) / 1.0e9;
+    };
+    auto get_gflops_per_sec = [&](KernelBase* kern, VariantID vid, size_t tune_idx) {
+      return kern->getFLOPsPerRep(vid, tune_idx) / get_time_per_rep(kern, vid, tune_idx) / 1.0e9;
+    };
+    auto get_mits_per_sec = [&](KernelBase* kern, VariantID vid, size_t tune_idx) {
+      return kern->getItsPerRep() / get_time_per_rep(kern, vid, tune_idx) / 1.0e6;
+    };
+
+    //
+    // Use given peaks or best measured rates of each variant.
+    //
+    vector<double> peak_gbytes_per_sec;
+    vector<double> peak_gflops_per_sec;
+    // best rate of each cache level of Stream_CACHE_BW in level order
+    vector<vector<pair<string, double>>> level_gbytes_per_sec;
+    bool mem_peak_run = false;
+    bool fma_peak_run = false;
+    getPeakRates(peak_gbytes_per_sec, peak_gflops_per_sec,
+                 level_gbytes_per_sec, mem_peak_run, fma_peak_run);
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Time/rep", "Bytes/rep", "FLOPs/rep",
+                                         "FLOPs/Byte", "GB/s", "GFLOP/s",
+                                         "Mits/s", "% Peak GB/s", "% Peak GFLOP/s",
+                                         "% Roofline" };
+    size_t data_width = prec + 8;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Roofline Report (min time over passes, peaks are "
+         << ( run_params.getPeakBandwidth() > 0.0 ? "given" :
+              mem_peak_run ? "Stream_CACHE_BW mem" : "best measured" )
+         << " GB/s and "
+         << ( run_params.getPeakFLOPs() > 0.0 ? "given" :
+              fma_peak_run ? "Basic_FMA_PEAK" : "best measured" )
+         << " GFLOP/s) ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel variant tuning that was run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          const double time_per_rep = get_time_per_rep(kern, vid, tune_idx);
+          const double gbytes_per_sec = get_gbytes_per_sec(kern, vid, tune_idx);
+          const double gflops_per_sec = get_gflops_per_sec(kern, vid, tune_idx);
+          const double mits_per_sec = get_mits_per_sec(kern, vid, tune_idx);
+          const double intensity = kern->getBytesPerRep(vid, tune_idx) > 0
+              ? static_cast<double>(kern->getFLOPsPerRep(vid, tune_idx)) / kern->getBytesPerRep(vid, tune_idx)
+              : 0.0;
+
+          // attainable rate at kernel intensity is min(peak flops, intensity * peak bw)
+          const double bw_pct = peak_gbytes_per_sec[vid] > 0.0
+              ? 100.0 * gbytes_per_sec / peak_gbytes_per_sec[vid] : 0.0;
+          const double flops_pct = peak_gflops_per_sec[vid] > 0.0
+              ? 100.0 * gflops_per_sec / peak_gflops_per_sec[vid] : 0.0;
+          const double attainable_gflops_per_sec =
+              min(peak_gflops_per_sec[vid], intensity * peak_gbytes_per_sec[vid]);
+          const double roofline_pct = attainable_gflops_per_sec > 0.0
+              ? 100.0 * gflops_per_sec / attainable_gflops_per_sec
+              : bw_pct;
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << setprecision(prec) << std::scientific
+               << sepchr <<right<< setw(data_width) << time_per_rep
+               << sepchr <<right<< setw(data_width) << kern->getBytesPerRep(vid, tune_idx)
+               << sepchr <<right<< setw(data_width) << kern->getFLOPsPerRep(vid, tune_idx)
+               << setprecision(3) << std::fixed
+               << sepchr <<right<< setw(data_width) << intensity
+               << sepchr <<right<< setw(data_width) << gbytes_per_sec
+               << sepchr <<right<< setw(data_width) << gflops_per_sec
+               << sepchr <<right<< setw(data_width) << mits_per_sec
+               << setprecision(1)
+               << sepchr <<right<< setw(data_width) << bw_pct
+               << sepchr <<right<< setw(data_width) << flops_pct
+               << sepchr <<right<< setw(data_width) << roofline_pct
+               << endl;
+
+        }  // iterate over tunings
+
+      }  // iterate over variants
+
+    }  // iterate over kernels
+
+    //
+    // Print the bandwidth ceiling of each cache level of each variant, the
+    // best rate of the Stream_CACHE_BW tunings of the level.
+    //
+    bool have_levels = false;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      have_levels = have_levels || !level_gbytes_per_sec[variant_ids[iv]].empty();
+    }
+    if ( have_levels ) {
+
+      const string level_col_name("Level  ");
+      const string ceiling_col_name("Ceiling GB/s");
+
+      file << endl;
+      file << "Bandwidth Ceilings (best Stream_CACHE_BW rate of each level) " << endl;
+      file <<left<< setw(varcol_width) << variant_col_name
+           << sepchr <<left<< setw(tuncol_width) << level_col_name
+           << sepchr <<left<< setw(data_width) << ceiling_col_name << endl;
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (auto const& level : level_gbytes_per_sec[vid]) {
+          file <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << level.first
+               << setprecision(3) << std::fixed
+               << sepchr <<right<< setw(data_width) << level.second
+               << endl;
+        }
+      }
+
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writePatternReport(ostream& file)
+{
+  if ( file ) {
+
+    auto get_time_per_rep = [&](KernelBase* kern, VariantID vid, size_t tune_idx) {
+      return kern->getMinTime(vid, tune_idx) / kern->getRunReps();
+    };
+
+    //
+    // The machine balance of each variant is its peak GFLOP/s over its
+    // peak GB/s, kernels with fewer FLOPs/Byte than that are memory bound.
+    //
+    vector<double> peak_gbytes_per_sec;
+    vector<double> peak_gflops_per_sec;
+    vector<vector<pair<string, double>>> level_gbytes_per_sec;
+    bool mem_peak_run = false;
+    bool fma_peak_run = false;
+    getPeakRates(peak_gbytes_per_sec, peak_gflops_per_sec,
+                 level_gbytes_per_sec, mem_peak_run, fma_peak_run);
+
+    auto get_balance = [&](VariantID vid, double bytes, double flops) {
+      if ( peak_gbytes_per_sec[vid] <= 0.0 || peak_gflops_per_sec[vid] <= 0.0 ) {
+        return string("unknown");
+      }
+      const double machine_balance = peak_gflops_per_sec[vid] / peak_gbytes_per_sec[vid];
+      return ( bytes > 0.0 && flops / bytes < machine_balance )
+             ? string("memory") : string("compute");
+    };
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string pattern_col_name("Pattern  ");
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 6;
+
+    size_t patcol_width = pattern_col_name.size();
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t pid = 0; pid < NumPatterns; ++pid) {
+      patcol_width = max(patcol_width, getPatternName(static_cast<PatternID>(pid)).size());
+    }
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    patcol_width++;
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Time/rep", "Bytes/rep", "FLOPs/rep",
+                                         "FLOPs/Byte", "GB/s", "GFLOP/s",
+                                         "Balance" };
+    size_t data_width = prec + 8;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Totals of the kernel tunings run of each pattern and variant.
+    //
+    struct PatternTotals
+    {
+      size_t num_tunings = 0;
+      double time_per_rep = 0.0;
+      double bytes_per_rep = 0.0;
+      double flops_per_rep = 0.0;
+    };
+    vector<vector<PatternTotals>> totals(NumPatterns,
+                                         vector<PatternTotals>(NumVariants));
+
+    auto print_row = [&](double time_per_rep, double bytes, double flops,
+                         VariantID vid) {
+      const double intensity = bytes > 0.0 ? flops / bytes : 0.0;
+      file << setprecision(prec) << std::scientific
+           << sepchr <<right<< setw(data_width) << time_per_rep
+           << sepchr <<right<< setw(data_width) << bytes
+           << sepchr <<right<< setw(data_width) << flops
+           << setprecision(3) << std::fixed
+           << sepchr <<right<< setw(data_width) << intensity
+           << sepchr <<right<< setw(data_width) << bytes / time_per_rep / 1.0e9
+           << sepchr <<right<< setw(data_width) << flops / time_per_rep / 1.0e9
+           << sepchr <<right<< setw(data_width) << get_balance(vid, bytes, flops)
+           << endl;
+    };
+
+    //
+    // Print title line.
+    //
+    file << "Access Pattern Report (min time over passes, balance is memory "
+            "when FLOPs/Byte is less than peak GFLOP/s over peak GB/s) ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(patcol_width) << pattern_col_name
+         << sepchr <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel variant tuning that was run under
+    // each pattern of the kernel.
+    //
+    for (size_t pid = 0; pid < NumPatterns; ++pid) {
+      PatternID tpid = static_cast<PatternID>(pid);
+
+      for (size_t ik = 0; ik < kernels.size(); ++ik) {
+        KernelBase* kern = kernels[ik];
+        if ( !kern->hasPattern(tpid) ) {
+          continue;
+        }
+
+        for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+          VariantID vid = variant_ids[iv];
+
+          for (std::string const& tuning_name : tuning_names[vid]) {
+
+            if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+              continue;
+            }
+            size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+            if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+              continue;
+            }
+
+            const double time_per_rep = get_time_per_rep(kern, vid, tune_idx);
+            const double bytes = kern->getBytesPerRep(vid, tune_idx);
+            const double flops = kern->getFLOPsPerRep(vid, tune_idx);
+
+            PatternTotals& total = totals[pid][vid];
+            total.num_tunings += 1;
+            total.time_per_rep += time_per_rep;
+            total.bytes_per_rep += bytes;
+            total.flops_per_rep += flops;
+
+            file <<left<< setw(patcol_width) << getPatternName(tpid)
+                 << sepchr <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width) << tuning_name;
+            print_row(time_per_rep, bytes, flops, vid);
+
+          }  // iterate over tunings
+
+        }  // iterate over variants
+
+      }  // iterate over kernels
+
+    }  // iterate over patterns
+
+    //
+    // Print the totals of each pattern and variant, the rates and balance
+    // of running all its kernel tunings one after the other.
+    //
+    const string count_col_name("Tunings  ");
+
+    file << endl;
+    file << "Pattern Summary (sums over kernel tunings run) " << endl;
+    file <<left<< setw(patcol_width) << pattern_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << count_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    for (size_t pid = 0; pid < NumPatterns; ++pid) {
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        PatternTotals const& total = totals[pid][vid];
+        if ( total.num_tunings == 0 ) {
+          continue;
+        }
+        file <<left<< setw(patcol_width) << getPatternName(static_cast<PatternID>(pid))
+             << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+             << sepchr <<right<< setw(tuncol_width) << total.num_tunings;
+        print_row(total.time_per_rep, total.bytes_per_rep,
+                  total.flops_per_rep, vid);
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeCountersReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 1;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    vector<string> stat_col_names{ "Bytes/rep" };
+    for (string const& event_name : run_params.getPapiEvents()) {
+      stat_col_names.push_back(event_name);
+    }
+    size_t data_width = 16;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Hardware Counters Report (counts per rep) ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel variant tuning that was run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << sepchr <<right<< setw(data_width) << kern->getBytesPerRep(vid, tune_idx)
+               << setprecision(prec) << std::fixed;
+          for (double counter : kern->getAvgCountersPerRep(vid, tune_idx)) {
+            file << sepchr <<right<< setw(data_width) << counter;
+          }
+          file << endl;
+
+        }  // iterate over tunings
+
+      }  // iterate over variants
+
+    }  // iterate over kernels
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeSizeSweepReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Rows of each kernel variant tuning are together, ordered by size.
+    //
+    vector<SizeSweepResult> results(size_sweep_results);
+    std::stable_sort(results.begin(), results.end(),
+                     [](const SizeSweepResult& lhs, const SizeSweepResult& rhs) {
+      return std::tie(lhs.kernel_name, lhs.vid, lhs.tuning_name) <
+             std::tie(rhs.kernel_name, rhs.vid, rhs.tuning_name);
+    });
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (const SizeSweepResult& result : results) {
+      kercol_width = max(kercol_width, result.kernel_name.size());
+      varcol_width = max(varcol_width, getVariantName(result.vid).size());
+      tuncol_width = max(tuncol_width, result.tuning_name.size());
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Problem size", "Footprint (bytes)",
+                                         "Time/rep (sec.)", "GB/s", "GFLOP/s" };
+    size_t data_width = 16;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Size Sweep Report (min time per rep over passes at each size)";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each size of each kernel variant tuning.
+    //
+    for (const SizeSweepResult& result : results) {
+      const double gbytes_per_sec = result.time_per_rep > 0.0 ?
+          result.bytes_per_rep / result.time_per_rep * 1.0e-9 : 0.0;
+      const double gflops_per_sec = result.time_per_rep > 0.0 ?
+          result.flops_per_rep / result.time_per_rep * 1.0e-9 : 0.0;
+
+      file <<left<< setw(kercol_width) << result.kernel_name
+           << sepchr <<left<< setw(varcol_width) << getVariantName(result.vid)
+           << sepchr <<left<< setw(tuncol_width) << result.tuning_name
+           << sepchr <<right<< setw(data_width) << result.problem_size
+           << sepchr <<right<< setw(data_width) << result.footprint
+           << setprecision(9) << std::scientific
+           << sepchr <<right<< setw(data_width) << result.time_per_rep
+           << setprecision(3) << std::fixed
+           << sepchr <<right<< setw(data_width) << gbytes_per_sec
+           << sepchr <<right<< setw(data_width) << gflops_per_sec
+           << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeMemoryFitReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    for (const MemoryFitResult& result : memory_fit_results) {
+      kercol_width = max(kercol_width, result.kernel_name.size());
+    }
+    kercol_width++;
+
+    const vector<string> stat_col_names{ "Requested size", "Run size",
+                                         "Requested bytes", "Run bytes",
+                                         "Budget bytes", "Action" };
+    size_t data_width = 16;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Memory Fit Report (" << RunParams::MemoryFitToStr(run_params.getMemoryFit())
+         << " kernels over " << run_params.getMemoryFraction()
+         << " of memory) (bytes -> estimated from bytes touched per rep)";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel made, in suite order.
+    //
+    for (const MemoryFitResult& result : memory_fit_results) {
+      file <<left<< setw(kercol_width) << result.kernel_name
+           << sepchr <<right<< setw(data_width) << result.requested_size
+           << sepchr <<right<< setw(data_width) << result.run_size
+           << setprecision(0) << std::fixed
+           << sepchr <<right<< setw(data_width) << result.requested_bytes
+           << sepchr <<right<< setw(data_width) << result.run_bytes
+           << sepchr <<right<< setw(data_width) << result.budget_bytes
+           << sepchr <<right<< setw(data_width) << result.action
+           << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+//
+// Scaling of each kernel variant tuning over the runs of a scaling series,
+// the runs given with '--scaling-series' and this run, ordered by number of
+// ranks. Speedup and efficiency are relative to the run with the fewest
+// ranks, for strong scaling efficiency is t0*p0 / (t*p) and for weak
+// scaling it is t0 / t, where the speedup is the scaled speedup.
+//
+void Executor::writeMPIScalingReport(ostream& file)
+{
+  if ( file ) {
+
+    const bool strong =
+        run_params.getMPIScaling() == RunParams::StrongScaling;
+
+    int num_ranks = 1;
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 9;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (std::string const& tuning_name : kern->getVariantTuningNames(vid)) {
+          tuncol_width = max(tuncol_width, tuning_name.size());
+        }
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Ranks", "Size/Rank", "Min Time/Rep",
+                                         "Speedup", "Efficiency" };
+    size_t data_width = prec + 8;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+
+    //
+    // Print title line.
+    //
+    file << "MPI Scaling Report (" << RunParams::MPIScalingToStr(run_params.getMPIScaling())
+         << " scaling, sec.) ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each run of the series of each variant tuning
+    // run in this run.
+    //
+    for (KernelBase* kern : kernels) {
+      const double reps = static_cast<double>(kern->getRunReps());
+      for (VariantID vid : variant_ids) {
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          const string& tuning_name = kern->getVariantTuningName(vid, tune_idx);
+          vector<ScalingPoint> points;
+          auto iter = scaling_series.find(
+              std::make_tuple(kern->getName(), getVariantName(vid), tuning_name));
+          if ( iter != scaling_series.end() ) {
+            points = iter->second;
+          }
+          points.push_back(ScalingPoint{num_ranks, kern->getActualProblemSize(),
+                                        kern->getMinTime(vid, tune_idx) / reps});
+          std::stable_sort(points.begin(), points.end(),
+                           [](const ScalingPoint& lhs, const ScalingPoint& rhs) {
+            return lhs.num_ranks < rhs.num_ranks;
+          });
+
+          const ScalingPoint& first = points.front();
+          for (const ScalingPoint& point : points) {
+            const double speedup = point.time_per_rep > 0.0 ?
+                first.time_per_rep / point.time_per_rep : 0.0;
+            const double rank_ratio =
+                static_cast<double>(point.num_ranks) / first.num_ranks;
+            const double efficiency = strong ? speedup / rank_ratio : speedup;
+
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width) << tuning_name
+                 << sepchr <<right<< setw(data_width) << point.num_ranks
+                 << sepchr <<right<< setw(data_width) << point.problem_size
+                 << setprecision(prec) << std::fixed
+                 << sepchr <<right<< setw(data_width) << point.time_per_rep
+                 << setprecision(3)
+                 << sepchr <<right<< setw(data_width)
+                 << (strong ? speedup : speedup * rank_ratio)
+                 << sepchr <<right<< setw(data_width) << efficiency
+                 << endl;
+          }
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeBytesValidationReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Index of each DRAM byte event in the counted PAPI events.
+    //
+    const vector<string>& papi_events = run_params.getPapiEvents();
+    const vector<string>& bytes_events = run_params.getBytesEvents();
+    const vector<double>& bytes_event_scales = run_params.getBytesEventScales();
+    vector<size_t> bytes_event_idx;
+    for (const string& event : bytes_events) {
+      bytes_event_idx.push_back(
+          std::find(papi_events.begin(), papi_events.end(), event) - papi_events.begin());
+    }
+    const double tol = run_params.getBytesTolerance();
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Declared Bytes/rep",
+                                         "Measured Bytes/rep",
+                                         "Ratio", "Status" };
+    size_t data_width = 16;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Bytes Validation Report (declared / measured DRAM bytes per rep, "
+         << "OK within 1 +/- " << tol << ")";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel variant tuning that was run.
+    //
+    size_t num_flagged = 0;
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          const vector<double> counters = kern->getAvgCountersPerRep(vid, tune_idx);
+          double measured = 0.0;
+          for (size_t ie = 0; ie < bytes_event_idx.size(); ++ie) {
+            if ( bytes_event_idx[ie] < counters.size() ) {
+              measured += counters[bytes_event_idx[ie]] * bytes_event_scales[ie];
+            }
+          }
+          const double declared = kern->getBytesPerRep(vid, tune_idx);
+
+          // declared above measured usually means reuse in cache the byte
+          // formula does not model, below measured means traffic it misses
+          string status("NOT_MEASURED");
+          double ratio = 0.0;
+          if ( measured > 0.0 ) {
+            ratio = declared / measured;
+            if ( ratio > 1.0 + tol ) {
+              status = "OVER_DECLARED";
+            } else if ( ratio < 1.0 - tol ) {
+              status = "UNDER_DECLARED";
+            } else {
+              status = "OK";
+            }
+          }
+          if ( status != "OK" ) {
+            ++num_flagged;
+          }
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << setprecision(0) << std::fixed
+               << sepchr <<right<< setw(data_width) << declared
+               << sepchr <<right<< setw(data_width) << measured
+               << setprecision(3)
+               << sepchr <<right<< setw(data_width) << ratio
+               << sepchr <<right<< setw(data_width) << status
+               << endl;
+
+        }  // iterate over tunings
+
+      }  // iterate over variants
+
+    }  // iterate over kernels
+
+    getCout() << "\n " << num_flagged
+              << " kernel variant tunings with declared bytes outside the"
+              << " measured bytes band, see bytes validation file" << endl;
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+void Executor::writeRankTimingReport(ostream& file)
+{
+  if ( file ) {
+
+    int num_ranks = 1;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    // count nodes as the ranks that are first on their shared memory node
+    int num_nodes = 1;
+    {
+      MPI_Comm node_comm;
+      MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+                          MPI_INFO_NULL, &node_comm);
+      int node_rank = 0;
+      MPI_Comm_rank(node_comm, &node_rank);
+      MPI_Comm_free(&node_comm);
+      int is_first_on_node = (node_rank == 0) ? 1 : 0;
+      MPI_Allreduce(&is_first_on_node, &num_nodes, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    }
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 9;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Min", "Max", "Mean", "Imbalance",
+                                         "Job GB/s", "Node GB/s" };
+    size_t data_width = prec + 8;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Runtime per Rep across " << num_ranks << " MPI ranks on "
+         << num_nodes << " nodes (sec.) (Imbalance -> Max/Mean)";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel variant tuning that was run,
+    // every rank runs the same kernels so the reductions match.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          const double time = kern->getTotTime(vid, tune_idx) /
+              kern->getPassTimes(vid, tune_idx).size() / kern->getRunReps();
+          const double bytes = kern->getBytesPerRep(vid, tune_idx);
+
+          double min_time = 0.0;
+          double max_time = 0.0;
+          double sum_time = 0.0;
+          double sum_bytes = 0.0;
+          MPI_Allreduce(&time, &min_time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+          MPI_Allreduce(&time, &max_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+          MPI_Allreduce(&time, &sum_time, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+          MPI_Allreduce(&bytes, &sum_bytes, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+          const double mean_time = sum_time / num_ranks;
+          const double imbalance = mean_time > 0.0 ? max_time / mean_time : 0.0;
+          // ranks sync around the timed region so the slowest rank bounds
+          // the time of the job
+          const double job_gbs = max_time > 0.0 ? sum_bytes / max_time * 1.0e-9 : 0.0;
+          const double node_gbs = job_gbs / num_nodes;
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(data_width) << min_time
+               << sepchr <<right<< setw(data_width) << max_time
+               << sepchr <<right<< setw(data_width) << mean_time
+               << setprecision(3)
+               << sepchr <<right<< setw(data_width) << imbalance
+               << sepchr <<right<< setw(data_width) << job_gbs
+               << sepchr <<right<< setw(data_width) << node_gbs
+               << endl;
+
+        }  // iterate over tunings
+
+      }  // iterate over variants
+
+    }  // iterate over kernels
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeGPUSharingReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Group the ranks that share a GPU by splitting the ranks on each shared
+    // memory node by the device they are bound to.
+    //
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+                        MPI_INFO_NULL, &node_comm);
+    MPI_Comm gpu_comm;
+    MPI_Comm_split(node_comm, detail::getGPUDevice(), 0, &gpu_comm);
+    MPI_Comm_free(&node_comm);
+
+    int gpu_rank = 0;
+    int num_gpu_ranks = 1;
+    MPI_Comm_rank(gpu_comm, &gpu_rank);
+    MPI_Comm_size(gpu_comm, &num_gpu_ranks);
+
+    // count GPUs as the ranks that are first on their GPU
+    const int is_first_on_gpu = (gpu_rank == 0) ? 1 : 0;
+    int num_gpus = 1;
+    MPI_Allreduce(&is_first_on_gpu, &num_gpus, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    int max_gpu_ranks = 1;
+    MPI_Allreduce(&num_gpu_ranks, &max_gpu_ranks, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 3;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Rank Min", "Rank Max", "Rank Mean",
+                                         "GPU Mean", "Job", "Spread",
+                                         "Fairness" };
+    size_t data_width = prec + 12;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Throughput of " << max_gpu_ranks << " MPI ranks per GPU on "
+         << num_gpus << " GPUs (M iterations/sec.)"
+         << " (GPU Mean -> mean over GPUs of the sum over ranks sharing a GPU)"
+         << " (Spread -> largest Max/Min over ranks sharing a GPU)"
+         << " (Fairness -> smallest Jain index over ranks sharing a GPU)";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each GPU kernel variant tuning that was run,
+    // every rank runs the same kernels so the reductions match.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        if ( !isVariantGPU(vid) ) {
+          continue;
+        }
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          const double time = kern->getTotTime(vid, tune_idx) /
+              kern->getPassTimes(vid, tune_idx).size() / kern->getRunReps();
+          const double rate = time > 0.0 ?
+              kern->getItsPerRep() / time * 1.0e-6 : 0.0;
+
+          // reduce over the ranks sharing this GPU
+          double gpu_min = 0.0;
+          double gpu_max = 0.0;
+          double gpu_sum = 0.0;
+          double gpu_sum_sq = 0.0;
+          const double rate_sq = rate * rate;
+          MPI_Allreduce(&rate, &gpu_min, 1, MPI_DOUBLE, MPI_MIN, gpu_comm);
+          MPI_Allreduce(&rate, &gpu_max, 1, MPI_DOUBLE, MPI_MAX, gpu_comm);
+          MPI_Allreduce(&rate, &gpu_sum, 1, MPI_DOUBLE, MPI_SUM, gpu_comm);
+          MPI_Allreduce(&rate_sq, &gpu_sum_sq, 1, MPI_DOUBLE, MPI_SUM, gpu_comm);
+
+          const double spread = gpu_min > 0.0 ? gpu_max / gpu_min : 0.0;
+          const double fairness = gpu_sum_sq > 0.0 ?
+              gpu_sum * gpu_sum / (num_gpu_ranks * gpu_sum_sq) : 0.0;
+
+          // reduce over all ranks, and over GPUs using the first rank on each
+          double min_rate = 0.0;
+          double max_rate = 0.0;
+          double sum_rate = 0.0;
+          MPI_Allreduce(&rate, &min_rate, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+          MPI_Allreduce(&rate, &max_rate, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+          MPI_Allreduce(&rate, &sum_rate, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+          double max_spread = 0.0;
+          double min_fairness = 0.0;
+          MPI_Allreduce(&spread, &max_spread, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+          MPI_Allreduce(&fairness, &min_fairness, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+
+          int num_ranks = 1;
+          MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+          const double mean_rate = sum_rate / num_ranks;
+          const double gpu_mean = sum_rate / num_gpus;
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(data_width) << min_rate
+               << sepchr <<right<< setw(data_width) << max_rate
+               << sepchr <<right<< setw(data_width) << mean_rate
+               << sepchr <<right<< setw(data_width) << gpu_mean
+               << sepchr <<right<< setw(data_width) << sum_rate
+               << sepchr <<right<< setw(data_width) << max_spread
+               << sepchr <<right<< setw(data_width) << min_fairness
+               << endl;
+
+        }  // iterate over tunings
+
+      }  // iterate over variants
+
+    }  // iterate over kernels
+
+    MPI_Comm_free(&gpu_comm);
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+#endif
+
+
+void Executor::writeEnergyReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    vector<string> stat_col_names{ "Joules/rep", "Watts", "GFLOP/s/Watt" };
+    for (string const& meter_name : detail::getEnergyMeterNames()) {
+      stat_col_names.push_back(meter_name + " Joules/rep");
+    }
+    size_t data_width = 16;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Energy Report (joules per rep, average power, and GFLOP/s per watt) ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel variant tuning that was run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          const vector<double> meter_joules = kern->getAvgEnergyPerRep(vid, tune_idx);
+          double joules = 0.0;
+          for (double meter_joule : meter_joules) {
+            joules += meter_joule;
+          }
+          const double time_per_rep = kern->getTotTime(vid, tune_idx) /
+              kern->getPassTimes(vid, tune_idx).size() / kern->getRunReps();
+          const double watts = time_per_rep > 0.0 ? joules / time_per_rep : 0.0;
+          // flop/joule is the same as flop/s/watt
+          const double gflops_per_watt = joules > 0.0 ?
+              kern->getFLOPsPerRep(vid, tune_idx) / joules * 1.0e-9 : 0.0;
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(data_width) << joules
+               << sepchr <<right<< setw(data_width) << watts
+               << sepchr <<right<< setw(data_width) << gflops_per_watt;
+          for (double meter_joule : meter_joules) {
+            file << sepchr <<right<< setw(data_width) << meter_joule;
+          }
+          file << endl;
+
+        }  // iterate over tunings
+
+      }  // iterate over variants
+
+    }  // iterate over kernels
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writePhaseTimingReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string phase_col_name("Phase  ");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    size_t phasecol_width = phase_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+      for (string const& phase_name : kernels[ik]->getPhaseNames()) {
+        phasecol_width = max(phasecol_width, phase_name.size());
+      }
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+    phasecol_width++;
+
+    vector<string> stat_col_names{ "Time (sec)", "% of kernel time" };
+    size_t data_width = 16;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Phase Timing Report (average time per pass) ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name
+         << sepchr <<left<< setw(phasecol_width) << phase_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each phase of each kernel variant tuning
+    // that was run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      const vector<string>& phase_names = kern->getPhaseNames();
+      if ( phase_names.empty() ) {
+        continue;
+      }
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          const double kernel_time =
+              kern->getTotTime(vid, tune_idx) / kern->getPassTimes(vid, tune_idx).size();
+          vector<double> phase_times = kern->getAvgPhaseTimes(vid, tune_idx);
+
+          for (size_t ip = 0; ip < phase_names.size(); ++ip) {
+            double phase_time = ip < phase_times.size() ? phase_times[ip] : 0.0;
+            double phase_pct = kernel_time > 0.0
+                             ? 100.0 * phase_time / kernel_time : 0.0;
+
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width) << tuning_name
+                 << sepchr <<left<< setw(phasecol_width) << phase_names[ip]
+                 << setprecision(8) << std::fixed
+                 << sepchr <<right<< setw(data_width) << phase_time
+                 << setprecision(1) << std::fixed
+                 << sepchr <<right<< setw(data_width) << phase_pct
+                 << endl;
+          }
+
+        }  // iterate over tunings
+
+      }  // iterate over variants
+
+    }  // iterate over kernels
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeMetricsReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string metric_col_name("Metric  ");
+    const string value_col_name("Value");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    size_t metriccol_width = metric_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+      for (string const& metric_name : kernels[ik]->getMetricNames()) {
+        metriccol_width = max(metriccol_width, metric_name.size());
+      }
+    }
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+    metriccol_width++;
+
+    const size_t data_width = max(size_t(16), value_col_name.size()) + 1;
+
+    //
+    // Print title line.
+    //
+    file << "Kernel Metrics Report ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name
+         << sepchr <<left<< setw(metriccol_width) << metric_col_name
+         << sepchr <<left<< setw(data_width) << value_col_name
+         << endl;
+
+    //
+    // Print row of data for each metric of each kernel variant tuning
+    // that was run and measured them.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      const vector<string>& metric_names = kern->getMetricNames();
+      if ( metric_names.empty() ) {
+        continue;
+      }
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          vector<double> metrics = kern->getMetrics(vid, tune_idx);
+
+          for (size_t im = 0; im < std::min(metrics.size(), metric_names.size()); ++im) {
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width) << tuning_name
+                 << sepchr <<left<< setw(metriccol_width) << metric_names[im]
+                 << setprecision(8) << std::defaultfloat
+                 << sepchr <<right<< setw(data_width) << metrics[im]
+                 << endl;
+          }
+
+        }  // iterate over tunings
+
+      }  // iterate over variants
+
+    }  // iterate over kernels
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeDataPoolReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string space_col_name("Data Space  ");
+    const string sepchr(" , ");
+
+    size_t spacecol_width = space_col_name.size();
+    for (int ids = 0; ids < static_cast<int>(DataSpace::NumSpaces); ++ids) {
+      spacecol_width = max(spacecol_width,
+                           getDataSpaceName(static_cast<DataSpace>(ids)).size());
+    }
+    spacecol_width++;
+
+    const vector<string> stat_col_names{ "Allocs", "Reused",
+                                         "Peak In Use (bytes)",
+                                         "Peak Held (bytes)" };
+    size_t data_width = 0;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+    data_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Data Pool Report ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(spacecol_width) << space_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each data space that was allocated from.
+    //
+    for (int ids = 0; ids < static_cast<int>(DataSpace::NumSpaces); ++ids) {
+      DataSpace ds = static_cast<DataSpace>(ids);
+
+      detail::DataPoolStats stats = detail::getDataPoolStats(ds);
+      if ( stats.num_allocs == 0 ) {
+        continue;
+      }
+
+      file <<left<< setw(spacecol_width) << getDataSpaceName(ds)
+           << sepchr <<right<< setw(data_width) << stats.num_allocs
+           << sepchr <<right<< setw(data_width) << stats.num_reused
+           << sepchr <<right<< setw(data_width) << stats.peak_in_use_bytes
+           << sepchr <<right<< setw(data_width) << stats.peak_held_bytes
+           << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+//
+// The tuning database read with '--tuning-db' updated with the fastest
+// tuning of each kernel variant and data type that ran more than one
+// tuning, in the format read by readTuningDBFile.
+//
+void Executor::writeTuningDBReport(ostream& file)
+{
+  if ( file ) {
+
+    map<TuningDBKey, TuningDBEntry> db(tuning_db);
+
+    for (KernelBase* kern : kernels) {
+      const double reps = static_cast<double>(kern->getRunReps());
+      for (VariantID vid : variant_ids) {
+
+        map<TuningDBKey, pair<size_t, TuningDBEntry>> run_best;
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+          const double time_per_rep = kern->getMinTime(vid, tune_idx) / reps;
+          const TuningDBKey key = getTuningDBKey(kern, vid, tune_idx);
+          auto iter = run_best.find(key);
+          if ( iter == run_best.end() ) {
+            run_best.emplace(key, make_pair(size_t(1), TuningDBEntry{
+                kern->getVariantTuningName(vid, tune_idx), time_per_rep}));
+          } else {
+            iter->second.first += 1;
+            if ( time_per_rep < iter->second.second.time_per_rep ) {
+              iter->second.second = TuningDBEntry{
+                  kern->getVariantTuningName(vid, tune_idx), time_per_rep};
+            }
+          }
+        }
+
+        for (auto const& best : run_best) {
+          if ( best.second.first > 1 ) {
+            db[best.first] = best.second.second;
+          }
+        }
+      }
+    }
+
+    file << "# kernel variant data_type size_bucket gpu_model best_tuning time_per_rep" << endl;
+    file << setprecision(9) << std::scientific;
+    for (auto const& entry : db) {
+      file << std::get<0>(entry.first)
+           << " " << std::get<1>(entry.first)
+           << " " << std::get<2>(entry.first)
+           << " " << std::get<3>(entry.first)
+           << " " << std::get<4>(entry.first)
+           << " " << entry.second.tuning_name
+           << " " << entry.second.time_per_rep << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeAutotuneReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Written as a tuning file so later runs can use it with --tuning-file.
+    //
+    file << "# Autotuned tunings : Kernel Variant Tuning" << endl;
+    file << "# Load with --tuning-file to run only these tunings" << endl;
+
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        auto kern_tunings = kernel_tuning_names.find({kern->getName(), vid});
+        if ( kern_tunings == kernel_tuning_names.end() ) {
+          continue;
+        }
+        for (string const& tuning_name : kern_tunings->second) {
+          file << kern->getName() << " " << getVariantName(vid) << " "
+               << tuning_name;
+          for (AutotuneResult const& result : autotune_results) {
+            if ( result.kernel_name == kern->getName() &&
+                 result.vid == vid && result.tuning_name == tuning_name ) {
+              file << " # " << setprecision(6) << scientific
+                   << result.rep_time << " sec/rep, fastest "
+                   << getDataTypeName(result.data_type) << " of "
+                   << result.num_tunings << " tunings, "
+                   << result.num_pruned << " pruned"
+                   << defaultfloat;
+            }
+          }
+          file << endl;
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeConcurrentReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernels  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (ConcurrentResult const& result : concurrent_results) {
+      kercol_width = max(kercol_width, result.kernel_names.size());
+      varcol_width = max(varcol_width, getVariantName(result.vid).size());
+      tuncol_width = max(tuncol_width, result.tuning_name.size());
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Num Kernels", "Serial", "Concurrent",
+                                         "Speedup" };
+    const size_t data_width = prec + 8;
+
+    //
+    // Print title line.
+    //
+    file << "Concurrent Kernels Report (sec.) ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each group of kernels run concurrently.
+    //
+    for (ConcurrentResult const& result : concurrent_results) {
+      file <<left<< setw(kercol_width) << result.kernel_names
+           << sepchr <<left<< setw(varcol_width) << getVariantName(result.vid)
+           << sepchr <<left<< setw(tuncol_width) << result.tuning_name
+           << sepchr <<right<< setw(data_width) << result.num_kernels
+           << setprecision(prec) << std::fixed
+           << sepchr <<right<< setw(data_width) << result.serial_time
+           << sepchr <<right<< setw(data_width) << result.concurrent_time
+           << setprecision(3)
+           << sepchr <<right<< setw(data_width)
+           << result.serial_time / result.concurrent_time
+           << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+//
+// The slowdown is the min pass time with the load over the min pass time
+// alone, rows are sorted by slowdown so the kernels most sensitive to the
+// load come first.
+//
+void Executor::writeInterferenceReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (InterferenceResult const& result : interference_results) {
+      kercol_width = max(kercol_width, result.kernel_name.size());
+      varcol_width = max(varcol_width, getVariantName(result.vid).size());
+      tuncol_width = max(tuncol_width, result.tuning_name.size());
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Idle", "Loaded", "Slowdown" };
+    const size_t data_width = prec + 8;
+
+    vector<InterferenceResult> results(interference_results);
+    std::stable_sort(results.begin(), results.end(),
+        [](InterferenceResult const& lhs, InterferenceResult const& rhs) {
+          return lhs.loaded_time / lhs.idle_time >
+                 rhs.loaded_time / rhs.idle_time;
+        });
+
+    //
+    // Print title line with the loads.
+    //
+    file << "Interference Report (sec.) with load";
+    for (RunParams::InterferenceLoad load : run_params.getInterferenceLoads()) {
+      file << " " << RunParams::InterferenceLoadToStr(load);
+      if ( load == RunParams::CPUStreamLoad ) {
+        file << " x" << run_params.getInterferenceThreads();
+      }
+    }
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel variant tuning.
+    //
+    for (InterferenceResult const& result : results) {
+      file <<left<< setw(kercol_width) << result.kernel_name
+           << sepchr <<left<< setw(varcol_width) << getVariantName(result.vid)
+           << sepchr <<left<< setw(tuncol_width) << result.tuning_name
+           << setprecision(prec) << std::fixed
+           << sepchr <<right<< setw(data_width) << result.idle_time
+           << sepchr <<right<< setw(data_width) << result.loaded_time
+           << setprecision(3)
+           << sepchr <<right<< setw(data_width)
+           << result.loaded_time / result.idle_time
+           << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+//
+// The slowdown of each side is its time running with the other side over
+// its time running alone, the throughput is the iterations of both parts
+// per second of the co-execution wall time.
+//
+void Executor::writeCoExecReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string cpu_tuning_col_name("CPU Tuning  ");
+    const string gpu_tuning_col_name("GPU Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t cpucol_width = cpu_tuning_col_name.size();
+    size_t gpucol_width = gpu_tuning_col_name.size();
+    for (CoExecResult const& result : co_exec_results) {
+      kercol_width = max(kercol_width, result.kernel_name.size());
+      cpucol_width = max(cpucol_width, result.cpu_tuning_name.size());
+      gpucol_width = max(gpucol_width, result.gpu_tuning_name.size());
+    }
+    kercol_width++;
+    cpucol_width++;
+    gpucol_width++;
+
+    const vector<string> stat_col_names{ "CPU Alone", "GPU Alone",
+                                         "CPU Co-exec", "GPU Co-exec",
+                                         "Co-exec", "CPU Slowdown",
+                                         "GPU Slowdown", "Mits/sec",
+                                         "GPU Whole", "Speedup" };
+    const size_t data_width = prec + 8;
+
+    //
+    // Print title line.
+    //
+    file << "Co-execution Report (sec.) "
+         << getVariantName(run_params.getCoExecCPUVariant()) << " + "
+         << getVariantName(run_params.getCoExecGPUVariant())
+         << ", GPU part " << run_params.getCoExecGPUFraction();
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(cpucol_width) << cpu_tuning_col_name
+         << sepchr <<left<< setw(gpucol_width) << gpu_tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel, the speedup is over running the
+    // whole problem on the GPU.
+    //
+    for (CoExecResult const& result : co_exec_results) {
+      file <<left<< setw(kercol_width) << result.kernel_name
+           << sepchr <<left<< setw(cpucol_width) << result.cpu_tuning_name
+           << sepchr <<left<< setw(gpucol_width) << result.gpu_tuning_name
+           << setprecision(prec) << std::fixed
+           << sepchr <<right<< setw(data_width) << result.cpu_time
+           << sepchr <<right<< setw(data_width) << result.gpu_time
+           << sepchr <<right<< setw(data_width) << result.cpu_co_time
+           << sepchr <<right<< setw(data_width) << result.gpu_co_time
+           << sepchr <<right<< setw(data_width) << result.co_time
+           << setprecision(3)
+           << sepchr <<right<< setw(data_width) << result.cpu_co_time / result.cpu_time
+           << sepchr <<right<< setw(data_width) << result.gpu_co_time / result.gpu_time
+           << sepchr <<right<< setw(data_width) << result.its / result.co_time / 1.0e6
+           << setprecision(prec)
+           << sepchr <<right<< setw(data_width) << result.gpu_full_time
+           << setprecision(3)
+           << sepchr <<right<< setw(data_width) << result.gpu_full_time / result.co_time
+           << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+//
+// The predicted time per app cycle is the wall time of a proxy cycle, the
+// App_cycle row of each variant. Each kernel row gives its share of the
+// cycle and the ratio of its interleaved to isolated time, ie. the cost of
+// sharing the caches with the other kernels.
+//
+void Executor::writeAppProxyReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string cycle_row_name("App_cycle");
+    const string sepchr(" , ");
+
+    const size_t prec = 6;
+
+    size_t kercol_width = max(kernel_col_name.size(), cycle_row_name.size());
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (AppProxyResult const& result : app_proxy_results) {
+      varcol_width = max(varcol_width, getVariantName(result.vid).size());
+      for (size_t ik = 0; ik < result.kernel_names.size(); ++ik) {
+        kercol_width = max(kercol_width, result.kernel_names[ik].size());
+        tuncol_width = max(tuncol_width, result.tuning_names[ik].size());
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Weight", "Isolated", "Interleaved",
+                                         "Share (%)", "Interference" };
+    const size_t data_width = prec + 8;
+
+    //
+    // Print title line.
+    //
+    file << "App Proxy Report (sec. per cycle, "
+         << run_params.getAppProxyCycles() << " cycles) ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each kernel of the plan, then the cycle.
+    //
+    for (AppProxyResult const& result : app_proxy_results) {
+
+      double isolated_cycle_time = 0.0;
+      for (size_t ik = 0; ik < result.kernel_names.size(); ++ik) {
+        isolated_cycle_time += result.isolated_times[ik];
+
+        file <<left<< setw(kercol_width) << result.kernel_names[ik]
+             << sepchr <<left<< setw(varcol_width) << getVariantName(result.vid)
+             << sepchr <<left<< setw(tuncol_width) << result.tuning_names[ik]
+             << sepchr <<right<< setw(data_width) << result.weights[ik]
+             << setprecision(prec) << std::fixed
+             << sepchr <<right<< setw(data_width) << result.isolated_times[ik]
+             << sepchr <<right<< setw(data_width) << result.interleaved_times[ik]
+             << setprecision(3)
+             << sepchr <<right<< setw(data_width)
+             << 100.0 * result.interleaved_times[ik] / result.cycle_time
+             << sepchr <<right<< setw(data_width)
+             << result.interleaved_times[ik] / result.isolated_times[ik]
+             << endl;
+      }
+
+      file <<left<< setw(kercol_width) << cycle_row_name
+           << sepchr <<left<< setw(varcol_width) << getVariantName(result.vid)
+           << sepchr <<left<< setw(tuncol_width) << ""
+           << sepchr <<right<< setw(data_width) << ""
+           << setprecision(prec) << std::fixed
+           << sepchr <<right<< setw(data_width) << isolated_cycle_time
+           << sepchr <<right<< setw(data_width) << result.cycle_time
+           << setprecision(3)
+           << sepchr <<right<< setw(data_width) << 100.0
+           << sepchr <<right<< setw(data_width)
+           << result.cycle_time / isolated_cycle_time
+           << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
 
 
-  for (RunParams::CombinerOpt combiner : run_params.getNpassesCombinerOpts()) {
-    file = openOutputFile(out_fprefix + "-timing-" + RunParams::CombinerOptToStr(combiner) + ".csv");
-    writeCSVReport(*file, CSVRepMode::Timing, combiner, 6 /* prec */);
+//
+// Time per rep of the variant tunings with warm caches and with the caches
+// flushed before each rep, from passes run with '--cold-cache'.
+//
+void Executor::writeColdCacheReport(ostream& file)
+{
+  if ( file ) {
 
-    if ( haveReferenceVariant() ) {
-      file = openOutputFile(out_fprefix + "-speedup-" + RunParams::CombinerOptToStr(combiner) + ".csv");
-      writeCSVReport(*file, CSVRepMode::Speedup, combiner, 3 /* prec */);
-    }
-  }
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
 
-  file = openOutputFile(out_fprefix + "-checksum.txt");
-  writeChecksumReport(*file);
+    const size_t prec = 9;
 
-  {
-    vector<FOMGroup> fom_groups;
-    getFOMGroups(fom_groups);
-    if (!fom_groups.empty() ) {
-      file = openOutputFile(out_fprefix + "-fom.csv");
-      writeFOMReport(*file, fom_groups);
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (std::string const& tuning_name : kern->getVariantTuningNames(vid)) {
+          tuncol_width = max(tuncol_width, tuning_name.size());
+        }
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Warm Min Time/Rep", "Cold Min Time/Rep",
+                                         "Warm Avg Time/Rep", "Cold Avg Time/Rep",
+                                         "Cold/Warm Min" };
+    size_t data_width = prec + 8;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
     }
-  }
 
-  file = openOutputFile(out_fprefix + "-kernels.csv");
-  if ( *file ) {
-    bool to_file = true;
-    writeKernelInfoSummary(*file, to_file);
-  }
+    //
+    // Print title line.
+    //
+    file << "Cold Cache Report (sec.) ";
+    file << endl;
 
-#if defined(RAJA_PERFSUITE_USE_CALIPER)
-  KernelBase::setCaliperMgrFlush();
-#endif
-}
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
 
-unique_ptr<ostream> Executor::openOutputFile(const string& filename) const
-{
-  int rank = 0;
-#if defined(RAJA_PERFSUITE_ENABLE_MPI)
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#endif
-  if (rank == 0) {
-    unique_ptr<ostream> file(new ofstream(filename.c_str(), ios::out | ios::trunc));
-    if ( !*file ) {
-      getCout() << " ERROR: Can't open output file " << filename << endl;
+    //
+    // Print row of data for each variant tuning run with and without
+    // flushing caches.
+    //
+    for (KernelBase* kern : kernels) {
+      const double reps = static_cast<double>(kern->getRunReps());
+      for (VariantID vid : variant_ids) {
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+
+          const vector<RAJA::Timer::ElapsedType>& warm_times =
+              kern->getPassTimes(vid, tune_idx);
+          const vector<RAJA::Timer::ElapsedType>& cold_times =
+              kern->getColdCachePassTimes(vid, tune_idx);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ||
+               warm_times.empty() || cold_times.empty() ) {
+            continue;
+          }
+
+          const double warm_min = *min_element(warm_times.begin(), warm_times.end()) / reps;
+          const double cold_min = *min_element(cold_times.begin(), cold_times.end()) / reps;
+          const double warm_avg = accumulate(warm_times.begin(), warm_times.end(), 0.0) /
+                                  (warm_times.size() * reps);
+          const double cold_avg = accumulate(cold_times.begin(), cold_times.end(), 0.0) /
+                                  (cold_times.size() * reps);
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width)
+               << kern->getVariantTuningName(vid, tune_idx)
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(data_width) << warm_min
+               << sepchr <<right<< setw(data_width) << cold_min
+               << sepchr <<right<< setw(data_width) << warm_avg
+               << sepchr <<right<< setw(data_width) << cold_avg
+               << setprecision(3)
+               << sepchr <<right<< setw(data_width) << cold_min / warm_min
+               << endl;
+        }
+      }
     }
-    return file;
-  }
-  return unique_ptr<ostream>(makeNullStream());
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
 }
 
-void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
-                              RunParams::CombinerOpt combiner, size_t prec)
+//
+// Strong scaling of the OpenMP tunings run with each number of threads given
+// with '--omp-threads'. Speedup and parallel efficiency are relative to the
+// smallest number of threads run, marginal speedup is relative to the
+// previous number of threads, so it drops toward 1 where a kernel stops
+// scaling, ie. past one socket.
+//
+void Executor::writeOpenMPScalingReport(ostream& file)
 {
   if ( file ) {
 
+    const vector<int>& thread_counts = run_params.getOpenMPThreadCounts();
+
     //
     // Set basic table formatting parameters.
     //
     const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
     const string sepchr(" , ");
 
+    const size_t prec = 9;
+
     size_t kercol_width = kernel_col_name.size();
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (size_t tune_idx = 0; tune_idx < kern->getNumOpenMPThreadTunings(vid); ++tune_idx) {
+          tuncol_width = max(tuncol_width, kern->getVariantTuningName(vid, tune_idx).size());
+        }
+      }
     }
     kercol_width++;
-
-    vector<std::vector<size_t>> vartuncol_width(variant_ids.size());
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      size_t var_width = max(prec+2, getVariantName(variant_ids[iv]).size());
-      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
-        vartuncol_width[iv].emplace_back(max(var_width, tuning_name.size()));
-      }
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Threads", "Min Time/Rep", "Speedup",
+                                         "Efficiency", "Marginal Speedup" };
+    size_t data_width = prec + 8;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
     }
 
     //
     // Print title line.
     //
-    file << getReportTitle(mode, combiner);
+    file << "OpenMP Scaling Report (sec.) ";
+    file << endl;
 
     //
-    // Wrtie CSV file contents for report.
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
     //
+    // Print row of data for each number of threads of each tuning, the
+    // tuning run with n threads is at index (i+1)*num_tunings + tune_idx
+    // where n is the i-th number of threads.
+    //
+    for (KernelBase* kern : kernels) {
+      const double reps = static_cast<double>(kern->getRunReps());
+      for (VariantID vid : variant_ids) {
+        const size_t num_tunings = kern->getNumOpenMPThreadTunings(vid);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
 
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
-        file << sepchr;
+          double first_time = 0.0;
+          int first_threads = 0;
+          double prev_time = 0.0;
+          for (size_t i = 0; i < thread_counts.size(); ++i) {
+            const size_t thr_idx = (i+1)*num_tunings + tune_idx;
+            if ( !kern->wasVariantTuningRun(vid, thr_idx) ) {
+              continue;
+            }
+
+            const double time = kern->getMinTime(vid, thr_idx) / reps;
+            if ( first_threads == 0 ) {
+              first_time = time;
+              first_threads = thread_counts[i];
+              prev_time = time;
+            }
+            const double speedup = time > 0.0 ? first_time / time : 0.0;
+            const double efficiency =
+                speedup * first_threads / thread_counts[i];
+            const double marginal_speedup = time > 0.0 ? prev_time / time : 0.0;
+            prev_time = time;
+
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width)
+                 << kern->getVariantTuningName(vid, tune_idx)
+                 << sepchr <<right<< setw(data_width) << thread_counts[i]
+                 << setprecision(prec) << std::fixed
+                 << sepchr <<right<< setw(data_width) << time
+                 << setprecision(3)
+                 << sepchr <<right<< setw(data_width) << speedup
+                 << sepchr <<right<< setw(data_width) << efficiency
+                 << sepchr <<right<< setw(data_width) << marginal_speedup
+                 << endl;
+          }
+        }
       }
     }
-    file << endl;
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+//
+// Time and energy per rep of the GPU tunings run with the default settings
+// and each clock cap and power limit given with '--gpu-clocks' and
+// '--gpu-power-limits'. A setting is on the Pareto front of a tuning if no
+// other setting of the tuning is at least as fast while using at most as
+// much energy and is better in one, so the front holds the settings worth
+// choosing between for time against energy.
+//
+void Executor::writeGPUSweepReport(ostream& file)
+{
+  if ( file ) {
+
+    const vector<RunParams::GPUSetting>& settings = run_params.getGPUSettings();
 
     //
-    // Print column variant name line.
+    // Set basic table formatting parameters.
     //
-    file <<left<< setw(kercol_width) << kernel_col_name;
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
-        file << sepchr <<left<< setw(vartuncol_width[iv][it])
-             << getVariantName(variant_ids[iv]);
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 9;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (size_t tune_idx = 0; tune_idx < kern->getNumGPUSettingTunings(vid); ++tune_idx) {
+          tuncol_width = max(tuncol_width, kern->getVariantTuningName(vid, tune_idx).size());
+        }
       }
     }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Setting", "Time/Rep", "Joules/rep",
+                                         "Pareto" };
+    size_t data_width = prec + 8;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
+
+    //
+    // Print title line.
+    //
+    file << "GPU Sweep Report (sec. and joules per rep) ";
     file << endl;
 
     //
-    // Print column tuning name line.
+    // Print column name line.
     //
-    file <<left<< setw(kercol_width) << kernel_col_name;
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
-        file << sepchr <<left<< setw(vartuncol_width[iv][it])
-             << tuning_names[variant_ids[iv]][it];
-      }
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
     }
     file << endl;
 
     //
-    // Print row of data for variants of each kernel.
+    // Print row of data for the default settings and each setting of each
+    // tuning, the tuning run with the i-th setting is at index
+    // (i+1)*num_tunings + tune_idx.
     //
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      KernelBase* kern = kernels[ik];
-      file <<left<< setw(kercol_width) << kern->getName();
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        VariantID vid = variant_ids[iv];
-        for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
-          std::string const& tuning_name = tuning_names[variant_ids[iv]][it];
-          file << sepchr <<right<< setw(vartuncol_width[iv][it]);
-          if ( (mode == CSVRepMode::Speedup) &&
-               (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
-                !kern->hasVariantTuningDefined(vid, tuning_name)) ) {
-            file << "Not run";
-          } else if ( (mode == CSVRepMode::Timing) &&
-                      !kern->hasVariantTuningDefined(vid, tuning_name) ) {
-            file << "Not run";
-          } else {
-            file << setprecision(prec) << std::fixed
-                 << getReportDataEntry(mode, combiner, kern, vid,
-                        kern->getVariantTuningIndex(vid, tuning_name));
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        const size_t num_tunings = kern->getNumGPUSettingTunings(vid);
+        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+
+          vector<string> setting_names;
+          vector<double> times;
+          vector<double> energies;
+          for (size_t i = 0; i <= settings.size(); ++i) {
+            const size_t set_idx = i*num_tunings + tune_idx;
+            if ( !kern->wasVariantTuningRun(vid, set_idx) ) {
+              continue;
+            }
+            double joules = 0.0;
+            for (double meter_joule : kern->getAvgEnergyPerRep(vid, set_idx)) {
+              joules += meter_joule;
+            }
+            setting_names.emplace_back(i == 0 ? string("default")
+                                              : settings[i-1].getName());
+            times.emplace_back(kern->getTotTime(vid, set_idx) /
+                kern->getPassTimes(vid, set_idx).size() / kern->getRunReps());
+            energies.emplace_back(joules);
+          }
+
+          for (size_t i = 0; i < times.size(); ++i) {
+            bool dominated = false;
+            for (size_t j = 0; j < times.size() && !dominated; ++j) {
+              dominated = times[j] <= times[i] && energies[j] <= energies[i] &&
+                          (times[j] < times[i] || energies[j] < energies[i]);
+            }
+
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width)
+                 << kern->getVariantTuningName(vid, tune_idx)
+                 << sepchr <<right<< setw(data_width) << setting_names[i]
+                 << setprecision(prec) << std::fixed
+                 << sepchr <<right<< setw(data_width) << times[i]
+                 << sepchr <<right<< setw(data_width) << energies[i]
+                 << sepchr <<right<< setw(data_width)
+                 << (dominated ? "no" : "yes")
+                 << endl;
           }
         }
       }
-      file << endl;
     }
 
     file.flush();
@@ -872,8 +7707,11 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
   } // note file will be closed when file stream goes out of scope
 }
 
-
-void Executor::writeFOMReport(ostream& file, vector<FOMGroup>& fom_groups)
+//
+// Minor and major page faults of this process in the timed regions of the
+// variant tunings, per pass, from passes run with '--count-page-faults'.
+//
+void Executor::writePageFaultsReport(ostream& file)
 {
   if ( file ) {
 
@@ -881,505 +7719,789 @@ void Executor::writeFOMReport(ostream& file, vector<FOMGroup>& fom_groups)
     // Set basic table formatting parameters.
     //
     const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
     const string sepchr(" , ");
-    size_t prec = 2;
+
+    const size_t prec = 1;
 
     size_t kercol_width = kernel_col_name.size();
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (std::string const& tuning_name : kern->getVariantTuningNames(vid)) {
+          tuncol_width = max(tuncol_width, tuning_name.size());
+        }
+      }
     }
     kercol_width++;
+    varcol_width++;
+    tuncol_width++;
 
-    size_t fom_col_width = prec+14;
+    const vector<string> stat_col_names{ "Minor Faults/Pass", "Major Faults/Pass" };
+    size_t data_width = prec + 12;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
 
-    std::vector<size_t> fom_group_ncols(fom_groups.size(), 0);
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      const FOMGroup& group = fom_groups[ifg];
+    //
+    // Print title line.
+    //
+    file << "Page Faults Report (managed policy "
+         << getManagedPolicyName(run_params.getManagedPolicy()) << ") ";
+    file << endl;
 
-      for (size_t gv = 0; gv < group.variants.size(); ++gv) {
-        VariantID vid = group.variants[gv];
-        const string& variant_name = getVariantName(vid);
-        // num variants and tuning
-        // Includes the PM baseline and the variants and tunings to compared to it
-        fom_group_ncols[ifg] += tuning_names[vid].size();
-        for (const string& tuning_name : tuning_names[vid]) {
-          fom_col_width = max(fom_col_width, variant_name.size()+1+tuning_name.size());
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of data for each variant tuning run.
+    //
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width)
+               << kern->getVariantTuningName(vid, tune_idx)
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(data_width)
+               << kern->getAvgMinorPageFaults(vid, tune_idx)
+               << sepchr <<right<< setw(data_width)
+               << kern->getAvgMajorPageFaults(vid, tune_idx)
+               << endl;
         }
       }
     }
 
-    vector< vector<int> > col_exec_count(fom_groups.size());
-    vector< vector<double> > col_min(fom_groups.size());
-    vector< vector<double> > col_max(fom_groups.size());
-    vector< vector<double> > col_avg(fom_groups.size());
-    vector< vector<double> > col_stddev(fom_groups.size());
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      col_exec_count[ifg].resize(fom_group_ncols[ifg], 0);
-      col_min[ifg].resize(fom_group_ncols[ifg], numeric_limits<double>::max());
-      col_max[ifg].resize(fom_group_ncols[ifg], -numeric_limits<double>::max());
-      col_avg[ifg].resize(fom_group_ncols[ifg], 0.0);
-      col_stddev[ifg].resize(fom_group_ncols[ifg], 0.0);
-    }
-    vector< vector< vector<double> > > pct_diff(kernels.size());
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      pct_diff[ik].resize(fom_groups.size());
-      for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-        pct_diff[ik][ifg].resize(fom_group_ncols[ifg], 0.0);
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+//
+// Device memory of each GPU variant tuning next to its time per rep, the
+// data allocated after setUp, the most data allocated at once, and the most
+// memory of the GPU in use at once, which includes the temporaries of
+// libraries and the RAJA and runtime memory pools. The scratch of a tuning
+// is the peak less the setUp data.
+//
+void Executor::writeDeviceMemoryReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (std::string const& tuning_name : kern->getVariantTuningNames(vid)) {
+          tuncol_width = max(tuncol_width, tuning_name.size());
+        }
       }
     }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Min time/rep (sec)",
+                                         "SetUp Data (bytes)",
+                                         "Peak Data (bytes)",
+                                         "Peak Device (bytes)",
+                                         "Scratch (bytes)" };
+    size_t data_width = prec + 14;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
 
     //
     // Print title line.
     //
-    file << "FOM Report : signed speedup(-)/slowdown(+) for each PM (base vs. RAJA) -> (T_RAJA - T_base) / T_base )";
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      for (size_t iv = 0; iv < fom_group_ncols[ifg]*2; ++iv) {
-        file << sepchr;
-      }
+    file << "Device Memory Report ";
+    file << endl;
+
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
     }
     file << endl;
 
-    file << "'OVER_TOL' in column to right if RAJA speedup is over tolerance";
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      for (size_t iv = 0; iv < fom_group_ncols[ifg]*2; ++iv) {
-        file << sepchr;
+    //
+    // Print row of data for each GPU variant tuning run.
+    //
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        if ( !isVariantGPU(vid) ) {
+          continue;
+        }
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          const size_t setup_bytes = kern->getDeviceSetUpDataBytes(vid, tune_idx);
+          const size_t peak_bytes = max(kern->getPeakDeviceDataBytes(vid, tune_idx),
+                                        kern->getPeakDeviceMemoryBytes(vid, tune_idx));
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width)
+               << kern->getVariantTuningName(vid, tune_idx)
+               << setprecision(prec) << std::scientific
+               << sepchr <<right<< setw(data_width)
+               << kern->getMinTime(vid, tune_idx) / kern->getRunReps()
+               << sepchr <<right<< setw(data_width) << setup_bytes
+               << sepchr <<right<< setw(data_width)
+               << kern->getPeakDeviceDataBytes(vid, tune_idx)
+               << sepchr <<right<< setw(data_width)
+               << kern->getPeakDeviceMemoryBytes(vid, tune_idx)
+               << sepchr <<right<< setw(data_width)
+               << (peak_bytes > setup_bytes ? peak_bytes - setup_bytes : 0)
+               << endl;
+        }
       }
     }
-    file << endl;
 
-    string pass(",        ");
-    string fail(",OVER_TOL");
-    string base(",base_ref");
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+//
+// GPU state over the kept passes of each GPU variant tuning, the lowest
+// clocks, highest temperature and power of any pass, the passes kept while
+// throttled, the passes rerun because they were throttled, and the throttle
+// reasons of all kept passes as a hex mask.
+//
+void Executor::writeGPUTelemetryReport(ostream& file)
+{
+  if ( file ) {
 
     //
-    // Print column title line.
+    // Set basic table formatting parameters.
     //
-    file <<left<< setw(kercol_width) << kernel_col_name;
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      const FOMGroup& group = fom_groups[ifg];
-      for (size_t gv = 0; gv < group.variants.size(); ++gv) {
-        VariantID vid = group.variants[gv];
-        string variant_name = getVariantName(vid);
-        for (const string& tuning_name : tuning_names[vid]) {
-          file << sepchr <<left<< setw(fom_col_width)
-               << (variant_name+"-"+tuning_name) << pass;
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    const size_t prec = 1;
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (std::string const& tuning_name : kern->getVariantTuningNames(vid)) {
+          tuncol_width = max(tuncol_width, tuning_name.size());
         }
       }
     }
-    file << endl;
-
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Min SM MHz", "Min Mem MHz",
+                                         "Max Temp C", "Max Watts",
+                                         "Throttled Passes", "Reruns",
+                                         "Throttle Reasons" };
+    size_t data_width = prec + 12;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
 
     //
-    // Write CSV file contents for FOM report.
+    // Print title line.
     //
+    file << "GPU Telemetry Report (over passes) ";
+    file << endl;
 
     //
-    // Print row of FOM data for each kernel.
+    // Print column name line.
     //
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      KernelBase* kern = kernels[ik];
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
 
-      file <<left<< setw(kercol_width) << kern->getName();
+    //
+    // Print row of data for each GPU variant tuning run.
+    //
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+
+          const vector<detail::GPUTelemetry>& pass_telemetry =
+              kern->getPassTelemetry(vid, tune_idx);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ||
+               pass_telemetry.empty() ) {
+            continue;
+          }
 
-      for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-        const FOMGroup& group = fom_groups[ifg];
+          detail::GPUTelemetry telemetry = detail::emptyTelemetry();
+          int throttled_passes = 0;
+          for (detail::GPUTelemetry const& pass : pass_telemetry) {
+            detail::combineTelemetry(telemetry, pass);
+            throttled_passes += pass.throttled() ? 1 : 0;
+          }
 
-        constexpr double unknown_totTime = -1.0;
-        double base_totTime = unknown_totTime;
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width)
+               << kern->getVariantTuningName(vid, tune_idx)
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(data_width) << telemetry.sm_clock_mhz
+               << sepchr <<right<< setw(data_width) << telemetry.mem_clock_mhz
+               << sepchr <<right<< setw(data_width) << telemetry.temperature_c
+               << sepchr <<right<< setw(data_width) << telemetry.power_watts
+               << sepchr <<right<< setw(data_width) << throttled_passes
+               << sepchr <<right<< setw(data_width)
+               << kern->getNumDiscardedPasses(vid, tune_idx)
+               << sepchr <<right<< setw(data_width) << std::hex << std::showbase
+               << telemetry.throttle_reasons << std::dec << std::noshowbase
+               << endl;
+        }
+      }
+    }
 
-        size_t col = 0;
-        for (size_t gv = 0; gv < group.variants.size(); ++gv) {
-          VariantID vid = group.variants[gv];
+    file.flush();
 
-          for (const string& tuning_name : tuning_names[vid]) {
+  } // note file will be closed when file stream goes out of scope
+}
 
-            size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+//
+// Time per rep of each GPU variant tuning split into the time the device
+// was busy running its kernels, copies, and memsets and the rest, the host
+// side time, ie. launch overhead and host objects made in the rep loop.
+//
+void Executor::writeDeviceActivityReport(ostream& file)
+{
+  if ( file ) {
 
-            //
-            // If kernel variant was run, generate data for it and
-            // print (signed) percentage difference from baseline.
-            //
-            if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
-              col_exec_count[ifg][col]++;
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
 
-              bool is_base = (base_totTime == unknown_totTime);
-              if (is_base) {
-                base_totTime = kern->getTotTime(vid, tune_idx);
-              }
+    const size_t prec = 3;
 
-              pct_diff[ik][ifg][col] =
-                (kern->getTotTime(vid, tune_idx) - base_totTime) / base_totTime;
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (std::string const& tuning_name : kern->getVariantTuningNames(vid)) {
+          tuncol_width = max(tuncol_width, tuning_name.size());
+        }
+      }
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+
+    const vector<string> stat_col_names{ "Time/rep (us)", "Device busy/rep (us)",
+                                         "Host side/rep (us)", "Device busy %",
+                                         "Device ops/rep" };
+    size_t data_width = prec + 12;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
 
-              string pfstring(pass);
-              if (pct_diff[ik][ifg][col] > run_params.getPFTolerance()) {
-                pfstring = fail;
-              }
-              if (is_base) {
-                pfstring = base;
-              }
+    //
+    // Print title line.
+    //
+    file << "Device Activity Report (mean over passes) ";
+    file << endl;
 
-              file << sepchr << setw(fom_col_width) << setprecision(prec)
-                   <<left<< pct_diff[ik][ifg][col] <<right<< pfstring;
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
 
-              //
-              // Gather data for column summaries (unsigned).
-              //
-              col_min[ifg][col] = min( col_min[ifg][col], pct_diff[ik][ifg][col] );
-              col_max[ifg][col] = max( col_max[ifg][col], pct_diff[ik][ifg][col] );
-              col_avg[ifg][col] += pct_diff[ik][ifg][col];
+    //
+    // Print row of data for each GPU variant tuning run.
+    //
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        if ( !isVariantGPU(vid) ) {
+          continue;
+        }
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
 
-            } else {  // variant was not run, print a big fat goose egg...
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
 
-              file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
-                   << 0.0 << pass;
+          const double npasses =
+              static_cast<double>(kern->getPassTimes(vid, tune_idx).size());
+          const double reps = static_cast<double>(kern->getRunReps());
+          const double time_per_rep =
+              kern->getTotTime(vid, tune_idx) / npasses / reps;
+          const double busy_per_rep =
+              kern->getAvgDeviceBusyTime(vid, tune_idx) / reps;
+          const double host_per_rep = max(0.0, time_per_rep - busy_per_rep);
+          const double busy_percent = (time_per_rep > 0.0)
+              ? 100.0 * busy_per_rep / time_per_rep : 0.0;
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width)
+               << kern->getVariantTuningName(vid, tune_idx)
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(data_width) << time_per_rep * 1.0e6
+               << sepchr <<right<< setw(data_width) << busy_per_rep * 1.0e6
+               << sepchr <<right<< setw(data_width) << host_per_rep * 1.0e6
+               << sepchr <<right<< setw(data_width) << busy_percent
+               << sepchr <<right<< setw(data_width)
+               << kern->getAvgDeviceOps(vid, tune_idx) / reps
+               << endl;
+        }
+      }
+    }
 
-            }
+    file.flush();
 
-            col++;
-          }
+  } // note file will be closed when file stream goes out of scope
+}
 
-        }  // iterate over group variants
+//
+// Untimed reps each variant tuning ran in adaptive warmup before its rep
+// times converged, and the times of its first and last warmup rep, the
+// ratio of which is the cold-start cost.
+//
+void Executor::writeWarmupReport(ostream& file)
+{
+  if ( file ) {
 
-      }  // iterate over fom_groups (i.e., columns)
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
 
-      file << endl;
+    const size_t prec = 6;
 
-    } // iterate over kernels
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (AdaptiveWarmupResult const& result : warmup_results) {
+      kercol_width = max(kercol_width, result.kernel_name.size());
+      varcol_width = max(varcol_width, getVariantName(result.vid).size());
+      tuncol_width = max(tuncol_width, result.tuning_name.size());
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
 
+    const vector<string> stat_col_names{ "Warmup Reps", "Converged",
+                                         "First Rep", "Last Rep",
+                                         "First/Last" };
+    const size_t data_width = prec + 8;
 
     //
-    // Compute column summary data.
+    // Print title line.
     //
+    file << "Warmup Report (sec., rep time tolerance "
+         << run_params.getAdaptiveWarmupTolerance() << ", at most "
+         << run_params.getAdaptiveWarmupMaxReps() << " reps) ";
+    file << endl;
 
-    // Column average...
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
-        if ( col_exec_count[ifg][col] > 0 ) {
-          col_avg[ifg][col] /= col_exec_count[ifg][col];
-        } else {
-          col_avg[ifg][col] = 0.0;
-        }
-      }
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
     }
+    file << endl;
 
-    // Column standard deviation...
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      KernelBase* kern = kernels[ik];
+    //
+    // Print row of data for each variant tuning warmed up.
+    //
+    for (AdaptiveWarmupResult const& result : warmup_results) {
+      file <<left<< setw(kercol_width) << result.kernel_name
+           << sepchr <<left<< setw(varcol_width) << getVariantName(result.vid)
+           << sepchr <<left<< setw(tuncol_width) << result.tuning_name
+           << sepchr <<right<< setw(data_width) << result.reps
+           << sepchr <<right<< setw(data_width)
+           << (result.converged ? "yes" : "no")
+           << setprecision(prec) << std::fixed
+           << sepchr <<right<< setw(data_width) << result.first_rep_time
+           << sepchr <<right<< setw(data_width) << result.last_rep_time
+           << setprecision(3)
+           << sepchr <<right<< setw(data_width)
+           << result.first_rep_time / result.last_rep_time
+           << endl;
+    }
 
-      for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-        const FOMGroup& group = fom_groups[ifg];
+    file.flush();
 
-        int col = 0;
-        for (size_t gv = 0; gv < group.variants.size(); ++gv) {
-          VariantID vid = group.variants[gv];
+  } // note file will be closed when file stream goes out of scope
+}
 
-          for (const string& tuning_name : tuning_names[vid]) {
+//
+// Registers and local memory per thread and occupancy of the GPU kernels of
+// the variant tunings that record them, ie. the min blocks tunings.
+//
+void Executor::writeGPUFuncAttributesReport(ostream& file)
+{
+  if ( file ) {
 
-            size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string func_col_name("Function  ");
+    const string sepchr(" , ");
 
-            if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
-              col_stddev[ifg][col] += ( pct_diff[ik][ifg][col] - col_avg[ifg][col] ) *
-                                      ( pct_diff[ik][ifg][col] - col_avg[ifg][col] );
-            }
+    const size_t prec = 2;
 
-            col++;
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    size_t funccol_width = func_col_name.size();
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (std::string const& tuning_name : kern->getVariantTuningNames(vid)) {
+          tuncol_width = max(tuncol_width, tuning_name.size());
+        }
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+          for (GPUFuncAttributes const& attrs : kern->getGPUFuncAttributes(vid, tune_idx)) {
+            funccol_width = max(funccol_width, attrs.name.size());
           }
-
-        } // iterate over group variants
-
-      }  // iterate over groups
-
-    }  // iterate over kernels
-
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
-        if ( col_exec_count[ifg][col] > 0 ) {
-          col_stddev[ifg][col] /= col_exec_count[ifg][col];
-        } else {
-          col_stddev[ifg][col] = 0.0;
         }
       }
     }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
+    funccol_width++;
+
+    const vector<string> stat_col_names{ "Registers", "Local Bytes",
+                                         "Static Shmem", "Dynamic Shmem",
+                                         "Occupancy" };
+    size_t data_width = prec + 8;
+    for (string const& stat_col_name : stat_col_names) {
+      data_width = max(data_width, stat_col_name.size());
+    }
 
     //
-    // Print column summaries.
+    // Print title line.
     //
-    file <<left<< setw(kercol_width) << " ";
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
-        file << sepchr << setw(fom_col_width) <<left<< "  " <<right<< pass;
-      }
-    }
+    file << "GPU Function Attributes Report ";
     file << endl;
 
-    file <<left<< setw(kercol_width) << "Col Min";
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
-        file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
-             << col_min[ifg][col] << pass;
-      }
-    }
-    file << endl;
-
-    file <<left<< setw(kercol_width) << "Col Max";
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
-        file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
-             << col_max[ifg][col] << pass;
-      }
-    }
-    file << endl;
-
-    file <<left<< setw(kercol_width) << "Col Avg";
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
-        file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
-             << col_avg[ifg][col] << pass;
-      }
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name
+         << sepchr <<left<< setw(funccol_width) << func_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
     }
     file << endl;
 
-    file <<left<< setw(kercol_width) << "Col Std Dev";
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      for (size_t col = 0; col < fom_group_ncols[ifg]; ++col) {
-        file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
-             << col_stddev[ifg][col] << pass;
+    //
+    // Print row of data for each GPU function of each variant tuning run
+    // that recorded them.
+    //
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          for (GPUFuncAttributes const& attrs : kern->getGPUFuncAttributes(vid, tune_idx)) {
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width)
+                 << kern->getVariantTuningName(vid, tune_idx)
+                 << sepchr <<left<< setw(funccol_width) << attrs.name
+                 << sepchr <<right<< setw(data_width) << attrs.num_regs
+                 << sepchr <<right<< setw(data_width) << attrs.local_bytes
+                 << sepchr <<right<< setw(data_width) << attrs.static_shmem_bytes
+                 << sepchr <<right<< setw(data_width) << attrs.dynamic_shmem_bytes
+                 << setprecision(prec) << std::fixed
+                 << sepchr <<right<< setw(data_width) << attrs.occupancy
+                 << endl;
+          }
+        }
       }
     }
-    file << endl;
 
     file.flush();
 
   } // note file will be closed when file stream goes out of scope
 }
 
-
-void Executor::writeChecksumReport(ostream& file)
+//
+// Reproducible tunings of the kernels using reductions, whether the
+// checksums of their passes were bitwise the same, and their average time
+// relative to the fastest tuning of the same variant.
+//
+void Executor::writeReproducibilityReport(ostream& file)
 {
   if ( file ) {
 
-#if defined(RAJA_PERFSUITE_ENABLE_MPI)
-    int num_ranks;
-    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
-#endif
-
     //
     // Set basic table formatting parameters.
     //
-    const string equal_line("===================================================================================================");
-    const string dash_line("----------------------------------------------------------------------------------------");
-    const string dash_line_short("-------------------------------------------------------");
-    string dot_line("........................................................");
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string fastest_col_name("Fastest Tuning  ");
+    const string sepchr(" , ");
 
-    size_t prec = 20;
-    size_t checksum_width = prec + 8;
+    const size_t prec = 6;
 
-    size_t namecol_width = 0;
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      namecol_width = max(namecol_width, kernels[ik]->getName().size());
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        size_t var_width = getVariantName(variant_ids[iv]).size();
-        for (std::string const& tuning_name :
-             kernels[ik]->getVariantTuningNames(variant_ids[iv])) {
-          namecol_width = max(namecol_width, var_width+1+tuning_name.size());
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = max(tuning_col_name.size(), fastest_col_name.size());
+    for (KernelBase* kern : kernels) {
+      kercol_width = max(kercol_width, kern->getName().size());
+      for (VariantID vid : variant_ids) {
+        varcol_width = max(varcol_width, getVariantName(vid).size());
+        for (std::string const& tuning_name : kern->getVariantTuningNames(vid)) {
+          tuncol_width = max(tuncol_width, tuning_name.size());
         }
       }
     }
-    namecol_width++;
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
 
+    const vector<string> stat_col_names{ "Passes", "Bitwise Same", "Time",
+                                         "Fastest Time", "Cost" };
+    const size_t data_width = prec + 8;
 
     //
-    // Print title.
+    // Print title line.
     //
-    file << equal_line << endl;
-    file << "Checksum Report ";
-#if defined(RAJA_PERFSUITE_ENABLE_MPI)
-    file << "for " << num_ranks << " MPI ranks ";
-#endif
+    file << "Reproducibility Report (sec.) ";
     file << endl;
-    file << equal_line << endl;
 
     //
-    // Print column title line.
+    // Print column name line.
     //
-    file <<left<< setw(namecol_width) << "Kernel  " << endl;
-    file << dot_line << endl;
-    file <<left<< setw(namecol_width) << "Variants  "
-#if defined(RAJA_PERFSUITE_ENABLE_MPI)
-         <<left<< setw(checksum_width) << "Average Checksum  "
-         <<left<< setw(checksum_width) << "Max Checksum Diff  "
-         <<left<< setw(checksum_width) << "Checksum Diff StdDev"
-#else
-         <<left<< setw(checksum_width) << "Checksum  "
-         <<left<< setw(checksum_width) << "Checksum Diff  "
-#endif
-         << endl;
-    file <<left<< setw(namecol_width) << "  "
-         <<left<< setw(checksum_width) << "  "
-         <<left<< setw(checksum_width) << "(vs. first variant listed)  "
-#if defined(RAJA_PERFSUITE_ENABLE_MPI)
-         <<left<< setw(checksum_width) << ""
-#endif
-         << endl;
-    file << dash_line << endl;
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name
+         << sepchr <<left<< setw(tuncol_width) << fastest_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
 
     //
-    // Print checksum and diff against baseline for each kernel variant.
+    // Print row of data for each reproducible tuning run.
     //
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      KernelBase* kern = kernels[ik];
-
-      file <<left<< setw(namecol_width) << kern->getName() << endl;
-      file << dot_line << endl;
-
-      Checksum_type cksum_ref = 0.0;
-      size_t ivck = 0;
-      bool found_ref = false;
-      while ( ivck < variant_ids.size() && !found_ref ) {
-        VariantID vid = variant_ids[ivck];
-        size_t num_tunings = kern->getNumVariantTunings(vid);
-        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-          if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
-            cksum_ref = kern->getChecksum(vid, tune_idx);
-            found_ref = true;
-            break;
-          }
-        }
-        ++ivck;
+    for (KernelBase* kern : kernels) {
+      if ( !kern->usesFeature(Reduction) ) {
+        continue;
       }
 
-      // get vector of checksums and diffs
-      std::vector<std::vector<Checksum_type>> checksums(variant_ids.size());
-      std::vector<std::vector<Checksum_type>> checksums_diff(variant_ids.size());
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        VariantID vid = variant_ids[iv];
-        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+      for (VariantID vid : variant_ids) {
 
-        checksums[iv].resize(num_tunings, 0.0);
-        checksums_diff[iv].resize(num_tunings, 0.0);
-        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-          if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
-            checksums[iv][tune_idx] = kern->getChecksum(vid, tune_idx);
-            checksums_diff[iv][tune_idx] = cksum_ref - kern->getChecksum(vid, tune_idx);
+        auto avg_time = [&](size_t tune_idx) {
+          return kern->getTotTime(vid, tune_idx) /
+                 kern->getPassTimes(vid, tune_idx).size();
+        };
+
+        size_t fastest_idx = KernelBase::getUnknownTuningIdx();
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+          if ( kern->wasVariantTuningRun(vid, tune_idx) &&
+               !kern->getPassTimes(vid, tune_idx).empty() &&
+               ( fastest_idx == KernelBase::getUnknownTuningIdx() ||
+                 avg_time(tune_idx) < avg_time(fastest_idx) ) ) {
+            fastest_idx = tune_idx;
           }
         }
-      }
-
-#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+        if ( fastest_idx == KernelBase::getUnknownTuningIdx() ) {
+          continue;
+        }
 
-      // get stats for checksums
-      std::vector<std::vector<Checksum_type>> checksums_sum(variant_ids.size());
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
-        checksums_sum[iv].resize(num_tunings, 0.0);
-        Allreduce(checksums[iv].data(), checksums_sum[iv].data(), num_tunings,
-                  MPI_SUM, MPI_COMM_WORLD);
-      }
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ||
+               kern->getPassTimes(vid, tune_idx).empty() ||
+               !kern->isVariantTuningReproducible(vid, tune_idx) ) {
+            continue;
+          }
 
-      std::vector<std::vector<Checksum_type>> checksums_avg(variant_ids.size());
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
-        checksums_avg[iv].resize(num_tunings, 0.0);
-        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-          checksums_avg[iv][tune_idx] = checksums_sum[iv][tune_idx] / num_ranks;
-        }
-      }
+          const vector<Checksum_type>& pass_checksums =
+              kern->getPassChecksums(vid, tune_idx);
+          string same("n/a");
+          if ( pass_checksums.size() > 1 ) {
+            same = "yes";
+            for (Checksum_type pass_checksum : pass_checksums) {
+              if ( pass_checksum != pass_checksums.front() ) {
+                same = "no";
+              }
+            }
+          }
 
-      // get stats for checksums_abs_diff
-      std::vector<std::vector<Checksum_type>> checksums_abs_diff(variant_ids.size());
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
-        checksums_abs_diff[iv].resize(num_tunings, 0.0);
-        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-          checksums_abs_diff[iv][tune_idx] = std::abs(checksums_diff[iv][tune_idx]);
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width)
+               << kern->getVariantTuningName(vid, tune_idx)
+               << sepchr <<left<< setw(tuncol_width)
+               << kern->getVariantTuningName(vid, fastest_idx)
+               << sepchr <<right<< setw(data_width) << pass_checksums.size()
+               << sepchr <<right<< setw(data_width) << same
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(data_width) << avg_time(tune_idx)
+               << sepchr <<right<< setw(data_width) << avg_time(fastest_idx)
+               << setprecision(3)
+               << sepchr <<right<< setw(data_width)
+               << avg_time(tune_idx) / avg_time(fastest_idx)
+               << endl;
         }
       }
+    }
 
-      std::vector<std::vector<Checksum_type>> checksums_abs_diff_min(variant_ids.size());
-      std::vector<std::vector<Checksum_type>> checksums_abs_diff_max(variant_ids.size());
-      std::vector<std::vector<Checksum_type>> checksums_abs_diff_sum(variant_ids.size());
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
-        checksums_abs_diff_min[iv].resize(num_tunings, 0.0);
-        checksums_abs_diff_max[iv].resize(num_tunings, 0.0);
-        checksums_abs_diff_sum[iv].resize(num_tunings, 0.0);
+    file.flush();
 
-        Allreduce(checksums_abs_diff[iv].data(), checksums_abs_diff_min[iv].data(), num_tunings,
-                  MPI_MIN, MPI_COMM_WORLD);
-        Allreduce(checksums_abs_diff[iv].data(), checksums_abs_diff_max[iv].data(), num_tunings,
-                  MPI_MAX, MPI_COMM_WORLD);
-        Allreduce(checksums_abs_diff[iv].data(), checksums_abs_diff_sum[iv].data(), num_tunings,
-                  MPI_SUM, MPI_COMM_WORLD);
-      }
+  } // note file will be closed when file stream goes out of scope
+}
 
-      std::vector<std::vector<Checksum_type>> checksums_abs_diff_avg(variant_ids.size());
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
-        checksums_abs_diff_avg[iv].resize(num_tunings, 0.0);
-        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-          checksums_abs_diff_avg[iv][tune_idx] = checksums_abs_diff_sum[iv][tune_idx] / num_ranks;
-        }
-      }
+void Executor::writeRegressionReport(ostream& file)
+{
+  if ( file ) {
 
-      std::vector<std::vector<Checksum_type>> checksums_abs_diff_diff2avg2(variant_ids.size());
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
-        checksums_abs_diff_diff2avg2[iv].resize(num_tunings, 0.0);
-        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-          checksums_abs_diff_diff2avg2[iv][tune_idx] = (checksums_abs_diff[iv][tune_idx] - checksums_abs_diff_avg[iv][tune_idx]) *
-                                                  (checksums_abs_diff[iv][tune_idx] - checksums_abs_diff_avg[iv][tune_idx]) ;
-        }
-      }
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
 
-      std::vector<std::vector<Checksum_type>> checksums_abs_diff_stddev(variant_ids.size());
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
-        checksums_abs_diff_stddev[iv].resize(num_tunings, 0.0);
-        Allreduce(checksums_abs_diff_diff2avg2[iv].data(), checksums_abs_diff_stddev[iv].data(), num_tunings,
-                  MPI_SUM, MPI_COMM_WORLD);
-        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-          checksums_abs_diff_stddev[iv][tune_idx] = std::sqrt(checksums_abs_diff_stddev[iv][tune_idx] / num_ranks);
-        }
-      }
+    const size_t prec = 6;
 
-#endif
+    size_t kercol_width = kernel_col_name.size();
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (RegressionResult const& result : regression_results) {
+      kercol_width = max(kercol_width, result.kernel_name.size());
+      varcol_width = max(varcol_width, getVariantName(result.vid).size());
+      tuncol_width = max(tuncol_width, result.tuning_name.size());
+    }
+    kercol_width++;
+    varcol_width++;
+    tuncol_width++;
 
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        VariantID vid = variant_ids[iv];
-        const string& variant_name = getVariantName(vid);
+    const vector<string> stat_col_names{ "Prev Min", "Min", "Ratio",
+                                         "Threshold", "Status" };
+    const size_t data_width = prec + 8;
 
-        size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
-        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-          const string& tuning_name = kern->getVariantTuningName(vid, tune_idx);
+    //
+    // Print title line.
+    //
+    file << "Regression Report (sec.) vs. " << run_params.getCompareDir()
+         << " : tolerance = " << run_params.getCompareTolerance();
+    file << endl;
 
-          if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
-            file <<left<< setw(namecol_width) << (variant_name+"-"+tuning_name)
-                 << showpoint << setprecision(prec)
-#if defined(RAJA_PERFSUITE_ENABLE_MPI)
-                 <<left<< setw(checksum_width) << checksums_avg[iv][tune_idx]
-                 <<left<< setw(checksum_width) << checksums_abs_diff_max[iv][tune_idx]
-                 <<left<< setw(checksum_width) << checksums_abs_diff_stddev[iv][tune_idx] << endl;
-#else
-                 <<left<< setw(checksum_width) << checksums[iv][tune_idx]
-                 <<left<< setw(checksum_width) << checksums_diff[iv][tune_idx] << endl;
-#endif
-          } else {
-            file <<left<< setw(namecol_width) << (variant_name+"-"+tuning_name)
-#if defined(RAJA_PERFSUITE_ENABLE_MPI)
-                 <<left<< setw(checksum_width) << "Not Run"
-                 <<left<< setw(checksum_width) << "Not Run"
-                 <<left<< setw(checksum_width) << "Not Run" << endl;
-#else
-                 <<left<< setw(checksum_width) << "Not Run"
-                 <<left<< setw(checksum_width) << "Not Run" << endl;
-#endif
-          }
+    //
+    // Print column name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(data_width) << stat_col_name;
+    }
+    file << endl;
 
-        }
+    //
+    // Print row of data for each kernel variant tuning run.
+    //
+    for (RegressionResult const& result : regression_results) {
+      file <<left<< setw(kercol_width) << result.kernel_name
+           << sepchr <<left<< setw(varcol_width) << getVariantName(result.vid)
+           << sepchr <<left<< setw(tuncol_width) << result.tuning_name;
+      if ( !result.in_baseline ) {
+        file << setprecision(prec) << std::fixed
+             << sepchr <<right<< setw(data_width) << "Not run"
+             << sepchr <<right<< setw(data_width) << result.time
+             << sepchr <<right<< setw(data_width) << ""
+             << sepchr <<right<< setw(data_width) << ""
+             << sepchr <<left<< setw(data_width) << "NOT_IN_BASELINE"
+             << endl;
+        continue;
       }
-
-      file << endl;
-      file << dash_line_short << endl;
+      const double ratio = result.time / result.base_time;
+      const char* status = (ratio > result.threshold) ? "REGRESSION"
+                         : (ratio < 1.0 / result.threshold) ? "IMPROVED"
+                         : "OK";
+      file << setprecision(prec) << std::fixed
+           << sepchr <<right<< setw(data_width) << result.base_time
+           << sepchr <<right<< setw(data_width) << result.time
+           << setprecision(3)
+           << sepchr <<right<< setw(data_width) << ratio
+           << sepchr <<right<< setw(data_width) << result.threshold
+           << sepchr <<left<< setw(data_width) << status
+           << endl;
     }
 
     file.flush();
@@ -1411,11 +8533,19 @@ string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner
       title += string("Runtime Report (sec.) ");
       break;
     }
+    case CSVRepMode::DeviceTiming : {
+      title += string("GPU Event Runtime Report (sec.) ");
+      break;
+    }
+    case CSVRepMode::IterationTiming : {
+      title += string("Runtime per Iteration Report (nsec.) ");
+      break;
+    }
     case CSVRepMode::Speedup : {
       if ( haveReferenceVariant() ) {
         title += string("Speedup Report (T_ref/T_var)") +
                  string(": ref var = ") + getVariantName(reference_vid) +
-                 string(" ");
+                 string(" (* -> not significant at 95% confidence) ");
       }
       break;
     }
@@ -1435,7 +8565,7 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
     case CSVRepMode::Timing : {
       switch ( combiner ) {
         case RunParams::CombinerOpt::Average : {
-          retval = kern->getTotTime(vid, tune_idx) / run_params.getNumPasses();
+          retval = kern->getTotTime(vid, tune_idx) / kern->getPassTimes(vid, tune_idx).size();
         }
         break;
         case RunParams::CombinerOpt::Minimum : {
@@ -1450,6 +8580,37 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
       }
       break;
     }
+    case CSVRepMode::DeviceTiming : {
+      switch ( combiner ) {
+        case RunParams::CombinerOpt::Average : {
+          retval = kern->getTotDeviceTime(vid, tune_idx) / kern->getPassDeviceTimes(vid, tune_idx).size();
+        }
+        break;
+        case RunParams::CombinerOpt::Minimum : {
+          retval = kern->getMinDeviceTime(vid, tune_idx);
+        }
+        break;
+        case RunParams::CombinerOpt::Maximum : {
+          retval = kern->getMaxDeviceTime(vid, tune_idx);
+        }
+        break;
+        default : { getCout() << "\n Unknown CSV combiner mode = " << combiner << endl; }
+      }
+      break;
+    }
+    case CSVRepMode::IterationTiming : {
+      //
+      // Runtime of one rep divided by its iterations, for a latency bound
+      // kernel like Basic_POINTER_CHASE this is the time per load.
+      //
+      const long double its = static_cast<long double>(kern->getRunReps()) *
+                              kern->getItsPerRep();
+      if ( its > 0.0 ) {
+        retval = getReportDataEntry(CSVRepMode::Timing, combiner,
+                                    kern, vid, tune_idx) / its * 1.0e9;
+      }
+      break;
+    }
     case CSVRepMode::Speedup : {
       if ( haveReferenceVariant() ) {
         if ( kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) &&
@@ -1491,6 +8652,23 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
   return retval;
 }
 
+bool Executor::isSpeedupSignificant(KernelBase* kern, VariantID vid,
+                                    size_t tune_idx) const
+{
+  if ( vid == reference_vid && tune_idx == reference_tune_idx ) {
+    return true;
+  }
+  ConfidenceInterval ref_ci = computeConfidenceInterval(
+      kern->getPassTimes(reference_vid, reference_tune_idx));
+  ConfidenceInterval ci = computeConfidenceInterval(
+      kern->getPassTimes(vid, tune_idx));
+  if ( ref_ci.num < 2 || ci.num < 2 ) {
+    // can not tell with a single pass
+    return true;
+  }
+  return meansDifferSignificantly(ref_ci, ci);
+}
+
 void Executor::getFOMGroups(vector<FOMGroup>& fom_groups)
 {
   fom_groups.clear();
@@ -11,16 +11,24 @@
 
 #include "common/RAJAPerfSuite.hpp"
 #include "common/RunParams.hpp"
+#include "common/RPTypes.hpp"
+#include "common/TopologyUtils.hpp"
 
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
 #include "rajaperf_config.hpp"
 #endif
 
+#include <cstdio>
 #include <iosfwd>
 #include <streambuf>
+#include <map>
 #include <memory>
+#include <random>
 #include <utility>
 #include <set>
+#include <tuple>
+#include <string>
+#include <vector>
 
 namespace rajaperf {
 
@@ -50,6 +58,12 @@ public:
 
   void outputRunData();
 
+  /*!
+   * \brief Return nonzero if a kernel variant tuning regressed vs. the run
+   *        given to '--compare-to', zero otherwise.
+   */
+  int getExitStatus() const;
+
 private:
   Executor() = delete;
 
@@ -58,13 +72,83 @@ private:
   template < typename Kernel >
   KernelBase* makeKernel();
 
-  void runKernel(KernelBase* kern, bool print_kernel_name);
+  void runKernel(KernelBase* kern, bool print_kernel_name,
+                 KernelBase* next_kern = nullptr);
+  void runKernelTuning(KernelBase* kern, VariantID vid, size_t tune_idx,
+                       KernelBase* next_kern,
+                       std::pair<VariantID, size_t> last_tuning,
+                       std::pair<VariantID, size_t> next_tuning);
+
+  void runPasses();
+
+  bool pipelineSetUp() const;
+  std::vector<KernelBase*> getPassKernels(const std::vector<KernelBase*>& kerns);
+  std::vector<std::pair<VariantID, size_t>> getSelectedTunings(
+      const KernelBase* kern) const;
+
+  bool needsMorePasses(const KernelBase* kern) const;
+  void runPassesToCITarget();
+
+  void runSizeSweep();
+  void recordSizeSweepResults();
+
+  void makeRunPlanKernels();
+
+  void fitKernelsToMemory();
 
   void runWarmupKernels();
+  void runAdaptiveWarmup();
+
+  void calibrateKernelReps();
+
+  // dry run estimate of the run time of the suite
+  void writeRunTimeEstimate(std::ostream& str);
+
+  void runConcurrentKernels();
+
+  void runAppProxy();
+
+  void runCoExecution();
+
+  void runInterference();
+
+  void autotuneKernels();
+
+  void readTuningFile(const std::string& filename);
+
+  void readBaselineFile(const std::string& dirname);
+  void readScalingSeriesFile(const std::string& dirname);
+  void compareToBaseline();
+
+  void bindGPUDevice(bool verbose);
+  void gatherTopology();
+
+  std::string getProgressFileName() const;
+  void readProgressFile();
+  void openProgressFile();
+  bool resumePass(KernelBase* kern, VariantID vid, size_t tune_idx);
+  void runKernelIsolated(KernelBase* kern);
+  void writeProgressRecord(KernelBase* kern, VariantID vid, size_t tune_idx,
+                           Checksum_type pass_checksum);
+
+  bool readFileOnRank0(const std::string& filename, std::string& contents) const;
+
+  std::string getResultCacheFileName() const;
+  std::string getResultCacheKey(KernelBase* kern, VariantID vid, size_t tune_idx);
+  void readResultCacheFile();
+  void openResultCacheFile();
+  bool cachedPass(KernelBase* kern, VariantID vid, size_t tune_idx);
+  void writeResultCacheRecord(KernelBase* kern, VariantID vid, size_t tune_idx,
+                              Checksum_type pass_checksum);
+
+  bool isTuningSelected(const KernelBase* kern, VariantID vid,
+                        const std::string& tuning_name) const;
 
   enum CSVRepMode {
     Timing = 0,
     Speedup,
+    DeviceTiming,
+    IterationTiming,
 
     NumRepModes // Keep this one last and DO NOT remove (!!)
   };
@@ -73,9 +157,146 @@ private:
     std::vector<VariantID> variants;
   };
 
+  struct ConcurrentResult {
+    std::string kernel_names;
+    VariantID vid;
+    std::string tuning_name;
+    size_t num_kernels;
+    double serial_time;      // sum of times running kernels one at a time
+    double concurrent_time;  // time running kernels concurrently
+  };
+
+  struct InterferenceResult {
+    std::string kernel_name;
+    VariantID vid;
+    std::string tuning_name;
+    double idle_time;    // min pass time running alone
+    double loaded_time;  // min pass time running with the interference load
+  };
+
+  struct AdaptiveWarmupResult {
+    std::string kernel_name;
+    VariantID vid;
+    std::string tuning_name;
+    long reps;                // untimed reps run
+    bool converged;           // false -> stopped at the most reps
+    double first_rep_time;
+    double last_rep_time;
+  };
+
+  struct CoExecResult {
+    std::string kernel_name;
+    std::string cpu_tuning_name;
+    std::string gpu_tuning_name;
+    double cpu_time;          // time of the CPU part run alone
+    double gpu_time;          // time of the GPU part run alone
+    double cpu_co_time;       // time of the CPU part run with the GPU part
+    double gpu_co_time;       // time of the GPU part run with the CPU part
+    double co_time;           // wall time running both parts
+    double its;               // iterations of both parts over all reps
+    double gpu_full_time;     // time of the whole problem on the GPU in the
+                              // suite passes
+  };
+
+  struct AppProxyResult {
+    VariantID vid;
+    std::vector<std::string> kernel_names;  // in run plan order
+    std::vector<std::string> tuning_names;
+    std::vector<long> weights;               // reps per cycle
+    std::vector<double> isolated_times;      // per cycle from the suite passes
+    std::vector<double> interleaved_times;   // per cycle in the proxy run
+    double cycle_time;                       // wall time per proxy cycle
+  };
+
+  struct RegressionResult {
+    std::string kernel_name;
+    VariantID vid;
+    std::string tuning_name;
+    bool in_baseline;            // false -> not run in previous run
+    double base_time;            // min pass time of previous run
+    double time;                 // min pass time of this run
+    double threshold;            // time ratio above which it regressed
+  };
+
+  struct SizeSweepResult {
+    std::string kernel_name;
+    VariantID vid;
+    std::string tuning_name;
+    Index_type problem_size;
+    size_t footprint;            // bytes allocated in setUp
+    double time_per_rep;         // min pass time per rep
+    double bytes_per_rep;
+    double flops_per_rep;
+  };
+
+  struct MemoryFitResult {
+    std::string kernel_name;
+    Index_type requested_size;   // target size given on the command line
+    Index_type run_size;         // target size run, 0 if skipped
+    double requested_bytes;      // estimated bytes at requested_size
+    double run_bytes;            // estimated bytes at run_size
+    double budget_bytes;         // budget of the memory bounding the kernel
+    std::string action;          // fits, downsized, resized, or skipped
+  };
+
+  struct TuningDBEntry {
+    std::string tuning_name;     // fastest tuning
+    double time_per_rep;         // min pass time per rep of the tuning
+  };
+
+  // kernel, variant, data type, size bucket, and GPU model names
+  using TuningDBKey = std::tuple<std::string, std::string, std::string,
+                                 Index_type, std::string>;
+
+  TuningDBKey getTuningDBKey(const KernelBase* kern, VariantID vid,
+                             size_t tune_idx) const;
+  void readTuningDBFile(const std::string& filename);
+  void selectBestTunings();
+  void writeTuningDBReport(std::ostream& file);
+
+  struct ScalingPoint {
+    int num_ranks;
+    Index_type problem_size;     // problem size of each rank
+    double time_per_rep;         // min pass time per rep
+  };
+
+  struct ResumedPass {
+    Index_type reps;             // reps the pass ran
+    double time;                 // pass time
+    double device_time;          // pass GPU event time, nan if not recorded
+    Checksum_type checksum;      // checksum of the pass
+    double block_size;           // GPU block size, nan if not recorded
+    std::string cache_key;       // result cache key, empty if not recorded
+  };
+
+  // completed passes by kernel, variant, tuning name, problem size, and pass
+  using ResumedPassMap =
+      std::map<std::tuple<std::string, std::string, std::string, Index_type, int>,
+               ResumedPass>;
+
+  static void readProgressRecords(const std::string& contents,
+                                  ResumedPassMap& passes);
+
+  struct AutotuneResult {
+    std::string kernel_name;
+    VariantID vid;
+    DataType data_type;
+    std::string tuning_name;     // fastest tuning
+    double rep_time;             // rep time of fastest tuning
+    size_t num_tunings;          // number of tunings searched
+    size_t num_pruned;           // number of tunings pruned after first probe
+  };
+
   std::unique_ptr<std::ostream> openOutputFile(const std::string& filename) const;
 
+  // write the timeline recorded with '--trace', every rank writes its own
+  // file when running with more than one rank
+  void writeTraceFile(const std::string& out_fprefix) const;
+
   void writeKernelInfoSummary(std::ostream& str, bool to_file) const;
+  // suite wall time split into the phases of executing the kernels and
+  // the rest of the harness
+  void writeExecutePhaseSummary(std::ostream& str) const;
 
   void writeCSVReport(std::ostream& file, CSVRepMode mode,
                       RunParams::CombinerOpt combiner, size_t prec);
@@ -85,8 +306,70 @@ private:
                                  KernelBase* kern, VariantID vid, 
                                  size_t tune_idx);
 
+  bool isSpeedupSignificant(KernelBase* kern, VariantID vid,
+                            size_t tune_idx) const;
+
   void writeChecksumReport(std::ostream& file);
 
+  void writeTimingDistributionReport(std::ostream& file);
+
+  void writeConfidenceIntervalReport(std::ostream& file);
+  void writeTopologyReport(std::ostream& file);
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  void writeRankTimingReport(std::ostream& file);
+  void writeGPUSharingReport(std::ostream& file);
+#endif
+
+  void getPeakRates(std::vector<double>& peak_gbytes_per_sec,
+                    std::vector<double>& peak_gflops_per_sec,
+                    std::vector<std::vector<std::pair<std::string, double>>>& level_gbytes_per_sec,
+                    bool& mem_peak_run, bool& fma_peak_run);
+  void writeRooflineReport(std::ostream& file);
+  void writePatternReport(std::ostream& file);
+
+  std::string getRunDataMetadata() const;
+  void writeRunDataRecord(std::ostream& file, KernelBase* kern,
+                          VariantID vid, size_t tune_idx, size_t ip,
+                          int pass, Checksum_type checksum,
+                          const std::string& metadata);
+  void writeRunDataReport(std::ostream& file);
+
+  void writeCountersReport(std::ostream& file);
+  void writeBytesValidationReport(std::ostream& file);
+  void writeEnergyReport(std::ostream& file);
+
+  void writePhaseTimingReport(std::ostream& file);
+  void writeMetricsReport(std::ostream& file);
+
+  void writeDataPoolReport(std::ostream& file);
+
+  void writeConcurrentReport(std::ostream& file);
+
+  void writeInterferenceReport(std::ostream& file);
+
+  void writeAppProxyReport(std::ostream& file);
+
+  void writeCoExecReport(std::ostream& file);
+
+  void writeReproducibilityReport(std::ostream& file);
+  void writeColdCacheReport(std::ostream& file);
+  void writeOpenMPScalingReport(std::ostream& file);
+  void writeGPUSweepReport(std::ostream& file);
+  void writePageFaultsReport(std::ostream& file);
+  void writeDeviceMemoryReport(std::ostream& file);
+  void writeGPUTelemetryReport(std::ostream& file);
+  void writeDeviceActivityReport(std::ostream& file);
+  void writeWarmupReport(std::ostream& file);
+  void writeGPUFuncAttributesReport(std::ostream& file);
+
+  void writeSizeSweepReport(std::ostream& file);
+  void writeMemoryFitReport(std::ostream& file);
+  void writeMPIScalingReport(std::ostream& file);
+
+  void writeAutotuneReport(std::ostream& file);
+
+  void writeRegressionReport(std::ostream& file);
+
   void writeFOMReport(std::ostream& file, std::vector<FOMGroup>& fom_groups);
   void getFOMGroups(std::vector<FOMGroup>& fom_groups);
 
@@ -95,6 +378,76 @@ private:
   std::vector<VariantID>   variant_ids;
   std::vector<std::string> tuning_names[NumVariants];
 
+  std::vector<ConcurrentResult> concurrent_results;
+
+  std::vector<InterferenceResult> interference_results;
+
+  std::vector<AppProxyResult> app_proxy_results;
+
+  std::vector<CoExecResult> co_exec_results;
+
+  std::vector<AdaptiveWarmupResult> warmup_results;
+
+  std::vector<SizeSweepResult> size_sweep_results;
+
+  std::vector<MemoryFitResult> memory_fit_results;
+
+  // wall time in seconds of runSuite
+  double suite_wall_time = 0.0;
+
+  // tunings to run for a kernel and variant, chosen by autotuning or read
+  // from a tuning file, in place of tuning_names for that variant
+  std::map<std::pair<std::string, VariantID>,
+           std::vector<std::string>> kernel_tuning_names;
+
+  std::vector<AutotuneResult> autotune_results;
+
+  // best tunings read from the '--tuning-db' file
+  std::map<TuningDBKey, TuningDBEntry> tuning_db;
+
+  // run plan configuration of each kernel made for '--run-plan', its
+  // tunings are run in place of tuning_names and its reps are not calibrated
+  std::map<const KernelBase*,
+           const RunParams::RunPlanEntry*> run_plan_entries;
+
+  // min and max pass times of the run given to '--compare-to' by kernel,
+  // variant, and tuning name
+  std::map<std::tuple<std::string, std::string, std::string>,
+           std::pair<double, double>> baseline_times;
+
+  // min time per rep of the runs given to '--scaling-series' by kernel,
+  // variant, and tuning name
+  std::map<std::tuple<std::string, std::string, std::string>,
+           std::vector<ScalingPoint>> scaling_series;
+
+  std::vector<RegressionResult> regression_results;
+
+  // passes completed in the interrupted run given to '--resume'
+  ResumedPassMap resumed_passes;
+
+  // completed passes are appended to this file as they finish,
+  // only open on rank 0
+  FILE* progress_file = nullptr;
+  std::string progress_metadata;
+
+  // passes in the result cache given to '--incremental', reused if their
+  // key matches, passes run are appended to the file, only open on rank 0
+  ResumedPassMap cached_passes;
+  FILE* result_cache_file = nullptr;
+  std::map<std::string, uint64_t> kernel_code_hashes;
+  size_t num_cached_passes = 0;
+
+  // shuffles kernel and variant tuning order with '--random-order', seeded
+  // with the seed of rank 0 so all ranks run the same order
+  unsigned long long random_order_seed = 0;
+  std::mt19937_64 random_order_engine;
+
+  // placement of this rank found in setupSuite, and on rank 0 the rows of
+  // the topology file and the placement warnings of all ranks
+  detail::RankPlacement rank_placement;
+  std::vector<std::string> topology_rows;
+  std::vector<std::string> topology_warnings;
+
   VariantID reference_vid;
   size_t    reference_tune_idx;
 
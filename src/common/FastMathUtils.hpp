@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for the fast_math tunings of kernels limited by the throughput of
+/// math library functions.
+///
+/// The fast methods compute in single precision with the fast intrinsics of
+/// the device, ie. __expf and __fdividef, and with the single precision
+/// math library on the host, which the compiler may vectorize with a vector
+/// math library, ie. libmvec or SVML, in simd loops. Their results differ
+/// from those of the precise double precision functions the other tunings
+/// use, so the tunings are only added when '--fast-math' is given, then the
+/// checksum report gives the difference for each tuning.
+///
+
+#ifndef RAJAPerf_FastMathUtils_HPP
+#define RAJAPerf_FastMathUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+#include "common/RPTypes.hpp"
+
+#include <cmath>
+#include <string>
+
+namespace rajaperf
+{
+
+namespace fast_math
+{
+
+RAJA_HOST_DEVICE RAJA_INLINE Real_type exp(Real_type x)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __expf(static_cast<float>(x));
+#else
+  return std::exp(static_cast<float>(x));
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Real_type sqrt(Real_type x)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __fsqrt_rn(static_cast<float>(x));
+#else
+  return std::sqrt(static_cast<float>(x));
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Real_type rsqrt(Real_type x)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return rsqrtf(static_cast<float>(x));
+#else
+  return 1.0f / std::sqrt(static_cast<float>(x));
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Real_type div(Real_type a, Real_type b)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __fdividef(static_cast<float>(a), static_cast<float>(b));
+#else
+  return static_cast<float>(a) / static_cast<float>(b);
+#endif
+}
+
+/*!
+ * \brief Return the name of a fast math tuning, ie. fast_math for CPU
+ *        variants and fast_math_block_256 for GPU variants with block_size.
+ */
+inline std::string getTuningName(size_t block_size = 0)
+{
+  if (block_size == 0) {
+    return "fast_math";
+  }
+  return "fast_math_block_" + std::to_string(block_size);
+}
+
+}  // closing brace for fast_math namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,200 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GPUClockUtils.hpp"
+
+#if defined(RAJA_PERFSUITE_USE_NVML)
+#include <nvml.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+#include <amd_smi/amdsmi.h>
+#endif
+
+#include <cstdio>
+#include <stdexcept>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+namespace
+{
+
+bool control_initialized = false;
+
+#if defined(RAJA_PERFSUITE_USE_NVML)
+nvmlDevice_t nvml_device;
+unsigned int nvml_default_power_limit_mw = 0;
+unsigned int nvml_mem_clock_mhz = 0;
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+amdsmi_processor_handle amdsmi_device;
+uint64_t amdsmi_default_power_cap_uw = 0;
+uint64_t amdsmi_min_gfx_clock_mhz = 0;
+#endif
+
+/*!
+ * \brief Throw if the setting could not be applied.
+ */
+void checkApplied(bool ok, const RunParams::GPUSetting& setting)
+{
+  if (!ok) {
+    throw std::runtime_error("applyGPUSetting : Can't set GPU " +
+                             setting.getName() +
+                             ", setting clocks and power limits may need "
+                             "administrator permissions");
+  }
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Initialize control of the GPU with the given PCI bus id.
+ */
+void initGPUControl(const std::string& pci_bus_id,
+                    const std::vector<RunParams::GPUSetting>& settings)
+{
+#if defined(RAJA_PERFSUITE_USE_NVML)
+  if (!control_initialized && nvmlInit() == NVML_SUCCESS) {
+    if (nvmlDeviceGetHandleByPciBusId(pci_bus_id.c_str(), &nvml_device) == NVML_SUCCESS &&
+        nvmlDeviceGetPowerManagementDefaultLimit(nvml_device,
+            &nvml_default_power_limit_mw) == NVML_SUCCESS &&
+        nvmlDeviceGetApplicationsClock(nvml_device, NVML_CLOCK_MEM,
+            &nvml_mem_clock_mhz) == NVML_SUCCESS) {
+      control_initialized = true;
+    } else {
+      nvmlShutdown();
+    }
+  }
+#endif
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+  unsigned int domain = 0, bus = 0, device = 0, function = 0;
+  if (!control_initialized &&
+      std::sscanf(pci_bus_id.c_str(), "%x:%x:%x.%x",
+                  &domain, &bus, &device, &function) == 4 &&
+      amdsmi_init(AMDSMI_INIT_AMD_GPUS) == AMDSMI_STATUS_SUCCESS) {
+    amdsmi_bdf_t bdf;
+    bdf.domain_number = domain;
+    bdf.bus_number = bus;
+    bdf.device_number = device;
+    bdf.function_number = function;
+    amdsmi_power_cap_info_t cap_info;
+    amdsmi_clk_info_t clk_info;
+    if (amdsmi_get_processor_handle_from_bdf(bdf, &amdsmi_device) ==
+            AMDSMI_STATUS_SUCCESS &&
+        amdsmi_get_power_cap_info(amdsmi_device, 0, &cap_info) ==
+            AMDSMI_STATUS_SUCCESS &&
+        amdsmi_get_clock_info(amdsmi_device, AMDSMI_CLK_TYPE_GFX, &clk_info) ==
+            AMDSMI_STATUS_SUCCESS) {
+      amdsmi_default_power_cap_uw = cap_info.default_power_cap;
+      amdsmi_min_gfx_clock_mhz = clk_info.min_clk;
+      control_initialized = true;
+    } else {
+      amdsmi_shut_down();
+    }
+  }
+#endif
+  if (!control_initialized) {
+    throw std::runtime_error("initGPUControl : Can't control clocks or power "
+                             "limit with NVML or AMD SMI of GPU " + pci_bus_id);
+  }
+
+  // try each setting now instead of failing part way through the run
+  for (const RunParams::GPUSetting& setting : settings) {
+    try {
+      applyGPUSetting(setting);
+    } catch (...) {
+      resetGPUSettings();
+      finalizeGPUControl();
+      throw;
+    }
+    resetGPUSettings();
+  }
+}
+
+/*
+ * Reset the GPU and release resources used for control.
+ */
+void finalizeGPUControl()
+{
+  if (!control_initialized) {
+    return;
+  }
+  resetGPUSettings();
+#if defined(RAJA_PERFSUITE_USE_NVML)
+  nvmlShutdown();
+#endif
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+  amdsmi_shut_down();
+#endif
+  control_initialized = false;
+}
+
+/*
+ * Apply a setting to the GPU.
+ */
+void applyGPUSetting(const RunParams::GPUSetting& setting)
+{
+  bool ok = false;
+  const unsigned int value = static_cast<unsigned int>(setting.value);
+
+#if defined(RAJA_PERFSUITE_USE_NVML)
+  if (control_initialized) {
+    if (setting.kind == RunParams::GPUSetting::ClockMHz) {
+      ok = nvmlDeviceSetApplicationsClocks(nvml_device, nvml_mem_clock_mhz,
+                                           value) == NVML_SUCCESS;
+    } else {
+      ok = nvmlDeviceSetPowerManagementLimit(nvml_device,
+                                             value * 1000u) == NVML_SUCCESS;
+    }
+  }
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+  if (control_initialized) {
+    if (setting.kind == RunParams::GPUSetting::ClockMHz) {
+      ok = amdsmi_set_gpu_clk_range(amdsmi_device, amdsmi_min_gfx_clock_mhz,
+                                    value, AMDSMI_CLK_TYPE_GFX) ==
+           AMDSMI_STATUS_SUCCESS;
+    } else {
+      ok = amdsmi_set_power_cap(amdsmi_device, 0,
+                                static_cast<uint64_t>(value) * 1000000u) ==
+           AMDSMI_STATUS_SUCCESS;
+    }
+  }
+#endif
+
+  static_cast<void>(value);
+  checkApplied(ok, setting);
+}
+
+/*
+ * Reset the GPU clocks and power limit to their defaults.
+ */
+void resetGPUSettings()
+{
+  if (!control_initialized) {
+    return;
+  }
+#if defined(RAJA_PERFSUITE_USE_NVML)
+  nvmlDeviceResetApplicationsClocks(nvml_device);
+  nvmlDeviceSetPowerManagementLimit(nvml_device, nvml_default_power_limit_mw);
+#endif
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+  amdsmi_set_gpu_perf_level(amdsmi_device, AMDSMI_DEV_PERF_LEVEL_AUTO);
+  amdsmi_set_power_cap(amdsmi_device, 0, amdsmi_default_power_cap_uw);
+#endif
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
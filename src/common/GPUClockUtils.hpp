@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for setting GPU clock caps and power limits of the tunings of
+/// '--gpu-clocks' and '--gpu-power-limits'.
+///
+/// Settings are made with NVML when the suite is built with
+/// RAJA_PERFSUITE_USE_NVML and with AMD SMI when the suite is built with
+/// RAJA_PERFSUITE_USE_AMDSMI. Setting clocks and power limits usually needs
+/// administrator permissions, so each setting is tried when initialized.
+///
+
+#ifndef RAJAPerf_GPUClockUtils_HPP
+#define RAJAPerf_GPUClockUtils_HPP
+
+#include "common/RunParams.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Initialize control of the GPU with the given PCI bus id,
+ * ie. 0000:3b:00.0, and try each setting.
+ *
+ * Throws std::runtime_error if the GPU can not be controlled or a setting
+ * is not permitted.
+ */
+void initGPUControl(const std::string& pci_bus_id,
+                    const std::vector<RunParams::GPUSetting>& settings);
+
+/*!
+ * \brief Reset the GPU to its default settings and release resources
+ * used for control.
+ */
+void finalizeGPUControl();
+
+/*!
+ * \brief Apply a setting to the GPU.
+ *
+ * Throws std::runtime_error if the setting can not be applied.
+ */
+void applyGPUSetting(const RunParams::GPUSetting& setting);
+
+/*!
+ * \brief Reset the GPU clocks and power limit to their defaults.
+ */
+void resetGPUSettings();
+
+/*!
+ * \brief Apply a setting while in scope, nullptr for the default settings.
+ */
+class ScopedGPUSetting
+{
+public:
+  explicit ScopedGPUSetting(const RunParams::GPUSetting* setting)
+    : m_applied(setting != nullptr)
+  {
+    if (m_applied) {
+      applyGPUSetting(*setting);
+    }
+  }
+
+  ~ScopedGPUSetting()
+  {
+    if (m_applied) {
+      resetGPUSettings();
+    }
+  }
+
+  ScopedGPUSetting(ScopedGPUSetting const&) = delete;
+  ScopedGPUSetting& operator=(ScopedGPUSetting const&) = delete;
+
+private:
+  bool m_applied;
+};
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
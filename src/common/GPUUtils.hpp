@@ -15,6 +15,9 @@
 #define RAJAPerf_GPUUtils_HPP
 
 #include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include <string>
 
 namespace rajaperf
 {
@@ -138,6 +141,36 @@ struct ExactSqrt
   static constexpr bool valid() { return sqrt(I)*sqrt(I) == I; }
 };
 
+// true if I is a power of two, false otherwise
+struct PowerOfTwo
+{
+  template < size_t I >
+  static constexpr bool valid() { return I > 0 && (I & (I-1)) == 0; }
+};
+
+// true if I is at most N, false otherwise
+template < size_t N >
+struct AtMost
+{
+  template < size_t I >
+  static constexpr bool valid() { return I <= N; }
+};
+
+// true if I is valid according to all of validity_checkers, false otherwise
+template < typename... validity_checkers >
+struct AllOf
+{
+  template < size_t I >
+  static constexpr bool valid()
+  {
+    bool valids[] = {true, validity_checkers::template valid<I>()...};
+    for (bool v : valids) {
+      if (!v) { return false; }
+    }
+    return true;
+  }
+};
+
 template < size_t... block_sizes >
 using list_type = camp::int_seq<size_t, block_sizes...>;
 
@@ -156,6 +189,265 @@ using make_list_type =
 
 } // closing brace for gpu_block_size namespace
 
+namespace gpu_tile_size
+{
+
+// constexpr return the number of outputs each thread computes so that a
+// tile_size x tile_size tile is computed by at most max_threads threads
+constexpr size_t reg_size(size_t tile_size, size_t max_threads)
+{
+  return (tile_size*tile_size > max_threads)
+      ? (tile_size*tile_size) / max_threads
+      : 1;
+}
+
+// return name of tile tuning, ie. tile_16 or tile_32_reg_4
+inline std::string tuning_name(size_t tile_size, size_t reg_size)
+{
+  std::string name = "tile_"+std::to_string(tile_size);
+  if (reg_size > 1) {
+    name += "_reg_"+std::to_string(reg_size);
+  }
+  return name;
+}
+
+} // closing brace for gpu_tile_size namespace
+
+namespace gpu_min_blocks
+{
+
+// minimum numbers of resident blocks per SM requested with the second
+// argument of __launch_bounds__ by the min blocks tunings, the compiler
+// limits the registers per thread so that many blocks fit
+using list_type = camp::int_seq<size_t, 2, 4>;
+
+// resident threads per SM, min blocks tunings of more threads are skipped
+constexpr size_t max_threads = 2048;
+
+constexpr bool valid(size_t block_size, size_t min_blocks)
+{
+  return block_size*min_blocks <= max_threads;
+}
+
+// min blocks limited to what fits, for instantiations that are not run
+constexpr size_t clamp(size_t block_size, size_t min_blocks)
+{
+  return valid(block_size, min_blocks)
+      ? min_blocks
+      : ((max_threads / block_size > 0) ? max_threads / block_size : 1);
+}
+
+// the second argument of __launch_bounds__ in HIP is the minimum number of
+// waves per execution unit, a CU has 4 execution units
+constexpr size_t hip_min_waves_per_eu(size_t block_size, size_t min_blocks)
+{
+  return (clamp(block_size, min_blocks)*block_size / (4*64) > 0)
+      ? clamp(block_size, min_blocks)*block_size / (4*64)
+      : 1;
+}
+
+// return name of min blocks tuning, ie. block_256_minblocks_4
+inline std::string tuning_name(size_t block_size, size_t min_blocks)
+{
+  return "block_"+std::to_string(block_size)+"_minblocks_"+std::to_string(min_blocks);
+}
+
+} // closing brace for gpu_min_blocks namespace
+
+namespace gpu_block_shape
+{
+
+// x extents, in threads, of the block shape tunings of multi-dimensional
+// kernels, the y extent, and z extent of 3D shapes, make up the rest of
+// each block size
+using x_list_type = camp::int_seq<size_t, 8, 16, 32, 64, 128, 256>;
+
+// z extents of the 3D block shape tunings
+using z_list_type = camp::int_seq<size_t, 1, 2, 4, 8>;
+
+constexpr bool valid(size_t block_size, size_t x_size, size_t z_size)
+{
+  return x_size*z_size <= block_size && (block_size/(x_size*z_size))*(x_size*z_size) == block_size;
+}
+
+// y extent of the shape, 1 for instantiations that are not run
+constexpr size_t y_size(size_t block_size, size_t x_size, size_t z_size)
+{
+  return valid(block_size, x_size, z_size)
+      ? block_size/(x_size*z_size)
+      : 1;
+}
+
+// z extent of the shape, 1 for instantiations that are not run, so their
+// launch bounds stay within the shape x extent
+constexpr size_t z_size(size_t block_size, size_t x_size, size_t z_size)
+{
+  return valid(block_size, x_size, z_size)
+      ? z_size
+      : 1;
+}
+
+// return name of 2D block shape tuning, ie. shape_64x4
+inline std::string tuning_name(size_t block_size, size_t x_size)
+{
+  return "shape_"+std::to_string(x_size)+"x"+std::to_string(y_size(block_size, x_size, 1));
+}
+
+// return name of 3D block shape tuning, ie. shape_32x4x2
+inline std::string tuning_name(size_t block_size, size_t x_size, size_t z_size)
+{
+  return "shape_"+std::to_string(x_size)+"x"+std::to_string(y_size(block_size, x_size, z_size))+
+         "x"+std::to_string(z_size);
+}
+
+// return name of 2.5D block shape tuning that marches through z,
+// ie. shape_32x8_march
+inline std::string march_tuning_name(size_t block_size, size_t x_size)
+{
+  return tuning_name(block_size, x_size)+"_march";
+}
+
+} // closing brace for gpu_block_shape namespace
+
+namespace gpu_coarsen
+{
+
+// items computed by each thread of the coarsened tunings, 1 is the usual
+// block size tuning
+using items_per_thread_type = camp::int_seq<size_t, 2, 4, 8>;
+
+// items loaded and stored with one vector access by the vec tunings
+using vec_widths_type = camp::int_seq<size_t, 2, 4>;
+
+// vec tunings are defined if data is aligned to vectors of vec_width
+// doubles, the largest data type
+constexpr bool valid_vec(size_t data_alignment, size_t vec_width)
+{
+  return data_alignment % (vec_width*sizeof(double)) == 0;
+}
+
+// vec_width values of T loaded or stored with one access
+template < typename T, size_t vec_width >
+struct alignas(vec_width*sizeof(T)) vec_type
+{
+  T v[vec_width];
+};
+
+// return name of coarsened tuning, ie. block_256_contiguous_4 or
+// block_256_strided_4
+inline std::string tuning_name(size_t block_size, size_t items_per_thread, bool strided)
+{
+  return "block_"+std::to_string(block_size)+
+         (strided ? "_strided_" : "_contiguous_")+std::to_string(items_per_thread);
+}
+
+// return name of vec tuning, ie. block_256_vec_2
+inline std::string vec_tuning_name(size_t block_size, size_t vec_width)
+{
+  return "block_"+std::to_string(block_size)+"_vec_"+std::to_string(vec_width);
+}
+
+} // closing brace for gpu_coarsen namespace
+
+namespace gpu_read_only
+{
+
+// return name of read only tuning, ie. ldg_block_256
+inline std::string tuning_name(size_t block_size)
+{
+  return "ldg_block_"+std::to_string(block_size);
+}
+
+} // closing brace for gpu_read_only namespace
+
+namespace gpu_launch
+{
+
+// return name of launch tuning, ie. launch_block_256
+inline std::string tuning_name(size_t block_size)
+{
+  return "launch_block_"+std::to_string(block_size);
+}
+
+} // closing brace for gpu_launch namespace
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+///
+/// Pointer to data a kernel only reads, loaded with __ldg through the
+/// read-only data cache. It indexes and offsets like a pointer so kernel
+/// bodies use it unchanged. HIP has no separate read-only path, there
+/// __ldg is a plain load and only the const __restrict__ hint is left.
+///
+template < typename T >
+struct ReadOnlyPtr
+{
+  const T* __restrict__ ptr;
+
+  RAJA_HOST_DEVICE
+  ReadOnlyPtr(const T* p = nullptr) : ptr(p) { }
+
+  RAJA_DEVICE
+  T operator[](Index_type i) const
+  { return __ldg(ptr + i); }
+
+  RAJA_HOST_DEVICE
+  ReadOnlyPtr operator+(Index_type offset) const
+  { return ReadOnlyPtr(ptr + offset); }
+};
+
+///
+/// Array of pointers a kernel only reads, the pointers and the data they
+/// point to are loaded with __ldg.
+///
+template < typename T >
+struct ReadOnlyPtr<T*>
+{
+  T* const* __restrict__ ptr;
+
+  RAJA_HOST_DEVICE
+  ReadOnlyPtr(T* const* p = nullptr) : ptr(p) { }
+
+  RAJA_DEVICE
+  ReadOnlyPtr<T> operator[](Index_type i) const
+  {
+    static_assert(sizeof(T*) == sizeof(unsigned long long), "Unsupported pointer size");
+    return ReadOnlyPtr<T>(reinterpret_cast<const T*>(
+        __ldg(reinterpret_cast<const unsigned long long*>(ptr + i))));
+  }
+
+  RAJA_HOST_DEVICE
+  ReadOnlyPtr operator+(Index_type offset) const
+  { return ReadOnlyPtr(ptr + offset); }
+};
+
+namespace gpu_read_only
+{
+
+// pointer type of read only data in kernels templated on read_only, the
+// read only tunings use ReadOnlyPtr and the others T*
+template < typename T, bool read_only >
+using ptr_type = typename std::conditional<read_only, ReadOnlyPtr<T>, T*>::type;
+
+} // closing brace for gpu_read_only namespace
+#endif
+
+///
+/// Registers and local memory per thread of a GPU kernel, its static and
+/// dynamic shared memory per block, and its theoretical occupancy, the
+/// fraction of the resident threads of an SM it can use, as given by
+/// cudaFuncGetAttributes or hipFuncGetAttributes. Local memory is mostly
+/// register spills.
+///
+struct GPUFuncAttributes
+{
+  std::string name;
+  int num_regs = -1;
+  size_t local_bytes = 0;
+  size_t static_shmem_bytes = 0;
+  size_t dynamic_shmem_bytes = 0;
+  double occupancy = 0.0;
+};
+
 //compile time loop over an integer sequence
 //this allows for creating a loop over a compile time constant variable
 template <typename Func, typename T, T... ts>
@@ -195,4 +487,797 @@ inline void seq_for(camp::int_seq<T, ts...> const&, Func&& func)
     });                                                                        \
   }
 
+//
+// Same as above for kernels templated on element data type, defines
+// run<variant>VariantTyped calling run<variant>VariantImpl<Data_type, block_size>,
+// run<variant>Variant is defined with a data type run boilerplate macro.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_TYPED_BOILERPLATE(kernel, variant) \
+  template < typename Data_type >                                              \
+  void kernel::run##variant##VariantTyped(VariantID vid, size_t tune_idx)      \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<Data_type, block_size>(vid);               \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+  }
+
+//
+// Block size tunings followed by launch tunings for launch_vid, which call
+// run<variant>VariantImpl<block_size, true> for each block size, see
+// common/LaunchUtils.hpp.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(kernel, variant, launch_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<block_size>(vid);                          \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_RUN(variant, Impl, )                          \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_NAMES                                         \
+    }                                                                          \
+  }
+
+//
+// Same as above for kernels templated on element data type, see
+// RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_TYPED_BOILERPLATE.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_TYPED_BOILERPLATE(kernel, variant, launch_vid) \
+  template < typename Data_type >                                              \
+  void kernel::run##variant##VariantTyped(VariantID vid, size_t tune_idx)      \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<Data_type, block_size>(vid);               \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_RUN(variant, Impl, RAJAPERF_GPU_LAUNCH_TYPED_TPARAMS) \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_NAMES                                         \
+    }                                                                          \
+  }
+
+//
+// Same as above followed by nontemporal tunings for nontemporal_vid, which
+// call run<variant>VariantNontemporal<Data_type, block_size> for each
+// block size, see common/NontemporalUtils.hpp, and launch tunings for
+// launch_vid.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_NONTEMPORAL_TUNING_DEFINE_TYPED_BOILERPLATE(kernel, variant, nontemporal_vid, launch_vid) \
+  template < typename Data_type >                                              \
+  void kernel::run##variant##VariantTyped(VariantID vid, size_t tune_idx)      \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<Data_type, block_size>(vid);               \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == nontemporal_vid) {                                              \
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                   \
+        if (run_params.numValidGPUBlockSize() == 0u ||                         \
+            run_params.validGPUBlockSize(block_size)) {                        \
+          if (tune_idx == t) {                                                 \
+            setBlockSize(block_size);                                          \
+            run##variant##VariantNontemporal<Data_type, block_size>(vid);      \
+          }                                                                    \
+          t += 1;                                                              \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_RUN(variant, Impl, RAJAPERF_GPU_LAUNCH_TYPED_TPARAMS) \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == nontemporal_vid) {                                              \
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                   \
+        if (run_params.numValidGPUBlockSize() == 0u ||                         \
+            run_params.validGPUBlockSize(block_size)) {                        \
+          addVariantTuningName(vid,                                            \
+              "nontemporal_block_"+std::to_string(block_size));                \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_NAMES                                         \
+    }                                                                          \
+  }
+
+//
+// Block size tunings followed by graph tunings for graph_vid. Graph tunings
+// replay the launches of one rep captured once in a GPU graph, they are not
+// available when running on stream 0 as it can not be captured.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_GRAPH_TUNING_DEFINE_BOILERPLATE(kernel, variant, graph_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<block_size>(vid);                          \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == graph_vid && run_params.getGPUStream() != 0) {                  \
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                   \
+        if (run_params.numValidGPUBlockSize() == 0u ||                         \
+            run_params.validGPUBlockSize(block_size)) {                        \
+          if (tune_idx == t) {                                                 \
+            setBlockSize(block_size);                                          \
+            run##variant##VariantGraph<block_size>(vid);                       \
+          }                                                                    \
+          t += 1;                                                              \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == graph_vid && run_params.getGPUStream() != 0) {                  \
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                   \
+        if (run_params.numValidGPUBlockSize() == 0u ||                         \
+            run_params.validGPUBlockSize(block_size)) {                        \
+          addVariantTuningName(vid, "graph_"+std::to_string(block_size));      \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  }
+
+
+//
+// Block size tunings followed by persistent tunings for persistent_vid.
+// Persistent tunings call run<variant>VariantPersistent<block_size>, which
+// launches one cooperative kernel that loops over the reps on the device and
+// synchronizes the grid where the other tunings start a new kernel. They are
+// only available on devices that support cooperative launches. Launch
+// tunings for launch_vid follow.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_PERSISTENT_TUNING_DEFINE_BOILERPLATE(kernel, variant, persistent_vid, launch_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<block_size>(vid);                          \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == persistent_vid && detail::have##variant##CooperativeLaunch()) { \
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                   \
+        if (run_params.numValidGPUBlockSize() == 0u ||                         \
+            run_params.validGPUBlockSize(block_size)) {                        \
+          if (tune_idx == t) {                                                 \
+            setBlockSize(block_size);                                          \
+            run##variant##VariantPersistent<block_size>(vid);                  \
+          }                                                                    \
+          t += 1;                                                              \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_RUN(variant, Impl, )                          \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == persistent_vid && detail::have##variant##CooperativeLaunch()) { \
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                   \
+        if (run_params.numValidGPUBlockSize() == 0u ||                         \
+            run_params.validGPUBlockSize(block_size)) {                        \
+          addVariantTuningName(vid, "persistent_"+std::to_string(block_size)); \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_NAMES                                         \
+    }                                                                          \
+  }
+
+//
+// Block size tunings followed by tile tunings for tile_vid. Tile tunings
+// call run<variant>VariantTiled<tile_size, reg_size> for each tile size in
+// gpu_tile_sizes_type, with reg_size chosen so blocks have at most
+// default_gpu_block_size threads.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_TILE_TUNING_DEFINE_BOILERPLATE(kernel, variant, tile_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<block_size>(vid);                          \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == tile_vid) {                                                     \
+      seq_for(gpu_tile_sizes_type{}, [&](auto tile_size) {                     \
+        constexpr size_t reg_size =                                            \
+            gpu_tile_size::reg_size(tile_size, default_gpu_block_size);        \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(tile_size*(tile_size/reg_size));                        \
+          run##variant##VariantTiled<tile_size, reg_size>(vid);                \
+        }                                                                      \
+        t += 1;                                                                \
+      });                                                                      \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == tile_vid) {                                                     \
+      seq_for(gpu_tile_sizes_type{}, [&](auto tile_size) {                     \
+        addVariantTuningName(vid, gpu_tile_size::tuning_name(tile_size,        \
+            gpu_tile_size::reg_size(tile_size, default_gpu_block_size)));      \
+      });                                                                      \
+    }                                                                          \
+  }
+
+
+//
+// Block size tunings followed by min blocks tunings for min_blocks_vid.
+// Min blocks tunings call run<variant>VariantImpl<block_size, min_blocks>
+// for each block size and each min blocks in gpu_min_blocks::list_type
+// whose blocks fit in an SM together.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_MIN_BLOCKS_TUNING_DEFINE_BOILERPLATE(kernel, variant, min_blocks_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<block_size>(vid);                          \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == min_blocks_vid) {                                               \
+      RAJAPERF_GPU_MIN_BLOCKS_TUNING_RUN(variant, Impl)                        \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == min_blocks_vid) {                                               \
+      RAJAPERF_GPU_MIN_BLOCKS_TUNING_NAMES                                     \
+    }                                                                          \
+  }
+
+//
+// Parts of the min blocks tunings for kernels that define their own
+// run<variant>Variant, the run part calls run<variant>Variant<impl> and
+// expects tune_idx and the tuning counter t.
+//
+#define RAJAPERF_GPU_MIN_BLOCKS_TUNING_RUN(variant, impl)                      \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      seq_for(gpu_min_blocks::list_type{}, [&](auto min_blocks) {              \
+        if (gpu_min_blocks::valid(block_size, min_blocks)) {                   \
+          if (tune_idx == t) {                                                 \
+            setBlockSize(block_size);                                          \
+            run##variant##Variant##impl<block_size,                            \
+                gpu_min_blocks::clamp(block_size, min_blocks)>(vid);           \
+          }                                                                    \
+          t += 1;                                                              \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  });
+
+#define RAJAPERF_GPU_MIN_BLOCKS_TUNING_NAMES                                   \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      seq_for(gpu_min_blocks::list_type{}, [&](auto min_blocks) {              \
+        if (gpu_min_blocks::valid(block_size, min_blocks)) {                   \
+          addVariantTuningName(vid,                                            \
+              gpu_min_blocks::tuning_name(block_size, min_blocks));            \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  });
+
+//
+// Block size tunings followed by block shape tunings for shape_vid of 2D
+// kernels, see RAJAPERF_GPU_SHAPE_2D_TUNING_RUN.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_SHAPE_2D_TUNING_DEFINE_BOILERPLATE(kernel, variant, shape_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<block_size>(vid);                          \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == shape_vid) {                                                    \
+      RAJAPERF_GPU_SHAPE_2D_TUNING_RUN(variant)                                \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == shape_vid) {                                                    \
+      RAJAPERF_GPU_SHAPE_2D_TUNING_NAMES                                       \
+    }                                                                          \
+  }
+
+//
+// Block size tunings followed by block shape and z marching tunings for
+// shape_vid of 3D kernels, see RAJAPERF_GPU_SHAPE_3D_TUNING_RUN.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_SHAPE_3D_TUNING_DEFINE_BOILERPLATE(kernel, variant, shape_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<block_size>(vid);                          \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == shape_vid) {                                                    \
+      RAJAPERF_GPU_SHAPE_3D_TUNING_RUN(variant)                                \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == shape_vid) {                                                    \
+      RAJAPERF_GPU_SHAPE_3D_TUNING_NAMES                                       \
+    }                                                                          \
+  }
+
+//
+// Parts of the block shape tunings for multi-dimensional kernels that
+// define their own run<variant>Variant. The 2D run part calls
+// run<variant>VariantShape<x_size, y_size>, and the 3D run part calls
+// run<variant>VariantShape<x_size, y_size, z_size>, for each block size
+// and each shape in gpu_block_shape of that many threads. The 3D run part
+// then calls run<variant>VariantMarch<x_size, y_size> for each 2D shape,
+// whose threads each march through all of z (2.5D blocking). They expect
+// tune_idx and the tuning counter t.
+//
+#define RAJAPERF_GPU_SHAPE_2D_TUNING_RUN(variant)                              \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      seq_for(gpu_block_shape::x_list_type{}, [&](auto x_size) {               \
+        if (gpu_block_shape::valid(block_size, x_size, 1)) {                   \
+          if (tune_idx == t) {                                                 \
+            setBlockSize(block_size);                                          \
+            run##variant##VariantShape<x_size,                                 \
+                gpu_block_shape::y_size(block_size, x_size, 1)>(vid);          \
+          }                                                                    \
+          t += 1;                                                              \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  });
+
+#define RAJAPERF_GPU_SHAPE_2D_TUNING_NAMES                                     \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      seq_for(gpu_block_shape::x_list_type{}, [&](auto x_size) {               \
+        if (gpu_block_shape::valid(block_size, x_size, 1)) {                   \
+          addVariantTuningName(vid,                                            \
+              gpu_block_shape::tuning_name(block_size, x_size));               \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  });
+
+#define RAJAPERF_GPU_SHAPE_3D_TUNING_RUN(variant)                              \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      seq_for(gpu_block_shape::x_list_type{}, [&](auto x_size) {               \
+        seq_for(gpu_block_shape::z_list_type{}, [&](auto z_size) {             \
+          if (gpu_block_shape::valid(block_size, x_size, z_size)) {            \
+            if (tune_idx == t) {                                               \
+              setBlockSize(block_size);                                        \
+              run##variant##VariantShape<x_size,                               \
+                  gpu_block_shape::y_size(block_size, x_size, z_size),         \
+                  gpu_block_shape::z_size(block_size, x_size, z_size)>(vid);   \
+            }                                                                  \
+            t += 1;                                                            \
+          }                                                                    \
+        });                                                                    \
+      });                                                                      \
+      seq_for(gpu_block_shape::x_list_type{}, [&](auto x_size) {               \
+        if (gpu_block_shape::valid(block_size, x_size, 1)) {                   \
+          if (tune_idx == t) {                                                 \
+            setBlockSize(block_size);                                          \
+            run##variant##VariantMarch<x_size,                                 \
+                gpu_block_shape::y_size(block_size, x_size, 1)>(vid);          \
+          }                                                                    \
+          t += 1;                                                              \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  });
+
+#define RAJAPERF_GPU_SHAPE_3D_TUNING_NAMES                                     \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      seq_for(gpu_block_shape::x_list_type{}, [&](auto x_size) {               \
+        seq_for(gpu_block_shape::z_list_type{}, [&](auto z_size) {             \
+          if (gpu_block_shape::valid(block_size, x_size, z_size)) {            \
+            addVariantTuningName(vid,                                          \
+                gpu_block_shape::tuning_name(block_size, x_size, z_size));     \
+          }                                                                    \
+        });                                                                    \
+      });                                                                      \
+      seq_for(gpu_block_shape::x_list_type{}, [&](auto x_size) {               \
+        if (gpu_block_shape::valid(block_size, x_size, 1)) {                   \
+          addVariantTuningName(vid,                                            \
+              gpu_block_shape::march_tuning_name(block_size, x_size));         \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  });
+
+//
+// Parts of the read only tunings for kernels that define their own
+// run<variant>Variant, the run part calls run<variant>Variant<impl> for each
+// block size and expects tune_idx and the tuning counter t.
+//
+#define RAJAPERF_GPU_READ_ONLY_TUNING_RUN(variant, impl)                       \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      if (tune_idx == t) {                                                     \
+        setBlockSize(block_size);                                              \
+        run##variant##Variant##impl<block_size>(vid);                          \
+      }                                                                        \
+      t += 1;                                                                  \
+    }                                                                          \
+  });
+
+#define RAJAPERF_GPU_READ_ONLY_TUNING_NAMES                                    \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      addVariantTuningName(vid, gpu_read_only::tuning_name(block_size));       \
+    }                                                                          \
+  });
+
+//
+// Parts of the launch tunings for kernels that define their own
+// run<variant>Variant, the run part calls
+// run<variant>Variant<impl><tparams block_size, true> for each block size
+// and expects tune_idx and the tuning counter t, see common/LaunchUtils.hpp.
+//
+#define RAJAPERF_GPU_LAUNCH_TUNING_RUN(variant, impl, tparams)                 \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      if (tune_idx == t) {                                                     \
+        setBlockSize(block_size);                                              \
+        run##variant##Variant##impl<tparams block_size, true>(vid);            \
+      }                                                                        \
+      t += 1;                                                                  \
+    }                                                                          \
+  });
+
+#define RAJAPERF_GPU_LAUNCH_TUNING_NAMES                                       \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      addVariantTuningName(vid, gpu_launch::tuning_name(block_size));          \
+    }                                                                          \
+  });
+
+// template parameters before block_size of the typed launch tunings
+#define RAJAPERF_GPU_LAUNCH_TYPED_TPARAMS Data_type,
+
+//
+// Parts of the fast math tunings for kernels that define their own
+// run<variant>Variant, the run part calls run<variant>Variant<impl> for each
+// block size and expects tune_idx and the tuning counter t, both only when
+// '--fast-math' is given, see common/FastMathUtils.hpp.
+//
+#define RAJAPERF_GPU_FAST_MATH_TUNING_RUN(variant, impl)                       \
+  if (run_params.getFastMath()) {                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##Variant##impl<block_size>(vid);                        \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+  }
+
+#define RAJAPERF_GPU_FAST_MATH_TUNING_NAMES                                    \
+  if (run_params.getFastMath()) {                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, fast_math::getTuningName(block_size));       \
+      }                                                                        \
+    });                                                                        \
+  }
+
+//
+// Block size tunings followed by coarsened tunings for coarsen_vid. For each
+// block size the coarsened tunings call
+// run<variant>VariantCoarsened<block_size, items_per_thread, strided> for
+// each items per thread, with the items of a thread contiguous or block_size
+// apart, and run<variant>VariantVec<block_size, vec_width> for each vector
+// width the data alignment allows. Launch tunings for launch_vid follow.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_COARSEN_TUNING_DEFINE_BOILERPLATE(kernel, variant, coarsen_vid, launch_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<block_size>(vid);                          \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == coarsen_vid) {                                                  \
+      RAJAPERF_GPU_COARSEN_TUNING_RUN(variant, )                               \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_RUN(variant, Impl, )                          \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == coarsen_vid) {                                                  \
+      RAJAPERF_GPU_COARSEN_TUNING_NAMES                                        \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_NAMES                                         \
+    }                                                                          \
+  }
+
+//
+// Same as above for kernels templated on element data type, see
+// RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_TYPED_BOILERPLATE.
+//
+#define RAJAPERF_GPU_BLOCK_SIZE_COARSEN_TUNING_DEFINE_TYPED_BOILERPLATE(kernel, variant, coarsen_vid, launch_vid) \
+  template < typename Data_type >                                              \
+  void kernel::run##variant##VariantTyped(VariantID vid, size_t tune_idx)      \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantImpl<Data_type, block_size>(vid);               \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+    if (vid == coarsen_vid) {                                                  \
+      RAJAPERF_GPU_COARSEN_TUNING_RUN(variant, RAJAPERF_GPU_COARSEN_TYPED_TPARAMS) \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_RUN(variant, Impl, RAJAPERF_GPU_LAUNCH_TYPED_TPARAMS) \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                     \
+      if (run_params.numValidGPUBlockSize() == 0u ||                           \
+          run_params.validGPUBlockSize(block_size)) {                          \
+        addVariantTuningName(vid, "block_"+std::to_string(block_size));        \
+      }                                                                        \
+    });                                                                        \
+    if (vid == coarsen_vid) {                                                  \
+      RAJAPERF_GPU_COARSEN_TUNING_NAMES                                        \
+    }                                                                          \
+    if (vid == launch_vid) {                                                   \
+      RAJAPERF_GPU_LAUNCH_TUNING_NAMES                                         \
+    }                                                                          \
+  }
+
+//
+// Parts of the coarsened tunings, the run part expects tune_idx and the
+// tuning counter t, tparams are the template parameters before block_size.
+//
+#define RAJAPERF_GPU_COARSEN_TUNING_RUN(variant, tparams)                      \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      seq_for(gpu_coarsen::items_per_thread_type{}, [&](auto items_per_thread) { \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantCoarsened<tparams block_size,                   \
+                                          items_per_thread, false>(vid);       \
+        }                                                                      \
+        t += 1;                                                                \
+        if (tune_idx == t) {                                                   \
+          setBlockSize(block_size);                                            \
+          run##variant##VariantCoarsened<tparams block_size,                   \
+                                          items_per_thread, true>(vid);        \
+        }                                                                      \
+        t += 1;                                                                \
+      });                                                                      \
+      seq_for(gpu_coarsen::vec_widths_type{}, [&](auto vec_width) {            \
+        if (gpu_coarsen::valid_vec(getDataAlignment(), vec_width)) {           \
+          if (tune_idx == t) {                                                 \
+            setBlockSize(block_size);                                          \
+            run##variant##VariantVec<tparams block_size, vec_width>(vid);      \
+          }                                                                    \
+          t += 1;                                                              \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  });
+
+#define RAJAPERF_GPU_COARSEN_TUNING_NAMES                                      \
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {                       \
+    if (run_params.numValidGPUBlockSize() == 0u ||                             \
+        run_params.validGPUBlockSize(block_size)) {                            \
+      seq_for(gpu_coarsen::items_per_thread_type{}, [&](auto items_per_thread) { \
+        addVariantTuningName(vid,                                              \
+            gpu_coarsen::tuning_name(block_size, items_per_thread, false));    \
+        addVariantTuningName(vid,                                              \
+            gpu_coarsen::tuning_name(block_size, items_per_thread, true));     \
+      });                                                                      \
+      seq_for(gpu_coarsen::vec_widths_type{}, [&](auto vec_width) {            \
+        if (gpu_coarsen::valid_vec(getDataAlignment(), vec_width)) {           \
+          addVariantTuningName(vid,                                            \
+              gpu_coarsen::vec_tuning_name(block_size, vec_width));            \
+        }                                                                      \
+      });                                                                      \
+    }                                                                          \
+  });
+
+// template parameters before block_size of the typed coarsened tunings
+#define RAJAPERF_GPU_COARSEN_TYPED_TPARAMS Data_type,
+
 #endif  // closing endif for header file include guard
@@ -16,6 +16,8 @@
 
 #include "RPTypes.hpp"
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #if defined(RAJA_ENABLE_HIP)
 
@@ -25,6 +27,15 @@
 #include "RAJA/policy/hip/policy.hpp"
 #include "RAJA/policy/hip/raja_hiperrchk.hpp"
 
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+#include <rocblas/rocblas.h>
+#include <rocsolver/rocsolver.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+#include <rocfft/rocfft.h>
+#endif
+
 
 namespace rajaperf
 {
@@ -67,6 +78,108 @@ __global__ void lambda_hip(Lambda body)
   body();
 }
 
+/*!
+ * \brief Index of item j of the calling thread of a coarsened kernel whose
+ * threads compute items_per_thread items each, contiguous items or items
+ * block_size apart so consecutive threads access consecutive items.
+ */
+template < size_t block_size, size_t items_per_thread, bool strided >
+__device__ __forceinline__ Index_type hip_coarsened_index(size_t j)
+{
+  return strided
+      ? static_cast<Index_type>(blockIdx.x * block_size * items_per_thread +
+                                j * block_size + threadIdx.x)
+      : static_cast<Index_type>((blockIdx.x * block_size + threadIdx.x) *
+                                items_per_thread + j);
+}
+
+/*!
+ * \brief Number of threads in a hip wavefront.
+ */
+constexpr size_t hip_warp_size = 64;
+
+/*!
+ * \brief Reduce val over the threads of a warp with shuffles using the RAJA
+ * operator Op, the result is valid in lane 0.
+ * Every thread in the warp must call this.
+ */
+template < typename Op, typename T >
+__device__ __forceinline__ T hip_warp_reduce(T val)
+{
+  for (int offset = hip_warp_size / 2; offset > 0; offset /= 2) {
+    val = Op{}(val, __shfl_down(val, offset, hip_warp_size));
+  }
+  return val;
+}
+
+/*!
+ * \brief Reduce val over the threads of a block using the RAJA operator Op,
+ * the result is valid in thread 0. Warps reduce with shuffles and the warp
+ * results are combined through shared memory.
+ * Every thread in the block must call this and block_size must be a
+ * multiple of hip_warp_size.
+ */
+template < size_t block_size, typename Op, typename T >
+__device__ __forceinline__ T hip_block_reduce(T val)
+{
+  static_assert(block_size % hip_warp_size == 0,
+                "block_size must be a multiple of the warp size");
+  constexpr size_t num_warps = block_size / hip_warp_size;
+
+  __shared__ T warp_vals[num_warps];
+
+  const size_t lane = threadIdx.x % hip_warp_size;
+  const size_t warp = threadIdx.x / hip_warp_size;
+
+  val = hip_warp_reduce<Op>(val);
+
+  if (num_warps > 1) {
+    if (lane == 0) {
+      warp_vals[warp] = val;
+    }
+    __syncthreads();
+
+    if (warp == 0) {
+      val = hip_warp_reduce<Op>( (lane < num_warps) ? warp_vals[lane]
+                                                     : Op::identity() );
+    }
+    // warp_vals may be reused by the next call
+    __syncthreads();
+  }
+
+  return val;
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+/*!
+ * \brief Throw if a rocBLAS or rocSOLVER call did not succeed.
+ */
+inline void rocblasAssert(rocblas_status code, const char *file, int line)
+{
+  if (code != rocblas_status_success) {
+    throw std::runtime_error(std::string("ROCBLASassert: ") +
+                             rocblas_status_to_string(code) + " " +
+                             file + " " + std::to_string(line));
+  }
+}
+#define rocblasErrchk(ans) { ::rajaperf::rocblasAssert((ans), __FILE__, __LINE__); }
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_FFT)
+/*!
+ * \brief Throw if a rocFFT call did not succeed.
+ */
+inline void rocfftAssert(rocfft_status code, const char *file, int line)
+{
+  if (code != rocfft_status_success) {
+    throw std::runtime_error(std::string("ROCFFTassert: status ") +
+                             std::to_string(static_cast<int>(code)) + " " +
+                             file + " " + std::to_string(line));
+  }
+}
+#define rocfftErrchk(ans) { ::rajaperf::rocfftAssert((ans), __FILE__, __LINE__); }
+#endif
+
 
 namespace detail
 {
@@ -91,6 +204,20 @@ inline hipDeviceProp_t getHipDeviceProp()
   return prop;
 }
 
+/*!
+ * \brief Get if the current hip device can access memory from the system
+ *        allocator, which needs xnack enabled, for example on MI300A with
+ *        HSA_XNACK=1.
+ */
+inline bool haveHipPageableMemoryAccess()
+{
+  int pageable = 0;
+  hipErrchk( hipDeviceGetAttribute(&pageable,
+                                   hipDeviceAttributePageableMemoryAccess,
+                                   getHipDevice()) );
+  return pageable != 0;
+}
+
 /*!
  * \brief Get max occupancy in blocks for the given kernel for the current
  *        hip device.
@@ -108,6 +235,93 @@ int getHipOccupancyMaxBlocks(Func&& func, int num_threads, size_t shmem_size)
   return max_blocks * multiProcessorCount;
 }
 
+/*!
+ * \brief Get if the current hip device supports cooperative launches, whose
+ *        blocks are all resident at once and may synchronize the grid.
+ */
+inline bool haveHipCooperativeLaunch()
+{
+  return getHipDeviceProp().cooperativeLaunch != 0;
+}
+
+/*!
+ * \brief Get if the current hip device has FP64 matrix cores with the
+ *        16x16x4 shape, gfx90a and gfx94x.
+ */
+inline bool haveHipDoubleMma()
+{
+  const std::string arch = getHipDeviceProp().gcnArchName;
+  return arch.compare(0, 6, "gfx90a") == 0 ||
+         arch.compare(0, 5, "gfx94") == 0;
+}
+
+/*!
+ * \brief Get the most shared memory (LDS) a block may use on the current
+ *        hip device.
+ */
+inline size_t getHipSharedMemPerBlock()
+{
+  return getHipDeviceProp().sharedMemPerBlock;
+}
+
+/*!
+ * \brief Get the shared memory (LDS) of a compute unit of the current hip
+ *        device, which is not shared with L1 so has no carve-out.
+ */
+inline size_t getHipSharedMemPerMultiprocessor()
+{
+  return getHipDeviceProp().maxSharedMemoryPerMultiProcessor;
+}
+
+/*!
+ * \brief Get the registers and local memory per thread, the shared memory
+ *        per block, and the occupancy of the given kernel, called name in
+ *        reports, for the current hip device launched with num_threads
+ *        threads and shmem_size bytes of dynamic shared memory per block.
+ */
+template < typename Func >
+RAJA_INLINE
+GPUFuncAttributes getHipFuncAttributes(const std::string& name, Func&& func,
+                                    int num_threads, size_t shmem_size)
+{
+  hipFuncAttributes func_attrs;
+  hipErrchk(hipFuncGetAttributes(&func_attrs, reinterpret_cast<const void*>(func)));
+
+  int max_blocks = 0;
+  hipErrchk(hipOccupancyMaxActiveBlocksPerMultiprocessor(
+      &max_blocks, func, num_threads, shmem_size));
+
+  GPUFuncAttributes attrs;
+  attrs.name = name;
+  attrs.num_regs = func_attrs.numRegs;
+  attrs.local_bytes = func_attrs.localSizeBytes;
+  attrs.static_shmem_bytes = func_attrs.sharedSizeBytes;
+  attrs.dynamic_shmem_bytes = shmem_size;
+  attrs.occupancy = static_cast<double>(max_blocks * num_threads) /
+                    getHipDeviceProp().maxThreadsPerMultiProcessor;
+  return attrs;
+}
+
+/*!
+ * \brief Capture the work body enqueues on stream into an executable graph.
+ *
+ * body must not synchronize stream. Destroy the returned graph with
+ * hipGraphExecDestroy.
+ */
+template < typename Body >
+inline hipGraphExec_t captureHipGraph(hipStream_t stream, Body&& body)
+{
+  hipGraph_t graph;
+  hipErrchk( hipStreamBeginCapture( stream, hipStreamCaptureModeThreadLocal ) );
+  body();
+  hipErrchk( hipStreamEndCapture( stream, &graph ) );
+
+  hipGraphExec_t graph_exec;
+  hipErrchk( hipGraphInstantiate( &graph_exec, graph, nullptr, nullptr, 0 ) );
+  hipErrchk( hipGraphDestroy( graph ) );
+  return graph_exec;
+}
+
 /*
  * Copy memory len bytes from src to dst.
  */
@@ -138,6 +352,31 @@ inline void* allocHipDeviceFineData(size_t len)
   return dfptr;
 }
 
+/*!
+ * \brief Set the release threshold of the default memory pool of the
+ * current device, memory the pool holds above it is returned to the
+ * system when the device or a stream synchronizes.
+ */
+inline void setHipMemPoolReleaseThreshold(size_t nbytes)
+{
+  hipMemPool_t pool;
+  hipErrchk( hipDeviceGetDefaultMemPool( &pool, getHipDevice() ) );
+  uint64_t threshold = nbytes;
+  hipErrchk( hipMemPoolSetAttribute( pool, hipMemPoolAttrReleaseThreshold,
+                                     &threshold ) );
+}
+
+/*!
+ * \brief Allocate HIP device data array (dptr) from the default memory pool
+ * of the device, ordered in the legacy default stream.
+ */
+inline void* allocHipDeviceAsyncData(size_t len)
+{
+  void* dptr = nullptr;
+  hipErrchk( hipMallocAsync( &dptr, len, 0 ) );
+  return dptr;
+}
+
 /*!
  * \brief Allocate HIP managed data array (mptr).
  */
@@ -185,7 +424,7 @@ inline void* allocHipPinnedCoarseData(size_t len)
 /*!
  * \brief Apply mem advice to HIP data array (ptr).
  */
-inline void adviseHipData(void* ptr, int len, hipMemoryAdvise advice, int device)
+inline void adviseHipData(void* ptr, size_t len, hipMemoryAdvise advice, int device)
 {
   hipErrchk( hipMemAdvise( ptr, len, advice, device ) );
 }
@@ -211,6 +450,15 @@ inline void deallocHipDeviceData(void* dptr)
   hipErrchk( hipFree( dptr ) );
 }
 
+/*!
+ * \brief Free device data array allocated from the default memory pool,
+ * ordered in the legacy default stream.
+ */
+inline void deallocHipDeviceAsyncData(void* dptr)
+{
+  hipErrchk( hipFreeAsync( dptr, 0 ) );
+}
+
 /*!
  * \brief Free managed data array.
  */
@@ -227,6 +475,112 @@ inline void deallocHipPinnedData(void* pptr)
   hipErrchk( hipHostFree( pptr ) );
 }
 
+/*!
+ * \brief Contiguous chunks of [0, len) owned by each visible HIP device
+ *        in multi-GPU runs, each device runs its chunk on its own stream.
+ *
+ * Chunk p is [offsets[p], offsets[p+1]) and lives on devices[p].
+ */
+struct HipPartitions
+{
+  int home_device = -1;
+  std::vector<int> devices;
+  std::vector<hipStream_t> streams;
+  std::vector<Index_type> offsets;
+};
+
+/*!
+ * \brief Split [0, len) evenly over all visible devices.
+ */
+inline HipPartitions makeHipPartitions(Index_type len)
+{
+  HipPartitions parts;
+  parts.home_device = getHipDevice();
+
+  int num_devices = 0;
+  hipErrchk( hipGetDeviceCount(&num_devices) );
+  parts.offsets.emplace_back(0);
+  for (int p = 0; p < num_devices; ++p) {
+    hipStream_t stream;
+    hipErrchk( hipSetDevice(p) );
+    hipErrchk( hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) );
+    parts.devices.emplace_back(p);
+    parts.streams.emplace_back(stream);
+    parts.offsets.emplace_back((len * (p+1)) / num_devices);
+  }
+  hipErrchk( hipSetDevice(parts.home_device) );
+  return parts;
+}
+
+/*!
+ * \brief Wait for the streams of all devices.
+ */
+inline void synchronizeHipPartitions(const HipPartitions& parts)
+{
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    hipErrchk( hipSetDevice(parts.devices[p]) );
+    hipErrchk( hipStreamSynchronize(parts.streams[p]) );
+  }
+  hipErrchk( hipSetDevice(parts.home_device) );
+}
+
+inline void destroyHipPartitions(HipPartitions& parts)
+{
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    hipErrchk( hipSetDevice(parts.devices[p]) );
+    hipErrchk( hipStreamDestroy(parts.streams[p]) );
+  }
+  hipErrchk( hipSetDevice(parts.home_device) );
+  parts.devices.clear();
+  parts.streams.clear();
+  parts.offsets.clear();
+}
+
+/*!
+ * \brief Copy the chunks of ptr to device arrays allocated on the device
+ *        owning each chunk.
+ */
+template < typename T >
+inline std::vector<T*> scatterHipPartitions(const HipPartitions& parts, const T* ptr)
+{
+  std::vector<T*> chunks;
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    const size_t nbytes = (parts.offsets[p+1] - parts.offsets[p]) * sizeof(T);
+    hipErrchk( hipSetDevice(parts.devices[p]) );
+    T* chunk = static_cast<T*>(allocHipDeviceData(nbytes));
+    hipErrchk( hipMemcpy( chunk, ptr + parts.offsets[p], nbytes,
+                hipMemcpyDefault ) );
+    chunks.emplace_back(chunk);
+  }
+  hipErrchk( hipSetDevice(parts.home_device) );
+  return chunks;
+}
+
+/*!
+ * \brief Copy the device chunks back to ptr.
+ */
+template < typename T >
+inline void gatherHipPartitions(const HipPartitions& parts,
+                                 const std::vector<T*>& chunks, T* ptr)
+{
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    const size_t nbytes = (parts.offsets[p+1] - parts.offsets[p]) * sizeof(T);
+    hipErrchk( hipMemcpy( ptr + parts.offsets[p], chunks[p], nbytes,
+                hipMemcpyDefault ) );
+  }
+}
+
+template < typename T >
+inline void freeHipPartitions(const HipPartitions& parts, std::vector<T*>& chunks)
+{
+  for (size_t p = 0; p < parts.devices.size(); ++p) {
+    hipErrchk( hipSetDevice(parts.devices[p]) );
+    deallocHipDeviceData(chunks[p]);
+  }
+  hipErrchk( hipSetDevice(parts.home_device) );
+  chunks.clear();
+}
+
 }  // closing brace for detail namespace
 
 }  // closing brace for rajaperf namespace
@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for index width tunings of kernels that index through arrays,
+/// which run with their index arrays and the loop indices read from them
+/// in a 32 or 64 bit integer type.
+///
+/// Kernels with index width tunings call setUsesIndexWidths in their
+/// constructor, then their Base Seq, OpenMP, CUDA, and HIP variants also
+/// have the tunings "index_32bit" and "index_64bit". They set up copies of
+/// their index arrays in the index type of the tuning with
+/// allocAndCopyIndexData, so one kernel compares both widths regardless of
+/// the type its other tunings use.
+///
+
+#ifndef RAJAPerf_IndexUtils_HPP
+#define RAJAPerf_IndexUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Index width of a tuning, Default for tunings that use the index
+ *        types of the kernel.
+ */
+enum struct IndexWidth {
+  Default,
+  Int32,
+  Int64,
+
+  NumIndexWidths // Keep this one last
+};
+
+namespace index_width
+{
+
+/*!
+ * \brief Return the name of the tuning using index width, ie. index_32bit.
+ */
+inline std::string getTuningName(IndexWidth width)
+{
+  switch ( width ) {
+    case IndexWidth::Int32 : return "index_32bit";
+    case IndexWidth::Int64 : return "index_64bit";
+    default : return "default";
+  }
+}
+
+/*!
+ * \brief Return the size in bytes of an index of width, 0 for the Default
+ *        width.
+ */
+inline size_t getIndexSize(IndexWidth width)
+{
+  switch ( width ) {
+    case IndexWidth::Int32 : return sizeof(Int32_type);
+    case IndexWidth::Int64 : return sizeof(Int64_type);
+    default : return 0;
+  }
+}
+
+} // closing brace for index_width namespace
+
+}  // closing brace for rajaperf namespace
+
+//
+// Call func<IndexList_type>(...) with IndexList_type the integer type of
+// the index width of an index width tuning.
+//
+#define RAJAPERF_INDEX_WIDTH_DISPATCH(width, func, ...)                       \
+  switch ( width ) {                                                           \
+    case ::rajaperf::IndexWidth::Int32 :                                       \
+      func< ::rajaperf::Int32_type >(__VA_ARGS__); break;                      \
+    case ::rajaperf::IndexWidth::Int64 :                                       \
+      func< ::rajaperf::Int64_type >(__VA_ARGS__); break;                      \
+    default :                                                                  \
+      getCout() << "\n  " << getName() << " : Unknown index width = "          \
+                << static_cast<int>(width) << std::endl;                       \
+  }
+
+//
+// Define run<variant>IndexVariant to call run<variant>VariantIndex with the
+// integer type of the index width of the tuning.
+//
+#define RAJAPERF_INDEX_WIDTH_RUN_BOILERPLATE(kernel, variant)                  \
+  void kernel::run##variant##IndexVariant(VariantID vid, size_t tune_idx)      \
+  {                                                                            \
+    RAJAPERF_INDEX_WIDTH_DISPATCH(getIndexWidth(vid, tune_idx),                \
+        run##variant##VariantIndex, vid);                                      \
+  }
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "InterferenceUtils.hpp"
+
+#include "CudaDataUtils.hpp"
+#include "HipDataUtils.hpp"
+
+#include <atomic>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+namespace
+{
+
+std::thread copy_thread;
+std::atomic<bool> copy_stop{false};
+std::atomic<size_t> copy_bytes{0};
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+/*
+ * Copy a pinned host buffer to the device and back until stopped, each
+ * pair of copies is synchronized so stopping waits for one pair at most.
+ */
+void runCopyLoad(int device, size_t nbytes)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk( cudaSetDevice( device ) );
+  void* host_buffer = nullptr;
+  void* device_buffer = nullptr;
+  cudaStream_t stream;
+  cudaErrchk( cudaMallocHost( &host_buffer, nbytes ) );
+  cudaErrchk( cudaMalloc( &device_buffer, nbytes ) );
+  cudaErrchk( cudaStreamCreateWithFlags( &stream, cudaStreamNonBlocking ) );
+  while ( !copy_stop ) {
+    cudaErrchk( cudaMemcpyAsync( device_buffer, host_buffer, nbytes,
+                                 cudaMemcpyHostToDevice, stream ) );
+    cudaErrchk( cudaMemcpyAsync( host_buffer, device_buffer, nbytes,
+                                 cudaMemcpyDeviceToHost, stream ) );
+    cudaErrchk( cudaStreamSynchronize( stream ) );
+    copy_bytes += 2*nbytes;
+  }
+  cudaErrchk( cudaStreamDestroy( stream ) );
+  cudaErrchk( cudaFree( device_buffer ) );
+  cudaErrchk( cudaFreeHost( host_buffer ) );
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk( hipSetDevice( device ) );
+  void* host_buffer = nullptr;
+  void* device_buffer = nullptr;
+  hipStream_t stream;
+  hipErrchk( hipHostMalloc( &host_buffer, nbytes ) );
+  hipErrchk( hipMalloc( &device_buffer, nbytes ) );
+  hipErrchk( hipStreamCreateWithFlags( &stream, hipStreamNonBlocking ) );
+  while ( !copy_stop ) {
+    hipErrchk( hipMemcpyAsync( device_buffer, host_buffer, nbytes,
+                               hipMemcpyHostToDevice, stream ) );
+    hipErrchk( hipMemcpyAsync( host_buffer, device_buffer, nbytes,
+                               hipMemcpyDeviceToHost, stream ) );
+    hipErrchk( hipStreamSynchronize( stream ) );
+    copy_bytes += 2*nbytes;
+  }
+  hipErrchk( hipStreamDestroy( stream ) );
+  hipErrchk( hipFree( device_buffer ) );
+  hipErrchk( hipHostFree( host_buffer ) );
+#endif
+}
+#endif
+
+}  // closing brace for anonymous namespace
+
+std::vector<int> getBackgroundCPUs(int num)
+{
+  std::vector<int> cpus;
+#if defined(__linux__)
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+    for (int cpu = CPU_SETSIZE-1;
+         cpu >= 0 && static_cast<int>(cpus.size()) < num; --cpu) {
+      if (CPU_ISSET(cpu, &mask)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  cpus.resize(num < 0 ? 0 : num, -1);
+  return cpus;
+}
+
+void bindThreadToCPU(int cpu)
+{
+#if defined(__linux__)
+  if (cpu < 0) {
+    return;
+  }
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(cpu, &mask);
+  pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask);
+#else
+  (void) cpu;
+#endif
+}
+
+void startCopyLoad(size_t nbytes)
+{
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+  if (copy_thread.joinable() || nbytes == 0) {
+    return;
+  }
+#if defined(RAJA_ENABLE_CUDA)
+  const int device = getCudaDevice();
+#else
+  const int device = getHipDevice();
+#endif
+  copy_stop = false;
+  copy_bytes = 0;
+  copy_thread = std::thread(runCopyLoad, device, nbytes);
+#else
+  (void) nbytes;
+#endif
+}
+
+size_t stopCopyLoad()
+{
+  if (copy_thread.joinable()) {
+    copy_stop = true;
+    copy_thread.join();
+  }
+  return copy_bytes;
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
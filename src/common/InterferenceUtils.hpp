@@ -0,0 +1,61 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for background load run alongside measured kernels with
+/// '--interference', so kernels sensitive to contention for memory
+/// bandwidth or the host to device link can be found.
+///
+/// Bandwidth streaming threads and the GPU stream load run Stream_TRIAD
+/// kernel objects in the background, see KernelBase::startBackgroundRun.
+/// The host to device copy load is run here on its own thread and stream.
+///
+
+#ifndef RAJAPerf_InterferenceUtils_HPP
+#define RAJAPerf_InterferenceUtils_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Return num cpus for background threads, taken from the end of the
+ * affinity mask of the process so they are away from the cpus OpenMP
+ * threads run on first. Returns -1 for each thread if cpus can not be found.
+ */
+std::vector<int> getBackgroundCPUs(int num);
+
+/*!
+ * \brief Bind the calling thread to cpu, does nothing if cpu < 0 or the
+ * thread can not be bound.
+ */
+void bindThreadToCPU(int cpu);
+
+/*!
+ * \brief Start copying nbytes host to device and back on a background thread
+ * and its own stream until stopCopyLoad is called.
+ *
+ * Does nothing when the suite is built without CUDA or HIP.
+ */
+void startCopyLoad(size_t nbytes);
+
+/*!
+ * \brief Stop the copies started by startCopyLoad and return the bytes copied.
+ */
+size_t stopCopyLoad();
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
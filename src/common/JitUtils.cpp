@@ -0,0 +1,401 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "JitUtils.hpp"
+
+#include "common/OutputUtils.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT) && defined(RAJA_ENABLE_CUDA)
+#include <nvrtc.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT) && defined(RAJA_ENABLE_HIP)
+#include <hip/hiprtc.h>
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+namespace
+{
+
+/*!
+ * \brief 64 bit FNV-1a hash of str as 16 hex digits, the same in every run.
+ */
+std::string hashString(const std::string& str)
+{
+  unsigned long long hash = 14695981039346656037ull;
+  for (unsigned char c : str) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+  char buf[17];
+  std::snprintf(buf, sizeof(buf), "%016llx", hash);
+  return std::string(buf);
+}
+
+/*!
+ * \brief Read the file at path into data, return false if it can't be read.
+ */
+bool readBinary(const std::string& path, std::string& data)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  data.assign(std::istreambuf_iterator<char>(file),
+              std::istreambuf_iterator<char>());
+  return !data.empty();
+}
+
+/*!
+ * \brief Write data to the file name in dir, through a temporary file that
+ * is renamed so other processes never read a partial binary. Failing to
+ * write only loses the cache entry.
+ */
+void writeBinary(const std::string& dir, const std::string& name,
+                 const std::string& data)
+{
+  const std::string outdir = recursiveMkdir(dir);
+  if (outdir.empty()) {
+    return;
+  }
+  const std::string path = outdir + "/" + name;
+  std::ostringstream tmp_path;
+  tmp_path << path << ".tmp" << std::chrono::steady_clock::now().time_since_epoch().count();
+  {
+    std::ofstream file(tmp_path.str(), std::ios::binary);
+    if (!file) {
+      return;
+    }
+    file.write(data.data(), data.size());
+    if (!file) {
+      std::remove(tmp_path.str().c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp_path.str().c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.str().c_str());
+  }
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Metric names of jit tunings.
+ */
+std::vector<std::string> getJitMetricNames()
+{
+  return {"jit_compile_sec", "jit_load_sec", "jit_disk_cached"};
+}
+
+/*
+ * Metric values of jit tunings.
+ */
+std::vector<double> getJitMetrics(const JitStats& stats)
+{
+  return {stats.compile_sec, stats.load_sec, stats.disk_cached ? 1.0 : 0.0};
+}
+
+/*
+ * Suite types for jit sources.
+ */
+std::string getJitTypesSource()
+{
+  std::string src;
+  src += std::is_same<Real_type, float>::value ? "typedef float Real_type;\n"
+                                               : "typedef double Real_type;\n";
+  src += (sizeof(Index_type) == sizeof(long long)) ? "typedef long long Index_type;\n"
+                                                   : "typedef int Index_type;\n";
+  return src;
+}
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT) && defined(RAJA_ENABLE_CUDA)
+
+namespace
+{
+
+void checkNvrtc(nvrtcResult result, const std::string& what)
+{
+  if (result != NVRTC_SUCCESS) {
+    throw std::runtime_error(what + " : " + nvrtcGetErrorString(result));
+  }
+}
+
+void checkCu(CUresult result, const std::string& what)
+{
+  if (result != CUDA_SUCCESS) {
+    const char* str = nullptr;
+    cuGetErrorString(result, &str);
+    throw std::runtime_error(what + " : " + (str ? str : "unknown CUDA driver error"));
+  }
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Get a jit kernel compiled with NVRTC.
+ */
+CUfunction getCudaJitFunction(const std::string& kernel_name,
+                              const std::string& source,
+                              const std::string& cache_dir,
+                              JitStats& stats)
+{
+  static std::map<std::string, std::pair<CUfunction, JitStats>> loaded;
+
+  int device = 0;
+  int major = 0;
+  int minor = 0;
+  int nvrtc_major = 0;
+  int nvrtc_minor = 0;
+  cudaGetDevice(&device);
+  cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device);
+  cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device);
+  checkNvrtc(nvrtcVersion(&nvrtc_major, &nvrtc_minor), "nvrtcVersion");
+
+  const std::string arch = "sm_" + std::to_string(major*10 + minor);
+  const std::string arch_opt = "--gpu-architecture=" + arch;
+  const std::string key = kernel_name + "_" + arch + "_nvrtc" +
+      std::to_string(nvrtc_major) + "." + std::to_string(nvrtc_minor) + "_" +
+      hashString(source);
+
+  auto it = loaded.find(key + "_" + std::to_string(device));
+  if (it != loaded.end()) {
+    stats = it->second.second;
+    return it->second.first;
+  }
+
+  stats = JitStats{};
+
+  const std::string file_name = key + ".cubin";
+  std::string binary;
+  if (!cache_dir.empty() && readBinary(cache_dir + "/" + file_name, binary)) {
+
+    stats.disk_cached = true;
+
+  } else {
+
+    auto start = std::chrono::steady_clock::now();
+
+    nvrtcProgram prog;
+    checkNvrtc(nvrtcCreateProgram(&prog, source.c_str(),
+                                  (kernel_name + ".cu").c_str(),
+                                  0, nullptr, nullptr),
+               "nvrtcCreateProgram");
+
+    const char* opts[] = {arch_opt.c_str(), "--std=c++14"};
+    nvrtcResult result = nvrtcCompileProgram(prog, 2, opts);
+    if (result != NVRTC_SUCCESS) {
+      size_t log_size = 0;
+      nvrtcGetProgramLogSize(prog, &log_size);
+      std::string log(log_size, '\0');
+      nvrtcGetProgramLog(prog, &log[0]);
+      nvrtcDestroyProgram(&prog);
+      throw std::runtime_error("getCudaJitFunction : Can't compile " +
+                               kernel_name + "\n" + log);
+    }
+
+    size_t binary_size = 0;
+    checkNvrtc(nvrtcGetCUBINSize(prog, &binary_size), "nvrtcGetCUBINSize");
+    binary.resize(binary_size);
+    checkNvrtc(nvrtcGetCUBIN(prog, &binary[0]), "nvrtcGetCUBIN");
+    nvrtcDestroyProgram(&prog);
+
+    stats.compile_sec = secondsSince(start);
+
+    if (!cache_dir.empty()) {
+      writeBinary(cache_dir, file_name, binary);
+    }
+
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  CUmodule module;
+  CUfunction function;
+  checkCu(cuModuleLoadData(&module, binary.data()), "cuModuleLoadData");
+  checkCu(cuModuleGetFunction(&function, module, kernel_name.c_str()),
+          "cuModuleGetFunction");
+
+  stats.load_sec = secondsSince(start);
+
+  loaded.emplace(key + "_" + std::to_string(device),
+                 std::make_pair(function, stats));
+
+  return function;
+}
+
+/*
+ * Launch a jit kernel on a 1D grid.
+ */
+void launchCudaJitFunction(CUfunction function,
+                           size_t grid_size, size_t block_size,
+                           size_t shmem, cudaStream_t stream,
+                           void** args)
+{
+  checkCu(cuLaunchKernel(function,
+                         grid_size, 1, 1,
+                         block_size, 1, 1,
+                         shmem, stream, args, nullptr),
+          "cuLaunchKernel");
+}
+
+#endif
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT) && defined(RAJA_ENABLE_HIP)
+
+namespace
+{
+
+void checkHiprtc(hiprtcResult result, const std::string& what)
+{
+  if (result != HIPRTC_SUCCESS) {
+    throw std::runtime_error(what + " : " + hiprtcGetErrorString(result));
+  }
+}
+
+void checkHip(hipError_t result, const std::string& what)
+{
+  if (result != hipSuccess) {
+    throw std::runtime_error(what + " : " + hipGetErrorString(result));
+  }
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Get a jit kernel compiled with hipRTC.
+ */
+hipFunction_t getHipJitFunction(const std::string& kernel_name,
+                                const std::string& source,
+                                const std::string& cache_dir,
+                                JitStats& stats)
+{
+  static std::map<std::string, std::pair<hipFunction_t, JitStats>> loaded;
+
+  int device = 0;
+  int runtime_version = 0;
+  hipDeviceProp_t props;
+  checkHip(hipGetDevice(&device), "hipGetDevice");
+  checkHip(hipGetDeviceProperties(&props, device), "hipGetDeviceProperties");
+  checkHip(hipRuntimeGetVersion(&runtime_version), "hipRuntimeGetVersion");
+
+  // gcnArchName may carry feature flags, ie. gfx90a:sramecc+:xnack-
+  std::string arch(props.gcnArchName);
+  const std::string arch_opt = "--offload-arch=" + arch;
+  for (char& c : arch) {
+    if (c == ':' || c == '+') {
+      c = '_';
+    }
+  }
+  const std::string key = kernel_name + "_" + arch + "_hip" +
+      std::to_string(runtime_version) + "_" + hashString(source);
+
+  auto it = loaded.find(key + "_" + std::to_string(device));
+  if (it != loaded.end()) {
+    stats = it->second.second;
+    return it->second.first;
+  }
+
+  stats = JitStats{};
+
+  const std::string file_name = key + ".hsaco";
+  std::string binary;
+  if (!cache_dir.empty() && readBinary(cache_dir + "/" + file_name, binary)) {
+
+    stats.disk_cached = true;
+
+  } else {
+
+    auto start = std::chrono::steady_clock::now();
+
+    hiprtcProgram prog;
+    checkHiprtc(hiprtcCreateProgram(&prog, source.c_str(),
+                                    (kernel_name + ".hip").c_str(),
+                                    0, nullptr, nullptr),
+                "hiprtcCreateProgram");
+
+    const char* opts[] = {arch_opt.c_str(), "-std=c++14"};
+    hiprtcResult result = hiprtcCompileProgram(prog, 2, opts);
+    if (result != HIPRTC_SUCCESS) {
+      size_t log_size = 0;
+      hiprtcGetProgramLogSize(prog, &log_size);
+      std::string log(log_size, '\0');
+      hiprtcGetProgramLog(prog, &log[0]);
+      hiprtcDestroyProgram(&prog);
+      throw std::runtime_error("getHipJitFunction : Can't compile " +
+                               kernel_name + "\n" + log);
+    }
+
+    size_t binary_size = 0;
+    checkHiprtc(hiprtcGetCodeSize(prog, &binary_size), "hiprtcGetCodeSize");
+    binary.resize(binary_size);
+    checkHiprtc(hiprtcGetCode(prog, &binary[0]), "hiprtcGetCode");
+    hiprtcDestroyProgram(&prog);
+
+    stats.compile_sec = secondsSince(start);
+
+    if (!cache_dir.empty()) {
+      writeBinary(cache_dir, file_name, binary);
+    }
+
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  hipModule_t module;
+  hipFunction_t function;
+  checkHip(hipModuleLoadData(&module, binary.data()), "hipModuleLoadData");
+  checkHip(hipModuleGetFunction(&function, module, kernel_name.c_str()),
+           "hipModuleGetFunction");
+
+  stats.load_sec = secondsSince(start);
+
+  loaded.emplace(key + "_" + std::to_string(device),
+                 std::make_pair(function, stats));
+
+  return function;
+}
+
+/*
+ * Launch a jit kernel on a 1D grid.
+ */
+void launchHipJitFunction(hipFunction_t function,
+                          size_t grid_size, size_t block_size,
+                          size_t shmem, hipStream_t stream,
+                          void** args)
+{
+  checkHip(hipModuleLaunchKernel(function,
+                                 grid_size, 1, 1,
+                                 block_size, 1, 1,
+                                 shmem, stream, args, nullptr),
+           "hipModuleLaunchKernel");
+}
+
+#endif
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for the jit tunings of GPU kernels, which compile the source of
+/// a kernel at run time with the problem sizes of the run written into it as
+/// constants, so the compiler can unroll and fold the loops over them.
+///
+/// Kernels are compiled with NVRTC or hipRTC when the suite is built with
+/// RAJA_PERFSUITE_ENABLE_JIT. The compiled binaries are written to the
+/// directory given by --jit-cache-dir and loaded from it by later runs with
+/// the same source and device, and kept loaded for the rest of the run.
+/// The time to compile and to load a kernel are reported as metrics of the
+/// tuning, apart from the time of its reps.
+///
+
+#ifndef RAJAPerf_JitUtils_HPP
+#define RAJAPerf_JitUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT) && defined(RAJA_ENABLE_CUDA)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT) && defined(RAJA_ENABLE_HIP)
+#include <hip/hip_runtime.h>
+#endif
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Cost of getting a jit kernel, compile_sec is zero when the binary
+ * was read from the disk cache.
+ */
+struct JitStats
+{
+  double compile_sec = 0.0;
+  double load_sec = 0.0;
+  bool disk_cached = false;
+};
+
+/*!
+ * \brief Names of the metrics of jit tunings, in the order of getJitMetrics.
+ */
+std::vector<std::string> getJitMetricNames();
+
+/*!
+ * \brief Values of the jit metrics of stats.
+ */
+std::vector<double> getJitMetrics(const JitStats& stats);
+
+/*!
+ * \brief Declarations of the suite types Real_type and Index_type to
+ * prepend to jit kernel sources, which can not include the suite headers.
+ */
+std::string getJitTypesSource();
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT) && defined(RAJA_ENABLE_CUDA)
+
+/*!
+ * \brief Get the kernel kernel_name, declared extern "C" in source, compiled
+ * for the current device with NVRTC, from the kernels already loaded, the
+ * binaries in cache_dir, or by compiling it.
+ *
+ * Throws std::runtime_error with the compile log if compilation fails.
+ */
+CUfunction getCudaJitFunction(const std::string& kernel_name,
+                              const std::string& source,
+                              const std::string& cache_dir,
+                              JitStats& stats);
+
+/*!
+ * \brief Launch function on a 1D grid in stream, args are the pointers to
+ * the kernel arguments.
+ */
+void launchCudaJitFunction(CUfunction function,
+                           size_t grid_size, size_t block_size,
+                           size_t shmem, cudaStream_t stream,
+                           void** args);
+
+#endif
+
+#if defined(RAJA_PERFSUITE_ENABLE_JIT) && defined(RAJA_ENABLE_HIP)
+
+/*!
+ * \brief Same as getCudaJitFunction compiling with hipRTC.
+ */
+hipFunction_t getHipJitFunction(const std::string& kernel_name,
+                                const std::string& source,
+                                const std::string& cache_dir,
+                                JitStats& stats);
+
+/*!
+ * \brief Same as launchCudaJitFunction for HIP.
+ */
+void launchHipJitFunction(hipFunction_t function,
+                          size_t grid_size, size_t block_size,
+                          size_t shmem, hipStream_t stream,
+                          void** args);
+
+#endif
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -9,11 +9,21 @@
 #include "KernelBase.hpp"
 
 #include "RunParams.hpp"
+#include "CounterUtils.hpp"
+#include "EnergyUtils.hpp"
+#include "GPUClockUtils.hpp"
+#include "CudaDataUtils.hpp"
+#include "HipDataUtils.hpp"
 #include "OpenMPTargetDataUtils.hpp"
+#include "OpenMPUtils.hpp"
+#include "TraceUtils.hpp"
+#include "InterferenceUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include <thread>
 
 namespace rajaperf {
 
@@ -35,6 +45,59 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params)
     uses_feature[fid] = false;
   }
 
+  for (size_t pid = 0; pid < NumPatterns; ++pid) {
+    has_pattern[pid] = false;
+  }
+
+  uses_data_types = false;
+  for (size_t idt = 0; idt < static_cast<size_t>(DataType::NumDataTypes); ++idt) {
+    uses_data_type[idt] = false;
+  }
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    num_data_type_tunings[vid] = 0;
+  }
+
+  uses_l2_persist_window = false;
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    num_l2_persist_tunings[vid] = 0;
+  }
+  l2_persist_ptr = nullptr;
+  l2_persist_nbytes = 0;
+
+  uses_shmem_carveout = false;
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    num_shmem_carveout_tunings[vid] = 0;
+  }
+  shmem_carveout = -1;
+
+  uses_storage_precisions = false;
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    num_storage_base_tunings[vid] = 0;
+  }
+
+  uses_index_widths = false;
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    num_index_base_tunings[vid] = 0;
+  }
+
+  uses_omp_target_thread_limit = false;
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    num_omp_target_tunings[vid] = 0;
+  }
+  omp_target_thread_limit = 0;
+  uses_omp_target_num_teams = false;
+  omp_target_num_teams = 0;
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    num_omp_thread_tunings[vid] = 0;
+  }
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    num_gpu_setting_tunings[vid] = 0;
+  }
+
+  rep_batching_allowed = true;
+
   its_per_rep = -1;
   kernels_per_rep = -1;
   bytes_per_rep = -1;
@@ -43,6 +106,26 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params)
   running_variant = NumVariants;
   running_tuning = getUnknownTuningIdx();
 
+  running_batch_reps = 0;
+  batch_start_time = 0.0;
+  running_probe = false;
+  running_cold_cache = false;
+  calibrated_reps = 0;
+
+  gpu_stream_idx = -1;
+  pass_idx = -1;
+  running_concurrently = false;
+
+  setup_data_cache_idx = 0;
+
+  device_elapsed = 0.0;
+#if defined(RAJA_ENABLE_CUDA)
+  have_cuda_timer_events = false;
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  have_hip_timer_events = false;
+#endif
+
   checksum_scale_factor = 1.0;
 
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
@@ -76,14 +159,91 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params)
                                            CALI_ATTR_ASVALUE |
                                            CALI_ATTR_AGGREGATABLE |
                                            CALI_ATTR_SKIP_EVENTS);
+  // pass index is a context attribute so samples and region profiles can be
+  // grouped by pass
+  Pass_attr = cali_create_attribute("Pass", CALI_TYPE_INT, CALI_ATTR_DEFAULT);
+
+  cali_kernel_region = getName();
+  cali_group_region = getGroupName(cali_kernel_region);
 #endif
 }
 
 
 KernelBase::~KernelBase()
 {
+  // owners stop background runs before deleting, this only avoids
+  // destroying a joinable thread
+  if (background_thread.joinable()) {
+    background_stop = true;
+    background_thread.join();
+  }
+  if (setup_thread.joinable()) {
+    setup_thread.join();
+  }
+
+  clearSetupDataCache();
+
+#if defined(RAJA_ENABLE_CUDA)
+  if (have_cuda_timer_events) {
+    cudaErrchk( cudaEventDestroy( cuda_timer_events[0] ) );
+    cudaErrchk( cudaEventDestroy( cuda_timer_events[1] ) );
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if (have_hip_timer_events) {
+    hipErrchk( hipEventDestroy( hip_timer_events[0] ) );
+    hipErrchk( hipEventDestroy( hip_timer_events[1] ) );
+  }
+#endif
+}
+
+
+Index_type KernelBase::getKernelParam(const std::string& param_name,
+                                      Index_type default_value,
+                                      Index_type min_value,
+                                      Index_type max_value)
+{
+  long value = static_cast<long>(default_value);
+  run_params.getKernelParam(name, param_name, value);
+  const Index_type param_value =
+      std::min(std::max(static_cast<Index_type>(value), min_value), max_value);
+  kernel_params.emplace_back(KernelParam{param_name, param_value,
+                                         min_value, max_value, {}});
+  return param_value;
+}
+
+Index_type KernelBase::getKernelParam(const std::string& param_name,
+                                      Index_type default_value,
+                                      const std::vector<Index_type>& valid_values)
+{
+  long value = static_cast<long>(default_value);
+  run_params.getKernelParam(name, param_name, value);
+  Index_type min_value = default_value;
+  Index_type max_value = default_value;
+  for (Index_type valid_value : valid_values) {
+    min_value = std::min(min_value, valid_value);
+    max_value = std::max(max_value, valid_value);
+  }
+  kernel_params.emplace_back(KernelParam{param_name,
+                                         static_cast<Index_type>(value),
+                                         min_value, max_value, valid_values});
+  return static_cast<Index_type>(value);
 }
 
+std::string KernelBase::getKernelParamsString() const
+{
+  if (kernel_params.empty()) {
+    return "-";
+  }
+  std::string str;
+  for (const KernelParam& param : kernel_params) {
+    if (!str.empty()) {
+      str += " ";
+    }
+    str += param.name + "=" + std::to_string(param.value);
+  }
+  return str;
+}
 
 Index_type KernelBase::getTargetProblemSize() const
 {
@@ -94,20 +254,47 @@ Index_type KernelBase::getTargetProblemSize() const
   } else if (run_params.getSizeMeaning() == RunParams::SizeMeaning::Direct) {
     target_size = static_cast<Index_type>(run_params.getSize());
   }
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  // with strong scaling each rank runs its share of the global size
+  if (run_params.getMPIScaling() == RunParams::StrongScaling) {
+    int num_ranks = 1;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+    target_size = std::max(static_cast<Index_type>(1),
+                           static_cast<Index_type>(
+                               RAJA_DIVIDE_CEILING_INT(target_size, num_ranks)));
+  }
+#endif
   return target_size;
 }
 
 Index_type KernelBase::getRunReps() const
 {
   Index_type run_reps = static_cast<Index_type>(0);
-  if (run_params.getInputState() == RunParams::CheckRun) {
+  if (running_batch_reps > 0) {
+    run_reps = running_batch_reps;
+  } else if (run_params.getInputState() == RunParams::CheckRun) {
     run_reps = static_cast<Index_type>(run_params.getCheckRunReps());
+  } else if (calibrated_reps > 0) {
+    run_reps = calibrated_reps;
   } else {
     run_reps = static_cast<Index_type>(default_reps*run_params.getRepFactor());
   }
   return run_reps;
 }
 
+Index_type KernelBase::getRepBatchSize() const
+{
+  Index_type batch_reps = static_cast<Index_type>(0);
+  if (run_params.getTimingBatchReps() > 0) {
+    batch_reps = getRunReps();
+    if (rep_batching_allowed) {
+      batch_reps = std::min(batch_reps,
+          static_cast<Index_type>(run_params.getTimingBatchReps()));
+    }
+  }
+  return batch_reps;
+}
+
 void KernelBase::setVariantDefined(VariantID vid)
 {
   if (!isVariantAvailable(vid)) return;
@@ -164,6 +351,15 @@ void KernelBase::setVariantDefined(VariantID vid)
     {
 #if defined(RAJA_ENABLE_HIP)
       setHipTuningDefinitions(vid);
+#endif
+      break;
+    }
+
+    case Base_SYCL :
+    case RAJA_SYCL :
+    {
+#if defined(RAJA_ENABLE_SYCL)
+      setSyclTuningDefinitions(vid);
 #endif
       break;
     }
@@ -184,17 +380,378 @@ void KernelBase::setVariantDefined(VariantID vid)
     }
   }
 
+  //
+  // Add a tuning for each storage precision given with '--storage-precisions'
+  // to the Base variants of kernels with storage tunings, before the data
+  // type repeats so storage tunings run with each data type. They are opt in
+  // as their checksums differ from the reference by the storage error
+  //
+  if (uses_storage_precisions &&
+      !run_params.getStoragePrecisions().empty() &&
+      (vid == Base_Seq || vid == Base_OpenMP ||
+       vid == Base_CUDA || vid == Base_HIP)) {
+    num_storage_base_tunings[vid] = variant_tuning_names[vid].size();
+    for (StoragePrecision precision : run_params.getStoragePrecisions()) {
+      addVariantTuningName(vid, storage::getTuningName(precision));
+    }
+  }
+
+  //
+  // Add a tuning for each index width to the Base variants of kernels with
+  // index width tunings
+  //
+  if (uses_index_widths &&
+      (vid == Base_Seq || vid == Base_OpenMP ||
+       vid == Base_CUDA || vid == Base_HIP)) {
+    num_index_base_tunings[vid] = variant_tuning_names[vid].size();
+    for (int iw = 1; iw < static_cast<int>(IndexWidth::NumIndexWidths); ++iw) {
+      addVariantTuningName(vid,
+          index_width::getTuningName(static_cast<IndexWidth>(iw)));
+    }
+  }
+
+  num_data_type_tunings[vid] = variant_tuning_names[vid].size();
+
+  //
+  // Repeat the tunings of kernels using data types for each data type,
+  // appending the data type name to each tuning name
+  //
+  if (uses_data_types && !data_types.empty()) {
+    std::vector<std::string> tuning_names;
+    tuning_names.swap(variant_tuning_names[vid]);
+    std::vector<bool> tuning_reproducible;
+    tuning_reproducible.swap(variant_tuning_reproducible[vid]);
+    for (DataType dt : data_types) {
+      for (size_t t = 0; t < tuning_names.size(); ++t) {
+        std::string name = tuning_names[t] + "_" + getDataTypeName(dt);
+        if (tuning_reproducible[t]) {
+          addReproducibleVariantTuningName(vid, std::move(name));
+        } else {
+          addVariantTuningName(vid, std::move(name));
+        }
+      }
+    }
+  }
+
+#if defined(RAJA_ENABLE_CUDA)
+  //
+  // Repeat the CUDA tunings of kernels with a reused array, appending
+  // "_l2persist" to each tuning name, after the data type tunings so a
+  // repeat runs the tuning at its index modulo the number of tunings
+  //
+  if (uses_l2_persist_window &&
+      (vid == Base_CUDA || vid == Lambda_CUDA || vid == RAJA_CUDA) &&
+      haveCudaL2PersistWindow()) {
+    const size_t num_tunings = variant_tuning_names[vid].size();
+    num_l2_persist_tunings[vid] = num_tunings;
+    for (size_t t = 0; t < num_tunings; ++t) {
+      std::string name = variant_tuning_names[vid][t] + "_l2persist";
+      if (variant_tuning_reproducible[vid][t]) {
+        addReproducibleVariantTuningName(vid, std::move(name));
+      } else {
+        addVariantTuningName(vid, std::move(name));
+      }
+    }
+  }
+
+  //
+  // Repeat the Base CUDA tunings of kernels that set their shared memory
+  // carve-out for each carve-out, appending "_carveout_<n>" to each tuning
+  // name, after the L2 persist tunings
+  //
+  if (uses_shmem_carveout && vid == Base_CUDA &&
+      !run_params.getGPUShmemCarveouts().empty()) {
+    const size_t num_tunings = variant_tuning_names[vid].size();
+    num_shmem_carveout_tunings[vid] = num_tunings;
+    for (int carveout : run_params.getGPUShmemCarveouts()) {
+      for (size_t t = 0; t < num_tunings; ++t) {
+        std::string name = variant_tuning_names[vid][t] + "_carveout_" +
+                           std::to_string(carveout);
+        if (variant_tuning_reproducible[vid][t]) {
+          addReproducibleVariantTuningName(vid, std::move(name));
+        } else {
+          addVariantTuningName(vid, std::move(name));
+        }
+      }
+    }
+  }
+#endif
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+  //
+  // Repeat the Base OpenMP target tunings of kernels with a tunable thread
+  // limit or number of teams for each thread limit and number of teams,
+  // appending "_tl_<n>" and "_nt_<n>" to each tuning name, 0 is the kernel
+  // default thread limit or no num_teams clause. The RAJA variants take the
+  // number of threads as a template argument
+  //
+  if (vid == Base_OpenMPTarget) {
+    std::vector<int> thread_limits{0};
+    if (uses_omp_target_thread_limit) {
+      thread_limits.insert(thread_limits.end(),
+                           run_params.getOpenMPTargetThreadLimits().begin(),
+                           run_params.getOpenMPTargetThreadLimits().end());
+    }
+    std::vector<int> num_teams{0};
+    if (uses_omp_target_num_teams) {
+      num_teams.insert(num_teams.end(),
+                       run_params.getOpenMPTargetNumTeams().begin(),
+                       run_params.getOpenMPTargetNumTeams().end());
+    }
+    omp_target_launch_configs.clear();
+    for (int nt : num_teams) {
+      for (int tl : thread_limits) {
+        if (tl > 0 || nt > 0) {
+          omp_target_launch_configs.emplace_back(tl, nt);
+        }
+      }
+    }
+
+    const size_t num_tunings = variant_tuning_names[vid].size();
+    if (!omp_target_launch_configs.empty()) {
+      num_omp_target_tunings[vid] = num_tunings;
+    }
+    for (const auto& config : omp_target_launch_configs) {
+      std::string suffix;
+      if (config.first > 0) {
+        suffix += "_tl_" + std::to_string(config.first);
+      }
+      if (config.second > 0) {
+        suffix += "_nt_" + std::to_string(config.second);
+      }
+      for (size_t t = 0; t < num_tunings; ++t) {
+        std::string name = variant_tuning_names[vid][t] + suffix;
+        if (variant_tuning_reproducible[vid][t]) {
+          addReproducibleVariantTuningName(vid, std::move(name));
+        } else {
+          addVariantTuningName(vid, std::move(name));
+        }
+      }
+    }
+  }
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  //
+  // Repeat the OpenMP tunings for each number of threads, appending
+  // "_thr_<n>" to each tuning name, the repeats run one after another in
+  // ascending number of threads
+  //
+  if ((vid == Base_OpenMP || vid == Lambda_OpenMP || vid == RAJA_OpenMP) &&
+      !run_params.getOpenMPThreadCounts().empty()) {
+    const size_t num_tunings = variant_tuning_names[vid].size();
+    num_omp_thread_tunings[vid] = num_tunings;
+    for (int num_threads : run_params.getOpenMPThreadCounts()) {
+      for (size_t t = 0; t < num_tunings; ++t) {
+        std::string name = variant_tuning_names[vid][t] + "_thr_" +
+                           std::to_string(num_threads);
+        if (variant_tuning_reproducible[vid][t]) {
+          addReproducibleVariantTuningName(vid, std::move(name));
+        } else {
+          addVariantTuningName(vid, std::move(name));
+        }
+      }
+    }
+  }
+#endif
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+  //
+  // Repeat the GPU tunings for each clock cap and power limit, appending
+  // "_clk_<n>" or "_pwr_<n>" to each tuning name, after all other repeats
+  // so the GPU is set once around each repeated tuning
+  //
+  if ((vid == Base_CUDA || vid == Lambda_CUDA || vid == RAJA_CUDA ||
+       vid == Base_HIP || vid == Lambda_HIP || vid == RAJA_HIP) &&
+      !run_params.getGPUSettings().empty()) {
+    const size_t num_tunings = variant_tuning_names[vid].size();
+    num_gpu_setting_tunings[vid] = num_tunings;
+    for (const RunParams::GPUSetting& setting : run_params.getGPUSettings()) {
+      for (size_t t = 0; t < num_tunings; ++t) {
+        std::string name = variant_tuning_names[vid][t] + "_" +
+                           setting.getName();
+        if (variant_tuning_reproducible[vid][t]) {
+          addReproducibleVariantTuningName(vid, std::move(name));
+        } else {
+          addVariantTuningName(vid, std::move(name));
+        }
+      }
+    }
+  }
+#endif
+
   checksum[vid].resize(variant_tuning_names[vid].size(), 0.0);
   num_exec[vid].resize(variant_tuning_names[vid].size(), 0);
   min_time[vid].resize(variant_tuning_names[vid].size(), std::numeric_limits<double>::max());
   max_time[vid].resize(variant_tuning_names[vid].size(), -std::numeric_limits<double>::max());
   tot_time[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  min_device_time[vid].resize(variant_tuning_names[vid].size(), std::numeric_limits<double>::max());
+  max_device_time[vid].resize(variant_tuning_names[vid].size(), -std::numeric_limits<double>::max());
+  tot_device_time[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  rep_batch_times[vid].resize(variant_tuning_names[vid].size());
+  pass_time[vid].resize(variant_tuning_names[vid].size());
+  pass_device_time[vid].resize(variant_tuning_names[vid].size());
+  pass_checksums[vid].resize(variant_tuning_names[vid].size());
+  cached_checksums[vid].resize(variant_tuning_names[vid].size());
+  cold_cache_pass_time[vid].resize(variant_tuning_names[vid].size());
+  tuning_block_size[vid].resize(variant_tuning_names[vid].size(), nan(""));
+  tot_counters_per_rep[vid].resize(variant_tuning_names[vid].size());
+  tot_energy_per_rep[vid].resize(variant_tuning_names[vid].size());
+  tot_minor_page_faults[vid].resize(variant_tuning_names[vid].size(), 0);
+  tot_major_page_faults[vid].resize(variant_tuning_names[vid].size(), 0);
+  device_setup_data_bytes[vid].resize(variant_tuning_names[vid].size(), 0);
+  peak_device_data_bytes[vid].resize(variant_tuning_names[vid].size(), 0);
+  peak_device_memory_bytes[vid].resize(variant_tuning_names[vid].size(), 0);
+  gpu_func_attributes[vid].resize(variant_tuning_names[vid].size());
+  pass_telemetry[vid].resize(variant_tuning_names[vid].size());
+  num_discarded_passes[vid].resize(variant_tuning_names[vid].size(), 0);
+  tot_device_busy_time[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  tot_device_ops[vid].resize(variant_tuning_names[vid].size(), 0);
+  tot_phase_time[vid].resize(variant_tuning_names[vid].size(),
+      std::vector<RAJA::Timer::ElapsedType>(phase_names.size(), 0.0));
   #if defined(RAJA_PERFSUITE_USE_CALIPER)
     doCaliMetaOnce[vid].resize(variant_tuning_names[vid].size(), true);
   #endif
 }
 
-int KernelBase::getDataAlignment() const
+void KernelBase::setUsesDataTypes()
+{
+  uses_data_types = true;
+  for (size_t idt = 0; idt < static_cast<size_t>(DataType::NumDataTypes); ++idt) {
+    uses_data_type[idt] = true;
+  }
+
+  data_types = run_params.getDataTypes();
+}
+
+void KernelBase::setUsesFloatingPointDataTypes()
+{
+  uses_data_types = true;
+  uses_data_type[static_cast<size_t>(DataType::Float)] = true;
+  uses_data_type[static_cast<size_t>(DataType::Double)] = true;
+
+  data_types.clear();
+  for (DataType dt : run_params.getDataTypes()) {
+    if (usesDataType(dt)) {
+      data_types.push_back(dt);
+    }
+  }
+}
+
+DataType KernelBase::getDataType(VariantID vid, size_t tune_idx) const
+{
+  if (num_gpu_setting_tunings[vid] > 0) {
+    tune_idx %= num_gpu_setting_tunings[vid];
+  }
+  if (num_omp_thread_tunings[vid] > 0) {
+    tune_idx %= num_omp_thread_tunings[vid];
+  }
+  if (num_omp_target_tunings[vid] > 0) {
+    tune_idx %= num_omp_target_tunings[vid];
+  }
+  if (num_shmem_carveout_tunings[vid] > 0) {
+    tune_idx %= num_shmem_carveout_tunings[vid];
+  }
+  if (num_l2_persist_tunings[vid] > 0) {
+    tune_idx %= num_l2_persist_tunings[vid];
+  }
+  if (uses_data_types && !data_types.empty() && num_data_type_tunings[vid] > 0) {
+    return data_types.at(tune_idx / num_data_type_tunings[vid]);
+  }
+#if defined(RP_USE_FLOAT)
+  return DataType::Float;
+#else
+  return DataType::Double;
+#endif
+}
+
+size_t KernelBase::getDataTypeTuningIdx(VariantID vid, size_t tune_idx) const
+{
+  if (num_gpu_setting_tunings[vid] > 0) {
+    tune_idx %= num_gpu_setting_tunings[vid];
+  }
+  if (num_omp_thread_tunings[vid] > 0) {
+    tune_idx %= num_omp_thread_tunings[vid];
+  }
+  if (num_omp_target_tunings[vid] > 0) {
+    tune_idx %= num_omp_target_tunings[vid];
+  }
+  if (num_shmem_carveout_tunings[vid] > 0) {
+    tune_idx %= num_shmem_carveout_tunings[vid];
+  }
+  if (num_l2_persist_tunings[vid] > 0) {
+    tune_idx %= num_l2_persist_tunings[vid];
+  }
+  if (uses_data_types && num_data_type_tunings[vid] > 0) {
+    return tune_idx % num_data_type_tunings[vid];
+  }
+  return tune_idx;
+}
+
+StoragePrecision KernelBase::getStoragePrecision(VariantID vid, size_t tune_idx) const
+{
+  const size_t num_tunings = num_storage_base_tunings[vid];
+  const size_t dt_tune_idx = getDataTypeTuningIdx(vid, tune_idx);
+  const size_t num_precisions = run_params.getStoragePrecisions().size();
+  if (num_tunings > 0 && dt_tune_idx >= num_tunings &&
+      dt_tune_idx < num_tunings + num_precisions) {
+    return run_params.getStoragePrecisions().at(dt_tune_idx - num_tunings);
+  }
+  return StoragePrecision::Default;
+}
+
+IndexWidth KernelBase::getIndexWidth(VariantID vid, size_t tune_idx) const
+{
+  const size_t num_tunings = num_index_base_tunings[vid];
+  const size_t dt_tune_idx = getDataTypeTuningIdx(vid, tune_idx);
+  const size_t num_widths =
+      static_cast<size_t>(IndexWidth::NumIndexWidths) - 1;
+  if (num_tunings > 0 && dt_tune_idx >= num_tunings &&
+      dt_tune_idx < num_tunings + num_widths) {
+    return static_cast<IndexWidth>(dt_tune_idx - num_tunings + 1);
+  }
+  return IndexWidth::Default;
+}
+
+int KernelBase::getOpenMPTuningThreads(VariantID vid, size_t tune_idx) const
+{
+  const size_t num_tunings = num_omp_thread_tunings[vid];
+  if (num_tunings > 0 && tune_idx >= num_tunings) {
+    return run_params.getOpenMPThreadCounts().at(tune_idx / num_tunings - 1);
+  }
+  return 0;
+}
+
+const RunParams::GPUSetting* KernelBase::getGPUTuningSetting(VariantID vid,
+                                                             size_t tune_idx) const
+{
+  const size_t num_tunings = num_gpu_setting_tunings[vid];
+  if (num_tunings > 0 && tune_idx >= num_tunings) {
+    return &run_params.getGPUSettings().at(tune_idx / num_tunings - 1);
+  }
+  return nullptr;
+}
+
+//
+// Bytes per rep are given for elements of Real_type, kernels using data
+// types move only elements of their data type and storage tunings only
+// elements of their storage precision.
+//
+Index_type KernelBase::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const StoragePrecision precision = getStoragePrecision(vid, tune_idx);
+  if (precision != StoragePrecision::Default) {
+    return bytes_per_rep / static_cast<Index_type>(sizeof(Real_type)) *
+           static_cast<Index_type>(storage::getElementSize(precision));
+  }
+  if (!uses_data_types) {
+    return bytes_per_rep;
+  }
+  return bytes_per_rep / static_cast<Index_type>(sizeof(Real_type)) *
+         static_cast<Index_type>(getDataTypeSize(getDataType(vid, tune_idx)));
+}
+
+size_t KernelBase::getDataAlignment() const
 {
   return run_params.getDataAlignment();
 }
@@ -227,6 +784,10 @@ DataSpace KernelBase::getDataSpace(VariantID vid) const
     case RAJA_HIP :
       return run_params.getHipDataSpace();
 
+    case Base_SYCL :
+    case RAJA_SYCL :
+      return run_params.getSyclDataSpace();
+
     case Kokkos_Lambda :
       return run_params.getKokkosDataSpace();
 
@@ -240,61 +801,1400 @@ DataSpace KernelBase::getHostAccessibleDataSpace(VariantID vid) const
   return hostAccessibleDataSpace(getDataSpace(vid));
 }
 
+void KernelBase::clearSetupDataCache()
+{
+  for (auto& ds_cache : setup_data_cache) {
+    for (CachedSetupData& cached : ds_cache.second) {
+      rajaperf::detail::deallocData(ds_cache.first, cached.ptr);
+    }
+  }
+  setup_data_cache.clear();
+}
+
+std::string KernelBase::getExecutePhaseName(ExecutePhase phase)
+{
+  switch (phase) {
+    case SetUpPhase : return "SetUp";
+    case RunPhase : return "Run";
+    case ChecksumPhase : return "Checksum";
+    case TearDownPhase : return "TearDown";
+    default : return "Unknown";
+  }
+}
+
+//
+// The phases are timed back to back, so the cold cache reps are counted in
+// the setUp phase.
+//
 void KernelBase::execute(VariantID vid, size_t tune_idx)
 {
+  waitPipelinedSetUp();
+
   running_variant = vid;
   running_tuning = tune_idx;
 
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  // data is first touched with the number of threads of the tuning
+  ScopedNumThreads scoped_num_threads(getOpenMPTuningThreads(vid, tune_idx));
+#endif
+
+  // the GPU is set for the whole pass, its clocks settle before timing
+  detail::ScopedGPUSetting scoped_gpu_setting(getGPUTuningSetting(vid, tune_idx));
+
+  const double pass_trace_start = startTraceEvent();
+  double phase_trace_start = pass_trace_start;
+
+  RAJA::Timer phase_timer;
+  auto endPhase = [&](ExecutePhase phase) {
+    phase_timer.stop();
+    execute_phase_time[phase] += phase_timer.elapsed();
+    phase_timer.reset();
+    phase_timer.start();
+    if (detail::haveTrace()) {
+      stopTraceEvent(getExecutePhaseName(phase), "phase", vid, tune_idx,
+                     phase_trace_start);
+      phase_trace_start = startTraceEvent();
+    }
+  };
+  phase_timer.start();
+
+  if (run_params.getColdCache() && hasVariantDefined(vid)) {
+    runColdCacheReps(vid, tune_idx);
+  }
+
   resetTimer();
 
-  detail::resetDataInitCount();
-  this->setUp(vid, tune_idx);
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  if (doCaliperTiming) {
+    cali_begin_int(Pass_attr, pass_idx);
+  }
+#endif
+
+  if (prepared_variant != NumVariants &&
+      (prepared_variant != vid || prepared_tuning != tune_idx)) {
+    this->tearDown(prepared_variant, prepared_tuning);
+    prepared_variant = NumVariants;
+  }
+
+  startDeviceMemory(vid);
+
+  if (prepared_variant == vid) {
+    // set up by startPipelinedSetUp while the kernel before this one ran,
+    // its time is counted as the setUp time of this pass
+    execute_phase_time[SetUpPhase] += prepared_setup_time;
+    prepared_variant = NumVariants;
+  } else {
+    detail::resetDataInitCount();
+    setup_data_cache_idx = 0;
+    CALI_PHASE_START("setUp");
+    this->setUp(vid, tune_idx);
+    CALI_PHASE_STOP("setUp");
+  }
+  if (isVariantGPU(vid)) {
+    detail::applyManagedPolicy(run_params.getManagedPolicy());
+  }
+  const size_t live_bytes_after_setup = detail::getDataLiveBytes();
+  if (tracking_device_memory) {
+    sampleDeviceMemory();
+    const size_t data_bytes = detail::getDataLiveDeviceBytes();
+    device_setup_data_bytes[vid].at(tune_idx) =
+        (data_bytes > device_data_start_bytes) ? data_bytes - device_data_start_bytes : 0;
+  }
+  endPhase(SetUpPhase);
 
   this->runKernel(vid, tune_idx);
+  endPhase(RunPhase);
 
-  this->updateChecksum(vid, tune_idx);
+  if (post_run_hook) {
+    std::function<void()> hook = std::move(post_run_hook);
+    post_run_hook = nullptr;
+    hook();
+  }
+
+  CALI_PHASE_START("checksum");
+  updatePassChecksum(vid, tune_idx);
+  CALI_PHASE_STOP("checksum");
+  endPhase(ChecksumPhase);
 
+  stopDeviceMemory(vid, tune_idx);
+
+  CALI_PHASE_START("tearDown");
   this->tearDown(vid, tune_idx);
+  CALI_PHASE_STOP("tearDown");
+  endPhase(TearDownPhase);
+
+  // data live after tearDown, ie. cached setup data, is not part of the
+  // footprint of this variant
+  const size_t live_bytes_after_teardown = detail::getDataLiveBytes();
+  if (live_bytes_after_setup > live_bytes_after_teardown) {
+    data_footprint = std::max(data_footprint,
+        live_bytes_after_setup - live_bytes_after_teardown);
+  }
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  if (doCaliperTiming) {
+    cali_end(Pass_attr);
+  }
+#endif
+
+  stopTraceEvent(getName(), "pass", vid, tune_idx, pass_trace_start);
 
   running_variant = NumVariants;
   running_tuning = getUnknownTuningIdx();
 }
 
-void KernelBase::recordExecTime()
+//
+// The elapsed counters, energy, page faults, and phase times of the last
+// pass are still held, so what recordExecTime added for it is subtracted,
+// the min and max times are found again from the remaining passes.
+//
+void KernelBase::discardLastPass(VariantID vid, size_t tune_idx)
 {
-  num_exec[running_variant].at(running_tuning)++;
+  if (num_exec[vid].at(tune_idx) == 0) {
+    return;
+  }
 
-  RAJA::Timer::ElapsedType exec_time = timer.elapsed();
-  min_time[running_variant].at(running_tuning) =
-      std::min(min_time[running_variant].at(running_tuning), exec_time);
-  max_time[running_variant].at(running_tuning) =
-      std::max(max_time[running_variant].at(running_tuning), exec_time);
-  tot_time[running_variant].at(running_tuning) += exec_time;
+  num_exec[vid].at(tune_idx)--;
+  num_discarded_passes[vid].at(tune_idx)++;
+
+  std::vector<RAJA::Timer::ElapsedType>& times = pass_time[vid].at(tune_idx);
+  tot_time[vid].at(tune_idx) -= times.back();
+  times.pop_back();
+  min_time[vid].at(tune_idx) = times.empty() ? std::numeric_limits<double>::max()
+      : *std::min_element(times.begin(), times.end());
+  max_time[vid].at(tune_idx) = times.empty() ? -std::numeric_limits<double>::max()
+      : *std::max_element(times.begin(), times.end());
+
+  std::vector<RAJA::Timer::ElapsedType>& device_times =
+      pass_device_time[vid].at(tune_idx);
+  if (usingDeviceTimer() && !device_times.empty()) {
+    tot_device_time[vid].at(tune_idx) -= device_times.back();
+    device_times.pop_back();
+    min_device_time[vid].at(tune_idx) = device_times.empty()
+        ? std::numeric_limits<double>::max()
+        : *std::min_element(device_times.begin(), device_times.end());
+    max_device_time[vid].at(tune_idx) = device_times.empty()
+        ? -std::numeric_limits<double>::max()
+        : *std::max_element(device_times.begin(), device_times.end());
+  }
+
+  const Index_type batch_reps = getRepBatchSize();
+  if (batch_reps > 0) {
+    std::vector<RAJA::Timer::ElapsedType>& batch_times =
+        rep_batch_times[vid].at(tune_idx);
+    const size_t num_batches = RAJA_DIVIDE_CEILING_INT(getRunReps(), batch_reps);
+    batch_times.resize(batch_times.size() - std::min(num_batches, batch_times.size()));
+  }
+
+  const Index_type run_reps = getRunReps();
+  std::vector<double>& tot_counters = tot_counters_per_rep[vid].at(tune_idx);
+  for (size_t ic = 0; ic < std::min(tot_counters.size(), counter_elapsed.size()); ++ic) {
+    tot_counters[ic] -= static_cast<double>(counter_elapsed[ic]) / run_reps;
+  }
+  std::vector<double>& tot_energy = tot_energy_per_rep[vid].at(tune_idx);
+  for (size_t im = 0; im < std::min(tot_energy.size(), energy_elapsed.size()); ++im) {
+    tot_energy[im] -= energy_elapsed[im] / run_reps;
+  }
+  if (run_params.getCountPageFaults()) {
+    tot_minor_page_faults[vid].at(tune_idx) -= page_faults_elapsed[0];
+    tot_major_page_faults[vid].at(tune_idx) -= page_faults_elapsed[1];
+  }
+  std::vector<RAJA::Timer::ElapsedType>& tot_phases = tot_phase_time[vid].at(tune_idx);
+  for (size_t ip = 0; ip < std::min(tot_phases.size(), phase_timers.size()); ++ip) {
+    tot_phases[ip] -= phase_timers[ip].elapsed();
+  }
+
+  std::vector<Checksum_type>& checksums = pass_checksums[vid].at(tune_idx);
+  if (!checksums.empty()) {
+    checksum[vid].at(tune_idx) -= checksums.back();
+    checksums.pop_back();
+  }
+
+  if (!pass_telemetry[vid].at(tune_idx).empty()) {
+    pass_telemetry[vid].at(tune_idx).pop_back();
+  }
+
+  if (detail::haveActivityTracing() && isVariantGPU(vid)) {
+    tot_device_busy_time[vid].at(tune_idx) -= activity_elapsed.busy_time;
+    tot_device_ops[vid].at(tune_idx) -= activity_elapsed.num_ops;
+  }
 }
 
-void KernelBase::runKernel(VariantID vid, size_t tune_idx)
+void KernelBase::addResumedPass(VariantID vid, size_t tune_idx,
+                                RAJA::Timer::ElapsedType time,
+                                RAJA::Timer::ElapsedType device_time,
+                                Checksum_type pass_checksum, double block_size)
 {
-  if ( !hasVariantDefined(vid) ) {
-    return;
+  num_exec[vid].at(tune_idx)++;
+  min_time[vid].at(tune_idx) = std::min(min_time[vid].at(tune_idx), time);
+  max_time[vid].at(tune_idx) = std::max(max_time[vid].at(tune_idx), time);
+  tot_time[vid].at(tune_idx) += time;
+  pass_time[vid].at(tune_idx).emplace_back(time);
+  tuning_block_size[vid].at(tune_idx) = block_size;
+
+  if (!std::isnan(device_time)) {
+    min_device_time[vid].at(tune_idx) =
+        std::min(min_device_time[vid].at(tune_idx), device_time);
+    max_device_time[vid].at(tune_idx) =
+        std::max(max_device_time[vid].at(tune_idx), device_time);
+    tot_device_time[vid].at(tune_idx) += device_time;
+    pass_device_time[vid].at(tune_idx).emplace_back(device_time);
   }
 
-#if defined(RAJA_PERFSUITE_USE_CALIPER)
-  if (doCaliperTiming) {
-    KernelBase::setCaliperMgrStart(vid, getVariantTuningName(vid, tune_idx));
+  checksum[vid].at(tune_idx) += pass_checksum;
+  pass_checksums[vid].at(tune_idx).emplace_back(pass_checksum);
+}
+
+//
+// The checksum of the pass is computed from zero so it can be compared
+// bitwise with the checksums of other passes.
+//
+void KernelBase::updatePassChecksum(VariantID vid, size_t tune_idx)
+{
+  const Checksum_type prev_checksum = checksum[vid].at(tune_idx);
+  checksum[vid].at(tune_idx) = 0.0;
+
+  if (run_params.getChecksumOnce()) {
+    running_checksums = &cached_checksums[vid].at(tune_idx);
+    running_checksum_idx = 0;
   }
-#endif
+  this->updateChecksum(vid, tune_idx);
+  running_checksums = nullptr;
 
-  switch ( vid ) {
+  pass_checksums[vid].at(tune_idx).emplace_back(checksum[vid].at(tune_idx));
+  checksum[vid].at(tune_idx) += prev_checksum;
+}
 
+bool KernelBase::isVariantTuningReproducible(VariantID vid,
+                                             size_t tune_idx) const
+{
+  switch ( vid ) {
     case Base_Seq :
-    {
-      runSeqVariant(vid, tune_idx);
-      break;
-    }
-
     case Lambda_Seq :
     case RAJA_Seq :
-    {
+      return true;
+    default :
+      return variant_tuning_reproducible[vid].at(tune_idx);
+  }
+}
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+RAJA::Timer::ElapsedType KernelBase::executeConcurrently(
+    const std::vector<KernelBase*>& kernels, VariantID vid,
+    const std::vector<size_t>& tune_idxs)
+{
+  return executeConcurrently(kernels,
+      std::vector<VariantID>(kernels.size(), vid), tune_idxs);
+}
+
+RAJA::Timer::ElapsedType KernelBase::executeConcurrently(
+    const std::vector<KernelBase*>& kernels,
+    const std::vector<VariantID>& vids,
+    const std::vector<size_t>& tune_idxs)
+{
+  //
+  // Set up all kernels first so data initialization, which uses
+  // a shared counter, happens in the same order as in execute.
+  //
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+    kern->running_variant = vids[ik];
+    kern->running_tuning = tune_idxs[ik];
+
+    kern->resetTimer();
+
+    detail::resetDataInitCount();
+    kern->setup_data_cache_idx = 0;
+    kern->setUp(vids[ik], tune_idxs[ik]);
+
+    kern->running_concurrently = true;
+  }
+
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk( cudaDeviceSynchronize() );
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  hipErrchk( hipDeviceSynchronize() );
+#endif
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+  // new host threads must use the same device as this thread
+#if defined(RAJA_ENABLE_CUDA)
+  const int cuda_device = getCudaDevice();
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  const int hip_device = getHipDevice();
+#endif
+
+  detail::HostTimer wall_timer;
+  wall_timer.start();
+
+  std::vector<std::thread> threads;
+  threads.reserve(kernels.size());
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+    VariantID vid = vids[ik];
+    size_t tune_idx = tune_idxs[ik];
+    threads.emplace_back([=]() {
+#if defined(RAJA_ENABLE_CUDA)
+      cudaErrchk( cudaSetDevice( cuda_device ) );
+#endif
+#if defined(RAJA_ENABLE_HIP)
+      hipErrchk( hipSetDevice( hip_device ) );
+#endif
+      kern->runVariantTuning(vid, tune_idx);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  wall_timer.stop();
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+    kern->running_concurrently = false;
+
+    kern->updatePassChecksum(vids[ik], tune_idxs[ik]);
+
+    kern->tearDown(vids[ik], tune_idxs[ik]);
+
+    kern->running_variant = NumVariants;
+    kern->running_tuning = getUnknownTuningIdx();
+  }
+
+  return wall_timer.elapsed();
+}
+#endif
+
+RAJA::Timer::ElapsedType KernelBase::executeInterleaved(
+    const std::vector<KernelBase*>& kernels, VariantID vid,
+    const std::vector<size_t>& tune_idxs, int num_cycles)
+{
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+    kern->running_variant = vid;
+    kern->running_tuning = tune_idxs[ik];
+
+    kern->resetTimer();
+
+    detail::resetDataInitCount();
+    kern->setup_data_cache_idx = 0;
+    kern->setUp(vid, tune_idxs[ik]);
+  }
+
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk( cudaDeviceSynchronize() );
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  hipErrchk( hipDeviceSynchronize() );
+#endif
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+  //
+  // Each kernel times its own reps, the timers accumulate over the cycles.
+  //
+  detail::HostTimer wall_timer;
+  wall_timer.start();
+
+  for (int ic = 0; ic < num_cycles; ++ic) {
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kernels[ik]->runVariantTuning(vid, tune_idxs[ik]);
+    }
+  }
+
+  wall_timer.stop();
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+
+    kern->updatePassChecksum(vid, tune_idxs[ik]);
+
+    kern->tearDown(vid, tune_idxs[ik]);
+
+    kern->running_variant = NumVariants;
+    kern->running_tuning = getUnknownTuningIdx();
+  }
+
+  return wall_timer.elapsed();
+}
+
+void KernelBase::startBackgroundRun(VariantID vid, size_t tune_idx, int cpu)
+{
+  if (background_thread.joinable()) {
+    return;
+  }
+
+  running_variant = vid;
+  running_tuning = tune_idx;
+
+  resetTimer();
+
+  detail::resetDataInitCount();
+  setup_data_cache_idx = 0;
+  this->setUp(vid, tune_idx);
+
+  // timers only synchronize the kernel stream and record nothing, the
+  // reps run one at a time so stopping waits for one rep at most
+  running_concurrently = true;
+  running_probe = true;
+  running_background = true;
+  running_batch_reps = 1;
+  background_stop = false;
+
+  // the background thread must use the same device as this thread
+#if defined(RAJA_ENABLE_CUDA)
+  const int cuda_device = getCudaDevice();
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  const int hip_device = getHipDevice();
+#endif
+
+  background_thread = std::thread([=]() {
+#if defined(RAJA_ENABLE_CUDA)
+    cudaErrchk( cudaSetDevice( cuda_device ) );
+#endif
+#if defined(RAJA_ENABLE_HIP)
+    hipErrchk( hipSetDevice( hip_device ) );
+#endif
+    detail::bindThreadToCPU(cpu);
+    while ( !background_stop ) {
+      runVariantTuning(vid, tune_idx);
+    }
+  });
+}
+
+void KernelBase::stopBackgroundRun()
+{
+  if (!background_thread.joinable()) {
+    return;
+  }
+
+  background_stop = true;
+  background_thread.join();
+
+  running_batch_reps = 0;
+  running_background = false;
+  running_probe = false;
+  running_concurrently = false;
+
+  this->tearDown(running_variant, running_tuning);
+
+  running_variant = NumVariants;
+  running_tuning = getUnknownTuningIdx();
+}
+
+void KernelBase::startPipelinedSetUp(VariantID vid, size_t tune_idx)
+{
+  if (setup_thread.joinable() || prepared_variant != NumVariants) {
+    return;
+  }
+
+  // the setup thread must use the same device as this thread
+#if defined(RAJA_ENABLE_CUDA)
+  const int cuda_device = getCudaDevice();
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  const int hip_device = getHipDevice();
+#endif
+
+  setup_thread = std::thread([=]() {
+#if defined(RAJA_ENABLE_CUDA)
+    cudaErrchk( cudaSetDevice( cuda_device ) );
+#endif
+#if defined(RAJA_ENABLE_HIP)
+    hipErrchk( hipSetDevice( hip_device ) );
+#endif
+    try {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+      ScopedNumThreads scoped_num_threads(getOpenMPTuningThreads(vid, tune_idx));
+#endif
+      running_variant = vid;
+      running_tuning = tune_idx;
+
+      RAJA::Timer setup_timer;
+      setup_timer.start();
+
+      // the data init counter is per thread, so data is initialized the
+      // same as in execute
+      detail::resetDataInitCount();
+      setup_data_cache_idx = 0;
+      this->setUp(vid, tune_idx);
+
+      // copies to the device are done before the next timed region
+      synchronize();
+
+      setup_timer.stop();
+      prepared_setup_time = setup_timer.elapsed();
+
+      running_variant = NumVariants;
+      running_tuning = getUnknownTuningIdx();
+
+      prepared_variant = vid;
+      prepared_tuning = tune_idx;
+    } catch (...) {
+      running_variant = NumVariants;
+      running_tuning = getUnknownTuningIdx();
+      setup_thread_error = std::current_exception();
+    }
+  });
+}
+
+void KernelBase::waitPipelinedSetUp()
+{
+  if (!setup_thread.joinable()) {
+    return;
+  }
+
+  setup_thread.join();
+
+  if (setup_thread_error) {
+    std::exception_ptr error = setup_thread_error;
+    setup_thread_error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void KernelBase::cancelPipelinedSetUp()
+{
+  if (setup_thread.joinable()) {
+    setup_thread.join();
+  }
+  // the pass the setup was for never runs, so what setUp threw is dropped
+  setup_thread_error = nullptr;
+
+  if (prepared_variant != NumVariants) {
+    this->tearDown(prepared_variant, prepared_tuning);
+    prepared_variant = NumVariants;
+  }
+}
+
+void KernelBase::runColdCacheReps(VariantID vid, size_t tune_idx)
+{
+  // kernels that index data by rep number run all reps after one flush
+  const Index_type run_reps = getRunReps();
+  const Index_type flush_reps = rep_batching_allowed ? 1 : run_reps;
+  const bool gpu = isVariantGPU(vid);
+
+  running_cold_cache = true;
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  const bool cali_timing = doCaliperTiming;
+  doCaliperTiming = false;
+#endif
+
+  resetTimer();
+
+  detail::resetDataInitCount();
+  setup_data_cache_idx = 0;
+  this->setUp(vid, tune_idx);
+  if (gpu) {
+    detail::applyManagedPolicy(run_params.getManagedPolicy());
+  }
+
+  for (Index_type irep = 0; irep < run_reps; irep += flush_reps) {
+    running_batch_reps = std::min(flush_reps, run_reps - irep);
+    detail::flushCaches(gpu);
+    runVariantTuning(vid, tune_idx);
+  }
+  running_batch_reps = 0;
+
+  this->tearDown(vid, tune_idx);
+
+  cold_cache_pass_time[vid].at(tune_idx).emplace_back(timer.elapsed());
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  doCaliperTiming = cali_timing;
+#endif
+
+  running_cold_cache = false;
+}
+
+RAJA::Timer::ElapsedType KernelBase::probeRepTime(
+    VariantID vid, size_t tune_idx, RAJA::Timer::ElapsedType min_time)
+{
+  //
+  // Run with doubling num reps until run takes at least min_time,
+  // kernels that index data by rep number are not probed beyond
+  // their run reps since their data size grows with reps.
+  //
+  const Index_type max_probe_reps =
+      rep_batching_allowed ? static_cast<Index_type>(1 << 20)
+                           : std::max(getRunReps(), static_cast<Index_type>(1));
+
+  running_variant = vid;
+  running_tuning = tune_idx;
+  running_probe = true;
+
+  const double trace_start = startTraceEvent();
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  const bool cali_timing = doCaliperTiming;
+  doCaliperTiming = false;
+#endif
+
+  RAJA::Timer::ElapsedType rep_time = 0.0;
+  for (Index_type probe_reps = 1; ;
+       probe_reps = std::min(2*probe_reps, max_probe_reps)) {
+
+    running_batch_reps = probe_reps;
+
+    resetTimer();
+
+    detail::resetDataInitCount();
+    setup_data_cache_idx = 0;
+    this->setUp(vid, tune_idx);
+
+    runVariantTuning(vid, tune_idx);
+
+    this->tearDown(vid, tune_idx);
+
+    running_batch_reps = 0;
+
+    // ranks must agree on num probes since timed regions have barriers
+    double probe_time = timer.elapsed();
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    MPI_Allreduce(MPI_IN_PLACE, &probe_time, 1, MPI_DOUBLE, MPI_MAX,
+                  MPI_COMM_WORLD);
+#endif
+
+    if (probe_time >= min_time || probe_reps >= max_probe_reps) {
+      rep_time = probe_time / probe_reps;
+      break;
+    }
+  }
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  doCaliperTiming = cali_timing;
+#endif
+
+  stopTraceEvent("Probe", "probe", vid, tune_idx, trace_start);
+
+  running_probe = false;
+  running_variant = NumVariants;
+  running_tuning = getUnknownTuningIdx();
+
+  return rep_time;
+}
+
+void KernelBase::probePhaseTimes(VariantID vid, size_t tune_idx,
+                                 RAJA::Timer::ElapsedType min_time,
+                                 double (&phase_times)[NumExecutePhases])
+{
+  phase_times[RunPhase] = probeRepTime(vid, tune_idx, min_time);
+
+  //
+  // Time setUp, checksum, and tearDown once as in execute, the checksum
+  // is not kept so the probe does not change the checksum of the kernel.
+  //
+  running_variant = vid;
+  running_tuning = tune_idx;
+  running_probe = true;
+
+  RAJA::Timer phase_timer;
+  auto endPhase = [&](ExecutePhase phase) {
+    phase_timer.stop();
+    phase_times[phase] = phase_timer.elapsed();
+    phase_timer.reset();
+    phase_timer.start();
+  };
+  phase_timer.start();
+
+  detail::resetDataInitCount();
+  setup_data_cache_idx = 0;
+  this->setUp(vid, tune_idx);
+  endPhase(SetUpPhase);
+
+  const Checksum_type prev_checksum = checksum[vid].at(tune_idx);
+  this->updateChecksum(vid, tune_idx);
+  checksum[vid].at(tune_idx) = prev_checksum;
+  endPhase(ChecksumPhase);
+
+  this->tearDown(vid, tune_idx);
+  endPhase(TearDownPhase);
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Allreduce(MPI_IN_PLACE, phase_times, NumExecutePhases, MPI_DOUBLE,
+                MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  running_probe = false;
+  running_variant = NumVariants;
+  running_tuning = getUnknownTuningIdx();
+}
+
+KernelBase::WarmupResult KernelBase::warmupUntilStable(
+    VariantID vid, size_t tune_idx, double tolerance, Index_type max_reps)
+{
+  running_variant = vid;
+  running_tuning = tune_idx;
+  running_probe = true;
+
+  const double trace_start = startTraceEvent();
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  const bool cali_timing = doCaliperTiming;
+  doCaliperTiming = false;
+#endif
+
+  detail::resetDataInitCount();
+  setup_data_cache_idx = 0;
+  this->setUp(vid, tune_idx);
+
+  WarmupResult result{0, 0.0, 0.0, false};
+  RAJA::Timer::ElapsedType prev_rep_time = 0.0;
+  while (result.reps < max_reps && !result.converged) {
+
+    running_batch_reps = 1;
+
+    resetTimer();
+
+    runVariantTuning(vid, tune_idx);
+
+    running_batch_reps = 0;
+
+    // ranks must agree on num reps since timed regions have barriers
+    double rep_time = timer.elapsed();
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    MPI_Allreduce(MPI_IN_PLACE, &rep_time, 1, MPI_DOUBLE, MPI_MAX,
+                  MPI_COMM_WORLD);
+#endif
+
+    if (result.reps == 0) {
+      result.first_rep_time = rep_time;
+    } else {
+      result.converged =
+          std::abs(rep_time - prev_rep_time) <= tolerance * prev_rep_time;
+    }
+    result.last_rep_time = rep_time;
+    prev_rep_time = rep_time;
+    ++result.reps;
+  }
+
+  this->tearDown(vid, tune_idx);
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  doCaliperTiming = cali_timing;
+#endif
+
+  stopTraceEvent("Warmup", "warmup", vid, tune_idx, trace_start, result.reps);
+
+  running_probe = false;
+  running_variant = NumVariants;
+  running_tuning = getUnknownTuningIdx();
+
+  return result;
+}
+
+void KernelBase::recordExecTime()
+{
+  if (running_probe || running_cold_cache) {
+    return;
+  }
+
+  RAJA::Timer::ElapsedType exec_time = timer.elapsed();
+
+  if (running_batch_reps > 0) {
+    // timer accumulates over batches, pass time is recorded in runKernel
+    rep_batch_times[running_variant].at(running_tuning).emplace_back(
+        (exec_time - batch_start_time) / running_batch_reps);
+    batch_start_time = exec_time;
+    return;
+  }
+
+  num_exec[running_variant].at(running_tuning)++;
+  min_time[running_variant].at(running_tuning) =
+      std::min(min_time[running_variant].at(running_tuning), exec_time);
+  max_time[running_variant].at(running_tuning) =
+      std::max(max_time[running_variant].at(running_tuning), exec_time);
+  tot_time[running_variant].at(running_tuning) += exec_time;
+  pass_time[running_variant].at(running_tuning).emplace_back(exec_time);
+  if (isVariantGPU(running_variant)) {
+    tuning_block_size[running_variant].at(running_tuning) = kernel_block_size;
+  }
+
+  if (!counter_elapsed.empty()) {
+    std::vector<double>& tot_counters =
+        tot_counters_per_rep[running_variant].at(running_tuning);
+    tot_counters.resize(counter_elapsed.size(), 0.0);
+    const Index_type run_reps = getRunReps();
+    for (size_t ic = 0; ic < counter_elapsed.size(); ++ic) {
+      tot_counters[ic] += static_cast<double>(counter_elapsed[ic]) / run_reps;
+    }
+  }
+
+  if (!energy_elapsed.empty()) {
+    std::vector<double>& tot_energy =
+        tot_energy_per_rep[running_variant].at(running_tuning);
+    tot_energy.resize(energy_elapsed.size(), 0.0);
+    const Index_type run_reps = getRunReps();
+    for (size_t im = 0; im < energy_elapsed.size(); ++im) {
+      tot_energy[im] += energy_elapsed[im] / run_reps;
+    }
+  }
+
+  if (run_params.getCountPageFaults()) {
+    tot_minor_page_faults[running_variant].at(running_tuning) += page_faults_elapsed[0];
+    tot_major_page_faults[running_variant].at(running_tuning) += page_faults_elapsed[1];
+  }
+
+  if (!phase_timers.empty()) {
+    std::vector<RAJA::Timer::ElapsedType>& tot_phases =
+        tot_phase_time[running_variant].at(running_tuning);
+    tot_phases.resize(phase_timers.size(), 0.0);
+    for (size_t ip = 0; ip < phase_timers.size(); ++ip) {
+      tot_phases[ip] += phase_timers[ip].elapsed();
+    }
+  }
+
+  if (detail::haveTelemetry() && isVariantGPU(running_variant)) {
+    pass_telemetry[running_variant].at(running_tuning).emplace_back(telemetry_elapsed);
+  }
+
+  if (detail::haveActivityTracing() && isVariantGPU(running_variant)) {
+    tot_device_busy_time[running_variant].at(running_tuning) += activity_elapsed.busy_time;
+    tot_device_ops[running_variant].at(running_tuning) += activity_elapsed.num_ops;
+  }
+
+  if (usingDeviceTimer()) {
+    min_device_time[running_variant].at(running_tuning) =
+        std::min(min_device_time[running_variant].at(running_tuning), device_elapsed);
+    max_device_time[running_variant].at(running_tuning) =
+        std::max(max_device_time[running_variant].at(running_tuning), device_elapsed);
+    tot_device_time[running_variant].at(running_tuning) += device_elapsed;
+    pass_device_time[running_variant].at(running_tuning).emplace_back(device_elapsed);
+  }
+}
+
+std::vector<double> KernelBase::getAvgCountersPerRep(VariantID vid,
+                                                     size_t tune_idx) const
+{
+  std::vector<double> avg_counters(tot_counters_per_rep[vid].at(tune_idx));
+  const int nexec = num_exec[vid].at(tune_idx);
+  for (double& counter : avg_counters) {
+    counter /= nexec;
+  }
+  return avg_counters;
+}
+
+std::vector<double> KernelBase::getAvgEnergyPerRep(VariantID vid,
+                                                   size_t tune_idx) const
+{
+  std::vector<double> avg_energy(tot_energy_per_rep[vid].at(tune_idx));
+  const int nexec = num_exec[vid].at(tune_idx);
+  for (double& energy : avg_energy) {
+    energy /= nexec;
+  }
+  return avg_energy;
+}
+
+double KernelBase::getAvgMinorPageFaults(VariantID vid, size_t tune_idx) const
+{
+  const int nexec = num_exec[vid].at(tune_idx);
+  return nexec > 0
+       ? static_cast<double>(tot_minor_page_faults[vid].at(tune_idx)) / nexec
+       : 0.0;
+}
+
+double KernelBase::getAvgMajorPageFaults(VariantID vid, size_t tune_idx) const
+{
+  const int nexec = num_exec[vid].at(tune_idx);
+  return nexec > 0
+       ? static_cast<double>(tot_major_page_faults[vid].at(tune_idx)) / nexec
+       : 0.0;
+}
+
+double KernelBase::getAvgDeviceBusyTime(VariantID vid, size_t tune_idx) const
+{
+  const int nexec = num_exec[vid].at(tune_idx);
+  return nexec > 0 ? tot_device_busy_time[vid].at(tune_idx) / nexec : 0.0;
+}
+
+double KernelBase::getAvgDeviceOps(VariantID vid, size_t tune_idx) const
+{
+  const int nexec = num_exec[vid].at(tune_idx);
+  return nexec > 0
+       ? static_cast<double>(tot_device_ops[vid].at(tune_idx)) / nexec
+       : 0.0;
+}
+
+std::vector<double> KernelBase::getAvgPhaseTimes(VariantID vid,
+                                                 size_t tune_idx) const
+{
+  std::vector<double> avg_phases(tot_phase_time[vid].at(tune_idx).begin(),
+                                 tot_phase_time[vid].at(tune_idx).end());
+  const int nexec = num_exec[vid].at(tune_idx);
+  for (double& phase : avg_phases) {
+    phase /= nexec;
+  }
+  return avg_phases;
+}
+
+void KernelBase::startCounting()
+{
+  if (running_concurrently || detail::getNumCounters() == 0) {
+    return;
+  }
+  counter_elapsed.resize(detail::getNumCounters(), 0);
+  detail::startCounters();
+}
+
+void KernelBase::stopCounting()
+{
+  if (running_concurrently || detail::getNumCounters() == 0) {
+    return;
+  }
+  detail::stopCounters(counter_elapsed);
+}
+
+void KernelBase::startEnergy()
+{
+  if (running_concurrently || detail::getNumEnergyMeters() == 0) {
+    return;
+  }
+  const size_t num_meters = detail::getNumEnergyMeters();
+  energy_start.resize(num_meters, 0.0);
+  energy_stop.resize(num_meters, 0.0);
+  energy_elapsed.resize(num_meters, 0.0);
+  detail::readEnergy(energy_start);
+}
+
+void KernelBase::stopEnergy()
+{
+  if (running_concurrently || detail::getNumEnergyMeters() == 0) {
+    return;
+  }
+  detail::readEnergy(energy_stop);
+  detail::addEnergyUsed(energy_start, energy_stop, energy_elapsed);
+}
+
+void KernelBase::startTelemetry()
+{
+  if (running_concurrently || !detail::haveTelemetry() ||
+      !isVariantGPU(running_variant)) {
+    return;
+  }
+  detail::combineTelemetry(telemetry_elapsed, detail::readTelemetry());
+}
+
+void KernelBase::stopTelemetry()
+{
+  if (running_concurrently || !detail::haveTelemetry() ||
+      !isVariantGPU(running_variant)) {
+    return;
+  }
+  detail::combineTelemetry(telemetry_elapsed, detail::readTelemetry());
+}
+
+//
+// The device is synchronized before the timer starts and before it stops,
+// so the records of the region are complete when it ends.
+//
+void KernelBase::startActivity()
+{
+  if (running_concurrently || !detail::haveActivityTracing() ||
+      !isVariantGPU(running_variant)) {
+    return;
+  }
+  detail::startActivityRegion();
+  activity_trace_start = startTraceEvent();
+}
+
+void KernelBase::stopActivity()
+{
+  if (running_concurrently || !detail::haveActivityTracing() ||
+      !isVariantGPU(running_variant)) {
+    return;
+  }
+  std::vector<std::pair<double, double>> op_times;
+  detail::DeviceActivity activity =
+      detail::stopActivityRegion(detail::haveTrace() ? &op_times : nullptr);
+  activity_elapsed.busy_time += activity.busy_time;
+  activity_elapsed.num_ops += activity.num_ops;
+
+  // the device was synchronized when the region started, so device times
+  // are placed on the trace relative to the host time the region started
+  if (!op_times.empty()) {
+    const std::vector<detail::TraceArg> args{
+        {"kernel", getName()},
+        {"variant", getVariantName(running_variant)},
+        {"tuning", getVariantTuningName(running_variant, running_tuning)}};
+    for (const std::pair<double, double>& op_time : op_times) {
+      detail::addTraceEvent("device op", "device",
+                            activity_trace_start + op_time.first,
+                            activity_trace_start + op_time.second,
+                            args, detail::DeviceTrack);
+    }
+  }
+}
+
+double KernelBase::startTraceEvent() const
+{
+  return detail::haveTrace() ? detail::getTraceTime() : 0.0;
+}
+
+void KernelBase::stopTraceEvent(const std::string& name, const char* category,
+                                VariantID vid, size_t tune_idx,
+                                double start_time, Index_type reps) const
+{
+  if (!detail::haveTrace()) {
+    return;
+  }
+  std::vector<detail::TraceArg> args{
+      {"kernel", getName()},
+      {"variant", getVariantName(vid)},
+      {"tuning", getVariantTuningName(vid, tune_idx)}};
+  if (pass_idx >= 0) {
+    args.emplace_back("pass", std::to_string(pass_idx));
+  }
+  if (reps > 0) {
+    args.emplace_back("reps", std::to_string(reps));
+  }
+  detail::addTraceEvent(name, category, start_time, detail::getTraceTime(), args);
+}
+
+void KernelBase::startPageFaults()
+{
+  if (running_concurrently || !run_params.getCountPageFaults()) {
+    return;
+  }
+  detail::readPageFaults(page_faults_start[0], page_faults_start[1]);
+}
+
+void KernelBase::stopPageFaults()
+{
+  if (running_concurrently || !run_params.getCountPageFaults()) {
+    return;
+  }
+  long long minor_faults = 0;
+  long long major_faults = 0;
+  detail::readPageFaults(minor_faults, major_faults);
+  page_faults_elapsed[0] += minor_faults - page_faults_start[0];
+  page_faults_elapsed[1] += major_faults - page_faults_start[1];
+}
+
+//
+// Freed device memory may be returned to the GPU asynchronously, so the
+// device is synchronized before the free bytes are read.
+//
+void KernelBase::startDeviceMemory(VariantID vid)
+{
+  tracking_device_memory = run_params.getTrackDeviceMemory() &&
+                           isVariantGPU(vid) && !running_concurrently;
+  if (!tracking_device_memory) {
+    return;
+  }
+  synchronize();
+  detail::resetDataPeakDeviceBytes();
+  device_data_start_bytes = detail::getDataLiveDeviceBytes();
+  device_free_start_bytes = detail::getGPUFreeBytes();
+  device_free_min_bytes = device_free_start_bytes;
+}
+
+void KernelBase::sampleDeviceMemory()
+{
+  if (!tracking_device_memory) {
+    return;
+  }
+  device_free_min_bytes = std::min(device_free_min_bytes, detail::getGPUFreeBytes());
+}
+
+void KernelBase::stopDeviceMemory(VariantID vid, size_t tune_idx)
+{
+  if (!tracking_device_memory) {
+    return;
+  }
+  synchronize();
+  sampleDeviceMemory();
+  tracking_device_memory = false;
+
+  const size_t peak_data_bytes = detail::getDataPeakDeviceBytes();
+  if (peak_data_bytes > device_data_start_bytes) {
+    peak_device_data_bytes[vid].at(tune_idx) =
+        std::max(peak_device_data_bytes[vid].at(tune_idx),
+                 peak_data_bytes - device_data_start_bytes);
+  }
+  peak_device_memory_bytes[vid].at(tune_idx) =
+      std::max(peak_device_memory_bytes[vid].at(tune_idx),
+               device_free_start_bytes - device_free_min_bytes);
+}
+
+bool KernelBase::usingDeviceTimer() const
+{
+  if (!run_params.getGPUEventTiming()) {
+    return false;
+  }
+#if defined(RAJA_ENABLE_CUDA)
+  if ( running_variant == Base_CUDA ||
+       running_variant == Lambda_CUDA ||
+       running_variant == RAJA_CUDA ) {
+    return true;
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if ( running_variant == Base_HIP ||
+       running_variant == Lambda_HIP ||
+       running_variant == RAJA_HIP ) {
+    return true;
+  }
+#endif
+  return false;
+}
+
+void KernelBase::startDeviceTimer()
+{
+  if (!usingDeviceTimer()) {
+    return;
+  }
+#if defined(RAJA_ENABLE_CUDA)
+  if ( running_variant == Base_CUDA ||
+       running_variant == Lambda_CUDA ||
+       running_variant == RAJA_CUDA ) {
+    if (!have_cuda_timer_events) {
+      cudaErrchk( cudaEventCreate( &cuda_timer_events[0] ) );
+      cudaErrchk( cudaEventCreate( &cuda_timer_events[1] ) );
+      have_cuda_timer_events = true;
+    }
+    cudaErrchk( cudaEventRecord( cuda_timer_events[0],
+                                 getCudaResource().get_stream() ) );
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if ( running_variant == Base_HIP ||
+       running_variant == Lambda_HIP ||
+       running_variant == RAJA_HIP ) {
+    if (!have_hip_timer_events) {
+      hipErrchk( hipEventCreate( &hip_timer_events[0] ) );
+      hipErrchk( hipEventCreate( &hip_timer_events[1] ) );
+      have_hip_timer_events = true;
+    }
+    hipErrchk( hipEventRecord( hip_timer_events[0],
+                               getHipResource().get_stream() ) );
+  }
+#endif
+}
+
+void KernelBase::stopDeviceTimer()
+{
+  if (!usingDeviceTimer()) {
+    return;
+  }
+  float elapsed_ms = 0.0f;
+#if defined(RAJA_ENABLE_CUDA)
+  if ( running_variant == Base_CUDA ||
+       running_variant == Lambda_CUDA ||
+       running_variant == RAJA_CUDA ) {
+    cudaErrchk( cudaEventRecord( cuda_timer_events[1],
+                                 getCudaResource().get_stream() ) );
+    cudaErrchk( cudaEventSynchronize( cuda_timer_events[1] ) );
+    cudaErrchk( cudaEventElapsedTime( &elapsed_ms, cuda_timer_events[0],
+                                                   cuda_timer_events[1] ) );
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if ( running_variant == Base_HIP ||
+       running_variant == Lambda_HIP ||
+       running_variant == RAJA_HIP ) {
+    hipErrchk( hipEventRecord( hip_timer_events[1],
+                               getHipResource().get_stream() ) );
+    hipErrchk( hipEventSynchronize( hip_timer_events[1] ) );
+    hipErrchk( hipEventElapsedTime( &elapsed_ms, hip_timer_events[0],
+                                                 hip_timer_events[1] ) );
+  }
+#endif
+  device_elapsed += static_cast<RAJA::Timer::ElapsedType>(elapsed_ms) / 1000.0;
+}
+
+void KernelBase::runKernel(VariantID vid, size_t tune_idx)
+{
+  if ( !hasVariantDefined(vid) ) {
+    return;
+  }
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  if (doCaliperTiming) {
+    KernelBase::setCaliperMgrStart(vid, getVariantTuningName(vid, tune_idx));
+  }
+#endif
+
+  const Index_type batch_reps = getRepBatchSize();
+  if (batch_reps > 0) {
+
+    //
+    // Run reps in batches so each batch is timed separately, then record
+    // the time of all batches as the time of this pass.
+    //
+    const Index_type run_reps = getRunReps();
+
+    const Index_type num_batches = RAJA_DIVIDE_CEILING_INT(run_reps, batch_reps);
+    std::vector<RAJA::Timer::ElapsedType>& batch_times =
+        rep_batch_times[vid].at(tune_idx);
+    if (batch_times.empty()) {
+      batch_times.reserve(num_batches * run_params.getNumPasses());
+    }
+
+    //
+    // Ranks barrier around groups of barrier_batches batches, 0 -> around
+    // the pass, so batches in a group are timed by each rank on its own.
+    //
+    const Index_type barrier_batches = run_params.getTimingBarrierBatches();
+
+    batch_start_time = timer.elapsed();
+    for (Index_type irep = 0, ib = 0; irep < run_reps; irep += batch_reps, ++ib) {
+      running_batch_reps = std::min(batch_reps, run_reps - irep);
+      if (barrier_batches > 0) {
+        skip_start_barrier = (ib % barrier_batches) != 0;
+        skip_stop_barrier = ((ib+1) % barrier_batches) != 0 &&
+                            ib+1 < num_batches;
+      } else {
+        skip_start_barrier = ib != 0;
+        skip_stop_barrier = ib+1 < num_batches;
+      }
+      runVariantTuning(vid, tune_idx);
+    }
+    running_batch_reps = 0;
+    skip_start_barrier = false;
+    skip_stop_barrier = false;
+
+    recordExecTime();
+
+  } else {
+
+    runVariantTuning(vid, tune_idx);
+
+  }
+
+#if defined(RAJA_PERFSUITE_USE_CALIPER)
+  if (doCaliperTiming) {
+    KernelBase::setCaliperMgrStop(vid, getVariantTuningName(vid, tune_idx));
+  }
+#endif
+}
+
+bool KernelBase::runStorageTuning(VariantID vid, size_t tune_idx)
+{
+  if (getStoragePrecision(vid, tune_idx) == StoragePrecision::Default) {
+    return false;
+  }
+
+  switch ( vid ) {
+
+    case Base_Seq :
+    {
+      runSeqStorageVariant(vid, tune_idx);
+      break;
+    }
+
+    case Base_OpenMP :
+    {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+      runOpenMPStorageVariant(vid, tune_idx);
+#endif
+      break;
+    }
+
+    case Base_CUDA :
+    {
+#if defined(RAJA_ENABLE_CUDA)
+      runCudaStorageVariant(vid, tune_idx);
+#endif
+      break;
+    }
+
+    case Base_HIP :
+    {
+#if defined(RAJA_ENABLE_HIP)
+      runHipStorageVariant(vid, tune_idx);
+#endif
+      break;
+    }
+
+    default : {
+      return false;
+    }
+
+  }
+
+  return true;
+}
+
+bool KernelBase::runIndexTuning(VariantID vid, size_t tune_idx)
+{
+  if (getIndexWidth(vid, tune_idx) == IndexWidth::Default) {
+    return false;
+  }
+
+  switch ( vid ) {
+
+    case Base_Seq :
+    {
+      runSeqIndexVariant(vid, tune_idx);
+      break;
+    }
+
+    case Base_OpenMP :
+    {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+      runOpenMPIndexVariant(vid, tune_idx);
+#endif
+      break;
+    }
+
+    case Base_CUDA :
+    {
+#if defined(RAJA_ENABLE_CUDA)
+      runCudaIndexVariant(vid, tune_idx);
+#endif
+      break;
+    }
+
+    case Base_HIP :
+    {
+#if defined(RAJA_ENABLE_HIP)
+      runHipIndexVariant(vid, tune_idx);
+#endif
+      break;
+    }
+
+    default : {
+      return false;
+    }
+
+  }
+
+  return true;
+}
+
+//
+// Each call runs the reps of a pass, a rep batch, a probe, or cold cache
+// reps, which is recorded as one trace event.
+//
+void KernelBase::runVariantTuning(VariantID vid, size_t tune_idx)
+{
+  const double trace_start = startTraceEvent();
+
+  switch ( vid ) {
+
+    case Base_Seq :
+    {
+      if (!runStorageTuning(vid, tune_idx) &&
+          !runIndexTuning(vid, tune_idx)) {
+        runSeqVariant(vid, tune_idx);
+      }
+      break;
+    }
+
+    case Lambda_Seq :
+    case RAJA_Seq :
+    {
 #if defined(RUN_RAJA_SEQ)
       runSeqVariant(vid, tune_idx);
 #endif
@@ -306,7 +2206,17 @@ void KernelBase::runKernel(VariantID vid, size_t tune_idx)
     case RAJA_OpenMP :
     {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-      runOpenMPVariant(vid, tune_idx);
+      if (num_omp_thread_tunings[vid] > 0 &&
+          tune_idx >= num_omp_thread_tunings[vid]) {
+        ScopedNumThreads scoped_num_threads(getOpenMPTuningThreads(vid, tune_idx));
+        if (!runStorageTuning(vid, tune_idx % num_omp_thread_tunings[vid]) &&
+            !runIndexTuning(vid, tune_idx % num_omp_thread_tunings[vid])) {
+          runOpenMPVariant(vid, tune_idx % num_omp_thread_tunings[vid]);
+        }
+      } else if (!runStorageTuning(vid, tune_idx) &&
+                 !runIndexTuning(vid, tune_idx)) {
+        runOpenMPVariant(vid, tune_idx);
+      }
 #endif
       break;
     }
@@ -315,7 +2225,19 @@ void KernelBase::runKernel(VariantID vid, size_t tune_idx)
     case RAJA_OpenMPTarget :
     {
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
-      runOpenMPTargetVariant(vid, tune_idx);
+      if (num_omp_target_tunings[vid] > 0 &&
+          tune_idx >= num_omp_target_tunings[vid]) {
+        const size_t num_tunings = num_omp_target_tunings[vid];
+        const auto& config =
+            omp_target_launch_configs.at(tune_idx / num_tunings - 1);
+        omp_target_thread_limit = config.first;
+        omp_target_num_teams = config.second;
+        runOpenMPTargetVariant(vid, tune_idx % num_tunings);
+        omp_target_thread_limit = 0;
+        omp_target_num_teams = 0;
+      } else {
+        runOpenMPTargetVariant(vid, tune_idx);
+      }
 #endif
       break;
     }
@@ -325,7 +2247,31 @@ void KernelBase::runKernel(VariantID vid, size_t tune_idx)
     case RAJA_CUDA :
     {
 #if defined(RAJA_ENABLE_CUDA)
-      runCudaVariant(vid, tune_idx);
+      size_t cuda_tune_idx = tune_idx;
+      if (num_gpu_setting_tunings[vid] > 0) {
+        cuda_tune_idx %= num_gpu_setting_tunings[vid];
+      }
+      if (num_shmem_carveout_tunings[vid] > 0 &&
+          cuda_tune_idx >= num_shmem_carveout_tunings[vid]) {
+        const size_t num_tunings = num_shmem_carveout_tunings[vid];
+        shmem_carveout =
+            run_params.getGPUShmemCarveouts().at(cuda_tune_idx / num_tunings - 1);
+        cuda_tune_idx %= num_tunings;
+      }
+      if (num_l2_persist_tunings[vid] > 0 &&
+          cuda_tune_idx >= num_l2_persist_tunings[vid]) {
+        cudaStream_t stream = getCudaResource().get_stream();
+        setCudaL2PersistWindow(stream, l2_persist_ptr, l2_persist_nbytes);
+        if (!runStorageTuning(vid, cuda_tune_idx - num_l2_persist_tunings[vid]) &&
+            !runIndexTuning(vid, cuda_tune_idx - num_l2_persist_tunings[vid])) {
+          runCudaVariant(vid, cuda_tune_idx - num_l2_persist_tunings[vid]);
+        }
+        resetCudaL2PersistWindow(stream);
+      } else if (!runStorageTuning(vid, cuda_tune_idx) &&
+                 !runIndexTuning(vid, cuda_tune_idx)) {
+        runCudaVariant(vid, cuda_tune_idx);
+      }
+      shmem_carveout = -1;
 #endif
       break;
     }
@@ -335,7 +2281,22 @@ void KernelBase::runKernel(VariantID vid, size_t tune_idx)
     case RAJA_HIP :
     {
 #if defined(RAJA_ENABLE_HIP)
-      runHipVariant(vid, tune_idx);
+      const size_t hip_tune_idx = (num_gpu_setting_tunings[vid] > 0)
+                                ? tune_idx % num_gpu_setting_tunings[vid]
+                                : tune_idx;
+      if (!runStorageTuning(vid, hip_tune_idx) &&
+          !runIndexTuning(vid, hip_tune_idx)) {
+        runHipVariant(vid, hip_tune_idx);
+      }
+#endif
+      break;
+    }
+
+    case Base_SYCL :
+    case RAJA_SYCL :
+    {
+#if defined(RAJA_ENABLE_SYCL)
+      runSyclVariant(vid, tune_idx);
 #endif
       break;
     }
@@ -354,11 +2315,15 @@ void KernelBase::runKernel(VariantID vid, size_t tune_idx)
     }
 
   }
-#if defined(RAJA_PERFSUITE_USE_CALIPER)
-  if (doCaliperTiming) {
-    KernelBase::setCaliperMgrStop(vid, getVariantTuningName(vid, tune_idx));
+
+  if (detail::haveTrace() && !running_background) {
+    const Index_type reps =
+        (running_batch_reps > 0) ? running_batch_reps : getRunReps();
+    const char* name = running_cold_cache ? "ColdCacheReps" :
+                       running_probe ? "ProbeReps" :
+                       (running_batch_reps > 0) ? "RepBatch" : "Reps";
+    stopTraceEvent(name, "reps", vid, tune_idx, trace_start, reps);
   }
-#endif
 }
 
 void KernelBase::print(std::ostream& os) const
@@ -373,6 +2338,11 @@ void KernelBase::print(std::ostream& os) const
     os << "\t\t\t\t" << getFeatureName(static_cast<FeatureID>(j))
                      << " : " << uses_feature[j] << std::endl;
   }
+  os << "\t\t\t has_pattern: " << std::endl;
+  for (unsigned j = 0; j < NumPatterns; ++j) {
+    os << "\t\t\t\t" << getPatternName(static_cast<PatternID>(j))
+                     << " : " << has_pattern[j] << std::endl;
+  }
   os << "\t\t\t variant_tuning_names: " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
     os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
@@ -386,6 +2356,8 @@ void KernelBase::print(std::ostream& os) const
   os << "\t\t\t kernels_per_rep = " << kernels_per_rep << std::endl;
   os << "\t\t\t bytes_per_rep = " << bytes_per_rep << std::endl;
   os << "\t\t\t FLOPs_per_rep = " << FLOPs_per_rep << std::endl;
+  os << "\t\t\t data_footprint = " << data_footprint << std::endl;
+  os << "\t\t\t kernel_params = " << getKernelParamsString() << std::endl;
   os << "\t\t\t num_exec: " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
     os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
@@ -438,8 +2410,8 @@ void KernelBase::doOnceCaliMetaBegin(VariantID vid, size_t tune_idx)
     cali_set_double(Reps_attr,(double)getRunReps());
     cali_set_double(Iters_Rep_attr,(double)getItsPerRep());
     cali_set_double(Kernels_Rep_attr,(double)getKernelsPerRep());
-    cali_set_double(Bytes_Rep_attr,(double)getBytesPerRep());
-    cali_set_double(Flops_Rep_attr,(double)getFLOPsPerRep());
+    cali_set_double(Bytes_Rep_attr,(double)getBytesPerRep(vid, tune_idx));
+    cali_set_double(Flops_Rep_attr,(double)getFLOPsPerRep(vid, tune_idx));
     cali_set_double(BlockSize_attr, getBlockSize());
   }
 }
@@ -14,6 +14,11 @@
 #include "common/DataUtils.hpp"
 #include "common/RunParams.hpp"
 #include "common/GPUUtils.hpp"
+#include "common/IndexUtils.hpp"
+#include "common/StorageUtils.hpp"
+#include "common/TelemetryUtils.hpp"
+#include "common/ActivityUtils.hpp"
+#include "common/TimerUtils.hpp"
 
 #include "RAJA/util/Timer.hpp"
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
@@ -25,42 +30,74 @@
 #if defined(RAJA_ENABLE_HIP)
 #include "RAJA/policy/hip/raja_hiperrchk.hpp"
 #endif
+#if defined(RAJA_ENABLE_SYCL)
+#include <sycl/sycl.hpp>
+#endif
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <iostream>
 #include <map>
 #include <limits>
 #include <utility>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <typeindex>
+#include <typeinfo>
 
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
 
+//
+// Timed region "RAJAPerf -> group -> kernel", the region names are made in
+// the KernelBase constructor so no strings are built on the timed path.
+//
 #define CALI_START \
     if (doCaliperTiming) { \
-      std::string kstr = getName(); \
-      std::string gstr = getGroupName(kstr); \
-      std::string vstr = "RAJAPerf"; \
       doOnceCaliMetaBegin(running_variant, running_tuning); \
-      CALI_MARK_BEGIN(vstr.c_str()); \
-      CALI_MARK_BEGIN(gstr.c_str()); \
-      CALI_MARK_BEGIN(kstr.c_str()); \
+      CALI_MARK_BEGIN("RAJAPerf"); \
+      CALI_MARK_BEGIN(cali_group_region.c_str()); \
+      CALI_MARK_BEGIN(cali_kernel_region.c_str()); \
     }
 
 #define CALI_STOP \
     if (doCaliperTiming) { \
-      std::string kstr = getName(); \
-      std::string gstr = getGroupName(kstr); \
-      std::string vstr = "RAJAPerf"; \
-      CALI_MARK_END(kstr.c_str()); \
-      CALI_MARK_END(gstr.c_str()); \
-      CALI_MARK_END(vstr.c_str()); \
+      CALI_MARK_END(cali_kernel_region.c_str()); \
+      CALI_MARK_END(cali_group_region.c_str()); \
+      CALI_MARK_END("RAJAPerf"); \
       doOnceCaliMetaEnd(running_variant,running_tuning); \
     }
 
+//
+// Untimed region "RAJAPerf_Phases -> group -> kernel -> phase" for the
+// setUp, checksum, and tearDown phases of executing a kernel.
+//
+#define CALI_PHASE_START(phase) \
+    if (doCaliperTiming) { \
+      CALI_MARK_BEGIN("RAJAPerf_Phases"); \
+      CALI_MARK_BEGIN(cali_group_region.c_str()); \
+      CALI_MARK_BEGIN(cali_kernel_region.c_str()); \
+      CALI_MARK_BEGIN(phase); \
+    }
+
+#define CALI_PHASE_STOP(phase) \
+    if (doCaliperTiming) { \
+      CALI_MARK_END(phase); \
+      CALI_MARK_END(cali_kernel_region.c_str()); \
+      CALI_MARK_END(cali_group_region.c_str()); \
+      CALI_MARK_END("RAJAPerf_Phases"); \
+    }
+
 #else
 
 #define CALI_START
 #define CALI_STOP
+#define CALI_PHASE_START(phase)
+#define CALI_PHASE_STOP(phase)
 
 #endif
 
@@ -80,6 +117,19 @@ public:
     { return std::numeric_limits<size_t>::max(); }
   static std::string getDefaultTuningName() { return "default"; }
 
+  //
+  // Phases of execute, the wall time of each is summed over all calls.
+  // The run phase is all of runKernel, not only the timed reps.
+  //
+  enum ExecutePhase {
+    SetUpPhase = 0,
+    RunPhase,
+    ChecksumPhase,
+    TearDownPhase,
+    NumExecutePhases
+  };
+  static std::string getExecutePhaseName(ExecutePhase phase);
+
   KernelBase(KernelID kid, const RunParams& params);
 
   virtual ~KernelBase();
@@ -102,10 +152,153 @@ public:
   void setBlockSize(Index_type size) { kernel_block_size = size; }
 
   void setUsesFeature(FeatureID fid) { uses_feature[fid] = true; }
+  void setHasPattern(PatternID pid) { has_pattern[pid] = true; }
+
+  // Register a shape parameter of the kernel and return its value, given
+  // with '--kernel-param KERNEL:name=value' or default_value otherwise.
+  // Values less than min_value or greater than max_value are rejected as
+  // bad input.
+  Index_type getKernelParam(const std::string& param_name,
+                            Index_type default_value,
+                            Index_type min_value = 1,
+                            Index_type max_value =
+                                std::numeric_limits<Index_type>::max());
+  // Same as above for a parameter that may only be one of valid_values.
+  Index_type getKernelParam(const std::string& param_name,
+                            Index_type default_value,
+                            const std::vector<Index_type>& valid_values);
+
+  // Kernels templated on element type call one of these before defining
+  // variants, then each tuning is run with each data type given with
+  // '--data-types' that the kernel supports
+  void setUsesDataTypes();
+  void setUsesFloatingPointDataTypes();
+  void setPhaseNames(const std::vector<std::string>& names)
+  {
+    phase_names = names;
+    phase_timers.resize(phase_names.size());
+  }
+  // Kernels that report values measured in a run besides times, ie. the
+  // compression ratio of halo messages, name them with this and return
+  // them from getMetrics
+  void setMetricNames(const std::vector<std::string>& names)
+  { metric_names = names; }
+
+  // Kernels with a small array reused by every rep call this before
+  // defining variants, then each CUDA tuning is also run with the array
+  // marked as persisting in L2, ie. "block_256_l2persist", on devices that
+  // support it. The array is given in setUp with setL2PersistWindow.
+  void setUsesL2PersistWindow() { uses_l2_persist_window = true; }
+  void setL2PersistWindow(const void* ptr, size_t nbytes)
+  {
+    l2_persist_ptr = ptr;
+    l2_persist_nbytes = nbytes;
+  }
+
+  // Kernels whose Base CUDA kernels use shared memory and set the carve-out
+  // from getSharedMemCarveout call this before defining variants, then each
+  // Base_CUDA tuning is also run with each carve-out given with
+  // '--gpu-shmem-carveouts', ie. "block_256_carveout_50"
+  void setUsesSharedMemCarveout() { uses_shmem_carveout = true; }
+  // carve-out in percent of the running tuning, -1 -> driver default
+  int getSharedMemCarveout() const { return shmem_carveout; }
+
+  // Kernels that implement run<backend>StorageVariant for their Base Seq,
+  // OpenMP, CUDA, and HIP variants call this before defining variants, then
+  // those variants also have a tuning for each narrower storage precision,
+  // ie. "storage_bf16", see common/StorageUtils.hpp
+  void setUsesStoragePrecisions() { uses_storage_precisions = true; }
+  // storage precision of tune_idx, Default for the other tunings
+  StoragePrecision getStoragePrecision(VariantID vid, size_t tune_idx) const;
+
+  // Kernels that implement run<backend>IndexVariant for their Base Seq,
+  // OpenMP, CUDA, and HIP variants call this before defining variants, then
+  // those variants also have a tuning for each index width, ie.
+  // "index_32bit", see common/IndexUtils.hpp
+  void setUsesIndexWidths() { uses_index_widths = true; }
+  // index width of tune_idx, Default for the other tunings
+  IndexWidth getIndexWidth(VariantID vid, size_t tune_idx) const;
+
+  // Kernels whose Base OpenMP target loops take their thread_limit from
+  // getOpenMPTargetThreadLimit call this before defining variants, then each
+  // Base_OpenMPTarget tuning is also run with each thread limit given with
+  // '--omptarget-thread-limits', ie. "default_tl_128"
+  void setUsesOpenMPTargetThreadLimit() { uses_omp_target_thread_limit = true; }
+  int getOpenMPTargetThreadLimit(int default_limit) const
+  {
+    return (omp_target_thread_limit > 0) ? omp_target_thread_limit
+                                         : default_limit;
+  }
+  // Kernels whose Base OpenMP target loops take a num_teams clause of
+  // getOpenMPTargetNumTeams when it is positive, and none otherwise, call
+  // this before defining variants, then each Base_OpenMPTarget tuning is also
+  // run with each number of teams given with '--omptarget-num-teams', ie.
+  // "default_nt_440"
+  void setUsesOpenMPTargetNumTeams() { uses_omp_target_num_teams = true; }
+  int getOpenMPTargetNumTeams() const { return omp_target_num_teams; }
+
+  // Each OpenMP tuning is also run with each number of threads given with
+  // '--omp-threads', ie. "default_thr_8", return the number of threads of
+  // tune_idx or 0 for the tunings run with the default number of threads
+  int getOpenMPTuningThreads(VariantID vid, size_t tune_idx) const;
+  size_t getNumOpenMPThreadTunings(VariantID vid) const
+  {
+    return num_omp_thread_tunings[vid];
+  }
+
+  // Each GPU tuning is also run with each clock cap and power limit given
+  // with '--gpu-clocks' and '--gpu-power-limits', ie. "block_256_clk_1410",
+  // return the setting of tune_idx or nullptr for the default settings
+  const RunParams::GPUSetting* getGPUTuningSetting(VariantID vid,
+                                                   size_t tune_idx) const;
+  size_t getNumGPUSettingTunings(VariantID vid) const
+  {
+    return num_gpu_setting_tunings[vid];
+  }
+
+  // Kernels that index data by rep number can not be timed in rep batches
+  void setRepBatchingAllowed(bool allowed) { rep_batching_allowed = allowed; }
+  bool getRepBatchingAllowed() const { return rep_batching_allowed; }
+
+  // Methods used to calibrate run reps to a target time
+  RAJA::Timer::ElapsedType probeRepTime(VariantID vid, size_t tune_idx,
+                                        RAJA::Timer::ElapsedType min_time);
+  // Times of the phases of one pass used to estimate run time in a dry run,
+  // the run phase time is the time per rep found by probeRepTime
+  void probePhaseTimes(VariantID vid, size_t tune_idx,
+                       RAJA::Timer::ElapsedType min_time,
+                       double (&phase_times)[NumExecutePhases]);
+  void setCalibratedReps(Index_type reps) { calibrated_reps = reps; }
+
+  //
+  // Run untimed single reps with data set up once until the times of two
+  // successive reps differ by at most tolerance relative to the earlier
+  // one, or max_reps reps are run. Returns the reps run, the times of the
+  // first and last rep, and whether the rep times converged.
+  //
+  struct WarmupResult
+  {
+    Index_type reps;
+    RAJA::Timer::ElapsedType first_rep_time;
+    RAJA::Timer::ElapsedType last_rep_time;
+    bool converged;
+  };
+  WarmupResult warmupUntilStable(VariantID vid, size_t tune_idx,
+                                 double tolerance, Index_type max_reps);
 
   void setVariantDefined(VariantID vid);
   void addVariantTuningName(VariantID vid, std::string name)
-  { variant_tuning_names[vid].emplace_back(std::move(name)); }
+  {
+    variant_tuning_names[vid].emplace_back(std::move(name));
+    variant_tuning_reproducible[vid].emplace_back(false);
+  }
+  // add a tuning whose checksum is the same bitwise in every run, ie. one
+  // that reduces in a fixed order, see '--reproducible'
+  void addReproducibleVariantTuningName(VariantID vid, std::string name)
+  {
+    variant_tuning_names[vid].emplace_back(std::move(name));
+    variant_tuning_reproducible[vid].emplace_back(true);
+  }
 
   virtual void setSeqTuningDefinitions(VariantID vid)
   { addVariantTuningName(vid, getDefaultTuningName()); }
@@ -125,6 +318,11 @@ public:
   { addVariantTuningName(vid, getDefaultTuningName()); }
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  virtual void setSyclTuningDefinitions(VariantID vid)
+  { addVariantTuningName(vid, getDefaultTuningName()); }
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
   virtual void setOpenMPTargetTuningDefinitions(VariantID vid)
   { addVariantTuningName(vid, getDefaultTuningName()); }
@@ -146,13 +344,51 @@ public:
   Index_type getItsPerRep() const { return its_per_rep; };
   Index_type getKernelsPerRep() const { return kernels_per_rep; };
   Index_type getBytesPerRep() const { return bytes_per_rep; }
+  virtual Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const;
   Index_type getFLOPsPerRep() const { return FLOPs_per_rep; }
+  virtual Index_type getFLOPsPerRep(VariantID RAJAPERF_UNUSED_ARG(vid),
+                                    size_t RAJAPERF_UNUSED_ARG(tune_idx)) const
+  { return FLOPs_per_rep; }
   double getBlockSize() const { return kernel_block_size; }
+  // max bytes allocated with allocData in setUp and freed in tearDown
+  size_t getDataFootprint() const { return data_footprint; }
+  // wall time in seconds of a phase of execute summed over all its calls
+  double getExecutePhaseTime(ExecutePhase phase) const
+  { return execute_phase_time[phase]; }
+
+  struct KernelParam
+  {
+    std::string name;
+    Index_type value;
+    Index_type min_value;
+    Index_type max_value;
+    std::vector<Index_type> valid_values; // empty -> any value in [min_value, max_value]
+  };
+
+  const std::vector<KernelParam>& getKernelParams() const { return kernel_params; }
+  // parameters as "name=value" separated by spaces, "-" if there are none
+  std::string getKernelParamsString() const;
 
   Index_type getTargetProblemSize() const;
   Index_type getRunReps() const;
 
   bool usesFeature(FeatureID fid) const { return uses_feature[fid]; };
+  bool hasPattern(PatternID pid) const { return has_pattern[pid]; };
+
+  bool usesDataTypes() const { return uses_data_types; }
+  bool usesDataType(DataType dt) const
+  { return uses_data_type[static_cast<size_t>(dt)]; }
+
+  //
+  // Data type and tuning index without the data type of a tuning, tunings
+  // of kernels using data types are grouped by data type when several
+  // data types are run; else every tuning uses Real_type.
+  //
+  // The data types run are those given with '--data-types' that the
+  // kernel supports.
+  //
+  DataType getDataType(VariantID vid, size_t tune_idx) const;
+  size_t getDataTypeTuningIdx(VariantID vid, size_t tune_idx) const;
 
   bool hasVariantDefined(VariantID vid) const
   { return !variant_tuning_names[vid].empty(); }
@@ -192,6 +428,8 @@ public:
   { return getVariantTuningNames(vid).at(tune_idx); }
   std::vector<std::string> const& getVariantTuningNames(VariantID vid) const
   { return variant_tuning_names[vid]; }
+  // true if the tuning was added as reproducible or runs sequentially
+  bool isVariantTuningReproducible(VariantID vid, size_t tune_idx) const;
 
   //
   // Methods to get information about kernel execution for reports
@@ -216,14 +454,198 @@ public:
   double getTotTime(VariantID vid, size_t tune_idx) const
   { return tot_time[vid].at(tune_idx); }
 
+  // get GPU event timers accumulated over npasses
+  double getMinDeviceTime(VariantID vid, size_t tune_idx) const
+  { return min_device_time[vid].at(tune_idx); }
+  double getMaxDeviceTime(VariantID vid, size_t tune_idx) const
+  { return max_device_time[vid].at(tune_idx); }
+  double getTotDeviceTime(VariantID vid, size_t tune_idx) const
+  { return tot_device_time[vid].at(tune_idx); }
+
+  // get time of each pass and GPU event time of each pass when timing
+  // with '--gpu-event-timing'
+  const std::vector<RAJA::Timer::ElapsedType>& getPassTimes(
+      VariantID vid, size_t tune_idx) const
+  { return pass_time[vid].at(tune_idx); }
+  const std::vector<RAJA::Timer::ElapsedType>& getPassDeviceTimes(
+      VariantID vid, size_t tune_idx) const
+  { return pass_device_time[vid].at(tune_idx); }
+  // get time of each pass run with caches flushed before each rep when
+  // timing with '--cold-cache', flushes are not included
+  const std::vector<RAJA::Timer::ElapsedType>& getColdCachePassTimes(
+      VariantID vid, size_t tune_idx) const
+  { return cold_cache_pass_time[vid].at(tune_idx); }
+
+  // get checksum of each pass
+  const std::vector<Checksum_type>& getPassChecksums(
+      VariantID vid, size_t tune_idx) const
+  { return pass_checksums[vid].at(tune_idx); }
+
+  // get GPU block size used by executed variant/tuning, nan if not a GPU
+  // kernel
+  double getTuningBlockSize(VariantID vid, size_t tune_idx) const
+  { return tuning_block_size[vid].at(tune_idx); }
+
+  // get per-rep times of each rep batch timed over npasses
+  Index_type getRepBatchSize() const;
+  const std::vector<RAJA::Timer::ElapsedType>& getRepBatchTimes(
+      VariantID vid, size_t tune_idx) const
+  { return rep_batch_times[vid].at(tune_idx); }
+
+  // get hardware counter values per rep averaged over npasses
+  std::vector<double> getAvgCountersPerRep(VariantID vid, size_t tune_idx) const;
+
+  // get joules per rep of each energy meter averaged over npasses
+  std::vector<double> getAvgEnergyPerRep(VariantID vid, size_t tune_idx) const;
+
+  // get minor and major page faults per pass averaged over npasses
+  double getAvgMinorPageFaults(VariantID vid, size_t tune_idx) const;
+  double getAvgMajorPageFaults(VariantID vid, size_t tune_idx) const;
+
+  // get the bytes of device memory used above what was in use before setUp,
+  // by data allocated with allocData in device data spaces after setUp and
+  // at most in any pass, and by all memory of the GPU at most in any pass,
+  // including library and runtime temporaries, when tracking with
+  // '--track-device-memory'
+  size_t getDeviceSetUpDataBytes(VariantID vid, size_t tune_idx) const
+  { return device_setup_data_bytes[vid].at(tune_idx); }
+  size_t getPeakDeviceDataBytes(VariantID vid, size_t tune_idx) const
+  { return peak_device_data_bytes[vid].at(tune_idx); }
+  size_t getPeakDeviceMemoryBytes(VariantID vid, size_t tune_idx) const
+  { return peak_device_memory_bytes[vid].at(tune_idx); }
+
+  // get seconds the device was busy and device operations run in the timed
+  // region per pass averaged over npasses, when tracing device activity
+  // with '--device-activity'
+  double getAvgDeviceBusyTime(VariantID vid, size_t tune_idx) const;
+  double getAvgDeviceOps(VariantID vid, size_t tune_idx) const;
+
+  // get GPU telemetry of each pass of a GPU variant when sampling with
+  // '--gpu-telemetry', and the throttled passes discarded and rerun
+  const std::vector<detail::GPUTelemetry>& getPassTelemetry(
+      VariantID vid, size_t tune_idx) const
+  { return pass_telemetry[vid].at(tune_idx); }
+  bool wasLastPassThrottled(VariantID vid, size_t tune_idx) const
+  {
+    return !pass_telemetry[vid].at(tune_idx).empty() &&
+           pass_telemetry[vid].at(tune_idx).back().throttled();
+  }
+  int getNumDiscardedPasses(VariantID vid, size_t tune_idx) const
+  { return num_discarded_passes[vid].at(tune_idx); }
+
+  // get GPU kernel attributes recorded by the variant tuning, one for each
+  // GPU function it launched, empty if none were recorded
+  const std::vector<GPUFuncAttributes>& getGPUFuncAttributes(VariantID vid, size_t tune_idx) const
+  { return gpu_func_attributes[vid].at(tune_idx); }
+
+  // get times of phases set with setPhaseNames averaged over npasses
+  const std::vector<std::string>& getPhaseNames() const { return phase_names; }
+  std::vector<double> getAvgPhaseTimes(VariantID vid, size_t tune_idx) const;
+
+  // get values of the metrics set with setMetricNames for a tuning that was
+  // run, empty for tunings that do not measure them
+  const std::vector<std::string>& getMetricNames() const { return metric_names; }
+  virtual std::vector<double> getMetrics(VariantID RAJAPERF_UNUSED_ARG(vid),
+                                         size_t RAJAPERF_UNUSED_ARG(tune_idx)) const
+  { return {}; }
+
   Checksum_type getChecksum(VariantID vid, size_t tune_idx) const
   { return checksum[vid].at(tune_idx); }
 
   void execute(VariantID vid, size_t tune_idx);
 
+  //
+  // Set up the given variant tuning on a new host thread, the next execute
+  // of it waits for the thread and runs without setting up again, see
+  // '--pipeline-setup'. waitPipelinedSetUp waits for the thread and rethrows
+  // what setUp threw on it. cancelPipelinedSetUp waits for the thread and
+  // tears down what it set up if no execute used it, owners call it before
+  // deleting a kernel as the destructor can not call tearDown.
+  //
+  void startPipelinedSetUp(VariantID vid, size_t tune_idx);
+  void waitPipelinedSetUp();
+  void cancelPipelinedSetUp();
+
+  //
+  // Set a function called once when the run phase of the next execute
+  // ends, before its checksum and tearDown.
+  //
+  void setPostRunHook(std::function<void()> hook)
+  { post_run_hook = std::move(hook); }
+
+  //
+  // Remove the results of the last pass run by execute, ie. to run again a
+  // pass taken while the GPU was throttled.
+  //
+  void discardLastPass(VariantID vid, size_t tune_idx);
+
+  //
+  // Record a pass that completed in an earlier run, as if execute ran it,
+  // device_time and block_size are nan if not recorded.
+  //
+  void addResumedPass(VariantID vid, size_t tune_idx,
+                      RAJA::Timer::ElapsedType time,
+                      RAJA::Timer::ElapsedType device_time,
+                      Checksum_type pass_checksum, double block_size);
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+  /*!
+   * \brief Run the given variant tuning of each kernel concurrently,
+   *        each on its own GPU stream and host thread.
+   *
+   * Returns the wall time of the concurrent run, the time of each kernel
+   * is recorded as in execute.
+   */
+  static RAJA::Timer::ElapsedType executeConcurrently(
+      const std::vector<KernelBase*>& kernels, VariantID vid,
+      const std::vector<size_t>& tune_idxs);
+
+  //
+  // As above with a variant for each kernel, ie. to run a CPU and a GPU
+  // variant at the same time.
+  //
+  static RAJA::Timer::ElapsedType executeConcurrently(
+      const std::vector<KernelBase*>& kernels,
+      const std::vector<VariantID>& vids,
+      const std::vector<size_t>& tune_idxs);
+#endif
+
+  /*!
+   * \brief Run the given variant tuning of each kernel one after another
+   *        for num_cycles cycles, setting up all kernels once so their
+   *        data shares the caches as in an application.
+   *
+   * Returns the wall time of the cycles, the time of each kernel over all
+   * cycles is recorded as in execute.
+   */
+  static RAJA::Timer::ElapsedType executeInterleaved(
+      const std::vector<KernelBase*>& kernels, VariantID vid,
+      const std::vector<size_t>& tune_idxs, int num_cycles);
+
+  /*!
+   * \brief Run the given variant tuning one rep at a time on a background
+   *        host thread bound to cpu (-1 -> unbound), with its data set up
+   *        once, until stopBackgroundRun is called.
+   *
+   * Used as interference load with '--interference', the reps are not
+   * recorded and GPU variants only synchronize their own stream.
+   */
+  void startBackgroundRun(VariantID vid, size_t tune_idx, int cpu = -1);
+  void stopBackgroundRun();
+
+  // index of the pass through the suite executing this kernel; -1 -> none
+  void setPassIndex(int idx) { pass_idx = idx; }
+  int getPassIndex() const { return pass_idx; }
+
+  // use stream gpu_stream_idx of the camp stream pool; -1 -> see '--gpu_stream_0'
+  void setGPUStreamIndex(int idx) { gpu_stream_idx = idx; }
+
 #if defined(RAJA_ENABLE_CUDA)
   camp::resources::Cuda getCudaResource()
   {
+    if (gpu_stream_idx >= 0) {
+      return camp::resources::Cuda(gpu_stream_idx);
+    }
     if (run_params.getGPUStream() == 0) {
       return camp::resources::Cuda::CudaFromStream(0);
     }
@@ -233,12 +655,21 @@ public:
 #if defined(RAJA_ENABLE_HIP)
   camp::resources::Hip getHipResource()
   {
+    if (gpu_stream_idx >= 0) {
+      return camp::resources::Hip(gpu_stream_idx);
+    }
     if (run_params.getGPUStream() == 0) {
       return camp::resources::Hip::HipFromStream(0);
     }
     return camp::resources::Hip::get_default();
   }
 #endif
+#if defined(RAJA_ENABLE_SYCL)
+  camp::resources::Sycl getSyclResource()
+  {
+    return camp::resources::Sycl::get_default();
+  }
+#endif
 
   void synchronize()
   {
@@ -246,25 +677,39 @@ public:
     if ( running_variant == Base_CUDA ||
          running_variant == Lambda_CUDA ||
          running_variant == RAJA_CUDA ) {
-      cudaErrchk( cudaDeviceSynchronize() );
+      if (running_concurrently) {
+        cudaErrchk( cudaStreamSynchronize( getCudaResource().get_stream() ) );
+      } else {
+        cudaErrchk( cudaDeviceSynchronize() );
+      }
     }
 #endif
 #if defined(RAJA_ENABLE_HIP)
     if ( running_variant == Base_HIP ||
          running_variant == Lambda_HIP ||
          running_variant == RAJA_HIP ) {
-      hipErrchk( hipDeviceSynchronize() );
+      if (running_concurrently) {
+        hipErrchk( hipStreamSynchronize( getHipResource().get_stream() ) );
+      } else {
+        hipErrchk( hipDeviceSynchronize() );
+      }
+    }
+#endif
+#if defined(RAJA_ENABLE_SYCL)
+    if ( running_variant == Base_SYCL ||
+         running_variant == RAJA_SYCL ) {
+      getSyclResource().get_queue()->wait_and_throw();
     }
 #endif
   }
 
-  int getDataAlignment() const;
+  size_t getDataAlignment() const;
 
   DataSpace getDataSpace(VariantID vid) const;
   DataSpace getHostAccessibleDataSpace(VariantID vid) const;
 
   template <typename T>
-  void allocData(DataSpace dataSpace, T& ptr, int len)
+  void allocData(DataSpace dataSpace, T& ptr, Index_type len)
   {
     rajaperf::allocData(dataSpace,
         ptr, len, getDataAlignment());
@@ -273,7 +718,7 @@ public:
   template <typename T>
   void copyData(DataSpace dst_dataSpace, T* dst_ptr,
                 DataSpace src_dataSpace, const T* src_ptr,
-                int len)
+                Index_type len)
   {
     rajaperf::copyData(dst_dataSpace, dst_ptr, src_dataSpace, src_ptr, len);
   }
@@ -285,48 +730,174 @@ public:
   }
 
   template <typename T>
-  void allocData(T*& ptr, int len, VariantID vid)
+  void allocData(T*& ptr, Index_type len, VariantID vid)
   {
     rajaperf::allocData(getDataSpace(vid),
         ptr, len, getDataAlignment());
   }
 
   template <typename T>
-  void allocAndInitData(T*& ptr, int len, VariantID vid)
+  void allocAndInitData(T*& ptr, Index_type len, VariantID vid)
   {
-    rajaperf::allocAndInitData(getDataSpace(vid),
-        ptr, len, getDataAlignment());
+    if (!getCachedSetupData(ptr, len, SetupDataInit::Data, vid)) {
+      rajaperf::allocAndInitData(getDataSpace(vid),
+          ptr, len, getDataAlignment());
+      cacheSetupData(ptr, len, SetupDataInit::Data, vid);
+    }
   }
 
   template <typename T>
-  void allocAndInitDataConst(T*& ptr, int len, T val, VariantID vid)
+  void allocAndInitDataConst(T*& ptr, Index_type len, T val, VariantID vid)
   {
-    rajaperf::allocAndInitDataConst(getDataSpace(vid),
-        ptr, len, getDataAlignment(), val);
+    const std::string init_value(reinterpret_cast<const char*>(&val), sizeof(T));
+    if (!getCachedSetupData(ptr, len, SetupDataInit::Const, vid, init_value)) {
+      rajaperf::allocAndInitDataConst(getDataSpace(vid),
+          ptr, len, getDataAlignment(), val);
+      cacheSetupData(ptr, len, SetupDataInit::Const, vid, init_value);
+    }
   }
 
   template <typename T>
-  void allocAndInitDataRandSign(T*& ptr, int len, VariantID vid)
+  void allocAndInitDataRandSign(T*& ptr, Index_type len, VariantID vid)
   {
-    rajaperf::allocAndInitDataRandSign(getDataSpace(vid),
-        ptr, len, getDataAlignment());
+    if (!getCachedSetupData(ptr, len, SetupDataInit::RandSign, vid)) {
+      rajaperf::allocAndInitDataRandSign(getDataSpace(vid),
+          ptr, len, getDataAlignment());
+      cacheSetupData(ptr, len, SetupDataInit::RandSign, vid);
+    }
   }
 
   template <typename T>
-  void allocAndInitDataRandValue(T*& ptr, int len, VariantID vid)
+  void allocAndInitDataRandValue(T*& ptr, Index_type len, VariantID vid)
   {
-    rajaperf::allocAndInitDataRandValue(getDataSpace(vid),
-        ptr, len, getDataAlignment());
+    if (!getCachedSetupData(ptr, len, SetupDataInit::RandValue, vid)) {
+      rajaperf::allocAndInitDataRandValue(getDataSpace(vid),
+          ptr, len, getDataAlignment());
+      cacheSetupData(ptr, len, SetupDataInit::RandValue, vid);
+    }
   }
 
+  // how a cached setup array was initialized
+  enum class SetupDataInit { Data, Const, RandSign, RandValue };
+
+  //
+  // When '--reuse-setup-data' is given, a copy of each array initialized
+  // in setUp is kept per data space and the n-th array initialized in
+  // later setUp calls is copied from the n-th cached array if it has the
+  // same size, element type, and initialization, ie. the same constant,
+  // instead of being initialized again. So tunings of other data types do
+  // not reuse each other's arrays.
+  //
   template <typename T>
-  rajaperf::AutoDataMover<T> scopedMoveData(T*& ptr, int len, VariantID vid)
+  bool getCachedSetupData(T*& ptr, Index_type len, SetupDataInit init,
+                          VariantID vid,
+                          const std::string& init_value = std::string())
+  {
+    if (!run_params.getReuseSetupData()) {
+      return false;
+    }
+    DataSpace dataSpace = getDataSpace(vid);
+    std::vector<CachedSetupData>& cache = setup_data_cache[dataSpace];
+    if (setup_data_cache_idx < cache.size() &&
+        cache[setup_data_cache_idx].matches(len*sizeof(T), typeid(T),
+                                            init, init_value)) {
+      allocData(dataSpace, ptr, len);
+      copyData(dataSpace, ptr,
+               dataSpace, static_cast<const T*>(cache[setup_data_cache_idx].ptr),
+               len);
+      // keep init count in sync with initializing the data
+      detail::incDataInitCount();
+      setup_data_cache_idx++;
+      return true;
+    }
+    return false;
+  }
+
+  template <typename T>
+  void cacheSetupData(T* ptr, Index_type len, SetupDataInit init,
+                      VariantID vid,
+                      const std::string& init_value = std::string())
+  {
+    if (!run_params.getReuseSetupData()) {
+      return;
+    }
+    DataSpace dataSpace = getDataSpace(vid);
+    std::vector<CachedSetupData>& cache = setup_data_cache[dataSpace];
+    T* cached_ptr = nullptr;
+    allocData(dataSpace, cached_ptr, len);
+    copyData(dataSpace, cached_ptr, dataSpace, ptr, len);
+    if (setup_data_cache_idx < cache.size()) {
+      rajaperf::detail::deallocData(dataSpace, cache[setup_data_cache_idx].ptr);
+      cache[setup_data_cache_idx] = CachedSetupData{cached_ptr, len*sizeof(T),
+                                                    typeid(T), init, init_value};
+    } else {
+      cache.emplace_back(CachedSetupData{cached_ptr, len*sizeof(T),
+                                         typeid(T), init, init_value});
+    }
+    setup_data_cache_idx++;
+  }
+
+  void clearSetupDataCache();
+
+  template <typename T>
+  rajaperf::AutoDataMover<T> scopedMoveData(T*& ptr, Index_type len, VariantID vid)
   {
     rajaperf::moveData(getHostAccessibleDataSpace(vid), getDataSpace(vid),
         ptr, len, getDataAlignment());
     return {getDataSpace(vid), getHostAccessibleDataSpace(vid), ptr, len, getDataAlignment()};
   }
 
+  //
+  // Convert the elements of an array in the data space of vid to the
+  // storage precision of tune_idx in place, and back, nothing for tunings
+  // with the Default precision
+  //
+  template <typename T>
+  void convertDataToStorage(T*& ptr, Index_type len, VariantID vid, size_t tune_idx)
+  {
+    const StoragePrecision precision = getStoragePrecision(vid, tune_idx);
+    if (precision == StoragePrecision::Default) {
+      return;
+    }
+    auto moved = scopedMoveData(ptr, len, vid);
+    if (precision == StoragePrecision::Float) {
+      storage::convertToStorage<float>(ptr, len);
+    } else {
+      storage::convertToStorage<BFloat16_type>(ptr, len);
+    }
+  }
+
+  template <typename T>
+  void convertDataFromStorage(T*& ptr, Index_type len, VariantID vid, size_t tune_idx)
+  {
+    const StoragePrecision precision = getStoragePrecision(vid, tune_idx);
+    if (precision == StoragePrecision::Default) {
+      return;
+    }
+    auto moved = scopedMoveData(ptr, len, vid);
+    if (precision == StoragePrecision::Float) {
+      storage::convertFromStorage<float>(ptr, len);
+    } else {
+      storage::convertFromStorage<BFloat16_type>(ptr, len);
+    }
+  }
+
+  //
+  // Allocate a copy of the len indices in src in the index type of dst,
+  // both in the data space of vid
+  //
+  template <typename IndexList_type, typename T>
+  void allocAndCopyIndexData(IndexList_type*& dst, T*& src, Index_type len,
+                             VariantID vid)
+  {
+    allocData(dst, len, vid);
+    auto moved_src = scopedMoveData(src, len, vid);
+    auto moved_dst = scopedMoveData(dst, len, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      dst[i] = static_cast<IndexList_type>(src[i]);
+    }
+  }
+
   template <typename T>
   void deallocData(T*& ptr, VariantID vid)
   {
@@ -341,15 +912,17 @@ public:
   }
 
   template <typename T>
-  long double calcChecksum(T* ptr, int len, VariantID vid)
+  long double calcChecksum(T* ptr, Index_type len, VariantID vid)
   {
-    return rajaperf::calcChecksum(getDataSpace(vid),
-      ptr, len, getDataAlignment(), 1.0);
+    return calcChecksum(ptr, len, 1.0, vid);
   }
 
   template <typename T>
-  long double calcChecksum(T* ptr, int len, Real_type scale_factor, VariantID vid)
+  long double calcChecksum(T* ptr, Index_type len, Real_type scale_factor, VariantID vid)
   {
+    if (running_checksums != nullptr) {
+      return calcCachedChecksum(ptr, len, scale_factor, vid);
+    }
     return rajaperf::calcChecksum(getDataSpace(vid),
       ptr, len, getDataAlignment(), scale_factor);
   }
@@ -358,22 +931,89 @@ public:
   {
     synchronize();
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
-    MPI_Barrier(MPI_COMM_WORLD);
+    if (!running_concurrently && !skip_start_barrier) {
+      MPI_Barrier(MPI_COMM_WORLD);
+    }
 #endif
+    startCounting();
+    startEnergy();
+    startPageFaults();
+    startTelemetry();
+    startActivity();
     timer.start();
+    startDeviceTimer();
     CALI_START;
   }
 
   void stopTimer()
   {
+    stopDeviceTimer();
     synchronize();
+    stopCounting();
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
-    MPI_Barrier(MPI_COMM_WORLD);
+    if (!running_concurrently && !skip_stop_barrier) {
+      MPI_Barrier(MPI_COMM_WORLD);
+    }
 #endif
-    CALI_STOP; timer.stop(); recordExecTime();
+    CALI_STOP;
+    timer.stop();
+    stopActivity();
+    stopTelemetry();
+    stopPageFaults();
+    stopEnergy();
+    recordExecTime();
+    sampleDeviceMemory();
+  }
+
+  // record GPU kernel attributes of a function launched by the running
+  // variant tuning, ie. from detail::getCudaFuncAttributes, for the GPU
+  // function attributes report, replacing those of the same name
+  void setGPUFuncAttributes(const GPUFuncAttributes& attrs)
+  {
+    if (running_variant < NumVariants) {
+      std::vector<GPUFuncAttributes>& funcs =
+          gpu_func_attributes[running_variant].at(running_tuning);
+      for (GPUFuncAttributes& func : funcs) {
+        if (func.name == attrs.name) {
+          func = attrs;
+          return;
+        }
+      }
+      funcs.push_back(attrs);
+    }
+  }
+
+  void resetTimer()
+  {
+    timer.reset();
+    device_elapsed = 0.0;
+    counter_elapsed.assign(counter_elapsed.size(), 0);
+    energy_elapsed.assign(energy_elapsed.size(), 0.0);
+    page_faults_elapsed[0] = 0;
+    page_faults_elapsed[1] = 0;
+    telemetry_elapsed = detail::emptyTelemetry();
+    activity_elapsed = detail::DeviceActivity{0.0, 0};
+    for (detail::HostTimer& phase_timer : phase_timers) {
+      phase_timer.reset();
+    }
+  }
+
+  //
+  // Phase timers time parts of the timed region, ie. the pack,
+  // communication, and unpack phases of a halo exchange.
+  // Phase times accumulate like timer.
+  //
+  void startPhaseTimer(size_t phase_idx)
+  {
+    synchronize();
+    phase_timers.at(phase_idx).start();
   }
 
-  void resetTimer() { timer.reset(); }
+  void stopPhaseTimer(size_t phase_idx)
+  {
+    synchronize();
+    phase_timers.at(phase_idx).stop();
+  }
 
   //
   // Virtual and pure virtual methods that may/must be implemented
@@ -406,6 +1046,73 @@ public:
   virtual void runOpenMPTargetVariant(VariantID vid, size_t tune_idx) = 0;
 #endif
 
+  //
+  // Storage tunings of kernels that call setUsesStoragePrecisions run these
+  // instead of run<backend>Variant
+  //
+  virtual void runSeqStorageVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented Seq storage variant id = " << vid << std::endl;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  virtual void runOpenMPStorageVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented OpenMP storage variant id = " << vid << std::endl;
+  }
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+  virtual void runCudaStorageVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented Cuda storage variant id = " << vid << std::endl;
+  }
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+  virtual void runHipStorageVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented Hip storage variant id = " << vid << std::endl;
+  }
+#endif
+
+  //
+  // Index width tunings of kernels that call setUsesIndexWidths run these
+  // instead of run<backend>Variant
+  //
+  virtual void runSeqIndexVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented Seq index variant id = " << vid << std::endl;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  virtual void runOpenMPIndexVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented OpenMP index variant id = " << vid << std::endl;
+  }
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+  virtual void runCudaIndexVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented Cuda index variant id = " << vid << std::endl;
+  }
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+  virtual void runHipIndexVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented Hip index variant id = " << vid << std::endl;
+  }
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+  virtual void runSyclVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented Sycl variant id = " << vid << std::endl;
+  }
+#endif
+
 #if defined(RUN_KOKKOS)
   virtual void runKokkosVariant(VariantID vid, size_t tune_idx)
   {
@@ -462,6 +1169,89 @@ private:
 
   void recordExecTime();
 
+  bool usingDeviceTimer() const;
+  void startDeviceTimer();
+  void stopDeviceTimer();
+
+  void startCounting();
+  void stopCounting();
+
+  void startEnergy();
+  void stopEnergy();
+
+  void startPageFaults();
+  void stopPageFaults();
+
+  void startDeviceMemory(VariantID vid);
+  void sampleDeviceMemory();
+  void stopDeviceMemory(VariantID vid, size_t tune_idx);
+
+  void startTelemetry();
+  void stopTelemetry();
+
+  void startActivity();
+  void stopActivity();
+
+  // start time of a trace event, 0 when not tracing with '--trace'
+  double startTraceEvent() const;
+  // record a trace event of a variant tuning from start_time until now,
+  // reps > 0 is shown with the event
+  void stopTraceEvent(const std::string& name, const char* category,
+                      VariantID vid, size_t tune_idx, double start_time,
+                      Index_type reps = 0) const;
+
+  void runVariantTuning(VariantID vid, size_t tune_idx);
+  // run tune_idx with run<backend>StorageVariant if it is a storage tuning
+  bool runStorageTuning(VariantID vid, size_t tune_idx);
+  // run tune_idx with run<backend>IndexVariant if it is an index width tuning
+  bool runIndexTuning(VariantID vid, size_t tune_idx);
+
+  // run the reps of a pass in their own setUp and tearDown, flushing the
+  // caches before each rep, rep batching is used to time reps one by one
+  void runColdCacheReps(VariantID vid, size_t tune_idx);
+
+  // call updateChecksum recording the checksum of the pass on its own
+  void updatePassChecksum(VariantID vid, size_t tune_idx);
+
+  //
+  // With '--checksum-once' the checksums of the arrays of a pass are kept
+  // with a hash of the array bits, calcChecksum calls in later passes hash
+  // the array and reuse the checksum of the same call in an earlier pass
+  // if the hash matches. Calls are matched by their order in updateChecksum.
+  //
+  struct CachedChecksum
+  {
+    uint64_t hash;
+    long double checksum;
+  };
+
+  template <typename T>
+  long double calcCachedChecksum(T* ptr, Index_type len,
+                                 Real_type scale_factor, VariantID vid)
+  {
+    uint64_t hash = rajaperf::calcDataHash(getDataSpace(vid),
+        ptr, len, getDataAlignment());
+    uint64_t scale_bits = 0;
+    std::memcpy(&scale_bits, &scale_factor,
+                std::min(sizeof(scale_bits), sizeof(scale_factor)));
+    hash ^= (scale_bits + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+
+    std::vector<CachedChecksum>& cache = *running_checksums;
+    const size_t idx = running_checksum_idx++;
+    if (idx < cache.size() && cache[idx].hash == hash) {
+      return cache[idx].checksum;
+    }
+
+    const long double val = rajaperf::calcChecksum(getDataSpace(vid),
+        ptr, len, getDataAlignment(), scale_factor);
+    if (idx < cache.size()) {
+      cache[idx] = CachedChecksum{hash, val};
+    } else {
+      cache.emplace_back(CachedChecksum{hash, val});
+    }
+    return val;
+  }
+
   //
   // Static properties of kernel, independent of run
   //
@@ -474,8 +1264,46 @@ private:
   Index_type actual_prob_size;
 
   bool uses_feature[NumFeatures];
+  bool has_pattern[NumPatterns];
+
+  bool uses_data_types;
+  bool uses_data_type[static_cast<size_t>(DataType::NumDataTypes)];
+  std::vector<DataType> data_types;          // data types run
+  size_t num_data_type_tunings[NumVariants]; // tunings per data type
+
+  bool uses_l2_persist_window;
+  size_t num_l2_persist_tunings[NumVariants]; // tunings without L2 persist window
+  const void* l2_persist_ptr;
+  size_t l2_persist_nbytes;
+
+  bool uses_shmem_carveout;
+  size_t num_shmem_carveout_tunings[NumVariants]; // tunings with the default carve-out
+  int shmem_carveout; // carve-out of the running tuning; -1 -> default
+
+  bool uses_storage_precisions;
+  size_t num_storage_base_tunings[NumVariants]; // tunings before the storage tunings
+
+  bool uses_index_widths;
+  size_t num_index_base_tunings[NumVariants]; // tunings before the index width tunings
+
+  bool uses_omp_target_thread_limit;
+  bool uses_omp_target_num_teams;
+  size_t num_omp_target_tunings[NumVariants]; // tunings with the default launch config
+  // (thread limit, number of teams) of each repeat of the tunings
+  std::vector<std::pair<int, int>> omp_target_launch_configs;
+  int omp_target_thread_limit; // thread limit of the running tuning; 0 -> default
+  int omp_target_num_teams; // teams of the running tuning; 0 -> no clause
+
+  size_t num_omp_thread_tunings[NumVariants]; // tunings with the default number of threads
+
+  size_t num_gpu_setting_tunings[NumVariants]; // tunings with the default GPU settings
+
+  bool rep_batching_allowed;
 
   std::vector<std::string> variant_tuning_names[NumVariants];
+  std::vector<bool> variant_tuning_reproducible[NumVariants];
+
+  std::vector<KernelParam> kernel_params; // in order registered
 
   //
   // Properties of kernel dependent on how kernel is run
@@ -485,13 +1313,119 @@ private:
   Index_type bytes_per_rep;
   Index_type FLOPs_per_rep;
   double kernel_block_size = nan(""); // Set default value for non GPU kernels
+  size_t data_footprint = 0; // measured in execute, 0 until run
+  double execute_phase_time[NumExecutePhases] = {0.0, 0.0, 0.0, 0.0};
 
   VariantID running_variant;
   size_t running_tuning;
 
+  Index_type running_batch_reps; // reps in rep batch or probe being run; 0 -> none
+  bool running_probe;
+  bool running_cold_cache;
+  Index_type calibrated_reps;    // reps for target time; 0 -> not calibrated
+
+  int gpu_stream_idx;            // camp pool stream to run on; -1 -> default
+  int pass_idx;                  // pass through the suite; -1 -> none
+  bool running_concurrently;     // running in executeConcurrently
+  bool running_background = false; // running in startBackgroundRun
+  std::thread background_thread;
+  std::atomic<bool> background_stop{false};
+  std::thread setup_thread;      // running startPipelinedSetUp
+  std::exception_ptr setup_thread_error;
+  VariantID prepared_variant = NumVariants; // set up by startPipelinedSetUp
+  size_t prepared_tuning = 0;
+  double prepared_setup_time = 0.0;
+  std::function<void()> post_run_hook;
+  RAJA::Timer::ElapsedType batch_start_time;
+  // skip the MPI barrier of startTimer or stopTimer for rep batches between
+  // those that barrier with '--timing-barrier-batches'
+  bool skip_start_barrier = false;
+  bool skip_stop_barrier = false;
+
   std::vector<int> num_exec[NumVariants];
 
-  RAJA::Timer timer;
+  struct CachedSetupData
+  {
+    void* ptr;
+    size_t nbytes;
+    std::type_index type;
+    SetupDataInit init;
+    std::string init_value;  // bytes of the constant of SetupDataInit::Const
+
+    bool matches(size_t other_nbytes, std::type_index other_type,
+                 SetupDataInit other_init,
+                 const std::string& other_init_value) const
+    {
+      return nbytes == other_nbytes && type == other_type &&
+             init == other_init && init_value == other_init_value;
+    }
+  };
+  std::map<DataSpace, std::vector<CachedSetupData>> setup_data_cache;
+  size_t setup_data_cache_idx;
+
+  detail::HostTimer timer;
+
+  //
+  // GPU event pair recorded on kernel stream when timing GPU variants
+  // with '--gpu-event-timing', elapsed time accumulates like timer
+  //
+  RAJA::Timer::ElapsedType device_elapsed;
+#if defined(RAJA_ENABLE_CUDA)
+  bool have_cuda_timer_events;
+  cudaEvent_t cuda_timer_events[2];
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  bool have_hip_timer_events;
+  hipEvent_t hip_timer_events[2];
+#endif
+
+  //
+  // Hardware counts in timed regions when counting with '--papi-events',
+  // counts accumulate like timer
+  //
+  std::vector<long long> counter_elapsed;
+
+  //
+  // Joules used in timed regions when measuring with '--measure-energy',
+  // meters are read outside the timer start and stop
+  //
+  std::vector<double> energy_start;
+  std::vector<double> energy_stop;
+  std::vector<double> energy_elapsed;
+
+  //
+  // Minor and major page faults in timed regions when counting with
+  // '--count-page-faults', counts accumulate like timer
+  //
+  long long page_faults_start[2] = {0, 0};
+  long long page_faults_elapsed[2] = {0, 0};
+
+  //
+  // Device memory of the running pass when tracking with
+  // '--track-device-memory', the data bytes in use and free bytes of the
+  // GPU before setUp, and the least free bytes sampled after setUp and at
+  // the end of each timed region
+  //
+  bool tracking_device_memory = false;
+  size_t device_data_start_bytes = 0;
+  size_t device_free_start_bytes = 0;
+  size_t device_free_min_bytes = 0;
+
+  //
+  // GPU telemetry of timed regions when sampling with '--gpu-telemetry',
+  // samples combine like timer accumulates
+  //
+  detail::GPUTelemetry telemetry_elapsed = detail::emptyTelemetry();
+
+  // device activity of timed regions when tracing with '--device-activity',
+  // accumulates like timer
+  detail::DeviceActivity activity_elapsed = {0.0, 0};
+  double activity_trace_start = 0.0; // trace time the activity region started
+
+  std::vector<std::string> phase_names;
+  std::vector<detail::HostTimer> phase_timers;
+
+  std::vector<std::string> metric_names;
 
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
   bool doCaliperTiming = true; // warmup can use this to exclude timing
@@ -503,7 +1437,10 @@ private:
   cali_id_t Bytes_Rep_attr;
   cali_id_t Flops_Rep_attr;
   cali_id_t BlockSize_attr;
+  cali_id_t Pass_attr;
 
+  std::string cali_group_region;
+  std::string cali_kernel_region;
 
   // we need a Caliper Manager object per variant
   // we can inline this with c++17
@@ -513,6 +1450,37 @@ private:
   std::vector<RAJA::Timer::ElapsedType> min_time[NumVariants];
   std::vector<RAJA::Timer::ElapsedType> max_time[NumVariants];
   std::vector<RAJA::Timer::ElapsedType> tot_time[NumVariants];
+
+  std::vector<std::vector<double>> tot_counters_per_rep[NumVariants];
+  std::vector<std::vector<double>> tot_energy_per_rep[NumVariants];
+  std::vector<long long> tot_minor_page_faults[NumVariants];
+  std::vector<long long> tot_major_page_faults[NumVariants];
+  std::vector<size_t> device_setup_data_bytes[NumVariants];
+  std::vector<size_t> peak_device_data_bytes[NumVariants];
+  std::vector<size_t> peak_device_memory_bytes[NumVariants];
+  std::vector<std::vector<GPUFuncAttributes>> gpu_func_attributes[NumVariants];
+  std::vector<std::vector<detail::GPUTelemetry>> pass_telemetry[NumVariants];
+  std::vector<int> num_discarded_passes[NumVariants];
+  std::vector<double> tot_device_busy_time[NumVariants];
+  std::vector<long> tot_device_ops[NumVariants];
+
+  std::vector<std::vector<RAJA::Timer::ElapsedType>> tot_phase_time[NumVariants];
+
+  std::vector<RAJA::Timer::ElapsedType> min_device_time[NumVariants];
+  std::vector<RAJA::Timer::ElapsedType> max_device_time[NumVariants];
+  std::vector<RAJA::Timer::ElapsedType> tot_device_time[NumVariants];
+
+  std::vector<std::vector<RAJA::Timer::ElapsedType>> rep_batch_times[NumVariants];
+
+  std::vector<std::vector<RAJA::Timer::ElapsedType>> pass_time[NumVariants];
+  std::vector<std::vector<RAJA::Timer::ElapsedType>> pass_device_time[NumVariants];
+  std::vector<std::vector<Checksum_type>> pass_checksums[NumVariants];
+  std::vector<std::vector<CachedChecksum>> cached_checksums[NumVariants];
+  std::vector<CachedChecksum>* running_checksums = nullptr;
+  size_t running_checksum_idx = 0;
+  std::vector<std::vector<RAJA::Timer::ElapsedType>> cold_cache_pass_time[NumVariants];
+
+  std::vector<double> tuning_block_size[NumVariants];
 };
 
 }  // closing brace for rajaperf namespace
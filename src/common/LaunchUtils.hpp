@@ -0,0 +1,143 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods used by the launch tunings of the RAJA GPU variants of 1D
+/// kernels, which run the loops of the kernel with RAJA::launch instead of
+/// RAJA::forall.
+///
+/// The loops of a launch tuning map block bx and thread tx of a grid of
+/// block_size threads per block to iterate bx*block_size+tx of the segment,
+/// like the forall tunings of the same block size, so the difference in
+/// their times is the overhead of the launch abstraction.
+///
+
+#ifndef RAJAPerf_LaunchUtils_HPP
+#define RAJAPerf_LaunchUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/RPTypes.hpp"
+
+namespace rajaperf
+{
+
+namespace gpu_launch
+{
+
+#if defined(RAJA_ENABLE_CUDA)
+
+/*!
+ * \brief Run body for each iterate of seg asynchronously in res with
+ * RAJA::launch if launch is true or RAJA::forall with cuda_exec otherwise.
+ */
+template < size_t block_size, bool launch, typename Segment, typename Body >
+inline void forall(RAJA::resources::Cuda res, Segment const& seg, Body const& body)
+{
+  if (launch) {
+
+    using launch_policy =
+        RAJA::LaunchPolicy<RAJA::cuda_launch_t<true /*async*/, block_size>>;
+
+    using teams_x = RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
+
+    using threads_x = RAJA::LoopPolicy<RAJA::cuda_thread_size_x_direct<block_size>>;
+
+    const Index_type len = seg.size();
+    const Index_type grid_size = RAJA_DIVIDE_CEILING_INT(len, block_size);
+    auto begin = seg.begin();
+
+    RAJA::launch<launch_policy>( res,
+      RAJA::LaunchParams(RAJA::Teams(grid_size),
+                         RAJA::Threads(block_size)),
+      [=] __device__ (RAJA::LaunchContext ctx) {
+
+        RAJA::loop<teams_x>(ctx, RAJA::RangeSegment(0, grid_size),
+          [&](Index_type bx) {
+            RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, block_size),
+              [&](Index_type tx) {
+                Index_type k = bx * block_size + tx;
+                if (k < len) {
+                  body(begin[k]);
+                }
+              }
+            );
+          }
+        );
+
+      }
+    );
+
+  } else {
+
+    RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      seg, body);
+
+  }
+}
+
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+
+/*!
+ * \brief Run body for each iterate of seg asynchronously in res with
+ * RAJA::launch if launch is true or RAJA::forall with hip_exec otherwise.
+ */
+template < size_t block_size, bool launch, typename Segment, typename Body >
+inline void forall(RAJA::resources::Hip res, Segment const& seg, Body const& body)
+{
+  if (launch) {
+
+    using launch_policy =
+        RAJA::LaunchPolicy<RAJA::hip_launch_t<true /*async*/, block_size>>;
+
+    using teams_x = RAJA::LoopPolicy<RAJA::hip_block_x_direct>;
+
+    using threads_x = RAJA::LoopPolicy<RAJA::hip_thread_size_x_direct<block_size>>;
+
+    const Index_type len = seg.size();
+    const Index_type grid_size = RAJA_DIVIDE_CEILING_INT(len, block_size);
+    auto begin = seg.begin();
+
+    RAJA::launch<launch_policy>( res,
+      RAJA::LaunchParams(RAJA::Teams(grid_size),
+                         RAJA::Threads(block_size)),
+      [=] __device__ (RAJA::LaunchContext ctx) {
+
+        RAJA::loop<teams_x>(ctx, RAJA::RangeSegment(0, grid_size),
+          [&](Index_type bx) {
+            RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, block_size),
+              [&](Index_type tx) {
+                Index_type k = bx * block_size + tx;
+                if (k < len) {
+                  body(begin[k]);
+                }
+              }
+            );
+          }
+        );
+
+      }
+    );
+
+  } else {
+
+    RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      seg, body);
+
+  }
+}
+
+#endif
+
+}  // closing brace for gpu_launch namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
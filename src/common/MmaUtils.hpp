@@ -0,0 +1,186 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Matrix product on the FP64 matrix units of the GPU, the tensor cores of
+/// sm_80 and newer through nvcuda::wmma and the matrix cores of gfx90a and
+/// newer through rocwmma, used by the mma tunings of matrix product kernels.
+///
+/// gpu_matmul_mma computes, with row major matrices,
+///
+/// for (Index_type i = 0; i < ni; i++) {
+///   for (Index_type j = 0; j < nj; j++) {
+///     Real_type dot = 0.0;
+///     for (Index_type k = 0; k < nk; k++) {
+///       dot += a[i][k] * b[k][j];
+///     }
+///     out[i][j] = alpha * dot;
+///   }
+/// }
+///
+/// The matrix units sum the products in a different order than the other
+/// tunings, so the checksums differ by rounding.
+///
+
+#ifndef RAJAPerf_MmaUtils_HPP
+#define RAJAPerf_MmaUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+#include "common/RPTypes.hpp"
+
+//
+// The mma tunings are defined when Real_type is double and the matrix
+// fragment library is available, rocwmma is used when the suite is built
+// with RAJA_PERFSUITE_USE_ROCWMMA.
+//
+#if defined(RP_USE_DOUBLE) && \
+    (defined(__CUDACC__) || \
+     (defined(__HIPCC__) && defined(RAJA_PERFSUITE_USE_ROCWMMA)))
+#define RAJA_PERFSUITE_HAVE_GPU_MMA
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+
+#if defined(__CUDACC__)
+#include <mma.h>
+#else
+#include <rocwmma/rocwmma.hpp>
+#endif
+
+namespace rajaperf
+{
+
+namespace gpu_mma
+{
+
+#if defined(__CUDACC__)
+namespace wmma = nvcuda::wmma;
+
+// m8n8k4 is the FP64 fragment shape of sm_80
+constexpr int frag_m = 8;
+constexpr int frag_k = 4;
+constexpr int warp_size = 32;
+#else
+namespace wmma = rocwmma;
+
+// 16x16x4 is an FP64 fragment shape of gfx90a and gfx94x
+constexpr int frag_m = 16;
+constexpr int frag_k = 4;
+constexpr int warp_size = 64;
+#endif
+
+//
+// Each block computes a 32x32 tile of out with 2x2 warps, each warp
+// computes a 16x16 part with (16/frag_m)^2 accumulator fragments. Tiles of
+// a and b are staged in shared memory padded with zeros, so any ni, nj,
+// and nk work.
+//
+constexpr int tile_mn = 32;
+constexpr int tile_k = 16;
+constexpr int warp_mn = 16;
+constexpr int frags = warp_mn / frag_m;
+constexpr size_t block_size = 4 * warp_size;
+
+} // closing brace for gpu_mma namespace
+
+template < typename Data_type >
+__launch_bounds__(gpu_mma::block_size)
+__global__ void gpu_matmul_mma(Data_type* out, const Data_type* a,
+                               const Data_type* b, Data_type alpha,
+                               Index_type ni, Index_type nj, Index_type nk)
+{
+#if (defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 800) || \
+    defined(__gfx90a__) || defined(__gfx940__) || \
+    defined(__gfx941__) || defined(__gfx942__)
+  using namespace gpu_mma;
+
+  __shared__ __align__(32) Data_type a_tile[tile_mn][tile_k];
+  __shared__ __align__(32) Data_type b_tile[tile_k][tile_mn];
+  __shared__ __align__(32) Data_type c_tile[tile_mn][tile_mn];
+
+  const Index_type i0 = blockIdx.y * tile_mn;
+  const Index_type j0 = blockIdx.x * tile_mn;
+
+  const int warp = threadIdx.x / warp_size;
+  const int wi = (warp / 2) * warp_mn;
+  const int wj = (warp % 2) * warp_mn;
+
+  wmma::fragment<wmma::matrix_a, frag_m, frag_m, frag_k, Data_type, wmma::row_major> a_frag[frags];
+  wmma::fragment<wmma::matrix_b, frag_m, frag_m, frag_k, Data_type, wmma::row_major> b_frag[frags];
+  wmma::fragment<wmma::accumulator, frag_m, frag_m, frag_k, Data_type> c_frag[frags][frags];
+
+  for (int fi = 0; fi < frags; ++fi) {
+    for (int fj = 0; fj < frags; ++fj) {
+      wmma::fill_fragment(c_frag[fi][fj], 0.0);
+    }
+  }
+
+  for (Index_type k0 = 0; k0 < nk; k0 += tile_k) {
+
+    for (int idx = threadIdx.x; idx < tile_mn*tile_k; idx += block_size) {
+      const int ia = idx / tile_k;
+      const int ka = idx % tile_k;
+      a_tile[ia][ka] = (i0 + ia < ni && k0 + ka < nk)
+                     ? a[(k0 + ka) + (i0 + ia)*nk] : 0.0;
+      const int kb = idx / tile_mn;
+      const int jb = idx % tile_mn;
+      b_tile[kb][jb] = (k0 + kb < nk && j0 + jb < nj)
+                     ? b[(j0 + jb) + (k0 + kb)*nj] : 0.0;
+    }
+    __syncthreads();
+
+    for (int kk = 0; kk < tile_k; kk += frag_k) {
+      for (int f = 0; f < frags; ++f) {
+        wmma::load_matrix_sync(a_frag[f], &a_tile[wi + f*frag_m][kk], tile_k);
+        wmma::load_matrix_sync(b_frag[f], &b_tile[kk][wj + f*frag_m], tile_mn);
+      }
+      for (int fi = 0; fi < frags; ++fi) {
+        for (int fj = 0; fj < frags; ++fj) {
+          wmma::mma_sync(c_frag[fi][fj], a_frag[fi], b_frag[fj], c_frag[fi][fj]);
+        }
+      }
+    }
+    __syncthreads();
+
+  }
+
+  for (int fi = 0; fi < frags; ++fi) {
+    for (int fj = 0; fj < frags; ++fj) {
+      wmma::store_matrix_sync(&c_tile[wi + fi*frag_m][wj + fj*frag_m],
+                              c_frag[fi][fj], tile_mn, wmma::mem_row_major);
+    }
+  }
+  __syncthreads();
+
+  for (int idx = threadIdx.x; idx < tile_mn*tile_mn; idx += block_size) {
+    const int i = idx / tile_mn;
+    const int j = idx % tile_mn;
+    if (i0 + i < ni && j0 + j < nj) {
+      out[(j0 + j) + (i0 + i)*nj] = alpha * c_tile[i][j];
+    }
+  }
+#else
+  RAJA_UNUSED_VAR(out); RAJA_UNUSED_VAR(a); RAJA_UNUSED_VAR(b);
+  RAJA_UNUSED_VAR(alpha); RAJA_UNUSED_VAR(ni); RAJA_UNUSED_VAR(nj);
+  RAJA_UNUSED_VAR(nk);
+#endif
+}
+
+/*!
+ * \brief Number of blocks in each dimension of the gpu_matmul_mma grid.
+ */
+inline Index_type getMmaGridSize(Index_type n)
+{
+  return (n + gpu_mma::tile_mn - 1) / gpu_mma::tile_mn;
+}
+
+} // closing brace for rajaperf namespace
+
+#endif  // RAJA_PERFSUITE_HAVE_GPU_MMA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for non-temporal, or streaming, stores used by the nontemporal
+/// tunings of kernels that write arrays they do not read again in a rep.
+///
+/// A normal store reads the cache line it writes first, so writing an
+/// array moves twice its bytes. A non-temporal store writes the line
+/// without reading it and without keeping it in cache, so the traffic is
+/// what the bytes per rep of such kernels count.
+///
+
+#ifndef RAJAPerf_NontemporalUtils_HPP
+#define RAJAPerf_NontemporalUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstring>
+
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__) && \
+    defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Store val to *dst with a non-temporal store.
+ *
+ * CUDA device code uses the cache streaming store __stcs, clang, including
+ * HIP device code, uses __builtin_nontemporal_store, and other x86 host
+ * compilers use the SSE2 streaming integer stores. Otherwise this is a
+ * normal store.
+ */
+template < typename T >
+RAJA_HOST_DEVICE RAJA_INLINE void storeNontemporal(T* dst, T val)
+{
+#if defined(__CUDA_ARCH__)
+  __stcs(dst, val);
+#elif defined(__clang__)
+  __builtin_nontemporal_store(val, dst);
+#elif defined(__SSE2__) && defined(__x86_64__)
+  if (sizeof(T) == sizeof(long long)) {
+    long long bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    _mm_stream_si64(reinterpret_cast<long long*>(dst), bits);
+  } else if (sizeof(T) == sizeof(int)) {
+    int bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    _mm_stream_si32(reinterpret_cast<int*>(dst), bits);
+  } else {
+    *dst = val;
+  }
+#else
+  *dst = val;
+#endif
+}
+
+/*!
+ * \brief Order the non-temporal stores of the calling host thread before
+ * its later stores, call after its loop of non-temporal stores.
+ *
+ * GPU kernels need no fence, the stores are visible when the kernel ends.
+ */
+inline void fenceNontemporal()
+{
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__) && \
+    defined(__SSE2__)
+  _mm_sfence();
+#endif
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
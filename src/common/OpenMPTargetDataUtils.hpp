@@ -21,6 +21,16 @@
 
 #include <omp.h>
 
+#include <string>
+#include <vector>
+
+//
+// System allocated memory is only usable in target regions when every
+// translation unit with target constructs requires unified shared memory.
+//
+#if defined(RAJA_PERFSUITE_ENABLE_OMPTARGET_USM)
+#pragma omp requires unified_shared_memory
+#endif
 
 namespace rajaperf
 {
@@ -83,7 +93,7 @@ inline void deallocOpenMPDeviceData(void* dptr,
  * and of propoer size for copy operation to succeed.
  */
 template <typename T>
-void initOpenMPDeviceData(T* dptr, const T* hptr, int len,
+void initOpenMPDeviceData(T* dptr, const T* hptr, Index_type len,
                           int did = getOpenMPTargetDevice(),
                           int hid = getOpenMPTargetHost())
 {
@@ -97,13 +107,68 @@ void initOpenMPDeviceData(T* dptr, const T* hptr, int len,
  * and of propoer size for copy operation to succeed.
  */
 template <typename T>
-void getOpenMPDeviceData(T* hptr, const T* dptr, int len,
+void getOpenMPDeviceData(T* hptr, const T* dptr, Index_type len,
                          int hid = getOpenMPTargetHost(),
                          int did = getOpenMPTargetDevice())
 {
   omp_target_memcpy( hptr, const_cast<T*>(dptr), len * sizeof(T), 0, 0, hid, did );
 }
 
+namespace omp_target_map
+{
+
+/*!
+ * \brief Ways tunings of Base_OpenMPTarget variants give target regions
+ *        their data, in tuning order.
+ *
+ * DevicePtr, the default tuning, passes pointers from omp_target_alloc to
+ * target regions with is_device_ptr. EnterData maps host arrays with
+ * target enter data before the timed reps, so the maps of each rep find
+ * them present. MapToFrom maps host arrays in each rep, copying inputs to
+ * the device and outputs to and from it. NoWait passes device pointers to
+ * target regions with nowait and a depend on the output, so the reps are
+ * a chain of target tasks waited for after the last one is launched.
+ */
+enum struct Strategy : size_t
+{
+  DevicePtr = 0,
+  EnterData,
+  MapToFrom,
+  NoWait
+};
+
+/*!
+ * \brief Return the strategy of the given Base_OpenMPTarget tuning.
+ */
+inline Strategy getStrategy(size_t tune_idx)
+{
+  return static_cast<Strategy>(tune_idx);
+}
+
+/*!
+ * \brief Return the strategies of the tunings after the default tuning.
+ */
+inline std::vector<Strategy> getMappedStrategies()
+{
+  return {Strategy::EnterData, Strategy::MapToFrom, Strategy::NoWait};
+}
+
+/*!
+ * \brief Return name of tuning using the given strategy, ie. enter_data.
+ */
+inline std::string getTuningName(Strategy strategy)
+{
+  switch (strategy) {
+    case Strategy::DevicePtr: return "default";
+    case Strategy::EnterData: return "enter_data";
+    case Strategy::MapToFrom: return "map_tofrom";
+    case Strategy::NoWait:    return "nowait";
+  }
+  return "unknown";
+}
+
+}  // closing brace for omp_target_map namespace
+
 }  // closing brace for rajaperf namespace
 
 #endif // RAJA_ENABLE_TARGET_OPENMP
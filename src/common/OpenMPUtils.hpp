@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods and classes for OpenMP schedule tunings of OpenMP variants.
+///
+/// Schedule tunings run their loops with schedule(runtime), or with
+/// omp_parallel_for_runtime_exec in RAJA variants, after setting the
+/// schedule kind and chunk size of the tuning with omp_set_schedule.
+///
+/// Thread count tunings, given with '--omp-threads', run with the number
+/// of threads of the tuning set with omp_set_num_threads.
+///
+
+#ifndef RAJAPerf_OpenMPUtils_HPP
+#define RAJAPerf_OpenMPUtils_HPP
+
+#include "rajaperf_config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+#include "RAJA/RAJA.hpp"
+
+#include <omp.h>
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+//
+// RAJA policy for a parallel loop with the schedule set by omp_set_schedule.
+//
+using omp_parallel_for_runtime_exec =
+    RAJA::omp_parallel_exec<RAJA::omp_for_runtime_exec>;
+
+namespace omp_schedule
+{
+
+/*!
+ * \brief OpenMP schedule kind and chunk size, where a chunk size of 0 uses
+ *        the default chunk size of the kind.
+ */
+struct Schedule
+{
+  omp_sched_t kind;
+  int chunk_size;
+};
+
+namespace detail
+{
+
+template < size_t... chunk_sizes >
+inline std::vector<int> to_vector(camp::int_seq<size_t, chunk_sizes...> const&)
+{
+  return std::vector<int>{static_cast<int>(chunk_sizes)...};
+}
+
+} // closing brace for detail namespace
+
+/*!
+ * \brief Return schedules of OpenMP schedule tunings.
+ *
+ * These are the static, dynamic, and guided kinds with each of the chunk
+ * sizes in rajaperf::configuration::omp_chunk_sizes, or with the default
+ * chunk size if that is empty.
+ */
+inline std::vector<Schedule> getSchedules()
+{
+  std::vector<int> chunk_sizes =
+      detail::to_vector(rajaperf::configuration::omp_chunk_sizes{});
+  if (chunk_sizes.empty()) {
+    chunk_sizes.emplace_back(0);
+  }
+
+  std::vector<Schedule> schedules;
+  for (omp_sched_t kind : {omp_sched_static, omp_sched_dynamic, omp_sched_guided}) {
+    for (int chunk_size : chunk_sizes) {
+      schedules.emplace_back(Schedule{kind, chunk_size});
+    }
+  }
+  return schedules;
+}
+
+/*!
+ * \brief Return name of tuning using schedule, ie. dynamic_64 or guided
+ *        when using the default chunk size.
+ */
+inline std::string getScheduleTuningName(Schedule const& schedule)
+{
+  std::string name;
+  switch ( schedule.kind ) {
+    case omp_sched_static : name = "static"; break;
+    case omp_sched_dynamic : name = "dynamic"; break;
+    case omp_sched_guided : name = "guided"; break;
+    default : name = "runtime"; break;
+  }
+  if (schedule.chunk_size > 0) {
+    name += "_" + std::to_string(schedule.chunk_size);
+  }
+  return name;
+}
+
+/*!
+ * \brief Set the OpenMP runtime schedule for the lifetime of this object
+ *        and restore the previous runtime schedule after.
+ */
+class ScopedSchedule
+{
+public:
+  explicit ScopedSchedule(Schedule const& schedule)
+  {
+    omp_get_schedule(&m_old_kind, &m_old_chunk_size);
+    omp_set_schedule(schedule.kind, schedule.chunk_size);
+  }
+
+  ~ScopedSchedule()
+  {
+    omp_set_schedule(m_old_kind, m_old_chunk_size);
+  }
+
+  ScopedSchedule(ScopedSchedule const&) = delete;
+  ScopedSchedule& operator=(ScopedSchedule const&) = delete;
+
+private:
+  omp_sched_t m_old_kind;
+  int m_old_chunk_size;
+};
+
+} // closing brace for omp_schedule namespace
+
+/*!
+ * \brief Set the number of OpenMP threads for the lifetime of this object
+ *        and restore the previous number after, 0 keeps the number.
+ */
+class ScopedNumThreads
+{
+public:
+  explicit ScopedNumThreads(int num_threads)
+    : m_old_num_threads(omp_get_max_threads())
+  {
+    if (num_threads > 0) {
+      omp_set_num_threads(num_threads);
+    }
+  }
+
+  ~ScopedNumThreads()
+  {
+    omp_set_num_threads(m_old_num_threads);
+  }
+
+  ScopedNumThreads(ScopedNumThreads const&) = delete;
+  ScopedNumThreads& operator=(ScopedNumThreads const&) = delete;
+
+private:
+  int m_old_num_threads;
+};
+
+} // closing brace for rajaperf namespace
+
+#endif
+
+#endif  // closing endif for header file include guard
@@ -149,4 +149,31 @@ std::string recursiveMkdir(const std::string& in_path)
   return outpath;
 }
 
+/*
+ * Quote and escape given string for JSON output.
+ */
+std::string jsonString(const std::string& str)
+{
+  std::ostringstream out;
+  out << '"';
+  for (char c : str) {
+    switch (c) {
+      case '"'  : out << "\\\""; break;
+      case '\\' : out << "\\\\"; break;
+      case '\n' : out << "\\n"; break;
+      case '\t' : out << "\\t"; break;
+      default : {
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+              << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+          out << c;
+        }
+      }
+    }
+  }
+  out << '"';
+  return out.str();
+}
+
 }  // closing brace for rajaperf namespace
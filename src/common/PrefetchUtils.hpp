@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for software prefetch tunings of CPU variants of kernels that
+/// stream more arrays than hardware prefetchers may track.
+///
+/// Prefetch tunings run their loops in blocks of one cache line of
+/// elements and prefetch the line of each array a fixed distance of
+/// elements ahead of the block. Split tunings, defined by each kernel,
+/// run the loop body as several loops that each stream fewer arrays.
+///
+
+#ifndef RAJAPerf_PrefetchUtils_HPP
+#define RAJAPerf_PrefetchUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Prefetch the cache line holding *addr to be read.
+ *
+ * This does nothing with compilers without __builtin_prefetch.
+ */
+template < typename T >
+RAJA_INLINE void prefetchRead(const T* addr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(addr, 0, 3);
+#else
+  RAJA_UNUSED_VAR(addr);
+#endif
+}
+
+/*!
+ * \brief Prefetch the cache line holding *addr to be written.
+ *
+ * This does nothing with compilers without __builtin_prefetch.
+ */
+template < typename T >
+RAJA_INLINE void prefetchWrite(T* addr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(addr, 1, 3);
+#else
+  RAJA_UNUSED_VAR(addr);
+#endif
+}
+
+namespace prefetch
+{
+
+//
+// Number of Real_type elements in a 64 byte cache line, the block length
+// of the loops of prefetch tunings.
+//
+constexpr Index_type line_length = 64 / sizeof(Real_type);
+
+namespace detail
+{
+
+template < size_t... distances >
+inline std::vector<Index_type> to_vector(camp::int_seq<size_t, distances...> const&)
+{
+  return std::vector<Index_type>{static_cast<Index_type>(distances)...};
+}
+
+} // closing brace for detail namespace
+
+/*!
+ * \brief Return distances in elements of prefetch tunings.
+ *
+ * These are the distances in rajaperf::configuration::prefetch_distances,
+ * or 16, 64, 256, and 1024 elements if that is empty.
+ */
+inline std::vector<Index_type> getDistances()
+{
+  std::vector<Index_type> distances =
+      detail::to_vector(rajaperf::configuration::prefetch_distances{});
+  if (distances.empty()) {
+    distances = {16, 64, 256, 1024};
+  }
+  return distances;
+}
+
+/*!
+ * \brief Return name of tuning prefetching distance elements ahead,
+ *        ie. prefetch_256.
+ */
+inline std::string getPrefetchTuningName(Index_type distance)
+{
+  return "prefetch_" + std::to_string(distance);
+}
+
+/*!
+ * \brief Return name of tunings splitting the loop body into several
+ *        loops over fewer arrays.
+ */
+inline std::string getSplitTuningName()
+{
+  return "split";
+}
+
+} // closing brace for prefetch namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
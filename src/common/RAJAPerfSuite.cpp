@@ -18,23 +18,38 @@
 // Basic kernels...
 //
 #include "basic/ARRAY_OF_PTRS.hpp"
+#include "basic/ATOMIC_CONTENTION.hpp"
+#include "basic/BATCHED_GEMM.hpp"
+#include "basic/BATCHED_LU.hpp"
+#include "basic/BITSET.hpp"
 #include "basic/COPY8.hpp"
+#include "basic/COPYN.hpp"
 #include "basic/DAXPY.hpp"
 #include "basic/DAXPY_ATOMIC.hpp"
+#include "basic/FMA_PEAK.hpp"
+#include "basic/GATHER.hpp"
+#include "basic/HASH_MIX.hpp"
 #include "basic/IF_QUAD.hpp"
 #include "basic/INDEXLIST.hpp"
 #include "basic/INDEXLIST_3LOOP.hpp"
 #include "basic/INIT3.hpp"
 #include "basic/INIT_VIEW1D.hpp"
 #include "basic/INIT_VIEW1D_OFFSET.hpp"
+#include "basic/LOAD_IMBALANCE.hpp"
 #include "basic/MAT_MAT_SHARED.hpp"
+#include "basic/MORTON.hpp"
 #include "basic/MULADDSUB.hpp"
 #include "basic/NESTED_INIT.hpp"
 #include "basic/PI_ATOMIC.hpp"
 #include "basic/PI_REDUCE.hpp"
+#include "basic/POINTER_CHASE.hpp"
 #include "basic/REDUCE3_INT.hpp"
 #include "basic/REDUCE_STRUCT.hpp"
+#include "basic/RNG.hpp"
+#include "basic/SCATTER.hpp"
+#include "basic/TEMP_ALLOC.hpp"
 #include "basic/TRAP_INT.hpp"
+#include "basic/VIEW_OVERHEAD.hpp"
 
 //
 // Lcals kernels...
@@ -47,7 +62,12 @@
 #include "lcals/GEN_LIN_RECUR.hpp"
 #include "lcals/HYDRO_1D.hpp"
 #include "lcals/HYDRO_2D.hpp"
+#include "lcals/IMPLICIT_COND.hpp"
+#include "lcals/IMPLICIT_HYDRO_2D.hpp"
 #include "lcals/INT_PREDICT.hpp"
+#include "lcals/MONTE_CARLO_SEARCH.hpp"
+#include "lcals/PIC_1D.hpp"
+#include "lcals/PIC_2D.hpp"
 #include "lcals/PLANCKIAN.hpp"
 #include "lcals/TRIDIAG_ELIM.hpp"
 
@@ -58,15 +78,23 @@
 #include "polybench/POLYBENCH_3MM.hpp"
 #include "polybench/POLYBENCH_ADI.hpp"
 #include "polybench/POLYBENCH_ATAX.hpp"
+#include "polybench/POLYBENCH_CHOLESKY.hpp"
+#include "polybench/POLYBENCH_COVARIANCE.hpp"
 #include "polybench/POLYBENCH_FDTD_2D.hpp"
 #include "polybench/POLYBENCH_FLOYD_WARSHALL.hpp"
+#include "polybench/POLYBENCH_FLOYD_WARSHALL_INPLACE.hpp"
 #include "polybench/POLYBENCH_GEMM.hpp"
 #include "polybench/POLYBENCH_GEMVER.hpp"
 #include "polybench/POLYBENCH_GESUMMV.hpp"
 #include "polybench/POLYBENCH_HEAT_3D.hpp"
 #include "polybench/POLYBENCH_JACOBI_1D.hpp"
 #include "polybench/POLYBENCH_JACOBI_2D.hpp"
+#include "polybench/POLYBENCH_LU.hpp"
 #include "polybench/POLYBENCH_MVT.hpp"
+#include "polybench/POLYBENCH_SEIDEL_2D.hpp"
+#include "polybench/POLYBENCH_SYMM.hpp"
+#include "polybench/POLYBENCH_SYRK.hpp"
+#include "polybench/POLYBENCH_TRMM.hpp"
 
 //
 // Stream kernels...
@@ -76,26 +104,40 @@
 #include "stream/ADD.hpp"
 #include "stream/TRIAD.hpp"
 #include "stream/DOT.hpp"
+#include "stream/CACHE_BW.hpp"
 
 //
 // Apps kernels...
 //
 #include "apps/CONVECTION3DPA.hpp"
+#include "apps/COUPLE.hpp"
 #include "apps/DEL_DOT_VEC_2D.hpp"
 #include "apps/DIFFUSION3DPA.hpp"
 #include "apps/EDGE3D.hpp"
 #include "apps/ENERGY.hpp"
 #include "apps/FIR.hpp"
+#include "apps/FUSED_PIPELINE.hpp"
 #include "apps/HALOEXCHANGE.hpp"
 #include "apps/HALOEXCHANGE_FUSED.hpp"
 #include "apps/LTIMES.hpp"
 #include "apps/LTIMES_NOVIEW.hpp"
 #include "apps/MASS3DEA.hpp"
 #include "apps/MASS3DPA.hpp"
+#include "apps/MASS3D_APPLY.hpp"
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+#include "apps/MPI_HALOEXCHANGE.hpp"
+#endif
 #include "apps/NODAL_ACCUMULATION_3D.hpp"
+#include "apps/PIC_PUSH_DEPOSIT.hpp"
 #include "apps/PRESSURE.hpp"
+#include "apps/STENCIL_27PT.hpp"
 #include "apps/VOL3D.hpp"
+#include "apps/XS_LOOKUP.hpp"
+#include "apps/LBM_D3Q19.hpp"
+#include "apps/MG_VCYCLE.hpp"
+#include "apps/MC_TRANSPORT.hpp"
 #include "apps/ZONAL_ACCUMULATION_3D.hpp"
+#include "apps/AMR_PATCHES.hpp"
 
 //
 // Algorithm kernels...
@@ -106,9 +148,55 @@
 #include "algorithm/REDUCE_SUM.hpp"
 #include "algorithm/MEMSET.hpp"
 #include "algorithm/MEMCPY.hpp"
+#include "algorithm/HISTOGRAM.hpp"
+#include "algorithm/SEGMENTED_SCAN.hpp"
+#include "algorithm/SEGMENTED_REDUCE.hpp"
+#include "algorithm/FFT_1D.hpp"
+#include "algorithm/FFT_3D.hpp"
+#include "algorithm/TRIDIAG_SOLVE.hpp"
+#include "algorithm/LINEAR_RECUR.hpp"
+#include "algorithm/TRANSFER.hpp"
+#include "algorithm/MEMCPY_2D.hpp"
+#include "algorithm/MEMCPY_3D.hpp"
+#include "algorithm/HASH_TABLE.hpp"
+#include "algorithm/TRANSPOSE.hpp"
+#include "algorithm/SELECT.hpp"
+
+//
+// Sparse kernels...
+//
+#include "sparse/SPMV.hpp"
+#include "sparse/CG.hpp"
+#include "sparse/SPTRSV.hpp"
+
+//
+// Overhead kernels...
+//
+#include "overhead/EMPTY.hpp"
+#include "overhead/TRIVIAL.hpp"
+#include "overhead/DEPENDENCY.hpp"
+
+//
+// Comm kernels...
+//
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+#include "comm/ALLREDUCE.hpp"
+#include "comm/DOT_ALLREDUCE.hpp"
+#include "comm/NEIGHBOR_ALLTOALLV.hpp"
+#endif
 
 
 #include <iostream>
+#include <deque>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <dlfcn.h>
+#endif
 
 namespace rajaperf
 {
@@ -133,6 +221,9 @@ static const std::string GroupNames [] =
   std::string("Stream"),
   std::string("Apps"),
   std::string("Algorithm"),
+  std::string("Sparse"),
+  std::string("Overhead"),
+  std::string("Comm"),
 
   std::string("Unknown Group")  // Keep this at the end and DO NOT remove....
 
@@ -158,23 +249,38 @@ static const std::string KernelNames [] =
 // Basic kernels...
 //
   std::string("Basic_ARRAY_OF_PTRS"),
+  std::string("Basic_ATOMIC_CONTENTION"),
+  std::string("Basic_BATCHED_GEMM"),
+  std::string("Basic_BATCHED_LU"),
+  std::string("Basic_BITSET"),
   std::string("Basic_COPY8"),
+  std::string("Basic_COPYN"),
   std::string("Basic_DAXPY"),
   std::string("Basic_DAXPY_ATOMIC"),
+  std::string("Basic_FMA_PEAK"),
+  std::string("Basic_GATHER"),
+  std::string("Basic_HASH_MIX"),
   std::string("Basic_IF_QUAD"),
   std::string("Basic_INDEXLIST"),
   std::string("Basic_INDEXLIST_3LOOP"),
   std::string("Basic_INIT3"),
   std::string("Basic_INIT_VIEW1D"),
   std::string("Basic_INIT_VIEW1D_OFFSET"),
+  std::string("Basic_LOAD_IMBALANCE"),
   std::string("Basic_MAT_MAT_SHARED"),
+  std::string("Basic_MORTON"),
   std::string("Basic_MULADDSUB"),
   std::string("Basic_NESTED_INIT"),
   std::string("Basic_PI_ATOMIC"),
   std::string("Basic_PI_REDUCE"),
+  std::string("Basic_POINTER_CHASE"),
   std::string("Basic_REDUCE3_INT"),
   std::string("Basic_REDUCE_STRUCT"),
+  std::string("Basic_RNG"),
+  std::string("Basic_SCATTER"),
+  std::string("Basic_TEMP_ALLOC"),
   std::string("Basic_TRAP_INT"),
+  std::string("Basic_VIEW_OVERHEAD"),
 
 //
 // Lcals kernels...
@@ -187,7 +293,12 @@ static const std::string KernelNames [] =
   std::string("Lcals_GEN_LIN_RECUR"),
   std::string("Lcals_HYDRO_1D"),
   std::string("Lcals_HYDRO_2D"),
+  std::string("Lcals_IMPLICIT_COND"),
+  std::string("Lcals_IMPLICIT_HYDRO_2D"),
   std::string("Lcals_INT_PREDICT"),
+  std::string("Lcals_MONTE_CARLO_SEARCH"),
+  std::string("Lcals_PIC_1D"),
+  std::string("Lcals_PIC_2D"),
   std::string("Lcals_PLANCKIAN"),
   std::string("Lcals_TRIDIAG_ELIM"),
 
@@ -198,20 +309,29 @@ static const std::string KernelNames [] =
   std::string("Polybench_3MM"),
   std::string("Polybench_ADI"),
   std::string("Polybench_ATAX"),
+  std::string("Polybench_CHOLESKY"),
+  std::string("Polybench_COVARIANCE"),
   std::string("Polybench_FDTD_2D"),
   std::string("Polybench_FLOYD_WARSHALL"),
+  std::string("Polybench_FLOYD_WARSHALL_INPLACE"),
   std::string("Polybench_GEMM"),
   std::string("Polybench_GEMVER"),
   std::string("Polybench_GESUMMV"),
   std::string("Polybench_HEAT_3D"),
   std::string("Polybench_JACOBI_1D"),
   std::string("Polybench_JACOBI_2D"),
+  std::string("Polybench_LU"),
   std::string("Polybench_MVT"),
+  std::string("Polybench_SEIDEL_2D"),
+  std::string("Polybench_SYMM"),
+  std::string("Polybench_SYRK"),
+  std::string("Polybench_TRMM"),
 
 //
 // Stream kernels...
 //
   std::string("Stream_ADD"),
+  std::string("Stream_CACHE_BW"),
   std::string("Stream_COPY"),
   std::string("Stream_DOT"),
   std::string("Stream_MUL"),
@@ -221,21 +341,34 @@ static const std::string KernelNames [] =
 // Apps kernels...
 //
   std::string("Apps_CONVECTION3DPA"),
+  std::string("Apps_COUPLE"),
   std::string("Apps_DEL_DOT_VEC_2D"),
   std::string("Apps_DIFFUSION3DPA"),
   std::string("Apps_EDGE3D"),
   std::string("Apps_ENERGY"),
   std::string("Apps_FIR"),
+  std::string("Apps_FUSED_PIPELINE"),
   std::string("Apps_HALOEXCHANGE"),
   std::string("Apps_HALOEXCHANGE_FUSED"),
   std::string("Apps_LTIMES"),
   std::string("Apps_LTIMES_NOVIEW"),
   std::string("Apps_MASS3DEA"),
   std::string("Apps_MASS3DPA"),
+  std::string("Apps_MASS3D_APPLY"),
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  std::string("Apps_MPI_HALOEXCHANGE"),
+#endif
   std::string("Apps_NODAL_ACCUMULATION_3D"),
+  std::string("Apps_PIC_PUSH_DEPOSIT"),
   std::string("Apps_PRESSURE"),
+  std::string("Apps_STENCIL_27PT"),
   std::string("Apps_VOL3D"),
+  std::string("Apps_XS_LOOKUP"),
+  std::string("Apps_LBM_D3Q19"),
+  std::string("Apps_MG_VCYCLE"),
+  std::string("Apps_MC_TRANSPORT"),
   std::string("Apps_ZONAL_ACCUMULATION_3D"),
+  std::string("Apps_AMR_PATCHES"),
 
 //
 // Algorithm kernels...
@@ -246,6 +379,42 @@ static const std::string KernelNames [] =
   std::string("Algorithm_REDUCE_SUM"),
   std::string("Algorithm_MEMSET"),
   std::string("Algorithm_MEMCPY"),
+  std::string("Algorithm_HISTOGRAM"),
+  std::string("Algorithm_SEGMENTED_SCAN"),
+  std::string("Algorithm_SEGMENTED_REDUCE"),
+  std::string("Algorithm_FFT_1D"),
+  std::string("Algorithm_FFT_3D"),
+  std::string("Algorithm_TRIDIAG_SOLVE"),
+  std::string("Algorithm_LINEAR_RECUR"),
+  std::string("Algorithm_TRANSFER"),
+  std::string("Algorithm_MEMCPY_2D"),
+  std::string("Algorithm_MEMCPY_3D"),
+  std::string("Algorithm_HASH_TABLE"),
+  std::string("Algorithm_TRANSPOSE"),
+  std::string("Algorithm_SELECT"),
+
+//
+// Sparse kernels...
+//
+  std::string("Sparse_SPMV"),
+  std::string("Sparse_CG"),
+  std::string("Sparse_SPTRSV"),
+
+//
+// Overhead kernels...
+//
+  std::string("Overhead_EMPTY"),
+  std::string("Overhead_TRIVIAL"),
+  std::string("Overhead_DEPENDENCY"),
+
+//
+// Comm kernels...
+//
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  std::string("Comm_ALLREDUCE"),
+  std::string("Comm_DOT_ALLREDUCE"),
+  std::string("Comm_NEIGHBOR_ALLTOALLV"),
+#endif
 
   std::string("Unknown Kernel")  // Keep this at the end and DO NOT remove....
 
@@ -286,6 +455,9 @@ static const std::string VariantNames [] =
   std::string("Lambda_HIP"),
   std::string("RAJA_HIP"),
 
+  std::string("Base_SYCL"),
+  std::string("RAJA_SYCL"),
+
   std::string("Kokkos_Lambda"),
 
   std::string("Unknown Variant")  // Keep this at the end and DO NOT remove....
@@ -326,6 +498,35 @@ static const std::string FeatureNames [] =
 }; // END FeatureNames
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each performance characteristic (access PATTERN)
+ *        of kernels in suite.
+ *
+ * IMPORTANT: This is only modified when a new pattern is used in suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE PatternID enum IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string PatternNames [] =
+{
+
+  std::string("Streaming"),
+  std::string("Stencil"),
+  std::string("GatherScatter"),
+
+  std::string("ReductionBound"),
+  std::string("LatencyBound"),
+  std::string("ComputeBound"),
+
+  std::string("Unknown Pattern")  // Keep this at the end and DO NOT remove....
+
+}; // END PatternNames
+
+
 /*!
  *******************************************************************************
  *
@@ -345,10 +546,13 @@ static const std::string DataSpaceNames [] =
   std::string("Omp"),
 
   std::string("OmpTarget"),
+  std::string("OmpTargetSystem"),
 
   std::string("CudaPinned"),
   std::string("CudaManaged"),
   std::string("CudaDevice"),
+  std::string("CudaDeviceAsync"),
+  std::string("CudaSystem"),
 
   std::string("HipHostAdviseFine"),
   std::string("HipHostAdviseCoarse"),
@@ -360,12 +564,205 @@ static const std::string DataSpaceNames [] =
   std::string("HipManagedAdviseCoarse"),
   std::string("HipDevice"),
   std::string("HipDeviceFine"),
+  std::string("HipDeviceAsync"),
+  std::string("HipSystem"),
+
+  std::string("SyclPinned"),
+  std::string("SyclManaged"),
+  std::string("SyclDevice"),
 
   std::string("Unknown Memory")  // Keep this at the end and DO NOT remove....
 
 }; // END VariantNames
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each data type used in suite.
+ *
+ * IMPORTANT: This is only modified when a new data type is added to the suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE DataType enum IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string DataTypeNames [] =
+{
+  std::string("int32"),
+  std::string("int64"),
+
+  std::string("float"),
+  std::string("double"),
+
+  std::string("Unknown Data Type")  // Keep this at the end and DO NOT remove....
+
+}; // END DataTypeNames
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each NUMA policy used in suite.
+ *
+ * IMPORTANT: This is only modified when a new NUMA policy is added to the suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE NumaPolicy enum IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string NumaPolicyNames [] =
+{
+  std::string("FirstTouch"),
+  std::string("Interleave"),
+  std::string("Membind"),
+
+  std::string("Unknown NUMA Policy")  // Keep this at the end and DO NOT remove....
+
+}; // END NumaPolicyNames
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each host page policy used in suite.
+ *
+ * IMPORTANT: This is only modified when a new page policy is added to the suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE HostPagePolicy enum IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string HostPagePolicyNames [] =
+{
+  std::string("Default"),
+  std::string("THP"),
+  std::string("Huge2MB"),
+  std::string("Huge1GB"),
+
+  std::string("Unknown Host Page Policy")  // Keep this at the end and DO NOT remove....
+
+}; // END HostPagePolicyNames
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each managed policy used in suite.
+ *
+ * IMPORTANT: This is only modified when a new managed policy is added to the suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE ManagedPolicy enum IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string ManagedPolicyNames [] =
+{
+  std::string("None"),
+  std::string("Prefetch"),
+  std::string("PreferredLocation"),
+  std::string("ReadMostly"),
+
+  std::string("Unknown Managed Policy")  // Keep this at the end and DO NOT remove....
+
+}; // END ManagedPolicyNames
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Out-of-tree kernel registered with registerKernel.
+ *
+ * Registered kernels and their groups are kept in deques, which keep
+ * references to their names valid as more are registered. Registration
+ * may happen during static initialization, so the lists are function
+ * local statics and group ids are assigned when names are first looked up.
+ *
+ *******************************************************************************
+ */
+struct RegisteredKernel
+{
+  std::string group_name;
+  std::string full_name;
+  KernelFactory factory;
+};
+
+static std::deque<RegisteredKernel>& getRegisteredKernels()
+{
+  static std::deque<RegisteredKernel> registered_kernels;
+  return registered_kernels;
+}
+
+static std::deque<std::string>& getRegisteredGroupNames()
+{
+  static std::deque<std::string> registered_group_names;
+
+  for (const RegisteredKernel& rk : getRegisteredKernels()) {
+    bool found = false;
+    for (size_t ig = 0; ig < NumGroups && !found; ++ig) {
+      found = (GroupNames[ig] == rk.group_name);
+    }
+    for (size_t ig = 0; ig < registered_group_names.size() && !found; ++ig) {
+      found = (registered_group_names[ig] == rk.group_name);
+    }
+    if ( !found ) {
+      registered_group_names.emplace_back(rk.group_name);
+    }
+  }
+
+  return registered_group_names;
+}
+
+KernelID registerKernel(const std::string& group_name,
+                        const std::string& kernel_name,
+                        KernelFactory factory)
+{
+  std::deque<RegisteredKernel>& registered_kernels = getRegisteredKernels();
+
+  const std::string full_name = group_name + "_" + kernel_name;
+  for (size_t ik = 0; ik < registered_kernels.size(); ++ik) {
+    if ( registered_kernels[ik].full_name == full_name ) {
+      return static_cast<KernelID>(NumKernels + ik);
+    }
+  }
+
+  registered_kernels.emplace_back(
+      RegisteredKernel{group_name, full_name, factory});
+  return static_cast<KernelID>(NumKernels + registered_kernels.size() - 1);
+}
+
+size_t getNumKernels()
+{
+  return NumKernels + getRegisteredKernels().size();
+}
+
+size_t getNumGroups()
+{
+  return NumGroups + getRegisteredGroupNames().size();
+}
+
+bool loadKernelLibrary(const std::string& lib_name, std::string& error)
+{
+#if defined(__unix__) || defined(__APPLE__)
+  // the library is never closed, its kernels are used until exit
+  void* handle = dlopen(lib_name.c_str(), RTLD_NOW | RTLD_GLOBAL);
+  if ( !handle ) {
+    const char* dl_error = dlerror();
+    error = dl_error ? dl_error : "unknown dlopen error";
+    return false;
+  }
+  return true;
+#else
+  error = "loading kernel libraries is not supported on this platform";
+  return false;
+#endif
+}
+
+
 /*
  *******************************************************************************
  *
@@ -375,6 +772,9 @@ static const std::string DataSpaceNames [] =
  */
 const std::string& getGroupName(GroupID gid)
 {
+  if ( gid >= NumGroups ) {
+    return getRegisteredGroupNames().at(gid - NumGroups);
+  }
   return GroupNames[gid];
 }
 
@@ -388,8 +788,9 @@ const std::string& getGroupName(GroupID gid)
  */
 std::string getKernelName(KernelID kid)
 {
-  std::string::size_type pos = KernelNames[kid].find("_");
-  std::string kname(KernelNames[kid].substr(pos+1, std::string::npos));
+  const std::string& full_name = getFullKernelName(kid);
+  std::string::size_type pos = full_name.find("_");
+  std::string kname(full_name.substr(pos+1, std::string::npos));
   return kname;
 }
 
@@ -403,6 +804,9 @@ std::string getKernelName(KernelID kid)
  */
 const std::string& getFullKernelName(KernelID kid)
 {
+  if ( kid >= NumKernels ) {
+    return getRegisteredKernels().at(kid - NumKernels).full_name;
+  }
   return KernelNames[kid];
 }
 
@@ -472,6 +876,13 @@ bool isVariantAvailable(VariantID vid)
   }
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  if ( vid == Base_SYCL ||
+       vid == RAJA_SYCL ) {
+    ret_val = true;
+  }
+#endif
+
 #if defined(RUN_KOKKOS)
   if ( vid == Kokkos_Lambda ) {
     ret_val = true;
@@ -533,6 +944,13 @@ bool isVariantGPU(VariantID vid)
   }
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  if ( vid == Base_SYCL ||
+       vid == RAJA_SYCL ) {
+    ret_val = true;
+  }
+#endif
+
 #if defined(RUN_KOKKOS)
   if ( vid == Kokkos_Lambda ) {
     ret_val = true;
@@ -554,6 +972,18 @@ const std::string& getFeatureName(FeatureID fid)
   return FeatureNames[fid];
 }
 
+/*
+ *******************************************************************************
+ *
+ * Return pattern name associated with PatternID enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getPatternName(PatternID pid)
+{
+  return PatternNames[pid];
+}
+
 
 /*
  *******************************************************************************
@@ -592,10 +1022,17 @@ bool isDataSpaceAvailable(DataSpace dataSpace)
       ret_val = true; break;
 #endif
 
+#if defined(RAJA_ENABLE_TARGET_OPENMP) && defined(RAJA_PERFSUITE_ENABLE_OMPTARGET_USM)
+    case DataSpace::OmpTargetSystem:
+      ret_val = true; break;
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
     case DataSpace::CudaPinned:
     case DataSpace::CudaManaged:
     case DataSpace::CudaDevice:
+    case DataSpace::CudaDeviceAsync:
+    case DataSpace::CudaSystem:
       ret_val = true; break;
 #endif
 
@@ -614,6 +1051,174 @@ bool isDataSpaceAvailable(DataSpace dataSpace)
 #endif
     case DataSpace::HipDevice:
     case DataSpace::HipDeviceFine:
+    case DataSpace::HipDeviceAsync:
+    case DataSpace::HipSystem:
+      ret_val = true; break;
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+    case DataSpace::SyclPinned:
+    case DataSpace::SyclManaged:
+    case DataSpace::SyclDevice:
+      ret_val = true; break;
+#endif
+
+    default:
+      ret_val = false; break;
+  }
+
+  return ret_val;
+}
+
+/*
+ *******************************************************************************
+ *
+ * Return data type name associated with DataType enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getDataTypeName(DataType dt)
+{
+  return DataTypeNames[static_cast<int>(dt)];
+}
+
+/*
+ *******************************************************************************
+ *
+ * Return size in bytes of an element of the DataType enum value.
+ *
+ *******************************************************************************
+ */
+size_t getDataTypeSize(DataType dt)
+{
+  switch (dt) {
+    case DataType::Int32: return sizeof(Int32_type);
+    case DataType::Int64: return sizeof(Int64_type);
+    case DataType::Float: return sizeof(Float_type);
+    case DataType::Double: return sizeof(Double_type);
+    default: return 0;
+  }
+}
+
+/*
+ *******************************************************************************
+ *
+ * Return NUMA policy name associated with NumaPolicy enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getNumaPolicyName(NumaPolicy np)
+{
+  return NumaPolicyNames[static_cast<int>(np)];
+}
+
+/*!
+ *******************************************************************************
+ *
+ * Return true if the NUMA policy associated with NumaPolicy enum value is
+ * available.
+ *
+ *******************************************************************************
+ */
+bool isNumaPolicyAvailable(NumaPolicy np)
+{
+  bool ret_val = false;
+
+  switch (np) {
+    case NumaPolicy::FirstTouch:
+      ret_val = true; break;
+
+#if defined(__linux__) && defined(SYS_mbind)
+    case NumaPolicy::Interleave:
+    case NumaPolicy::Membind:
+      ret_val = true; break;
+#endif
+
+    default:
+      ret_val = false; break;
+  }
+
+  return ret_val;
+}
+
+/*
+ *******************************************************************************
+ *
+ * Return host page policy name associated with HostPagePolicy enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getHostPagePolicyName(HostPagePolicy hp)
+{
+  return HostPagePolicyNames[static_cast<int>(hp)];
+}
+
+/*!
+ *******************************************************************************
+ *
+ * Return true if the host page policy associated with HostPagePolicy enum
+ * value is available.
+ *
+ *******************************************************************************
+ */
+bool isHostPagePolicyAvailable(HostPagePolicy hp)
+{
+  bool ret_val = false;
+
+  switch (hp) {
+    case HostPagePolicy::Default:
+      ret_val = true; break;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    case HostPagePolicy::THP:
+      ret_val = true; break;
+#endif
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    case HostPagePolicy::Huge2MB:
+    case HostPagePolicy::Huge1GB:
+      ret_val = true; break;
+#endif
+
+    default:
+      ret_val = false; break;
+  }
+
+  return ret_val;
+}
+
+/*
+ *******************************************************************************
+ *
+ * Return managed policy name associated with ManagedPolicy enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getManagedPolicyName(ManagedPolicy mp)
+{
+  return ManagedPolicyNames[static_cast<int>(mp)];
+}
+
+/*!
+ *******************************************************************************
+ *
+ * Return true if the managed policy associated with ManagedPolicy enum
+ * value is available.
+ *
+ *******************************************************************************
+ */
+bool isManagedPolicyAvailable(ManagedPolicy mp)
+{
+  bool ret_val = false;
+
+  switch (mp) {
+    case ManagedPolicy::None:
+      ret_val = true; break;
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+    case ManagedPolicy::Prefetch:
+    case ManagedPolicy::PreferredLocation:
+    case ManagedPolicy::ReadMostly:
       ret_val = true; break;
 #endif
 
@@ -646,10 +1251,30 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::ARRAY_OF_PTRS(run_params);
        break;
     }
+    case Basic_ATOMIC_CONTENTION : {
+       kernel = new basic::ATOMIC_CONTENTION(run_params);
+       break;
+    }
+    case Basic_BATCHED_GEMM : {
+       kernel = new basic::BATCHED_GEMM(run_params);
+       break;
+    }
+    case Basic_BATCHED_LU : {
+       kernel = new basic::BATCHED_LU(run_params);
+       break;
+    }
+    case Basic_BITSET : {
+       kernel = new basic::BITSET(run_params);
+       break;
+    }
     case Basic_COPY8 : {
        kernel = new basic::COPY8(run_params);
        break;
     }
+    case Basic_COPYN : {
+       kernel = new basic::COPYN(run_params);
+       break;
+    }
     case Basic_DAXPY : {
        kernel = new basic::DAXPY(run_params);
        break;
@@ -658,6 +1283,18 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::DAXPY_ATOMIC(run_params);
        break;
     }
+    case Basic_FMA_PEAK : {
+       kernel = new basic::FMA_PEAK(run_params);
+       break;
+    }
+    case Basic_GATHER : {
+       kernel = new basic::GATHER(run_params);
+       break;
+    }
+    case Basic_HASH_MIX : {
+       kernel = new basic::HASH_MIX(run_params);
+       break;
+    }
     case Basic_IF_QUAD : {
        kernel = new basic::IF_QUAD(run_params);
        break;
@@ -682,10 +1319,18 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::INIT_VIEW1D_OFFSET(run_params);
        break;
     }
+    case Basic_LOAD_IMBALANCE : {
+       kernel = new basic::LOAD_IMBALANCE(run_params);
+       break;
+    }
     case Basic_MAT_MAT_SHARED : {
        kernel = new basic::MAT_MAT_SHARED(run_params);
        break;
     }
+    case Basic_MORTON : {
+       kernel = new basic::MORTON(run_params);
+       break;
+    }
     case Basic_MULADDSUB : {
        kernel = new basic::MULADDSUB(run_params);
        break;
@@ -702,6 +1347,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::PI_REDUCE(run_params);
        break;
     }
+    case Basic_POINTER_CHASE : {
+       kernel = new basic::POINTER_CHASE(run_params);
+       break;
+    }
     case Basic_REDUCE3_INT : {
        kernel = new basic::REDUCE3_INT(run_params);
        break;
@@ -710,10 +1359,26 @@ KernelBase* getKernelObject(KernelID kid,
         kernel = new basic::REDUCE_STRUCT(run_params);
         break;
     } 	
+    case Basic_RNG : {
+       kernel = new basic::RNG(run_params);
+       break;
+    }
+    case Basic_SCATTER : {
+       kernel = new basic::SCATTER(run_params);
+       break;
+    }
+    case Basic_TEMP_ALLOC : {
+       kernel = new basic::TEMP_ALLOC(run_params);
+       break;
+    }
     case Basic_TRAP_INT : {
        kernel = new basic::TRAP_INT(run_params);
        break;
     }
+    case Basic_VIEW_OVERHEAD : {
+       kernel = new basic::VIEW_OVERHEAD(run_params);
+       break;
+    }
 
 //
 // Lcals kernels...
@@ -750,10 +1415,30 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new lcals::HYDRO_2D(run_params);
        break;
     }
+    case Lcals_IMPLICIT_COND : {
+       kernel = new lcals::IMPLICIT_COND(run_params);
+       break;
+    }
+    case Lcals_IMPLICIT_HYDRO_2D : {
+       kernel = new lcals::IMPLICIT_HYDRO_2D(run_params);
+       break;
+    }
     case Lcals_INT_PREDICT : {
        kernel = new lcals::INT_PREDICT(run_params);
        break;
     }
+    case Lcals_MONTE_CARLO_SEARCH : {
+       kernel = new lcals::MONTE_CARLO_SEARCH(run_params);
+       break;
+    }
+    case Lcals_PIC_1D : {
+       kernel = new lcals::PIC_1D(run_params);
+       break;
+    }
+    case Lcals_PIC_2D : {
+       kernel = new lcals::PIC_2D(run_params);
+       break;
+    }
     case Lcals_PLANCKIAN : {
        kernel = new lcals::PLANCKIAN(run_params);
        break;
@@ -782,6 +1467,14 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new polybench::POLYBENCH_ATAX(run_params);
        break;
     }
+    case Polybench_CHOLESKY : {
+       kernel = new polybench::POLYBENCH_CHOLESKY(run_params);
+       break;
+    }
+    case Polybench_COVARIANCE : {
+       kernel = new polybench::POLYBENCH_COVARIANCE(run_params);
+       break;
+    }
     case Polybench_FDTD_2D : {
        kernel = new polybench::POLYBENCH_FDTD_2D(run_params);
        break;
@@ -790,6 +1483,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new polybench::POLYBENCH_FLOYD_WARSHALL(run_params);
        break;
     }
+    case Polybench_FLOYD_WARSHALL_INPLACE : {
+       kernel = new polybench::POLYBENCH_FLOYD_WARSHALL_INPLACE(run_params);
+       break;
+    }
     case Polybench_GEMM : {
        kernel = new polybench::POLYBENCH_GEMM(run_params);
        break;
@@ -814,10 +1511,30 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new polybench::POLYBENCH_JACOBI_2D(run_params);
        break;
     }
+    case Polybench_LU : {
+       kernel = new polybench::POLYBENCH_LU(run_params);
+       break;
+    }
     case Polybench_MVT : {
        kernel = new polybench::POLYBENCH_MVT(run_params);
        break;
     }
+    case Polybench_SEIDEL_2D : {
+       kernel = new polybench::POLYBENCH_SEIDEL_2D(run_params);
+       break;
+    }
+    case Polybench_SYMM : {
+       kernel = new polybench::POLYBENCH_SYMM(run_params);
+       break;
+    }
+    case Polybench_SYRK : {
+       kernel = new polybench::POLYBENCH_SYRK(run_params);
+       break;
+    }
+    case Polybench_TRMM : {
+       kernel = new polybench::POLYBENCH_TRMM(run_params);
+       break;
+    }
 
 //
 // Stream kernels...
@@ -826,6 +1543,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new stream::ADD(run_params);
        break;
     }
+    case Stream_CACHE_BW : {
+       kernel = new stream::CACHE_BW(run_params);
+       break;
+    }
     case Stream_COPY : {
        kernel = new stream::COPY(run_params);
        break;
@@ -851,6 +1572,11 @@ KernelBase* getKernelObject(KernelID kid,
        break;
     }
 
+    case Apps_COUPLE : {
+       kernel = new apps::COUPLE(run_params);
+       break;
+    }
+
     case Apps_DEL_DOT_VEC_2D : {
        kernel = new apps::DEL_DOT_VEC_2D(run_params);
        break;
@@ -871,6 +1597,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::FIR(run_params);
        break;
     }
+    case Apps_FUSED_PIPELINE : {
+       kernel = new apps::FUSED_PIPELINE(run_params);
+       break;
+    }
     case Apps_HALOEXCHANGE : {
        kernel = new apps::HALOEXCHANGE(run_params);
        break;
@@ -895,22 +1625,60 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::MASS3DPA(run_params);
        break;
     }
+    case Apps_MASS3D_APPLY : {
+       kernel = new apps::MASS3D_APPLY(run_params);
+       break;
+    }
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    case Apps_MPI_HALOEXCHANGE : {
+       kernel = new apps::MPI_HALOEXCHANGE(run_params);
+       break;
+    }
+#endif
     case Apps_NODAL_ACCUMULATION_3D : {
        kernel = new apps::NODAL_ACCUMULATION_3D(run_params);
        break;
     }
+    case Apps_PIC_PUSH_DEPOSIT : {
+       kernel = new apps::PIC_PUSH_DEPOSIT(run_params);
+       break;
+    }
     case Apps_PRESSURE : {
        kernel = new apps::PRESSURE(run_params);
        break;
     }
+    case Apps_STENCIL_27PT : {
+       kernel = new apps::STENCIL_27PT(run_params);
+       break;
+    }
     case Apps_VOL3D : {
        kernel = new apps::VOL3D(run_params);
        break;
     }
+    case Apps_XS_LOOKUP : {
+       kernel = new apps::XS_LOOKUP(run_params);
+       break;
+    }
+    case Apps_LBM_D3Q19 : {
+       kernel = new apps::LBM_D3Q19(run_params);
+       break;
+    }
+    case Apps_MG_VCYCLE : {
+       kernel = new apps::MG_VCYCLE(run_params);
+       break;
+    }
+    case Apps_MC_TRANSPORT : {
+       kernel = new apps::MC_TRANSPORT(run_params);
+       break;
+    }
     case Apps_ZONAL_ACCUMULATION_3D : {
        kernel = new apps::ZONAL_ACCUMULATION_3D(run_params);
        break;
     }
+    case Apps_AMR_PATCHES : {
+       kernel = new apps::AMR_PATCHES(run_params);
+       break;
+    }
 
 //
 // Algorithm kernels...
@@ -939,9 +1707,116 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new algorithm::MEMCPY(run_params);
        break;
     }
+    case Algorithm_HISTOGRAM: {
+       kernel = new algorithm::HISTOGRAM(run_params);
+       break;
+    }
+    case Algorithm_SEGMENTED_SCAN: {
+       kernel = new algorithm::SEGMENTED_SCAN(run_params);
+       break;
+    }
+    case Algorithm_SEGMENTED_REDUCE: {
+       kernel = new algorithm::SEGMENTED_REDUCE(run_params);
+       break;
+    }
+    case Algorithm_FFT_1D: {
+       kernel = new algorithm::FFT_1D(run_params);
+       break;
+    }
+    case Algorithm_FFT_3D: {
+       kernel = new algorithm::FFT_3D(run_params);
+       break;
+    }
+    case Algorithm_TRIDIAG_SOLVE: {
+       kernel = new algorithm::TRIDIAG_SOLVE(run_params);
+       break;
+    }
+    case Algorithm_LINEAR_RECUR: {
+       kernel = new algorithm::LINEAR_RECUR(run_params);
+       break;
+    }
+    case Algorithm_TRANSFER: {
+       kernel = new algorithm::TRANSFER(run_params);
+       break;
+    }
+    case Algorithm_MEMCPY_2D: {
+       kernel = new algorithm::MEMCPY_2D(run_params);
+       break;
+    }
+    case Algorithm_MEMCPY_3D: {
+       kernel = new algorithm::MEMCPY_3D(run_params);
+       break;
+    }
+    case Algorithm_HASH_TABLE: {
+       kernel = new algorithm::HASH_TABLE(run_params);
+       break;
+    }
+    case Algorithm_TRANSPOSE: {
+       kernel = new algorithm::TRANSPOSE(run_params);
+       break;
+    }
+    case Algorithm_SELECT: {
+       kernel = new algorithm::SELECT(run_params);
+       break;
+    }
+
+//
+// Sparse kernels...
+//
+    case Sparse_SPMV: {
+       kernel = new sparse::SPMV(run_params);
+       break;
+    }
+    case Sparse_CG: {
+       kernel = new sparse::CG(run_params);
+       break;
+    }
+    case Sparse_SPTRSV: {
+       kernel = new sparse::SPTRSV(run_params);
+       break;
+    }
+
+//
+// Overhead kernels...
+//
+    case Overhead_EMPTY: {
+       kernel = new overhead::EMPTY(run_params);
+       break;
+    }
+    case Overhead_TRIVIAL: {
+       kernel = new overhead::TRIVIAL(run_params);
+       break;
+    }
+    case Overhead_DEPENDENCY: {
+       kernel = new overhead::DEPENDENCY(run_params);
+       break;
+    }
+
+//
+// Comm kernels...
+//
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    case Comm_ALLREDUCE: {
+       kernel = new comm::ALLREDUCE(run_params);
+       break;
+    }
+    case Comm_DOT_ALLREDUCE: {
+       kernel = new comm::DOT_ALLREDUCE(run_params);
+       break;
+    }
+    case Comm_NEIGHBOR_ALLTOALLV: {
+       kernel = new comm::NEIGHBOR_ALLTOALLV(run_params);
+       break;
+    }
+#endif
 
     default: {
-      getCout() << "\n Unknown Kernel ID = " << kid << std::endl;
+      if ( kid >= NumKernels &&
+           static_cast<size_t>(kid - NumKernels) < getRegisteredKernels().size() ) {
+        kernel = getRegisteredKernels()[kid - NumKernels].factory(kid, run_params);
+      } else {
+        getCout() << "\n Unknown Kernel ID = " << kid << std::endl;
+      }
     }
 
   } // end switch on kernel id
@@ -44,7 +44,7 @@ class RunParams;
  *
  *******************************************************************************
  */
-enum GroupID {
+enum GroupID : int {
 
   Basic = 0,
   Lcals,
@@ -52,6 +52,9 @@ enum GroupID {
   Stream,
   Apps,
   Algorithm,
+  Sparse,
+  Overhead,
+  Comm,
 
   NumGroups // Keep this one last and DO NOT remove (!!)
 
@@ -71,29 +74,44 @@ enum GroupID {
  *
  *******************************************************************************
  */
-enum KernelID {
+enum KernelID : int {
 
 //
 // Basic kernels...
 //
   Basic_ARRAY_OF_PTRS = 0,
+  Basic_ATOMIC_CONTENTION,
+  Basic_BATCHED_GEMM,
+  Basic_BATCHED_LU,
+  Basic_BITSET,
   Basic_COPY8,
+  Basic_COPYN,
   Basic_DAXPY,
   Basic_DAXPY_ATOMIC,
+  Basic_FMA_PEAK,
+  Basic_GATHER,
+  Basic_HASH_MIX,
   Basic_IF_QUAD,
   Basic_INDEXLIST,
   Basic_INDEXLIST_3LOOP,
   Basic_INIT3,
   Basic_INIT_VIEW1D,
   Basic_INIT_VIEW1D_OFFSET,
+  Basic_LOAD_IMBALANCE,
   Basic_MAT_MAT_SHARED,
+  Basic_MORTON,
   Basic_MULADDSUB,
   Basic_NESTED_INIT,
   Basic_PI_ATOMIC,
   Basic_PI_REDUCE,
+  Basic_POINTER_CHASE,
   Basic_REDUCE3_INT,
   Basic_REDUCE_STRUCT,
+  Basic_RNG,
+  Basic_SCATTER,
+  Basic_TEMP_ALLOC,
   Basic_TRAP_INT,
+  Basic_VIEW_OVERHEAD,
 
 //
 // Lcals kernels...
@@ -106,7 +124,12 @@ enum KernelID {
   Lcals_GEN_LIN_RECUR,
   Lcals_HYDRO_1D,
   Lcals_HYDRO_2D,
+  Lcals_IMPLICIT_COND,
+  Lcals_IMPLICIT_HYDRO_2D,
   Lcals_INT_PREDICT,
+  Lcals_MONTE_CARLO_SEARCH,
+  Lcals_PIC_1D,
+  Lcals_PIC_2D,
   Lcals_PLANCKIAN,
   Lcals_TRIDIAG_ELIM,
 
@@ -117,20 +140,29 @@ enum KernelID {
   Polybench_3MM,
   Polybench_ADI,
   Polybench_ATAX,
+  Polybench_CHOLESKY,
+  Polybench_COVARIANCE,
   Polybench_FDTD_2D,
   Polybench_FLOYD_WARSHALL,
+  Polybench_FLOYD_WARSHALL_INPLACE,
   Polybench_GEMM,
   Polybench_GEMVER,
   Polybench_GESUMMV,
   Polybench_HEAT_3D,
   Polybench_JACOBI_1D,
   Polybench_JACOBI_2D,
+  Polybench_LU,
   Polybench_MVT,
+  Polybench_SEIDEL_2D,
+  Polybench_SYMM,
+  Polybench_SYRK,
+  Polybench_TRMM,
 
 //
 // Stream kernels...
 //
   Stream_ADD,
+  Stream_CACHE_BW,
   Stream_COPY,
   Stream_DOT,
   Stream_MUL,
@@ -140,21 +172,34 @@ enum KernelID {
 // Apps kernels...
 //
   Apps_CONVECTION3DPA,
+  Apps_COUPLE,
   Apps_DEL_DOT_VEC_2D,
   Apps_DIFFUSION3DPA,
   Apps_EDGE3D,
   Apps_ENERGY,
   Apps_FIR,
+  Apps_FUSED_PIPELINE,
   Apps_HALOEXCHANGE,
   Apps_HALOEXCHANGE_FUSED,
   Apps_LTIMES,
   Apps_LTIMES_NOVIEW,
   Apps_MASS3DEA,
   Apps_MASS3DPA,
+  Apps_MASS3D_APPLY,
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  Apps_MPI_HALOEXCHANGE,
+#endif
   Apps_NODAL_ACCUMULATION_3D,
+  Apps_PIC_PUSH_DEPOSIT,
   Apps_PRESSURE,
+  Apps_STENCIL_27PT,
   Apps_VOL3D,
+  Apps_XS_LOOKUP,
+  Apps_LBM_D3Q19,
+  Apps_MG_VCYCLE,
+  Apps_MC_TRANSPORT,
   Apps_ZONAL_ACCUMULATION_3D,
+  Apps_AMR_PATCHES,
 
 //
 // Algorithm kernels...
@@ -165,6 +210,42 @@ enum KernelID {
   Algorithm_REDUCE_SUM,
   Algorithm_MEMSET,
   Algorithm_MEMCPY,
+  Algorithm_HISTOGRAM,
+  Algorithm_SEGMENTED_SCAN,
+  Algorithm_SEGMENTED_REDUCE,
+  Algorithm_FFT_1D,
+  Algorithm_FFT_3D,
+  Algorithm_TRIDIAG_SOLVE,
+  Algorithm_LINEAR_RECUR,
+  Algorithm_TRANSFER,
+  Algorithm_MEMCPY_2D,
+  Algorithm_MEMCPY_3D,
+  Algorithm_HASH_TABLE,
+  Algorithm_TRANSPOSE,
+  Algorithm_SELECT,
+
+//
+// Sparse kernels...
+//
+  Sparse_SPMV,
+  Sparse_CG,
+  Sparse_SPTRSV,
+
+//
+// Overhead kernels...
+//
+  Overhead_EMPTY,
+  Overhead_TRIVIAL,
+  Overhead_DEPENDENCY,
+
+//
+// Comm kernels...
+//
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  Comm_ALLREDUCE,
+  Comm_DOT_ALLREDUCE,
+  Comm_NEIGHBOR_ALLTOALLV,
+#endif
 
   NumKernels // Keep this one last and NEVER comment out (!!)
 
@@ -204,6 +285,9 @@ enum VariantID {
   Lambda_HIP,
   RAJA_HIP,
 
+  Base_SYCL,
+  RAJA_SYCL,
+
   Kokkos_Lambda,
 
   NumVariants // Keep this one last and NEVER comment out (!!)
@@ -243,6 +327,41 @@ enum FeatureID {
 };
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each performance characteristic
+ *        (access PATTERN) of kernels in suite.
+ *
+ * Streaming kernels access their arrays with unit stride, Stencil kernels
+ * access neighbors of each index, GatherScatter kernels access memory
+ * through index arrays or permutations, ReductionBound kernels combine
+ * their data into few values, LatencyBound kernels have serial dependence
+ * chains, ie. pointer chasing, recurrences, or launch overhead, and
+ * ComputeBound kernels do many FLOPs per byte.
+ *
+ * IMPORTANT: This is only modified when a new pattern is used in suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE PatternNames ARRAY IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum PatternID {
+
+  Streaming = 0,
+  Stencil,
+  GatherScatter,
+
+  ReductionBound,
+  LatencyBound,
+  ComputeBound,
+
+  NumPatterns // Keep this one last and NEVER comment out (!!)
+
+};
+
+
 /*!
  *******************************************************************************
  *
@@ -263,10 +382,13 @@ enum struct DataSpace {
   Omp,
 
   OmpTarget,
+  OmpTargetSystem,
 
   CudaPinned,
   CudaManaged,
   CudaDevice,
+  CudaDeviceAsync,
+  CudaSystem,
 
   HipHostAdviseFine,
   HipHostAdviseCoarse,
@@ -278,12 +400,137 @@ enum struct DataSpace {
   HipManagedAdviseCoarse,
   HipDevice,
   HipDeviceFine,
+  HipDeviceAsync,
+  HipSystem,
+
+  SyclPinned,
+  SyclManaged,
+  SyclDevice,
 
   NumSpaces // Keep this one last and NEVER comment out (!!)
 
 };
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each element data type kernels
+ * with data type tunings may be run with.
+ *
+ * IMPORTANT: This is only modified when a new data type is used in suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE DataTypeNames ARRAY IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum struct DataType {
+
+  Int32 = 0,
+  Int64,
+
+  Float,
+  Double,
+
+  NumDataTypes // Keep this one last and NEVER comment out (!!)
+
+};
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Storage precision of a tuning, Default for tunings that store
+ * their arrays in the type they compute in, see common/StorageUtils.hpp.
+ *
+ *******************************************************************************
+ */
+enum struct StoragePrecision {
+
+  Default,
+  Float,
+  BFloat16,
+
+  NumStoragePrecisions // Keep this one last
+
+};
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each NUMA policy used to place
+ * the pages of Omp data.
+ *
+ * IMPORTANT: This is only modified when a new NUMA policy is used in suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE NumaPolicyNames ARRAY IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum struct NumaPolicy {
+
+  FirstTouch = 0,
+  Interleave,
+  Membind,
+
+  NumNumaPolicies // Keep this one last and NEVER comment out (!!)
+
+};
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each page size policy used to
+ * allocate host data.
+ *
+ * IMPORTANT: This is only modified when a new page policy is used in suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE HostPagePolicyNames ARRAY IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum struct HostPagePolicy {
+
+  Default = 0,
+  THP,
+  Huge2MB,
+  Huge1GB,
+
+  NumHostPagePolicies // Keep this one last and NEVER comment out (!!)
+
+};
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each policy applied to managed
+ * data before the timed region of GPU variants.
+ *
+ * IMPORTANT: This is only modified when a new managed policy is used in suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ITEMS IN THE ManagedPolicyNames ARRAY IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum struct ManagedPolicy {
+
+  None = 0,
+  Prefetch,
+  PreferredLocation,
+  ReadMostly,
+
+  NumManagedPolicies // Keep this one last and NEVER comment out (!!)
+
+};
+
+
 /*!
  *******************************************************************************
  *
@@ -353,6 +600,15 @@ bool isVariantGPU(VariantID vid);
  */
 const std::string& getFeatureName(FeatureID vid);
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Return pattern name associated with PatternID enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getPatternName(PatternID pid);
+
 /*!
  *******************************************************************************
  *
@@ -371,6 +627,83 @@ const std::string& getDataSpaceName(DataSpace cd);
  */
 bool isDataSpaceAvailable(DataSpace dataSpace);
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Return data type name associated with DataType enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getDataTypeName(DataType dt);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return size in bytes of an element of the DataType enum value.
+ *
+ *******************************************************************************
+ */
+size_t getDataTypeSize(DataType dt);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return NUMA policy name associated with NumaPolicy enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getNumaPolicyName(NumaPolicy np);
+
+/*!
+ *******************************************************************************
+ *
+ * Return true if the NUMA policy associated with NumaPolicy enum value is
+ * available.
+ *
+ *******************************************************************************
+ */
+bool isNumaPolicyAvailable(NumaPolicy np);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return host page policy name associated with HostPagePolicy enum
+ * value.
+ *
+ *******************************************************************************
+ */
+const std::string& getHostPagePolicyName(HostPagePolicy hp);
+
+/*!
+ *******************************************************************************
+ *
+ * Return true if the host page policy associated with HostPagePolicy enum
+ * value is available.
+ *
+ *******************************************************************************
+ */
+bool isHostPagePolicyAvailable(HostPagePolicy hp);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return managed policy name associated with ManagedPolicy enum
+ * value.
+ *
+ *******************************************************************************
+ */
+const std::string& getManagedPolicyName(ManagedPolicy mp);
+
+/*!
+ *******************************************************************************
+ *
+ * Return true if the managed policy associated with ManagedPolicy enum
+ * value is available.
+ *
+ *******************************************************************************
+ */
+bool isManagedPolicyAvailable(ManagedPolicy mp);
+
 /*!
  *******************************************************************************
  *
@@ -382,6 +715,66 @@ bool isDataSpaceAvailable(DataSpace dataSpace);
  */
 KernelBase* getKernelObject(KernelID kid, const RunParams& run_params);
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Function type constructing an out-of-tree kernel object with the
+ *        KernelID it was registered with.
+ *
+ *******************************************************************************
+ */
+using KernelFactory = KernelBase* (*)(KernelID kid, const RunParams& run_params);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Register an out-of-tree kernel and return its KernelID.
+ *
+ *        Registered kernels get ids after the kernels in the KernelID enum
+ *        and group names not in the suite get ids after the groups in the
+ *        GroupID enum, so they are selected, run, and reported like kernels
+ *        in the suite. Registering a full kernel name again returns the
+ *        id of the first registration.
+ *
+ *        Usually called through RAJAPERF_REGISTER_KERNEL when the object
+ *        file or shared library holding the kernel is loaded.
+ *
+ *******************************************************************************
+ */
+KernelID registerKernel(const std::string& group_name,
+                        const std::string& kernel_name,
+                        KernelFactory factory);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return number of kernels, including registered kernels.
+ *
+ *******************************************************************************
+ */
+size_t getNumKernels();
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return number of groups, including groups of registered kernels.
+ *
+ *******************************************************************************
+ */
+size_t getNumGroups();
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Load shared library with kernels registered by its static
+ *        initializers, ie. with RAJAPERF_REGISTER_KERNEL.
+ *
+ *        Returns false and sets error if the library can not be loaded.
+ *
+ *******************************************************************************
+ */
+bool loadKernelLibrary(const std::string& lib_name, std::string& error);
+
 /*!
  *******************************************************************************
  *
@@ -423,4 +816,23 @@ inline void ignore_unused(Ts&&...) { }
 
 }  // closing brace for rajaperf namespace
 
+//
+// Register kernel class CLASS, with a constructor taking the KernelID and
+// RunParams, as kernel NAME in group GROUP when the file using this macro
+// at namespace scope is loaded. The class constructor passes the KernelID
+// on to the KernelBase constructor.
+//
+#define RAJAPERF_REGISTER_KERNEL_CONCAT_IMPL(a, b) a##b
+#define RAJAPERF_REGISTER_KERNEL_CONCAT(a, b) \
+  RAJAPERF_REGISTER_KERNEL_CONCAT_IMPL(a, b)
+
+#define RAJAPERF_REGISTER_KERNEL(CLASS, GROUP, NAME) \
+  static const ::rajaperf::KernelID \
+  RAJAPERF_REGISTER_KERNEL_CONCAT(rajaperf_registered_kernel_, __LINE__) = \
+      ::rajaperf::registerKernel(GROUP, NAME, \
+          [](::rajaperf::KernelID kid, \
+             const ::rajaperf::RunParams& params) -> ::rajaperf::KernelBase* { \
+            return new CLASS(kid, params); \
+          });
+
 #endif  // closing endif for header file include guard
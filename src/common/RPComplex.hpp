@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Lightweight complex number type usable in host and device code.
+///
+
+#ifndef RAJAPerf_RPComplex_HPP
+#define RAJAPerf_RPComplex_HPP
+
+#include "RAJA/util/macros.hpp"
+
+namespace rajaperf
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Complex number type usable in host and device code.
+ *
+ * std::complex can not be used in device code so this type provides the
+ * part of its interface used by kernels in the Suite. Like std::complex, it
+ * stores the real part followed by the imaginary part.
+ *
+ ******************************************************************************
+ */
+template < typename T >
+class Complex
+{
+public:
+  using value_type = T;
+
+  RAJA_HOST_DEVICE
+  constexpr Complex(T re = T(), T im = T()) : m_re(re), m_im(im) { }
+
+  RAJA_HOST_DEVICE
+  constexpr T real() const { return m_re; }
+  RAJA_HOST_DEVICE
+  constexpr T imag() const { return m_im; }
+
+  RAJA_HOST_DEVICE
+  Complex& operator+=(const Complex& rhs)
+  {
+    m_re += rhs.m_re;
+    m_im += rhs.m_im;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  Complex& operator-=(const Complex& rhs)
+  {
+    m_re -= rhs.m_re;
+    m_im -= rhs.m_im;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  Complex& operator*=(const Complex& rhs)
+  {
+    const T re = m_re*rhs.m_re - m_im*rhs.m_im;
+    m_im = m_re*rhs.m_im + m_im*rhs.m_re;
+    m_re = re;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  Complex& operator*=(T rhs)
+  {
+    m_re *= rhs;
+    m_im *= rhs;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  Complex& operator/=(T rhs)
+  {
+    m_re /= rhs;
+    m_im /= rhs;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  friend Complex operator-(const Complex& z)
+  { return Complex(-z.m_re, -z.m_im); }
+
+  RAJA_HOST_DEVICE
+  friend Complex operator+(Complex lhs, const Complex& rhs)
+  { return lhs += rhs; }
+  RAJA_HOST_DEVICE
+  friend Complex operator-(Complex lhs, const Complex& rhs)
+  { return lhs -= rhs; }
+  RAJA_HOST_DEVICE
+  friend Complex operator*(Complex lhs, const Complex& rhs)
+  { return lhs *= rhs; }
+
+  RAJA_HOST_DEVICE
+  friend Complex operator*(Complex lhs, T rhs)
+  { return lhs *= rhs; }
+  RAJA_HOST_DEVICE
+  friend Complex operator*(T lhs, Complex rhs)
+  { return rhs *= lhs; }
+  RAJA_HOST_DEVICE
+  friend Complex operator/(Complex lhs, T rhs)
+  { return lhs /= rhs; }
+
+private:
+  T m_re;
+  T m_im;
+};
+
+///
+template < typename T >
+RAJA_HOST_DEVICE
+RAJA_INLINE constexpr T real(const Complex<T>& z) { return z.real(); }
+///
+template < typename T >
+RAJA_HOST_DEVICE
+RAJA_INLINE constexpr T imag(const Complex<T>& z) { return z.imag(); }
+///
+template < typename T >
+RAJA_HOST_DEVICE
+RAJA_INLINE constexpr Complex<T> conj(const Complex<T>& z)
+{ return Complex<T>(z.real(), -z.imag()); }
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
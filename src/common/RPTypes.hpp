@@ -15,6 +15,9 @@
 
 #include "RAJA/util/types.hpp"
 
+#include <cmath>
+#include <cstdint>
+
 //
 // Only one of the following (double or float) should be defined.
 //
@@ -28,7 +31,7 @@
 //#undef RP_USE_COMPLEX
 
 #if defined(RP_USE_COMPLEX)
-#include <complex>
+#include "RPComplex.hpp"
 #endif
 
 
@@ -95,10 +98,14 @@ using Checksum_type = long double;
 #if defined(RP_USE_DOUBLE)
 ///
 using Real_type = double;
+///
+#define Real_MPI_type MPI_DOUBLE
 
 #elif defined(RP_USE_FLOAT)
 ///
 using Real_type = float;
+///
+#define Real_MPI_type MPI_FLOAT
 
 #else
 #error Real_type is undefined!
@@ -109,12 +116,29 @@ using Real_ptr = Real_type*;
 
 #if defined(RP_USE_COMPLEX)
 ///
-using Complex_type = std::complex<Real_type>;
+using Complex_type = Complex<Real_type>;
 
 using Complex_ptr = Complex_type*;
 #endif
 
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Element types of kernels with data type tunings, one for each
+ *        value of the DataType enum.
+ *
+ ******************************************************************************
+ */
+using Int32_type = std::int32_t;
+///
+using Int64_type = std::int64_t;
+///
+using Float_type = float;
+///
+using Double_type = double;
+
+
 
 
 }  // closing brace for rajaperf namespace
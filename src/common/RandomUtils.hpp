@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Counter based random number generators of Salmon et al., "Parallel
+/// Random Numbers: As Easy as 1, 2, 3", SC11, as in Random123, cuRAND, and
+/// rocRAND.
+///
+/// Each generator is a keyed bijection of a 128 bit counter, so the values
+/// for counter i only depend on i and the key, and may be generated in any
+/// order, in parallel, or on a device without generator state in memory.
+/// The generators give the known answers of the Random123 test vectors.
+///
+
+#ifndef RAJAPerf_RandomUtils_HPP
+#define RAJAPerf_RandomUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+#include "common/RPTypes.hpp"
+
+#include <cmath>
+
+namespace rajaperf
+{
+
+namespace rng
+{
+
+using uint32 = unsigned int;
+using uint64 = unsigned long long;
+
+struct Uint4x32
+{
+  uint32 v[4];
+};
+
+/*!
+ * \brief Philox4x32 with 10 rounds of counter ctr and key k0, k1.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE Uint4x32 philox4x32_10(Uint4x32 ctr,
+                                                    uint32 k0, uint32 k1)
+{
+  constexpr uint32 M0 = 0xD2511F53u;
+  constexpr uint32 M1 = 0xCD9E8D57u;
+  constexpr uint32 W0 = 0x9E3779B9u;
+  constexpr uint32 W1 = 0xBB67AE85u;
+
+  for (int r = 0; r < 10; ++r) {
+    if (r > 0) {
+      k0 += W0;
+      k1 += W1;
+    }
+    const uint64 p0 = static_cast<uint64>(M0) * ctr.v[0];
+    const uint64 p1 = static_cast<uint64>(M1) * ctr.v[2];
+    const uint32 hi0 = static_cast<uint32>(p0 >> 32);
+    const uint32 lo0 = static_cast<uint32>(p0);
+    const uint32 hi1 = static_cast<uint32>(p1 >> 32);
+    const uint32 lo1 = static_cast<uint32>(p1);
+    ctr.v[0] = hi1 ^ ctr.v[1] ^ k0;
+    ctr.v[1] = lo1;
+    ctr.v[2] = hi0 ^ ctr.v[3] ^ k1;
+    ctr.v[3] = lo0;
+  }
+  return ctr;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE uint32 rotl32(uint32 x, int r)
+{
+  return (x << r) | (x >> (32 - r));
+}
+
+/*!
+ * \brief Threefry4x32 with 20 rounds of counter ctr and key k.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE Uint4x32 threefry4x32_20(Uint4x32 ctr,
+                                                      const Uint4x32& k)
+{
+  constexpr int R[8][2] = { {10, 26}, {11, 21}, {13, 27}, {23,  5},
+                            { 6, 20}, {17, 11}, {25, 10}, {18, 20} };
+
+  const uint32 ks[5] = { k.v[0], k.v[1], k.v[2], k.v[3],
+                         0x1BD11BDAu ^ k.v[0] ^ k.v[1] ^ k.v[2] ^ k.v[3] };
+
+  uint32 x0 = ctr.v[0] + ks[0];
+  uint32 x1 = ctr.v[1] + ks[1];
+  uint32 x2 = ctr.v[2] + ks[2];
+  uint32 x3 = ctr.v[3] + ks[3];
+
+  for (int r = 0; r < 20; ++r) {
+    if (r % 2 == 0) {
+      x0 += x1; x1 = rotl32(x1, R[r % 8][0]); x1 ^= x0;
+      x2 += x3; x3 = rotl32(x3, R[r % 8][1]); x3 ^= x2;
+    } else {
+      x0 += x3; x3 = rotl32(x3, R[r % 8][0]); x3 ^= x0;
+      x2 += x1; x1 = rotl32(x1, R[r % 8][1]); x1 ^= x2;
+    }
+    // inject the key schedule every 4 rounds
+    if (r % 4 == 3) {
+      const uint32 s = static_cast<uint32>(r / 4 + 1);
+      x0 += ks[s % 5];
+      x1 += ks[(s + 1) % 5];
+      x2 += ks[(s + 2) % 5];
+      x3 += ks[(s + 3) % 5] + s;
+    }
+  }
+  return Uint4x32{ {x0, x1, x2, x3} };
+}
+
+/*!
+ * \brief Philox4x32-10 of 64 bit counter i and 64 bit seed.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE Uint4x32 philox(uint64 i, uint64 seed)
+{
+  return philox4x32_10(Uint4x32{ {static_cast<uint32>(i), static_cast<uint32>(i >> 32),
+                                  0u, 0u} },
+                       static_cast<uint32>(seed), static_cast<uint32>(seed >> 32));
+}
+
+/*!
+ * \brief Threefry4x32-20 of 64 bit counter i and 64 bit seed.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE Uint4x32 threefry(uint64 i, uint64 seed)
+{
+  return threefry4x32_20(Uint4x32{ {static_cast<uint32>(i), static_cast<uint32>(i >> 32),
+                                    0u, 0u} },
+                         Uint4x32{ {static_cast<uint32>(seed), static_cast<uint32>(seed >> 32),
+                                    0u, 0u} });
+}
+
+/*!
+ * \brief Uniform value in the open interval (0.0, 1.0) from the top 53 bits
+ *        of the 64 bits hi, lo.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE Real_type uniform(uint32 hi, uint32 lo)
+{
+  const uint64 z = (static_cast<uint64>(hi) << 32) | lo;
+  return (static_cast<Real_type>(z >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+/*!
+ * \brief Replace uniform values u0, u1 in (0.0, 1.0) with two independent
+ *        standard normal values by the Box-Muller transform.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE void boxMuller(Real_type& u0, Real_type& u1)
+{
+  const Real_type two_pi = 6.28318530717958647692;
+  const Real_type r = std::sqrt(-2.0 * std::log(u0));
+  const Real_type theta = two_pi * u1;
+  u0 = r * std::cos(theta);
+  u1 = r * std::sin(theta);
+}
+
+}  // closing brace for rng namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -9,13 +9,21 @@
 #include "RunParams.hpp"
 
 #include "KernelBase.hpp"
+#include "TimerUtils.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <cstdlib>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 
+#include <limits>
 #include <list>
+#include <random>
 #include <set>
+#include <sstream>
 
 namespace rajaperf
 {
@@ -32,15 +40,85 @@ RunParams::RunParams(int argc, char** argv)
  : input_state(Undefined),
    show_progress(false),
    npasses(1),
+   ci_target(0.0),
+   max_npasses(100),
    npasses_combiners(),
+   timing_batch_reps(0),
+   timing_hist_bins(10),
+   timing_barrier_batches(1),
+   peak_bandwidth(0.0),
+   peak_flops(0.0),
    rep_fact(1.0),
+   target_time(0.0),
+   estimate_probe_time(0.0),
+   walltime_budget(0.0),
    size_meaning(SizeMeaning::Unset),
    size(0.0),
    size_factor(0.0),
+   size_sweep(),
+   memory_fraction(0.0),
+   memory_fit(SkipMemoryFit),
+   run_plan_file(),
+   run_plan(),
+   app_proxy_cycles(0),
    data_alignment(RAJA::DATA_ALIGN),
+   reuse_setup_data(false),
+   pipeline_setup(false),
+   sparse_stencil(27),
+   histogram_bins(1024),
+   histogram_skew(0.0),
+   branch_fraction(-1.0),
+   branch_run_length(1),
+   segment_size(64),
+   segment_dist("uniform"),
+   batched_matrix_size(16),
+   fft_size(1024),
+   ltimes_num_d(64),
+   ltimes_num_g(32),
+   ltimes_num_m(25),
+   gather_pattern("random"),
+   gather_block_size(64),
+   use_data_pool(false),
+   gpu_pool_release_threshold(0),
+   autotune(false),
+   tuning_file(),
+   tuning_db_file(),
+   run_best_tunings(false),
+   compare_dir(),
+   compare_tol(0.1),
+   mpi_scaling(NoScaling),
+   scaling_series_dirs(),
    gpu_stream(1),
+   gpu_device(-1),
+   ranks_per_gpu(0),
+   multi_gpu(false),
+   gpu_event_timing(false),
+   host_timer(RAJAHostTimer),
+   measure_energy(false),
+   resume(false),
+   incremental(false),
+   result_cache_file(),
+   result_cache_options(),
+   isolate_kernels(false),
+   cold_cache(false),
+   concurrent_kernels(1),
+   concurrent_mixed(false),
+   co_exec_cpu_variant(NumVariants),
+   co_exec_gpu_variant(NumVariants),
+   co_exec_gpu_fraction(0.5),
+   mpi_gpu_aware(false),
    gpu_block_sizes(),
+   omp_target_thread_limits(),
+   omp_target_num_teams(),
+   gpu_shmem_carveouts(),
+   gpu_settings(),
+   omp_thread_counts(),
+   data_types(),
+   storage_precisions(),
    pf_tol(0.1),
+   reproducible(false),
+   checksum_once(false),
+   fast_math(false),
    checkrun_reps(1),
    reference_variant(),
    reference_vid(NumVariants),
@@ -56,14 +134,27 @@ RunParams::RunParams(int argc, char** argv)
    invalid_tuning_input(),
    exclude_tuning_input(),
    invalid_exclude_tuning_input(),
+   kernel_param_input(),
+   kernel_libs(),
+   kernel_params(),
    feature_input(),
    invalid_feature_input(),
    exclude_feature_input(),
    invalid_exclude_feature_input(),
+   pattern_input(),
+   invalid_pattern_input(),
+   exclude_pattern_input(),
+   invalid_exclude_pattern_input(),
    npasses_combiner_input(),
    invalid_npasses_combiner_input(),
    outdir(),
    outfile_prefix("RAJAPerf"),
+   jit_cache_dir("rajaperf_jit_cache"),
+   papi_events(),
+   validate_bytes(false),
+   bytes_events(),
+   bytes_event_scales(),
+   bytes_tol(0.25),
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
    add_to_spot_config(),
 #endif
@@ -72,9 +163,17 @@ RunParams::RunParams(int argc, char** argv)
    run_kernels(),
    run_variants()
 {
+  if (argc > 0) {
+    getCout() << "\n\nReading command line input..." << std::endl;
+  }
   parseCommandLineOptions(argc, argv);
 }
 
+RunParams::RunParams()
+  : RunParams(0, nullptr)
+{
+}
+
 
 /*
  *******************************************************************************
@@ -99,6 +198,8 @@ void RunParams::print(std::ostream& str) const
 {
   str << "\n show_progress = " << show_progress;
   str << "\n npasses = " << npasses;
+  str << "\n ci_target = " << ci_target;
+  str << "\n max_npasses = " << max_npasses;
   str << "\n npasses combiners = ";
   for (size_t j = 0; j < npasses_combiners.size(); ++j) {
     str << "\n\t" << CombinerOptToStr(npasses_combiners[j]);
@@ -111,21 +212,141 @@ void RunParams::print(std::ostream& str) const
   for (size_t j = 0; j < invalid_npasses_combiner_input.size(); ++j) {
     str << "\n\t" << invalid_npasses_combiner_input[j];
   }
+  str << "\n timing_batch_reps = " << timing_batch_reps;
+  str << "\n timing_hist_bins = " << timing_hist_bins;
+  str << "\n timing_barrier_batches = " << timing_barrier_batches;
+  str << "\n peak_bandwidth = " << peak_bandwidth;
+  str << "\n peak_flops = " << peak_flops;
   str << "\n rep_fact = " << rep_fact;
+  str << "\n target_time = " << target_time;
+  str << "\n estimate_probe_time = " << estimate_probe_time;
+  str << "\n walltime_budget = " << walltime_budget;
   str << "\n size_meaning = " << SizeMeaningToStr(getSizeMeaning());
   str << "\n size = " << size;
   str << "\n size_factor = " << size_factor;
+  str << "\n size_sweep = ";
+  for (double sweep_size : size_sweep) {
+    str << sweep_size << " ";
+  }
+  str << "\n memory_fraction = " << memory_fraction;
+  str << "\n memory_fit = " << MemoryFitToStr(memory_fit);
+  str << "\n run_plan_file = " << run_plan_file;
+  str << "\n run_plan = ";
+  for (const RunPlanEntry& entry : run_plan) {
+    str << "\n\t" << getFullKernelName(entry.kernel_id)
+        << " size=" << entry.size << " reps=" << entry.reps
+        << " weight=" << entry.weight;
+    for (const std::string& tuning : entry.tunings) {
+      str << " " << tuning;
+    }
+  }
   str << "\n data_alignment = " << data_alignment;
+  str << "\n reuse_setup_data = " << reuse_setup_data;
+  str << "\n pipeline_setup = " << pipeline_setup;
+  str << "\n random_order = " << random_order;
+  str << "\n random_order_seed = " << random_order_seed;
+  str << "\n sparse_stencil = " << sparse_stencil;
+  str << "\n histogram_bins = " << histogram_bins;
+  str << "\n histogram_skew = " << histogram_skew;
+  str << "\n branch_fraction = " << branch_fraction;
+  str << "\n branch_run_length = " << branch_run_length;
+  str << "\n segment_size = " << segment_size;
+  str << "\n segment_dist = " << segment_dist;
+  str << "\n batched_matrix_size = " << batched_matrix_size;
+  str << "\n fft_size = " << fft_size;
+  str << "\n ltimes_num_d = " << ltimes_num_d;
+  str << "\n ltimes_num_g = " << ltimes_num_g;
+  str << "\n ltimes_num_m = " << ltimes_num_m;
+  str << "\n gather_pattern = " << gather_pattern;
+  str << "\n gather_block_size = " << gather_block_size;
+  str << "\n use_data_pool = " << use_data_pool;
+  str << "\n gpu_pool_release_threshold = " << gpu_pool_release_threshold;
+  str << "\n autotune = " << autotune;
+  str << "\n tuning_file = " << tuning_file;
+  str << "\n tuning_db_file = " << tuning_db_file;
+  str << "\n run_best_tunings = " << run_best_tunings;
+  str << "\n compare_dir = " << compare_dir;
+  str << "\n compare_tol = " << compare_tol;
+  str << "\n mpi_scaling = " << MPIScalingToStr(mpi_scaling);
+  str << "\n scaling_series_dirs = ";
+  for (size_t j = 0; j < scaling_series_dirs.size(); ++j) {
+    str << "\n\t" << scaling_series_dirs[j];
+  }
   str << "\n gpu stream = " << ((gpu_stream == 0) ? "0" : "RAJA default");
+  str << "\n gpu_device = " << gpu_device;
+  str << "\n ranks_per_gpu = " << ranks_per_gpu;
+  str << "\n multi_gpu = " << multi_gpu;
+  str << "\n gpu_event_timing = " << gpu_event_timing;
+  str << "\n host_timer = " << HostTimerToStr(host_timer);
+  str << "\n measure_energy = " << measure_energy;
+  str << "\n resume = " << resume;
+  str << "\n incremental = " << incremental;
+  str << "\n result_cache_file = " << result_cache_file;
+  str << "\n isolate_kernels = " << isolate_kernels;
+  str << "\n cold_cache = " << cold_cache;
+  str << "\n concurrent_kernels = " << concurrent_kernels;
+  str << "\n concurrent_mixed = " << concurrent_mixed;
+  str << "\n co_exec_cpu_variant = "
+      << ( co_exec_cpu_variant == NumVariants ? std::string("none")
+                                              : getVariantName(co_exec_cpu_variant) );
+  str << "\n co_exec_gpu_variant = "
+      << ( co_exec_gpu_variant == NumVariants ? std::string("none")
+                                              : getVariantName(co_exec_gpu_variant) );
+  str << "\n co_exec_gpu_fraction = " << co_exec_gpu_fraction;
+  str << "\n mpi_gpu_aware = " << mpi_gpu_aware;
   str << "\n gpu_block_sizes = ";
   for (size_t j = 0; j < gpu_block_sizes.size(); ++j) {
     str << "\n\t" << gpu_block_sizes[j];
   }
+  str << "\n omp_target_thread_limits = ";
+  for (size_t j = 0; j < omp_target_thread_limits.size(); ++j) {
+    str << "\n\t" << omp_target_thread_limits[j];
+  }
+  str << "\n omp_target_num_teams = ";
+  for (size_t j = 0; j < omp_target_num_teams.size(); ++j) {
+    str << "\n\t" << omp_target_num_teams[j];
+  }
+  str << "\n gpu_shmem_carveouts = ";
+  for (size_t j = 0; j < gpu_shmem_carveouts.size(); ++j) {
+    str << "\n\t" << gpu_shmem_carveouts[j];
+  }
+  str << "\n gpu_settings = ";
+  for (size_t j = 0; j < gpu_settings.size(); ++j) {
+    str << "\n\t" << gpu_settings[j].getName();
+  }
+  str << "\n omp_thread_counts = ";
+  for (size_t j = 0; j < omp_thread_counts.size(); ++j) {
+    str << "\n\t" << omp_thread_counts[j];
+  }
+  str << "\n data_types = ";
+  for (size_t j = 0; j < data_types.size(); ++j) {
+    str << "\n\t" << getDataTypeName(data_types[j]);
+  }
+  str << "\n storage_precisions = ";
+  for (size_t j = 0; j < storage_precisions.size(); ++j) {
+    str << "\n\t" << storage::getName(storage_precisions[j]);
+  }
   str << "\n pf_tol = " << pf_tol;
+  str << "\n reproducible = " << reproducible;
+  str << "\n checksum_once = " << checksum_once;
+  str << "\n fast_math = " << fast_math;
   str << "\n checkrun_reps = " << checkrun_reps;
   str << "\n reference_variant = " << reference_variant;
   str << "\n outdir = " << outdir;
   str << "\n outfile_prefix = " << outfile_prefix;
+  str << "\n jit_cache_dir = " << jit_cache_dir;
+
+  if (!papi_events.empty()) {
+    str << "\n papi_events = ";
+    for (size_t j = 0; j < papi_events.size(); ++j) {
+      str << "\n\t" << papi_events[j];
+    }
+  }
+  str << "\n validate_bytes = " << validate_bytes;
+  for (size_t j = 0; j < bytes_events.size(); ++j) {
+    str << "\n\t" << bytes_events[j] << " * " << bytes_event_scales[j];
+  }
+  str << "\n bytes_tol = " << bytes_tol;
 
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
   if (add_to_spot_config.length() > 0) {
@@ -134,14 +355,35 @@ void RunParams::print(std::ostream& str) const
 #endif
 
   str << "\n disable_warmup = " << disable_warmup;
+  str << "\n adaptive_warmup_tol = " << adaptive_warmup_tol;
+  str << "\n adaptive_warmup_max_reps = " << adaptive_warmup_max_reps;
   str << "\n allow_problematic_implementations = "
       << allow_problematic_implementations;
 
   str << "\n seq data space = " << getDataSpaceName(seqDataSpace);
   str << "\n omp data space = " << getDataSpaceName(ompDataSpace);
+  str << "\n host page policy = " << getHostPagePolicyName(host_page_policy);
+  str << "\n managed policy = " << getManagedPolicyName(managed_policy);
+  str << "\n count_page_faults = " << count_page_faults;
+  str << "\n track_device_memory = " << track_device_memory;
+  str << "\n gpu_telemetry = " << gpu_telemetry;
+  str << "\n device_activity = " << device_activity;
+  str << "\n trace = " << trace;
+  str << "\n interference_loads = ";
+  for (size_t j = 0; j < interference_loads.size(); ++j) {
+    str << "\n\t" << InterferenceLoadToStr(interference_loads[j]);
+  }
+  str << "\n interference_threads = " << interference_threads;
+  str << "\n throttle_reruns = " << throttle_reruns;
+  str << "\n omp numa policy = " << getNumaPolicyName(omp_numa_policy);
+  str << "\n omp numa nodes = ";
+  for (size_t j = 0; j < omp_numa_nodes.size(); ++j) {
+    str << "\n\t" << omp_numa_nodes[j];
+  }
   str << "\n omp target data space = " << getDataSpaceName(ompTargetDataSpace);
   str << "\n cuda data space = " << getDataSpaceName(cudaDataSpace);
   str << "\n hip data space = " << getDataSpaceName(hipDataSpace);
+  str << "\n sycl data space = " << getDataSpaceName(syclDataSpace);
   str << "\n kokkos data space = " << getDataSpaceName(kokkosDataSpace);
 
   str << "\n kernel_input = ";
@@ -198,6 +440,16 @@ void RunParams::print(std::ostream& str) const
     str << "\n\t" << invalid_exclude_tuning_input[j];
   }
 
+  str << "\n kernel_param_input = ";
+  for (size_t j = 0; j < kernel_param_input.size(); ++j) {
+    str << "\n\t" << kernel_param_input[j];
+  }
+
+  str << "\n kernel_libs = ";
+  for (size_t j = 0; j < kernel_libs.size(); ++j) {
+    str << "\n\t" << kernel_libs[j];
+  }
+
   str << "\n feature_input = ";
   for (size_t j = 0; j < feature_input.size(); ++j) {
     str << "\n\t" << feature_input[j];
@@ -216,6 +468,24 @@ void RunParams::print(std::ostream& str) const
     str << "\n\t" << invalid_exclude_feature_input[j];
   }
 
+  str << "\n pattern_input = ";
+  for (size_t j = 0; j < pattern_input.size(); ++j) {
+    str << "\n\t" << pattern_input[j];
+  }
+  str << "\n invalid_pattern_input = ";
+  for (size_t j = 0; j < invalid_pattern_input.size(); ++j) {
+    str << "\n\t" << invalid_pattern_input[j];
+  }
+
+  str << "\n exclude_pattern_input = ";
+  for (size_t j = 0; j < exclude_pattern_input.size(); ++j) {
+    str << "\n\t" << exclude_pattern_input[j];
+  }
+  str << "\n invalid_exclude_pattern_input = ";
+  for (size_t j = 0; j < invalid_exclude_pattern_input.size(); ++j) {
+    str << "\n\t" << invalid_exclude_pattern_input[j];
+  }
+
   str << std::endl;
   str.flush();
 }
@@ -233,7 +503,59 @@ void RunParams::print(std::ostream& str) const
  */
 void RunParams::parseCommandLineOptions(int argc, char** argv)
 {
-  getCout() << "\n\nReading command line input..." << std::endl;
+  // load kernel libraries before parsing other options so their kernels
+  // are known to options like --print-kernels and --kernels
+  for (int i = 1; i < argc; ++i) {
+    if ( std::string(argv[i]) == std::string("--load-kernels") ) {
+      bool got_someting = false;
+      for (i++; i < argc && argv[i][0] != '-'; ++i) {
+        got_someting = true;
+        std::string error;
+        if ( loadKernelLibrary(argv[i], error) ) {
+          kernel_libs.push_back(argv[i]);
+        } else {
+          getCout() << "\nBad input:"
+                    << " could not load kernel library " << argv[i]
+                    << " (" << error << ")" << std::endl;
+          input_state = BadInput;
+        }
+      }
+      i--;
+      if ( !got_someting ) {
+        getCout() << "\nBad input:"
+                  << " must give --load-kernels one or more library names"
+                  << std::endl;
+        input_state = BadInput;
+      }
+    }
+  }
+
+  //
+  // The options of the result cache key are all options but those that
+  // select what is run, where output goes, or how progress is shown, as
+  // those do not change the result of a pass. The number of passes is not
+  // part of the key either, the pass index is.
+  //
+  static const std::set<std::string> result_cache_ignored_options{
+      "--kernels", "-k", "--exclude-kernels", "-ek",
+      "--variants", "-v", "--exclude-variants", "-ev",
+      "--tunings", "-t", "--exclude-tunings", "-et",
+      "--features", "-f", "--exclude-features", "-ef",
+      "--patterns", "-pt", "--exclude-patterns", "-ept",
+      "--outdir", "-od", "--outfile", "-of",
+      "--show-progress", "-sp", "--npasses",
+      "--resume", "--incremental",
+      "--compare-to", "--compare-tol", "--pass-fail-tol", "-pftol",
+      "--scaling-series"};
+  for (int i = 1; i < argc; ++i) {
+    if ( result_cache_ignored_options.count(argv[i]) != 0 ) {
+      while ( i+1 < argc && argv[i+1][0] != '-' ) {
+        i++;
+      }
+    } else {
+      result_cache_options += std::string(argv[i]) + " ";
+    }
+  }
 
   for (int i = 1; i < argc; ++i) {
 
@@ -286,6 +608,24 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
       printKernelFeatures(getCout());
       input_state = InfoRequest;
 
+    } else if ( opt == std::string("--print-patterns") ||
+                opt == std::string("-ppt") ) {
+
+      printPatternNames(getCout());
+      input_state = InfoRequest;
+
+    } else if ( opt == std::string("--print-pattern-kernels") ||
+                opt == std::string("-pptk") ) {
+
+      printPatternKernels(getCout());
+      input_state = InfoRequest;
+
+    } else if ( opt == std::string("--print-kernel-patterns") ||
+                opt == std::string("-pkpt") ) {
+
+      printKernelPatterns(getCout());
+      input_state = InfoRequest;
+
     } else if ( opt == std::string("--npasses") ) {
 
       i++;
@@ -298,6 +638,42 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--ci-target") ) {
+
+      i++;
+      if ( i < argc ) {
+        ci_target = ::atof( argv[i] );
+        if ( ci_target < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ci-target a non-negative value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ci-target a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--max-npasses") ) {
+
+      i++;
+      if ( i < argc ) {
+        max_npasses = ::atoi( argv[i] );
+        if ( max_npasses < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --max-npasses a positive value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --max-npasses a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--npasses-combiners") ) {
 
       bool done = false;
@@ -313,6 +689,96 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         }
       }
 
+    } else if ( opt == std::string("--timing-batch") ) {
+
+      i++;
+      if ( i < argc ) {
+        timing_batch_reps = ::atoi( argv[i] );
+        if ( timing_batch_reps < 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --timing-batch a non-negative value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --timing-batch a value for number of reps per timing sample (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--timing-hist-bins") ) {
+
+      i++;
+      if ( i < argc ) {
+        timing_hist_bins = ::atoi( argv[i] );
+        if ( timing_hist_bins <= 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --timing-hist-bins a POSITIVE value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --timing-hist-bins a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--timing-barrier-batches") ) {
+
+      i++;
+      if ( i < argc ) {
+        timing_barrier_batches = ::atoi( argv[i] );
+        if ( timing_barrier_batches < 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --timing-barrier-batches a non-negative value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --timing-barrier-batches a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--peak-bandwidth") ) {
+
+      i++;
+      if ( i < argc ) {
+        peak_bandwidth = ::atof( argv[i] );
+        if ( peak_bandwidth < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --peak-bandwidth a non-negative value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --peak-bandwidth a value in GB/s (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--peak-flops") ) {
+
+      i++;
+      if ( i < argc ) {
+        peak_flops = ::atof( argv[i] );
+        if ( peak_flops < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --peak-flops a non-negative value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --peak-flops a value in GFLOP/s (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--repfact") ) {
 
       i++;
@@ -325,6 +791,24 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--target-time") ) {
+
+      i++;
+      if ( i < argc ) {
+        target_time = ::atof( argv[i] );
+        if ( target_time < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --target-time a non-negative value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --target-time a value in seconds (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--sizefact") ) {
 
       i++;
@@ -379,110 +863,1088 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
-    } else if ( opt == std::string("-align") ||
-                opt == std::string("--data_alignment") ) {
+    } else if ( opt == std::string("--size-sweep") ) {
 
       i++;
-      if ( i < argc ) {
-        long long align = ::atoll( argv[i] );
-        long long min_align = alignof(std::max_align_t);
-        if ( align < min_align ) {
-          getCout() << "\nBad input:"
-                << " must give " << opt << " a value of at least " << min_align
-                << std::endl;
-          input_state = BadInput;
-        } else if ( (align & (align-1)) != 0 ) {
-          getCout() << "\nBad input:"
-                << " must give " << opt << " a power of 2"
-                << std::endl;
-          input_state = BadInput;
-        } else {
-          data_alignment = align;
+      double sweep_min = 0.0;
+      double sweep_max = 0.0;
+      double sweep_ratio = 0.0;
+      if ( i < argc &&
+           sscanf(argv[i], "%lf:%lf:%lf", &sweep_min, &sweep_max, &sweep_ratio) == 3 &&
+           sweep_min > 0.0 && sweep_max >= sweep_min && sweep_ratio > 1.0 ) {
+        for (double sweep_size = sweep_min; sweep_size <= sweep_max;
+             sweep_size *= sweep_ratio) {
+          size_sweep.push_back(std::round(sweep_size));
         }
       } else {
         getCout() << "\nBad input:"
-                  << " must give " << opt << " a value (int)"
+                  << " must give --size-sweep min:max:ratio with"
+                  << " 0 < min <= max and ratio > 1 (double:double:double)"
                   << std::endl;
         input_state = BadInput;
       }
 
-    } else if ( opt == std::string("--gpu_stream_0") ) {
-
-      gpu_stream = 0;
-
-    } else if ( opt == std::string("--gpu_block_size") ) {
+    } else if ( opt == std::string("--memory-fraction") ) {
 
-      bool got_someting = false;
-      bool done = false;
       i++;
-      while ( i < argc && !done ) {
-        opt = std::string(argv[i]);
-        if ( opt.at(0) == '-' ) {
-          i--;
-          done = true;
-        } else {
-          got_someting = true;
-          int gpu_block_size = ::atoi( opt.c_str() );
-          if ( gpu_block_size <= 0 ) {
-            getCout() << "\nBad input:"
-                      << " must give --gpu_block_size POSITIVE values (int)"
-                      << std::endl;
-            input_state = BadInput;
-          } else {
-            gpu_block_sizes.push_back(gpu_block_size);
-          }
-          ++i;
+      if ( i < argc ) {
+        memory_fraction = ::atof( argv[i] );
+        if ( memory_fraction <= 0.0 || memory_fraction > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --memory-fraction a value in (0, 1] (double)"
+                    << std::endl;
+          input_state = BadInput;
         }
-      }
-      if (!got_someting) {
+      } else {
         getCout() << "\nBad input:"
-                  << " must give --gpu_block_size one or more values (int)"
+                  << " must give --memory-fraction a value (double)"
                   << std::endl;
         input_state = BadInput;
       }
 
-    } else if ( opt == std::string("--pass-fail-tol") ||
-                opt == std::string("-pftol") ) {
+    } else if ( opt == std::string("--memory-fit") ) {
 
       i++;
       if ( i < argc ) {
-        pf_tol = ::atof( argv[i] );
+        opt = std::string(argv[i]);
+        if ( opt == MemoryFitToStr(SkipMemoryFit) ) {
+          memory_fit = SkipMemoryFit;
+        } else if ( opt == MemoryFitToStr(DownsizeMemoryFit) ) {
+          memory_fit = DownsizeMemoryFit;
+        } else if ( opt == MemoryFitToStr(MaxMemoryFit) ) {
+          memory_fit = MaxMemoryFit;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --memory-fit one of skip, downsize, or max"
+                    << std::endl;
+          input_state = BadInput;
+        }
       } else {
         getCout() << "\nBad input:"
-                  << " must give --pass-fail-tol (or -pftol) a value (double)"
+                  << " must give --memory-fit a value (string)"
                   << std::endl;
         input_state = BadInput;
       }
 
-    } else if ( opt == std::string("--kernels") ||
-                opt == std::string("-k") ) {
+    } else if ( opt == std::string("--run-plan") ) {
 
-      bool done = false;
       i++;
-      while ( i < argc && !done ) {
+      if ( i < argc ) {
         opt = std::string(argv[i]);
         if ( opt.at(0) == '-' ) {
           i--;
-          done = true;
         } else {
-          kernel_input.push_back(opt);
-          ++i;
+          run_plan_file = opt;
         }
       }
+      if ( run_plan_file.empty() ) {
+        getCout() << "\nBad input:"
+                  << " must give --run-plan a file name (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
 
-    } else if ( opt == std::string("--exclude-kernels") ||
-                opt == std::string("-ek") ) {
+    } else if ( opt == std::string("--app-proxy") ) {
 
-      bool done = false;
       i++;
-      while ( i < argc && !done ) {
-        opt = std::string(argv[i]);
-        if ( opt.at(0) == '-' ) {
-          i--;
-          done = true;
-        } else {
-          exclude_kernel_input.push_back(opt);
-          ++i;
+      if ( i < argc ) {
+        app_proxy_cycles = ::atoi( argv[i] );
+        if ( app_proxy_cycles < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --app-proxy a positive value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --app-proxy a value for number of cycles to run (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("-align") ||
+                opt == std::string("--data_alignment") ) {
+
+      i++;
+      if ( i < argc ) {
+        long long align = ::atoll( argv[i] );
+        long long min_align = alignof(std::max_align_t);
+        if ( align < min_align ) {
+          getCout() << "\nBad input:"
+                << " must give " << opt << " a value of at least " << min_align
+                << std::endl;
+          input_state = BadInput;
+        } else if ( (align & (align-1)) != 0 ) {
+          getCout() << "\nBad input:"
+                << " must give " << opt << " a power of 2"
+                << std::endl;
+          input_state = BadInput;
+        } else {
+          data_alignment = align;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give " << opt << " a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--reuse-setup-data") ) {
+
+      reuse_setup_data = true;
+
+    } else if ( opt == std::string("--pipeline-setup") ) {
+
+      pipeline_setup = true;
+
+    } else if ( opt == std::string("--random-order") ) {
+
+      random_order = true;
+      // optional seed, a random seed otherwise
+      if ( i+1 < argc &&
+           std::isdigit(static_cast<unsigned char>(argv[i+1][0])) ) {
+        i++;
+        random_order_seed = ::strtoull( argv[i], nullptr, 10 );
+      } else {
+        std::random_device rd;
+        random_order_seed = (static_cast<unsigned long long>(rd()) << 32) ^ rd();
+      }
+
+    } else if ( opt == std::string("--sparse-stencil") ) {
+
+      i++;
+      if ( i < argc ) {
+        sparse_stencil = ::atoi( argv[i] );
+        if ( sparse_stencil != 7 && sparse_stencil != 27 ) {
+          getCout() << "\nBad input:"
+                    << " must give --sparse-stencil a value of 7 or 27"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --sparse-stencil a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--histogram-bins") ) {
+
+      i++;
+      if ( i < argc ) {
+        histogram_bins = ::atol( argv[i] );
+        if ( histogram_bins < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --histogram-bins a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --histogram-bins a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--histogram-skew") ) {
+
+      i++;
+      if ( i < argc ) {
+        histogram_skew = ::atof( argv[i] );
+        if ( histogram_skew < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --histogram-skew a non-negative value"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --histogram-skew a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--branch-fraction") ) {
+
+      i++;
+      if ( i < argc ) {
+        branch_fraction = ::atof( argv[i] );
+        if ( branch_fraction < 0.0 || branch_fraction > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --branch-fraction a value in [0, 1]"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --branch-fraction a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--branch-run-length") ) {
+
+      i++;
+      if ( i < argc ) {
+        branch_run_length = ::atol( argv[i] );
+        if ( branch_run_length < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --branch-run-length a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --branch-run-length a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--segment-size") ) {
+
+      i++;
+      if ( i < argc ) {
+        segment_size = ::atol( argv[i] );
+        if ( segment_size < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --segment-size a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --segment-size a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--segment-dist") ) {
+
+      i++;
+      if ( i < argc ) {
+        segment_dist = std::string( argv[i] );
+        if ( segment_dist != "fixed" && segment_dist != "uniform" &&
+             segment_dist != "skewed" ) {
+          getCout() << "\nBad input:"
+                    << " must give --segment-dist one of fixed, uniform,"
+                    << " or skewed"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --segment-dist a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--batched-matrix-size") ) {
+
+      i++;
+      if ( i < argc ) {
+        batched_matrix_size = ::atol( argv[i] );
+        if ( batched_matrix_size < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --batched-matrix-size a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --batched-matrix-size a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--fft-size") ) {
+
+      i++;
+      if ( i < argc ) {
+        fft_size = ::atol( argv[i] );
+        if ( fft_size < 2 || (fft_size & (fft_size-1)) != 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --fft-size a power of two value of at least 2"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --fft-size a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ltimes-num-d") ) {
+
+      i++;
+      if ( i < argc ) {
+        ltimes_num_d = ::atol( argv[i] );
+        if ( ltimes_num_d < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ltimes-num-d a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ltimes-num-d a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ltimes-num-g") ) {
+
+      i++;
+      if ( i < argc ) {
+        ltimes_num_g = ::atol( argv[i] );
+        if ( ltimes_num_g < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ltimes-num-g a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ltimes-num-g a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ltimes-num-m") ) {
+
+      i++;
+      if ( i < argc ) {
+        ltimes_num_m = ::atol( argv[i] );
+        if ( ltimes_num_m < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ltimes-num-m a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ltimes-num-m a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--gather-pattern") ) {
+
+      i++;
+      if ( i < argc ) {
+        gather_pattern = std::string( argv[i] );
+        if ( gather_pattern != "identity" && gather_pattern != "strided" &&
+             gather_pattern != "block_shuffled" && gather_pattern != "random" ) {
+          getCout() << "\nBad input:"
+                    << " must give --gather-pattern one of identity, strided,"
+                    << " block_shuffled, or random"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --gather-pattern a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--gather-block-size") ) {
+
+      i++;
+      if ( i < argc ) {
+        gather_block_size = ::atol( argv[i] );
+        if ( gather_block_size < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --gather-block-size a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --gather-block-size a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--autotune") ) {
+
+      autotune = true;
+
+    } else if ( opt == std::string("--tuning-file") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+        } else {
+          tuning_file = opt;
+        }
+      }
+      if ( tuning_file.empty() ) {
+        getCout() << "\nBad input:"
+                  << " must give --tuning-file a file name (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--tuning-db") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+        } else {
+          tuning_db_file = opt;
+        }
+      }
+      if ( tuning_db_file.empty() ) {
+        getCout() << "\nBad input:"
+                  << " must give --tuning-db a file name (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--compare-to") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+        } else {
+          compare_dir = opt;
+        }
+      }
+      if ( compare_dir.empty() ) {
+        getCout() << "\nBad input:"
+                  << " must give --compare-to a directory name (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--mpi-scaling") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt == MPIScalingToStr(StrongScaling) ) {
+          mpi_scaling = StrongScaling;
+        } else if ( opt == MPIScalingToStr(WeakScaling) ) {
+          mpi_scaling = WeakScaling;
+        } else if ( opt == MPIScalingToStr(NoScaling) ) {
+          mpi_scaling = NoScaling;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --mpi-scaling one of strong, weak, or none"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --mpi-scaling a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--scaling-series") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          scaling_series_dirs.push_back(opt);
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --scaling-series one or more directory names (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--compare-tol") ) {
+
+      i++;
+      if ( i < argc ) {
+        compare_tol = ::atof( argv[i] );
+        if ( compare_tol < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --compare-tol a non-negative value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --compare-tol a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--data-pool") ) {
+
+      use_data_pool = true;
+
+    } else if ( opt == std::string("--gpu-pool-release-threshold") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt == std::string("max") ) {
+          gpu_pool_release_threshold = std::numeric_limits<size_t>::max();
+        } else if ( !opt.empty() && std::isdigit(static_cast<unsigned char>(opt.at(0))) ) {
+          gpu_pool_release_threshold = static_cast<size_t>(::atoll( opt.c_str() ));
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give " << argv[i-1] << " a number of bytes or max"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --gpu-pool-release-threshold a value (int or max)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--gpu_stream_0") ) {
+
+      gpu_stream = 0;
+
+    } else if ( opt == std::string("--gpu-device") ) {
+
+      i++;
+      if ( i < argc ) {
+        gpu_device = ::atoi( argv[i] );
+        if ( gpu_device < 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --gpu-device a non-negative value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --gpu-device a value for the GPU device id (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ranks-per-gpu") ) {
+
+      i++;
+      if ( i < argc ) {
+        ranks_per_gpu = ::atoi( argv[i] );
+        if ( ranks_per_gpu < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ranks-per-gpu a positive value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ranks-per-gpu a value for the number of"
+                  << " MPI ranks sharing each GPU (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--multi-gpu") ) {
+
+      multi_gpu = true;
+
+    } else if ( opt == std::string("--gpu-event-timing") ) {
+
+      gpu_event_timing = true;
+
+    } else if ( opt == std::string("--host-timer") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt == HostTimerToStr(RAJAHostTimer) ) {
+          host_timer = RAJAHostTimer;
+        } else if ( opt == HostTimerToStr(CycleHostTimer) ) {
+          if ( detail::haveCycleCounter() ) {
+            host_timer = CycleHostTimer;
+          } else {
+            getCout() << "\nBad input:"
+                      << " --host-timer cycle needs an x86 cpu with an invariant"
+                      << " time stamp counter or an aarch64 cpu"
+                      << std::endl;
+            input_state = BadInput;
+          }
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --host-timer one of raja or cycle"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --host-timer a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--measure-energy") ) {
+
+      measure_energy = true;
+
+    } else if ( opt == std::string("--resume") ) {
+
+      resume = true;
+
+    } else if ( opt == std::string("--incremental") ) {
+
+      incremental = true;
+      // optional cache file name, the file in the output directory otherwise
+      if ( i+1 < argc && argv[i+1][0] != '-' ) {
+        i++;
+        result_cache_file = std::string( argv[i] );
+      }
+
+    } else if ( opt == std::string("--isolate-kernels") ) {
+
+      isolate_kernels = true;
+
+    } else if ( opt == std::string("--cold-cache") ) {
+
+      cold_cache = true;
+
+    } else if ( opt == std::string("--concurrent-kernels") ) {
+
+      i++;
+      if ( i < argc ) {
+        concurrent_kernels = ::atoi( argv[i] );
+        if ( concurrent_kernels < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --concurrent-kernels a positive value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --concurrent-kernels a value for number of kernels to run concurrently (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--concurrent-mixed") ) {
+
+      concurrent_mixed = true;
+
+    } else if ( opt == std::string("--co-execute") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          co_exec_input.push_back(opt);
+          ++i;
+        }
+      }
+      if ( co_exec_input.size() != 2 ) {
+        getCout() << "\nBad input:"
+                  << " must give --co-execute a CPU and a GPU variant name (strings)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--co-execute-split") ) {
+
+      i++;
+      if ( i < argc ) {
+        co_exec_gpu_fraction = ::atof( argv[i] );
+        if ( co_exec_gpu_fraction <= 0.0 || co_exec_gpu_fraction >= 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --co-execute-split a value between 0 and 1 (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --co-execute-split a value for the GPU part of the problem (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--mpi-gpu-aware") ) {
+
+      mpi_gpu_aware = true;
+
+    } else if ( opt == std::string("--gpu_block_size") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          int gpu_block_size = ::atoi( opt.c_str() );
+          if ( gpu_block_size <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --gpu_block_size POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            gpu_block_sizes.push_back(gpu_block_size);
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --gpu_block_size one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--omptarget-thread-limits") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          int thread_limit = ::atoi( opt.c_str() );
+          if ( thread_limit <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --omptarget-thread-limits POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            omp_target_thread_limits.push_back(thread_limit);
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --omptarget-thread-limits one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--omptarget-num-teams") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          int num_teams = ::atoi( opt.c_str() );
+          if ( num_teams <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --omptarget-num-teams POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            omp_target_num_teams.push_back(num_teams);
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --omptarget-num-teams one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--gpu-shmem-carveouts") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          int carveout = ::atoi( opt.c_str() );
+          if ( carveout < 0 || carveout > 100 ) {
+            getCout() << "\nBad input:"
+                      << " must give --gpu-shmem-carveouts values from 0 to 100 (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            gpu_shmem_carveouts.push_back(carveout);
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --gpu-shmem-carveouts one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--gpu-clocks") ||
+                opt == std::string("--gpu-power-limits") ) {
+
+      const std::string name = opt;
+      const GPUSetting::Kind kind = (name == std::string("--gpu-clocks"))
+          ? GPUSetting::ClockMHz : GPUSetting::PowerLimitWatts;
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          int value = ::atoi( opt.c_str() );
+          if ( value <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give " << name << " positive values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            gpu_settings.push_back(GPUSetting{kind, value});
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give " << name << " one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+      // the sweep report compares the energy of the settings
+      measure_energy = true;
+
+    } else if ( opt == std::string("--omp-threads") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          // values may be separated by commas, ie. 1,2,4,8
+          std::istringstream counts_stream(opt);
+          std::string count_str;
+          while ( std::getline(counts_stream, count_str, ',') ) {
+            int num_threads = ::atoi( count_str.c_str() );
+            if ( num_threads <= 0 ) {
+              getCout() << "\nBad input:"
+                        << " must give --omp-threads POSITIVE values (int)"
+                        << std::endl;
+              input_state = BadInput;
+            } else {
+              omp_thread_counts.push_back(num_threads);
+            }
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --omp-threads one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+      std::sort(omp_thread_counts.begin(), omp_thread_counts.end());
+      omp_thread_counts.erase(std::unique(omp_thread_counts.begin(),
+                                          omp_thread_counts.end()),
+                              omp_thread_counts.end());
+
+    } else if ( opt == std::string("--data-types") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          bool found_it = false;
+          for (int idt = 0; idt < static_cast<int>(DataType::NumDataTypes); ++idt) {
+            DataType dt = static_cast<DataType>(idt);
+            if (getDataTypeName(dt) == opt) {
+              found_it = true;
+              if (std::find(data_types.begin(), data_types.end(), dt) ==
+                  data_types.end()) {
+                data_types.push_back(dt);
+              }
+              break;
+            }
+          }
+          if (!found_it) {
+            getCout() << "\nBad input:"
+                      << " must give --data-types values from"
+                      << " int32, int64, float, double; got " << opt
+                      << std::endl;
+            input_state = BadInput;
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --data-types one or more values (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--storage-precisions") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          bool found_it = false;
+          for (int ip = 1; ip < static_cast<int>(StoragePrecision::NumStoragePrecisions); ++ip) {
+            StoragePrecision precision = static_cast<StoragePrecision>(ip);
+            if (storage::getName(precision) == opt) {
+              found_it = true;
+              if (std::find(storage_precisions.begin(), storage_precisions.end(),
+                            precision) == storage_precisions.end()) {
+                storage_precisions.push_back(precision);
+              }
+              break;
+            }
+          }
+          if (!found_it) {
+            getCout() << "\nBad input:"
+                      << " must give --storage-precisions values from"
+                      << " fp32, bf16; got " << opt
+                      << std::endl;
+            input_state = BadInput;
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --storage-precisions one or more values (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--pass-fail-tol") ||
+                opt == std::string("-pftol") ) {
+
+      i++;
+      if ( i < argc ) {
+        pf_tol = ::atof( argv[i] );
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --pass-fail-tol (or -pftol) a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--reproducible") ) {
+
+      reproducible = true;
+
+    } else if ( opt == std::string("--checksum-once") ) {
+
+      checksum_once = true;
+
+    } else if ( opt == std::string("--fast-math") ) {
+
+      fast_math = true;
+
+    } else if ( opt == std::string("--kernels") ||
+                opt == std::string("-k") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          kernel_input.push_back(opt);
+          ++i;
+        }
+      }
+
+    } else if ( opt == std::string("--load-kernels") ) {
+
+      // libraries were loaded before parsing, skip their names
+      i++;
+      while ( i < argc && argv[i][0] != '-' ) {
+        ++i;
+      }
+      i--;
+
+    } else if ( opt == std::string("--kernel-param") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          kernel_param_input.push_back(opt);
+          ++i;
+        }
+      }
+
+    } else if ( opt == std::string("--exclude-kernels") ||
+                opt == std::string("-ek") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          exclude_kernel_input.push_back(opt);
+          ++i;
         }
       }
 
@@ -528,6 +1990,8 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
                 opt == std::string("-cds") ||
                 opt == std::string("--hip-data-space") ||
                 opt == std::string("-hds") ||
+                opt == std::string("--sycl-data-space") ||
+                opt == std::string("-syds") ||
                 opt == std::string("--kokkos-data-space") ||
                 opt == std::string("-kds") ) {
 
@@ -560,6 +2024,9 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
               } else if ( opt_name == std::string("--hip-data-space") ||
                           opt_name == std::string("-hds") ) {
                 hipDataSpace = ds;
+              } else if ( opt_name == std::string("--sycl-data-space") ||
+                          opt_name == std::string("-syds") ) {
+                syclDataSpace = ds;
               } else if ( opt_name == std::string("--kokkos-data-space") ||
                           opt_name == std::string("-kds") ) {
                 kokkosDataSpace = ds;
@@ -583,6 +2050,219 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
           }
         }
       }
+    } else if ( opt == std::string("--host-page-policy") ) {
+
+      bool got_someting = false;
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+        } else {
+          for (int ihp = 0; ihp < static_cast<int>(HostPagePolicy::NumHostPagePolicies); ++ihp) {
+            HostPagePolicy hp = static_cast<HostPagePolicy>(ihp);
+            if (getHostPagePolicyName(hp) == opt) {
+              got_someting = true;
+              host_page_policy = hp;
+              if (!isHostPagePolicyAvailable(hp)) {
+                getCout() << "\nBad input:"
+                          << " must give --host-page-policy a page policy that is available in this config"
+                          << std::endl;
+                input_state = BadInput;
+              }
+              break;
+            }
+          }
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --host-page-policy one of Default, THP,"
+                  << " Huge2MB, Huge1GB"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--managed-policy") ) {
+
+      bool got_someting = false;
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+        } else {
+          for (int imp = 0; imp < static_cast<int>(ManagedPolicy::NumManagedPolicies); ++imp) {
+            ManagedPolicy mp = static_cast<ManagedPolicy>(imp);
+            if (getManagedPolicyName(mp) == opt) {
+              got_someting = true;
+              managed_policy = mp;
+              if (!isManagedPolicyAvailable(mp)) {
+                getCout() << "\nBad input:"
+                          << " must give --managed-policy a managed policy that is available in this config"
+                          << std::endl;
+                input_state = BadInput;
+              }
+              break;
+            }
+          }
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --managed-policy one of None, Prefetch,"
+                  << " PreferredLocation, ReadMostly"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--count-page-faults") ) {
+
+      count_page_faults = true;
+
+    } else if ( opt == std::string("--track-device-memory") ) {
+
+      track_device_memory = true;
+
+    } else if ( opt == std::string("--gpu-telemetry") ) {
+
+      gpu_telemetry = true;
+
+    } else if ( opt == std::string("--device-activity") ) {
+
+      device_activity = true;
+
+    } else if ( opt == std::string("--trace") ) {
+
+      trace = true;
+
+    } else if ( opt == std::string("--interference") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          bool found_it = false;
+          for (int il = 0; il < NumInterferenceLoads && !found_it; ++il) {
+            InterferenceLoad load = static_cast<InterferenceLoad>(il);
+            if ( opt == InterferenceLoadToStr(load) ) {
+              found_it = true;
+              if ( !hasInterferenceLoad(load) ) {
+                interference_loads.push_back(load);
+              }
+            }
+          }
+          if ( !found_it ) {
+            getCout() << "\nBad input:"
+                      << " unknown --interference load " << opt
+                      << ", must be one of cpu-stream, gpu-stream, or pcie-copy"
+                      << std::endl;
+            input_state = BadInput;
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --interference one or more loads (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--interference-threads") ) {
+
+      i++;
+      if ( i < argc ) {
+        interference_threads = ::atoi( argv[i] );
+        if ( interference_threads <= 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --interference-threads a POSITIVE value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --interference-threads a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--throttle-reruns") ) {
+
+      i++;
+      if ( i < argc ) {
+        throttle_reruns = ::atoi( argv[i] );
+        if ( throttle_reruns < 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --throttle-reruns a non-negative value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --throttle-reruns a value for number of reruns (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--omp-numa-policy") ) {
+
+      bool got_someting = false;
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+        } else {
+          for (int inp = 0; inp < static_cast<int>(NumaPolicy::NumNumaPolicies); ++inp) {
+            NumaPolicy np = static_cast<NumaPolicy>(inp);
+            if (getNumaPolicyName(np) == opt) {
+              got_someting = true;
+              omp_numa_policy = np;
+              if (!isNumaPolicyAvailable(np)) {
+                getCout() << "\nBad input:"
+                          << " must give --omp-numa-policy a NUMA policy that is available in this config"
+                          << std::endl;
+                input_state = BadInput;
+              }
+              break;
+            }
+          }
+          // optional list of NUMA nodes
+          bool done = false;
+          i++;
+          while ( i < argc && !done ) {
+            opt = std::string(argv[i]);
+            if ( opt.at(0) == '-' || !std::isdigit(opt.at(0)) ) {
+              i--;
+              done = true;
+            } else {
+              omp_numa_nodes.push_back( ::atoi( opt.c_str() ) );
+              ++i;
+            }
+          }
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --omp-numa-policy one of FirstTouch,"
+                  << " Interleave, Membind"
+                  << std::endl;
+        input_state = BadInput;
+      } else if (omp_numa_policy == NumaPolicy::FirstTouch &&
+                 !omp_numa_nodes.empty()) {
+        getCout() << "\nBad input:"
+                  << " --omp-numa-policy FirstTouch does not take NUMA nodes"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( std::string(argv[i]) == std::string("--tunings") ||
                 std::string(argv[i]) == std::string("-t") ) {
 
@@ -594,7 +2274,11 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
           i--;
           done = true;
         } else {
-          tuning_input.push_back(opt);
+          if ( opt == std::string("best") ) {
+            run_best_tunings = true;
+          } else {
+            tuning_input.push_back(opt);
+          }
           ++i;
         }
       }
@@ -647,6 +2331,38 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         }
       }
 
+    } else if ( std::string(argv[i]) == std::string("--patterns") ||
+                std::string(argv[i]) == std::string("-pt") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          pattern_input.push_back(opt);
+          ++i;
+        }
+      }
+
+    } else if ( std::string(argv[i]) == std::string("--exclude-patterns") ||
+                std::string(argv[i]) == std::string("-ept") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          exclude_pattern_input.push_back(opt);
+          ++i;
+        }
+      }
+
     } else if ( std::string(argv[i]) == std::string("--outdir") ||
                 std::string(argv[i]) == std::string("-od") ) {
 
@@ -673,6 +2389,18 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         }
       }
 
+    } else if ( std::string(argv[i]) == std::string("--jit-cache-dir") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( !opt.empty() && opt.at(0) == '-' ) {
+          i--;
+        } else {
+          jit_cache_dir = opt;
+        }
+      }
+
     } else if ( std::string(argv[i]) == std::string("--refvar") ||
                 std::string(argv[i]) == std::string("-rv") ) {
 
@@ -692,10 +2420,82 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = DryRun;
       }
 
-    } else if ( std::string(argv[i]) == std::string("--disable-warmup") ) {
-
-      disable_warmup = true;
-
+    } else if ( std::string(argv[i]) == std::string("--estimate-probe") ) {
+
+      i++;
+      if ( i < argc ) {
+        estimate_probe_time = ::atof( argv[i] );
+        if ( estimate_probe_time < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --estimate-probe a non-negative value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --estimate-probe a value in seconds (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( std::string(argv[i]) == std::string("--walltime-budget") ) {
+
+      i++;
+      if ( i < argc ) {
+        walltime_budget = ::atof( argv[i] );
+        if ( walltime_budget < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --walltime-budget a non-negative value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --walltime-budget a value in seconds (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( std::string(argv[i]) == std::string("--disable-warmup") ) {
+
+      disable_warmup = true;
+
+    } else if ( std::string(argv[i]) == std::string("--adaptive-warmup") ) {
+
+      i++;
+      if ( i < argc ) {
+        adaptive_warmup_tol = ::atof( argv[i] );
+        if ( adaptive_warmup_tol <= 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --adaptive-warmup a positive value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --adaptive-warmup a value for the rep time tolerance (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( std::string(argv[i]) == std::string("--adaptive-warmup-max-reps") ) {
+
+      i++;
+      if ( i < argc ) {
+        adaptive_warmup_max_reps = ::atoi( argv[i] );
+        if ( adaptive_warmup_max_reps < 2 ) {
+          getCout() << "\nBad input:"
+                    << " must give --adaptive-warmup-max-reps a value of at least 2 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --adaptive-warmup-max-reps a value for most warmup reps (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( std::string(argv[i]) ==
                 std::string("--allow-problematic-implementations") ) {
 
@@ -723,6 +2523,79 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         }
 
       }
+#if defined(RAJA_PERFSUITE_USE_PAPI)
+    } else if ( opt == std::string("--papi-events") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          papi_events.push_back(opt);
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --papi-events one or more event names (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--validate-bytes") ) {
+
+      validate_bytes = true;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          // event name with optional "*<bytes per count>" suffix
+          size_t star = opt.rfind('*');
+          double scale = 1.0;
+          if ( star != std::string::npos ) {
+            scale = ::atof( opt.substr(star+1).c_str() );
+            opt = opt.substr(0, star);
+          }
+          if ( scale <= 0.0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --validate-bytes events a positive scale (double)"
+                      << std::endl;
+            input_state = BadInput;
+          }
+          bytes_events.push_back(opt);
+          bytes_event_scales.push_back(scale);
+          ++i;
+        }
+      }
+
+    } else if ( opt == std::string("--bytes-tol") ) {
+
+      i++;
+      if ( i < argc ) {
+        bytes_tol = ::atof( argv[i] );
+        if ( bytes_tol < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --bytes-tol a non-negative value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --bytes-tol a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+#endif
+
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
     } else if ( std::string(argv[i]) == std::string("--add-to-spot-config") ||
                std::string(argv[i]) == std::string("-atsc") ) {
@@ -749,20 +2622,186 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
 
   }
 
+  // A size sweep starts at its smallest size
+  if (!size_sweep.empty()) {
+    if (size_meaning != SizeMeaning::Unset) {
+      getCout() << "\nBad input:"
+                << " may only set one of --size-sweep, --size, and --sizefact"
+                << std::endl;
+      input_state = BadInput;
+    }
+    setSize(size_sweep.front());
+  }
+
+  if (memory_fit != SkipMemoryFit && memory_fraction <= 0.0) {
+    getCout() << "\nBad input:"
+              << " --memory-fit requires --memory-fraction"
+              << std::endl;
+    input_state = BadInput;
+  }
+  if (memory_fit == MaxMemoryFit && !size_sweep.empty()) {
+    getCout() << "\nBad input:"
+              << " --memory-fit max can not be used with --size-sweep"
+              << std::endl;
+    input_state = BadInput;
+  }
+
   // Default size and size_meaning if unset
   if (size_meaning == SizeMeaning::Unset) {
     size_meaning = SizeMeaning::Factor;
     size_factor = 1.0;
   }
 
+  // Workers are forked before the device is used, so options that run
+  // kernels in the driver process can not be combined with isolation
+  if (isolate_kernels) {
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    getCout() << "\nBad input:"
+              << " --isolate-kernels is not available with MPI"
+              << std::endl;
+    input_state = BadInput;
+#endif
+    if (autotune || target_time > 0.0 || ci_target > 0.0 ||
+        concurrent_kernels > 1) {
+      getCout() << "\nBad input:"
+                << " --isolate-kernels can not be used with --autotune,"
+                << " --target-time, --ci-target, or --concurrent-kernels"
+                << std::endl;
+      input_state = BadInput;
+    }
+  }
+
+  if (ranks_per_gpu > 0) {
+#if !defined(RAJA_PERFSUITE_ENABLE_MPI)
+    getCout() << "\nBad input:"
+              << " --ranks-per-gpu requires a build with MPI"
+              << std::endl;
+    input_state = BadInput;
+#endif
+    if (gpu_device >= 0 || multi_gpu) {
+      getCout() << "\nBad input:"
+                << " --ranks-per-gpu can not be used with --gpu-device"
+                << " or --multi-gpu"
+                << std::endl;
+      input_state = BadInput;
+    }
+  }
+
+  if (multi_gpu && concurrent_kernels > 1) {
+    getCout() << "\nBad input:"
+              << " --multi-gpu can not be used with --concurrent-kernels"
+              << std::endl;
+    input_state = BadInput;
+  }
+
+  if ((estimate_probe_time > 0.0 || walltime_budget > 0.0) &&
+      (input_state == PerfRun || input_state == CheckRun)) {
+    getCout() << "\nBad input:"
+              << " --estimate-probe and --walltime-budget require --dryrun"
+              << std::endl;
+    input_state = BadInput;
+  }
+
+  if (run_best_tunings && tuning_db_file.empty()) {
+    getCout() << "\nBad input:"
+              << " --tunings best requires --tuning-db"
+              << std::endl;
+    input_state = BadInput;
+  }
+
+  if (!scaling_series_dirs.empty() && mpi_scaling == NoScaling) {
+    getCout() << "\nBad input:"
+              << " --scaling-series requires --mpi-scaling strong or weak"
+              << std::endl;
+    input_state = BadInput;
+  }
+
+  if (adaptive_warmup_tol > 0.0 && isolate_kernels) {
+    getCout() << "\nBad input:"
+              << " --adaptive-warmup can not be used with --isolate-kernels"
+              << std::endl;
+    input_state = BadInput;
+  }
+
+  if (gpu_telemetry && isolate_kernels) {
+    getCout() << "\nBad input:"
+              << " --gpu-telemetry can not be used with --isolate-kernels"
+              << std::endl;
+    input_state = BadInput;
+  }
+
+  if (device_activity) {
+#if !defined(RAJA_PERFSUITE_USE_CUPTI) && !defined(RAJA_PERFSUITE_USE_ROCTRACER)
+    getCout() << "\nBad input:"
+              << " --device-activity requires building with"
+              << " RAJA_PERFSUITE_USE_CUPTI or RAJA_PERFSUITE_USE_ROCTRACER"
+              << std::endl;
+    input_state = BadInput;
+#endif
+    if (isolate_kernels) {
+      getCout() << "\nBad input:"
+                << " --device-activity can not be used with --isolate-kernels"
+                << std::endl;
+      input_state = BadInput;
+    }
+  }
+
+  if (!interference_loads.empty()) {
+#if !defined(RAJA_ENABLE_CUDA) && !defined(RAJA_ENABLE_HIP)
+    if (hasInterferenceLoad(GPUStreamLoad) || hasInterferenceLoad(CopyLoad)) {
+      getCout() << "\nBad input:"
+                << " --interference gpu-stream and pcie-copy require a CUDA"
+                << " or HIP build"
+                << std::endl;
+      input_state = BadInput;
+    }
+#endif
+    if (isolate_kernels) {
+      getCout() << "\nBad input:"
+                << " --interference can not be used with --isolate-kernels"
+                << std::endl;
+      input_state = BadInput;
+    }
+  }
+
+  if (trace && isolate_kernels) {
+    getCout() << "\nBad input:"
+              << " --trace can not be used with --isolate-kernels"
+              << std::endl;
+    input_state = BadInput;
+  }
+
+  // the driver queries free GPU memory, which it may not do before forking
+  if (memory_fraction > 0.0 && isolate_kernels) {
+    getCout() << "\nBad input:"
+              << " --memory-fraction can not be used with --isolate-kernels"
+              << std::endl;
+    input_state = BadInput;
+  }
+
+  if (throttle_reruns > 0 && !gpu_telemetry) {
+    getCout() << "\nBad input:"
+              << " --throttle-reruns must be used with --gpu-telemetry"
+              << std::endl;
+    input_state = BadInput;
+  }
+
   processNpassesCombinerInput();
 
+  processBytesValidationInput();
+
+  processRunPlanInput();
+
   processKernelInput();
 
   processVariantInput();
 
   processTuningInput();
 
+  processCoExecInput();
+
+  processKernelParamInput();
+
   if ( input_state != BadInput &&
        input_state != DryRun && 
        input_state != CheckRun ) {
@@ -795,6 +2834,14 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t --print-kernel-features, -pkf \n"
       << "\t      (print names of features used by each kernel)\n\n";
 
+  str << "\t --print-patterns, -ppt (print names of kernel access patterns)\n\n";
+
+  str << "\t --print-pattern-kernels, -pptk \n"
+      << "\t      (print names of kernels that have each pattern)\n\n";
+
+  str << "\t --print-kernel-patterns, -pkpt \n"
+      << "\t      (print names of patterns of each kernel)\n\n";
+
   str << "\t --print-data-spaces, -pds (print names of data spaces)\n\n";
 
   str << "\t Options for selecting output details....\n"
@@ -804,6 +2851,20 @@ void RunParams::printHelpMessage(std::ostream& str) const
 
   str << "\t --dryrun (print summary of how Suite will run without running it)\n\n";
 
+  str << "\t --estimate-probe <double> [default is 0.0; i.e., use only --tuning-db]\n"
+      << "\t      (with --dryrun, probe each kernel variant tuning to be run for\n"
+      << "\t       at least this many seconds to estimate its time per rep and its\n"
+      << "\t       setUp, checksum, and tearDown times; times per rep in the\n"
+      << "\t       tuning database are used when it has them)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --dryrun --estimate-probe 0.05\n\n";
+
+  str << "\t --walltime-budget <double> [default is 0.0; i.e., no suggestion]\n"
+      << "\t      (with --dryrun, suggest --repfact and per kernel reps so the\n"
+      << "\t       estimated run time of the Suite fits in this many seconds)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --dryrun --tuning-db RAJAPerf-tuning-db.txt --walltime-budget 3600\n\n";
+
   str << "\t --refvar, -rv <string> [Default is none]\n"
       << "\t      (reference variant for speedup calculation)\n\n";
   str << "\t\t Example...\n"
@@ -814,12 +2875,62 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t -pftol 0.2 (RAJA kernel variants that run 20% or more slower than Base variants will be reported as OVER_TOL in FOM report)\n\n";
 
+  str << "\t --reproducible [default is off]\n"
+      << "\t      (write a reproducibility .csv file comparing the checksums of\n"
+      << "\t       the passes of each reproducible tuning of the reduction kernels\n"
+      << "\t       and its time to the fastest tuning of the same variant;\n"
+      << "\t       needs --npasses 2 or more to compare checksums)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --reproducible --npasses 3 --features Reduction\n\n";
+
+  str << "\t --checksum-once [default is checksum every pass]\n"
+      << "\t      (compute the checksum of each array once and keep it with a hash\n"
+      << "\t       of the array bits, later passes only hash the array, on the\n"
+      << "\t       device for device data, and reuse the checksum if the hash\n"
+      << "\t       matches; arrays that differ are checksummed again)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --checksum-once --npasses 10 --size 100000000\n\n";
+
   str << "\t --npasses-combiners <space-separated strings> [Default is 'Average']\n"
       << "\t      (Specify combining npasses timing data into timing files)\n";
   str << "\t\t Example...\n"
       << "\t\t --npasses-combiners Average Minimum Maximum (produce average, min, and\n"
       << "\t\t   max timing .csv files)\n\n";
 
+  str << "\t --timing-batch <int> [default is 0; i.e., no timing distribution report]\n"
+      << "\t      (time each kernel in batches of the given number of reps and\n"
+      << "\t       write per-batch timing statistics to timing distribution .csv file)\n"
+      << "\t      Kernels whose reps index their data by rep number are timed\n"
+      << "\t      as a single batch per pass.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --timing-batch 1 (time every rep of each kernel separately)\n\n";
+
+  str << "\t --timing-hist-bins <int> [default is 10]\n"
+      << "\t      (number of histogram bins in timing distribution .csv file)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --timing-hist-bins 20 (bin timing samples into 20 bins)\n\n";
+
+  str << "\t --timing-barrier-batches <int> [default is 1]\n"
+      << "\t      (with MPI, barrier ranks around groups of the given number\n"
+      << "\t       of --timing-batch batches instead of around every batch,\n"
+      << "\t       batches in a group are synchronized on each rank only;\n"
+      << "\t       0 -> barrier only at the start and end of each pass)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --timing-batch 1 --timing-barrier-batches 0 (time every rep\n"
+      << "\t\t   without barriers between reps)\n\n";
+
+  str << "\t --peak-bandwidth <double> [default is 0.0; i.e., use best measured]\n"
+      << "\t      (machine peak memory bandwidth in GB/s used in roofline .csv file)\n"
+      << "\t      If not given, the highest bandwidth measured for each variant is used.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --peak-bandwidth 2039.0\n\n";
+
+  str << "\t --peak-flops <double> [default is 0.0; i.e., use best measured]\n"
+      << "\t      (machine peak floating point rate in GFLOP/s used in roofline .csv file)\n"
+      << "\t      If not given, the highest rate measured for each variant is used.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --peak-flops 9700.0\n\n";
+
   str << "\t --outdir, -od <string> [Default is current directory]\n"
       << "\t      (directory path for output data files)\n";
   str << "\t\t Examples...\n"
@@ -832,11 +2943,30 @@ void RunParams::printHelpMessage(std::ostream& str) const
       << "\t\t --outfile mydata (output data will be in files 'mydata*')\n"
       << "\t\t -of dat (output data will be in files 'dat*')\n\n";
 
+  str << "\t --jit-cache-dir <string> [Default is rajaperf_jit_cache]\n"
+      << "\t      (directory for the binaries of the GPU jit tunings, kernels\n"
+      << "\t       compiled at run time are loaded from it when the source and\n"
+      << "\t       device match, an empty string disables the disk cache)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --jit-cache-dir /tmp/me/jit\n"
+      << "\t\t --jit-cache-dir \"\" (compile the jit kernels in every run)\n\n";
+
   str << "\t Options for selecting kernels to run....\n"
       << "\t ========================================\n\n";;
 
   str << "\t --disable-warmup (disable warmup kernels) [Default is run warmup kernels that are relevant to kernels selected to run]\n\n";
 
+  str << "\t --adaptive-warmup <double> [default is 0.0; i.e., no adaptive warmup]\n"
+      << "\t      (before the suite passes, run untimed reps of each kernel\n"
+      << "\t       variant tuning until the times of two successive reps differ\n"
+      << "\t       by at most this fraction, and write a warmup .csv file of the\n"
+      << "\t       reps each needed)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --adaptive-warmup 0.05 (warm up until rep times are within 5%)\n\n";
+
+  str << "\t --adaptive-warmup-max-reps <int> [default is 100]\n"
+      << "\t      (most reps run by --adaptive-warmup for one variant tuning)\n\n";
+
   str << "\t --allow-problematic-implementations (allow problematic kernel implementations) [Default is to not allow problematic kernel implementations to run]\n"
       << "\t      These implementations may deadlock causing the code to hang indefinitely.\n\n";
 
@@ -858,6 +2988,21 @@ void RunParams::printHelpMessage(std::ostream& str) const
       << "\t\t -ek INIT3 MULADDSUB (exclude INIT3 and MULADDSUB kernels)\n"
       << "\t\t -ek INIT3 Apps (exclude INIT3 kernel and all kernels in Apps group)\n\n";
 
+  str << "\t --kernel-param <space-separated KERNEL:name=value> [Default is none]\n"
+      << "\t      (set shape parameters of kernels, KERNEL is a full or short kernel name)\n"
+      << "\t      Valid parameters of a kernel are listed when an invalid one is given\n"
+      << "\t      and in the kernel info output.\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --kernel-param LTIMES:num_d=32 LTIMES:num_g=16\n"
+      << "\t\t --kernel-param Comm_HALOEXCHANGE:halo_width=2\n\n";
+
+  str << "\t --load-kernels <space-separated strings> [Default is none]\n"
+      << "\t      (shared libraries of out-of-tree kernels to load, kernels\n"
+      << "\t       registered in them with RAJAPERF_REGISTER_KERNEL join the\n"
+      << "\t       Suite in their own groups and are selected like other kernels)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --load-kernels ./libmy-kernels.so -k MyGroup\n\n";
+
   str << "\t --variants, -v <space-separated strings> [Default is run all]\n"
       << "\t      (names of variants to run)\n"
       << "\t      See '--print-variants'/'-pv' option for list of valid variant names.\n";
@@ -886,6 +3031,20 @@ void RunParams::printHelpMessage(std::ostream& str) const
       << "\t\t --exclude-features Forall (exclude all kernels that use RAJA forall)\n"
       << "\t\t -ef Forall Reduction (exclude all kernels that use RAJA forall or RAJA reductions)\n\n";
 
+  str << "\t --patterns, -pt <space-separated strings> [Default is run all]\n"
+      << "\t      (names of access patterns to run)\n"
+      << "\t      See '--print-kernel-patterns'/'-pkpt' option for list of patterns of kernels.\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --patterns GatherScatter (run all kernels that gather or scatter)\n"
+      << "\t\t -pt Streaming Stencil (run all streaming or stencil kernels)\n\n";
+
+  str << "\t --exclude-patterns, -ept <space-separated strings> [Default is exclude none]\n"
+      << "\t      (names of access patterns to exclude)\n"
+      << "\t      See '--print-kernel-patterns'/'-pkpt' option for list of patterns of kernels.\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --exclude-patterns LatencyBound (exclude all latency bound kernels)\n"
+      << "\t\t -ept ComputeBound ReductionBound (exclude all compute or reduction bound kernels)\n\n";
+
   str << "\t Options for selecting run size....\n"
       << "\t ==================================\n\n";;
 
@@ -901,11 +3060,32 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --npasses 2 (runs complete Suite twice)\n\n";
 
+  str << "\t --ci-target <double> [default is 0; i.e., run npasses only]\n"
+      << "\t      (after npasses, keep running passes of kernels until the 95%\n"
+      << "\t       confidence interval of the mean pass time of each variant\n"
+      << "\t       tuning is within the given fraction of the mean)\n"
+      << "\t      At least 2 passes are run, see also --max-npasses.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ci-target 0.02 (run until intervals are within +-2% of means)\n\n";
+
+  str << "\t --max-npasses <int> [default is 100]\n"
+      << "\t      (max num passes through Suite when running with --ci-target)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --max-npasses 20\n\n";
+
   str << "\t --repfact <double> [default is 1.0]\n"
       << "\t      (multiplier on default # reps to run each kernel)\n";
   str << "\t\t Example...\n"
       << "\t\t --repfact 0.5 (run each kernels 1/2 as many times as its default reps)\n\n";
 
+  str << "\t --target-time <double> [default is 0.0; i.e., use --repfact]\n"
+      << "\t      (target run time in seconds of each kernel variant in a pass)\n"
+      << "\t      Reps of each kernel are calibrated with short probe runs before running Suite\n"
+      << "\t      so its slowest variant runs for about the target time.\n"
+      << "\t      Ignored if '--checkrun' is given.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --target-time 0.5 (run each kernel variant for at most about 0.5 sec. per pass)\n\n";
+
   str << "\t --sizefact <double> [default is 1.0]\n"
       << "\t      (fraction of default kernel sizes to run)\n"
       << "\t      May not be set if '--size' is set.\n";
@@ -918,12 +3098,150 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --size 1000000 (runs each kernel with size ~1,000,000)\n\n";
 
+  str << "\t --size-sweep <min:max:ratio> [no default]\n"
+      << "\t      (run all kernels at sizes min, min*ratio, ... up to max in one\n"
+      << "\t       process and write time and bandwidth vs. size to a size sweep\n"
+      << "\t       .csv file, other output files are for the largest size run)\n"
+      << "\t      May not be set if --size or --sizefact is set.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --size-sweep 10000:1000000:2 (runs sizes 10K, 20K, ..., 640K)\n\n";
+
+  str << "\t --memory-fraction <double> [default is no bound]\n"
+      << "\t      (fraction in (0, 1] of free GPU memory, for GPU variants, and of\n"
+      << "\t       physical host memory, for other variants, each kernel may use;\n"
+      << "\t       the footprint of each kernel is estimated from the bytes its\n"
+      << "\t       variants touch per rep before it is set up, kernels over the\n"
+      << "\t       bound are handled as given by --memory-fit and listed in a\n"
+      << "\t       memory fit .csv file)\n\n";
+
+  str << "\t --memory-fit <string> [default is skip]\n"
+      << "\t      (what is done with kernels with --memory-fraction; one of\n"
+      << "\t       skip: kernels over the bound are not run,\n"
+      << "\t       downsize: kernels over the bound run at the largest size that fits,\n"
+      << "\t       max: every kernel runs at the largest size that fits)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --memory-fraction 0.8 --memory-fit max (capacity sweep using 80%\n"
+      << "\t\t   of memory for each kernel)\n\n";
+
+  str << "\t --run-plan <string> [default is none]\n"
+      << "\t      (file with lines '<kernel> [size=<int>] [reps=<int>]\n"
+      << "\t       [weight=<int>] [tunings=<tuning>,...]' run in file order in one\n"
+      << "\t       process, each line with its own size, reps, and tunings, text\n"
+      << "\t       after # is ignored; kernels are given by full name and may be\n"
+      << "\t       repeated; weight is used by --app-proxy)\n"
+      << "\t      Unset values use the command line options. May not be set with\n"
+      << "\t      --kernels, --size-sweep, --isolate-kernels, or --concurrent-kernels.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --run-plan production-plan.txt\n\n";
+
+  str << "\t --app-proxy <int> [default is 0; i.e., no app proxy run]\n"
+      << "\t      (after the suite passes, run this many cycles of the --run-plan\n"
+      << "\t       kernels interleaved, each cycle running each kernel for\n"
+      << "\t       weight=<int> reps of its plan line, default 1, and write a .csv\n"
+      << "\t       file of the predicted time per cycle)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --run-plan app-plan.txt --app-proxy 10\n\n";
+
   str << "\t Options for selecting GPU execution details....\n"
       << "\t ===============================================\n\n";;
 
   str << "\t --gpu_stream_0 [default is to use RAJA default stream]\n"
       << "\t      (when this option is given, use stream 0 with HIP and CUDA kernel variants)\n\n";
 
+  str << "\t --gpu-device <int> [Default is local MPI rank mod number of GPUs with MPI,\n"
+      << "\t                     the default device otherwise]\n"
+      << "\t      (run HIP and CUDA kernel variants on the GPU with the given device id)\n\n";
+
+  str << "\t --ranks-per-gpu <int> [Default is one GPU per local MPI rank]\n"
+      << "\t      (bind each group of <int> consecutive local MPI ranks to one GPU,\n"
+      << "\t       ie. when sharing GPUs with MPS or running on partitioned GPUs,\n"
+      << "\t       and write the aggregate and per-rank throughput on each GPU)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ranks-per-gpu 4 (with 8 ranks on a node with 2 GPUs, local\n"
+      << "\t\t   ranks 0-3 share GPU 0 and local ranks 4-7 share GPU 1)\n\n";
+
+  str << "\t --multi-gpu [default is one GPU per process]\n"
+      << "\t      (when this option is given, Base HIP and CUDA variants of the Stream\n"
+      << "\t       kernels partition their arrays over all visible GPUs, each GPU\n"
+      << "\t       runs its partition on its own stream, and times are for all GPUs)\n\n";
+
+  str << "\t --gpu-event-timing [default is host timer only]\n"
+      << "\t      (when this option is given, also time HIP and CUDA kernel variants with\n"
+      << "\t       GPU events recorded on the kernel stream and write device timing .csv files)\n\n";
+
+  str << "\t --host-timer <string> [default is raja]\n"
+      << "\t      (host timer for timed regions; one of\n"
+      << "\t       raja: RAJA::Timer as configured in RAJA,\n"
+      << "\t       cycle: the cpu cycle counter, tsc on x86 or cntvct_el0 on aarch64,\n"
+      << "\t       with calibrated frequency and the timer overhead subtracted)\n"
+      << "\t      The run summary reports the resolution and overhead of the timer.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --host-timer cycle --checkrun 10\n\n";
+
+  str << "\t --resume [default is to run all passes]\n"
+      << "\t      (when this option is given, read the progress .jsonl file of an\n"
+      << "\t       interrupted run with the same output directory and file prefix\n"
+      << "\t       and skip the kernel variant tuning passes it completed)\n\n";
+
+  str << "\t --incremental [<filename>] [default is to run all passes]\n"
+      << "\t      (when this option is given, reuse the passes in the result cache\n"
+      << "\t       .jsonl file whose key did not change and run the others, the\n"
+      << "\t       key hashes the object code of the kernel, the RAJA version and\n"
+      << "\t       build, the options other than kernel selection and output, the\n"
+      << "\t       data space, and the node hardware, the passes run are added to\n"
+      << "\t       the file, <outdir>/<outfile>-cache.jsonl by default)\n"
+      << "\t      Reused passes are in all reports as if they were run.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --incremental results/cache.jsonl -k Basic_DAXPY\n\n";
+
+  str << "\t --cold-cache [default is warm cache timing only]\n"
+      << "\t      (when this option is given, also time the reps of each kernel\n"
+      << "\t       variant tuning pass with the host caches and GPU L2 cache\n"
+      << "\t       flushed before each rep, the flushes are not timed and a\n"
+      << "\t       .csv file with warm and cold cache times is written)\n\n";
+
+  str << "\t --isolate-kernels [default is to run all kernels in this process]\n"
+      << "\t      (when this option is given, run each pass of each kernel in a\n"
+      << "\t       forked worker process with a fresh address space and device\n"
+      << "\t       context, results are sent back to the driver over a pipe;\n"
+      << "\t       not available with MPI, --autotune, --target-time,\n"
+      << "\t       --ci-target, or --concurrent-kernels)\n\n";
+
+  str << "\t --measure-energy [default is no energy measurement]\n"
+      << "\t      (when this option is given, read CPU package (RAPL) and GPU\n"
+      << "\t       (NVML, AMD SMI) energy meters around each timed kernel region\n"
+      << "\t       and write joules per rep and GFLOP/s per watt to an energy .csv file)\n\n";
+
+  str << "\t --concurrent-kernels <int> [default is 1; i.e., no concurrent runs]\n"
+      << "\t      (after the suite passes, also run this many instances of each\n"
+      << "\t       HIP and CUDA kernel variant tuning concurrently, each on its own\n"
+      << "\t       stream, and write a .csv file comparing concurrent to serial time)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --concurrent-kernels 4 (run 4 instances of each kernel at once)\n\n";
+
+  str << "\t --concurrent-mixed [default is run instances of the same kernel]\n"
+      << "\t      (with --concurrent-kernels, run groups of different kernels\n"
+      << "\t       concurrently, grouping kernels in the order they are run)\n\n";
+
+  str << "\t --co-execute <space-separated strings> [default is none]\n"
+      << "\t      (after the suite passes, also run a CPU variant and a GPU\n"
+      << "\t       variant of each kernel at the same time, each on its part of\n"
+      << "\t       the problem in its own data space, and write a .csv file of the\n"
+      << "\t       combined throughput and the slowdown of each side; both\n"
+      << "\t       variants must be run)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --co-execute Base_OpenMP Base_CUDA\n\n";
+
+  str << "\t --co-execute-split <double> [default is 0.5]\n"
+      << "\t      (part of the problem of each kernel run by the GPU variant\n"
+      << "\t       of --co-execute, the CPU variant runs the rest)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --co-execute-split 0.8\n\n";
+
+  str << "\t --mpi-gpu-aware [default is stage GPU messages through host memory]\n"
+      << "\t      (pass GPU data directly to MPI in kernels that send messages,\n"
+      << "\t       ie. MPI_HALOEXCHANGE; requires a GPU-aware MPI library)\n\n";
+
   str << "\t --gpu_block_size <space-separated ints> [no default]\n"
       << "\t      (block sizes to run for all GPU kernels)\n"
       << "\t      GPU kernels not supporting gpu_block_size option will be skipped.\n"
@@ -932,12 +3250,82 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --gpu_block_size 128 256 512 (runs kernels with gpu_block_size 128, 256, and 512)\n\n";
 
+  str << "\t --omptarget-thread-limits <space-separated ints> [no default]\n"
+      << "\t      (also run each Base OpenMP target tuning with each thread_limit,\n"
+      << "\t       appending _tl_<n> to the tuning name)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --omptarget-thread-limits 64 128 512\n\n";
+
+  str << "\t --omptarget-num-teams <space-separated ints> [no default]\n"
+      << "\t      (also run each Base OpenMP target tuning with each num_teams,\n"
+      << "\t       appending _nt_<n> to the tuning name, the other tunings leave\n"
+      << "\t       the number of teams to the compiler)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --omptarget-num-teams 110 220 440\n\n";
+
+  str << "\t --gpu-shmem-carveouts <space-separated ints> [no default]\n"
+      << "\t      (also run each Base CUDA tuning of kernels using shared memory\n"
+      << "\t       with each preferred shared memory carve-out, in percent of the\n"
+      << "\t       unified L1 and shared memory of an SM, appending _carveout_<n>\n"
+      << "\t       to the tuning name)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --gpu-shmem-carveouts 0 50 100\n\n";
+
+  str << "\t --gpu-clocks <space-separated ints> [no default]\n"
+      << "\t      (also run each GPU tuning with the GPU clock capped at each\n"
+      << "\t       clock in MHz, appending _clk_<n> to the tuning name; needs\n"
+      << "\t       NVML or AMD SMI and permission to set clocks, implies\n"
+      << "\t       --measure-energy; writes a time and energy report with the\n"
+      << "\t       Pareto front of each tuning, ie. <prefix>-gpu-sweep.csv)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --gpu-clocks 1410 1200 990\n\n";
+
+  str << "\t --gpu-power-limits <space-separated ints> [no default]\n"
+      << "\t      (also run each GPU tuning with the GPU power limit set to each\n"
+      << "\t       limit in watts, appending _pwr_<n> to the tuning name; like\n"
+      << "\t       --gpu-clocks, settings run in the order given)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --gpu-power-limits 400 300 200\n\n";
+
+  str << "\t --omp-threads <space or comma-separated ints> [no default]\n"
+      << "\t      (run each OpenMP tuning with each number of threads,\n"
+      << "\t       appending _thr_<n> to the tuning name, data is first touched\n"
+      << "\t       with the same number of threads; writes a speedup and\n"
+      << "\t       parallel efficiency report, ie. <prefix>-omp-scaling.csv)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --omp-threads 1,2,4,8,16,32\n\n";
+
+  str << "\t --data-types <space-separated strings> [Default is Real_type only]\n"
+      << "\t      (element data types to run kernels templated on data type,\n"
+      << "\t       ie. Algorithm, Stream, DAXPY, MULADDSUB, with; one of int32,\n"
+      << "\t       int64, float, double. Kernels skip types they do not support.\n"
+      << "\t       The name of each data type is appended to tuning names.)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --data-types int32 double (runs kernels with int32 and double data)\n\n";
+
+  str << "\t --storage-precisions <space-separated strings> [Default is none]\n"
+      << "\t      (precisions to also run the Base variants of kernels with\n"
+      << "\t       storage tunings, ie. Stream_TRIAD, Apps_PRESSURE, Sparse_SPMV,\n"
+      << "\t       with; one of fp32, bf16. The arrays are stored in the narrower\n"
+      << "\t       type and storage_<name> is the tuning name. Their checksums\n"
+      << "\t       differ from the reference by the error of the narrower type.)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --storage-precisions fp32 bf16\n\n";
+
+  str << "\t --fast-math [Default is off]\n"
+      << "\t      (also run the fast_math tunings of Lcals_PLANCKIAN, Apps_ENERGY,\n"
+      << "\t       and Basic_TRAP_INT, which compute math functions in single\n"
+      << "\t       precision. Their checksums differ from the reference.)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --fast-math -k Lcals_PLANCKIAN\n\n";
+
   str << "\t --tunings, -t <space-separated strings> [Default is run all]\n"
       << "\t      (names of tunings to run)\n"
       << "\t      Note: knowing which tunings are available requires knowledge about the variants,\n"
       << "\t      since available tunings depend on the given variant (and potentially other args).\n";
   str << "\t\t Examples...\n"
       << "\t\t --tunings default (run all default tunings)\n"
+      << "\t\t --tunings best (run the best tuning in the --tuning-db file)\n"
       << "\t\t -t default block_128 (run default and block_128 tunings)\n\n";
 
   str << "\t --exclude-tunings, -et <space-separated strings> [Default is exclude none]\n"
@@ -956,6 +3344,187 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t -align 4096 (allocates memory aligned to 4KiB boundaries)\n\n";
 
+  str << "\t --reuse-setup-data [default is initialize data for each variant and tuning]\n"
+      << "\t      (initialize kernel data once per data space and copy it into place\n"
+      << "\t       for each variant and tuning of the kernel that uses that data space)\n"
+      << "\t      Uses additional memory to hold a copy of the initial kernel data.\n\n";
+
+  str << "\t --pipeline-setup [default is set up each kernel after the one before it]\n"
+      << "\t      (set up the first variant and tuning of the next kernel on another\n"
+      << "\t       host thread while the last one of the current kernel checks its\n"
+      << "\t       results and tears down, never during a timed region)\n"
+      << "\t      Holds the data of two kernels at once. Ignored with --isolate-kernels,\n"
+      << "\t      --cold-cache, --resume, --random-order, or more than one MPI rank.\n\n";
+
+  str << "\t --random-order [<unsigned int>] [default is run kernels, variants, and\n"
+      << "\t       tunings in the same order each pass]\n"
+      << "\t      (shuffle the order of kernels in each pass, and the order of the\n"
+      << "\t       variant tunings of each kernel, so clock, thermal, and cache state\n"
+      << "\t       left by earlier runs do not favor some of them. The optional value\n"
+      << "\t       seeds the shuffles, a random seed is used otherwise; the seed is\n"
+      << "\t       reported with the run so the order can be repeated)\n"
+      << "\t      Disables --pipeline-setup.\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --random-order (random seed)\n"
+      << "\t\t --random-order 42 (repeatable order)\n\n";
+
+  str << "\t --sparse-stencil <int> [default is 27]\n"
+      << "\t      (number of points in the 3D Laplacian stencil used to generate\n"
+      << "\t       the matrices of Sparse kernels, 7 or 27)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --sparse-stencil 7\n\n";
+
+  str << "\t --histogram-bins <int> [default is 1024]\n"
+      << "\t      (number of bins of the HISTOGRAM kernel, eg. 16 to 1048576)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --histogram-bins 1048576\n\n";
+
+  str << "\t --histogram-skew <double> [default is 0.0]\n"
+      << "\t      (Zipf exponent of the distribution of elements over the bins\n"
+      << "\t       of the HISTOGRAM kernel, 0.0 is uniform and larger values\n"
+      << "\t       put more elements in fewer bins)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --histogram-skew 1.0\n\n";
+
+  str << "\t --branch-fraction <double> [default is kernel data]\n"
+      << "\t      (fraction of elements of conditional kernels, ie. IF_QUAD,\n"
+      << "\t       that take the branch, in [0, 1]; by default IF_QUAD takes\n"
+      << "\t       the branch for about half of its elements at random)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --branch-fraction 0.9\n\n";
+
+  str << "\t --branch-run-length <int> [default is 1]\n"
+      << "\t      (number of consecutive elements of conditional kernels that\n"
+      << "\t       take the same branch when --branch-fraction is given,\n"
+      << "\t       1 picks each element independently and larger values make\n"
+      << "\t       the branches of neighboring elements agree)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --branch-run-length 32\n\n";
+
+  str << "\t --segment-size <int> [default is 64]\n"
+      << "\t      (mean segment length of the segmented kernels)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --segment-size 1000\n\n";
+
+  str << "\t --segment-dist <string> [default is uniform]\n"
+      << "\t      (distribution of segment lengths of the segmented kernels,\n"
+      << "\t       fixed, uniform in [1, 2*size-1], or skewed with most\n"
+      << "\t       segments short and a few very long)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --segment-dist skewed\n\n";
+
+  str << "\t --batched-matrix-size <int> [default is 16]\n"
+      << "\t      (number of rows and columns of each matrix of the batched\n"
+      << "\t       dense kernels, the problem size sets the number of matrices)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --batched-matrix-size 64\n\n";
+
+  str << "\t --fft-size <int> [default is 1024]\n"
+      << "\t      (length of each transform of the batched 1D FFT kernel,\n"
+      << "\t       a power of two, the problem size sets the number of transforms)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --fft-size 4096\n\n";
+
+  str << "\t --ltimes-num-d <int> [default is 64]\n"
+      << "\t      (number of directions of the LTIMES kernels,\n"
+      << "\t       the problem size sets the number of zones)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ltimes-num-d 48\n\n";
+
+  str << "\t --ltimes-num-g <int> [default is 32]\n"
+      << "\t      (number of energy groups of the LTIMES kernels)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ltimes-num-g 64\n\n";
+
+  str << "\t --ltimes-num-m <int> [default is 25]\n"
+      << "\t      (number of moments of the LTIMES kernels)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ltimes-num-m 16\n\n";
+
+  str << "\t --gather-pattern <string> [default is random]\n"
+      << "\t      (index pattern of the gather and scatter kernels, identity,\n"
+      << "\t       strided, block_shuffled blocks of contiguous indices in\n"
+      << "\t       random order, or a random permutation)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --gather-pattern block_shuffled\n\n";
+
+  str << "\t --gather-block-size <int> [default is 64]\n"
+      << "\t      (stride of the strided and block length of the\n"
+      << "\t       block_shuffled gather index patterns)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --gather-block-size 4096\n\n";
+
+  str << "\t --autotune [default is run all GPU block size tunings]\n"
+      << "\t      (search the block size tunings, ie. block_<size> or occgs_<size>,\n"
+      << "\t       of each GPU variant for the fastest one with short probe runs,\n"
+      << "\t       pruning slow tunings early, and run only that one afterwards)\n"
+      << "\t      The chosen tunings are written to an autotune file that can be\n"
+      << "\t      given to --tuning-file in later runs.\n\n";
+
+  str << "\t --tuning-file <string> [default is none]\n"
+      << "\t      (file with lines '<kernel> <variant> <tuning>' naming the tunings\n"
+      << "\t       to run for a kernel and variant, ie. an autotune file)\n"
+      << "\t      Kernels and variants not in the file run all selected tunings.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --tuning-file RAJAPerf-autotune.txt\n\n";
+
+  str << "\t --tuning-db <string> [default is none]\n"
+      << "\t      (tuning database file of the best tuning by kernel, variant,\n"
+      << "\t       data type, power of two size bucket, and GPU model; every\n"
+      << "\t       run writes the database merged with the fastest tuning of\n"
+      << "\t       each kernel variant that ran more than one tuning to a tuning\n"
+      << "\t       database file. With --tunings best only the best tuning of\n"
+      << "\t       each kernel variant in the database is run)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --tuning-db ./sweep/RAJAPerf-tuning-db.txt --tunings best\n\n";
+
+  str << "\t --compare-to <string> [default is none]\n"
+      << "\t      (output directory of a previous run to compare run times to;\n"
+      << "\t       its run data file with the same file prefix is read and the\n"
+      << "\t       ratios of min times are written to a regression report file)\n"
+      << "\t      The Suite exits with a nonzero status when a kernel variant\n"
+      << "\t      tuning is slower than the previous run beyond tolerance.\n";
+  str << "\t\t Example...\n"
+      << "\t\t --compare-to ./nightly/2023-08-01\n\n";
+
+  str << "\t --mpi-scaling <string> [default is none]\n"
+      << "\t      (how the problem size is split over MPI ranks; one of\n"
+      << "\t       strong: the size is the global size, each rank runs its share,\n"
+      << "\t       weak: the size is the size of each rank,\n"
+      << "\t       none: every rank runs the size on its own)\n"
+      << "\t      With strong or weak, an MPI scaling report file lists the\n"
+      << "\t      scaling efficiency of this run and the --scaling-series runs.\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --mpi-scaling strong --size 8e8\n"
+      << "\t\t --mpi-scaling weak --size 1e8\n\n";
+
+  str << "\t --scaling-series <space-separated strings> [default is none]\n"
+      << "\t      (output directories of earlier runs of a scaling series, ie.\n"
+      << "\t       on fewer nodes; their run data files with the same file\n"
+      << "\t       prefix are read into the MPI scaling report)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --scaling-series ./scaling/nodes_1 ./scaling/nodes_2\n\n";
+
+  str << "\t --compare-tol <double> [default is 0.1; i.e., 10%]\n"
+      << "\t      (slowdown tolerance vs. the previous run given to --compare-to,\n"
+      << "\t       added to the relative npasses spread of min to max times of\n"
+      << "\t       the two runs)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --compare-tol 0.05\n\n";
+
+  str << "\t --data-pool [default is allocate and free kernel data directly]\n"
+      << "\t      (cache freed kernel data in a pool for each data space and reuse it\n"
+      << "\t       for later allocations; pool statistics are written to a report file)\n"
+      << "\t      Memory held by the pool is only released at the end of the run.\n\n";
+
+  str << "\t --gpu-pool-release-threshold <int or max> [default is 0]\n"
+      << "\t      (bytes of freed memory the default memory pool of the GPU keeps\n"
+      << "\t       for later allocations when the device or a stream synchronizes,\n"
+      << "\t       used by the CudaDeviceAsync and HipDeviceAsync data spaces)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --gpu-pool-release-threshold 1073741824 (keep up to 1GiB)\n"
+      << "\t\t --gpu-pool-release-threshold max (never release memory)\n\n";
+
   str << "\t --seq-data-space, -sds <string> [Default is Host]\n"
       << "\t      (name of data space to use for sequential variants)\n"
       << "\t      Valid data space names are 'Host' or 'CudaPinned'\n";
@@ -970,26 +3539,121 @@ void RunParams::printHelpMessage(std::ostream& str) const
       << "\t\t --omp-data-space Omp (run Omp variants with Omp memory)\n"
       << "\t\t -ods Host (run Omp variants with Host memory)\n\n";
 
+  str << "\t --host-page-policy <string> [Default is Default]\n"
+      << "\t      (page size policy used to allocate Host and Omp data space memory;\n"
+      << "\t       one of Default, THP (transparent huge pages with madvise),\n"
+      << "\t       Huge2MB, Huge1GB (explicit huge pages with MAP_HUGETLB))\n"
+      << "\t      Huge2MB and Huge1GB need huge pages reserved on the node.\n"
+      << "\t      Allocations smaller than a huge page use default pages.\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --host-page-policy THP (ask for transparent huge pages)\n"
+      << "\t\t --host-page-policy Huge1GB (map kernel data with 1GiB pages)\n\n";
+
+  str << "\t --managed-policy <string> [Default is None]\n"
+      << "\t      (policy applied to managed data of CUDA and HIP variants after\n"
+      << "\t       setUp and before the timed region; one of None, Prefetch\n"
+      << "\t       (prefetch to the device), PreferredLocation (advise the device\n"
+      << "\t       as preferred location), ReadMostly (advise read mostly))\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --cuda-data-space CudaManaged --managed-policy Prefetch\n\n";
+
+  str << "\t --count-page-faults [default is no page fault counting]\n"
+      << "\t      (when this option is given, count the host page faults in the\n"
+      << "\t       timed region of each kernel variant tuning and write a\n"
+      << "\t       page faults .csv file)\n\n";
+
+  str << "\t --track-device-memory [default is no device memory tracking]\n"
+      << "\t      (when this option is given, track the device memory high-water\n"
+      << "\t       of each GPU variant tuning, of data allocated by the suite and\n"
+      << "\t       of all device memory in use, including library temporaries,\n"
+      << "\t       and write a device memory .csv file)\n\n";
+
+  str << "\t --gpu-telemetry [default is no GPU telemetry]\n"
+      << "\t      (when this option is given, sample the clocks, temperature,\n"
+      << "\t       power, and throttle reasons of the GPU (NVML, AMD SMI) around\n"
+      << "\t       the timed region of each GPU variant tuning, warn about passes\n"
+      << "\t       taken while throttled, and write a GPU telemetry .csv file)\n\n";
+
+  str << "\t --throttle-reruns <int> [default is 0; i.e., only warn]\n"
+      << "\t      (with --gpu-telemetry, run a pass taken while the GPU was\n"
+      << "\t       throttled again, discarding its results, up to this many times)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --gpu-telemetry --throttle-reruns 3\n\n";
+
+  str << "\t --device-activity [default is no device activity tracing]\n"
+      << "\t      (when this option is given, trace the kernels, copies, and\n"
+      << "\t       memsets the GPU runs (CUPTI, roctracer) in the timed region\n"
+      << "\t       of each GPU variant tuning, and write a device activity .csv\n"
+      << "\t       file splitting the time per rep into device busy time and\n"
+      << "\t       host side time)\n\n";
+
+  str << "\t --trace [default is no trace]\n"
+      << "\t      (when this option is given, record the warmup, setUp, reps or\n"
+      << "\t       rep batches, checksum, and tearDown of each kernel variant\n"
+      << "\t       tuning on a timeline, with device operations when given with\n"
+      << "\t       --device-activity, and write it to a Chrome trace .json file\n"
+      << "\t       that can be loaded in Perfetto)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --trace --timing-batch 10 (trace batches of 10 reps)\n\n";
+
+  str << "\t --interference <space-separated strings> [default is none]\n"
+      << "\t      (background loads to run each kernel variant tuning again\n"
+      << "\t       alongside after the suite passes, and write an interference\n"
+      << "\t       .csv file with the slowdown of each under the load; one or\n"
+      << "\t       more of cpu-stream (Stream_TRIAD Base_Seq threads bound to\n"
+      << "\t       the last cores of the process), gpu-stream (Stream_TRIAD on\n"
+      << "\t       its own GPU stream), and pcie-copy (host to device copies\n"
+      << "\t       and back))\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --interference cpu-stream --interference-threads 4\n"
+      << "\t\t --interference gpu-stream pcie-copy\n\n";
+
+  str << "\t --interference-threads <int> [default is 1]\n"
+      << "\t      (number of bandwidth streaming threads of the cpu-stream\n"
+      << "\t       interference load)\n\n";
+
+  str << "\t --omp-numa-policy <string> [<space-separated ints>] [Default is FirstTouch]\n"
+      << "\t      (NUMA policy used to place pages of Omp data space memory; one of\n"
+      << "\t       FirstTouch, Interleave, Membind, optionally followed by the NUMA\n"
+      << "\t       nodes Interleave or Membind use; default is all allowed nodes)\n"
+      << "\t      FirstTouch places pages by touching them with the static schedule\n"
+      << "\t      of the OpenMP kernels. Interleave and Membind are Linux only.\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --omp-numa-policy Interleave (interleave pages across all nodes)\n"
+      << "\t\t --omp-numa-policy Membind 1 (allocate pages on node 1)\n\n";
+
   str << "\t --omptarget-data-space, -otds <string> [Default is OmpTarget]\n"
       << "\t      (names of data space to use for OpenMP Target variants)\n"
-      << "\t      Valid data space names are 'OmpTarget' or 'CudaPinned'\n";
+      << "\t      Valid data space names are 'OmpTarget', 'OmpTargetSystem',\n"
+      << "\t      or 'CudaPinned'\n";
   str << "\t\t Examples...\n"
       << "\t\t --omptarget-data-space OmpTarget (run Omp Target variants with Omp Target memory)\n"
       << "\t\t -otds CudaPinned (run Omp Target variants with Cuda Pinned memory)\n\n";
 
   str << "\t --cuda-data-space, -cds <string> [Default is CudaDevice]\n"
       << "\t      (names of data space to use for CUDA variants)\n"
-      << "\t      Valid data space names are 'CudaDevice', 'CudaPinned', or 'CudaManaged'\n";
+      << "\t      Valid data space names are 'CudaDevice', 'CudaDeviceAsync',\n"
+      << "\t      'CudaPinned', 'CudaManaged', or 'CudaSystem'\n";
   str << "\t\t Examples...\n"
       << "\t\t --cuda-data-space CudaManaged (run CUDA variants with Cuda Managed memory)\n"
-      << "\t\t -cds CudaPinned (run CUDA variants with Cuda Pinned memory)\n\n";
+      << "\t\t -cds CudaPinned (run CUDA variants with Cuda Pinned memory)\n"
+      << "\t\t -cds CudaSystem (run CUDA variants with system allocated memory)\n\n";
 
   str << "\t --hip-data-space, -hds <string> [Default is HipDevice]\n"
       << "\t      (names of data space to use for HIP variants)\n"
-      << "\t      Valid data space names are 'HipDevice', 'HipPinned', or 'HipManaged'\n";
+      << "\t      Valid data space names are 'HipDevice', 'HipDeviceAsync',\n"
+      << "\t      'HipPinned', 'HipManaged', or 'HipSystem'\n";
   str << "\t\t Examples...\n"
       << "\t\t --hip-data-space HipManaged (run HIP variants with Hip Managed memory)\n"
-      << "\t\t -hds HipPinned (run HIP variants with Hip Pinned memory)\n\n";
+      << "\t\t -hds HipPinned (run HIP variants with Hip Pinned memory)\n"
+      << "\t\t -hds HipSystem (run HIP variants with system allocated memory)\n\n";
+
+  str << "\t --sycl-data-space, -syds <string> [Default is SyclDevice]\n"
+      << "\t      (names of data space to use for SYCL variants)\n"
+      << "\t      Valid data space names are 'SyclDevice', 'SyclPinned', or 'SyclManaged'\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --sycl-data-space SyclManaged (run SYCL variants with Sycl shared USM memory)\n"
+      << "\t\t -syds SyclPinned (run SYCL variants with Sycl host USM memory)\n\n";
 
   str << "\t --kokkos-data-space, -kds <string> [Default is Host]\n"
       << "\t      (names of data space to use)\n";
@@ -997,6 +3661,31 @@ void RunParams::printHelpMessage(std::ostream& str) const
       << "\t\t --kokkos-data-space Host (run KOKKOS variants with Host memory)\n"
       << "\t\t -kds HipPinned (run KOKKOS variants with Hip Pinned memory)\n\n";
 
+#if defined(RAJA_PERFSUITE_USE_PAPI)
+  str << "\t --papi-events <space-separated strings> [Default is none]\n"
+      << "\t      (PAPI events to count around each timed kernel region and\n"
+      << "\t       write per rep to a counters .csv file; see papi_avail and\n"
+      << "\t       papi_native_avail for names, cuda::: and rocm::: events count\n"
+      << "\t       GPU metrics)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --papi-events PAPI_TOT_INS PAPI_L3_TCM\n"
+      << "\t\t --papi-events cuda:::dram__bytes_read.sum:device=0\n\n";
+
+  str << "\t --validate-bytes [<space-separated strings>] [Default is none]\n"
+      << "\t      (count PAPI events giving DRAM traffic, each given as name or\n"
+      << "\t       name*<bytes per count>, and compare their sum per rep to the\n"
+      << "\t       bytes per rep each kernel declares in a bytes validation .csv file;\n"
+      << "\t       with no events, CUDA dram__bytes_read/write or rocm FETCH_SIZE and\n"
+      << "\t       WRITE_SIZE of device 0 are used in CUDA and HIP builds)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --validate-bytes (GPU builds)\n"
+      << "\t\t --validate-bytes perf::UNC_M_CAS_COUNT:RD*64 perf::UNC_M_CAS_COUNT:WR*64\n\n";
+
+  str << "\t --bytes-tol <double> [default is 0.25]\n"
+      << "\t      (declared/measured bytes per rep ratios outside 1 +/- this value\n"
+      << "\t       are flagged in the bytes validation .csv file)\n\n";
+#endif
+
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
   str << "\t --add-to-spot-config, -atsc <string> [Default is none]\n"
       << "\t\t appends additional parameters to the built-in Caliper spot config\n";
@@ -1013,7 +3702,7 @@ void RunParams::printKernelNames(std::ostream& str) const
 {
   str << "\nAvailable kernels:";
   str << "\n------------------\n";
-  for (int kid = 0; kid < NumKernels; ++kid) {
+  for (size_t kid = 0; kid < getNumKernels(); ++kid) {
     str << getKernelName(static_cast<KernelID>(kid)) << std::endl;
   }
   str.flush();
@@ -1024,7 +3713,7 @@ void RunParams::printFullKernelNames(std::ostream& str) const
 {
   str << "\nAvailable kernels (<group name>_<kernel name>):";
   str << "\n-----------------------------------------\n";
-  for (int kid = 0; kid < NumKernels; ++kid) {
+  for (size_t kid = 0; kid < getNumKernels(); ++kid) {
     str << getFullKernelName(static_cast<KernelID>(kid)) << std::endl;
   }
   str.flush();
@@ -1068,7 +3757,7 @@ void RunParams::printGroupNames(std::ostream& str) const
 {
   str << "\nAvailable groups:";
   str << "\n-----------------\n";
-  for (int gid = 0; gid < NumGroups; ++gid) {
+  for (size_t gid = 0; gid < getNumGroups(); ++gid) {
     str << getGroupName(static_cast<GroupID>(gid)) << std::endl;
   }
   str.flush();
@@ -1091,7 +3780,7 @@ void RunParams::printFeatureKernels(std::ostream& str) const
   for (int fid = 0; fid < NumFeatures; ++fid) {
     FeatureID tfid = static_cast<FeatureID>(fid);
     str << getFeatureName(tfid) << std::endl;
-    for (int kid = 0; kid < NumKernels; ++kid) {
+    for (size_t kid = 0; kid < getNumKernels(); ++kid) {
       KernelID tkid = static_cast<KernelID>(kid);
       KernelBase* kern = getKernelObject(tkid, *this);
       if ( kern->usesFeature(tfid) ) {
@@ -1108,7 +3797,7 @@ void RunParams::printKernelFeatures(std::ostream& str) const
 {
   str << "\nAvailable kernels and features each uses:";
   str << "\n-----------------------------------------\n";
-  for (int kid = 0; kid < NumKernels; ++kid) {
+  for (size_t kid = 0; kid < getNumKernels(); ++kid) {
     KernelID tkid = static_cast<KernelID>(kid);
     str << getFullKernelName(tkid) << std::endl;
     KernelBase* kern = getKernelObject(tkid, *this);
@@ -1123,6 +3812,55 @@ void RunParams::printKernelFeatures(std::ostream& str) const
   str.flush();
 }
 
+void RunParams::printPatternNames(std::ostream& str) const
+{
+  str << "\nAvailable patterns:";
+  str << "\n-------------------\n";
+  for (int pid = 0; pid < NumPatterns; ++pid) {
+    str << getPatternName(static_cast<PatternID>(pid)) << std::endl;
+  }
+  str.flush();
+}
+
+void RunParams::printPatternKernels(std::ostream& str) const
+{
+  str << "\nAvailable patterns and kernels that have each:";
+  str << "\n----------------------------------------------\n";
+  for (int pid = 0; pid < NumPatterns; ++pid) {
+    PatternID tpid = static_cast<PatternID>(pid);
+    str << getPatternName(tpid) << std::endl;
+    for (size_t kid = 0; kid < getNumKernels(); ++kid) {
+      KernelID tkid = static_cast<KernelID>(kid);
+      KernelBase* kern = getKernelObject(tkid, *this);
+      if ( kern->hasPattern(tpid) ) {
+        str << "\t" << getFullKernelName(tkid) << std::endl;
+      }
+      delete kern;
+    }  // loop over kernels
+    str << std::endl;
+  }  // loop over patterns
+  str.flush();
+}
+
+void RunParams::printKernelPatterns(std::ostream& str) const
+{
+  str << "\nAvailable kernels and patterns each has:";
+  str << "\n----------------------------------------\n";
+  for (size_t kid = 0; kid < getNumKernels(); ++kid) {
+    KernelID tkid = static_cast<KernelID>(kid);
+    str << getFullKernelName(tkid) << std::endl;
+    KernelBase* kern = getKernelObject(tkid, *this);
+    for (int pid = 0; pid < NumPatterns; ++pid) {
+      PatternID tpid = static_cast<PatternID>(pid);
+      if ( kern->hasPattern(tpid) ) {
+         str << "\t" << getPatternName(tpid) << std::endl;
+      }
+    }  // loop over patterns
+    delete kern;
+  }  // loop over kernels
+  str.flush();
+}
+
 /*
  *******************************************************************************
  *
@@ -1158,6 +3896,177 @@ void RunParams::processNpassesCombinerInput()
   } // else
 }
 
+/*
+ *******************************************************************************
+ *
+ * Check the variants of '--co-execute', a CPU and a GPU variant that are
+ * both run.
+ *
+ *******************************************************************************
+ */
+void RunParams::processCoExecInput()
+{
+  if ( co_exec_input.size() != 2 ) {
+    return;
+  }
+
+  VariantID vids[2] = {NumVariants, NumVariants};
+  for (size_t ii = 0; ii < 2; ++ii) {
+    for (size_t iv = 0; iv < NumVariants; ++iv) {
+      VariantID vid = static_cast<VariantID>(iv);
+      if ( getVariantName(vid) == co_exec_input[ii] ) {
+        vids[ii] = vid;
+      }
+    }
+  }
+
+  if ( vids[0] == NumVariants || isVariantGPU(vids[0]) ||
+       vids[1] == NumVariants || !isVariantGPU(vids[1]) ) {
+    getCout() << "\nBad input:"
+              << " --co-execute must be given a CPU variant then a GPU variant,"
+              << " not " << co_exec_input[0] << " " << co_exec_input[1]
+              << std::endl;
+    input_state = BadInput;
+    return;
+  }
+
+  if ( run_variants.find(vids[0]) == run_variants.end() ||
+       run_variants.find(vids[1]) == run_variants.end() ) {
+    getCout() << "\nBad input:"
+              << " the variants of --co-execute must be run, ie. given with"
+              << " --variants"
+              << std::endl;
+    input_state = BadInput;
+    return;
+  }
+
+  if ( isolate_kernels ) {
+    getCout() << "\nBad input:"
+              << " --co-execute can not be used with --isolate-kernels"
+              << std::endl;
+    input_state = BadInput;
+    return;
+  }
+
+  co_exec_cpu_variant = vids[0];
+  co_exec_gpu_variant = vids[1];
+}
+
+/*
+ *******************************************************************************
+ *
+ * Read the configurations of '--run-plan' into run_plan and select the
+ * kernels of the plan to run.
+ *
+ *******************************************************************************
+ */
+void RunParams::processRunPlanInput()
+{
+  if ( run_plan_file.empty() ) {
+    if ( app_proxy_cycles > 0 ) {
+      getCout() << "\nBad input:"
+                << " --app-proxy must be used with --run-plan"
+                << std::endl;
+      input_state = BadInput;
+    }
+    return;
+  }
+
+  if ( !kernel_input.empty() || !size_sweep.empty() ||
+       isolate_kernels || concurrent_kernels > 1 ) {
+    getCout() << "\nBad input:"
+              << " --run-plan can not be used with --kernels, --size-sweep,"
+              << " --isolate-kernels, or --concurrent-kernels"
+              << std::endl;
+    input_state = BadInput;
+    return;
+  }
+
+  std::ifstream file(run_plan_file.c_str());
+  if ( !file ) {
+    getCout() << "\nBad input:"
+              << " can't open run plan file " << run_plan_file
+              << std::endl;
+    input_state = BadInput;
+    return;
+  }
+
+  //
+  // Each line names a kernel followed by key=value settings, text after #
+  // is ignored.
+  //
+  std::string line;
+  while ( std::getline(file, line) ) {
+    line = line.substr(0, line.find('#'));
+
+    std::istringstream line_stream(line);
+    std::string kernel_name;
+    if ( !(line_stream >> kernel_name) ) {
+      continue;
+    }
+
+    const KernelID no_kernel = static_cast<KernelID>(getNumKernels());
+    RunPlanEntry entry{no_kernel, 0.0, 0, 0, {}};
+    for (size_t kid = 0; kid < getNumKernels(); ++kid) {
+      if ( getFullKernelName(static_cast<KernelID>(kid)) == kernel_name ) {
+        entry.kernel_id = static_cast<KernelID>(kid);
+      }
+    }
+    if ( entry.kernel_id == no_kernel ) {
+      getCout() << "\nBad input:"
+                << " unknown kernel " << kernel_name
+                << " in run plan file " << run_plan_file
+                << std::endl;
+      input_state = BadInput;
+      continue;
+    }
+
+    std::string setting;
+    while ( line_stream >> setting ) {
+      const size_t eq = setting.find('=');
+      const std::string key = setting.substr(0, eq);
+      const std::string value = (eq == std::string::npos)
+                              ? std::string() : setting.substr(eq + 1);
+      if ( key == "size" && ::atof(value.c_str()) > 0.0 ) {
+        entry.size = ::atof(value.c_str());
+      } else if ( key == "reps" && ::atol(value.c_str()) > 0 ) {
+        entry.reps = ::atol(value.c_str());
+      } else if ( key == "weight" && ::atol(value.c_str()) > 0 ) {
+        entry.weight = ::atol(value.c_str());
+      } else if ( key == "tunings" && !value.empty() ) {
+        std::istringstream tunings_stream(value);
+        std::string tuning;
+        while ( std::getline(tunings_stream, tuning, ',') ) {
+          if ( !tuning.empty() ) {
+            entry.tunings.push_back(tuning);
+          }
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " bad setting " << setting << " for " << kernel_name
+                  << " in run plan file " << run_plan_file
+                  << ", must be size=<int>, reps=<int>, weight=<int>, or"
+                  << " tunings=<tuning>,..."
+                  << std::endl;
+        input_state = BadInput;
+      }
+    }
+
+    if ( std::find(kernel_input.begin(), kernel_input.end(), kernel_name) ==
+         kernel_input.end() ) {
+      kernel_input.push_back(kernel_name);
+    }
+    run_plan.push_back(entry);
+  }
+
+  if ( run_plan.empty() && input_state != BadInput ) {
+    getCout() << "\nBad input:"
+              << " no kernels in run plan file " << run_plan_file
+              << std::endl;
+    input_state = BadInput;
+  }
+}
+
 /*
  *******************************************************************************
  *
@@ -1168,6 +4077,50 @@ void RunParams::processNpassesCombinerInput()
  *
  *******************************************************************************
  */
+/*
+ *******************************************************************************
+ *
+ * Set default DRAM byte events for '--validate-bytes' if none were given and
+ * add the events to the PAPI events to count.
+ *
+ *******************************************************************************
+ */
+void RunParams::processBytesValidationInput()
+{
+  if ( !validate_bytes ) {
+    return;
+  }
+
+  if ( bytes_events.empty() ) {
+#if defined(RAJA_ENABLE_CUDA)
+    bytes_events = { "cuda:::dram__bytes_read.sum:device=0",
+                     "cuda:::dram__bytes_write.sum:device=0" };
+    bytes_event_scales = { 1.0, 1.0 };
+#elif defined(RAJA_ENABLE_HIP)
+    // rocprofiler FETCH_SIZE and WRITE_SIZE count kilobytes
+    bytes_events = { "rocm:::FETCH_SIZE:device=0",
+                     "rocm:::WRITE_SIZE:device=0" };
+    bytes_event_scales = { 1024.0, 1024.0 };
+#endif
+  }
+
+  if ( bytes_events.empty() ) {
+    getCout() << "\nBad input:"
+              << " must give --validate-bytes events counting DRAM traffic"
+              << " (string[*double]) in builds without CUDA or HIP"
+              << std::endl;
+    input_state = BadInput;
+    return;
+  }
+
+  for (const std::string& event : bytes_events) {
+    if ( std::find(papi_events.begin(), papi_events.end(), event) ==
+         papi_events.end() ) {
+      papi_events.push_back(event);
+    }
+  }
+}
+
 void RunParams::processKernelInput()
 {
   using Slist = std::list<std::string>;
@@ -1199,7 +4152,7 @@ void RunParams::processKernelInput()
     Svector groups2exclude;
     for (Slist::iterator it = exclude_kern_names.begin(); 
          it != exclude_kern_names.end(); ++it) {
-      for (size_t ig = 0; ig < NumGroups; ++ig) {
+      for (size_t ig = 0; ig < getNumGroups(); ++ig) {
         const std::string& group_name = getGroupName(static_cast<GroupID>(ig));
         if ( group_name == *it ) {
           groups2exclude.push_back(group_name);
@@ -1215,7 +4168,7 @@ void RunParams::processKernelInput()
     for (size_t ig = 0; ig < groups2exclude.size(); ++ig) {
       const std::string& gname(groups2exclude[ig]);
 
-      for (size_t ik = 0; ik < NumKernels; ++ik) {
+      for (size_t ik = 0; ik < getNumKernels(); ++ik) {
         KernelID kid = static_cast<KernelID>(ik);
         if ( getFullKernelName(kid).find(gname) != std::string::npos ) {
           exclude_kernels.insert(kid);
@@ -1234,7 +4187,7 @@ void RunParams::processKernelInput()
          it != exclude_kern_names.end(); ++it) {
       bool found_it = false;
 
-      for (size_t ik = 0; ik < NumKernels && !found_it; ++ik) {
+      for (size_t ik = 0; ik < getNumKernels() && !found_it; ++ik) {
         KernelID kid = static_cast<KernelID>(ik);
         if ( getKernelName(kid) == *it || getFullKernelName(kid) == *it ) {
           exclude_kernels.insert(kid);
@@ -1300,7 +4253,7 @@ void RunParams::processKernelInput()
             // Found valid feature name, exclude kernels that use the feature.
             found_it = true;
 
-            for (int kid = 0; kid < NumKernels; ++kid) {
+            for (size_t kid = 0; kid < getNumKernels(); ++kid) {
               KernelID tkid = static_cast<KernelID>(kid);
               KernelBase* kern = getKernelObject(tkid, *this);
               if ( kern->usesFeature(tfid) ) {
@@ -1320,6 +4273,72 @@ void RunParams::processKernelInput()
   }  // if exclude feature name input is not empty
 
 
+  // ================================================================
+  //
+  // Determine IDs of kernels to exclude from run based on exclude
+  // pattern input.
+  //
+  // ================================================================
+
+  if ( !exclude_pattern_input.empty() ) {
+
+    // First, check for invalid exclude_pattern input.
+    for (size_t i = 0; i < exclude_pattern_input.size(); ++i) {
+      bool found_it = false;
+
+      for (size_t pid = 0; pid < NumPatterns && !found_it; ++pid) {
+        PatternID tpid = static_cast<PatternID>(pid);
+        if ( getPatternName(tpid) == exclude_pattern_input[i] ) {
+          found_it = true;
+        }
+      }
+
+      // Assemble invalid input items for output message.
+      if ( !found_it ) {
+        invalid_exclude_pattern_input.push_back( exclude_pattern_input[i] );
+      }
+
+    }  // iterate over patterns to exclude
+
+    //
+    // If exclude pattern input is valid, determine which kernels have input-
+    // specified patterns and add to set of kernel IDs to exclude from run.
+    //
+    if ( invalid_exclude_pattern_input.empty() ) {
+
+      for (size_t i = 0; i < exclude_pattern_input.size(); ++i) {
+
+        const std::string& pattern = exclude_pattern_input[i];
+
+        bool found_it = false;
+        for (size_t pid = 0; pid < NumPatterns && !found_it; ++pid) {
+          PatternID tpid = static_cast<PatternID>(pid);
+
+          if ( getPatternName(tpid) == pattern ) {
+
+            // Found valid pattern name, exclude kernels that have the pattern.
+            found_it = true;
+
+            for (size_t kid = 0; kid < getNumKernels(); ++kid) {
+              KernelID tkid = static_cast<KernelID>(kid);
+              KernelBase* kern = getKernelObject(tkid, *this);
+              if ( kern->hasPattern(tpid) ) {
+                 exclude_kernels.insert( tkid );
+              }
+              delete kern;
+            }  // loop over kernels
+
+          }  // if input pattern name matches pattern id
+
+        }  // iterate over pattern ids until name match is found
+
+      }  // loop over exclude pattern name input
+
+    }  // if exclude pattern name input is valid
+
+  }  // if exclude pattern name input is not empty
+
+
   // ================================================================
   //
   // Determine IDs of kernels to run based on input.
@@ -1329,12 +4348,13 @@ void RunParams::processKernelInput()
 
   run_kernels.clear();
 
-  if ( kernel_input.empty() && feature_input.empty() ) {
+  if ( kernel_input.empty() && feature_input.empty() &&
+       pattern_input.empty() ) {
 
     //
-    // No kernels or features specified in input. Run 'em all!
+    // No kernels, features, or patterns specified in input. Run 'em all!
     //
-    for (size_t kid = 0; kid < NumKernels; ++kid) {
+    for (size_t kid = 0; kid < getNumKernels(); ++kid) {
       KernelID tkid = static_cast<KernelID>(kid);
       if (exclude_kernels.find(tkid) == exclude_kernels.end()) {
         run_kernels.insert( tkid );
@@ -1389,7 +4409,7 @@ void RunParams::processKernelInput()
             if ( getFeatureName(tfid) == feature ) {
               found_it = true;
 
-              for (int kid = 0; kid < NumKernels; ++kid) {
+              for (size_t kid = 0; kid < getNumKernels(); ++kid) {
                 KernelID tkid = static_cast<KernelID>(kid);
                 KernelBase* kern = getKernelObject(tkid, *this);
                 if ( kern->usesFeature(tfid) &&
@@ -1409,6 +4429,68 @@ void RunParams::processKernelInput()
 
     } // if !feature_input.empty()
 
+    //
+    // Look for kernels having patterns if such input provided
+    //
+    if ( !pattern_input.empty() ) {
+
+      //
+      // First, check for invalid pattern input.
+      //
+      for (size_t i = 0; i < pattern_input.size(); ++i) {
+        bool found_it = false;
+
+        for (size_t pid = 0; pid < NumPatterns && !found_it; ++pid) {
+          PatternID tpid = static_cast<PatternID>(pid);
+          if ( getPatternName(tpid) == pattern_input[i] ) {
+            found_it = true;
+          }
+        }
+
+        // Assemble invalid input items for output message.
+        if ( !found_it )  {
+          invalid_pattern_input.push_back( pattern_input[i] );
+        }
+
+      } // iterate over pattern input items
+
+      //
+      // If pattern input is valid, determine which kernels have
+      // input-specified patterns and add to set of kernels to run.
+      //
+      if ( invalid_pattern_input.empty() ) {
+
+        for (size_t i = 0; i < pattern_input.size(); ++i) {
+
+          const std::string& pattern = pattern_input[i];
+
+          bool found_it = false;
+          for (size_t pid = 0; pid < NumPatterns && !found_it; ++pid) {
+            PatternID tpid = static_cast<PatternID>(pid);
+
+            if ( getPatternName(tpid) == pattern ) {
+              found_it = true;
+
+              for (size_t kid = 0; kid < getNumKernels(); ++kid) {
+                KernelID tkid = static_cast<KernelID>(kid);
+                KernelBase* kern = getKernelObject(tkid, *this);
+                if ( kern->hasPattern(tpid) &&
+                     exclude_kernels.find(tkid) == exclude_kernels.end() ) {
+                   run_kernels.insert( tkid );
+                }
+                delete kern;
+              }  // iterate over kernels
+
+            }  // if input pattern name matches pattern id
+
+          }  // iterate over pattern ids until name match is found
+
+        }  // iterate over pattern name input
+
+      }  // if pattern name input is valid
+
+    } // if !pattern_input.empty()
+
     // Make list copy of kernel name input to manipulate for
     // processing potential group names and/or kernel names, next
     Slist kern_names(kernel_input.begin(), kernel_input.end());
@@ -1420,7 +4502,7 @@ void RunParams::processKernelInput()
     Svector groups2run;
     for (Slist::iterator it = kern_names.begin(); it != kern_names.end(); ++it)
     {
-      for (size_t ig = 0; ig < NumGroups; ++ig) {
+      for (size_t ig = 0; ig < getNumGroups(); ++ig) {
         const std::string& group_name = getGroupName(static_cast<GroupID>(ig));
         if ( group_name == *it ) {
           groups2run.push_back(group_name);
@@ -1435,7 +4517,7 @@ void RunParams::processKernelInput()
     for (size_t ig = 0; ig < groups2run.size(); ++ig) {
       const std::string& gname(groups2run[ig]);
 
-      for (size_t kid = 0; kid < NumKernels; ++kid) {
+      for (size_t kid = 0; kid < getNumKernels(); ++kid) {
         KernelID tkid = static_cast<KernelID>(kid);
         if ( getFullKernelName(tkid).find(gname) != std::string::npos &&
              exclude_kernels.find(tkid) == exclude_kernels.end()) {
@@ -1453,7 +4535,7 @@ void RunParams::processKernelInput()
     {
       bool found_it = false;
 
-      for (size_t kid = 0; kid < NumKernels && !found_it; ++kid) {
+      for (size_t kid = 0; kid < getNumKernels() && !found_it; ++kid) {
         KernelID tkid = static_cast<KernelID>(kid);
         if ( getKernelName(tkid) == *it || getFullKernelName(tkid) == *it ) {
           if (exclude_kernels.find(tkid) == exclude_kernels.end()) {
@@ -1470,7 +4552,7 @@ void RunParams::processKernelInput()
 
     } // iterate over kernel name input
 
-  }  // else either kernel input or feature input is non-empty
+  }  // else either kernel, feature, or pattern input is non-empty
 
   //
   // Set BadInput state based on invalid kernel input
@@ -1485,6 +4567,11 @@ void RunParams::processKernelInput()
        !(invalid_exclude_feature_input.empty()) ) {
     input_state = BadInput;
   }
+
+  if ( !(invalid_pattern_input.empty()) ||
+       !(invalid_exclude_pattern_input.empty()) ) {
+    input_state = BadInput;
+  }
    
 }
 
@@ -1696,4 +4783,146 @@ void RunParams::processTuningInput()
 }
 
 
+/*
+ *******************************************************************************
+ *
+ * Get the value of a kernel parameter given with --kernel-param.
+ *
+ *******************************************************************************
+ */
+bool RunParams::getKernelParam(const std::string& kernel_name,
+                               const std::string& param_name,
+                               long& value) const
+{
+  auto kernel_it = kernel_params.find(kernel_name);
+  if (kernel_it == kernel_params.end()) {
+    return false;
+  }
+  auto param_it = kernel_it->second.find(param_name);
+  if (param_it == kernel_it->second.end()) {
+    return false;
+  }
+  value = param_it->second;
+  return true;
+}
+
+
+/*
+ *******************************************************************************
+ *
+ * Parse kernel parameter input and check that the kernels exist and have
+ * the given parameters with valid values.
+ *
+ *******************************************************************************
+ */
+void RunParams::processKernelParamInput()
+{
+  for (const std::string& input : kernel_param_input) {
+
+    const size_t colon = input.find(':');
+    const size_t equals = input.find('=', colon == std::string::npos ? 0 : colon);
+    if ( colon == std::string::npos || equals == std::string::npos ||
+         colon == 0 || equals == colon+1 || equals+1 == input.size() ) {
+      getCout() << "\nBad input:"
+                << " must give --kernel-param values as KERNEL:name=value, "
+                << input << std::endl;
+      input_state = BadInput;
+      continue;
+    }
+
+    const std::string kernel_name = input.substr(0, colon);
+    const std::string param_name = input.substr(colon+1, equals-colon-1);
+    const std::string value_str = input.substr(equals+1);
+
+    char* end = nullptr;
+    const long value = std::strtol(value_str.c_str(), &end, 10);
+    if ( end == nullptr || *end != '\0' ) {
+      getCout() << "\nBad input:"
+                << " must give --kernel-param an integer value, "
+                << input << std::endl;
+      input_state = BadInput;
+      continue;
+    }
+
+    bool found_kernel = false;
+    for (size_t kid = 0; kid < getNumKernels(); ++kid) {
+      KernelID tkid = static_cast<KernelID>(kid);
+      if ( getFullKernelName(tkid) == kernel_name ||
+           getKernelName(tkid) == kernel_name ) {
+        kernel_params[getFullKernelName(tkid)][param_name] = value;
+        found_kernel = true;
+        break;
+      }
+    }
+    if ( !found_kernel ) {
+      getCout() << "\nBad input:"
+                << " invalid kernel name given to --kernel-param, "
+                << kernel_name << std::endl;
+      input_state = BadInput;
+    }
+
+  }
+
+  //
+  // Check given parameters against those each kernel registers
+  //
+  for (size_t kid = 0; kid < getNumKernels(); ++kid) {
+    KernelID tkid = static_cast<KernelID>(kid);
+    auto kernel_it = kernel_params.find(getFullKernelName(tkid));
+    if (kernel_it == kernel_params.end()) {
+      continue;
+    }
+
+    KernelBase* kern = getKernelObject(tkid, *this);
+    const std::vector<KernelBase::KernelParam>& registered =
+        kern->getKernelParams();
+
+    for (const auto& given : kernel_it->second) {
+      auto param = std::find_if(registered.begin(), registered.end(),
+          [&](const KernelBase::KernelParam& p) { return p.name == given.first; });
+      if (param == registered.end()) {
+        getCout() << "\nBad input:"
+                  << " invalid --kernel-param for " << kernel_it->first
+                  << ", " << given.first << ", valid parameters are";
+        for (const KernelBase::KernelParam& p : registered) {
+          getCout() << " " << p.name;
+        }
+        if (registered.empty()) {
+          getCout() << " none";
+        }
+        getCout() << std::endl;
+        input_state = BadInput;
+      } else if (!param->valid_values.empty() &&
+                 std::find(param->valid_values.begin(), param->valid_values.end(),
+                           static_cast<Index_type>(given.second)) ==
+                     param->valid_values.end()) {
+        getCout() << "\nBad input:"
+                  << " invalid --kernel-param value for " << kernel_it->first
+                  << ":" << given.first << ", " << given.second
+                  << ", valid values are";
+        for (Index_type valid_value : param->valid_values) {
+          getCout() << " " << valid_value;
+        }
+        getCout() << std::endl;
+        input_state = BadInput;
+      } else if (given.second < param->min_value) {
+        getCout() << "\nBad input:"
+                  << " must give --kernel-param " << kernel_it->first
+                  << ":" << given.first << " a value of at least "
+                  << param->min_value << std::endl;
+        input_state = BadInput;
+      } else if (given.second > param->max_value) {
+        getCout() << "\nBad input:"
+                  << " must give --kernel-param " << kernel_it->first
+                  << ":" << given.first << " a value of at most "
+                  << param->max_value << std::endl;
+        input_state = BadInput;
+      }
+    }
+
+    delete kern;
+  }
+}
+
+
 }  // closing brace for rajaperf namespace
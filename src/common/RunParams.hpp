@@ -9,6 +9,8 @@
 #ifndef RAJAPerf_RunParams_HPP
 #define RAJAPerf_RunParams_HPP
 
+#include <algorithm>
+#include <map>
 #include <string>
 #include <set>
 #include <vector>
@@ -30,6 +32,9 @@ class RunParams {
 
 public:
   RunParams( int argc, char** argv );
+  // Default parameters without command line input, for programs that
+  // embed the suite
+  RunParams( );
   ~RunParams( );
 
   /*!
@@ -95,6 +100,110 @@ public:
     }
   }
 
+  /*!
+   * \brief Enumeration indicating how the problem size is split over MPI ranks
+   */
+  enum MPIScaling {
+    NoScaling,     /*!< every rank runs the size, results are not combined */
+    StrongScaling, /*!< the size is the global size split over the ranks */
+    WeakScaling,   /*!< the size is the size of each rank */
+  };
+
+  /*!
+   * \brief Translate MPIScaling enum value to string
+   */
+  static std::string MPIScalingToStr(MPIScaling ms)
+  {
+    switch (ms) {
+      case MPIScaling::NoScaling:
+        return "none";
+      case MPIScaling::StrongScaling:
+        return "strong";
+      case MPIScaling::WeakScaling:
+        return "weak";
+      default:
+        return "Unknown";
+    }
+  }
+
+  /*!
+   * \brief Enumeration of what is done with kernels whose estimated memory
+   * footprint is over the budget set with '--memory-fraction'
+   */
+  enum MemoryFit {
+    SkipMemoryFit,     /*!< kernels over budget are not run */
+    DownsizeMemoryFit, /*!< kernels over budget run at the largest size that fits */
+    MaxMemoryFit,      /*!< every kernel runs at the largest size that fits */
+  };
+
+  /*!
+   * \brief Translate MemoryFit enum value to string
+   */
+  static std::string MemoryFitToStr(MemoryFit mf)
+  {
+    switch (mf) {
+      case MemoryFit::SkipMemoryFit:
+        return "skip";
+      case MemoryFit::DownsizeMemoryFit:
+        return "downsize";
+      case MemoryFit::MaxMemoryFit:
+        return "max";
+      default:
+        return "Unknown";
+    }
+  }
+
+  /*!
+   * \brief Enumeration of host timers used for timed regions
+   */
+  enum HostTimer {
+    RAJAHostTimer,  /*!< RAJA::Timer as configured in RAJA */
+    CycleHostTimer, /*!< cpu cycle counter, see TimerUtils.hpp */
+  };
+
+  /*!
+   * \brief Translate HostTimer enum value to string
+   */
+  static std::string HostTimerToStr(HostTimer ht)
+  {
+    switch (ht) {
+      case HostTimer::RAJAHostTimer:
+        return "raja";
+      case HostTimer::CycleHostTimer:
+        return "cycle";
+      default:
+        return "Unknown";
+    }
+  }
+
+  /*!
+   * \brief Enumeration of background loads run alongside kernels
+   */
+  enum InterferenceLoad {
+    CPUStreamLoad, /*!< bandwidth streaming host threads on other cores */
+    GPUStreamLoad, /*!< Stream_TRIAD on its own GPU stream */
+    CopyLoad,      /*!< host to device and device to host copies */
+
+    NumInterferenceLoads
+  };
+
+  /*!
+   * \brief Translate InterferenceLoad enum value to string
+   */
+  static std::string InterferenceLoadToStr(InterferenceLoad il)
+  {
+    switch (il) {
+      case InterferenceLoad::CPUStreamLoad:
+        return "cpu-stream";
+      case InterferenceLoad::GPUStreamLoad:
+        return "gpu-stream";
+      case InterferenceLoad::CopyLoad:
+        return "pcie-copy";
+      default:
+        return "Unknown";
+    }
+  }
+
   /*!
    * \brief Return state of input parsed to this point.
    */
@@ -107,21 +216,176 @@ public:
   bool showProgress() const { return show_progress; }
 
   int getNumPasses() const { return npasses; }
+  double getCITarget() const { return ci_target; }
+  int getMaxNumPasses() const { return max_npasses; }
 
   double getRepFactor() const { return rep_fact; }
 
+  double getTargetTime() const { return target_time; }
+
+  double getEstimateProbeTime() const { return estimate_probe_time; }
+  double getWalltimeBudget() const { return walltime_budget; }
+
   const std::vector<CombinerOpt>& getNpassesCombinerOpts() const
   { return npasses_combiners; }
 
+  int getTimingBatchReps() const { return timing_batch_reps; }
+  int getTimingHistBins() const { return timing_hist_bins; }
+  int getTimingBarrierBatches() const { return timing_barrier_batches; }
+
+  double getPeakBandwidth() const { return peak_bandwidth; }
+  double getPeakFLOPs() const { return peak_flops; }
+
   SizeMeaning getSizeMeaning() const { return size_meaning; }
 
   double getSize() const { return size; }
 
   double getSizeFactor() const { return size_factor; }
 
+  //
+  // Sizes of '--size-sweep', empty if not sweeping.
+  //
+  const std::vector<double>& getSizeSweep() const { return size_sweep; }
+
+  //
+  // Fraction of host and device memory kernels may use, 0 if not bounded,
+  // and what is done with kernels over it.
+  //
+  double getMemoryFraction() const { return memory_fraction; }
+  MemoryFit getMemoryFit() const { return memory_fit; }
+
+  //
+  // Set the size of all kernels, used to run the sizes of a size sweep.
+  //
+  void setSize(double new_size)
+  {
+    size = new_size;
+    size_meaning = SizeMeaning::Direct;
+  }
+
+  //
+  // Restore a size and its meaning saved before setSize.
+  //
+  void restoreSize(SizeMeaning saved_meaning, double saved_size)
+  {
+    size = saved_size;
+    size_meaning = saved_meaning;
+  }
+
+  //
+  // One configuration of '--run-plan', a kernel with its own size, reps,
+  // and tunings. A size or reps of 0 and no tunings use the values of the
+  // command line. The weight is the reps of the kernel in one cycle of
+  // '--app-proxy', 0 -> 1.
+  //
+  struct RunPlanEntry
+  {
+    KernelID kernel_id;
+    double size;
+    long reps;
+    long weight;
+    std::vector<std::string> tunings;
+  };
+
+  //
+  // Configurations of '--run-plan' in file order, empty if no run plan.
+  //
+  const std::vector<RunPlanEntry>& getRunPlan() const { return run_plan; }
+
+  //
+  // One GPU clock cap in MHz or power limit in watts of '--gpu-clocks' and
+  // '--gpu-power-limits', GPU tunings are also run with each.
+  //
+  struct GPUSetting
+  {
+    enum Kind { ClockMHz, PowerLimitWatts };
+    Kind kind;
+    int value;
+
+    // suffix of tuning names, ie. "clk_1410" or "pwr_300"
+    std::string getName() const
+    {
+      return ((kind == ClockMHz) ? "clk_" : "pwr_") + std::to_string(value);
+    }
+  };
+
+  //
+  // Clock caps and power limits in the order given, empty if none.
+  //
+  const std::vector<GPUSetting>& getGPUSettings() const { return gpu_settings; }
+
+  int getAppProxyCycles() const { return app_proxy_cycles; }
+
   size_t getDataAlignment() const { return data_alignment; }
 
+  bool getReuseSetupData() const { return reuse_setup_data; }
+
+  bool getPipelineSetUp() const { return pipeline_setup; }
+  bool getRandomOrder() const { return random_order; }
+  unsigned long long getRandomOrderSeed() const { return random_order_seed; }
+
+  int getSparseStencil() const { return sparse_stencil; }
+
+  long getHistogramBins() const { return histogram_bins; }
+  double getHistogramSkew() const { return histogram_skew; }
+
+  double getBranchFraction() const { return branch_fraction; }
+  long getBranchRunLength() const { return branch_run_length; }
+
+  long getSegmentSize() const { return segment_size; }
+  const std::string& getSegmentDist() const { return segment_dist; }
+
+  long getBatchedMatrixSize() const { return batched_matrix_size; }
+
+  long getFFTSize() const { return fft_size; }
+
+  long getLTIMESNumD() const { return ltimes_num_d; }
+  long getLTIMESNumG() const { return ltimes_num_g; }
+  long getLTIMESNumM() const { return ltimes_num_m; }
+
+  const std::string& getGatherPattern() const { return gather_pattern; }
+  long getGatherBlockSize() const { return gather_block_size; }
+
+  bool getUseDataPool() const { return use_data_pool; }
+
+  size_t getGPUPoolReleaseThreshold() const { return gpu_pool_release_threshold; }
+
+  bool getAutotune() const { return autotune; }
+  const std::string& getTuningFile() const { return tuning_file; }
+  const std::string& getTuningDBFile() const { return tuning_db_file; }
+  bool getRunBestTunings() const { return run_best_tunings; }
+
+  const std::string& getCompareDir() const { return compare_dir; }
+  double getCompareTolerance() const { return compare_tol; }
+
+  MPIScaling getMPIScaling() const { return mpi_scaling; }
+  const std::vector<std::string>& getScalingSeriesDirs() const { return scaling_series_dirs; }
+
   int getGPUStream() const { return gpu_stream; }
+  int getGPUDevice() const { return gpu_device; }
+  int getRanksPerGPU() const { return ranks_per_gpu; }
+  bool getMultiGPU() const { return multi_gpu; }
+  bool getGPUEventTiming() const { return gpu_event_timing; }
+  HostTimer getHostTimer() const { return host_timer; }
+  bool getMeasureEnergy() const { return measure_energy; }
+  bool getResume() const { return resume; }
+  bool getIncremental() const { return incremental; }
+  const std::string& getResultCacheFile() const { return result_cache_file; }
+  const std::string& getResultCacheOptions() const { return result_cache_options; }
+  bool getIsolateKernels() const { return isolate_kernels; }
+  bool getColdCache() const { return cold_cache; }
+  int getConcurrentKernels() const { return concurrent_kernels; }
+  bool getConcurrentMixed() const { return concurrent_mixed; }
+  VariantID getCoExecCPUVariant() const { return co_exec_cpu_variant; }
+  VariantID getCoExecGPUVariant() const { return co_exec_gpu_variant; }
+  double getCoExecGPUFraction() const { return co_exec_gpu_fraction; }
+  bool getMPIGPUAware() const { return mpi_gpu_aware; }
+  const std::vector<DataType>& getDataTypes() const { return data_types; }
+  const std::vector<StoragePrecision>& getStoragePrecisions() const { return storage_precisions; }
+  const std::vector<int>& getOpenMPTargetThreadLimits() const { return omp_target_thread_limits; }
+  const std::vector<int>& getOpenMPTargetNumTeams() const { return omp_target_num_teams; }
+  const std::vector<int>& getGPUShmemCarveouts() const { return gpu_shmem_carveouts; }
+  const std::vector<int>& getOpenMPThreadCounts() const { return omp_thread_counts; }
   size_t numValidGPUBlockSize() const { return gpu_block_sizes.size(); }
   bool validGPUBlockSize(size_t block_size) const
   {
@@ -138,9 +402,30 @@ public:
   DataSpace getOmpTargetDataSpace() const { return ompTargetDataSpace; }
   DataSpace getCudaDataSpace() const { return cudaDataSpace; }
   DataSpace getHipDataSpace() const { return hipDataSpace; }
+  DataSpace getSyclDataSpace() const { return syclDataSpace; }
   DataSpace getKokkosDataSpace() const { return kokkosDataSpace; }
 
+  HostPagePolicy getHostPagePolicy() const { return host_page_policy; }
+  ManagedPolicy getManagedPolicy() const { return managed_policy; }
+  bool getCountPageFaults() const { return count_page_faults; }
+  bool getTrackDeviceMemory() const { return track_device_memory; }
+  bool getGPUTelemetry() const { return gpu_telemetry; }
+  bool getDeviceActivity() const { return device_activity; }
+  bool getTrace() const { return trace; }
+  const std::vector<InterferenceLoad>& getInterferenceLoads() const
+  { return interference_loads; }
+  bool hasInterferenceLoad(InterferenceLoad il) const
+  { return std::find(interference_loads.begin(), interference_loads.end(), il)
+           != interference_loads.end(); }
+  int getInterferenceThreads() const { return interference_threads; }
+  int getThrottleReruns() const { return throttle_reruns; }
+  NumaPolicy getOmpNumaPolicy() const { return omp_numa_policy; }
+  const std::vector<int>& getOmpNumaNodes() const { return omp_numa_nodes; }
+
   double getPFTolerance() const { return pf_tol; }
+  bool getReproducible() const { return reproducible; }
+  bool getChecksumOnce() const { return checksum_once; }
+  bool getFastMath() const { return fast_math; }
 
   int getCheckRunReps() const { return checkrun_reps; }
 
@@ -148,17 +433,36 @@ public:
 
   const std::vector<std::string>& getTuningInput() const
                                   { return tuning_input; }
+
+  /*!
+   * \brief Set value to the kernel parameter param_name of the kernel with
+   * full name kernel_name given with --kernel-param, return false if it was
+   * not given.
+   */
+  bool getKernelParam(const std::string& kernel_name,
+                      const std::string& param_name,
+                      long& value) const;
   const std::vector<std::string>& getExcludeTuningInput() const
                                   { return exclude_tuning_input; }
 
   const std::string& getOutputDirName() const { return outdir; }
   const std::string& getOutputFilePrefix() const { return outfile_prefix; }
+  const std::string& getJitCacheDir() const { return jit_cache_dir; }
+
+  const std::vector<std::string>& getPapiEvents() const { return papi_events; }
+
+  bool getValidateBytes() const { return validate_bytes; }
+  const std::vector<std::string>& getBytesEvents() const { return bytes_events; }
+  const std::vector<double>& getBytesEventScales() const { return bytes_event_scales; }
+  double getBytesTolerance() const { return bytes_tol; }
 
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
   const std::string& getAddToSpotConfig() const { return add_to_spot_config; }
 #endif
 
   bool getDisableWarmup() const { return disable_warmup; }
+  double getAdaptiveWarmupTolerance() const { return adaptive_warmup_tol; }
+  int getAdaptiveWarmupMaxReps() const { return adaptive_warmup_max_reps; }
 
   bool getAllowProblematicImplementations() const
   { return allow_problematic_implementations; }
@@ -176,8 +480,6 @@ public:
 
 
 private:
-  RunParams() = delete;
-
 //@{
 //! @name Routines used in command line parsing and printing option output
   void parseCommandLineOptions(int argc, char** argv);
@@ -190,11 +492,18 @@ private:
   void printFeatureNames(std::ostream& str) const;
   void printFeatureKernels(std::ostream& str) const;
   void printKernelFeatures(std::ostream& str) const;
+  void printPatternNames(std::ostream& str) const;
+  void printPatternKernels(std::ostream& str) const;
+  void printKernelPatterns(std::ostream& str) const;
 
   void processNpassesCombinerInput();
+  void processBytesValidationInput();
+  void processRunPlanInput();
   void processKernelInput();
   void processVariantInput();
   void processTuningInput();
+  void processCoExecInput();
+  void processKernelParamInput();
 //@}
 
   InputOpt input_state;  /*!< state of command line input */
@@ -202,22 +511,167 @@ private:
   bool show_progress;    /*!< true -> show run progress; false -> do not */
 
   int npasses;           /*!< Number of passes through suite  */
+  double ci_target;      /*!< Relative half width of 95% confidence interval
+                              of mean pass time to run passes until;
+                              0 -> run npasses only */
+  int max_npasses;       /*!< Max num passes through suite with ci_target */
 
   std::vector<CombinerOpt> npasses_combiners;  /*!< Combiners to use when
                               outputting timer data */
 
+  int timing_batch_reps; /*!< Num reps timed per sample in timing
+                              distribution report; 0 -> no report */
+  int timing_hist_bins;  /*!< Num histogram bins in timing
+                              distribution report */
+  int timing_barrier_batches; /*!< Num timing batches between MPI barriers;
+                                   0 -> barrier only around each pass */
+
+  double peak_bandwidth; /*!< machine peak GB/s for roofline report;
+                              0 -> use best measured */
+  double peak_flops;     /*!< machine peak GFLOP/s for roofline report;
+                              0 -> use best measured */
+
   double rep_fact;       /*!< pct of default kernel reps to run */
 
+  double target_time;    /*!< target run time (sec.) of each kernel variant
+                              per pass; 0 -> use rep_fact */
+
+  double estimate_probe_time; /*!< min time (sec.) to probe each kernel
+                                   variant tuning for the dry run estimate;
+                                   0 -> use only the tuning database */
+  double walltime_budget; /*!< walltime (sec.) the dry run suggests reps to
+                               fit in; 0 -> no suggestion */
+
   SizeMeaning size_meaning; /*!< meaning of size value */
   double size;           /*!< kernel size to run (input option) */
   double size_factor;    /*!< default kernel size multipier (input option) */
+  std::vector<double> size_sweep; /*!< sizes to run in one process
+                                       (input option) */
+  double memory_fraction; /*!< fraction of memory kernels may use;
+                               0 -> not bounded (input option) */
+  MemoryFit memory_fit; /*!< what is done with kernels over the memory
+                             bound (input option) */
+  std::string run_plan_file; /*!< file of kernel configurations to run in
+                                  one process (input option) */
+  std::vector<RunPlanEntry> run_plan; /*!< configurations of run_plan_file */
+  int app_proxy_cycles; /*!< cycles of the run plan kernels to run
+                             interleaved; 0 -> no app proxy run */
   size_t data_alignment;
 
+  bool reuse_setup_data; /*!< true -> init kernel data once per data space
+                              and copy it in setUp of each variant/tuning */
+
+  bool pipeline_setup;   /*!< true -> set up the next kernel on another host
+                              thread while the current one finishes */
+
+  int sparse_stencil;    /*!< points in 3D Laplacian stencil of Sparse
+                              kernel matrices, 7 or 27 */
+
+  long histogram_bins;   /*!< number of bins of HISTOGRAM kernel */
+  double histogram_skew; /*!< Zipf exponent of HISTOGRAM bin distribution,
+                              0 -> uniform */
+
+  double branch_fraction; /*!< fraction of elements of conditional kernels
+                               that take the branch, < 0 -> kernel data */
+  long branch_run_length; /*!< number of consecutive elements of conditional
+                               kernels that take the same branch */
+
+  long segment_size;     /*!< mean segment length of segmented kernels */
+  std::string segment_dist; /*!< distribution of segment lengths of
+                                 segmented kernels, fixed, uniform, or
+                                 skewed */
+
+  long batched_matrix_size; /*!< number of rows and columns of each matrix
+                                 of batched dense kernels */
+
+  long fft_size;         /*!< length of each transform of batched 1D FFT
+                              kernels, a power of two */
+
+  long ltimes_num_d;     /*!< number of directions of LTIMES kernels */
+  long ltimes_num_g;     /*!< number of groups of LTIMES kernels */
+  long ltimes_num_m;     /*!< number of moments of LTIMES kernels */
+
+  std::string gather_pattern; /*!< index pattern of gather and scatter
+                                   kernels, identity, strided,
+                                   block_shuffled, or random */
+  long gather_block_size; /*!< stride of strided and block length of
+                               block_shuffled gather index patterns */
+
+  bool use_data_pool;    /*!< true -> allocate kernel data from a caching
+                              pool per data space */
+
+  size_t gpu_pool_release_threshold; /*!< bytes kept by the default memory
+                                          pool of the GPU for reuse */
+
+  bool autotune;         /*!< true -> search GPU block size tunings for the
+                              fastest and run only that one */
+  std::string tuning_file; /*!< file naming tunings to run per kernel */
+  std::string tuning_db_file; /*!< tuning database of the best tunings by
+                                   kernel, variant, size, and GPU model */
+  bool run_best_tunings; /*!< true -> run only the best tuning of each
+                              kernel variant in the tuning database */
+
+  std::string compare_dir; /*!< output dir of a previous run to compare
+                                run times to; empty -> no comparison */
+  double compare_tol;    /*!< pct run time can exceed the previous run's,
+                              beyond the npasses spread, before it is
+                              reported as a regression */
+
+  MPIScaling mpi_scaling; /*!< how the size is split over MPI ranks */
+  std::vector<std::string> scaling_series_dirs; /*!< output dirs of earlier
+                                                     runs of a scaling series */
+
   int gpu_stream; /*!< 0 -> use stream 0; anything else -> use raja default stream */
+  int gpu_device; /*!< GPU device to run on; -1 -> bind by local MPI rank,
+                       or use the default device without MPI */
+  int ranks_per_gpu; /*!< MPI ranks sharing each GPU, ie. with MPS or a
+                          partitioned GPU; 0 -> one GPU per local rank */
+  bool multi_gpu; /*!< true -> partition kernels that support it over all
+                       visible GPUs */
+  bool gpu_event_timing; /*!< true -> also time GPU variants with GPU events */
+  HostTimer host_timer; /*!< host timer used for timed regions */
+  bool measure_energy; /*!< true -> read energy meters around timed regions */
+  bool resume; /*!< true -> skip passes completed in the progress file */
+  bool incremental; /*!< true -> reuse passes in the result cache whose
+                         key did not change */
+  std::string result_cache_file; /*!< result cache file name, empty -> file
+                                      in the output directory */
+  std::string result_cache_options; /*!< command line options that may change
+                                         results, part of the cache key */
+  bool isolate_kernels; /*!< true -> run each kernel pass in a forked worker */
+  bool cold_cache; /*!< true -> also time reps run after flushing caches */
+  int concurrent_kernels; /*!< Num GPU kernels to run concurrently;
+                               1 -> no concurrent runs */
+  bool concurrent_mixed; /*!< true -> run different kernels concurrently;
+                              false -> run instances of the same kernel */
+  VariantID co_exec_cpu_variant; /*!< CPU variant to run at the same time as
+                                      co_exec_gpu_variant; NumVariants -> no
+                                      co-execution runs */
+  VariantID co_exec_gpu_variant;
+  double co_exec_gpu_fraction; /*!< part of the problem run by the GPU
+                                    variant in co-execution runs */
+  bool mpi_gpu_aware;    /*!< true -> pass GPU buffers directly to MPI */
   std::vector<size_t> gpu_block_sizes; /*!< Block sizes for gpu tunings to run (input option) */
+  std::vector<int> omp_target_thread_limits; /*!< thread limits for Base OpenMP target
+                                                  tunings; empty -> kernel default */
+  std::vector<int> omp_target_num_teams; /*!< numbers of teams for Base OpenMP target
+                                              tunings; empty -> compiler default */
+  std::vector<int> gpu_shmem_carveouts; /*!< shared memory carve-outs in percent for
+                                             Base CUDA tunings; empty -> driver default */
+  std::vector<GPUSetting> gpu_settings; /*!< GPU clock caps and power limits for
+                                             GPU tunings; empty -> GPU default */
+  std::vector<int> omp_thread_counts; /*!< thread counts for OpenMP tunings,
+                                           ascending; empty -> OMP default */
+  std::vector<DataType> data_types; /*!< Data types to run kernels using data types with;
+                                         empty -> Real_type only */
+  std::vector<StoragePrecision> storage_precisions; /*!< Precisions of storage tunings;
+                                                         empty -> no storage tunings */
 
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
                               each PM case to pass/fail acceptance */
+  bool reproducible;     /*!< true -> write reproducibility report */
+  bool checksum_once;    /*!< true -> reuse checksums of bitwise same data */
+  bool fast_math;        /*!< true -> add the fast_math tunings */
 
   int checkrun_reps;     /*!< Num reps each kernel is run in check run */
 
@@ -230,8 +684,31 @@ private:
   DataSpace ompTargetDataSpace = DataSpace::OmpTarget;
   DataSpace cudaDataSpace = DataSpace::CudaDevice;
   DataSpace hipDataSpace = DataSpace::HipDevice;
+  DataSpace syclDataSpace = DataSpace::SyclDevice;
   DataSpace kokkosDataSpace = DataSpace::Host;
 
+  HostPagePolicy host_page_policy = HostPagePolicy::Default; /*!< page size of host data */
+  ManagedPolicy managed_policy = ManagedPolicy::None; /*!< prefetch or advice for managed data */
+  bool count_page_faults = false; /*!< true -> count page faults in timed regions */
+  bool track_device_memory = false; /*!< true -> track device memory high-water of GPU variants */
+  bool gpu_telemetry = false; /*!< true -> sample GPU clocks, temperature,
+                                   power, and throttling around timed regions */
+  int throttle_reruns = 0; /*!< times to rerun a pass taken while the GPU
+                                was throttled; 0 -> only warn */
+  bool random_order = false; /*!< true -> shuffle kernel and variant tuning
+                                  order each pass */
+  unsigned long long random_order_seed = 0; /*!< seed of random_order shuffles */
+  bool device_activity = false; /*!< true -> trace device busy time in
+                                     timed regions (CUPTI, roctracer) */
+  bool trace = false; /*!< true -> record a timeline of suite execution
+                           and write it as Chrome trace JSON */
+  std::vector<InterferenceLoad> interference_loads; /*!< background loads to
+      run kernels again alongside; empty -> no interference runs */
+  int interference_threads = 1; /*!< host threads of the cpu-stream load */
+  NumaPolicy omp_numa_policy = NumaPolicy::FirstTouch; /*!< placement of Omp data pages */
+  std::vector<int> omp_numa_nodes; /*!< NUMA nodes for omp_numa_policy;
+                                        empty -> all allowed nodes */
+
   //
   // Arrays to hold input strings for valid/invalid input. Helpful for
   // debugging command line args.
@@ -244,26 +721,51 @@ private:
   std::vector<std::string> invalid_variant_input;
   std::vector<std::string> exclude_variant_input;
   std::vector<std::string> invalid_exclude_variant_input;
+  std::vector<std::string> co_exec_input;
   std::vector<std::string> tuning_input;
   std::vector<std::string> invalid_tuning_input;
   std::vector<std::string> exclude_tuning_input;
   std::vector<std::string> invalid_exclude_tuning_input;
+  std::vector<std::string> kernel_param_input;
+  std::vector<std::string> kernel_libs; /*!< shared libraries of
+      out-of-tree kernels loaded with --load-kernels */
+  std::map<std::string, std::map<std::string, long>> kernel_params; /*!<
+      kernel parameter values by full kernel name and parameter name */
   std::vector<std::string> feature_input;
   std::vector<std::string> invalid_feature_input;
   std::vector<std::string> exclude_feature_input;
   std::vector<std::string> invalid_exclude_feature_input;
+  std::vector<std::string> pattern_input;
+  std::vector<std::string> invalid_pattern_input;
+  std::vector<std::string> exclude_pattern_input;
+  std::vector<std::string> invalid_exclude_pattern_input;
 
   std::vector<std::string> npasses_combiner_input;
   std::vector<std::string> invalid_npasses_combiner_input;
 
   std::string outdir;          /*!< Output directory name. */
   std::string outfile_prefix;  /*!< Prefix for output data file names. */
+  std::string jit_cache_dir;   /*!< Directory of jit tuning binaries, empty
+                                    for no disk cache. */
+
+  std::vector<std::string> papi_events; /*!< PAPI events to count */
+
+  bool validate_bytes; /*!< true -> compare bytes per rep to counted bytes */
+  std::vector<std::string> bytes_events; /*!< PAPI events counting DRAM traffic */
+  std::vector<double> bytes_event_scales; /*!< bytes per count of bytes_events */
+  double bytes_tol; /*!< declared/measured bytes ratios within 1 +/- bytes_tol
+                         are reported OK */
 
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
   std::string add_to_spot_config;
 #endif
 
   bool disable_warmup;
+  double adaptive_warmup_tol = 0.0; /*!< relative difference of successive
+                                         untimed rep times to warm up each
+                                         variant tuning to; 0 -> no adaptive
+                                         warmup */
+  int adaptive_warmup_max_reps = 100; /*!< most adaptive warmup reps */
 
   bool allow_problematic_implementations;
 
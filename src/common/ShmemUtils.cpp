@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ShmemUtils.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_SHMEM)
+
+#include <mpi.h>
+
+#include <stdexcept>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+static bool shmem_initialized = false;
+
+void initShmem()
+{
+  if (shmem_initialized) {
+    return;
+  }
+#if defined(RAJA_ENABLE_CUDA)
+  MPI_Comm comm = MPI_COMM_WORLD;
+  nvshmemx_init_attr_t attr;
+  attr.mpi_comm = &comm;
+  if (nvshmemx_init_attr(NVSHMEMX_INIT_WITH_MPI_COMM, &attr) != 0) {
+    throw std::runtime_error("initShmem : nvshmemx_init_attr failed");
+  }
+#elif defined(RAJA_ENABLE_HIP)
+  rocshmem::rocshmem_init();
+#endif
+  shmem_initialized = true;
+}
+
+void finalizeShmem()
+{
+  if (!shmem_initialized) {
+    return;
+  }
+#if defined(RAJA_ENABLE_CUDA)
+  nvshmem_finalize();
+#elif defined(RAJA_ENABLE_HIP)
+  rocshmem::rocshmem_finalize();
+#endif
+  shmem_initialized = false;
+}
+
+void* allocShmemData(size_t nbytes)
+{
+  void* ptr = nullptr;
+#if defined(RAJA_ENABLE_CUDA)
+  ptr = nvshmem_malloc(nbytes);
+#elif defined(RAJA_ENABLE_HIP)
+  ptr = rocshmem::rocshmem_malloc(nbytes);
+#endif
+  if (ptr == nullptr && nbytes > 0) {
+    throw std::runtime_error("allocShmemData : symmetric heap allocation failed");
+  }
+  return ptr;
+}
+
+void deallocShmemData(void* ptr)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  nvshmem_free(ptr);
+#elif defined(RAJA_ENABLE_HIP)
+  rocshmem::rocshmem_free(ptr);
+#endif
+}
+
+void barrierShmem()
+{
+#if defined(RAJA_ENABLE_CUDA)
+  nvshmem_barrier_all();
+#elif defined(RAJA_ENABLE_HIP)
+  rocshmem::rocshmem_barrier_all();
+#endif
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // RAJA_PERFSUITE_ENABLE_SHMEM
@@ -0,0 +1,75 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for the shmem tunings of GPU kernels, which communicate with
+/// one-sided puts issued from GPU kernels through NVSHMEM or rocSHMEM when
+/// the suite is built with RAJA_PERFSUITE_ENABLE_SHMEM.
+///
+/// The library is initialized over MPI_COMM_WORLD the first time a shmem
+/// tuning runs, so processing element (PE) ids are the MPI ranks, and is
+/// finalized before MPI at the end of the run. Allocating and freeing
+/// symmetric memory are collective over all ranks.
+///
+
+#ifndef RAJAPerf_ShmemUtils_HPP
+#define RAJAPerf_ShmemUtils_HPP
+
+#include <cstddef>
+
+#if defined(RAJA_PERFSUITE_ENABLE_SHMEM) && defined(RAJA_ENABLE_CUDA)
+#include <nvshmem.h>
+#include <nvshmemx.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_ENABLE_SHMEM) && defined(RAJA_ENABLE_HIP)
+#include <rocshmem/rocshmem.hpp>
+#endif
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+#if defined(RAJA_PERFSUITE_ENABLE_SHMEM)
+
+/*!
+ * \brief Initialize NVSHMEM or rocSHMEM over MPI_COMM_WORLD, if not
+ * initialized yet.
+ */
+void initShmem();
+
+/*!
+ * \brief Finalize NVSHMEM or rocSHMEM if it was initialized, must be called
+ * before MPI_Finalize.
+ */
+void finalizeShmem();
+
+/*!
+ * \brief Allocate nbytes of symmetric GPU memory, collective over all ranks.
+ */
+void* allocShmemData(size_t nbytes);
+
+/*!
+ * \brief Free symmetric GPU memory, collective over all ranks.
+ */
+void deallocShmemData(void* ptr);
+
+/*!
+ * \brief Wait for all ranks and for the completion of their puts.
+ */
+void barrierShmem();
+
+#endif
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
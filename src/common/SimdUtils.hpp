@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods and macros for explicit SIMD tunings of sequential variants.
+///
+/// Base_Seq simd tunings mark their innermost loops with RAJAPERF_SIMD, or
+/// RAJAPERF_SIMD_REDUCTION for loops reducing into a scalar, and RAJA_Seq
+/// simd tunings run with RAJA::simd_exec. Both compare against the default
+/// tunings that rely on the compiler to vectorize on its own.
+///
+
+#ifndef RAJAPerf_SimdUtils_HPP
+#define RAJAPerf_SimdUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+
+#include <climits>
+#include <cstddef>
+#include <string>
+
+#if defined(__ARM_FEATURE_SVE)
+#include <arm_sve.h>
+#endif
+
+//
+// Ask the compiler to vectorize the following loop.
+//
+#define RAJAPERF_SIMD RAJA_SIMD
+
+//
+// Ask the compiler to vectorize the following loop reducing into var with op.
+//
+#if defined(RAJA_ENABLE_OPENMP)
+#define RAJAPERF_SIMD_REDUCTION(op, var) RAJA_PRAGMA(omp simd reduction(op:var))
+#else
+#define RAJAPERF_SIMD_REDUCTION(op, var) RAJA_SIMD
+#endif
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Return width in bits of the widest SIMD registers the suite was
+ *        compiled for, or 0 if unknown.
+ *
+ * The width of SVE registers is read at run time unless it was fixed at
+ * compile time.
+ */
+inline size_t getSimdVectorWidthBits()
+{
+#if defined(__AVX512F__)
+  return 512;
+#elif defined(__AVX__)
+  return 256;
+#elif defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && \
+      __ARM_FEATURE_SVE_BITS > 0
+  return __ARM_FEATURE_SVE_BITS;
+#elif defined(__ARM_FEATURE_SVE)
+  return svcntb() * CHAR_BIT;
+#elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ALTIVEC__)
+  return 128;
+#else
+  return 0;
+#endif
+}
+
+/*!
+ * \brief Return name of SIMD tunings, which includes the vector width in
+ *        bits when known, ie. simd_512 when compiled for AVX-512.
+ */
+inline std::string getSimdTuningName()
+{
+  const size_t width = getSimdVectorWidthBits();
+  return (width > 0) ? "simd_" + std::to_string(width) : "simd";
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for confidence intervals and significance tests of pass times.
+///
+/// Pass times are treated as independent samples, intervals and tests use
+/// the Student t distribution at 95% confidence.
+///
+
+#ifndef RAJAPerf_StatsUtils_HPP
+#define RAJAPerf_StatsUtils_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Mean, sample standard deviation, and 95% confidence interval of
+ * the mean of a set of samples.
+ *
+ * The interval is empty (lo == hi == mean) with less than two samples.
+ */
+struct ConfidenceInterval
+{
+  size_t num;
+  double mean;
+  double stddev;
+  double lo;
+  double hi;
+
+  // half width of the interval relative to the mean
+  double relHalfWidth() const
+  { return (mean > 0.0) ? (hi - mean) / mean : 0.0; }
+};
+
+/*!
+ * \brief 97.5th percentile of the Student t distribution with df degrees of
+ * freedom, the critical value of two sided tests at 95% confidence.
+ */
+inline double studentT975(double df)
+{
+  static const double table[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+     2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+     2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+
+  // round down so the critical value is conservative
+  const size_t idf = (df < 1.0) ? 1 : static_cast<size_t>(df);
+  if (idf <= 30) {
+    return table[idf-1];
+  } else if (idf <= 40) {
+    return 2.021;
+  } else if (idf <= 60) {
+    return 2.000;
+  } else if (idf <= 120) {
+    return 1.980;
+  }
+  return 1.960;
+}
+
+/*!
+ * \brief Compute t based 95% confidence interval of the mean of samples.
+ */
+template < typename T >
+inline ConfidenceInterval computeConfidenceInterval(const std::vector<T>& samples)
+{
+  ConfidenceInterval ci{samples.size(), 0.0, 0.0, 0.0, 0.0};
+  if (samples.empty()) {
+    return ci;
+  }
+
+  for (T sample : samples) {
+    ci.mean += static_cast<double>(sample);
+  }
+  ci.mean /= ci.num;
+
+  if (ci.num > 1) {
+    double sum_sq = 0.0;
+    for (T sample : samples) {
+      const double diff = static_cast<double>(sample) - ci.mean;
+      sum_sq += diff * diff;
+    }
+    ci.stddev = std::sqrt(sum_sq / (ci.num - 1));
+  }
+
+  const double half_width = (ci.num > 1)
+      ? studentT975(ci.num - 1) * ci.stddev / std::sqrt(static_cast<double>(ci.num))
+      : 0.0;
+  ci.lo = ci.mean - half_width;
+  ci.hi = ci.mean + half_width;
+
+  return ci;
+}
+
+/*!
+ * \brief Return true if the means of a and b differ at 95% confidence by
+ * Welch's t test, false if they do not or either has less than two samples.
+ */
+inline bool meansDifferSignificantly(const ConfidenceInterval& a,
+                                     const ConfidenceInterval& b)
+{
+  if (a.num < 2 || b.num < 2) {
+    return false;
+  }
+
+  const double va = a.stddev * a.stddev / a.num;
+  const double vb = b.stddev * b.stddev / b.num;
+  const double diff = std::abs(a.mean - b.mean);
+  if (va + vb == 0.0) {
+    return diff > 0.0;
+  }
+
+  const double t = diff / std::sqrt(va + vb);
+  // Welch-Satterthwaite degrees of freedom
+  const double df = (va + vb) * (va + vb) /
+                    (va * va / (a.num - 1) + vb * vb / (b.num - 1));
+
+  return t > studentT975(df);
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
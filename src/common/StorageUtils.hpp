@@ -0,0 +1,225 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for storage tunings of bandwidth bound kernels, which keep their
+/// arrays in a narrower floating point type and compute in the type of the
+/// kernel, converting each element when it is loaded and stored.
+///
+/// Kernels with storage tunings call setUsesStoragePrecisions in their
+/// constructor, then their Base Seq, OpenMP, CUDA, and HIP variants also
+/// have a tuning for each precision given with '--storage-precisions', ie.
+/// "storage_fp32" and "storage_bf16". Their arrays are set
+/// up as usual and converted in place to the storage type with
+/// convertDataToStorage, their results are converted back with
+/// convertDataFromStorage before computing the checksum, so the checksum
+/// diff of a storage tuning is the error of the narrower storage.
+///
+
+#ifndef RAJAPerf_StorageUtils_HPP
+#define RAJAPerf_StorageUtils_HPP
+
+#include "common/RAJAPerfSuite.hpp"
+#include "common/RPTypes.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief A bfloat16 value, the upper 16 bits of an IEEE float.
+ */
+struct BFloat16_type
+{
+  uint16_t bits;
+};
+
+namespace storage
+{
+
+/*!
+ * \brief Return the name of precision given with '--storage-precisions',
+ *        ie. bf16.
+ */
+inline std::string getName(StoragePrecision precision)
+{
+  switch ( precision ) {
+    case StoragePrecision::Float : return "fp32";
+    case StoragePrecision::BFloat16 : return "bf16";
+    default : return "default";
+  }
+}
+
+/*!
+ * \brief Return the name of the tuning storing arrays in precision,
+ *        ie. storage_bf16.
+ */
+inline std::string getTuningName(StoragePrecision precision)
+{
+  if (precision == StoragePrecision::Default) {
+    return "default";
+  }
+  return "storage_" + getName(precision);
+}
+
+/*!
+ * \brief Return the size in bytes of an element stored in precision, 0
+ *        for the Default precision.
+ */
+inline size_t getElementSize(StoragePrecision precision)
+{
+  switch ( precision ) {
+    case StoragePrecision::Float : return sizeof(float);
+    case StoragePrecision::BFloat16 : return sizeof(BFloat16_type);
+    default : return 0;
+  }
+}
+
+/*!
+ * \brief Load a stored element as a Real_type.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE Real_type load(float val)
+{
+  return static_cast<Real_type>(val);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Real_type load(double val)
+{
+  return static_cast<Real_type>(val);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE Real_type load(BFloat16_type val)
+{
+  const uint32_t bits = static_cast<uint32_t>(val.bits) << 16;
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return static_cast<Real_type>(f);
+}
+
+/*!
+ * \brief Round val to the Storage_type element stored for it, bfloat16
+ *        rounds to nearest even.
+ */
+template < typename Storage_type >
+RAJA_HOST_DEVICE RAJA_INLINE Storage_type store(Real_type val)
+{
+  return static_cast<Storage_type>(val);
+}
+
+template < >
+RAJA_HOST_DEVICE RAJA_INLINE BFloat16_type store<BFloat16_type>(Real_type val)
+{
+  const float f = static_cast<float>(val);
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  if ( (bits & 0x7fffffffu) > 0x7f800000u ) {
+    return BFloat16_type{static_cast<uint16_t>((bits >> 16) | 0x0040u)}; // quiet NaN
+  }
+  bits += 0x7fffu + ((bits >> 16) & 1u);
+  return BFloat16_type{static_cast<uint16_t>(bits >> 16)};
+}
+
+/*!
+ * \brief Convert len elements of T in host memory to Storage_type in place,
+ *        the converted elements start at data.
+ *
+ * Storage_type is not larger than T so converting in increasing order does
+ * not overwrite elements not yet converted.
+ */
+template < typename Storage_type, typename T >
+void convertToStorage(T* data, Index_type len)
+{
+  static_assert(sizeof(Storage_type) <= sizeof(T), "Storage type too large");
+  Storage_type* stored = reinterpret_cast<Storage_type*>(data);
+  for (Index_type i = 0; i < len; ++i) {
+    const Storage_type val = store<Storage_type>(static_cast<Real_type>(data[i]));
+    memcpy(&stored[i], &val, sizeof(val));
+  }
+}
+
+/*!
+ * \brief Convert len Storage_type elements at data in host memory back to T
+ *        in place, in decreasing order for the same reason.
+ */
+template < typename Storage_type, typename T >
+void convertFromStorage(T* data, Index_type len)
+{
+  static_assert(sizeof(Storage_type) <= sizeof(T), "Storage type too large");
+  const Storage_type* stored = reinterpret_cast<const Storage_type*>(data);
+  for (Index_type i = len; i > 0; --i) {
+    Storage_type val;
+    memcpy(&val, &stored[i-1], sizeof(val));
+    data[i-1] = static_cast<T>(load(val));
+  }
+}
+
+} // closing brace for storage namespace
+
+}  // closing brace for rajaperf namespace
+
+//
+// Call func<Storage_type>(...) with Storage_type the element type of the
+// storage precision of a storage tuning.
+//
+#define RAJAPERF_STORAGE_PRECISION_DISPATCH(precision, func, ...)           \
+  switch ( precision ) {                                                       \
+    case ::rajaperf::StoragePrecision::Float :                                 \
+      func< float >(__VA_ARGS__); break;                                       \
+    case ::rajaperf::StoragePrecision::BFloat16 :                              \
+      func< ::rajaperf::BFloat16_type >(__VA_ARGS__); break;                   \
+    default :                                                                  \
+      getCout() << "\n  " << getName() << " : Unknown storage precision = "    \
+                << static_cast<int>(precision) << std::endl;                   \
+  }
+
+//
+// Define run<variant>StorageVariant to call run<variant>VariantStorage with
+// the element type of the storage precision of the tuning.
+//
+#define RAJAPERF_STORAGE_RUN_BOILERPLATE(kernel, variant)                      \
+  void kernel::run##variant##StorageVariant(VariantID vid, size_t tune_idx)    \
+  {                                                                            \
+    RAJAPERF_STORAGE_PRECISION_DISPATCH(getStoragePrecision(vid, tune_idx),    \
+        run##variant##VariantStorage, vid);                                    \
+  }
+
+//
+// Define run<variant>StorageVariant for kernels using floating point data
+// types to call run<variant>VariantStorage<Data_type, Storage_type>, which
+// computes in Data_type, with the element types of the data type and the
+// storage precision of the tuning.
+//
+#define RAJAPERF_FLOATING_POINT_DATA_TYPE_STORAGE_RUN_BOILERPLATE(kernel, variant) \
+  template < typename Data_type >                                              \
+  void kernel::run##variant##StorageVariantTyped(VariantID vid, size_t tune_idx) \
+  {                                                                            \
+    switch ( getStoragePrecision(vid, tune_idx) ) {                            \
+      case ::rajaperf::StoragePrecision::Float :                               \
+        run##variant##VariantStorage< Data_type, float >(vid); break;          \
+      case ::rajaperf::StoragePrecision::BFloat16 :                            \
+        run##variant##VariantStorage< Data_type,                               \
+                                      ::rajaperf::BFloat16_type >(vid); break; \
+      default :                                                                \
+        getCout() << "\n  " << getName() << " : Unknown storage precision = "  \
+                  << static_cast<int>(getStoragePrecision(vid, tune_idx))      \
+                  << std::endl;                                                \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::run##variant##StorageVariant(VariantID vid, size_t tune_idx)    \
+  {                                                                            \
+    RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx),     \
+        run##variant##StorageVariantTyped, vid, tune_idx);                     \
+  }
+
+#endif  // closing endif for header file include guard
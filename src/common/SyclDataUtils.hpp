@@ -0,0 +1,123 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for SYCL kernel data allocation, initialization, and deallocation.
+///
+
+
+#ifndef RAJAPerf_SyclDataUtils_HPP
+#define RAJAPerf_SyclDataUtils_HPP
+
+#include "RPTypes.hpp"
+#include <new>
+#include <stdexcept>
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include "common/RAJAPerfSuite.hpp"
+#include "common/GPUUtils.hpp"
+
+#include "RAJA/policy/sycl/policy.hpp"
+
+#include <sycl/sycl.hpp>
+
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Number of work-items in the nd_range of a 1D SYCL kernel with
+ * work-groups of block_size work-items covering len iterations.
+ */
+inline size_t getSyclGlobalSize(Index_type len, size_t block_size)
+{
+  return block_size * RAJA_DIVIDE_CEILING_INT(len, block_size);
+}
+
+
+namespace detail
+{
+
+/*!
+ * \brief Get the queue used for data allocation and copies, it is the
+ * queue of the default camp SYCL resource.
+ */
+inline sycl::queue* getSyclQueue()
+{
+  return camp::resources::Sycl::get_default().get_queue();
+}
+
+/*!
+ * \brief Get the max work-group size of the device of the data queue.
+ */
+inline size_t getSyclMaxWorkGroupSize()
+{
+  return getSyclQueue()->get_device()
+      .get_info<sycl::info::device::max_work_group_size>();
+}
+
+/*
+ * Copy memory len bytes from src to dst.
+ */
+inline void copySyclData(void* dst_ptr, const void* src_ptr, size_t len)
+{
+  getSyclQueue()->memcpy( dst_ptr, src_ptr, len ).wait();
+}
+
+/*!
+ * \brief Allocate SYCL device USM data array (dptr).
+ */
+inline void* allocSyclDeviceData(size_t len)
+{
+  void* dptr = sycl::malloc_device( len, *getSyclQueue() );
+  if (dptr == nullptr && len > 0) {
+    throw std::bad_alloc();
+  }
+  return dptr;
+}
+
+/*!
+ * \brief Allocate SYCL shared USM data array (mptr).
+ */
+inline void* allocSyclManagedData(size_t len)
+{
+  void* mptr = sycl::malloc_shared( len, *getSyclQueue() );
+  if (mptr == nullptr && len > 0) {
+    throw std::bad_alloc();
+  }
+  return mptr;
+}
+
+/*!
+ * \brief Allocate SYCL host USM data array (pptr).
+ */
+inline void* allocSyclPinnedData(size_t len)
+{
+  void* pptr = sycl::malloc_host( len, *getSyclQueue() );
+  if (pptr == nullptr && len > 0) {
+    throw std::bad_alloc();
+  }
+  return pptr;
+}
+
+/*!
+ * \brief Free SYCL USM data array of any kind.
+ */
+inline void deallocSyclData(void* ptr)
+{
+  sycl::free( ptr, *getSyclQueue() );
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif // RAJA_ENABLE_SYCL
+
+#endif  // closing endif for header file include guard
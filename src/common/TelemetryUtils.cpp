@@ -0,0 +1,206 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TelemetryUtils.hpp"
+
+#if defined(RAJA_PERFSUITE_USE_NVML)
+#include <nvml.h>
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+#include <amd_smi/amdsmi.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+namespace
+{
+
+bool telemetry_initialized = false;
+
+#if defined(RAJA_PERFSUITE_USE_NVML)
+nvmlDevice_t nvml_device;
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+amdsmi_processor_handle amdsmi_device;
+#endif
+
+/*!
+ * \brief Return the larger of two values, ignoring nan.
+ */
+double maxIgnoreNan(double a, double b)
+{
+  return std::isnan(a) ? b : (std::isnan(b) ? a : std::max(a, b));
+}
+
+/*!
+ * \brief Return the smaller of two values, ignoring nan.
+ */
+double minIgnoreNan(double a, double b)
+{
+  return std::isnan(a) ? b : (std::isnan(b) ? a : std::min(a, b));
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Return telemetry with no samples.
+ */
+GPUTelemetry emptyTelemetry()
+{
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  return GPUTelemetry{nan, nan, nan, nan, 0};
+}
+
+/*
+ * Combine the sample with the telemetry of a region.
+ */
+void combineTelemetry(GPUTelemetry& region, const GPUTelemetry& sample)
+{
+  region.sm_clock_mhz = minIgnoreNan(region.sm_clock_mhz, sample.sm_clock_mhz);
+  region.mem_clock_mhz = minIgnoreNan(region.mem_clock_mhz, sample.mem_clock_mhz);
+  region.temperature_c = maxIgnoreNan(region.temperature_c, sample.temperature_c);
+  region.power_watts = maxIgnoreNan(region.power_watts, sample.power_watts);
+  region.throttle_reasons |= sample.throttle_reasons;
+}
+
+/*
+ * Initialize telemetry of the GPU with the given PCI bus id.
+ */
+void initTelemetry(const std::string& pci_bus_id)
+{
+#if defined(RAJA_PERFSUITE_USE_NVML)
+  if (nvmlInit() == NVML_SUCCESS) {
+    if (nvmlDeviceGetHandleByPciBusId(pci_bus_id.c_str(), &nvml_device) == NVML_SUCCESS) {
+      telemetry_initialized = true;
+      return;
+    }
+    nvmlShutdown();
+  }
+#endif
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+  unsigned int domain = 0, bus = 0, device = 0, function = 0;
+  if (std::sscanf(pci_bus_id.c_str(), "%x:%x:%x.%x",
+                  &domain, &bus, &device, &function) == 4 &&
+      amdsmi_init(AMDSMI_INIT_AMD_GPUS) == AMDSMI_STATUS_SUCCESS) {
+    amdsmi_bdf_t bdf;
+    bdf.domain_number = domain;
+    bdf.bus_number = bus;
+    bdf.device_number = device;
+    bdf.function_number = function;
+    if (amdsmi_get_processor_handle_from_bdf(bdf, &amdsmi_device) ==
+        AMDSMI_STATUS_SUCCESS) {
+      telemetry_initialized = true;
+      return;
+    }
+    amdsmi_shut_down();
+  }
+#endif
+  throw std::runtime_error("initTelemetry : Can't read NVML or AMD SMI telemetry of GPU " +
+                           pci_bus_id);
+}
+
+/*
+ * Release resources used for telemetry.
+ */
+void finalizeTelemetry()
+{
+  if (!telemetry_initialized) {
+    return;
+  }
+#if defined(RAJA_PERFSUITE_USE_NVML)
+  nvmlShutdown();
+#endif
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+  amdsmi_shut_down();
+#endif
+  telemetry_initialized = false;
+}
+
+/*
+ * Return true if the GPU is being sampled.
+ */
+bool haveTelemetry()
+{
+  return telemetry_initialized;
+}
+
+/*
+ * Sample the GPU.
+ */
+GPUTelemetry readTelemetry()
+{
+  GPUTelemetry sample = emptyTelemetry();
+  if (!telemetry_initialized) {
+    return sample;
+  }
+
+#if defined(RAJA_PERFSUITE_USE_NVML)
+  unsigned int value = 0;
+  if (nvmlDeviceGetClockInfo(nvml_device, NVML_CLOCK_SM, &value) == NVML_SUCCESS) {
+    sample.sm_clock_mhz = value;
+  }
+  if (nvmlDeviceGetClockInfo(nvml_device, NVML_CLOCK_MEM, &value) == NVML_SUCCESS) {
+    sample.mem_clock_mhz = value;
+  }
+  if (nvmlDeviceGetTemperature(nvml_device, NVML_TEMPERATURE_GPU, &value) == NVML_SUCCESS) {
+    sample.temperature_c = value;
+  }
+  if (nvmlDeviceGetPowerUsage(nvml_device, &value) == NVML_SUCCESS) {
+    sample.power_watts = value * 1.0e-3;  // milliwatts
+  }
+  unsigned long long reasons = 0;
+  if (nvmlDeviceGetCurrentClocksThrottleReasons(nvml_device, &reasons) == NVML_SUCCESS) {
+    sample.throttle_reasons = reasons & ~(nvmlClocksThrottleReasonGpuIdle |
+                                          nvmlClocksThrottleReasonApplicationsClocksSetting);
+  }
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_AMDSMI)
+  amdsmi_clk_info_t clk_info;
+  if (amdsmi_get_clock_info(amdsmi_device, AMDSMI_CLK_TYPE_GFX, &clk_info) ==
+      AMDSMI_STATUS_SUCCESS) {
+    sample.sm_clock_mhz = clk_info.clk;
+  }
+  if (amdsmi_get_clock_info(amdsmi_device, AMDSMI_CLK_TYPE_MEM, &clk_info) ==
+      AMDSMI_STATUS_SUCCESS) {
+    sample.mem_clock_mhz = clk_info.clk;
+  }
+  int64_t temperature = 0;
+  if (amdsmi_get_temp_metric(amdsmi_device, AMDSMI_TEMPERATURE_TYPE_EDGE,
+                             AMDSMI_TEMP_CURRENT, &temperature) ==
+      AMDSMI_STATUS_SUCCESS) {
+    sample.temperature_c = static_cast<double>(temperature);
+  }
+  amdsmi_power_info_t power_info;
+  if (amdsmi_get_power_info(amdsmi_device, &power_info) == AMDSMI_STATUS_SUCCESS) {
+    sample.power_watts = power_info.current_socket_power;
+  }
+  amdsmi_gpu_metrics_t metrics;
+  if (amdsmi_get_gpu_metrics_info(amdsmi_device, &metrics) == AMDSMI_STATUS_SUCCESS) {
+    sample.throttle_reasons = metrics.throttle_status;
+  }
+#endif
+
+  return sample;
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for sampling GPU clocks, temperature, power, and throttle
+/// reasons around timed kernel regions.
+///
+/// The GPU the suite runs on is sampled before the timer starts and after
+/// it stops, with NVML when the suite is built with RAJA_PERFSUITE_USE_NVML
+/// and with AMD SMI when the suite is built with RAJA_PERFSUITE_USE_AMDSMI.
+///
+
+#ifndef RAJAPerf_TelemetryUtils_HPP
+#define RAJAPerf_TelemetryUtils_HPP
+
+#include <string>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief GPU state over a timed region, the lowest clocks, highest
+ * temperature and power, and all throttle reasons of its samples.
+ *
+ * Throttle reasons are the NVML clock event reasons or AMD SMI throttle
+ * status bits, not counting idle and application clock settings, so
+ * nonzero means the clocks were held down while the region ran.
+ */
+struct GPUTelemetry
+{
+  double sm_clock_mhz;
+  double mem_clock_mhz;
+  double temperature_c;
+  double power_watts;
+  unsigned long long throttle_reasons;
+
+  bool throttled() const { return throttle_reasons != 0; }
+};
+
+/*!
+ * \brief Return telemetry with no samples, combining a sample with it
+ * gives that sample.
+ */
+GPUTelemetry emptyTelemetry();
+
+/*!
+ * \brief Combine the sample with the telemetry of a region.
+ */
+void combineTelemetry(GPUTelemetry& region, const GPUTelemetry& sample);
+
+/*!
+ * \brief Initialize telemetry of the GPU with the given PCI bus id,
+ * ie. 0000:3b:00.0.
+ *
+ * Throws std::runtime_error if the GPU can not be sampled.
+ */
+void initTelemetry(const std::string& pci_bus_id);
+
+/*!
+ * \brief Release resources used for telemetry.
+ */
+void finalizeTelemetry();
+
+/*!
+ * \brief Return true if the GPU is being sampled.
+ */
+bool haveTelemetry();
+
+/*!
+ * \brief Sample the GPU, fields that can not be read are nan.
+ */
+GPUTelemetry readTelemetry();
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,185 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TimerUtils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <cpuid.h>
+#endif
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+namespace
+{
+
+bool use_cycle_counter = false;
+
+// number of empty timed regions used to find resolution and overhead
+const int num_timer_samples = 10000;
+
+/*
+ * Calibrate the counter frequency against steady_clock over 20 ms, on
+ * aarch64 the frequency is read from cntfrq_el0 instead.
+ */
+double calibrateCycleCounterFrequency()
+{
+#if defined(__aarch64__)
+  uint64_t frequency;
+  asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+  return static_cast<double>(frequency);
+#elif defined(RAJAPERF_HAVE_CYCLE_COUNTER)
+  using clock = std::chrono::steady_clock;
+  const clock::time_point clock_start = clock::now();
+  const uint64_t cycles_start = readCycleCounter();
+  clock::time_point clock_stop = clock_start;
+  while (clock_stop - clock_start < std::chrono::milliseconds(20)) {
+    clock_stop = clock::now();
+  }
+  const uint64_t cycles_stop = readCycleCounter();
+  return (cycles_stop - cycles_start) /
+         std::chrono::duration<double>(clock_stop - clock_start).count();
+#else
+  return 1.0;
+#endif
+}
+
+/*
+ * The cycle counter overhead is in counter ticks so it can be taken before
+ * the frequency is known.
+ */
+uint64_t measureCycleCounterOverhead()
+{
+  uint64_t overhead = std::numeric_limits<uint64_t>::max();
+  for (int i = 0; i < num_timer_samples; ++i) {
+    const uint64_t start = readCycleCounter();
+    const uint64_t stop = readCycleCounter();
+    overhead = std::min(overhead, stop - start);
+  }
+  return overhead;
+}
+
+double measureRAJATimerOverhead()
+{
+  double overhead = std::numeric_limits<double>::max();
+  for (int i = 0; i < num_timer_samples; ++i) {
+    RAJA::Timer timer;
+    timer.start();
+    timer.stop();
+    overhead = std::min(overhead, static_cast<double>(timer.elapsed()));
+  }
+  return overhead;
+}
+
+/*
+ * RAJA::Timer resolution is the smallest nonzero elapsed time of a region
+ * that spins until the elapsed time changes.
+ */
+double measureRAJATimerResolution()
+{
+  double resolution = std::numeric_limits<double>::max();
+  for (int i = 0; i < num_timer_samples / 100; ++i) {
+    RAJA::Timer timer;
+    timer.start();
+    double elapsed = 0.0;
+    while (elapsed <= 0.0) {
+      timer.stop();
+      elapsed = timer.elapsed();
+    }
+    resolution = std::min(resolution, elapsed);
+  }
+  return resolution;
+}
+
+struct TimerProperties
+{
+  double frequency;
+  double resolution;
+  double overhead;
+};
+
+const TimerProperties& getCycleCounterProperties()
+{
+  static const TimerProperties properties = []() {
+    const uint64_t overhead_cycles = measureCycleCounterOverhead();
+    const double frequency = calibrateCycleCounterFrequency();
+    return TimerProperties{frequency, 1.0 / frequency,
+                           overhead_cycles / frequency};
+  }();
+  return properties;
+}
+
+const TimerProperties& getRAJATimerProperties()
+{
+  static const TimerProperties properties = []() {
+    const double resolution = measureRAJATimerResolution();
+    return TimerProperties{1.0 / resolution, resolution,
+                           measureRAJATimerOverhead()};
+  }();
+  return properties;
+}
+
+}  // closing brace for anonymous namespace
+
+bool haveCycleCounter()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+  // invariant tsc bit of the advanced power management leaf
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) {
+    return false;
+  }
+  return (edx & (1u << 8)) != 0;
+#elif defined(__aarch64__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+double getCycleCounterFrequency()
+{
+  return getCycleCounterProperties().frequency;
+}
+
+void setUseCycleCounter(bool use)
+{
+  use_cycle_counter = use && haveCycleCounter();
+  if (use_cycle_counter) {
+    // calibrate now so no timed region does it
+    getCycleCounterProperties();
+  }
+}
+
+bool getUseCycleCounter()
+{
+  return use_cycle_counter;
+}
+
+double getTimerResolution()
+{
+  return use_cycle_counter ? getCycleCounterProperties().resolution
+                           : getRAJATimerProperties().resolution;
+}
+
+double getTimerOverhead()
+{
+  return use_cycle_counter ? getCycleCounterProperties().overhead
+                           : getRAJATimerProperties().overhead;
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
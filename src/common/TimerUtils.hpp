@@ -0,0 +1,144 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Host timer used for kernel timed regions, either RAJA::Timer or, with
+/// '--host-timer cycle', the cycle counter of the cpu, the time stamp
+/// counter on x86 and the virtual counter cntvct_el0 on aarch64.
+///
+/// The cycle counter frequency is calibrated against std::chrono once, and
+/// the measured overhead of a start, stop pair is subtracted from each
+/// elapsed time, so short timed regions can be measured.
+///
+
+#ifndef RAJAPerf_TimerUtils_HPP
+#define RAJAPerf_TimerUtils_HPP
+
+#include "RAJA/util/Timer.hpp"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#define RAJAPERF_HAVE_CYCLE_COUNTER
+#elif defined(__aarch64__)
+#define RAJAPERF_HAVE_CYCLE_COUNTER
+#endif
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Read the cycle counter, ordered with the surrounding instructions.
+ * Returns 0 if there is no cycle counter.
+ */
+inline uint64_t readCycleCounter()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+  _mm_lfence();
+  const uint64_t cycles = __rdtsc();
+  _mm_lfence();
+  return cycles;
+#elif defined(__aarch64__)
+  uint64_t cycles;
+  asm volatile("isb; mrs %0, cntvct_el0" : "=r"(cycles) :: "memory");
+  return cycles;
+#else
+  return 0;
+#endif
+}
+
+/*!
+ * \brief Return true if the cycle counter can be used to time, ie. on x86 the
+ * time stamp counter must run at a constant rate.
+ */
+bool haveCycleCounter();
+
+/*!
+ * \brief Return the cycle counter frequency in Hz, calibrated on first call.
+ */
+double getCycleCounterFrequency();
+
+/*!
+ * \brief Use the cycle counter, or RAJA::Timer, for HostTimers started after
+ * this call.
+ */
+void setUseCycleCounter(bool use_cycle_counter);
+bool getUseCycleCounter();
+
+/*!
+ * \brief Return the resolution in seconds of the timer in use, the smallest
+ * nonzero difference between two reads of it.
+ */
+double getTimerResolution();
+
+/*!
+ * \brief Return the overhead in seconds of the timer in use, the smallest time
+ * measured for an empty timed region. With the cycle counter this is
+ * subtracted from elapsed times.
+ */
+double getTimerOverhead();
+
+/*!
+ * \brief Accumulating timer with the interface of RAJA::Timer, used for the
+ * timed regions of kernels.
+ */
+class HostTimer
+{
+public:
+  using ElapsedType = RAJA::Timer::ElapsedType;
+
+  void start()
+  {
+    m_use_cycles = getUseCycleCounter();
+    if (m_use_cycles) {
+      m_start_cycles = readCycleCounter();
+    } else {
+      m_timer.start();
+    }
+  }
+
+  void stop()
+  {
+    if (m_use_cycles) {
+      const uint64_t stop_cycles = readCycleCounter();
+      const ElapsedType time =
+          (stop_cycles - m_start_cycles) / getCycleCounterFrequency() -
+          getTimerOverhead();
+      m_cycle_elapsed += (time > 0.0) ? time : 0.0;
+    } else {
+      m_timer.stop();
+    }
+  }
+
+  ElapsedType elapsed() const
+  {
+    return m_cycle_elapsed + m_timer.elapsed();
+  }
+
+  void reset()
+  {
+    m_cycle_elapsed = 0.0;
+    m_timer.reset();
+  }
+
+private:
+  bool m_use_cycles = false;
+  uint64_t m_start_cycles = 0;
+  ElapsedType m_cycle_elapsed = 0.0;
+  RAJA::Timer m_timer;
+};
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
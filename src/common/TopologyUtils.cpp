@@ -0,0 +1,358 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TopologyUtils.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+namespace
+{
+
+/*
+ * Return the first line of a sysfs file, empty if it can not be read.
+ */
+std::string readSysfsLine(const std::string& path)
+{
+  std::ifstream file(path);
+  std::string line;
+  if (file) {
+    std::getline(file, line);
+  }
+  return line;
+}
+
+bool contains(const std::vector<int>& ids, int id)
+{
+  return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+/*
+ * Return the sysfs name of a PCI bus id from CUDA or HIP, which may have
+ * upper case hex digits and a longer domain than the 4 digits of sysfs.
+ */
+std::string getSysfsBusId(const std::string& bus_id)
+{
+  std::string name;
+  for (char c : bus_id) {
+    name += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  }
+  const size_t colon = name.find(':');
+  if (colon != std::string::npos && colon > 4) {
+    name = name.substr(colon - 4);
+  }
+  return name;
+}
+
+/*
+ * Return the NUMA node of a sysfs device directory, -1 if not known.
+ */
+int getDeviceNumaNode(const std::string& device_dir)
+{
+  const std::string node = readSysfsLine(device_dir + "/numa_node");
+  return node.empty() ? -1 : std::atoi(node.c_str());
+}
+
+#if defined(__linux__)
+/*
+ * Return the RDMA and Slingshot network devices and their NUMA nodes.
+ */
+std::vector<std::pair<std::string, int>> getNetworkDevices()
+{
+  std::vector<std::pair<std::string, int>> nics;
+  for (const std::string class_dir : {"/sys/class/infiniband", "/sys/class/cxi"}) {
+    DIR* dir = opendir(class_dir.c_str());
+    if (dir == nullptr) {
+      continue;
+    }
+    std::vector<std::string> names;
+    while (dirent* entry = readdir(dir)) {
+      if (entry->d_name[0] != '.') {
+        names.emplace_back(entry->d_name);
+      }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+    for (const std::string& name : names) {
+      nics.emplace_back(name,
+          getDeviceNumaNode(class_dir + "/" + name + "/device"));
+    }
+  }
+  return nics;
+}
+
+/*
+ * Return the NUMA node of a page touched by the calling thread, where the
+ * memory policy of the rank and first touch put its data.
+ */
+int getTouchedPageNumaNode()
+{
+  int node = -1;
+#if defined(SYS_get_mempolicy)
+  // values from linux/mempolicy.h
+  constexpr int mpol_f_node = 1 << 0;
+  constexpr int mpol_f_addr = 1 << 1;
+
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  void* ptr = mmap(nullptr, page_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) {
+    return -1;
+  }
+  static_cast<volatile char*>(ptr)[0] = 1;
+  if (syscall(SYS_get_mempolicy, &node, nullptr, 0, ptr,
+              mpol_f_node | mpol_f_addr) != 0) {
+    node = -1;
+  }
+  munmap(ptr, page_size);
+#endif
+  return node;
+}
+
+/*
+ * Return the memory policy of the rank, ie. "bind 1" or "default".
+ */
+std::string getMemoryPolicy()
+{
+#if defined(SYS_get_mempolicy)
+  // values from linux/mempolicy.h
+  static const char* const mode_names[] = {"default", "preferred", "bind",
+                                           "interleave", "local"};
+  constexpr int mpol_mode_mask = 0xff;
+
+  constexpr size_t bits_per_mask = CHAR_BIT * sizeof(unsigned long);
+  constexpr size_t max_nodes = 1024;
+  std::vector<unsigned long> mask(max_nodes / bits_per_mask, 0ul);
+
+  int mode = 0;
+  if (syscall(SYS_get_mempolicy, &mode, mask.data(), max_nodes,
+              nullptr, 0) != 0) {
+    return "unknown";
+  }
+  mode &= mpol_mode_mask;
+  if (mode < 0 || mode >= static_cast<int>(sizeof(mode_names)/sizeof(mode_names[0]))) {
+    return "mode " + std::to_string(mode);
+  }
+  std::string policy = mode_names[mode];
+  if (mode != 0 && mode != 4) {
+    std::vector<int> nodes;
+    for (size_t node = 0; node < max_nodes; ++node) {
+      if (mask[node / bits_per_mask] & (1ul << (node % bits_per_mask))) {
+        nodes.push_back(static_cast<int>(node));
+      }
+    }
+    policy += " " + formatCPUList(nodes);
+  }
+  return policy;
+#else
+  return "unknown";
+#endif
+}
+#endif
+
+}  // closing brace for unnamed namespace
+
+std::vector<int> parseCPUList(const std::string& list)
+{
+  std::vector<int> ids;
+  std::istringstream str(list);
+  std::string range;
+  while (std::getline(str, range, ',')) {
+    if (range.empty()) {
+      continue;
+    }
+    const size_t dash = range.find('-');
+    const int first = std::atoi(range.substr(0, dash).c_str());
+    const int last = (dash == std::string::npos)
+                   ? first : std::atoi(range.substr(dash+1).c_str());
+    for (int id = first; id <= last; ++id) {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+
+std::string formatCPUList(const std::vector<int>& ids, const std::string& sep)
+{
+  std::vector<int> sorted(ids);
+  std::sort(sorted.begin(), sorted.end());
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+  std::string list;
+  for (size_t i = 0; i < sorted.size(); ) {
+    size_t j = i;
+    while (j+1 < sorted.size() && sorted[j+1] == sorted[j] + 1) {
+      ++j;
+    }
+    if (!list.empty()) {
+      list += sep;
+    }
+    list += std::to_string(sorted[i]);
+    if (j > i) {
+      list += "-" + std::to_string(sorted[j]);
+    }
+    i = j+1;
+  }
+  return list;
+}
+
+std::vector<int> getNumaNodes()
+{
+  return parseCPUList(readSysfsLine("/sys/devices/system/node/online"));
+}
+
+std::vector<int> getNumaDistances(int node)
+{
+  std::vector<int> distances;
+  std::istringstream str(readSysfsLine("/sys/devices/system/node/node" +
+                                       std::to_string(node) + "/distance"));
+  int distance = 0;
+  while (str >> distance) {
+    distances.push_back(distance);
+  }
+  return distances;
+}
+
+RankPlacement getRankPlacement(int gpu_device, const std::string& gpu_bus_id)
+{
+  RankPlacement placement;
+
+  char hostname[256] = {'\0'};
+  gethostname(hostname, sizeof(hostname)-1);
+  placement.host = hostname;
+
+  placement.gpu_device = gpu_device;
+  placement.gpu_bus_id = gpu_bus_id;
+
+#if defined(__linux__)
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &mask)) {
+        placement.cpus.push_back(cpu);
+      }
+    }
+  }
+
+  for (int node : getNumaNodes()) {
+    const std::vector<int> node_cpus = parseCPUList(
+        readSysfsLine("/sys/devices/system/node/node" + std::to_string(node) +
+                      "/cpulist"));
+    for (int cpu : node_cpus) {
+      if (contains(placement.cpus, cpu)) {
+        placement.cpu_nodes.push_back(node);
+        break;
+      }
+    }
+  }
+
+  placement.data_node = getTouchedPageNumaNode();
+  placement.memory_policy = getMemoryPolicy();
+
+  if (!gpu_bus_id.empty()) {
+    const std::string device_dir = "/sys/bus/pci/devices/" +
+                                   getSysfsBusId(gpu_bus_id);
+    placement.gpu_node = getDeviceNumaNode(device_dir);
+    placement.gpu_local_cpus =
+        parseCPUList(readSysfsLine(device_dir + "/local_cpulist"));
+  }
+
+  placement.nics = getNetworkDevices();
+#else
+  placement.memory_policy = "unknown";
+#endif
+
+  return placement;
+}
+
+std::vector<std::string> getPlacementWarnings(const RankPlacement& placement)
+{
+  std::vector<std::string> warnings;
+  const std::string cpu_nodes = formatCPUList(placement.cpu_nodes);
+
+  if (placement.data_node >= 0 && !placement.cpu_nodes.empty() &&
+      !contains(placement.cpu_nodes, placement.data_node)) {
+    warnings.push_back(
+        "data is on NUMA node " + std::to_string(placement.data_node) +
+        " (memory policy " + placement.memory_policy + ") but the cpus are on"
+        " NUMA nodes " + cpu_nodes + ", bind memory to the cpus, ie."
+        " numactl --membind=" + cpu_nodes);
+  }
+
+  if (placement.gpu_device >= 0 && !placement.cpus.empty()) {
+    bool gpu_remote = false;
+    if (!placement.gpu_local_cpus.empty()) {
+      gpu_remote = std::none_of(placement.cpus.begin(), placement.cpus.end(),
+          [&](int cpu) { return contains(placement.gpu_local_cpus, cpu); });
+    } else if (placement.gpu_node >= 0 && !placement.cpu_nodes.empty()) {
+      gpu_remote = !contains(placement.cpu_nodes, placement.gpu_node);
+    }
+    if (gpu_remote) {
+      std::string hint;
+      if (placement.gpu_node >= 0) {
+        const std::string gpu_node = std::to_string(placement.gpu_node);
+        hint = "numactl --cpunodebind=" + gpu_node + " --membind=" + gpu_node;
+      } else {
+        hint = "taskset -c " + formatCPUList(placement.gpu_local_cpus);
+      }
+      warnings.push_back(
+          "GPU " + std::to_string(placement.gpu_device) + " (" +
+          placement.gpu_bus_id + ") is on NUMA node " +
+          std::to_string(placement.gpu_node) + " with cpus " +
+          formatCPUList(placement.gpu_local_cpus) + " but the rank runs on"
+          " cpus " + formatCPUList(placement.cpus) + ", bind the rank near"
+          " its GPU, ie. " + hint + " or srun --gpu-bind=closest");
+    }
+  }
+
+  if (!placement.nics.empty() && !placement.cpu_nodes.empty()) {
+    bool any_local = false;
+    bool all_known = true;
+    for (const auto& nic : placement.nics) {
+      any_local = any_local || contains(placement.cpu_nodes, nic.second);
+      all_known = all_known && nic.second >= 0;
+    }
+    if (!any_local && all_known) {
+      std::string nics;
+      for (const auto& nic : placement.nics) {
+        nics += (nics.empty() ? "" : " ") + nic.first + ":" +
+                std::to_string(nic.second);
+      }
+      warnings.push_back(
+          "no network device is on the NUMA nodes " + cpu_nodes +
+          " of the cpus (device:node " + nics + "), bind ranks near a"
+          " network device for MPI kernels");
+    }
+  }
+
+  return warnings;
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
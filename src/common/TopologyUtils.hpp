@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods to find where a rank runs, the cpus it may run on, the NUMA
+/// nodes of those cpus, of its data, and of its GPU and network devices,
+/// so misplaced ranks can be reported before their numbers are trusted.
+///
+/// The topology is read from Linux sysfs, /sys/devices/system/node for
+/// NUMA nodes and /sys/bus/pci/devices for PCI devices, so nothing is found
+/// on other systems.
+///
+
+#ifndef RAJAPerf_TopologyUtils_HPP
+#define RAJAPerf_TopologyUtils_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Placement of the calling rank. NUMA nodes are -1 if not known.
+ */
+struct RankPlacement
+{
+  std::string host;
+  std::vector<int> cpus;           // cpus in the affinity mask
+  std::vector<int> cpu_nodes;      // NUMA nodes of the cpus
+  int data_node = -1;              // NUMA node of a page touched by the rank
+  std::string memory_policy;       // memory policy of the rank, ie. "default"
+  int gpu_device = -1;             // -1 if no GPU is used
+  std::string gpu_bus_id;
+  int gpu_node = -1;
+  std::vector<int> gpu_local_cpus; // cpus local to the GPU
+  std::vector<std::pair<std::string, int>> nics; // network devices and nodes
+};
+
+/*!
+ * \brief Return the placement of the calling rank, gpu_device is the GPU it
+ * uses or -1 and gpu_bus_id its PCI bus id.
+ */
+RankPlacement getRankPlacement(int gpu_device, const std::string& gpu_bus_id);
+
+/*!
+ * \brief Return the online NUMA nodes, empty if not known.
+ */
+std::vector<int> getNumaNodes();
+
+/*!
+ * \brief Return the distances from node to each online node, as in the
+ * ACPI SLIT table where 10 is local, empty if not known.
+ */
+std::vector<int> getNumaDistances(int node);
+
+/*!
+ * \brief Return the warnings of misplacement of a rank, data or GPU on
+ * NUMA nodes away from its cpus, each with a hint of a better binding.
+ */
+std::vector<std::string> getPlacementWarnings(const RankPlacement& placement);
+
+/*!
+ * \brief Parse a Linux cpu or node list like "0-3,8-11".
+ */
+std::vector<int> parseCPUList(const std::string& list);
+
+/*!
+ * \brief Format ids as a Linux cpu or node list like "0-3,8-11", with sep
+ * between the ranges.
+ */
+std::string formatCPUList(const std::vector<int>& ids,
+                          const std::string& sep = ",");
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
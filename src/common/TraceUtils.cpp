@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TraceUtils.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <mutex>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+namespace
+{
+
+using trace_clock = std::chrono::steady_clock;
+
+struct TraceEvent
+{
+  std::string name;
+  std::string category;
+  double start_time;
+  double end_time;
+  int tid;
+  std::vector<TraceArg> args;
+};
+
+bool trace_initialized = false;
+trace_clock::time_point trace_start;
+
+//
+// Events may be added from the host threads of concurrent kernels, so they
+// are guarded by a mutex.
+//
+std::mutex trace_mutex;
+std::vector<TraceEvent> trace_events;
+
+//
+// Host threads are numbered in the order they first add an event, the
+// device track is shown after them.
+//
+std::atomic<int> num_trace_threads{0};
+const int device_tid = 1000000;
+
+int getTraceThreadId()
+{
+  thread_local int tid = num_trace_threads++;
+  return tid;
+}
+
+std::string escapeJSON(const std::string& str)
+{
+  std::string escaped;
+  escaped.reserve(str.size());
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+      escaped += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+      escaped += buf;
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+void writeThreadName(std::ostream& str, int pid, int tid,
+                     const std::string& name)
+{
+  str << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+      << ",\"tid\":" << tid
+      << ",\"args\":{\"name\":\"" << escapeJSON(name) << "\"}}";
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Start recording events.
+ */
+void initTrace()
+{
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  trace_events.clear();
+  trace_start = trace_clock::now();
+  trace_initialized = true;
+}
+
+/*
+ * Stop recording events.
+ */
+void finalizeTrace()
+{
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  trace_initialized = false;
+  trace_events.clear();
+}
+
+bool haveTrace()
+{
+  return trace_initialized;
+}
+
+double getTraceTime()
+{
+  return std::chrono::duration<double>(trace_clock::now() - trace_start).count();
+}
+
+void addTraceEvent(const std::string& name, const std::string& category,
+                   double start_time, double end_time,
+                   const std::vector<TraceArg>& args,
+                   TraceTrack track)
+{
+  if (!trace_initialized) {
+    return;
+  }
+  const int tid = (track == DeviceTrack) ? device_tid : getTraceThreadId();
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  trace_events.emplace_back(
+      TraceEvent{name, category, start_time, end_time, tid, args});
+}
+
+/*
+ * Events are complete ('X') events with times in microseconds, threads
+ * are named with metadata ('M') events.
+ */
+void writeTrace(std::ostream& str, int pid)
+{
+  std::lock_guard<std::mutex> lock(trace_mutex);
+
+  bool have_device_events = false;
+  for (const TraceEvent& event : trace_events) {
+    have_device_events = have_device_events || (event.tid == device_tid);
+  }
+
+  str << std::fixed << std::setprecision(3);
+  str << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+  const int num_threads = num_trace_threads;
+  for (int tid = 0; tid < num_threads; ++tid) {
+    writeThreadName(str, pid, tid,
+        tid == 0 ? std::string("host") :
+                   "host thread " + std::to_string(tid));
+    str << ",\n";
+  }
+  if (have_device_events) {
+    writeThreadName(str, pid, device_tid, "device");
+    str << ",\n";
+  }
+  str << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+      << ",\"args\":{\"name\":\"rank " << pid << "\"}}";
+
+  for (const TraceEvent& event : trace_events) {
+    str << ",\n{\"name\":\"" << escapeJSON(event.name) << "\""
+        << ",\"cat\":\"" << escapeJSON(event.category) << "\""
+        << ",\"ph\":\"X\""
+        << ",\"ts\":" << event.start_time * 1.0e6
+        << ",\"dur\":" << (event.end_time - event.start_time) * 1.0e6
+        << ",\"pid\":" << pid
+        << ",\"tid\":" << event.tid;
+    if (!event.args.empty()) {
+      str << ",\"args\":{";
+      for (size_t ia = 0; ia < event.args.size(); ++ia) {
+        str << (ia > 0 ? "," : "")
+            << "\"" << escapeJSON(event.args[ia].first) << "\":\""
+            << escapeJSON(event.args[ia].second) << "\"";
+      }
+      str << "}";
+    }
+    str << "}";
+  }
+
+  str << "\n]}\n";
+  str.flush();
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
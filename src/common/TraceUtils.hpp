@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for recording a timeline of suite execution, the warmup, setUp,
+/// rep, checksum, and tearDown phases of each kernel variant tuning, and
+/// writing it as a Chrome trace JSON file that Perfetto or chrome://tracing
+/// can load.
+///
+/// Host events are recorded on a track per host thread. Device operations
+/// are recorded on a device track when device activity is traced, see
+/// ActivityUtils.hpp. When tracing is off recording an event is a check of
+/// one flag.
+///
+
+#ifndef RAJAPerf_TraceUtils_HPP
+#define RAJAPerf_TraceUtils_HPP
+
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Track an event is shown on.
+ */
+enum TraceTrack
+{
+  HostTrack,   // track of the host thread adding the event
+  DeviceTrack  // track of device operations
+};
+
+/*!
+ * \brief Name and value of an argument shown with an event.
+ */
+using TraceArg = std::pair<std::string, std::string>;
+
+/*!
+ * \brief Start recording events, event times are relative to this call.
+ */
+void initTrace();
+
+/*!
+ * \brief Stop recording events and drop the recorded events.
+ */
+void finalizeTrace();
+
+/*!
+ * \brief Return true if events are being recorded.
+ */
+bool haveTrace();
+
+/*!
+ * \brief Return time in seconds since initTrace.
+ */
+double getTraceTime();
+
+/*!
+ * \brief Record an event from start_time to end_time, in seconds since
+ * initTrace. May be called from any host thread.
+ */
+void addTraceEvent(const std::string& name, const std::string& category,
+                   double start_time, double end_time,
+                   const std::vector<TraceArg>& args,
+                   TraceTrack track = HostTrack);
+
+/*!
+ * \brief Write the recorded events as Chrome trace JSON, pid is the process
+ * id shown for the events, ie. the MPI rank.
+ */
+void writeTrace(std::ostream& str, int pid);
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
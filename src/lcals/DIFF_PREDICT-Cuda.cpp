@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -34,7 +35,7 @@ __global__ void diff_predict(Real_ptr px, Real_ptr cx,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void DIFF_PREDICT::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -65,7 +66,7 @@ void DIFF_PREDICT::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
          DIFF_PREDICT_BODY;
        });
@@ -78,7 +79,7 @@ void DIFF_PREDICT::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(DIFF_PREDICT, Cuda)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(DIFF_PREDICT, Cuda, RAJA_CUDA)
 
 } // end namespace lcals
 } // end namespace rajaperf
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -35,7 +36,7 @@ __global__ void diff_predict(Real_ptr px, Real_ptr cx,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void DIFF_PREDICT::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -66,7 +67,7 @@ void DIFF_PREDICT::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
          DIFF_PREDICT_BODY;
        });
@@ -79,7 +80,7 @@ void DIFF_PREDICT::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(DIFF_PREDICT, Hip)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(DIFF_PREDICT, Hip, RAJA_HIP)
 
 } // end namespace lcals
 } // end namespace rajaperf
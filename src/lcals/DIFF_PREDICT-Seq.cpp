@@ -10,7 +10,12 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SimdUtils.hpp"
+#include "common/PrefetchUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,8 +23,154 @@ namespace lcals
 {
 
 
-void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DIFF_PREDICT::runSeqVariantSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DIFF_PREDICT_DATA_SETUP;
+
+#if defined(RUN_RAJA_SEQ)
+  auto diffpredict_lam = [=](Index_type i) {
+                           DIFF_PREDICT_BODY;
+                         };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DIFF_PREDICT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), diffpredict_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  DIFF_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DIFF_PREDICT::runSeqVariantPrefetch(VariantID vid, Index_type distance)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DIFF_PREDICT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ib = ibegin; ib < iend; ib += prefetch::line_length) {
+          const Index_type ie = std::min(ib + prefetch::line_length, iend);
+          if ( ib + distance < iend ) {
+            DIFF_PREDICT_PREFETCH(ib + distance);
+          }
+          for (Index_type i = ib; i < ie; ++i ) {
+            DIFF_PREDICT_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DIFF_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DIFF_PREDICT::runSeqVariantSplit(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DIFF_PREDICT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DIFF_PREDICT_SPLIT_BODY_0;
+        }
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DIFF_PREDICT_SPLIT_BODY_1;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DIFF_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd(vid);
+    return;
+  }
+
+  const std::vector<Index_type> distances = prefetch::getDistances();
+  if ( tune_idx >= 2 && tune_idx < 2 + distances.size() ) {
+    runSeqVariantPrefetch(vid, distances[tune_idx - 2]);
+    return;
+  }
+  if ( tune_idx == 2 + distances.size() ) {
+    runSeqVariantSplit(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -88,5 +239,21 @@ void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+void DIFF_PREDICT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+  }
+
+  if ( vid == Base_Seq ) {
+    for (Index_type distance : prefetch::getDistances()) {
+      addVariantTuningName(vid, prefetch::getPrefetchTuningName(distance));
+    }
+    addVariantTuningName(vid, prefetch::getSplitTuningName());
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -33,6 +33,11 @@
 ///   px[i + offset * 12] = cr;
 /// }
 ///
+/// The Base CPU variants have tunings that prefetch each array a distance
+/// of elements ahead (prefetch_<distance>) and that run the body in two
+/// loops (split), the first storing cr in px[i + offset * 13] for the
+/// second.
+///
 
 #ifndef RAJAPerf_Lcals_DIFF_PREDICT_HPP
 #define RAJAPerf_Lcals_DIFF_PREDICT_HPP
@@ -66,6 +71,48 @@
   px[i + offset * 13] = cr - px[i + offset * 12]; \
   px[i + offset * 12] = cr;
 
+#define DIFF_PREDICT_PREFETCH(i) \
+  prefetchRead(&cx[(i) + offset * 4]); \
+  prefetchWrite(&px[(i) + offset * 4]); \
+  prefetchWrite(&px[(i) + offset * 5]); \
+  prefetchWrite(&px[(i) + offset * 6]); \
+  prefetchWrite(&px[(i) + offset * 7]); \
+  prefetchWrite(&px[(i) + offset * 8]); \
+  prefetchWrite(&px[(i) + offset * 9]); \
+  prefetchWrite(&px[(i) + offset * 10]); \
+  prefetchWrite(&px[(i) + offset * 11]); \
+  prefetchWrite(&px[(i) + offset * 12]); \
+  prefetchWrite(&px[(i) + offset * 13]);
+
+#define DIFF_PREDICT_SPLIT_BODY_0  \
+  Real_type ar, br, cr; \
+\
+  ar                  = cx[i + offset * 4];       \
+  br                  = ar - px[i + offset * 4];  \
+  px[i + offset * 4]  = ar;                       \
+  cr                  = br - px[i + offset * 5];  \
+  px[i + offset * 5]  = br;                       \
+  ar                  = cr - px[i + offset * 6];  \
+  px[i + offset * 6]  = cr;                       \
+  br                  = ar - px[i + offset * 7];  \
+  px[i + offset * 7]  = ar;                       \
+  cr                  = br - px[i + offset * 8];  \
+  px[i + offset * 8]  = br;                       \
+  px[i + offset * 13] = cr;
+
+#define DIFF_PREDICT_SPLIT_BODY_1  \
+  Real_type ar, br, cr; \
+\
+  cr                  = px[i + offset * 13];      \
+  ar                  = cr - px[i + offset * 9];  \
+  px[i + offset * 9]  = cr;                       \
+  br                  = ar - px[i + offset * 10]; \
+  px[i + offset * 10] = ar;                       \
+  cr                  = br - px[i + offset * 11]; \
+  px[i + offset * 11] = br;                       \
+  px[i + offset * 13] = cr - px[i + offset * 12]; \
+  px[i + offset * 12] = cr;
+
 
 #include "common/KernelBase.hpp"
 
@@ -95,11 +142,18 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  void runSeqVariantPrefetch(VariantID vid, Index_type distance);
+  void runSeqVariantSplit(VariantID vid);
+  void runOpenMPVariantPrefetch(VariantID vid, Index_type distance);
+  void runOpenMPVariantSplit(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
 
 private:
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -34,7 +35,7 @@ __global__ void eos(Real_ptr x, Real_ptr y, Real_ptr z, Real_ptr u,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void EOS::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -65,7 +66,7 @@ void EOS::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
          EOS_BODY;
        });
@@ -78,7 +79,7 @@ void EOS::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(EOS, Cuda)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(EOS, Cuda, RAJA_CUDA)
 
 } // end namespace lcals
 } // end namespace rajaperf
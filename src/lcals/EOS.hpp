@@ -15,6 +15,9 @@
 ///                    t*( u[i+6] + q*( u[i+5] + q*u[i+4] ) ) );
 /// }
 ///
+/// The Base CPU variants have tunings that prefetch each array a distance
+/// of elements ahead (prefetch_<distance>).
+///
 
 #ifndef RAJAPerf_Lcals_EOS_HPP
 #define RAJAPerf_Lcals_EOS_HPP
@@ -35,6 +38,12 @@
                 t*( u[i+3] + r*( u[i+2] + r*u[i+1] ) + \
                    t*( u[i+6] + q*( u[i+5] + q*u[i+4] ) ) );
 
+#define EOS_PREFETCH(i) \
+  prefetchRead(&u[i]); \
+  prefetchRead(&z[i]); \
+  prefetchRead(&y[i]); \
+  prefetchWrite(&x[i]);
+
 
 #include "common/KernelBase.hpp"
 
@@ -64,11 +73,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  void runSeqVariantPrefetch(VariantID vid, Index_type distance);
+  void runOpenMPVariantPrefetch(VariantID vid, Index_type distance);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
 
 private:
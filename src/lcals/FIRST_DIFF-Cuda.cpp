@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -33,7 +34,7 @@ __global__ void first_diff(Real_ptr x, Real_ptr y,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void FIRST_DIFF::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -63,7 +64,7 @@ void FIRST_DIFF::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
          FIRST_DIFF_BODY;
        });
@@ -76,7 +77,7 @@ void FIRST_DIFF::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(FIRST_DIFF, Cuda)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(FIRST_DIFF, Cuda, RAJA_CUDA)
 
 } // end namespace lcals
 } // end namespace rajaperf
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -33,7 +34,7 @@ __global__ void first_diff(Real_ptr x, Real_ptr y,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void FIRST_DIFF::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -63,7 +64,7 @@ void FIRST_DIFF::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
          FIRST_DIFF_BODY;
        });
@@ -76,7 +77,7 @@ void FIRST_DIFF::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(FIRST_DIFF, Hip)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(FIRST_DIFF, Hip, RAJA_HIP)
 
 } // end namespace lcals
 } // end namespace rajaperf
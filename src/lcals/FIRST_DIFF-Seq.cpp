@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SimdUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void FIRST_DIFF::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_DIFF::runSeqVariantSimd(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -26,6 +28,67 @@ void FIRST_DIFF::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 
   FIRST_DIFF_DATA_SETUP;
 
+#if defined(RUN_RAJA_SEQ)
+  auto firstdiff_lam = [=](Index_type i) {
+                         FIRST_DIFF_BODY;
+                       };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIRST_DIFF_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), firstdiff_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIRST_DIFF : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FIRST_DIFF::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_DIFF_DATA_SETUP;
+
 #if defined(RUN_RAJA_SEQ)
   auto firstdiff_lam = [=](Index_type i) {
                          FIRST_DIFF_BODY;
@@ -88,5 +151,14 @@ void FIRST_DIFF::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 
 }
 
+void FIRST_DIFF::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
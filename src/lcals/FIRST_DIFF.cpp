@@ -37,6 +37,8 @@ FIRST_DIFF::FIRST_DIFF(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Stencil);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -45,6 +47,8 @@ FIRST_DIFF::FIRST_DIFF(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
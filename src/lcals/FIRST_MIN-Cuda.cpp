@@ -57,6 +57,112 @@ __global__ void first_min(Real_ptr x,
   }
 }
 
+//
+// Keep the smaller value, or the smaller index when the values are equal,
+// so the result is the first minimum whatever order the values combine in.
+//
+__device__ __forceinline__ void first_min_combine(MyMinLoc& mymin,
+                                                  Real_type val, Index_type loc)
+{
+  if ( val < mymin.val || ( val == mymin.val && loc < mymin.loc ) ) {
+    mymin.val = val;
+    mymin.loc = loc;
+  }
+}
+
+//
+// Reduce mymin over the threads of a block, the result is valid in thread 0.
+// Warps reduce with shuffles of the value and index and the warp results
+// are combined through shared memory.
+//
+template < size_t block_size >
+__device__ __forceinline__ MyMinLoc first_min_block_reduce(MyMinLoc mymin,
+                                                           MyMinLoc mininit)
+{
+  static_assert(block_size % cuda_warp_size == 0,
+                "block_size must be a multiple of the warp size");
+  constexpr size_t num_warps = block_size / cuda_warp_size;
+
+  __shared__ MyMinLoc warp_minloc[num_warps];
+
+  const size_t lane = threadIdx.x % cuda_warp_size;
+  const size_t warp = threadIdx.x / cuda_warp_size;
+
+  for (int offset = cuda_warp_size / 2; offset > 0; offset /= 2) {
+    first_min_combine(mymin,
+                      __shfl_down_sync(0xffffffffu, mymin.val, offset),
+                      __shfl_down_sync(0xffffffffu, mymin.loc, offset));
+  }
+
+  if (num_warps > 1) {
+    if (lane == 0) {
+      warp_minloc[warp] = mymin;
+    }
+    __syncthreads();
+
+    if (warp == 0) {
+      mymin = (lane < num_warps) ? warp_minloc[lane] : mininit;
+      for (int offset = cuda_warp_size / 2; offset > 0; offset /= 2) {
+        first_min_combine(mymin,
+                          __shfl_down_sync(0xffffffffu, mymin.val, offset),
+                          __shfl_down_sync(0xffffffffu, mymin.loc, offset));
+      }
+    }
+  }
+
+  return mymin;
+}
+
+//
+// First pass of the two pass reduction, each block writes its min-loc to
+// dminloc[blockIdx.x].
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void first_min_partial(Real_ptr x,
+                                  MyMinLoc* dminloc,
+                                  MyMinLoc mininit,
+                                  Index_type iend)
+{
+  MyMinLoc mymin = mininit;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    FIRST_MIN_BODY;
+  }
+
+  mymin = first_min_block_reduce<block_size>(mymin, mininit);
+
+  if ( threadIdx.x == 0 ) {
+    dminloc[ blockIdx.x ] = mymin;
+  }
+}
+
+//
+// Second pass of the two pass reduction, a single block combines the
+// num_partial block results.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void first_min_final(MyMinLoc* dminloc_partial,
+                                Index_type num_partial,
+                                MyMinLoc* dminloc,
+                                MyMinLoc mininit)
+{
+  MyMinLoc mymin = mininit;
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    first_min_combine(mymin, dminloc_partial[ i ].val, dminloc_partial[ i ].loc);
+  }
+
+  mymin = first_min_block_reduce<block_size>(mymin, mininit);
+
+  if ( threadIdx.x == 0 ) {
+    *dminloc = mymin;
+  }
+}
+
+
 
 template < size_t block_size >
 void FIRST_MIN::runCudaVariantBlock(VariantID vid)
@@ -145,6 +251,8 @@ void FIRST_MIN::runCudaVariantOccGS(VariantID vid)
     constexpr size_t shmem = sizeof(MyMinLoc)*block_size;
     const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
         (first_min<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("first_min",
+        (first_min<block_size>), block_size, shmem) );
 
     const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
     const size_t grid_size = std::min(normal_grid_size, max_grid_size);
@@ -205,6 +313,105 @@ void FIRST_MIN::runCudaVariantOccGS(VariantID vid)
   }
 }
 
+template < typename exec_policy >
+void FIRST_MIN::runCudaVariantExpt(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  FIRST_MIN_DATA_SETUP;
+
+  if ( vid == RAJA_CUDA ) {
+
+    using VL_TYPE = RAJA::expt::ValLoc<Real_type, Index_type>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       VL_TYPE tloc(m_xmin_init, m_initloc);
+
+       RAJA::forall< exec_policy >( res,
+         RAJA::RangeSegment(ibegin, iend),
+         RAJA::expt::Reduce<RAJA::operators::minimum>(&tloc),
+         [=] __device__ (Index_type i, VL_TYPE& loc) {
+           loc.min(x[i], i);
+         }
+       );
+
+       m_minloc = static_cast<Index_type>(tloc.getLoc());
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIRST_MIN : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FIRST_MIN::runCudaVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  FIRST_MIN_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (first_min_partial<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("first_min_partial",
+        (first_min_partial<block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    MyMinLoc* dminloc_partial;
+    cudaErrchk( cudaMalloc( (void**)&dminloc_partial,
+                            grid_size * sizeof(MyMinLoc) ) );
+
+    MyMinLoc* dminloc;
+    cudaErrchk( cudaMalloc( (void**)&dminloc, sizeof(MyMinLoc) ) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      FIRST_MIN_MINLOC_INIT;
+
+      first_min_partial<block_size><<<grid_size, block_size,
+                              shmem, res.get_stream()>>>(x, dminloc_partial,
+                                                         mymin, iend);
+      cudaErrchk( cudaGetLastError() );
+
+      first_min_final<block_size><<<1, block_size,
+                              shmem, res.get_stream()>>>(dminloc_partial,
+                                                         grid_size,
+                                                         dminloc, mymin);
+      cudaErrchk( cudaGetLastError() );
+
+      cudaErrchk( cudaMemcpyAsync( &mymin, dminloc, sizeof(MyMinLoc),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+
+      m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+    }
+    stopTimer();
+
+    cudaErrchk( cudaFree( dminloc ) );
+    cudaErrchk( cudaFree( dminloc_partial ) );
+
+  } else {
+     getCout() << "\n  FIRST_MIN : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
 void FIRST_MIN::runCudaVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -234,10 +441,54 @@ void FIRST_MIN::runCudaVariant(VariantID vid, size_t tune_idx)
 
         t += 1;
 
+        if ( vid == RAJA_CUDA ) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantExpt<RAJA::cuda_exec<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantExpt<RAJA::cuda_exec_occ_calc<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantTwoPass<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
   } else {
 
     getCout() << "\n  FIRST_MIN : Unknown Cuda variant id = " << vid << std::endl;
@@ -259,10 +510,33 @@ void FIRST_MIN::setCudaTuningDefinitions(VariantID vid)
 
         addVariantTuningName(vid, "occgs_"+std::to_string(block_size));
 
+        if ( vid == RAJA_CUDA ) {
+
+          addVariantTuningName(vid, "expt_block_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "expt_occgs_"+std::to_string(block_size));
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
   }
 }
 
@@ -57,6 +57,112 @@ __global__ void first_min(Real_ptr x,
   }
 }
 
+//
+// Keep the smaller value, or the smaller index when the values are equal,
+// so the result is the first minimum whatever order the values combine in.
+//
+__device__ __forceinline__ void first_min_combine(MyMinLoc& mymin,
+                                                  Real_type val, Index_type loc)
+{
+  if ( val < mymin.val || ( val == mymin.val && loc < mymin.loc ) ) {
+    mymin.val = val;
+    mymin.loc = loc;
+  }
+}
+
+//
+// Reduce mymin over the threads of a block, the result is valid in thread 0.
+// Warps reduce with shuffles of the value and index and the warp results
+// are combined through shared memory.
+//
+template < size_t block_size >
+__device__ __forceinline__ MyMinLoc first_min_block_reduce(MyMinLoc mymin,
+                                                           MyMinLoc mininit)
+{
+  static_assert(block_size % hip_warp_size == 0,
+                "block_size must be a multiple of the warp size");
+  constexpr size_t num_warps = block_size / hip_warp_size;
+
+  __shared__ MyMinLoc warp_minloc[num_warps];
+
+  const size_t lane = threadIdx.x % hip_warp_size;
+  const size_t warp = threadIdx.x / hip_warp_size;
+
+  for (int offset = hip_warp_size / 2; offset > 0; offset /= 2) {
+    first_min_combine(mymin,
+                      __shfl_down(mymin.val, offset, hip_warp_size),
+                      __shfl_down(mymin.loc, offset, hip_warp_size));
+  }
+
+  if (num_warps > 1) {
+    if (lane == 0) {
+      warp_minloc[warp] = mymin;
+    }
+    __syncthreads();
+
+    if (warp == 0) {
+      mymin = (lane < num_warps) ? warp_minloc[lane] : mininit;
+      for (int offset = hip_warp_size / 2; offset > 0; offset /= 2) {
+        first_min_combine(mymin,
+                          __shfl_down(mymin.val, offset, hip_warp_size),
+                          __shfl_down(mymin.loc, offset, hip_warp_size));
+      }
+    }
+  }
+
+  return mymin;
+}
+
+//
+// First pass of the two pass reduction, each block writes its min-loc to
+// dminloc[blockIdx.x].
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void first_min_partial(Real_ptr x,
+                                  MyMinLoc* dminloc,
+                                  MyMinLoc mininit,
+                                  Index_type iend)
+{
+  MyMinLoc mymin = mininit;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    FIRST_MIN_BODY;
+  }
+
+  mymin = first_min_block_reduce<block_size>(mymin, mininit);
+
+  if ( threadIdx.x == 0 ) {
+    dminloc[ blockIdx.x ] = mymin;
+  }
+}
+
+//
+// Second pass of the two pass reduction, a single block combines the
+// num_partial block results.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void first_min_final(MyMinLoc* dminloc_partial,
+                                Index_type num_partial,
+                                MyMinLoc* dminloc,
+                                MyMinLoc mininit)
+{
+  MyMinLoc mymin = mininit;
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    first_min_combine(mymin, dminloc_partial[ i ].val, dminloc_partial[ i ].loc);
+  }
+
+  mymin = first_min_block_reduce<block_size>(mymin, mininit);
+
+  if ( threadIdx.x == 0 ) {
+    *dminloc = mymin;
+  }
+}
+
+
 
 template < size_t block_size >
 void FIRST_MIN::runHipVariantBlock(VariantID vid)
@@ -148,6 +254,8 @@ void FIRST_MIN::runHipVariantOccGS(VariantID vid)
     constexpr size_t shmem = sizeof(MyMinLoc)*block_size;
     const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
         (first_min<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("first_min",
+        (first_min<block_size>), block_size, shmem) );
 
     const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
     const size_t grid_size = std::min(normal_grid_size, max_grid_size);
@@ -211,6 +319,104 @@ void FIRST_MIN::runHipVariantOccGS(VariantID vid)
   }
 }
 
+template < typename exec_policy >
+void FIRST_MIN::runHipVariantExpt(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  FIRST_MIN_DATA_SETUP;
+
+  if ( vid == RAJA_HIP ) {
+
+    using VL_TYPE = RAJA::expt::ValLoc<Real_type, Index_type>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       VL_TYPE tloc(m_xmin_init, m_initloc);
+
+       RAJA::forall< exec_policy >( res,
+         RAJA::RangeSegment(ibegin, iend),
+         RAJA::expt::Reduce<RAJA::operators::minimum>(&tloc),
+         [=] __device__ (Index_type i, VL_TYPE& loc) {
+           loc.min(x[i], i);
+         }
+       );
+
+       m_minloc = static_cast<Index_type>(tloc.getLoc());
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIRST_MIN : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FIRST_MIN::runHipVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  FIRST_MIN_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (first_min_partial<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("first_min_partial",
+        (first_min_partial<block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    MyMinLoc* dminloc_partial;
+    hipErrchk( hipMalloc( (void**)&dminloc_partial,
+                          grid_size * sizeof(MyMinLoc) ) );
+
+    MyMinLoc* dminloc;
+    hipErrchk( hipMalloc( (void**)&dminloc, sizeof(MyMinLoc) ) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      FIRST_MIN_MINLOC_INIT;
+
+      hipLaunchKernelGGL( (first_min_partial<block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          x, dminloc_partial, mymin, iend );
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL( (first_min_final<block_size>), dim3(1), dim3(block_size),
+                          shmem, res.get_stream(),
+                          dminloc_partial, grid_size, dminloc, mymin );
+      hipErrchk( hipGetLastError() );
+
+      hipErrchk( hipMemcpyAsync( &mymin, dminloc, sizeof(MyMinLoc),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+
+      m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+    }
+    stopTimer();
+
+    hipErrchk( hipFree( dminloc ) );
+    hipErrchk( hipFree( dminloc_partial ) );
+
+  } else {
+     getCout() << "\n  FIRST_MIN : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
 void FIRST_MIN::runHipVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -240,10 +446,54 @@ void FIRST_MIN::runHipVariant(VariantID vid, size_t tune_idx)
 
         t += 1;
 
+        if ( vid == RAJA_HIP ) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantExpt<RAJA::hip_exec<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantExpt<RAJA::hip_exec_occ_calc<block_size, true /*async*/>>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
       }
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantTwoPass<block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+    }
+
   } else {
 
     getCout() << "\n  FIRST_MIN : Unknown Hip variant id = " << vid << std::endl;
@@ -265,12 +515,34 @@ void FIRST_MIN::setHipTuningDefinitions(VariantID vid)
 
         addVariantTuningName(vid, "occgs_"+std::to_string(block_size));
 
+        if ( vid == RAJA_HIP ) {
+
+          addVariantTuningName(vid, "expt_block_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "expt_occgs_"+std::to_string(block_size));
+
+        }
+
       }
 
     });
 
-  }
+    if ( vid == Base_HIP ) {
 
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+        }
+
+      });
+
+    }
+
+  }
 }
 
 } // end namespace lcals
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,10 +20,117 @@ namespace lcals
 {
 
 
-void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_MIN::runOpenMPVariantSchedule(VariantID vid, size_t schedule_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  omp_schedule::ScopedSchedule schedule(omp_schedule::getSchedules()[schedule_idx]);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp declare reduction(minloc : MyMinLoc : \
+                                      omp_out = MinLoc_compare(omp_out, omp_in)) \
+                                      initializer (omp_priv = omp_orig)
+
+        FIRST_MIN_MINLOC_INIT;
+
+        #pragma omp parallel for schedule(runtime) reduction(minloc:mymin)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIRST_MIN_BODY;
+        }
+
+        m_minloc = mymin.loc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto firstmin_base_lam = [=](Index_type i) -> Real_type {
+                                 return x[i];
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp declare reduction(minloc : MyMinLoc : \
+                                      omp_out = MinLoc_compare(omp_out, omp_in)) \
+                                      initializer (omp_priv = omp_orig)
+
+        FIRST_MIN_MINLOC_INIT;
+
+        #pragma omp parallel for schedule(runtime) reduction(minloc:mymin)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          if ( firstmin_base_lam(i) < mymin.val ) {
+            mymin.val = x[i];
+            mymin.loc = i;
+          }
+        }
+
+        m_minloc = mymin.loc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceMinLoc<RAJA::omp_reduce, Real_type, Index_type> loc(
+                                                        m_xmin_init, m_initloc);
+
+        RAJA::forall<omp_parallel_for_runtime_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FIRST_MIN_BODY_RAJA;
+        });
+
+        m_minloc = loc.getLoc();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(schedule_idx);
+#endif
+}
+
+void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx > 0 ) {
+    runOpenMPVariantSchedule(vid, tune_idx - 1);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -114,6 +223,18 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void FIRST_MIN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  for (omp_schedule::Schedule const& schedule : omp_schedule::getSchedules()) {
+    addVariantTuningName(vid, omp_schedule::getScheduleTuningName(schedule));
+  }
 #endif
 }
 
@@ -30,6 +30,8 @@ namespace lcals
 void FIRST_MIN::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -46,11 +48,20 @@ void FIRST_MIN::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
       FIRST_MIN_MINLOC_INIT;
 
-      #pragma omp target is_device_ptr(x) device( did ) map(tofrom:mymin)
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1) \
-                  reduction(minloc:mymin)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        FIRST_MIN_BODY;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x) device( did ) map(tofrom:mymin)
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1) \
+                    reduction(minloc:mymin)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIRST_MIN_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x) device( did ) map(tofrom:mymin)
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1) \
+                    reduction(minloc:mymin)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIRST_MIN_BODY;
+        }
       }
 
       m_minloc = mymin.loc;
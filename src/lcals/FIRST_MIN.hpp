@@ -81,6 +81,7 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -91,10 +92,22 @@ public:
   void runHipVariantBlock(VariantID vid);
   template < size_t block_size >
   void runHipVariantOccGS(VariantID vid);
+  template < typename exec_policy >
+  void runCudaVariantExpt(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantTwoPass(VariantID vid);
+  template < typename exec_policy >
+  void runHipVariantExpt(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantTwoPass(VariantID vid);
+  void runOpenMPVariantSchedule(VariantID vid, size_t schedule_idx);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  // warp shuffle tunings need whole warps on every gpu backend
+  using gpu_warp_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<64>>;
 
   Real_ptr m_x;
   Real_type m_xmin_init;
@@ -36,6 +36,8 @@ FIRST_SUM::FIRST_SUM(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Stencil);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -44,6 +46,8 @@ FIRST_SUM::FIRST_SUM(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
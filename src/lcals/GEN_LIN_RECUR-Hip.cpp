@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -49,6 +50,20 @@ __global__ void genlinrecur2(Real_ptr b5, Real_ptr stb5,
 
 
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void genlinrecur_fused(Real_ptr b5, Real_ptr stb5,
+                                  Real_ptr sa, Real_ptr sb,
+                                  Index_type kb5i,
+                                  Index_type N)
+{
+   Index_type k = blockIdx.x * block_size + threadIdx.x;
+   if (k < N) {
+     GEN_LIN_RECUR_BODY_FUSED;
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void GEN_LIN_RECUR::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -86,12 +101,12 @@ void GEN_LIN_RECUR::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(0, N), [=] __device__ (Index_type k) {
          GEN_LIN_RECUR_BODY1;
        });
 
-       RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(1, N+1), [=] __device__ (Index_type i) {
          GEN_LIN_RECUR_BODY2;
        });
@@ -104,7 +119,100 @@ void GEN_LIN_RECUR::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(GEN_LIN_RECUR, Hip)
+template < size_t block_size >
+void GEN_LIN_RECUR::runHipVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  GEN_LIN_RECUR_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       constexpr size_t shmem = 0;
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(N, block_size);
+       hipLaunchKernelGGL((genlinrecur_fused<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                          b5, stb5, sa, sb, kb5i, N );
+       hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  GEN_LIN_RECUR : Unknown Hip fused variant id = " << vid << std::endl;
+  }
+}
+
+void GEN_LIN_RECUR::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantFused<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Hip, Impl, )
+
+  }
+
+}
+
+void GEN_LIN_RECUR::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "fused_"+std::to_string(block_size));
+      }
+    });
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
 
 } // end namespace lcals
 } // end namespace rajaperf
@@ -30,6 +30,8 @@ namespace lcals
 void GEN_LIN_RECUR::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
 
   GEN_LIN_RECUR_DATA_SETUP;
 
@@ -38,16 +40,32 @@ void GEN_LIN_RECUR::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(b5, stb5, sa, sb) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type k = 0; k < N; ++k ) {
-        GEN_LIN_RECUR_BODY1;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(b5, stb5, sa, sb) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type k = 0; k < N; ++k ) {
+          GEN_LIN_RECUR_BODY1;
+        }
+      } else {
+        #pragma omp target is_device_ptr(b5, stb5, sa, sb) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type k = 0; k < N; ++k ) {
+          GEN_LIN_RECUR_BODY1;
+        }
       }
 
-      #pragma omp target is_device_ptr(b5, stb5, sa, sb) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = 1; i < N+1; ++i ) {
-        GEN_LIN_RECUR_BODY2;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(b5, stb5, sa, sb) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 1; i < N+1; ++i ) {
+          GEN_LIN_RECUR_BODY2;
+        }
+      } else {
+        #pragma omp target is_device_ptr(b5, stb5, sa, sb) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 1; i < N+1; ++i ) {
+          GEN_LIN_RECUR_BODY2;
+        }
       }
 
     }
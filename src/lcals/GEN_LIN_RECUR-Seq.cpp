@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SimdUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,8 +20,78 @@ namespace lcals
 {
 
 
-void GEN_LIN_RECUR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void GEN_LIN_RECUR::runSeqVariantSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  GEN_LIN_RECUR_DATA_SETUP;
+
+#if defined(RUN_RAJA_SEQ)
+  auto genlinrecur_lam1 = [=](Index_type k) {
+                            GEN_LIN_RECUR_BODY1;
+                          };
+  auto genlinrecur_lam2 = [=](Index_type i) {
+                            GEN_LIN_RECUR_BODY2;
+                          };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type k = 0; k < N; ++k ) {
+          GEN_LIN_RECUR_BODY1;
+        }
+
+        RAJAPERF_SIMD
+        for (Index_type i = 1; i < N+1; ++i ) {
+          GEN_LIN_RECUR_BODY2;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(0, N), genlinrecur_lam1);
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(1, N+1), genlinrecur_lam2);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  GEN_LIN_RECUR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void GEN_LIN_RECUR::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
 
   GEN_LIN_RECUR_DATA_SETUP;
@@ -100,5 +172,14 @@ void GEN_LIN_RECUR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+void GEN_LIN_RECUR::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -41,6 +41,8 @@ GEN_LIN_RECUR::GEN_LIN_RECUR(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(LatencyBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -49,6 +51,8 @@ GEN_LIN_RECUR::GEN_LIN_RECUR(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -12,6 +12,8 @@
 /// Note: kernel is altered to enable parallelism and reproducibility
 ///       (in original, stb5 is a scalar). In the future, this may be
 ///       changed to use atomics. --RDH
+///       Algorithm_LINEAR_RECUR computes a first order linear recurrence
+///       with the dependence intact, in order or with a parallel scan.
 ///
 /// Index_type kb5i = 0;
 ///
@@ -26,6 +28,9 @@
 ///   stb5[k] = b5[k+kb5i] - stb5[k];
 /// }
 ///
+/// Every k is updated once by each loop and independently of the other k,
+/// so the fused tunings apply both updates of each k in one loop.
+///
 
 #ifndef RAJAPerf_Lcals_GEN_LIN_RECUR_HPP
 #define RAJAPerf_Lcals_GEN_LIN_RECUR_HPP
@@ -49,6 +54,14 @@
   b5[k+kb5i] = sa[k] + stb5[k]*sb[k]; \
   stb5[k] = b5[k+kb5i] - stb5[k];
 
+#define GEN_LIN_RECUR_BODY_FUSED  \
+  Real_type stb5k = stb5[k]; \
+  Real_type b5k = sa[k] + stb5k*sb[k]; \
+  stb5k = b5k - stb5k; \
+  b5k = sa[k] + stb5k*sb[k]; \
+  b5[k+kb5i] = b5k; \
+  stb5[k] = b5k - stb5k;
+
 
 #include "common/KernelBase.hpp"
 
@@ -78,12 +91,20 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  void runOpenMPVariantFused(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantFused(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantFused(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
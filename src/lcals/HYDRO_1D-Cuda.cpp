@@ -13,9 +13,12 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
+#include <cooperative_groups.h>
+
 namespace rajaperf
 {
 namespace lcals
@@ -33,8 +36,25 @@ __global__ void hydro_1d(Real_ptr x, Real_ptr y, Real_ptr z,
    }
 }
 
-
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void hydro_1d_persistent(Real_ptr x, Real_ptr y, Real_ptr z,
+                                    Real_type q, Real_type r, Real_type t,
+                                    Index_type iend, Index_type run_reps)
+{
+   cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+   for (Index_type irep = 0; irep < run_reps; ++irep) {
+     for (Index_type i = blockIdx.x * block_size + threadIdx.x;
+          i < iend;
+          i += gridDim.x * block_size) {
+       HYDRO_1D_BODY;
+     }
+     grid.sync();
+   }
+}
+
+
+template < size_t block_size, bool launch >
 void HYDRO_1D::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -65,7 +85,7 @@ void HYDRO_1D::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
          HYDRO_1D_BODY;
        });
@@ -78,7 +98,43 @@ void HYDRO_1D::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(HYDRO_1D, Cuda)
+template < size_t block_size >
+void HYDRO_1D::runCudaVariantPersistent(VariantID vid)
+{
+  Index_type run_reps = getRunReps();
+  Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  HYDRO_1D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (hydro_1d_persistent<block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("hydro_1d_persistent",
+        (hydro_1d_persistent<block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    void* args[] = { &x, &y, &z, (void*)&q, (void*)&r, (void*)&t, &iend, &run_reps };
+
+    startTimer();
+
+    cudaErrchk( cudaLaunchCooperativeKernel(
+        (const void*)hydro_1d_persistent<block_size>, grid_size, block_size,
+        args, shmem, res.get_stream() ) );
+
+    stopTimer();
+
+  } else {
+     getCout() << "\n  HYDRO_1D : Unknown Cuda persistent variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_PERSISTENT_TUNING_DEFINE_BOILERPLATE(HYDRO_1D, Cuda, Base_CUDA, RAJA_CUDA)
 
 } // end namespace lcals
 } // end namespace rajaperf
@@ -40,6 +40,8 @@ HYDRO_1D::HYDRO_1D(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Stencil);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -48,6 +50,8 @@ HYDRO_1D::HYDRO_1D(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
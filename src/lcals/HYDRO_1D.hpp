@@ -13,6 +13,10 @@
 ///   x[i] = q + y[i]*( r*z[i+10] + t*z[i+11] );
 /// }
 ///
+/// The persistent tunings of the Base GPU variants run all the reps in one
+/// cooperative kernel with a grid synchronization between reps, so the
+/// difference to the block tunings at small sizes is the launch latency.
+///
 
 #ifndef RAJAPerf_Lcals_HYDRO_1D_HPP
 #define RAJAPerf_Lcals_HYDRO_1D_HPP
@@ -59,12 +63,18 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantPersistent(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantPersistent(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
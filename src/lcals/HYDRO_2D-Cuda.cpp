@@ -184,7 +184,56 @@ void HYDRO_2D::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(HYDRO_2D, Cuda)
+template < size_t j_block_size, size_t k_block_size >
+void HYDRO_2D::runCudaVariantShape(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  HYDRO_2D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      dim3 nthreads_per_block(j_block_size, k_block_size, 1);
+      dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(jn-2, j_block_size)),
+                   static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(kn-2, k_block_size)),
+                   static_cast<size_t>(1));
+
+      hydro_2d1<j_block_size, k_block_size>
+               <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(zadat, zbdat,
+                                                 zpdat, zqdat, zrdat, zmdat,
+                                                 jn, kn);
+      cudaErrchk( cudaGetLastError() );
+
+      hydro_2d2<j_block_size, k_block_size>
+               <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(zudat, zvdat,
+                                                 zadat, zbdat, zzdat, zrdat,
+                                                 s,
+                                                 jn, kn);
+      cudaErrchk( cudaGetLastError() );
+
+      hydro_2d3<j_block_size, k_block_size>
+               <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(zroutdat, zzoutdat,
+                                                 zrdat, zudat, zzdat, zvdat,
+                                                 t,
+                                                 jn, kn);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  HYDRO_2D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_SHAPE_2D_TUNING_DEFINE_BOILERPLATE(HYDRO_2D, Cuda, Base_CUDA)
 
 } // end namespace lcals
 } // end namespace rajaperf
@@ -187,7 +187,59 @@ void HYDRO_2D::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(HYDRO_2D, Hip)
+template < size_t j_block_size, size_t k_block_size >
+void HYDRO_2D::runHipVariantShape(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  HYDRO_2D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      dim3 nthreads_per_block(j_block_size, k_block_size, 1);
+      dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(jn-2, j_block_size)),
+                   static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(kn-2, k_block_size)),
+                   static_cast<size_t>(1));
+
+      hipLaunchKernelGGL((hydro_2d1<j_block_size, k_block_size>),
+                         dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         zadat, zbdat,
+                         zpdat, zqdat, zrdat, zmdat,
+                         jn, kn);
+       hipErrchk( hipGetLastError() );
+
+       hipLaunchKernelGGL((hydro_2d2<j_block_size, k_block_size>),
+                          dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                          zudat, zvdat,
+                          zadat, zbdat, zzdat, zrdat,
+                          s,
+                          jn, kn);
+       hipErrchk( hipGetLastError() );
+
+       hipLaunchKernelGGL((hydro_2d3<j_block_size, k_block_size>),
+                          dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                          zroutdat, zzoutdat,
+                          zrdat, zudat, zzdat, zvdat,
+                          t,
+                          jn, kn);
+       hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  HYDRO_2D : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_SHAPE_2D_TUNING_DEFINE_BOILERPLATE(HYDRO_2D, Hip, Base_HIP)
 
 } // end namespace lcals
 } // end namespace rajaperf
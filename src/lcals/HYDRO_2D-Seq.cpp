@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SimdUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HYDRO_2D::runSeqVariantSimd(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type kbeg = 1;
@@ -26,6 +28,115 @@ void HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
   const Index_type jbeg = 1;
   const Index_type jend = m_jn - 1;
 
+  HYDRO_2D_DATA_SETUP;
+#if !defined(RUN_RAJA_SEQ)
+  RAJA_UNUSED_VAR(kn);   // prevents a compiler warning in the OpenMP target offload build case
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          RAJAPERF_SIMD
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY1;
+          }
+        }
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          RAJAPERF_SIMD
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY2;
+          }
+        }
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          RAJAPERF_SIMD
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY3;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      HYDRO_2D_VIEWS_RAJA;
+
+      auto hydro2d_lam1 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY1_RAJA;
+                          };
+      auto hydro2d_lam2 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY2_RAJA;
+                          };
+      auto hydro2d_lam3 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY3_RAJA;
+                          };
+
+      using EXECPOL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::seq_exec,    // k
+            RAJA::statement::For<1, RAJA::simd_exec, // j
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam1);
+
+        RAJA::kernel<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam2);
+
+        RAJA::kernel<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam3);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HYDRO_2D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
   HYDRO_2D_DATA_SETUP;
 #if !defined(RUN_RAJA_SEQ)
   RAJA_UNUSED_VAR(kn);   // prevents a compiler warning in the OpenMP target offload build case
@@ -158,5 +269,14 @@ void HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 }
 
+void HYDRO_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
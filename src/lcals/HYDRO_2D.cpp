@@ -55,6 +55,8 @@ HYDRO_2D::HYDRO_2D(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(Stencil);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -38,6 +38,9 @@
 ///   }
 /// }
 ///
+/// The Base GPU variants also have tunings for each j by k block shape of
+/// each block size, see gpu_block_shape.
+///
 
 #ifndef RAJAPerf_Lcals_HYDRO_2D_HPP
 #define RAJAPerf_Lcals_HYDRO_2D_HPP
@@ -153,12 +156,18 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantSimd(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t j_block_size, size_t k_block_size >
+  void runCudaVariantShape(VariantID vid);
+  template < size_t j_block_size, size_t k_block_size >
+  void runHipVariantShape(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IMPLICIT_COND.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void implicit_cond(Real_ptr vh, Real_ptr vf, Real_ptr vg,
+                              Real_ptr vy, Real_ptr vs, Real_type ar,
+                              Real_type br, Index_type ng, Index_type nz,
+                              Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     IMPLICIT_COND_BODY;
+   }
+}
+
+
+template < size_t block_size, bool launch >
+void IMPLICIT_COND::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  IMPLICIT_COND_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+       implicit_cond<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( vh, vf, vg,
+                                                   vy, vs, ar,
+                                                   br, ng, nz,
+                                                   iend );
+       cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       gpu_launch::forall< block_size, launch >( res,
+         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+         IMPLICIT_COND_BODY;
+       });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  IMPLICIT_COND : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(IMPLICIT_COND, Cuda, RAJA_CUDA)
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IMPLICIT_COND.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+IMPLICIT_COND::IMPLICIT_COND(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_IMPLICIT_COND, params)
+{
+  m_ng = 7;
+
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  m_nz = getTargetProblemSize() / (m_ng-1) + 1;
+  m_array_length = m_ng * m_nz;
+
+  m_ar = 0.053;
+  m_br = 0.073;
+
+  setActualProblemSize( (m_ng-1) * (m_nz-1) );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (2*sizeof(Real_type) + 0*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type) + 3*sizeof(Real_type)) * m_array_length );
+  setFLOPsPerRep(12 * getActualProblemSize());
+
+  setUsesFeature(Forall);
+
+  setHasPattern(Stencil);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+IMPLICIT_COND::~IMPLICIT_COND()
+{
+}
+
+void IMPLICIT_COND::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  //
+  // Keep vf away from zero since both outputs divide by it.
+  //
+  constexpr unsigned long long vf_seed = 1511;
+
+  allocData(m_vf, m_array_length, vid);
+  {
+    auto reset_vf = scopedMoveData(m_vf, m_array_length, vid);
+    for (Index_type i = 0; i < m_array_length; ++i) {
+      m_vf[i] = 0.5 + detail::counterRandValue(vf_seed, i);
+    }
+  }
+
+  allocAndInitDataRandValue(m_vh, m_array_length, vid);
+  allocAndInitDataRandValue(m_vg, m_array_length, vid);
+  allocAndInitDataConst(m_vy, m_array_length, 0.0, vid);
+  allocAndInitDataConst(m_vs, m_array_length, 0.0, vid);
+}
+
+void IMPLICIT_COND::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_vy, m_array_length, vid);
+  checksum[vid][tune_idx] += calcChecksum(m_vs, m_array_length, vid);
+}
+
+void IMPLICIT_COND::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_vh, vid);
+  deallocData(m_vf, vid);
+  deallocData(m_vg, vid);
+  deallocData(m_vy, vid);
+  deallocData(m_vs, vid);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
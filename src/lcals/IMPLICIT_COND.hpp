@@ -0,0 +1,156 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// IMPLICIT_COND kernel reference implementation (Livermore loop 15):
+///
+/// for (Index_type j = 1; j < ng; ++j ) {
+///   for (Index_type k = 1; k < nz; ++k ) {
+///     if ( j+1 >= ng ) {
+///       vy[j][k] = 0.0;
+///       continue;
+///     }
+///     t = ( vh[j+1][k] > vh[j][k] ) ? ar : br;
+///     if ( vf[j][k] < vf[j][k-1] ) {
+///       r = max( vh[j][k-1], vh[j+1][k-1] );
+///       s = vf[j][k-1];
+///     } else {
+///       r = max( vh[j][k], vh[j+1][k] );
+///       s = vf[j][k];
+///     }
+///     vy[j][k] = sqrt( vg[j][k]*vg[j][k] + r*r )*t/s;
+///     if ( k+1 >= nz ) {
+///       vs[j][k] = 0.0;
+///       continue;
+///     }
+///     if ( vf[j][k] < vf[j-1][k] ) {
+///       r = max( vg[j-1][k], vg[j-1][k+1] );
+///       s = vf[j-1][k];
+///       t = br;
+///     } else {
+///       r = max( vg[j][k], vg[j][k+1] );
+///       s = vf[j][k];
+///       t = ar;
+///     }
+///     vs[j][k] = sqrt( vh[j][k]*vh[j][k] + r*r )*t/s;
+///   }
+/// }
+///
+/// Each (j,k) point only reads vh, vf, and vg, so the nest is flattened
+/// into one parallel loop over i = (j-1)*(nz-1) + (k-1) and the continue
+/// statements become else branches.
+///
+
+#ifndef RAJAPerf_Lcals_IMPLICIT_COND_HPP
+#define RAJAPerf_Lcals_IMPLICIT_COND_HPP
+
+#include "RAJA/util/macros.hpp"
+
+#define IMPLICIT_COND_DATA_SETUP \
+  Real_ptr vh = m_vh; \
+  Real_ptr vf = m_vf; \
+  Real_ptr vg = m_vg; \
+  Real_ptr vy = m_vy; \
+  Real_ptr vs = m_vs; \
+\
+  const Real_type ar = m_ar; \
+  const Real_type br = m_br; \
+\
+  const Index_type ng = m_ng; \
+  const Index_type nz = m_nz;
+
+#define IMPLICIT_COND_BODY \
+  const Index_type j = 1 + i / (nz-1); \
+  const Index_type k = 1 + i % (nz-1); \
+  const Index_type jk = k + j*nz; \
+  if ( j+1 >= ng ) { \
+    vy[jk] = 0.0; \
+  } else { \
+    Real_type t = ( vh[jk+nz] > vh[jk] ) ? ar : br; \
+    Real_type r, s; \
+    if ( vf[jk] < vf[jk-1] ) { \
+      r = RAJA_MAX( vh[jk-1], vh[jk-1+nz] ); \
+      s = vf[jk-1]; \
+    } else { \
+      r = RAJA_MAX( vh[jk], vh[jk+nz] ); \
+      s = vf[jk]; \
+    } \
+    vy[jk] = sqrt( vg[jk]*vg[jk] + r*r )*t/s; \
+    if ( k+1 >= nz ) { \
+      vs[jk] = 0.0; \
+    } else { \
+      if ( vf[jk] < vf[jk-nz] ) { \
+        r = RAJA_MAX( vg[jk-nz], vg[jk-nz+1] ); \
+        s = vf[jk-nz]; \
+        t = br; \
+      } else { \
+        r = RAJA_MAX( vg[jk], vg[jk+1] ); \
+        s = vf[jk]; \
+        t = ar; \
+      } \
+      vs[jk] = sqrt( vh[jk]*vh[jk] + r*r )*t/s; \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class IMPLICIT_COND : public KernelBase
+{
+public:
+
+  IMPLICIT_COND(const RunParams& params);
+
+  ~IMPLICIT_COND();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Real_ptr m_vh;
+  Real_ptr m_vf;
+  Real_ptr m_vg;
+  Real_ptr m_vy;
+  Real_ptr m_vs;
+
+  Real_type m_ar;
+  Real_type m_br;
+
+  Index_type m_ng;
+  Index_type m_nz;
+  Index_type m_array_length;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IMPLICIT_HYDRO_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void implicit_hydro_2d(Real_ptr za, Real_ptr zb, Real_ptr zr,
+                                  Real_ptr zu, Real_ptr zv, Real_ptr zz,
+                                  Index_type kn, Index_type w,
+                                  Index_type jbeg, Index_type jend)
+{
+   Index_type j = jbeg + blockIdx.x * block_size + threadIdx.x;
+   if (j < jend) {
+     IMPLICIT_HYDRO_2D_BODY;
+   }
+}
+
+
+template < size_t block_size, bool launch >
+void IMPLICIT_HYDRO_2D::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  IMPLICIT_HYDRO_2D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+        IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(jend - jbeg, block_size);
+        hipLaunchKernelGGL((implicit_hydro_2d<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(), za, zb, zr,
+                                                   zu, zv, zz,
+                                                   kn, w,
+                                                   jbeg, jend );
+        hipErrchk( hipGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+        IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+        gpu_launch::forall< block_size, launch >( res,
+          RAJA::RangeSegment(jbeg, jend), [=] __device__ (Index_type j) {
+          IMPLICIT_HYDRO_2D_BODY;
+        });
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  IMPLICIT_HYDRO_2D : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(IMPLICIT_HYDRO_2D, Hip, RAJA_HIP)
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IMPLICIT_HYDRO_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void IMPLICIT_HYDRO_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  IMPLICIT_HYDRO_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+          IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+          #pragma omp parallel for
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            IMPLICIT_HYDRO_2D_BODY;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+          IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+          auto implicithydro2d_lam = [=](Index_type j) {
+                                       IMPLICIT_HYDRO_2D_BODY;
+                                     };
+
+          #pragma omp parallel for
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            implicithydro2d_lam(j);
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+          IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(jbeg, jend), [=](Index_type j) {
+            IMPLICIT_HYDRO_2D_BODY;
+          });
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  IMPLICIT_HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
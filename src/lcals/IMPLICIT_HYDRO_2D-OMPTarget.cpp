@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IMPLICIT_HYDRO_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+  //
+  // Define threads per team for target execution
+  //
+  const size_t threads_per_team = 256;
+
+
+void IMPLICIT_HYDRO_2D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
+
+  IMPLICIT_HYDRO_2D_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+        IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(za, zb, zr, zu, zv, zz) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            IMPLICIT_HYDRO_2D_BODY;
+          }
+        } else {
+          #pragma omp target is_device_ptr(za, zb, zr, zu, zv, zz) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            IMPLICIT_HYDRO_2D_BODY;
+          }
+        }
+
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+        IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+        RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment(jbeg, jend), [=](Index_type j) {
+          IMPLICIT_HYDRO_2D_BODY;
+        });
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  IMPLICIT_HYDRO_2D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IMPLICIT_HYDRO_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void IMPLICIT_HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  IMPLICIT_HYDRO_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+          IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            IMPLICIT_HYDRO_2D_BODY;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+          IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+          auto implicithydro2d_lam = [=](Index_type j) {
+                                       IMPLICIT_HYDRO_2D_BODY;
+                                     };
+
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            implicithydro2d_lam(j);
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 2; w < jn+kn-3; ++w) {
+
+          IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP;
+
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(jbeg, jend), [=](Index_type j) {
+            IMPLICIT_HYDRO_2D_BODY;
+          });
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  IMPLICIT_HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
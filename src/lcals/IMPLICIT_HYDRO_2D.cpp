@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IMPLICIT_HYDRO_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+IMPLICIT_HYDRO_2D::IMPLICIT_HYDRO_2D(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_IMPLICIT_HYDRO_2D, params)
+{
+  m_jn = 1000;
+  m_kn = 1000;
+
+  setDefaultProblemSize(m_kn * m_jn);
+  setDefaultReps(50);
+
+  m_jn = m_kn = std::sqrt(getTargetProblemSize());
+  m_array_length = m_kn * m_jn;
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( (m_jn-2) * (m_kn-2) );
+  setKernelsPerRep( m_jn + m_kn - 5 );
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * (m_jn-2) * (m_kn-2) +
+                  (0*sizeof(Real_type ) + 5*sizeof(Real_type )) * m_array_length );
+  setFLOPsPerRep( 11 * (m_jn-2) * (m_kn-2) );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(Stencil);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+IMPLICIT_HYDRO_2D::~IMPLICIT_HYDRO_2D()
+{
+}
+
+void IMPLICIT_HYDRO_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_za, m_array_length, vid);
+  allocAndInitData(m_zb, m_array_length, vid);
+  allocAndInitData(m_zr, m_array_length, vid);
+  allocAndInitData(m_zu, m_array_length, vid);
+  allocAndInitData(m_zv, m_array_length, vid);
+  allocAndInitData(m_zz, m_array_length, vid);
+}
+
+void IMPLICIT_HYDRO_2D::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_za, m_array_length, checksum_scale_factor , vid);
+}
+
+void IMPLICIT_HYDRO_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_za, vid);
+  deallocData(m_zb, vid);
+  deallocData(m_zr, vid);
+  deallocData(m_zu, vid);
+  deallocData(m_zv, vid);
+  deallocData(m_zz, vid);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
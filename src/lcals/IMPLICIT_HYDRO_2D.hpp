@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// IMPLICIT_HYDRO_2D kernel reference implementation (Livermore loop 23):
+///
+/// for (Index_type j = 1; j < jn-1; ++j ) {
+///   for (Index_type k = 1; k < kn-1; ++k ) {
+///     Real_type qa = za[j+1][k]*zr[j][k] + za[j-1][k]*zb[j][k] +
+///                    za[j][k+1]*zu[j][k] + za[j][k-1]*zv[j][k] + zz[j][k];
+///     za[j][k] += 0.175*( qa - za[j][k] );
+///   }
+/// }
+///
+/// Each point reads za at the points before it in the sweep after they
+/// are updated and at the points after it before they are updated. The
+/// points on a wavefront w = j + k depend only on points of earlier
+/// wavefronts, so the wavefronts run in order with the points of each
+/// wavefront in parallel, which gives the same result as the reference.
+///
+
+#ifndef RAJAPerf_Lcals_IMPLICIT_HYDRO_2D_HPP
+#define RAJAPerf_Lcals_IMPLICIT_HYDRO_2D_HPP
+
+#include "RAJA/util/macros.hpp"
+
+#define IMPLICIT_HYDRO_2D_DATA_SETUP \
+  Real_ptr za = m_za; \
+  Real_ptr zb = m_zb; \
+  Real_ptr zr = m_zr; \
+  Real_ptr zu = m_zu; \
+  Real_ptr zv = m_zv; \
+  Real_ptr zz = m_zz; \
+\
+  const Index_type jn = m_jn; \
+  const Index_type kn = m_kn;
+
+#define IMPLICIT_HYDRO_2D_WAVEFRONT_SETUP \
+  const Index_type jbeg = RAJA_MAX(1, w-(kn-2)); \
+  const Index_type jend = RAJA_MIN(jn-2, w-1) + 1;
+
+#define IMPLICIT_HYDRO_2D_BODY \
+  const Index_type k = w - j; \
+  const Real_type qa = za[k + (j+1)*kn]*zr[k + j*kn] + \
+                       za[k + (j-1)*kn]*zb[k + j*kn] + \
+                       za[k+1 + j*kn]*zu[k + j*kn] + \
+                       za[k-1 + j*kn]*zv[k + j*kn] + zz[k + j*kn]; \
+  za[k + j*kn] += 0.175*( qa - za[k + j*kn] );
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class IMPLICIT_HYDRO_2D : public KernelBase
+{
+public:
+
+  IMPLICIT_HYDRO_2D(const RunParams& params);
+
+  ~IMPLICIT_HYDRO_2D();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Real_ptr m_za;
+  Real_ptr m_zb;
+  Real_ptr m_zr;
+  Real_ptr m_zu;
+  Real_ptr m_zv;
+  Real_ptr m_zz;
+
+  Index_type m_jn;
+  Index_type m_kn;
+  Index_type m_array_length;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -20,6 +20,10 @@
 ///           px[i + offset *  2];
 /// }
 ///
+/// The Base CPU variants have tunings that prefetch each array a distance
+/// of elements ahead (prefetch_<distance>) and that sum the terms into
+/// px[i] in two loops (split).
+///
 
 #ifndef RAJAPerf_Lcals_INT_PREDICT_HPP
 #define RAJAPerf_Lcals_INT_PREDICT_HPP
@@ -45,6 +49,30 @@
           c0*( px[i + offset *  4] + px[i + offset *  5] ) + \
           px[i + offset *  2];
 
+#define INT_PREDICT_PREFETCH(i) \
+  prefetchRead(&px[(i) + offset * 12]); \
+  prefetchRead(&px[(i) + offset * 11]); \
+  prefetchRead(&px[(i) + offset * 10]); \
+  prefetchRead(&px[(i) + offset *  9]); \
+  prefetchRead(&px[(i) + offset *  8]); \
+  prefetchRead(&px[(i) + offset *  7]); \
+  prefetchRead(&px[(i) + offset *  6]); \
+  prefetchRead(&px[(i) + offset *  5]); \
+  prefetchRead(&px[(i) + offset *  4]); \
+  prefetchRead(&px[(i) + offset *  2]); \
+  prefetchWrite(&px[i]);
+
+#define INT_PREDICT_SPLIT_BODY_0  \
+  px[i] = dm28*px[i + offset * 12] + dm27*px[i + offset * 11] + \
+          dm26*px[i + offset * 10] + dm25*px[i + offset *  9] + \
+          dm24*px[i + offset *  8];
+
+#define INT_PREDICT_SPLIT_BODY_1  \
+  px[i] = px[i] + dm23*px[i + offset *  7] + \
+          dm22*px[i + offset *  6] + \
+          c0*( px[i + offset *  4] + px[i + offset *  5] ) + \
+          px[i + offset *  2];
+
 
 #include "common/KernelBase.hpp"
 
@@ -74,11 +102,18 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  void runSeqVariantPrefetch(VariantID vid, Index_type distance);
+  void runSeqVariantSplit(VariantID vid);
+  void runOpenMPVariantPrefetch(VariantID vid, Index_type distance);
+  void runOpenMPVariantSplit(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
 
 private:
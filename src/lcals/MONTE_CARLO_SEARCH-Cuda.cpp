@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MONTE_CARLO_SEARCH.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void monte_carlo_search(Int_ptr zone, Int_ptr side,
+                                   Real_ptr plan, Real_ptr d,
+                                   Real_type r, Real_type s, Real_type t,
+                                   Index_type n, Index_type ii, Index_type lb,
+                                   Index_type* dloc, Index_type loc_init,
+                                   Index_type iend)
+{
+  extern __shared__ Index_type ploc[ ];
+
+  Index_type k = blockIdx.x * block_size + threadIdx.x;
+
+  ploc[ threadIdx.x ] = loc_init;
+  if ( k < iend ) {
+    MONTE_CARLO_SEARCH_TEST;
+    if ( found ) {
+      ploc[ threadIdx.x ] = k;
+    }
+  }
+  __syncthreads();
+
+  for ( Index_type i = block_size / 2; i > 0; i /= 2 ) {
+    if ( threadIdx.x < i ) {
+      ploc[ threadIdx.x ] = RAJA_MIN( ploc[ threadIdx.x ], ploc[ threadIdx.x + i ] );
+    }
+     __syncthreads();
+  }
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicMin<RAJA::cuda_atomic>( dloc, ploc[ 0 ] );
+  }
+}
+
+
+template < size_t block_size >
+void MONTE_CARLO_SEARCH::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  MONTE_CARLO_SEARCH_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Index_type* dloc;
+    allocData(DataSpace::CudaDevice, dloc, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const Index_type loc_init = n;
+      cudaErrchk( cudaMemcpyAsync( dloc, &loc_init, sizeof(Index_type),
+                                   cudaMemcpyHostToDevice, res.get_stream() ) );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = sizeof(Index_type)*block_size;
+      monte_carlo_search<block_size><<<grid_size, block_size,
+                                       shmem, res.get_stream()>>>( zone, side,
+                                                                   plan, d,
+                                                                   r, s, t,
+                                                                   n, ii, lb,
+                                                                   dloc, loc_init,
+                                                                   iend );
+      cudaErrchk( cudaGetLastError() );
+
+      cudaErrchk( cudaMemcpyAsync( &m_loc, dloc, sizeof(Index_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dloc);
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceMin<RAJA::cuda_reduce, Index_type> loc(n);
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type k) {
+        MONTE_CARLO_SEARCH_BODY_RAJA;
+      });
+
+      m_loc = static_cast<Index_type>(loc.get());
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  MONTE_CARLO_SEARCH : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(MONTE_CARLO_SEARCH, Cuda)
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
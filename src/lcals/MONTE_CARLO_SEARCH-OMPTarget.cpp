@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MONTE_CARLO_SEARCH.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+  //
+  // Define threads per team for target execution
+  //
+  const size_t threads_per_team = 256;
+
+
+void MONTE_CARLO_SEARCH::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MONTE_CARLO_SEARCH_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Index_type loc = n;
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(zone, side, plan, d) device( did ) map(tofrom:loc)
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static,1) \
+                                 reduction(min:loc)
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          MONTE_CARLO_SEARCH_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(zone, side, plan, d) device( did ) map(tofrom:loc)
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static,1) \
+                                 reduction(min:loc)
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          MONTE_CARLO_SEARCH_BODY;
+        }
+      }
+
+      m_loc = loc;
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceMin<RAJA::omp_target_reduce, Index_type> loc(n);
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+        RAJA::RangeSegment(ibegin, iend), [=](Index_type k) {
+        MONTE_CARLO_SEARCH_BODY_RAJA;
+      });
+
+      m_loc = static_cast<Index_type>(loc.get());
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  MONTE_CARLO_SEARCH : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
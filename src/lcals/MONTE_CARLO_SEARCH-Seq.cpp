@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MONTE_CARLO_SEARCH.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void MONTE_CARLO_SEARCH::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MONTE_CARLO_SEARCH_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type loc = n;
+
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          MONTE_CARLO_SEARCH_BODY;
+        }
+
+        m_loc = loc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto mcsearch_base_lam = [=](Index_type k) -> bool {
+                                 MONTE_CARLO_SEARCH_TEST;
+                                 return found;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type loc = n;
+
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          if ( mcsearch_base_lam(k) ) {
+            loc = RAJA_MIN(loc, k);
+          }
+        }
+
+        m_loc = loc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceMin<RAJA::seq_reduce, Index_type> loc(n);
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type k) {
+          MONTE_CARLO_SEARCH_BODY_RAJA;
+        });
+
+        m_loc = static_cast<Index_type>(loc.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  MONTE_CARLO_SEARCH : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,136 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MONTE_CARLO_SEARCH.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+MONTE_CARLO_SEARCH::MONTE_CARLO_SEARCH(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_MONTE_CARLO_SEARCH, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_r = 0.3;
+  m_s = 0.4;
+  m_t = 0.5;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Int_type) + 2*sizeof(Int_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * 2*getActualProblemSize() );
+  setFLOPsPerRep(7 * getActualProblemSize());
+
+  setUsesFeature(Forall);
+  setUsesFeature(Reduction);
+
+  setHasPattern(ReductionBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+MONTE_CARLO_SEARCH::~MONTE_CARLO_SEARCH()
+{
+}
+
+void MONTE_CARLO_SEARCH::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type num_zones = getActualProblemSize();
+
+  constexpr unsigned long long zone_seed = 1601;
+  constexpr unsigned long long table_seed = 1607;
+
+  allocData(m_zone, num_zones, vid);
+  allocData(m_side, num_zones, vid);
+  allocData(m_plan, num_zones, vid);
+  allocData(m_d, 2*num_zones, vid);
+  {
+    auto reset_zone = scopedMoveData(m_zone, num_zones, vid);
+    auto reset_side = scopedMoveData(m_side, num_zones, vid);
+    auto reset_plan = scopedMoveData(m_plan, num_zones, vid);
+    auto reset_d = scopedMoveData(m_d, 2*num_zones, vid);
+
+    for (Index_type i = 0; i < num_zones; ++i) {
+      m_plan[i] = detail::counterRandValue(table_seed, i);
+    }
+    for (Index_type i = 0; i < 2*num_zones; ++i) {
+      m_d[i] = detail::counterRandValue(table_seed, num_zones + i);
+    }
+
+    //
+    // Zones index the tables in [5, 2N) skipping N, which ends the search
+    // in the original. Each side records the sign of the zone's test value
+    // so the search runs on until the zone planted at 7N/8.
+    //
+    MONTE_CARLO_SEARCH_DATA_SETUP;
+
+    for (Index_type k = 0; k < num_zones; ++k) {
+      zone[k] = 5 + static_cast<Int_type>(
+          std::floor((2*num_zones - 5) * detail::counterRandValue(zone_seed, k)));
+      if ( zone[k] == num_zones ) {
+        zone[k] += 1;
+      }
+      side[k] = 0;
+
+      MONTE_CARLO_SEARCH_TEST;
+      RAJA_UNUSED_VAR(found);
+
+      side[k] = ( tmp < 0.0 ) ? -1 : ( tmp > 0.0 ) ? 1 : 0;
+    }
+    side[7*num_zones/8] = 0;
+  }
+
+  m_loc = num_zones;
+}
+
+void MONTE_CARLO_SEARCH::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += static_cast<long double>(m_loc);
+}
+
+void MONTE_CARLO_SEARCH::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_zone, vid);
+  deallocData(m_side, vid);
+  deallocData(m_plan, vid);
+  deallocData(m_d, vid);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
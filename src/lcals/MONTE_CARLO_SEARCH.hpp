@@ -0,0 +1,147 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MONTE_CARLO_SEARCH kernel reference implementation (Livermore loop 16):
+///
+/// Note: kernel implementation uses a "min" reduction.
+///
+/// Index_type loc = N;
+/// for (Index_type k = 0; k < N; ++k ) {
+///   Int_type j5 = zone[k];
+///   Real_type tmp;
+///   if ( j5 < N ) {
+///     if ( j5+lb < N ) {
+///       tmp = plan[j5-1] - t;
+///     } else if ( j5+ii < N ) {
+///       tmp = plan[j5-1] - s;
+///     } else {
+///       tmp = plan[j5-1] - r;
+///     }
+///   } else {
+///     tmp = d[j5-1] - ( d[j5-2]*(t-d[j5-3])*(t-d[j5-3]) +
+///                       (s-d[j5-4])*(s-d[j5-4]) +
+///                       (r-d[j5-5])*(r-d[j5-5]) );
+///   }
+///   if ( tmp < 0.0 ? side[k] >= 0 : tmp > 0.0 ? side[k] <= 0 : true ) {
+///     loc = k;
+///     break;
+///   }
+/// }
+///
+/// The original walks the zones until the first one whose test value does
+/// not match the sign recorded in side and exits the loop there. The
+/// kernel tests every zone in parallel and finds the first such zone with
+/// a min reduction of its index.
+///
+
+#ifndef RAJAPerf_Lcals_MONTE_CARLO_SEARCH_HPP
+#define RAJAPerf_Lcals_MONTE_CARLO_SEARCH_HPP
+
+#include "RAJA/util/macros.hpp"
+
+#define MONTE_CARLO_SEARCH_DATA_SETUP \
+  Int_ptr zone = m_zone; \
+  Int_ptr side = m_side; \
+  Real_ptr plan = m_plan; \
+  Real_ptr d = m_d; \
+\
+  const Real_type r = m_r; \
+  const Real_type s = m_s; \
+  const Real_type t = m_t; \
+\
+  const Index_type n = getActualProblemSize(); \
+  const Index_type ii = n / 3; \
+  const Index_type lb = ii + ii;
+
+#define MONTE_CARLO_SEARCH_TEST \
+  const Int_type j5 = zone[k]; \
+  Real_type tmp; \
+  if ( j5 < n ) { \
+    if ( j5+lb < n ) { \
+      tmp = plan[j5-1] - t; \
+    } else if ( j5+ii < n ) { \
+      tmp = plan[j5-1] - s; \
+    } else { \
+      tmp = plan[j5-1] - r; \
+    } \
+  } else { \
+    tmp = d[j5-1] - ( d[j5-2]*(t-d[j5-3])*(t-d[j5-3]) + \
+                      (s-d[j5-4])*(s-d[j5-4]) + \
+                      (r-d[j5-5])*(r-d[j5-5]) ); \
+  } \
+  const bool found = ( tmp < 0.0 ) ? ( side[k] >= 0 ) : \
+                     ( tmp > 0.0 ) ? ( side[k] <= 0 ) : true;
+
+#define MONTE_CARLO_SEARCH_BODY \
+  MONTE_CARLO_SEARCH_TEST \
+  if ( found ) { \
+    loc = RAJA_MIN(loc, k); \
+  }
+
+#define MONTE_CARLO_SEARCH_BODY_RAJA \
+  MONTE_CARLO_SEARCH_TEST \
+  if ( found ) { \
+    loc.min(k); \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class MONTE_CARLO_SEARCH : public KernelBase
+{
+public:
+
+  MONTE_CARLO_SEARCH(const RunParams& params);
+
+  ~MONTE_CARLO_SEARCH();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Int_ptr m_zone;
+  Int_ptr m_side;
+  Real_ptr m_plan;
+  Real_ptr m_d;
+
+  Real_type m_r;
+  Real_type m_s;
+  Real_type m_t;
+
+  Index_type m_loc;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,134 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pic_1d1(Real_ptr vx, Real_ptr xx, Real_ptr xi,
+                        Real_ptr ex1, Real_ptr dex1, Int_ptr ix,
+                        Real_ptr grd, Real_ptr ex, Real_ptr dex,
+                        Index_type iend)
+{
+   Index_type k = blockIdx.x * block_size + threadIdx.x;
+   if (k < iend) {
+     PIC_1D_BODY1;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pic_1d2(Real_ptr vx, Real_ptr xx, Real_ptr xi,
+                        Real_ptr ex1, Real_ptr dex1, Real_ptr rx,
+                        Int_ptr ir, Real_type flx,
+                        Index_type iend)
+{
+   Index_type k = blockIdx.x * block_size + threadIdx.x;
+   if (k < iend) {
+     PIC_1D_BODY2;
+   }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void pic_1d3(Real_ptr rh, Real_ptr rx, Int_ptr ir,
+                        Index_type iend)
+{
+   Index_type k = blockIdx.x * block_size + threadIdx.x;
+   if (k < iend) {
+     PIC_1D_RAJA_ATOMIC_BODY3(RAJA::cuda_atomic);
+   }
+}
+
+
+template < size_t block_size, bool launch >
+void PIC_1D::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  PIC_1D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+
+       pic_1d1<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( vx, xx, xi,
+                                                  ex1, dex1, ix,
+                                                  grd, ex, dex,
+                                                  iend );
+       cudaErrchk( cudaGetLastError() );
+
+       pic_1d2<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( vx, xx, xi,
+                                                  ex1, dex1, rx,
+                                                  ir, flx,
+                                                  iend );
+       cudaErrchk( cudaGetLastError() );
+
+       pic_1d3<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( rh, rx, ir,
+                                                  iend );
+       cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       gpu_launch::forall< block_size, launch >( res,
+         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type k) {
+         PIC_1D_BODY1;
+       });
+
+       gpu_launch::forall< block_size, launch >( res,
+         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type k) {
+         PIC_1D_BODY2;
+       });
+
+       gpu_launch::forall< block_size, launch >( res,
+         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type k) {
+         PIC_1D_RAJA_ATOMIC_BODY3(RAJA::cuda_atomic);
+       });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PIC_1D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(PIC_1D, Cuda, RAJA_CUDA)
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
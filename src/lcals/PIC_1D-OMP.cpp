@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void PIC_1D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PIC_1D_DATA_SETUP;
+
+  auto pic1d_lam1 = [=](Index_type k) {
+                      PIC_1D_BODY1;
+                    };
+  auto pic1d_lam2 = [=](Index_type k) {
+                      PIC_1D_BODY2;
+                    };
+  auto pic1d_lam3 = [=](Index_type k) {
+                      #pragma omp atomic
+                      rh[ ir[k]-1 ] += 1.0 - rx[k];
+                      #pragma omp atomic
+                      rh[ ir[k] ] += rx[k];
+                    };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for schedule(static) nowait
+          for (Index_type k = ibegin; k < iend; ++k ) {
+            PIC_1D_BODY1;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type k = ibegin; k < iend; ++k ) {
+            PIC_1D_BODY2;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type k = ibegin; k < iend; ++k ) {
+            #pragma omp atomic
+            rh[ ir[k]-1 ] += 1.0 - rx[k];
+            #pragma omp atomic
+            rh[ ir[k] ] += rx[k];
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for schedule(static) nowait
+          for (Index_type k = ibegin; k < iend; ++k ) {
+            pic1d_lam1(k);
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type k = ibegin; k < iend; ++k ) {
+            pic1d_lam2(k);
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type k = ibegin; k < iend; ++k ) {
+            pic1d_lam3(k);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::omp_parallel_region>( [=]() {
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), pic1d_lam1);
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), pic1d_lam2);
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type k) {
+            PIC_1D_RAJA_ATOMIC_BODY3(RAJA::omp_atomic);
+          });
+
+        }); // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_1D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,127 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+  //
+  // Define threads per team for target execution
+  //
+  const size_t threads_per_team = 256;
+
+
+void PIC_1D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PIC_1D_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(vx, xx, xi, ex1, dex1, ix, grd, ex, dex) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          PIC_1D_BODY1;
+        }
+      } else {
+        #pragma omp target is_device_ptr(vx, xx, xi, ex1, dex1, ix, grd, ex, dex) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          PIC_1D_BODY1;
+        }
+      }
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(vx, xx, xi, ex1, dex1, rx, ir) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          PIC_1D_BODY2;
+        }
+      } else {
+        #pragma omp target is_device_ptr(vx, xx, xi, ex1, dex1, rx, ir) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          PIC_1D_BODY2;
+        }
+      }
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(rh, rx, ir) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          #pragma omp atomic
+          rh[ ir[k]-1 ] += 1.0 - rx[k];
+          #pragma omp atomic
+          rh[ ir[k] ] += rx[k];
+        }
+      } else {
+        #pragma omp target is_device_ptr(rh, rx, ir) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          #pragma omp atomic
+          rh[ ir[k]-1 ] += 1.0 - rx[k];
+          #pragma omp atomic
+          rh[ ir[k] ] += rx[k];
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+        RAJA::RangeSegment(ibegin, iend), [=](Index_type k) {
+        PIC_1D_BODY1;
+      });
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+        RAJA::RangeSegment(ibegin, iend), [=](Index_type k) {
+        PIC_1D_BODY2;
+      });
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+        RAJA::RangeSegment(ibegin, iend), [=](Index_type k) {
+        PIC_1D_RAJA_ATOMIC_BODY3(RAJA::omp_atomic);
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PIC_1D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
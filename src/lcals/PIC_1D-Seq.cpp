@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void PIC_1D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PIC_1D_DATA_SETUP;
+
+#if defined(RUN_RAJA_SEQ)
+  auto pic1d_lam1 = [=](Index_type k) {
+                      PIC_1D_BODY1;
+                    };
+  auto pic1d_lam2 = [=](Index_type k) {
+                      PIC_1D_BODY2;
+                    };
+  auto pic1d_lam3 = [=](Index_type k) {
+                      PIC_1D_BODY3;
+                    };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          PIC_1D_BODY1;
+        }
+
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          PIC_1D_BODY2;
+        }
+
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          PIC_1D_BODY3;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          pic1d_lam1(k);
+        }
+
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          pic1d_lam2(k);
+        }
+
+        for (Index_type k = ibegin; k < iend; ++k ) {
+          pic1d_lam3(k);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), pic1d_lam1);
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), pic1d_lam2);
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type k) {
+          PIC_1D_RAJA_ATOMIC_BODY3(RAJA::seq_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PIC_1D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,136 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+PIC_1D::PIC_1D(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_PIC_1D, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_grid_len = 2048;
+
+  m_flx = 0.001;
+
+  setItsPerRep( 3 * getActualProblemSize() );
+  setKernelsPerRep(3);
+  setBytesPerRep( (5*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type) + 2*sizeof(Real_type)) * m_grid_len +
+
+                  (3*sizeof(Real_type) + 5*sizeof(Real_type)) * getActualProblemSize() +
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() +
+
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * (m_grid_len+1) );
+  setFLOPsPerRep((0 +
+                  8 +
+                  3) * getActualProblemSize());
+
+  checksum_scale_factor = 0.001;
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setHasPattern(GatherScatter);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+PIC_1D::~PIC_1D()
+{
+}
+
+void PIC_1D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type num_particles = getActualProblemSize();
+
+  //
+  // Particles start in the cells [1, 2048] of the grid.
+  //
+  constexpr unsigned long long grd_seed = 1409;
+
+  allocData(m_grd, num_particles, vid);
+  {
+    auto reset_grd = scopedMoveData(m_grd, num_particles, vid);
+    for (Index_type k = 0; k < num_particles; ++k) {
+      m_grd[k] = 1.0 + std::floor(m_grid_len * detail::counterRandValue(grd_seed, k));
+    }
+  }
+
+  allocAndInitDataConst(m_vx, num_particles, 0.0, vid);
+  allocAndInitDataConst(m_xx, num_particles, 0.0, vid);
+  allocAndInitDataConst(m_xi, num_particles, 0.0, vid);
+  allocAndInitDataConst(m_ex1, num_particles, 0.0, vid);
+  allocAndInitDataConst(m_dex1, num_particles, 0.0, vid);
+  allocAndInitDataConst(m_rx, num_particles, 0.0, vid);
+  allocAndInitDataConst(m_ix, num_particles, 0, vid);
+  allocAndInitDataConst(m_ir, num_particles, 0, vid);
+  allocAndInitData(m_ex, m_grid_len, vid);
+  allocAndInitData(m_dex, m_grid_len, vid);
+  allocAndInitDataConst(m_rh, m_grid_len+1, 0.0, vid);
+}
+
+void PIC_1D::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_xx, getActualProblemSize(), vid);
+  checksum[vid][tune_idx] += calcChecksum(m_rh, m_grid_len+1, checksum_scale_factor , vid);
+}
+
+void PIC_1D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_vx, vid);
+  deallocData(m_xx, vid);
+  deallocData(m_xi, vid);
+  deallocData(m_ex1, vid);
+  deallocData(m_dex1, vid);
+  deallocData(m_rx, vid);
+  deallocData(m_ix, vid);
+  deallocData(m_ir, vid);
+  deallocData(m_grd, vid);
+  deallocData(m_ex, vid);
+  deallocData(m_dex, vid);
+  deallocData(m_rh, vid);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
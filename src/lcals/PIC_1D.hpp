@@ -0,0 +1,144 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// PIC_1D kernel reference implementation (Livermore loop 14):
+///
+/// for (Index_type k = 0; k < N; ++k ) {
+///   vx[k] = 0.0;
+///   xx[k] = 0.0;
+///   ix[k] = (Int_type) grd[k];
+///   xi[k] = (Real_type) ix[k];
+///   ex1[k] = ex[ ix[k] - 1 ];
+///   dex1[k] = dex[ ix[k] - 1 ];
+/// }
+///
+/// for (Index_type k = 0; k < N; ++k ) {
+///   vx[k] = vx[k] + ex1[k] + ( xx[k] - xi[k] )*dex1[k];
+///   xx[k] = xx[k] + vx[k]  + flx;
+///   ir[k] = xx[k];
+///   rx[k] = xx[k] - ir[k];
+///   ir[k] = ( ir[k] & 2048-1 ) + 1;
+///   xx[k] = rx[k] + ir[k];
+/// }
+///
+/// for (Index_type k = 0; k < N; ++k ) {
+///   rh[ ir[k]-1 ] += 1.0 - rx[k];
+///   rh[ ir[k] ] += rx[k];
+/// }
+///
+/// The particles of the last loop deposit to the same cells of rh, so the
+/// parallel variants add their charges atomically and their checksums
+/// differ by rounding.
+///
+
+#ifndef RAJAPerf_Lcals_PIC_1D_HPP
+#define RAJAPerf_Lcals_PIC_1D_HPP
+
+
+#define PIC_1D_DATA_SETUP \
+  Real_ptr vx = m_vx; \
+  Real_ptr xx = m_xx; \
+  Real_ptr xi = m_xi; \
+  Real_ptr ex1 = m_ex1; \
+  Real_ptr dex1 = m_dex1; \
+  Real_ptr rx = m_rx; \
+  Int_ptr ix = m_ix; \
+  Int_ptr ir = m_ir; \
+  Real_ptr grd = m_grd; \
+  Real_ptr ex = m_ex; \
+  Real_ptr dex = m_dex; \
+  Real_ptr rh = m_rh; \
+\
+  const Real_type flx = m_flx;
+
+#define PIC_1D_BODY1 \
+  vx[k] = 0.0; \
+  xx[k] = 0.0; \
+  ix[k] = static_cast<Int_type>(grd[k]); \
+  xi[k] = static_cast<Real_type>(ix[k]); \
+  ex1[k] = ex[ ix[k] - 1 ]; \
+  dex1[k] = dex[ ix[k] - 1 ];
+
+#define PIC_1D_BODY2 \
+  vx[k] = vx[k] + ex1[k] + ( xx[k] - xi[k] )*dex1[k]; \
+  xx[k] = xx[k] + vx[k]  + flx; \
+  ir[k] = static_cast<Int_type>(xx[k]); \
+  rx[k] = xx[k] - ir[k]; \
+  ir[k] = ( ir[k] & 2048-1 ) + 1; \
+  xx[k] = rx[k] + ir[k];
+
+#define PIC_1D_BODY3 \
+  rh[ ir[k]-1 ] += 1.0 - rx[k]; \
+  rh[ ir[k] ] += rx[k];
+
+#define PIC_1D_RAJA_ATOMIC_BODY3(policy) \
+  RAJA::atomicAdd<policy>(&rh[ ir[k]-1 ], 1.0 - rx[k]); \
+  RAJA::atomicAdd<policy>(&rh[ ir[k] ], rx[k]);
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class PIC_1D : public KernelBase
+{
+public:
+
+  PIC_1D(const RunParams& params);
+
+  ~PIC_1D();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Real_ptr m_vx;
+  Real_ptr m_xx;
+  Real_ptr m_xi;
+  Real_ptr m_ex1;
+  Real_ptr m_dex1;
+  Real_ptr m_rx;
+  Int_ptr m_ix;
+  Int_ptr m_ir;
+  Real_ptr m_grd;
+  Real_ptr m_ex;
+  Real_ptr m_dex;
+  Real_ptr m_rh;
+
+  Real_type m_flx;
+
+  Index_type m_grid_len;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
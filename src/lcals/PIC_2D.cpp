@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+PIC_2D::PIC_2D(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_PIC_2D, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_grid_len = 64 * 64;
+  m_table_len = 96;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (4*sizeof(Real_type) + 4*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type) + 2*sizeof(Real_type)) * m_grid_len +
+                  (0*sizeof(Real_type) + 2*sizeof(Real_type)) * m_table_len +
+                  (0*sizeof(Int_type) + 2*sizeof(Int_type)) * m_table_len +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_grid_len );
+  setFLOPsPerRep(7 * getActualProblemSize());
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setHasPattern(GatherScatter);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+PIC_2D::~PIC_2D()
+{
+}
+
+void PIC_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type num_particles = getActualProblemSize();
+
+  //
+  // Particles start anywhere in the 64 by 64 grid with velocities in
+  // [-0.5, 0.5), and the fields and corrections are in [-0.05, 0.05) so
+  // velocities stay small. The offsets e and f are 0 or 1, and 1 where
+  // the cell index i2 or j2 is -1, so every count lands in the grid.
+  //
+  constexpr unsigned long long p_seed = 1301;
+  constexpr unsigned long long field_seed = 1303;
+  constexpr unsigned long long offset_seed = 1307;
+
+  allocData(m_p, 4*num_particles, vid);
+  allocData(m_b, m_grid_len, vid);
+  allocData(m_c, m_grid_len, vid);
+  allocData(m_y, m_table_len, vid);
+  allocData(m_z, m_table_len, vid);
+  allocData(m_e, m_table_len, vid);
+  allocData(m_f, m_table_len, vid);
+  {
+    auto reset_p = scopedMoveData(m_p, 4*num_particles, vid);
+    auto reset_b = scopedMoveData(m_b, m_grid_len, vid);
+    auto reset_c = scopedMoveData(m_c, m_grid_len, vid);
+    auto reset_y = scopedMoveData(m_y, m_table_len, vid);
+    auto reset_z = scopedMoveData(m_z, m_table_len, vid);
+    auto reset_e = scopedMoveData(m_e, m_table_len, vid);
+    auto reset_f = scopedMoveData(m_f, m_table_len, vid);
+
+    for (Index_type ip = 0; ip < num_particles; ++ip) {
+      m_p[0 + ip*4] = 64.0 * detail::counterRandValue(p_seed, 0 + ip*4);
+      m_p[1 + ip*4] = 64.0 * detail::counterRandValue(p_seed, 1 + ip*4);
+      m_p[2 + ip*4] = detail::counterRandValue(p_seed, 2 + ip*4) - 0.5;
+      m_p[3 + ip*4] = detail::counterRandValue(p_seed, 3 + ip*4) - 0.5;
+    }
+    for (Index_type i = 0; i < m_grid_len; ++i) {
+      m_b[i] = 0.1 * detail::counterRandValue(field_seed, 2*i) - 0.05;
+      m_c[i] = 0.1 * detail::counterRandValue(field_seed, 2*i+1) - 0.05;
+    }
+    for (Index_type i = 0; i < m_table_len; ++i) {
+      m_y[i] = 0.1 * detail::counterRandValue(field_seed, 2*(m_grid_len+i)) - 0.05;
+      m_z[i] = 0.1 * detail::counterRandValue(field_seed, 2*(m_grid_len+i)+1) - 0.05;
+      m_e[i] = (i == 31) ? 1 : (detail::counterRandValue(offset_seed, 2*i) < 0.5 ? 0 : 1);
+      m_f[i] = (i == 31) ? 1 : (detail::counterRandValue(offset_seed, 2*i+1) < 0.5 ? 0 : 1);
+    }
+  }
+  allocAndInitDataConst(m_h, m_grid_len, 0.0, vid);
+}
+
+void PIC_2D::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_p, 4*getActualProblemSize(), vid);
+  checksum[vid][tune_idx] += calcChecksum(m_h, m_grid_len, vid);
+}
+
+void PIC_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_p, vid);
+  deallocData(m_b, vid);
+  deallocData(m_c, vid);
+  deallocData(m_y, vid);
+  deallocData(m_z, vid);
+  deallocData(m_e, vid);
+  deallocData(m_f, vid);
+  deallocData(m_h, vid);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
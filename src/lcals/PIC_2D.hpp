@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// PIC_2D kernel reference implementation (Livermore loop 13):
+///
+/// for (Index_type ip = 0; ip < N; ++ip ) {
+///   Index_type i1 = p[ip][0];
+///   Index_type j1 = p[ip][1];
+///   i1 &= 64-1;
+///   j1 &= 64-1;
+///   p[ip][2] += b[j1][i1];
+///   p[ip][3] += c[j1][i1];
+///   p[ip][0] += p[ip][2];
+///   p[ip][1] += p[ip][3];
+///   Index_type i2 = p[ip][0];
+///   Index_type j2 = p[ip][1];
+///   i2 = ( i2 & 64-1 ) - 1;
+///   j2 = ( j2 & 64-1 ) - 1;
+///   p[ip][0] += y[i2+32];
+///   p[ip][1] += z[j2+32];
+///   i2 += e[i2+32];
+///   j2 += f[j2+32];
+///   h[j2][i2] += 1.0;
+/// }
+///
+/// Particles are independent except for the counts they add to the cells
+/// of h, so the parallel variants add them atomically.
+///
+
+#ifndef RAJAPerf_Lcals_PIC_2D_HPP
+#define RAJAPerf_Lcals_PIC_2D_HPP
+
+
+#define PIC_2D_DATA_SETUP \
+  Real_ptr p = m_p; \
+  Real_ptr b = m_b; \
+  Real_ptr c = m_c; \
+  Real_ptr y = m_y; \
+  Real_ptr z = m_z; \
+  Int_ptr e = m_e; \
+  Int_ptr f = m_f; \
+  Real_ptr h = m_h;
+
+#define PIC_2D_PUSH_BODY \
+  Index_type i1 = static_cast<Index_type>(p[0 + ip*4]); \
+  Index_type j1 = static_cast<Index_type>(p[1 + ip*4]); \
+  i1 &= 64-1; \
+  j1 &= 64-1; \
+  p[2 + ip*4] += b[i1 + j1*64]; \
+  p[3 + ip*4] += c[i1 + j1*64]; \
+  p[0 + ip*4] += p[2 + ip*4]; \
+  p[1 + ip*4] += p[3 + ip*4]; \
+  Index_type i2 = static_cast<Index_type>(p[0 + ip*4]); \
+  Index_type j2 = static_cast<Index_type>(p[1 + ip*4]); \
+  i2 = ( i2 & 64-1 ) - 1; \
+  j2 = ( j2 & 64-1 ) - 1; \
+  p[0 + ip*4] += y[i2+32]; \
+  p[1 + ip*4] += z[j2+32]; \
+  i2 += e[i2+32]; \
+  j2 += f[j2+32];
+
+#define PIC_2D_BODY \
+  PIC_2D_PUSH_BODY \
+  h[i2 + j2*64] += 1.0;
+
+#define PIC_2D_RAJA_ATOMIC_BODY(policy) \
+  PIC_2D_PUSH_BODY \
+  RAJA::atomicAdd<policy>(&h[i2 + j2*64], 1.0);
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class PIC_2D : public KernelBase
+{
+public:
+
+  PIC_2D(const RunParams& params);
+
+  ~PIC_2D();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, bool launch = false >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Real_ptr m_p;
+  Real_ptr m_b;
+  Real_ptr m_c;
+  Real_ptr m_y;
+  Real_ptr m_z;
+  Int_ptr m_e;
+  Int_ptr m_f;
+  Real_ptr m_h;
+
+  Index_type m_grid_len;
+  Index_type m_table_len;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 #include <cmath>
@@ -22,8 +23,8 @@ namespace rajaperf
 namespace lcals
 {
 
-template < size_t block_size >
-__launch_bounds__(block_size)
+template < size_t block_size, size_t min_blocks = 1 >
+__launch_bounds__(block_size, min_blocks)
 __global__ void planckian(Real_ptr x, Real_ptr y,
                           Real_ptr u, Real_ptr v, Real_ptr w,
                           Index_type iend)
@@ -36,6 +37,19 @@ __global__ void planckian(Real_ptr x, Real_ptr y,
 
 
 template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void planckian_fast_math(Real_ptr x, Real_ptr y,
+                                    Real_ptr u, Real_ptr v, Real_ptr w,
+                                    Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     PLANCKIAN_BODY_FAST_MATH;
+   }
+}
+
+
+template < size_t block_size, size_t min_blocks, bool launch >
 void PLANCKIAN::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -48,12 +62,14 @@ void PLANCKIAN::runCudaVariantImpl(VariantID vid)
 
   if ( vid == Base_CUDA ) {
 
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("planckian", planckian<block_size, min_blocks>, block_size, 0) );
+
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
        constexpr size_t shmem = 0;
-       planckian<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( x, y,
+       planckian<block_size, min_blocks><<<grid_size, block_size, shmem, res.get_stream()>>>( x, y,
                                              u, v, w,
                                              iend );
        cudaErrchk( cudaGetLastError() );
@@ -66,7 +82,7 @@ void PLANCKIAN::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
          PLANCKIAN_BODY;
        });
@@ -79,7 +95,115 @@ void PLANCKIAN::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(PLANCKIAN, Cuda)
+template < size_t block_size >
+void PLANCKIAN::runCudaVariantFastMath(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  PLANCKIAN_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+       constexpr size_t shmem = 0;
+       planckian_fast_math<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( x, y,
+                                             u, v, w,
+                                             iend );
+       cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PLANCKIAN : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void PLANCKIAN::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    RAJAPERF_GPU_MIN_BLOCKS_TUNING_RUN(Cuda, Impl)
+
+    RAJAPERF_GPU_FAST_MATH_TUNING_RUN(Cuda, FastMath)
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          setBlockSize(block_size);
+          runCudaVariantImpl<block_size, 1, true>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+
+}
+
+void PLANCKIAN::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    RAJAPERF_GPU_MIN_BLOCKS_TUNING_NAMES
+
+    RAJAPERF_GPU_FAST_MATH_TUNING_NAMES
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+}
 
 } // end namespace lcals
 } // end namespace rajaperf
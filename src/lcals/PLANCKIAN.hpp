@@ -14,6 +14,9 @@
 ///   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 /// }
 ///
+/// The fast_math tunings compute the divides and exp with the fast methods
+/// in common/FastMathUtils.hpp.
+///
 
 #ifndef RAJAPerf_Lcals_PLANCKIAN_HPP
 #define RAJAPerf_Lcals_PLANCKIAN_HPP
@@ -30,8 +33,13 @@
   y[i] = u[i] / v[i]; \
   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 
+#define PLANCKIAN_BODY_FAST_MATH  \
+  y[i] = fast_math::div( u[i], v[i] ); \
+  w[i] = fast_math::div( x[i], fast_math::exp( y[i] ) - 1.0 );
+
 
 #include "common/KernelBase.hpp"
+#include "common/FastMathUtils.hpp"
 
 namespace rajaperf
 {
@@ -59,12 +67,19 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  void runSeqVariantFastMath(VariantID vid);
+  template < size_t block_size, size_t min_blocks = 1, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantFastMath(VariantID vid);
+  template < size_t block_size, size_t min_blocks = 1, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantFastMath(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
 
 #include <iostream>
 
@@ -33,7 +34,7 @@ __global__ void eos(Real_ptr xout, Real_ptr xin, Real_ptr y, Real_ptr z,
 }
 
 
-template < size_t block_size >
+template < size_t block_size, bool launch >
 void TRIDIAG_ELIM::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -64,7 +65,7 @@ void TRIDIAG_ELIM::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+       gpu_launch::forall< block_size, launch >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
          TRIDIAG_ELIM_BODY;
        });
@@ -77,7 +78,7 @@ void TRIDIAG_ELIM::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(TRIDIAG_ELIM, Cuda)
+RAJAPERF_GPU_BLOCK_SIZE_LAUNCH_TUNING_DEFINE_BOILERPLATE(TRIDIAG_ELIM, Cuda, RAJA_CUDA)
 
 } // end namespace lcals
 } // end namespace rajaperf
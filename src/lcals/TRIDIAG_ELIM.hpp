@@ -10,7 +10,8 @@
 /// TRIDIAG_ELIM kernel reference implementation:
 ///
 /// Note: kernel is altered to enable parallelism (original did not have
-///       separate input and output arrays for 'x').
+///       separate input and output arrays for 'x'). Algorithm_TRIDIAG_SOLVE
+///       solves tridiagonal systems with the recurrence intact.
 ///
 /// for (Index_type i = 1; i < N; ++i ) {
 ///   xout[i] = z[i] * ( y[i] - xin[i-1] );
@@ -59,11 +60,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void runSeqVariantSimd(VariantID vid);
+  template < size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
 
 private:
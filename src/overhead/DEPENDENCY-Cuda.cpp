@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "DEPENDENCY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace overhead
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dependency_node(Real_ptr x, Real_type a, Real_type b,
+                                Index_type len)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < len) {
+     DEPENDENCY_BODY;
+   }
+}
+
+
+void DEPENDENCY::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+
+  const std::vector<Node>& graph = m_graphs[tune_idx];
+
+  DEPENDENCY_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    std::vector<cudaStream_t> streams(m_num_streams);
+    for (cudaStream_t& stream : streams) {
+      cudaErrchk( cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking) );
+    }
+    std::vector<cudaEvent_t> events(graph.size());
+    for (cudaEvent_t& event : events) {
+      cudaErrchk( cudaEventCreateWithFlags(&event, cudaEventDisableTiming) );
+    }
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(len, block_size);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t n = 0; n < graph.size(); ++n) {
+        DEPENDENCY_NODE_SETUP(n);
+        cudaStream_t stream = streams[graph[n].stream];
+        for (Index_type p : graph[n].preds) {
+          cudaErrchk( cudaStreamWaitEvent(stream, events[p], 0) );
+        }
+        dependency_node<block_size><<<grid_size, block_size, shmem, stream>>>(
+            x, a, b, len );
+        cudaErrchk( cudaGetLastError() );
+        if (graph[n].record) {
+          cudaErrchk( cudaEventRecord(events[n], stream) );
+        }
+      }
+
+    }
+    for (cudaStream_t& stream : streams) {
+      cudaErrchk( cudaStreamSynchronize(stream) );
+    }
+    stopTimer();
+
+    for (cudaEvent_t& event : events) {
+      cudaErrchk( cudaEventDestroy(event) );
+    }
+    for (cudaStream_t& stream : streams) {
+      cudaErrchk( cudaStreamDestroy(stream) );
+    }
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    // streams of the camp resource pool, each event taken from a resource
+    // is a new CUDA event as in codes that use camp resources
+    std::vector<camp::resources::Cuda> resources;
+    for (Index_type s = 0; s < m_num_streams; ++s) {
+      resources.emplace_back(camp::resources::Cuda(s));
+    }
+    std::vector<camp::resources::Event> events(graph.size());
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t n = 0; n < graph.size(); ++n) {
+        DEPENDENCY_NODE_SETUP(n);
+        camp::resources::Cuda& res = resources[graph[n].stream];
+        for (Index_type p : graph[n].preds) {
+          res.wait_for(&events[p]);
+        }
+        RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+          RAJA::RangeSegment(0, len), [=] __device__ (Index_type i) {
+          DEPENDENCY_BODY;
+        });
+        if (graph[n].record) {
+          events[n] = res.get_event_erased();
+        }
+      }
+
+    }
+    for (camp::resources::Cuda& res : resources) {
+      res.wait();
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  DEPENDENCY : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void DEPENDENCY::setCudaTuningDefinitions(VariantID vid)
+{
+  addPatternTunings(vid);
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
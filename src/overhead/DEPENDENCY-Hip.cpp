@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "DEPENDENCY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace overhead
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dependency_node(Real_ptr x, Real_type a, Real_type b,
+                                Index_type len)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < len) {
+     DEPENDENCY_BODY;
+   }
+}
+
+
+void DEPENDENCY::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+
+  const std::vector<Node>& graph = m_graphs[tune_idx];
+
+  DEPENDENCY_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    std::vector<hipStream_t> streams(m_num_streams);
+    for (hipStream_t& stream : streams) {
+      hipErrchk( hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) );
+    }
+    std::vector<hipEvent_t> events(graph.size());
+    for (hipEvent_t& event : events) {
+      hipErrchk( hipEventCreateWithFlags(&event, hipEventDisableTiming) );
+    }
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(len, block_size);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t n = 0; n < graph.size(); ++n) {
+        DEPENDENCY_NODE_SETUP(n);
+        hipStream_t stream = streams[graph[n].stream];
+        for (Index_type p : graph[n].preds) {
+          hipErrchk( hipStreamWaitEvent(stream, events[p], 0) );
+        }
+        hipLaunchKernelGGL((dependency_node<block_size>), dim3(grid_size), dim3(block_size), shmem, stream,
+                           x, a, b, len );
+        hipErrchk( hipGetLastError() );
+        if (graph[n].record) {
+          hipErrchk( hipEventRecord(events[n], stream) );
+        }
+      }
+
+    }
+    for (hipStream_t& stream : streams) {
+      hipErrchk( hipStreamSynchronize(stream) );
+    }
+    stopTimer();
+
+    for (hipEvent_t& event : events) {
+      hipErrchk( hipEventDestroy(event) );
+    }
+    for (hipStream_t& stream : streams) {
+      hipErrchk( hipStreamDestroy(stream) );
+    }
+
+  } else if ( vid == RAJA_HIP ) {
+
+    // streams of the camp resource pool, each event taken from a resource
+    // is a new HIP event as in codes that use camp resources
+    std::vector<camp::resources::Hip> resources;
+    for (Index_type s = 0; s < m_num_streams; ++s) {
+      resources.emplace_back(camp::resources::Hip(s));
+    }
+    std::vector<camp::resources::Event> events(graph.size());
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t n = 0; n < graph.size(); ++n) {
+        DEPENDENCY_NODE_SETUP(n);
+        camp::resources::Hip& res = resources[graph[n].stream];
+        for (Index_type p : graph[n].preds) {
+          res.wait_for(&events[p]);
+        }
+        RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+          RAJA::RangeSegment(0, len), [=] __device__ (Index_type i) {
+          DEPENDENCY_BODY;
+        });
+        if (graph[n].record) {
+          events[n] = res.get_event_erased();
+        }
+      }
+
+    }
+    for (camp::resources::Hip& res : resources) {
+      res.wait();
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  DEPENDENCY : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void DEPENDENCY::setHipTuningDefinitions(VariantID vid)
+{
+  addPatternTunings(vid);
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,50 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "DEPENDENCY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace overhead
+{
+
+
+void DEPENDENCY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  DEPENDENCY_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type n = 0; n < m_num_nodes; ++n) {
+        DEPENDENCY_NODE_SETUP(n);
+        for (Index_type i = 0; i < len; ++i ) {
+          DEPENDENCY_BODY;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  DEPENDENCY : Unknown variant id = " << vid << std::endl;
+  }
+
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
@@ -0,0 +1,185 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "DEPENDENCY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace overhead
+{
+
+
+DEPENDENCY::DEPENDENCY(const RunParams& params)
+  : KernelBase(rajaperf::Overhead_DEPENDENCY, params)
+{
+  setDefaultProblemSize(1024);
+  setDefaultReps(1000);
+
+  m_num_nodes = getKernelParam("nodes", 16, 3);
+  // camp resources are taken from a pool of 16 streams
+  m_num_streams = getKernelParam("streams", 4, 2, 16);
+
+  for (int ip = 0; ip < NumPatterns; ++ip) {
+    m_graphs[ip] = makeGraph(static_cast<Pattern>(ip));
+    m_edges[ip] = 0;
+    for (const Node& node : m_graphs[ip]) {
+      m_edges[ip] += node.preds.size();
+    }
+  }
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( m_num_nodes * getActualProblemSize() );
+  setKernelsPerRep( m_num_nodes );
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                  m_num_nodes * getActualProblemSize() );
+  setFLOPsPerRep(2 * m_num_nodes * getActualProblemSize());
+
+  setMetricNames({"edges", "edge_overhead_sec"});
+
+  setUsesFeature(Forall);
+
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+DEPENDENCY::~DEPENDENCY()
+{
+}
+
+std::string DEPENDENCY::getPatternName(Pattern pattern)
+{
+  switch (pattern) {
+    case Serial: return "serial";
+    case Chain: return "chain";
+    case ForkJoin: return "fork_join";
+    case Diamond: return "diamond";
+    default: return "unknown";
+  }
+}
+
+std::vector<DEPENDENCY::Node> DEPENDENCY::makeGraph(Pattern pattern) const
+{
+  std::vector<Node> graph;
+
+  switch (pattern) {
+
+    case Serial : {
+      for (Index_type n = 0; n < m_num_nodes; ++n) {
+        graph.push_back(Node{0, {}, false});
+      }
+      break;
+    }
+
+    case Chain : {
+      // each node waits for the one before it on the next stream
+      graph.push_back(Node{0, {}, false});
+      for (Index_type n = 1; n < m_num_nodes; ++n) {
+        graph.push_back(Node{n % m_num_streams, {n-1}, false});
+      }
+      break;
+    }
+
+    case ForkJoin : {
+      // a root, branches over all streams, and a join waiting for them all
+      graph.push_back(Node{0, {}, false});
+      std::vector<Index_type> branches;
+      for (Index_type n = 1; n < m_num_nodes-1; ++n) {
+        graph.push_back(Node{n % m_num_streams, {0}, false});
+        branches.push_back(n);
+      }
+      graph.push_back(Node{0, branches, false});
+      break;
+    }
+
+    case Diamond : {
+      // layers of two nodes between a root and a sink, each node waits for
+      // both nodes of the layer before it
+      graph.push_back(Node{0, {}, false});
+      std::vector<Index_type> prev_layer{0};
+      Index_type n = 1;
+      for (Index_type layer = 0; n < m_num_nodes-1; ++layer) {
+        std::vector<Index_type> this_layer;
+        for (Index_type w = 0; w < 2 && n < m_num_nodes-1; ++w, ++n) {
+          graph.push_back(Node{(2*layer + w + 1) % m_num_streams,
+                               prev_layer, false});
+          this_layer.push_back(n);
+        }
+        prev_layer = this_layer;
+      }
+      graph.push_back(Node{0, prev_layer, false});
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DEPENDENCY : Unknown pattern = " << pattern << std::endl;
+    }
+
+  }
+
+  for (const Node& node : graph) {
+    for (Index_type p : node.preds) {
+      graph[p].record = true;
+    }
+  }
+
+  return graph;
+}
+
+void DEPENDENCY::addPatternTunings(VariantID vid)
+{
+  for (int ip = 0; ip < NumPatterns; ++ip) {
+    addVariantTuningName(vid, getPatternName(static_cast<Pattern>(ip)));
+  }
+}
+
+std::vector<double> DEPENDENCY::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  if ( !isVariantGPU(vid) || tune_idx == Serial ||
+       tune_idx >= static_cast<size_t>(NumPatterns) ||
+       !wasVariantTuningRun(vid, Serial) ) {
+    return {};
+  }
+  const double run_reps = static_cast<double>(getRunReps());
+  const double edges = static_cast<double>(m_edges[tune_idx]);
+  const double rep_time = getMinTime(vid, tune_idx) / run_reps;
+  const double serial_rep_time = getMinTime(vid, Serial) / run_reps;
+  return {edges, (rep_time - serial_rep_time) / edges};
+}
+
+void DEPENDENCY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_x, m_num_nodes * getActualProblemSize(), vid);
+  m_a = 0.5;
+  m_b = 1.0;
+}
+
+void DEPENDENCY::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_x, m_num_nodes * getActualProblemSize(), vid);
+}
+
+void DEPENDENCY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_x, vid);
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
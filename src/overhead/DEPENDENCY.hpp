@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// DEPENDENCY kernel reference implementation:
+///
+/// // run the nodes of a dependency graph, each node updates its own array
+/// for (Index_type n = 0; n < num_nodes; ++n ) {
+///   Real_ptr x = xnodes + n*len;
+///   for (Index_type i = 0; i < len; ++i ) {
+///     x[i] = a * x[i] + b;
+///   }
+/// }
+///
+/// Each rep runs num_nodes node kernels, given by the kernel parameter
+/// "nodes", over the number of GPU streams given by the kernel parameter
+/// "streams". Each tuning runs the nodes in a different graph, ie. a chain
+/// across the streams, a fork-join, or a ladder of diamonds, where a node
+/// waits for the nodes it depends on with events. The serial tuning runs all
+/// nodes in order on one stream with no events, so the difference in time
+/// per rep divided by the edges of a graph is the overhead of one
+/// dependency. The Base variants use CUDA/HIP streams and events and the
+/// RAJA variants use camp resources and their events. The problem size is
+/// the length of each node array, so small sizes give trivial kernels and
+/// large sizes STREAM like kernels.
+///
+
+#ifndef RAJAPerf_Overhead_DEPENDENCY_HPP
+#define RAJAPerf_Overhead_DEPENDENCY_HPP
+
+#define DEPENDENCY_DATA_SETUP \
+  Real_ptr xnodes = m_x; \
+  const Index_type len = getActualProblemSize(); \
+  const Real_type a = m_a; \
+  const Real_type b = m_b;
+
+#define DEPENDENCY_NODE_SETUP(n) \
+  Real_ptr x = xnodes + (n)*len;
+
+#define DEPENDENCY_BODY  \
+  x[i] = a * x[i] + b;
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace overhead
+{
+
+class DEPENDENCY : public KernelBase
+{
+public:
+
+  DEPENDENCY(const RunParams& params);
+
+  ~DEPENDENCY();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  DEPENDENCY : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  DEPENDENCY : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  // edges per rep and the overhead of one edge relative to the serial
+  // tuning in seconds
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
+private:
+  static const size_t default_gpu_block_size = 256;
+
+  // graphs in the order of the GPU tunings
+  enum Pattern {
+    Serial = 0,
+    Chain,
+    ForkJoin,
+    Diamond,
+    NumPatterns
+  };
+  static std::string getPatternName(Pattern pattern);
+
+  struct Node
+  {
+    Index_type stream;
+    std::vector<Index_type> preds; // nodes this node waits for
+    bool record;                   // a later node waits for this node
+  };
+
+  // nodes in an order where each node comes after the nodes it waits for
+  std::vector<Node> makeGraph(Pattern pattern) const;
+
+  void addPatternTunings(VariantID vid);
+
+  Index_type m_num_nodes;
+  Index_type m_num_streams;
+
+  std::vector<Node> m_graphs[NumPatterns];
+  Index_type m_edges[NumPatterns];
+
+  Real_ptr m_x;
+  Real_type m_a;
+  Real_type m_b;
+};
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
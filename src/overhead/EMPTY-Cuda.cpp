@@ -0,0 +1,201 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "EMPTY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace overhead
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void empty(Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     EMPTY_BODY;
+   }
+}
+
+
+template < size_t block_size >
+void EMPTY::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  EMPTY_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      empty<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      lambda_cuda_forall<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+        ibegin, iend, [=] __device__ (Index_type i) {
+        EMPTY_BODY;
+      });
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        EMPTY_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  EMPTY : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void EMPTY::runCudaVariantLaunch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  EMPTY_DATA_SETUP;
+
+  if ( vid == RAJA_CUDA ) {
+
+    constexpr bool async = true;
+
+    using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<async, block_size>>;
+
+    using teams_x = RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
+
+    using threads_x = RAJA::LoopPolicy<RAJA::cuda_thread_size_x_direct<block_size>>;
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::launch<launch_policy>( res,
+        RAJA::LaunchParams(RAJA::Teams(grid_size),
+                           RAJA::Threads(block_size)),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<teams_x>(ctx, RAJA::RangeSegment(0, grid_size),
+            [&](Index_type bx) {
+              RAJA::loop<threads_x>(ctx, RAJA::RangeSegment(0, block_size),
+                [&](Index_type tx) {
+                  const Index_type i = bx * block_size + tx;
+                  if (i < iend) {
+                    EMPTY_BODY;
+                  }
+                }
+              );  // RAJA::loop<threads_x>
+            }
+          );  // RAJA::loop<teams_x>
+
+        }  // outer lambda (ctx)
+      );  // RAJA::launch
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  EMPTY : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void EMPTY::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == RAJA_CUDA) {
+
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantLaunch<block_size>(vid);
+        }
+        t += 1;
+
+      }
+
+    }
+
+  });
+}
+
+void EMPTY::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, block_name);
+
+      if (vid == RAJA_CUDA) {
+        addVariantTuningName(vid, "launch_"+block_name);
+      }
+
+    }
+
+  });
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
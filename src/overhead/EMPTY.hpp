@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// EMPTY kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+/// }
+///
+/// Each rep launches one loop, or GPU kernel, with an empty body, so the
+/// time per rep is the cost of a launch of the variant with no work and
+/// no arguments besides the iteration range. The RAJA variants also have
+/// launch tunings that use RAJA::launch in place of RAJA::forall.
+///
+
+#ifndef RAJAPerf_Overhead_EMPTY_HPP
+#define RAJAPerf_Overhead_EMPTY_HPP
+
+#define EMPTY_DATA_SETUP
+
+// the body does nothing, i is only used to avoid unused warnings
+#define EMPTY_BODY \
+  static_cast<void>(i);
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace overhead
+{
+
+class EMPTY : public KernelBase
+{
+public:
+
+  EMPTY(const RunParams& params);
+
+  ~EMPTY();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantLaunch(VariantID vid);
+  void runOpenMPVariantLaunch(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantLaunch(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantLaunch(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+};
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "TRIVIAL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace overhead
+{
+
+
+template < size_t num_values >
+void TRIVIAL::runSeqVariantLaunch(VariantID vid)
+{
+#if defined(RUN_RAJA_SEQ)
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRIVIAL_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_Seq : {
+
+      using launch_policy = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+
+      using outer_x = RAJA::LoopPolicy<RAJA::seq_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::launch<launch_policy>(RAJA::LaunchParams(),
+          [=](RAJA::LaunchContext ctx) {
+            RAJA::loop<outer_x>(ctx, RAJA::RangeSegment(ibegin, iend),
+              [&](Index_type i) {
+                TRIVIAL_BODY;
+              }
+            );  // RAJA::loop<outer_x>
+          }  // outer lambda (ctx)
+        );  // RAJA::launch
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRIVIAL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < size_t num_values >
+void TRIVIAL::runSeqVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRIVIAL_DATA_SETUP;
+
+#if defined(RUN_RAJA_SEQ)
+  auto trivial_lam = [=](Index_type i) {
+                     TRIVIAL_BODY;
+                   };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRIVIAL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          trivial_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), trivial_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRIVIAL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRIVIAL::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  dispatchArgs([&](auto num_values) {
+    if ( tune_idx == 0 ) {
+      runSeqVariantImpl<num_values>(vid);
+    } else {
+      runSeqVariantLaunch<num_values>(vid);
+    }
+  });
+}
+
+void TRIVIAL::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "launch");
+  }
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
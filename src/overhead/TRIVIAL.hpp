@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// TRIVIAL kernel reference implementation:
+///
+/// TRIVIAL_Args<num_values> args;
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   x[i] += args.values[0];
+/// }
+///
+/// Each rep launches one loop, or GPU kernel, with a body that updates one
+/// value per iterate. args holds arg_bytes bytes, given by the kernel
+/// parameter "arg_bytes", and is passed to the Base GPU kernels by value and
+/// captured whole by the lambdas of the other variants, so sweeping
+/// arg_bytes gives the cost of copying kernel arguments at launch. The RAJA
+/// variants also have launch tunings that use RAJA::launch in place of
+/// RAJA::forall.
+///
+
+#ifndef RAJAPerf_Overhead_TRIVIAL_HPP
+#define RAJAPerf_Overhead_TRIVIAL_HPP
+
+#define TRIVIAL_DATA_SETUP \
+  Real_ptr x = m_x; \
+  TRIVIAL_Args<num_values> args; \
+  for (size_t v = 0; v < num_values; ++v) { \
+    args.values[v] = m_val; \
+  }
+
+#define TRIVIAL_BODY  \
+  x[i] += args.values[0];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace overhead
+{
+
+template < size_t num_values >
+struct TRIVIAL_Args
+{
+  Real_type values[num_values];
+};
+
+class TRIVIAL : public KernelBase
+{
+public:
+
+  TRIVIAL(const RunParams& params);
+
+  ~TRIVIAL();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t num_values >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t num_values >
+  void runSeqVariantLaunch(VariantID vid);
+  template < size_t num_values >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t num_values >
+  void runOpenMPVariantLaunch(VariantID vid);
+  template < size_t num_values >
+  void runOpenMPTargetVariantImpl(VariantID vid);
+  template < size_t num_values >
+  void runKokkosVariantImpl(VariantID vid);
+  template < size_t block_size, size_t num_values >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size, size_t num_values >
+  void runCudaVariantLaunch(VariantID vid);
+  template < size_t block_size, size_t num_values >
+  void runHipVariantImpl(VariantID vid);
+  template < size_t block_size, size_t num_values >
+  void runHipVariantLaunch(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  // number of values in args for each valid arg_bytes
+  using args_sizes_type = camp::int_seq<size_t, 1, 8, 64, 256>;
+
+  // call func with the number of values in args given by arg_bytes as a
+  // compile time constant
+  template < typename Func >
+  void dispatchArgs(Func&& func)
+  {
+    seq_for(args_sizes_type{}, [&](auto num_values) {
+      if (num_values*sizeof(Real_type) == static_cast<size_t>(m_arg_bytes)) {
+        func(num_values);
+      }
+    });
+  }
+
+  Index_type m_arg_bytes;
+
+  Real_ptr m_x;
+  Real_type m_val;
+};
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_GEMM.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+//
+// A tile_size of zero lets Kokkos choose the MDRangePolicy tiling, the
+// other tile sizes match the tiled GPU tunings.
+//
+void POLYBENCH_GEMM::runKokkosVariantImpl(VariantID vid, Index_type tile_size) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  auto A_view = getViewFromPointer(A, ni * nk);
+  auto B_view = getViewFromPointer(B, nk * nj);
+  auto C_view = getViewFromPointer(C, ni * nj);
+
+  // Point the kernel data at the contiguous View allocations so the
+  // POLYBENCH_GEMM bodies can be used unchanged in the Kokkos lambda
+  A = A_view.data();
+  B = B_view.data();
+  C = C_view.data();
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Kokkos::parallel_for(
+          "POLYBENCH_GEMM_Kokkos Kokkos_Lambda",
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {ni, nj},
+                                                 {tile_size, tile_size}),
+          KOKKOS_LAMBDA(Index_type i, Index_type j) {
+            POLYBENCH_GEMM_BODY1;
+            POLYBENCH_GEMM_BODY2;
+            for (Index_type k = 0; k < nk; ++k) {
+              POLYBENCH_GEMM_BODY3;
+            }
+            POLYBENCH_GEMM_BODY4;
+          });
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_GEMM : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(m_C, C_view, ni * nj);
+}
+
+void POLYBENCH_GEMM::runKokkosVariant(VariantID vid, size_t tune_idx) {
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runKokkosVariantImpl(vid, 0);
+  }
+  t += 1;
+
+  seq_for(gpu_tile_sizes_type{}, [&](auto tile_size) {
+    if (tune_idx == t) {
+      runKokkosVariantImpl(vid, tile_size);
+    }
+    t += 1;
+  });
+}
+
+void POLYBENCH_GEMM::setKokkosTuningDefinitions(VariantID vid) {
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  seq_for(gpu_tile_sizes_type{}, [&](auto tile_size) {
+    addVariantTuningName(vid, "tile_" + std::to_string(tile_size));
+  });
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
@@ -0,0 +1,75 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_JACOBI_2D.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace polybench {
+
+void POLYBENCH_JACOBI_2D::runKokkosVariant(VariantID vid,
+                                           size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_JACOBI_2D_DATA_SETUP;
+
+  auto A_view = getViewFromPointer(A, N * N);
+  auto B_view = getViewFromPointer(B, N * N);
+
+  // Point the kernel data at the contiguous View allocations so the
+  // POLYBENCH_JACOBI_2D bodies can be used unchanged in the Kokkos lambdas
+  A = A_view.data();
+  B = B_view.data();
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        Kokkos::parallel_for(
+            "POLYBENCH_JACOBI_2D_Kokkos Kokkos_Lambda--BODY1",
+            Kokkos::MDRangePolicy<Kokkos::Rank<2>>({1, 1}, {N - 1, N - 1}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j) {
+              POLYBENCH_JACOBI_2D_BODY1;
+            });
+
+        Kokkos::parallel_for(
+            "POLYBENCH_JACOBI_2D_Kokkos Kokkos_Lambda--BODY2",
+            Kokkos::MDRangePolicy<Kokkos::Rank<2>>({1, 1}, {N - 1, N - 1}),
+            KOKKOS_LAMBDA(Index_type i, Index_type j) {
+              POLYBENCH_JACOBI_2D_BODY2;
+            });
+      }
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  POLYBENCH_JACOBI_2D : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(m_A, A_view, N * N);
+  moveDataToHostFromKokkosView(m_B, B_view, N * N);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+#endif // RUN_KOKKOS
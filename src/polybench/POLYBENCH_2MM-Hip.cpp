@@ -14,6 +14,8 @@
 
 #include "common/HipDataUtils.hpp"
 
+#include "tiled_matmul_helper.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -250,7 +252,50 @@ void POLYBENCH_2MM::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_2MM, Hip)
+template < size_t tile_size, size_t reg_size >
+void POLYBENCH_2MM::runHipVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_2MM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dim3 nthreads_per_block(tile_size, tile_size / reg_size, 1);
+      constexpr size_t shmem = 0;
+
+      dim3 nblocks1(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nj, tile_size)),
+                    static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, tile_size)),
+                    static_cast<size_t>(1));
+      hipLaunchKernelGGL((poly_matmul_tiled<tile_size, reg_size>),
+                         dim3(nblocks1), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         tmp, A, B, alpha, 0.0,
+                         ni, nj, nk);
+      hipErrchk( hipGetLastError() );
+
+      dim3 nblocks2(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nl, tile_size)),
+                    static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, tile_size)),
+                    static_cast<size_t>(1));
+      hipLaunchKernelGGL((poly_matmul_tiled<tile_size, reg_size>),
+                         dim3(nblocks2), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         D, tmp, C, 1.0, beta,
+                         ni, nl, nj);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_2MM : Unknown Hip tiled variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TILE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_2MM, Hip, Base_HIP)
 
 } // end namespace polybench
 } // end namespace rajaperf
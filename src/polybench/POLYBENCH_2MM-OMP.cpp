@@ -7,6 +7,7 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_2MM.hpp"
+#include "tiled_matmul_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -26,10 +27,60 @@ namespace polybench
 {
 
 
-void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < Index_type tile_size >
+void POLYBENCH_2MM::runOpenMPVariantTiled(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_2MM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        poly_matmul_tiled_omp<tile_size>(tmp, A, B, alpha, 0.0,
+                                         ni, nj, nk);
+
+        poly_matmul_tiled_omp<tile_size>(D, tmp, C, 1.0, beta,
+                                         ni, nl, nj);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_2MM : Unknown tiled variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx > 0 ) {
+    size_t t = 1;
+    seq_for(omp_tile_sizes_type{}, [&](auto tile_size) {
+      if (tune_idx == t) {
+        runOpenMPVariantTiled<tile_size>(vid);
+      }
+      t += 1;
+    });
+    return;
+  }
+
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_2MM_DATA_SETUP;
@@ -228,8 +279,20 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void POLYBENCH_2MM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    seq_for(omp_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "tile_"+std::to_string(tile_size));
+    });
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -60,6 +60,8 @@ POLYBENCH_2MM::POLYBENCH_2MM(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -128,17 +128,26 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < Index_type tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
+  template < size_t tile_size, size_t reg_size >
+  void runCudaVariantTiled(VariantID vid);
+  template < size_t tile_size, size_t reg_size >
+  void runHipVariantTiled(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using gpu_tile_sizes_type = gpu_block_size::list_type<16, 32>;
+  using omp_tile_sizes_type = camp::int_seq<Index_type, 32, 64>;
 
   Index_type m_ni;
   Index_type m_nj;
@@ -14,6 +14,8 @@
 
 #include "common/CudaDataUtils.hpp"
 
+#include "tiled_matmul_helper.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -322,7 +324,59 @@ void POLYBENCH_3MM::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_3MM, Cuda)
+template < size_t tile_size, size_t reg_size >
+void POLYBENCH_3MM::runCudaVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_3MM_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dim3 nthreads_per_block(tile_size, tile_size / reg_size, 1);
+      constexpr size_t shmem = 0;
+
+      dim3 nblocks1(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nj, tile_size)),
+                    static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, tile_size)),
+                    static_cast<size_t>(1));
+      poly_matmul_tiled<tile_size, reg_size>
+                <<<nblocks1, nthreads_per_block, shmem, res.get_stream()>>>(E, A, B,
+                                                   1.0, 0.0,
+                                                   ni, nj, nk);
+      cudaErrchk( cudaGetLastError() );
+
+      dim3 nblocks2(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nl, tile_size)),
+                    static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nj, tile_size)),
+                    static_cast<size_t>(1));
+      poly_matmul_tiled<tile_size, reg_size>
+                <<<nblocks2, nthreads_per_block, shmem, res.get_stream()>>>(F, C, D,
+                                                   1.0, 0.0,
+                                                   nj, nl, nm);
+      cudaErrchk( cudaGetLastError() );
+
+      dim3 nblocks3(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nl, tile_size)),
+                    static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, tile_size)),
+                    static_cast<size_t>(1));
+      poly_matmul_tiled<tile_size, reg_size>
+                <<<nblocks3, nthreads_per_block, shmem, res.get_stream()>>>(G, E, F,
+                                                   1.0, 0.0,
+                                                   ni, nl, nj);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_3MM : Unknown Cuda tiled variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TILE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_3MM, Cuda, Base_CUDA)
 
 } // end namespace polybench
 } // end namespace rajaperf
@@ -14,6 +14,8 @@
 
 #include "common/HipDataUtils.hpp"
 
+#include "tiled_matmul_helper.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -327,7 +329,59 @@ void POLYBENCH_3MM::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_3MM, Hip)
+template < size_t tile_size, size_t reg_size >
+void POLYBENCH_3MM::runHipVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_3MM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dim3 nthreads_per_block(tile_size, tile_size / reg_size, 1);
+      constexpr size_t shmem = 0;
+
+      dim3 nblocks1(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nj, tile_size)),
+                    static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, tile_size)),
+                    static_cast<size_t>(1));
+      hipLaunchKernelGGL((poly_matmul_tiled<tile_size, reg_size>),
+                         dim3(nblocks1), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         E, A, B, 1.0, 0.0,
+                         ni, nj, nk);
+      hipErrchk( hipGetLastError() );
+
+      dim3 nblocks2(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nl, tile_size)),
+                    static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nj, tile_size)),
+                    static_cast<size_t>(1));
+      hipLaunchKernelGGL((poly_matmul_tiled<tile_size, reg_size>),
+                         dim3(nblocks2), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         F, C, D, 1.0, 0.0,
+                         nj, nl, nm);
+      hipErrchk( hipGetLastError() );
+
+      dim3 nblocks3(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nl, tile_size)),
+                    static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, tile_size)),
+                    static_cast<size_t>(1));
+      hipLaunchKernelGGL((poly_matmul_tiled<tile_size, reg_size>),
+                         dim3(nblocks3), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         G, E, F, 1.0, 0.0,
+                         ni, nl, nj);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_3MM : Unknown Hip tiled variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TILE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_3MM, Hip, Base_HIP)
 
 } // end namespace polybench
 } // end namespace rajaperf
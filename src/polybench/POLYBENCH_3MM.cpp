@@ -68,6 +68,8 @@ POLYBENCH_3MM::POLYBENCH_3MM(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
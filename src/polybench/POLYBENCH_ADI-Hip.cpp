@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "adi_helper.hpp"
 
 #include <iostream>
 
@@ -73,6 +74,124 @@ __global__ void adi_lam(const Index_type n,
 }
 
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void adi1_interleaved(const Index_type n,
+                                 const Real_type a, const Real_type b, const Real_type c,
+                                 const Real_type d, const Real_type f,
+                                 Real_ptr P, Real_ptr Q, Real_ptr U, Real_ptr V)
+{
+  Index_type i = 1 + blockIdx.x * block_size + threadIdx.x;
+  if (i < n-1) {
+    POLYBENCH_ADI_BODY2_INTERLEAVED;
+    for (Index_type j = 1; j < n-1; ++j) {
+       POLYBENCH_ADI_BODY3_INTERLEAVED;
+    }
+    POLYBENCH_ADI_BODY4;
+    for (Index_type k = n-2; k >= 1; --k) {
+       POLYBENCH_ADI_BODY5_INTERLEAVED;
+    }
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void adi2_interleaved(const Index_type n,
+                                 const Real_type a, const Real_type c, const Real_type d,
+                                 const Real_type e, const Real_type f,
+                                 Real_ptr P, Real_ptr Q, Real_ptr U, Real_ptr V)
+{
+  Index_type i = 1 + blockIdx.x * block_size + threadIdx.x;
+  if (i < n-1) {
+    POLYBENCH_ADI_BODY6_INTERLEAVED;
+    for (Index_type j = 1; j < n-1; ++j) {
+      POLYBENCH_ADI_BODY7_INTERLEAVED;
+    }
+    POLYBENCH_ADI_BODY8;
+    for (Index_type k = n-2; k >= 1; --k) {
+      POLYBENCH_ADI_BODY9_INTERLEAVED;
+    }
+  }
+}
+
+//
+// The pcr kernels solve line 1 + blockIdx.x, the equation of x[j] is
+// stored at j-1 with the boundary values x[0] = x[n-1] = 1 moved to the
+// right hand side.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void adi1_pcr(const Index_type n,
+                         const Real_type a, const Real_type b, const Real_type c,
+                         const Real_type d, const Real_type f,
+                         Real_ptr U, Real_ptr V)
+{
+  HIP_DYNAMIC_SHARED(Real_type, adi_pcr_shmem);
+
+  const Index_type m = n-2;
+  Real_ptr sa = adi_pcr_shmem;
+  Real_ptr sb = sa + m;
+  Real_ptr sc = sb + m;
+  Real_ptr sd = sc + m;
+
+  const Index_type i = 1 + blockIdx.x;
+  for (Index_type j = 1 + threadIdx.x; j < n-1; j += block_size) {
+    sa[j-1] = (j > 1) ? a : 0.0;
+    sb[j-1] = b;
+    sc[j-1] = (j < n-2) ? c : 0.0;
+    sd[j-1] = -d * U[j * n + i-1] + (1.0 + 2.0*d) * U[j * n + i] -
+              f * U[j * n + i + 1] - ((j > 1) ? 0.0 : a) - ((j < n-2) ? 0.0 : c);
+  }
+  __syncthreads();
+
+  poly_adi_pcr_solve<block_size>(sa, sb, sc, sd, m);
+
+  for (Index_type k = 1 + threadIdx.x; k < n-1; k += block_size) {
+    V[k * n + i] = sd[k-1];
+  }
+  if (threadIdx.x == 0) {
+    V[0 * n + i] = 1.0;
+    POLYBENCH_ADI_BODY4;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void adi2_pcr(const Index_type n,
+                         const Real_type a, const Real_type c, const Real_type d,
+                         const Real_type e, const Real_type f,
+                         Real_ptr U, Real_ptr V)
+{
+  HIP_DYNAMIC_SHARED(Real_type, adi_pcr_shmem);
+
+  const Index_type m = n-2;
+  Real_ptr sa = adi_pcr_shmem;
+  Real_ptr sb = sa + m;
+  Real_ptr sc = sb + m;
+  Real_ptr sd = sc + m;
+
+  const Index_type i = 1 + blockIdx.x;
+  for (Index_type j = 1 + threadIdx.x; j < n-1; j += block_size) {
+    sa[j-1] = (j > 1) ? d : 0.0;
+    sb[j-1] = e;
+    sc[j-1] = (j < n-2) ? f : 0.0;
+    sd[j-1] = -a * V[(i-1) * n + j] + (1.0 + 2.0*a) * V[i * n + j] -
+              c * V[(i + 1) * n + j] - ((j > 1) ? 0.0 : d) - ((j < n-2) ? 0.0 : f);
+  }
+  __syncthreads();
+
+  poly_adi_pcr_solve<block_size>(sa, sb, sc, sd, m);
+
+  for (Index_type k = 1 + threadIdx.x; k < n-1; k += block_size) {
+    U[i * n + k] = sd[k-1];
+  }
+  if (threadIdx.x == 0) {
+    U[i * n + 0] = 1.0;
+    POLYBENCH_ADI_BODY8;
+  }
+}
+
+
 template < size_t block_size >
 void POLYBENCH_ADI::runHipVariantImpl(VariantID vid)
 {
@@ -233,7 +352,226 @@ void POLYBENCH_ADI::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_ADI, Hip)
+template < size_t block_size >
+void POLYBENCH_ADI::runHipVariantGraph(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_ADI_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    hipGraphExec_t graph_exec = detail::captureHipGraph(res.get_stream(), [&]() {
+
+      for (Index_type t = 1; t <= tsteps; ++t) {
+
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(n-2, block_size);
+        constexpr size_t shmem = 0;
+
+        hipLaunchKernelGGL((adi1<block_size>),
+                           dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           n,
+                           a, b, c, d, f,
+                           P, Q, U, V);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((adi2<block_size>),
+                           dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           n,
+                           a, c, d, e, f,
+                           P, Q, U, V);
+        hipErrchk( hipGetLastError() );
+
+      }  // tstep loop
+
+    });
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipGraphLaunch( graph_exec, res.get_stream() ) );
+
+    }
+    stopTimer();
+
+    hipErrchk( hipGraphExecDestroy( graph_exec ) );
+
+  } else {
+     getCout() << "\n  POLYBENCH_ADI : Unknown Hip graph variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void POLYBENCH_ADI::runHipVariantInterleaved(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_ADI_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 1; t <= tsteps; ++t) {
+
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(n-2, block_size);
+        constexpr size_t shmem = 0;
+
+        hipLaunchKernelGGL((adi1_interleaved<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         n, a, b, c, d, f, P, Q, U, V);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((adi2_interleaved<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         n, a, c, d, e, f, P, Q, U, V);
+        hipErrchk( hipGetLastError() );
+
+      }  // tstep loop
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_ADI : Unknown Hip interleaved variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void POLYBENCH_ADI::runHipVariantPcr(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_ADI_DATA_SETUP;
+  RAJA_UNUSED_VAR(P);
+  RAJA_UNUSED_VAR(Q);
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 1; t <= tsteps; ++t) {
+
+        const size_t grid_size = n-2;
+        const size_t shmem = poly_adi_pcr_shmem(n);
+
+        hipLaunchKernelGGL((adi1_pcr<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         n, a, b, c, d, f, U, V);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((adi2_pcr<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         n, a, c, d, e, f, U, V);
+        hipErrchk( hipGetLastError() );
+
+      }  // tstep loop
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_ADI : Unknown Hip pcr variant id = " << vid << std::endl;
+  }
+}
+
+void POLYBENCH_ADI::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    if (run_params.getGPUStream() != 0) {
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+          if (tune_idx == t) {
+            setBlockSize(block_size);
+            runHipVariantGraph<block_size>(vid);
+          }
+          t += 1;
+        }
+      });
+    }
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantInterleaved<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_adi_pcr_fits(m_n, block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantPcr<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+  }
+}
+
+void POLYBENCH_ADI::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    if (run_params.getGPUStream() != 0) {
+      seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+          addVariantTuningName(vid, "graph_"+std::to_string(block_size));
+        }
+      });
+    }
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "interleaved_"+std::to_string(block_size));
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_adi_pcr_fits(m_n, block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        addVariantTuningName(vid, "pcr_"+std::to_string(block_size));
+      }
+    });
+
+  }
+}
 
 } // end namespace polybench
 } // end namespace rajaperf
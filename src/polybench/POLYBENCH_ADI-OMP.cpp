@@ -7,9 +7,11 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_ADI.hpp"
+#include "adi_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <cstring>
 
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ADI::runOpenMPVariantLineBatch(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -27,6 +29,89 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
   POLYBENCH_ADI_DATA_SETUP;
 
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          #pragma omp parallel for
+          for (Index_type i0 = 1; i0 < n-1; i0 += poly_adi_line_batch) {
+            const Index_type i_end = std::min(i0 + poly_adi_line_batch, n-1);
+            for (Index_type i = i0; i < i_end; ++i) {
+              POLYBENCH_ADI_BODY2_INTERLEAVED;
+            }
+            for (Index_type j = 1; j < n-1; ++j) {
+              for (Index_type i = i0; i < i_end; ++i) {
+                POLYBENCH_ADI_BODY3_INTERLEAVED;
+              }
+            }
+            for (Index_type i = i0; i < i_end; ++i) {
+              POLYBENCH_ADI_BODY4;
+            }
+            for (Index_type k = n-2; k >= 1; --k) {
+              for (Index_type i = i0; i < i_end; ++i) {
+                POLYBENCH_ADI_BODY5_INTERLEAVED;
+              }
+            }
+          }
+
+          #pragma omp parallel for
+          for (Index_type i0 = 1; i0 < n-1; i0 += poly_adi_line_batch) {
+            const Index_type i_end = std::min(i0 + poly_adi_line_batch, n-1);
+            for (Index_type i = i0; i < i_end; ++i) {
+              POLYBENCH_ADI_BODY6_INTERLEAVED;
+            }
+            for (Index_type j = 1; j < n-1; ++j) {
+              for (Index_type i = i0; i < i_end; ++i) {
+                POLYBENCH_ADI_BODY7_INTERLEAVED;
+              }
+            }
+            for (Index_type i = i0; i < i_end; ++i) {
+              POLYBENCH_ADI_BODY8;
+            }
+            for (Index_type k = n-2; k >= 1; --k) {
+              for (Index_type i = i0; i < i_end; ++i) {
+                POLYBENCH_ADI_BODY9_INTERLEAVED;
+              }
+            }
+          }
+
+        }  // tstep loop
+
+      }  // run_reps
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ADI : Unknown line batch variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantLineBatch(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_DATA_SETUP;
+
   switch ( vid ) {
 
     case Base_OpenMP : {
@@ -220,8 +305,18 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void POLYBENCH_ADI::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "line_batch");
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
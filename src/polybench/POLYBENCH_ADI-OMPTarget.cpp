@@ -29,6 +29,8 @@ namespace polybench
 void POLYBENCH_ADI::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
 
   POLYBENCH_ADI_DATA_SETUP;
 
@@ -39,29 +41,59 @@ void POLYBENCH_ADI::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED
 
       for (Index_type t = 1; t <= tsteps; ++t) {
 
-        #pragma omp target is_device_ptr(P,Q,U,V) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-        for (Index_type i = 1; i < n-1; ++i) {
-          POLYBENCH_ADI_BODY2;
-          for (Index_type j = 1; j < n-1; ++j) {
-            POLYBENCH_ADI_BODY3;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(P,Q,U,V) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY2;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY3;
+            }
+            POLYBENCH_ADI_BODY4;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY5;
+            }
           }
-          POLYBENCH_ADI_BODY4;
-          for (Index_type k = n-2; k >= 1; --k) {
-            POLYBENCH_ADI_BODY5;
+        } else {
+          #pragma omp target is_device_ptr(P,Q,U,V) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY2;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY3;
+            }
+            POLYBENCH_ADI_BODY4;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY5;
+            }
           }
         }
 
-        #pragma omp target is_device_ptr(P,Q,U,V) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-        for (Index_type i = 1; i < n-1; ++i) {
-          POLYBENCH_ADI_BODY6;
-          for (Index_type j = 1; j < n-1; ++j) {
-            POLYBENCH_ADI_BODY7;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(P,Q,U,V) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY6;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY7;
+            }
+            POLYBENCH_ADI_BODY8;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY9;
+            }
           }
-          POLYBENCH_ADI_BODY8;
-          for (Index_type k = n-2; k >= 1; --k) {
-            POLYBENCH_ADI_BODY9;
+        } else {
+          #pragma omp target is_device_ptr(P,Q,U,V) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY6;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY7;
+            }
+            POLYBENCH_ADI_BODY8;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY9;
+            }
           }
         }
 
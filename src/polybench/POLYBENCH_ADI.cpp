@@ -45,6 +45,9 @@ POLYBENCH_ADI::POLYBENCH_ADI(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(Stencil);
+  setHasPattern(LatencyBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -53,6 +56,8 @@ POLYBENCH_ADI::POLYBENCH_ADI(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -57,6 +57,13 @@
 ///      }
 ///    }
 ///  }
+///
+/// The lines of a sweep are independent and each sweep reads all lines of
+/// the other, so the tunings parallelize the lines of each sweep: OpenMP
+/// line_batch tunings interleave the recurrences of batches of lines, GPU
+/// interleaved tunings store p and q by column, and GPU pcr tunings solve
+/// each line with a thread block, see adi_helper.hpp.
+///
 
 
 
@@ -123,6 +130,35 @@
   U[i * n + k] = P[i * n + k] * U[i * n + k +1] + Q[i * n + k];
 
 
+#define POLYBENCH_ADI_BODY2_INTERLEAVED \
+  V[0 * n + i] = 1.0; \
+  P[0 * n + i] = 0.0; \
+  Q[0 * n + i] = V[0 * n + i];
+
+#define POLYBENCH_ADI_BODY3_INTERLEAVED \
+  P[j * n + i] = -c / (a * P[(j-1) * n + i] + b); \
+  Q[j * n + i] = (-d * U[j * n + i-1] + (1.0 + 2.0*d) * U[j * n + i] - \
+                 f * U[j * n + i + 1] - a * Q[(j-1) * n + i]) / \
+                    (a * P[(j-1) * n + i] + b);
+
+#define POLYBENCH_ADI_BODY5_INTERLEAVED \
+  V[k * n + i]  = P[k * n + i] * V[(k+1) * n + i] + Q[k * n + i];
+
+#define POLYBENCH_ADI_BODY6_INTERLEAVED \
+  U[i * n + 0] = 1.0; \
+  P[0 * n + i] = 0.0; \
+  Q[0 * n + i] = U[i * n + 0];
+
+#define POLYBENCH_ADI_BODY7_INTERLEAVED \
+  P[j * n + i] = -f / (d * P[(j-1) * n + i] + e); \
+  Q[j * n + i] = (-a * V[(i-1) * n + j] + (1.0 + 2.0*a) * V[i * n + j] - \
+                 c * V[(i + 1) * n + j] - d * Q[(j-1) * n + i]) / \
+                    (d * P[(j-1) * n + i] + e);
+
+#define POLYBENCH_ADI_BODY9_INTERLEAVED \
+  U[i * n + k] = P[k * n + i] * U[i * n + k +1] + Q[k * n + i];
+
+
 #define POLYBENCH_ADI_BODY2_RAJA \
   Vview(0, i) = 1.0; \
   Pview(i, 0) = 0.0; \
@@ -196,12 +232,26 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runOpenMPVariantLineBatch(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantGraph(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantInterleaved(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantPcr(VariantID vid);
+  template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantGraph(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantInterleaved(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantPcr(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "matvec_helper.hpp"
 
 #include <iostream>
 
@@ -66,6 +67,58 @@ __global__ void poly_atax_lam(Index_type N,
 }
 
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_atax_warp_row_1(Real_ptr A, Real_ptr x, Real_ptr y,
+                                     Real_ptr tmp, Index_type N)
+{
+  constexpr size_t warps_per_block = block_size / poly_warp_size;
+  Index_type i = blockIdx.x * warps_per_block + threadIdx.x / poly_warp_size;
+
+  if (i < N) {
+    Real_type dot = poly_warp_row_sum(N, [=](Index_type j) {
+      return A[j + i*N] * x[j];
+    });
+    if (threadIdx.x % poly_warp_size == 0) {
+      y[i] = 0.0;
+      POLYBENCH_ATAX_BODY3;
+    }
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_atax_warp_row_2(Real_ptr A, Real_ptr tmp, Real_ptr y,
+                                     Index_type N)
+{
+  Index_type j = blockIdx.x * poly_column_width + threadIdx.x;
+
+  Real_type dot = poly_block_column_sum<block_size>(N, j < N,
+    [=](Index_type i) {
+      return A[j + i*N] * tmp[i];
+    });
+  if (threadIdx.y == 0 && j < N) {
+    y[j] += dot;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_atax_dual_layout_1(Real_ptr AT, Real_ptr x, Real_ptr y,
+                                        Real_ptr tmp, Index_type N)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+
+  if (i < N) {
+    POLYBENCH_ATAX_BODY1;
+    for (Index_type j = 0; j < N; ++j ) {
+      POLYBENCH_ATAX_BODY2_AT;
+    }
+    POLYBENCH_ATAX_BODY3;
+  }
+}
+
+
 template < size_t block_size >
 void POLYBENCH_ATAX::runCudaVariantImpl(VariantID vid)
 {
@@ -203,7 +256,144 @@ void POLYBENCH_ATAX::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_ATAX, Cuda)
+template < size_t block_size >
+void POLYBENCH_ATAX::runCudaVariantWarpRow(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_ATAX_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size1 =
+          RAJA_DIVIDE_CEILING_INT(N, block_size / poly_warp_size);
+      const size_t grid_size2 = RAJA_DIVIDE_CEILING_INT(N, poly_column_width);
+      const dim3 nthreads_per_block2(poly_column_width,
+                                     block_size / poly_column_width);
+      constexpr size_t shmem = 0;
+
+      poly_atax_warp_row_1<block_size><<<grid_size1, block_size, shmem, res.get_stream()>>>(A, x, y, tmp, N);
+      cudaErrchk( cudaGetLastError() );
+
+      poly_atax_warp_row_2<block_size><<<grid_size2, nthreads_per_block2, shmem, res.get_stream()>>>(A, tmp, y, N);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_ATAX : Unknown Cuda warp row variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void POLYBENCH_ATAX::runCudaVariantDualLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_ATAX_DATA_SETUP;
+  POLYBENCH_ATAX_DATA_SETUP_AT;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(N, block_size);
+      constexpr size_t shmem = 0;
+
+      poly_atax_dual_layout_1<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(AT, x, y, tmp, N);
+      cudaErrchk( cudaGetLastError() );
+
+      poly_atax_2<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(A, tmp, y, N);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_ATAX : Unknown Cuda dual layout variant id = " << vid << std::endl;
+  }
+}
+
+void POLYBENCH_ATAX::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantWarpRow<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantDualLayout<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+  }
+}
+
+void POLYBENCH_ATAX::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        addVariantTuningName(vid, "warp_row_"+std::to_string(block_size));
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "dual_layout_"+std::to_string(block_size));
+      }
+    });
+
+  }
+}
 
 } // end namespace polybench
 } // end namespace rajaperf
@@ -7,9 +7,11 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_ATAX.hpp"
+#include "matvec_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ATAX::runOpenMPVariantRowOrder(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -27,6 +29,116 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
   POLYBENCH_ATAX_DATA_SETUP;
 
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_ATAX_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY2;
+          }
+          POLYBENCH_ATAX_BODY3;
+        }
+
+        #pragma omp parallel for
+        for (Index_type j0 = 0; j0 < N; j0 += poly_row_order_chunk ) {
+          const Index_type j_end = std::min(j0 + poly_row_order_chunk, N);
+          for (Index_type i = 0; i < N; ++i ) {
+            for (Index_type j = j0; j < j_end; ++j ) {
+              POLYBENCH_ATAX_BODY5_ROW_ORDER;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ATAX : Unknown row order variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_ATAX::runOpenMPVariantDualLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_ATAX_DATA_SETUP;
+  POLYBENCH_ATAX_DATA_SETUP_AT;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_ATAX_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY2;
+          }
+          POLYBENCH_ATAX_BODY3;
+        }
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < N; ++j ) {
+          POLYBENCH_ATAX_BODY4;
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_ATAX_BODY5_AT;
+          }
+          POLYBENCH_ATAX_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ATAX : Unknown dual layout variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantRowOrder(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runOpenMPVariantDualLayout(vid);
+    return;
+  }
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_ATAX_DATA_SETUP;
+
   switch ( vid ) {
 
     case Base_OpenMP : {
@@ -188,8 +300,19 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void POLYBENCH_ATAX::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "row_order");
+    addVariantTuningName(vid, "dual_layout");
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
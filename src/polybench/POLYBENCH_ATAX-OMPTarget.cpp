@@ -29,6 +29,8 @@ namespace polybench
 void POLYBENCH_ATAX::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
 
   POLYBENCH_ATAX_DATA_SETUP;
 
@@ -37,24 +39,48 @@ void POLYBENCH_ATAX::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSE
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(x,y,tmp,A) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = 0; i < N; ++i ) {
-        POLYBENCH_ATAX_BODY1;
-        for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_ATAX_BODY2;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x,y,tmp,A) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_ATAX_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY2;
+          }
+          POLYBENCH_ATAX_BODY3;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x,y,tmp,A) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_ATAX_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY2;
+          }
+          POLYBENCH_ATAX_BODY3;
         }
-        POLYBENCH_ATAX_BODY3;
       }
 
-      #pragma omp target is_device_ptr(y,tmp,A) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type j = 0; j < N; ++j ) {
-        POLYBENCH_ATAX_BODY4;
-        for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_ATAX_BODY5;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(y,tmp,A) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type j = 0; j < N; ++j ) {
+          POLYBENCH_ATAX_BODY4;
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_ATAX_BODY5;
+          }
+          POLYBENCH_ATAX_BODY6;
+        }
+      } else {
+        #pragma omp target is_device_ptr(y,tmp,A) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type j = 0; j < N; ++j ) {
+          POLYBENCH_ATAX_BODY4;
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_ATAX_BODY5;
+          }
+          POLYBENCH_ATAX_BODY6;
         }
-        POLYBENCH_ATAX_BODY6;
       }
 
     }
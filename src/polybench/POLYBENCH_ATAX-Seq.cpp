@@ -7,6 +7,7 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_ATAX.hpp"
+#include "matvec_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -18,12 +19,105 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_ATAX::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ATAX::runSeqVariantRowOrder(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_ATAX_DATA_SETUP;
 
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_ATAX_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY2;
+          }
+          POLYBENCH_ATAX_BODY3;
+        }
+
+        for (Index_type i = 0; i < N; ++i ) {
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY5_ROW_ORDER;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ATAX : Unknown row order variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_ATAX::runSeqVariantDualLayout(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_ATAX_DATA_SETUP;
+  POLYBENCH_ATAX_DATA_SETUP_AT;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_ATAX_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY2;
+          }
+          POLYBENCH_ATAX_BODY3;
+        }
+
+        for (Index_type j = 0; j < N; ++j ) {
+          POLYBENCH_ATAX_BODY4;
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_ATAX_BODY5_AT;
+          }
+          POLYBENCH_ATAX_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ATAX : Unknown dual layout variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_ATAX::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 1 ) {
+    runSeqVariantRowOrder(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runSeqVariantDualLayout(vid);
+    return;
+  }
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_ATAX_DATA_SETUP;
+
   switch ( vid ) {
 
     case Base_Seq : {
@@ -185,5 +279,15 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
 }
 
+void POLYBENCH_ATAX::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "row_order");
+    addVariantTuningName(vid, "dual_layout");
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -7,6 +7,7 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_ATAX.hpp"
+#include "matvec_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
@@ -28,6 +29,8 @@ POLYBENCH_ATAX::POLYBENCH_ATAX(const RunParams& params)
 
   m_N = std::sqrt( getTargetProblemSize() )+1;
 
+  m_AT = nullptr;
+
 
   setActualProblemSize( m_N * m_N );
 
@@ -47,6 +50,8 @@ POLYBENCH_ATAX::POLYBENCH_ATAX(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(Streaming);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -55,6 +60,8 @@ POLYBENCH_ATAX::POLYBENCH_ATAX(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -71,13 +78,24 @@ POLYBENCH_ATAX::~POLYBENCH_ATAX()
 {
 }
 
-void POLYBENCH_ATAX::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+bool POLYBENCH_ATAX::usesDualLayout(VariantID vid, size_t tune_idx) const
+{
+  return poly_is_dual_layout_tuning(getVariantTuningName(vid, tune_idx));
+}
+
+void POLYBENCH_ATAX::setUp(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   allocAndInitData(m_tmp, m_N, vid);
   allocAndInitData(m_x, m_N, vid);
   allocAndInitData(m_A, m_N * m_N, vid);
   allocAndInitDataConst(m_y, m_N, 0.0, vid);
+
+  if ( usesDualLayout(vid, tune_idx) ) {
+    allocData(m_AT, m_N * m_N, vid);
+    auto reset_A = scopedMoveData(m_A, m_N * m_N, vid);
+    auto reset_AT = scopedMoveData(m_AT, m_N * m_N, vid);
+    poly_transpose(m_AT, m_A, m_N);
+  }
 }
 
 void POLYBENCH_ATAX::updateChecksum(VariantID vid, size_t tune_idx)
@@ -85,13 +103,15 @@ void POLYBENCH_ATAX::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid][tune_idx] += calcChecksum(m_y, m_N, checksum_scale_factor , vid);
 }
 
-void POLYBENCH_ATAX::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ATAX::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   deallocData(m_tmp, vid);
   deallocData(m_x, vid);
   deallocData(m_y, vid);
   deallocData(m_A, vid);
+  if ( usesDualLayout(vid, tune_idx) ) {
+    deallocData(m_AT, vid);
+  }
 }
 
 } // end namespace polybench
@@ -21,6 +21,12 @@
 ///     y[j] += A[i][j] * tmp[i];
 ///   }
 /// }
+///
+/// The second product reads A by column. The row_order tunings run it with
+/// the loop over i outside and the dual_layout tunings run it over a copy
+/// AT of A transposed in setUp, GPU warp_row tunings sum each row with a
+/// warp and each column with a block, see matvec_helper.hpp.
+///
 
 
 #ifndef RAJAPerf_POLYBENCH_ATAX_HPP
@@ -34,6 +40,9 @@
 \
   const Index_type N = m_N;
 
+#define POLYBENCH_ATAX_DATA_SETUP_AT \
+  Real_ptr AT = m_AT;
+
 
 #define POLYBENCH_ATAX_BODY1 \
   y[i] = 0.0; \
@@ -54,6 +63,15 @@
 #define POLYBENCH_ATAX_BODY6 \
   y[j] = dot;
 
+#define POLYBENCH_ATAX_BODY5_ROW_ORDER \
+  y[j] += A[j + i*N] * tmp[i];
+
+#define POLYBENCH_ATAX_BODY2_AT \
+  dot += AT[i + j*N] * x[j];
+
+#define POLYBENCH_ATAX_BODY5_AT \
+  dot += AT[i + j*N] * tmp[i];
+
 
 #define POLYBENCH_ATAX_BODY1_RAJA \
   yview(i) = 0.0; \
@@ -116,14 +134,30 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantRowOrder(VariantID vid);
+  void runSeqVariantDualLayout(VariantID vid);
+  void runOpenMPVariantRowOrder(VariantID vid);
+  void runOpenMPVariantDualLayout(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpRow(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpRow(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantDualLayout(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantDualLayout(VariantID vid);
 
 private:
+  bool usesDualLayout(VariantID vid, size_t tune_idx) const;
+
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
@@ -132,6 +166,7 @@ private:
   Real_ptr m_y;
   Real_ptr m_x;
   Real_ptr m_A;
+  Real_ptr m_AT;
 };
 
 } // end namespace polybench
@@ -0,0 +1,177 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_CHOLESKY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+void POLYBENCH_CHOLESKY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_CHOLESKY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n*n; ++i ) {
+          POLYBENCH_CHOLESKY_BODY1;
+        }
+
+        for (Index_type k = 0; k < n-1; ++k) {
+          #pragma omp parallel for
+          for (Index_type i = k+1; i < n; ++i ) {
+            POLYBENCH_CHOLESKY_BODY2;
+          }
+
+          #pragma omp parallel for
+          for (Index_type i = k+1; i < n; ++i ) {
+            for (Index_type j = k+1; j < i+1; ++j ) {
+              POLYBENCH_CHOLESKY_BODY3;
+            }
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; ++i ) {
+          POLYBENCH_CHOLESKY_BODY4;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        auto poly_cholesky_copy_base_lam = [=](Index_type i) {
+          POLYBENCH_CHOLESKY_BODY1;
+        };
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n*n; ++i ) {
+          poly_cholesky_copy_base_lam(i);
+        }
+
+        for (Index_type k = 0; k < n-1; ++k) {
+          auto poly_cholesky_scale_base_lam = [=](Index_type i) {
+            POLYBENCH_CHOLESKY_BODY2;
+          };
+
+          #pragma omp parallel for
+          for (Index_type i = k+1; i < n; ++i ) {
+            poly_cholesky_scale_base_lam(i);
+          }
+
+          auto poly_cholesky_update_base_lam = [=](Index_type i, Index_type j) {
+            POLYBENCH_CHOLESKY_BODY3;
+          };
+
+          #pragma omp parallel for
+          for (Index_type i = k+1; i < n; ++i ) {
+            for (Index_type j = k+1; j < i+1; ++j ) {
+              poly_cholesky_update_base_lam(i, j);
+            }
+          }
+        }
+
+        auto poly_cholesky_sqrt_base_lam = [=](Index_type i) {
+          POLYBENCH_CHOLESKY_BODY4;
+        };
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; ++i ) {
+          poly_cholesky_sqrt_base_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_CHOLESKY_VIEWS_RAJA;
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<1, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>( RAJA::RangeSegment{0, n*n},
+          [=](Index_type i) {
+            POLYBENCH_CHOLESKY_BODY1_RAJA;
+        });
+
+        for (Index_type k = 0; k < n-1; ++k) {
+          RAJA::forall<RAJA::omp_parallel_for_exec>( RAJA::RangeSegment{k+1, n},
+            [=](Index_type i) {
+              POLYBENCH_CHOLESKY_BODY2_RAJA;
+          });
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{k+1, n},
+                                                   RAJA::RangeSegment{k+1, n}),
+            [=](Index_type i, Index_type j) {
+              if (j <= i) {
+                POLYBENCH_CHOLESKY_BODY3_RAJA;
+              }
+            }
+          );
+        }
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>( RAJA::RangeSegment{0, n},
+          [=](Index_type i) {
+            POLYBENCH_CHOLESKY_BODY4_RAJA;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_CHOLESKY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
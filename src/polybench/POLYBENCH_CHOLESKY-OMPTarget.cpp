@@ -0,0 +1,152 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_CHOLESKY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+  //
+  // Define threads per team for target execution
+  //
+  const size_t threads_per_team = 256;
+
+void POLYBENCH_CHOLESKY::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
+
+  POLYBENCH_CHOLESKY_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(A,L) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n*n; ++i ) {
+          POLYBENCH_CHOLESKY_BODY1;
+        }
+      } else {
+        #pragma omp target is_device_ptr(A,L) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n*n; ++i ) {
+          POLYBENCH_CHOLESKY_BODY1;
+        }
+      }
+
+      for (Index_type k = 0; k < n-1; ++k) {
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(A,L) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = k+1; i < n; ++i ) {
+            POLYBENCH_CHOLESKY_BODY2;
+          }
+        } else {
+          #pragma omp target is_device_ptr(A,L) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = k+1; i < n; ++i ) {
+            POLYBENCH_CHOLESKY_BODY2;
+          }
+        }
+
+        #pragma omp target is_device_ptr(A,L) device( did )
+        #pragma omp teams distribute parallel for schedule(static, 1) collapse(2)
+        for (Index_type i = k+1; i < n; ++i ) {
+          for (Index_type j = k+1; j < n; ++j ) {
+            if (j <= i) {
+              POLYBENCH_CHOLESKY_BODY3;
+            }
+          }
+        }
+      }
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(A,L) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n; ++i ) {
+          POLYBENCH_CHOLESKY_BODY4;
+        }
+      } else {
+        #pragma omp target is_device_ptr(A,L) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n; ++i ) {
+          POLYBENCH_CHOLESKY_BODY4;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    POLYBENCH_CHOLESKY_VIEWS_RAJA;
+
+    using EXEC_POL =
+      RAJA::KernelPolicy<
+        RAJA::statement::Collapse<RAJA::omp_target_parallel_collapse_exec,
+                                  RAJA::ArgList<0, 1>,
+          RAJA::statement::Lambda<0>
+        >
+      >;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+        RAJA::RangeSegment{0, n*n}, [=] (Index_type i) {
+          POLYBENCH_CHOLESKY_BODY1_RAJA;
+      });
+
+      for (Index_type k = 0; k < n-1; ++k) {
+        RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment{k+1, n}, [=] (Index_type i) {
+            POLYBENCH_CHOLESKY_BODY2_RAJA;
+        });
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{k+1, n},
+                                                 RAJA::RangeSegment{k+1, n}),
+          [=] (Index_type i, Index_type j) {
+            if (j <= i) {
+              POLYBENCH_CHOLESKY_BODY3_RAJA;
+            }
+          }
+        );
+      }
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+        RAJA::RangeSegment{0, n}, [=] (Index_type i) {
+          POLYBENCH_CHOLESKY_BODY4_RAJA;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_CHOLESKY : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_CHOLESKY kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; i++) {
+///   for (Index_type j = 0; j < i; j++) {
+///     for (Index_type k = 0; k < j; k++) {
+///       A[i][j] -= A[i][k] * A[j][k];
+///     }
+///     A[i][j] /= A[j][j];
+///   }
+///   for (Index_type k = 0; k < i; k++) {
+///     A[i][i] -= A[i][k] * A[i][k];
+///   }
+///   A[i][i] = sqrt(A[i][i]);
+/// }
+///
+/// Here the symmetric positive definite A is copied to L, whose lower
+/// triangle is factored in place in right looking order: for each k the
+/// column below the diagonal is scaled, then the lower triangle of the
+/// trailing submatrix is updated. The diagonal keeps the updated pivots
+/// until a last loop takes their square roots.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_CHOLESKY_HPP
+#define RAJAPerf_POLYBENCH_CHOLESKY_HPP
+
+#define POLYBENCH_CHOLESKY_DATA_SETUP \
+  const Index_type n = m_n; \
+\
+  Real_ptr A = m_A; \
+  Real_ptr L = m_L;
+
+
+#define POLYBENCH_CHOLESKY_BODY1 \
+  L[i] = A[i];
+
+#define POLYBENCH_CHOLESKY_BODY2 \
+  L[k + i*n] /= sqrt(L[k + k*n]);
+
+#define POLYBENCH_CHOLESKY_BODY3 \
+  L[j + i*n] -= L[k + i*n] * L[k + j*n];
+
+#define POLYBENCH_CHOLESKY_BODY4 \
+  L[i + i*n] = sqrt(L[i + i*n]);
+
+
+#define POLYBENCH_CHOLESKY_BODY1_RAJA \
+  L[i] = A[i];
+
+#define POLYBENCH_CHOLESKY_BODY2_RAJA \
+  Lview(i, k) /= sqrt(Lview(k, k));
+
+#define POLYBENCH_CHOLESKY_BODY3_RAJA \
+  Lview(i, j) -= Lview(i, k) * Lview(j, k);
+
+#define POLYBENCH_CHOLESKY_BODY4_RAJA \
+  Lview(i, i) = sqrt(Lview(i, i));
+
+
+#define POLYBENCH_CHOLESKY_VIEWS_RAJA \
+  using VIEW_TYPE = RAJA::View<Real_type, \
+                               RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE Lview(L, RAJA::Layout<2>(n, n));
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_CHOLESKY : public KernelBase
+{
+public:
+
+  POLYBENCH_CHOLESKY(const RunParams& params);
+
+  ~POLYBENCH_CHOLESKY();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+
+  Index_type m_n;
+
+  Real_ptr m_A;
+  Real_ptr m_L;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,253 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_COVARIANCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Define thread block shape for CUDA execution
+//
+#define j_block_sz (32)
+#define i_block_sz (block_size / j_block_sz)
+
+#define POLY_COVARIANCE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA \
+  j_block_sz, i_block_sz
+
+#define POLY_COVARIANCE_THREADS_PER_BLOCK_CUDA \
+  dim3 nthreads_per_block(POLY_COVARIANCE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA, 1);
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_covariance_mean(Real_ptr mean, Real_ptr data,
+                                     Real_type float_n, Index_type m,
+                                     Index_type n,
+                                     Index_type jbegin, Index_type jend)
+{
+  Index_type j = jbegin + blockIdx.x * block_size + threadIdx.x;
+
+  if (j < jend) {
+    POLYBENCH_COVARIANCE_BODY1;
+  }
+}
+
+template < size_t j_block_size, size_t i_block_size >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_covariance_center(Real_ptr data, Real_ptr mean,
+                                       Index_type m,
+                                       Index_type ibegin, Index_type iend,
+                                       Index_type jbegin, Index_type jend)
+{
+  Index_type i = ibegin + blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = jbegin + blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < iend && j < jend ) {
+    POLYBENCH_COVARIANCE_BODY2;
+  }
+}
+
+template < size_t j_block_size, size_t i_block_size >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_covariance_cov(Real_ptr cov, Real_ptr data,
+                                    Real_type float_n, Index_type m,
+                                    Index_type n,
+                                    Index_type ibegin, Index_type iend,
+                                    Index_type jbegin, Index_type jend)
+{
+  Index_type i = ibegin + blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = jbegin + blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < iend && j < jend && j >= i ) {
+    POLYBENCH_COVARIANCE_BODY3;
+  }
+}
+
+template < size_t block_size, typename Lambda >
+__launch_bounds__(block_size)
+__global__ void poly_covariance_lam(Index_type ibegin, Index_type iend,
+                                    Lambda body)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+
+  if (i < iend) {
+    body(i);
+  }
+}
+
+template < size_t j_block_size, size_t i_block_size, typename Lambda >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_covariance_lam_2d(Index_type ibegin, Index_type iend,
+                                       Index_type jbegin, Index_type jend,
+                                       Lambda body)
+{
+  Index_type i = ibegin + blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = jbegin + blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < iend && j < jend ) {
+    body(i, j);
+  }
+}
+
+
+template < size_t block_size >
+void POLYBENCH_COVARIANCE::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_COVARIANCE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      POLY_COVARIANCE_THREADS_PER_BLOCK_CUDA;
+      constexpr size_t shmem = 0;
+
+      const size_t grid_size_mean = RAJA_DIVIDE_CEILING_INT(m, block_size);
+      poly_covariance_mean<block_size><<<grid_size_mean, block_size, shmem, res.get_stream()>>>(mean, data, float_n, m, n,
+                           0, m);
+      cudaErrchk( cudaGetLastError() );
+
+      dim3 nblocks_center(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(m, j_block_sz)),
+                          static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n, i_block_sz)),
+                          static_cast<size_t>(1));
+      poly_covariance_center<POLY_COVARIANCE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+                            <<<nblocks_center, nthreads_per_block, shmem, res.get_stream()>>>(data, mean, m,
+                               0, n,
+                               0, m);
+      cudaErrchk( cudaGetLastError() );
+
+      dim3 nblocks_cov(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(m, j_block_sz)),
+                       static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(m, i_block_sz)),
+                       static_cast<size_t>(1));
+      poly_covariance_cov<POLY_COVARIANCE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+                         <<<nblocks_cov, nthreads_per_block, shmem, res.get_stream()>>>(cov, data, float_n, m, n,
+                            0, m,
+                            0, m);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      POLY_COVARIANCE_THREADS_PER_BLOCK_CUDA;
+      constexpr size_t shmem = 0;
+
+      const size_t grid_size_mean = RAJA_DIVIDE_CEILING_INT(m, block_size);
+      poly_covariance_lam<block_size><<<grid_size_mean, block_size, shmem, res.get_stream()>>>(0, m,
+        [=] __device__ (Index_type j) {
+          POLYBENCH_COVARIANCE_BODY1;
+        }
+      );
+      cudaErrchk( cudaGetLastError() );
+
+      dim3 nblocks_center(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(m, j_block_sz)),
+                          static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n, i_block_sz)),
+                          static_cast<size_t>(1));
+      poly_covariance_lam_2d<POLY_COVARIANCE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+                            <<<nblocks_center, nthreads_per_block, shmem, res.get_stream()>>>(
+        0, n, 0, m,
+        [=] __device__ (Index_type i, Index_type j) {
+          POLYBENCH_COVARIANCE_BODY2;
+        }
+      );
+      cudaErrchk( cudaGetLastError() );
+
+      dim3 nblocks_cov(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(m, j_block_sz)),
+                       static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(m, i_block_sz)),
+                       static_cast<size_t>(1));
+      poly_covariance_lam_2d<POLY_COVARIANCE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+                            <<<nblocks_cov, nthreads_per_block, shmem, res.get_stream()>>>(
+        0, m, 0, m,
+        [=] __device__ (Index_type i, Index_type j) {
+          if (j >= i) {
+            POLYBENCH_COVARIANCE_BODY3;
+          }
+        }
+      );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    POLYBENCH_COVARIANCE_VIEWS_RAJA;
+
+    using EXEC_POL_1D = RAJA::cuda_exec<block_size, true /*async*/>;
+
+    using EXEC_POL =
+      RAJA::KernelPolicy<
+        RAJA::statement::CudaKernelFixedAsync<i_block_sz * j_block_sz,
+          RAJA::statement::For<0, RAJA::cuda_global_size_y_direct<i_block_sz>,   // i
+            RAJA::statement::For<1, RAJA::cuda_global_size_x_direct<j_block_sz>, // j
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<EXEC_POL_1D>( res, RAJA::RangeSegment{0, m},
+        [=] __device__ (Index_type j) {
+          POLYBENCH_COVARIANCE_BODY1_RAJA;
+      });
+
+      RAJA::kernel_resource<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{0, n},
+                                                        RAJA::RangeSegment{0, m}),
+                                       res,
+        [=] __device__ (Index_type i, Index_type j) {
+          POLYBENCH_COVARIANCE_BODY2_RAJA;
+        }
+      );
+
+      RAJA::kernel_resource<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{0, m},
+                                                        RAJA::RangeSegment{0, m}),
+                                       res,
+        [=] __device__ (Index_type i, Index_type j) {
+          if (j >= i) {
+            POLYBENCH_COVARIANCE_BODY3_RAJA;
+          }
+        }
+      );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_COVARIANCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_COVARIANCE, Cuda)
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_COVARIANCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+void POLYBENCH_COVARIANCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_COVARIANCE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < m; ++j ) {
+          POLYBENCH_COVARIANCE_BODY1;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; ++i ) {
+          for (Index_type j = 0; j < m; ++j ) {
+            POLYBENCH_COVARIANCE_BODY2;
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < m; ++i ) {
+          for (Index_type j = i; j < m; ++j ) {
+            POLYBENCH_COVARIANCE_BODY3;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        auto poly_covariance_mean_base_lam = [=](Index_type j) {
+          POLYBENCH_COVARIANCE_BODY1;
+        };
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < m; ++j ) {
+          poly_covariance_mean_base_lam(j);
+        }
+
+        auto poly_covariance_center_base_lam = [=](Index_type i, Index_type j) {
+          POLYBENCH_COVARIANCE_BODY2;
+        };
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; ++i ) {
+          for (Index_type j = 0; j < m; ++j ) {
+            poly_covariance_center_base_lam(i, j);
+          }
+        }
+
+        auto poly_covariance_cov_base_lam = [=](Index_type i, Index_type j) {
+          POLYBENCH_COVARIANCE_BODY3;
+        };
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < m; ++i ) {
+          for (Index_type j = i; j < m; ++j ) {
+            poly_covariance_cov_base_lam(i, j);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_COVARIANCE_VIEWS_RAJA;
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<1, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>( RAJA::RangeSegment{0, m},
+          [=](Index_type j) {
+            POLYBENCH_COVARIANCE_BODY1_RAJA;
+        });
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{0, n},
+                                                 RAJA::RangeSegment{0, m}),
+          [=](Index_type i, Index_type j) {
+            POLYBENCH_COVARIANCE_BODY2_RAJA;
+          }
+        );
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{0, m},
+                                                 RAJA::RangeSegment{0, m}),
+          [=](Index_type i, Index_type j) {
+            if (j >= i) {
+              POLYBENCH_COVARIANCE_BODY3_RAJA;
+            }
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_COVARIANCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_COVARIANCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+void POLYBENCH_COVARIANCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_COVARIANCE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type j = 0; j < m; ++j ) {
+          POLYBENCH_COVARIANCE_BODY1;
+        }
+
+        for (Index_type i = 0; i < n; ++i ) {
+          for (Index_type j = 0; j < m; ++j ) {
+            POLYBENCH_COVARIANCE_BODY2;
+          }
+        }
+
+        for (Index_type i = 0; i < m; ++i ) {
+          for (Index_type j = i; j < m; ++j ) {
+            POLYBENCH_COVARIANCE_BODY3;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        auto poly_covariance_mean_base_lam = [=](Index_type j) {
+          POLYBENCH_COVARIANCE_BODY1;
+        };
+
+        for (Index_type j = 0; j < m; ++j ) {
+          poly_covariance_mean_base_lam(j);
+        }
+
+        auto poly_covariance_center_base_lam = [=](Index_type i, Index_type j) {
+          POLYBENCH_COVARIANCE_BODY2;
+        };
+
+        for (Index_type i = 0; i < n; ++i ) {
+          for (Index_type j = 0; j < m; ++j ) {
+            poly_covariance_center_base_lam(i, j);
+          }
+        }
+
+        auto poly_covariance_cov_base_lam = [=](Index_type i, Index_type j) {
+          POLYBENCH_COVARIANCE_BODY3;
+        };
+
+        for (Index_type i = 0; i < m; ++i ) {
+          for (Index_type j = i; j < m; ++j ) {
+            poly_covariance_cov_base_lam(i, j);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      POLYBENCH_COVARIANCE_VIEWS_RAJA;
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::seq_exec,
+            RAJA::statement::For<1, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>( RAJA::RangeSegment{0, m},
+          [=](Index_type j) {
+            POLYBENCH_COVARIANCE_BODY1_RAJA;
+        });
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{0, n},
+                                                 RAJA::RangeSegment{0, m}),
+          [=](Index_type i, Index_type j) {
+            POLYBENCH_COVARIANCE_BODY2_RAJA;
+          }
+        );
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{0, m},
+                                                 RAJA::RangeSegment{0, m}),
+          [=](Index_type i, Index_type j) {
+            if (j >= i) {
+              POLYBENCH_COVARIANCE_BODY3_RAJA;
+            }
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  POLYBENCH_COVARIANCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_COVARIANCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_COVARIANCE::POLYBENCH_COVARIANCE(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_COVARIANCE, params)
+{
+  Index_type m_default = 1000;
+  Index_type n_default = 1000;
+
+  setDefaultProblemSize( m_default * m_default );
+  setDefaultReps(4);
+
+  m_m = std::sqrt( getTargetProblemSize() ) + 1;
+  m_n = n_default;
+
+  m_float_n = static_cast<Real_type>(m_n);
+
+
+  setActualProblemSize( m_m * m_m );
+
+  setItsPerRep( m_m +
+                m_n * m_m +
+                m_m * (m_m+1) / 2 );
+  setKernelsPerRep(3);
+  setBytesPerRep( (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_m +
+                  (1*sizeof(Real_type ) + 0*sizeof(Real_type )) * m_m +
+
+                  (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_m +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_m +
+
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_m +
+                  (1*sizeof(Real_type ) + 0*sizeof(Real_type )) * m_m * m_m );
+  setFLOPsPerRep((m_n + 1) * m_m +
+                 m_n * m_m +
+                 (2 * m_n + 1) * m_m * (m_m+1) / 2);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+  setUsesFeature(Forall);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+POLYBENCH_COVARIANCE::~POLYBENCH_COVARIANCE()
+{
+}
+
+void POLYBENCH_COVARIANCE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  allocAndInitData(m_data, m_n * m_m, vid);
+  allocAndInitDataConst(m_mean, m_m, 0.0, vid);
+  allocAndInitDataConst(m_cov, m_m * m_m, 0.0, vid);
+}
+
+void POLYBENCH_COVARIANCE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_cov, m_m * m_m, checksum_scale_factor , vid);
+}
+
+void POLYBENCH_COVARIANCE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_data, vid);
+  deallocData(m_mean, vid);
+  deallocData(m_cov, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
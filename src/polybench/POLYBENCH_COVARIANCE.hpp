@@ -0,0 +1,156 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_COVARIANCE kernel reference implementation:
+///
+/// for (Index_type j = 0; j < M; j++) {
+///   mean[j] = 0.0;
+///   for (Index_type i = 0; i < N; i++) {
+///     mean[j] += data[i][j];
+///   }
+///   mean[j] /= float_n;
+/// }
+/// for (Index_type i = 0; i < N; i++) {
+///   for (Index_type j = 0; j < M; j++) {
+///     data[i][j] -= mean[j];
+///   }
+/// }
+/// for (Index_type i = 0; i < M; i++) {
+///   for (Index_type j = i; j < M; j++) {
+///     cov[i][j] = 0.0;
+///     for (Index_type k = 0; k < N; k++) {
+///       cov[i][j] += data[k][i] * data[k][j];
+///     }
+///     cov[i][j] /= (float_n - 1.0);
+///     cov[j][i] = cov[i][j];
+///   }
+/// }
+///
+/// GPU and RAJA variants run the square of i, j for the last loop and skip
+/// the entries below the diagonal.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_COVARIANCE_HPP
+#define RAJAPerf_POLYBENCH_COVARIANCE_HPP
+
+#define POLYBENCH_COVARIANCE_DATA_SETUP \
+  const Index_type m = m_m; \
+  const Index_type n = m_n; \
+\
+  Real_type float_n = m_float_n; \
+\
+  Real_ptr data = m_data; \
+  Real_ptr mean = m_mean; \
+  Real_ptr cov = m_cov;
+
+
+#define POLYBENCH_COVARIANCE_BODY1 \
+  Real_type sum = 0.0; \
+  for (Index_type i = 0; i < n; ++i) { \
+    sum += data[j + i*m]; \
+  } \
+  mean[j] = sum / float_n;
+
+#define POLYBENCH_COVARIANCE_BODY2 \
+  data[j + i*m] -= mean[j];
+
+#define POLYBENCH_COVARIANCE_BODY3 \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < n; ++k) { \
+    dot += data[i + k*m] * data[j + k*m]; \
+  } \
+  cov[j + i*m] = dot / (float_n - 1.0); \
+  cov[i + j*m] = cov[j + i*m];
+
+
+#define POLYBENCH_COVARIANCE_BODY1_RAJA \
+  Real_type sum = 0.0; \
+  for (Index_type i = 0; i < n; ++i) { \
+    sum += dataview(i, j); \
+  } \
+  meanview(j) = sum / float_n;
+
+#define POLYBENCH_COVARIANCE_BODY2_RAJA \
+  dataview(i, j) -= meanview(j);
+
+#define POLYBENCH_COVARIANCE_BODY3_RAJA \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < n; ++k) { \
+    dot += dataview(k, i) * dataview(k, j); \
+  } \
+  covview(i, j) = dot / (float_n - 1.0); \
+  covview(j, i) = covview(i, j);
+
+
+#define POLYBENCH_COVARIANCE_VIEWS_RAJA \
+  using VIEW_1 = RAJA::View<Real_type, \
+                            RAJA::Layout<1, Index_type, 0>>; \
+\
+  using VIEW_2 = RAJA::View<Real_type, \
+                            RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_1 meanview(mean, RAJA::Layout<1>(m)); \
+  VIEW_2 dataview(data, RAJA::Layout<2>(n, m)); \
+  VIEW_2 covview(cov, RAJA::Layout<2>(m, m));
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_COVARIANCE : public KernelBase
+{
+public:
+
+  POLYBENCH_COVARIANCE(const RunParams& params);
+
+  ~POLYBENCH_COVARIANCE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+
+  Index_type m_m;
+  Index_type m_n;
+
+  Real_type m_float_n;
+  Real_ptr m_data;
+  Real_ptr m_mean;
+  Real_ptr m_cov;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -308,7 +308,177 @@ void POLYBENCH_FDTD_2D::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_FDTD_2D, Hip)
+template < size_t block_size >
+void POLYBENCH_FDTD_2D::runHipVariantGraph(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_FDTD_2D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    hipGraphExec_t graph_exec = detail::captureHipGraph(res.get_stream(), [&]() {
+
+      for (t = 0; t < tsteps; ++t) {
+
+        constexpr size_t shmem = 0;
+
+        const size_t grid_size1 = RAJA_DIVIDE_CEILING_INT(ny, block_size);
+        hipLaunchKernelGGL((poly_fdtd2d_1<block_size>),
+                           dim3(grid_size1), dim3(block_size), shmem, res.get_stream(),
+                           ey, fict, ny, t);
+        hipErrchk( hipGetLastError() );
+
+        FDTD_2D_THREADS_PER_BLOCK_HIP;
+        FDTD_2D_NBLOCKS_HIP;
+
+        hipLaunchKernelGGL((poly_fdtd2d_2<FDTD_2D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+                           dim3(nblocks234), dim3(nthreads_per_block234), shmem, res.get_stream(),
+                           ey, hz, nx, ny);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((poly_fdtd2d_3<FDTD_2D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+                           dim3(nblocks234), dim3(nthreads_per_block234), shmem, res.get_stream(),
+                           ex, hz, nx, ny);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((poly_fdtd2d_4<FDTD_2D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+                           dim3(nblocks234), dim3(nthreads_per_block234), shmem, res.get_stream(),
+                           hz, ex, ey, nx, ny);
+        hipErrchk( hipGetLastError() );
+
+      } // tstep loop
+
+    });
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipGraphLaunch( graph_exec, res.get_stream() ) );
+
+    }
+    stopTimer();
+
+    hipErrchk( hipGraphExecDestroy( graph_exec ) );
+
+  } else {
+     getCout() << "\n  POLYBENCH_FDTD_2D : Unknown Hip graph variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t j_block_size, size_t i_block_size >
+void POLYBENCH_FDTD_2D::runHipVariantShape(VariantID vid)
+{
+  constexpr size_t block_size = j_block_size*i_block_size;
+
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_FDTD_2D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (t = 0; t < tsteps; ++t) {
+
+        constexpr size_t shmem = 0;
+
+        const size_t grid_size1 = RAJA_DIVIDE_CEILING_INT(ny, block_size);
+        hipLaunchKernelGGL((poly_fdtd2d_1<block_size>),
+                           dim3(grid_size1), dim3(block_size), shmem, res.get_stream(),
+                           ey, fict, ny, t);
+        hipErrchk( hipGetLastError() );
+
+        dim3 nthreads_per_block234(j_block_size, i_block_size, 1);
+        dim3 nblocks234(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ny, j_block_size)),
+                        static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nx, i_block_size)),
+                        static_cast<size_t>(1));
+
+        hipLaunchKernelGGL((poly_fdtd2d_2<j_block_size, i_block_size>),
+                           dim3(nblocks234), dim3(nthreads_per_block234), shmem, res.get_stream(),
+                           ey, hz, nx, ny);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((poly_fdtd2d_3<j_block_size, i_block_size>),
+                           dim3(nblocks234), dim3(nthreads_per_block234), shmem, res.get_stream(),
+                           ex, hz, nx, ny);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((poly_fdtd2d_4<j_block_size, i_block_size>),
+                           dim3(nblocks234), dim3(nthreads_per_block234), shmem, res.get_stream(),
+                           hz, ex, ey, nx, ny);
+        hipErrchk( hipGetLastError() );
+
+      } // tstep loop
+
+    } // run_reps
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_FDTD_2D : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void POLYBENCH_FDTD_2D::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if (vid == Base_HIP && run_params.getGPUStream() != 0) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantGraph<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+  }
+
+  if (vid == Base_HIP) {
+    RAJAPERF_GPU_SHAPE_2D_TUNING_RUN(Hip)
+  }
+}
+
+void POLYBENCH_FDTD_2D::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if (vid == Base_HIP && run_params.getGPUStream() != 0) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "graph_"+std::to_string(block_size));
+      }
+    });
+  }
+
+  if (vid == Base_HIP) {
+    RAJAPERF_GPU_SHAPE_2D_TUNING_NAMES
+  }
+}
 
 } // end namespace polybench
 } // end namespace rajaperf
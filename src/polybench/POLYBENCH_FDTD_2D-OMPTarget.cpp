@@ -29,6 +29,8 @@ namespace polybench
 void POLYBENCH_FDTD_2D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
 
   POLYBENCH_FDTD_2D_DATA_SETUP;
 
@@ -39,10 +41,18 @@ void POLYBENCH_FDTD_2D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UN
 
       for (t = 0; t < tsteps; ++t) {
 
-        #pragma omp target is_device_ptr(ey,fict) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-        for (Index_type j = 0; j < ny; j++) {
-          POLYBENCH_FDTD_2D_BODY1;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(ey,fict) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type j = 0; j < ny; j++) {
+            POLYBENCH_FDTD_2D_BODY1;
+          }
+        } else {
+          #pragma omp target is_device_ptr(ey,fict) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type j = 0; j < ny; j++) {
+            POLYBENCH_FDTD_2D_BODY1;
+          }
         }
 
         #pragma omp target is_device_ptr(ey,hz) device( did )
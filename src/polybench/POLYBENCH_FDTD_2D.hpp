@@ -31,6 +31,9 @@
 ///     }
 ///   }
 /// }
+///
+/// The Base GPU variants also have tunings for each j by i block shape of
+/// each block size for the 2D loops, see gpu_block_shape.
 
 
 #ifndef RAJAPerf_POLYBENCH_FDTD_2D_HPP
@@ -119,7 +122,15 @@ public:
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantGraph(VariantID vid);
+  template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantGraph(VariantID vid);
+  template < size_t j_block_size, size_t i_block_size >
+  void runCudaVariantShape(VariantID vid);
+  template < size_t j_block_size, size_t i_block_size >
+  void runHipVariantShape(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -24,7 +24,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -36,24 +36,51 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_U
 
     case Base_OpenMP : {
 
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+      if (tune_idx == 0) {
 
-        for (Index_type k = 0; k < N; ++k) {
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          for (Index_type k = 0; k < N; ++k) {
 #if defined(USE_OMP_COLLAPSE)
-          #pragma omp parallel for collapse(2)
+            #pragma omp parallel for collapse(2)
 #else
-          #pragma omp parallel for
+            #pragma omp parallel for
 #endif
-          for (Index_type i = 0; i < N; ++i) {
-            for (Index_type j = 0; j < N; ++j) {
-              POLYBENCH_FLOYD_WARSHALL_BODY;
+            for (Index_type i = 0; i < N; ++i) {
+              for (Index_type j = 0; j < N; ++j) {
+                POLYBENCH_FLOYD_WARSHALL_BODY;
+              }
             }
           }
+
         }
+        stopTimer();
+
+      } else {
+
+        //
+        // One thread generates the rows of each k step as a taskloop, the
+        // implicit taskgroup of the taskloop orders the k steps.
+        //
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          #pragma omp parallel
+          #pragma omp single
+          for (Index_type k = 0; k < N; ++k) {
+            #pragma omp taskloop
+            for (Index_type i = 0; i < N; ++i) {
+              for (Index_type j = 0; j < N; ++j) {
+                POLYBENCH_FLOYD_WARSHALL_BODY;
+              }
+            }
+          }
+
+        }
+        stopTimer();
 
       }
-      stopTimer();
 
       break;
     }
@@ -142,8 +169,18 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_U
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void POLYBENCH_FLOYD_WARSHALL::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "taskloop");
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -20,6 +20,10 @@
 ///     }
 ///   }
 /// }
+///
+/// The "taskloop" tuning of the Base OpenMP variant runs the i loop of each
+/// k step as an OpenMP taskloop generated by one thread instead of a
+/// parallel for, so the thread team is created once per rep.
 
 
 #ifndef RAJAPerf_POLYBENCH_FLOYD_WARSHALL_HPP
@@ -77,6 +81,7 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -0,0 +1,148 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_INPLACE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include "tiled_floyd_warshall_helper.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Define thread block shape for CUDA execution
+//
+#define j_block_sz (32)
+#define i_block_sz (block_size / j_block_sz)
+
+#define POLY_FLOYD_WARSHALL_INPLACE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA \
+  j_block_sz, i_block_sz
+
+#define POLY_FLOYD_WARSHALL_INPLACE_THREADS_PER_BLOCK_CUDA \
+  dim3 nthreads_per_block(POLY_FLOYD_WARSHALL_INPLACE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA, 1);
+
+#define POLY_FLOYD_WARSHALL_INPLACE_NBLOCKS_CUDA \
+  dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N, j_block_sz)), \
+               static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N, i_block_sz)), \
+               static_cast<size_t>(1));
+
+
+template < size_t j_block_size, size_t i_block_size >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_floyd_warshall_inplace(Real_ptr p,
+                                            Index_type k,
+                                            Index_type N)
+{
+  Index_type i = blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < N && j < N ) {
+    POLYBENCH_FLOYD_WARSHALL_INPLACE_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_FLOYD_WARSHALL_INPLACE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemcpyAsync( p, pin, N*N*sizeof(Real_type),
+                                   cudaMemcpyDeviceToDevice, res.get_stream() ) );
+
+      for (Index_type k = 0; k < N; ++k) {
+
+        POLY_FLOYD_WARSHALL_INPLACE_THREADS_PER_BLOCK_CUDA;
+        POLY_FLOYD_WARSHALL_INPLACE_NBLOCKS_CUDA;
+        constexpr size_t shmem = 0;
+
+        poly_floyd_warshall_inplace<POLY_FLOYD_WARSHALL_INPLACE_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+                           <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(p,
+                                                             k, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_INPLACE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t tile_size, size_t reg_size >
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::runCudaVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_FLOYD_WARSHALL_INPLACE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const size_t num_tiles = static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N, tile_size));
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemcpyAsync( p, pin, N*N*sizeof(Real_type),
+                                   cudaMemcpyDeviceToDevice, res.get_stream() ) );
+
+      for (Index_type k0 = 0; k0 < N; k0 += tile_size) {
+
+        dim3 nthreads_per_block(tile_size, tile_size / reg_size, 1);
+        constexpr size_t shmem = 0;
+
+        poly_floyd_warshall_tiled_diag<tile_size, reg_size>
+                  <<<dim3(1, 1, 1), nthreads_per_block, shmem, res.get_stream()>>>(p, k0, N);
+        cudaErrchk( cudaGetLastError() );
+
+        poly_floyd_warshall_tiled_cross<tile_size, reg_size>
+                  <<<dim3(num_tiles, 2, 1), nthreads_per_block, shmem, res.get_stream()>>>(p, k0, N);
+        cudaErrchk( cudaGetLastError() );
+
+        poly_floyd_warshall_tiled_rest<tile_size, reg_size>
+                  <<<dim3(num_tiles, num_tiles, 1), nthreads_per_block, shmem, res.get_stream()>>>(p, k0, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_INPLACE : Unknown Cuda tiled variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TILE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_FLOYD_WARSHALL_INPLACE, Cuda, Base_CUDA)
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,137 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_INPLACE.hpp"
+#include "tiled_floyd_warshall_helper.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+template < Index_type tile_size >
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::runOpenMPVariantTiled(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_INPLACE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N*N; ++i) {
+          p[i] = pin[i];
+        }
+
+        poly_floyd_warshall_tiled_omp<tile_size>(p, N);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_INPLACE : Unknown tiled variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx > 0 ) {
+    size_t t = 1;
+    seq_for(cpu_tile_sizes_type{}, [&](auto tile_size) {
+      if (tune_idx == t) {
+        runOpenMPVariantTiled<tile_size>(vid);
+      }
+      t += 1;
+    });
+    return;
+  }
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_INPLACE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for
+          for (Index_type i = 0; i < N*N; ++i) {
+            p[i] = pin[i];
+          }
+
+          for (Index_type k = 0; k < N; ++k) {
+            #pragma omp for
+            for (Index_type i = 0; i < N; ++i) {
+              for (Index_type j = 0; j < N; ++j) {
+                POLYBENCH_FLOYD_WARSHALL_INPLACE_BODY;
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_INPLACE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    seq_for(cpu_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "tile_"+std::to_string(tile_size));
+    });
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
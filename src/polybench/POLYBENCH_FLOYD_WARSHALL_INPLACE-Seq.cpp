@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_INPLACE.hpp"
+#include "tiled_floyd_warshall_helper.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+template < Index_type tile_size >
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::runSeqVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_INPLACE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N*N; ++i) {
+          p[i] = pin[i];
+        }
+
+        poly_floyd_warshall_tiled_seq<tile_size>(p, N);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_INPLACE : Unknown tiled variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx > 0 ) {
+    size_t t = 1;
+    seq_for(cpu_tile_sizes_type{}, [&](auto tile_size) {
+      if (tune_idx == t) {
+        runSeqVariantTiled<tile_size>(vid);
+      }
+      t += 1;
+    });
+    return;
+  }
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_INPLACE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N*N; ++i) {
+          p[i] = pin[i];
+        }
+
+        for (Index_type k = 0; k < N; ++k) {
+          for (Index_type i = 0; i < N; ++i) {
+            for (Index_type j = 0; j < N; ++j) {
+              POLYBENCH_FLOYD_WARSHALL_INPLACE_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_INPLACE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    seq_for(cpu_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "tile_"+std::to_string(tile_size));
+    });
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_INPLACE.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_FLOYD_WARSHALL_INPLACE::POLYBENCH_FLOYD_WARSHALL_INPLACE(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_FLOYD_WARSHALL_INPLACE, params)
+{
+  Index_type N_default = 1000;
+
+  setDefaultProblemSize( N_default * N_default );
+  setDefaultReps(8);
+
+  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+
+
+  setActualProblemSize( m_N * m_N );
+
+  setItsPerRep( m_N*m_N );
+  setKernelsPerRep(1);
+  // copy of pin to p, then one read and write of p
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N +
+                  (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N );
+  setFLOPsPerRep(1 * m_N*m_N*m_N );
+
+  checksum_scale_factor = 1.0 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+POLYBENCH_FLOYD_WARSHALL_INPLACE::~POLYBENCH_FLOYD_WARSHALL_INPLACE()
+{
+}
+
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  allocAndInitDataRandValue(m_pin, m_N*m_N, vid);
+  allocAndInitDataConst(m_p, m_N*m_N, 0.0, vid);
+}
+
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_p, m_N*m_N, checksum_scale_factor , vid);
+}
+
+void POLYBENCH_FLOYD_WARSHALL_INPLACE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_pin, vid);
+  deallocData(m_p, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_FLOYD_WARSHALL_INPLACE kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N*N; i++) {
+///   p[i] = pin[i];
+/// }
+/// for (Index_type k = 0; k < N; k++) {
+///   for (Index_type i = 0; i < N; i++) {
+///     for (Index_type j = 0; j < N; j++) {
+///       p[i][j] = p[i][j] < p[i][k] + p[k][j] ?
+///                 p[i][j] : p[i][k] + p[k][j];
+///     }
+///   }
+/// }
+///
+/// This is the original Polybench kernel, which updates the path lengths
+/// in place, unlike POLYBENCH_FLOYD_WARSHALL. The edge lengths are not
+/// negative, so row k and column k do not change in step k and the i and j
+/// loops of a step can run in parallel.
+///
+/// The tile tunings run the blocked algorithm on tile_size x tile_size
+/// tiles. For each diagonal tile they update the diagonal tile, then the
+/// other tiles in its tile row and tile column, then the remaining tiles,
+/// each with the k steps of the diagonal tile. CPU variants keep the three
+/// tiles a tile update reads in cache, GPU variants in shared memory.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_FLOYD_WARSHALL_INPLACE_HPP
+#define RAJAPerf_POLYBENCH_FLOYD_WARSHALL_INPLACE_HPP
+
+#define POLYBENCH_FLOYD_WARSHALL_INPLACE_DATA_SETUP \
+  Real_ptr pin = m_pin; \
+  Real_ptr p = m_p; \
+  const Index_type N = m_N;
+
+
+#define POLYBENCH_FLOYD_WARSHALL_INPLACE_BODY \
+  p[j + i*N] = p[j + i*N] < p[k + i*N] + p[j + k*N] ? \
+               p[j + i*N] : p[k + i*N] + p[j + k*N];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_FLOYD_WARSHALL_INPLACE : public KernelBase
+{
+public:
+
+  POLYBENCH_FLOYD_WARSHALL_INPLACE(const RunParams& params);
+
+  ~POLYBENCH_FLOYD_WARSHALL_INPLACE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_INPLACE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < Index_type tile_size >
+  void runSeqVariantTiled(VariantID vid);
+  template < Index_type tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+  template < size_t tile_size, size_t reg_size >
+  void runCudaVariantTiled(VariantID vid);
+  template < size_t tile_size, size_t reg_size >
+  void runHipVariantTiled(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+  using gpu_tile_sizes_type = gpu_block_size::list_type<16, 32>;
+  using cpu_tile_sizes_type = camp::int_seq<Index_type, 32, 64, 128>;
+
+  Index_type m_N;
+
+  Real_ptr m_pin;
+  Real_ptr m_p;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -14,6 +14,10 @@
 
 #include "common/CudaDataUtils.hpp"
 
+#include "common/MmaUtils.hpp"
+
+#include "tiled_matmul_helper.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -179,7 +183,194 @@ void POLYBENCH_GEMM::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_GEMM, Cuda)
+template < size_t tile_size, size_t reg_size >
+void POLYBENCH_GEMM::runCudaVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dim3 nthreads_per_block(tile_size, tile_size / reg_size, 1);
+      constexpr size_t shmem = 0;
+
+      dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nj, tile_size)),
+                   static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, tile_size)),
+                   static_cast<size_t>(1));
+      poly_matmul_tiled<tile_size, reg_size>
+                <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(C, A, B,
+                                                   alpha, 0.0,
+                                                   ni, nj, nk);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown Cuda tiled variant id = " << vid << std::endl;
+  }
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+void POLYBENCH_GEMM::runCudaVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    cublasHandle_t handle;
+    cublasErrchk( cublasCreate(&handle) );
+    cublasErrchk( cublasSetStream(handle, res.get_stream()) );
+
+    // row major C = A B is column major C^T = B^T A^T
+    const Real_type zero = 0.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RP_USE_DOUBLE)
+      cublasErrchk( cublasDgemm(handle, CUBLAS_OP_N, CUBLAS_OP_N,
+                                nj, ni, nk,
+                                &alpha, B, nj,
+                                        A, nk,
+                                &zero,  C, nj) );
+#else
+      cublasErrchk( cublasSgemm(handle, CUBLAS_OP_N, CUBLAS_OP_N,
+                                nj, ni, nk,
+                                &alpha, B, nj,
+                                        A, nk,
+                                &zero,  C, nj) );
+#endif
+
+    }
+    stopTimer();
+
+    cublasErrchk( cublasDestroy(handle) );
+
+  } else {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown Cuda blas variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+void POLYBENCH_GEMM::runCudaVariantMma(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dim3 nblocks(static_cast<size_t>(getMmaGridSize(nj)),
+                   static_cast<size_t>(getMmaGridSize(ni)),
+                   static_cast<size_t>(1));
+      constexpr size_t shmem = 0;
+
+      gpu_matmul_mma<Real_type>
+                <<<nblocks, gpu_mma::block_size, shmem, res.get_stream()>>>(C, A, B,
+                                                   alpha, ni, nj, nk);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown Cuda mma variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+void POLYBENCH_GEMM::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_tile_sizes_type{}, [&](auto tile_size) {
+      constexpr size_t reg_size =
+          gpu_tile_size::reg_size(tile_size, default_gpu_block_size);
+      if (tune_idx == t) {
+        setBlockSize(tile_size*(tile_size/reg_size));
+        runCudaVariantTiled<tile_size, reg_size>(vid);
+      }
+      t += 1;
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    if (tune_idx == t) {
+      runCudaVariantBlas(vid);
+    }
+    t += 1;
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+    if (detail::haveCudaDoubleMma()) {
+      if (tune_idx == t) {
+        setBlockSize(gpu_mma::block_size);
+        runCudaVariantMma(vid);
+      }
+      t += 1;
+    }
+#endif
+
+  }
+}
+
+void POLYBENCH_GEMM::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, gpu_tile_size::tuning_name(tile_size,
+          gpu_tile_size::reg_size(tile_size, default_gpu_block_size)));
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    addVariantTuningName(vid, "cublas");
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+    if (detail::haveCudaDoubleMma()) {
+      addVariantTuningName(vid, "mma");
+    }
+#endif
+
+  }
+}
 
 } // end namespace polybench
 } // end namespace rajaperf
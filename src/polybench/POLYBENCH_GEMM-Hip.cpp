@@ -14,6 +14,10 @@
 
 #include "common/HipDataUtils.hpp"
 
+#include "common/MmaUtils.hpp"
+
+#include "tiled_matmul_helper.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -180,7 +184,196 @@ void POLYBENCH_GEMM::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_GEMM, Hip)
+template < size_t tile_size, size_t reg_size >
+void POLYBENCH_GEMM::runHipVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dim3 nthreads_per_block(tile_size, tile_size / reg_size, 1);
+      constexpr size_t shmem = 0;
+
+      dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(nj, tile_size)),
+                   static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(ni, tile_size)),
+                   static_cast<size_t>(1));
+      hipLaunchKernelGGL((poly_matmul_tiled<tile_size, reg_size>),
+                         dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                         C, A, B, alpha, 0.0,
+                         ni, nj, nk);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown Hip tiled variant id = " << vid << std::endl;
+  }
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+void POLYBENCH_GEMM::runHipVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    rocblas_handle handle;
+    rocblasErrchk( rocblas_create_handle(&handle) );
+    rocblasErrchk( rocblas_set_stream(handle, res.get_stream()) );
+
+    // row major C = A B is column major C^T = B^T A^T
+    const Real_type zero = 0.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(RP_USE_DOUBLE)
+      rocblasErrchk( rocblas_dgemm(handle,
+                                   rocblas_operation_none, rocblas_operation_none,
+                                   nj, ni, nk,
+                                   &alpha, B, nj,
+                                           A, nk,
+                                   &zero,  C, nj) );
+#else
+      rocblasErrchk( rocblas_sgemm(handle,
+                                   rocblas_operation_none, rocblas_operation_none,
+                                   nj, ni, nk,
+                                   &alpha, B, nj,
+                                           A, nk,
+                                   &zero,  C, nj) );
+#endif
+
+    }
+    stopTimer();
+
+    rocblasErrchk( rocblas_destroy_handle(handle) );
+
+  } else {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown Hip blas variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+void POLYBENCH_GEMM::runHipVariantMma(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dim3 nblocks(static_cast<size_t>(getMmaGridSize(nj)),
+                   static_cast<size_t>(getMmaGridSize(ni)),
+                   static_cast<size_t>(1));
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((gpu_matmul_mma<Real_type>),
+                         dim3(nblocks), dim3(gpu_mma::block_size), shmem, res.get_stream(),
+                         C, A, B, alpha, ni, nj, nk);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown Hip mma variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+void POLYBENCH_GEMM::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_tile_sizes_type{}, [&](auto tile_size) {
+      constexpr size_t reg_size =
+          gpu_tile_size::reg_size(tile_size, default_gpu_block_size);
+      if (tune_idx == t) {
+        setBlockSize(tile_size*(tile_size/reg_size));
+        runHipVariantTiled<tile_size, reg_size>(vid);
+      }
+      t += 1;
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    if (tune_idx == t) {
+      runHipVariantBlas(vid);
+    }
+    t += 1;
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+    if (detail::haveHipDoubleMma()) {
+      if (tune_idx == t) {
+        setBlockSize(gpu_mma::block_size);
+        runHipVariantMma(vid);
+      }
+      t += 1;
+    }
+#endif
+
+  }
+}
+
+void POLYBENCH_GEMM::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, gpu_tile_size::tuning_name(tile_size,
+          gpu_tile_size::reg_size(tile_size, default_gpu_block_size)));
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    addVariantTuningName(vid, "rocblas");
+#endif
+
+#if defined(RAJA_PERFSUITE_HAVE_GPU_MMA)
+    if (detail::haveHipDoubleMma()) {
+      addVariantTuningName(vid, "mma");
+    }
+#endif
+
+  }
+}
 
 } // end namespace polybench
 } // end namespace rajaperf
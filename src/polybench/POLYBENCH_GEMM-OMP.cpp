@@ -7,6 +7,7 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_GEMM.hpp"
+#include "tiled_matmul_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -19,10 +20,57 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < Index_type tile_size >
+void POLYBENCH_GEMM::runOpenMPVariantTiled(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        poly_matmul_tiled_omp<tile_size>(C, A, B, alpha, 0.0,
+                                         ni, nj, nk);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown tiled variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx > 0 ) {
+    size_t t = 1;
+    seq_for(omp_tile_sizes_type{}, [&](auto tile_size) {
+      if (tune_idx == t) {
+        runOpenMPVariantTiled<tile_size>(vid);
+      }
+      t += 1;
+    });
+    return;
+  }
+
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_GEMM_DATA_SETUP;
@@ -150,8 +198,20 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void POLYBENCH_GEMM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    seq_for(omp_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "tile_"+std::to_string(tile_size));
+    });
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SimdUtils.hpp"
+
 #include <iostream>
 
 
@@ -19,12 +21,56 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GEMM::runSeqVariantSimd(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_GEMM_DATA_SETUP;
 
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < ni; ++i ) {
+          for (Index_type j = 0; j < nj; ++j ) {
+            POLYBENCH_GEMM_BODY1;
+            POLYBENCH_GEMM_BODY2;
+            RAJAPERF_SIMD_REDUCTION(+, dot)
+            for (Index_type k = 0; k < nk; ++k ) {
+               POLYBENCH_GEMM_BODY3;
+            }
+            POLYBENCH_GEMM_BODY4;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_GEMM::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd(vid);
+    return;
+  }
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
   switch ( vid ) {
 
     case Base_Seq : {
@@ -149,5 +195,14 @@ void POLYBENCH_GEMM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
 }
 
+void POLYBENCH_GEMM::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
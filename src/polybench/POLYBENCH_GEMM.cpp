@@ -52,6 +52,8 @@ POLYBENCH_GEMM::POLYBENCH_GEMM(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(ComputeBound);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -70,6 +72,8 @@ POLYBENCH_GEMM::POLYBENCH_GEMM(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 POLYBENCH_GEMM::~POLYBENCH_GEMM()
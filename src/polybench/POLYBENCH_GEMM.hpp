@@ -19,6 +19,11 @@
 ///     C[i][j] = dot;
 ///   }
 /// }
+///
+/// Besides the block and tile tunings, the Base GPU variants have a vendor
+/// BLAS gemm tuning (cublas, rocblas) and an mma tuning on the FP64 matrix
+/// units when the device has them. These sum in a different order, so their
+/// checksums differ by rounding.
 
 
 #ifndef RAJAPerf_POLYBENCH_GEMM_HPP
@@ -99,18 +104,36 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void setKokkosTuningDefinitions(VariantID vid);
+  void runSeqVariantSimd(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < Index_type tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
+  template < size_t tile_size, size_t reg_size >
+  void runCudaVariantTiled(VariantID vid);
+  template < size_t tile_size, size_t reg_size >
+  void runHipVariantTiled(VariantID vid);
+  void runCudaVariantBlas(VariantID vid);
+  void runHipVariantBlas(VariantID vid);
+  void runCudaVariantMma(VariantID vid);
+  void runHipVariantMma(VariantID vid);
+  void runKokkosVariantImpl(VariantID vid, Index_type tile_size);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using gpu_tile_sizes_type = gpu_block_size::list_type<16, 32>;
+  using omp_tile_sizes_type = camp::int_seq<Index_type, 32, 64>;
 
   Index_type m_ni;
   Index_type m_nj;
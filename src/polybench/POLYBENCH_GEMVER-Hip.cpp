@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "matvec_helper.hpp"
 
 #include <iostream>
 
@@ -122,6 +123,77 @@ __global__ void poly_gemmver_234_lam(Index_type n, Lambda body)
 }
 
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_gemmver_warp_row_2(Real_ptr A,
+                                        Real_ptr x, Real_ptr y,
+                                        Real_type beta,
+                                        Index_type n)
+{
+  Index_type i = blockIdx.x * poly_column_width + threadIdx.x;
+
+  Real_type dot = poly_block_column_sum<block_size>(n, i < n,
+    [=](Index_type j) {
+      return beta * A[i + j*n] * y[j];
+    });
+  if (threadIdx.y == 0 && i < n) {
+    POLYBENCH_GEMVER_BODY4;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_gemmver_warp_row_4(Real_ptr A,
+                                        Real_ptr x, Real_ptr w,
+                                        Real_type alpha,
+                                        Index_type n)
+{
+  constexpr size_t warps_per_block = block_size / poly_warp_size;
+  Index_type i = blockIdx.x * warps_per_block + threadIdx.x / poly_warp_size;
+
+  if (i < n) {
+    Real_type dot = poly_warp_row_sum(n, [=](Index_type j) {
+      return alpha * A[j + i*n] * x[j];
+    });
+    if (threadIdx.x % poly_warp_size == 0) {
+      w[i] += dot;
+    }
+  }
+}
+
+template < size_t i_block_size, size_t j_block_size >
+__launch_bounds__(i_block_size*j_block_size)
+__global__ void poly_gemmver_dual_layout_1(Real_ptr AT,
+                                           Real_ptr u1, Real_ptr v1,
+                                           Real_ptr u2, Real_ptr v2,
+                                           Index_type n)
+{
+  Index_type j = blockIdx.y * j_block_size + threadIdx.y;
+  Index_type i = blockIdx.x * i_block_size + threadIdx.x;
+
+  if (i < n && j < n) {
+    POLYBENCH_GEMVER_BODY1_AT;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_gemmver_dual_layout_4(Real_ptr AT,
+                                           Real_ptr x, Real_ptr w,
+                                           Real_type alpha,
+                                           Index_type n)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < n) {
+    POLYBENCH_GEMVER_BODY6;
+    for (Index_type j = 0; j < n; ++j) {
+      POLYBENCH_GEMVER_BODY7_AT;
+    }
+    POLYBENCH_GEMVER_BODY8;
+  }
+}
+
+
 template < size_t block_size >
 void POLYBENCH_GEMVER::runHipVariantImpl(VariantID vid)
 {
@@ -312,7 +384,175 @@ void POLYBENCH_GEMVER::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_GEMVER, Hip)
+template < size_t block_size >
+void POLYBENCH_GEMVER::runHipVariantWarpRow(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_GEMVER_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      GEMVER_THREADS_PER_BLOCK_HIP;
+      GEMVER_NBLOCKS_HIP;
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((poly_gemmver_1<GEMVER_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>), dim3(nblocks1), dim3(nthreads_per_block1), shmem, res.get_stream(),
+                         A, u1, v1, u2, v2, n);
+      hipErrchk( hipGetLastError() );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(n, block_size);
+      const size_t grid_size2 = RAJA_DIVIDE_CEILING_INT(n, poly_column_width);
+      const size_t grid_size4 =
+          RAJA_DIVIDE_CEILING_INT(n, block_size / poly_warp_size);
+      const dim3 nthreads_per_block2(poly_column_width,
+                                     block_size / poly_column_width);
+
+      hipLaunchKernelGGL((poly_gemmver_warp_row_2<block_size>), dim3(grid_size2), dim3(nthreads_per_block2), shmem, res.get_stream(),
+                         A, x, y, beta, n);
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((poly_gemmver_3<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         x, z, n);
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((poly_gemmver_warp_row_4<block_size>), dim3(grid_size4), dim3(block_size), shmem, res.get_stream(),
+                         A, x, w, alpha, n);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_GEMVER : Unknown Hip warp row variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void POLYBENCH_GEMVER::runHipVariantDualLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_GEMVER_DATA_SETUP;
+  POLYBENCH_GEMVER_DATA_SETUP_AT;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      GEMVER_THREADS_PER_BLOCK_HIP;
+      GEMVER_NBLOCKS_HIP;
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((poly_gemmver_1<GEMVER_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>), dim3(nblocks1), dim3(nthreads_per_block1), shmem, res.get_stream(),
+                         A, u1, v1, u2, v2, n);
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((poly_gemmver_dual_layout_1<GEMVER_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>), dim3(nblocks1), dim3(nthreads_per_block1), shmem, res.get_stream(),
+                         AT, u1, v1, u2, v2, n);
+      hipErrchk( hipGetLastError() );
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(n, block_size);
+
+      hipLaunchKernelGGL((poly_gemmver_2<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         A, x, y, beta, n);
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((poly_gemmver_3<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         x, z, n);
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((poly_gemmver_dual_layout_4<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         AT, x, w, alpha, n);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_GEMVER : Unknown Hip dual layout variant id = " << vid << std::endl;
+  }
+}
+
+void POLYBENCH_GEMVER::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantWarpRow<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantDualLayout<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+  }
+}
+
+void POLYBENCH_GEMVER::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        addVariantTuningName(vid, "warp_row_"+std::to_string(block_size));
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "dual_layout_"+std::to_string(block_size));
+      }
+    });
+
+  }
+}
 
 } // end namespace polybench
 } // end namespace rajaperf
@@ -7,9 +7,11 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_GEMVER.hpp"
+#include "matvec_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <cstring>
 
@@ -20,7 +22,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GEMVER::runOpenMPVariantRowOrder(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -28,6 +30,154 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 
   POLYBENCH_GEMVER_DATA_SETUP;
 
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY1;
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type i0 = 0; i0 < n; i0 += poly_row_order_chunk ) {
+          const Index_type i_end = std::min(i0 + poly_row_order_chunk, n);
+          Real_type dots[poly_row_order_chunk];
+          for (Index_type i = i0; i < i_end; i++ ) {
+            dots[i - i0] = 0.0;
+          }
+          for (Index_type j = 0; j < n; j++) {
+            for (Index_type i = i0; i < i_end; i++ ) {
+              POLYBENCH_GEMVER_BODY3_ROW_ORDER;
+            }
+          }
+          for (Index_type i = i0; i < i_end; i++ ) {
+            x[i] += dots[i - i0];
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY5;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY6;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY7;
+          }
+          POLYBENCH_GEMVER_BODY8;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMVER : Unknown row order variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_GEMVER::runOpenMPVariantDualLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GEMVER_DATA_SETUP;
+  POLYBENCH_GEMVER_DATA_SETUP_AT;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY1;
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < n; j++ ) {
+          for (Index_type i = 0; i < n; i++) {
+            POLYBENCH_GEMVER_BODY1_AT;
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY2;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY3_AT;
+          }
+          POLYBENCH_GEMVER_BODY4;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY5;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY6;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY7;
+          }
+          POLYBENCH_GEMVER_BODY8;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMVER : Unknown dual layout variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantRowOrder(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runOpenMPVariantDualLayout(vid);
+    return;
+  }
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GEMVER_DATA_SETUP;
+
   switch ( vid ) {
 
     case Base_OpenMP : {
@@ -231,8 +381,19 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void POLYBENCH_GEMVER::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "row_order");
+    addVariantTuningName(vid, "dual_layout");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
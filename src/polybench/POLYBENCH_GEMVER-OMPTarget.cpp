@@ -29,6 +29,8 @@ namespace polybench
 void POLYBENCH_GEMVER::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
 
   POLYBENCH_GEMVER_DATA_SETUP;
 
@@ -45,30 +47,62 @@ void POLYBENCH_GEMVER::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNU
         }
       }
 
-      #pragma omp target is_device_ptr(A,x,y) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = 0; i < n; i++) {
-        POLYBENCH_GEMVER_BODY2;
-        for (Index_type j = 0; j < n; j++) {
-          POLYBENCH_GEMVER_BODY3;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(A,x,y) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n; i++) {
+          POLYBENCH_GEMVER_BODY2;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY3;
+          }
+          POLYBENCH_GEMVER_BODY4;
+        }
+      } else {
+        #pragma omp target is_device_ptr(A,x,y) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n; i++) {
+          POLYBENCH_GEMVER_BODY2;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY3;
+          }
+          POLYBENCH_GEMVER_BODY4;
         }
-        POLYBENCH_GEMVER_BODY4;
       }
 
-      #pragma omp target is_device_ptr(x,z) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = 0; i < n; i++) {
-        POLYBENCH_GEMVER_BODY5;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x,z) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n; i++) {
+          POLYBENCH_GEMVER_BODY5;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x,z) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n; i++) {
+          POLYBENCH_GEMVER_BODY5;
+        }
       }
 
-      #pragma omp target is_device_ptr(A,w,x) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = 0; i < n; i++) {
-        POLYBENCH_GEMVER_BODY6;
-        for (Index_type j = 0; j < n; j++) {
-          POLYBENCH_GEMVER_BODY7;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(A,w,x) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n; i++) {
+          POLYBENCH_GEMVER_BODY6;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY7;
+          }
+          POLYBENCH_GEMVER_BODY8;
+        }
+      } else {
+        #pragma omp target is_device_ptr(A,w,x) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < n; i++) {
+          POLYBENCH_GEMVER_BODY6;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY7;
+          }
+          POLYBENCH_GEMVER_BODY8;
         }
-        POLYBENCH_GEMVER_BODY8;
       }
 
     } // end run_reps
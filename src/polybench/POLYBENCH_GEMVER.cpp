@@ -7,6 +7,7 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_GEMVER.hpp"
+#include "matvec_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
@@ -31,6 +32,8 @@ POLYBENCH_GEMVER::POLYBENCH_GEMVER(const RunParams& params)
   m_alpha = 1.5;
   m_beta = 1.2;
 
+  m_AT = nullptr;
+
 
   setActualProblemSize( m_n * m_n );
 
@@ -61,6 +64,10 @@ POLYBENCH_GEMVER::POLYBENCH_GEMVER(const RunParams& params)
   setUsesFeature(Forall);
   setUsesFeature(Kernel);
 
+  setHasPattern(Streaming);
+
+  setUsesL2PersistWindow();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -69,6 +76,8 @@ POLYBENCH_GEMVER::POLYBENCH_GEMVER(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -85,10 +94,13 @@ POLYBENCH_GEMVER::~POLYBENCH_GEMVER()
 {
 }
 
-void POLYBENCH_GEMVER::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+bool POLYBENCH_GEMVER::usesDualLayout(VariantID vid, size_t tune_idx) const
 {
-  (void) vid;
+  return poly_is_dual_layout_tuning(getVariantTuningName(vid, tune_idx));
+}
 
+void POLYBENCH_GEMVER::setUp(VariantID vid, size_t tune_idx)
+{
   allocAndInitData(m_A, m_n * m_n, vid);
   allocAndInitData(m_u1, m_n, vid);
   allocAndInitData(m_v1, m_n, vid);
@@ -98,6 +110,16 @@ void POLYBENCH_GEMVER::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
   allocAndInitData(m_x, m_n, vid);
   allocAndInitData(m_y, m_n, vid);
   allocAndInitData(m_z, m_n, vid);
+
+  if ( usesDualLayout(vid, tune_idx) ) {
+    allocData(m_AT, m_n * m_n, vid);
+    auto reset_A = scopedMoveData(m_A, m_n * m_n, vid);
+    auto reset_AT = scopedMoveData(m_AT, m_n * m_n, vid);
+    poly_transpose(m_AT, m_A, m_n);
+  }
+
+  // x is read by every row of A in the last loop
+  setL2PersistWindow(m_x, m_n*sizeof(Real_type));
 }
 
 void POLYBENCH_GEMVER::updateChecksum(VariantID vid, size_t tune_idx)
@@ -105,9 +127,8 @@ void POLYBENCH_GEMVER::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid][tune_idx] += calcChecksum(m_w, m_n, checksum_scale_factor , vid);
 }
 
-void POLYBENCH_GEMVER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GEMVER::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   deallocData(m_A, vid);
   deallocData(m_u1, vid);
   deallocData(m_v1, vid);
@@ -117,6 +138,9 @@ void POLYBENCH_GEMVER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
   deallocData(m_x, vid);
   deallocData(m_y, vid);
   deallocData(m_z, vid);
+  if ( usesDualLayout(vid, tune_idx) ) {
+    deallocData(m_AT, vid);
+  }
 }
 
 } // end namespace basic
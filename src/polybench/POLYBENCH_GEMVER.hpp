@@ -35,6 +35,12 @@
 ///   }
 /// }
 ///
+/// The second loop nest reads A by column. The row_order tunings run it with
+/// the loop over j outside for chunks of i and the dual_layout tunings run
+/// it over a copy AT of A transposed in setUp and updated with A in the
+/// first loop nest, GPU warp_row tunings sum each row with a warp and each
+/// column with a block, see matvec_helper.hpp.
+///
 
 
 
@@ -56,6 +62,9 @@
 \
   const Index_type n = m_n;
 
+#define POLYBENCH_GEMVER_DATA_SETUP_AT \
+  Real_ptr AT = m_AT;
+
 
 #define POLYBENCH_GEMVER_BODY1 \
   A[j + i*n] += u1[i] * v1[j] + u2[i] * v2[j];
@@ -81,6 +90,18 @@
 #define POLYBENCH_GEMVER_BODY8 \
   w[i] = dot;
 
+#define POLYBENCH_GEMVER_BODY1_AT \
+  AT[i + j*n] += u1[i] * v1[j] + u2[i] * v2[j];
+
+#define POLYBENCH_GEMVER_BODY3_AT \
+  dot +=  beta * AT[j + i*n] * y[j];
+
+#define POLYBENCH_GEMVER_BODY3_ROW_ORDER \
+  dots[i - i0] +=  beta * A[i + j*n] * y[j];
+
+#define POLYBENCH_GEMVER_BODY7_AT \
+  dot +=  alpha * AT[i + j*n] * x[j];
+
 
 #define POLYBENCH_GEMVER_BODY1_RAJA \
   Aview(i,j) += u1view(i) * v1view(j) + u2view(i) * v2view(j);
@@ -153,14 +174,30 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantRowOrder(VariantID vid);
+  void runSeqVariantDualLayout(VariantID vid);
+  void runOpenMPVariantRowOrder(VariantID vid);
+  void runOpenMPVariantDualLayout(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpRow(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpRow(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantDualLayout(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantDualLayout(VariantID vid);
 
 private:
+  bool usesDualLayout(VariantID vid, size_t tune_idx) const;
+
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
@@ -169,6 +206,7 @@ private:
   Real_type m_alpha;
   Real_type m_beta;
   Real_ptr m_A;
+  Real_ptr m_AT;
   Real_ptr m_u1;
   Real_ptr m_v1;
   Real_ptr m_u2;
@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/BlasUtils.hpp"
+#include "matvec_helper.hpp"
 
 #include <iostream>
 
@@ -40,6 +42,30 @@ __global__ void poly_gesummv(Real_ptr x, Real_ptr y,
 }
 
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_gesummv_warp_row(Real_ptr x, Real_ptr y,
+                                      Real_ptr A, Real_ptr B,
+                                      Real_type alpha, Real_type beta,
+                                      Index_type N)
+{
+  constexpr size_t warps_per_block = block_size / poly_warp_size;
+  Index_type i = blockIdx.x * warps_per_block + threadIdx.x / poly_warp_size;
+
+  if (i < N) {
+    Real_type tmpdot = poly_warp_row_sum(N, [=](Index_type j) {
+      return A[j + i*N] * x[j];
+    });
+    Real_type ydot = poly_warp_row_sum(N, [=](Index_type j) {
+      return B[j + i*N] * x[j];
+    });
+    if (threadIdx.x % poly_warp_size == 0) {
+      POLYBENCH_GESUMMV_BODY3;
+    }
+  }
+}
+
+
 template < size_t block_size >
 void POLYBENCH_GESUMMV::runHipVariantImpl(VariantID vid)
 {
@@ -116,7 +142,138 @@ void POLYBENCH_GESUMMV::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_GESUMMV, Hip)
+template < size_t block_size >
+void POLYBENCH_GESUMMV::runHipVariantWarpRow(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_GESUMMV_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size =
+          RAJA_DIVIDE_CEILING_INT(N, block_size / poly_warp_size);
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((poly_gesummv_warp_row<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         x, y, A, B, alpha, beta, N);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_GESUMMV : Unknown Hip warp row variant id = " << vid << std::endl;
+  }
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+void POLYBENCH_GESUMMV::runHipVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_GESUMMV_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    rocblas_handle handle;
+    rocblasErrchk( rocblas_create_handle(&handle) );
+    rocblasErrchk( rocblas_set_stream(handle, res.get_stream()) );
+
+    // row major A and B are column major A^T and B^T
+    const Real_type zero = 0.0;
+    const Real_type one = 1.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      rocblasErrchk( rocblasGemv(handle, rocblas_operation_transpose, N, N,
+                                 &beta, B, x, &zero, y) );
+      rocblasErrchk( rocblasGemv(handle, rocblas_operation_transpose, N, N,
+                                 &alpha, A, x, &one, y) );
+
+    }
+    stopTimer();
+
+    rocblasErrchk( rocblas_destroy_handle(handle) );
+
+  } else {
+      getCout() << "\n  POLYBENCH_GESUMMV : Unknown Hip blas variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+void POLYBENCH_GESUMMV::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantWarpRow<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    if (tune_idx == t) {
+      runHipVariantBlas(vid);
+    }
+    t += 1;
+#endif
+
+  }
+}
+
+void POLYBENCH_GESUMMV::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        addVariantTuningName(vid, "warp_row_"+std::to_string(block_size));
+      }
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    addVariantTuningName(vid, "rocblas");
+#endif
+
+  }
+}
 
 } // end namespace polybench
 } // end namespace rajaperf
@@ -29,6 +29,8 @@ namespace polybench
 void POLYBENCH_GESUMMV::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
 
   POLYBENCH_GESUMMV_DATA_SETUP;
 
@@ -37,14 +39,26 @@ void POLYBENCH_GESUMMV::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UN
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(x, y, A, B) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = 0; i < N; ++i ) {
-        POLYBENCH_GESUMMV_BODY1;
-        for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_GESUMMV_BODY2;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x, y, A, B) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_GESUMMV_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_GESUMMV_BODY2;
+          }
+          POLYBENCH_GESUMMV_BODY3;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x, y, A, B) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_GESUMMV_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_GESUMMV_BODY2;
+          }
+          POLYBENCH_GESUMMV_BODY3;
         }
-        POLYBENCH_GESUMMV_BODY3;
       }
 
     }
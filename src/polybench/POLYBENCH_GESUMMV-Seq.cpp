@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/BlasUtils.hpp"
+
 #include <iostream>
 
 
@@ -18,8 +20,49 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+void POLYBENCH_GESUMMV::runSeqVariantCblas(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GESUMMV_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        cblasGemv(false, N, N, beta, B, x, 0.0, y);
+        cblasGemv(false, N, N, alpha, A, x, 1.0, y);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GESUMMV : Unknown cblas variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
+void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+  if ( tune_idx == 1 ) {
+    runSeqVariantCblas(vid);
+    return;
+  }
+#else
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_GESUMMV_DATA_SETUP;
@@ -131,5 +174,16 @@ void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 }
 
+void POLYBENCH_GESUMMV::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "cblas");
+  }
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
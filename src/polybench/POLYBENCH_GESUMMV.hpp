@@ -18,6 +18,13 @@
 ///   }
 ///   y[i] = alpha * tmp[i] + beta * y[i];
 /// }
+///
+/// The GPU warp_row tunings sum each row with a warp so the reads of A and B
+/// are coalesced, see matvec_helper.hpp.
+///
+/// The cblas, cublas, and rocblas tunings compute y = beta * B * x and then
+/// y += alpha * A * x with the gemv routine of the vendor BLAS library.
+///
 
 
 #ifndef RAJAPerf_POLYBENCH_GESUMMV_HPP
@@ -99,12 +106,20 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantCblas(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpRow(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpRow(VariantID vid);
+  void runCudaVariantBlas(VariantID vid);
+  void runHipVariantBlas(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
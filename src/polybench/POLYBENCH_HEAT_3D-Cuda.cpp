@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/StorageUtils.hpp"
 
 #include <iostream>
 
@@ -44,7 +45,7 @@ template < size_t k_block_size, size_t j_block_size, size_t i_block_size >
 __launch_bounds__(k_block_size*j_block_size*i_block_size)
 __global__ void poly_heat_3D_1(Real_ptr A, Real_ptr B, Index_type N)
 {
-   Index_type i = 1 + blockIdx.z;
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
    Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
    Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
 
@@ -57,7 +58,7 @@ template < size_t k_block_size, size_t j_block_size, size_t i_block_size >
 __launch_bounds__(k_block_size*j_block_size*i_block_size)
 __global__ void poly_heat_3D_2(Real_ptr A, Real_ptr B, Index_type N)
 {
-   Index_type i = 1 + blockIdx.z;
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
    Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
    Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
 
@@ -66,11 +67,65 @@ __global__ void poly_heat_3D_2(Real_ptr A, Real_ptr B, Index_type N)
    }
 }
 
+template < typename Storage_type, size_t k_block_size, size_t j_block_size, size_t i_block_size >
+__launch_bounds__(k_block_size*j_block_size*i_block_size)
+__global__ void poly_heat_3D_storage_1(Storage_type* A, Storage_type* B, Index_type N)
+{
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (i < N-1 && j < N-1 && k < N-1) {
+     POLYBENCH_HEAT_3D_STORAGE_BODY1;
+   }
+}
+
+template < typename Storage_type, size_t k_block_size, size_t j_block_size, size_t i_block_size >
+__launch_bounds__(k_block_size*j_block_size*i_block_size)
+__global__ void poly_heat_3D_storage_2(Storage_type* A, Storage_type* B, Index_type N)
+{
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (i < N-1 && j < N-1 && k < N-1) {
+     POLYBENCH_HEAT_3D_STORAGE_BODY2;
+   }
+}
+
+template < size_t k_block_size, size_t j_block_size >
+__launch_bounds__(k_block_size*j_block_size)
+__global__ void poly_heat_3D_march_1(Real_ptr A, Real_ptr B, Index_type N)
+{
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (j < N-1 && k < N-1) {
+     for (Index_type i = 1; i < N-1; ++i) {
+       POLYBENCH_HEAT_3D_BODY1;
+     }
+   }
+}
+
+template < size_t k_block_size, size_t j_block_size >
+__launch_bounds__(k_block_size*j_block_size)
+__global__ void poly_heat_3D_march_2(Real_ptr A, Real_ptr B, Index_type N)
+{
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (j < N-1 && k < N-1) {
+     for (Index_type i = 1; i < N-1; ++i) {
+       POLYBENCH_HEAT_3D_BODY2;
+     }
+   }
+}
+
 template< size_t k_block_size, size_t j_block_size, size_t i_block_size, typename Lambda >
 __launch_bounds__(k_block_size*j_block_size*i_block_size)
 __global__ void poly_heat_3D_lam(Index_type N, Lambda body)
 {
-   Index_type i = 1 + blockIdx.z;
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
    Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
    Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
 
@@ -196,7 +251,230 @@ void POLYBENCH_HEAT_3D::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_HEAT_3D, Cuda)
+template < size_t block_size >
+void POLYBENCH_HEAT_3D::runCudaVariantGraph(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    cudaGraphExec_t graph_exec = detail::captureCudaGraph(res.get_stream(), [&]() {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        HEAT_3D_THREADS_PER_BLOCK_CUDA;
+        HEAT_3D_NBLOCKS_CUDA;
+        constexpr size_t shmem = 0;
+
+        poly_heat_3D_1<HEAT_3D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+        poly_heat_3D_2<HEAT_3D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    });
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaGraphLaunch( graph_exec, res.get_stream() ) );
+
+    }
+    stopTimer();
+
+    cudaErrchk( cudaGraphExecDestroy( graph_exec ) );
+
+  } else {
+     getCout() << "\n  POLYBENCH_HEAT_3D : Unknown Cuda graph variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t k_block_size, size_t j_block_size, size_t i_block_size >
+void POLYBENCH_HEAT_3D::runCudaVariantShape(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        dim3 nthreads_per_block(k_block_size, j_block_size, i_block_size);
+        dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, k_block_size)),
+                     static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, j_block_size)),
+                     static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, i_block_size)));
+        constexpr size_t shmem = 0;
+
+        poly_heat_3D_1<k_block_size, j_block_size, i_block_size>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+        poly_heat_3D_2<k_block_size, j_block_size, i_block_size>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t k_block_size, size_t j_block_size >
+void POLYBENCH_HEAT_3D::runCudaVariantMarch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        dim3 nthreads_per_block(k_block_size, j_block_size, 1);
+        dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, k_block_size)),
+                     static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, j_block_size)),
+                     static_cast<size_t>(1));
+        constexpr size_t shmem = 0;
+
+        poly_heat_3D_march_1<k_block_size, j_block_size>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+        poly_heat_3D_march_2<k_block_size, j_block_size>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void POLYBENCH_HEAT_3D::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if (vid == Base_CUDA && run_params.getGPUStream() != 0) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantGraph<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+  }
+
+  if (vid == Base_CUDA) {
+    RAJAPERF_GPU_SHAPE_3D_TUNING_RUN(Cuda)
+  }
+}
+
+void POLYBENCH_HEAT_3D::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if (vid == Base_CUDA && run_params.getGPUStream() != 0) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "graph_"+std::to_string(block_size));
+      }
+    });
+  }
+
+  if (vid == Base_CUDA) {
+    RAJAPERF_GPU_SHAPE_3D_TUNING_NAMES
+  }
+}
+
+template < typename Storage_type >
+void POLYBENCH_HEAT_3D::runCudaVariantStorage(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_HEAT_3D_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        HEAT_3D_THREADS_PER_BLOCK_CUDA;
+        HEAT_3D_NBLOCKS_CUDA;
+        constexpr size_t shmem = 0;
+
+        poly_heat_3D_storage_1<Storage_type, HEAT_3D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+        poly_heat_3D_storage_2<Storage_type, HEAT_3D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown Cuda storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(POLYBENCH_HEAT_3D, Cuda)
 
 } // end namespace polybench
 } // end namespace rajaperf
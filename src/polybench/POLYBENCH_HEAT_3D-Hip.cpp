@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/StorageUtils.hpp"
 
 #include <iostream>
 
@@ -44,7 +45,7 @@ template < size_t k_block_size, size_t j_block_size, size_t i_block_size >
 __launch_bounds__(k_block_size*j_block_size*i_block_size)
 __global__ void poly_heat_3D_1(Real_ptr A, Real_ptr B, Index_type N)
 {
-   Index_type i = 1 + blockIdx.z;
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
    Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
    Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
 
@@ -57,7 +58,7 @@ template < size_t k_block_size, size_t j_block_size, size_t i_block_size >
 __launch_bounds__(k_block_size*j_block_size*i_block_size)
 __global__ void poly_heat_3D_2(Real_ptr A, Real_ptr B, Index_type N)
 {
-   Index_type i = 1 + blockIdx.z;
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
    Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
    Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
 
@@ -66,11 +67,65 @@ __global__ void poly_heat_3D_2(Real_ptr A, Real_ptr B, Index_type N)
    }
 }
 
+template < typename Storage_type, size_t k_block_size, size_t j_block_size, size_t i_block_size >
+__launch_bounds__(k_block_size*j_block_size*i_block_size)
+__global__ void poly_heat_3D_storage_1(Storage_type* A, Storage_type* B, Index_type N)
+{
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (i < N-1 && j < N-1 && k < N-1) {
+     POLYBENCH_HEAT_3D_STORAGE_BODY1;
+   }
+}
+
+template < typename Storage_type, size_t k_block_size, size_t j_block_size, size_t i_block_size >
+__launch_bounds__(k_block_size*j_block_size*i_block_size)
+__global__ void poly_heat_3D_storage_2(Storage_type* A, Storage_type* B, Index_type N)
+{
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (i < N-1 && j < N-1 && k < N-1) {
+     POLYBENCH_HEAT_3D_STORAGE_BODY2;
+   }
+}
+
+template < size_t k_block_size, size_t j_block_size >
+__launch_bounds__(k_block_size*j_block_size)
+__global__ void poly_heat_3D_march_1(Real_ptr A, Real_ptr B, Index_type N)
+{
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (j < N-1 && k < N-1) {
+     for (Index_type i = 1; i < N-1; ++i) {
+       POLYBENCH_HEAT_3D_BODY1;
+     }
+   }
+}
+
+template < size_t k_block_size, size_t j_block_size >
+__launch_bounds__(k_block_size*j_block_size)
+__global__ void poly_heat_3D_march_2(Real_ptr A, Real_ptr B, Index_type N)
+{
+   Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
+   Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
+
+   if (j < N-1 && k < N-1) {
+     for (Index_type i = 1; i < N-1; ++i) {
+       POLYBENCH_HEAT_3D_BODY2;
+     }
+   }
+}
+
 template< size_t k_block_size, size_t j_block_size, size_t i_block_size, typename Lambda >
 __launch_bounds__(k_block_size*j_block_size*i_block_size)
 __global__ void poly_heat_3D_lam(Index_type N, Lambda body)
 {
-   Index_type i = 1 + blockIdx.z;
+   Index_type i = 1 + blockIdx.z * i_block_size + threadIdx.z;
    Index_type j = 1 + blockIdx.y * j_block_size + threadIdx.y;
    Index_type k = 1 + blockIdx.x * k_block_size + threadIdx.x;
 
@@ -202,7 +257,238 @@ void POLYBENCH_HEAT_3D::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_HEAT_3D, Hip)
+template < size_t block_size >
+void POLYBENCH_HEAT_3D::runHipVariantGraph(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    hipGraphExec_t graph_exec = detail::captureHipGraph(res.get_stream(), [&]() {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        HEAT_3D_THREADS_PER_BLOCK_HIP;
+        HEAT_3D_NBLOCKS_HIP;
+        constexpr size_t shmem = 0;
+
+        hipLaunchKernelGGL((poly_heat_3D_1<HEAT_3D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+                           dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           A, B, N);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((poly_heat_3D_2<HEAT_3D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+                           dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           A, B, N);
+        hipErrchk( hipGetLastError() );
+
+      }
+
+    });
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipGraphLaunch( graph_exec, res.get_stream() ) );
+
+    }
+    stopTimer();
+
+    hipErrchk( hipGraphExecDestroy( graph_exec ) );
+
+  } else {
+     getCout() << "\n  POLYBENCH_HEAT_3D : Unknown Hip graph variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t k_block_size, size_t j_block_size, size_t i_block_size >
+void POLYBENCH_HEAT_3D::runHipVariantShape(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        dim3 nthreads_per_block(k_block_size, j_block_size, i_block_size);
+        dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, k_block_size)),
+                     static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, j_block_size)),
+                     static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, i_block_size)));
+        constexpr size_t shmem = 0;
+
+        hipLaunchKernelGGL((poly_heat_3D_1<k_block_size, j_block_size, i_block_size>),
+                           dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           A, B, N);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((poly_heat_3D_2<k_block_size, j_block_size, i_block_size>),
+                           dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           A, B, N);
+        hipErrchk( hipGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t k_block_size, size_t j_block_size >
+void POLYBENCH_HEAT_3D::runHipVariantMarch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        dim3 nthreads_per_block(k_block_size, j_block_size, 1);
+        dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, k_block_size)),
+                     static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, j_block_size)),
+                     static_cast<size_t>(1));
+        constexpr size_t shmem = 0;
+
+        hipLaunchKernelGGL((poly_heat_3D_march_1<k_block_size, j_block_size>),
+                           dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           A, B, N);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((poly_heat_3D_march_2<k_block_size, j_block_size>),
+                           dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           A, B, N);
+        hipErrchk( hipGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void POLYBENCH_HEAT_3D::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if (vid == Base_HIP && run_params.getGPUStream() != 0) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantGraph<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+  }
+
+  if (vid == Base_HIP) {
+    RAJAPERF_GPU_SHAPE_3D_TUNING_RUN(Hip)
+  }
+}
+
+void POLYBENCH_HEAT_3D::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if (vid == Base_HIP && run_params.getGPUStream() != 0) {
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "graph_"+std::to_string(block_size));
+      }
+    });
+  }
+
+  if (vid == Base_HIP) {
+    RAJAPERF_GPU_SHAPE_3D_TUNING_NAMES
+  }
+}
+
+template < typename Storage_type >
+void POLYBENCH_HEAT_3D::runHipVariantStorage(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_HEAT_3D_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        HEAT_3D_THREADS_PER_BLOCK_HIP;
+        HEAT_3D_NBLOCKS_HIP;
+        constexpr size_t shmem = 0;
+
+        hipLaunchKernelGGL((poly_heat_3D_storage_1<Storage_type, HEAT_3D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+                           dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           A, B, N);
+        hipErrchk( hipGetLastError() );
+
+        hipLaunchKernelGGL((poly_heat_3D_storage_2<Storage_type, HEAT_3D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+                           dim3(nblocks), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           A, B, N);
+        hipErrchk( hipGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown Hip storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(POLYBENCH_HEAT_3D, Hip)
 
 } // end namespace polybench
 } // end namespace rajaperf
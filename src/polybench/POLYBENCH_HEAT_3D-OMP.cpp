@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/StorageUtils.hpp"
+
 #include <iostream>
 
 
@@ -18,8 +20,62 @@ namespace rajaperf
 namespace polybench
 {
 
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// RAJA OpenMP kernel policies of the tunings, segments are (i, j, k).
+//
+using poly_heat3d_omp_collapse_pol =
+  RAJA::KernelPolicy<
+    RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                              RAJA::ArgList<0, 1>,
+      RAJA::statement::For<2, RAJA::seq_exec,
+        RAJA::statement::Lambda<0>
+      >
+    >
+  >;
+
+using poly_heat3d_omp_outer_pol =
+  RAJA::KernelPolicy<
+    RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<2, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >
+  >;
+
+using poly_heat3d_omp_collapse_simd_pol =
+  RAJA::KernelPolicy<
+    RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                              RAJA::ArgList<0, 1>,
+      RAJA::statement::For<2, RAJA::simd_exec,
+        RAJA::statement::Lambda<0>
+      >
+    >
+  >;
+
+template < Index_type tile_size >
+using poly_heat3d_omp_tile_pol =
+  RAJA::KernelPolicy<
+    RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+      RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::seq_exec,
+        RAJA::statement::Tile<2, RAJA::tile_fixed<tile_size>, RAJA::seq_exec,
+          RAJA::statement::For<1, RAJA::seq_exec,
+            RAJA::statement::For<2, RAJA::simd_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >
+  >;
+
+#endif
+
 
-void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -106,43 +162,29 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_HEAT_3D_VIEWS_RAJA;
+      size_t t = 0;
 
-      using EXEC_POL =
-        RAJA::KernelPolicy<
-          RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
-                                    RAJA::ArgList<0, 1>,
-            RAJA::statement::For<2, RAJA::seq_exec,
-              RAJA::statement::Lambda<0>
-            >
-          >
-        >;
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        for (Index_type t = 0; t < tsteps; ++t) {
+      if (tune_idx == t) {
+        runOpenMPVariantRAJA<poly_heat3d_omp_collapse_pol>(vid);
+      }
+      t += 1;
 
-          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
-                                                   RAJA::RangeSegment{1, N-1},
-                                                   RAJA::RangeSegment{1, N-1}),
-            [=](Index_type i, Index_type j, Index_type k) {
-              POLYBENCH_HEAT_3D_BODY1_RAJA;
-            }
-          );
+      if (tune_idx == t) {
+        runOpenMPVariantRAJA<poly_heat3d_omp_outer_pol>(vid);
+      }
+      t += 1;
 
-          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
-                                                   RAJA::RangeSegment{1, N-1},
-                                                   RAJA::RangeSegment{1, N-1}),
-            [=](Index_type i, Index_type j, Index_type k) {
-              POLYBENCH_HEAT_3D_BODY2_RAJA;
-            }
-          );
+      if (tune_idx == t) {
+        runOpenMPVariantRAJA<poly_heat3d_omp_collapse_simd_pol>(vid);
+      }
+      t += 1;
 
+      seq_for(omp_tile_sizes_type{}, [&](auto tile_size) {
+        if (tune_idx == t) {
+          runOpenMPVariantRAJA<poly_heat3d_omp_tile_pol<tile_size>>(vid);
         }
-
-      }
-      stopTimer();
+        t += 1;
+      });
 
       break;
     }
@@ -153,10 +195,115 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+template < typename EXEC_POL >
+void POLYBENCH_HEAT_3D::runOpenMPVariantRAJA(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  POLYBENCH_HEAT_3D_VIEWS_RAJA;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    for (Index_type t = 0; t < tsteps; ++t) {
+
+      RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                               RAJA::RangeSegment{1, N-1},
+                                               RAJA::RangeSegment{1, N-1}),
+        [=](Index_type i, Index_type j, Index_type k) {
+          POLYBENCH_HEAT_3D_BODY1_RAJA;
+        }
+      );
+
+      RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{1, N-1},
+                                               RAJA::RangeSegment{1, N-1},
+                                               RAJA::RangeSegment{1, N-1}),
+        [=](Index_type i, Index_type j, Index_type k) {
+          POLYBENCH_HEAT_3D_BODY2_RAJA;
+        }
+      );
+
+    }
+
+  }
+  stopTimer();
+
+#endif
+  RAJA_UNUSED_VAR(vid);
+}
+
+void POLYBENCH_HEAT_3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if (vid == RAJA_OpenMP) {
+    addVariantTuningName(vid, "outer");
+    addVariantTuningName(vid, "collapse_simd");
+    seq_for(omp_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "tile_"+std::to_string(tile_size));
+    });
+  }
+}
+
+template < typename Storage_type >
+void POLYBENCH_HEAT_3D::runOpenMPVariantStorage(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_HEAT_3D_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type i = 1; i < N-1; ++i ) {
+          for (Index_type j = 1; j < N-1; ++j ) {
+            for (Index_type k = 1; k < N-1; ++k ) {
+              POLYBENCH_HEAT_3D_STORAGE_BODY1;
+            }
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type i = 1; i < N-1; ++i ) {
+          for (Index_type j = 1; j < N-1; ++j ) {
+            for (Index_type k = 1; k < N-1; ++k ) {
+              POLYBENCH_HEAT_3D_STORAGE_BODY2;
+            }
+          }
+        }
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  POLYBENCH_HEAT_3D : Unknown OpenMP storage variant id = " << vid << std::endl;
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+RAJAPERF_STORAGE_RUN_BOILERPLATE(POLYBENCH_HEAT_3D, OpenMP)
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -52,6 +52,10 @@ POLYBENCH_HEAT_3D::POLYBENCH_HEAT_3D(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(Stencil);
+
+  setUsesStoragePrecisions();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -76,17 +80,21 @@ POLYBENCH_HEAT_3D::~POLYBENCH_HEAT_3D()
 {
 }
 
-void POLYBENCH_HEAT_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_HEAT_3D::setUp(VariantID vid, size_t tune_idx)
 {
   (void) vid;
   allocAndInitData(m_Ainit, m_N*m_N*m_N, vid);
   allocAndInitData(m_Binit, m_N*m_N*m_N, vid);
   allocData(m_A, m_N*m_N*m_N, vid);
   allocData(m_B, m_N*m_N*m_N, vid);
+  convertDataToStorage(m_Ainit, m_N*m_N*m_N, vid, tune_idx);
+  convertDataToStorage(m_Binit, m_N*m_N*m_N, vid, tune_idx);
 }
 
 void POLYBENCH_HEAT_3D::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  convertDataFromStorage(m_A, m_N*m_N*m_N, vid, tune_idx);
+  convertDataFromStorage(m_B, m_N*m_N*m_N, vid, tune_idx);
   checksum[vid][tune_idx] += calcChecksum(m_A, m_N*m_N*m_N, checksum_scale_factor , vid);
   checksum[vid][tune_idx] += calcChecksum(m_B, m_N*m_N*m_N, checksum_scale_factor , vid);
 }
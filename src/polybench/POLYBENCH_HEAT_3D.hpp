@@ -35,6 +35,18 @@
 ///   }
 ///
 /// }
+///
+/// The RAJA OpenMP variant has tunings with other kernel policies: the
+/// default collapses the i and j loops, "outer" runs only the i loop in
+/// parallel, "collapse_simd" runs the k loop as simd, and "tile_<size>"
+/// tiles the j and k loops.
+///
+/// The Base GPU variants also have tunings for each k by j by i block
+/// shape of each block size, see gpu_block_shape, and for each k by j
+/// shape whose threads march through all of i.
+///
+/// The storage tunings keep the arrays in fp32 or bf16 and compute in
+/// Real_type, see common/StorageUtils.hpp.
 
 
 #ifndef RAJAPerf_POLYBENCH_HEAT_3D_HPP
@@ -71,6 +83,35 @@
                            B[k-1 + N*(j + N*i)] ) + \
                    B[k + N*(j + N*i)];
 
+#define POLYBENCH_HEAT_3D_STORAGE_DATA_SETUP \
+  Storage_type* A = reinterpret_cast<Storage_type*>(m_A); \
+  Storage_type* B = reinterpret_cast<Storage_type*>(m_B); \
+  \
+  copyData(getDataSpace(vid), m_A, getDataSpace(vid), m_Ainit, m_N*m_N*m_N); \
+  copyData(getDataSpace(vid), m_B, getDataSpace(vid), m_Binit, m_N*m_N*m_N); \
+  \
+  const Index_type N = m_N; \
+  const Index_type tsteps = m_tsteps;
+
+#define POLYBENCH_HEAT_3D_STORAGE_BODY(dst, src) \
+  { \
+    const Real_type c = storage::load(src[k + N*(j + N*i)]); \
+    dst[k + N*(j + N*i)] = storage::store<Storage_type>( \
+                   0.125*( storage::load(src[k + N*(j + N*(i+1))]) - 2.0*c + \
+                           storage::load(src[k + N*(j + N*(i-1))]) ) + \
+                   0.125*( storage::load(src[k + N*(j+1 + N*i)])   - 2.0*c + \
+                           storage::load(src[k + N*(j-1 + N*i)]) ) + \
+                   0.125*( storage::load(src[k+1 + N*(j + N*i)])   - 2.0*c + \
+                           storage::load(src[k-1 + N*(j + N*i)]) ) + \
+                   c ); \
+  }
+
+#define POLYBENCH_HEAT_3D_STORAGE_BODY1 \
+  POLYBENCH_HEAT_3D_STORAGE_BODY(B, A)
+
+#define POLYBENCH_HEAT_3D_STORAGE_BODY2 \
+  POLYBENCH_HEAT_3D_STORAGE_BODY(A, B)
+
 
 #define POLYBENCH_HEAT_3D_BODY1_RAJA \
   Bview(i,j,k) = \
@@ -123,17 +164,46 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename EXEC_POL >
+  void runOpenMPVariantRAJA(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
+  void runCudaVariantGraph(VariantID vid);
+  template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantGraph(VariantID vid);
+  template < size_t k_block_size, size_t j_block_size, size_t i_block_size >
+  void runCudaVariantShape(VariantID vid);
+  template < size_t k_block_size, size_t j_block_size, size_t i_block_size >
+  void runHipVariantShape(VariantID vid);
+  template < size_t k_block_size, size_t j_block_size >
+  void runCudaVariantMarch(VariantID vid);
+  template < size_t k_block_size, size_t j_block_size >
+  void runHipVariantMarch(VariantID vid);
+
+  void runSeqStorageVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPStorageVariant(VariantID vid, size_t tune_idx);
+  void runCudaStorageVariant(VariantID vid, size_t tune_idx);
+  void runHipStorageVariant(VariantID vid, size_t tune_idx);
+  template < typename Storage_type >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runOpenMPVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runCudaVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runHipVariantStorage(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using omp_tile_sizes_type = camp::int_seq<Index_type, 16, 64>;
 
   Index_type m_N;
   Index_type m_tsteps;
@@ -29,6 +29,8 @@ namespace polybench
 void POLYBENCH_JACOBI_1D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
 
   POLYBENCH_JACOBI_1D_DATA_SETUP;
 
@@ -39,16 +41,32 @@ void POLYBENCH_JACOBI_1D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_
 
       for (Index_type t = 0; t < tsteps; ++t) {
 
-        #pragma omp target is_device_ptr(A,B) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-        for (Index_type i = 1; i < N-1; ++i ) {
-          POLYBENCH_JACOBI_1D_BODY1;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(A,B) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 1; i < N-1; ++i ) {
+            POLYBENCH_JACOBI_1D_BODY1;
+          }
+        } else {
+          #pragma omp target is_device_ptr(A,B) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 1; i < N-1; ++i ) {
+            POLYBENCH_JACOBI_1D_BODY1;
+          }
         }
 
-        #pragma omp target is_device_ptr(A,B) device( did )
-        #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-        for (Index_type i = 1; i < N-1; ++i ) {
-          POLYBENCH_JACOBI_1D_BODY2;
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target is_device_ptr(A,B) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 1; i < N-1; ++i ) {
+            POLYBENCH_JACOBI_1D_BODY2;
+          }
+        } else {
+          #pragma omp target is_device_ptr(A,B) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = 1; i < N-1; ++i ) {
+            POLYBENCH_JACOBI_1D_BODY2;
+          }
         }
       }
 
@@ -13,6 +13,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/StorageUtils.hpp"
 
 #include <iostream>
 
@@ -63,6 +64,30 @@ __global__ void poly_jacobi_2D_2(Real_ptr A, Real_ptr B, Index_type N)
   }
 }
 
+template < typename Storage_type, size_t j_block_size, size_t i_block_size >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_jacobi_2D_storage_1(Storage_type* A, Storage_type* B, Index_type N)
+{
+  Index_type i = 1 + blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = 1 + blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < N-1 && j < N-1 ) {
+    POLYBENCH_JACOBI_2D_STORAGE_BODY1;
+  }
+}
+
+template < typename Storage_type, size_t j_block_size, size_t i_block_size >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_jacobi_2D_storage_2(Storage_type* A, Storage_type* B, Index_type N)
+{
+  Index_type i = 1 + blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = 1 + blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < N-1 && j < N-1 ) {
+    POLYBENCH_JACOBI_2D_STORAGE_BODY2;
+  }
+}
+
 template < size_t j_block_size, size_t i_block_size, typename Lambda >
 __launch_bounds__(j_block_size*i_block_size)
 __global__ void poly_jacobi_2D_lam(Index_type N, Lambda body)
@@ -187,7 +212,90 @@ void POLYBENCH_JACOBI_2D::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_JACOBI_2D, Cuda)
+template < size_t j_block_size, size_t i_block_size >
+void POLYBENCH_JACOBI_2D::runCudaVariantShape(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_JACOBI_2D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        dim3 nthreads_per_block(j_block_size, i_block_size, 1);
+        dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, j_block_size)),
+                     static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(N-2, i_block_size)),
+                     static_cast<size_t>(1));
+        constexpr size_t shmem = 0;
+
+        poly_jacobi_2D_1<j_block_size, i_block_size>
+                        <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+        poly_jacobi_2D_2<j_block_size, i_block_size>
+                        <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_JACOBI_2D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_SHAPE_2D_TUNING_DEFINE_BOILERPLATE(POLYBENCH_JACOBI_2D, Cuda, Base_CUDA)
+
+template < typename Storage_type >
+void POLYBENCH_JACOBI_2D::runCudaVariantStorage(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_JACOBI_2D_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        JACOBI_2D_THREADS_PER_BLOCK_CUDA;
+        JACOBI_2D_NBLOCKS_CUDA;
+        constexpr size_t shmem = 0;
+
+        poly_jacobi_2D_storage_1<Storage_type, JACOBI_2D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+        poly_jacobi_2D_storage_2<Storage_type, JACOBI_2D_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+            <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(A, B, N);
+        cudaErrchk( cudaGetLastError() );
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_JACOBI_2D : Unknown Cuda storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(POLYBENCH_JACOBI_2D, Cuda)
 
 } // end namespace polybench
 } // end namespace rajaperf
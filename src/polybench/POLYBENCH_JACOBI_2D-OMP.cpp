@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/StorageUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
 
 
@@ -19,7 +22,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -31,29 +34,86 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 
     case Base_OpenMP : {
 
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+      if (tune_idx == 0) {
 
-        for (Index_type t = 0; t < tsteps; ++t) {
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              POLYBENCH_JACOBI_2D_BODY1;
+          for (Index_type t = 0; t < tsteps; ++t) {
+
+            #pragma omp parallel for
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                POLYBENCH_JACOBI_2D_BODY1;
+              }
+            }
+
+            #pragma omp parallel for
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                POLYBENCH_JACOBI_2D_BODY2;
+              }
             }
+
           }
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              POLYBENCH_JACOBI_2D_BODY2;
+        }
+        stopTimer();
+
+      } else {
+
+        //
+        // Each task updates a tile of rows. The dependences on the first
+        // row of the tile and of its neighbor tiles order a task after the
+        // tasks of the previous sweep that write the rows it reads or read
+        // the rows it writes, so sweeps overlap without a barrier.
+        //
+        const Index_type tile_rows = task_tile_rows;
+        const Index_type num_tiles = (N-2 + tile_rows-1) / tile_rows;
+
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          #pragma omp parallel
+          #pragma omp single
+          for (Index_type t = 0; t < tsteps; ++t) {
+
+            for (Index_type it = 0; it < num_tiles; ++it) {
+              const Index_type ibeg = 1 + it*tile_rows;
+              const Index_type iend = std::min(ibeg + tile_rows, N-1);
+              const Index_type iprev = 1 + std::max(it-1, Index_type(0))*tile_rows;
+              const Index_type inext = 1 + std::min(it+1, num_tiles-1)*tile_rows;
+              #pragma omp task firstprivate(ibeg, iend) \
+                               depend(in: A[iprev*N], A[ibeg*N], A[inext*N]) \
+                               depend(out: B[ibeg*N])
+              for (Index_type i = ibeg; i < iend; ++i ) {
+                for (Index_type j = 1; j < N-1; ++j ) {
+                  POLYBENCH_JACOBI_2D_BODY1;
+                }
+              }
+            }
+
+            for (Index_type it = 0; it < num_tiles; ++it) {
+              const Index_type ibeg = 1 + it*tile_rows;
+              const Index_type iend = std::min(ibeg + tile_rows, N-1);
+              const Index_type iprev = 1 + std::max(it-1, Index_type(0))*tile_rows;
+              const Index_type inext = 1 + std::min(it+1, num_tiles-1)*tile_rows;
+              #pragma omp task firstprivate(ibeg, iend) \
+                               depend(in: B[iprev*N], B[ibeg*N], B[inext*N]) \
+                               depend(out: A[ibeg*N])
+              for (Index_type i = ibeg; i < iend; ++i ) {
+                for (Index_type j = 1; j < N-1; ++j ) {
+                  POLYBENCH_JACOBI_2D_BODY2;
+                }
+              }
             }
+
           }
 
         }
+        stopTimer();
 
       }
-      stopTimer();
 
       break;
     }
@@ -147,8 +207,64 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void POLYBENCH_JACOBI_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "task_depend");
+  }
+}
+
+template < typename Storage_type >
+void POLYBENCH_JACOBI_2D::runOpenMPVariantStorage(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_JACOBI_2D_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        #pragma omp parallel for
+        for (Index_type i = 1; i < N-1; ++i ) {
+          for (Index_type j = 1; j < N-1; ++j ) {
+            POLYBENCH_JACOBI_2D_STORAGE_BODY1;
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 1; i < N-1; ++i ) {
+          for (Index_type j = 1; j < N-1; ++j ) {
+            POLYBENCH_JACOBI_2D_STORAGE_BODY2;
+          }
+        }
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  POLYBENCH_JACOBI_2D : Unknown OpenMP storage variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(POLYBENCH_JACOBI_2D, OpenMP)
+
 } // end namespace polybench
 } // end namespace rajaperf
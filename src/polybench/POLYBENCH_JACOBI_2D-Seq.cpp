@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/StorageUtils.hpp"
+
 #include <iostream>
 
 
@@ -143,5 +145,42 @@ void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 
 }
 
+template < typename Storage_type >
+void POLYBENCH_JACOBI_2D::runSeqVariantStorage(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_JACOBI_2D_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+
+        for (Index_type i = 1; i < N-1; ++i ) {
+          for (Index_type j = 1; j < N-1; ++j ) {
+            POLYBENCH_JACOBI_2D_STORAGE_BODY1;
+          }
+        }
+        for (Index_type i = 1; i < N-1; ++i ) {
+          for (Index_type j = 1; j < N-1; ++j ) {
+            POLYBENCH_JACOBI_2D_STORAGE_BODY2;
+          }
+        }
+
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  POLYBENCH_JACOBI_2D : Unknown Seq storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(POLYBENCH_JACOBI_2D, Seq)
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -51,6 +51,10 @@ POLYBENCH_JACOBI_2D::POLYBENCH_JACOBI_2D(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(Stencil);
+
+  setUsesStoragePrecisions();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -69,23 +73,29 @@ POLYBENCH_JACOBI_2D::POLYBENCH_JACOBI_2D(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
 }
 
 POLYBENCH_JACOBI_2D::~POLYBENCH_JACOBI_2D()
 {
 }
 
-void POLYBENCH_JACOBI_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_JACOBI_2D::setUp(VariantID vid, size_t tune_idx)
 {
   (void) vid;
   allocAndInitData(m_Ainit, m_N*m_N, vid);
   allocAndInitData(m_Binit, m_N*m_N, vid);
   allocData(m_A, m_N*m_N, vid);
   allocData(m_B, m_N*m_N, vid);
+  convertDataToStorage(m_Ainit, m_N*m_N, vid, tune_idx);
+  convertDataToStorage(m_Binit, m_N*m_N, vid, tune_idx);
 }
 
 void POLYBENCH_JACOBI_2D::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  convertDataFromStorage(m_A, m_N*m_N, vid, tune_idx);
+  convertDataFromStorage(m_B, m_N*m_N, vid, tune_idx);
   checksum[vid][tune_idx] += calcChecksum(m_A, m_N*m_N, checksum_scale_factor , vid);
   checksum[vid][tune_idx] += calcChecksum(m_B, m_N*m_N, checksum_scale_factor , vid);
 }
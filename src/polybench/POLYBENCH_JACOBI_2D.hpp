@@ -22,6 +22,16 @@
 ///     }
 ///   }
 /// }
+///
+/// The "task_depend" tuning of the Base OpenMP variant runs each sweep as
+/// tasks over tiles of rows with depend clauses on the neighbor tiles, so
+/// tiles of consecutive sweeps overlap instead of waiting at a barrier.
+///
+/// The Base GPU variants also have tunings for each j by i block shape of
+/// each block size, see gpu_block_shape.
+///
+/// The storage tunings keep the arrays in fp32 or bf16 and compute in
+/// Real_type, see common/StorageUtils.hpp.
 
 
 #ifndef RAJAPerf_POLYBENCH_JACOBI_2D_HPP
@@ -44,6 +54,28 @@
 #define POLYBENCH_JACOBI_2D_BODY2 \
   A[j + i*N] = 0.2 * (B[j + i*N] + B[j-1 + i*N] + B[j+1 + i*N] + B[j + (i+1)*N] + B[j + (i-1)*N]);
 
+#define POLYBENCH_JACOBI_2D_STORAGE_DATA_SETUP \
+  Storage_type* A = reinterpret_cast<Storage_type*>(m_A); \
+  Storage_type* B = reinterpret_cast<Storage_type*>(m_B); \
+  \
+  copyData(getDataSpace(vid), m_A, getDataSpace(vid), m_Ainit, m_N*m_N); \
+  copyData(getDataSpace(vid), m_B, getDataSpace(vid), m_Binit, m_N*m_N); \
+  \
+  const Index_type N = m_N; \
+  const Index_type tsteps = m_tsteps;
+
+#define POLYBENCH_JACOBI_2D_STORAGE_BODY1 \
+  B[j + i*N] = storage::store<Storage_type>( \
+      0.2 * (storage::load(A[j + i*N]) + storage::load(A[j-1 + i*N]) + \
+             storage::load(A[j+1 + i*N]) + storage::load(A[j + (i+1)*N]) + \
+             storage::load(A[j + (i-1)*N])) );
+
+#define POLYBENCH_JACOBI_2D_STORAGE_BODY2 \
+  A[j + i*N] = storage::store<Storage_type>( \
+      0.2 * (storage::load(B[j + i*N]) + storage::load(B[j-1 + i*N]) + \
+             storage::load(B[j+1 + i*N]) + storage::load(B[j + (i+1)*N]) + \
+             storage::load(B[j + (i-1)*N])) );
+
 
 #define POLYBENCH_JACOBI_2D_BODY1_RAJA \
   Bview(i,j) = 0.2 * (Aview(i,j) + Aview(i,j-1) + Aview(i,j+1) + Aview(i+1,j) + Aview(i-1,j));
@@ -87,16 +119,37 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t j_block_size, size_t i_block_size >
+  void runCudaVariantShape(VariantID vid);
+  template < size_t j_block_size, size_t i_block_size >
+  void runHipVariantShape(VariantID vid);
+
+  void runSeqStorageVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPStorageVariant(VariantID vid, size_t tune_idx);
+  void runCudaStorageVariant(VariantID vid, size_t tune_idx);
+  void runHipStorageVariant(VariantID vid, size_t tune_idx);
+  template < typename Storage_type >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runOpenMPVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runCudaVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runHipVariantStorage(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
+  // rows of each task of the Base OpenMP task_depend tuning
+  static const Index_type task_tile_rows = 16;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
@@ -0,0 +1,253 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_LU.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Define thread block shape for Hip execution
+//
+#define j_block_sz (32)
+#define i_block_sz (block_size / j_block_sz)
+
+#define POLY_LU_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP \
+  j_block_sz, i_block_sz
+
+#define POLY_LU_THREADS_PER_BLOCK_HIP \
+  dim3 nthreads_per_block(POLY_LU_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, 1);
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_lu_copy(Real_ptr LU, Real_ptr A,
+                             Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+
+  if (i < iend) {
+    POLYBENCH_LU_BODY1;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_lu_scale(Real_ptr LU, Index_type k, Index_type n,
+                              Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+
+  if (i < iend) {
+    POLYBENCH_LU_BODY2;
+  }
+}
+
+template < size_t j_block_size, size_t i_block_size >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_lu_update(Real_ptr LU, Index_type k, Index_type n,
+                               Index_type ibegin, Index_type iend,
+                               Index_type jbegin, Index_type jend)
+{
+  Index_type i = ibegin + blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = jbegin + blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < iend && j < jend ) {
+    POLYBENCH_LU_BODY3;
+  }
+}
+
+template < size_t block_size, typename Lambda >
+__launch_bounds__(block_size)
+__global__ void poly_lu_lam(Index_type ibegin, Index_type iend,
+                            Lambda body)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+
+  if (i < iend) {
+    body(i);
+  }
+}
+
+template < size_t j_block_size, size_t i_block_size, typename Lambda >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_lu_lam_2d(Index_type ibegin, Index_type iend,
+                               Index_type jbegin, Index_type jend,
+                               Lambda body)
+{
+  Index_type i = ibegin + blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = jbegin + blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < iend && j < jend ) {
+    body(i, j);
+  }
+}
+
+
+template < size_t block_size >
+void POLYBENCH_LU::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_LU_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      POLY_LU_THREADS_PER_BLOCK_HIP;
+      constexpr size_t shmem = 0;
+
+      const size_t grid_size_copy = RAJA_DIVIDE_CEILING_INT(n*n, block_size);
+      hipLaunchKernelGGL((poly_lu_copy<block_size>),
+                         dim3(grid_size_copy), dim3(block_size), shmem, res.get_stream(),
+                         LU, A,
+                         0, n*n);
+      hipErrchk( hipGetLastError() );
+
+      for (Index_type k = 0; k < n-1; ++k) {
+        const size_t grid_size_scale = RAJA_DIVIDE_CEILING_INT(n - (k+1), block_size);
+        hipLaunchKernelGGL((poly_lu_scale<block_size>),
+                           dim3(grid_size_scale), dim3(block_size), shmem, res.get_stream(),
+                           LU, k, n,
+                           k+1, n);
+        hipErrchk( hipGetLastError() );
+
+        dim3 nblocks_update(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n - (k+1), j_block_sz)),
+                            static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n - (k+1), i_block_sz)),
+                            static_cast<size_t>(1));
+        hipLaunchKernelGGL((poly_lu_update<POLY_LU_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP>),
+                           dim3(nblocks_update), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           LU, k, n,
+                           k+1, n,
+                           k+1, n);
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      POLY_LU_THREADS_PER_BLOCK_HIP;
+      constexpr size_t shmem = 0;
+
+      const size_t grid_size_copy = RAJA_DIVIDE_CEILING_INT(n*n, block_size);
+
+      auto poly_lu_copy_lambda =
+        [=] __device__ (Index_type i) {
+          POLYBENCH_LU_BODY1;
+        };
+
+      hipLaunchKernelGGL((poly_lu_lam<block_size, decltype(poly_lu_copy_lambda)>),
+                         dim3(grid_size_copy), dim3(block_size), shmem, res.get_stream(),
+                         0, n*n, poly_lu_copy_lambda);
+      hipErrchk( hipGetLastError() );
+
+      for (Index_type k = 0; k < n-1; ++k) {
+        const size_t grid_size_scale = RAJA_DIVIDE_CEILING_INT(n - (k+1), block_size);
+
+        auto poly_lu_scale_lambda =
+          [=] __device__ (Index_type i) {
+            POLYBENCH_LU_BODY2;
+          };
+
+        hipLaunchKernelGGL((poly_lu_lam<block_size, decltype(poly_lu_scale_lambda)>),
+                           dim3(grid_size_scale), dim3(block_size), shmem, res.get_stream(),
+                           k+1, n, poly_lu_scale_lambda);
+        hipErrchk( hipGetLastError() );
+
+        dim3 nblocks_update(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n - (k+1), j_block_sz)),
+                            static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n - (k+1), i_block_sz)),
+                            static_cast<size_t>(1));
+
+        auto poly_lu_update_lambda =
+          [=] __device__ (Index_type i, Index_type j) {
+            POLYBENCH_LU_BODY3;
+          };
+
+        hipLaunchKernelGGL((poly_lu_lam_2d<POLY_LU_THREADS_PER_BLOCK_TEMPLATE_PARAMS_HIP, decltype(poly_lu_update_lambda)>),
+                           dim3(nblocks_update), dim3(nthreads_per_block), shmem, res.get_stream(),
+                           k+1, n, k+1, n,
+                           poly_lu_update_lambda);
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    POLYBENCH_LU_VIEWS_RAJA;
+
+    using EXEC_POL_1D = RAJA::hip_exec<block_size, true /*async*/>;
+
+    using EXEC_POL =
+      RAJA::KernelPolicy<
+        RAJA::statement::HipKernelFixedAsync<i_block_sz * j_block_sz,
+          RAJA::statement::For<0, RAJA::hip_global_size_y_direct<i_block_sz>,   // i
+            RAJA::statement::For<1, RAJA::hip_global_size_x_direct<j_block_sz>, // j
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<EXEC_POL_1D>( res, RAJA::RangeSegment{0, n*n},
+        [=] __device__ (Index_type i) {
+          POLYBENCH_LU_BODY1_RAJA;
+      });
+
+      for (Index_type k = 0; k < n-1; ++k) {
+        RAJA::forall<EXEC_POL_1D>( res, RAJA::RangeSegment{k+1, n},
+          [=] __device__ (Index_type i) {
+            POLYBENCH_LU_BODY2_RAJA;
+        });
+
+        RAJA::kernel_resource<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{k+1, n},
+                                                          RAJA::RangeSegment{k+1, n}),
+                                         res,
+          [=] __device__ (Index_type i, Index_type j) {
+            POLYBENCH_LU_BODY3_RAJA;
+          }
+        );
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_LU : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_LU, Hip)
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_LU.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_LU::POLYBENCH_LU(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_LU, params)
+{
+  Index_type n_default = 1000;
+
+  setDefaultProblemSize( n_default * n_default );
+  setDefaultReps(4);
+
+  m_n = std::sqrt( getTargetProblemSize() ) + 1;
+
+
+  setActualProblemSize( m_n * m_n );
+
+  setItsPerRep( m_n * m_n +
+                m_n * (m_n-1) / 2 +
+                (m_n-1) * m_n * (2*m_n-1) / 6 );
+  setKernelsPerRep(1 + 2 * (m_n-1));
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_n );
+  setFLOPsPerRep(m_n * (m_n-1) / 2 +
+                 2 * (m_n-1) * m_n * (2*m_n-1) / 6);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+  setUsesFeature(Forall);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+POLYBENCH_LU::~POLYBENCH_LU()
+{
+}
+
+void POLYBENCH_LU::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = m_n * m_n;
+
+  //
+  // Off diagonal entries are multiples of 1/8 in [-1, 1) and diagonal
+  // entries are n, so A is diagonally dominant by columns and factors
+  // stably without pivoting.
+  //
+  constexpr unsigned long long a_seed = 5119;
+
+  allocData(m_A, len, vid);
+  {
+    auto reset_A = scopedMoveData(m_A, len, vid);
+    for (Index_type i = 0; i < m_n; ++i) {
+      for (Index_type j = 0; j < m_n; ++j) {
+        const Index_type idx = j + i*m_n;
+        m_A[idx] = (i == j)
+            ? static_cast<Real_type>(m_n)
+            : 0.125 * std::floor(16.0 * detail::counterRandValue(a_seed, idx)) - 1.0;
+      }
+    }
+  }
+  allocAndInitDataConst(m_LU, len, 0.0, vid);
+}
+
+void POLYBENCH_LU::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_LU, m_n * m_n, checksum_scale_factor , vid);
+}
+
+void POLYBENCH_LU::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_A, vid);
+  deallocData(m_LU, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
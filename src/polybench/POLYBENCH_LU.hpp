@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_LU kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; i++) {
+///   for (Index_type j = 0; j < i; j++) {
+///     for (Index_type k = 0; k < j; k++) {
+///       A[i][j] -= A[i][k] * A[k][j];
+///     }
+///     A[i][j] /= A[j][j];
+///   }
+///   for (Index_type j = i; j < N; j++) {
+///     for (Index_type k = 0; k < i; k++) {
+///       A[i][j] -= A[i][k] * A[k][j];
+///     }
+///   }
+/// }
+///
+/// Here A is copied to LU, which is factored in place in right looking
+/// order: for each k the column below the diagonal is scaled, then the
+/// trailing submatrix is updated, so each step is two parallel loops.
+/// Every entry gets the same updates as in the reference.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_LU_HPP
+#define RAJAPerf_POLYBENCH_LU_HPP
+
+#define POLYBENCH_LU_DATA_SETUP \
+  const Index_type n = m_n; \
+\
+  Real_ptr A = m_A; \
+  Real_ptr LU = m_LU;
+
+
+#define POLYBENCH_LU_BODY1 \
+  LU[i] = A[i];
+
+#define POLYBENCH_LU_BODY2 \
+  LU[k + i*n] /= LU[k + k*n];
+
+#define POLYBENCH_LU_BODY3 \
+  LU[j + i*n] -= LU[k + i*n] * LU[j + k*n];
+
+
+#define POLYBENCH_LU_BODY1_RAJA \
+  LU[i] = A[i];
+
+#define POLYBENCH_LU_BODY2_RAJA \
+  LUview(i, k) /= LUview(k, k);
+
+#define POLYBENCH_LU_BODY3_RAJA \
+  LUview(i, j) -= LUview(i, k) * LUview(k, j);
+
+
+#define POLYBENCH_LU_VIEWS_RAJA \
+  using VIEW_TYPE = RAJA::View<Real_type, \
+                               RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE LUview(LU, RAJA::Layout<2>(n, n));
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_LU : public KernelBase
+{
+public:
+
+  POLYBENCH_LU(const RunParams& params);
+
+  ~POLYBENCH_LU();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+
+  Index_type m_n;
+
+  Real_ptr m_A;
+  Real_ptr m_LU;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/BlasUtils.hpp"
+#include "matvec_helper.hpp"
 
 #include <iostream>
 
@@ -54,6 +56,57 @@ __global__ void poly_mvt_2(Real_ptr A, Real_ptr x2, Real_ptr y2,
 }
 
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_mvt_warp_row_1(Real_ptr A, Real_ptr x1, Real_ptr y1,
+                                    Index_type N)
+{
+  constexpr size_t warps_per_block = block_size / poly_warp_size;
+  Index_type i = blockIdx.x * warps_per_block + threadIdx.x / poly_warp_size;
+
+  if (i < N) {
+    Real_type dot = poly_warp_row_sum(N, [=](Index_type j) {
+      return A[j + i*N] * y1[j];
+    });
+    if (threadIdx.x % poly_warp_size == 0) {
+      POLYBENCH_MVT_BODY3;
+    }
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_mvt_warp_row_2(Real_ptr A, Real_ptr x2, Real_ptr y2,
+                                    Index_type N)
+{
+  Index_type i = blockIdx.x * poly_column_width + threadIdx.x;
+
+  Real_type dot = poly_block_column_sum<block_size>(N, i < N,
+    [=](Index_type j) {
+      return A[i + j*N] * y2[i];
+    });
+  if (threadIdx.y == 0 && i < N) {
+    POLYBENCH_MVT_BODY6;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_mvt_dual_layout_1(Real_ptr AT, Real_ptr x1, Real_ptr y1,
+                                       Index_type N)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+
+  if (i < N) {
+    POLYBENCH_MVT_BODY1;
+    for (Index_type j = 0; j < N; ++j ) {
+      POLYBENCH_MVT_BODY2_AT;
+    }
+    POLYBENCH_MVT_BODY3;
+  }
+}
+
+
 template < size_t block_size >
 void POLYBENCH_MVT::runCudaVariantImpl(VariantID vid)
 {
@@ -154,7 +207,196 @@ void POLYBENCH_MVT::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_MVT, Cuda)
+template < size_t block_size >
+void POLYBENCH_MVT::runCudaVariantWarpRow(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_MVT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size1 =
+          RAJA_DIVIDE_CEILING_INT(N, block_size / poly_warp_size);
+      const size_t grid_size2 = RAJA_DIVIDE_CEILING_INT(N, poly_column_width);
+      const dim3 nthreads_per_block2(poly_column_width,
+                                     block_size / poly_column_width);
+      constexpr size_t shmem = 0;
+
+      poly_mvt_warp_row_1<block_size><<<grid_size1, block_size, shmem, res.get_stream()>>>(A, x1, y1, N);
+      cudaErrchk( cudaGetLastError() );
+
+      poly_mvt_warp_row_2<block_size><<<grid_size2, nthreads_per_block2, shmem, res.get_stream()>>>(A, x2, y2, N);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_MVT : Unknown Cuda warp row variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void POLYBENCH_MVT::runCudaVariantDualLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_MVT_DATA_SETUP;
+  POLYBENCH_MVT_DATA_SETUP_AT;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(N, block_size);
+      constexpr size_t shmem = 0;
+
+      poly_mvt_dual_layout_1<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(AT, x1, y1, N);
+      cudaErrchk( cudaGetLastError() );
+
+      poly_mvt_2<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(A, x2, y2, N);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_MVT : Unknown Cuda dual layout variant id = " << vid << std::endl;
+  }
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+void POLYBENCH_MVT::runCudaVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_MVT_DATA_SETUP;
+  POLYBENCH_MVT_DATA_SETUP_BLAS;
+
+  if ( vid == Base_CUDA ) {
+
+    cublasHandle_t handle;
+    cublasErrchk( cublasCreate(&handle) );
+    cublasErrchk( cublasSetStream(handle, res.get_stream()) );
+
+    // row major A is column major A^T
+    const Real_type zero = 0.0;
+    const Real_type one = 1.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cublasErrchk( cublasGemv(handle, CUBLAS_OP_T, N, N,
+                               &one, A, y1, &one, x1) );
+
+      cublasErrchk( cublasGemv(handle, CUBLAS_OP_N, N, N,
+                               &one, A, ones, &zero, colsum) );
+      cublasErrchk( cublasSbmv(handle, N, &one, y2, colsum, &one, x2) );
+
+    }
+    stopTimer();
+
+    cublasErrchk( cublasDestroy(handle) );
+
+  } else {
+      getCout() << "\n  POLYBENCH_MVT : Unknown Cuda blas variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+void POLYBENCH_MVT::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantWarpRow<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantDualLayout<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    if (tune_idx == t) {
+      runCudaVariantBlas(vid);
+    }
+    t += 1;
+#endif
+
+  }
+}
+
+void POLYBENCH_MVT::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        addVariantTuningName(vid, "warp_row_"+std::to_string(block_size));
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "dual_layout_"+std::to_string(block_size));
+      }
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    addVariantTuningName(vid, "cublas");
+#endif
+
+  }
+}
 
 } // end namespace polybench
 } // end namespace rajaperf
@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/BlasUtils.hpp"
+#include "matvec_helper.hpp"
 
 #include <iostream>
 
@@ -54,6 +56,57 @@ __global__ void poly_mvt_2(Real_ptr A, Real_ptr x2, Real_ptr y2,
 }
 
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_mvt_warp_row_1(Real_ptr A, Real_ptr x1, Real_ptr y1,
+                                    Index_type N)
+{
+  constexpr size_t warps_per_block = block_size / poly_warp_size;
+  Index_type i = blockIdx.x * warps_per_block + threadIdx.x / poly_warp_size;
+
+  if (i < N) {
+    Real_type dot = poly_warp_row_sum(N, [=](Index_type j) {
+      return A[j + i*N] * y1[j];
+    });
+    if (threadIdx.x % poly_warp_size == 0) {
+      POLYBENCH_MVT_BODY3;
+    }
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_mvt_warp_row_2(Real_ptr A, Real_ptr x2, Real_ptr y2,
+                                    Index_type N)
+{
+  Index_type i = blockIdx.x * poly_column_width + threadIdx.x;
+
+  Real_type dot = poly_block_column_sum<block_size>(N, i < N,
+    [=](Index_type j) {
+      return A[i + j*N] * y2[i];
+    });
+  if (threadIdx.y == 0 && i < N) {
+    POLYBENCH_MVT_BODY6;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_mvt_dual_layout_1(Real_ptr AT, Real_ptr x1, Real_ptr y1,
+                                       Index_type N)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+
+  if (i < N) {
+    POLYBENCH_MVT_BODY1;
+    for (Index_type j = 0; j < N; ++j ) {
+      POLYBENCH_MVT_BODY2_AT;
+    }
+    POLYBENCH_MVT_BODY3;
+  }
+}
+
+
 template < size_t block_size >
 void POLYBENCH_MVT::runHipVariantImpl(VariantID vid)
 {
@@ -152,7 +205,200 @@ void POLYBENCH_MVT::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_MVT, Hip)
+template < size_t block_size >
+void POLYBENCH_MVT::runHipVariantWarpRow(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_MVT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size1 =
+          RAJA_DIVIDE_CEILING_INT(N, block_size / poly_warp_size);
+      const size_t grid_size2 = RAJA_DIVIDE_CEILING_INT(N, poly_column_width);
+      const dim3 nthreads_per_block2(poly_column_width,
+                                     block_size / poly_column_width);
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((poly_mvt_warp_row_1<block_size>), dim3(grid_size1), dim3(block_size), shmem, res.get_stream(),
+                         A, x1, y1, N);
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((poly_mvt_warp_row_2<block_size>), dim3(grid_size2), dim3(nthreads_per_block2), shmem, res.get_stream(),
+                         A, x2, y2, N);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_MVT : Unknown Hip warp row variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void POLYBENCH_MVT::runHipVariantDualLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_MVT_DATA_SETUP;
+  POLYBENCH_MVT_DATA_SETUP_AT;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(N, block_size);
+      constexpr size_t shmem = 0;
+
+      hipLaunchKernelGGL((poly_mvt_dual_layout_1<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         AT, x1, y1, N);
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL((poly_mvt_2<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         A, x2, y2, N);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_MVT : Unknown Hip dual layout variant id = " << vid << std::endl;
+  }
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+void POLYBENCH_MVT::runHipVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_MVT_DATA_SETUP;
+  POLYBENCH_MVT_DATA_SETUP_BLAS;
+
+  if ( vid == Base_HIP ) {
+
+    rocblas_handle handle;
+    rocblasErrchk( rocblas_create_handle(&handle) );
+    rocblasErrchk( rocblas_set_stream(handle, res.get_stream()) );
+
+    // row major A is column major A^T
+    const Real_type zero = 0.0;
+    const Real_type one = 1.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      rocblasErrchk( rocblasGemv(handle, rocblas_operation_transpose, N, N,
+                                 &one, A, y1, &one, x1) );
+
+      rocblasErrchk( rocblasGemv(handle, rocblas_operation_none, N, N,
+                                 &one, A, ones, &zero, colsum) );
+      rocblasErrchk( rocblasSbmv(handle, N, &one, y2, colsum, &one, x2) );
+
+    }
+    stopTimer();
+
+    rocblasErrchk( rocblas_destroy_handle(handle) );
+
+  } else {
+      getCout() << "\n  POLYBENCH_MVT : Unknown Hip blas variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+void POLYBENCH_MVT::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantWarpRow<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantDualLayout<block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    if (tune_idx == t) {
+      runHipVariantBlas(vid);
+    }
+    t += 1;
+#endif
+
+  }
+}
+
+void POLYBENCH_MVT::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (poly_valid_warp_row_block_size(block_size) &&
+          (run_params.numValidGPUBlockSize() == 0u ||
+           run_params.validGPUBlockSize(block_size))) {
+        addVariantTuningName(vid, "warp_row_"+std::to_string(block_size));
+      }
+    });
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid, "dual_layout_"+std::to_string(block_size));
+      }
+    });
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    addVariantTuningName(vid, "rocblas");
+#endif
+
+  }
+}
 
 } // end namespace polybench
 } // end namespace rajaperf
@@ -7,9 +7,11 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_MVT.hpp"
+#include "matvec_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_MVT::runOpenMPVariantRowOrder(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -27,6 +29,123 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
   POLYBENCH_MVT_DATA_SETUP;
 
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY2;
+          }
+          POLYBENCH_MVT_BODY3;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i0 = 0; i0 < N; i0 += poly_row_order_chunk ) {
+          const Index_type i_end = std::min(i0 + poly_row_order_chunk, N);
+          Real_type dots[poly_row_order_chunk];
+          for (Index_type i = i0; i < i_end; ++i ) {
+            dots[i - i0] = 0.0;
+          }
+          for (Index_type j = 0; j < N; ++j ) {
+            for (Index_type i = i0; i < i_end; ++i ) {
+              POLYBENCH_MVT_BODY5_ROW_ORDER;
+            }
+          }
+          for (Index_type i = i0; i < i_end; ++i ) {
+            x2[i] += dots[i - i0];
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_MVT : Unknown row order variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_MVT::runOpenMPVariantDualLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_MVT_DATA_SETUP;
+  POLYBENCH_MVT_DATA_SETUP_AT;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY2;
+          }
+          POLYBENCH_MVT_BODY3;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY4;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY5_AT;
+          }
+          POLYBENCH_MVT_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_MVT : Unknown dual layout variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantRowOrder(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runOpenMPVariantDualLayout(vid);
+    return;
+  }
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_MVT_DATA_SETUP;
+
   switch ( vid ) {
 
     case Base_OpenMP : {
@@ -191,8 +310,19 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void POLYBENCH_MVT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "row_order");
+    addVariantTuningName(vid, "dual_layout");
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
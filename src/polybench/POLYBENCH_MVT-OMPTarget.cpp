@@ -29,6 +29,8 @@ namespace polybench
 void POLYBENCH_MVT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
 
   POLYBENCH_MVT_DATA_SETUP;
 
@@ -37,24 +39,48 @@ void POLYBENCH_MVT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(x1,A,y1) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = 0; i < N; ++i ) {
-        POLYBENCH_MVT_BODY1;
-        for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_MVT_BODY2;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x1,A,y1) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY2;
+          }
+          POLYBENCH_MVT_BODY3;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x1,A,y1) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY2;
+          }
+          POLYBENCH_MVT_BODY3;
         }
-        POLYBENCH_MVT_BODY3;
       }
 
-      #pragma omp target is_device_ptr(x2,A,y2) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = 0; i < N; ++i ) {
-        POLYBENCH_MVT_BODY4;
-        for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_MVT_BODY5;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(x2,A,y2) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY4;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY5;
+          }
+          POLYBENCH_MVT_BODY6;
+        }
+      } else {
+        #pragma omp target is_device_ptr(x2,A,y2) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY4;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY5;
+          }
+          POLYBENCH_MVT_BODY6;
         }
-        POLYBENCH_MVT_BODY6;
       }
 
     }
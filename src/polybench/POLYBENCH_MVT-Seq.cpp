@@ -7,9 +7,13 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_MVT.hpp"
+#include "matvec_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/BlasUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
 
 
@@ -19,8 +23,152 @@ namespace polybench
 {
 
 
-void POLYBENCH_MVT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_MVT::runSeqVariantRowOrder(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_MVT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY2;
+          }
+          POLYBENCH_MVT_BODY3;
+        }
+
+        for (Index_type i0 = 0; i0 < N; i0 += poly_row_order_chunk ) {
+          const Index_type i_end = std::min(i0 + poly_row_order_chunk, N);
+          Real_type dots[poly_row_order_chunk];
+          for (Index_type i = i0; i < i_end; ++i ) {
+            dots[i - i0] = 0.0;
+          }
+          for (Index_type j = 0; j < N; ++j ) {
+            for (Index_type i = i0; i < i_end; ++i ) {
+              POLYBENCH_MVT_BODY5_ROW_ORDER;
+            }
+          }
+          for (Index_type i = i0; i < i_end; ++i ) {
+            x2[i] += dots[i - i0];
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_MVT : Unknown row order variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_MVT::runSeqVariantDualLayout(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_MVT_DATA_SETUP;
+  POLYBENCH_MVT_DATA_SETUP_AT;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY2;
+          }
+          POLYBENCH_MVT_BODY3;
+        }
+
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY4;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY5_AT;
+          }
+          POLYBENCH_MVT_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_MVT : Unknown dual layout variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+void POLYBENCH_MVT::runSeqVariantCblas(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_MVT_DATA_SETUP;
+  POLYBENCH_MVT_DATA_SETUP_BLAS;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        cblasGemv(false, N, N, 1.0, A, y1, 1.0, x1);
+
+        cblasGemv(true, N, N, 1.0, A, ones, 0.0, colsum);
+        cblasSbmv(N, 1.0, y2, colsum, 1.0, x2);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_MVT : Unknown cblas variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
+void POLYBENCH_MVT::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+    runSeqVariantRowOrder(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runSeqVariantDualLayout(vid);
+    return;
+  }
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+  if ( tune_idx == 3 ) {
+    runSeqVariantCblas(vid);
+    return;
+  }
+#endif
+
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_MVT_DATA_SETUP;
@@ -178,5 +326,18 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+void POLYBENCH_MVT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "row_order");
+    addVariantTuningName(vid, "dual_layout");
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+    addVariantTuningName(vid, "cblas");
+#endif
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -7,6 +7,7 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "POLYBENCH_MVT.hpp"
+#include "matvec_helper.hpp"
 
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
@@ -28,6 +29,10 @@ POLYBENCH_MVT::POLYBENCH_MVT(const RunParams& params)
 
   m_N = std::sqrt( getTargetProblemSize() ) + 1;
 
+  m_AT = nullptr;
+  m_ones = nullptr;
+  m_colsum = nullptr;
+
 
   setActualProblemSize( m_N * m_N );
 
@@ -46,6 +51,8 @@ POLYBENCH_MVT::POLYBENCH_MVT(const RunParams& params)
 
   setUsesFeature(Kernel);
 
+  setHasPattern(Streaming);
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -54,6 +61,8 @@ POLYBENCH_MVT::POLYBENCH_MVT(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -68,14 +77,36 @@ POLYBENCH_MVT::~POLYBENCH_MVT()
 {
 }
 
-void POLYBENCH_MVT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+bool POLYBENCH_MVT::usesDualLayout(VariantID vid, size_t tune_idx) const
+{
+  return poly_is_dual_layout_tuning(getVariantTuningName(vid, tune_idx));
+}
+
+bool POLYBENCH_MVT::usesBlas(VariantID vid, size_t tune_idx) const
+{
+  const std::string& name = getVariantTuningName(vid, tune_idx);
+  return name == "cblas" || name == "cublas" || name == "rocblas";
+}
+
+void POLYBENCH_MVT::setUp(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   allocAndInitData(m_y1, m_N, vid);
   allocAndInitData(m_y2, m_N, vid);
   allocAndInitData(m_A, m_N * m_N, vid);
   allocAndInitDataConst(m_x1, m_N, 0.0, vid);
   allocAndInitDataConst(m_x2, m_N, 0.0, vid);
+
+  if ( usesDualLayout(vid, tune_idx) ) {
+    allocData(m_AT, m_N * m_N, vid);
+    auto reset_A = scopedMoveData(m_A, m_N * m_N, vid);
+    auto reset_AT = scopedMoveData(m_AT, m_N * m_N, vid);
+    poly_transpose(m_AT, m_A, m_N);
+  }
+
+  if ( usesBlas(vid, tune_idx) ) {
+    allocAndInitDataConst(m_ones, m_N, 1.0, vid);
+    allocData(m_colsum, m_N, vid);
+  }
 }
 
 void POLYBENCH_MVT::updateChecksum(VariantID vid, size_t tune_idx)
@@ -84,14 +115,20 @@ void POLYBENCH_MVT::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid][tune_idx] += calcChecksum(m_x2, m_N, checksum_scale_factor , vid);
 }
 
-void POLYBENCH_MVT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_MVT::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   deallocData(m_x1, vid);
   deallocData(m_x2, vid);
   deallocData(m_y1, vid);
   deallocData(m_y2, vid);
   deallocData(m_A, vid);
+  if ( usesDualLayout(vid, tune_idx) ) {
+    deallocData(m_AT, vid);
+  }
+  if ( usesBlas(vid, tune_idx) ) {
+    deallocData(m_ones, vid);
+    deallocData(m_colsum, vid);
+  }
 }
 
 } // end namespace polybench
@@ -19,6 +19,17 @@
 ///     x2[i] += A[j][i] * y2[i];
 ///   }
 /// }
+///
+/// The second product reads A by column. The row_order tunings run it with
+/// the loop over j outside for chunks of i and the dual_layout tunings run
+/// it over a copy AT of A transposed in setUp, GPU warp_row tunings sum each
+/// row with a warp and each column with a block, see matvec_helper.hpp.
+///
+/// The cblas, cublas, and rocblas tunings compute the first product with the
+/// gemv routine of the vendor BLAS library. The second product scales the
+/// sums of the columns of A by y2, so they compute the column sums with gemv
+/// over a vector of ones and scale them with sbmv of bandwidth 0.
+///
 
 
 #ifndef RAJAPerf_POLYBENCH_MVT_HPP
@@ -32,6 +43,13 @@
   Real_ptr A = m_A; \
   const Index_type N = m_N;
 
+#define POLYBENCH_MVT_DATA_SETUP_AT \
+  Real_ptr AT = m_AT;
+
+#define POLYBENCH_MVT_DATA_SETUP_BLAS \
+  Real_ptr ones = m_ones; \
+  Real_ptr colsum = m_colsum;
+
 
 #define POLYBENCH_MVT_BODY1 \
   Real_type dot = 0.0;
@@ -51,6 +69,15 @@
 #define POLYBENCH_MVT_BODY6 \
   x2[i] += dot;
 
+#define POLYBENCH_MVT_BODY2_AT \
+  dot += AT[i + j*N] * y1[j];
+
+#define POLYBENCH_MVT_BODY5_AT \
+  dot += AT[j + i*N] * y2[i];
+
+#define POLYBENCH_MVT_BODY5_ROW_ORDER \
+  dots[i - i0] += A[i + j*N] * y2[i];
+
 
 #define POLYBENCH_MVT_BODY1_RAJA \
   dot = 0.0;
@@ -113,14 +140,34 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantRowOrder(VariantID vid);
+  void runSeqVariantDualLayout(VariantID vid);
+  void runOpenMPVariantRowOrder(VariantID vid);
+  void runOpenMPVariantDualLayout(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantWarpRow(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantWarpRow(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantDualLayout(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantDualLayout(VariantID vid);
+  void runSeqVariantCblas(VariantID vid);
+  void runCudaVariantBlas(VariantID vid);
+  void runHipVariantBlas(VariantID vid);
 
 private:
+  bool usesDualLayout(VariantID vid, size_t tune_idx) const;
+  bool usesBlas(VariantID vid, size_t tune_idx) const;
+
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
@@ -130,6 +177,9 @@ private:
   Real_ptr m_y1;
   Real_ptr m_y2;
   Real_ptr m_A;
+  Real_ptr m_AT;
+  Real_ptr m_ones;
+  Real_ptr m_colsum;
 };
 
 } // end namespace polybench
@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SEIDEL_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_seidel_2d(Real_ptr A, Index_type N, Index_type w,
+                               Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+
+  if (i < iend) {
+    POLYBENCH_SEIDEL_2D_BODY;
+  }
+}
+
+template < size_t block_size, typename Lambda >
+__launch_bounds__(block_size)
+__global__ void poly_seidel_2d_lam(Index_type ibegin, Index_type iend,
+                                   Lambda body)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+
+  if (i < iend) {
+    body(i);
+  }
+}
+
+
+template < size_t block_size >
+void POLYBENCH_SEIDEL_2D::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_SEIDEL_2D_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+        for (Index_type w = 3; w < 3*N-5; ++w) {
+
+          POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+          const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend - ibeg, block_size);
+          poly_seidel_2d<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(A, N, w,
+                         ibeg, iend);
+          cudaErrchk( cudaGetLastError() );
+
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+        for (Index_type w = 3; w < 3*N-5; ++w) {
+
+          POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+          const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend - ibeg, block_size);
+          poly_seidel_2d_lam<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(ibeg, iend,
+            [=] __device__ (Index_type i) {
+              POLYBENCH_SEIDEL_2D_BODY;
+            }
+          );
+          cudaErrchk( cudaGetLastError() );
+
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    POLYBENCH_SEIDEL_2D_VIEWS_RAJA;
+
+    using EXEC_POL = RAJA::cuda_exec<block_size, true /*async*/>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+        for (Index_type w = 3; w < 3*N-5; ++w) {
+
+          POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+          RAJA::forall<EXEC_POL>( res, RAJA::RangeSegment{ibeg, iend},
+            [=] __device__ (Index_type i) {
+              POLYBENCH_SEIDEL_2D_BODY_RAJA;
+          });
+
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_SEIDEL_2D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_SEIDEL_2D, Cuda)
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,148 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SEIDEL_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_seidel_2d(Real_ptr A, Index_type N, Index_type w,
+                               Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+
+  if (i < iend) {
+    POLYBENCH_SEIDEL_2D_BODY;
+  }
+}
+
+template < size_t block_size, typename Lambda >
+__launch_bounds__(block_size)
+__global__ void poly_seidel_2d_lam(Index_type ibegin, Index_type iend,
+                                   Lambda body)
+{
+  Index_type i = ibegin + blockIdx.x * block_size + threadIdx.x;
+
+  if (i < iend) {
+    body(i);
+  }
+}
+
+
+template < size_t block_size >
+void POLYBENCH_SEIDEL_2D::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  POLYBENCH_SEIDEL_2D_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+        for (Index_type w = 3; w < 3*N-5; ++w) {
+
+          POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+          const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend - ibeg, block_size);
+          hipLaunchKernelGGL((poly_seidel_2d<block_size>),
+                             dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                             A, N, w,
+                             ibeg, iend);
+          hipErrchk( hipGetLastError() );
+
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      constexpr size_t shmem = 0;
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+        for (Index_type w = 3; w < 3*N-5; ++w) {
+
+          POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+          const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend - ibeg, block_size);
+
+          auto poly_seidel_2d_lambda =
+            [=] __device__ (Index_type i) {
+              POLYBENCH_SEIDEL_2D_BODY;
+            };
+
+          hipLaunchKernelGGL((poly_seidel_2d_lam<block_size, decltype(poly_seidel_2d_lambda)>),
+                             dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                             ibeg, iend, poly_seidel_2d_lambda);
+          hipErrchk( hipGetLastError() );
+
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    POLYBENCH_SEIDEL_2D_VIEWS_RAJA;
+
+    using EXEC_POL = RAJA::hip_exec<block_size, true /*async*/>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+        for (Index_type w = 3; w < 3*N-5; ++w) {
+
+          POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+          RAJA::forall<EXEC_POL>( res, RAJA::RangeSegment{ibeg, iend},
+            [=] __device__ (Index_type i) {
+              POLYBENCH_SEIDEL_2D_BODY_RAJA;
+          });
+
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_SEIDEL_2D : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_SEIDEL_2D, Hip)
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SEIDEL_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+void POLYBENCH_SEIDEL_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_SEIDEL_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+          for (Index_type w = 3; w < 3*N-5; ++w) {
+
+            POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+            #pragma omp parallel for
+            for (Index_type i = ibeg; i < iend; ++i ) {
+              POLYBENCH_SEIDEL_2D_BODY;
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+          for (Index_type w = 3; w < 3*N-5; ++w) {
+
+            POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+            auto poly_seidel_2d_base_lam = [=](Index_type i) {
+              POLYBENCH_SEIDEL_2D_BODY;
+            };
+
+            #pragma omp parallel for
+            for (Index_type i = ibeg; i < iend; ++i ) {
+              poly_seidel_2d_base_lam(i);
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_SEIDEL_2D_VIEWS_RAJA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+          for (Index_type w = 3; w < 3*N-5; ++w) {
+
+            POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>( RAJA::RangeSegment{ibeg, iend},
+              [=](Index_type i) {
+                POLYBENCH_SEIDEL_2D_BODY_RAJA;
+            });
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_SEIDEL_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
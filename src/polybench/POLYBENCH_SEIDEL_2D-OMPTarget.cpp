@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SEIDEL_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+  //
+  // Define threads per team for target execution
+  //
+  const size_t threads_per_team = 256;
+
+void POLYBENCH_SEIDEL_2D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
+
+  POLYBENCH_SEIDEL_2D_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+        for (Index_type w = 3; w < 3*N-5; ++w) {
+
+          POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+          if ( omp_num_teams > 0 ) {
+            #pragma omp target is_device_ptr(A) device( did )
+            #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+            for (Index_type i = ibeg; i < iend; ++i ) {
+              POLYBENCH_SEIDEL_2D_BODY;
+            }
+          } else {
+            #pragma omp target is_device_ptr(A) device( did )
+            #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+            for (Index_type i = ibeg; i < iend; ++i ) {
+              POLYBENCH_SEIDEL_2D_BODY;
+            }
+          }
+
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    POLYBENCH_SEIDEL_2D_VIEWS_RAJA;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type t = 0; t < tsteps; ++t) {
+        for (Index_type w = 3; w < 3*N-5; ++w) {
+
+          POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+          RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+            RAJA::RangeSegment{ibeg, iend}, [=] (Index_type i) {
+              POLYBENCH_SEIDEL_2D_BODY_RAJA;
+          });
+
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_SEIDEL_2D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
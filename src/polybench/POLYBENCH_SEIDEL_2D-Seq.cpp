@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SEIDEL_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+void POLYBENCH_SEIDEL_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_SEIDEL_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+          for (Index_type w = 3; w < 3*N-5; ++w) {
+
+            POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+            for (Index_type i = ibeg; i < iend; ++i ) {
+              POLYBENCH_SEIDEL_2D_BODY;
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+          for (Index_type w = 3; w < 3*N-5; ++w) {
+
+            POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+            auto poly_seidel_2d_base_lam = [=](Index_type i) {
+              POLYBENCH_SEIDEL_2D_BODY;
+            };
+
+            for (Index_type i = ibeg; i < iend; ++i ) {
+              poly_seidel_2d_base_lam(i);
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      POLYBENCH_SEIDEL_2D_VIEWS_RAJA;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+          for (Index_type w = 3; w < 3*N-5; ++w) {
+
+            POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP;
+
+            RAJA::forall<RAJA::seq_exec>( RAJA::RangeSegment{ibeg, iend},
+              [=](Index_type i) {
+                POLYBENCH_SEIDEL_2D_BODY_RAJA;
+            });
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  POLYBENCH_SEIDEL_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SEIDEL_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_SEIDEL_2D::POLYBENCH_SEIDEL_2D(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_SEIDEL_2D, params)
+{
+  Index_type N_default = 1000;
+
+  setDefaultProblemSize( N_default * N_default );
+  setDefaultReps(4);
+
+  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+  m_tsteps = 20;
+
+
+  setActualProblemSize( (m_N-2) * (m_N-2) );
+
+  setItsPerRep( m_tsteps * (m_N-2) * (m_N-2) );
+  setKernelsPerRep( m_tsteps * (3*m_N - 8) );
+  setBytesPerRep( m_tsteps * ( (1*sizeof(Real_type ) + 0*sizeof(Real_type )) *
+                               (m_N-2) * (m_N-2) +
+                               (0*sizeof(Real_type ) + 1*sizeof(Real_type )) *
+                               (m_N * m_N - 4) ) );
+  setFLOPsPerRep( m_tsteps * 9 * (m_N-2) * (m_N-2) );
+
+  checksum_scale_factor = 0.0001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(Stencil);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+POLYBENCH_SEIDEL_2D::~POLYBENCH_SEIDEL_2D()
+{
+}
+
+void POLYBENCH_SEIDEL_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  allocAndInitData(m_Ainit, m_N*m_N, vid);
+  allocData(m_A, m_N*m_N, vid);
+}
+
+void POLYBENCH_SEIDEL_2D::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_A, m_N*m_N, checksum_scale_factor , vid);
+}
+
+void POLYBENCH_SEIDEL_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_A, vid);
+  deallocData(m_Ainit, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_SEIDEL_2D kernel reference implementation:
+///
+/// for (Index_type t = 0; t < TSTEPS; t++) {
+///   for (Index_type i = 1; i < N-1; i++) {
+///     for (Index_type j = 1; j < N-1; j++) {
+///       A[i][j] = (A[i-1][j-1] + A[i-1][j] + A[i-1][j+1] +
+///                  A[i][j-1] + A[i][j] + A[i][j+1] +
+///                  A[i+1][j-1] + A[i+1][j] + A[i+1][j+1]) / 9.0;
+///     }
+///   }
+/// }
+///
+/// Each point reads the points before it in the sweep after they are
+/// updated and the points after it before they are updated. The points on
+/// a wavefront w = 2*i + j depend only on points of earlier wavefronts, so
+/// each time step runs the wavefronts in order with the points of each
+/// wavefront in parallel, which gives the same result as the reference.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_SEIDEL_2D_HPP
+#define RAJAPerf_POLYBENCH_SEIDEL_2D_HPP
+
+#define POLYBENCH_SEIDEL_2D_DATA_SETUP \
+  Real_ptr A = m_A; \
+  \
+  copyData(getDataSpace(vid), A, getDataSpace(vid), m_Ainit, m_N*m_N); \
+  \
+  const Index_type N = m_N; \
+  const Index_type tsteps = m_tsteps;
+
+
+#define POLYBENCH_SEIDEL_2D_WAVEFRONT_SETUP \
+  const Index_type ibeg = RAJA_MAX(1, (w-N+3) / 2); \
+  const Index_type iend = RAJA_MIN(N-2, (w-1) / 2) + 1;
+
+
+#define POLYBENCH_SEIDEL_2D_BODY \
+  const Index_type j = w - 2*i; \
+  A[j + i*N] = (A[j-1 + (i-1)*N] + A[j + (i-1)*N] + A[j+1 + (i-1)*N] + \
+                A[j-1 + i*N] + A[j + i*N] + A[j+1 + i*N] + \
+                A[j-1 + (i+1)*N] + A[j + (i+1)*N] + A[j+1 + (i+1)*N]) / 9.0;
+
+
+#define POLYBENCH_SEIDEL_2D_BODY_RAJA \
+  const Index_type j = w - 2*i; \
+  Aview(i,j) = (Aview(i-1,j-1) + Aview(i-1,j) + Aview(i-1,j+1) + \
+                Aview(i,j-1) + Aview(i,j) + Aview(i,j+1) + \
+                Aview(i+1,j-1) + Aview(i+1,j) + Aview(i+1,j+1)) / 9.0;
+
+
+#define POLYBENCH_SEIDEL_2D_VIEWS_RAJA \
+  using VIEW_TYPE = RAJA::View<Real_type, \
+                               RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE Aview(A, RAJA::Layout<2>(N, N));
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_SEIDEL_2D : public KernelBase
+{
+public:
+
+  POLYBENCH_SEIDEL_2D(const RunParams& params);
+
+  ~POLYBENCH_SEIDEL_2D();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+
+  Index_type m_N;
+  Index_type m_tsteps;
+
+  Real_ptr m_A;
+  Real_ptr m_Ainit;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SYMM.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_SYMM::POLYBENCH_SYMM(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_SYMM, params)
+{
+  Index_type m_default = 1000;
+  Index_type n_default = 1000;
+
+  setDefaultProblemSize( m_default * n_default );
+  setDefaultReps(4);
+
+  m_m = std::sqrt( getTargetProblemSize() ) + 1;
+  m_n = m_m;
+
+  m_alpha = 1.5;
+  m_beta = 1.2;
+
+
+  setActualProblemSize( m_m * m_n );
+
+  setItsPerRep( m_m * m_n );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_m * m_n +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_m * m_n +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_m * (m_m+1) / 2 );
+  setFLOPsPerRep((2 * m_m +
+                  3) * m_m * m_n);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+POLYBENCH_SYMM::~POLYBENCH_SYMM()
+{
+}
+
+void POLYBENCH_SYMM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  allocAndInitData(m_A, m_m * m_m, vid);
+  allocAndInitData(m_B, m_m * m_n, vid);
+  allocAndInitData(m_C, m_m * m_n, vid);
+}
+
+void POLYBENCH_SYMM::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_C, m_m * m_n, checksum_scale_factor , vid);
+}
+
+void POLYBENCH_SYMM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_A, vid);
+  deallocData(m_B, vid);
+  deallocData(m_C, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_SYMM kernel reference implementation:
+///
+/// for (Index_type i = 0; i < M; i++) {
+///   for (Index_type j = 0; j < N; j++) {
+///     Real_type dot = 0.0;
+///     for (Index_type k = 0; k < i; k++) {
+///       C[k][j] += alpha * B[i][j] * A[i][k];
+///       dot += B[k][j] * A[i][k];
+///     }
+///     C[i][j] = beta * C[i][j] + alpha * B[i][j] * A[i][i] + alpha * dot;
+///   }
+/// }
+///
+/// The reference updates rows k < i of C while computing row i, which
+/// races when rows run in parallel. Here each entry of C is computed on
+/// its own from the lower triangle of the symmetric A, which gives
+///
+/// C[i][j] = beta * C[i][j] + alpha * sum_k A(i,k) * B[k][j]
+///
+/// with A(i,k) = A[i][k] for k <= i and A[k][i] for k > i.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_SYMM_HPP
+#define RAJAPerf_POLYBENCH_SYMM_HPP
+
+#define POLYBENCH_SYMM_DATA_SETUP \
+  const Index_type m = m_m; \
+  const Index_type n = m_n; \
+\
+  Real_type alpha = m_alpha; \
+  Real_type beta = m_beta; \
+\
+  Real_ptr A = m_A; \
+  Real_ptr B = m_B; \
+  Real_ptr C = m_C;
+
+
+#define POLYBENCH_SYMM_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < i; ++k) { \
+    dot += A[k + i*m] * B[j + k*n]; \
+  } \
+  for (Index_type k = i; k < m; ++k) { \
+    dot += A[i + k*m] * B[j + k*n]; \
+  } \
+  C[j + i*n] = beta * C[j + i*n] + alpha * dot;
+
+
+#define POLYBENCH_SYMM_BODY_RAJA \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < i; ++k) { \
+    dot += Aview(i, k) * Bview(k, j); \
+  } \
+  for (Index_type k = i; k < m; ++k) { \
+    dot += Aview(k, i) * Bview(k, j); \
+  } \
+  Cview(i, j) = beta * Cview(i, j) + alpha * dot;
+
+
+#define POLYBENCH_SYMM_VIEWS_RAJA \
+  using VIEW_TYPE = RAJA::View<Real_type, \
+                               RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE Aview(A, RAJA::Layout<2>(m, m)); \
+  VIEW_TYPE Bview(B, RAJA::Layout<2>(m, n)); \
+  VIEW_TYPE Cview(C, RAJA::Layout<2>(m, n));
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_SYMM : public KernelBase
+{
+public:
+
+  POLYBENCH_SYMM(const RunParams& params);
+
+  ~POLYBENCH_SYMM();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+
+  Index_type m_m;
+  Index_type m_n;
+
+  Real_type m_alpha;
+  Real_type m_beta;
+  Real_ptr m_A;
+  Real_ptr m_B;
+  Real_ptr m_C;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
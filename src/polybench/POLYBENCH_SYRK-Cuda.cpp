@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SYRK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Define thread block shape for CUDA execution
+//
+#define j_block_sz (32)
+#define i_block_sz (block_size / j_block_sz)
+
+#define POLY_SYRK_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA \
+  j_block_sz, i_block_sz
+
+#define POLY_SYRK_THREADS_PER_BLOCK_CUDA \
+  dim3 nthreads_per_block(POLY_SYRK_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA, 1);
+
+
+template < size_t j_block_size, size_t i_block_size >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_syrk(Real_ptr C, Real_ptr A, Real_type alpha,
+                          Real_type beta, Index_type n, Index_type m,
+                          Index_type ibegin, Index_type iend,
+                          Index_type jbegin, Index_type jend)
+{
+  Index_type i = ibegin + blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = jbegin + blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < iend && j < jend && j <= i ) {
+    POLYBENCH_SYRK_BODY;
+  }
+}
+
+template < size_t j_block_size, size_t i_block_size, typename Lambda >
+__launch_bounds__(j_block_size*i_block_size)
+__global__ void poly_syrk_lam_2d(Index_type ibegin, Index_type iend,
+                                 Index_type jbegin, Index_type jend,
+                                 Lambda body)
+{
+  Index_type i = ibegin + blockIdx.y * i_block_size + threadIdx.y;
+  Index_type j = jbegin + blockIdx.x * j_block_size + threadIdx.x;
+
+  if ( i < iend && j < jend ) {
+    body(i, j);
+  }
+}
+
+
+template < size_t block_size >
+void POLYBENCH_SYRK::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  POLYBENCH_SYRK_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      POLY_SYRK_THREADS_PER_BLOCK_CUDA;
+      constexpr size_t shmem = 0;
+
+      dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n, j_block_sz)),
+                   static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n, i_block_sz)),
+                   static_cast<size_t>(1));
+      poly_syrk<POLY_SYRK_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+               <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(C, A, alpha, beta, n, m,
+                  0, n,
+                  0, n);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == Lambda_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      POLY_SYRK_THREADS_PER_BLOCK_CUDA;
+      constexpr size_t shmem = 0;
+
+      dim3 nblocks(static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n, j_block_sz)),
+                   static_cast<size_t>(RAJA_DIVIDE_CEILING_INT(n, i_block_sz)),
+                   static_cast<size_t>(1));
+      poly_syrk_lam_2d<POLY_SYRK_THREADS_PER_BLOCK_TEMPLATE_PARAMS_CUDA>
+                      <<<nblocks, nthreads_per_block, shmem, res.get_stream()>>>(
+        0, n, 0, n,
+        [=] __device__ (Index_type i, Index_type j) {
+          if (j <= i) {
+            POLYBENCH_SYRK_BODY;
+          }
+        }
+      );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    POLYBENCH_SYRK_VIEWS_RAJA;
+
+    using EXEC_POL =
+      RAJA::KernelPolicy<
+        RAJA::statement::CudaKernelFixedAsync<i_block_sz * j_block_sz,
+          RAJA::statement::For<0, RAJA::cuda_global_size_y_direct<i_block_sz>,   // i
+            RAJA::statement::For<1, RAJA::cuda_global_size_x_direct<j_block_sz>, // j
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::kernel_resource<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{0, n},
+                                                        RAJA::RangeSegment{0, n}),
+                                       res,
+        [=] __device__ (Index_type i, Index_type j) {
+          if (j <= i) {
+            POLYBENCH_SYRK_BODY_RAJA;
+          }
+        }
+      );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  POLYBENCH_SYRK : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_SYRK, Cuda)
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
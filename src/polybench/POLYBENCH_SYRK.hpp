@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_SYRK kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; i++) {
+///   for (Index_type j = 0; j <= i; j++) {
+///     C[i][j] *= beta;
+///   }
+///   for (Index_type k = 0; k < M; k++) {
+///     for (Index_type j = 0; j <= i; j++) {
+///       C[i][j] += alpha * A[i][k] * A[j][k];
+///     }
+///   }
+/// }
+///
+/// Each entry of the lower triangle of C is computed with its k loop
+/// innermost, which sums in the same order as the reference. GPU and RAJA
+/// variants run the square of i, j and skip the entries above the diagonal.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_SYRK_HPP
+#define RAJAPerf_POLYBENCH_SYRK_HPP
+
+#define POLYBENCH_SYRK_DATA_SETUP \
+  const Index_type n = m_n; \
+  const Index_type m = m_m; \
+\
+  Real_type alpha = m_alpha; \
+  Real_type beta = m_beta; \
+\
+  Real_ptr A = m_A; \
+  Real_ptr C = m_C;
+
+
+#define POLYBENCH_SYRK_BODY \
+  Real_type dot = beta * C[j + i*n]; \
+  for (Index_type k = 0; k < m; ++k) { \
+    dot += alpha * A[k + i*m] * A[k + j*m]; \
+  } \
+  C[j + i*n] = dot;
+
+
+#define POLYBENCH_SYRK_BODY_RAJA \
+  Real_type dot = beta * Cview(i, j); \
+  for (Index_type k = 0; k < m; ++k) { \
+    dot += alpha * Aview(i, k) * Aview(j, k); \
+  } \
+  Cview(i, j) = dot;
+
+
+#define POLYBENCH_SYRK_VIEWS_RAJA \
+  using VIEW_TYPE = RAJA::View<Real_type, \
+                               RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE Aview(A, RAJA::Layout<2>(n, m)); \
+  VIEW_TYPE Cview(C, RAJA::Layout<2>(n, n));
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_SYRK : public KernelBase
+{
+public:
+
+  POLYBENCH_SYRK(const RunParams& params);
+
+  ~POLYBENCH_SYRK();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+
+  Index_type m_n;
+  Index_type m_m;
+
+  Real_type m_alpha;
+  Real_type m_beta;
+  Real_ptr m_A;
+  Real_ptr m_C;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
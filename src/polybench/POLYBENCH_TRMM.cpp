@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_TRMM.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_TRMM::POLYBENCH_TRMM(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_TRMM, params)
+{
+  Index_type m_default = 1000;
+  Index_type n_default = 1000;
+
+  setDefaultProblemSize( m_default * n_default );
+  setDefaultReps(4);
+
+  m_m = std::sqrt( getTargetProblemSize() ) + 1;
+  m_n = m_m;
+
+  m_alpha = 1.5;
+
+
+  setActualProblemSize( m_m * m_n );
+
+  setItsPerRep( m_m * m_n );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_m * m_n +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_m * (m_m-1) / 2 );
+  setFLOPsPerRep(m_m * m_m * m_n);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+
+  setHasPattern(ComputeBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+POLYBENCH_TRMM::~POLYBENCH_TRMM()
+{
+}
+
+void POLYBENCH_TRMM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  allocAndInitData(m_A, m_m * m_m, vid);
+  allocAndInitData(m_Bin, m_m * m_n, vid);
+  allocAndInitDataConst(m_Bout, m_m * m_n, 0.0, vid);
+}
+
+void POLYBENCH_TRMM::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_Bout, m_m * m_n, checksum_scale_factor , vid);
+}
+
+void POLYBENCH_TRMM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_A, vid);
+  deallocData(m_Bin, vid);
+  deallocData(m_Bout, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
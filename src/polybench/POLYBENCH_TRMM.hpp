@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_TRMM kernel reference implementation:
+///
+/// for (Index_type i = 0; i < M; i++) {
+///   for (Index_type j = 0; j < N; j++) {
+///     for (Index_type k = i+1; k < M; k++) {
+///       B[i][j] += A[k][i] * B[k][j];
+///     }
+///     B[i][j] = alpha * B[i][j];
+///   }
+/// }
+///
+/// The reference updates B in place in increasing order of i, reading
+/// rows k > i that are not yet updated. Here the result goes to a separate
+/// array Bout so the rows are independent and run in parallel.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_TRMM_HPP
+#define RAJAPerf_POLYBENCH_TRMM_HPP
+
+#define POLYBENCH_TRMM_DATA_SETUP \
+  const Index_type m = m_m; \
+  const Index_type n = m_n; \
+\
+  Real_type alpha = m_alpha; \
+\
+  Real_ptr A = m_A; \
+  Real_ptr Bin = m_Bin; \
+  Real_ptr Bout = m_Bout;
+
+
+#define POLYBENCH_TRMM_BODY \
+  Real_type dot = Bin[j + i*n]; \
+  for (Index_type k = i+1; k < m; ++k) { \
+    dot += A[i + k*m] * Bin[j + k*n]; \
+  } \
+  Bout[j + i*n] = alpha * dot;
+
+
+#define POLYBENCH_TRMM_BODY_RAJA \
+  Real_type dot = Binview(i, j); \
+  for (Index_type k = i+1; k < m; ++k) { \
+    dot += Aview(k, i) * Binview(k, j); \
+  } \
+  Boutview(i, j) = alpha * dot;
+
+
+#define POLYBENCH_TRMM_VIEWS_RAJA \
+  using VIEW_TYPE = RAJA::View<Real_type, \
+                               RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE Aview(A, RAJA::Layout<2>(m, m)); \
+  VIEW_TYPE Binview(Bin, RAJA::Layout<2>(m, n)); \
+  VIEW_TYPE Boutview(Bout, RAJA::Layout<2>(m, n));
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_TRMM : public KernelBase
+{
+public:
+
+  POLYBENCH_TRMM(const RunParams& params);
+
+  ~POLYBENCH_TRMM();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+
+  Index_type m_m;
+  Index_type m_n;
+
+  Real_type m_alpha;
+  Real_ptr m_A;
+  Real_ptr m_Bin;
+  Real_ptr m_Bout;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Line solvers used by the tunings of the Polybench ADI kernel. Each sweep
+/// of ADI solves n-2 independent tridiagonal systems, one per line, of the
+/// form
+///
+///   l*x[j-1] + m*x[j] + r*x[j+1] = rhs[j],  j = 1, ..., n-2
+///
+/// with x[0] = x[n-1] = 1. The default tunings solve a line with the Thomas
+/// algorithm in the scratch arrays P and Q indexed [line][j].
+///
+/// The interleaved and line_batch tunings index P and Q [j][line], so the
+/// recurrences of neighboring lines read neighboring entries. CPU line_batch
+/// tunings advance the recurrences of poly_adi_line_batch lines together in
+/// the inner loop, GPU interleaved tunings run a line per thread as the
+/// default tunings. Both compute the same values as the default tunings.
+///
+/// The GPU pcr tunings solve a line per thread block with parallel cyclic
+/// reduction in shared memory, which sums in a different order than the
+/// Thomas algorithm, so their checksums differ by rounding.
+///
+
+#ifndef RAJAPerf_POLYBENCH_ADI_HELPER_HPP
+#define RAJAPerf_POLYBENCH_ADI_HELPER_HPP
+
+#include "common/RPTypes.hpp"
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Number of lines whose recurrences CPU line_batch tunings interleave.
+//
+constexpr Index_type poly_adi_line_batch = 8;
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+
+//
+// The pcr tunings keep the coefficients of a line in 4*(n-2) values of
+// dynamic shared memory and up to poly_adi_pcr_items equations of a line
+// in the registers of each thread.
+//
+constexpr Index_type poly_adi_pcr_items = 4;
+constexpr size_t poly_adi_pcr_max_shmem = 48*1024;
+
+inline size_t poly_adi_pcr_shmem(Index_type n)
+{
+  return 4 * (n-2) * sizeof(Real_type);
+}
+
+//
+// Return if the pcr tunings can solve lines of n points with block_size.
+//
+inline bool poly_adi_pcr_fits(Index_type n, size_t block_size)
+{
+  return n > 2 &&
+         n-2 <= poly_adi_pcr_items * static_cast<Index_type>(block_size) &&
+         poly_adi_pcr_shmem(n) <= poly_adi_pcr_max_shmem;
+}
+
+//
+// Solve the m equations sa[j]*x[j-1] + sb[j]*x[j] + sc[j]*x[j+1] = sd[j]
+// in shared memory with sa[0] = sc[m-1] = 0, leaving x[j] in sd[j].
+// Each step eliminates the unknowns s away from every equation, the new
+// equations are kept in registers until all threads have read the old ones.
+// Every thread in the block must call this.
+//
+template < size_t block_size >
+__device__ __forceinline__ void poly_adi_pcr_solve(Real_ptr sa, Real_ptr sb,
+                                                   Real_ptr sc, Real_ptr sd,
+                                                   Index_type m)
+{
+  Real_type na[poly_adi_pcr_items];
+  Real_type nb[poly_adi_pcr_items];
+  Real_type nc[poly_adi_pcr_items];
+  Real_type nd[poly_adi_pcr_items];
+
+  for (Index_type s = 1; s < m; s *= 2) {
+
+    for (Index_type r = 0; r < poly_adi_pcr_items; ++r) {
+      const Index_type j = threadIdx.x + r * block_size;
+      if (j < m) {
+        Real_type aj = 0.0;
+        Real_type bj = sb[j];
+        Real_type cj = 0.0;
+        Real_type dj = sd[j];
+        if (j - s >= 0) {
+          const Real_type k1 = sa[j] / sb[j-s];
+          aj = -sa[j-s] * k1;
+          bj -= sc[j-s] * k1;
+          dj -= sd[j-s] * k1;
+        }
+        if (j + s < m) {
+          const Real_type k2 = sc[j] / sb[j+s];
+          cj = -sc[j+s] * k2;
+          bj -= sa[j+s] * k2;
+          dj -= sd[j+s] * k2;
+        }
+        na[r] = aj;
+        nb[r] = bj;
+        nc[r] = cj;
+        nd[r] = dj;
+      }
+    }
+    __syncthreads();
+
+    for (Index_type r = 0; r < poly_adi_pcr_items; ++r) {
+      const Index_type j = threadIdx.x + r * block_size;
+      if (j < m) {
+        sa[j] = na[r];
+        sb[j] = nb[r];
+        sc[j] = nc[r];
+        sd[j] = nd[r];
+      }
+    }
+    __syncthreads();
+
+  }
+
+  for (Index_type j = threadIdx.x; j < m; j += block_size) {
+    sd[j] /= sb[j];
+  }
+  __syncthreads();
+}
+
+#endif
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
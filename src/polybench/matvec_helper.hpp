@@ -0,0 +1,151 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Matrix vector product helpers used by the transpose aware tunings of the
+/// Polybench ATAX, MVT, GESUMMV, and GEMVER kernels, which multiply by the
+/// row major matrix A (row pass) and by its transpose (column pass).
+///
+/// CPU row_order tunings run the column pass with the loop over rows
+/// outside, so they read A with stride 1, and dual_layout tunings also keep
+/// the transpose AT of A and run the column pass as a row pass over AT.
+/// Both add the terms of each sum in the same order as the default tunings.
+///
+/// GPU warp_row tunings sum each row with a warp, so the warp reads
+/// consecutive entries of the row, and sum each column with the rows of
+/// threads of a block, so the threads of a warp read consecutive entries of
+/// a row, and combine the partial sums in shared memory. These add the terms
+/// in a different order, so their checksums differ by rounding. GPU
+/// dual_layout tunings run the row pass with a thread per row over AT, so
+/// both passes read the matrices coalesced and add the terms in the same
+/// order as the default tunings.
+///
+
+#ifndef RAJAPerf_POLYBENCH_MATVEC_HELPER_HPP
+#define RAJAPerf_POLYBENCH_MATVEC_HELPER_HPP
+
+#include "RAJA/RAJA.hpp"
+#include "common/RPTypes.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Return if the named tuning keeps the transpose of A.
+//
+inline bool poly_is_dual_layout_tuning(const std::string& tuning_name)
+{
+  return tuning_name.compare(0, 11, "dual_layout") == 0;
+}
+
+//
+// Number of columns each thread updates in OpenMP row_order column passes.
+//
+constexpr Index_type poly_row_order_chunk = 256;
+
+//
+// Set the n x n matrix out to the transpose of in.
+//
+inline void poly_transpose(Real_ptr out, const Real_type* in, Index_type n)
+{
+  for (Index_type i = 0; i < n; ++i) {
+    for (Index_type j = 0; j < n; ++j) {
+      out[i + j*n] = in[j + i*n];
+    }
+  }
+}
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+
+#if defined(__HIPCC__)
+constexpr size_t poly_warp_size = hip_warp_size;
+#else
+constexpr size_t poly_warp_size = cuda_warp_size;
+#endif
+
+//
+// Width of the column tile of blocks in column passes, the blocks are
+// poly_column_width x (block_size / poly_column_width) threads.
+//
+constexpr size_t poly_column_width = 32;
+
+//
+// Sum term(j) for j in [0, n) over the lanes of a warp, lane l adds the
+// terms l, l + warp size, ..., the result is valid in lane 0.
+// Every thread in the warp must call this.
+//
+template < typename Term >
+__device__ __forceinline__ Real_type poly_warp_row_sum(Index_type n, Term term)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+
+  Real_type sum = 0.0;
+  for (Index_type j = threadIdx.x % poly_warp_size; j < n; j += poly_warp_size) {
+    sum += term(j);
+  }
+
+#if defined(__HIPCC__)
+  return hip_warp_reduce<sum_op>(sum);
+#else
+  return cuda_warp_reduce<sum_op>(sum);
+#endif
+}
+
+//
+// Sum term(i) for i in [0, n) over the rows of threads of the block, row r
+// adds the terms r, r + rows, ..., the result is valid in the threads with
+// threadIdx.y == 0. Threads whose column is outside the matrix pass
+// active = false. Every thread in the block must call this once.
+//
+template < size_t block_size, typename Term >
+__device__ __forceinline__ Real_type poly_block_column_sum(Index_type n,
+                                                           bool active,
+                                                           Term term)
+{
+  // block sizes below the column width are never run, keep them compiling
+  constexpr size_t rows = (block_size < poly_column_width)
+                        ? 1 : block_size / poly_column_width;
+
+  __shared__ Real_type partial[rows][poly_column_width];
+
+  Real_type sum = 0.0;
+  if (active) {
+    for (Index_type i = threadIdx.y; i < n; i += rows) {
+      sum += term(i);
+    }
+  }
+  partial[threadIdx.y][threadIdx.x] = sum;
+  __syncthreads();
+
+  if (threadIdx.y == 0) {
+    for (size_t r = 1; r < rows; ++r) {
+      sum += partial[r][threadIdx.x];
+    }
+  }
+  return sum;
+}
+
+//
+// Return if the warp_row tunings may run with block_size.
+//
+constexpr bool poly_valid_warp_row_block_size(size_t block_size)
+{
+  return block_size % poly_warp_size == 0 &&
+         block_size % poly_column_width == 0;
+}
+
+#endif
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,286 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Blocked in place Floyd-Warshall used by the tile tunings of the
+/// Polybench FLOYD_WARSHALL_INPLACE kernel. For each diagonal tile kt the
+/// k steps of tile kt are applied to
+///
+///   1. tile (kt, kt),
+///   2. the tiles (kt, t) and (t, kt), t != kt, which read tile (kt, kt),
+///   3. the tiles (it, jt), it != kt and jt != kt, which read the tiles
+///      (it, kt) and (kt, jt).
+///
+/// Every entry takes the minimum with the same sums in the same k order as
+/// the untiled variants, so the tile tunings produce the same checksums.
+///
+
+#ifndef RAJAPerf_POLYBENCH_TILED_FLOYD_WARSHALL_HELPER_HPP
+#define RAJAPerf_POLYBENCH_TILED_FLOYD_WARSHALL_HELPER_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Apply the k steps [k0, k_end) to the entries in rows [i0, i_end) and
+// columns [j0, j_end) of p.
+//
+inline void poly_floyd_warshall_tile(Real_ptr p, Index_type N,
+                                     Index_type i0, Index_type i_end,
+                                     Index_type j0, Index_type j_end,
+                                     Index_type k0, Index_type k_end)
+{
+  for (Index_type k = k0; k < k_end; ++k) {
+    for (Index_type i = i0; i < i_end; ++i) {
+      const Real_type p_ik = p[k + i*N];
+      for (Index_type j = j0; j < j_end; ++j) {
+        const Real_type path = p_ik + p[j + k*N];
+        p[j + i*N] = p[j + i*N] < path ? p[j + i*N] : path;
+      }
+    }
+  }
+}
+
+template < Index_type tile_size >
+inline void poly_floyd_warshall_tiled_seq(Real_ptr p, Index_type N)
+{
+  for (Index_type k0 = 0; k0 < N; k0 += tile_size) {
+    const Index_type k_end = std::min(k0 + tile_size, N);
+
+    poly_floyd_warshall_tile(p, N, k0, k_end, k0, k_end, k0, k_end);
+
+    for (Index_type t0 = 0; t0 < N; t0 += tile_size) {
+      if (t0 == k0) { continue; }
+      const Index_type t_end = std::min(t0 + tile_size, N);
+      poly_floyd_warshall_tile(p, N, k0, k_end, t0, t_end, k0, k_end);
+      poly_floyd_warshall_tile(p, N, t0, t_end, k0, k_end, k0, k_end);
+    }
+
+    for (Index_type i0 = 0; i0 < N; i0 += tile_size) {
+      if (i0 == k0) { continue; }
+      const Index_type i_end = std::min(i0 + tile_size, N);
+      for (Index_type j0 = 0; j0 < N; j0 += tile_size) {
+        if (j0 == k0) { continue; }
+        const Index_type j_end = std::min(j0 + tile_size, N);
+        poly_floyd_warshall_tile(p, N, i0, i_end, j0, j_end, k0, k_end);
+      }
+    }
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// The tiles of a phase are independent, the thread team is made once and
+// the implicit barriers of the worksharing loops order the phases.
+//
+template < Index_type tile_size >
+inline void poly_floyd_warshall_tiled_omp(Real_ptr p, Index_type N)
+{
+  const Index_type nt = (N + tile_size - 1) / tile_size;
+
+  #pragma omp parallel
+  for (Index_type kt = 0; kt < nt; ++kt) {
+    const Index_type k0 = kt * tile_size;
+    const Index_type k_end = std::min(k0 + tile_size, N);
+
+    #pragma omp single
+    poly_floyd_warshall_tile(p, N, k0, k_end, k0, k_end, k0, k_end);
+
+    #pragma omp for
+    for (Index_type t = 0; t < nt; ++t) {
+      if (t == kt) { continue; }
+      const Index_type t0 = t * tile_size;
+      const Index_type t_end = std::min(t0 + tile_size, N);
+      poly_floyd_warshall_tile(p, N, k0, k_end, t0, t_end, k0, k_end);
+      poly_floyd_warshall_tile(p, N, t0, t_end, k0, k_end, k0, k_end);
+    }
+
+    #pragma omp for collapse(2)
+    for (Index_type it = 0; it < nt; ++it) {
+      for (Index_type jt = 0; jt < nt; ++jt) {
+        if (it == kt || jt == kt) { continue; }
+        const Index_type i0 = it * tile_size;
+        const Index_type j0 = jt * tile_size;
+        poly_floyd_warshall_tile(p, N, i0, std::min(i0 + tile_size, N),
+                                       j0, std::min(j0 + tile_size, N),
+                                       k0, k_end);
+      }
+    }
+  }
+}
+
+#endif
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+
+//
+// The GPU phases run with tile_size x (tile_size / reg_size) threads per
+// block, each thread updates reg_size entries of a tile held in shared
+// memory. Entries outside the matrix are only read by other entries
+// outside the matrix and are never stored.
+//
+
+template < size_t tile_size, size_t reg_size >
+__launch_bounds__(tile_size*(tile_size/reg_size))
+__global__ void poly_floyd_warshall_tiled_diag(Real_ptr p, Index_type k0,
+                                               Index_type N)
+{
+  constexpr size_t rows_per_pass = tile_size / reg_size;
+
+  __shared__ Real_type kk_tile[tile_size][tile_size];
+
+  const Index_type j = k0 + threadIdx.x;
+
+  for (size_t r = 0; r < reg_size; ++r) {
+    const Index_type row = threadIdx.y + r * rows_per_pass;
+    const Index_type i = k0 + row;
+    kk_tile[row][threadIdx.x] = (i < N && j < N) ? p[j + i*N] : 0.0;
+  }
+
+  const Index_type k_len = (N - k0 < static_cast<Index_type>(tile_size))
+                         ? N - k0 : static_cast<Index_type>(tile_size);
+  for (Index_type k = 0; k < k_len; ++k) {
+    __syncthreads();
+    for (size_t r = 0; r < reg_size; ++r) {
+      const Index_type row = threadIdx.y + r * rows_per_pass;
+      const Real_type path = kk_tile[row][k] + kk_tile[k][threadIdx.x];
+      kk_tile[row][threadIdx.x] = kk_tile[row][threadIdx.x] < path
+                                ? kk_tile[row][threadIdx.x] : path;
+    }
+  }
+
+  for (size_t r = 0; r < reg_size; ++r) {
+    const Index_type row = threadIdx.y + r * rows_per_pass;
+    const Index_type i = k0 + row;
+    if ( i < N && j < N ) {
+      p[j + i*N] = kk_tile[row][threadIdx.x];
+    }
+  }
+}
+
+//
+// blockIdx.x is the tile t, blockIdx.y is 0 for tile (kt, t) and 1 for
+// tile (t, kt).
+//
+template < size_t tile_size, size_t reg_size >
+__launch_bounds__(tile_size*(tile_size/reg_size))
+__global__ void poly_floyd_warshall_tiled_cross(Real_ptr p, Index_type k0,
+                                                Index_type N)
+{
+  constexpr size_t rows_per_pass = tile_size / reg_size;
+
+  const Index_type t0 = blockIdx.x * tile_size;
+  if (t0 == k0) {
+    return;
+  }
+  const bool in_row = (blockIdx.y == 0);
+  const Index_type i0 = in_row ? k0 : t0;
+  const Index_type j0 = in_row ? t0 : k0;
+
+  __shared__ Real_type kk_tile[tile_size][tile_size];
+  __shared__ Real_type tile[tile_size][tile_size];
+
+  const Index_type j = j0 + threadIdx.x;
+  const Index_type kj = k0 + threadIdx.x;
+
+  for (size_t r = 0; r < reg_size; ++r) {
+    const Index_type row = threadIdx.y + r * rows_per_pass;
+    const Index_type i = i0 + row;
+    const Index_type ki = k0 + row;
+    kk_tile[row][threadIdx.x] = (ki < N && kj < N) ? p[kj + ki*N] : 0.0;
+    tile[row][threadIdx.x] = (i < N && j < N) ? p[j + i*N] : 0.0;
+  }
+
+  const Index_type k_len = (N - k0 < static_cast<Index_type>(tile_size))
+                         ? N - k0 : static_cast<Index_type>(tile_size);
+  for (Index_type k = 0; k < k_len; ++k) {
+    __syncthreads();
+    for (size_t r = 0; r < reg_size; ++r) {
+      const Index_type row = threadIdx.y + r * rows_per_pass;
+      const Real_type path = in_row
+          ? kk_tile[row][k] + tile[k][threadIdx.x]
+          : tile[row][k] + kk_tile[k][threadIdx.x];
+      tile[row][threadIdx.x] = tile[row][threadIdx.x] < path
+                             ? tile[row][threadIdx.x] : path;
+    }
+  }
+
+  for (size_t r = 0; r < reg_size; ++r) {
+    const Index_type row = threadIdx.y + r * rows_per_pass;
+    const Index_type i = i0 + row;
+    if ( i < N && j < N ) {
+      p[j + i*N] = tile[row][threadIdx.x];
+    }
+  }
+}
+
+//
+// blockIdx.x and blockIdx.y are the tile column and row, the tiles read
+// are not written in this phase so each entry is kept in a register.
+//
+template < size_t tile_size, size_t reg_size >
+__launch_bounds__(tile_size*(tile_size/reg_size))
+__global__ void poly_floyd_warshall_tiled_rest(Real_ptr p, Index_type k0,
+                                               Index_type N)
+{
+  constexpr size_t rows_per_pass = tile_size / reg_size;
+
+  const Index_type i0 = blockIdx.y * tile_size;
+  const Index_type j0 = blockIdx.x * tile_size;
+  if (i0 == k0 || j0 == k0) {
+    return;
+  }
+
+  __shared__ Real_type ik_tile[tile_size][tile_size];
+  __shared__ Real_type kj_tile[tile_size][tile_size];
+
+  const Index_type j = j0 + threadIdx.x;
+  const Index_type kj = k0 + threadIdx.x;
+
+  Real_type val[reg_size];
+  for (size_t r = 0; r < reg_size; ++r) {
+    const Index_type row = threadIdx.y + r * rows_per_pass;
+    const Index_type i = i0 + row;
+    const Index_type ki = k0 + row;
+    ik_tile[row][threadIdx.x] = (i < N && kj < N) ? p[kj + i*N] : 0.0;
+    kj_tile[row][threadIdx.x] = (ki < N && j < N) ? p[j + ki*N] : 0.0;
+    val[r] = (i < N && j < N) ? p[j + i*N] : 0.0;
+  }
+  __syncthreads();
+
+  const Index_type k_len = (N - k0 < static_cast<Index_type>(tile_size))
+                         ? N - k0 : static_cast<Index_type>(tile_size);
+  for (Index_type k = 0; k < k_len; ++k) {
+    const Real_type p_kj = kj_tile[k][threadIdx.x];
+    for (size_t r = 0; r < reg_size; ++r) {
+      const Real_type path = ik_tile[threadIdx.y + r * rows_per_pass][k] + p_kj;
+      val[r] = val[r] < path ? val[r] : path;
+    }
+  }
+
+  for (size_t r = 0; r < reg_size; ++r) {
+    const Index_type i = i0 + threadIdx.y + r * rows_per_pass;
+    if ( i < N && j < N ) {
+      p[j + i*N] = val[r];
+    }
+  }
+}
+
+#endif
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
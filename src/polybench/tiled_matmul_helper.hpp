@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tiled matrix products used by the tile tunings of the Polybench
+/// GEMM, 2MM, and 3MM kernels. Each computes
+///
+/// for (Index_type i = 0; i < ni; i++) {
+///   for (Index_type j = 0; j < nj; j++) {
+///     Real_type dot = init;
+///     for (Index_type k = 0; k < nk; k++) {
+///       dot += alpha * a[i][k] * b[k][j];
+///     }
+///     out[i][j] = dot;
+///   }
+/// }
+///
+/// Every output accumulates over k in increasing order, as the untiled
+/// variants do, so the tile tunings produce the same checksums.
+///
+
+#ifndef RAJAPerf_POLYBENCH_TILED_MATMUL_HELPER_HPP
+#define RAJAPerf_POLYBENCH_TILED_MATMUL_HELPER_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// Cache blocked product, each thread computes tile_size x tile_size blocks
+// of out with the inner loops over k and j to stream through rows of b.
+//
+template < Index_type tile_size >
+inline void poly_matmul_tiled_omp(Real_ptr out, const Real_type* a,
+                                  const Real_type* b,
+                                  Real_type alpha, Real_type init,
+                                  Index_type ni, Index_type nj, Index_type nk)
+{
+  #pragma omp parallel for collapse(2)
+  for (Index_type i0 = 0; i0 < ni; i0 += tile_size) {
+    for (Index_type j0 = 0; j0 < nj; j0 += tile_size) {
+
+      const Index_type i_end = std::min(i0 + tile_size, ni);
+      const Index_type j_end = std::min(j0 + tile_size, nj);
+
+      Real_type dot[tile_size][tile_size];
+      for (Index_type i = i0; i < i_end; ++i) {
+        for (Index_type j = j0; j < j_end; ++j) {
+          dot[i-i0][j-j0] = init;
+        }
+      }
+
+      for (Index_type k0 = 0; k0 < nk; k0 += tile_size) {
+        const Index_type k_end = std::min(k0 + tile_size, nk);
+        for (Index_type i = i0; i < i_end; ++i) {
+          for (Index_type k = k0; k < k_end; ++k) {
+            const Real_type a_ik = alpha * a[k + i*nk];
+            for (Index_type j = j0; j < j_end; ++j) {
+              dot[i-i0][j-j0] += a_ik * b[j + k*nj];
+            }
+          }
+        }
+      }
+
+      for (Index_type i = i0; i < i_end; ++i) {
+        for (Index_type j = j0; j < j_end; ++j) {
+          out[j + i*nj] = dot[i-i0][j-j0];
+        }
+      }
+
+    }
+  }
+}
+
+#endif
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+
+//
+// Shared memory tiled product run with tile_size x (tile_size / reg_size)
+// threads per block, each thread computes reg_size outputs of a
+// tile_size x tile_size block of out held in registers.
+//
+template < size_t tile_size, size_t reg_size >
+__launch_bounds__(tile_size*(tile_size/reg_size))
+__global__ void poly_matmul_tiled(Real_ptr out, const Real_type* a,
+                                  const Real_type* b,
+                                  Real_type alpha, Real_type init,
+                                  Index_type ni, Index_type nj, Index_type nk)
+{
+  constexpr size_t rows_per_pass = tile_size / reg_size;
+
+  __shared__ Real_type a_tile[tile_size][tile_size];
+  __shared__ Real_type b_tile[tile_size][tile_size];
+
+  const Index_type i0 = blockIdx.y * tile_size;
+  const Index_type j = blockIdx.x * tile_size + threadIdx.x;
+
+  Real_type dot[reg_size];
+  for (size_t r = 0; r < reg_size; ++r) {
+    dot[r] = init;
+  }
+
+  for (Index_type k0 = 0; k0 < nk; k0 += tile_size) {
+
+    for (size_t r = 0; r < reg_size; ++r) {
+      const Index_type row = threadIdx.y + r * rows_per_pass;
+      const Index_type i = i0 + row;
+      const Index_type ka = k0 + threadIdx.x;
+      const Index_type kb = k0 + row;
+      a_tile[row][threadIdx.x] = (i < ni && ka < nk) ? a[ka + i*nk] : 0.0;
+      b_tile[row][threadIdx.x] = (kb < nk && j < nj) ? b[j + kb*nj] : 0.0;
+    }
+    __syncthreads();
+
+    const Index_type k_len = (nk - k0 < static_cast<Index_type>(tile_size))
+                           ? nk - k0 : static_cast<Index_type>(tile_size);
+    for (Index_type k = 0; k < k_len; ++k) {
+      const Real_type b_kj = b_tile[k][threadIdx.x];
+      for (size_t r = 0; r < reg_size; ++r) {
+        dot[r] += alpha * a_tile[threadIdx.y + r * rows_per_pass][k] * b_kj;
+      }
+    }
+    __syncthreads();
+
+  }
+
+  for (size_t r = 0; r < reg_size; ++r) {
+    const Index_type i = i0 + threadIdx.y + r * rows_per_pass;
+    if ( i < ni && j < nj ) {
+      out[j + i*nj] = dot[r];
+    }
+  }
+}
+
+#endif
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,167 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Python module rajaperf over the library interface in RAJAPerfSuiteAPI.hpp.
+///
+/// run() gives its results as a dict of NumPy arrays, one per column, that
+/// pandas.DataFrame takes as is:
+///
+///   import pandas, rajaperf
+///   df = pandas.DataFrame(rajaperf.run(["Stream_TRIAD"], ["Base_Seq"],
+///                                      sizes=[1e5, 1e6, 1e7], reps=10))
+///
+
+#include "RAJAPerfSuiteAPI.hpp"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace
+{
+
+template < typename T >
+py::array_t<T> toArray(const std::vector<T>& values)
+{
+  return py::array_t<T>(values.size(), values.data());
+}
+
+//
+// Run each kernel, variant, and tuning at each size for the given number
+// of passes, one row per pass. No tunings runs all tunings of a variant.
+// Variants a kernel does not define are skipped.
+//
+py::dict run(const std::vector<std::string>& kernels,
+             const std::vector<std::string>& variants,
+             const std::vector<std::string>& tunings,
+             const std::vector<double>& sizes,
+             long reps, int passes)
+{
+  std::vector<std::string> kernel_col;
+  std::vector<std::string> variant_col;
+  std::vector<std::string> tuning_col;
+  std::vector<long> size_col;
+  std::vector<long> reps_col;
+  std::vector<int> pass_col;
+  std::vector<double> time_col;
+  std::vector<long> its_col;
+  std::vector<long> bytes_col;
+  std::vector<long> flops_col;
+  std::vector<double> checksum_col;
+
+  const std::vector<double> run_sizes =
+      sizes.empty() ? std::vector<double>{0.0} : sizes;
+
+  for (const std::string& kernel_name : kernels) {
+    for (double size : run_sizes) {
+
+      rajaperf::api::Kernel kernel(kernel_name, size);
+      kernel.setReps(reps);
+
+      const std::vector<std::string> kernel_variants = kernel.getVariantNames();
+
+      for (const std::string& variant : variants) {
+
+        bool defined = false;
+        for (const std::string& a_variant : kernel_variants) {
+          if (a_variant == variant) { defined = true; }
+        }
+        if (!defined) { continue; }
+
+        const std::vector<std::string> run_tunings =
+            tunings.empty() ? kernel.getTuningNames(variant) : tunings;
+
+        for (const std::string& tuning : run_tunings) {
+          for (int ip = 0; ip < passes; ++ip) {
+
+            {
+              py::gil_scoped_release release;
+              kernel.run(variant, tuning);
+            }
+
+            kernel_col.emplace_back(kernel.getName());
+            variant_col.emplace_back(variant);
+            tuning_col.emplace_back(tuning);
+            size_col.emplace_back(kernel.getProblemSize());
+            reps_col.emplace_back(kernel.getReps());
+            pass_col.emplace_back(ip);
+            time_col.emplace_back(kernel.getLastTime());
+            its_col.emplace_back(kernel.getItsPerRep());
+            bytes_col.emplace_back(kernel.getBytesPerRep());
+            flops_col.emplace_back(kernel.getFLOPsPerRep());
+            checksum_col.emplace_back(
+                static_cast<double>(kernel.getLastChecksum()));
+          }
+        }
+      }
+    }
+  }
+
+  py::dict result;
+  result["kernel"] = py::cast(kernel_col);
+  result["variant"] = py::cast(variant_col);
+  result["tuning"] = py::cast(tuning_col);
+  result["problem_size"] = toArray(size_col);
+  result["reps"] = toArray(reps_col);
+  result["pass"] = toArray(pass_col);
+  result["time"] = toArray(time_col);
+  result["its_per_rep"] = toArray(its_col);
+  result["bytes_per_rep"] = toArray(bytes_col);
+  result["flops_per_rep"] = toArray(flops_col);
+  result["checksum"] = toArray(checksum_col);
+  return result;
+}
+
+} // end anonymous namespace
+
+PYBIND11_MODULE(rajaperf, m)
+{
+  m.doc() = "Run RAJA Performance Suite kernels without the raja-perf.exe "
+            "command line";
+
+  py::class_<rajaperf::api::Kernel>(m, "Kernel")
+    .def(py::init<const std::string&, double>(),
+         py::arg("name"), py::arg("size") = 0.0)
+    .def_static("kernel_names", &rajaperf::api::Kernel::getKernelNames)
+    .def_property_readonly("name", &rajaperf::api::Kernel::getName)
+    .def_property_readonly("problem_size",
+                           &rajaperf::api::Kernel::getProblemSize)
+    .def_property("reps", &rajaperf::api::Kernel::getReps,
+                  &rajaperf::api::Kernel::setReps)
+    .def("variant_names", &rajaperf::api::Kernel::getVariantNames)
+    .def("tuning_names", &rajaperf::api::Kernel::getTuningNames,
+         py::arg("variant"))
+    .def("run", &rajaperf::api::Kernel::run,
+         py::arg("variant"), py::arg("tuning") = "default",
+         py::call_guard<py::gil_scoped_release>())
+    .def_property_readonly("last_time", &rajaperf::api::Kernel::getLastTime)
+    .def_property_readonly("min_time", &rajaperf::api::Kernel::getMinTime)
+    .def_property_readonly("last_checksum",
+        [](const rajaperf::api::Kernel& kernel) {
+          return static_cast<double>(kernel.getLastChecksum());
+        })
+    .def_property_readonly("its_per_rep",
+                           &rajaperf::api::Kernel::getItsPerRep)
+    .def_property_readonly("bytes_per_rep",
+                           &rajaperf::api::Kernel::getBytesPerRep)
+    .def_property_readonly("flops_per_rep",
+                           &rajaperf::api::Kernel::getFLOPsPerRep);
+
+  m.def("run", &run,
+        py::arg("kernels"), py::arg("variants"),
+        py::arg("tunings") = std::vector<std::string>{},
+        py::arg("sizes") = std::vector<double>{},
+        py::arg("reps") = 0, py::arg("passes") = 1,
+        "Run kernels and return a dict of result columns");
+}
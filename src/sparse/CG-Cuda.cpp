@@ -0,0 +1,461 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+//
+// Kernels with a reduction sum it over each block and add the block sums
+// to sums with atomics.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cg_classic_spmv(Real_ptr q, Real_ptr p,
+                                Int_ptr row_ptr, Int_ptr col, Real_ptr val,
+                                Real_ptr sums, Index_type nrows)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  Real_type pq = 0.0;
+  if (i < nrows) {
+    CG_CLASSIC_SPMV_BODY;
+  }
+  pq = cuda_block_reduce<block_size, sum_op>(pq);
+  if (threadIdx.x == 0) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>(&sums[0], pq);
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cg_classic_update(Real_ptr x, Real_ptr r,
+                                  Real_ptr p, Real_ptr q, Real_type alpha,
+                                  Real_ptr sums, Index_type nrows)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  Real_type rr = 0.0;
+  if (i < nrows) {
+    CG_CLASSIC_UPDATE_BODY;
+  }
+  rr = cuda_block_reduce<block_size, sum_op>(rr);
+  if (threadIdx.x == 0) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>(&sums[0], rr);
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cg_classic_direction(Real_ptr p, Real_ptr r, Real_type beta,
+                                     Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    CG_CLASSIC_DIRECTION_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cg_chrongear_spmv(Real_ptr w, Real_ptr r,
+                                  Int_ptr row_ptr, Int_ptr col, Real_ptr val,
+                                  Real_ptr sums, Index_type nrows)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  Real_type rr = 0.0;
+  Real_type wr = 0.0;
+  if (i < nrows) {
+    CG_CHRONGEAR_SPMV_BODY;
+  }
+  rr = cuda_block_reduce<block_size, sum_op>(rr);
+  wr = cuda_block_reduce<block_size, sum_op>(wr);
+  if (threadIdx.x == 0) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>(&sums[0], rr);
+    RAJA::atomicAdd<RAJA::cuda_atomic>(&sums[1], wr);
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cg_chrongear_update(Real_ptr x, Real_ptr r, Real_ptr p,
+                                    Real_ptr w, Real_ptr s,
+                                    Real_type alpha, Real_type beta,
+                                    Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    CG_CHRONGEAR_UPDATE_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cg_pipelined_dot(Real_ptr r, Real_ptr w,
+                                 Real_ptr sums, Index_type nrows)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  Real_type rr = 0.0;
+  Real_type wr = 0.0;
+  if (i < nrows) {
+    CG_PIPELINED_DOT_BODY;
+  }
+  rr = cuda_block_reduce<block_size, sum_op>(rr);
+  wr = cuda_block_reduce<block_size, sum_op>(wr);
+  if (threadIdx.x == 0) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>(&sums[0], rr);
+    RAJA::atomicAdd<RAJA::cuda_atomic>(&sums[1], wr);
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cg_pipelined_spmv(Real_ptr q, Real_ptr w,
+                                  Int_ptr row_ptr, Int_ptr col, Real_ptr val,
+                                  Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    CG_PIPELINED_SPMV_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cg_pipelined_update(Real_ptr x, Real_ptr r, Real_ptr p,
+                                    Real_ptr q, Real_ptr w, Real_ptr s,
+                                    Real_ptr z,
+                                    Real_type alpha, Real_type beta,
+                                    Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    CG_PIPELINED_UPDATE_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void CG::runCudaVariantClassic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  CG_CLASSIC_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Real_ptr sums;
+    allocData(DataSpace::CudaDevice, sums, 1);
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemsetAsync( sums, 0, sizeof(Real_type), res.get_stream() ) );
+      cg_classic_spmv<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          q, p, row_ptr, col, val, sums, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+      Real_type pq;
+      cudaErrchk( cudaMemcpyAsync( &pq, sums, sizeof(Real_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      allReduce(&pq, 1);
+      const Real_type alpha = getClassicStep(pq);
+
+      cudaErrchk( cudaMemsetAsync( sums, 0, sizeof(Real_type), res.get_stream() ) );
+      cg_classic_update<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, r, p, q, alpha, sums, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+      Real_type rr;
+      cudaErrchk( cudaMemcpyAsync( &rr, sums, sizeof(Real_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      allReduce(&rr, 1);
+      const Real_type beta = getClassicDirection(rr);
+
+      cg_classic_direction<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          p, r, beta, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, sums);
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> pq(0.0);
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        CG_CLASSIC_SPMV_BODY;
+      });
+      Real_type pq_sum = pq.get();
+      allReduce(&pq_sum, 1);
+      const Real_type alpha = getClassicStep(pq_sum);
+
+      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> rr(0.0);
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        CG_CLASSIC_UPDATE_BODY;
+      });
+      Real_type rr_sum = rr.get();
+      allReduce(&rr_sum, 1);
+      const Real_type beta = getClassicDirection(rr_sum);
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        CG_CLASSIC_DIRECTION_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  CG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void CG::runCudaVariantChronGear(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  CG_CHRONGEAR_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Real_ptr sums;
+    allocData(DataSpace::CudaDevice, sums, 2);
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemsetAsync( sums, 0, 2*sizeof(Real_type), res.get_stream() ) );
+      cg_chrongear_spmv<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          w, r, row_ptr, col, val, sums, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+      Real_type rr_wr[2];
+      cudaErrchk( cudaMemcpyAsync( rr_wr, sums, 2*sizeof(Real_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      allReduce(rr_wr, 2);
+      Real_type alpha, beta;
+      getChronGearStep(rr_wr[0], rr_wr[1], alpha, beta);
+
+      cg_chrongear_update<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, r, p, w, s, alpha, beta, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, sums);
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> rr(0.0);
+      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> wr(0.0);
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        CG_CHRONGEAR_SPMV_BODY;
+      });
+      Real_type rr_wr[2] = {rr.get(), wr.get()};
+      allReduce(rr_wr, 2);
+      Real_type alpha, beta;
+      getChronGearStep(rr_wr[0], rr_wr[1], alpha, beta);
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        CG_CHRONGEAR_UPDATE_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  CG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+//
+// The SpMV is launched before waiting for the all-reduce of the dot
+// products, so the device computes it while MPI reduces.
+//
+template < size_t block_size >
+void CG::runCudaVariantPipelined(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  CG_PIPELINED_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    Real_ptr sums;
+    allocData(DataSpace::CudaDevice, sums, 2);
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemsetAsync( sums, 0, 2*sizeof(Real_type), res.get_stream() ) );
+      cg_pipelined_dot<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          r, w, sums, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+      Real_type rr_wr[2];
+      cudaErrchk( cudaMemcpyAsync( rr_wr, sums, 2*sizeof(Real_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      startAllReduce(rr_wr, 2);
+
+      cg_pipelined_spmv<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          q, w, row_ptr, col, val, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+      waitAllReduce();
+      Real_type alpha, beta;
+      getChronGearStep(rr_wr[0], rr_wr[1], alpha, beta);
+
+      cg_pipelined_update<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          x, r, p, q, w, s, z, alpha, beta, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, sums);
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> rr(0.0);
+      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> wr(0.0);
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        CG_PIPELINED_DOT_BODY;
+      });
+      Real_type rr_wr[2] = {rr.get(), wr.get()};
+      startAllReduce(rr_wr, 2);
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        CG_PIPELINED_SPMV_BODY;
+      });
+
+      waitAllReduce();
+      Real_type alpha, beta;
+      getChronGearStep(rr_wr[0], rr_wr[1], alpha, beta);
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        CG_PIPELINED_UPDATE_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  CG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void CG::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantClassic<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantChronGear<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantPipelined<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+}
+
+void CG::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "classic"+block_name);
+      addVariantTuningName(vid, "chronopoulos_gear"+block_name);
+      addVariantTuningName(vid, "pipelined"+block_name);
+
+    }
+
+  });
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
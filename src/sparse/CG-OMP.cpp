@@ -0,0 +1,299 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+void CG::runOpenMPVariantClassic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  CG_CLASSIC_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type pq = 0.0;
+        #pragma omp parallel for reduction(+:pq)
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CLASSIC_SPMV_BODY;
+        }
+        allReduce(&pq, 1);
+        const Real_type alpha = getClassicStep(pq);
+
+        Real_type rr = 0.0;
+        #pragma omp parallel for reduction(+:rr)
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CLASSIC_UPDATE_BODY;
+        }
+        allReduce(&rr, 1);
+        const Real_type beta = getClassicDirection(rr);
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CLASSIC_DIRECTION_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> pq(0.0);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CLASSIC_SPMV_BODY;
+        });
+        Real_type pq_sum = pq.get();
+        allReduce(&pq_sum, 1);
+        const Real_type alpha = getClassicStep(pq_sum);
+
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> rr(0.0);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CLASSIC_UPDATE_BODY;
+        });
+        Real_type rr_sum = rr.get();
+        allReduce(&rr_sum, 1);
+        const Real_type beta = getClassicDirection(rr_sum);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CLASSIC_DIRECTION_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  CG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void CG::runOpenMPVariantChronGear(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  CG_CHRONGEAR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type rr = 0.0;
+        Real_type wr = 0.0;
+        #pragma omp parallel for reduction(+:rr, wr)
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CHRONGEAR_SPMV_BODY;
+        }
+        Real_type sums[2] = {rr, wr};
+        allReduce(sums, 2);
+        Real_type alpha, beta;
+        getChronGearStep(sums[0], sums[1], alpha, beta);
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CHRONGEAR_UPDATE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> rr(0.0);
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> wr(0.0);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CHRONGEAR_SPMV_BODY;
+        });
+        Real_type sums[2] = {rr.get(), wr.get()};
+        allReduce(sums, 2);
+        Real_type alpha, beta;
+        getChronGearStep(sums[0], sums[1], alpha, beta);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CHRONGEAR_UPDATE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  CG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void CG::runOpenMPVariantPipelined(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  CG_PIPELINED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type rr = 0.0;
+        Real_type wr = 0.0;
+        #pragma omp parallel for reduction(+:rr, wr)
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_PIPELINED_DOT_BODY;
+        }
+        Real_type sums[2] = {rr, wr};
+        startAllReduce(sums, 2);
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_PIPELINED_SPMV_BODY;
+        }
+
+        waitAllReduce();
+        Real_type alpha, beta;
+        getChronGearStep(sums[0], sums[1], alpha, beta);
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_PIPELINED_UPDATE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> rr(0.0);
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> wr(0.0);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_PIPELINED_DOT_BODY;
+        });
+        Real_type sums[2] = {rr.get(), wr.get()};
+        startAllReduce(sums, 2);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_PIPELINED_SPMV_BODY;
+        });
+
+        waitAllReduce();
+        Real_type alpha, beta;
+        getChronGearStep(sums[0], sums[1], alpha, beta);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_PIPELINED_UPDATE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  CG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void CG::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantClassic(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantChronGear(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runOpenMPVariantPipelined(vid);
+  }
+  t += 1;
+}
+
+void CG::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "classic");
+  addVariantTuningName(vid, "chronopoulos_gear");
+  addVariantTuningName(vid, "pipelined");
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
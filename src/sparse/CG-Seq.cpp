@@ -0,0 +1,282 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+void CG::runSeqVariantClassic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  CG_CLASSIC_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type pq = 0.0;
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CLASSIC_SPMV_BODY;
+        }
+        allReduce(&pq, 1);
+        const Real_type alpha = getClassicStep(pq);
+
+        Real_type rr = 0.0;
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CLASSIC_UPDATE_BODY;
+        }
+        allReduce(&rr, 1);
+        const Real_type beta = getClassicDirection(rr);
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CLASSIC_DIRECTION_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> pq(0.0);
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CLASSIC_SPMV_BODY;
+        });
+        Real_type pq_sum = pq.get();
+        allReduce(&pq_sum, 1);
+        const Real_type alpha = getClassicStep(pq_sum);
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> rr(0.0);
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CLASSIC_UPDATE_BODY;
+        });
+        Real_type rr_sum = rr.get();
+        allReduce(&rr_sum, 1);
+        const Real_type beta = getClassicDirection(rr_sum);
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CLASSIC_DIRECTION_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  CG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void CG::runSeqVariantChronGear(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  CG_CHRONGEAR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type rr = 0.0;
+        Real_type wr = 0.0;
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CHRONGEAR_SPMV_BODY;
+        }
+        Real_type sums[2] = {rr, wr};
+        allReduce(sums, 2);
+        Real_type alpha, beta;
+        getChronGearStep(sums[0], sums[1], alpha, beta);
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_CHRONGEAR_UPDATE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> rr(0.0);
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> wr(0.0);
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CHRONGEAR_SPMV_BODY;
+        });
+        Real_type sums[2] = {rr.get(), wr.get()};
+        allReduce(sums, 2);
+        Real_type alpha, beta;
+        getChronGearStep(sums[0], sums[1], alpha, beta);
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_CHRONGEAR_UPDATE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  CG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void CG::runSeqVariantPipelined(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  CG_PIPELINED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type rr = 0.0;
+        Real_type wr = 0.0;
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_PIPELINED_DOT_BODY;
+        }
+        Real_type sums[2] = {rr, wr};
+        startAllReduce(sums, 2);
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_PIPELINED_SPMV_BODY;
+        }
+
+        waitAllReduce();
+        Real_type alpha, beta;
+        getChronGearStep(sums[0], sums[1], alpha, beta);
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          CG_PIPELINED_UPDATE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> rr(0.0);
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> wr(0.0);
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_PIPELINED_DOT_BODY;
+        });
+        Real_type sums[2] = {rr.get(), wr.get()};
+        startAllReduce(sums, 2);
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_PIPELINED_SPMV_BODY;
+        });
+
+        waitAllReduce();
+        Real_type alpha, beta;
+        getChronGearStep(sums[0], sums[1], alpha, beta);
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          CG_PIPELINED_UPDATE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  CG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void CG::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantClassic(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantChronGear(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantPipelined(vid);
+  }
+  t += 1;
+}
+
+void CG::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "classic");
+  addVariantTuningName(vid, "chronopoulos_gear");
+  addVariantTuningName(vid, "pipelined");
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,271 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include "SparseData.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+CG::CG(const RunParams& params)
+  : KernelBase(rajaperf::Sparse_CG, params)
+{
+  Index_type n_default = 100;
+
+  setDefaultProblemSize(n_default*n_default*n_default);
+  setDefaultReps(50);
+
+  m_stencil = params.getSparseStencil();
+
+  m_n = std::max(Index_type(std::cbrt(getTargetProblemSize()) + 0.5),
+                 Index_type(1));
+  m_nrows = m_n*m_n*m_n;
+  m_nnz = getLaplacian3DNumNonzeros(m_n, m_stencil);
+
+  setActualProblemSize( m_nrows );
+
+  setItsPerRep( m_nrows );
+  setKernelsPerRep(3);
+  setBytesPerRep( getBytesPerRep(Base_Seq, 0) );
+  setFLOPsPerRep( getFLOPsPerRep(Base_Seq, 0) );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Reduction);
+
+  setHasPattern(GatherScatter);
+  setHasPattern(ReductionBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+CG::~CG()
+{
+}
+
+//
+// Tunings before setting up the kernel tunings, ie. in the constructor, are
+// classic.
+//
+CG::Method CG::getMethod(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx < getNumVariantTunings(vid)) {
+    const std::string& name = getVariantTuningName(vid, tune_idx);
+    if (name.compare(0, 17, "chronopoulos_gear") == 0) {
+      return Method::chronopoulos_gear;
+    } else if (name.compare(0, 9, "pipelined") == 0) {
+      return Method::pipelined;
+    }
+  }
+  return Method::classic;
+}
+
+//
+// Each loop reads the matrix or the vectors it uses once and writes the
+// vectors it updates.
+//
+Index_type CG::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const Index_type matrix_bytes =
+      (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * (m_nrows+1) + // row_ptr
+      (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * m_nnz +       // col
+      (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nnz;        // val
+
+  switch ( getMethod(vid, tune_idx) ) {
+    case Method::chronopoulos_gear :
+      return matrix_bytes +
+             (5*sizeof(Real_type) + 6*sizeof(Real_type)) * m_nrows;
+    case Method::pipelined :
+      return matrix_bytes +
+             (7*sizeof(Real_type) + 10*sizeof(Real_type)) * m_nrows;
+    case Method::classic :
+    default :
+      return matrix_bytes +
+             (4*sizeof(Real_type) + 7*sizeof(Real_type)) * m_nrows;
+  }
+}
+
+Index_type CG::getFLOPsPerRep(VariantID vid, size_t tune_idx) const
+{
+  switch ( getMethod(vid, tune_idx) ) {
+    case Method::chronopoulos_gear :
+      return 2 * m_nnz + 12 * m_nrows;
+    case Method::pipelined :
+      return 2 * m_nnz + 16 * m_nrows;
+    case Method::classic :
+    default :
+      return 2 * m_nnz + 10 * m_nrows;
+  }
+}
+
+void CG::allReduce(Real_type* sums, int num_sums)
+{
+  startAllReduce(sums, num_sums);
+  waitAllReduce();
+}
+
+void CG::startAllReduce(Real_type* sums, int num_sums)
+{
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Iallreduce(MPI_IN_PLACE, sums, num_sums, Real_MPI_type, MPI_SUM,
+                 MPI_COMM_WORLD, &m_allreduce_request);
+#else
+  RAJA_UNUSED_VAR(sums);
+  RAJA_UNUSED_VAR(num_sums);
+#endif
+}
+
+void CG::waitAllReduce()
+{
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Wait(&m_allreduce_request, MPI_STATUS_IGNORE);
+#endif
+}
+
+Real_type CG::getClassicStep(Real_type pq) const
+{
+  return (pq != 0.0) ? m_rr / pq : 0.0;
+}
+
+Real_type CG::getClassicDirection(Real_type rr)
+{
+  const Real_type beta = (m_rr != 0.0) ? rr / m_rr : 0.0;
+  m_rr = rr;
+  return beta;
+}
+
+void CG::getChronGearStep(Real_type rr, Real_type wr,
+                          Real_type& alpha, Real_type& beta)
+{
+  beta = (m_iter > 0 && m_rr != 0.0) ? rr / m_rr : 0.0;
+  const Real_type denom = (m_iter > 0 && m_alpha != 0.0)
+                        ? wr - beta * rr / m_alpha : wr;
+  alpha = (denom != 0.0) ? rr / denom : 0.0;
+
+  m_iter += 1;
+  m_rr = rr;
+  m_alpha = alpha;
+}
+
+template < typename T >
+void CG::allocAndCopyData(T*& ptr, const std::vector<T>& host_data,
+                          VariantID vid)
+{
+  const Index_type len = static_cast<Index_type>(host_data.size());
+  allocData(ptr, len, vid);
+  copyData(getDataSpace(vid), ptr, DataSpace::Host, host_data.data(), len);
+}
+
+void CG::setUp(VariantID vid, size_t tune_idx)
+{
+  const Method method = getMethod(vid, tune_idx);
+
+  CSRMatrix A;
+  generateLaplacian3D(A, m_n, m_stencil);
+
+  allocAndCopyData(m_row_ptr, A.row_ptr, vid);
+  allocAndCopyData(m_col, A.col, vid);
+  allocAndCopyData(m_val, A.val, vid);
+
+  m_q = nullptr;
+  m_w = nullptr;
+  m_s = nullptr;
+  m_z = nullptr;
+
+  //
+  // x = 0 so r = b = 1, classic CG starts with p = r and the others with
+  // p = s = z = 0 and beta = 0 in the first iteration.
+  //
+  allocAndInitDataConst(m_x, m_nrows, 0.0, vid);
+  allocAndInitDataConst(m_r, m_nrows, 1.0, vid);
+  allocAndInitDataConst(m_p, m_nrows, (method == Method::classic) ? 1.0 : 0.0, vid);
+
+  if (method != Method::chronopoulos_gear) {
+    allocAndInitDataConst(m_q, m_nrows, 0.0, vid);
+  }
+  if (method != Method::classic) {
+    allocAndInitDataConst(m_s, m_nrows, 0.0, vid);
+  }
+  if (method == Method::chronopoulos_gear) {
+    allocAndInitDataConst(m_w, m_nrows, 0.0, vid);
+  }
+  if (method == Method::pipelined) {
+    allocAndInitDataConst(m_z, m_nrows, 0.0, vid);
+
+    // pipelined CG starts with w = A*r
+    std::vector<Real_type> w(m_nrows);
+    for (Index_type i = 0; i < m_nrows; ++i) {
+      Real_type ax = 0.0;
+      for (Index_type k = A.row_ptr[i]; k < A.row_ptr[i+1]; ++k) {
+        ax += A.val[k];
+      }
+      w[i] = ax;
+    }
+    allocAndCopyData(m_w, w, vid);
+  }
+
+  m_iter = 0;
+  m_rr = static_cast<Real_type>(m_nrows);
+  allReduce(&m_rr, 1);
+  m_alpha = 0.0;
+}
+
+void CG::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_x, m_nrows, checksum_scale_factor , vid);
+}
+
+void CG::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_row_ptr, vid);
+  deallocData(m_col, vid);
+  deallocData(m_val, vid);
+  deallocData(m_x, vid);
+  deallocData(m_r, vid);
+  deallocData(m_p, vid);
+  if (m_q) {
+    deallocData(m_q, vid);
+  }
+  if (m_w) {
+    deallocData(m_w, vid);
+  }
+  if (m_s) {
+    deallocData(m_s, vid);
+  }
+  if (m_z) {
+    deallocData(m_z, vid);
+  }
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,249 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CG kernel reference implementation:
+///
+/// One iteration of the conjugate gradient method for A*x = b per rep, with
+/// A in CSR format. Classic CG is
+///
+/// q = A*p;
+/// alpha = rr / dot(p, q);       // global reduction
+/// x += alpha*p;
+/// r -= alpha*q;
+/// rr_new = dot(r, r);           // global reduction
+/// p = r + (rr_new / rr)*p;
+/// rr = rr_new;
+///
+/// A is the matrix of a 3D 7 or 27 point Laplacian (see --sparse-stencil),
+/// b is 1, and the initial x is 0. Tunings are
+///
+///   classic           -- as above, two reductions each forcing a global
+///                        synchronization per iteration
+///   chronopoulos_gear -- w = A*r, then rr = dot(r, r) and wr = dot(w, r)
+///                        in one reduction, with s = A*p kept by
+///                        recurrence
+///   pipelined         -- Ghysels and Vanroose pipelined CG, rr and wr
+///                        are reduced while q = A*w is computed,
+///                        with s = A*p and z = A*s kept by recurrence
+///
+/// With MPI each rank solves a copy of the system and reductions are
+/// summed over all ranks, the pipelined tuning starts a non-blocking
+/// all-reduce before and waits for it after the SpMV. The tunings do the
+/// same iterations in exact arithmetic, so give nearly the same checksum.
+///
+
+#ifndef RAJAPerf_Sparse_CG_HPP
+#define RAJAPerf_Sparse_CG_HPP
+
+#define CG_DATA_SETUP \
+  const Index_type nrows = m_nrows; \
+\
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val; \
+\
+  Real_ptr x = m_x; \
+  Real_ptr r = m_r; \
+  Real_ptr p = m_p;
+
+#define CG_CLASSIC_DATA_SETUP \
+  CG_DATA_SETUP; \
+\
+  Real_ptr q = m_q;
+
+#define CG_CHRONGEAR_DATA_SETUP \
+  CG_DATA_SETUP; \
+\
+  Real_ptr w = m_w; \
+  Real_ptr s = m_s;
+
+#define CG_PIPELINED_DATA_SETUP \
+  CG_DATA_SETUP; \
+\
+  Real_ptr q = m_q; \
+  Real_ptr w = m_w; \
+  Real_ptr s = m_s; \
+  Real_ptr z = m_z;
+
+//
+// y = A*x for row i, ax is the result.
+//
+#define CG_SPMV_BODY(y, x) \
+  Real_type ax = 0.0; \
+  for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) { \
+    ax += val[k] * x[col[k]]; \
+  } \
+  y[i] = ax;
+
+#define CG_CLASSIC_SPMV_BODY \
+  CG_SPMV_BODY(q, p) \
+  pq += p[i] * ax;
+
+#define CG_CLASSIC_UPDATE_BODY \
+  x[i] += alpha * p[i]; \
+  r[i] -= alpha * q[i]; \
+  rr += r[i] * r[i];
+
+#define CG_CLASSIC_DIRECTION_BODY \
+  p[i] = r[i] + beta * p[i];
+
+#define CG_CHRONGEAR_SPMV_BODY \
+  CG_SPMV_BODY(w, r) \
+  rr += r[i] * r[i]; \
+  wr += ax * r[i];
+
+#define CG_CHRONGEAR_UPDATE_BODY \
+  p[i] = r[i] + beta * p[i]; \
+  s[i] = w[i] + beta * s[i]; \
+  x[i] += alpha * p[i]; \
+  r[i] -= alpha * s[i];
+
+#define CG_PIPELINED_DOT_BODY \
+  rr += r[i] * r[i]; \
+  wr += w[i] * r[i];
+
+#define CG_PIPELINED_SPMV_BODY \
+  CG_SPMV_BODY(q, w)
+
+#define CG_PIPELINED_UPDATE_BODY \
+  z[i] = q[i] + beta * z[i]; \
+  s[i] = w[i] + beta * s[i]; \
+  p[i] = r[i] + beta * p[i]; \
+  x[i] += alpha * p[i]; \
+  r[i] -= alpha * s[i]; \
+  w[i] -= alpha * z[i];
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace sparse
+{
+
+class CG : public KernelBase
+{
+public:
+
+  CG(const RunParams& params);
+
+  ~CG();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+  Index_type getFLOPsPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  CG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runSeqVariantClassic(VariantID vid);
+  void runSeqVariantChronGear(VariantID vid);
+  void runSeqVariantPipelined(VariantID vid);
+  void runOpenMPVariantClassic(VariantID vid);
+  void runOpenMPVariantChronGear(VariantID vid);
+  void runOpenMPVariantPipelined(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantClassic(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantChronGear(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantPipelined(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantClassic(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantChronGear(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantPipelined(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  // block reductions need whole warps on every gpu backend
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<64>>;
+
+  enum struct Method { classic, chronopoulos_gear, pipelined };
+
+  // method used by tuning, given by the start of the tuning name
+  Method getMethod(VariantID vid, size_t tune_idx) const;
+
+  //
+  // Sums of num_sums values over all ranks, in place. Without MPI these
+  // do nothing.
+  //
+  void allReduce(Real_type* sums, int num_sums);
+  void startAllReduce(Real_type* sums, int num_sums);
+  void waitAllReduce();
+
+  //
+  // Step alpha from pq = dot(p, q) and direction update beta from the
+  // new rr = dot(r, r) of classic CG, and alpha and beta of the
+  // Chronopoulos-Gear and pipelined methods from rr and wr = dot(w, r).
+  // Updates the scalars carried to the next iteration, a zero
+  // denominator gives zero so a converged solve stays converged.
+  //
+  Real_type getClassicStep(Real_type pq) const;
+  Real_type getClassicDirection(Real_type rr);
+  void getChronGearStep(Real_type rr, Real_type wr,
+                        Real_type& alpha, Real_type& beta);
+
+  template < typename T >
+  void allocAndCopyData(T*& ptr, const std::vector<T>& host_data,
+                        VariantID vid);
+
+  int m_stencil;
+
+  Index_type m_n;
+  Index_type m_nrows;
+  Index_type m_nnz;
+
+  Int_ptr m_row_ptr;
+  Int_ptr m_col;
+  Real_ptr m_val;
+
+  Real_ptr m_x;
+  Real_ptr m_r;
+  Real_ptr m_p;
+  Real_ptr m_q;
+  Real_ptr m_w;
+  Real_ptr m_s;
+  Real_ptr m_z;
+
+  // scalars carried between iterations
+  Index_type m_iter;
+  Real_type m_rr;
+  Real_type m_alpha;
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  MPI_Request m_allreduce_request;
+#endif
+};
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
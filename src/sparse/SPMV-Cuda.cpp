@@ -0,0 +1,404 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+#include "common/IndexUtils.hpp"
+#include "common/StorageUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void spmv_csr_scalar(Real_ptr y, Real_ptr x,
+                                Int_ptr row_ptr, Int_ptr col, Real_ptr val,
+                                Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    SPMV_CSR_BODY;
+  }
+}
+
+template < typename Storage_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void spmv_csr_storage(Storage_type* y, Storage_type* x,
+                                 Int_ptr row_ptr, Int_ptr col, Storage_type* val,
+                                 Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    SPMV_CSR_STORAGE_BODY;
+  }
+}
+
+template < typename IndexList_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void spmv_csr_index(Real_ptr y, Real_ptr x,
+                               IndexList_type* row_ptr, IndexList_type* col,
+                               Real_ptr val, IndexList_type nrows)
+{
+  IndexList_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    SPMV_CSR_INDEX_BODY;
+  }
+}
+
+//
+// vector_size consecutive threads compute each row and sum their partial
+// results with shuffles, all threads take part in the shuffles.
+//
+template < size_t block_size, size_t vector_size >
+__launch_bounds__(block_size)
+__global__ void spmv_csr_vector(Real_ptr y, Real_ptr x,
+                                Int_ptr row_ptr, Int_ptr col, Real_ptr val,
+                                Index_type nrows)
+{
+  Index_type i = (blockIdx.x * block_size + threadIdx.x) / vector_size;
+  const Index_type lane = threadIdx.x % vector_size;
+
+  Real_type dot = 0.0;
+  if (i < nrows) {
+    for (Index_type k = row_ptr[i] + lane; k < row_ptr[i+1]; k += vector_size ) {
+      dot += val[k] * x[col[k]];
+    }
+  }
+  for (int offset = vector_size / 2; offset > 0; offset /= 2) {
+    dot += __shfl_down_sync(0xffffffff, dot, offset, vector_size);
+  }
+  if (i < nrows && lane == 0) {
+    y[i] = dot;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void spmv_ell(Real_ptr y, Real_ptr x,
+                         Int_ptr col, Real_ptr val,
+                         Index_type ell_width, Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    SPMV_ELL_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void spmv_sell(Real_ptr y, Real_ptr x,
+                          Int_ptr chunk_ptr, Int_ptr chunk_len, Int_ptr perm,
+                          Int_ptr col, Real_ptr val,
+                          Index_type chunk_size, Index_type nrows)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < nrows) {
+    SPMV_SELL_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void SPMV::runCudaVariantCSRScalar(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  SPMV_CSR_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+      constexpr size_t shmem = 0;
+      spmv_csr_scalar<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, x, row_ptr, col, val, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        SPMV_CSR_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SPMV : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size, size_t vector_size >
+void SPMV::runCudaVariantCSRVector(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  SPMV_CSR_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows*vector_size, block_size);
+      constexpr size_t shmem = 0;
+      spmv_csr_vector<block_size, vector_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, x, row_ptr, col, val, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SPMV : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void SPMV::runCudaVariantELL(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  SPMV_ELL_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+      constexpr size_t shmem = 0;
+      spmv_ell<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, x, col, val, ell_width, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        SPMV_ELL_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SPMV : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void SPMV::runCudaVariantSELL(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  SPMV_SELL_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+      constexpr size_t shmem = 0;
+      spmv_sell<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, x, chunk_ptr, chunk_len, perm, col, val,
+          chunk_size, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nrows), [=] __device__ (Index_type i) {
+        SPMV_SELL_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SPMV : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void SPMV::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantCSRScalar<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == Base_CUDA) {
+        seq_for(gpu_vector_sizes_type{}, [&](auto vector_size) {
+          if (tune_idx == t) {
+            setBlockSize(block_size);
+            runCudaVariantCSRVector<block_size, vector_size>(vid);
+          }
+          t += 1;
+        });
+      }
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantELL<block_size>(vid);
+      }
+      t += 1;
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantSELL<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+}
+
+void SPMV::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "csr_scalar"+block_name);
+
+      if (vid == Base_CUDA) {
+        seq_for(gpu_vector_sizes_type{}, [&](auto vector_size) {
+          addVariantTuningName(vid, "csr_vector_"+std::to_string(vector_size)+block_name);
+        });
+      }
+
+      addVariantTuningName(vid, "ell"+block_name);
+
+      addVariantTuningName(vid, getSELLTuningName(vid)+block_name);
+
+    }
+
+  });
+}
+
+template < typename Storage_type >
+void SPMV::runCudaVariantStorage(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  SPMV_CSR_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+      constexpr size_t shmem = 0;
+      spmv_csr_storage<Storage_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, x, row_ptr, col, val, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SPMV : Unknown Cuda storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(SPMV, Cuda)
+
+template < typename IndexList_type >
+void SPMV::runCudaVariantIndex(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+
+  auto res{getCudaResource()};
+
+  SPMV_CSR_INDEX_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, block_size);
+      constexpr size_t shmem = 0;
+      spmv_csr_index<IndexList_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          y, x, row_ptr, col, val, nrows );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SPMV : Unknown Cuda index variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_INDEX_WIDTH_RUN_BOILERPLATE(SPMV, Cuda)
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
@@ -0,0 +1,303 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/IndexUtils.hpp"
+#include "common/StorageUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+void SPMV::runSeqVariantCSR(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPMV_CSR_DATA_SETUP;
+
+  auto spmv_csr_lam = [=](Index_type i) {
+                          SPMV_CSR_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          SPMV_CSR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          spmv_csr_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), spmv_csr_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPMV::runSeqVariantELL(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPMV_ELL_DATA_SETUP;
+
+  auto spmv_ell_lam = [=](Index_type i) {
+                          SPMV_ELL_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          SPMV_ELL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          spmv_ell_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), spmv_ell_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPMV::runSeqVariantSELL(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  const Index_type nchunks = m_nchunks;
+
+  SPMV_SELL_DATA_SETUP;
+
+  auto spmv_sell_lam = [=](Index_type c) {
+                          SPMV_SELL_CHUNK_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < nchunks; ++c ) {
+          SPMV_SELL_CHUNK_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < nchunks; ++c ) {
+          spmv_sell_lam(c);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nchunks), spmv_sell_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPMV::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantCSR(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantELL(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantSELL(vid);
+  }
+  t += 1;
+}
+
+void SPMV::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "csr");
+  addVariantTuningName(vid, "ell");
+  addVariantTuningName(vid, getSELLTuningName(vid));
+}
+
+template < typename Storage_type >
+void SPMV::runSeqVariantStorage(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPMV_CSR_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type i = 0; i < nrows; ++i ) {
+        SPMV_CSR_STORAGE_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  SPMV : Unknown Seq storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_STORAGE_RUN_BOILERPLATE(SPMV, Seq)
+
+template < typename IndexList_type >
+void SPMV::runSeqVariantIndex(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPMV_CSR_INDEX_DATA_SETUP;
+
+  if ( vid == Base_Seq ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (IndexList_type i = 0; i < nrows; ++i ) {
+        SPMV_CSR_INDEX_BODY;
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  SPMV : Unknown Seq index variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_INDEX_WIDTH_RUN_BOILERPLATE(SPMV, Seq)
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,267 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include "SparseData.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+SPMV::SPMV(const RunParams& params)
+  : KernelBase(rajaperf::Sparse_SPMV, params)
+{
+  Index_type n_default = 100;
+
+  setDefaultProblemSize(n_default*n_default*n_default);
+  setDefaultReps(50);
+
+  m_stencil = params.getSparseStencil();
+
+  m_n = std::max(Index_type(std::cbrt(getTargetProblemSize()) + 0.5),
+                 Index_type(1));
+  m_nrows = m_n*m_n*m_n;
+  m_nnz = getLaplacian3DNumNonzeros(m_n, m_stencil);
+
+  setActualProblemSize( m_nrows );
+
+  setItsPerRep( m_nrows );
+  setKernelsPerRep(1);
+  // CSR data, the padding read by ELLPACK and SELL-C-sigma is not counted
+  setBytesPerRep( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_nrows +    // y
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * (m_nrows+1) + // row_ptr
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * m_nnz +       // col
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nnz +       // val
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nrows );    // x
+  setFLOPsPerRep(2 * m_nnz);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setHasPattern(GatherScatter);
+
+  setUsesStoragePrecisions();
+  setUsesIndexWidths();
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+SPMV::~SPMV()
+{
+}
+
+//
+// Storage tunings move val, x, and y in their storage precision and the
+// indices as usual, index width tunings move the indices in their width.
+//
+Index_type SPMV::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  const IndexWidth width = getIndexWidth(vid, tune_idx);
+  if (width != IndexWidth::Default) {
+    const Index_type index_size = index_width::getIndexSize(width);
+    return (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_nrows +   // y
+           (0*index_size + 1*index_size) * (m_nrows+1) +             // row_ptr
+           (0*index_size + 1*index_size) * m_nnz +                   // col
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nnz +     // val
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nrows;    // x
+  }
+
+  const StoragePrecision precision = getStoragePrecision(vid, tune_idx);
+  if (precision == StoragePrecision::Default) {
+    return KernelBase::getBytesPerRep(vid, tune_idx);
+  }
+  const Index_type elem_size = storage::getElementSize(precision);
+  return (1*elem_size + 0*elem_size) * m_nrows +                        // y
+         (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * (m_nrows+1) +     // row_ptr
+         (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * m_nnz +           // col
+         (0*elem_size + 1*elem_size) * m_nnz +                           // val
+         (0*elem_size + 1*elem_size) * m_nrows;                          // x
+}
+
+SPMV::Layout SPMV::getLayout(VariantID vid, size_t tune_idx) const
+{
+  const std::string& name = getVariantTuningName(vid, tune_idx);
+  if (name.compare(0, 4, "sell") == 0) {
+    return Layout::SELL;
+  } else if (name.compare(0, 3, "ell") == 0) {
+    return Layout::ELL;
+  }
+  return Layout::CSR;
+}
+
+std::string SPMV::getSELLTuningName(VariantID vid) const
+{
+  const Index_type chunk_size = isVariantGPU(vid) ? SPMV_SELL_GPU_CHUNK_SIZE
+                                                  : SPMV_SELL_CPU_CHUNK_SIZE;
+  return "sell_" + std::to_string(chunk_size) +
+         "_" + std::to_string(chunk_size*SPMV_SELL_SIGMA_CHUNKS);
+}
+
+template < typename T >
+void SPMV::allocAndCopyData(T*& ptr, const std::vector<T>& host_data,
+                            VariantID vid)
+{
+  const Index_type len = static_cast<Index_type>(host_data.size());
+  allocData(ptr, len, vid);
+  copyData(getDataSpace(vid), ptr, DataSpace::Host, host_data.data(), len);
+}
+
+template < typename IndexList_type >
+void SPMV::setUpIndexLists(VariantID vid)
+{
+  IndexList_type* row_ptr;
+  allocAndCopyIndexData(row_ptr, m_row_ptr, m_nrows+1, vid);
+  m_width_row_ptr = row_ptr;
+
+  IndexList_type* col;
+  allocAndCopyIndexData(col, m_col, m_nnz, vid);
+  m_width_col = col;
+}
+
+template < typename IndexList_type >
+void SPMV::tearDownIndexLists(VariantID vid)
+{
+  IndexList_type* row_ptr = static_cast<IndexList_type*>(m_width_row_ptr);
+  deallocData(row_ptr, vid);
+  m_width_row_ptr = nullptr;
+
+  IndexList_type* col = static_cast<IndexList_type*>(m_width_col);
+  deallocData(col, vid);
+  m_width_col = nullptr;
+}
+
+void SPMV::setUp(VariantID vid, size_t tune_idx)
+{
+  CSRMatrix A;
+  generateLaplacian3D(A, m_n, m_stencil);
+
+  m_ell_width = 0;
+  m_nchunks = 0;
+  m_chunk_size = 0;
+
+  m_row_ptr = nullptr;
+  m_chunk_ptr = nullptr;
+  m_chunk_len = nullptr;
+  m_perm = nullptr;
+
+  m_width_row_ptr = nullptr;
+  m_width_col = nullptr;
+
+  switch ( getLayout(vid, tune_idx) ) {
+
+    case Layout::CSR : {
+      allocAndCopyData(m_row_ptr, A.row_ptr, vid);
+      allocAndCopyData(m_col, A.col, vid);
+      allocAndCopyData(m_val, A.val, vid);
+      if (getIndexWidth(vid, tune_idx) != IndexWidth::Default) {
+        RAJAPERF_INDEX_WIDTH_DISPATCH(getIndexWidth(vid, tune_idx), setUpIndexLists, vid);
+      }
+      break;
+    }
+
+    case Layout::ELL : {
+      ELLMatrix ell;
+      convertToELL(ell, A);
+      m_ell_width = ell.width;
+      allocAndCopyData(m_col, ell.col, vid);
+      allocAndCopyData(m_val, ell.val, vid);
+      break;
+    }
+
+    case Layout::SELL : {
+      const Index_type chunk_size = isVariantGPU(vid) ? SPMV_SELL_GPU_CHUNK_SIZE
+                                                      : SPMV_SELL_CPU_CHUNK_SIZE;
+      SELLMatrix sell;
+      convertToSELL(sell, A, chunk_size, chunk_size*SPMV_SELL_SIGMA_CHUNKS);
+      m_nchunks = sell.nchunks();
+      m_chunk_size = chunk_size;
+      allocAndCopyData(m_chunk_ptr, sell.chunk_ptr, vid);
+      allocAndCopyData(m_chunk_len, sell.chunk_len, vid);
+      allocAndCopyData(m_perm, sell.perm, vid);
+      allocAndCopyData(m_col, sell.col, vid);
+      allocAndCopyData(m_val, sell.val, vid);
+      break;
+    }
+
+  }
+
+  //
+  // Multiples of 1/8 keep every sum exact, so all layouts and summation
+  // orders give the same result.
+  //
+  allocAndInitData(m_x, m_nrows, vid);
+  {
+    auto reset_x = scopedMoveData(m_x, m_nrows, vid);
+    for (Index_type i = 0; i < m_nrows; ++i) {
+      m_x[i] = 1.0 + 0.125 * (i % 8);
+    }
+  }
+  allocAndInitDataConst(m_y, m_nrows, 0.0, vid);
+
+  convertDataToStorage(m_val, m_nnz, vid, tune_idx);
+  convertDataToStorage(m_x, m_nrows, vid, tune_idx);
+  convertDataToStorage(m_y, m_nrows, vid, tune_idx);
+}
+
+void SPMV::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  convertDataFromStorage(m_y, m_nrows, vid, tune_idx);
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_nrows, vid);
+}
+
+void SPMV::tearDown(VariantID vid, size_t tune_idx)
+{
+  if (getIndexWidth(vid, tune_idx) != IndexWidth::Default) {
+    RAJAPERF_INDEX_WIDTH_DISPATCH(getIndexWidth(vid, tune_idx), tearDownIndexLists, vid);
+  }
+  if (m_row_ptr) {
+    deallocData(m_row_ptr, vid);
+  }
+  if (m_chunk_ptr) {
+    deallocData(m_chunk_ptr, vid);
+  }
+  if (m_chunk_len) {
+    deallocData(m_chunk_len, vid);
+  }
+  if (m_perm) {
+    deallocData(m_perm, vid);
+  }
+  deallocData(m_col, vid);
+  deallocData(m_val, vid);
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,298 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV kernel reference implementation:
+///
+/// y = A*x with A in CSR format
+///
+/// for (Index_type i = 0; i < nrows; ++i ) {
+///   Real_type dot = 0.0;
+///   for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) {
+///     dot += val[k] * x[col[k]];
+///   }
+///   y[i] = dot;
+/// }
+///
+/// A is the matrix of a 3D 7 or 27 point Laplacian (see --sparse-stencil).
+/// Tunings store A in CSR, ELLPACK, or SELL-C-sigma format (see
+/// SparseData.hpp), GPU CSR tunings use a thread per row (scalar) or
+/// vector_size threads per row (vector).
+///
+/// The storage tunings keep val, x, and y in fp32 or bf16 in CSR format
+/// and compute in Real_type, see common/StorageUtils.hpp.
+///
+/// The index width tunings run CSR with copies of row_ptr and col in 32 or
+/// 64 bit integers and loop indices of the same type, see
+/// common/IndexUtils.hpp.
+///
+
+#ifndef RAJAPerf_Sparse_SPMV_HPP
+#define RAJAPerf_Sparse_SPMV_HPP
+
+//
+// SELL-C-sigma chunk size used by CPU and GPU variants, and sigma as a
+// number of chunks.
+//
+#define SPMV_SELL_CPU_CHUNK_SIZE 8
+#define SPMV_SELL_GPU_CHUNK_SIZE 32
+#define SPMV_SELL_SIGMA_CHUNKS 8
+
+#define SPMV_DATA_SETUP \
+  const Index_type nrows = m_nrows; \
+\
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define SPMV_CSR_DATA_SETUP \
+  SPMV_DATA_SETUP; \
+\
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val;
+
+#define SPMV_ELL_DATA_SETUP \
+  SPMV_DATA_SETUP; \
+\
+  const Index_type ell_width = m_ell_width; \
+\
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val;
+
+#define SPMV_SELL_DATA_SETUP \
+  SPMV_DATA_SETUP; \
+\
+  const Index_type chunk_size = m_chunk_size; \
+\
+  Int_ptr chunk_ptr = m_chunk_ptr; \
+  Int_ptr chunk_len = m_chunk_len; \
+  Int_ptr perm = m_perm; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val;
+
+#define SPMV_CSR_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) { \
+    dot += val[k] * x[col[k]]; \
+  } \
+  y[i] = dot;
+
+#define SPMV_ELL_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < ell_width; ++k ) { \
+    dot += val[i + k*nrows] * x[col[i + k*nrows]]; \
+  } \
+  y[i] = dot;
+
+//
+// SELL-C-sigma slot i.
+//
+#define SPMV_SELL_BODY \
+  const Index_type c = i / chunk_size; \
+  const Index_type e0 = chunk_ptr[c] + (i - c*chunk_size); \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < chunk_len[c]; ++k ) { \
+    dot += val[e0 + k*chunk_size] * x[col[e0 + k*chunk_size]]; \
+  } \
+  y[perm[i]] = dot;
+
+//
+// SELL-C-sigma chunk c computing all of its slots together, used by CPU
+// variants so the loop over slots can be vectorized.
+//
+#define SPMV_SELL_CHUNK_BODY \
+  Real_type dot[SPMV_SELL_CPU_CHUNK_SIZE]; \
+  for (Index_type s = 0; s < SPMV_SELL_CPU_CHUNK_SIZE; ++s ) { \
+    dot[s] = 0.0; \
+  } \
+  for (Index_type k = 0; k < chunk_len[c]; ++k ) { \
+    const Index_type e0 = chunk_ptr[c] + k*chunk_size; \
+    for (Index_type s = 0; s < SPMV_SELL_CPU_CHUNK_SIZE; ++s ) { \
+      dot[s] += val[e0 + s] * x[col[e0 + s]]; \
+    } \
+  } \
+  const Index_type s_end = (nrows - c*chunk_size < chunk_size) \
+                         ? nrows - c*chunk_size : chunk_size; \
+  for (Index_type s = 0; s < s_end; ++s ) { \
+    y[perm[s + c*chunk_size]] = dot[s]; \
+  }
+
+#define SPMV_CSR_STORAGE_DATA_SETUP \
+  const Index_type nrows = m_nrows; \
+\
+  Storage_type* x = reinterpret_cast<Storage_type*>(m_x); \
+  Storage_type* y = reinterpret_cast<Storage_type*>(m_y); \
+\
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr col = m_col; \
+  Storage_type* val = reinterpret_cast<Storage_type*>(m_val);
+
+#define SPMV_CSR_STORAGE_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) { \
+    dot += storage::load(val[k]) * storage::load(x[col[k]]); \
+  } \
+  y[i] = storage::store<Storage_type>(dot);
+
+#define SPMV_CSR_INDEX_DATA_SETUP \
+  const IndexList_type nrows = static_cast<IndexList_type>(m_nrows); \
+\
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+\
+  IndexList_type* row_ptr = static_cast<IndexList_type*>(m_width_row_ptr); \
+  IndexList_type* col = static_cast<IndexList_type*>(m_width_col); \
+  Real_ptr val = m_val;
+
+#define SPMV_CSR_INDEX_BODY \
+  Real_type dot = 0.0; \
+  for (IndexList_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) { \
+    dot += val[k] * x[col[k]]; \
+  } \
+  y[i] = dot;
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace sparse
+{
+
+class SPMV : public KernelBase
+{
+public:
+
+  SPMV(const RunParams& params);
+
+  ~SPMV();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runSeqVariantCSR(VariantID vid);
+  void runSeqVariantELL(VariantID vid);
+  void runSeqVariantSELL(VariantID vid);
+  void runOpenMPVariantCSR(VariantID vid);
+  void runOpenMPVariantELL(VariantID vid);
+  void runOpenMPVariantSELL(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantCSRScalar(VariantID vid);
+  template < size_t block_size, size_t vector_size >
+  void runCudaVariantCSRVector(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantELL(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantSELL(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantCSRScalar(VariantID vid);
+  template < size_t block_size, size_t vector_size >
+  void runHipVariantCSRVector(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantELL(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantSELL(VariantID vid);
+
+  void runSeqStorageVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPStorageVariant(VariantID vid, size_t tune_idx);
+  void runCudaStorageVariant(VariantID vid, size_t tune_idx);
+  void runHipStorageVariant(VariantID vid, size_t tune_idx);
+  template < typename Storage_type >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runOpenMPVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runCudaVariantStorage(VariantID vid);
+  template < typename Storage_type >
+  void runHipVariantStorage(VariantID vid);
+
+  void runSeqIndexVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPIndexVariant(VariantID vid, size_t tune_idx);
+  void runCudaIndexVariant(VariantID vid, size_t tune_idx);
+  void runHipIndexVariant(VariantID vid, size_t tune_idx);
+  template < typename IndexList_type >
+  void runSeqVariantIndex(VariantID vid);
+  template < typename IndexList_type >
+  void runOpenMPVariantIndex(VariantID vid);
+  template < typename IndexList_type >
+  void runCudaVariantIndex(VariantID vid);
+  template < typename IndexList_type >
+  void runHipVariantIndex(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<32>>;
+  using gpu_vector_sizes_type = gpu_block_size::list_type<8, 32>;
+
+  enum struct Layout { CSR, ELL, SELL };
+
+  // layout used by tuning, given by the start of the tuning name
+  Layout getLayout(VariantID vid, size_t tune_idx) const;
+  std::string getSELLTuningName(VariantID vid) const;
+
+  template < typename T >
+  void allocAndCopyData(T*& ptr, const std::vector<T>& host_data,
+                        VariantID vid);
+
+  template < typename IndexList_type >
+  void setUpIndexLists(VariantID vid);
+  template < typename IndexList_type >
+  void tearDownIndexLists(VariantID vid);
+
+  int m_stencil;
+
+  Index_type m_n;
+  Index_type m_nrows;
+  Index_type m_nnz;
+  Index_type m_ell_width;
+  Index_type m_nchunks;
+  Index_type m_chunk_size;
+
+  Int_ptr m_row_ptr;
+  Int_ptr m_chunk_ptr;
+  Int_ptr m_chunk_len;
+  Int_ptr m_perm;
+  Int_ptr m_col;
+  Real_ptr m_val;
+
+  // copies of row_ptr and col of index width tunings, arrays of
+  // IndexList_type
+  void* m_width_row_ptr;
+  void* m_width_col;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
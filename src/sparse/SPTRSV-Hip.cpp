@@ -0,0 +1,275 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPTRSV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void sptrsv_level(Real_ptr x, Real_ptr b,
+                             Int_ptr row_ptr, Int_ptr col, Real_ptr val,
+                             Int_ptr level_rows,
+                             Index_type level_begin, Index_type level_end)
+{
+  Index_type ii = level_begin + blockIdx.x * block_size + threadIdx.x;
+  if (ii < level_end) {
+    SPTRSV_LEVEL_ROW_BODY;
+  }
+}
+
+//
+// Each warp solves a row, the rows are taken in order from the counter
+// after the done flags so a warp only waits for rows taken by warps that
+// are already running. The lanes of a warp wait for the rows of their
+// entries and the products are summed over the warp.
+//
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void sptrsv_sync_free(Real_ptr x, Real_ptr b,
+                                 Int_ptr row_ptr, Int_ptr col, Real_ptr val,
+                                 Int_ptr done, Index_type nrows)
+{
+  using sum_op = RAJA::operators::plus<Real_type>;
+
+  const int lane = threadIdx.x % hip_warp_size;
+
+  Int_type i = 0;
+  if (lane == 0) {
+    i = RAJA::atomicAdd<RAJA::hip_atomic>(&done[nrows], 1);
+  }
+  i = __shfl(i, 0);
+  if (i >= nrows) {
+    return;
+  }
+
+  volatile Int_type* done_v = done;
+  volatile Real_type* x_v = x;
+
+  const Index_type kdiag = row_ptr[i+1] - 1;
+  Real_type sum = 0.0;
+  for (Index_type k = row_ptr[i] + lane; k < kdiag; k += hip_warp_size) {
+    const Index_type j = col[k];
+    while ( done_v[j] == 0 ) { }
+    __threadfence();
+    sum += val[k] * x_v[j];
+  }
+  sum = hip_warp_reduce<sum_op>(sum);
+
+  if (lane == 0) {
+    x[i] = (b[i] - sum) / val[kdiag];
+    __threadfence();
+    RAJA::atomicExchange<RAJA::hip_atomic>(&done[i], 1);
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void sptrsv_block_jacobi(Real_ptr x, Real_ptr b,
+                                    Int_ptr row_ptr, Int_ptr col, Real_ptr val,
+                                    Index_type block_rows, Index_type nrows,
+                                    Index_type nblocks)
+{
+  Index_type ib = blockIdx.x * block_size + threadIdx.x;
+  if (ib < nblocks) {
+    SPTRSV_BLOCK_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void SPTRSV::runHipVariantLevelSets(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  SPTRSV_LEVEL_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type l = 0; l < nlevels; ++l ) {
+        const size_t grid_size =
+            RAJA_DIVIDE_CEILING_INT(level_ptr[l+1] - level_ptr[l], block_size);
+        hipLaunchKernelGGL((sptrsv_level<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                           x, b, row_ptr, col, val, level_rows, level_ptr[l], level_ptr[l+1]);
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type l = 0; l < nlevels; ++l ) {
+        RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+          RAJA::RangeSegment(level_ptr[l], level_ptr[l+1]),
+          [=] __device__ (Index_type ii) {
+          SPTRSV_LEVEL_ROW_BODY;
+        });
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SPTRSV : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void SPTRSV::runHipVariantSyncFree(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  SPTRSV_SYNC_FREE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    constexpr size_t rows_per_block = block_size / hip_warp_size;
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nrows, rows_per_block);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemsetAsync( done, 0, (nrows+1)*sizeof(Int_type),
+                                   res.get_stream() ) );
+      hipLaunchKernelGGL((sptrsv_sync_free<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         x, b, row_ptr, col, val, done, nrows);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SPTRSV : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void SPTRSV::runHipVariantBlockJacobi(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  auto res{getHipResource()};
+
+  SPTRSV_BLOCK_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(nblocks, block_size);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL((sptrsv_block_jacobi<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+                         x, b, row_ptr, col, val, block_rows, nrows, nblocks);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+        RAJA::RangeSegment(0, nblocks), [=] __device__ (Index_type ib) {
+        SPTRSV_BLOCK_BODY;
+      });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SPTRSV : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void SPTRSV::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantLevelSets<block_size>(vid);
+      }
+      t += 1;
+
+      if (vid == Base_HIP) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantSyncFree<block_size>(vid);
+        }
+        t += 1;
+      }
+
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantBlockJacobi<block_size>(vid);
+      }
+      t += 1;
+
+    }
+
+  });
+}
+
+void SPTRSV::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      const std::string block_name = "_block_"+std::to_string(block_size);
+
+      addVariantTuningName(vid, "level_sets"+block_name);
+      if (vid == Base_HIP) {
+        addVariantTuningName(vid, "sync_free"+block_name);
+      }
+      addVariantTuningName(vid, "block_jacobi"+block_name);
+
+    }
+
+  });
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
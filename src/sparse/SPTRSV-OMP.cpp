@@ -0,0 +1,226 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPTRSV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+void SPTRSV::runOpenMPVariantLevelSets(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  SPTRSV_LEVEL_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        // the barrier at the end of each loop separates the levels
+        #pragma omp parallel
+        for (Index_type l = 0; l < nlevels; ++l ) {
+          #pragma omp for
+          for (Index_type ii = level_ptr[l]; ii < level_ptr[l+1]; ++ii ) {
+            SPTRSV_LEVEL_ROW_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < nlevels; ++l ) {
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(level_ptr[l], level_ptr[l+1]), [=](Index_type ii) {
+            SPTRSV_LEVEL_ROW_BODY;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SPTRSV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Chunks of rows are handed out in order and the rows of a chunk are solved
+// in order, so the lowest row being waited on always belongs to a thread
+// that is not waiting and the solve can not deadlock.
+//
+void SPTRSV::runOpenMPVariantSyncFree(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  SPTRSV_SYNC_FREE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < nrows; ++i ) {
+          done[i] = 0;
+        }
+
+        #pragma omp parallel for schedule(dynamic, 64)
+        for (Index_type i = 0; i < nrows; ++i ) {
+          Real_type sum = b[i];
+          const Index_type kdiag = row_ptr[i+1] - 1;
+          for (Index_type k = row_ptr[i]; k < kdiag; ++k ) {
+            const Index_type j = col[k];
+            Int_type ready = 0;
+            while ( !ready ) {
+              #pragma omp atomic read
+              ready = done[j];
+            }
+            #pragma omp flush
+            sum -= val[k] * x[j];
+          }
+          x[i] = sum / val[kdiag];
+          #pragma omp flush
+          #pragma omp atomic write
+          done[i] = 1;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SPTRSV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SPTRSV::runOpenMPVariantBlockJacobi(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  SPTRSV_BLOCK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ib = 0; ib < nblocks; ++ib ) {
+          SPTRSV_BLOCK_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type ib) {
+          SPTRSV_BLOCK_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SPTRSV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SPTRSV::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantLevelSets(vid);
+  }
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+    if (tune_idx == t) {
+      runOpenMPVariantSyncFree(vid);
+    }
+    t += 1;
+  }
+
+  if (tune_idx == t) {
+    runOpenMPVariantBlockJacobi(vid);
+  }
+  t += 1;
+}
+
+void SPTRSV::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "level_sets");
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "sync_free");
+  }
+  addVariantTuningName(vid, "block_jacobi");
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPTRSV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+void SPTRSV::runSeqVariantRows(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPTRSV_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          SPTRSV_ROW_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nrows), [=](Index_type i) {
+          SPTRSV_ROW_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  SPTRSV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPTRSV::runSeqVariantBlockJacobi(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPTRSV_BLOCK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ib = 0; ib < nblocks; ++ib ) {
+          SPTRSV_BLOCK_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type ib) {
+          SPTRSV_BLOCK_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  SPTRSV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPTRSV::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantRows(vid);
+  }
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantBlockJacobi(vid);
+  }
+  t += 1;
+}
+
+void SPTRSV::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+  addVariantTuningName(vid, "block_jacobi");
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
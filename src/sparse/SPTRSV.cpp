@@ -0,0 +1,180 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPTRSV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include "SparseData.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+SPTRSV::SPTRSV(const RunParams& params)
+  : KernelBase(rajaperf::Sparse_SPTRSV, params)
+{
+  Index_type n_default = 100;
+
+  setDefaultProblemSize(n_default*n_default*n_default);
+  setDefaultReps(50);
+
+  m_stencil = params.getSparseStencil();
+  m_block_rows = getKernelParam("block_rows", 64, 1);
+
+  m_n = std::max(Index_type(std::cbrt(getTargetProblemSize()) + 0.5),
+                 Index_type(1));
+  m_nrows = m_n*m_n*m_n;
+
+  // the matrix is symmetric so the lower triangle has half of the off
+  // diagonal entries
+  const Index_type nnz_A = getLaplacian3DNumNonzeros(m_n, m_stencil);
+  m_nnz = (nnz_A - m_nrows) / 2 + m_nrows;
+
+  //
+  // The levels are needed to report them, they only depend on the size
+  // and stencil of the matrix.
+  //
+  {
+    CSRMatrix A;
+    generateLaplacian3D(A, m_n, m_stencil);
+    CSRMatrix L;
+    extractLowerTriangle(L, A);
+    std::vector<Int_type> level_rows;
+    m_nlevels = computeLevelSets(m_level_ptr, level_rows, L);
+  }
+
+  setActualProblemSize( m_nrows );
+
+  setItsPerRep( m_nrows );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * (m_nrows+1) + // row_ptr
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * m_nnz +       // col
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nnz +       // val
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nrows +     // b
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nrows );    // x
+  setFLOPsPerRep(2 * (m_nnz - m_nrows) + m_nrows);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setMetricNames({"levels", "solve_sec"});
+
+  setUsesFeature(Forall);
+
+  setHasPattern(GatherScatter);
+  setHasPattern(LatencyBound);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+SPTRSV::~SPTRSV()
+{
+}
+
+SPTRSV::Method SPTRSV::getMethod(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx < getNumVariantTunings(vid)) {
+    const std::string& name = getVariantTuningName(vid, tune_idx);
+    if (name.compare(0, 10, "level_sets") == 0) {
+      return Method::level_sets;
+    } else if (name.compare(0, 9, "sync_free") == 0) {
+      return Method::sync_free;
+    } else if (name.compare(0, 12, "block_jacobi") == 0) {
+      return Method::block_jacobi;
+    }
+  }
+  return Method::rows;
+}
+
+std::vector<double> SPTRSV::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  const double run_reps = static_cast<double>(getRunReps());
+  return {static_cast<double>(m_nlevels),
+          getMinTime(vid, tune_idx) / run_reps};
+}
+
+template < typename T >
+void SPTRSV::allocAndCopyData(T*& ptr, const std::vector<T>& host_data,
+                              VariantID vid)
+{
+  const Index_type len = static_cast<Index_type>(host_data.size());
+  allocData(ptr, len, vid);
+  copyData(getDataSpace(vid), ptr, DataSpace::Host, host_data.data(), len);
+}
+
+void SPTRSV::setUp(VariantID vid, size_t tune_idx)
+{
+  const Method method = getMethod(vid, tune_idx);
+
+  CSRMatrix A;
+  generateLaplacian3D(A, m_n, m_stencil);
+  CSRMatrix L;
+  extractLowerTriangle(L, A);
+
+  allocAndCopyData(m_row_ptr, L.row_ptr, vid);
+  allocAndCopyData(m_col, L.col, vid);
+  allocAndCopyData(m_val, L.val, vid);
+
+  allocAndInitDataConst(m_b, m_nrows, 1.0, vid);
+  allocAndInitDataConst(m_x, m_nrows, 0.0, vid);
+
+  m_level_rows = nullptr;
+  m_done = nullptr;
+
+  if (method == Method::level_sets) {
+    std::vector<Int_type> level_rows;
+    computeLevelSets(m_level_ptr, level_rows, L);
+    allocAndCopyData(m_level_rows, level_rows, vid);
+  }
+  if (method == Method::sync_free) {
+    allocAndInitDataConst(m_done, m_nrows+1, Int_type(0), vid);
+  }
+}
+
+void SPTRSV::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_x, m_nrows, checksum_scale_factor , vid);
+}
+
+void SPTRSV::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  deallocData(m_row_ptr, vid);
+  deallocData(m_col, vid);
+  deallocData(m_val, vid);
+  deallocData(m_b, vid);
+  deallocData(m_x, vid);
+  if (m_level_rows) {
+    deallocData(m_level_rows, vid);
+  }
+  if (m_done) {
+    deallocData(m_done, vid);
+  }
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
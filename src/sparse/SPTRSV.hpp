@@ -0,0 +1,201 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPTRSV kernel reference implementation:
+///
+/// // solve L*x = b by forward substitution, L in CSR format with the
+/// // diagonal the last entry of each row
+/// for (Index_type i = 0; i < nrows; ++i ) {
+///   Real_type sum = b[i];
+///   for (Index_type k = row_ptr[i]; k < row_ptr[i+1]-1; ++k ) {
+///     sum -= val[k] * x[col[k]];
+///   }
+///   x[i] = sum / val[row_ptr[i+1]-1];
+/// }
+///
+/// L is the lower triangle of the matrix of a 3D 7 or 27 point Laplacian
+/// (see --sparse-stencil) and b is 1, each rep is one solve. Tunings are
+///
+///   default      -- rows in order, sequential variants only
+///   level_sets   -- rows are grouped in levels where every row depends
+///                   only on rows of earlier levels, the rows of a level
+///                   are solved in parallel with one loop, or GPU kernel
+///                   launch, per level
+///   sync_free    -- rows are solved in parallel in one loop, or GPU
+///                   kernel, each row waits for the rows it depends on to
+///                   be marked done with flags, Base variants only
+///   block_jacobi -- rows are split into blocks of the kernel parameter
+///                   "block_rows" rows, entries outside the block of their
+///                   row are dropped and the blocks are solved in parallel,
+///                   an approximate solve so the checksum differs
+///
+/// The number of levels and the time per solve are reported as metrics.
+///
+
+#ifndef RAJAPerf_Sparse_SPTRSV_HPP
+#define RAJAPerf_Sparse_SPTRSV_HPP
+
+#define SPTRSV_DATA_SETUP \
+  const Index_type nrows = m_nrows; \
+\
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val; \
+\
+  Real_ptr b = m_b; \
+  Real_ptr x = m_x;
+
+#define SPTRSV_LEVEL_DATA_SETUP \
+  SPTRSV_DATA_SETUP; \
+\
+  const Index_type nlevels = m_nlevels; \
+  const std::vector<Int_type>& level_ptr = m_level_ptr; \
+  Int_ptr level_rows = m_level_rows;
+
+#define SPTRSV_SYNC_FREE_DATA_SETUP \
+  SPTRSV_DATA_SETUP; \
+\
+  Int_ptr done = m_done;
+
+#define SPTRSV_BLOCK_DATA_SETUP \
+  SPTRSV_DATA_SETUP; \
+\
+  const Index_type block_rows = m_block_rows; \
+  const Index_type nblocks = RAJA_DIVIDE_CEILING_INT(nrows, block_rows);
+
+#define SPTRSV_ROW_BODY \
+  Real_type sum = b[i]; \
+  const Index_type kdiag = row_ptr[i+1] - 1; \
+  for (Index_type k = row_ptr[i]; k < kdiag; ++k ) { \
+    sum -= val[k] * x[col[k]]; \
+  } \
+  x[i] = sum / val[kdiag];
+
+#define SPTRSV_LEVEL_ROW_BODY \
+  const Index_type i = level_rows[ii]; \
+  SPTRSV_ROW_BODY
+
+#define SPTRSV_BLOCK_BODY \
+  const Index_type ibegin = ib * block_rows; \
+  const Index_type iend = (ibegin + block_rows < nrows) ? ibegin + block_rows \
+                                                        : nrows; \
+  for (Index_type i = ibegin; i < iend; ++i ) { \
+    Real_type sum = b[i]; \
+    const Index_type kdiag = row_ptr[i+1] - 1; \
+    for (Index_type k = row_ptr[i]; k < kdiag; ++k ) { \
+      if (col[k] >= ibegin) { \
+        sum -= val[k] * x[col[k]]; \
+      } \
+    } \
+    x[i] = sum / val[kdiag]; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace sparse
+{
+
+class SPTRSV : public KernelBase
+{
+public:
+
+  SPTRSV(const RunParams& params);
+
+  ~SPTRSV();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  // number of levels of the matrix and the time per solve in seconds
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPTRSV : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  void runSeqVariantRows(VariantID vid);
+  void runSeqVariantBlockJacobi(VariantID vid);
+  void runOpenMPVariantLevelSets(VariantID vid);
+  void runOpenMPVariantSyncFree(VariantID vid);
+  void runOpenMPVariantBlockJacobi(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantLevelSets(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantSyncFree(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantBlockJacobi(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantLevelSets(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantSyncFree(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantBlockJacobi(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  // the sync free kernels solve a row with each warp
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                         gpu_block_size::MultipleOf<64>>;
+
+  enum struct Method { rows, level_sets, sync_free, block_jacobi };
+
+  // method used by tuning, given by the start of the tuning name
+  Method getMethod(VariantID vid, size_t tune_idx) const;
+
+  template < typename T >
+  void allocAndCopyData(T*& ptr, const std::vector<T>& host_data,
+                        VariantID vid);
+
+  int m_stencil;
+
+  Index_type m_n;
+  Index_type m_nrows;
+  Index_type m_nnz;
+  Index_type m_block_rows;
+
+  Int_ptr m_row_ptr;
+  Int_ptr m_col;
+  Real_ptr m_val;
+
+  Real_ptr m_b;
+  Real_ptr m_x;
+
+  // level sets, level_ptr is used on the host to launch each level
+  Index_type m_nlevels;
+  std::vector<Int_type> m_level_ptr;
+  Int_ptr m_level_rows;
+
+  // sync free done flags of the rows, followed by the next row counter
+  // used by the GPU kernels
+  Int_ptr m_done;
+};
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,238 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "common/RAJAPerfSuite.hpp"
+#include "SparseData.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+Index_type getLaplacian3DNumNonzeros(Index_type n, int stencil_points)
+{
+  if (stencil_points == 27) {
+    // each dimension contributes 3 offsets for interior points, 2 for faces
+    return (3*n-2) * (3*n-2) * (3*n-2);
+  }
+  return n*n*n + 6*n*n*(n-1);
+}
+
+//
+// Generate matrix row by row, neighbors are visited with the k offset
+// outermost and the i offset innermost so columns are increasing.
+//
+void generateLaplacian3D(CSRMatrix& A, Index_type n, int stencil_points)
+{
+  if (stencil_points != 7 && stencil_points != 27) {
+    getCout() << "\n******* ERROR!!! unsupported stencil "
+              << stencil_points << " *******" << std::endl;
+    return;
+  }
+
+  const Index_type nrows = n*n*n;
+  const Index_type nnz = getLaplacian3DNumNonzeros(n, stencil_points);
+
+  A.nrows = nrows;
+  A.row_ptr.resize(nrows+1);
+  A.col.resize(nnz);
+  A.val.resize(nnz);
+
+  const Real_type diag = static_cast<Real_type>(stencil_points - 1);
+
+  Index_type e = 0;
+  for (Index_type k = 0; k < n; ++k) {
+    for (Index_type j = 0; j < n; ++j) {
+      for (Index_type i = 0; i < n; ++i) {
+
+        const Index_type row = i + j*n + k*n*n;
+        A.row_ptr[row] = static_cast<Int_type>(e);
+
+        for (Index_type dk = -1; dk <= 1; ++dk) {
+          for (Index_type dj = -1; dj <= 1; ++dj) {
+            for (Index_type di = -1; di <= 1; ++di) {
+
+              const Index_type ndiff = (dk != 0) + (dj != 0) + (di != 0);
+              if (stencil_points == 7 && ndiff > 1) {
+                continue;
+              }
+              if (k+dk < 0 || k+dk >= n ||
+                  j+dj < 0 || j+dj >= n ||
+                  i+di < 0 || i+di >= n) {
+                continue;
+              }
+
+              A.col[e] = static_cast<Int_type>(row + di + dj*n + dk*n*n);
+              A.val[e] = (ndiff == 0) ? diag : -1.0;
+              e += 1;
+            }
+          }
+        }
+
+      }
+    }
+  }
+  A.row_ptr[nrows] = static_cast<Int_type>(e);
+}
+
+void convertToELL(ELLMatrix& ell, const CSRMatrix& A)
+{
+  const Index_type nrows = A.nrows;
+
+  Index_type width = 0;
+  for (Index_type i = 0; i < nrows; ++i) {
+    width = std::max(width, Index_type(A.row_ptr[i+1] - A.row_ptr[i]));
+  }
+
+  ell.nrows = nrows;
+  ell.width = width;
+  ell.col.resize(nrows*width);
+  ell.val.resize(nrows*width);
+
+  for (Index_type i = 0; i < nrows; ++i) {
+    const Index_type row_begin = A.row_ptr[i];
+    const Index_type row_len = A.row_ptr[i+1] - row_begin;
+    for (Index_type k = 0; k < width; ++k) {
+      if (k < row_len) {
+        ell.col[i + k*nrows] = A.col[row_begin + k];
+        ell.val[i + k*nrows] = A.val[row_begin + k];
+      } else {
+        ell.col[i + k*nrows] = static_cast<Int_type>(i);
+        ell.val[i + k*nrows] = 0.0;
+      }
+    }
+  }
+}
+
+void convertToSELL(SELLMatrix& sell, const CSRMatrix& A,
+                   Index_type chunk_size, Index_type sigma)
+{
+  const Index_type nrows = A.nrows;
+  const Index_type nchunks = (nrows + chunk_size - 1) / chunk_size;
+
+  auto row_len = [&](Int_type i) {
+    return A.row_ptr[i+1] - A.row_ptr[i];
+  };
+
+  sell.nrows = nrows;
+  sell.chunk_size = chunk_size;
+  sell.sigma = sigma;
+
+  //
+  // Sort rows by decreasing length within each window of sigma rows,
+  // stable so rows of equal length keep their order.
+  //
+  sell.perm.resize(nrows);
+  std::iota(sell.perm.begin(), sell.perm.end(), Int_type(0));
+  for (Index_type w = 0; w < nrows; w += sigma) {
+    const Index_type w_end = std::min(w + sigma, nrows);
+    std::stable_sort(sell.perm.begin() + w, sell.perm.begin() + w_end,
+                     [&](Int_type a, Int_type b) {
+                       return row_len(a) > row_len(b);
+                     });
+  }
+
+  sell.chunk_ptr.resize(nchunks+1);
+  sell.chunk_len.resize(nchunks);
+
+  Index_type len = 0;
+  for (Index_type c = 0; c < nchunks; ++c) {
+    Int_type c_len = 0;
+    for (Index_type s = c*chunk_size; s < std::min((c+1)*chunk_size, nrows); ++s) {
+      c_len = std::max(c_len, row_len(sell.perm[s]));
+    }
+    sell.chunk_ptr[c] = static_cast<Int_type>(len);
+    sell.chunk_len[c] = c_len;
+    len += c_len * chunk_size;
+  }
+  sell.chunk_ptr[nchunks] = static_cast<Int_type>(len);
+
+  //
+  // Padding entries, including those of slots past the last row, have
+  // value 0 and the column of their row.
+  //
+  sell.col.resize(len);
+  sell.val.resize(len);
+
+  for (Index_type c = 0; c < nchunks; ++c) {
+    for (Index_type lane = 0; lane < chunk_size; ++lane) {
+      const Index_type s = c*chunk_size + lane;
+      const Int_type row = (s < nrows) ? sell.perm[s] : 0;
+      const Index_type r_begin = (s < nrows) ? A.row_ptr[row] : 0;
+      const Index_type r_len = (s < nrows) ? row_len(row) : 0;
+      for (Index_type k = 0; k < sell.chunk_len[c]; ++k) {
+        const Index_type e = sell.chunk_ptr[c] + k*chunk_size + lane;
+        if (k < r_len) {
+          sell.col[e] = A.col[r_begin + k];
+          sell.val[e] = A.val[r_begin + k];
+        } else {
+          sell.col[e] = row;
+          sell.val[e] = 0.0;
+        }
+      }
+    }
+  }
+}
+
+void extractLowerTriangle(CSRMatrix& L, const CSRMatrix& A)
+{
+  L.nrows = A.nrows;
+  L.row_ptr.resize(A.nrows+1);
+  L.col.clear();
+  L.val.clear();
+
+  for (Index_type row = 0; row < A.nrows; ++row) {
+    L.row_ptr[row] = static_cast<Int_type>(L.col.size());
+    for (Index_type e = A.row_ptr[row]; e < A.row_ptr[row+1]; ++e) {
+      if (A.col[e] <= row) {
+        L.col.push_back(A.col[e]);
+        L.val.push_back(A.val[e]);
+      }
+    }
+  }
+  L.row_ptr[A.nrows] = static_cast<Int_type>(L.col.size());
+}
+
+Index_type computeLevelSets(std::vector<Int_type>& level_ptr,
+                            std::vector<Int_type>& level_rows,
+                            const CSRMatrix& L)
+{
+  std::vector<Int_type> level(L.nrows, 0);
+  Int_type nlevels = 0;
+  for (Index_type row = 0; row < L.nrows; ++row) {
+    for (Index_type e = L.row_ptr[row]; e < L.row_ptr[row+1]-1; ++e) {
+      level[row] = std::max(level[row], level[L.col[e]] + 1);
+    }
+    nlevels = std::max(nlevels, level[row] + 1);
+  }
+
+  //
+  // Bucket the rows by level, rows are visited in increasing order so the
+  // rows of each level stay in increasing order.
+  //
+  level_ptr.assign(nlevels+1, 0);
+  for (Index_type row = 0; row < L.nrows; ++row) {
+    level_ptr[level[row]+1] += 1;
+  }
+  std::partial_sum(level_ptr.begin(), level_ptr.end(), level_ptr.begin());
+
+  std::vector<Int_type> next(level_ptr.begin(), level_ptr.end()-1);
+  level_rows.resize(L.nrows);
+  for (Index_type row = 0; row < L.nrows; ++row) {
+    level_rows[next[level[row]]++] = static_cast<Int_type>(row);
+  }
+
+  return nlevels;
+}
+
+}  // closing brace for sparse namespace
+}  // closing brace for rajaperf namespace
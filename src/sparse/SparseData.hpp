@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Sparse matrix storage and generation used by kernels in the Sparse group.
+///
+
+#ifndef RAJAPerf_SparseData_HPP
+#define RAJAPerf_SparseData_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+//
+// Host matrix in compressed sparse row format, the entries of each row are
+// ordered by increasing column index.
+//
+struct CSRMatrix
+{
+  Index_type nrows = 0;
+  std::vector<Int_type> row_ptr; // nrows+1 offsets of rows in col and val
+  std::vector<Int_type> col;
+  std::vector<Real_type> val;
+
+  Index_type nnz() const { return static_cast<Index_type>(col.size()); }
+};
+
+//
+// Host matrix in ELLPACK format, each row is padded to width entries and
+// entry k of row i is at i + k*nrows. Padding entries have value 0 and the
+// column of their row.
+//
+struct ELLMatrix
+{
+  Index_type nrows = 0;
+  Index_type width = 0;
+  std::vector<Int_type> col;
+  std::vector<Real_type> val;
+};
+
+//
+// Host matrix in SELL-C-sigma format. Rows are sorted by decreasing length
+// within windows of sigma rows, slot s holds row perm[s], and the slots are
+// split into chunks of chunk_size rows padded to the length of their longest
+// row. Entry k of slot s in chunk c = s / chunk_size is at
+// chunk_ptr[c] + k*chunk_size + s % chunk_size.
+//
+struct SELLMatrix
+{
+  Index_type nrows = 0;
+  Index_type chunk_size = 0;
+  Index_type sigma = 0;
+  std::vector<Int_type> chunk_ptr; // nchunks+1 offsets of chunks
+  std::vector<Int_type> chunk_len; // padded row length of each chunk
+  std::vector<Int_type> perm;      // row held by each slot
+  std::vector<Int_type> col;
+  std::vector<Real_type> val;
+
+  Index_type nchunks() const
+  { return static_cast<Index_type>(chunk_len.size()); }
+};
+
+//
+// Return number of non-zeros of the 3D Laplacian generated below.
+//
+Index_type getLaplacian3DNumNonzeros(Index_type n, int stencil_points);
+
+//
+// Generate the matrix of a 3D Laplacian with a 7 or 27 point stencil on
+// an n x n x n grid without boundary points, ie. a diagonal of
+// stencil_points-1 and -1 for each neighbor in the grid.
+//
+void generateLaplacian3D(CSRMatrix& A, Index_type n, int stencil_points);
+
+//
+// Convert CSR matrix to ELLPACK and SELL-C-sigma matrices.
+//
+void convertToELL(ELLMatrix& ell, const CSRMatrix& A);
+///
+void convertToSELL(SELLMatrix& sell, const CSRMatrix& A,
+                   Index_type chunk_size, Index_type sigma);
+
+//
+// Extract the lower triangle of A including the diagonal, so the diagonal
+// is the last entry of each row.
+//
+void extractLowerTriangle(CSRMatrix& L, const CSRMatrix& A);
+
+//
+// Compute the level sets of lower triangular L, the level of a row is one
+// more than the highest level of the rows it depends on. The rows of level
+// l, in increasing order, are level_rows[level_ptr[l]] up to
+// level_rows[level_ptr[l+1]]. Returns the number of levels.
+//
+Index_type computeLevelSets(std::vector<Int_type>& level_ptr,
+                            std::vector<Int_type>& level_rows,
+                            const CSRMatrix& L);
+
+}  // closing brace for sparse namespace
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -14,8 +14,9 @@
 namespace rajaperf {
 namespace stream {
 
-void ADD::runKokkosVariant(VariantID vid,
-                           size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < typename Data_type >
+void ADD::runKokkosVariantTyped(VariantID vid,
+                                size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -58,6 +59,8 @@ void ADD::runKokkosVariant(VariantID vid,
   moveDataToHostFromKokkosView(c, c_view, iend);
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(ADD, Kokkos)
+
 } // end namespace stream
 } // end namespace rajaperf
 #endif // (RUN_KOKKOS)
@@ -14,8 +14,9 @@
 namespace rajaperf {
 namespace stream {
 
-void COPY::runKokkosVariant(VariantID vid,
-                            size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < typename Data_type >
+void COPY::runKokkosVariantTyped(VariantID vid,
+                                 size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -53,6 +54,8 @@ void COPY::runKokkosVariant(VariantID vid,
   moveDataToHostFromKokkosView(c, c_view, iend);
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(COPY, Kokkos)
+
 } // end namespace stream
 } // end namespace rajaperf
 #endif // (RUN_KOKKOS)
@@ -14,8 +14,9 @@
 namespace rajaperf {
 namespace stream {
 
-void DOT::runKokkosVariant(VariantID vid,
-                           size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < typename Data_type >
+void DOT::runKokkosVariantTyped(VariantID vid,
+                                size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
 
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -35,12 +36,12 @@ void DOT::runKokkosVariant(VariantID vid,
 
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      Real_type dot = m_dot_init;
+      Data_type dot = static_cast<Data_type>(m_dot_init);
 
       parallel_reduce(
           "DOT-Kokkos Kokkos_Lambda",
           Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
-          KOKKOS_LAMBDA(Index_type i, Real_type & dot_res) {
+          KOKKOS_LAMBDA(Index_type i, Data_type & dot_res) {
             dot_res += a_view[i] * b_view[i];
           },
           dot);
@@ -62,6 +63,8 @@ void DOT::runKokkosVariant(VariantID vid,
   moveDataToHostFromKokkosView(b, b_view, iend);
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DOT, Kokkos)
+
 } // end namespace stream
 } // end namespace rajaperf
 #endif // (RUN_KOKKOS)
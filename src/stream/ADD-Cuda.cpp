@@ -14,6 +14,8 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/NontemporalUtils.hpp"
 
 #include <iostream>
 
@@ -22,9 +24,9 @@ namespace rajaperf
 namespace stream
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void add(Real_ptr c, Real_ptr a, Real_ptr b,
+__global__ void add(Data_type* c, Data_type* a, Data_type* b,
                     Index_type iend)
 {
   Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -34,7 +36,18 @@ __global__ void add(Real_ptr c, Real_ptr a, Real_ptr b,
 }
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void add_nontemporal(Data_type* c, Data_type* a, Data_type* b,
+                                Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    ADD_BODY_NONTEMPORAL;
+  }
+}
+
+template < typename Data_type, size_t block_size, bool launch >
 void ADD::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -45,14 +58,45 @@ void ADD::runCudaVariantImpl(VariantID vid)
 
   ADD_DATA_SETUP;
 
-  if ( vid == Base_CUDA ) {
+  if ( vid == Base_CUDA && run_params.getMultiGPU() ) {
+
+    // each device owns a chunk of the arrays, copied outside the timer
+    auto parts = detail::makeCudaPartitions(iend);
+    auto a_chunks = detail::scatterCudaPartitions(parts, a);
+    auto b_chunks = detail::scatterCudaPartitions(parts, b);
+    auto c_chunks = detail::scatterCudaPartitions(parts, c);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t p = 0; p < parts.devices.size(); ++p) {
+        const Index_type part_len = parts.offsets[p+1] - parts.offsets[p];
+        cudaErrchk( cudaSetDevice(parts.devices[p]) );
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(part_len, block_size);
+        constexpr size_t shmem = 0;
+        add<Data_type, block_size><<<grid_size, block_size, shmem, parts.streams[p]>>>(
+            c_chunks[p], a_chunks[p], b_chunks[p], part_len );
+        cudaErrchk( cudaGetLastError() );
+      }
+
+    }
+    detail::synchronizeCudaPartitions(parts);
+    stopTimer();
+
+    detail::gatherCudaPartitions(parts, c_chunks, c);
+    detail::freeCudaPartitions(parts, a_chunks);
+    detail::freeCudaPartitions(parts, b_chunks);
+    detail::freeCudaPartitions(parts, c_chunks);
+    detail::destroyCudaPartitions(parts);
+
+  } else if ( vid == Base_CUDA ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      add<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( c, a, b,
+      add<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( c, a, b,
                                       iend );
       cudaErrchk( cudaGetLastError() );
 
@@ -80,7 +124,7 @@ void ADD::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         ADD_BODY;
       });
@@ -93,7 +137,38 @@ void ADD::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(ADD, Cuda)
+template < typename Data_type, size_t block_size >
+void ADD::runCudaVariantNontemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  ADD_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      add_nontemporal<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          c, a, b, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  ADD : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_NONTEMPORAL_TUNING_DEFINE_TYPED_BOILERPLATE(ADD, Cuda, Base_CUDA, RAJA_CUDA)
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(ADD, Cuda)
 
 } // end namespace stream
 } // end namespace rajaperf
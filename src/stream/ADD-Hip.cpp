@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/NontemporalUtils.hpp"
 
 #include <iostream>
 
@@ -21,9 +23,9 @@ namespace rajaperf
 namespace stream
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void add(Real_ptr c, Real_ptr a, Real_ptr b,
+__global__ void add(Data_type* c, Data_type* a, Data_type* b,
                      Index_type iend)
 {
   Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -33,7 +35,18 @@ __global__ void add(Real_ptr c, Real_ptr a, Real_ptr b,
 }
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void add_nontemporal(Data_type* c, Data_type* a, Data_type* b,
+                                Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    ADD_BODY_NONTEMPORAL;
+  }
+}
+
+template < typename Data_type, size_t block_size, bool launch >
 void ADD::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -44,14 +57,45 @@ void ADD::runHipVariantImpl(VariantID vid)
 
   ADD_DATA_SETUP;
 
-  if ( vid == Base_HIP ) {
+  if ( vid == Base_HIP && run_params.getMultiGPU() ) {
+
+    // each device owns a chunk of the arrays, copied outside the timer
+    auto parts = detail::makeHipPartitions(iend);
+    auto a_chunks = detail::scatterHipPartitions(parts, a);
+    auto b_chunks = detail::scatterHipPartitions(parts, b);
+    auto c_chunks = detail::scatterHipPartitions(parts, c);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t p = 0; p < parts.devices.size(); ++p) {
+        const Index_type part_len = parts.offsets[p+1] - parts.offsets[p];
+        hipErrchk( hipSetDevice(parts.devices[p]) );
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(part_len, block_size);
+        constexpr size_t shmem = 0;
+        hipLaunchKernelGGL((add<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, parts.streams[p],
+            c_chunks[p], a_chunks[p], b_chunks[p], part_len );
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    detail::synchronizeHipPartitions(parts);
+    stopTimer();
+
+    detail::gatherHipPartitions(parts, c_chunks, c);
+    detail::freeHipPartitions(parts, a_chunks);
+    detail::freeHipPartitions(parts, b_chunks);
+    detail::freeHipPartitions(parts, c_chunks);
+    detail::destroyHipPartitions(parts);
+
+  } else if ( vid == Base_HIP ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      hipLaunchKernelGGL((add<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  c, a, b,
+      hipLaunchKernelGGL((add<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  c, a, b,
                                       iend );
       hipErrchk( hipGetLastError() );
 
@@ -81,7 +125,7 @@ void ADD::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         ADD_BODY;
       });
@@ -94,7 +138,38 @@ void ADD::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(ADD, Hip)
+template < typename Data_type, size_t block_size >
+void ADD::runHipVariantNontemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  ADD_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((add_nontemporal<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+          c, a, b, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  ADD : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_NONTEMPORAL_TUNING_DEFINE_TYPED_BOILERPLATE(ADD, Hip, Base_HIP, RAJA_HIP)
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(ADD, Hip)
 
 } // end namespace stream
 } // end namespace rajaperf
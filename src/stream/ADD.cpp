@@ -34,6 +34,10 @@ ADD::ADD(const RunParams& params)
 
   setUsesFeature(Forall);
 
+  setHasPattern(Streaming);
+
+  setUsesFloatingPointDataTypes();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -42,6 +46,8 @@ ADD::ADD(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -53,6 +59,9 @@ ADD::ADD(const RunParams& params)
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
 
+  setVariantDefined( Base_SYCL );
+  setVariantDefined( RAJA_SYCL );
+
   setVariantDefined( Kokkos_Lambda );
 }
 
@@ -60,24 +69,54 @@ ADD::~ADD()
 {
 }
 
-void ADD::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ADD::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitData(m_a, getActualProblemSize(), vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-  allocAndInitDataConst(m_c, getActualProblemSize(), 0.0, vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void ADD::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_c, getActualProblemSize(), vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), updateChecksumTyped, vid, tune_idx);
+}
+
+void ADD::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void ADD::setUpTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Data_type* a;
+  Data_type* b;
+  Data_type* c;
+  allocAndInitData(a, getActualProblemSize(), vid);
+  allocAndInitData(b, getActualProblemSize(), vid);
+  allocAndInitDataConst(c, getActualProblemSize(), Data_type(0), vid);
+  m_a = a;
+  m_b = b;
+  m_c = c;
+}
+
+template < typename Data_type >
+void ADD::updateChecksumTyped(VariantID vid, size_t tune_idx)
+{
+  Data_type* c = static_cast<Data_type*>(m_c);
+  checksum[vid][tune_idx] += calcChecksum(c, getActualProblemSize(), vid);
 }
 
-void ADD::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void ADD::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  (void) vid;
-  deallocData(m_a, vid);
-  deallocData(m_b, vid);
-  deallocData(m_c, vid);
+  Data_type* a = static_cast<Data_type*>(m_a);
+  Data_type* b = static_cast<Data_type*>(m_b);
+  Data_type* c = static_cast<Data_type*>(m_c);
+  deallocData(a, vid);
+  deallocData(b, vid);
+  deallocData(c, vid);
+  m_a = nullptr;
+  m_b = nullptr;
+  m_c = nullptr;
 }
 
 } // end namespace stream
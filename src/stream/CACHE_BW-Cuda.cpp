@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CACHE_BW.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace stream
+{
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cache_bw_read(Real_ptr a, Real_ptr y, Real_type b,
+                              Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    CACHE_BW_READ_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cache_bw_write(Real_ptr a, Real_type c,
+                               Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    CACHE_BW_WRITE_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void cache_bw_read_write(Real_ptr a, Real_type c,
+                                    Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    CACHE_BW_READ_WRITE_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void CACHE_BW::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = m_len;
+  const size_t pattern = m_pattern;
+
+  auto res{getCudaResource()};
+
+  CACHE_BW_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    constexpr size_t shmem = 0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type s = 0; s < sweeps; ++s ) {
+        if (pattern == s_read) {
+          cache_bw_read<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+              a, y, b, iend );
+        } else if (pattern == s_write) {
+          cache_bw_write<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+              a, c, iend );
+        } else {
+          cache_bw_read_write<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+              a, c, iend );
+        }
+        cudaErrchk( cudaGetLastError() );
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  CACHE_BW : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void CACHE_BW::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  const size_t tuning_block_size = getTuning(vid, tune_idx).block_size;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tuning_block_size == block_size) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<block_size>(vid);
+      }
+    }
+  });
+}
+
+void CACHE_BW::setCudaTuningDefinitions(VariantID vid)
+{
+  const std::vector<size_t> nbytes{
+      static_cast<size_t>(getCudaDeviceProp().l2CacheSize)};
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addLevelTunings(vid, nbytes, 0, 1, 2, block_size,
+                      "_"+std::to_string(block_size));
+    }
+  });
+}
+
+} // end namespace stream
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
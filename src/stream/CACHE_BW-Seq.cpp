@@ -0,0 +1,75 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CACHE_BW.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace stream
+{
+
+
+void CACHE_BW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_len;
+  const size_t pattern = m_pattern;
+
+  CACHE_BW_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < sweeps; ++s ) {
+          if (pattern == s_read) {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              CACHE_BW_READ_BODY;
+            }
+          } else if (pattern == s_write) {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              CACHE_BW_WRITE_BODY;
+            }
+          } else {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              CACHE_BW_READ_WRITE_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  CACHE_BW : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void CACHE_BW::setSeqTuningDefinitions(VariantID vid)
+{
+  addLevelTunings(vid, detail::getHostCacheLevelSizes(), 2, 1, 1, 0, "");
+}
+
+} // end namespace stream
+} // end namespace rajaperf
@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CACHE_BW.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace stream
+{
+
+//
+// Elements of a included in the checksum, the working sets of all levels
+// are larger so every tuning has the same checksum.
+//
+constexpr Index_type cache_bw_checksum_len = 256;
+
+
+CACHE_BW::CACHE_BW(const RunParams& params)
+  : KernelBase(rajaperf::Stream_CACHE_BW, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(200);
+
+  m_b = 0.0;
+  m_c = 1.0;
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                  getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setMetricNames({"working_set_bytes", "sweeps"});
+
+  setUsesFeature( Forall );
+
+  setHasPattern( Streaming );
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+
+  setVariantDefined( Base_CUDA );
+
+  setVariantDefined( Base_HIP );
+}
+
+CACHE_BW::~CACHE_BW()
+{
+}
+
+const std::vector<std::string>& CACHE_BW::getPatternNames()
+{
+  static const std::vector<std::string> names{"read", "write", "read_write"};
+  return names;
+}
+
+void CACHE_BW::addLevelTunings(VariantID vid, const std::vector<size_t>& nbytes,
+                               size_t num_private, Index_type nthreads,
+                               size_t first_level, size_t block_size,
+                               const std::string& suffix)
+{
+  const Index_type elem_bytes = sizeof(Real_type);
+
+  size_t max_nbytes = 0;
+  for (size_t n : nbytes) {
+    max_nbytes = std::max(max_nbytes, n);
+  }
+  const Index_type mem_len =
+      std::max(getActualProblemSize(),
+               4 * static_cast<Index_type>(max_nbytes) / elem_bytes);
+
+  std::vector<Tuning> levels;
+  for (size_t l = 0; l < nbytes.size(); ++l) {
+    Index_type len = static_cast<Index_type>(nbytes[l]) / 2 / elem_bytes;
+    if (l < num_private) {
+      len *= nthreads;
+    }
+    len = std::max(std::min(len, mem_len), cache_bw_checksum_len);
+    levels.push_back({"L" + std::to_string(first_level + l), 0, len,
+                      std::max(mem_len / len, Index_type(1)), block_size});
+  }
+  levels.push_back({"mem", 0, mem_len, 1, block_size});
+
+  for (Tuning const& level : levels) {
+    for (size_t p = 0; p < getPatternNames().size(); ++p) {
+      Tuning tuning = level;
+      tuning.pattern = p;
+      addVariantTuningName(vid, level.level+"_"+getPatternNames()[p]+suffix);
+      m_tunings[vid].push_back(tuning);
+    }
+  }
+}
+
+//
+// Each sweep reads or writes each element once, read_write does both.
+//
+Index_type CACHE_BW::getBytesPerRep(VariantID vid, size_t tune_idx) const
+{
+  if (tune_idx >= m_tunings[vid].size()) {
+    return KernelBase::getBytesPerRep(vid, tune_idx);
+  }
+  const Tuning& tuning = getTuning(vid, tune_idx);
+  const Index_type accesses = (tuning.pattern == s_read_write) ? 2 : 1;
+  return accesses * sizeof(Real_type) * tuning.len * tuning.sweeps;
+}
+
+std::vector<double> CACHE_BW::getMetrics(VariantID vid, size_t tune_idx) const
+{
+  const Tuning& tuning = getTuning(vid, tune_idx);
+  return {static_cast<double>(tuning.len * sizeof(Real_type)),
+          static_cast<double>(tuning.sweeps)};
+}
+
+void CACHE_BW::setUp(VariantID vid, size_t tune_idx)
+{
+  const Tuning& tuning = getTuning(vid, tune_idx);
+  m_len = tuning.len;
+  m_sweeps = tuning.sweeps;
+  m_pattern = tuning.pattern;
+
+  allocAndInitDataConst(m_a, m_len, 1.0, vid);
+  allocAndInitDataConst(m_y, 1, 0.0, vid);
+}
+
+void CACHE_BW::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid].at(tune_idx) += calcChecksum(m_a, cache_bw_checksum_len, vid);
+  checksum[vid].at(tune_idx) += calcChecksum(m_y, 1, vid);
+}
+
+void CACHE_BW::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_a, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace stream
+} // end namespace rajaperf
@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CACHE_BW kernel reference implementation:
+///
+/// for (Index_type s = 0; s < sweeps; ++s ) {
+///   for (Index_type i = ibegin; i < iend; ++i ) {
+///     if ( a[i] < b ) { y[0] = a[i]; }  // read
+///     a[i] = c ;                        // write
+///     a[i] = a[i] * c ;                 // read_write
+///   }
+/// }
+///
+/// Tunings give the cache level the working set a is sized to fit and the
+/// access pattern, ie. L2_read_write. The working set of a level is half
+/// the size of the level, times the number of threads for the private L1
+/// and L2 of the CPU, and the mem level is out of cache, the larger of the
+/// problem size and four times the LLC. Levels are found with sysconf or
+/// sysfs on the CPU and the device properties on the GPU, which has L2 and
+/// mem levels. Each rep sweeps a as many times as fit the mem level, so
+/// every tuning moves about the same bytes per rep. b is 0, c is 1, and a
+/// is 1, so the read pattern never writes y.
+///
+/// When it is run, the best rate of the tunings of each level is its
+/// bandwidth ceiling in the roofline report, and the best rate of the mem
+/// tunings is the peak GB/s, unless --peak-bandwidth is given.
+///
+
+#ifndef RAJAPerf_Stream_CACHE_BW_HPP
+#define RAJAPerf_Stream_CACHE_BW_HPP
+
+#define CACHE_BW_DATA_SETUP \
+  Real_ptr a = m_a; \
+  Real_ptr y = m_y; \
+  const Real_type b = m_b; \
+  const Real_type c = m_c; \
+  const Index_type sweeps = m_sweeps;
+
+#define CACHE_BW_READ_BODY  \
+  if ( a[i] < b ) { y[0] = a[i]; }
+
+#define CACHE_BW_WRITE_BODY  \
+  a[i] = c ;
+
+#define CACHE_BW_READ_WRITE_BODY  \
+  a[i] = a[i] * c ;
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace stream
+{
+
+class CACHE_BW : public KernelBase
+{
+public:
+
+  CACHE_BW(const RunParams& params);
+
+  ~CACHE_BW();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const override;
+  std::vector<double> getMetrics(VariantID vid, size_t tune_idx) const override;
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  CACHE_BW : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+
+  // return the level of the tuning named tuning_name, ie. L2 for
+  // L2_read_256, used to group tunings by level in the roofline report
+  static std::string getLevelName(const std::string& tuning_name)
+  {
+    return tuning_name.substr(0, tuning_name.find('_'));
+  }
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  //
+  // Patterns are numbered in the order of getPatternNames.
+  //
+  static const size_t s_read = 0;
+  static const size_t s_write = 1;
+  static const size_t s_read_write = 2;
+
+  static const std::vector<std::string>& getPatternNames();
+
+  struct Tuning
+  {
+    std::string level;
+    size_t pattern;
+    Index_type len;
+    Index_type sweeps;
+    size_t block_size;
+  };
+
+  //
+  // Add the tunings of each pattern for cache levels of nbytes, the first
+  // num_private of which are private to each of nthreads threads, and the
+  // mem level, with tuning names ending in suffix.
+  //
+  void addLevelTunings(VariantID vid, const std::vector<size_t>& nbytes,
+                       size_t num_private, Index_type nthreads,
+                       size_t first_level, size_t block_size,
+                       const std::string& suffix);
+  const Tuning& getTuning(VariantID vid, size_t tune_idx) const
+  { return m_tunings[vid].at(tune_idx); }
+
+  std::vector<Tuning> m_tunings[NumVariants];
+
+  Index_type m_len;
+  Index_type m_sweeps;
+  size_t m_pattern;
+
+  Real_type m_b;
+  Real_type m_c;
+
+  Real_ptr m_a;
+  Real_ptr m_y;
+};
+
+} // end namespace stream
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
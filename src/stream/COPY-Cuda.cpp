@@ -13,6 +13,8 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/NontemporalUtils.hpp"
 
 #include <iostream>
 
@@ -21,9 +23,9 @@ namespace rajaperf
 namespace stream
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void copy(Real_ptr c, Real_ptr a,
+__global__ void copy(Data_type* c, Data_type* a,
                      Index_type iend)
 {
   Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -33,7 +35,18 @@ __global__ void copy(Real_ptr c, Real_ptr a,
 }
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void copy_nontemporal(Data_type* c, Data_type* a,
+                                 Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    COPY_BODY_NONTEMPORAL;
+  }
+}
+
+template < typename Data_type, size_t block_size, bool launch >
 void COPY::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -44,14 +57,43 @@ void COPY::runCudaVariantImpl(VariantID vid)
 
   COPY_DATA_SETUP;
 
-  if ( vid == Base_CUDA ) {
+  if ( vid == Base_CUDA && run_params.getMultiGPU() ) {
+
+    // each device owns a chunk of the arrays, copied outside the timer
+    auto parts = detail::makeCudaPartitions(iend);
+    auto a_chunks = detail::scatterCudaPartitions(parts, a);
+    auto c_chunks = detail::scatterCudaPartitions(parts, c);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t p = 0; p < parts.devices.size(); ++p) {
+        const Index_type part_len = parts.offsets[p+1] - parts.offsets[p];
+        cudaErrchk( cudaSetDevice(parts.devices[p]) );
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(part_len, block_size);
+        constexpr size_t shmem = 0;
+        copy<Data_type, block_size><<<grid_size, block_size, shmem, parts.streams[p]>>>(
+            c_chunks[p], a_chunks[p], part_len );
+        cudaErrchk( cudaGetLastError() );
+      }
+
+    }
+    detail::synchronizeCudaPartitions(parts);
+    stopTimer();
+
+    detail::gatherCudaPartitions(parts, c_chunks, c);
+    detail::freeCudaPartitions(parts, a_chunks);
+    detail::freeCudaPartitions(parts, c_chunks);
+    detail::destroyCudaPartitions(parts);
+
+  } else if ( vid == Base_CUDA ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      copy<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( c, a,
+      copy<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( c, a,
                                        iend );
       cudaErrchk( cudaGetLastError() );
 
@@ -79,7 +121,7 @@ void COPY::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         COPY_BODY;
       });
@@ -92,7 +134,38 @@ void COPY::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(COPY, Cuda)
+template < typename Data_type, size_t block_size >
+void COPY::runCudaVariantNontemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  COPY_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      copy_nontemporal<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          c, a, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  COPY : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_NONTEMPORAL_TUNING_DEFINE_TYPED_BOILERPLATE(COPY, Cuda, Base_CUDA, RAJA_CUDA)
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(COPY, Cuda)
 
 } // end namespace stream
 } // end namespace rajaperf
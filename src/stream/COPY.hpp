@@ -13,19 +13,26 @@
 ///   c[i] = a[i] ;
 /// }
 ///
+/// The nontemporal tunings write c with non-temporal stores, which do not
+/// read the lines they write, so the traffic is the bytes per rep counted.
+///
 
 #ifndef RAJAPerf_Stream_COPY_HPP
 #define RAJAPerf_Stream_COPY_HPP
 
 #define COPY_DATA_SETUP \
-  Real_ptr a = m_a; \
-  Real_ptr c = m_c;
+  Data_type* a = static_cast<Data_type*>(m_a); \
+  Data_type* c = static_cast<Data_type*>(m_c);
 
 #define COPY_BODY  \
   c[i] = a[i] ;
 
+#define COPY_BODY_NONTEMPORAL  \
+  storeNontemporal(&c[i], a[i]);
+
 
 #include "common/KernelBase.hpp"
+#include "common/DataTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -51,21 +58,62 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runSyclVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  template < typename Data_type >
+  void setUpTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void updateChecksumTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void tearDownTyped(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void runSeqVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runSyclVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPTargetVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runKokkosVariantTyped(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void setSyclTuningDefinitions(VariantID vid);
+  void setOpenMPTargetTuningDefinitions(VariantID vid);
+  template < typename Data_type >
+  void runSeqVariantSimd(VariantID vid);
+  template < typename Data_type >
+  void runSeqVariantNontemporal(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantNontemporal(VariantID vid);
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantNontemporal(VariantID vid);
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantNontemporal(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runSyclVariantImpl(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPTargetVariantMapped(VariantID vid, size_t tune_idx);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
-  Real_ptr m_a;
-  Real_ptr m_c;
+  void* m_a; // array of Data_type
+  void* m_c; // array of Data_type
 };
 
 } // end namespace stream
@@ -13,6 +13,13 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/BlasUtils.hpp"
+
+#include <cooperative_groups.h>
+
+#include "cub/device/device_reduce.cuh"
+#include "cub/iterator/counting_input_iterator.cuh"
+#include "cub/iterator/transform_input_iterator.cuh"
 
 #include <iostream>
 #include <utility>
@@ -23,13 +30,15 @@ namespace rajaperf
 namespace stream
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void dot(Real_ptr a, Real_ptr b,
-                    Real_ptr dprod, Real_type dprod_init,
+__global__ void dot(Data_type* a, Data_type* b,
+                    Data_type* dprod, Data_type dprod_init,
                     Index_type iend)
 {
-  extern __shared__ Real_type pdot[ ];
+  // shared memory is declared with one type for all data types
+  extern __shared__ Double_type pdot_shmem[ ];
+  Data_type* pdot = reinterpret_cast<Data_type*>(pdot_shmem);
 
   Index_type i = blockIdx.x * block_size + threadIdx.x;
 
@@ -58,8 +67,182 @@ __global__ void dot(Real_ptr a, Real_ptr b,
 
 }
 
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_partial(Data_type* a, Data_type* b, Data_type* dpartial,
+                            Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type dot = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    DOT_BODY;
+  }
+
+  dot = cuda_block_reduce<block_size, sum_op>(dot);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = dot;
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_final(Data_type* dpartial, Index_type num_partial,
+                          Data_type* dprod, Data_type dot_init)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type dot = sum_op::identity();
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    dot += dpartial[ i ];
+  }
+
+  dot = cuda_block_reduce<block_size, sum_op>(dot);
+
+  if ( threadIdx.x == 0 ) {
+    *dprod = dot_init + dot;
+  }
+}
+
+
+//
+// Term of the dot product at index i, transforms the indices given to the
+// library reduction.
+//
+template < typename Data_type >
+struct DotProduct
+{
+  Data_type* a;
+  Data_type* b;
+
+  __host__ __device__ Data_type operator()(Index_type i) const
+  {
+    return a[i] * b[i];
+  }
+};
+
+
+template < typename Data_type >
+void DOT::runCudaVariantCub(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    cudaStream_t stream = res.get_stream();
+
+    int len = iend - ibegin;
+
+    ::cub::TransformInputIterator<Data_type, DotProduct<Data_type>,
+                                  ::cub::CountingInputIterator<Index_type>>
+        terms(::cub::CountingInputIterator<Index_type>(ibegin),
+              DotProduct<Data_type>{a, b});
+
+    Data_type* prod_storage;
+    allocData(DataSpace::CudaPinned, prod_storage, 1);
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+    cudaErrchk(::cub::DeviceReduce::Reduce(d_temp_storage,
+                                           temp_storage_bytes,
+                                           terms,
+                                           prod_storage,
+                                           len,
+                                           ::cub::Sum(),
+                                           dot_init,
+                                           stream));
 
-template < size_t block_size >
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::CudaDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // Run
+      cudaErrchk(::cub::DeviceReduce::Reduce(d_temp_storage,
+                                             temp_storage_bytes,
+                                             terms,
+                                             prod_storage,
+                                             len,
+                                             ::cub::Sum(),
+                                             dot_init,
+                                             stream));
+
+      cudaErrchk(cudaStreamSynchronize(stream));
+      m_dot += static_cast<Real_type>(*prod_storage);
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::CudaDevice, temp_storage);
+    deallocData(DataSpace::CudaPinned, prod_storage);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+template < typename Data_type >
+void DOT::runCudaVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    cublasHandle_t handle;
+    cublasErrchk( cublasCreate(&handle) );
+    cublasErrchk( cublasSetStream(handle, res.get_stream()) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Data_type dot;
+      cublasErrchk( cublasDot(handle, iend, a, b, &dot) );
+      m_dot += static_cast<Real_type>(dot_init + dot);
+
+    }
+    stopTimer();
+
+    cublasErrchk( cublasDestroy(handle) );
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Cuda blas variant id = " << vid << std::endl;
+
+  }
+
+}
+#endif
+
+template < typename Data_type, size_t block_size >
 void DOT::runCudaVariantBlock(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -72,23 +255,25 @@ void DOT::runCudaVariantBlock(VariantID vid)
 
   if ( vid == Base_CUDA ) {
 
-    Real_ptr dprod;
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    Data_type* dprod;
     allocData(DataSpace::CudaDevice, dprod, 1);
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      cudaErrchk( cudaMemcpyAsync( dprod, &m_dot_init, sizeof(Real_type),
+      cudaErrchk( cudaMemcpyAsync( dprod, &dot_init, sizeof(Data_type),
                                    cudaMemcpyHostToDevice, res.get_stream() ) );
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
-      constexpr size_t shmem = sizeof(Real_type)*block_size;
-      dot<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
-          a, b, dprod, m_dot_init, iend );
+      constexpr size_t shmem = sizeof(Data_type)*block_size;
+      dot<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          a, b, dprod, dot_init, iend );
       cudaErrchk( cudaGetLastError() );
 
-      Real_type lprod;
-      cudaErrchk( cudaMemcpyAsync( &lprod, dprod, sizeof(Real_type),
+      Data_type lprod;
+      cudaErrchk( cudaMemcpyAsync( &lprod, dprod, sizeof(Data_type),
                                    cudaMemcpyDeviceToHost, res.get_stream() ) );
       cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
       m_dot += lprod;
@@ -103,7 +288,7 @@ void DOT::runCudaVariantBlock(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> dot(m_dot_init);
+       RAJA::ReduceSum<RAJA::cuda_reduce, Data_type> dot(static_cast<Data_type>(m_dot_init));
 
        RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
@@ -120,7 +305,7 @@ void DOT::runCudaVariantBlock(VariantID vid)
   }
 }
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 void DOT::runCudaVariantOccGS(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -133,27 +318,31 @@ void DOT::runCudaVariantOccGS(VariantID vid)
 
   if ( vid == Base_CUDA ) {
 
-    Real_ptr dprod;
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    Data_type* dprod;
     allocData(DataSpace::CudaDevice, dprod, 1);
 
-    constexpr size_t shmem = sizeof(Real_type)*block_size;
+    constexpr size_t shmem = sizeof(Data_type)*block_size;
     const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
-        (dot<block_size>), block_size, shmem);
+        (dot<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("dot",
+        (dot<Data_type, block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      cudaErrchk( cudaMemcpyAsync( dprod, &m_dot_init, sizeof(Real_type),
+      cudaErrchk( cudaMemcpyAsync( dprod, &dot_init, sizeof(Data_type),
                                    cudaMemcpyHostToDevice, res.get_stream() ) );
 
       const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       const size_t grid_size = std::min(normal_grid_size, max_grid_size);
-      dot<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
-          a, b, dprod, m_dot_init, iend );
+      dot<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          a, b, dprod, dot_init, iend );
       cudaErrchk( cudaGetLastError() );
 
-      Real_type lprod;
-      cudaErrchk( cudaMemcpyAsync( &lprod, dprod, sizeof(Real_type),
+      Data_type lprod;
+      cudaErrchk( cudaMemcpyAsync( &lprod, dprod, sizeof(Data_type),
                                    cudaMemcpyDeviceToHost, res.get_stream() ) );
       cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
       m_dot += lprod;
@@ -168,7 +357,7 @@ void DOT::runCudaVariantOccGS(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> dot(m_dot_init);
+       RAJA::ReduceSum<RAJA::cuda_reduce, Data_type> dot(static_cast<Data_type>(m_dot_init));
 
        RAJA::forall< RAJA::cuda_exec_occ_calc<block_size, true /*async*/> >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
@@ -185,10 +374,393 @@ void DOT::runCudaVariantOccGS(VariantID vid)
   }
 }
 
-void DOT::runCudaVariant(VariantID vid, size_t tune_idx)
+//
+// Each block reduces a fixed part of a and b and the block results are
+// reduced in order by a single block, so the dot product is the same in
+// every run.
+//
+template < typename Data_type, size_t block_size >
+void DOT::runCudaVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (dot_partial<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("dot_partial",
+        (dot_partial<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dprod;
+    allocData(DataSpace::CudaDevice, dprod, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::CudaDevice, dpartial, grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dot_partial<Data_type, block_size><<<grid_size, block_size,
+                  shmem, res.get_stream()>>>( a, b, dpartial, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      dot_final<Data_type, block_size><<<1, block_size,
+                  shmem, res.get_stream()>>>( dpartial, grid_size,
+                                              dprod, dot_init );
+      cudaErrchk( cudaGetLastError() );
+
+      Data_type lprod;
+      cudaErrchk( cudaMemcpyAsync( &lprod, dprod, sizeof(Data_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dpartial);
+    deallocData(DataSpace::CudaDevice, dprod);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_atomic(Data_type* a, Data_type* b, Data_type* dprod,
+                           Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type dot = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    DOT_BODY;
+  }
+
+  dot = cuda_warp_reduce<sum_op>(dot);
+
+  if ( threadIdx.x % cuda_warp_size == 0 ) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>( dprod, dot );
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_lastblock(Data_type* a, Data_type* b, Data_type* dpartial,
+                              unsigned int* dcount,
+                              Data_type* dprod, Data_type dot_init,
+                              Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  __shared__ bool is_last_block;
+
+  Data_type dot = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    DOT_BODY;
+  }
+
+  dot = cuda_block_reduce<block_size, sum_op>(dot);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = dot;
+    // make the partial visible to the last block before counting this block,
+    // the count wraps back to 0 for the next launch
+    __threadfence();
+    is_last_block = ( atomicInc( dcount, gridDim.x - 1 ) == gridDim.x - 1 );
+  }
+  __syncthreads();
+
+  if ( is_last_block ) {
+
+    dot = sum_op::identity();
+    for ( Index_type j = threadIdx.x ; j < gridDim.x ; j += block_size ) {
+      dot += dpartial[ j ];
+    }
+
+    dot = cuda_block_reduce<block_size, sum_op>(dot);
+
+    if ( threadIdx.x == 0 ) {
+      *dprod = dot_init + dot;
+    }
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_coopgs(Data_type* a, Data_type* b, Data_type* dpartial,
+                           Data_type* dprod, Data_type dot_init,
+                           Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+
+  Data_type dot = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    DOT_BODY;
+  }
+
+  dot = cuda_block_reduce<block_size, sum_op>(dot);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = dot;
+  }
+
+  grid.sync();
+
+  if ( blockIdx.x == 0 ) {
+
+    dot = sum_op::identity();
+    for ( Index_type j = threadIdx.x ; j < gridDim.x ; j += block_size ) {
+      dot += dpartial[ j ];
+    }
+
+    dot = cuda_block_reduce<block_size, sum_op>(dot);
+
+    if ( threadIdx.x == 0 ) {
+      *dprod = dot_init + dot;
+    }
+  }
+}
+
+//
+// Each warp adds its result to the dot product with an atomic in one kernel.
+//
+template < typename Data_type, size_t block_size >
+void DOT::runCudaVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (dot_atomic<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("dot_atomic",
+        (dot_atomic<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dprod;
+    allocData(DataSpace::CudaDevice, dprod, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaMemcpyAsync( dprod, &dot_init, sizeof(Data_type),
+                                   cudaMemcpyHostToDevice, res.get_stream() ) );
+
+      dot_atomic<Data_type, block_size><<<grid_size, block_size,
+                  shmem, res.get_stream()>>>( a, b, dprod, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      Data_type lprod;
+      cudaErrchk( cudaMemcpyAsync( &lprod, dprod, sizeof(Data_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dprod);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+//
+// Each block writes its result and the last block to finish, found with a
+// fence and an atomic counter, reduces the block results in order in the
+// same kernel, so the dot product is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void DOT::runCudaVariantLastBlock(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (dot_lastblock<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("dot_lastblock",
+        (dot_lastblock<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dprod;
+    allocData(DataSpace::CudaDevice, dprod, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::CudaDevice, dpartial, grid_size);
+
+    unsigned int* dcount;
+    allocData(DataSpace::CudaDevice, dcount, 1);
+    cudaErrchk( cudaMemsetAsync( dcount, 0, sizeof(unsigned int),
+                                 res.get_stream() ) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      dot_lastblock<Data_type, block_size><<<grid_size, block_size,
+                  shmem, res.get_stream()>>>( a, b, dpartial, dcount,
+                                              dprod, dot_init, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      Data_type lprod;
+      cudaErrchk( cudaMemcpyAsync( &lprod, dprod, sizeof(Data_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dcount);
+    deallocData(DataSpace::CudaDevice, dpartial);
+    deallocData(DataSpace::CudaDevice, dprod);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+//
+// Each block writes its result and the first block reduces the block
+// results in order after a grid sync in the same cooperative kernel, so
+// the dot product is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void DOT::runCudaVariantCoopGS(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getCudaOccupancyMaxBlocks(
+        (dot_coopgs<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getCudaFuncAttributes("dot_coopgs",
+        (dot_coopgs<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dprod;
+    allocData(DataSpace::CudaDevice, dprod, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::CudaDevice, dpartial, grid_size);
+
+    void* args[] = { &a, &b, &dpartial, &dprod, (void*)&dot_init, &iend };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cudaErrchk( cudaLaunchCooperativeKernel(
+          (const void*)dot_coopgs<Data_type, block_size>, grid_size, block_size,
+          args, shmem, res.get_stream() ) );
+
+      Data_type lprod;
+      cudaErrchk( cudaMemcpyAsync( &lprod, dprod, sizeof(Data_type),
+                                   cudaMemcpyDeviceToHost, res.get_stream() ) );
+      cudaErrchk( cudaStreamSynchronize( res.get_stream() ) );
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::CudaDevice, dpartial);
+    deallocData(DataSpace::CudaDevice, dprod);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Cuda variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < typename Data_type >
+void DOT::runCudaVariantTyped(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
 
+  if ( vid == Base_CUDA ) {
+
+    if (tune_idx == t) {
+
+      runCudaVariantCub<Data_type>(vid);
+
+    }
+
+    t += 1;
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    if (tune_idx == t) {
+
+      runCudaVariantBlas<Data_type>(vid);
+
+    }
+
+    t += 1;
+#endif
+
+  }
+
   if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
 
     seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
@@ -199,7 +771,7 @@ void DOT::runCudaVariant(VariantID vid, size_t tune_idx)
         if (tune_idx == t) {
 
           setBlockSize(block_size);
-          runCudaVariantBlock<block_size>(vid);
+          runCudaVariantBlock<Data_type, block_size>(vid);
 
         }
 
@@ -208,7 +780,7 @@ void DOT::runCudaVariant(VariantID vid, size_t tune_idx)
         if (tune_idx == t) {
 
           setBlockSize(block_size);
-          runCudaVariantOccGS<block_size>(vid);
+          runCudaVariantOccGS<Data_type, block_size>(vid);
 
         }
 
@@ -218,6 +790,68 @@ void DOT::runCudaVariant(VariantID vid, size_t tune_idx)
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantTwoPass<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantAtomic<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runCudaVariantLastBlock<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+      if ( detail::haveCudaCooperativeLaunch() ) {
+
+        seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            if (tune_idx == t) {
+
+              setBlockSize(block_size);
+              runCudaVariantCoopGS<Data_type, block_size>(vid);
+
+            }
+
+            t += 1;
+
+          }
+
+        });
+
+      }
+
+    }
+
   } else {
 
     getCout() << "\n  DOT : Unknown Cuda variant id = " << vid << std::endl;
@@ -226,8 +860,20 @@ void DOT::runCudaVariant(VariantID vid, size_t tune_idx)
 
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DOT, Cuda)
+
 void DOT::setCudaTuningDefinitions(VariantID vid)
 {
+  if ( vid == Base_CUDA ) {
+
+    addVariantTuningName(vid, "cub");
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    addVariantTuningName(vid, "cublas");
+#endif
+
+  }
+
   if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
 
     seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
@@ -243,6 +889,40 @@ void DOT::setCudaTuningDefinitions(VariantID vid)
 
     });
 
+    if ( vid == Base_CUDA ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "atomic_"+std::to_string(block_size));
+
+          addReproducibleVariantTuningName(vid, "lastblock_"+std::to_string(block_size));
+
+        }
+
+      });
+
+      if ( detail::haveCudaCooperativeLaunch() ) {
+
+        seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            addReproducibleVariantTuningName(vid, "coopgs_"+std::to_string(block_size));
+
+          }
+
+        });
+
+      }
+
+    }
+
   }
 }
 
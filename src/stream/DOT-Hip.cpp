@@ -12,7 +12,21 @@
 
 #if defined(RAJA_ENABLE_HIP)
 
+#if defined(__HIPCC__)
+#define ROCPRIM_HIP_API 1
+#include "rocprim/device/device_reduce.hpp"
+#include "rocprim/iterator/counting_iterator.hpp"
+#include "rocprim/iterator/transform_iterator.hpp"
+#elif defined(__CUDACC__)
+#include "cub/device/device_reduce.cuh"
+#include "cub/iterator/counting_input_iterator.cuh"
+#include "cub/iterator/transform_input_iterator.cuh"
+#endif
+
 #include "common/HipDataUtils.hpp"
+#include "common/BlasUtils.hpp"
+
+#include <hip/hip_cooperative_groups.h>
 
 #include <iostream>
 #include <utility>
@@ -23,13 +37,15 @@ namespace rajaperf
 namespace stream
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void dot(Real_ptr a, Real_ptr b,
-                    Real_ptr dprod, Real_type dprod_init,
+__global__ void dot(Data_type* a, Data_type* b,
+                    Data_type* dprod, Data_type dprod_init,
                     Index_type iend)
 {
-  HIP_DYNAMIC_SHARED( Real_type, pdot)
+  // shared memory is declared with one type for all data types
+  HIP_DYNAMIC_SHARED( Double_type, pdot_shmem)
+  Data_type* pdot = reinterpret_cast<Data_type*>(pdot_shmem);
 
   Index_type i = blockIdx.x * block_size + threadIdx.x;
 
@@ -59,8 +75,210 @@ __global__ void dot(Real_ptr a, Real_ptr b,
 
 }
 
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_partial(Data_type* a, Data_type* b, Data_type* dpartial,
+                            Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type dot = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    DOT_BODY;
+  }
+
+  dot = hip_block_reduce<block_size, sum_op>(dot);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = dot;
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_final(Data_type* dpartial, Index_type num_partial,
+                          Data_type* dprod, Data_type dot_init)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type dot = sum_op::identity();
+
+  for ( Index_type i = threadIdx.x ; i < num_partial ; i += block_size ) {
+    dot += dpartial[ i ];
+  }
+
+  dot = hip_block_reduce<block_size, sum_op>(dot);
+
+  if ( threadIdx.x == 0 ) {
+    *dprod = dot_init + dot;
+  }
+}
+
+
+//
+// Term of the dot product at index i, transforms the indices given to the
+// library reduction.
+//
+template < typename Data_type >
+struct DotProduct
+{
+  Data_type* a;
+  Data_type* b;
+
+  __host__ __device__ Data_type operator()(Index_type i) const
+  {
+    return a[i] * b[i];
+  }
+};
+
+
+template < typename Data_type >
+void DOT::runHipVariantRocprim(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    hipStream_t stream = res.get_stream();
+
+    int len = iend - ibegin;
+
+#if defined(__HIPCC__)
+    auto terms = ::rocprim::make_transform_iterator(
+        ::rocprim::make_counting_iterator<Index_type>(ibegin),
+        DotProduct<Data_type>{a, b});
+#elif defined(__CUDACC__)
+    ::cub::TransformInputIterator<Data_type, DotProduct<Data_type>,
+                                  ::cub::CountingInputIterator<Index_type>>
+        terms(::cub::CountingInputIterator<Index_type>(ibegin),
+              DotProduct<Data_type>{a, b});
+#endif
+
+    Data_type* prod_storage;
+    allocData(DataSpace::HipPinned, prod_storage, 1);
+
+    // Determine temporary device storage requirements
+    void* d_temp_storage = nullptr;
+    size_t temp_storage_bytes = 0;
+#if defined(__HIPCC__)
+    hipErrchk(::rocprim::reduce(d_temp_storage,
+                                temp_storage_bytes,
+                                terms,
+                                prod_storage,
+                                dot_init,
+                                len,
+                                rocprim::plus<Data_type>(),
+                                stream));
+#elif defined(__CUDACC__)
+    hipErrchk(::cub::DeviceReduce::Reduce(d_temp_storage,
+                                          temp_storage_bytes,
+                                          terms,
+                                          prod_storage,
+                                          len,
+                                          ::cub::Sum(),
+                                          dot_init,
+                                          stream));
+#endif
+
+    // Allocate temporary storage
+    unsigned char* temp_storage;
+    allocData(DataSpace::HipDevice, temp_storage, temp_storage_bytes);
+    d_temp_storage = temp_storage;
+
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // Run
+#if defined(__HIPCC__)
+      hipErrchk(::rocprim::reduce(d_temp_storage,
+                                  temp_storage_bytes,
+                                  terms,
+                                  prod_storage,
+                                  dot_init,
+                                  len,
+                                  rocprim::plus<Data_type>(),
+                                  stream));
+#elif defined(__CUDACC__)
+      hipErrchk(::cub::DeviceReduce::Reduce(d_temp_storage,
+                                            temp_storage_bytes,
+                                            terms,
+                                            prod_storage,
+                                            len,
+                                            ::cub::Sum(),
+                                            dot_init,
+                                            stream));
+#endif
+
+      hipErrchk(hipStreamSynchronize(stream));
+      m_dot += static_cast<Real_type>(*prod_storage);
+
+    }
+    stopTimer();
+
+    // Free temporary storage
+    deallocData(DataSpace::HipDevice, temp_storage);
+    deallocData(DataSpace::HipPinned, prod_storage);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+template < typename Data_type >
+void DOT::runHipVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    rocblas_handle handle;
+    rocblasErrchk( rocblas_create_handle(&handle) );
+    rocblasErrchk( rocblas_set_stream(handle, res.get_stream()) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Data_type dot;
+      rocblasErrchk( rocblasDot(handle, iend, a, b, &dot) );
+      m_dot += static_cast<Real_type>(dot_init + dot);
+
+    }
+    stopTimer();
+
+    rocblasErrchk( rocblas_destroy_handle(handle) );
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Hip blas variant id = " << vid << std::endl;
+
+  }
+
+}
+#endif
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 void DOT::runHipVariantBlock(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -73,24 +291,26 @@ void DOT::runHipVariantBlock(VariantID vid)
 
   if ( vid == Base_HIP ) {
 
-    Real_ptr dprod;
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    Data_type* dprod;
     allocData(DataSpace::HipDevice, dprod, 1);
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      hipErrchk( hipMemcpyAsync( dprod, &m_dot_init, sizeof(Real_type),
+      hipErrchk( hipMemcpyAsync( dprod, &dot_init, sizeof(Data_type),
                                  hipMemcpyHostToDevice, res.get_stream() ) );
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
-      constexpr size_t shmem = sizeof(Real_type)*block_size;
-      hipLaunchKernelGGL((dot<block_size>), dim3(grid_size), dim3(block_size),
+      constexpr size_t shmem = sizeof(Data_type)*block_size;
+      hipLaunchKernelGGL((dot<Data_type, block_size>), dim3(grid_size), dim3(block_size),
                                             shmem, res.get_stream(),
-                         a, b, dprod, m_dot_init, iend );
+                         a, b, dprod, dot_init, iend );
       hipErrchk( hipGetLastError() );
 
-      Real_type lprod;
-      hipErrchk( hipMemcpyAsync( &lprod, dprod, sizeof(Real_type),
+      Data_type lprod;
+      hipErrchk( hipMemcpyAsync( &lprod, dprod, sizeof(Data_type),
                                  hipMemcpyDeviceToHost, res.get_stream() ) );
       hipErrchk( hipStreamSynchronize( res.get_stream() ) );
       m_dot += lprod;
@@ -105,7 +325,7 @@ void DOT::runHipVariantBlock(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::ReduceSum<RAJA::hip_reduce, Real_type> dot(m_dot_init);
+       RAJA::ReduceSum<RAJA::hip_reduce, Data_type> dot(static_cast<Data_type>(m_dot_init));
 
        RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
@@ -122,7 +342,7 @@ void DOT::runHipVariantBlock(VariantID vid)
   }
 }
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 void DOT::runHipVariantOccGS(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -135,28 +355,32 @@ void DOT::runHipVariantOccGS(VariantID vid)
 
   if ( vid == Base_HIP ) {
 
-    Real_ptr dprod;
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    Data_type* dprod;
     allocData(DataSpace::HipDevice, dprod, 1);
 
-    constexpr size_t shmem = sizeof(Real_type)*block_size;
+    constexpr size_t shmem = sizeof(Data_type)*block_size;
     const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
-        (dot<block_size>), block_size, shmem);
+        (dot<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("dot",
+        (dot<Data_type, block_size>), block_size, shmem) );
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      hipErrchk( hipMemcpyAsync( dprod, &m_dot_init, sizeof(Real_type),
+      hipErrchk( hipMemcpyAsync( dprod, &dot_init, sizeof(Data_type),
                                  hipMemcpyHostToDevice, res.get_stream() ) );
 
       const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       const size_t grid_size = std::min(normal_grid_size, max_grid_size);
-      hipLaunchKernelGGL((dot<block_size>), dim3(grid_size), dim3(block_size),
+      hipLaunchKernelGGL((dot<Data_type, block_size>), dim3(grid_size), dim3(block_size),
                                             shmem, res.get_stream(),
-                         a, b, dprod, m_dot_init, iend );
+                         a, b, dprod, dot_init, iend );
       hipErrchk( hipGetLastError() );
 
-      Real_type lprod;
-      hipErrchk( hipMemcpyAsync( &lprod, dprod, sizeof(Real_type),
+      Data_type lprod;
+      hipErrchk( hipMemcpyAsync( &lprod, dprod, sizeof(Data_type),
                                  hipMemcpyDeviceToHost, res.get_stream() ) );
       hipErrchk( hipStreamSynchronize( res.get_stream() ) );
       m_dot += lprod;
@@ -171,7 +395,7 @@ void DOT::runHipVariantOccGS(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-       RAJA::ReduceSum<RAJA::hip_reduce, Real_type> dot(m_dot_init);
+       RAJA::ReduceSum<RAJA::hip_reduce, Data_type> dot(static_cast<Data_type>(m_dot_init));
 
        RAJA::forall< RAJA::hip_exec_occ_calc<block_size, true /*async*/> >( res,
          RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
@@ -188,10 +412,395 @@ void DOT::runHipVariantOccGS(VariantID vid)
   }
 }
 
-void DOT::runHipVariant(VariantID vid, size_t tune_idx)
+//
+// Each block reduces a fixed part of a and b and the block results are
+// reduced in order by a single block, so the dot product is the same in
+// every run.
+//
+template < typename Data_type, size_t block_size >
+void DOT::runHipVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (dot_partial<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("dot_partial",
+        (dot_partial<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dprod;
+    allocData(DataSpace::HipDevice, dprod, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::HipDevice, dpartial, grid_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL( (dot_partial<Data_type, block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          a, b, dpartial, iend );
+      hipErrchk( hipGetLastError() );
+
+      hipLaunchKernelGGL( (dot_final<Data_type, block_size>), dim3(1), dim3(block_size),
+                          shmem, res.get_stream(),
+                          dpartial, grid_size, dprod, dot_init );
+      hipErrchk( hipGetLastError() );
+
+      Data_type lprod;
+      hipErrchk( hipMemcpyAsync( &lprod, dprod, sizeof(Data_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, dpartial);
+    deallocData(DataSpace::HipDevice, dprod);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_atomic(Data_type* a, Data_type* b, Data_type* dprod,
+                           Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  Data_type dot = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    DOT_BODY;
+  }
+
+  dot = hip_warp_reduce<sum_op>(dot);
+
+  if ( threadIdx.x % hip_warp_size == 0 ) {
+    RAJA::atomicAdd<RAJA::hip_atomic>( dprod, dot );
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_lastblock(Data_type* a, Data_type* b, Data_type* dpartial,
+                              unsigned int* dcount,
+                              Data_type* dprod, Data_type dot_init,
+                              Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  __shared__ bool is_last_block;
+
+  Data_type dot = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    DOT_BODY;
+  }
+
+  dot = hip_block_reduce<block_size, sum_op>(dot);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = dot;
+    // make the partial visible to the last block before counting this block,
+    // the count wraps back to 0 for the next launch
+    __threadfence();
+    is_last_block = ( atomicInc( dcount, gridDim.x - 1 ) == gridDim.x - 1 );
+  }
+  __syncthreads();
+
+  if ( is_last_block ) {
+
+    dot = sum_op::identity();
+    for ( Index_type j = threadIdx.x ; j < gridDim.x ; j += block_size ) {
+      dot += dpartial[ j ];
+    }
+
+    dot = hip_block_reduce<block_size, sum_op>(dot);
+
+    if ( threadIdx.x == 0 ) {
+      *dprod = dot_init + dot;
+    }
+  }
+}
+
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void dot_coopgs(Data_type* a, Data_type* b, Data_type* dpartial,
+                           Data_type* dprod, Data_type dot_init,
+                           Index_type iend)
+{
+  using sum_op = RAJA::operators::plus<Data_type>;
+
+  cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+
+  Data_type dot = sum_op::identity();
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    DOT_BODY;
+  }
+
+  dot = hip_block_reduce<block_size, sum_op>(dot);
+
+  if ( threadIdx.x == 0 ) {
+    dpartial[ blockIdx.x ] = dot;
+  }
+
+  grid.sync();
+
+  if ( blockIdx.x == 0 ) {
+
+    dot = sum_op::identity();
+    for ( Index_type j = threadIdx.x ; j < gridDim.x ; j += block_size ) {
+      dot += dpartial[ j ];
+    }
+
+    dot = hip_block_reduce<block_size, sum_op>(dot);
+
+    if ( threadIdx.x == 0 ) {
+      *dprod = dot_init + dot;
+    }
+  }
+}
+
+//
+// Each warp adds its result to the dot product with an atomic in one kernel.
+//
+template < typename Data_type, size_t block_size >
+void DOT::runHipVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (dot_atomic<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("dot_atomic",
+        (dot_atomic<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dprod;
+    allocData(DataSpace::HipDevice, dprod, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipMemcpyAsync( dprod, &dot_init, sizeof(Data_type),
+                                 hipMemcpyHostToDevice, res.get_stream() ) );
+
+      hipLaunchKernelGGL( (dot_atomic<Data_type, block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          a, b, dprod, iend );
+      hipErrchk( hipGetLastError() );
+
+      Data_type lprod;
+      hipErrchk( hipMemcpyAsync( &lprod, dprod, sizeof(Data_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, dprod);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+//
+// Each block writes its result and the last block to finish, found with a
+// fence and an atomic counter, reduces the block results in order in the
+// same kernel, so the dot product is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void DOT::runHipVariantLastBlock(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (dot_lastblock<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("dot_lastblock",
+        (dot_lastblock<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dprod;
+    allocData(DataSpace::HipDevice, dprod, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::HipDevice, dpartial, grid_size);
+
+    unsigned int* dcount;
+    allocData(DataSpace::HipDevice, dcount, 1);
+    hipErrchk( hipMemsetAsync( dcount, 0, sizeof(unsigned int),
+                               res.get_stream() ) );
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipLaunchKernelGGL( (dot_lastblock<Data_type, block_size>), dim3(grid_size), dim3(block_size),
+                          shmem, res.get_stream(),
+                          a, b, dpartial, dcount, dprod, dot_init, iend );
+      hipErrchk( hipGetLastError() );
+
+      Data_type lprod;
+      hipErrchk( hipMemcpyAsync( &lprod, dprod, sizeof(Data_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, dcount);
+    deallocData(DataSpace::HipDevice, dpartial);
+    deallocData(DataSpace::HipDevice, dprod);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+//
+// Each block writes its result and the first block reduces the block
+// results in order after a grid sync in the same cooperative kernel, so
+// the dot product is the same in every run.
+//
+template < typename Data_type, size_t block_size >
+void DOT::runHipVariantCoopGS(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  DOT_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    const Data_type dot_init = static_cast<Data_type>(m_dot_init);
+
+    constexpr size_t shmem = 0;
+    const size_t max_grid_size = detail::getHipOccupancyMaxBlocks(
+        (dot_coopgs<Data_type, block_size>), block_size, shmem);
+    setGPUFuncAttributes( detail::getHipFuncAttributes("dot_coopgs",
+        (dot_coopgs<Data_type, block_size>), block_size, shmem) );
+
+    const size_t normal_grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+    const size_t grid_size = std::min(normal_grid_size, max_grid_size);
+
+    Data_type* dprod;
+    allocData(DataSpace::HipDevice, dprod, 1);
+
+    Data_type* dpartial;
+    allocData(DataSpace::HipDevice, dpartial, grid_size);
+
+    void* args[] = { &a, &b, &dpartial, &dprod, (void*)&dot_init, &iend };
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      hipErrchk( hipLaunchCooperativeKernel(
+          reinterpret_cast<const void*>(dot_coopgs<Data_type, block_size>),
+          dim3(grid_size), dim3(block_size), args, shmem, res.get_stream() ) );
+
+      Data_type lprod;
+      hipErrchk( hipMemcpyAsync( &lprod, dprod, sizeof(Data_type),
+                                 hipMemcpyDeviceToHost, res.get_stream() ) );
+      hipErrchk( hipStreamSynchronize( res.get_stream() ) );
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    deallocData(DataSpace::HipDevice, dpartial);
+    deallocData(DataSpace::HipDevice, dprod);
+
+  } else {
+
+    getCout() << "\n  DOT : Unknown Hip variant id = " << vid << std::endl;
+
+  }
+
+}
+
+template < typename Data_type >
+void DOT::runHipVariantTyped(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
 
+  if ( vid == Base_HIP ) {
+
+    if (tune_idx == t) {
+
+      runHipVariantRocprim<Data_type>(vid);
+
+    }
+
+    t += 1;
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    if (tune_idx == t) {
+
+      runHipVariantBlas<Data_type>(vid);
+
+    }
+
+    t += 1;
+#endif
+
+  }
+
   if ( vid == Base_HIP || vid == RAJA_HIP ) {
 
     seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
@@ -202,7 +811,7 @@ void DOT::runHipVariant(VariantID vid, size_t tune_idx)
         if (tune_idx == t) {
 
           setBlockSize(block_size);
-          runHipVariantBlock<block_size>(vid);
+          runHipVariantBlock<Data_type, block_size>(vid);
 
         }
 
@@ -211,7 +820,7 @@ void DOT::runHipVariant(VariantID vid, size_t tune_idx)
         if (tune_idx == t) {
 
           setBlockSize(block_size);
-          runHipVariantOccGS<block_size>(vid);
+          runHipVariantOccGS<Data_type, block_size>(vid);
 
         }
 
@@ -221,6 +830,68 @@ void DOT::runHipVariant(VariantID vid, size_t tune_idx)
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantTwoPass<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantAtomic<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+          if (tune_idx == t) {
+
+            setBlockSize(block_size);
+            runHipVariantLastBlock<Data_type, block_size>(vid);
+
+          }
+
+          t += 1;
+
+        }
+
+      });
+
+      if ( detail::haveHipCooperativeLaunch() ) {
+
+        seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            if (tune_idx == t) {
+
+              setBlockSize(block_size);
+              runHipVariantCoopGS<Data_type, block_size>(vid);
+
+            }
+
+            t += 1;
+
+          }
+
+        });
+
+      }
+
+    }
+
   } else {
 
     getCout() << "\n  DOT : Unknown Hip variant id = " << vid << std::endl;
@@ -229,8 +900,24 @@ void DOT::runHipVariant(VariantID vid, size_t tune_idx)
 
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DOT, Hip)
+
 void DOT::setHipTuningDefinitions(VariantID vid)
 {
+  if ( vid == Base_HIP ) {
+
+#if defined(__HIPCC__)
+    addVariantTuningName(vid, "rocprim");
+#elif defined(__CUDACC__)
+    addVariantTuningName(vid, "cub");
+#endif
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+    addVariantTuningName(vid, "rocblas");
+#endif
+
+  }
+
   if ( vid == Base_HIP || vid == RAJA_HIP ) {
 
     seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
@@ -246,6 +933,40 @@ void DOT::setHipTuningDefinitions(VariantID vid)
 
     });
 
+    if ( vid == Base_HIP ) {
+
+      seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+        if (run_params.numValidGPUBlockSize() == 0u ||
+            run_params.validGPUBlockSize(block_size)) {
+
+          addReproducibleVariantTuningName(vid, "two_pass_"+std::to_string(block_size));
+
+          addVariantTuningName(vid, "atomic_"+std::to_string(block_size));
+
+          addReproducibleVariantTuningName(vid, "lastblock_"+std::to_string(block_size));
+
+        }
+
+      });
+
+      if ( detail::haveHipCooperativeLaunch() ) {
+
+        seq_for(gpu_warp_block_sizes_type{}, [&](auto block_size) {
+
+          if (run_params.numValidGPUBlockSize() == 0u ||
+              run_params.validGPUBlockSize(block_size)) {
+
+            addReproducibleVariantTuningName(vid, "coopgs_"+std::to_string(block_size));
+
+          }
+
+        });
+
+      }
+
+    }
+
   }
 
 }
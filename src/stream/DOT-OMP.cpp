@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,8 +19,79 @@ namespace stream
 {
 
 
-void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// Each thread sums a fixed block of the iteration space and the thread
+// partial sums are combined in thread order, so the result is the same in
+// every run that uses the same number of threads.
+//
+template < typename Data_type >
+void DOT::runOpenMPVariantOrdered(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DOT_DATA_SETUP;
+
+  // partial sum of each thread
+  const Index_type nthreads = omp_get_max_threads();
+  std::vector<Data_type> partial_sums(nthreads);
+  Data_type* partial = partial_sums.data();
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Index_type nt_used = 1;
+
+      #pragma omp parallel
+      {
+        const Index_type nt = omp_get_num_threads();
+        const Index_type tid = omp_get_thread_num();
+        const Index_type len = iend - ibegin;
+
+        Data_type dot = 0;
+        for (Index_type i = ibegin + (len*tid)/nt;
+             i < ibegin + (len*(tid+1))/nt; ++i ) {
+          DOT_BODY;
+        }
+        partial[tid] = dot;
+
+        if ( tid == 0 ) {
+          nt_used = nt;
+        }
+      }
+
+      Data_type dot = static_cast<Data_type>(m_dot_init);
+      for (Index_type t = 0; t < nt_used; ++t ) {
+        dot += partial[t];
+      }
+
+      m_dot += dot;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  DOT : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < typename Data_type >
+void DOT::runOpenMPVariantTyped(VariantID vid, size_t tune_idx)
 {
+  if ( vid == Base_OpenMP && tune_idx == 1 ) {
+    runOpenMPVariantOrdered<Data_type>(vid);
+    return;
+  }
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
@@ -35,7 +107,7 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Data_type dot = static_cast<Data_type>(m_dot_init);
 
         #pragma omp parallel for reduction(+:dot)
         for (Index_type i = ibegin; i < iend; ++i ) {
@@ -52,14 +124,14 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
     case Lambda_OpenMP : {
 
-      auto dot_base_lam = [=](Index_type i) -> Real_type {
+      auto dot_base_lam = [=](Index_type i) -> Data_type {
                             return a[i] * b[i];
                           };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Data_type dot = static_cast<Data_type>(m_dot_init);
 
         #pragma omp parallel for reduction(+:dot)
         for (Index_type i = ibegin; i < iend; ++i ) {
@@ -79,7 +151,7 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> dot(m_dot_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Data_type> dot(m_dot_init);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
@@ -102,8 +174,20 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DOT, OpenMP)
+
+void DOT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addReproducibleVariantTuningName(vid, "ordered");
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
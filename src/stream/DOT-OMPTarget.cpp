@@ -26,9 +26,12 @@ namespace stream
   //
   const size_t threads_per_team = 256;
 
-void DOT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void DOT::runOpenMPTargetVariantTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
@@ -39,13 +42,22 @@ void DOT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      Real_type dot = m_dot_init;
-
-      #pragma omp target is_device_ptr(a, b) device( did ) map(tofrom:dot)
-      #pragma omp teams distribute parallel for reduction(+:dot) \
-              thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        DOT_BODY;
+      Data_type dot = static_cast<Data_type>(m_dot_init);
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(a, b) device( did ) map(tofrom:dot)
+        #pragma omp teams distribute parallel for reduction(+:dot) \
+                num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DOT_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(a, b) device( did ) map(tofrom:dot)
+        #pragma omp teams distribute parallel for reduction(+:dot) \
+                thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DOT_BODY;
+        }
       }
 
       m_dot += dot;
@@ -58,7 +70,7 @@ void DOT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::ReduceSum<RAJA::omp_target_reduce, Real_type> dot(m_dot_init);
+      RAJA::ReduceSum<RAJA::omp_target_reduce, Data_type> dot(m_dot_init);
 
       RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
@@ -75,6 +87,8 @@ void DOT::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   }
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DOT, OpenMPTarget)
+
 } // end namespace stream
 } // end namespace rajaperf
 
@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/BlasUtils.hpp"
+#include "common/SimdUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +21,8 @@ namespace stream
 {
 
 
-void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void DOT::runSeqVariantSimd(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -33,7 +37,94 @@ void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Data_type dot = static_cast<Data_type>(m_dot_init);
+
+        RAJAPERF_SIMD_REDUCTION(+, dot)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DOT_BODY;
+        }
+
+         m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DOT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+template < typename Data_type >
+void DOT::runSeqVariantCblas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  DOT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Data_type dot = static_cast<Data_type>(m_dot_init);
+
+        dot += cblasDot(iend, a, b);
+
+        m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DOT : Unknown cblas variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
+template < typename Data_type >
+void DOT::runSeqVariantTyped(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd<Data_type>(vid);
+    return;
+  }
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+  if ( tune_idx == 2 ) {
+    runSeqVariantCblas<Data_type>(vid);
+    return;
+  }
+#endif
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DOT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Data_type dot = static_cast<Data_type>(m_dot_init);
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           DOT_BODY;
@@ -50,14 +141,14 @@ void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto dot_base_lam = [=](Index_type i) -> Real_type {
+      auto dot_base_lam = [=](Index_type i) -> Data_type {
                             return a[i] * b[i];
                           };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Data_type dot = static_cast<Data_type>(m_dot_init);
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           dot += dot_base_lam(i);
@@ -76,7 +167,7 @@ void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> dot(m_dot_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Data_type> dot(m_dot_init);
 
         RAJA::forall<RAJA::seq_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
@@ -100,5 +191,19 @@ void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(DOT, Seq)
+
+void DOT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+    addVariantTuningName(vid, "cblas");
+#endif
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
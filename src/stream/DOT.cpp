@@ -34,8 +34,13 @@ DOT::DOT(const RunParams& params)
   setFLOPsPerRep(2 * getActualProblemSize());
 
   setUsesFeature( Forall );
+
+  setUsesFloatingPointDataTypes();
   setUsesFeature( Reduction );
 
+  setHasPattern( Streaming );
+  setHasPattern( ReductionBound );
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -44,6 +49,8 @@ DOT::DOT(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -60,13 +67,9 @@ DOT::~DOT()
 {
 }
 
-void DOT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DOT::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitData(m_a, getActualProblemSize(), vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-
-  m_dot = 0.0;
-  m_dot_init = 0.0;
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void DOT::updateChecksum(VariantID vid, size_t tune_idx)
@@ -74,11 +77,34 @@ void DOT::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid][tune_idx] += m_dot;
 }
 
-void DOT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DOT::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void DOT::setUpTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Data_type* a;
+  Data_type* b;
+  allocAndInitData(a, getActualProblemSize(), vid);
+  allocAndInitData(b, getActualProblemSize(), vid);
+  m_a = a;
+  m_b = b;
+
+  m_dot = 0.0;
+  m_dot_init = 0.0;
+}
+
+template < typename Data_type >
+void DOT::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  (void) vid;
-  deallocData(m_a, vid);
-  deallocData(m_b, vid);
+  Data_type* a = static_cast<Data_type*>(m_a);
+  Data_type* b = static_cast<Data_type*>(m_b);
+  deallocData(a, vid);
+  deallocData(b, vid);
+  m_a = nullptr;
+  m_b = nullptr;
 }
 
 } // end namespace stream
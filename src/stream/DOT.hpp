@@ -13,19 +13,23 @@
 ///   dot += a[i] * b[i];
 /// }
 ///
+/// The cblas, cublas, and rocblas tunings call the dot routine of the
+/// vendor BLAS library, which may sum in a different order.
+///
 
 #ifndef RAJAPerf_Stream_DOT_HPP
 #define RAJAPerf_Stream_DOT_HPP
 
 #define DOT_DATA_SETUP \
-  Real_ptr a = m_a; \
-  Real_ptr b = m_b;
+  Data_type* a = static_cast<Data_type*>(m_a); \
+  Data_type* b = static_cast<Data_type*>(m_b);
 
 #define DOT_BODY  \
   dot += a[i] * b[i] ;
 
 
 #include "common/KernelBase.hpp"
+#include "common/DataTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -53,23 +57,76 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  template < typename Data_type >
+  void setUpTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void tearDownTyped(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void runSeqVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPTargetVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runKokkosVariantTyped(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type >
+  void runSeqVariantSimd(VariantID vid);
+  template < typename Data_type >
+  void runSeqVariantCblas(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantOrdered(VariantID vid);
+  template < typename Data_type >
+  void runCudaVariantCub(VariantID vid);
+  template < typename Data_type >
+  void runHipVariantRocprim(VariantID vid);
+  template < typename Data_type >
+  void runCudaVariantBlas(VariantID vid);
+  template < typename Data_type >
+  void runHipVariantBlas(VariantID vid);
+  template < typename Data_type, size_t block_size >
   void runCudaVariantBlock(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
   void runCudaVariantOccGS(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
   void runHipVariantBlock(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
   void runHipVariantOccGS(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantTwoPass(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantTwoPass(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantAtomic(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantAtomic(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantLastBlock(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantLastBlock(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantCoopGS(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantCoopGS(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  // warp shuffle tunings need whole warps on every gpu backend
+  using gpu_warp_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
+                                                     gpu_block_size::MultipleOf<64>>;
 
-  Real_ptr m_a;
-  Real_ptr m_b;
+  void* m_a; // array of Data_type
+  void* m_b; // array of Data_type
   Real_type m_dot;
   Real_type m_dot_init;
 };
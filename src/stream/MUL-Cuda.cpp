@@ -13,6 +13,9 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/BlasUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/NontemporalUtils.hpp"
 
 #include <iostream>
 
@@ -21,9 +24,9 @@ namespace rajaperf
 namespace stream
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void mul(Real_ptr b, Real_ptr c, Real_type alpha,
+__global__ void mul(Data_type* b, Data_type* c, Data_type alpha,
                     Index_type iend)
 {
   Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -33,7 +36,18 @@ __global__ void mul(Real_ptr b, Real_ptr c, Real_type alpha,
 }
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mul_nontemporal(Data_type* b, Data_type* c, Data_type alpha,
+                                Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    MUL_BODY_NONTEMPORAL;
+  }
+}
+
+template < typename Data_type, size_t block_size, bool launch >
 void MUL::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -44,14 +58,43 @@ void MUL::runCudaVariantImpl(VariantID vid)
 
   MUL_DATA_SETUP;
 
-  if ( vid == Base_CUDA ) {
+  if ( vid == Base_CUDA && run_params.getMultiGPU() ) {
+
+    // each device owns a chunk of the arrays, copied outside the timer
+    auto parts = detail::makeCudaPartitions(iend);
+    auto b_chunks = detail::scatterCudaPartitions(parts, b);
+    auto c_chunks = detail::scatterCudaPartitions(parts, c);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t p = 0; p < parts.devices.size(); ++p) {
+        const Index_type part_len = parts.offsets[p+1] - parts.offsets[p];
+        cudaErrchk( cudaSetDevice(parts.devices[p]) );
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(part_len, block_size);
+        constexpr size_t shmem = 0;
+        mul<Data_type, block_size><<<grid_size, block_size, shmem, parts.streams[p]>>>(
+            b_chunks[p], c_chunks[p], alpha, part_len );
+        cudaErrchk( cudaGetLastError() );
+      }
+
+    }
+    detail::synchronizeCudaPartitions(parts);
+    stopTimer();
+
+    detail::gatherCudaPartitions(parts, b_chunks, b);
+    detail::freeCudaPartitions(parts, b_chunks);
+    detail::freeCudaPartitions(parts, c_chunks);
+    detail::destroyCudaPartitions(parts);
+
+  } else if ( vid == Base_CUDA ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      mul<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( b, c, alpha,
+      mul<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( b, c, alpha,
                                       iend );
       cudaErrchk( cudaGetLastError() );
 
@@ -79,7 +122,7 @@ void MUL::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         MUL_BODY;
       });
@@ -92,7 +135,153 @@ void MUL::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(MUL, Cuda)
+template < typename Data_type, size_t block_size >
+void MUL::runCudaVariantNontemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  MUL_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      mul_nontemporal<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          b, c, alpha, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  MUL : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+template < typename Data_type >
+void MUL::runCudaVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  MUL_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    cublasHandle_t handle;
+    cublasErrchk( cublasCreate(&handle) );
+    cublasErrchk( cublasSetStream(handle, res.get_stream()) );
+
+    // b = alpha * c is the geam of n x 1 matrices b = alpha * c + 0 * b
+    const Data_type zero = 0.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      cublasErrchk( cublasGeam(handle, iend, 1, &alpha, c, &zero, b, b) );
+
+    }
+    stopTimer();
+
+    cublasErrchk( cublasDestroy(handle) );
+
+  } else {
+     getCout() << "\n  MUL : Unknown Cuda blas variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+template < typename Data_type >
+void MUL::runCudaVariantTyped(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runCudaVariantImpl<Data_type, block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runCudaVariantNontemporal<Data_type, block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Cuda, Impl, RAJAPERF_GPU_LAUNCH_TYPED_TPARAMS)
+
+  }
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_CUDA ) {
+    if (tune_idx == t) {
+      runCudaVariantBlas<Data_type>(vid);
+    }
+    t += 1;
+  }
+#endif
+}
+
+void MUL::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid,
+            "nontemporal_block_"+std::to_string(block_size));
+      }
+    });
+
+  }
+
+  if ( vid == RAJA_CUDA ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_CUDA ) {
+    addVariantTuningName(vid, "cublas");
+  }
+#endif
+}
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(MUL, Cuda)
 
 } // end namespace stream
 } // end namespace rajaperf
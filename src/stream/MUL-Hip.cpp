@@ -13,6 +13,9 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/BlasUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/NontemporalUtils.hpp"
 
 #include <iostream>
 
@@ -21,9 +24,9 @@ namespace rajaperf
 namespace stream
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void mul(Real_ptr b, Real_ptr c, Real_type alpha,
+__global__ void mul(Data_type* b, Data_type* c, Data_type alpha,
                     Index_type iend)
 {
   Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -33,7 +36,18 @@ __global__ void mul(Real_ptr b, Real_ptr c, Real_type alpha,
 }
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void mul_nontemporal(Data_type* b, Data_type* c, Data_type alpha,
+                                Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    MUL_BODY_NONTEMPORAL;
+  }
+}
+
+template < typename Data_type, size_t block_size, bool launch >
 void MUL::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -44,14 +58,43 @@ void MUL::runHipVariantImpl(VariantID vid)
 
   MUL_DATA_SETUP;
 
-  if ( vid == Base_HIP ) {
+  if ( vid == Base_HIP && run_params.getMultiGPU() ) {
+
+    // each device owns a chunk of the arrays, copied outside the timer
+    auto parts = detail::makeHipPartitions(iend);
+    auto b_chunks = detail::scatterHipPartitions(parts, b);
+    auto c_chunks = detail::scatterHipPartitions(parts, c);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t p = 0; p < parts.devices.size(); ++p) {
+        const Index_type part_len = parts.offsets[p+1] - parts.offsets[p];
+        hipErrchk( hipSetDevice(parts.devices[p]) );
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(part_len, block_size);
+        constexpr size_t shmem = 0;
+        hipLaunchKernelGGL((mul<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, parts.streams[p],
+            b_chunks[p], c_chunks[p], alpha, part_len );
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    detail::synchronizeHipPartitions(parts);
+    stopTimer();
+
+    detail::gatherHipPartitions(parts, b_chunks, b);
+    detail::freeHipPartitions(parts, b_chunks);
+    detail::freeHipPartitions(parts, c_chunks);
+    detail::destroyHipPartitions(parts);
+
+  } else if ( vid == Base_HIP ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      hipLaunchKernelGGL((mul<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  b, c, alpha,
+      hipLaunchKernelGGL((mul<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  b, c, alpha,
                                       iend );
       hipErrchk( hipGetLastError() );
 
@@ -81,7 +124,7 @@ void MUL::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         MUL_BODY;
       });
@@ -94,7 +137,153 @@ void MUL::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(MUL, Hip)
+template < typename Data_type, size_t block_size >
+void MUL::runHipVariantNontemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  MUL_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((mul_nontemporal<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+          b, c, alpha, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  MUL : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+template < typename Data_type >
+void MUL::runHipVariantBlas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  MUL_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    rocblas_handle handle;
+    rocblasErrchk( rocblas_create_handle(&handle) );
+    rocblasErrchk( rocblas_set_stream(handle, res.get_stream()) );
+
+    // b = alpha * c is the geam of n x 1 matrices b = alpha * c + 0 * b
+    const Data_type zero = 0.0;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      rocblasErrchk( rocblasGeam(handle, iend, 1, &alpha, c, &zero, b, b) );
+
+    }
+    stopTimer();
+
+    rocblasErrchk( rocblas_destroy_handle(handle) );
+
+  } else {
+     getCout() << "\n  MUL : Unknown Hip blas variant id = " << vid << std::endl;
+  }
+}
+#endif
+
+template < typename Data_type >
+void MUL::runHipVariantTyped(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      if (tune_idx == t) {
+        setBlockSize(block_size);
+        runHipVariantImpl<Data_type, block_size>(vid);
+      }
+      t += 1;
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        if (tune_idx == t) {
+          setBlockSize(block_size);
+          runHipVariantNontemporal<Data_type, block_size>(vid);
+        }
+        t += 1;
+      }
+    });
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_RUN(Hip, Impl, RAJAPERF_GPU_LAUNCH_TYPED_TPARAMS)
+
+  }
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_HIP ) {
+    if (tune_idx == t) {
+      runHipVariantBlas<Data_type>(vid);
+    }
+    t += 1;
+  }
+#endif
+}
+
+void MUL::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+    }
+  });
+
+  if ( vid == Base_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+        addVariantTuningName(vid,
+            "nontemporal_block_"+std::to_string(block_size));
+      }
+    });
+
+  }
+
+  if ( vid == RAJA_HIP ) {
+
+    RAJAPERF_GPU_LAUNCH_TUNING_NAMES
+
+  }
+
+#if defined(RAJA_PERFSUITE_USE_VENDOR_BLAS)
+  if ( vid == Base_HIP ) {
+    addVariantTuningName(vid, "rocblas");
+  }
+#endif
+}
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(MUL, Hip)
 
 } // end namespace stream
 } // end namespace rajaperf
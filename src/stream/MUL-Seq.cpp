@@ -10,6 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/BlasUtils.hpp"
+#include "common/SimdUtils.hpp"
+#include "common/NontemporalUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +22,8 @@ namespace stream
 {
 
 
-void MUL::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void MUL::runSeqVariantSimd(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -26,6 +31,148 @@ void MUL::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   MUL_DATA_SETUP;
 
+#if defined(RUN_RAJA_SEQ)
+  auto mul_lam = [=](Index_type i) {
+                   MUL_BODY;
+                 };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          MUL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), mul_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  MUL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < typename Data_type >
+void MUL::runSeqVariantNontemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MUL_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          MUL_BODY_NONTEMPORAL;
+        }
+        fenceNontemporal();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MUL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+template < typename Data_type >
+void MUL::runSeqVariantCblas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  MUL_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      // CBLAS has no out of place scal, so copy c to b and scale b
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        cblasCopy(iend, c, b);
+        cblasScal(iend, alpha, b);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MUL : Unknown cblas variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
+template < typename Data_type >
+void MUL::runSeqVariantTyped(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 1 ) {
+    runSeqVariantSimd<Data_type>(vid);
+    return;
+  }
+  if ( tune_idx == 2 ) {
+    runSeqVariantNontemporal<Data_type>(vid);
+    return;
+  }
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+  if ( tune_idx == 3 ) {
+    runSeqVariantCblas<Data_type>(vid);
+    return;
+  }
+#endif
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MUL_DATA_SETUP;
+
 #if defined(RUN_RAJA_SEQ)
   auto mul_lam = [=](Index_type i) {
                    MUL_BODY;
@@ -88,5 +235,23 @@ void MUL::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(MUL, Seq)
+
+void MUL::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, getSimdTuningName());
+  }
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "nontemporal");
+#if defined(RAJA_PERFSUITE_USE_CBLAS)
+    addVariantTuningName(vid, "cblas");
+#endif
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -34,6 +34,10 @@ MUL::MUL(const RunParams& params)
 
   setUsesFeature( Forall );
 
+  setHasPattern( Streaming );
+
+  setUsesFloatingPointDataTypes();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -42,6 +46,8 @@ MUL::MUL(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -53,6 +59,9 @@ MUL::MUL(const RunParams& params)
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
 
+  setVariantDefined( Base_SYCL );
+  setVariantDefined( RAJA_SYCL );
+
   setVariantDefined( Kokkos_Lambda );
 }
 
@@ -60,23 +69,49 @@ MUL::~MUL()
 {
 }
 
-void MUL::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void MUL::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_b, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_c, getActualProblemSize(), vid);
-  initData(m_alpha, vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void MUL::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_b, getActualProblemSize(), vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), updateChecksumTyped, vid, tune_idx);
+}
+
+void MUL::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void MUL::setUpTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Data_type* b;
+  Data_type* c;
+  allocAndInitDataConst(b, getActualProblemSize(), Data_type(0), vid);
+  allocAndInitData(c, getActualProblemSize(), vid);
+  initData(m_alpha, vid);
+  m_b = b;
+  m_c = c;
+}
+
+template < typename Data_type >
+void MUL::updateChecksumTyped(VariantID vid, size_t tune_idx)
+{
+  Data_type* b = static_cast<Data_type*>(m_b);
+  checksum[vid][tune_idx] += calcChecksum(b, getActualProblemSize(), vid);
 }
 
-void MUL::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void MUL::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  (void) vid;
-  deallocData(m_b, vid);
-  deallocData(m_c, vid);
+  Data_type* b = static_cast<Data_type*>(m_b);
+  Data_type* c = static_cast<Data_type*>(m_c);
+  deallocData(b, vid);
+  deallocData(c, vid);
+  m_b = nullptr;
+  m_c = nullptr;
 }
 
 } // end namespace stream
@@ -13,20 +13,31 @@
 ///   b[i] = alpha * c[i] ;
 /// }
 ///
+/// The nontemporal tunings write b with non-temporal stores, which do not
+/// read the lines they write, so the traffic is the bytes per rep counted.
+///
+/// The cublas and rocblas tunings call the geam routine of the vendor BLAS
+/// library as BLAS has no out of place scal, the cblas tuning calls copy
+/// then scal, which moves more bytes than counted.
+///
 
 #ifndef RAJAPerf_Stream_MUL_HPP
 #define RAJAPerf_Stream_MUL_HPP
 
 #define MUL_DATA_SETUP \
-  Real_ptr b = m_b; \
-  Real_ptr c = m_c; \
-  Real_type alpha = m_alpha;
+  Data_type* b = static_cast<Data_type*>(m_b); \
+  Data_type* c = static_cast<Data_type*>(m_c); \
+  Data_type alpha = static_cast<Data_type>(m_alpha);
 
 #define MUL_BODY  \
   b[i] = alpha * c[i] ;
 
+#define MUL_BODY_NONTEMPORAL  \
+  storeNontemporal(&b[i], alpha * c[i]);
+
 
 #include "common/KernelBase.hpp"
+#include "common/DataTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -52,21 +63,68 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runSyclVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  template < typename Data_type >
+  void setUpTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void updateChecksumTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void tearDownTyped(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void runSeqVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runSyclVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPTargetVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runKokkosVariantTyped(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void setSyclTuningDefinitions(VariantID vid);
+  void setOpenMPTargetTuningDefinitions(VariantID vid);
+  template < typename Data_type >
+  void runSeqVariantSimd(VariantID vid);
+  template < typename Data_type >
+  void runSeqVariantNontemporal(VariantID vid);
+  template < typename Data_type >
+  void runSeqVariantCblas(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantNontemporal(VariantID vid);
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantNontemporal(VariantID vid);
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantNontemporal(VariantID vid);
+  template < typename Data_type >
+  void runCudaVariantBlas(VariantID vid);
+  template < typename Data_type >
+  void runHipVariantBlas(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runSyclVariantImpl(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPTargetVariantMapped(VariantID vid, size_t tune_idx);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
-  Real_ptr m_b;
-  Real_ptr m_c;
+  void* m_b; // array of Data_type
+  void* m_c; // array of Data_type
   Real_type m_alpha;
 };
 
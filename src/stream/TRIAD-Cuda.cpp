@@ -13,6 +13,9 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include "common/CudaDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/NontemporalUtils.hpp"
+#include "common/StorageUtils.hpp"
 
 #include <iostream>
 
@@ -21,9 +24,9 @@ namespace rajaperf
 namespace stream
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void triad(Real_ptr a, Real_ptr b, Real_ptr c, Real_type alpha,
+__global__ void triad(Data_type* a, Data_type* b, Data_type* c, Data_type alpha,
                       Index_type iend)
 {
   Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -33,7 +36,30 @@ __global__ void triad(Real_ptr a, Real_ptr b, Real_ptr c, Real_type alpha,
 }
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void triad_nontemporal(Data_type* a, Data_type* b, Data_type* c, Data_type alpha,
+                                  Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    TRIAD_BODY_NONTEMPORAL;
+  }
+}
+
+template < typename Data_type, typename Storage_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void triad_storage(Storage_type* a, Storage_type* b, Storage_type* c,
+                              Data_type alpha,
+                              Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    TRIAD_STORAGE_BODY;
+  }
+}
+
+template < typename Data_type, size_t block_size, bool launch >
 void TRIAD::runCudaVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -44,14 +70,45 @@ void TRIAD::runCudaVariantImpl(VariantID vid)
 
   TRIAD_DATA_SETUP;
 
-  if ( vid == Base_CUDA ) {
+  if ( vid == Base_CUDA && run_params.getMultiGPU() ) {
+
+    // each device owns a chunk of the arrays, copied outside the timer
+    auto parts = detail::makeCudaPartitions(iend);
+    auto a_chunks = detail::scatterCudaPartitions(parts, a);
+    auto b_chunks = detail::scatterCudaPartitions(parts, b);
+    auto c_chunks = detail::scatterCudaPartitions(parts, c);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t p = 0; p < parts.devices.size(); ++p) {
+        const Index_type part_len = parts.offsets[p+1] - parts.offsets[p];
+        cudaErrchk( cudaSetDevice(parts.devices[p]) );
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(part_len, block_size);
+        constexpr size_t shmem = 0;
+        triad<Data_type, block_size><<<grid_size, block_size, shmem, parts.streams[p]>>>(
+            a_chunks[p], b_chunks[p], c_chunks[p], alpha, part_len );
+        cudaErrchk( cudaGetLastError() );
+      }
+
+    }
+    detail::synchronizeCudaPartitions(parts);
+    stopTimer();
+
+    detail::gatherCudaPartitions(parts, a_chunks, a);
+    detail::freeCudaPartitions(parts, a_chunks);
+    detail::freeCudaPartitions(parts, b_chunks);
+    detail::freeCudaPartitions(parts, c_chunks);
+    detail::destroyCudaPartitions(parts);
+
+  } else if ( vid == Base_CUDA ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      triad<block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( a, b, c, alpha,
+      triad<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>( a, b, c, alpha,
                                         iend );
       cudaErrchk( cudaGetLastError() );
 
@@ -79,7 +136,7 @@ void TRIAD::runCudaVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         TRIAD_BODY;
       });
@@ -92,7 +149,72 @@ void TRIAD::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(TRIAD, Cuda)
+template < typename Data_type, size_t block_size >
+void TRIAD::runCudaVariantNontemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  TRIAD_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      triad_nontemporal<Data_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          a, b, c, alpha, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  TRIAD : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_NONTEMPORAL_TUNING_DEFINE_TYPED_BOILERPLATE(TRIAD, Cuda, Base_CUDA, RAJA_CUDA)
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(TRIAD, Cuda)
+
+template < typename Data_type, typename Storage_type >
+void TRIAD::runCudaVariantStorage(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getCudaResource()};
+
+  TRIAD_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      triad_storage<Data_type, Storage_type, block_size><<<grid_size, block_size, shmem, res.get_stream()>>>(
+          a, b, c, alpha, iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  TRIAD : Unknown Cuda storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_STORAGE_RUN_BOILERPLATE(TRIAD, Cuda)
 
 } // end namespace stream
 } // end namespace rajaperf
@@ -13,6 +13,9 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include "common/HipDataUtils.hpp"
+#include "common/LaunchUtils.hpp"
+#include "common/NontemporalUtils.hpp"
+#include "common/StorageUtils.hpp"
 
 #include <iostream>
 
@@ -21,9 +24,9 @@ namespace rajaperf
 namespace stream
 {
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
 __launch_bounds__(block_size)
-__global__ void triad(Real_ptr a, Real_ptr b, Real_ptr c, Real_type alpha,
+__global__ void triad(Data_type* a, Data_type* b, Data_type* c, Data_type alpha,
                       Index_type iend)
 {
   Index_type i = blockIdx.x * block_size + threadIdx.x;
@@ -33,7 +36,30 @@ __global__ void triad(Real_ptr a, Real_ptr b, Real_ptr c, Real_type alpha,
 }
 
 
-template < size_t block_size >
+template < typename Data_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void triad_nontemporal(Data_type* a, Data_type* b, Data_type* c, Data_type alpha,
+                                  Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    TRIAD_BODY_NONTEMPORAL;
+  }
+}
+
+template < typename Data_type, typename Storage_type, size_t block_size >
+__launch_bounds__(block_size)
+__global__ void triad_storage(Storage_type* a, Storage_type* b, Storage_type* c,
+                              Data_type alpha,
+                              Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    TRIAD_STORAGE_BODY;
+  }
+}
+
+template < typename Data_type, size_t block_size, bool launch >
 void TRIAD::runHipVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
@@ -44,14 +70,45 @@ void TRIAD::runHipVariantImpl(VariantID vid)
 
   TRIAD_DATA_SETUP;
 
-  if ( vid == Base_HIP ) {
+  if ( vid == Base_HIP && run_params.getMultiGPU() ) {
+
+    // each device owns a chunk of the arrays, copied outside the timer
+    auto parts = detail::makeHipPartitions(iend);
+    auto a_chunks = detail::scatterHipPartitions(parts, a);
+    auto b_chunks = detail::scatterHipPartitions(parts, b);
+    auto c_chunks = detail::scatterHipPartitions(parts, c);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (size_t p = 0; p < parts.devices.size(); ++p) {
+        const Index_type part_len = parts.offsets[p+1] - parts.offsets[p];
+        hipErrchk( hipSetDevice(parts.devices[p]) );
+        const size_t grid_size = RAJA_DIVIDE_CEILING_INT(part_len, block_size);
+        constexpr size_t shmem = 0;
+        hipLaunchKernelGGL((triad<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, parts.streams[p],
+            a_chunks[p], b_chunks[p], c_chunks[p], alpha, part_len );
+        hipErrchk( hipGetLastError() );
+      }
+
+    }
+    detail::synchronizeHipPartitions(parts);
+    stopTimer();
+
+    detail::gatherHipPartitions(parts, a_chunks, a);
+    detail::freeHipPartitions(parts, a_chunks);
+    detail::freeHipPartitions(parts, b_chunks);
+    detail::freeHipPartitions(parts, c_chunks);
+    detail::destroyHipPartitions(parts);
+
+  } else if ( vid == Base_HIP ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
       const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
       constexpr size_t shmem = 0;
-      hipLaunchKernelGGL((triad<block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  a, b, c, alpha,
+      hipLaunchKernelGGL((triad<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),  a, b, c, alpha,
                                         iend );
       hipErrchk( hipGetLastError() );
 
@@ -81,7 +138,7 @@ void TRIAD::runHipVariantImpl(VariantID vid)
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >( res,
+      gpu_launch::forall< block_size, launch >( res,
         RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
         TRIAD_BODY;
       });
@@ -94,7 +151,72 @@ void TRIAD::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BOILERPLATE(TRIAD, Hip)
+template < typename Data_type, size_t block_size >
+void TRIAD::runHipVariantNontemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  TRIAD_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((triad_nontemporal<Data_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+          a, b, c, alpha, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  TRIAD : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_NONTEMPORAL_TUNING_DEFINE_TYPED_BOILERPLATE(TRIAD, Hip, Base_HIP, RAJA_HIP)
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(TRIAD, Hip)
+
+template < typename Data_type, typename Storage_type >
+void TRIAD::runHipVariantStorage(VariantID vid)
+{
+  constexpr size_t block_size = default_gpu_block_size;
+  setBlockSize(block_size);
+
+  const Index_type run_reps = getRunReps();
+  const Index_type iend = getActualProblemSize();
+
+  auto res{getHipResource()};
+
+  TRIAD_STORAGE_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      constexpr size_t shmem = 0;
+      hipLaunchKernelGGL((triad_storage<Data_type, Storage_type, block_size>), dim3(grid_size), dim3(block_size), shmem, res.get_stream(),
+          a, b, c, alpha, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+  } else {
+      getCout() << "\n  TRIAD : Unknown Hip storage variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_FLOATING_POINT_DATA_TYPE_STORAGE_RUN_BOILERPLATE(TRIAD, Hip)
 
 } // end namespace stream
 } // end namespace rajaperf
@@ -26,23 +26,145 @@ namespace stream
   //
   const size_t threads_per_team = 256;
 
-void TRIAD::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void TRIAD::runOpenMPTargetVariantMapped(VariantID vid, size_t tune_idx)
 {
   const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
   TRIAD_DATA_SETUP;
 
-  if ( vid == Base_OpenMPTarget ) {
+  const omp_target_map::Strategy strategy = omp_target_map::getStrategy(tune_idx);
+
+  if ( strategy == omp_target_map::Strategy::NoWait ) {
 
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      #pragma omp target is_device_ptr(a, b, c) device( did )
-      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
-      for (Index_type i = ibegin; i < iend; ++i ) {
-        TRIAD_BODY;
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(a, b, c) device( did ) nowait depend(inout: a[0])
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRIAD_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(a, b, c) device( did ) nowait depend(inout: a[0])
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRIAD_BODY;
+        }
+      }
+
+    }
+    #pragma omp taskwait
+    stopTimer();
+
+    return;
+  }
+
+  //
+  // The other strategies map host arrays, the arrays are moved back to the
+  // device for the checksum.
+  //
+  {
+    auto a_host = scopedMoveData(a, iend, vid);
+    auto b_host = scopedMoveData(b, iend, vid);
+    auto c_host = scopedMoveData(c, iend, vid);
+
+    if ( strategy == omp_target_map::Strategy::EnterData ) {
+
+      #pragma omp target enter data map(to: a[0:iend], b[0:iend], c[0:iend]) device( did )
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        // the arrays are present, so these maps copy nothing
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target map(tofrom: a[0:iend]) map(to: b[0:iend], c[0:iend]) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            TRIAD_BODY;
+          }
+        } else {
+          #pragma omp target map(tofrom: a[0:iend]) map(to: b[0:iend], c[0:iend]) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            TRIAD_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      #pragma omp target exit data map(from: a[0:iend]) map(release: b[0:iend], c[0:iend]) device( did )
+
+    } else if ( strategy == omp_target_map::Strategy::MapToFrom ) {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( omp_num_teams > 0 ) {
+          #pragma omp target map(tofrom: a[0:iend]) map(to: b[0:iend], c[0:iend]) device( did )
+          #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            TRIAD_BODY;
+          }
+        } else {
+          #pragma omp target map(tofrom: a[0:iend]) map(to: b[0:iend], c[0:iend]) device( did )
+          #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            TRIAD_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+    } else {
+      getCout() << "\n  TRIAD : Unknown OMP Target mapping tuning = " << tune_idx << std::endl;
+    }
+  }
+  m_a = a;
+  m_b = b;
+  m_c = c;
+}
+
+template < typename Data_type >
+void TRIAD::runOpenMPTargetVariantTyped(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+  const int omp_thread_limit = getOpenMPTargetThreadLimit(threads_per_team);
+  const int omp_num_teams = getOpenMPTargetNumTeams();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRIAD_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget &&
+       omp_target_map::getStrategy(tune_idx) != omp_target_map::Strategy::DevicePtr ) {
+
+    runOpenMPTargetVariantMapped<Data_type>(vid, tune_idx);
+
+  } else if ( vid == Base_OpenMPTarget ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      if ( omp_num_teams > 0 ) {
+        #pragma omp target is_device_ptr(a, b, c) device( did )
+        #pragma omp teams distribute parallel for num_teams(omp_num_teams) thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRIAD_BODY;
+        }
+      } else {
+        #pragma omp target is_device_ptr(a, b, c) device( did )
+        #pragma omp teams distribute parallel for thread_limit(omp_thread_limit) schedule(static, 1)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRIAD_BODY;
+        }
       }
 
     }
@@ -66,6 +188,19 @@ void TRIAD::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
   }
 }
 
+RAJAPERF_FLOATING_POINT_DATA_TYPE_RUN_BOILERPLATE(TRIAD, OpenMPTarget)
+
+void TRIAD::setOpenMPTargetTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, omp_target_map::getTuningName(omp_target_map::Strategy::DevicePtr));
+
+  if ( vid == Base_OpenMPTarget ) {
+    for (omp_target_map::Strategy strategy : omp_target_map::getMappedStrategies()) {
+      addVariantTuningName(vid, omp_target_map::getTuningName(strategy));
+    }
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
 
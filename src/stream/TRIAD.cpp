@@ -38,6 +38,12 @@ TRIAD::TRIAD(const RunParams& params)
 
   setUsesFeature( Forall );
 
+  setHasPattern( Streaming );
+
+  setUsesFloatingPointDataTypes();
+
+  setUsesStoragePrecisions();
+
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
@@ -46,6 +52,8 @@ TRIAD::TRIAD(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
+  setUsesOpenMPTargetThreadLimit();
+  setUsesOpenMPTargetNumTeams();
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
@@ -57,6 +65,9 @@ TRIAD::TRIAD(const RunParams& params)
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
 
+  setVariantDefined( Base_SYCL );
+  setVariantDefined( RAJA_SYCL );
+
   setVariantDefined( Kokkos_Lambda );
 }
 
@@ -64,25 +75,59 @@ TRIAD::~TRIAD()
 {
 }
 
-void TRIAD::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRIAD::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-  allocAndInitData(m_c, getActualProblemSize(), vid);
-  initData(m_alpha, vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), setUpTyped, vid, tune_idx);
 }
 
 void TRIAD::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_a, getActualProblemSize(), checksum_scale_factor , vid);
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), updateChecksumTyped, vid, tune_idx);
+}
+
+void TRIAD::tearDown(VariantID vid, size_t tune_idx)
+{
+  RAJAPERF_FLOATING_POINT_DATA_TYPE_DISPATCH(getDataType(vid, tune_idx), tearDownTyped, vid, tune_idx);
+}
+
+template < typename Data_type >
+void TRIAD::setUpTyped(VariantID vid, size_t tune_idx)
+{
+  Data_type* a;
+  Data_type* b;
+  Data_type* c;
+  allocAndInitDataConst(a, getActualProblemSize(), Data_type(0), vid);
+  allocAndInitData(b, getActualProblemSize(), vid);
+  allocAndInitData(c, getActualProblemSize(), vid);
+  convertDataToStorage(a, getActualProblemSize(), vid, tune_idx);
+  convertDataToStorage(b, getActualProblemSize(), vid, tune_idx);
+  convertDataToStorage(c, getActualProblemSize(), vid, tune_idx);
+  initData(m_alpha, vid);
+  m_a = a;
+  m_b = b;
+  m_c = c;
+}
+
+template < typename Data_type >
+void TRIAD::updateChecksumTyped(VariantID vid, size_t tune_idx)
+{
+  Data_type* a = static_cast<Data_type*>(m_a);
+  convertDataFromStorage(a, getActualProblemSize(), vid, tune_idx);
+  checksum[vid][tune_idx] += calcChecksum(a, getActualProblemSize(), checksum_scale_factor , vid);
 }
 
-void TRIAD::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type >
+void TRIAD::tearDownTyped(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  (void) vid;
-  deallocData(m_a, vid);
-  deallocData(m_b, vid);
-  deallocData(m_c, vid);
+  Data_type* a = static_cast<Data_type*>(m_a);
+  Data_type* b = static_cast<Data_type*>(m_b);
+  Data_type* c = static_cast<Data_type*>(m_c);
+  deallocData(a, vid);
+  deallocData(b, vid);
+  deallocData(c, vid);
+  m_a = nullptr;
+  m_b = nullptr;
+  m_c = nullptr;
 }
 
 } // end namespace stream
@@ -13,21 +13,42 @@
 ///   a[i] = b[i] + alpha * c[i] ;
 /// }
 ///
+/// The nontemporal tunings write a with non-temporal stores, which do not
+/// read the lines they write, so the traffic is the bytes per rep counted.
+///
+/// The storage tunings keep the arrays in fp32 or bf16 and compute in the
+/// data type of the tuning, see common/StorageUtils.hpp.
+///
 
 #ifndef RAJAPerf_Stream_TRIAD_HPP
 #define RAJAPerf_Stream_TRIAD_HPP
 
 #define TRIAD_DATA_SETUP \
-  Real_ptr a = m_a; \
-  Real_ptr b = m_b; \
-  Real_ptr c = m_c; \
-  Real_type alpha = m_alpha;
+  Data_type* a = static_cast<Data_type*>(m_a); \
+  Data_type* b = static_cast<Data_type*>(m_b); \
+  Data_type* c = static_cast<Data_type*>(m_c); \
+  Data_type alpha = static_cast<Data_type>(m_alpha);
 
 #define TRIAD_BODY  \
   a[i] = b[i] + alpha * c[i] ;
 
+#define TRIAD_BODY_NONTEMPORAL  \
+  storeNontemporal(&a[i], b[i] + alpha * c[i]);
+
+#define TRIAD_STORAGE_DATA_SETUP \
+  Storage_type* a = static_cast<Storage_type*>(m_a); \
+  Storage_type* b = static_cast<Storage_type*>(m_b); \
+  Storage_type* c = static_cast<Storage_type*>(m_c); \
+  Data_type alpha = static_cast<Data_type>(m_alpha);
+
+#define TRIAD_STORAGE_BODY  \
+  a[i] = storage::store<Storage_type>( \
+      static_cast<Data_type>(storage::load(b[i])) + \
+      alpha * static_cast<Data_type>(storage::load(c[i])) ) ;
+
 
 #include "common/KernelBase.hpp"
+#include "common/DataTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -53,22 +74,84 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runSyclVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  template < typename Data_type >
+  void setUpTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void updateChecksumTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void tearDownTyped(VariantID vid, size_t tune_idx);
+
+  template < typename Data_type >
+  void runSeqVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runSyclVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPTargetVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runKokkosVariantTyped(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  void setSyclTuningDefinitions(VariantID vid);
+  void setOpenMPTargetTuningDefinitions(VariantID vid);
+  template < typename Data_type >
+  void runSeqVariantSimd(VariantID vid);
+  template < typename Data_type >
+  void runSeqVariantNontemporal(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantNontemporal(VariantID vid);
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < typename Data_type, size_t block_size >
+  void runCudaVariantNontemporal(VariantID vid);
+  template < typename Data_type, size_t block_size, bool launch = false >
   void runHipVariantImpl(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runHipVariantNontemporal(VariantID vid);
+  template < typename Data_type, size_t block_size >
+  void runSyclVariantImpl(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPTargetVariantMapped(VariantID vid, size_t tune_idx);
+
+  void runSeqStorageVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPStorageVariant(VariantID vid, size_t tune_idx);
+  void runCudaStorageVariant(VariantID vid, size_t tune_idx);
+  void runHipStorageVariant(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runSeqStorageVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runOpenMPStorageVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runCudaStorageVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type >
+  void runHipStorageVariantTyped(VariantID vid, size_t tune_idx);
+  template < typename Data_type, typename Storage_type >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename Data_type, typename Storage_type >
+  void runOpenMPVariantStorage(VariantID vid);
+  template < typename Data_type, typename Storage_type >
+  void runCudaVariantStorage(VariantID vid);
+  template < typename Data_type, typename Storage_type >
+  void runHipVariantStorage(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
-  Real_ptr m_a;
-  Real_ptr m_b;
-  Real_ptr m_c;
+  void* m_a; // array of Data_type
+  void* m_b; // array of Data_type
+  void* m_c; // array of Data_type
   Real_type m_alpha;
 };
 